@@ -0,0 +1,5 @@
+import __version__
+__version__ = __version__.ver
+
+__author__ = "Karl MacMillan, Michael Droettboom, Ichiro Fujinaga, Christoph Dalitz"
+ 
@@ -0,0 +1,2 @@
+ver = '3.4.0'
+
@@ -0,0 +1,650 @@
+# -*- mode: python; indent-tabs-mode: nil; tab-width: 3 -*-
+# vim: set tabstop=3 shiftwidth=3 expandtab:
+#
+# Copyright (C) 2001-2005 Ichiro Fujinaga, Michael Droettboom, Karl MacMillan
+#               2010      Christoph Dalitz
+#
+# This program is free software; you can redistribute it and/or
+# modify it under the terms of the GNU General Public License
+# as published by the Free Software Foundation; either version 2
+# of the License, or (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program; if not, write to the Free Software
+# Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+#
+
+import os
+import sys
+from distutils.core import Extension
+from distutils.dep_util import newer
+from gamera import pyplate
+from gamera.args import ImageType
+
+# this is not used directly, but is needed to support type conversions
+# between Python and C++
+from gamera import args_wrappers
+
+global std_import
+global plugins_to_ignore
+
+
+# magic_import and magic_import_setup
+#
+# This allows us to ignore a list of modules passed into
+# magic_import_setup. generate_plugin uses this to prevent
+# the loading of C++ modules that may not exist yet during
+# the build process.
+def magic_import(name, globals_={}, locals_={}, fromlist=[], level=-1):
+    global plugins_to_ignore
+    global std_import
+
+    if fromlist != None and "core" in fromlist:
+        fromlist = list(fromlist)
+        fromlist.remove("core")
+
+    for x in plugins_to_ignore:
+        if name == x:
+            return None
+
+    if float(sys.version[0:3]) < 2.45:
+        return std_import(name, globals_, locals_, fromlist)
+    else:
+        return std_import(name, globals_, locals_, fromlist, level)
+
+
+def magic_import_setup(ignore):
+    global plugins_to_ignore
+    global std_import
+    plugins_to_ignore = ignore
+    # Save the standard __import__ function so we can chain to it
+    std_import = __builtins__['__import__']
+    # Override the __import__ function with our new one
+    __builtins__['__import__'] = magic_import
+
+
+def restore_import():
+    global std_import
+    __builtins__['__import__'] = std_import
+
+
+template = pyplate.Template("""
+  [[exec import os]]
+  [[exec from gamera.enums import GREYSCALE, GREY16, RGB]]
+  [[ exec from gamera.plugin import PluginFunction, PluginModule ]]
+  [[exec from gamera.args import ImageType, Class, Real ]]
+  [[exec from gamera.util import get_pixel_type_name]]
+
+  [[# This should be included first in order to avoid libpng.h/setjmp.h problems. #]]
+  [[if module.__class__.__name__ == "PngSupportModule"]]
+    #include <png.h>
+  [[end]]
+
+  #include \"gameramodule.hpp\"
+  #include \"knnmodule.hpp\"
+  #include \"plugin_stats.hpp\"
+
+  [[# include the headers that the module needs #]]
+  [[for header in module.cpp_headers]]
+    #include \"[[header]]\"
+  [[end]]
+
+  [[# Standard headers used in the plugins #]]
+  #include <string>
+  #include <stdexcept>
+  #include \"Python.h\"
+  #include <list>
+
+  using namespace Gamera;
+  [[for x in module.cpp_namespaces]]
+    using namespace [[x]];
+  [[end]]
+
+  [[# Generate the plugin path and module name from the filename. #]]
+  [[# The module name for our purposes will be prefixed with an underscore #]]
+  [[exec plug_path, filename = os.path.split(__file__)]]
+  [[exec module_name = '_' + filename.split('.')[0] ]]
+
+  [[# Declare all of the functions - because this is a C++ file we have to #]]
+  [[# declare the functions as C functions so that Python can access them #]]
+  extern \"C\" {
+#ifndef _MSC_VER
+    void init[[module_name]](void);
+#endif
+    static PyObject* call_plugin_stats(PyObject* self, PyObject* args);
+    static PyObject* call_reset_plugin_stats(PyObject* self, PyObject* args);
+    [[for function in module.functions]]
+      [[if not function.pure_python]]
+        static PyObject* call_[[function.__name__]](PyObject* self, PyObject* args);
+        [[if function.batch]]
+          static PyObject* call_[[function.__name__]]_batch(PyObject* self, PyObject* args);
+        [[end]]
+      [[end]]
+    [[end]]
+  }
+
+  [[# Create the list of methods for the module - the name of the function #]]
+  [[# is derived from the name of the class implementing the function - #]]
+  [[# also, the function name is prepended with call_ so that there are no clashes #]]
+  [[# with the real plugin functions #]]
+  static PyMethodDef [[module_name]]_methods[] = {
+    [[for function in module.functions]]
+      [[if not function.pure_python]]
+        { CHAR_PTR_CAST \"[[function.__name__]]\",
+          call_[[function.__name__]], METH_VARARGS,
+          CHAR_PTR_CAST [[function.escape_docstring()]]
+        },
+        [[if function.batch]]
+          { CHAR_PTR_CAST \"[[function.__name__]]_batch\",
+            call_[[function.__name__]]_batch, METH_VARARGS,
+            CHAR_PTR_CAST \"Calls [[function.__name__]] on each image of a list and returns the list of results.\"
+          },
+        [[end]]
+      [[end]]
+    [[end]]
+    { CHAR_PTR_CAST \"_plugin_stats\",
+      call_plugin_stats, METH_VARARGS,
+      CHAR_PTR_CAST \"Returns the execution statistics (events=0) or the trace (events=1) of the plugins in this module.\"
+    },
+    { CHAR_PTR_CAST \"_reset_plugin_stats\",
+      call_reset_plugin_stats, METH_VARARGS,
+      CHAR_PTR_CAST \"Clears the execution statistics of the plugins in this module.\"
+    },
+    { NULL }
+  };
+
+  [[# The execution statistics of the wrappers in this module #]]
+  static PluginStats plugin_stats;
+
+  static PyObject* call_plugin_stats(PyObject* self, PyObject* args) {
+    int events = 0;
+    if (PyArg_ParseTuple(args, CHAR_PTR_CAST \"|i:_plugin_stats\", &events) <= 0)
+      return 0;
+    if (events)
+      return plugin_stats.events_to_python();
+    return plugin_stats.entries_to_python();
+  }
+
+  static PyObject* call_reset_plugin_stats(PyObject* self, PyObject* args) {
+    plugin_stats.clear();
+    Py_INCREF(Py_None);
+    return Py_None;
+  }
+
+  [[# Each module can declare several functions so we loop through and generate wrapping #]]
+  [[# code for each function #]]
+  [[for function in module.functions]]
+    [[if not function.pure_python]]
+      static PyObject* call_[[function.__name__]](PyObject* self, PyObject* args) {
+      [[# this holds the self argument - note that the self passed into the function will #]]
+      [[# be Null because this functions is not actually bound to an object #]]
+
+      PyErr_Clear();
+      [[if function.self_type == None]]
+        [[exec args = function.args.list]]
+      [[else]]
+        [[exec args = [function.self_type] + function.args.list]]
+        [[exec function.self_type.name = 'self']]
+      [[end]]
+      [[# for each argument insert the appropriate conversion code into the string that will #]]
+      [[# be passed to PyArg_ParseTuple and create a variable to hold the result. #]]
+      [[if function.return_type != None]]
+        [[exec function.return_type.name = 'return']]
+        [[exec function.return_type.convert_from_PyObject = True]]
+        [[if not function.feature_function]]
+          [[function.return_type.declare()]]
+        [[end]]
+      [[end]]
+      [[exec pyarg_format = '']]
+      [[for arg in args]]
+        [[exec pyarg_format += arg.arg_format]]
+        [[arg.declare()]]
+      [[end]]
+
+      [[# Now that we have all of the arguments and variables for them we can parse #]]
+      [[# the argument tuple. #]]
+      [[if function.feature_function]]
+         int offset = -1;
+         if (PyArg_ParseTuple(args, CHAR_PTR_CAST \"O|i:[[function.__name__]]\",&[[function.self_type.pysymbol]], &offset) <= 0)
+           return 0;
+      [[else]]
+         [[if pyarg_format != '']]
+           if (PyArg_ParseTuple(args, CHAR_PTR_CAST \"[[pyarg_format]]:[[function.__name__]]\"
+           [[for arg in args]]
+             ,
+             &[[arg.pysymbol]]
+           [[end]]
+           ) <= 0)
+           return 0;
+         [[end]]
+      [[end]]
+
+      [[for arg in args]]
+        [[arg.from_python()]]
+      [[end]]
+
+      [[# the image types are determined before the GIL is released #]]
+      [[if function.release_gil]]
+        [[for arg in args]]
+          [[if isinstance(arg, ImageType)]]
+            int [[arg.symbol]]_combination = get_image_combination([[arg.pysymbol]]);
+          [[end]]
+        [[end]]
+      [[end]]
+
+      PluginStatsCall stats_call;
+      [[for arg in args]]
+        [[if isinstance(arg, ImageType)]]
+          stats_call.add_image([[arg.symbol]]);
+        [[end]]
+      [[end]]
+      [[if isinstance(function.self_type, ImageType)]]
+        [[exec stats_pixel_type = "get_pixel_type(%s)" % function.self_type.pysymbol]]
+      [[else]]
+        [[exec stats_pixel_type = "-1"]]
+      [[end]]
+
+      [[if function.feature_function]]
+         feature_t* feature_buffer = 0;
+         if (offset < 0) {
+           feature_buffer = new feature_t[ [[function.return_type.length]] ];
+         } else {
+           if (self_arg->features_len < offset + [[function.return_type.length]]) {
+             PyErr_Format(PyExc_ValueError, \"Offset as given (%d) will cause data to be written outside of array of length (%d).  Perhaps the feature array is not initialised?\", offset, (int)self_arg->features_len);
+             return 0;
+           }
+           feature_buffer = self_arg->features + offset;
+         }
+         stats_call.start();
+         [[args[0].call(function, args[1:], [])]]
+         stats_call.stop();
+         stats_call.record(plugin_stats, \"[[function.__name__]]\", [[stats_pixel_type]]);
+      [[else]]
+        [[# With release_gil, the interpreter lock is released during the call of the #]]
+        [[# C++ function; error paths inside the call reacquire it with Py_BLOCK_THREADS #]]
+        [[if function.release_gil]]
+          Py_BEGIN_ALLOW_THREADS
+        [[end]]
+        stats_call.start();
+        try {
+          [[if len(args)]]
+            [[args[0].call(function, args[1:], [])]]
+          [[else]]
+            [[if function.return_type != None]]
+              [[function.return_type.symbol]] =
+            [[end]]
+            [[function.__name__]]([[if function.progress_bar]]ProgressBar("[[function.progress_bar]]")[[else]][[end]]);
+          [[end]]
+        } catch (std::exception& e) {
+          [[if function.release_gil]]
+            Py_BLOCK_THREADS
+          [[end]]
+          PyErr_SetString(PyExc_RuntimeError, e.what());
+          return 0;
+        }
+        stats_call.stop();
+        [[if function.release_gil]]
+          Py_END_ALLOW_THREADS
+        [[end]]
+        [[if function.return_type != None]]
+          stats_call.add_result([[function.return_type.symbol]]);
+        [[end]]
+        stats_call.record(plugin_stats, \"[[function.__name__]]\", [[stats_pixel_type]]);
+      [[end]]
+
+      [[if function.feature_function]]
+         if (offset < 0) {
+           PyObject* str = PyString_FromStringAndSize((char*)feature_buffer, [[function.return_type.length]] * sizeof(feature_t));
+           if (str != 0) {
+              [[# This is pretty expensive, but simple #]]
+              PyObject* array_init = get_ArrayInit();
+              if (array_init == 0)
+                return 0;
+              PyObject* array = PyObject_CallFunction(
+                    array_init, (char *)\"sO\", (char *)\"d\", str);
+              Py_DECREF(str);
+              delete[] feature_buffer;
+              return array;
+           } else {
+             delete[] feature_buffer;
+             return 0;
+           }
+         } else {
+           Py_INCREF(Py_None);
+           return Py_None;
+         }
+      [[else]]
+        [[for arg in function.args]]
+          [[arg.delete()]]
+        [[end]]
+        [[if function.return_type == None]]
+          Py_INCREF(Py_None);
+          return Py_None;
+        [[else]]
+          [[if isinstance(function.return_type, (ImageType, Class))]]
+            if ([[function.return_type.symbol]] == NULL) {
+              if (PyErr_Occurred() == NULL) {
+                Py_INCREF(Py_None);
+                return Py_None;
+               } else
+                return NULL;
+            } else {
+              [[function.return_type.to_python()]]
+              return return_pyarg;
+            }
+          [[else]]
+            [[function.return_type.to_python()]]
+            return return_pyarg;
+          [[end]]
+        [[end]]
+      [[end]]
+      }
+
+      [[# The batch variant takes a list of images instead of the self argument. #]]
+      [[# The other arguments are converted only once, and the C++ function is #]]
+      [[# called for each image in a loop, which runs in parallel with OpenMP when #]]
+      [[# the function releases the GIL. Feature functions return one array with #]]
+      [[# the features of all images, the others a list of the results. #]]
+      [[if function.batch]]
+        static PyObject* call_[[function.__name__]]_batch(PyObject* self, PyObject* args) {
+        PyErr_Clear();
+        [[exec args = function.args.list]]
+        [[exec returns_value = function.return_type != None and not function.feature_function]]
+        [[if returns_value]]
+          [[function.return_type.declare()]]
+          [[exec result_type = getattr(function.return_type, 'return_type', function.return_type.c_type)]]
+          [[exec result_typedef = "typedef %s batch_result_t;" % result_type]]
+          [[result_typedef]]
+        [[end]]
+        PyObject* images_pyarg;
+        [[exec pyarg_format = 'O']]
+        [[for arg in args]]
+          [[exec pyarg_format += arg.arg_format]]
+          [[arg.declare()]]
+        [[end]]
+        if (PyArg_ParseTuple(args, CHAR_PTR_CAST \"[[pyarg_format]]:[[function.__name__]]_batch\",
+                             &images_pyarg
+        [[for arg in args]]
+          ,
+          &[[arg.pysymbol]]
+        [[end]]
+        ) <= 0)
+          return 0;
+
+        [[for arg in args]]
+          [[arg.from_python()]]
+        [[end]]
+
+        [[# the sequence holds the images until all calls are done #]]
+        PyObject* images_seq = PySequence_Fast(images_pyarg, \"Argument 'images' must be an iterable of images.\");
+        if (images_seq == NULL)
+          return 0;
+        int batch_size = PySequence_Fast_GET_SIZE(images_seq);
+        ImageVector batch_images(batch_size);
+        PluginStatsCall stats_call(true);
+        [[exec choices = function.self_type._get_choices()]]
+        for (int i = 0; i < batch_size; ++i) {
+          PyObject* image = PySequence_Fast_GET_ITEM(images_seq, i);
+          if (!is_ImageObject(image)) {
+            PyErr_SetString(PyExc_TypeError, \"Argument 'images' must be an iterable of images.\");
+            Py_DECREF(images_seq);
+            return 0;
+          }
+          int combination = get_image_combination(image);
+          switch (combination) {
+          [[for choice, pixel_type in choices]]
+            case [[choice.upper()]]:
+          [[end]]
+            break;
+          default:
+            [[function.self_type.type_error(function.__name__ + "_batch", "images", choices, "image")]]
+            Py_DECREF(images_seq);
+            return 0;
+          }
+          batch_images[i] = std::pair<Image*, int>((Image*)((RectObject*)image)->m_x, combination);
+          image_get_fv(image, &batch_images[i].first->features,
+                       &batch_images[i].first->features_len);
+          stats_call.add_image(batch_images[i].first);
+        }
+        [[# the calls are recorded with the pixel type of the first image #]]
+        int stats_pixel_type = batch_size ? get_pixel_type(PySequence_Fast_GET_ITEM(images_seq, 0)) : -1;
+
+        std::string batch_error;
+        [[if function.feature_function]]
+          feature_t* batch_features = new feature_t[batch_size * [[function.return_type.length]] ];
+        [[elif returns_value]]
+          std::vector<batch_result_t> batch_results(batch_size);
+        [[end]]
+        [[if function.release_gil]]
+          Py_BEGIN_ALLOW_THREADS
+        [[end]]
+        stats_call.start();
+        [[if function.release_gil]]
+          #ifdef _OPENMP
+          #pragma omp parallel for schedule(dynamic)
+          #endif
+        [[end]]
+        for (int i = 0; i < batch_size; ++i) {
+          Image* self_arg = batch_images[i].first;
+          [[if function.feature_function]]
+            feature_t* feature_buffer = batch_features + i * [[function.return_type.length]];
+          [[elif returns_value]]
+            batch_result_t [[function.return_type.symbol]] = batch_result_t();
+          [[end]]
+          try {
+            switch (batch_images[i].second) {
+            [[for choice, pixel_type in choices]]
+              case [[choice.upper()]]:
+              [[exec output_args = ["*((%s*)self_arg)" % choice] ]]
+              [[if len(args)]]
+                [[args[0].call(function, args[1:], output_args, pixel_type)]]
+              [[else]]
+                [[function.self_type._do_call(function, output_args)]]
+              [[end]]
+              break;
+            [[end]]
+            default:
+              break;
+            }
+          } catch (std::exception& e) {
+            [[if function.release_gil]]
+              #ifdef _OPENMP
+              #pragma omp critical
+              #endif
+            [[end]]
+            if (batch_error.empty())
+              batch_error = e.what();
+          }
+          [[if returns_value]]
+            batch_results[i] = [[function.return_type.symbol]];
+          [[end]]
+        }
+        stats_call.stop();
+        [[if function.release_gil]]
+          Py_END_ALLOW_THREADS
+        [[end]]
+        Py_DECREF(images_seq);
+        [[if returns_value]]
+          for (int i = 0; i < batch_size; ++i)
+            stats_call.add_result(batch_results[i]);
+        [[end]]
+        stats_call.record(plugin_stats, \"[[function.__name__]]_batch\", stats_pixel_type);
+
+        [[for arg in function.args]]
+          [[arg.delete()]]
+        [[end]]
+        [[if function.feature_function]]
+          PyObject* batch_pyresult = 0;
+          if (batch_error.empty()) {
+            PyObject* str = PyString_FromStringAndSize((char*)batch_features, batch_size * [[function.return_type.length]] * sizeof(feature_t));
+            if (str != 0) {
+              PyObject* array_init = get_ArrayInit();
+              if (array_init != 0)
+                batch_pyresult = PyObject_CallFunction(
+                      array_init, (char *)\"sO\", (char *)\"d\", str);
+              Py_DECREF(str);
+            }
+          }
+          delete[] batch_features;
+        [[elif returns_value]]
+          [[# the results are also converted after an error, so that they are freed #]]
+          PyObject* batch_pyresult = PyList_New(batch_size);
+          if (batch_pyresult == 0)
+            return 0;
+          for (int i = 0; i < batch_size; ++i) {
+            [[function.return_type.symbol]] = batch_results[i];
+            [[if result_type.endswith('*')]]
+              if ([[function.return_type.symbol]] == NULL) {
+                Py_INCREF(Py_None);
+                [[function.return_type.pysymbol]] = Py_None;
+              } else {
+                [[function.return_type.to_python()]]
+              }
+            [[else]]
+              [[function.return_type.to_python()]]
+            [[end]]
+            if ([[function.return_type.pysymbol]] == NULL) {
+              Py_DECREF(batch_pyresult);
+              return 0;
+            }
+            PyList_SET_ITEM(batch_pyresult, i, [[function.return_type.pysymbol]]);
+          }
+        [[else]]
+          PyObject* batch_pyresult = Py_None;
+          Py_INCREF(Py_None);
+        [[end]]
+        if (!batch_error.empty()) {
+          Py_XDECREF(batch_pyresult);
+          PyErr_SetString(PyExc_RuntimeError, batch_error.c_str());
+          return 0;
+        }
+        return batch_pyresult;
+        }
+      [[end]]
+    [[end]]
+  [[end]]
+
+  DL_EXPORT(void) init[[module_name]](void) {
+    Py_InitModule(CHAR_PTR_CAST \"[[module_name]]\", [[module_name]]_methods);
+  }
+  """)
+
+
+def check_release_gil(function):
+    """Raises a RuntimeError when the wrapper of a plugin function with
+    release_gil would need the interpreter lock during the call of the C++
+    function: Python objects are passed to or returned from it, or a
+    progress bar is updated."""
+    if not function.release_gil or function.pure_python:
+        return
+    problem = None
+    if function.feature_function:
+        problem = "feature functions"
+    elif function.progress_bar:
+        problem = "functions with a progress bar"
+    else:
+        for arg in function.args.list + [function.return_type]:
+            if arg is not None and arg.__class__.__name__ in ("Class", "Pixel"):
+                problem = "%s arguments or return values" % arg.__class__.__name__
+                break
+    if problem is not None:
+        raise RuntimeError("Plugin function '%s' can not release the GIL: "
+                           "this is not supported for %s" %
+                           (function.__name__, problem))
+
+
+def check_batch(function):
+    """Raises a RuntimeError when the batch variant of a plugin function
+    can not be generated: the list of images replaces the self argument,
+    so there must be one, and the loop over the images can neither
+    convert further image arguments nor update a progress bar."""
+    if not function.batch or function.pure_python:
+        return
+    problem = None
+    if not isinstance(function.self_type, ImageType):
+        problem = "functions without an image as self argument"
+    elif function.progress_bar:
+        problem = "functions with a progress bar"
+    else:
+        for arg in function.args.list:
+            if isinstance(arg, ImageType):
+                problem = "functions with further image arguments"
+                break
+    if problem is not None:
+        raise RuntimeError("Plugin function '%s' can not have a batch "
+                           "variant: this is not supported for %s" %
+                           (function.__name__, problem))
+
+
+def generate_plugin(plugin_filename, location, compiling_gamera,
+                    extra_compile_args=[], extra_link_args=[], libraries=[],
+                    define_macros=[]):
+    from gamera import gamera_setup
+
+    plug_path, filename = os.path.split(plugin_filename)
+    module_name = filename.split('.')[0]
+    cpp_filename = os.path.join(plug_path, "_" + module_name + ".cpp")
+
+    regenerate = False
+    if newer(plugin_filename, cpp_filename) or '-f' in sys.argv:
+        regenerate = True
+
+    sys.path.append(plug_path)
+
+    #import plugin
+    plugin_module = __import__(module_name)
+    if not hasattr(plugin_module, 'module'):
+        return None
+    if plugin_module.module.pure_python:
+        return None
+
+    # see if any of the header files have changed since last time
+    # we compiled
+    include_dirs = (["include", plug_path, "include/plugins"] +
+                    plugin_module.module.cpp_include_dirs)
+    if not compiling_gamera:
+        include_dirs.extend(gamera_setup.get_gamera_include_dirs())
+    if not regenerate:
+        for header in plugin_module.module.cpp_headers:
+            for include_dir in include_dirs:
+                header_filename = os.path.join(include_dir, header)
+                if os.path.exists(header_filename):
+                    if newer(header_filename, cpp_filename):
+                        regenerate = True
+                        break
+                    break
+            if regenerate:
+                break
+
+    if regenerate:
+        print "generating wrappers for", module_name, "plugin"
+        for function in plugin_module.module.functions:
+            check_release_gil(function)
+            check_batch(function)
+        template.execute_file(cpp_filename, plugin_module.__dict__)
+    else:
+        print "skipping wrapper generation for", module_name, "plugin (output up-to-date)"
+
+    # make the a distutils extension class for this plugin
+    cpp_files = [cpp_filename]
+    for file in plugin_module.module.cpp_sources:
+        cpp_files.append(file)
+
+    extra_libraries = plugin_module.module.extra_libraries
+    # This is to make up for a bug in distutils.
+    if '--compiler=mingw32' in sys.argv or not sys.platform == 'win32':
+        if "stdc++" not in extra_libraries:
+            extra_libraries.append("stdc++")
+    return Extension(location + "._" + module_name, cpp_files,
+                     include_dirs=include_dirs,
+                     library_dirs=plugin_module.module.library_dirs,
+                     libraries=extra_libraries,
+                     extra_compile_args=plugin_module.module.extra_compile_args + extra_compile_args,
+                     extra_link_args=plugin_module.module.extra_link_args + extra_link_args,
+                     define_macros=plugin_module.module.define_macros + define_macros,
+                     extra_objects=plugin_module.module.extra_objects)
@@ -0,0 +1,9705 @@
+#----------------------------------------------------------------------
+# This file was generated by convert_images.py
+#
+try:
+   from wx import ImageFromStream, BitmapFromImage
+   wxImageFromStream = ImageFromStream
+   wxBitmapFromImage = BitmapFromImage
+except:
+   from wxPython.wx import wxImageFromStream, wxBitmapFromImage
+import cStringIO, zlib
+
+
+def getComplexVectorData():
+    return zlib.decompress(
+"x\xda\x01\x1a\x02\xe5\xfd\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00 \
+\x00\x00\x00 \x08\x06\x00\x00\x00szz\xf4\x00\x00\x00\x04sBIT\x08\x08\x08\x08\
+|\x08d\x88\x00\x00\x01\xd1IDATX\x85\xed\x961\x8b\xd4@\x18\x86\x9f8\xb2\x88\
+\xa8(\x88\x8a\x08ZZ\x08\x16\x82\x95\x8d\x85\x82\x85b%\xfe\x80+D\x1b\x0bA\xb1\
+\xd1\x7fq\xb6ZX\xa9`'X\x1d\\q\xa5\x85\x0c\x82[\x9c\x9d\x95W\x18/fg2\xaf\xc5N\
+\xd6\xb8$\xd9\xdb\xdd\xac[\xdc\xbd\x102|\xdfL\xde\x87\xf9\x86\xc9\x07{\xda\
+\xedJ\x00\x8a\xa28_\x93\xfbm\x8c\xd9\xec\xc2\xa4(\x8as\xc0\x81\xf1\xb81\xe6K\
+9V\xcd\xb3\xd1\x85y\xd4F\x83\x07\xfb:4\x99II|\xab&\xb6(\xfd\xe35\xd5\x0eXk\
+\x8d\xa4\xdb\xc0K\xc0\x02)P\x00?\x80uIO\x9ds\xa7f\xa5\x1a\xd5\xa5v\x82t\x1d\
+\xf8\x1a\xe7\x14\x92n:\xe7NXkM\x9e\xe7G%]\x03\xde\x03\xdb\x92\x1eM\xeb\xd5\n\
+ \xe9\t\x10b~\r\xf0-\xa0\xf7\xe3\xbc\xe7\x9d\x00HZ\xa9\xe4>\x86\x10.\xb6\x01\
+D\xad\x02o\xe6\x06\x88\xf5Lc|\xdb{\x7f&\x84pa\x12@\\\xf7zn\x00\x86\xdbX\xc6W\
+\x01v\x020AS\xdd\x037F\xab\xa4\xb7s\x986j\x12\xc0\xe8\x8av\xce}Z\x06\xc0\xa1\
+r\xd0\xef\xf7\xb7\x16\x01P\xaa\xe9\x0c\xfc,\xe3y\x9e\x1f\x83\xff\x7f\x066\
+\xcbA\xaf\xd7\xbb<\x87i\xa3&\x01\xac\x97\x83$IV\x16\x01P\xaa\xb6\x04!\x84+\
+\x95x\x90t\xb5\xeb\x12\xb4\x06\xa3>Tr\xdf%\xdd\xda\t\x80\xa4\xbb\x9d\x00x\
+\xefO\x03\xdf*\xf9\xb4\r \xcb\xb2\xc3\xc0+I\x8f;\x01\x00\x18\x0c\x06\xc7\x81\
+\x17@\xce\xdfr\xdc\xf3\xde\x9f\xb5\xd6\x9a4M\x0f\x86\x10.Iz\x06|\x96t\xa7\tp\
+&\x80R\xce\xb9\x93\x92\x1e\x00\xef\x18\xfe\x9a\x7f1\xec\x07\xb6\x805I\x0f\
+\xb3,;\xd2\xf6\x8dq\xaf\xa5wD\xfb\xc7\xb3\x95\x0ey!]\xb11\xa6\x91jwv\xc5{Z\
+\xba\xfe\x00\xd898'\xd5\x9d2\x92\x00\x00\x00\x00IEND\xaeB`\x82\x1fX\xe8\xaa"\
+ )
+
+def getComplexVectorBitmap():
+    return wxBitmapFromImage(getComplexVectorImage())
+
+def getComplexVectorImage():
+    stream = cStringIO.StringIO(getComplexVectorData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getFloatVectorData():
+    return zlib.decompress(
+'x\xda\x01\xee\x01\x11\xfe\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00 \
+\x00\x00\x00 \x08\x06\x00\x00\x00szz\xf4\x00\x00\x00\x04sBIT\x08\x08\x08\x08\
+|\x08d\x88\x00\x00\x01\xa5IDATX\x85\xedV\xbdJ\x03A\x18\x9cd\x8d\x89`\xa5\x18\
+\x04\x1bQD\x1b+\xed\xc4"\x0f\xe0\x1bX\t\x16V>\x80\x9d\x0f\xa2X\xd8\t\x96V\
+\x16b\x13\xb0P,BD\x84\xd8x\x90\xf8C\xce\x90\xe8\x85\xdd\xb1\xf0"\xebrg\xbc\
+\x9f\x9cB2\xb0\xdc\xee\xf7\xcd\xde\xcc\xdd\xee\xde}\xc0\x00\xfd\x8e\x14\x00H\
+)\x17<roB\x88J\x1c"R\xcai\x0093.\x84(w\xfa\xf4h\xc58\xc4]\x14}4\x90\x8eQ$\
+\x14R\xee\x95\x1e\xb1^\xe1\x9b\xd6P\x00\xb2\x1f$\x80\x06\x80\x07\x00\xd7$O\
+\x1d\xc79\xcaf\xb3/A]}\xad\x8b\x11\xbf\xa9\xd7\xeb9\x83C\x92\x05\xcb\xb22\
+\xedv{\x92\xe4\x1a\x80\x13-\xffJr;\x88\xd6O\x06\xca\x1e\x1c\xbf7\xb3o\x98\
+\xdcJ\xd4\x80\x94r\xce\xe0\xdcu3\x10\xeb)\xa8V\xab\x15#4\xd5mN\xac\x06\xf2\
+\xf9\xfc\xac\x11\xba\xfa\xed\xdc\xc8KP*\x95\x04\x80c-\xdfRJ\xad\xfcV+\x94\
+\x01\xcb\xb22R\xca\x19\x92\xeb\x00.\xb4\xdc\xa5Rj)\xc8\xc3\x861P\x03\xf0\xae\
+\x8d\x9f\x00\xec*\xa5V}\x84=\xb5\xa2\xec\x81\t\xa5\xd42\x80\x96;\x1e#y\x9fN\
+\xa7\xcf\xc3\xdc,\xf4\x1e \xb9\xa9\xc5\x1c\x92\x850ZQ7\xe1\xa1\x16\x7f\x96R\
+\xce\'j\xa0\xd9l\x8e\xba\xbcN\xee\xd6q\x9c\xf1\xc4\x0c\x00\x80Rj\x11@S\xcb\
+\x9f\xd5j\xb5\xe1\xc4\x0c\x00\x00\xc9\r\x83s\x90\xa8\x01\x17{:\x8f\xe4N\x14\
+\x03\r\x006\x80G\xb7\xaf7O\xd8\xb6=\x82\xcf\x8fR\x87g\xbb\xbfkO\xad\xffW\x11\
+i\x15rO\xaab!\x84\xaf+\xb3\xf5GU<\xc0\x9f\xe3\x03\x80sb\xe4`\x08B\x08\x00\
+\x00\x00\x00IEND\xaeB`\x82@-\xd1\xf1' )
+
+def getFloatVectorBitmap():
+    return wxBitmapFromImage(getFloatVectorImage())
+
+def getFloatVectorImage():
+    stream = cStringIO.StringIO(getFloatVectorData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getGameraSplashData():
+    return zlib.decompress(
+'x\xda\xd4\xbbeP\x1c_\xf8\xad\x8b\x07\x87\xe0\x12\xdc-0\x10 \xc1%\xb8K\xf0\
+\xe0\xae\x81\xe0.\xc1\xdd\x1d\x02\xc1\xdd!\xb8\x0e\x0e\xc1!\xb8\xbb;\x0c\xcc\
+\xe9\xfc\xfeu\xaan\xd5\xad\xf3\xedV\x9d\xba\t5\x19\x9a\xd0\xbd{\xef\xf7]\xeb\
+Y\xdd=\xe1\xca\x8aR\x18\xa8$\xa8000\x182\xd2\x9fUa``\xbf\xc0\xc0\xc0!#\xc3\
+\x01[TR\x8e\xc6\x81\x7f\xe0\xbf\x8b\xc9\xa8###/o*m\xc0\xc0P\xc2\xc8|\x16Uw\
+\xcf:\xe9\xf0QW\xd7\xcc`oG\xf9\xa0\xf8\xc0\x88\x96\xa4\x9c\xc5,MH\x17hL\xa7\
+\xa7\xd2Y\xe1\xcc\x17\x96}\x94\xae1S\x193q\x9ac9\xcdrN\xea\xc4\xcf\xab\xfd}\
+\x9d\xdf\xed\xaf\xe5\xba\xf6\x0cx\xecf\xac\xc3n\xba^\x8c\xbe\xe2\x95#\xbb\
+\x01\xfbr\x02&\xdb\x99\x0e\x94\xd6\xdf\x1b\x18AT\x10\x15\x88\xc0\xac\xeaR&[N\
+\x8al i\xf6\xfe\x9c\xa2\xab\xca\xa2i_\x9d\x8a\x12U\xeb\xb9Y\xaf\xaa\xaf\xd4\
+\xe7\xcewB\xe8y\xe9yir!f\xb8\t\x9a\x80\x82\x8c\xfc\x99\xee,\xc3\x06\x0e\x01\
+\x01a\x0f=\x10\x8a\x88\x90O\xf8\x7fz\x05\x91\xe7ZTYacc\xa7\x91\xf6\xcb\xcb\
+\xcb\x8fqc\xc0\xc1\xc1}\x87\xa7\x82\xa2!\x7ffG\xf8\xbf\xfa\xba\xb5\x97\xe1o\
+\xd5w|\xff\xe4]\xb7\xfd\x83\x86\x08\xbd\xa9\xa1\x01\x81\x1dq\x10\x0c\xbeP\
+\x13\x13\x13\xfb+h\x95\x9e\x9e\xfe\xe9\xd3\'|RfZ\x19\x87!\x8e\x12\n\xbf\xd3\
+\x8d\x9e\xa2\xa2\xa2_\xe7\x9d~\xcbV\x84\xd8i\x06Z\x1c\x8f\xd0\x0e_\x87\xfaU\
+\xfb\xfa%\xc5\xc6\xec\xa7\x9b\x15\xe2\xd7\xe2\x1b/\xce\x94\xf7\xda\tiiCD\xa4\
+ddd\xa4\xa4\xdf\r\x0e\x06^\x1c\xbcM\x82\xe6\xac\xbfZ\xd4\x1aR\x7fkj<{\xdd<\
+\xc3\x12\x12\x00\x13\x91v]\xf9\xedo\t"\xe4\xc3i\x15\xaet\xd8\x0f\xf8\x984\
+\xc5\x83\x08\\\xcd2pY\xd1_\xab\x05\xf5\xd4\xbe~\xf59\x9a-\xcd\xdbd?0\x7f\x8d\
+\xf8B\xcak\xf7!s\xfc@\r\x9cF{\xe8#\x94\x0e\xda;sY\xb6mr[\xf79\xdf\xa2\xeb\
+\xa2\xf7p\xd4\xb7_k\xe6\xf1\xb5\xb1\xb5\xadh*"P\x83\xc7\x85\xb0\x7f\xb3\xd9\
+\xb8\xf5\x8a\x9d\x9dkln\xce\xb5\xe6\xdf\xbd\xf4\x0c\t\xe9\xfaC\xcb^dp\xde\
+\xc9ot\x98@W\x8e\xa6I\x88\x87g\xbb\xd4\xearf\x11\x10\xfe\x18=\x9f\xc8v\xcc\
+\x9bT\xcc:\x05\x06\x0f\xfe\xe9\xba%\x1d\xb1Y\x13\xd8\xb9\xf4\xb0\x7f8\xa9\
+\x1atc\xce)\xf4k\x0e\xf5\r(\x11\x1b\xcf\x0c\x95\x1d\x95\xb5\x8c\x92A\x92\xe1\
+\x94\x1eu\x92O\x10U\x8d\xed{>\xe3m\xce\xb1M\xd7\r\xdc\xe7\x86R\xb8\x1f\x16\
+\x03\xdb\xbdS\xd9FAd\xc0\xfb\x99\xb2\x82\xbdq\xf1\x08Y`\xeaWP\x05\xa0\xbdB\
+\x1c\x1e#8\xa7O\x18\xbbo\xf4\x9f\xac\x8e\x87\t*T\xc9s\x19N\xac\x93\xea>?C\
+\xd0\x9e\xed[\x12V\xf9\xc6\x0c^\x8b\xd7v,f2x\xb1\xc6\x7f\x96\x01\xaf\xa5\x16\
+\xeb\xda\x0cZ\x94\x19=\xb1\xb5\xfbwg1\xfd\xd3\x93\xa7\xab\x95D\xa1ip\xf6\\\
+\x8d?<F\xa0\xd6{\xb1\xd1\xb1\xe9\xc4\xd7\xf0\xc0>K7\xfc\x02t\x11b\'\xbf\xaf\
+\xbf\x98\xe7\x14\xba\tvr\x9d\xe0\xfd\xf1\xac\x0bf\x97\xd9\xdd\xb7\xa6\xe1\
+\xa08\x856\x86\xda\xbc\x1e\xe6\xbe\x86k\xde\x82\xc0\xafW^\xb1\xf6\xebM&`\x17\
+\xa1\xeb\x9bz\xbf\xc7\x0e)\x87\x8c\x0f\xb0\x01\x1c\x96M\xcb\x82\xfaX/\x9f>@\
+\x06\xaa\r\xfcN\xa5\xbff\xb7\x9a\xaa\x189\x02\xb5\x11\x91)\xdeg\xf0a\x96wE\
+\x07\x87\xc6p\xed\xb2k\xe1|\xf5z\x85\x1c\xf1z\xbfZ\xeb\xcb\xa3\xfa\xae\xc2\
+\xbc\xde\xa3\xba\x19\xb0b\xbc\xda\xe1\xfe\xfe$\x82\x82\x82\x11oG\x89\x80\x85\
+\xc9\xf2\xc4`cc\xab\x97\x9dR\x07\x9d?\xf8\x9d\xe7\x08\x9a\xe6\xd3\xd8\xae4\
+\xd4\x96\xd4<\xd0\xdb\xbcgf\xf5\x85<\xc7\xae\x9b\xd2\xc1\xc1Y\xc7\xbd!\x89E\
+\xcb5hyI\x92\'\xbc\x8e\x84f\xdbU\x9ew>\xe7l\x99?\t\x12g\xf28d$?5\xdb\xaef\
+\xf8*\x81+\xd4\xe9(E82\xc7\xdb\xe3)Z\xee\xcb\xef\xcb\xe4<_\xd6j\xa78\x12%\
+\xcc\xcd\xf7\xd8\xf2N$\xd3\x0c \xeb\xca\xeb\xdf.\x13\x0c\x1c\xbf\x03\x0b\xce\
+\xdb\xf5\x00\x1f\x82\xde\xc7\xdbYk\xa4Q\x86\x83MYQ\xafu\xe5t\x8d\xc7\x9b\xeb\
+\xbe\x85\xe2"\x93\xabDNF\xf6e\xbdY\xa7\xb2\xf9G\x1d\xa9\x11\xf9#\xd4\xebe\
+\xad\xe8>s\xf6^\x93\xb0*g@\x03\x15\x15\xd5\xf7\xe5\xc9f\xc6\x07\xf5,\xcb\xc8\
+/\x81V\xd0\xc46"Fo\xa2i^Z\xb8\xd4G\xac\xc3\x97\xddD~\xea\x0c\xe3\xab\xd4\\\
+\xc1ZT\xb3U\x01a\xaelvb;\xabp\x1eKF\x1auc\xfd\xad\x849"p\xecL\x97P\xb7\xd3\
+\x15\x94ta6\xb6\xd3t\x8b\\\x94\xf2*\xd7\xfbV\x0f\x05*\xc3v\xdegs\xe7e\xde \
+\x8f~\xe8\xb8\xab\x97\x85f\xf1\x93\xaf\xa8h\x0fk\x93\xaa\x8e\x06_\xe5\x15p\
+\x94\xb2\xd4\xf2V\xbe6\xe0\xef\x1c_\x0e\xd0gg\xe3##\xe3\xa3l\x8c\x8c\x8cl,\
+\x1dyYbSo\xac\xdb/\x9f\x1c,\xb1?.\xeb\x901\xbc\xbb\xa0zy\xa1x\x15\xe1|\xeb\
+\x9d>\xba\x90\xea\xf0\xb7]fU\xe3t\x93$utnz\xdai\xf3\x1a\xcd\xef\x00\n\xaf\
+\x92\xd9e<w\xd4;\x97\xac\xf4EQ.\xca\xa9\xa9\x91g\x96\xb7\xc4f{\xfd\xafu\xa3$\
+I\x8b~W3\xab\x98&\xb0\xa6\xb7\xf3\xe7kH~\xf3\xe4UTJv\xe0\xb4\xcb\xb5\x13\xaf\
+.\xcfs\\%\x01\x10\x8a\xb0\x7f\r0?\xefonK\x0b%\x10\x82*\xde\xebU.\x1c\xf7\xdd\
+M\xb3\x05R\xf5}\xbbY\xbd\x07\xed*p\x06/\xd9\xf2\xdc2>\xf5\xcc\x08\xb7\xec\
+\xdeH\xf4fi\x91\xf5m=\x12\xde\x05\xbb\xccv\x10\xd7w\x91p\xcc\xc9"Y1\x07\xf7=\
+a\x16\xb1N\xc9"\xc9(\xec\xd7\xbdS\xa3-g7z\t\xb9\xaa9\x1f\xea2\x07\x9am\xe8\
+\xb3\xf7\xfa\xcb\xde\xd7\xd8s\xf4c\xd8q\xdd(A\xa1I\xa0\x1d\x03\x99\x05\xf2]\
+\xb9Y\xd8X\xd2\xf3\xe3\x89\x1b\x83}\x1c\x1b\x9fu\n4\xef\x1e\x04\xe2\xd7n:\
+\x9f\xc7\xdd\x7f\xdc_m\xd8\xa4\xa0\xab\xd2\xb2OJ\xdf]\x13\xfb\xc5/\x87\x03\
+\xedm\xcd\xb7\x9f\xd2\x0b\xccp\x1b\xf9:\xb1k\xcbX\xb2\xcd\xe7\xe3\xe1\x94\
+\xe1\xc7\xc1\xedk\x81f\xb7\xe6@%z\xb7#_\xfb\xf33\xa0\xf5\x17\x1c\x185\xbf\
+\x13>P\xb0\xd6\xb2\x0e\x16\\P\xd9\x08.\xf5\xf2\xa7\x98\xa0\x8a\x04\x00\xbd\
+\xd83\t\xf9\xdd\xd1\xf6X\xf4\x96\xef\xed]\xbc\xcc\xcf\x9c+l\xbb\x1e\xcd\xe7\
+\x95\xb5U\xc8G\xcc\xe7\x11\xf2\xdc7\x0ee\x94\x99\x0f]@\xcf\xd7R\x85\xda\x8f}\
+\xf4&\x1e\xa6\x0c\xaeLtp\xd3\x8e\x91\xa9\xe5q\xf7\xce\x81g\x7fQ\x07\x89\x8e-\
+\xda9\xbbn^z\xcc~\x05\x85\x17o\x9c\xf6\x08l\xf9\xdd\xb6\xc7\xf8}\x9f\x13=zd<\
+\xe1P\xfd\xbe\xa7\xbe\xc5\xc7\xf1\x84\x9f\x1c\x94H#X\xe5j$p1\xadt\x19\x96\
+\x81K-\xc8\xf9\x89\xa1$]x\xfa\xc8y\xa30\xf7\xaaBKG\x03\xe7\x90\xab\xd4\x83\
+\x94\x1dx\'f\n\xc8\x90J\x9bW\x99\x04L\xe3\x0f\xa2\xf9\xef\x1a\x82\x97\x12G\
+\xb9\xcb\xf0\xf2\xae\xa8\tgm\xeb\x02\xab\xd2)\xba\x01\xc0\x0c\x18I\xb4|\xda\
+\xf1\xbb\xf5\xbe\x01\x86m$\xc7L\x8bX3\x8eq\xac\x89\xb5k\xf6\xa9\x08\xf8\x92\
+\xfe\x1e\x9a!C)%\xcf\xd92\x17+/\x966\xb8\xaf2\xca\x99\xe8\xdc\xd9\x9b,\xa8\
+\xba/_R\x94\x07\xa8\xdd\xb6\xf6\x96\xbe\xcb\x9b\x90JeA\x9a\xeaue\xf2\xc3\x01\
+\xfc>\xab\x04\xe2#\r\x98\xef\xcaV\xda2V\xda\xc3>\xf7\x99\xf8\x06\xa2T\xa5\
+\xe3T{\xf1/J\x95\xa3\xe9\xba\x94yC\xea\xca\xeaZ\x90\xdb7\x14[\xe7\xb3\x0b\
+\x0bJ\xf9/\x98\x91\x06\xaf[\xa9@1\xf6u\xee\xdfK\xa8j\x8bV\x8eo\x07a\xc5n\xc6\
+K\xff\xe5\x94\x99^\xf7q\x83\xf3+.\xafg\xc1\x81\xb5\x9e,_\x9d<\xcd\xf9\x1c\
+\xf9j\xba\xeb\xf2\x9a\xd4\xc8\xdd\xa8\xe6m\x16\xbb0\xb3\xf8\'\r\xd0\x81\xb3.\
+\x8f\x18\xfb\xb2\x17\xce\xe9\xe9$\xdf:5)\x15\xa3K\x93\xd8\xd3\xad\xf3\x8fJM<\
+\xcb\xa7\\U\xdfZ-K\x1c>\xba\x1c%]\x9b\x96_\x9b\x1e\x17\xefO\\\xf0uU\x0b?`\
+\xebc\xdce\xff\x1e\x10\xd8\x82>\x868\xd8A\x08\xa0\xc5\xf4\x1e\x97\xb4\xf6\
+\xd2\xa4\xbc\xf6;\xd0w$\xaf\xbd\x8e\xbd\xa0\xca\xbd\x15BO\xcdj\xfd\x8e\t\xe3\
+puJV\x16\xc5\xfbx4\x1f\x1f#\xb92\xc1\xea\xe9\xf3\xe1\xb4\x02s\xf5\x89L\xf3UB\
+\xcf\xd8N7\xe7\x84\xab\x1f\x80[\t\t\xba\x85\xec+\xc9L\xb3,\xde\x1ec\t\x154\
+\xcd\x96D\xefD\xd8\xef\xe7\xbdj\xf1d\xda1\xef\x8c\xa3\xe6TTT\x94\x95yn\xdf\
+\xaeo\xacC\x9f\x8a\xa1/\xbc\xd0\xedP\xb0W=\xb1\t\x85\xb7\xfbI\xd7\x8b\x9f\
+\xdf\xed\xa9Tg\xbd\xcd\xfe\xc4\xdf>\xee\xe6\xe8\x82\x9a4\xa9\xbb\xae\xc7\x10\
+)\xb73[kk\xb1i\xaa\xed\x8e%a\xf7\xa77\x89D\x89\xce|\xd9[\x8a\x1cDY\xf6\x91\
+\xc0\x90\xb3\xaa\xe6<[c?\xe3\xd4\xcd\xe6h\xb2h0\x92\xe9\xcc\xd6\xe8T\xb6sI\
+\xb8\xb95/\x9cg\xa3\nf\xec\x0c\x98\xd7\xa7\xbf~0%\x02\x06\x00X\xa9\xe1\x94\
+\xf4o\xc7&\x87e\xa3\xfa\xa5\xa3\xe3\xe3\xd0\x90.\xe9.\x86\xed\xdaAW\xbb\xa5\
+\xd6\xdb\x10\xbb\xb7\x02\xe4\x85\x9b/\xf3=qF\xcahf\x80\xe8R\xc3_\x0c\xc8\xbd\
+F\xa6B\x8a\x15\xb3\xeb\x96l\x85\xd7\x9a\x1d\xaap`\xc7i^\x95\xba\x18L\xf4\xed\
+`\x87\xf2\x8f\xcf\\\xd4\x90zJ\xc5S\xfa\xbc\x8a\xe5\x03\x0f\x9f\xe8\xc7N\xder\
+\xb7\xfbV\xf3\xbd\xd2rq]\x87T\xcb\xa7/\xc0<_\x96\xa2.z\xfc\xf6@\xdd\x84C\xff\
+.\xce\x9bf\xf0\n\xd1\x9c(.\xba\x91\x98].\xdc(\xb4\x9a\x1c\xaa\x8f\xcc\xef\
+\xddza?\xf1\xbb\xeb\x12:\x16x\x1c\x8c\xc6\xa1F\x14$\x9f\xac\xc6$\xcfJd2$\xbf\
+\x84vhk\xf3\x0eC\x9f\xa1\xaf\x8fggg\xc4\x02\x1f\xc3)\xe4\x80\xe5\xb6\xbb\xa6\
+R\xc1Z\xd2\xbd\x0c#\x11\xca\xad\xc0\xd4\x98:v\xd0\xab\xcf\xbf\x15\xbe\x81\
+\xf6\xec\'\x16s\xc6\xe0\xe2\xe0\xdak\xd1\xe3\xd8\xef\x13\xa6\xbb\xe0\xe1\x13\
+8\xac\xd7f?P<l\xf4\x99T\xab\x7f9}n\xdbw\x10\x16\xbc\x0e\x83~\xbfv\xc2\x7f\
+\x81\x93w\x94\x06\x81}\x97\x1f\x96k\xb8W\xb0\x01\x06Rc\x92\x94\xf9j\xc7\x939\
+\xb8MLJ&\xdej\x04^\\\xdc\x1d\xe5\xb2\xd4\x0c \xae\x80\xa9o\xb4\x84\xe4A\xb1"\
+\xf8\xebX\x954E\x0b\xefl#\x7f\x94"\x13\xaa\xc1\xfa\xbc\xfd(te`\xbaF]1t7j\xf0\
+:b\xcb\xb3\xee\xcb\xbe\x01\xb4]\xc48m\xcf\xeaq\xce\x96w\x97\xcf\xe0\xdd\xd5\
+\xednD&\xe0\x88F_\xed\xa1{~\x90\xb8*\x16\x1euyU6\xd5\xd86\xbd*p\x88\xa4\xc4\
+\x91#8\x8d\xef\xc2\x86Jl\xbc\xb5\xcb\xf7\xa5\x91\x18AV\xfe\xad\xda\xdb\xf7\
+\xf4\xb0>\xf1\xffl\x89K\xa83\xac\xf7\xc2\xb1< \xdd\x92\xb9\x07\xcd\xe8\xcd\
+\xf5\x80\x9co\xe68\xc1\x1c\xc4a\x8c\x87\xe4|\\\xe3\r\x14\xd8\x0f\xd3\xdd(\
+\x97\x92py\xe7\xe3\xd6$\xe6\x8f]hi\x98\xee\xd0\xee\xca\xe2b\x89\xb4`\x95\x8c\
+~\xbb\xe7\xedQB\x02\x8e\xaa\xf1\xed\xcd\r\xe4\xc0\xef,\x1b5\x1e\ry&:Y\xbf\
+\x96\xdaA\xe3\x8e&\x91\xc6\x96\xd3\x1d\xbc\xb8@\xe1]RP@\xcb\xc6\x16\xed\\\
+\xbb\xfe\xb2\xe6\xd79\xd7\x8f-\xc3\x93\x89\xd14\xb7\xd2\xber\x18\xa2\x03\xf3\
+5\xfb\xab\xdal\xce\x04\xf5\xde[(!>\x81.yM\xc9c\xd7\xe1\x0b\xfd\x9d\xdbw\x11,\
+?-d\x98\xa6\xf5\x16G\x9a\xd9\tHq\xc6w\xf1\t\x05\xb1\xc4v\xad\xeco\xa7\x83\
+\xcfw\n\xcd9\xba|\xde\x1d\xbe\xe7k\x82^?\xa1\xc5\x99\x126\x11\xcd\xe7\x8b\
+\xfa:\x1aeZ^\x0e\x99.\x1dw\xdf\xc6\r^\xe6\xfch\xe6\x92\x81\xbe}i\xf1\xc1)\
+\x8e\x92>89\xcaz\xd2pk\xe2\x88}\xc8\x05i<\xaa\xd3\x05\x07\xbe\x05<\x11 \x84f\
+\xed\xddm[\x1b\x9f\xadg\xa5\x8bi!y\x7f#\x89(~\x189\xd5T\xc6\x07\x83\xea\\v\
+\x8bY\x98\xa3C"\xfa\xeeO*\x99\x97\x8b\x00\xac\x0c\x84\xb9\x18\x1cTVU\xe5T\
+\x8d[\x1e\xfdM\xd4\xee\x87\\A\x99\x98Y5\xf6\xf7\x89H^\xf3\x8fv\xcb\x96e\x90B\
+H&!\x87\xf7\xa6\'^\xbe\xeb\xd9#\x90\x84\x02M\x86\xf2\xf4\x80\x97\xab\xf9\x9e\
+\xe3{\x8d\x0e\xbd\xc2\xb8\x81\xd7\xa7j\xe8s\x16\x17\xc0?_\xe4*\xa2j\xd5\x8a\
+\x15W}\x8d\xcd\xfd\x1f\x07\xa0Q\xb5\x14\xe7\xcb\xc5\x13\xd3\xda\x06\x06~\xfc\
+\x88\'!OH\xc1#\x1b@k\x8d\x7f\t\tY\x86\x11\x0f\xc9+(\xd8\xa1gqljT\\\xd8\xf58\
+\xfa\xa8\xaaY\xac,i\xbf\xd6\xee!$?\x18\xef\x147f\x08\xe2]\xcb\xf4!m`@\x1d\
+\xe3\x7f\xe55%r\x15n&\xcdI\xf8\xa7-w\x02\xcd\xfbw\xf2\xb0\x8077\x15\xa5tqE\
+\xa2 \xef\xb3\x8d\x99\xd7\x8b-\xbb\x95\x9d\xce\xce6\xff\x01\xc0ndD\xb6\x12K\
+\xd7a\n\xef\xe7D\xa1\xd7\xf5\xe3O\x0b\xc4\xf8\x8f\x1a \x7f\x8f\xcfG_F\xe1\
+\x13=t\xd7\xa9\x81\x9dZD\xd9\x01\xc8\xb7~\xfd\x8c\xe7\xca}\x1f\xbc\x96\xae\
+\x00{zz:\xe3\xf3\x99j\x8an\xc5\xe7\x1e\xa3\x11+@\xc4\xb0\xb5r\x8c\xc5v\xbdI\
+\xbc\xf6\x1a\x80\xfbt\xe9\xc8L8\xe0\xb0\xad\xad\x19\xa0&Z\x97a6\x9d\x9e\xd93\
+\x19^[\xcb\x88\xfeuZt\xe2\x90\x9a\n{\x0f\xca\xad=aV#@f4\xcao\xefX\xf4\xf6h\
+\xa0\\\xee\x9e]&j7\x15\xcfb\xe7n]\xf7\xb9\x14\xcf\xafU\xa5\xec\x9c\x00\xcc<=\
+=\x1d6U\xf1\x1c\xae\x7f\xa3\xcb\xd2\xa8\xbb\x7f\x0c\x1f)f\xc6\xa7\xee>\xa38\
+\xcb\x19\t\xaaV\x7fq\xb4\xe8\x04\x1aD\xf7C .N\x91\xddX\x97\x1d\x83uI\xbd\x9b\
+\xcfKO(\xfd[\xa5^\xe6z\x1e\x875\x01\x8f\x869\xb6^\x81]?\xb0\x16\xd0\xff\xa4\
+\xa1k\xca\x14\x7f\xaf\x8f\x17\x0c\x9e\xefh\xd6=N\x9e\xdb\xac\xb1\x16\xe49\
+\xdf\xba\xbf\xac\x11\xfa\xb9n\xb4\xf9]~=\xe9/\xb2\x1f\xe11%\xd2\xa8\xee|\xbf\
+}@\xf1\x04\xe5\xf08\xb0<\xdd\xcc\x00\xb2H\xd3\x1f\xb2\x80\x08\xd4H(\xb0\x9e\
+\xfc\xeb*\x80\x08\xdbB\xd7\x85\x85\x1fW\x9a\xa1\xe7\xb9~\x8f\xbb\xa9\xc4&@i:\
+\xac\xbe\xb7\xda\xa67\xcbZ\xb7y\x83\xa5\xa8\xba\xb64\xff\x04t\xf6\xd1\x9dw<\
+\x9bn\xf3\xd5\xd4\xba\x81\xdfE\x9e\x01\x99\x00\x91\x8ca\x85\xa0\xde\xaf\x98\
+\x84!\x83Z\xeb\t1\xff=>\xd8\x1e\x0c\xff(E#\xac\x0b\x05\xed\xfc\x8es\xdfk\x80\
+\xfb\x01\xfc\x08\x97\xff\xf8\xe0\x06\xd8\xf7\x99\xa7\xb7\x85\x956\n\xdd\xd7\
+\xc5\xdb\x07\xc5\xdb\xc3\xf2\xc4\x0f\x11\x05|j\xf2\x87AY\x9f\x86Zy+YE\x8ex[\
+\x8d\x1c\xc66\xf0\xd4\\4\x92\x87G\xffE\x0bo\x96D\x8b\x87_\xef\xb3!\x08\xfc.$\
+\xf92\t\xc1?$\x80\x10q+\xf3\'\xbe.g\x03\xfb,\x89\xee/\x90\x104\n\xf0\xdb%\
+\xb4\xfd\x1f*~H\xf7\xf3\xdc\xf6A\x8brR/5(\xcd\x8d\x8d\x8d1\xcd\xb3\x0f\xe1\
+\xf5\r\x08\x85\xba\xb0\xe7WpP\x1eY4\x04__\x06eT\xd0\xfb\xc8\xf5\x06\xc1\xd5\
+\x90\xf5\xe1\xcce(\xc47\xb8\xf9\xdc\xc0\xf7\\\xa5|NV\xd4!\x067\xe6o\xc6\xdf\
+\x89\xaa\x89\xf6\x95vxv2\xc3(&=$"\x13`\xa1\x81\xfeZy\x9e\xf3\x8a\xed|\x1629\
+\xa9=?\xcf?4x\xa1nX\xaf\x150|\xdc\x9d\xf4\x0b>\x16\x14\xf6\x8c\xb9\x89o>{K>\
+\xd1\xa4!$\x19\x1d\xfc.wdt4\x1e\xd7\xcc\xd9\xb9\xa1\xb44\\\x9e\x16\x98W\xacv\
+g\x91\xda-\x8f\x97\xb5Pr\x08_\x15\xfeaP\xa9\xee\xc1\xe4\xd9un\xe9\xb0\xb2Z\
+\xe1D\xce?Z\xf0\xdc\ngx`\x9f^\\|\xe8\t\x1d\xbc\xd2\xac\xf8\xfb\xb2bo\xd2\xa4\
+\xf2\x82\xec\x13\x0fXE\xaeD1\xce\x03\xfd\xe5\x1a\x0b\xb03@\xc2\x87g\xb4OC\
+\xed\xdby\xbd\x9ecN\x9544&\ns\x07\xf4\x14\x04\xb8\xc4\x819\xd2Y\xa3\xd9E\x8b\
+\xc4 \xeb&\xe7\x19\xc5A\x88(\xdd\xd9\x17\xcb\x1f\x05`\x0f\x1fC\x85D\x8fo/\
+\x9b\xde\xab\xc0C\r7\xa5\xees$g\xe2\x0e4:\xa9\x90EUgV\x86\xd3H\xe12~\xba.A\
+\xfa<F_u\x9fLc\xa1\xbb\xab3?\xa4\xf4\x0f\x87\x04S\xc8\x91\xf7k\xb0\x8fQ}\xf1\
+4!\x13\x1b\xcbf\x17\xffNg\xcd\xae\xc3@Y$\x08\x97)\x91\x0e\x05\x19\x88\x93\
+\xc2\xd0\xde\xce\xc788\xdb\x9e\n\xa8\xc0\x81!\xba[5?62B\x90\xa8\x93\xc6\xf0\
+\xf00(]\x1el\xbb\xbd\x13O\xa4\xe6\xd6P\x84\\\x9f\x93C\x8e\xfa>\xa7 Yz_\xd5\
+\xb04\xbdu/!\xa5\x88X\x80sx\x89(\x9e\x1c\x05m6(\x11\x99q\rt\x9a\xd3066\x96\
+\x95\x95\x15\x81\x81\x9f\xe8v\x85\xce\x98\x8bz\x10y\x91\xab_\xbd\x909\xbeG\
+\xec\x1d\xaf\x0b{\xc4\xebkzt\xeb\xd9O\xbf\xf2\xed\xdb\x9a"\xab\xf4+!6v\x1a\
+\xfe\x98\xc1K\x97\xbf\x7fwe\xc8\x86\x1fl\xc0A\xf0\xff\xa5W\x89\x95\x06Y\xa5\
+\x17\x11KX\xd8\x80O\xfdx\x93\x84iH\xff2\xd6\x1b\xaf\xd8\x89$r`\xdbrhN\xd4W5&\
+\xfa\x9d\xff\xc3>>B\xd5D(=\xa9\xe6\xff\xbf\x1c\xd2@v\x1fT\xbfkai\xfe\xc8\xd6\
+\xe6\xf6\xa9\xa3E_k\t\xd5\xe3i\xff\x87\xff`g\xd7\xe8\xd2<_\xd0\x1b\x1b\xac\
+\x85\x15\x83o\xeb\r9\xd9O\xfc\xf9J\x04\x7f,|.-\xde0w\xd6\xfa\xe6\xe0\xca\xb4\
+|\xffgC\xb7Ns\x80r\xd97-g\x9e\xba\x0e\xa2\x0c\xb2|\xf9r}\xcae\xc8\x18\xfa2\
+\xbc\x9f\xe8\x06\xfd\xe667\xfaE(\xd7;\xb3\xd48\xea\xd3\xb2\xce\xe9\xe0)\x97\
+\x97k\xf6@\x82\xabR\x06\xeda\xb1\xd6\xda\xf1=yiy\xe6V\xb1c\xd67\xef{\xf6N\
+\x00\xa3\xb6\xeb\x81$\xd6\xae\xfa\x85\x9b\x8b\xcf\x01KvT\x96\x8b\x8b\xab8\
+\xcd\xf7\xfb\x04\xa8\x03\xd2uM|pyuuu\xba\xec\xba1\x91C!x\xff\xb7\'\xa8\r\xba\
+\xf7\xfbS\xe11\x1f\x10\xc9\xd3\xc6\xf7\xf2{\x8do\x95Z\xac\x1au\xfa^=\xe56o\
+\xbdV;\xce~\xfc@p\xab\xf6B\xaa|\xf6\xbej\x90l\xa7\xea\xab1;\x9egJY8t\xbe\xf7\
+\xbd]s!@\x1b\xa9\xae\xd7\xca8\xe5\xca*\xb6\xc7z\xc7\xf0\x0e`\x9e\xef\n\x03\
+\xea\x8e\xfb\x17\x80\xb3\x9d\x1e\x9d\x94y\x97%\x9c\x01;>:\xb2\xde\xf2\xd3\
+\xf9\xf6\x10?\xb8~\xf3\xd4!\x94\x8b\x8et\xf1\xd4\xc1\xc83\xcc\xc9-#h$\xc7\
+\xb7\xac\xa3\xab\xa3\xc3c\xb7\x86\xd7\xc4c\xa1ks\xa1\xfa-{ \xdf\x12\x8f6\x80\
+GfZ\xcaZ\xdd1\xd4>\xc4\xc7\x06\xd1[h)\xcdN\xbe\x8d!\xba\xab\xb4\x88J\xb5\r\
+\x10\x96\xc0@\xb8W\x06k\x1d\x85\xa0\xd6\xef\xf4\xc55\xc5\xc5\xc5\x05\x05?\
+\xfc\xfe\xa4\xd9\x15\xac\x85\xdd<\x1d9\xf0\x0e\xd8\xab\xc7\xc2\x0e\x90yF\xf8\
+n!R\x00\xce\xd9\xd1\xd1qU*[\xbd\x1e\xe9\x11\xa1\xf1\xeb1|\xb1\xebe\xb9+\xdb\
+\x86\xc4\xfcM\xf6\xfe\xe4\x92\xaf\xc5\xf3T\x0eT\xc6m\xcd\x81\xcf\xf3\x15\xf2\
+(\x05ub0\xa9\x000bP\xb1X\xa3\xeda\xd5m\xad\xe3\xcf\xfdc\x19\xe4K\xcb\xe1\xe1\
+\xf1\xf5\xcd\xad\xcf\x893I\x1d\xfa\xb8\xeb\xf3el\x0c\x83U\xc2M\xc2&\x03\xf4\
+\x01\xab\xe5!\xfb\xf446{"V\x08\xa2<-GV\xcc_f\xe0\xe3\xa2\xe2\xed\xad\xa7wBZ\
+\xdd\x15\x00\x17\x05\xb2\xd0=n;o\x8f\x1cQ\x99\x1cT\xdc\xcf[\x87\x98\xabx\xb7\
+\x17W\x9f\x9f6\xaf1\xfbYv,\x9c\xfb\xdcg\xbbM\xe6\n\xe7fgW*\xccY\'p\xa3>\x9d\
+\x8e\xdf\x01\xf2I!p\xfb\xa1\xdfD\x80\x9c\x90pYy}\x83o{\xda\x9a\xb0\xcdk\xb5$\
+\x02\xb4w\xeb\xe5\xf7Xn\x80~s\xef\xf5\xf4\xf4\xefp\nS$\nu!\x0c\xdb;\x83\x14\
+\xc2\x86\x8f$\xab\x87\x1fWAw\xbb\x8c%_\xba\x8f\xef]\xb3\xce\xdc[z\x9f\xfeV\
+\x1b\xcc\x1c\xdf\xd2\r\xd0\xddH~\x16\x07*\xcc2\x10t\x07@\x1e\xe3\xdf\x97TM\
+\x83\xc7;\xb7\xce\xcaTt@u\x9d\xa7h2).\x9f:\xbc\xeeOz\x06\xe2[\xf9\x94]4\xf5\
+\xe4\x07\x0f1\x95\x0c\xd6\xdf\x0c\xc6\x08\x02;\'9\xfa\xb8\xfa\x96\x900\xb2J\
+\xcd9r\xe1\xbc\xb2\xbc\x9c+]>\x84\x15\x9eY\xbb\xd6\x9bNHvy\x98\'\xb4\x8f\xea\
+\xb00\x17\xd2\xa7D+\x1e\xa2\xcf\xb9a\x03\x1e\x18\xd8\x9a\xf8\x8c\x9e\xa9\xc1\
+\xeb\xf9\xf4\xd4P\xfa\xd7\xbc\xadcO\x19\x83\xdc\xaf\xb0\xcc\xdaC\xff\xfd\xd9\
+\x05\xfb\xb4c+<\xb7s\x8e\xf0\xfe\xc7\xcd\x8f7\x99\xeb;\xbb\xbb\x9d\x97O\xa4\
+\x84\xef\xf58L\x89\xf5\xf9\xdd\xbf\xf9\x0c<mnn\xf6\x04\xf4\x88P\xfa\xbff5\
+\xb7|\xbf\x83\x02\x95\xb0\xd2\xae\xf7\xaa\xe8\xe5\xe5enNo2\x060\x96\xa6\xa6\
+\xc3RkcI\x8dV\xf1\xcc\x92-\x0fX\xeb\xbf\xcb\x17\x8d\x13\xc6 sRb\x93q\xd76\
+\xd02\xe3(\xe7\xc8h\x1d\xab\x8cg\xf5\xba\xcd\x18OLL\x0c\'\x18\xb0\xf1\xe8%\
+\xc9\xd8A\x931\x9e+\xb5\xce\x85\xf3\xd5\x97\xbe\xd5\x12ogg<\x1b&\x13\xf9\xea\
+\x05\x07\x80z\xb2\x07\xa8G95p\xb2\x155UU\xeb|\x96cj\xd0\xb2\xc7\xcdY\xd8\xd9\
+\xdf\xd0\x15\x9a\x15F\x81L\x9a\xe25\xbe6`^)\xd3\x13\xa1\xdb\xaf7\xc1\xdb\x05\
+D\x95\xa5\x96;\xf3\x91\rI\xcb\xcb\xf7gO\xd7M\x03\tE\x84\x12\xdb\xcao\xcd\xb6\
+Y\xfc`hl\xac?\x93\x13\xbc\xd2a\x9f\xad8H\xa4kQ\x0b\xe4\x0b/\x01\xf2\x95j\x80\
+\x02\xec5\x1dE\xe7\x00-\x06\xa7M2477\xcb%\x90\xe3\x93\xd4G\x07\x88\xf8Gp\xcf\
+\xf2r\x80/l\x16\xed\x0f\x8fNH\xc8\xc8\x04U5Ce\x89L\x80\xe52ir\xb4\xb5eec\xab\
+,\xa9i\x01\xea\\f\x9a\x7fY\xc7\x8eg\x99/R"\xe1\xe6\xa7\xc6T\xf4\x01\x9f\x04/\
+ \x17hHA\x11 \xff\\o!\xe2\x81\xa8%0\xd0C\xd5\xeb\xcf\x80\x12\x94\x18e\x0fLOO\
+\xc3\tb\xea\x97\x95\xd4<\x0c\x8f\x8c\x00p"\xe6\x16d7{g\xc7\xdfd\xbbJ\xd24\
+\xb9\x8fu\xf6\xee\xd5\xc1\xc1\x81\x81)\t\xb4\x07H\x9e\xbb\xc0"& 5\x88\xc4\t \
+\x02d\x04\x8e\xf7\xe5\xe5\xe5\xe3\xe6\xf5T}\xff\x82\xfa\xd8\xccdB\x16\xbd\
+\x8c\xe7t\xf7\xe6\xc2\xd9\x99=\xf2\xe9\x99\xbe\x9b\x8c\x0c\x8a;\x0e.\x82\xc9\
+\x89\xf4W2\x93\x8a%{\xe0<\xaf\x0f&\xb2%\x82\x07\x80/\x00"\xdd\x11\xc4(3\\\
+\x7f\xeb\x99\xd7\x7fb\xbd\\lW\xb7-1\xa4\nW\xa9^\x10\xd7O6#\xee\x0b#\xac\x17\
+\x15\x90\x9e>\xbe\rA\x0f\x9ad\x00\xe6\xe9\x9b\x93\x9b\x9b\x9b\x95\xb6U\xfd\
+\xea\xd9\xa5\xfbJ\xc7\x19\x90x\x81U0\xfa\rH/\t2\x82H\xfb\xbf\xd4E\xda\xf7\
+\x02\xc8\xdd\xcd\xcd\r\x1e\x1e^\xdcF\xf4`_S\xa4\xa2\xb8\x01P\x13\xe5s#]\xacD\
+W\x93\xcd\xf6h\x08p\xb3\x9f\xdc\xd5\xc0iK\xb6\xbe\x97\xdd\x91@\xb1S\x81\xb77\
+\xaf\x87Q\xc2Qb\xcfV~\x9b\x1dk\x94\xcf\xa1\x92(\x87\xb3\x8e\x1a\x9e\x03\x02\
+\t\xe8\xc8\xd1.3\x10l\x11\x16\xb1>\xe7\x93\n\x92\xc7\xb6\x92\xda\xd8X\xe3\
+\xe2\xe0H+\xef\x0f\xc2tP\x9a\xa0cpsso\xf6\xee\'\x0eJ\x0e\xd2\xcaLvUS\xf5\x19\
+\x0eq\xbc\xf39\xb7\x94\x91\x91QRR\x02\x8a\x91gW\xdc}\x0f\xdb\r\x19\xba\r\xbf\
+}\r\x13\x83\x8b\x19\x05\x0fNc\x1d\xedw\x07f\xa1\x05S\x1f\x95\x19\x9c\xd5\xb6\
+\x90\x9d\x98h2\xc4\xb1\xb1lb\xfa\xcb\xbc\x86/\xda\x8a\xd5\x9e\x91\x83\x8f\
+\x0f\xb5\x90\x86\xed$B\xaaB\x83\xa5B\xa3\x8e5\x94l7\n\xf4\xdf\xd5\xc7\xc2\
+\xb95\xc7\xde\xf8\x94\x94\x90g\xf5"@\xe8\x1a*\xf0V\xa4\xfb\x83h-t\xcb\xdb\
+\x16\x14z1M\xd0+-\xcc\xcd\x03k\xa4u\x04\x01=\x1f\x9d\xafdT\xd3\xd7WD\xa3AS\
+\xa0\x8e\xaa\xa5qq\xd9\xdd\xdd\xe5\xe8\x8a\x8e\x8e\xc9[\xcd\xc9\xc9ih\xf8\
+\xd0\x90\x99\x98\x08O\xd0\x1bi\x82ime\xa5mQk\x18\n)\x0fz\x93\xebq\x97\x0e\
+\x06K\x82\x89\xd2\x85\r\xc7\xb8\xccI\xff\x01X\xf5\x02\xbf\xe2\xc7\xd9\x1d2\
+\x9fs\xc6\x0f\x91!\xe8\xf0e\xbb\xc2\xbcP\xd5\x9b\xdb\xcb\xd3?(@\xbd\xb6\xc6\
+\x7fH\xf2\xe6\xe5\x043\xf3\xa8_\xbc\x88\x9b\xf8\xe7\x14b}\xee8:s\xd9\xdf\xdb\
+56/\xb8/T\\n\xf0H\x1c6u\xfa\xad\xe7\xdeS\xb3*\xe4\xf7-\xf4B\x18\xea\xf1\xaf\
+\xa0\xe7\xef\xee\xee\x80,\x14*\\\xbb\xb1-\xd4\xef\x04^<\xea\x9dk\x91Yg\xc2F\
+\xa6\xa5\xa7\xe7\x04\xeb\xbd\xd7\xd4\xd1!\x914\xad_U\x14/.,D\xfcE\x11\xd4\
+\xb7zl\x1e\x95.O/0@T.\xa8\x17\xf4\xb6\xda\x17!\x8eVp\x84\xf1\xc0-\xeb\xdb\
+\xc5Q\xb3!\x07rO\x82\x06\x15\x89\xcc\xc6\x87\xc5\xe5v_\x0799\xb4\x08\xe2\xfa\
+hw\x05\xd5\xd8m\xcc\xbfe@\xd7\x91G\x1eqG\xecx\xe3I\xfa\x19\xff\x96l\x04*\xc0\
+\xb2\xb9\xb4T\xa6x&\xef\r\x0e.\xaeG|N\t\xb7)\x91a\x18\xe2}JRR\xcdq\xaa\x012\
+\x14(\\\xf3z\xe2\xf3r\x1155\\\xfc\xbdC\xdb\xa6e\x15\xd2\x80=\xa1\xcc\xf1\x94\
+\x94\x94y\xdbf\xaf\x17}\t^N\xfb\xbb\x1e\xff<\x0c\x1a\x87\xd4\x81\xf9\xd2\x8e\
+\x8e\xaf\xc53=\x9c\xd42\x9e2\xd3j\xb8\xefS\xd1\x9c\n{/D\xb9\xaaA\xcb\xc8$E\
+\xf6\xb8\xd9,+(O\xc2\x80IL\xdd\xc7\xc4\xc4\xc6\xb2G\xc4BoN\xd2\x95&s\x0e\x05\
+\x16\x1e{\xaf\xfd\x94F\nv=~S\xf0g\x13>\tQ\xbc#\x82T\x0b\xbb#\xf1\xd2\x89\x87\
+\xb4-\x08\xde\xedZ\x0e\x1e\xc6@ _2L\xa3\xa9F9\xfe\xac\x0b\x03[\xbc\xbd!CC\
+\xd2V\xda\xa5\xfa\x9c\xde\x9ewcuf\xa3?\xd9\x05\xd6}^\xd9\xbb\x9e\x19MN\xaaZ\
+\x88\xaa\x07m:\'+R\xd1\xcb\xaf4\xbf\x1e<{\x9f\x8c\xaax\xd5\xaf\xa6\xd9\xe9\
+\xd5z\x17v,)\xc6\xa2\xa3c\x9a\x9a\x9b\x1b\xbf\x03\xec\xc5\xa61RMUU\x83\xd5\
+\xa0\xf4\'4Q-\x97\x08\x1dI\x95\xb1u\xa2\x85\xbcI\x87{8\x03\x18!P\xda\x06\xc9\
+]\xd6\xd4!l\x11\xb1\xc0\xd0\xf4,j-\x13\xb8=X\xae\x7fJ\xb3\xb0\xb2\xa2#\xc0a\
+\xe9V\xb2\xa4T\xa3\xbf\n\x1d\x1c\x1e\xd7/\xd9\x02\xa8\xe0w7\xeepH\x07\x7f\
+\x06\x8c\x0c\xbdZ\xf6\xa7d\xac\x9f\xb3\xb7\xb11\x9c\x0e/\x00\x01\x80\xccxz\
+\xf2Y\xc6\xbd\\M\xd3\xc9\x8dF\x8c\x12\x99hV\xf9~\xfa\xc8\x11\xa6\xa9\xd6\x9c\
+\x99\x9c\xcc\xfdg\x1d\xcb\x1a8\xae\x84_\xdd\xc1L\xbd\x855\xe6\\\x85v\xfd\x1e\
+\xec\xe8BC\xa9\x8e\xb3\x150\x0f\xe7\xb6K\xf92\xf3+\xf8\x84\\\xbev\xef\xb2\
+\xe3\ndz\x19\x88\xde\x11\xa9\x1f\x0cw\xf8\x9e\x9f\xdb:\x04\x05\x9cGD\xaaX\
+\xbe\x17\x16\xf4**h\xf8\xd1\x15^\r\xd8\xban\x93\xed\xd2\xd0P\xd8\xa3\xd0w\
+\xa7\xba\xbd\xde`\xb4\xd9hF\xa5\xd50vE\x93\xee\xd5c\xdf\x96\xde\x11"\xf8\x9e\
+\x92P\x10\x01!!\x9a*ph\x16\xcd\xae\x1f\x195\x05\x1f\x1a\xde\xdc\x8c\xca\xa5\
+\xb2\x0e\x84\x9aGaD\xa3\x03}$&\xee\xa1\xa9\x17\xf5$>)\xbe\x82\xf2\x08\xa5YZ.\
+z8\xb1[.\xb8$\xb5\xba\xf51\x04\'\xcd\xe4z\xf9\xded-\xd9\xe6\xe0\xd6\xab\x01R\
+\xc0(u\x7f\xb6\xa4\xf6\xef\xde\x07\x1f\xa7\xfc\x80\x13\xf1a\xcfc\xd7e\x0eC\
+\x0b\xee\x83\x81?\xe8n\xf1\xdeM\x94\xd1\xae\xc4\xc1\xbd\xae\xceI\x91hc \x97\
+\x8c\x91\x8de\xa0\xc80g\xb9\x03\x11\xa6\x07\xea\x86\\s\xd7\xea\xb5\xfa}\xc8\
+\xfd\x8fOM\x1c\xfb\xafnH\xe8\xff\x90)Y>\xf4\x1f\xbb\xc3\xfe?o\xdc\x9de=t-G\
+\xd5\xd4\x1a@\xaamU\xfb\xe6f\xed\xd4\x81\xc8_V^~\xdfUcP\xa9\x8eFzZ\x1c\xe3\
+\x90\t\xc2\xee\xfb\xb5p|\xff\xb2z\x9dH\xe8UX&\x9b\xb2\xfb\xef:\x1b\x97= \xaa\
+\xb2\xef\xfd9\xa8\x95\xc7\xaa\xbb+\x83\xb4\xa0\x16p\x9f\x83\xfe!gd\x01\x1e\
+\x00A\x00\xb6\xb6\x07\x91\xd9Kz\xae,\xcdG\x18\xe2<}O`4iI\r\x99+\x01\xb0\xb1*\
+\x9b\x1f8Cq\xbb\xd3\xd5\xfa\xe2\xbcN\xa3&\xce0"NtDD\xc4vR\xdb\x02c+++^\xdc\
+\x9bW\x00>\x00\x02MJI\xfew\x1fiR\xe0\xa5b\xfb\x07<HGm\x102\x89\xf6A\x98j\x1e\
+\x9a\xde\x1dg\xc4\x91.\x0f0\xa7\xfe\xda"\xc0\xcc\xc9\rJJV\xcc\xf4\x1e\xed%5i\
+\x84\xef\xca\xf4\xab\xca\xbc\x99\xf3\x07\xc81\x87\xe2\x8f\x8c\xa2\xb4+5\xe2T\
+\xbcZ\xf6\xf6:\xec\xf1\x90\x91\x82\xe2q\x08.D\xfe<\x8fe\x94\x08\xea\xcd\x009\
+\x10\x90\xb1\xd27\x00\x19///\x177>(\xad\x85\xc2\xc5S>\xf8\x85|\xfb\xad\xd7\
+\x8e\xc6\'\x16\xe4#\xa4\xfd\x96\xe3M\t\xae\xe1\xc5\x96\xa7\xa6E*\xf5\xcf4\
+\xd4ze\x04\x15-\x92v_v\xb8\x808\xbb@\xb7\xab/\xac!j\xc3$\xbd\x0c\xa7\xdf\x9a\
+\x1aUo\xf22x^E\xc3\xc8\xbff\x7f=*\xa2)\xdc\xdd\xd8\xb4\xb5Y\x85B^\x8fr5\xaf\
+\x85e\x12r\xf4=\x98\xc3\xbf`\x0b\x12\x97b1\x1c\xa2\xc2\xf6@\xb9`\x89\xc4{Rz\
+\xe4D\xc1Db[\xb6<\xa4v!o\xcd\xfb\x88\xbe\xff\xd6\xcb\xe4qp\xbao}\xdb\xd0\xec\
+\xb3\x8c\x99\xabd_\xe204>Z\x18\xbe\rx\xa5\x98\x86\xde{\xc2\x95\x07S\xed\x98\
+\x068\xde\xe5\xd30\x12\xd5\xe7e\xea:A*\xaa<c\xf1\xe0\xed\x1f\xe2\xc53\xa2\
+\x92\xdd<\x99\xf7\xd3\xffD\xef \xdb"\xc7\x97\xa0\xa0\xaa^\xcb\x15\xfa\xed\
+\xfe\x95\xf0\xee\x17\xf3\x16(\x1f\x037\xba\xbe\x12\xbf3D\xea\xe8\xe8A\x84d6V\
+\xdeB\xdd\x0fP\x05\xe0\x97\xb3\xef\xd0\xbc|\x83\xc7\x8c\x878\x18K\x06\xea\
+\xc7]\xbd\x94\x94&\x17\x17\x89\xf29\xe0\x03\xba\xb9\x94\x84#;\xb4\xc4\x8c\
+\xe1\\\x05\x01a_\x83[S>f%p\x96\xd0\xd1\xc9P,\xeec\xc0>\x93A\xa8\x85\xe6\xa2`\
+\xdbN\xbe\xb9\x0b\xc8\xd6b\xc4\x8b\xc5*\x10\xd7G\xa5\x85\xeb\xa9\xbe\xc1\xdb\
+Zd\xda7\xa8_\x15\xe2\xe3\x8b\xc8\x8bU\xd6\x13\xc2T\xc2H\x1d\r&h\xe3k\x0b\x83\
+\x11\x086\\\xec\xef\xff\\ pxxh\x94\xf7\x8ej\x08\xb9n\xc2\xb8\xb4\xaaJ\x12\
+\xa1*_L<\xc4h\x1b\x1c}\xf2\xa4\xee:\xd4\x8a\xf2\x17\x80#\xf5`\x04\xd4(\xd0\
+\xe7\xc3\xcbRe\xc6DT3\xfd\xbc\x1dj\x81\xbf\xcb\xcbL\xd8j\x01\xd2\xe1_DB@\xcb\
+\x8bkk\x98Vt Pm{\xfb\xbbp\x98\x87\xcf\x94\xd2v\xca:\x1a\xcc\xa3\x9c\x19d\xc1\
+"\xff\xfbY\x00\xf3n\x85L\xdeqhZ\xfb2\xca\xbfU\x08<}\x8c7\xad_\xe2\xb1\xff\
+\x1b\xd6\x80\x0b8\xf0\x05\x96I\xd4\xa4\\\x8f\x18\x84f\x94s\xf7\xf1\xda]\xa0\
+\xe0sIU\x15O\xba|T-\x80\x9a\xc5\x8c\xdf\xbe`T\xaf/\xdf\xf8\xce\x80\xa3I\x9b\
+\x1d\x96/\xc7\xea\'\xd555\x13\x7f\xa2\xbd\xc0\x99\r\x01\xc5SBP\xc7\xb7G\xe24\
++!\x86\xf9\xa3\x9f\xc62\x17\x14" \x96T\x02oW\x1b\x97\n\xa2%D\xf5\x19\xdc\xfe\
+\xcfg\xc3B\x0b\xbb\x1f\x160\xc9\x81$^\xb0\xc3\x181@\x81\xc0\x82\x17\x8a\x17S\
+\xe9NPp\xf5[\x0b\xbbdR\xec\xed\xc8\xec&k\x81\x9f\x845\xbc7\xbd\xea/\xd4\xc7\
+\xdc\xd0\r\xa0\xfew\x9dT\x9c\x88\x08\x8cM\xa2\xe4~\xc4\xa4\xa6$\x1bc\xbb\xb9\
+\xb8\x06\xf02\x9ee+\xbd\x0f\x84q\x12\x08>!!*\n\xf3\x92p"\xff\x9cPn%2\x12\x07\
+\x14A\n\xa8i\xc2\x18E\x1f\xf5\xca\xda\xcf\xd8a\x84\x7f\xeb\xd6\x8b\xe9\xfe\
+\xadIE^\'\xec\x13\xdaH\xa1\xe8\xd4\x89\xa1\xdc\x8a\x05\xd5{\x05iy\x18\xfe\
+\xf8\x8b\xb1bR\xa3!\x03\x12\xf4-\xb2\xd2\xb2\xb3\xb33\x80\x0b\x85>\xa1b\x89\
+\x87\x88V/\xa8MS\xf9\xebk\xbc\xb0\xe6j\xfd\xbb\x0b O\x7fC\n\xfd\x98 t\xa94\
+\xd5i\x88J\xc1s\x04t\x0f\xbd\xa5\x95U\xde\x0f1\x8e\x04\xe1\xcb~\xdc\x86\xaa\
+\xc0A\xca8\x13\x93\x93[/RRR+n\x9e\xcc\xf1\x07\xfcH\xa2\xe0qZZ\xfa\x9f\x1cf\
+\xb7Ddds\x87\xce\xde\xae\x18\x81\x00\x990\x89\xa3\x13\x87\xcc\x05\x97\xc7+\
+\xc2SNe\xd3#\xe6*\xcd\x1f:\xa3\xa0\xa0\xfcKJ\xe5\xac\xa3J\x1a\x1a\xcc\xcc\
+\x05\tq\r=\x9b%\x01\xb6\xd8I\xcc\xf0\xd5\xe17\x16\xee<TT\xb0\xa8\x81!OH\r9\
+\x89\x89\xe2\xe1\x82\xbd\xf4BK\r\x1e\xb8\xfa)\xcc\x16T(\x85?\x7f\x8a\\\xb2\
+\xe6F">\xb3\xe7*\x15\xcd\xb23\x8a;{\xbe\xe8\xafhk\xa1\xfcv\xe0:\xfb\x01\xa1h\
+\xc6\x1d\x92s<\x9ae\xea\xd0\xf7\x03\x84\xbac\xe9\xb5\xa7\xd6d\xd9\xcdV\xea\
+\x0e\x19\xbc\xf8\x19\xbd\xcdi\x17\x95\xae!\x0e\x9d\x18\xc8\x15\x01\xaf\xbe\
+\xcf\x8e\xcf\xdb\xeb\xd0Nzm\\\x88\x0fv:W\\*5@w\xef\xdf\x13\x90\xf3G\xbe\x9a\
+\xbe\xe5\x94?\xb8}\x8a\x8f\x8f\x0f\xad\x9c\x7fFC\x15\xf0\xf1a\x1cK\x0c8!\x03\
+\x81@\xd2>\xc7\xb7^\x93n.\xc3uQ\xc2\xc4&\x95\x13)o\xba^)9\xf5\xdd\x05s\xd2\
+\xd2\xd2BY*\xfe\xaa\x9fZ\xe4\xfa\xb8\xe6\x9d_O|\xcf\x86\xee\xbe\x11\x86\xa1\
+\xb1J\xe0\x86\x0f\x82\x07\x9c\xdd"j\xa0\xbf\xff\x01\xd2\x99\x94\x94\x04\x10\
+\xa7i\xfbFu\xbc,\x82\xdbM\x02\x95L\xe2\xacc\xeb\xb6Q97;\xbb\xdb7\xc3\x8bM\
+\xd4\xf2\xa9\xa4h\x01\x16\x0c\x0c\x0c%\x88\xb0\xd2\x01\xe0\xa5?\x7f\xf5>]\
+\x1f\xd0\x89\xaf\x8d\xb4\x97i\x96\x05va\xe5;\x1d\xc9\x88\xa7\x88^\x9e\x14[L\
+\xda>\x80\x91\xda7\x1e\xcf\xae///\x1f\x1f\xcbCBC\x07\xab\xa3\xd5\x8c\x93\xb9\
+%l\xe2\xb6\x96f\x16B\x8bKX\xec\x0f\xbb\xb5~b_\xfa\xcd\x80gOevv4\xbdZB\x9a\
+\x91/\x00\xa5\xbb:\xf3T\xbbAC?~t\x13\xf7,\x9a\xeb\x8f\x02l\xe6\xdf\x85\xf8\
+\xe3B\xea\xe4\xf4\xadzy\xe9\x07\xae\xc0\r\xa8.r\xc1\x16@\x8b@*p\x19\xcc\xcc\
+\x1ez\xb7h\xdb\xdc\xc7\xc9\xbb\x80\x87\xb2B\x14\x08u\xa0\xda@\xeb&\x8aD\xd2t\
+\xbdBT\xdd\'\xc1Kk\xc6\x86\xb0Sbw`?\xfd\xbf\xae\xaf\x84AQ\x82d\xa8\x87\x01\
+\xe3H\x04\x16\xd8"b\xb2\xe2oMk7\xa1\x9f+\x8c\x05\xc1j{\x91\xf2\xd4\x1fg\xdcC\
+)\xd9g\xc7\xc4\x90\xbe\xe1mL\x07\xd2\xfeC\x18\x81\xfe\xa7j\x04Ih|k+\xd0g\x00\
+[\x08K\xb8Fk\x96\x95\xe9\x97\x96q\x9a\x12999m\xc8\t\x7f\xfd\xb8\xaccPZ\xf6T\
+\xef\xf0jU\xd0N\xa9\xdbd\x0f\x84\x98\xfa^\xc8,\xb6\xf7!p\xacz\x9b}E\xc8\xa7d\
+\x92\xde\xa2\x97\x8b\x10\xcc\xeelP\xc6\xe9\x9d\xf0zk4N\xe1\xcf\\|\x0f5<\xc0A\
+\xc4\xa7\x12\xeb\xe1\x9c1_\x98\xeaBjP\x02\x8e\xa7<\xeb\noMG\xfb\xfb\x7f\x0c\
+\xeekw\xe5\xbd[\xa8d\xd0\xb5\xfe\xef\xd1\x0fW\xc1N\\7s\x7fx\xf6\x17\xe7\x85m\
+~\x9a\x17\x9d\xeb\xbd\xbc\xfd\xbb\xb3\x1c\xed\xf1D\xde\x86\xe3\xcb\xec\xc9\
+\xae\x1a\x07\x1dn\x81f7\xb7\xf1\xccP<^A\xa1\xc9q\xe5\x81{\x06\xff\xf7\xd9\
+\x90\xf8L\xdb\x0f\xb6\xd9\xce>\\\x06\xd7\x13\xfeZ\xd0\xe4\xee\xcdSy\x97"F\
+\xc4\xdc\xad\xcfv\x03e\x85\x98\x9fU\xc4\x1d\xc5~o\xbd}\xa77L\xf1Y\x06q6Yi\
+\xed\xdd:\xb6\xb1\xb9{\xba\xc4%\xeb\xeb\x8e\xc3\x15\x95\xf8N\xc3d\xe48\x84\
+\xc6\xa8\x1cU.9\x1f\xa8\xbf\x00\x11\x98MI#\x03\xb5l\x9b\xcf\x8ey\xee\xb4\xb6\
+\x82G|\x8f\xa8\x8f\x15TSL\xc8a/]8x\xd1r\xa1J\xf5\xca\x9f#\xea+\x93{_I\x8fH7\
+\x9a\xe5\xc2Aq\xbb\xd4\t\xc7h\x0f\xd82u\x0fz$I\xfd\xf9\xe5\xf5\xa3\xd6\x8d[\
+\x17\x02wx,\xcc\xac{\xb8\x9a@\xacJ\x93\xa7\x1f\xb9.,\xd2\x98\x8a\x9b\xb3\x1e\
+\xf0\xa7\xcf\xcd\xaa9\xa5\xee\x91\xe4 \xda\xe1\xb2\xbe\xa0\x12G\xce\xb3\xc8\
+\xab)\x04\x02\xd8E,Q}\xf4\x17vMQ\x0b\xd1W\xe1\x00\x11\x91\xec}\xf1\xa9\\J\
+\xa4\xa4\x0f\xcb\xa7\xefSY\xa8\xa8zL9\x11\xe1`\x11\x8eX\xa6Kf\xc9\xabD\xb1*\
+\xea\xb5\xe2N>\'\xdc@\x14e\xb3\xf7\xb7\x87Gds\x95B\xa0\xf8\xd2b\xe27\x04\x18\
+\xb7\x18I\xdc\x08\xc2=R\xdf\xa1\xeb\xc2\x06\xb5y\xd4\xb2zi\xfdO\x14o\xc3\x84\
+w\xcf?*~\x8c\xb3\x08\x0c\xbe\xfa\xce\x01\x06V\xbd7\x0e\xc3+\x90;\xc0\xe0\xa5\
+&~\xad\xd3n\x90/\xb2\xb0\xb6\xf6\xed\xa5\xdfo\x8f\xdf\xdeq\xacN\xee?\x93\x81\
+\x81\xfd\x1b\xfff\x00\x84\xc0{\rSB\xdc\xe4\x97I\xcb\xc5\xa3i\xea\xa8D)*v\xb9\
+\xd4i\xe0\xa03_6\xeb\xa8sb\xb0\xd3\x15\xc7\xbf\xcb\x03\xcd\xb6\xab\xd6c<\xaa\
+\xba\xfa]\xa9\xe4\xda\xff\xc5u\xb5"\xdc\x96\x17\xc5i,\x88\xd1\x1ac\xd7\x84\
+\xf1&n\x9c\xedz\xd3\xaf\x86\x8a\xd9]\xa7<|\xd9_\xbd\xa9\x01\xf6\x81\xc1\x1fS\
+\x9e\xf2\x96\xec\xdf|\x01\xd2\xe91k\n\xe0B\xc4\x9c\xe8\xee\xf1.\x04\x91\x8a\
+\xc5\xe2\xbe\x1f\xac\xc9\x88e\xb1\x1b\xc3\xdd\xa5d\xb5\xa6WW\x05\x87\xdd\xda\
+\xfb(\x1f\x84\x05\xda}\xcfK\x9b\xd4\xc2\x16\xe9\x94sPd\x85\x00\xa8\xb0\xb3\
+\xb2BA\x80\x93\x8e\x02\r\xe7o~\xdc\xfcy\xf0TTD_F\xac\xdd\xc7\xc8\x0f#\xb1\
+\xad\x16\xa3\x9c\xd4\x7f4(vu\x91\xeb\xb0:\xaf\xbc\x8e\xcd3Z\xb2\xfd\x83\x86\
+\x97\x9dp,\\\x05S\xf5\x91\xc8\x14\xbc\xb8x\x90F{\x08X\x97\xe8#\xa2\xd5\x12\
+\xc0\xd7\x0b\xc7\xb7\xc0d\xc6\xa50e\x86\x81\x96\xc3\xc6\xf4\xdc?g\x1f^\x10\n\
+C%\x06x\xe7\x7f\xa5\xb5\n\x07\xa5\x06z\xfb\x89=0PO\xd5\x02R\xf8/\x13\x8aY\
+\xa9\x8b\x88\xb8\xb9\xf1\x12i\x15\xcf\xc8$t\xfe\xbb\xa1\x03\x84\x1c\x9aaBN8\
+\x10\x982iS\xfc\xc0\xb9\xf5e\xf2|\xbd\xcd\x02\xcb)e\x83\xeda\x8c%be$\xa1@\
+\xd3A\xf5\xcc\x16\xf9\x15+\xd6\xbc\x8dl\xb8\xfe\x00\xd3\x91\x1e\x8d.\xb7[R\
+\x90\x8bK-\x9e(\xe8\x8dU\x9a\x95\xd2Dl\x8dy\x9b\x8f\xcb\xa6\xb5xH\x80R\x1e\
+\x10Mc\xbe\xb2\xe4\xf6\xc1\xff\xa2x\x82\x00\x11\xf0\x1e0\xdb\x86\x86\x86\x1f\
+\xe3\xd7\xd1!a\xf0\x00Bp82\xfe\x05|K\x84x\xe4qFy\xdd\xbfH\x90|219\x19\xb0\r\
+\x0eb\x91\x9a\xfd\x19\xec)\x1a\x00tx\xecW\xc28\xc1\xb6&\xb7\x93\xe5\xbc\xc0[\
+t\x01\xd4\x07o\xce\xf5\\Z\x88\xda` \xc7\xc8\xe7\x1d\x8cB\x15\xd1\xf3\xcb\xaf\
+=D\\\xa6D`\xc9A\x1e\xbb\xb5\xfe\xfd\xc7\r.\xb8<\x9d\xb8\x82\x85c&\xa68\xeakT\
+|IU\x02\xd9\x16<A$\xb1\x1e\xe8\xe6\xd4\xcc\x8c\xf8\'6X!,\xde\\H,Q\x90\xe6*\
+\xac~\x97\xdb=\x96\xdb\xb37g\xd3}\xc3\x93\xca\xde;\xd6\x82\xf6=&"\xf4\x0cy\
+\xfa\x13[2\x86w%Y\x0f\xedK\xf6R\t\xb1@\xa5)G\x80\x10\x05\xc8\xb1jS\xea+]\x9c\
+\x9d\x93\xfa\x11:W\x19r\xdc\xe1\x10\x81#\xd7$\x8c\xd6A\x0e&\xb2Q\xc1\x1b\xbc\
+\xd0E9\xfee\x9dR\x18\x04\xd4\\%!U\xcd7\x1d@\xfa\xb6*\xf8a\x161Q\x80YPA\xbe\
+\xa6\x0c\xa6:\xd1S\xc6\xb2\xbb*e\xb9\xa0\xf4!s`4 *\xfc\x04\x1fV\x00T\x15\x15\
+4\x94\xfa:B\xbf\xba\xd8"\xde\x02\xc5\xcc\xde}\xad\'\x1b!\x1e*\x8e\x02\x18i\
+\xc7\xd2\x993\x1f\xb1I\x02\x95\tu\x08\xd5=x1\xf5\x97\xcdB\x95\x04I8\x10\x9f\
+\xc2\xa6\r\x11\xfc(vpM.\xbe\x00\xf1\xe5\xe5\xb9\x0b\xea\xe5\xe88l\xf3\x06\
+\xcb\xf7Z\xa9+|\x8c\xc0s\xd8_\x8f\x04\x08\x9c\xf8\xa4\xcc\xe4U5\x98\xff%\x9c\
+\xad%Z\x85\xe9\x8dnJ\xba\xaa\x92E\xe5\x9e\xfd\x0b-\x8bZ\xbd\xdfN\x88\xe3ttt*\
+e\xe8\xfeN\x89x\x04\x04U#\x06\x88\xf8\x0b\xdd\xdd"*\x8e\xf1\xfa\x9c\xcam9\
+\x9d\x9d\t\xd38\x026\x0eMX\x98\x98\xfa\xbf\x9fv\x07\x15\xf7\x9b\xbb\xaeO\xf1\
+G5G|\x89\xab\xad>\x98y==E-\x81\x81\xef\xa9-\xc2\x1f\x85\xea\xf59\x87|= \x7f\
+\xdde\x1cQL\xc6X\xbcL\x8c\x8dUUU#"\xe5D\xbe\xec\xff\x9e\xa8\x99P\xf1\x1c\xfe\
+\x06r\x9f\xda\xbf\xb7Rk\xec\xaa\xef\x18?O^s\xe0{:=\xf7\xd6e\'\xfe0L2r\x14\
+\x9fU\xf1\xfb\xdbf\xefC\xa3#\xe3G\x06\xe3\xc5\xa5z\x0b\xc2\xd5\x8e\xa1\xd5c\
+\xa4]\xe9\x8a@\x01\n\xc0\xff>\x0cg\xa4\xcc\xa7\xf4r\x07\'\xedoW\xb5\xa4\xf5\
+\x04\xf4\x001\x96\xf8\x1dQ\x05\xc4/\xd78\xea\xd2\xe1\xf2p\x89\x0b TG\xc7\xda\
+\x9f\xa7\xffE\xe5\xc81\xba6\xf2e|\xc1a\xb1\xcf\x10\x03\xa2\x92z\x9b\x95\x1a\
+\xef\x02\xe3v"\xe1\x01)\xf3\x95\xac\xc0\x93\x1a\x87<w\x02b\xd4Y\xc9\x1fKtQ0\
+\xd1\xdbQ\xbf\xf2,\x16\\b\'\xdbU\xbdZ\xcc\xb3\x07\xb6\xae\x87M\'\xd2*5\xf6>!\
+@\xa5\xd87\x02x\x8f\xa5\x90\xd8>v3]\x0c\x8f\x8cXJ\xcf\xe4\xfbo@\x0f\x10\x0b\
+\x19\xd2+o\xfd6\x031\x85\xc2s\x92)\xfe\x8f\x06\xf9\xff\xe7\xd7\x00~l\xfd. dN\
+p\xe3\xa3\xc1\x80pqq\xbf+\x04\xf9\xfbw\xaf\x88T@\xe1\xe0\xa6\xd0z\xa0\xcd\
+\xa8@2\xb5\xc6Z\x18\xe3\xc6\x87\x83K\xa4\xb2\xafBi\xe1\xda\xbc\xf52\x10\xb8\
+\xd8\n\xee\x14J\x1d\xbd55+\xa4\xea\xe3\x00\xb0\x02\xf9G\x00\x00\x1d\xc1\xa7\
+\xfcM\\` \xd3\xedg\xc4="\x96\xec\xa2\x13#\xe9\x0b\x0fB\x0f\xaf\x87\x13\n\xf6\
+)T\xd67)\xda\xcd\x92$\x11\x7f\xbc\xb2\xa3\x03\xb2:\x8e\xc5Z\xd6\xbf4\x7ft\
+\xe6R]\xaf\xc5\x11\xe3\xd0in\xa1\xcbb\x12U\x1d\x91\x16\xf17{\x89\x05\xbb\xd4\
+\x99\x81u<\xb1|\xde\xa3\x0c\x0f/_L\xaf\xc5k\x15l\xfb\xeb\xc9\xf1\xd6g\x10%T\
+\xb1\x98\xcb\x9ct\xb5\xc3~\xa5\xa7\x11\xb4\xac\xa5\xae\xf5.\x05\xa9z]\x0e\
+\xe32-\xf9\xb5+\x91r\xde\x8f\x0e\xd8\xff\xbf\xc0\xdbU#<\xbd\x98Am\x99\xf5I\
+\xf1#\x90U\xa2\x97$\x07Q\xa4\x80\xc0\x15\x08ki\xa6v\x9d6\xc9\x10\x84\xa4\'\
+\x97@\x0em\xf3Z}\x9fj3\xb3\xa7`\x14nA\xc5\xf3\xcf\xa6\x9c-`s\x88\xd4\xb9\xbf\
+\xee\xedo^\x0f\x7f\xa0\xdb\xac\xa4\x93QR\xd8\x08$\xc9(\x90x\xc2\x86\x10\xf6p\
+\xaf\xe1\xb9\xfdI\x87\xd4\x1f\x80\x06\xca\xdf\xbe\x18S\x1b\x06B\xfb\xa8\xb9\
+\xb8\xb8\x12\xba?\xc1\x1f8\xf3\x95\xcf1\xcbx\x9e \xe2\xd9N\xb6\xd0\xc5S\xc4G\
+$\'\xb2\x03\xbe\x94\x87\x8f3\xc9\\\xc4\x8c\x97\x13\x00\xbb\x12g\xf4\xd35\xdc\
+\xc5c308\xb3x\x96\x176?\xa2\x9a\xc7\xf6\x97\x91M\x0e\xea\x03Jp0\xfd\xdb\\%p\
+\x81?\x14t}\xe4\xcc\xf7*j\xd2\xa4r!\x8c\x0b\xa1@ip\x1d\'\x00f\xf5\xef\xa0q\
+\xbau\xd3\xb2\x87(\xa1_Y0\xa6\xce\xa7\xc7L\xad%\x91\xbcI\x86\xebc\x01\xa5\
+\xa6-\xb6nR\xc0(\x0c9\xa4\xb7\xe0\x11|\xb95q\xd9Ku\xf7=\x84Nv\\\xb86$\xeeI#\
+\x8e\x1bf6\xbdD@L\x1c\xe0&\xdb\xd52\r\xea\x0b\x1c\x8dY\xb1\x8b.\x9c\x10tqQQ\
+\xd1\xb9\xd1/\'L\xbb\xad|\\\xffC\n p\x93\xc3r\x8f\x18z\x1f\xfb\x04Q*`S@\xf0\
+\x04\xe2\x97m\xf3/\x8e\xcb5\x80\xf0\xfee\xdce_\x189=\xad;\xe46\xca_:\xa9\xa3\
+t\xa3u\xfa\xd5\xa9f\xe9\x84\x99\xb1\xb3s\xa0\xff\x0e\x91\xf6\x99\xbar\xb9=?\
+\xaf\xa4&m\xcdL\x07\'TLA\x04\xbd\x82 \xf0\x80\xc1\xb7\xb8\xbb\x1c\xdd\xb1gRC\
+\x1d\xe5P6M6v\xe8~\xb3\xc2\xd2\x9b\x80\x9a@\x00jbZ\xaeY\x93\xd9\x93R\xa9Kl\
+\x02\x0cC\xe6\xd9\\\xf4\xab\xba\xba\xd6\t\xe3\xb7E[\x9e\x83\xb9\xb0K\xf7v\
+\xd7\x8b\x9fK\xb6<\xa6DYv\x95<\x99\x95?\x7f\xfa\xaf\x17\xa5\xa4$\x03\x11C\
+\x1f$\t\x9fa\xdd\x8d\xac\xc1\xba\x00\xb9k+.\x1e\xb4\xe5\xf9\xf7\xf4d\xc7e\n\
+\xed\x0b \xa8\xcc\x08\xd8\x8d\xf9\xfaT\xb2\x8c\xef\xcd\x91\x8c\xbf\x0eD\x96\
+\xe8\xaa\x1c\\_$n\xf9\xe0gz\xfb\xf2)\xeb\xbe\xb3\xbc\n\xc41\xc2\xb1\xdb"\x8b\
+B<\x87n_\x0f\xb3\x93\xbb\x83*\xea\xdc\xc0\x1c\xa6D\xc0\xe9\x1c]\xba\xc7\xcc\
+\xce\x8dG\x90>\x02\xb1\\WY\xf9g\x1c\xb8gL(\xf7\xe4zXAA\xe1A-\xe1&Y\xe9\x8b\
+\x98\xc2\x10\x96M\xae\x12\xfd\x0b\x01\xfb\x01\'\x98\x92\xfd\xc2m\xf6\xdb}\
+\xab\x02\xfd\x0c\x00?\xc0,T\xe0\x08h\x02\xc4\xc387w\x1ei\x9c\xe8\xb01w\x15\
+\xb8\xc5\xd4\xe9o\x0c\xd2T\'/\xa5\xd2/+\x96\x02 \xa7TivK\x9c\xd6\x1a\xdfO6\
+\xc17{ p$\xdb\xaeR\x05\xff#\xf6s\xb3\xdfs\xf3w\x85>\x05QvbI\xb0d+_\x1b\xc1j\
+\x874\xfbx\x06\xf2O\x99y\xd6\xa7D\t\xd76A \x95h\x94q\x9b\x12\xaf\xb9\xbfDo\
+\x9c\x075\x84\x00\xe5\xcd\xc4\xc4\x94Pp\xfeq\xb5\xd6eYCf\x1a+\x1a\x1d\x80\
+\x1f\xcfa\x8e\xb7}@\xfaHL\xe4\xfe\xf99\xb1\xa2\';f\x86\xec\xaf:\xdb\xaaQ\xd4\
+\xa3\xb7\x93\xac\xecH\xc4.\x0b\xf70\xc9\xdf?[\x9e\x96\xa6\xc8P"\x13@\x81\xb1\
+4\xb5\x80M\x1f\x04?p~\x10\x10\x10x\xdbw\xc1bRQ\xd1"\xcfN\x0c\xee|GFN\x0e~\
+\xce\xc7\x1f\xd0\xfd\xa9\xa3P\x87\x84\xb5\x05\x9d\xb8\xde\xa77&\xc2\x07W3\
+\x82\x17\xfa\xd4\x10G.\x93\x16\xce1\x96\t\x04G\xa13rH\xaf\x1d\x07\xd0\xbc\
+\xf8<\xe0\xff\x00#0\xeb\xcazW\xc6\xfcI;\xc8\x06[\xfc\x87\xe8D\xc2\x0b\'\xb4\
+\x88\xb2{\xcd6622{ \xe0\xc3d\xed\xc6c.\xc8|\x88svn\x8e\xedk\x9d\xf3\xc9\xe8\
+\x946\xc4\xc9\xc4 &\xc6\x80\x94\xfd\xfd\xfb\xbc\xbc\xf0x\xbe\xfa\xbf\x80\x8f\
+\x00g\xcb\x93iw\xfa\xb7\xf1L\xff\x1e0Fm\xd8\xba\xba\xba\x84Dn\x80B\x90\x9e\
+\x9e5w\xab\xc5\x8cjx\xab.\xbbNR\xdf\xbcA\xaa\xaf\xab\xe3\xc8\x00\xad\xacv\
+\x9cA _\xd4C>\x8e\xc4\x19u\x8b\x0c\xfeTR\x9c\xc7~\x9e\xba\x11\xed\xaa\xc3\
+\x0e\x1d\xf2]Z=\x9e/\xb2\x0e\x1f\x9cUCAs\xcc\x9e\xbc\x97R\xecS\x97\xc8\x1a#:\
+\x16\xf0{\xff\xe9\x9d\x1c\x8b\xb4\xf1;x\xa9\x0c\x9bYS\xe5\x19w)fa\x01\x811u\
+\x1c\xec\xe4\x1e\x84\xf8w\xd4\xb1\xa5Q\xf4\xdde\x90/S}\x90\x13\xccE(\x17\x18\
+H\xd8#\xc5\xcct2P\xd9/\xf8\x91\x17_-\xd0s\x95|\x0b\xcbP\x85\xda\xe3\xe6\x8a\
+\xb7\xc4\xaf\xb6&1\x93R\x92\x99\x19\x97:\xedBGw\xf3\x85A\xaa\x06\xfc\xee5mm\
+\xcb\xd6\x8d@]\x975\xaaa\x13H\xcf\x9b\xe5\t\xb2\xbd\x85\xc9\x16\xd3\x8a\xffB\
+e\xae\xd6\xe8\x9cG\x90\xf6H\xff \x8bG\xd6[\xa5\t*\x19\x95\xcfOS_ \x98\x1f\
+\x10\xa9U\xa0\xc4Bn\xbc\x99X\x90\x1f\x11\x18\x18-\x03E\xde\xad"F\xf3\x07@as\
+\x95x2\xc7\xeb\xb5\x8cT\x8cj\xb7\x7f\xf4\xad\x1e\xdb[Y\xfd\x8b\xec\x87\xc3`0\
+\x98\xde\xed\xf0\xfe\xa9#::\x9a/[Q\x10WP[{X\x8cY\xe4\xdb\xc74\x83\xca\xae$Z\
+\x1fq\x9f\xa0^\xf9\xe87=\xd7\x12\xc1\x03\xa6o)s\x104\x13\x0f\xabJj\x88l\xb7m\
+mv\xc3Eg\xac\xbfP\xa0)\xc0\x168\xa8\xb1@{\xffB\x89y\xdf2:\x1f\xa2V\x92~\xbd`\
+\x16\x1c\xa01zNI\xcb]8\xad=N\x7f\xb7p\xc4\x1fA\x92\xaf6GA\xe0\x16\x08\x99$\
+\xca\x0c3\x1a\x1e\xce\xa8\xdb\xe2\\b\xbf\xf6\x9a\xca\xec\x0f\xee\x9c\x84\x0f\
+\x10\xb1\xb7?\x03\x88\xc1\xael>\xceH\xcb\xf9>\xbf\xa8\xa8\xe8\xdf\xc5\x1a\
+\xddtB\x19\xe5YZ\x9b+\x8d\xbdx\xad\xaa\x07\x99\xc4\n\xe2g\'<~hEE\xc5\xd5\xd5\
+U\xddV]\r]\xe2\x07\x99(P\'\xbe]\x19\x0f\x0b\xcb\xe8\xfe\xf36\xf8\xcb\xddh\\\
+\x07P\xe1-\xddgd\xef\x12\xb2*z\x84\xba\xb6\x9d\xa5\xc6\xf3H\x86\xe3\x02^\xc4\
+44\xe6/..6\xba7\x00\x16;`A\xde\x11\xc0\x88\x9bTa\xa0u\xcd\xe1\t\xdb\x12\xca\
+\x95\x97E\xd57\x89\x8d\xf6\xd9\x7f\xfc^gP\xb4\xfa\x91\xd6\x15y\xd3\x99\x02z\
+\xa1\xa6\xf5H\xe1\xf5\x8e:\xc8Q\r\xff\xd4\xe0\'q\x0f\rj\xa8p;\\\x95\n\x8a\
+\x15\xaa\x08\xfc\x13\xaa\xdf\xc4V\x8d\xb6H\x8b\xf8\xbc\xdf\xb4\x15\xd0z\xf5\
+\x96\xa3 sR;\x1e\xdd]\xb5d\xe7\xe2\x92\x9aE\xbb\x7f\x1f{ \xe5C\x96\xdf\x12\
+\xfd \xf1\x97Vf\xdd\xb6\xf9Z\xac\x9aj\xc7)\xe86\x8b\xc0[\xeb\xcd%\xb2v\xbb\
+\xd1d\xd0\xcf\xcc\xc4\xc4 ~\x9eL\x0c{d\x84`:\xf6i\xd4\xd2WnU\xe2\x81\xe5R\
+\x05\x18y\xb3iMM\xb8\xda\xe0\xd4i\xfcQ\xa16\xfd\x13\x0b\xaa\xf4\xc0@D\xfaT4\
+\x04\x7f~\xd3\x977G1\xb3\xd1QQ\x8b\xa7w\x976\xdbt\x03t\xbc\x06y\xfa\x9cz\x07\
+\xcf\xde\x00\xc6\xc9\xca\xa22\x81\x81N\xf04\xbd\xa6\xb1\x98\xf4\xf1\xbc\xdc\
+\x1a\x90\xae\\\xcc<\xe5\x0e\xb5\x9e\xc7\xab\xfc\x9dNgfiz\x10d2x\xc6\xce\xa8\
+\xac\x9e\x9f\x8a\xaeU\xddM\xab\xd5\x01\xf4\x8a\x06\xabA8b.(%\xab"<2r\xc0z\
+\xdd\xb1\xd5\xc4\xd0pc\xb2\xf3\x91\r\x98kvv\xc2\x8c\x01\x00\x19\x13\x10\x03R\
+,=\xa5\xa8\xfdM1\xa6\xe3\xae\xad?Y\xbe\x1ef\xa0\x13\x9cx\x16\xf2\xad\xd2*\
+\x7f\xa1L\x0eV\xf7\x17HL4\r D\xf0`\xa5\x05\'\xee\xc5\xf6c\xafh\xffv\xa2\xbb)\
+\x85\x8cT\x1fh\xc9Lo\xdf^"\xa3v\xbb\x1a:4\xf9y\xde\xa1\xcbHr\xbd\xba\xa2!\
+\xba\r=a\x19na!\x05\x01\xa5\xd9\xce\xbb\\\xd1\xed\xd8+\xaa{\x96\xdf\xbb\x15\
+\x81\x81_\x93\x12jg\x96=`\\\xbfd?\x1d\xbe\x18g\x04\x90\xf0\xdb;\x86+\x1a\xf3\
+,\xfb\xa8X<\xff\xdcj\xc5bxX\xfaD\xa6\n#\n\xc2?x\x8c\x02\xa6\x8b\xb7,\xdeZP\
+\x01\xe6\xbd[\xaf\xc7\x17\x8f\xc57s6\x9db\xc9\xd2\xf7}#R\x10\xea\xea?\xb2"\
+\xec\xe5\x98\x15\x1b\x14\xe8\x915\x19r\xf9vM[\xdc\xfb\\g\x8c\xaf\x0cl:&\xe2\
+\xdb\xb6\x9f.bcbZ\xf5\xde\x0f\x8d\xed0Jn;\x9c\xe7\x08\n\xaf5\xb3\xb3\xca\xed\
+\xec\xec\x00\x99\xb7H\xc8\xbfW\x91.\xee\xc2\xa0\xb4LVZ\xda\xddy_\xb1\x11\'\
+\x06\xcb_\xdch\x10\xe5\r\x84\xf0_\xf8\xf7\x0f\xbe\t\x16\xa8\x8f\x7f\xbb\x19\
+\xd2\xf9^Me\xfbZ\x17~\xfa\x88I\x1ac\x19\x1b\x19\x93%Ej\x9a\x92Y\x0cg\xd67 \
+\xfe&)\xf1\xc3\xdbC\xb2R\x86s\xc3\xf3\r\xfe\xcf\xaf\x0c_\xdf\xb2.\xfe2\xf9%\
+\x97\xca\x1a\\>\xa60\xef}\x94\xa8\xb6\xba\xbaj\x131O\xcb`\xf3z\x0b\x85\xd8X[\
+3\xdf\xc1m\xb4\x9a\x0c\xc6\x14\x16\x16\xf6XVw\xe7\xb7\x11\xfa8\x1d%\xb2hV\
+\xfdx\xf9\x02k\xa1{LZ\xdd\xa5\xf2\xfa\xc7s\xe0\x05\xd0\\^}?\xf1\x94]:\xb9\
+\x94\xa8\xa8\xa8\x7f\xb7\xa3\x00\x912\x05[D\xf50Qb#\x9b\x9a\x9bWiu\xaa\xde\
+\x8dn/\x807\xc7\xbek\xeaE-lw\xfc\xb9\xf7\xd0\xd0 0\x89\xba\xf10L\x03V\xb9.\
+\xee1\x1b\xcf$\nw\xd6c\x80\xc8\xd4\xeb\xaa6\xcf3D\\Zq\xde\x90\xbd[\xcc\xa9-\
+\x7f\xbf\xd4)\xe1B\xc6hX\xac\x95\xef\x890\xe5\xd1c\x106\x07\x86 a\x7f\xae\
+\xc8\xcb\x19o\xadw\xcd6\xd4\x00\xbec\xf6\xdc\xd6A|B\xd3\x8b\xa2{\xaa\xa4\xa0\
+\xe5\x9f\xf7\x14k\xe7\xa4zI\xd9\xbf9Cx\x95B\xee\xde\xe86\x94\x95\x8dh[X\x9d\
+\x99\xa9\xf7\x19\xbc\xeb\t\x10U2X\x1f\xf7B\xf8z\xf0\x0cY\xac5\x91\x18\x90\
+\x004\xa3\xb5\xb5\xd5l4\xa51\xdbv\x94\xc7\xac\xb8\xa0\x00\x1d\x13\xdd\xbaQG;\
+\xa5\x0f\x13\xb3\xc3\xd4\xbfo2\xb9\xdc`-.*\x9c\xc8\xf5jG\xc6EP\x9cF\\\xb3Jo\
+\xe9\xb7\x8d\xe6_A\xabAa>}U\x1d\xea\xe7\xdd\x7f31-g(\x07\xd6\xf2}e\xaet\x05\
+\x99\xa0\x7f_\xe7\x8bD\x1c\x03\xbcM\xc0\xd7.\x0b\xb4\xf7\xdfC&F\x9a\xf2\xe5t\
+w\xcd\r\x91\xf6M\xcb\xdb[\xc6 \xa6\x9fr\x00\xdc\xfc\x9b\xdf\xaa\xaa\xf72\xec\
+\xdc\xb3\xbc@\xec\n\xbe\x9b\xd3\xf2\xf283\xa3j\xb2\xa0\x92\xa43\xa0\xe4\xa0\
+\xea\xc0\xacn\xd8\'\xce\x19\x89k\x17\x89\ti?\x85\x99\xc1@{\xbc+\xddG\x83\xfb\
+\x0c\xff\x17\xd2\xe7\x12\x01\x92\xbc\x19\x1c\x18Hh\x10FqP\xea\xaf\xe1\xb6Y\
+\x88\xb8\xf5{\x85\xf3\xac\x03\x92PTmRRRZ\x1a\x90\x85D!I\t\tb\xf69\\}\x80B\
+\x9dwA}]]]\x01\xd1\xca\x7fp\xffw\xa7\xfa\xf2\xf2r\x03Z\xaeY\xcd\t\xfe\x99\
+\xbf\xfdU\x16\xd6\xae\xec\xce[sA\x18\xd2\xa7\xc4\xa7\x98\x9b\xd3\xaf?$6/\xa4\
+\xff\x12\xb2\xcb\xfbI\x1b\x08\xe6\x88\xc5\x86\x0b\xc4\x0b\x0f\x8d\x97@\xc4\
+\x02B \xe35\xe0\x82\xcb\x8aM\x80T\xec\xecW?-@\xaf\xabA P\x80\x88H\xf9\xd7\
+\x15\xc7Vx\xc9\x7f\xd7=\x01k4\x1b0\xfbv\xb2{jj\x1a0\xf8\x02|{\x81\\d\xe6\xbd\
+;\x92l3_\xf5\xb5\xde\xf5\x14`\x84\xd4\xfd\xdd\xde\xb3\xb4\xac\x8a\x80j\xd0\
+\xa7\xb7W+\x91\x7f\xa5\xabC\xac\xc2n"o\x8aX\x1b\xba\xcb\xf6\x11\xa7Y\x13\xa6\
+\xde\xd2y0X\n\x04\xba\xcap\x847\x84\xcct}y,\x1f\n\xd2r\x04=\xf6\xfa\xf6\xc1\
+\xa1\x91\xb8\xc1Am\x12\xb8\x8b\x85>%\xa7\xa7\x87\x0b\xab\xa9\xaa\xf2M\xba\
+\xd0\xd3\xd1\x89\x92~\x16\xba\xe6*\xd7\xbb\x1b\xedzxd?{9\xea\xb8\'\xc4\xeb\
+\x1f\x18h\x02\x96|tT\x9c\x05`\x1a\xa0J\xd5\xd4\xd46A\xef\x9f\xcd\x92\x18\xe6\
+j\xe9\xb5\xeb\x05\xd8\xef\xd7\x07\x07;\xf4\xcf\x1f\xaf\xf7\x19\x08\x11L\xbbN\
+>n\xfa\x8b\xc2\x8eV/l\x93\x1d\x9cO\x8e\x8c\x88\xd9\x01\x92\xf8W\xbd\xb2\xb8\
+\x9a]\xd8/\x99\xaa\xef\xa7\xc2\\\n~*[\xab\xd7\x14`\x03@\x1a\xe6?oW\xd3\xd2JK\
+JB\xe8\xad\x19\x89\xb7\xa8\xeaXZs\xad;\xdd\x1a\x88<\xa0\x93\xff`\xcaj\x98U.\
+\xb0\x87YCq\xde\x8au\x17d\'\\\xc1\xcf\x81\xc6V\xd9\xae\x0b2\x89\xcae\x9fe\
+\x1d\xd1\x14S\x1c_\x1c\xcc\xa3\xaa\x9b\xeb[\npE\xd5\x8a\xeb\xe9K3\xcb\xffl"\
+\xdc\xa6\xd5\r\x99\xf4\xda\x86\x8e\x96W\xb3~\xad\xc3\x8b$2Awb_\x84\x81N\xba\
+\x7f\x93\xef\xaf\xc1\x12\xfa\xb8\xe7\xda\x16\x19\x01l&d\xd7\x97\x07T\x1a\x01\
+\x8e\x03\xb57\x9aB\xe8z\'\x94K@\xc0\xd6\xa1)\x91\x01z\xd5\xbe\x92\x97\x977S\
+\xac\x94\xcb\xe7b\xed\xec\xfcaZ\x11\x87\xdf\xf5\xcf#\xff\xf22\r\r\r\x87\xc5E\
+?\xc0u\xf1I1\xfc\xb8\xa0\xb1\x99\x05\x8b\xce\xc9\xac\xb88\x0eNN\xe3\xcesa\
+\x01JMV\x03\x99)N \xfe\xcf\xce\xce\x86VjP\xe3d\x05\xe17\xe6u\x8aN\xcbm\xf8q\
+\xf8-V\xfd,\x81\xad\x03O\te\xb9\x12\xe0!\x8b\xf0{CJk\xf0\xa6\xb9\r\x84OO/\
+\x8b\xc5\x0c\xf3\x88eOc?O!\x04B\x8b\x81\xee\x80\xfeY\xef\x0e>\xd6R\x9b\xa93\
+\x1b\xdd\xda2&6I(\x00@-8h\xf5\xe2\xe2\x1b\xc0\x15\'\xa9\xfc\x8an\xed\xeb\xce\
+7@\x98?<C\x04\xb0\xec*\xe2\xd6\xce\xce\xce7WXH\xc8\xd7\xd4\x94\x96\xe9\xdf\
+\x9fp\x10\xd2\xde\xa0\x84\x9e\x1e+S\x03\xad\x0c\xf4N\xd7\xa1\xb1\xa1\x89HaI\
+\xeb\x06\xe0\xd9\x03\xc8\xe3\xf5r\xb3\x83\x92\x92\x12\xb0\xdfF\xde\xe5>T8\
+\xcfa\x98\xb5\x8b\x9b[A\xdbF\xe3\xaeU\xc7\xd6\xbe\x99\x05\xa9\xfa\xf0-&\x85:\
+\xc9\xcc\xb2\xaf\xb5\xde\x85\xff\xddj_\xf7\xa8J\xdc\xa1D\xbe\xd6\x9a\x9c\xa2\
+\xea\x17\xfe\xe3[9b\xc0\xfd\x81s\x16(fRT\x9df\x86Mj\xa1?aw\x9b\xfd%\x8b\x8a,\
+MH\xca\x1b\x97\xaa0l\x7fY\xf5h\xb1\xf8\xb0\xef<\xf4\x05\xa8H\xf0\x84\xbc\xe3\
+\xd0\xfckF\x04\x02dj\xfc\x1f\xa13\xf5\x16Ho\x90@a\x1d\xe4J\xd6\xd6G\x80&\x01\
+"\x01\xd6\x1a<\xc4<\xf0\xe2\xa0\xe7Stk\xd1\xab\xea\xef\xef\xaf\x9ax\x7f\xb1\
+\xd3@2MkC+.\xa9\xa66c\x91\xebC@J\x9a\x99\x93\x13\xf3\xac\xf5X\xbb\xe0\x7f \
+\xcaJuX\xb8\xb6\xb66)\xf4<\x16w;h\x06\xb8%\xaf\xb0\x1f\xbey\xc9\xc4\xf7l\xa0\
+~\xfb\xfe"\x02~m\xd5\x18\xd9S\xae%\x96\xb7\x96\xdb\x9f\x8d2\xf6\x078\xc34\
+\xbb\x1f\xea\x81C\xc6\xdf\xcc\xc7\xf32\xae\xae\x9c\xc6h\x16\xfbL\xbc(\x08\t\
+\xe5\x08\x01\x00k\x97\xa6\xd0H\xcd\xb3O"0\x9d\xee\x9bR\xdaQ\x93\xd7\xab\x9cG\
+\x0e\xdc\x7fd\x14!\xc8\xc8\xd4\xb2\xc4\xe9I\x89\xa8\x85\x86\x85h\x10a\xc2\
+\xc8\xdf\x14\x8c\xfdrS\x81l\xeb\x12~G\x00N\xcb\xefdTe\xcb/\xb4/>\'\x87\x1c\
+\x19A\xa3Jo\x98\x08\xd08Q\\\xb0X\xce\xb7\xdf\x1e\xbf\x07\x06\xe8\x80.\x1b\
+\x93\x8f/OE\xd7\xac\xf2\xfdm\xbb\xc4i\xec\x0b&\xda\xf1c$\xb1\xec\x8aVi1~\x94\
+]{\r\x95\xa8\xbe\x86|\xfaf\xee\xe8(\x03\x18\xc30\xbb\xb7\xb8\xdb\xc0\x00%\
+\x1f\xd1\x9a\xd7\xe2\x18\xb4\xe9\xb2\x19\xf8\xc5\xe1IB\xc8\xda\xbe[S3\xf4\
+\x92\x01Z2gmbl\xfc\xf3\nX\xc1<$ ~\xfc\xf7\x18\x03(\xd6\xd4\xcc\xac\xc7\x15\
+\xe6\x99\x8e\x18\xd1\xfd\x8ef\x19\xb6M\xe8F\x04v\xeb[\xf0U\xac\xdb\xde\xb6\t\
+\x82{4\xa5\xb5\xf2\xc7\x8b\xcb\x01\xe9\xd1\xeeQh\xd4\xf7\x8d/\x17\xc2\x9f.\
+\x82%\x06\x0fcb\xb3\x15\x01\xb5\xfe\xa4\x80ip\xbe\xe7\xce\xd5\x92\x1ew\xf1\
+\xe8\x8fx\x02\xa5\x91y\xfauN\x16\xec\xce4Z\xb7d;\x7f\xe8|\xb1$V\xe7\x03&\xea\
+\x85\xd5b\xbc\'\xa7\xf3\xca\xd0\xe8\xe4\xb0\xd0\xb5\x01@v\xc9V\xb2\xd1\x9b\
+\xfc\xbdl\xb2_AU\x8c\xf0\x11\xbcz\xa9\x9a\xb3\x1a&E\xf5\xfa\xb1\xd3o\xbd\xf7\
+\xa9\xbd\xa2\xc8U\x0e\xed\xa3$\x07\xa1\x0cXh\xc4\xfc\x06\x02\x17\xc6b\xc6\
+\xbd\xaf\x84w\\`\xbd\xf7\x0b\xb8J\x02\xa2>\x81\xf2\xa2\x0f3\xfb\x89\xf1\xf7\
+\x047A\xb4I=m\xefJ\xcbg\x0e\x9d\x9dy`\xb7\xb7b\xe6\xec\xbf[\xf3\x12\xbd*\t\
+\xdd\x85xn\x84\x185\xe1\x15t\x0f^\xe7)\x01A5\x82\x0f\x05u\xb2}\xb8/\xf7Q\xd9\
+\xecUi\xa0~\xe6\xf6\x8eF*D\xda^\x1d\xad\xd7\xb4\xc5\xffq=\xce\xe8\xe0\xec\
+\x0c\xec\xce\xc6\xc8\xf8\xf3\x9a*\xecZ[\xfa\xb3\x05\x95\xcd\xb7\xc5\x15/\xde\
+\x1f\xb4\x87\x99k\x0e\xd6\xff]|.4+\x0c\x10\x01\xbcZ9\x0e\xa5E\xa2x&\x9eWwQ%2\
+~p\xff\xc8\x13\x88;K\xf6\x9a\x0fL|\xff}\x82pR\xe0\x85\xf52\xb6m\xc1\xaeQ\xe7\
+\xb1,j\tl\x91\xe3\x83\xc4\x15\xd8\xb6\x90\x1d\x17\xe7o\x85\x0c_\x9b\xd7IEE\
+\x15\xf0.\x14DXPXx)\x8f9\xc9#3m\xe2\xca\xf1\x03\xe7\r\xe7\xd9\x03F\x0e\x07\
+\xc9\xb1\xb7\xfc[\x1f\xc4\xce_\xe8\x0b\x0c\xfb\xea\x0b\xdd\xea\xbf\xc7\xf0\
+\x11\xe4A\x9c\x06S\x0e\x9d\xdf\x0e}\xf0c/\xe2%"\x0c|\xf2\xf4~\x1e\xb9\xef\
+\xd7\\\x84L7\x90\xd4Gk\xa9XJo\x90D\xf6@r\xe1\x088\x80\xd4s\xe3)\xa8E\xb2\x1a\
+\x1d\x10\xb9\r\x1a3\xe7\xca\xfdJ\xda\x17i@\xe433\xfc\x92\x95\x99j#l\x0f\xdd\
+\xcf}\xa9W,\xde^x\xac\x91+\x0c\x90\xbb\x1d\xefE\xac\xba\xfc\xf8\xb4\xa6\x92\
+\x83\xeeV\xdd\xd6\xd1\x91\xedfS\x98\x9a?\x82A\x8c\x141mAE \x86\xa3\x0e\xd6\
+\xd2\xd1\xd1\xf1\xf2\xe2\xa7\xf8\xa8|\xeb\xf4EQ\x11\xb3\xe3c\x0cU\xcf\x1f=\
+\x8b\xda\x0f\xcb\xa7\xfa]\xa9\xd5\xca\xe3\xd2\xfd\xcdq\xc5\xee\xf7\xb09\x85\
+\x18o\xa7\x1f\xa6s\x13/\xe0\xb3\xf7\xf3\xd2\x04=\x8c\xf1\x1eUf\xc3a\xa4\xeb\
+\xd4\x9e\x11\xaf\x913\xf1\xfc\xfb)\xf4f\xc9\xab\xf2\x18U;\xa92(\xf0\x7fk\xc9\
+\xe0\x14x>\xfc&W\xceU\xe6\xdc\xd7Z\x84`\xa5\x13\xb0\x90"\xfa\x02\xa7%((x`3\
+\xd4\x1c?\x91\x9e\xc1\x07=\xbe}:\xe5o\xe2\xedX\xef\x17\xb6\x1f\xe3I\xb0\x11l\
+\t\xcc\x9a\x0e\xa7\xd0\xb2\x94\x97\xd3\xc3TJx\xfb\xef\x9a\x89\xc5-\x12**\xea\
+\xc3\xad2\xaco\xc0\x96\x051\x8e\xe4\xff<\xeb \x03\xe9\xa9\xa6O\x0co-\x01N\
+\xad\x88\xa3A\x0c%\xe6\x80\xfe\xcb(\x85>\xb8E\x19N\x9cq\x97^C\x0c\x99,\xf6lE\
+\xe6\\\xee\xf6\xa2\x91\x89(65Y9d\xe2\xf4\xa7\xc9\x10\x9e\x1e\xefo\x84PEe9\
+\xe2v[\x8a\xe1\xf4u7\x9f~P\'\x9e\x0c\xe8\xa1\x08\xb2\x16\xe1\xc7\xe4\xb2\xab\
+\x9e\xc0\x90F\x08\xda\x1bf\xad\xa9y\xcc\r\xe6\x01\xd3\x8e\xc0\xd1\'\xa2\xf4\
+\xba\xda)\x9c\xde\x91-?:H\xf6\xbd50>\xca\xa5bc\x8b.\xcb7\x1a\x89\xd5\xf1\xfd\
+p\xcd%W\xa0PA{\xd8\xf3\x15\x92\xe1\xff\x18\xf9\xd5\x0f=\xc7\xd9\x87V\x80\x9d\
+\xf9:hr?\x11>\x00f\xb1\xa8\xb8\xf8\r\xb5\xff\xf6\x8f O\x145# \xbf\x08x\x80m\
+\xb7s\xf6\xefD\xbe\xf4\xc4:\x80\x89\x82g\xd4\xda"vGIe;1\x7f\xa7~6\xd6\xcf\
+\xecV\xef\xfdm\xdc<i`\x98\x9f\x87\x81<\x19\x9d\xe8MB\xee\xddu\x89\x1b\xc0\
+\x8e\x97\xfc!9\x8c\x9e\x9a\xd4\xcfp\xbc\xac\xfd\x7f?\x0b@B\xaf\xf0\xbe\xa2\
+\xe5\x10\x83,\xd2_\x18\xdf\x06\xfdv\x11\xcf`_\xc3\xc4\xe8\xba\x0b\xb4|\xe0\
+\xf4\x9brxF\x83\x82\xa6{?\xd1\xcb\xd3SRJ*>"RX0\x01I\xa3\x80\xc6mVZNn{7\x0c\
+\x10\xb0\xc4\xe1\xfe\x16*\x1cd\x84n\xa7\x08\x18Q\x92w\x10\xe6\x91*\x8a\x95\
+\x88JV\x05\x16u\xe1\x03Z\xfa}\x1bJ\xfd\xde-\nt$\x0c\xe2\x90\xc0@\xb8lE)~\x9a\
+l\xc5}\xa7\xdf5{\xe5s\xd1\x13M\x1a\xa3\xf0\x04\xd6\x19\x93n\xf9iM\xb4_^Y[\
+\x19\x99Y%\xbf@\x9c\x06\xab/\n\xbc{\x84\xd2\x1d=\x152\x0c\x1e\n\xc8\x8c\x16<\
+^\xe9}\x94\x83\xa5%\x10\xa9\x15@\xd6.\xd9\xf9\x0c\xe1\xee\xafd\x1e\xa2"\x8e\
+\x01\xc6\x11dR\x05.\x03qF\xdd\x98fH\x9e\x07\xba\x01\x88\xb6P\x93(\x85\xfe\
+\x1a\xbf\xd7}?!\xbf\xd7v\xd3!\xc3(*\x04F:\xba\xe0\x7f\x1fxwXi8l[\x7f\xb6\xa7\
+\xc4\x96VR*~f\xfd\xf0\xde\x08G\x9c\xa4b\xb8R4\xc3T\xa1\xbc\x1eQ\xf25f\x86\
+\x0c\x19\xd4\xadT\x82\x1b\xd3\xadX\xfc\xfd\xf4oc\x8b8\x12\x9b\x02#\n!\xfaU\
+\xcdQ\xa2\xc5{\xa7\x142\xefSJ:\xf6\xdc0#\n\xfel\xf8\x97\x97\x12\x02\xbaK\xfd\
+\x0b\xb8\x1f\x9a\xe8Y\x19C\x90\t\xa2\xe3\x8f\xab=D,Ll\xe9aF\xc0O\x81\xc2\r\
+\xb6A\xdd\xb4\xf4\x1f\xa00z{\x94\xc6\xe8U\xffR?)\xa4\xdb\xf6\x1f\xba\xad;\
+\xf0\x91\x00^\x95\x99\x8a\x96\xb9\x04p!\xc0\x05-<y3\x8c\xef\xe2p0\xae\x87G\
+\xe3D\xdf-\xec`\x88\x86\xf0!\xd0T\xe8\xfd\xc6\x99\x90\xae\xc9\xc98\xe7J$\xa5\
+[\xdf\x0f\xdb\xe8~\xd3+\xec\xf9\xc3\xba/\xf7\xe2\xbc \xe4\x0fT\x95\xf14\xb4\
+\x7f\x17\xfa\xed\xbe\x15 d\x0f?\xaa\x1ci\t\x0f\t}\xae\xab(\xff\xe1\xc4`c\x82\
+\x07Q\xeag\xb3\x07&\xc5\x89\xe9\x9d\x16\x94\xf2\x9d\x95"R\xfd\xc5ca\x93\x8a\
+\x82\x02Z**\xd8\x05SZ\x9a\xc7\xb2%{%9\xb9_\xbf\xb8\xf1t\xec[\xab\xa5cK\xfd\
+\x17\xce1\x90\x828\xdes&;\xc6L\xe4kX\x1e\x127{\x9a\xec\x16s\xe76\xdd?t\xb5\
+\xb5\xf1\x83@*\xa8\xd9&\xa2\x81H\xc8\xf6%\x0e\x94\x9b\xef\xe6\x98o\xbe\x97\
+\x10\x98\x8a\xb8r\x98\x93\x02\x92\x9d?l\xda;M\x82\x8eTZ3n^\xafS\t\x19M \x13\
+\xddRd\xfc\xf7PP\x83\xd7\xb4\xaf\xcb\x05\xe5\xb6\xc6W\xbe\xae4\xe1\xa1\xb4\
+\x12\xb1\xec\x8f*\x0c\tWb\xb5\xed\xe5\x85\x9e\x03\x9b\xeb\xb3\xcd\x9f\xe1\
+\xedL\x1f\x12\xac\x8d\x02\x8e\x8a\x95\x8a\x16\xff2vG\xaaxW_\x99I\xdf\x857\
+\x04`\xf1\xff\xa0>\x05\x01%e\x91\xe3\xcb\x83#\xd8\x8c\x81\xf6\x0c\xa1\x10\
+\x0f\x81e\x16\xf1f\xd6\xaf\xdc=s!\xe5D\x07\xc2\x9e\xa40\xd4*\xbc\'\x0252\xf3\
+\xf4nUx\xe5\xabW\x0b\xbd*\x8bP\xee\xca\xf4t\xa0\x14\\\x00\xccQOg\x06\x08\xc9\
+\x0b\xeb\xb0\x1c\xcf\xc4\xd1)\x80\x00\x11\x90\x8bn\xc5\x82\xc9\xe2^\xa9u~\
+\xe6Q\xa8\xa3\xd3]|+\x1fc\x8a\x07J\xca,q\x12k{IM\x8b\xb7\xcf\'-D\xe8\x0cmIN\
+\xc1\x1f\xe1\x06+)\xbbr4\xcd\xbe\xe2\x9fK\xf6\x0cf\xcc\xec\xcd\xf5q)\x13\xab\
+\xc7\xaeY\xdf\x80,\xda^\x96\x18\x08\xeb\x8c\x87_\xf4|\xf0!\xd83\xaakc\x89T\r\
+\xa6\x8c\x84\x8c\xac0\x9c\\\x99q\xc7\xe3"\x13*c8\xc4\xc1\xf8\x01/":\xe1\xef\
+\x82\xffZ\xea\xa4TA\xf7\x8ey\xd8\xa3\x7f0\x1b\xa0\xda\r\xa5\x7f\x81I\n\xf9\
+\xcd\xe1\x10\x15\xd4\x94h\'\xa9v\'\xe2\x07\xed\xef\xff\xec\xe8\x88\x12\x1c\
+\x83\x11:1FDN\xae\x0f`\xd7\xc2y\xa5\xef\xed\\\xce\xa4\'_\x1b\xdf(\xcb|\xe8\
+\xednF\x98\x11\xf4\xce\x01\x9a\x92\x9d\xfd\xf2-\xb8qni\xeb\xd6=2R\x0e\xe9\
+\xe9yJ\x03\x88t\x0b\xdb\x032\xa2\xc0\xf9E PE\x81Z.E%\x83\xfbG\xc5\xaa\xeav\
+\xeeQ\xcb6\x8a\x91C\x05\xec\xca\xe6\xf7\x13\x81L\xa2M\xee\x0e\x9c\x96\x1b_\
+\xb6F\xf9\xed&*\xcb\xced\xc0\xeb+\x10>\xf0\x06\x15_]Y?\xf4\xf3O\xbaP\x87IO\
+\xcbu\xd9A\xd8\xb6\xf0ppq\xa5\xa4\xa4\xbc\xbc\xbc\xaa\xf5;P=2c9Sn\xa6\x81j\
+\x1e\x1b\x1b\x03h@\xd0\xe7\xe9\xe6\x05\x11Q\xf8o\x9b\xdb\xf3\xddi\x9c6\xf6vV\
+z:\n\xaf,x\xf1\xdfG\x06\xe8\xe9\t\x08S\xdd\x9f\x9e\x94eTU\x13V\xed)\x0e\xce\
+\x85\x1f/\x07\x81\xd3\xfd3\xf4\xa7\xed\xbc\x1dM\xc9\x14L\x84(\x9b\xc7a\x9f\
+\xb0N\x8br\xd7\x0fa\xa2\xfa\xf3\xc6\x8cJS\xee\xda\xc7\x1cAoK\xbb,:\xf8NV[[\
+\x1b\xefD\x84\x14\xd4\xa22\xbd\x90$f\x9f\xf1\rgr\xd2 \xf9\x9d\xd3\x97\x02\
+\xb8\x16\xe4\xcc\xbd8\n\xa2\xce8\xae\xc6X\xfe\xd10\xbf\xb2mg)\x00"\xf5\x16\
+\xc8J\xb9L\x89\xf1,\xe8\xc6?\x11\xd0B\xaf\x15S\x17qLt\'\xc4\x98a\xdc\xaa\xf9\
+\xb9\xb9oM\x8a\xaf\x81\xbc\x81\xe5\xfb":B\xd4G$\xa78\x0f\x8c\x90#\xe9-!\x10\
+\xc8nf\xb1r\xca>\xa9_\xcfU\xaf\x91\xce3\xf8Y\x9aZZZ\x1e\x1c\xcd\x95\x87\xd5\
+\xf6h\xf1\xae[\x14\x19f^\xdal\x8f\xa6\xb0\xc9\xc9\xc8x\xecg\xbb\xf1x\x9b\xc0\
+\xe7\x04\xae\xbf>4:&p\xe3\xc1~\x0fQ\xc6\xb1\xf1\xaa\'S\x93\xd9\xff\r\x10T-\
+\xed\xa1\xf0\xf3\tW\xa5\xab\xe3\xfe\xef\x89\xc0\xc0@\x17\x02\xb4\xc2y\x84}\
+\xf8\xf6A\xfe\x94\xb3\x1dS\x0cs:\xf7\xdb\x9c\xf3\xa3\xb2Ee\x90\xaf\x9d\xb7\
+\xa9\xe9N${\xe7\x1f\xeb\xffE\xd3Y\x86\xc5\xcd\xb5]\x1bwwwww+\x0c\xee\x94\xe2\
+\xee7P\xbc\xb8\xbb\xbb;\xa5\x14(\xee\xee\xee\xeen\xa5\xb8;e\xbe\xf4\xf9\x8e7\
+?9f\x92\xc9\xde\xd7\xb5\xd6:\x93\x9d\xd0DC\xae\xbe}\x06\xa035?\xfb\xca\xd9Mp\
+\r\xc6\x84\xef\xc7\xfb\x0b\xea\xcej #n\xac\x02c\x82\x86\x86\x86\x08\x19\xfa\
+\r\xc1T \x10o\xbf\t\x19\xda\xda2-B\xe2\xbf\x8a\x95:\x06m\t\xeb\xe49\x13aoZ\
+\x17)\x8b\x9d\x16U\x89u\xd15\xc2\xa9\x15\xca%\x8b\xb1\xb1iU\xb1\x14v\x87\xb5\
+\xb0\xd7p\x99\x14\x95\x07I6\xa0\x10\xc2\x95\xa9<g2\x0c\xbf\xe0Pk\x96\x03q\
+\xf3\xf0\xf3\x17{\x98\xe7Q\x1b1NH\xe4\xff\xe0}\rB\xa1~\xfe\x13\xcb\xbcc!\xc0\
+W\xefn]n\xf6~\xab\xe6\xce\x07\x1f\x06<\x04\xb9\xfep\xef\xa7\xaf\x11\xd4l\x00\
+\xd2k\xcb\x86\x1f \xa2\x9b\x9d\x06F\xc5\x03\xff\x92\xee\x1c\xd6\x14A\xc3\xc6\
+E\x0e\xbf8\x97\x88\x08\x0f\'\'&\xdf\xa4LJ\xe5\xcd\x8b\x9f\xbc\xbc|~\xb7\x98y\
+\xf3\xdc\xd5\x1d?/oU\x8dN\x82=I\xa3\x91|\xb2\xbf\xba\xaf\x08\xe3E/n\x90\xc4n\
+\xca\xe7\x02\x11M\xa3iI$&\xa5/\x040e\xef\x7f\x7f\x16\xab\xb1\xf9\xdf\xefE\
+\x00 \xee\xec\\\xc7SE\xd0\x10\x87\xd3\x0em\x86\xb2RPpt7\x86\x90\x16B.\xb6J\
+\xcd\xc6\x86\xc7)\xc7\xf2#\x87\x85\x91\x95\xd2\xb6NY\xfap\xa7D1C\x84l\x06 \
+\xcd\x86o\x1bZ\xd7KsO\xf1x\xb8\xb8\x9f\x16\xd6\xdc\xebYyy\xbf\xe5\r\x05c\x8a\
+pq\x01\x9d\xf3\t\xf1\x86\xcf\x9b\x8b\x9b\x1b;\x0fb\xcc\x0c\xc8\xed\xa1\xd2s\
+\xe3\xe2\x02\x1c\x809\xce/,\xf4e\x01\xa7\xbe\xe5\xf04:*gkkK\x81\xd1\xeayCU\
+\xd0\x14\xd6\x9a!I\xe9\x14 \x90\xea\x1eg\x96\xdb\xbbz\x8f\xfd\xdb`\xd0\xe6\
+\xd6\x15\x04`\xcbx8\xca7\x96\xff\xde|\r\xf0\xb8q\xe0\\\x93/\xf9\x04\xdd\xa0\
+\xa0\x8e\xd8\x0b\xa5\xbb\x81\xd1\xedd\xaf!\xfdq\x0f\xe3=\x06\xf0\xb0\x19\x8d\
+\x85\x95\x95\xc3\xf6;\x822\xe7\x0f\xe2|F\xf8I"\xa0J\xcd\xb7\x8f\xae(\xd6S\
+\x83\x9d\n[\xbb]\x8e\x90x\xc0\xe7\xdey\x84\xe1Pp\x7f\x84bh\x01\xa2\x11\xd4m\
+\xb0\xba\xd0\x03J\x89f\r\x85%\x9a2-\'\xe3\xed\xe3\xed\xaa\xa6F\xa7\xa0\xa0\'\
+\xba@a\xdb\xff\xac*)))3\x93 v%\xfc5\xfc\xfe\xde\xadec\x0bP\xc2{\xd3]_\xa2\
+\xa6n\xb5\xe6\\W\xeb\x99\xf6\xadK^\xbb\x15\x05\xef([\xe8c\xb7\xfc\xb3PV\x08\
+\x85\xe7=56\x88\xc31\x89~q\xa4[k\xca\x93\xf0\xfe\x08\x9b8ey\xf9r\xa0\x05\xac\
+.r\xac\x1a\x08\xff\xbb&0\x07\xa8\x16\xd8a\xe9B\x9b\xe7\xcd\xfeT\x0e\xf9\xcb\
+\xeej\x9d\xfdg>\x8d\x1c\xd3\xc5\xe1\xc1\xc1\xfb\xfb\xfbMc\xb5\xdd\x933\xd7\
+\x8e\xadD:\x02\xf33\x16\xbc\xc6`4\xe7\\\'\x89Q\x8f\\\'\x82z\x94D\xb0\xe2\x84\
+\x02g\x14\xc7pm\xf3\xd3\xd3SBll\xa0\xa0\xac\x8c\x0c *\x07\x07\x07)\xc9\xc9\
+\x93OY\xecF\x9dr\xe2\xea\x05wD\xfe\x1ft\x8eG\x94^\xd1\x9apYYY\x99\xb1jd\x07\
+\x90\x92b?\xa5\xeb{j\x13Q\xa4obD\\\xb9\x86g\xc7R\xbdc\x9b!\x1a\xfb\xef\xbc\
+\xb0\xc7N\x12\xef\xc1@\xca\xf8E\xfe\x1d\x06\x99\xd6\xb2\xb0<`\x98\x85C_\'\
+\xf1\x1d}-\x8d?7\x906qD2\xf9\x1e\xf0h9\xef!vL\x16\x9c\x9d\xf0O\x88\xfe\xc3\
+\xe3\xe1e\x9f\xc4\xe6\x8d\x82\x90\xfd\n:\x0c\xaa\x81\xba\xfd\xf7\xba\x1c\xe8\
+ \x89\x80\x00q\xdd\x13\x02\xf3\x10\xe8\x90\x0c6\xc3y\xdb&|v#\x11\xd7\xdfJ\
+\xbe\xbe\xbe\xde\xde\xafB1\xd2\xf3\x8a\xc73\x05Oo\xefv\xcb\xd5\x7fwW9+]F\xf7\
+ ]\x93(\x07\x9c\xb4\r\x80\x0f\x89`=S\xef\xe3\n\xc7\x00\x12\xb2\xbf\x9f\xdc\
+\xda\xaa\x93ys\xcd\xc6\xd1\x1f\xc44\xe9\x1d-!$\xa4\x8bs7\xd7\xdb\x0b\xa1\x89\
+\xe5_\x10`b"Q\xb3BM\xc2!\xa8{W\xb7\x90\x95\x9a\xdah\xbf\x06\x80~\xba\xa5\xa5\
+\xa5\xdf\xe3\x9a\xb5Q\x02\xd0\xf3VVV\xf30\x87nBI\x0f\xf6ff\xc1x/\xb8\x13\xda\
+\x1a;f\xcda\xfel\x8c\x8c\x88\xf3}m\r\xd6\x80\xe6\x13\x98\'\xca^\xa3\x13*\xf7\
+\xeeQSS\xb3\x1c&\x0c\x12\x10\xf7\xf0\xc5G\x05>\xe2\xdc\xe3l[f"\xc3\x80\x0c\
+\xa8\xeb\x98\xd9j\x95wS\xa0n\xa3\x10m\xe2{\x1b\xe5x\x19\xcc\xa2_$\xac\xce\
+\xa7\x19\xf8!\xad\xf4\xfd\xc3\x8e\xdfD^^I!\xfd\xa1\n>7\'\xef\xacm\x87?$\xa9|\
+\xcdFo\x0f\x84\xfd\x0f\x1cR\x90\xd5\xbfI%\xef\xad\xfb\x91\x80\x00\xa0[\x05\
+\x07]\x12o|?7\t=\xc9\xc5\xc5\x85Z\x94\xd4\xdc\x14\x15\x81\xfd\xae\r\x08w\xfe\
+SH\xa7\xb0\x89\x9e\x1e\x919\x8a\x91\x07(\x87r\x80\xe2b\x81\xbc\xbc\xc2\xaey\
+\xa3\xa3\xa3cdx\x18\xe0\x92\xab\xa8\xc1j\xd5@ta\xc9\xfft\x19\xd7\xa1h\x0f\
+\xdb\x8b=\x8d\x7f\x81n\xb0M\xf8r\x0c\xd9\xf0\xcb\xccb\xbf\xaew"\x16A\x0e~\
+\x9b=\x86\x87\n\x9a\x9bS\x0f\xe5HbM\xdc\xd7!0\xe7\xcb\xf9\xf7 \xfc\x8d\xb7\
+\xfd3,\xd7\xf4\xae\xa4\x7f\xa2\x0e\x9c\x97\xb1\x12\x14\n\xaa\x8d\xe1\x1e\xec\
+\xa0\x00?Y\x13QAK\xd1u\x12\x9f\xaf\xf6\xb3\xe6\xc7c\xd2w\xf1\xd1\xb6\xc4\xfc\
+/\xf6W/v\xf56e\x86\xf9\xfd\x1f\xe5p\xe4\xa8C\x9a\xa5\x04\xd3\x82x\x87\xaf`\
+\xff\x05u\xc0\\\xbe\xd1\xe5\xf2J\xdb\x89\xf8\xf9\x8d\x88\x0b\x89qr\x16-\xb1\
+\rCI&s\x9b\xa3LP?\x96\xa8u\xd6\x18v\xf0\x89\x07\xe0\x86O/Uh\xcf\xe4\x8b\xe6d\
+dT\xb8\x8f\x05\xca\xe4\xb9=\xeb,\xeb\xd8\x14\r7\xbd\x88\xb9\x02s\xa4nZ\xb7\
+\x7fS\x94D\tt\xe5T\x11Q\xc2\x889\x07\x81\x82\x82\xa2\'9\xee\xed6d\xde\x0f\
+\xa8\xc1i(d\x04_\xffg^[\x017\x1a2F\xa8\xd5\x074\x8e\xb1\xb1\xec\xca\xcaJd|6\
+\x8e\xe1\xe4\xe4d\x8aO\xad[\x97{{{\x80\xb6C\xe8C\xf3\xc4\xc7\xc5\xc5\x01M\
+\xf1\xef:\xf4\xb5R\xf9\x82\xcd\x10\xf0\x07\xc3\x06w\xd6\xfft\xe6f\xe9K\xc5\
+\xe4\x95\x94h\xb6\xc4\xf2\x18#\xddP\xae\xed\xf7\xb4\x7f\xb7\xb6\xae~|\xf8S\
+\x85s\xf2qqA\xe1BTb\x99HvB!\xdeu\x82\xd1/.\xd4\x11O\x10\xfe\x1c\xec3\xcf~\
+\x14hSI\x9c\x05\xc1\x12\x9eb\x19I\xecbc\x94s\xc7L\x99\xf8\xfd\xc4\xa1NM!\xfb\
+\xdb+\xf92g\x8b\xbe\xd2\xf9wY\x7fVi\xaa\n<\x13|\x08\x0e\xf0zHk\xb2[\xf9%\xec\
+`c\xf1\xe7\xa2e\xdb,\x96\x96\x8e\x0e8Y2\xf0\x1f\x01\x1c\x95w\xb8\xe4{\x8d\
+\x1f\xec\x81i1\x9cV\xdd3\x9d\xee\x17zx\xe3qUe\x84!\x93\xce\xfd\xffF\x91)\x14\
+dB\xb0\xa3\xd6\x16\xf1\xe5\xb4\x97\xdb\xfe$\xb9\xa4\xcf\xc4\xc9\xd3\xd3\x13p\
+\x88N0\xf9xb4\xb2\x9e\x10\xc3j\x1f\xd6\x8f`\xba\x01Hd\xcb\x1eKJ\xf6F\xcaK\
+\x12\xe6a\xc2\xae\xbe;ll\xec\xe2\xe2bhhh\xe3\x97q\xed\xc2\x8d\x81\xf7%@\xaf\
+\xc5\xc4\x00\xef\xbb\x8b\xc1g\x8f\x8f\xfa\xb7Q~3T`hB\xe4;\xe5\x90\x895&\x8e`\
+\xea>=bJ\x19\xd3\xd4\xd3R@r\xd7\xf0\xa0^\x1b3t\xe6\x8c5\xb7b@\x9e5\x1c\xb6\
+\xa7V\xc2\xa2\xe0\xe5\xe4L\xe2\x0c\x1f@f\xb0#\xb8 R\x83\xc3\x86L\xf7\xcb\x84\
+(R+\x9cAR\x86\xaff\x14&\x16\xc3XL\x07\xc4f\xb5\xeb\xcd\xb7\xbek-^\x19I\xb9r\
+\xec\x17\xcf\x8f\x1f{\xe6\x94\x96\rTQ\xb3\x87\x81G\x8e\x803\xac[^\x9f\xca\
+\xac\xb1\x93\x83\xff\xb4\xb2L\xfc\xf36_\xec,FkX\xe4y\xf0\xc8\xc1Mh\x9a\'\xa1\
+y=\x8b\xb8\xaen\xf9\xc2\xc9\xa88=\x06Bb\x04\xca\xc1cn,\xe7\x08"<\xe2\x8c\x93\
+l\x9fr2M\x12;\xcc\xca\xa5\xd1\x13\xf6N\xc0\xf7\xba:L\xaa\xd7\xf4*\xfd\xb1\t\
+\x8c\xdb"\xf6~u\xbe\xc81~+bd$$\x02s\xd4\x07\xd4\xb2\x02v\xa5i\xd7\xc8\x92>\
+\xe5_j{\x04RKLlr\xa9_\x129\x85\x84\xb23\xffm6\\Y\xf6|\x1b\xdb\xa2>j3\xab\xab\
+:\x00\xa8\xe3R\x97\x12Q\xf5f~%!%\r+\x9c\xbeB\xdb\xad\xfd\xe1\xffY\xe4\x0f*\
+\xa9\xcc/\xb8o\xf5*\xa5\x0b\'n\xb8\xc4L\xcd\xf6[\xed\x96gZ\x00\xf4?:)_\xece[\
+u\xe4\x05G\xe2\x0c^\x9bBEo\x072\xd3\x93\xe7\x05U\x91l\x93\xd2\xaa7\xfc\xef\
+\xae\xc0\xc1A<\x9f\xb6\xac\xf5\xcd\\\xf7,\x11C7K\xdb\xdfP?Y(\x99\x0cv\x1c\
+\xf4\xf0\xf0]\xeb\x17\x0bK\xda`\x16*\xd4\x83\x8d\xf0\xb0\x16\xf0\xd3k\x17--m\
+\x92/S\x95\x16\xf3\xe6\x07\xc0;\xfc\x0e\x9b\xa3\x04\xd4=\x86\xe4\x19kp\xe4\
+\xe1\x1e\xb1\x96$\xd00P\x90H \xc72\xc7\xde|\xd4\x1e\xa0\x96\xb4\xb4\xb5\xa9m\
+#U\xd6\xc3\xf63\xc4=\x91\xb7C}\x9d\x92hNZ\xec\xb7\xd6\xb7\xb7U\xb6\xc7A\xf3B\
+1a\xe18\xe5\xf5K\xe3\xc8\xfe\x95\xcf\xd5\xaafE\x04}\x04\x16\x97F-\x13G\nrr\
+\x04\xc4\xc4\x8aJJ0\xe0?\x0f\xde\xba\xe9{\xb0\xf6|9\x0b\xf3\xf3\xedB\x1d\xf7\
+\xde\x7fWW3\xc7,\xbe\xff$4g\xcb\x00\xea\x93+\xcbf\x03eG\xd6F\x95\nvC\r\x9e\
+\xe9\xbbq\x91\xa5\x9c\x92\xd2\xf9\xc9I_6:\xb9\x91\xb72\x0e\xb0\xa7\x01\xde\
+\x07\x9a\x99CM\xf1&\xb2e\xe3L#\xbc\xfb\xbb\x9e\xdboLt\x8c\xfe\xd6\x97\xc8\
+\xd2B\xfd\xecj}\xef\xefn\x18\xee\xdc3\xb2\xd8\xe5]C\xf2\xa4\x18\xf2\xce\xae\
+\xc2u\xd7\xcf;\xc7){X\x15\x10%\x16\xce\xcdM\xa7n\xed@+\xd7\xda\xe1\x04\xb2\
+\x7f\x1a\xabuJ\xc1G\x8d\xef\xf6X\xb4\xe0\xaaj\xd0\xc1 @\xcf[\x1eV&\xb6\xd4\
+\x05\x84\xbb\xaf\xcf?\x963gJ\xe6\xdbm\x03\xe22\xb9t&\xfd\xcfR|\xf4N\x84c\x83\
+\xca2\x1e\x8d\xa8d\t\n\x88\xae<\xceT6\xaaJk\xbb\x1fsRT\x10.\xa1i\x19\x19R\
+\xfa\x84\x080\xcfK\xf9\x91\x16\xb1c\xf5J\x88\x92\x10\xb7\xa4tW&\xcf\xe0v\x9f\
+-\x8aL\xe3\x92(\xc4(\xb2h1\x18\xed\x10DN\xd4\xbdl\x17\x86\xb9\xdc\x18[\x00\
+\xe7\x87\x87\x87\x83\xfb($\xc9\xb6\x0cV{\xf4~\xaa\t ,\xf8I\xb7\x96\xbe2n\xf7\
+\xac\x92^6zF\t\x1b\xccN\xd1\x82\xcc\x98\xfcLu\x18\x03\xb5\xd9n\x91qE\xca\xff\
+\xf3\xdfs\x1d\x9e\xfa\x82\xb3\xdb\xbf\x01\xde\xc8\xb9\xc8`7\xd6"O{\x12\xde\
+\xd8\xe0\xcbA\xbd\xf4`dd\xac]\x12T\x11\x00\xc2R\x1d\xaaT\xb8Af@!\xdew\x8b>\
+\x16\x0b\xb4T\xc9\xb6\x01s33\x03\xb6\x95\xec&;]\x1bx1\x01\x8e\xcc\xfc\xfcn\
+\xc0\xd4\x92\xe7\x93\xab\xa7\xab\x17JU\xads\xea\xf9\x1d\xfdi\x80\x9cf}\x9e*~\
+O~9\x80\xae\xd3\xfd\x18xd\x97\xda\x08\xee\x0fC\x06\x1c\xda\xdc8^\xcc\xc0\xf4\
+\x9b\xb1\xd3D=\x8a"\x01\x11-3N>+\x1b[\xd2=\x96\xef\xed\xf8\xbf\xa7\xa28\x9eM\
+\xcd\x95\xac\x02\xa2\x84\xe1\x84_^\x1b_\xce\x13\x064\xa3\x13\x12\xc0\xefw3\
+\xc0\xa1\xab\x8d\xba\x14&\xafn<\xc3\xc3\xc3\x83\xfbL\x02\x02\x02\xb4\xb4\xd2\
+\xe7l:\xdf.;zn\xd3j~\xfc\xfc\xf9=\x90scui\xadd\xc9\x16H\xcbRRR\xa6\xa6\x94\
+\x8be\xab\xe6O\xf7\xf7:d\x9e\x10\xd3=\x9d3\xb4\x07\xf1\xb8}5\x8d?JKK\xcd\x07\
+\xc0\xbb+\xe4\x83\xdd\xa4p\xe26$c\xd3\xe4\x080\xfb\x07\x07\x84\xe6\x02\xa6a\
+\xb1\x01\x1c\xfc\xdf!,\x8dT\xe5\xe5\x05_\xb7\xe7\xb6\xb7\x8dr\xbda\xba\x10S\
+\x85Y~\xf4\x04\xb2%JXn:x\x00q\x01\xb0\x82\x9e\x19tT\xcc\xe9\xf7a\xce  :%\xe4\
+M\x03\xd9\x0b\xed\xfe)\xa5\x07\xee\xfc\xf1=K:\x90\xf2\xa0]\xb8\xf6q\x8f\xa29\
+\x82\xb9r\xf4G,\xa9\xd8|\xef\x02\x0b\xba\xb5r\xac\xd4\xa1Y>6ko\xbf>Xwt\xfeg\
+\xb8\x11X\x96\x19\xa7\x87\xa4\xad\xcd\xc9\x1bOo\\G\xee}\xa03\xa6\t\xc1\x83F>\
+a(\x82\xd3\xfdGu<\'\x9f\x90\xd0\xfa\xe2b\xa3\xf3\xc1\xf0|\xbd\x06 6\xe9\xca0\
+\x17\x9c\xc3nB\xa4Ud\xbe\xf3\x0c\xc13\xf4\x9fG\x91\x1e\xfdk?\xcd\xef\xd7`\
+\xe4\xdf\xd0+\x05\xba}\xdeO\xf6\xbd\x96\xaf\xb7Q\xd7\x90]4U\xf4\xbd\xef*\xde\
+\xda\xdaj=\xb8\xf1$0w\x93\x80\xf8`a\x00P\x9c\x81l\x84)\xba\xff\xddE\xb9\tSn]\
+\x1b\xda\x1b\xbe\x1d\xad\x83nA\xd9\xe8\xe3X\x1a\xda\xfbS\xd8Z\x82\x85\xcf\
+\xf6\xe6h\xc0\xb8<\x06\x02\x0c\x03N\xb4$\xfd\x0b\x11\x01\xbf&\x15!,\xae\x07\
+\x81\xb5\xc8\xe5\xc9\xc9\xde\x1dE\x9d\x1a\x16\xbc7)\x9ePu\xf6\xf8d\x14B\xed\
+\xf528|\xf8\xb5\xb2\x92\xa5)c\xfaMY\xd6\xce\xce\x96\xff\xeb6\x8c8\xc6\x9foM\
+\xebC\x80\t\xc7\xc7\xae\xe8\xf0\x94u\x00hJ)\x1e``\xc0\xa29n\xa1\xdao\x1b.\
+\x911_?\xcfm=\x9d{%$.&\xa6bt\xa9]c\x14\x06w\x06\xd0\x9bJ\xe9g.\x8b^\x02\xf5\
+\xcf>\x0cbbd\xb2\xf7\xf3n\x0e\x8e\xcd\xd4\x16%\xa5\xa5\xf4\x17\xf9\x8d@`\xb2\
+\xfd\xdcD\xee\xf7ljfF5\xa9\xd9I\x96\xe3a U)VS,S\x0bA\x92n\xd2A\xb5\xe2aD>-\
+\x19$CZ*\x0c\x94\x0f Z\xc8E\x14\xbb\xe8(hh\xfe\x17}5@\x14\xc3\xc5\xc1\x81\t\
+\xf9\xd4e\xa4\xda@\x80\\u\x0c\xe8vo\xaf\xc4^\xb6\xa4G\xcd\xdb\xed\xd1\x04**j\
+[[[\x89e\t\x10\x16\xd9\xbb\x9e5\xc2S\x9322\x90WL\xee\xe9\xab\xcc\xe5~\xd6\
+\x9a\xbd\x8c\xab\xce\xe4\x9bR~\x11\x11|\x0f\xf4\xf9\xdc?\x04\xb57\xb3\xb8\
+\xb8\x18\x15\x85\x982\xc6\xc3\xc5\xe5r\xb3?\xc4\xde\xfdl\x06l\xef\xeb\x02\
+\xba2u\xe1\x9f\xf5=\xc73\xbf\x86JC;4wJ@\xbe\xc1n\xc7\xff\x08\x042P\x95\x16r\
+\xb2\\6\xc5\x18\x94\xc5\x81\xea\x0f\xc5\xc2\x1a\x89\xd7\x00\xe5?j\xd4\xb7\
+\xc84\x14\x186\x9e\x9e\xad--+\xb7\xbd\xd0\xb1\x9c\x02\x99I\xbcDV[\xa6l\xeaB\
+\x84\xce\xc7\x16\x7f\x8dM\xde\xaf\x1e|\xceNO\x01:\rY\x7f^9\xb5\xff\xcf\xc1\
+\xc1\xa8\xcb\x9b\xb7R\xb8\xb6L1\xf9\x03h9\x0e\x83>\x19\xe5:BNN\xce\x084\xd2\
+\xe0Iy\x1fI\xa1O\x95E\xdd\x9f\xd2\x8f\xc0\xb7!\xe44\xf4v\xd5\x06m\x00f\xde\
+\x02\x0cP\xe0{+o\xadm\xcdA\xf0\xaf4\xfe\xbc<\xd8\xf5\x18\xb5\xbb1N\x13\x91\
+\x13\x11\xea5\xb8\x7f\xd5u&\xe4\xf3t\x1bE78\xfa\xb8\xa1\x07\x0b\x88\x89u{\
+\xddQ_S\n{\xddZ\x0c\x85#\ta\xc2\xc8\xedQ}a\xd8F\xcb\xbfps\x8b(\xadAwp\x1fX)\
+\x18Pt\x85\xa7\xda\xe8\xe5\xfeJ\xbf1\x9d/j\xc7\x95\xc5\x01\xcbb\xd8\xee\xf6\
+\xbe3\xe2\x1c\xda\xd7\xdb\xdb\xbb\xe5\xb1\x83*\xcfD\x80\xe2o=\x81wk\xa9\xf2\
+\xffY\xbb\x9b\xe0}\x1f q\xba\x14\xc4+d\x7f\x9f];t\x93\x88o\xc0PFTie{3p\x1d?\
+\xcb\x8eL\x90\xeb\xd5(/\xdd\xca\x8b\xa9}\x00\x1fL\xec}Q#\xe7Z\x0f9\x0b\xee\
+\xdb\x1d\x1c\x84\xa1[\x03\x18\xc6h}$\x1d\xf2\xbb\x18\xe1\x8b\xee\x9fk\xdaS\
+\xa9[o\x19B\'\xb1\x9f\x94\x93\xb0\xba\xba\xba<\x9cI\xa4\x98F\xe8 DA\xea\xe2d\
+\x80\xf23\x11F\x83\x12|\x9fm\xae~\x8e\x0e\x05\xcb1\xad\xeb\xcd\xebWt\xcd9o\
+\xea?T\xd4\xcc3\xb9\x08s&<\xf7\x00^\xaa\xb3\xa3O&p:\x02\xcc\xc4\xe9X\xfd\xd2\
+\x1aV\x0f\xc3\x07P"\x02\xe5D\xc5\x82\x00\xb3\xb9\x1c)\xf8\xb6\xed\xa9-\xd2\
+\xe7J\x98nJf\x9b\x10ugrm\xfb\x1do]^:T,\xe9i\x19,{}\x18L\x15eOd\xb0\xd3\xd3\
+\xd2\x8a>>\x9b\x87\x85\x85\x01\xd2\xfb1\x9d\xce\n\xc8\xe2\xd2\xd2\xd2J\xb5!3\
++\xab\xb2\xb2r\x95\xff\xc3\x97\x9a\x11n.\xae\xe0\x14wBs\xa0e\xb6\x17\x17\xdd\
+\x8eN3\x10\xb8H\x89\x88N\xaf\xae"\\\xe7fGg\xd3\x98\xb55$\t\x83F\x9b\xe04D\
+\x9f\t\x8b\x8a\x99\xd3k*\x855\xf8\x81o\x11\x98\xba\x94\xaa\xa2\x95`Q]\xe1\
+\xeb\xe1\xee\t\xf7\x12\xb8>\xb5\xd7\x18u\xbd>\xea;\x12s\xa1\xc6r\xc6\xc9\x98\
+se\xb1\x19wW\xce\xd9T\x1bv\xb8_\xac\xf3\xd2\xf0**(\xb4\xbb\x9d`u\xe6\xec\x8e\
+\x01\x98y\xaa\xf3y\xe1\xdf\xcc Z\x02\xc0\x02\xa4\xab\\F\x1b\xf3\xb0\x10y\\\
+\x85\x88\xd4T\x9c\x84\x91;@\xd0\x9d2(\xe8\xcd\xfe\xdd9\x07\xa2\x9a\tSbtm\xc1\
+\xe2\xa2\xa6\'Lm\xe2\xe7k S\x02\x9d\xf6\x0b\x01\xbe\xd0{\x97\x0b\x87\x9c\\\
+\x95+@U\x15]\x04\x1fc\xc1\xf9f_Z7\x1d`B\xe0\xb8\x8fC\xf8\xc6\x06\xedn\xff\
+\xd9\xdb\x03\xe4C\x05\xd0\x0e\x17l\xde\xaed\x84\x00\x97\n\xdc\xa7\x8eV-U\xec\
+\xd6\x84\xa7`c\xe8a\xdc\x83\xefp\xff\x03\xd3ox\xc8a\x04\x1a\x93\xc18H\xa2tU\
+\x90\x16\xfe_\x7f-\x9f\xddX\xe4\xd4cfx\t\xc3\xfe{\x8f\x1f\xf8,\x00\xbc\x90\
+\xfd\x9d7\xa5G$\x95\xc1MI4A\xcbz\xe2\xdf\x8al\x80\xfc\xaeq=!\nB\xb5\xf8"\x7f\
+>\xd3\x00-\x0e\x14\t\xabY\xe3\xc7\x9b\xef\xad#q\x80\xfe\x8b\xe6\xd1\x00\xae\
+\xd6\xbfG\xa5\xee\xbcE\x80Y\x18\xf8>H\xa0\xa8\xaa\n\x9fP\x050wNN\xcc\x9c\xfb\
+\xeb\xfdIt4\x92\x12\xad\x89I\xc2\xc8\xc2\xce\x0e\xfa\xef\x7f\xef\xa0\xe0\xe0\
+HLK\xfbb`\x10\xfc\xd0S\xd9jO\x15\xce\xbbq\xa1F.Y"{6\xe6\xc4\xe0\xe6F\x15\xfe\
+_S\xcc\xd8\x0b\xb9\x8a\x0f\x0b\xcf\xba\xdcR\x84z\xd8/9\xea@\xd7O\x96\xbaddd\
+\xcb6<jB\x80ugO\xfdV\xcc`\xcb\x9a\xb2\x8aN\xb1\xb3\xb5\x95D\x82\xb86508\x9f\
+\xa7U\xc4\xec\xe4\xe1\xe4\x84<\xee|}}\x05\n\xe6\xf8\xf7\x91\xa41lV\xba\xf3d\
+\xe0\xd7\x7f\xab.\x04N"\xc3\xe2\x05\x07V \xc9\xfb\xb3\xe5\xf2\x87p\x14"\xa7\
+\xb454\xe6\x01\x84)\x82\x1a\x1c\x04\xd5\x8b"\xd7\xd9\xc8\xff\x07@D\xec\x8b\
+\x18\xf7\xd8;\x82\x8ed\x1e\x07g\xb6\x12\xdd \x97\xd4\xd5sZ\x8d/,\xaai@\xdf\
+\xc4\x0b\x0b\x8e]\xa4\xf0a\xce\x8f\x85\x13\xa7\x0f*R\x1ay\x07\x91\xe4\x1f\
+\x115\xf85\x90\xb0\x9e\x8elbLI\xbf\xd1n\x05\x06[\xc2\xd91@\x88J\xa6\xad2\xe1\
+\xbc\xefn\x15\xb4\xc1^?\xc0\x0bg\x0fS\xee\xc2h\xa7Yl\xb9_\xab\xfaLf\xfd\xfc\
+\xa6\r\xdc\xfd\x1cX\x86\xff\x83Q\x87\xd3\xf5p\x07;yxy\tjx\x90\x95W\x10\x93\
+\x92>x\x8a\xfc\xe0\xe5\xb1 \xc0\xc2\xc6\x06(\xf1$\x12\xd3\xbc9\xa9\xd2\xd8b\
+\xaf8iKm\'1=]KO\xeb\xf5\xdf\xc3\x02qhH\x03v\x10\xcd\x96\xf3"@\x9eb\x80\x14;8\
+\x94jR\xedp\xf3\xebWu\xef\xea^H4\xa5\x10\xc5F\xd2\xaf\xd2\xe2\x087\xaaA\x87\
+\x0b\xf1\xad\xe6\x99W\xf8}x\x98H\x89\xb4,\x8b\xe4D\x81\nx~\xc9J\x06\x8d\xe8C\
+\xb3z\x9aN\x1a\x15\xbb\xe7[\x05\xe7f\x90\xa4\x08\x0e\xa3\x9f\\\\i\xed\x05\
+\xa6\xe7\x99P\xb5\xd7E\xa1$\xb1\x02\xe8\x1746\xceo\t(\xef\xfc\x15:&(\xf8\xc5\
+\x0f\x041\xb6&\x1e\xcdN\x9c\x83\xde\'\xac\xb6,^>\xbe\xcb\x00S\xf0\xbf\'\xd6\
+\xe3\xe2\xfe-\xde\xab^\x81Y\x88\xcc\xa39X\x9d2\'\xab\x02\xf7\xed\xc0\x03\xc1\
+\x8b\xac\xd6\xf7\xeb\xad\x99\xdc\xa7\xf2x\xb0\xa8\xcfc\xe5\xffV\x90\xe0\x98\
+\xc8v\xdf\x1cj(\xc8\xb0@\x9c\xc9\x98\x9a\x9a\x0262\x828R$\x15\xb1.\xfe\x1fX\
+\xb5\x02\xbcp4\x91!\xfev\xde`\xae\xac\x0c\x16\xf7\xb8"\xdb\\\xf6:B$\x8b\xa4\
+\xb1\xd9GM\xc6\xf8\xd4I\x93\x98\x8c\xa0\xfeC9k_\x8a\xcer\xa8\xd1\xe2\xf3\x89\
+\x9c\x8b\x19\xed\xb4\x92\xc7\xc8\xc9\x8f\xad/\x17\x97\xe5\x17U\xebkk\xa7\'\
+\xe5U\xe5\x97\'Y4\xbc\x86\x1b\x9fu\x99\xed\x94\xe9\x9dUq\xe4\xbf2:D\xd5\xe7$\
+[\x9e\xc2Fq\x15$3\x84@\x18S \x06\xc2  B\xdc\xf0 \xcam\x8a\xfb\xb7\x95\x8a\
+\x057\xa6\xa8\xd0<]\xfa\x1e\xb9|\xda\xed\xc2\x7f\xf2\x7f\x12>\x16N\xd8y\xc9\
+\xb3\xa1\xa9/R\xb3j\xd2\xcb\xc9\xce\x16q@O\x0e\x16\x15\x15\xe5\xcaB\xb9\x90\
+\xa9\xa3\x1c\xe8\xba\x12Z\xb1\xe4  A\x83\x17\x91y\x8en]\xea\xf5\x85H\xeb\x94\
+\xe87\xeaq\x17\xf5\x157h)\x8e/\x866@\xa5\xcb\x86\xc8\x8d\x1d\xc4\x1b\x1c\xc4\
+\xb5\xff\xd6\xf0\x15\xb1\x81\x1c\x12\xea<]\xa2\x8d\xfak\x94_Zd\xfd\xda\xf9\
+\xfd}\xa3BI\xbf\x16JJhd\xefu\x08\xf2\xab\xdf\xc7\xcd\x8d\xb3\xda\xab\rO\xf6\
+\xf2V\x95Q\xd1\x08c\x04\x8d\xaf\x1897\xa9\xa9\xc2\xde\x97\xa2R\x93\x00cr\x81\
+\x8cUb\xfc\x10\xa3Z\x87\xc1\x95\x91?&5+\xc8\xcdTI\' \x14\xecg?\xffG\n3\xac\
+\x0e\xb8\x8f\xf1\x17_\xf7\x0fg\x0e\xc4\xdf\x7f\xd7)\xa7)7\xe1\xdb\x0c\xc8\
+\x90\xc2\xd4\xf8\xb3\xb4\x13\x944\xe8]\xfca\t\xca\xae\x8f$(49\xa8\x92\x94\
+\x02z\x9b)#\x98p\x91\xc2\x96l\xab~UC\x9dHI\xda\xfa\xc6\n\xf5\xb7\x93~\x83\
+\xf8\x9c\xb2\xf8\xf5\xe6\xeeh\x9f\x9f\x18L\x9e\x0c\xbe/-\x07`\xfd]\x01\x1f\
+\x82o~}\xbf`?y??\x9fluc\x9b\x91\xfdw\xbcb\xab:zJ\xe2\xb8\xf9\x83w\x97\xcf"*\
+\x16\xb3\xc5\xf9t\xcf\x0e\xaf\x08\xcf\xa6WaJ\xe4\xf8\xf88UR\xe4];\xd0\x15\
+\xb6Mz\x9a\x0f8\x198\xd0ZjFZh5i\x17\xed\x8a\xe4F\xaf\x87\xdb\xf4H%f;\xdd~_/.\
+\x84\xf2\xd2\x0f"#7\x8c;\x9d\xea**\x98I\xd0\xac\xb9\x08\tJ\xe2:\x88n\x10\xac\
+R`UA\xc9\x90\x885\xf9?\x08>\x1e\xbf6M\x13\xab\x84\xe2\xae}\xc1\xa4\x0ec\xf1\
+\xa7\x81\x80|\xcen\x95\xef\x99a\xcf\x98Hj\xff\\\xb14\xfa\xf8\xf4\xf00fQ?l\
+\x18\x870\xe1\x9c\xf9u"\x9d\x95)\xcd\xd6\xccL\xb2x\xae\x97(\x82\xc0)s\xca\
+\x82\x8b>E~\x1b\xc2\x8b\xec^\x83U\x8d\x07+Hh\x17\xff\x90\xec\xdb\x9b\xdfG\
+\xd3\xce\x06\xad\x11\x85\xaf\x8e\x8e\x0e\x04\xbb\x04\x19>D\xf8\xaa\x17\xe9Nd\
+\xf0\x94\xc5\x08\xc9\x85b\x89\x06\x8a\xedn\xc1\x82b\x08m\x8a\xb8\x94:Q\xdc\
+\xf0\xd1\x91e\xce\xd4\xb0\xb3\x82/E\xd4\'\x1d\x1c\xff\x14M\xc3\xe9\x988ne\
+\xdf\x08\xdfv\x9d\xbe\xb0\xf4\x0b\xdb(h\xa2\xdd`v1\xd8kv:\xb0\xdd\x01\t3\x17\
+S\xfa\xc4W\xbe\x8d\x9a\xd4\x00\xbd\x1a\xde\xaf&b\xb5\x04\xfa\x83?qb\x861\x12\
+\x8fev\x05\xe0\xd6\xf1\xd1\x1a\x96l\xa5\x05\x94kVjFm\xac\xacd\x9a?-//\xe3\
+\xc5\xc9D!\xd4\x18\x1b\xb1\x00\x8d}\xf5w\xbf\xcb\x86%\x9at\xde\x82K|\xe5\xd6\
+`+^\xe8p/p\xfe\xbf\xcd\xa5\xe7\xbc+\xff\x96\xb6\x92\x97\xc3\xa8\x94\x0c\x1f\
+\xef\xf1\x89\xf16\x12\x84$\xb2<\x95\xb7\xb7\x9d\xd7\xf4\x01u \xd8211\x11y\
+\xf0\xba\x983>\xad\xfe)Ago\xbaZK\xd1\x1e\x8e\xc8\x14\xc7\x0cZ\x82W\x97\xc2\
+\xfb\x8f W\r\x15\x14j\x83-\x99C\xa3\x86\x9e\xdc(Q\x9c\x14\xa9P2n\xc1%S\\\xd7\
+\xdeN\xc4\x89\\{\xf4\t7\xf88\'TN\x9f.\x85\xf2\xbb\xeb\xf14\xe9\xcb+&\xc9\xc0\
+\x1c\x97\xd1\xfe>z\x92\xc5\x1f*\xea^>\xee\xd2\xfd\xd3\x82j\xfc\xbc\xaf(\xe92\
+\xc9j\xfa\xa3{\x94N\x18(p\x82p}\xa9\x9f\x82$\x02{\xfax\xe5]\xb6\xe45\xbe<C\
+\xb8Pj\xd1\xae\x12\xc0\xc1\xc3\xf5\xf5s\x08\n\xb6uv\xa2\xd8I\xd6\xac\x84L\
+\xc1\n\x8bG\xcac\xb4\xe26\x91a\xc3G\xf2\x90\xd1\xe8\xfe\x1e}OJ\x95\x16\xf2x$\
+\xd1P4{\x0e\xfc\xcc\xad\xb43\x8d`\xf6\xb4Zv\x17\x8e-Gs\x8cZZ\xad9\xa2;L_\x8a\
+\xff\x01{H\x9e\xe06\xf02A\x7fx\xc5k\xab\x0c\x8c\x0cHL\x8c\xfe\x1c\x92\xda\
+\xeb"\xb6r\x94!KIEEE\xeb\x8b\xf6E\xe2-Bm\x13V?F\xd0\x1a\xc2^o\xac\xb8\xf3~\
+\xa8V\xc5V\xbd%rD\xe1\xaf\x8a\nz:\xbaI\xab\xbb\xe9<\xe1\x8e\xf6v\x8drM\x1a,H\
+\xd3\x8e\x80\xed\x80\xa3[K\xa0\x89\xd0">q\x86\xc2\x9a\xd6k~O\xe4K\x923\xe8t\
+\xc2\x14-\x15\x14\xb3\xe7\xca2d\xd3>\xa8\x96I\x96\xfb\xe9 \x90\xe7\xdd%\x86\
+\x83\x14\x14\x18\x1a\xfa\x9d\x87/\xd3\xb9E\xc7\x96$\x98\xea{\x87\xc7\xa5K6*s\
+\x94\xf6/\xa3\xc2\xa9=\x1cC\x16"}]\xdd\xbee\x05\xd0\x89\xdb\xab~MO\xfcV&v\
+\xf4~#\x0b\x0b\x0bF\x92\x12\x9d\x94\xf2\x8f\x9dcYJR\x0b#7\x1b\xc1\xd6\x8b\
+\x9c<K,4\xb4\x84\x1bSo\xca\xbb\x84\xa0\x98A\xad\x85\x87\xa4\x1f\x16\xdfJ\x84\
+\xf2T\x88\xa3@\xb12\xd4(Vm\x06\xd3^\x9f2\x99\xecO]\x0b\x93~\x90\x90!>[\xea@\
+\n\x100B\xf8\xa4\x19\xd2\xa5D\xf1\x98z\\m\x0e\x197\xac\xb1\x942\x81\xf6J\x1f\
+\xb2\xa1&\x11\xb7\x06\xebvP\xd0P\xc4\x16fk\xfd\xf4\xab\x14\xee\x14\xc5\xc3\
+\x98g\x05\xbd\xa9~\xa2\xac\xf6G\xa4D\xda0k\xf6\xc80)\xbd\x17\x80>\xde\xe0\
+\xc4\xad\x9a\xe0e9\xaf\xfa\xde\xef>\x0e\xc4\x85\xd92&\xc4\x9d\xb7\xde\x06\
+\xbf9n\xb9\xedZ\xbfH\x125\xc9h\xffR\xa4K\xc1\xf0\xa7\x99\xd7\xb9\xfan\x1a\
+\xae\xbd\xefo*\x1c\xb7\x12}\xd7\xde\xd0\xd9\xe9\x0bV|\xfb+&\x8e\x87\xcau\x08\
+\xfa\xa1\xc942<\x1c\x1e\x11\xfe\x17\xb2G\xb2H\x00\xec\xbf299\xd9\xf3\xba\x02\
+\xd6+]\x18?r\xf9\x91T8\xb1\xdblj-A\x08\xde\x12\xf6\xa81\xee\x98V\x8f\xfau\
+\xca\x94\xb2H\xd5/\xcaG\x143l\xb4\xbd"\xc8-\xfc\xb5a\xcd\x84\x91c\x00\x85\
+\x1d\x13\xcb\x1e2\xb9\xcc>q\x83\xdf\x9e\'\x13\xc6\x9d\x9a\x93\x9a\x82\xcd@\t\
+\xcaDE.\xa4d\xe1D\x82\x02\xa2Yr\x94\x06\n\xdb\x1b\xf1#T\xa9\xb4\xe2\xe6\xee\
+\xff\xd6\x02l\x03\xe9\xd7\xda\x9a\x1e\x04\x1c4\x98(\x129T\xda\xab\xdb\xff\
+\xe2\xb5\xfa\'\xdd`\xd7\r\xc5_?\xbf\xeb\xde!\x90h\x0fKG\xef;s\xf6\xbe/z\xef^\
+\xbf\x13\x85\xfc\x90\xd3\xa4\xb1&3\xc2JL\x86%v\xe1\xc7\x89w\x19\xca\x87a\x9a\
+\xc2R{GZ\x00\x91\x0c\xaa\x08\xd8\x82\x8b\x10-\x02\x15.\x84 \x10\xa2\x07\xfa\
+\xd82\xeaO\xf8\x02\xe2\x0f\x8eQsgF\xb4\x83\x91\xefu\x12\x14\xb5\x8d\x8d?\x98\
+\x97(\xa9z\xd3\x0b\xf5\xaa>)\xa6\xf5\xf7C%b\x1e\x12\xbe[\xa5\x0c\x995\xf4\
+\x82W\x10\xbc\xf7\xa2\x84`\x8d\xcb\xde\x85\x1d\x05\xc0\x07\xe0\x17\xf2\x9e\
+\x8f8G\x1d&\xd6\x13\xd5\xcf\xfb|h\x1e\x12\xc5\xcbe<\xbf2\x9e\xbe\xfd\x14W\
+\xce\x13qv1\x04\xc1\xa4\x8e\xb6\xc3A)Yr\xde\xcaj\xa8\x115\x1dy\x12\xd2\x80V\
+\x80\xb1M\xc2\x88\x1f2\xb3j\x10\xc4\x8a\xda\xec\xf6\x13N\x92\x83 F\x7f\xb6\
+\x15 i\xd6aaJS\xa8X\x82\x0b\xe9\x03Q\xa9\xab\xa9\x05\xc2|\xc4\x93~\x13\xca\
+\xd3\xaaY1\xe7\x1f>\xb8G\xf5\x7f\xff{\xe5\xd7\xd3YI\xe2\xb3\x0b(\xb6\x07x\
+\x17\xfd\xcc}\x11\xf67t\x17\xbfO\x92\xe0\xf1O\x89\xc8\xd5\xa0(\x12b\xe4U\xff\
+\xa1PlG\n\x14[\xc9\x9fq\x91\x99:\xf1\xc5p\xa0\xc1L(\x10\xea^6\x16\xa6V\xe7\
+\xc4\xd1\xbc\r\x0fQ\\\xf8\x06\x95\xa9\xf8q&\xac\x0c\x03\x0e\x12\\\x08\x05\
+\xd4p\x1e\x04\xd1u\xdf\xdb\xd5\x01\xe8\xdcj\xb5\xde\x96\x84w\xf7]f\x11\xfbU\
+\xd2\xe2\xa1\xbf\xa6v\x8c4e4i\xcd\x89bLw7\x94\xb0\x806\xd8iU\xc9\xa4a\xe7\
+\xe0\xb1\x97\xba\xd7R~\x1d\\\xb7\x10\x1d\xbb[iy\xbdp\xa9\xce\xbf+3\x1b\xc5\
+\x97\x83\x9a\x0e[\x0b\x8dp\xd3{2P\xed\xb0j\xa3\xa6x\x1f}^{\xbe\xaa\xeeq\xd3?\
+\xb4W\xb4\'G\x13\xect\xb0b\xe4\x97\xc6\xea\x9b\x19\xd4\xd4\xd4\xa4F>\'\x07#>\
+\x85\'f\xef\x7f9:\xf8\xfe\x9d\n\xbe\xaf\xa612 \xe7&l\xbc\xa7Z\xf3\xe9\xe3\
+\xed\x8a\x18%\x1c\xb0;\xd9\x007\x1c\xdb\xe4,\r\x01\xb2\xdf\x05O\x8e;Z\x1d\
+\x8d\xef\xe5>\x8b]\xe9\x89\xf8\x1a\xf7\xba\xa0\xae\xd2\x99\xdcm5\x06\xf3\xbd\
+\xe3\xcc6\xb9\r9\xc9\x1ezO\x9b:\x1b\x94=6*&F\xc6 O\x88H\xef\xb7\xc7\x8b\xd3\
+\x7f\x9b-P\x16\xb3\xb3\x89c\x16\xd7\xaa\xc9\xbdP4\x17-\x95\xd3PwA-\x01\xf7\
+\x8f>\xe0\xe7\x04\x80\x93}\xf2w\xee\\\xac\xe9\x8d\x8eo\nHe9Qz-tdF\xdf\xa9\
+\xb5fX{#m\x1c\xd8 \x08\xc3a1\xa3@\x99Y\xb2\xac\xce\x11\xf44X\xa6Xe,k\x8dA\
+\xa4\xa1\x05V\xc2TYJ\xbf\x96NON\xfe\x8b\x93\xb9k\xd26V\x96\x9b\x14\x14\xc8<"\
+W\xf9D\x97\xe2UT\x1c\x82\xf9y\xd4\xb8?\xecFA\xa4\x93\xac\x05^f*\xaa\x00L2+A\
+\xa0;\x15\xc7\xea\xa4\n\x82\x86)\xf7\x89G\xe8}\x0cWs\xbe\xcf\x87\x91\xea\xb5\
+\xe0zzzH\x1a\x14\x0b\xfcL\xa0\x15\xea\x16h\xc0&\xdb\xc7\xde\xf1j\x005H\x94\
+\xf2c\x15f\x9a\x8a1u\x14Cj\x15\x01\x85\xd0" \xe8\x1b\xea\xbch\x98\xa45d\xbe\
+\xbb\x00]\xab\t\x07\x81\x85\x0e\x0c\xd4\xe4\xee\'\xa1\x8f\x86\x03\xba\x86(\
+\x0f\xe42\x91\x9c)\xb8\xd2\x01\xdb\xa6hR\xc2\xe9\\\xb1\xae"\xb5a2f\x03\x1a\
+\xb9q\xf3R\x94w\xc9;p\xba\xc2\x04\xb1c\'\xa7\xa0\xe0I\xc1\x13<\x14dc\x13\x96\
+p\x85STL\xc9|\xbd\x83\xa3\xfd\xab\xc1xhw_B\x9f\xe3\xc8H\xa0\x0f5\x06\xc2\xfb\
+MN@\xac\x02\xc1\xb49\xf6\xdc\xe8(\x82B`\x94\xcd\xd9r\x15\x83\x1a,F\xe0\x8fh\
+\x8fE\x9c\xa4T#2BB\xd3q\t\x14\x9e\x81}\x14\x0e(\x9f\x19>\xb1\x18\xe4uZ4q\xc5\
+\x12X\xc1\xed\xa6\xa3\x1d\xa3\xa2-^\xf2Y\x9f\x06~\x124h\xb3\xc4\'z*\xa1\x87\
+\xcb\xb1\xe6Gw\xcetJ\xab\xfe;\xb8\x06\x94HZ\x1e\x85\x92\xe4\x18\xfd \x9bZ\
+\xe4\xa9\xe6L*\xf5N\x8av-\x97%T>\x9d\xea\xd3O\xfa\xa6\x97~\xd3K\xec\xbe\xe8\
+\xef3\x9d\xe8vg\x87\xcaX_\xe0\xe4\t}:\x91\xf5\x0c\xdb\x13\xac\xf7B\x1cw\xba\
+\xbf\xf2\xe5\xbc(R\xb5\xef\xb9\x05\x9f@\xccD\xea\x9a\xc9\r\xb5\xd7\x06\x8b\
+\x10@\x91\x8f]\xc2\x15K\xdez\xbfE\xfeH~\xa6\xc0"\xb9\xad\x18\xa9\xfan\xc8\
+\x8a\x88\xbb\xdfJ\x84\x87\xbe9\xd3D\x1aJ\x89\xe6\xea\x1a\xc4]\xaa\xda\xe3}8j\
+\x1e\x04\xed;w#\xde\xfa\x87/\xa7J\x87\r>\x1c\x85\xb8\x9b\x00\xd94\xc6f\x8b\
+\x0f\xf1\xb2n\xce\x80\xaf\xc5\xc1f\xf7OB\xbc\x99\xfe\x80\x16\xba\x98\xb1\xda\
+\x0e\x90M\x86\x86\xa4\xe3d\xa0\xa3/\x93\x92\x92,\xb8\xca\x17N\xa6=\xf2F\xf2Z\
+\r\xaa\x9b\x9b\x9b_K\xcf\xa2\x10\x86X\xeblb1\xcb#i\x00\x0e\x08-.<\x81\x7f}\
+\xdbx:os\x7f\xf85s\xfc\x96\x07m\xac\x9b47\x84\x8c\xcf\xca7\x01\x94\x9e*\r\
+\x16\xf8\x01>\xa0aJ\x9dZ\x12\xf7.W\xc8\x1d\x0c\x01\xb9K\xddG\x9c7\xf1\xbb\
+\xfb\xf1\xb4\xc2\xeb\xb7\xa8J\x14\xfd\xc1\xc8\xb6\xbf\xcf\xe4\x01\xe4\x1ag\
+\x04\xa2tC\x01\xa5\x8d\x93\xef\xf5\x8cd9*\xa6\xa4\xf1J\x8d\xa1*]\xca\x85\xcf\
+#\r\r\x8ax%\x16\x95$\x0eR\xab|7\x05\x14\x03\xcd \xbe\xe91:\x1aJ\xb8d\x91\xb6\
+\xb1`\xbf\xb72\x8a\xd15\xdd0\x83\xd2\xe6\xf1\x83\xdd\x8a!\xdb\xca\xe0\xe0\
+\xe0K\xf5\x1d\x80\xf6\xfe\xcf\xd7{e\x13a\xbeH\x9b<\xabh\xb5\xdb\xa6me0f\xec\
+\x02\xc8,\xef\xd4\xd4\xd4\x80\xc9\x98\xd5\xa1\xa0\xa3\xb3\x0f\xe3\xa5\x8c\
+\xd1\xf8"\xd9Ox\x15\xa9\xf9\x97\x85\xaa\xf1\xef\xa5eJ\xdf\xe0\t\xfc\'[1\x07\
+\x8a\xdd0\x87\xafz\xb2b\x07+(\x99e\x0c\xeeVrk\xbf\xed\x12{\x06\xd86\xc1A\xa8\
+\xc9\x94\xf7>\x0c\xd8\x19\xf2\xf7\xc7e\xf6\x03\xad\xe0k\x98>\xbec\xe2;w[\xa3\
+n\'\xe6\xbc\x15\xd2\xe5\xd1}\xe6\xeb\xa5+H@\x8d\xad\x11E\xcc\x7f\x870\to\xc2\
+\xdb\'b%\r\xc1\xef\x7fq\xfe|\xfcW\xfc}\x0f\xdd\xe3r\x13\xd1_ln\'\xe4\xb3\xb6\
+\xa1!\xea=\x03&m\xca\x18\x90\xcewM\xf5=Z\xd0\xd0Q\x8d\xbb\\\xbe\x94\xae\xbc\
+\xf8v\x97\x97\x97\x03x\xc3\xaa\xdf\xbc\xcb\xd1f\x10/\xc9\x833\x89=wy\xecn\
+\xdc\xe3N\xaa\xdbXRR\x02$\xf9/K_j\x070\x87\x8d\xf5\xf4\x80TA\x8cdy\xb6\x9f\
+\x1aU\xe6xm~\x8cz,+\x9a\xc1\x873\x8e\x01oV\\\xedx}P\xecH\x9aW\x90\x03^\xaf\
+\xa8I\xfe\xc1\xb8i^\xecI\xf5\x88\xe5\xc1{\xa5\xa7\xa7\xb7\x1f\x0c\x9b\x1c<6\
+\xe98E+\x15\xf4\x02a\x1e\xd4\xa9q\xc0=\x89\xc2\x954\x19!\x0f2hA\x7ft\x90ca\
+\x8b\x14N\x90\xcf\x05\xb3\xf8\xd0\xa5\xb4\xb5\xb4\xf0\xe7\xa98\xba.\x9a\xf0\
+\x1e\x8f\xe1"\x06*\xa6K=\x95\xf9\xf8\xfanZ5\x04a\xd757\xa7O`$\x89\xaa+\xe6\
+\xbe\xac\x9a\x0f\x95\x91\x85\xf6\xb4\xd5\xc1\xa2Kk\xec_\x0f\xf9\xb1w\xcf\xce\
+\xa9\xb3d@\xb7\x0f\xc0\xdf]\xb94\'\xd7I}\xef\xf8\x04\xcaU>\x84\xc7\xe1\xc4y6\
+B\xa9\x0f\xbc\x8fR\x051\x80\xd8\x7f\x18\xb6eC\x87,\xc0_\xd6\xa9c\xc8\xe7\x03\
+\xae\xc4\xd9\xfc\xac$\x05\xdd\xcf\x03h\xa9\x9b\x95\xd5\xcf\x12K?o\xe6\x9f)\
+\x912Tm\xf6\x97\xd8+]\x9d(\xeb\x8e\x1c\xf9\x91\xefo\xc7\x7fw\xc0}O\x9aDK\xed\
+LL\x7f\xff;}m:\xe3\x8d\'\x1a\x8cp+\x11Jv\xe3n\x16`\x19\x01b\x06\x19\x02L\xa2\
+o\xbf\x15Z\xb1D\x83\x90\xed(dr\x0c>\xdb\xe5V\xc7\xd3\xd1\xb4\xca\xact\xa2\
+\x04\x02\xf3k\xe8,20\xb4\xd8\xd8\xd8\x7f\xff\xfe\xc5\x8b\x91f\xcb(\x10\xf6`\
+\xcbS\x90-\x9e3`\xfb\x87\xfb\xcb\xcb2\xa0Y5\x92\xeb\xcf\x0c8\x0c\x8c\x90-\
+\x01\x1c\x040yF\xc0\x8cCA"F\xc97;\xc8\x92"p\xf4\xd1\x07q\xa0Ca\x07\xbd\xf4\n\
+\x07\x80\xd1\xb8R\xff\xd9\x05\x86\t\x9b\x90\xd7\xe9`U\x82\xa3\xa95\x1999{\
+\xfaD\x9b6\xbf&\x99Y\xe85\xc4\rs\xbb\x06\xa9&\r;W\xfc\xfbYI\xf5*\x80>V:\xac<\
+b\x07Y\x90\x9ct\xf2\'X\x04\x08\xabAA\xa4\x87U\xf9\x03.r\xb6N\x9d\x14Ir\xa3G\
+\xb7\xc0\xd4\xef\x1be\xc8\xd1\x0c\xdaP\xa9\x0c\xf2\x03f\x1a\x11\x11>22\xf2I\
+\xe8\xa7\x1a\x03\xe0\xb3\x00\x00>?{~\xfa\x04\xf9\x8a\xb9\xd5\xe1\xe1hbB\xe1+\
+~\x9e\x93w\xa4\x85P9k:6\x80\xd6\x9f\xe7\xd4\x8a\xf3\x84\xb2\'\x0b\xfa\\\x19\
+\xbe/@\x05Ot\xa7Eg\x12o\xf0\xae\xcf\xc0C\xb4\x0b\x05\xaf\xf5\x95\x04;ljTX\
+\x9cm\x08\x92\xae\x9b\xbfiQ62R@tqn\x0eroDw\xef\xcd\xf4\xd0L\\\xf6\x17\xafm\
+\xdc\x90U\xdd\x9a=y\'\xf8c\xad\xc1:\x80\xd6\xe8\xf2n\x04;\t\xec\xc9\xf5\xe1\
+\x08n\t\xa8X\xb2]\x81\xbd\x83\xb2\x87\xce\x847\x08\x0c\x05UML$E*Ya\x97\xb9H\
+\xdf\x93\xf1\x17$\xd0\x1f\x94ewn.4\x10\xe8w:\xedA\xe9\x1d\xf5q\x9a\x9b\x90\
+\xa8]v\x12\xff)\x91\x04dHWM\xcdi\xb7\x17R\xce\x050!\xff\xab;\xf7\x8e-\xab\
+\x86\xb8\x84\x04\xe3n_A\x12\xb4\x8c\x8c4U%%\xfb\xadv^\xac(\x1a,\xc4\xc4C\x1c\
+\\\\S\x1fH\xbf&\x99\xe2O7$\xbf\xe0\x8a\x93\x10H\xb0\x1biD\xbc\xf6\x0f\x07\
+\x07A<X7\xad\xa2111Ir\x83\xb6M\xdf\xe7\xa1\xff#\x03w\x82\xe9\xc5\xff\xdeH\
+\x04\x04\x18\x1b\x17L\x1c\x01!\x91)\xedt\x89Z6\xfa\xe86)\tS\xb3\xe7L\xe1[\
+\xa7\x83\t\x02\x04\x1a\x08D\xd4D\xe7+\xee{;8\xd6\x13p\x9c\x97\x96\x86\xdbH\
+\xb6\x1fL\x826w\'\x03\xe3\xe2VH\x9cHl}\xc8\x88(L|\x15\xa7\x86A\x02\x1d#\xef{\
+\xfa\xbe\xac\xa4Q\xca\x9d\xfc(\x95<\x9fh\xc6\x95\\\'\x8f\xc0\xcc\xc6\xc2\x02\
+\xa4\x97TJeUU\xea\x99\xf9\xd9Y5uuN\x11\x11\x03\r\r,\x04\x18\x03\xb6\x15\xc0\
+\xd5UJ\xf5\r\x0c\xceON\xb2\nr\x9e<E\x06\x06\x06\x98\xd2\xc6m\x9b\xa8\xda\xd1\
+\x9e\x97]Yg \xe5!-\x83$\xcdyp\xa0\x852\xcd\x1f\x94\x84\x06c \x111\xeb\x98\
+\x93t\xaee\x83\xef$5\x90\xe9\xaeR\xf1\t\xb0a\x1ctw\xa5\x89\x83P\xe13\xe5lv\
+\xc2\xd3\xa2\xba\xa2\xab\x88\xfd\x1b@\x87\x05OoV\xd6\xc6o\xaf\xfc\x01%"\xae?\
+\xed\x0b\x03\nu\xd8\xc0i_\x1a\n\xb8\x81\x96\xb1[\xccF:\x18\x9e\x9f\x9f\xffv\
+\x81\x1d\xa7\xc7\xcd-\x1c\x17\xf6\xc7Mhbb\x9c\xd0\x0b\xa9i\xbc\xfcM\xa4"\x8a\
+\xbb\xba0c\xe5\xec\x01\xe0C\xd1*-}-\xad\xc7u~c\xf3v\xda\xd6\xbf\xa3\xb8\xd0\
+\xc6q~\x81]\n\xb5fO\xbe\x8b\xe6\x1c\x04\x81A\x05\x99\x99\x0c\x8c\x8c\x82\xd7\
+G\xd0\x03R\x03Q \xc9\x8a%\xac\xb9tV\xfd\xc7\x9eFc\xba\x14HX\x18*\xe5\x88\x81\
+\xb9\x95\x95R\x8dr\x00/~\xfd\xd1\xd2\xd2\x12q\x98\xe1FE-f\xcbP(\xe9\x9fpJ\
+\x88CCC\xe1\xe3\xe7\x87VD^D\x92\x12\xae\xf5M\xdaw\x17\xca\x03\xe6\xcd\x9e\
+\xef\xed\xaf\x7f\x95\x96\x1d\x0f\xd1\x8d\rY\x82\xb5\xaf\xaf\x01]\x8a\xe8\xc2\
+,Es\xea\\\xda\xe9\xaa\xfa)\xf1\xbb\xe7H|\xbbY\xdb\xa6\xd7\xd6\xcb\xef\x82\
+\xee(\xd4h?\xcf9\xc5\x11\x9eu{>M\xf9\xca\xcaJ\xb7o\xdf.6\xdb\xb0[h~\xfe\x95\
+\x0b\x1c\x04\x08g\x116:\r\x81\xa6\xe9\xbed\xe9o\x83\x00\xc1p\xe6Dh\xa0\x8b\
+\xe9\xde\xa0f!"T\xef"\n*\rU\x9aB\x93#\xb8;\xe8\x03\xb2J\x0b(\xe4"\xa2\xdd\
+\xf43\xb7v\x13\x8e2\xad\n\xa9\xa2\xc4\x91\x8b6\xa0fOae.\xe3L\x86kC\x0b\xb3\
+\xdb\xea\x13\xc9e\xef?\x81V\xa9j\xc3\xc7,\xb0&\xf7}Q\x10K\xe2\xf6\x1b\xff<xg\
+)\x85Ww\xf7\xfe\x8a<\x81H\x9e\'\xb7\xa7\x96\x90/JM\t\xcdD\xc8x\xe5l\x10\x98{\
+\x8d\xbf\xb0Fm\x18\xab\xaf\xf0Z\x11?Km:\x90\x7f\x01\xd7\xaa8\n\xe4\x9d1\x95\
+\x02\xd9\x91\xfaI&W\xe5x\xb9J\xbfN\xd0\xdcjm\xc9\xe2.\xaa\x88\x1d!\xf3D\xe1\
+\x1b`\xed\xcd\xcdx\xdc\xcc\x19\x13\x1b\xeb\xebhdB\x83\xe1<Z\x82\x15\xb6:\tQ\
+\xa0\xfd\xfd\xb0\x18\xe8\xbf\x7fKU\x0b\xc8\xfe\x90gff\xca\xd1`\x1d\x1d\x1dMM\
+M1\xf0\x02\x94\xcf\x96q\x06\x081P\xef\xf7\x03\xfdb\x181\xc3\xbd\xd7\xba\x86\
+\x86]\xad\xadr f\xe6\x7f\xaf\x7f\xaa\xc5\xaa\xa8\xa8\xc0d\x93Y\xf9w\x810g\
+\xeaQu\x8b\xbc\xf7\r\x08\x9d\xdf\x11\x7fe\x94ED\xfe\xb9\xcc\xeb\x10\x7f\xfe@\
+\xef\xdf\xe3\xf0/+**\xfa\xe6Q!Y\xa4V\xb1\x04\x84\xe7\xa7\xf3\xbb\x176?\xcf\
+\xf2\xeaj\x95\xd4\x00,*\xa8\xc8\xe1\xa2\xc5\xce\xaa\xae\x8b\xcd5W\xb6\x0c\
+\xe6,\xa5\xe6\xa6\x16\xd7\\\xf4\xcf\xe3e\x11\xc4*\xc7}R\x11\x06l\x19SVRF\xd0\
+?\xc5\x1c\xb50\x0c\x1f\xaf\xe1_\xe1ce\xcc\x15\x15\x99\xcd\xe0;g\x93\xd8-\xde\
+\xd2\xb5J\x11M\xa4\xa1\xcf\xbeg\x9c\x1e\xcaC\x1d\xder\x02%\x95\xeb\xdb\xe5\
+\x7f!\xf4\xe8Nu\xfb\xf6n\xdbDdD\xc0\xf1NKK\x8b\x16\x01\xedhq\x95\xf1\xd8\xdc\
+\xd8H\xc4GT(0\xbb\xae\xc3\x96A\xbd\x16^\x8e\xf7\x17\x96\x02\x07\xe4\x8d\xae>\
+\xbaV\x8e\x19%?\xc8*:#k\x02\xe2X>\x9ek\x89w\xd8\xee\xcczY,\xd4\xa2\xa3\xa7g7\
+h\xa5H\x19\xfb\xf5\xabb\x17>\x8aR\xa2i\xf09\x90\x18.R\x9f:I\xf8\xaf+\xedK\
+\x8b,\xbch\xdfs\x81\x8f\xfd=\xfc\x0e8\xa8x\xb9\xce\x01\xa7\xd7\xac!\xd6KDI8J\
+:\x01,\xe5\x10\xc4\x17b\xe7\xf74m\xf8\x07\x13&\xb4\xd9\xb1b\x08\x0e\xf9\xbb\
+\x1c\x83\xf6\x07va\xea?\xc4\xe9bgg\x1eA622\x12\xfb{\xf9\xdf\x06\x9d>@\x886\
+\x1cj\xa9\xf9*\xa5q2\xe6\x86\x86y\x00\x90\x9b\n:\xed\xb6\xd6)\xd1A\x83\xc51\
+\x10L\xa4\xcd ^bhu\xd4\xd4(2&\xb2X`8\x91E\x90\x1dp\x13|\x9f\xa6\xb7\x983\xd8\
+\x01\xd1\x13\xc8\x9b\x1e\x8b\x1a;~\x12\x0b\xb8\x9e\xa54\x91\xdcE\xfddi\x02\
+\xa4\xe8"hc1\xa7\xeb\xd9\xa2\xa6\xa2B \xf5z\xed\xf5S8:\xd8#\xee\xa0\x03\xb6u\
+tdyX \xbf\xde}\x8f\xf5\x9e\xf57\x00\xc3\xca\x85Y\x8c\xc1\xe0\x0f\xdd\xa2l=Dj\
+F\x1a}\x8a\xbcS\\\xd4\x8e\xabS\x10\xaf\x9e\xe4\xbe\xd6\x9c\xa2\x81\x90Q\r>GQ\
+\xe6lJ\x069\xe4\xcd\x8a\x12\x1dv\x14H\x93i\xe9\xfa\xbav\xcd\xfe\xf2\xe4\xe4\
+\xe5z?\xe2\xd6L\xd0$\x03(\x98\x8e\x82\rR\xa40\t)I\x10S9\xb6\xa0\xfc\xf2\xd4\
+\xed-\xd7\xc7\xa9\x9b\x90\xba\x08\xd5:\x97}\xd55\x7f\xed\xc5\x1a\xdb\xae\xf9\
+ \x87\xac\xd2\x1f\x81Az\x17\xca\x10\x84\xca\xcdZSh\x8d\x1e\xdb(C\x80\x10\xb5\
+\xbfh\x1f\xd5\xb7u\x19\xaf+&\xb3R\xe8\xd5\xc7\xbe\r\x0e\xba\x84>\x1b\xff\x82\
+\x1d\xc5N\x05\xe3\x12\xfe=\x10\xff8\x00\xcc\xac]\x1d"N\xcf\xf5\xec@\xff\xb8c\
+\xba\xa5\xb9\x19+i\xe5,\x0eDu-\xa7>\x11t\x91\x11\xe7.\'\x80\xb9\xd5\xe5\xfa\
+\x84\xbd"\x8av\x97xX\xb3?tP{\xb1a\xcb\x8f3\x0ed\x9b\xb9\x0e,\x072L\xde\x16\
+\x9e\xa7\xa7\'\xee\x13R\x01\'5\xc43\x97\xb6X\x99\xe2%\xdb/\x15\xbc@\n\xed\
+\x00b\x9e\x83\xbd\xa9)$\xa1c\xa5&\x15R\xc4\x80B\tV%W`\x0c\x84T\xf8W\xf2~U\
+\x10p\xc8byL\xa4\xf4\xc4b&&\xa6\xe4\x89#XXX^^^\xa1<\xb4\xb4`\x04\xd8>\x17\
+\xd3\x11\xfa\x8c)g\x81\x10)\xb2\xce\x0b\xea\xcbQHA\x8ch\x9c\x0c\x9c;\xa3A\
+\x1e\\DD\x89~\x02\xe2.#q\x91\x7fo\x1a`I\x19S\xe3\xac\xca\xb0E\x15\x986\xc3\
+\xd2\xcbt\xcd\xf5\xad\n\x980\xb1H\xde\x8f\xf1\xfeoWt\xff\xa2\x90[Oi\xffE\xe2\
+\x0f$%\x84\x12#K\xbd\xa7H\xbe\xe1\xb4V6S\x9c\xcc\xc1\xfd\xbd\x1b\x07AnA\x0e}\
+\x14\x1d\x8c\x14;\xe86\n\x01\x0eJ\x00\r\xb2\xb2\x1f\xaf\nO\xc1M\xd0v\x94\x8f\
+.\x16\x8a\x937p@\xc0\x97"\x1deH+\x03\xf1\xf6f\xd4/\xd9\x02\xf2\x13\xfb\xfd\
+\xf6\xf9C\xabh\xd9\xaf}o\xca\xe4f\xbf2\x17\x10*G\xdd\xe8\x1b\xc7\xe2UT\xfak\
+\xa5p~\xe1?\xf9\xdf/\x8d~{}]FU\x7fD\xf5\xf7\xdd\xeb\x0f\xb3\xce\xf7\xb2\x02\
+\x86#Rq\xf7\x82\xc8\x837z\xdb\x8a*iw\xdcv\x10\xb6\xf7BZ2\x10\xbf\xfb\xe8z\
+\xb6v\xe6\x18Z\x0e[\xde\x91\n\x8a6\x1eAV\xfa\x1eY\xb7K\x82\xa2P\xab\xa2\xef\
+\x18\xf0l5C\xc3\xb8\xda\xe6\x01\xf5\xcf\x9f?s\x0b\n\x12"\xc0\xe0 \x85MY\r@B \
+\xec\xb9Q@\xed\xb5\x86KRj>DBGC\xa4\x8f\x02M\x98=\xf5\xdb\xb1\xeb\xe3\x15p\
+\x00 "\xd15 \x869\xd0\x08\x86\x9e.\xdd\x85\xa0\x102\x0cP\xf6"x\xd5\xea|\xffJ\
+9-\xdd\t-\x84\x19\xb3zu\x17\xd2M\x14\x83E\xc9\x16\xaf\xc2\xcf\xdf\\\xc6\xf3\
+\xeb\xa5\xcd+\x94[QQ\xd1\x94R*\xa2\x9f\'N\x86\xaa,\x85\xba\x08\x94\x80\xed\
+\xd3\t_\xff\x93\xa2\xbc9y\x0bF\xbdz51\xdc+V\xe1\x10DUg9\x91n\xc2\x01\xd8\xdb\
+\x94\x95\xab\xbe~\xce\x9a}\xb3\x0e\xeb\xd7\xaf_\xdf\x85\xe6O\xdc\xf8r`\xcd\n\
+j\xe8\x1c&\x8a\xd4\x10\xd8\xa1\x98\x08\xf6\x99\xa6q\xa9\x11\x9eq\xba\x16_\
+\xd57\xc1\xce>\x7f@\xf9\n%\x81\xcf\x14EVA\xdf\xb2\x8c(\xae\xcd\x03\xe9\xea\
+\xb9\xa7\x89\xa7\xd5\x18\x1a\x1d\xc1bh\xf1\x89\xb3E$b\xe2\x9fEj?Sh\x95c\xcf\
+\xe1W\xc2\xe6\xdb\x7f\x90\x0fZ\x8dY$\x17CT\x9en\xbf\r\xf9XZZ\xc2w\xfbJ\xb0e4\
+\xe0\xc2G\x8fv\xae\xe3\xe6S\xb0\r\xecV)U-\xe7\n\xfa\x11U\x9d\xd8\x91\xf0\x02\
+a~\x9b\xf1*m"\xe3\xf8\xf7\xb1\xc9\xd9>\x8e\x11|\xf7\xdaZZZ\x1a\xd0!\xc8\xe91\
+\xe1\xe1p\x9d\xffe\x162\xa51\x11E\xdd?=\xf4\x05\x81\xf2\x94\xd4\xd51\xd7\xe3\
+ \xb8+4\x99\xbe\xf2\x11_\xa1\xafbC\x05I\xc4\x15\x87\xd3\xf6\t\x1f\x01J\xf9\
+\x8aLJ\xca\x81\xdcet5\x9d\'<7+\x03:IIL\xc2\xd3F\xbcL\x0f\xfaN\xd2`\xb1\x90\
+\x11\x99M\xac\x8f\x81\x01\xd9\x1cQ\x8c"\xc7\xbc\xbc\xbc\xbc\xeff@\xee\x8f\
+\xd1\xe0\x018\x8c\xc7\xd5\xa6t\xcb-p\xe0\x18h\x1d\xe1\xc1\xef\x9c\x99\x97\
+\x93\xce\x14\xcb\x15^\xda\r?\xb8\xde\xc3\xafP\x91"\x85a\xebWSB\xab\r\r\x0c4\
+\x99\xd20\x1ckVrTJM\x11 \xc6\n\xa6\xac\x98\x99\x98$\x8b0\x1eC\x80\xb8\xe4FHJ\
+H\xf8\xe9\'\xdc\xd3\xf0\x17}{\xe8\xee\xcd\xb5\xb5\x9d\x95cg\x1f\x05EE\xa9"5\
+\x06\x1c(\xe6\xba\xcc\xa8\xdd5+\x11.qRf\x81<\x15d$\x8c%\xdb\xc7\xa0N\xcd\xb2\
+L\xf2\xa1\x9a\xc0\xec4B\x1b\x8c\xed\xdf\x85\xe8=\x02hVwxa\xe8\x88Ab\x89\xdd\
+\x12\x1e\xbbc\xe3\xe26\x82*\xf9\x02m\x8d\xef\x8c\xc2\xd7\x12QJ\xca\xcaE_\xf8\
+\xec)9!\xa9\xb3u8\x02\x87`p7\xb2@n\xef\xd6#i\nG-F\x01y\x9fX\xf8r.\x80Q\x90\
+\x9bsf\xdf\n\xe5q?/\x8b\x91\xa1Z\xad\xbb\xdal3\xaf\xd3Y\x8d\xbd\xba\xba"\'&\
+\x96\xea\x1f;\xb8\x01Q%m\xcd\\\xa4O\x1c\x05I\xf4\x9apX4\xac%\'cI@\x00\xbf\
+\x17\x18\xc6\xfe~(=Y\x8c\xb9\xebk\x0e\xdb\x0f\xaf\xa1\x9a\xcaJ\x93\xb7\xad\
+\xbab\x07\xed\xcf\xd8\xda\x81\x91\x88\x16X\xdf\xf3We\x08\xee\xbb\x9b_:\x8d(\
+\xde\x03\xfb\xd0=$\xba\xda\x8dE\x070Z\x9fQ\xf64"\x8a\xe1\xbc\x1e\xc2\xc2`3&`\
+\xc3\x14\x93\x1dcGn<Ex\xe3\xb3ux\x86}\xca\xb5\xa9p\x8e\xfc\xc8\xf8D\xe8\x1b\
+\xa3\x10\xfc\xd9{\x9c\xbb\x8c\xd0)Coq\x113V\xb5\x01I\n\x92(,*\xda\xdbls\xc5\
+\x8b9\x9a\xdd\x93\xf2tb0(#\xc3\xb1\xac;\x80\xa0Vg\xcbp\xe5\xc7\xa4c\xef\x04l\
+Q\xa36\xd0s\xdf\x8d\x04\x02\x8d*_g\xfb\x9aSz\xb5\xab\xaeL-1\xa2\xdc\xea1\xa8\
+\xe9\x9d\x9c\xe5\xda\xb6\xbc\x89\x93\xac\n\xe0\xb1&\xebZ\xb6\x8b/\xee\xd7j\
+\xf3\xb6?e\x92\xa16\xe4\xcc\x1bd!p!J\xae\x7f \x7f\xdc\x0ec\x8f\x80\xabF\x19\
+\x88\xa2\x00\xa3\xd1F\xeb\x91\xd4\x881*\x98i\x01\x8a\xbc\x99\xfe\x02\n\xba\
+\xd2\x96\xb7\x03\x1bB\xdc\xa9H\xde\x96\x0e9p}K\xd8#""\x02|\xa8\nN\x15\xde\
+\xdbv\x12\xfa\xca\xb7qE\xf2<\x9e\xffx|\xe6\xbe85\xa9R \xe2<\xbfW\xb6G\x82\
+\x8bI\xe9w\xe1\xd2\xd6\xa8\xc7\n\xd2c\xcb\xd8\xe9\xf6\x13&K\xe8\xb9\x19&\xfe\
+\xdfS\x80\xbd{#\xcd!iDq2ED\xbd\x05\xb0{\x880P@\x00.C\xf0nk\xc0\xc6B\xd8\x80\
+\x99\x94\xc4 \xa3\xf3<\x9e2\xee\x112\x1fTa\x8c\x94\xd8\xc3\xd8WE\t<\x90#\xa6\
+\x0e\xbeq\x1d\xf5\x19\xf8\x88\xd0\xe3\x91W\xb6\x92\xce\t\x8e\x04\xb0\xe1\xec\
+r\x19_H\x08\x85\x185\xf7\xbe?\x14\x98\xa2\xc2\x1b83\x12\xf9\xf2\x00>L\xc8\
+\xb8\x91\x9cU=;i\x14\xa42Z\xb3oXf\xa1uK~\x1d7\xae\xb6M\xed\xce\xda\xc5\x92Ee\
+\xd5\xd5\xf1\xd2\xe6\xd4\xd4\xd4\xab.\xeaY3\xa5\xbd\xd2\xc1a\xc1r\xac\x98A\
+\x14\xb9g\xc1E [\x12^V\xd6\xaa\x8e\xec\xec\xc2\xdb\xda\xc3\xefI\x08#\xa46\
+\xdf\x848(\xd52[e\xb7\xc8\x9f\xb6\xb2\xb3\xf2~\x7fg\xa9+r5\x9a\xa3\xe4s\xa7`\
+\x84\xf8\x03!\xb6#\xca\xe7}_U\x1c\x18WO6\xe3\x9a!g\xf3:\xdd\x9f`\xdb\xc3\xbe\
+}7\xe2\xb9\x7fK\xae:lggGX\x02qz6?\xaf\x01\xf3\xd8\x85\xd5Am\x84\xc5\xc4 \x9d\
+\x89\xff;,\xeb\x8b\x80blUSqq\x08\xb5\x85N\x0c\xd5\xa1\x96\xf6/\xa0\\\x01+\
+\x12&\xe1\xd5\xa9Q{\xd1\xaah\xea\xac$y\xe7\x93\x96\x96\x06\xb0\x86-\xc3\xce\
+\xca\xdbJ\xb0\xe3\xdc\xa5\xed\xf1rK\x11\xd4\xe2\xb8\xa3U\xaeI1i\xa4\xa33j\
+\xd5P\x96\xb5\xd3\xfe\x8d\x19\xe1\x10\x90I|<< v#\x80\xdd\x84X\x9b\x8d\xbb`\
+\xc2\x83:L\x1b\xd6V;&\x14\x1br`\xe8\x04\xd5o)\xef\xaeO\x87vE\xe4/h9\x9ct\xe3\
+\xcd\x93B\x8f\x0f\x8c\xf7F\xb1\x99I\x7f\x8a\xf7\xd6\x039\x1c\xf0\xbe\xd5\xc4\
+\xa8Q\x13\x8e\xc0\x1f,\x04(\xfd\xdc\xda\xf2\x17\xf2\x1c>\x81\xdd\x10=\xa9\
+\xd6\xa3\x9e\xb4\\\xf6\x9d\xc5\xff\xae\x87\xbd\x87C\xe9\xcb\t\xa4\x16\x9b\
+\x16C\xeaP$\x13\xc5q\xb1z(\xd9<L\xed\xe4\n\xbaZ\x1dO\xe7!t\xf4\x7f\xc9\xcd\
+\xcd\r\xbd\xd9Y]E\x90B\xb1!\xdf\x0c7\xaa)(\xc8Q-] \t\xc7\x89\xc3\xc4\xfb\x9d\
+\xa9\x896\x1a\xd6+\x12!\xe1\xba\x87\xe3\x1b\xf5\xb9\xb0\x08c\xd7\xb7\xad\xe1\
+3\xeb\xd7\x15\x93\x1a[;\xc7\x11\xb8\xde|u\xa34Ls\xdagP\xf3\xc1\x87u\x0c\xd8t\
+0\xe5\xe6\xdf\xd5\xaf\xcd\xb5\x17 \xb0BD\xae\xef\xfcC\x8c|;/\xb4\xb8\xd9\xb9\
+2t\xf6\x90\x90jO)@\xd1.\xae\xcer\xb2\xf2\xf0n\x8eA\x83\x10,J\xcb\xe2\xdf\x02\
+8\x048<\xaf\xb6\xbb\xb2\x97\xa41/\xeb\xd4{f\x02\x1e\xc6\xbf\xd4\xac\xe8\xb3d\
+\\\xad\xaa\xaf\x00J\xf5\xf42\xe3\x91\x17q\x8d=w\x7f\xcfC5sK\xe5E\x97R\xa7W\
+\xa5\xe3K\xf0\xf5\xe2\x82\x9b\x9b\x1bt\xe8$\x90\x88\x108\x10\xebZW\xca{i;\
+\xc8+,$\xa4\xb3Z\xeb-##\x03\x81:\xd8>\xc8\r\xe0\xcc\xf7\x8e\xe1\xc1A\x98\x0c\
+\xa6\xdd\x07\xee \x12Y\te\xa8.xD\x9a\xbb\xf3o\xdcc4X\x11\x9d\xc7N+\xd4\x9c\
+\xb0&\xf8\xad\x03\xc8\xc8\xc8\xd9\xd9\xd9\x10}\xb6@]lm\xd96\xe9U\xfc\xfa\xd5\
+\x8b\xd9\xdc\xd9\x19\x1b.\x0e\xe2\x11\xe0\xc8T\xa2K\x92\x82d%\xa2\x06\xdf\
+\x9dB\t\xb0\xb0SY?h|G\xe3\xa6\xa3\xc3\xe1\x008J\xee\xfa\x90\x13\xdc\xba\xa4H\
+n\x14\xcc\x8b\x89\x16q#\x93\xe8*\x9d\xa3\x16\x18\x99\x988\xb2\x19l\x0c\x91e\
+\x8ec\x07\x03\x05y>\x7f\x9e\x1d\x156\xec\x1eu\x9d\xa3\x0f\xd7\xf0\x82\xb8\
+\xcd\x99\xb0qW\\,\x0eu\x85\\?7\xb9\x14\xa1"[Y\x7f\xb3\x08\x8c\x14 \xda^E\xc5\
+\xd0\xcb\x84f\xf2T\xfdHW\xf8\xe4\xab\xc8\xcf\xf87\xef\x9c\xdd\x08/\xe0\x8f\
+\xa7n\xfc\x84\x91\x8c\x8c\x0cY\xc3\xea\xf5u=\x84p\x85b*\xaaNb\xaa`L\x84\xd2u\
+\xd1S\xb1\xd7\xe5\xb9\x04\xb1\xd7\xb2\xba:LX\xdc\xdc\xb4\xb0et\x18(v7\xb7k%\
+\xc0Uz\\w\x99I\xd9;Gm\x98\x0e\xc7\xbc\x1d\x1f\x7fj0\xc6,q\xcd\x8a\x17j2\x19\
+\xb2\xad\x84!\xe3se)IIA\xf3\xb9fL\xe0&\x8c@\xf22\xb3\xb3\x17\xe4fV\xf2|\xc1\
+\xd2v\xf0\xee\x02*\x98\xdd\xc3\x1dH\xf8\xbb\xb8)\x87\x1c\xaa**2\xc5\xea\xbd\
+\x90\x9f\xa8\xe7\x96\x97\xc3\xdf\xc5\xd5&\xcb\xfek\xd0a\xd1A\nd\xc5U\xf0}8\
+\xb2<\xf2\xf3\xf3\x03z\xdbo\x86L\x05\xb3nf\xe6\x9d6j)$N\x86\x8d\xfa\xc0\t\
+\x02\x8f\xd65\x14\x17\x0f\xef\xfe\xfe\x1eB\x07\xd14\xc4\xe4Z\xef\xf0O\x1e\
+\x90\n\x04l\x8d\xb6W\x10{\xeb\xbb\xc6?$e\xe1\x0b\xa7"a1\xd4\xff\xfb\x8f\xb1\
+\xd9\x8f\xcda\xcf\xc7\\\xd3\x17\xc8E\xe3\xbb\xd72\xd7\x1d$t&\xa7\x94\x8f,\
+\xad{\xe8\x91\xfc\x12HP\x13\xe4j"T\xa7]k\x00\x8f\xdd\x14\x03G\xded\x81Y\x87\
+\x19#\xb2_\x9c\xbcC\xe6)U(!"!000`ab2\x13\xb2\x9a6\xdbE\x1b2(\xdc9>f2\xb79\
+\x8e\x8aB\xc4\t\x012Q@\xef\xce\xfaz\xb6J\xa9(\xd9\xccZ\x83uF\xba8,\x18]>\xec\
+\x97\xda\xa5\x9cd\x10\x12\xec\xfa{\xf8\xc2\xc9\x83\xb7\x8f\xb7w\xf4\x91\x0bZ\
+\x8c\x0b\x12\x1c\x9a\xb8\xbd\x8c\xfbO\xb1\n\x93\xf3\xb18z60Q\x13\x1dQL\xf7S\
+\xcc\xd3\xe3\xc5\xc6\x93\x8b5=&\xa5Rp\x94\xc9c$`X\xff[4\x0fq\x9a:f\x01D,\\\\\
+\\\xf6\xab\xb3\xd0\xea\xb0"d\x9b\x96\x81=\ts\x03\'H\xd3e\x95.\x1f\x8dI\x93O5\
+\xc5s\xca6\x944)cTIr"d\xe8\xd3\xf0\x80\xe3\xa1\x1e\xc7\xad\xad\xe9\xe6\xa9X7\
+\xe9\x11\x13\x11\xd5\xb6\x9c\xfb\xba\xd33A\xd5\x11S\xb0E\xb2f\xd3\xec\xe06#\
+\n\x9d\x06\xdf\x05x\xda\xe8\x14\xa9\x91\x88\xb8!\xf4\x17(\x94\x00 \xf5\xfb\
+\xf8w\xcb\xd7\x8d\xc7-\xf1w\xa9d\x94os\xcf\x11\xc7f\xab6\xbb\x188\xbfr\x9c2\
+\xef\xc2\xb1\t\xafD2()\xd3\xe4\xf6\x0b\x0c\xf4\x87\x9b\xa1s\xe0\xe8R\xd6\x00\
+\x9b\xf0\xe4u\xd0\xa1\xe5m4wB&\xda\n\x8e\xa7\xa3\xfcrn2\x12\xae\x1e.dC\xa5gd\
+T\x1d\xd0n\x14[p\xe7>n@\xc7\xd2{.@\x81\x1e\x11\xd2\xb7\xcdH\xe5%\xb7\xbf\xf1\
+E\xfeo\xb3\xcb\xda\xe6\xe1\xe1\xe1\xfe\xfe\xf7\x99\xe3\x01TW\x0e\x9d\x9a\x15\
+Uee\xe9bu8\xf6\xa4A\xdda\xdb!#KYv\x0c\x86H\xbf\xb7\xa7\xa6\xab5\xf3\x86\xb5\
+\xc4SllB\x02%\xf7^\x8f\xf8^\x8c\xe4\xa4\xf7Rjc\xf1`(\xfaT\x7fs\xb2\xd6\xd8\
+\xe0\xb8>@\xc8z5^X)\xec\x11\xf3i\xf5\x0c\xa3\x10\xea"\xba\xadZ\xdb\xf5l\x98\
+\x9f\xc3\x04\xa1\x8cA\x7f\x1d\xed\x14\xed\xb8\xf2D\x9c\xf7A"d\x01?\x8b>\xa1\
+\x10\x85IR\x12\x84\x02\'r\xe4\x12\x94\x87\xb5\x1f!\xc7\x9e\xb1`\xd0\xe1\x8d\
+\x9b\xf6\xae\x93\xf4\xeeG\x95\x840\t\xafR \xe8\xb7?\x18\x85\xff\xd4\x85\xb0\
+\x9e\x05t\xce`W\xc1\x7f6\xabK\x8b\xf7\xe3\xda=\xa7N\x8b$b\xef\xd1}&\x9e\xc7y\
+\x1efu\xd2UZ\x1b\xf3\xeb\x1a\xfa\xfa\xfa\x00\x9e\xbf\xb5miU,]\xdda\xcf]l\xb4\
+$\x1d\x0e\xfc\x82"\x8b\x8a\\\xe5\xdb\x93\xe32\xfb-**\nAQ,\x02y\x04\x07\xa2\
+\xc9\x98 \x06\x12{\xa2\xaa\xf3Q\x9fp\xe0\xc5/-\xbbx\xf0\xb9\x00\x17\xc2jR{GG\
+q\x12\x02\xfej\x19,\x15\x87\n\x86\xa4sd/W3\xe5]\xb3G|\x8e\x13O\xce\x9c\xa7\
+\x13\xe1f\xb1C\xc2\x067//\xec\xe9`\x0c>\xdbw6b=\xe8\x95\xc1\xf0Iy\xae\xeav\
+\xcb\x8d\x1c\x9a\x0e\xbd\x9a\x95;\x07\x94\x93\xa1.ijL\xba\rLx\x07\xe8eHL\xca\
+[\xf4o\xd4\x0e+ \xcd/\x86\xdf\xae\xb6E- \x07\xcfv\x19u\xcaM\x0b$\xce1>\xcf\
+\xf94\xb4|\x9c\xbcn\xe7tAp\xd5\xe3\x99\x1f\x8d.\x90\xa1\xc0\x01%\x84\xf1w\
+\x08T$\x06\xdbN\x91\xa5\x04u\xa1\xad\xa3\xa3vP\x06\xa9\x92J\x13\x8b\xf1\x04\
+\x05M\x02Q\x0b^\xde\xaa\x92\x83\xa9M\x90\x91\x0c\x82\x88_9{0Q\xb5\x88\xeb5\
+\x81\xfc\xb8\xba\xcfZ\xc0\xdb\xc06\x85\x07\x07\x9f\x82\xf5\xf5\xf5b\n\x98>r\
+\xc0\xaf\xfc\xb6MH\xba\x84\x8d\xd9!\xec\xda_\x0cK\xb4\xec\x00\xdb\xf7/\x00\
+\x8f\x04<\x99\xc7,i\x00#W[;\xdb\xde\x91\x86\xbc\xa5I\x84K\xc0X\xeb\x0b0\xa1\
+\x96\x85\xdb\xef\xfb\x93b\xc7\x7f\xff\x19\x1c\x19.D\xaf\xca\x9d\xb3Y\xc7@c\
+\x12\x8e\xdbvz\x11K\x7f9k\xa1T\xaa(\xb1\xcf\xe4\xcf\xf9\xf9{\x03\xf8a\x06\
+\x8d\xdc\x1fV\xbe\xd8\x80\xcf\xe3vP\xbe\xb1\xf5\xf2\xfc|\x10Ij\xda\xa0x\x8e\
+\x82%4\x17\xbb2A\x8d\xe1\xd0M\x08\xfe\x15^\x12\x99R\r\x0e\xda\x99B\xa6\xdf4\
+\x97:\x168\xaf\xeb\xbfW~\xe0.\xe3N\xed/_`_\xca\xab\xaa\xc2\xc6\xa5\xc6K\x0f\
+\xc2\xf0=x\xaf\x82Qk\x98\x97\x04Ix[K^\xda^\x0c\x95\x95i\x12\x8f\x9d\x98b\x9e\
+l\xdf\xa9\xec U\xf0\xaeQ\x02s\xa5\x1a\x83\xaa\xb4*F.\xa2d\x8a\xd5\xbeH\xc8H\
+\x95\xf964\x00\xd2\'D\xc2\x9bH+\xd3\x135\xd4\xf9~\xa9\x03yD\n-\x9e\xf5\x12\
+\xc0\t\xbd\xbf\x04Q\x19,\x86[\xdc\xd3\x99\xf1K\xabE\x9a\x0eq\x82$\nd\xc0\x86\
+\x7f\x8e\x0c\xf1\xe0D\x13\x1b\x13\x1d\x1d}yy\xf9\xf1\xf11<,\xc3\x19s\xf8\xe0\
+\xbd\'K\xf3\xc3\x02\xfb\x8d\x85\xa4\x07\x88\x8d\xdeTI\x12N\x19\xb8\x96\x0c8\
+\x80\x80ux\xddYY\xe1\x1d\xf3\xb0:\x999\xfd\x01\xe0\xe0\xd4}\xb1D\\\x99s\x97(\
+\x1fg\xa4Y\xe0\xdb8\xd1\x083&$9x\xed\x06\x88XJV)r\x9a\t\x9b\xac\x0c\x1a\x81\
+\xccs\'\x8d\xaa\xa3\xbc\xcf\xfb\xcf\xe2n%\xed\xaa\xe2S\xb1\t\t@T\x01\r6\xc6\
+\xb1eT\x00Q\xe5\xd6i\xffX|Ft\xf2b\xb3\x8d\x1b\x07\xe9\xc4\xad\xfd\xdf\x1d\
+\x9cRaG\x81\xb7\xb7W\xa3\xcb\xf3\xc5\x93F \xdc\xf4\x00\xfa\x15\xdcW\xa8Q>i\
+\xc1e\xd5\xd0\xd6\xde\xben\xc3c\xd4\xea\x04\xe9L\x94\x1b\xbc\xa2\xa4\x11\xb3\
+\x04\xbe-\x00+*+O]\xfd\xfd\xb8\x82\xa4\x0b]\xfd\xc2\x96svyIFD\xb2\xbe\xd4\
+\x88<\x8f\x16\x88\x84\xe9|\x04\xee\xef\xef\x1f\x1fG2\x11\x07\x82Q`%\x89\x90\
+\xef\x9f\xd1\x95\x04\x1e^^J\xa18o\xd3\xc3P \xfaPe0\xf0F\xf0~\xecw\xe3\x0bB\
+\x15$\xea\xbd\xf6;\xc8\xc6\xa7\x10\xaaM\xd1M\xc8\x8afH,^\xe5\xe4u\xb9\xbc\
+\xdc\x02f\x04Q|zy\xd9\xed\xfbr\x0b\xeco\xff\xb8\xf3\xa0(\x9d\xae\xe6\\\xa9\
+\xf1]\xfa`\xc1\x82K|a\x16\xe2r\xf7b\xc3\x16\x08\xba\xba\xf6x\xc3\x03}m\x0c\
+\xe6\x9e\xff\xb7\x16\x00O:6}H\x87\xe6Q\x85\x06\xabs\xa7\x1f*B"\xba\x8cU\xa7\
+\x87\xe6\xbek/\xb3\xa0k<^D\x1c\xb3\xa87\x0b\xfa\xbc\x93\xb8\x98$\x12\xf5{&\
+\xe8\xc1\x9a\x87H\xbd\x15\xf2\x16w.GB6\x10\xc0\xda\x98\xa1\xfa\xfa\xfa\xe0W\
+\xe3?8\x99;j\xaa\xdeEH1\xe0,9\x1a@\x95\xd7\xbf7_~\xd0\xd6\xd0\xe4F\xb6\xb7\
+\x0bY\xe1\x85bB\x0e\xd0PR"\x98\xcd\x11<\x93^\xbbq\xfc\xc4\x08\x01\xd9b\xc3\
+\xbbJdh\xd3u\xfa\xa5\xc9\xd0R\xf1\xd6\xdeQ\xf3\x142/eM\xd2m\xd2\x7f\x0e\x14}\
+\xbc\x19\xba\x01\xeb2\xb1F\xa0\x91\xef\xf7\xb2G\x1f\x03\x89\x10iN\x89\xee\
+\x0e\xb5t\xe1\xe0\xd1\xads5\xa8\xb7\xc3\xb3:`;\x81\x05S\xe3\xa7~\x8b\xc3\x90\
+\xee54.\x12l\xeb\xce\xb6\xe7\x01*g\xfb\x04\xf9\xfa\xfa\xc6\xc5\x97G\xe5\x1c~\
+X\xa8 \xa0\x8d\xbe\xda\xd8\xec.\xbb\t|\x08\xef\xfc\x9d\xae\x90\x8d\x0fd\x9b\
+\xb6\xe7\x03\xf2}GQ\x11d\xde\xdd5v-Z/z\x9el\xd7\xf2\xe6jpG\x93\xa6\x1e\xf0e\
+\xcc\xac\xab\xcb\xcb\xc7\x17\xdf\xaa\xaa\xaa\xad\xad\xadHv\x0e0I\xb3\x8dO\
+\x1a\xe99g\xabX\x0bt_\x1a8#\xe0\xce\xfa}\xf7\x91I\xb8\x16\x8bfn\xe8\x06\xd7\
+\x89w\x9a\x83r\x9a\x9f\x8b\xeb\xbb\x1aC\xaaB\x89_W\xba\x8f/\xb4\xaf_]\x11\
+\xe9O;\x07\xb6\xde\xaf\xe0e\xbf\xb4}\xcb.\xa8R\n\xb82\x18N\\\x9ao\xb5\xd8W\
+\xd8\xf8\xb2\xf3I9\xee\xc9\xbd\xbdata}&\xb3F\x96#\xc4\x90\x12\x89\x01\xc1\
+\xe2@l\xd87\xf8\xe7\xd51\xf1\xc34G8C\x90\xc4\xd1\x82D\x84\xa6\x9f@\xc7\xd3\
+\xf9\x03\xb1\x9c/\xf8\xbf)I\xd0\x8a\xd1\xbf\x8f\x1e\xcaj\xec\x9a8\xb0\x05\
+\xfa4h\xaf\xf5A\r\x96\xc6\x90\x84>\xff\xf7.\xe4\xb2\xc4\x9f\xabb\x00\xe9\xeb\
+_\xba-*?\xbf\x81C\x8fGJ\xe5,2m\xf8d\xf8\x9e.\x15^\xfb\x88\xcf\xf7\n\'~\xd9\
+\xb5\xf6v\x9aD\x9dK\x1a\x86\xd2\xd8\xd4\x12p0\xba\x82\xab0d\x0c>\xee\xf9\x9d\
+e\x168\x08H\x0c\xa5O\xa2>\xa7\x0f\x8dKs\x9dg\xa4v/J\xfd\xfd\xad\xd9C\xf5\xe5\
+x\xe4LJJ\xca\xd2\xd2\xd2&\x04\xf6DYw7\xd9Y\xec\xd0\xad\xebp\xb9\x07\xf0\xa3U\
+\xb0\x92V\x171\x87\xc4w\x85\x8fr\xaf\xdb\x1a\x8e\x9d\x9c\xfdaX\x82\x8d\xef\
+\x94\xef\xde}\x97\x8d\xe5M>`Nh-\xb0\xb0\xd1\xba\xc7;a\x9a2)\x0fx\xa7\xe0\x0f\
+O\xe2\x9bBR\xb6\x9f)Sf\x83\xd3h\xbe\xf6g\x0c\xa5\xeeC\x1b\\&%a\xe2\x99\x90\
+\xa9a\x04FG7X\'\x13\x88\xc9\xefsq\x12\xa0\x08\xc0\xa9\xcaVt\xf8E\x13\x87\x94\
+\xe5D\xfe\xd9\xa8\xe9\x89\xcf\x1b`\xe6\xa5\xb3J\x1b|\x83\xd9\xa6\xc0$D\x81\
+\xb3\xe7\x83`?\xba\xe0\x7fWk\xdc\xb6\xa5\t\x12H\xa5\xff\x9c\xeb\xdaM{3\xc5\
+\x85|\x99R\x0b\xd5\xfd\xe7\xa3g*\x8eu\x9b\x91\x1d\xbbt\xad\xe2\\\xc7\xd4\xd5\
+5\xc8I 7\x7f\xca\xb3\xb4\x93.\x85\xd0\xd5m\xe0dp\x1d\xd6\x8c\x07\x03\xe1z\
+\x91\xdb\x90\xa4\x19\xb3xN\x80\x8b\xab\x7f\xbeB\x8d!s\x18\x7f>\xac\t-lJ\xb3\
+\n\x04\x13Z\xb0f?\xdc\xa6c\xbd\xea\x15\xdf\xfd-5RHXxc}C\xbc\x94\x99\xf3\x8a\
+\xc6\xd3\xba\x96w\xb0\xc5\xa6\xbc1\xd2\x11m\xbd\xcf\xc82\xe20\xa5q\x14D\xd9g\
+2\xa6\xdb\x02\x93\x19\xa0\xb99>Hn\xc9\xb4\xdd\xd6\x06\x01f\x887e3\x14\xf9\
+\xcf\xd5<F\xae)\x97\xfe\x98\xc5eSW\xc0q\xec7\xea\xcd\x9b\xc8\xde\x88\\\x89\
+\x06h\xd0\xa5_#\x94\x9f\xf67xM,\xf8\x99\x10%\\\x93\t\xf6\xd3\x10[\xf0L+\xc5\
+\xf4m\xb5\x15*\x9f|\x95\xe7\x90\xcf\x01|_\\Ss\xf3-\xf3\x81\x8fI\xc9@\x05\xc2\
+\x08q\xdcpx8\xdc\xbf\xab\x84^\rH\x9aPw\xd41L\xe1K\x9c\xee\xdf\xba#\\\xadg\
+\xea\xd4Yn\xdf\xa3\xdf\xc8{`\xafR\x9f\xf8\xcf\xe2\xff\n\x1e\x18\x17\x82\xf97\
+\x1e1\x0c\x93\xb7/\x7fN\xe5\xc8\xc8n\x8d\xc4\x93\x0e\xe4l\xff\xdd\xbc4\xe1x.\
+.\x96u\xdcj\x87\xcd\xd8>\xbe#\x15\xf1\xc4\xb0\xae[5/\x1e\x16\x0e\x0c\x17s{\
+\x9e-Ag7\xf5\xa0\xa5\x82\xf0\xac\x93\xeeM>\xbf\xbc\xc4\x136}\xf3\xed\xae\xd2\
+o\xa9GT\x98?\xe5\xcc\x99\x9aD\xeb\xd6\x1a.,\xf2\x14\xc7\x04\x83*\xe4\xa7\xa4\
+]\xf3"%l\x06\x88q\xd2Y2^\x93)\x98\x8c\xca\xa1\xdd\xf2\xa3\xfb8\xe4y6\x1a\xd7\
+)\xcc0\x87NC\xafz\xb9d@e\xa0~\xf4=E\x03r\xc7"\xa0\xbafh\x1d\xfc\xf6\xd3\xfe\
+\x8b;l\x08\xddq\x12\xa2\xa7\xa7\x7f\xba\xd8\xe1\xa7\xff\xc6P\xba4\xb9\x03j\
+\x04B\x87\xda\xdf}\x93i\xfbH\x0cv\x14<\xf3\xabT\xed"\xb5\xc8\xc3\xce>\x93\
+\xc4\x9aX9\xb5m\x94k\xeeh\xf1\xc1~\xfb\x8cl\xaf\xa7\xed\xf3!\x85\xde$\xa5\
+\xa3\xcb4\xbd\x04s\xf3\xdd<\x19\x1a\x84c\xde\x81Wdg\xd4I\x11\xd5\xf8V=\xa7\
+\x01k\x95\x82\xe1p\x0b\x0e\x82U\xe6s\xe2w\x1d\x1a\xb5\x19\xe2\xd5D:zz\xf0;\
+\xf8\xf9\xc9\x0e\xfcJ\x9c\xc0\xbe\xfe1\xa2a\xaeJ\xbc\x8c\x83\x89\x8a\x8af\
+\xca\x87\xab\x10\xb6dKJD\x02\xa5\xe4g\xe3\x840-h\x84\x8b\x12\xd4\xf3^\xd1\
+\x03\x85/Z\xf5(\xad{P\x9f\x86|GI\x80\xb2\xaf\xdd\xbb1#&\x98*\xbaa?\x8bY{&\
+\xe7\xbdP\xae\x89\xf4\xd5uo&\xe5\x87Z\xff\xde50`BBB\x12fc\x8f\x08\xc2\x8d\
+\xe7\xbf"\x89\x89\x86\xf5t\xfe\xac+k\x90\x18\x15\t\x07\n\x98\xfc\x8d~\xbc^g\
+\xaeU\x9e\x90a\xf4\xf9\xb2\xdf\xf7\xbdj\xbazMo!UY\xebcN\xe4k\xd3r\x0eE\xdf\
+\xf6\xb40\xd6\x95\xdc}\xc1\xcd\xcfZ\x0e\x81[(u\xca>\xce>\xfe\x1e\x173\xe9&\
+\xb9\xe0\x18Y\xd0\x8e\xf7\xdfoJ\x14\xdb\xfe\xdb\xaa\x91\xda\xe6\xc40\x13\xd0\
+\x8e\x05\x86(\xb1M\x0e\x8cp\x97\xd7M5\x01\x9f\x17w\xa9\x96\xc4\xe1:\xca\x10X\
+\xebv\x14\x92\x87\xc5\x1f.\xe5\x9b-Mj\xe6\xcc\x89\x8c7?\x12F\xe0$\xc3#g\xd3\
+\xfa,\xb8\n\x84\xbc~\r\xab\xdf\xd9\x1f4\x80BG7\x81\xf6\xae\x85\xaa5O)\xcc\
+\x89\x1a\x15>\x1a\xfa!\xa1{K\xa7$\t3a\xc1u`B\x82\xb8\x17\xb1\xc6\xc7\xc5\x15\
+\xfc4\xc2O\x07\xe7\x7f\xad\xca\x02u.\xcd\xf0\xc1\x9b3\xb5y\x07\xbd1T4\x10a\
+\xd2\xcb\x9c6\xfe\x99^\xd5\xefhW{\xfe\x84\xa7\x83\x1e\x04\xf3\x04)\x9e}LkvR\
+\x99\xb6!2\xa0\x8f3\xd4d\xe2\x922\x86rly\xb6\\\x05\xa8\x8d/[\x04\xd6\xcd\xf3\
+>\xaf \xc4p\xc6\xbet\xcf#\x1c\x08\xb7V\xab\xed\xb0<P\xa4ED5\xe4\xd0\x10r\xc7\
+\xa7\xb4\xd3\xebM\x04\xce\n\xe5\x0e]z\x12\xbf\xed~\x8fv\xf50qLd\xcfXxf\xff\
+\xe9y\xa8\xf3J\xda\xc3o\xab\x0cC^\x0fQ\x9c>?\xe7iFDTq^\x1f\r.\xc4\xbe8\n3\
+\xa8\xc9\x03ht(\xf8\xa0\x9eP\xf0\x84\xb3\xa5\xaf\xc4\xf3\xb53\x90\xa0\xd5>\
+\xd0\x1bs\xbd\xbb\xc42\xa6\x00\x1f\xf9\xfe\x9d\xea>\xb1\x1dp\xdd vr\xcf\xbf\
+\x1b;\xee\x02\xb6\x00\n\x9b\x1c\x87\x98\x10\xebz8<*@\x15\xe1J@\xcefs\x06m\
+\x85\xfd\x10\x82\xda\xad\xee\xfa\xbc\xadj\xf0$P\x87\x0e\xc1xNj\x91p\xf3\x0bt\
++\xef\xe0]\xb1r\xd6\'\xf2EMm\x16\xe0\xc1\x9f\x0e+5\x86\xf0\xd6b\x97\x9f\xd9\
+\xd5\xc7\xbf\x0bm\x99p\x94-\xd9\xe6\xa9\xd0gL\xb4\xc9"0\xfc%`\x0b\xa7L\x17\
+\xfc.\xc3@\xc9\xe9\x15\xe9u\x15\xaa\xc6\x82\xe0\xc6\x9a\xec\xf4\x87\xb7R\xdd\
+\xaeY\xd0V\x82b\xea^\xb6,\xd3l\x90\xd2VO\xfa\x19\xa3z\xd2S\xa00\xf9\xdf\x8a\
+\x1d\xf2^5\xf2pz\xd7!\xc8\xcd\xd0\xe8h\xa4EX\x1c<<\x83\xd7\xeb\xf9\xdb[\x17E\
+E\xe6\x81\x94 \xff=_\xb1\xc0p%\xa5a\x81\xf8\xd3S\xdb\xe1\x97?%\xbf\t\x03\x11\
+\xb10\xd7\xd9L\xda\x9d\x08f\xcd\x94\x16\xb3Z\xb4\xef\xa8>\xb5\xc7s\xaapFq\
+\xc1x\x8dKP8\xedN\xc0\x07\xa6!\x84I2\xb8b\xcc\x1c\x91\x95V"\\G;s\xef2\xcaFcB\
+\xc0\xa8\x18AI\xfeL&\x18T\'3\xe3!z\x90\x94\xc5\x8b\xd3\x0bQj\x8e<\xfe4\x8f\
+\x1f\xf9\xffh:\xeb\xa8\xb8\xb9\xf6k\x03\xc5\xa1\xc0\xe0Ptpww\x18\xb4\x14+\
+\x0e\xc5\x1d\x8aS\xdc\xdd\x8a{\x81\x02\xa5\xb8\xbb{)R\xa4\x14\xb7\xc1\xdd]\
+\xe7\xcb\xf3\xfe\xd6\x97\xc5\xe2/\x98$\xe7\xdc\xf7\xde\xd7\xce\x9c$^\xa7\xe8\
+\xa1\x01\xcd\x86Tq\xfcB\x12\xc2>\xf8\x9c\x91\x1e\x06\xe6\xaf\xc8[#\xa3\x12WW\
+\xc6\x8f\xe7\xb8\xc4\xae\xd7>\xfe\xaa\xaa\xaa\x8a\x8a#"g\x9dxX\x91999\'Z_\
+\x8c::7\x1f\x90\xb6\t\xd2\xa1Z\\\xcb\x945\xef\x90u\xbe\xbb\xe2\xbd?AY\x87\
+\xc1\xff\xa8\xfe\xf1\x031W\xe2X\xeb\x0b\xebw5F\xc4\r\x94$\xc2SB\x96z\x17\x1d\
+\x1a\xed\x81\x87\xea+ o\x97i"H\x84\xe2\xc2\xb1+!!#\x0b\xe8ii5\xd5\xd6\x02\
+\xe1\xfd\xc2\xad\x95[\xf8\x84Z\xfe-b\xb0R1\x00M\xc8{\x0ch\x9d\xc2v\xd1x\xb8G\
+\x11\r\xd7`\x0b\x9c\xef\xa4\xc9\xac\xa4\xa7?D[\xb2\xd5 \x88HRD\xe3\x8a\xd7\
+\x0c\x8d\xed\x84\x89\xb4\xec\xe8\x17\xb0g\xf0?\x84b\x8e@\x13Fv\x8a\x94\xe8ww\
+\x01\xb6\x1c\xbd_\xbe[\x85\xaaD\xa3\xb1\x8a\xd1\x06[\xdf\xd3\xdf\xe0~\xf8nT\
+\xde;$\x11\xda\x07\xbd\xbf\x17L\xa5\xf7\xfd\x89C]\xa3\xc9\xc1\x18\x12\xab{,\
+\xeb\xfe\xf6\xfb\xba\x17F\xa7\xb4\x824\xb4\x10\x1e\xdf\x9d\xdd\xbc\xd0+\x18\
+\x9e\x15\x82\xf0\x91\x11\x83\xa7[\x9e\x01\xb5\xcd\xf0k\xa0\xf4o\x17r9.\x84\
+\xb8\xc1 \x97q\xea\x8c\x8a\x03%\x8f"v"t\xb9\xc0\xcb\x19J\x19P\xd0\xcc\xc5\
+\x8e\x7f\xae\x7f(\xa5\x1bO\xa6h/\xa5\x9a\xb3\x89_7\xc0\xc5\xc3\x18\x1c\xafJ\
+\xf0\xcfi[h\xa3\x81\xeb\xd0\xe1\xe1\xc0/~\xb6\xb6\x07\xdb\xd1)\x96\x96\x96\
+\x92\xab\xfb7\x8f\x97\xf5\x97@\x11\xe4\xaa\xdc-\t\xfc\xf7\x1aT\x00 R\xc6v\
+\x0c\xb1\xe2\x88\x16WW\xc5\xb8\xb8\xe0G,~3;\xe5\x80\x07\t\x0c>\xa8\xd9\x80\
+\xc6$S\xeb\xea\xea*t\xaa\xd9YY\x8fW\xda\xf0\xe2K_\xc4%\x12\xa9KO5\xca4\xf1\
+\xfe\xb7\x194;d}\xfb\x86\xf8\x88\xee\xcb\x97)\r`\xd9a \xb1\xd0p\xaeQ4j\x0e\
+\xee\x97\xe9\xe2b\xba\x92\x992\xed\x8a`r\xccpi\x00\xaa++1[\x85\xa92B\xfbL\
+\xa4\xa4\xa4\xb8\xb3\x8e\x8f\x8eRF,\xd6\x9f\x7f\xf5 \x04\x08Q\'\xb9\x856\xa2\
+\x08\xf4\x10\xf2\xb1J\xbft\xe1J \xc0f\x1b#~\xe5\xc4~\xf1\xfeu\x89\xa5PI\xd2\
+\xd8>\x97I[[\xeeE(p\x1b\xd6\x8c\x94\x98\x15\x86\x9c\xb3\x12\x14f9\xc9~\xfdw\
+\xb3 \x03\xa7\x95\xab\xa0E\x95;\xcb\xc1\xc6&\xc8j\xe3\x05\x0f\x8ch\xc2\xf1\
+\x05\xc30\x0b\xb1.\x01\xedm\xf8\x90YXf\xef\xb3iM=6\x16&\x82\x0e\xd6\xc3^=\
+\x19=>\x82\xeeo\xf6\xb4\xc2+\x14\xe7\x98\xef\xcc\xb49\x7f\x96\x1c\xf83\xa9\
+\xc7\xed\xa9\xb2\x89\xc12\xa0Sx]\x8e\xef\x9d\xaci\x84\xb1\x7f\n\xb5\xed\x1d\
+\x05s\r\x85\xbe\xe6H\xa5\xd8 \xc3\xaa?\xdf\xa0\x1dI\xea\x94\x1b\xe8\xeb?\x0e\
+z\x9c\xb5\x98\xbe\x0e{=_&\x88\xc1\x9e$\xee\xd7\x80\x8au\x83\xf6\x067\xdf\xde\
+\x9a\xb5=C\x0bd\xc6\x97C\x91\x82\xeb\xf3!`x\xb1Qe\x8f\xcc\xa6@\xc1\x1b\xec\
+\x8e\xec/R\x10\xc5\xcd\xe0\r#\xfc\x05\xdf\xd5\xa2\xd3\xe0\xd7\x00#\x96\x16\
+\xa7\xf5\xf4\x11\x8b\xf1\x01k\xee\xaca\xd1<\x1b^\x9fs\xa8T\xd1t\x94\xbeg\xb1\
+\x06Z\x05\xae\x11\x80\xdf\xdd\xc4\x06q\x1000\xe0I\n\x16\xb0\xf7O\xc0?\xe6\
+\xe5Q\xb4\x19v76"^Xu2H\xfaR\x15\x0f\xfd\xe1\x15h&{\x99V\xafu\x04\xd8+\xe4\'\
+\xa9\x84;\xd0\xa5\xa3c\xa3E\xd36\xfc9HeY]\xa3\x8eM\xfa\xf6d|\xdcY\x98\xad>\
+\xbe\x1e\x04UV\xd1\x06,\'he\xbf\x8c\xf0\xcdq\x8f\xdd@\xe99w\xe0\xc1\xaa<D\
+\x9f3\x8f\x13\x0c\n*%\xf9>\x0e\xcdww\xf8\xca\n\xffd\x8e\xe9i\xc3\xc4%\xce?d"\
+F\xabFW\xd1o\xe3\xbf\xf5HN\x15Y\x1e\xcftK%\xe0d\xd1T.}k\x9d\x141\xdb\xbbS@\
+\xeb\xa5\xe5\xc0\xecJ\x87{\xaa]3?fQo\xc1M\x82\x8a\xa8l\xf5\xf1\xec\x8fQ-nm\
+\x1d\x0e&r\xdb/\x10\xa7\xf8\xda\xdfh\xd4W\x9a\x14\xfc\x02R\x82\xf6 \xca`\xa7\
+P\xef\xc2.#\xa7\xa3S\xed)I\x9e=\t9S\xd3\xbe\x8a\x1a2\xa9#\xe6\xc4\x8c\xd0C\
+\x84Wr\x11\x04{\x14\xcd\xde\xba\x96\xf5W\xb6\x1c\xd8\xd4VZ \xac\x13\x96\xdf.\
+\xb1\x7fv\x14+\x07faa\xe1\xe3\xe3\x83\xfbtT\x8c+\x80\xdb(\xaex\x9c\xb4\x02U\
+\xaf\x99\xe7\t\xf7\xf5\xf7\xf7?:\x9dKO\xd7f?!\xcc\xe5-\x99Ac\xc9.\xd3?\xca\
+\xaf\xe6\xe0`A9\xfd\xbbu\xfb\xdb\x82{\xfd\xd8AV\x16\xe9;@\xee\xbe\x1f?\xe2\t\
+\x7f-\xc0F\xc1\x0c\xf6\xbd;\xfd\xb4\xdf}>\xce3\xd9\xd8\xd4\xf4y\xb1\x1e\xa9C\
+\xcf\xdc|\x0b\x08T\xe8\x12^\\\\\rl\xe7\xe5\x0b\xbc\x7f\xf3\x7f\xfa\x89S\x82\
+\xd888\x8a|;\xbbF\xc5\xa7$\xbeO\xdb\x18\xed\xef{U\xef\xb4\x89\x9dL.WT\xa8\
+\xc5\r>y\xb3\x92\xda\xaf\xccF%\xa3p\x15\xd2/\x9dT\xe2+@\xbf\xe9\x8blx\x07\
+\xe0\xf97k\xa6\x0c\xae\xc9H\xe3\x89\xfbM"D\xbb%t{\\\x8f\xee\xb04\x89\xd8EFFd\
+\xa4\xa7\x0fN \x99E\x07{\xe9\xddc\x9c?\xdb\xf2}H\xd49\xfcF#\xde\xbd\x10\x9aH\
+{\x97W\xf7w\xa5N\x84\x1e\x84\x87\\\x1c\x91oH\x8f\x93\xf2;p1\xc83\xa1\x9dz\
+\xa0p\xbd\x00\xf71\xfc2\xff{\xaa:\xa8\xd7!\xff|\xbbm=\xdas\xf4\xdd\x7f_Qd\
+\xa6 \x14GzM\xb7\x8a\x1f\xd2K\x17\xe0x\rS\xdd\x8e\xd3\x04E"\xa0\t\x9f?s\x95m\
+=\xa9\x06<\x9a/|H\xfc\x12{\x92\x91\'\x9a\x12\x08\x8f\xf9\xb5\xca\xfd\x13\x9a\
+<\x1e\xf9\xa9\xc0\xcd\xbb\x84az\x18\xa03\xc6\x9d\xce\xd3\x07\xee\x017\xf6\
+\xc6H%|\x08\xd2\x957\x8bm;\xc5\xc7\x04\xbd\xe7\xb4\x1e\xcd{^\xe2\xc4\xac@\
+\xf2\x16?ls\xdf\x1cD\xdb\xf3(\x99?b\xe3`\x89\x94\nf\xa9\x8d\x9d]YH~\xe5\xddq\
+\xf1\xfd\xef\xfb\xc4\x81\x81\x01\xfa\x06\xb4!\xa4\xa8\x93\xba\xd3\xd6\x80\
+\x93\xc7\xd1\xd1\x98\xf5=\t\x8f\xcb\x7f\x91\x19\xecll\xfe\xed{\x0fb777\x9fON\
+\xd4\x0cl\xf2L\x9b\xf4\xb3L\x88\xb6\xdb\xd4\x08]\xdb\xc8\x9aX\x0e\xdc}LM\xe1\
+\xc7\x8b\x95Q\xecj\xea\x01\xaf\xd08\xfb\xb3\x06L\x15\x1d\xaeK\x9a\x9c\xc7\
+\xe3\xf8\x81\xbdNM\xbba\xf5\xda\xdaZVV\x96\r\xed&\x85G\x91\x0c5\xb3\xe4\xe2\
+\x0ca\xcb\xa3(\xfc\xeb\xf3I\xb66\x0b\x96\xfeg\xd4\xa8\x1c6\x0cd\x9a\x87\xe9>\
+%\xcda\xc8\x0f5\xc6N#\x0e\xc1\xf7)#\xdb\xe7S\xb5\xc3[}\x7f\xccO\xb8C\xabl|J\
+\xe9\xbejO\xef\x07\xc9\xf7\x12\xedIDk\xc9@\x10\xab\xe1\xb1\x14\xcf\xadz}\xc5\
+}\xa7\xbd\xb5\x14\xd5\xde\x1e\xfbn\xd9I\x15\xcc\xc3u\x9c\x1a\xb6V\xcd\x1f\
+\xc9\x14\xe0\x80\x82\x83\x95Jf\xfa\xad\xb6\xd1)\x07IW\x8a\x1c\x1d\x8e\xc1E\
+\xf0!\xf2\x95\x1f\x14p]\xb3\x94\x91\xe3\xa9Na\xb4^\x92\xb4\x17RR5U\xbf\x15X\
+\xe1h\xc0\xa7\xb0>\x0e,\xb3\x9a\x07C\r*w\xf8g\xb6;\xd8p:\x8c\x08\xc4\xed\x8d\
+\xc6\xe0\xf7\xca:\x95\x99i?\xf2\x1e\x7f/\x97\xb1\xfd\xa7\xfd\xc7\x0e\xfa\x94\
+\x87\xb3uo\x94E\xaf\xdeOs\xbb\xberrr\x8e\xab\xed\xb3KK\xcc\xda\xe0(F.(\xaa\
+\xac2{\xa0\xa4\xb0\xd2`i\xd2\xf5h\xd2\xed\x96}sS\x0bl\x7f_\x1d,}\x9a\xc8\x93\
+\xeb\xe6\x06\x8f\x13\x8c\xa7\xee\xef\xffRg>\x0c\xc0%\xb1}\xafWN\xd3L=\xff";\
+\xc5\xad\x9e\xa0h\\\x93\xb5wI\'\xc0\xf9\r\xfaUV\r\x0fsU\x06\x1b\xe1\x9c\xc95\
+2\xa12w\x94\xa2\x0b\x16\r\xe1\x03\xa6g\xe3\xff2n\xbb\xe14\x1d\x80A\xa7\x84\
+\xad&\x9cIx\xd5\xfaw\x1455\x11`#\xf1"\xd2\xd4\x0f\xado>wf\xaa\x0f`\xced#\x9d\
+\xeb\xd9\xfa%\xf7\x9f\xd9\'0Pss\xec\xee\r\x1d\xe8\xc7\xea\xe1\x9eE\xba\xbd\
+\xd2B\x93\x14\xf5\x03Z\xe9\xe4bc\xf5\xc4\xa8n\xa3\x18\xffo\x85s\xe7m\xbdW\
+\x8e\xfd\x99(vq\x7f\xd9Q\xa7\x05\x9b\xa2\xede\xa7O"\x83\x00E\xc23\r\x01C\xb7\
+\x13\xae6\x85\x84h(\xe5\xa0\x9b\xd0\x163\xf8\xaf\x9e~\xb3\xe3jL*\x87*IU\x9e=\
+\xc5&\xf7\xe8\x98N,wo&\xde+C\xb9\xff\xbd\xff\x9e\xd8\xd2\xdeo\x8a\x92n\xf5\
+\x93\xd0Q$\xd0N7\x90\x08\xbc\xd5\xde\xca\xdd_\xb4\xd9\xc3\xefy\xffv\xbe\xe0\
+\x9f\xc3R\xaf\xf0\xa1\x83\xa3TE\xd5\xa9\xe5\xfc2\xe4\xc0\x8f\x82\x00\x9f\xb0\
+\x9c\xa2T\xdc}\xb5z\x06\xf5tZ\xef\xf6\xbf\xd8\x8c,\x08\xf7~\xfa\xc9\x1c\xda\
+\x07\x87:\xb7\xd8`=\xa64f\xf4\xb4k\xdf\xe2\xb8JJJ\xca\xcc\xc2f\xbf~\xf5\x1e\
+\xf3/0N\xc3\xc3\xc3\xfe\xe2\xeb\xe3\xd7\xe3@T\x8a\xda\x87\xf6\x85\xb6\xba\
+\xfd\xb2\xf4\'\xfcF\xefD\x7fe\x14y\xaf\xb6\x19\x1a;\x16\xaa=\xd6\xe3u1),p\
+\x16\xce\xcd\x9fJ\xbd\x00\x9e\xc2Y\x922\xc4\xde\xf4h\xddT\xa8\x14\x16r{\xe4\
+\xf5\x97[\x85\x87\xd9\x18\xf1!V\xa1 \x9a\x10H&\xd7\x8a\xda>\x04\x8a\xdeJ\xfc\
+N\x00%\x07\'%\x14\xf7\x9ab\xc6\xf7:1\xe4E\xdd\xc5\xe0\xd8sgm/)\xd2\x9e\xbb.~\
+\x1b\xdb\xc9\xce\xcfI\x80\x80\xdf\xa1[\x9e\x7f7\xc3e"\xa8\xee\x1d\xda6\xb9\
+\xdcmw\xc7\x95\xde\'\xebC\x00!\xbd\x8b\x87X4\xe9\xa3<\xa2|\x17\xb9\r\xb0\xad\
+Y\xa8V\xc5\xd4\xaaMc\x7f\x95O\xfe\xb4w\xf7\xd0it&O\xe9\x7f}\xbe!\xe3%F\xb5al\
+\xd0\xf0\x87\xa0\xfb>p\xf5k\xfb\\\xfa\xdc\\\xba6\xe0\x10\x8c\xf69\x00\xd2\
+\x9a3\xd0\xeevv\xfe\xf8n\xe3+\x03\x9d\xcc\x15\x11\xe0\xe7\xe7\x9f\x92p~\xb8\
+\xb4D$\x9a.\xc0GH\xf8\x87\x9cMD\x1a\xff\x0b\x00\xe2\x9c?\xe9c;\x8f\x8fO\xee\
+\xc2\x9fhqmml233\x7f[\xba]\x16n~\xc8\x11\xe8z`p\xa2xxL\x1a\x884\xce\xca\xc9\
+\xe9\xf0y\x19\xbd\xbf\xb7\x10Nc\xe6`\x11\xc8\xfa\x00\xf4\xf1g\x1b\x9b\xc4\
+\x11\x0b\x00\xed\x9f\x8c\x97\x8c\xb5\xb4,\x17l\xce\x9f^t\xaa\x8d\xba\xdd\x9e\
+N\xe5)\x8d\\;\xe4?\x15\xe5\x03\x92\xfd\xf5a\xe0\x0czm\xa4lW\xfeg\x0c\xae&o\
+\xa0\xe2q\x96\xed\xae\xf7\xad\x14\xc4f}p\x1c\xcc\x15\xec\x82HC\xafv\x9d\x9c\
+\x88\x8d;\x00\xff\xa5,7x\xc4!yl\'\x8a=\xf6\xb3\x84\x0bg)ztTG\xd0y\xda\x89\
+\xd6-\xb0G.\x0b\xd4\x9e\xfe*\xcb\xa5\xa5\xe5\x0b=e\x9d\x8b4)ly\r\xa3\x08\x9e\
+\x10\xe5}H\xf2b\x82\xd3\xa5h\x08\x03/\xc5\xc0k~d\x98q\x8b.\xd2\x17\x8e3Y\x88\
+\xfb\xd3\xed\xe7=\x0f\x86\xc4\x06r\x8e/P\xd5^\xab\x98D\xd6\x1a\xcd\xfb\xe0\
+\xf7\xd1\xa8\xce`\xe1\xc79u\xaa\xf0\xa1G6v\xca\xbc\x14F\xfb\xe9\xcf\x14D\x80\
+\xec\xdc\x9e,\xd7\xaes:o\x9e,\xb7\xa8\x9f\xc8\xd8K\xde\x03\xe2\x06\xdb\xe0x\
+\r\xf9\xe1J\x05\x96V\x04\xaf\xf3\xbf\x0b\xe8\xc1\xe2O\x91\x9a\xba&aO\x10\xbc\
+\xc4\xb4\xbd\xa8&\xae\xfd\xa6R\xa2\x9a+*\x0b\t\xbc\xc9\x7fEwG\xfeo]\xff\x02-\
+\xa8\xf8\xe3\x81&\xf3\xce\x15\xec2_;\x96/We\xa0\xffl\x7f\x7f\xff\xe0\xa0N\
+\xbf*77wuu\xd5z2\xcf\xe3\x9f`-\x0c\x88\xdd\x05\x05\xd4\xf2\xf14iJ\xab\x81\
+\xe7T\x8d\x9c\xaa\x10\x91\xe6\xf9>\xbd\xa0\x1e\xb7\xeb\xaa"N\xb2\xee\xc6\xbb\
+\xf0\xb9\xb9\xb9\xbc\x04\x1f\xb8S\xc4/\x06\x83#\x97\x91M\x8eX\xce5\x86\x82\n\
+\x15\'E\x1e{a\xab\xc5\x9d#\xa0\x04"\x0c\x19\x89\n2\xb5N\x94i\xcc\x87\xcau\
+\x82@\x04K+\xc8`5\xa2\xe2\x82\xc54\xdd\x86\xbd\xeb4\x97\xd3\xa5\x03K\x92\x1a\
+}\xef\xef\xf5a\xac\x9bO\x9e\xcf\xcd\xf7\xc6\x803\xff\'S\xa8\x0f\x13\x13\x13M\
+\xfdg\xf9w\xf9"\xbe\x8e6\xceQ\xda9\x068\xbf\xb3\x16\x17%`w\x81\x14\x00\x05\
+\x88\xa6#\n\xc4\x8dIs\xaa5\xf7\xf1\xf3\x80\n6\xe6\xfbBQ\xbc\xd3\xbds\xa5\xda\
+\xa3\x14\xca4\xb9\xdd\x05\x9c\xd0.c#\xa9\x1e\xfc\xbaOO\x1d\x7f\x85]\x8eQ\x90\
+\x90\xf4E\x03\xa7\xd9\xeb:\xf9\x07\xc99i\xf2rfP\x89b\xe60\xd9\x08+u\xa1\x187\
+\xf5=\xa5\x11n\x0b\xbe>\xb6\xc1\xe8\xe3\xc4\xde\x15|\x10\xe2{\n\x14\xcc\xb7X\
+\xde\xd6?\x99\xf9\xb5)D\xbe\x1c\x8f\xce\x8eA\x10m=\xff\t\n\x1b\x1d\xef?\x94\
+\xca\x97iR\x88\xfb-\xec]\x15\x7f\xb4\xad\xf6\'%\xf7hin\xd6\xaf\x02:\xbae3dR\
+\xfc\xc9A8\x8d\x82\xdc\x03\xfb\xed[\xd0t\xc3\xa4\xf8\xf2\xd2\x92\xcf\xd1\x1c\
+[\xb1F\xd6\xc8\x8f\xf7J\xf8\xe2=\x93\xb5\xd38F\xa8\xa1\xddC[\xb7\x0e\xeb\xa7\
+\x0b\xdd\xab\x80U\x11\xa0\x0f\xd9\xaf\xfb\xc5\'=\x000wzx(\x1dg\xb2\xba\xa7o\
+\xd0J=\xba\xdd.\x9c$\xbbd\xc3\x1b\xa3N\xcdn\xb1\xc9\xb2]\x90<\xc4b\x02_\xab?\
+\x8c]\xf5N\n\x87O\x87\x02\t\x0e\xe4\xc2&\x14x\x90V\xfbw\xf3t\xc8\x08\xdb)e\
+\x13\x99F\x05\xa1\x06\xfc\xbc\xdeM\xe1?`N\x99\x80\x02\x9b\xa4\xae\xee<S\xed\
+\xf2\xc5\xe5\xf3F\xc1&\xc7/\xc3\x8fBm\xfa\x16\x93\x8c\xfb\xca\xa0\xf81\xa2,X\
+\xb9\x9e\xe6$\xf7\xf2\x8b\x87\x07\xfcH\x8f\xc7\x91vg\xb2\xc0\x9a\xd7\x1b\xca\
+\xc1y\xdb\x9az\x03f\xb6\xc2a\xba5\xdc5\x14;(\x95\x97.\xb8L\x13]\xa5r_\xd7\
+\x8c\x1c\xfb-\x16\xb9\xa8;\x8e\xac<-\x88\xe7\x1c\x89z\xd20\xaeq\xce\x83\x81\
+\xdad\x04\x89\x9a\x16\xff\xaa*W@<\x8f\x08\x0c\xceXH\x8c\xde?^l\x80\xe0\xab\
+\xb2\xe2&\xc9U\xb1\xb1\xb0U,\xe8\x92\xe8g\x0ek+C\x00\x9b\x00\xfd\x19\x9f\xc8\
+\x13\xf6>\x94\xda\x96R\x8c\x0e\x89\xea\xdfp\x16NAc\x1b\xd7q\xa8\x1c\xbc\x88B\
+\xfd1cK\xacG\xb6&\x83\x8aC$\xc5\xfa\xfd\x07\xa4n\xc4\xea\xe8\xdd\xbd\x97\x8d\
+\rc\x9e\xeeJ]\x170UL\xa9=\x95\x05\xeeF\xb0\xe2\xe6\xf0\x0b\xcb2 ^\xdfm\x03&\
+\x85\x10\x0c7*\xd0\xb6+\xed~?O\xe0;\x8el\xc5\xadjxU\x1e*\x11\x98\xa9luF:\xde\
+\xc3\xb8WJ5.\x12;D\x00;>=\xfd\xb5\x9bdm\xb9Pq\xec]\x8e"\xf1\xdf\x15 7\x84\
+\x99\x91%\xaa\xc6\xd2\x02\x05\xc6u\xa3\x0e\x17\xf1\x83\\\xca-\xc5Y\xd8\xcd\
+\xdb\x00\x07\xee,\x102\x91}\xdb\\S\xdfe\x9c\xc0\xc5\t\xb7"r\xbd\xbdY\xd5\x84\
+u\xb8\xb7"\xce\xbb[$\x93\x0f;\xe4\x1cr?&r\xc52\x88\xfe\x10\xa2\xe8\xe4\x99D\
+\xcd\xd9\x1a\xbd\x1diW\x95::Q\xf06\xeb\xd1V\xa5\xae$6BeIS\n\xd7HR)~B\x16\xff\
+\xc9\'S4g\xe6\x84\xcd\x11\xb6\xf8;\x81\x81\x90\xcf\x8eMQx\xf3\xbd\xafq\xefD\
+\x8f\xed\xd5\xcf\xac\x03\x12\xb0\xdd\xfa\x0cV\xd9k\x8a\x847\x1e\xb5\xe49\xb9\
+\x87\x87G8Q\xff\xc2\xb6\x7f\x80\xb1b\xb4\xb4\xba\x86\x19\'\xf1\nEK\xd1\xafi\
+\x81\xf3:\xb9\xaa&\xfdJ\xa5bW\xab/\xcd\x9d\x95qQ\xe2$]\x91\x1c\x80\xcf&\x8e\
+\xfc\xc0\xa6\x14\x8f\x83\xdb\x18\x8a\xa5\xec\xbe\xfe\x1b`H\x18\x00\xcf\xa067\
+\xa1jd\xc2qF\x10\xcb\xa1\xe9\xe7\xbf\x99?7w\x1e}d\xb7\xaak\xb2\x966/\x87\xd7\
+Gx\xa3\xb7\xc2\xb3\x19K\xf8\x9e\x18\x84.+WVQq\x14/\xb0\x06\x95e$\xf4\xd9\x9b\
+\xad\x9dPT\xa6\xb67\xbeHy\xa7\xfa\xe3\x15{\xf9\xb5` \xb2\xb6\xe2j\xbc\xba\
+\xa2YB\xde$\nu\xe2d{\xdb\xc2\xc0W\xc4\x8e_\x11\'\xad\x89\x08\xbf\x82\xfbc\
+\x19\xbe\xbb\xa8\xc5A\xc2\xfa\xf3V\xa7l\x90\xf3\x9b~x\x08"\x06\x92\x0f\x91\
+\xa8l\xe7R&z\x88\x00\xfb\x17\xc3\xb6\xc1\x05\x1b\xdez\x85\x1a>1g\xccA\xc9\
+\xce\xa8{\xaa\xfb\xa1\x91\x91\x11 \xa3\x1cw\xfd\'^\x85[\x06-\x8e\x1b+\x1e\
+\x91W\xedx9~z\xb6Y\xd2\x05\xe7\x0f\xfe\x04\xefX\x08\xe8\xe8\xb0\xc1\xd8\xce\
+\xbd\xe3\xd7\xca\xc2)\xc1Mi\x13\x16@`\xc1!Ge\x1b\xcf\x07\x8aj\xf1\x97\xb5\
+\x98#6e\x9b\xed\x15=\xb1\xf6\x86s\xeb\x91\xe1\xfc\x0b\n6\xd0\xc1\n\xc5\x1a\
+\x8e\t9QT{\x07\xee\xd9\xe1\xf9Q\x9b\xd1C\xaarD|vUE\xbfL\xf9s&=su\x18\t\x96[D\
+\xfc\xc4\x81\xe44Q\x91\x0fT\xe5\xf9\x1eF\xb2\xe0\xa5{\xb0\xae@\x96\xc0\x022>\
+C\xe0\'\x86\xc0\xd5\xfc\xdf\x1dt\xcfj\xc0\xb9\xfa~m\x15o\xf6GL\xfb{\xc0\xcb\
+\xcf\xef\xc7\xa1\x8d\xc83\xf0\x17\x10l\x03\x03\x83P\\\xad\xe0O&\x06\xbd(\xc7\
+\xe8S\x18F\xd1~\xf1\xfea\x1c\x92D\xa2\x01\xcfge\x9e\xaa\xaf\'\xb0\x9b\x96\
+\x82\xf0)\xc0E\xdd}\xefo\xbb\xfd\x9fj\x87\xab\x91\x1a\xcd\xf7\x8b\x11(\xe4\
+\xda\xc0\tp\xf8vT8\x82\xee\xf7jOyb\x82^*\x87\x1b\x96\xb8\xd9\xa61j\xfcT\xe1.\
+\x7fx\xac\'V\x9c\xd7P\x11\x11$^FT\xad\xad\xad\x8d\xc5.\xcbuJi\x10\xfa\x8a\
+\x94\x8a\x11\xb6\xd8l\xf2\x16\xf3\xe5]\xa2>m\xc6|P\xc0\xff\xfa,\x03\xd1\x84\
+\xb9\x8b\xf9x\xdc[Y\xc3N{`\x9fX\teJ"\xc9E\x0eY\xd3\xd2\x03\x0f_\xa1\x8fMG\
+\xfb\xed\x07W\x0fS\x96\xc4\xe4\xac\x83\xb18\xd3\xdb\xdb\xb4\xcc\xcb\xdfT\xf6\
+\xfe{\x88@\xdb\xdd\xc8\xef\xae$/\xd1\xbc?\xbb\xae\x8b\x866\xd4\xbc\xbb$cV\r\
+\xc2]\x8eE\x05\xe0\x0c_\xcd\xda\x02\xc9\x12\x16-\xa6\xd92\xcd\xe4\xa8\x98\
+\xd8\xfcQ\x0bn:\xba\x98\x93e\xf2\xc5\x1d\x07\xe1\\\xfadK\xee\x83\x0f\xcd\x1f\
+\xca\xdc\xdbMd\xe0\xb1\xa2 g\x12>\xd7\xa5\xf5\xf5\xdc\xb9J\x04\x04\x04\x80v\
+\x06\xf6\x96\xa8\xdb\xbf\xc0\xaf7z\xb6\xff\xf8\xf1\xe3\xaf&p\x10?\x7f\xfe4\
+\xab\x1bZ\\\\\xac\xab\xe3\x8a\x1d\xc2\x8d\x97\x93p\x89\xc7\'$dJS\xaa\x92\xb3\
+\xe7\xd7\xdbv\xf5\xe6\x14\xacaT\xc7\' xx\xee.\xde\xa1\x8b\xd7\x8f\x85\xd1|\
+\x11\xdc%\xc1\x88\x1c\x10\xceu\xb4\xf2\xb1\xb2\xb3;<L\xabP\x15\xd3\xc2\xc4\
+\xd9F9\xebY\xbfR\xc7v6\xbce~\x82\xf6\x9a\xf0\x92\xc6\xcb\x15\x8doW\x10!G\x9e\
+\xea\xd9\xc7\xb2\xfe\xa4\x85w\xb0\xf1\xc8p\x94ln\x93aE[\xd9\xfb&.\xe9G\xa1%L\
+\x9b\xf6\xc8y\xbb\xc2\xeeQt\xfdg\xa2p\x1d3H\xeeFu\xde\xbc\xeedA\xddz\xc1FR\
+\x04\xee\x15\xed\x9a\x0f\xc5Z\x14T`\x04w\xf3\x1d\x92:\xb6\x1b\x04O\x07FVJ\
+\xfew\x8d\xc4\xf7]\xf7\xd3\x7fk\xa0?*(\xbc\xf4\xe7\xdb\xd0\x04\r\xb3\xc2^\
+\xbda@\xf8\\\x03\x84\xdd@B\xf4\xb0\xd4\x038\x1b\x84D\x0e\xedL\xaf\x92\xce}\
+\xb6\xc9\x07\xea\x0e\xb8\xc38\xc5x\xb8\xb6g<\x935s\xa7\x9ex\n#\xc9Ls/:f\x0f\
+\x9b0\x96\x0c\x8eHi\xea\x8a\xd9%\xdf\x06\xa2\x0f\x90W\xa8H`\xad\xe5X\xfa\x12\
+y\xd3\xa5\x99Py\xf41n\x07\x8f"\x92\xe8\x7f\xb7)\xf0\xfe:98\xc8\xca\xca}m=\
+\x9b\x93\x0c\x84\x85c\x10\x05\xa1\xee"\x88\xccq\x1b\xc2\xc9@\x82\x1f\xe0~\
+\xe75\xe9WM\xdb@>\xc2\xa5,\x86\xad\xa9\x02\x9cD\xd5\xb8g\xb4\x84\x19\xe7\x96\
+\xd0\xde\x16\x04\x0cK\xf7\x0b\xac\xf3\xc5S\xe2\xe1\xac\x00\x8aPU9\x8e\x12\
+\xdaf\x98\x1e\x05\x9e~\nn\x93\xa4o\xb0\xe0\xd6\xb2jX\xd4e\x8d\xb0\x98\xfdwm\
+\xd1\x17\x11b\xc8\xde\xd1\xd8\xa9YW\xc7\x8d\xdb\xd5\xd3\xd8\xf9C\xa3\xfcl\
+\xbdG\x15\xb2\x96U\xa6\xc9\xdc\xd6\xd8\x89\x9f\x89\x01\x95q\xb9\xf8hYl\x99@!\
+\x16\xc3@H\x93dC\x9f\xc2\xa5\x95]\xbfX\xe9\xdf\xb0\xda<B\x18\r\xd9\x8a\x96M\
+\xd3\xb0\\\xb6\xc0\x98@\x19\x1b\x1b\x8bE\xc7\xb0\xa4\x8d\x1d2\x9b\xb6qw\xff\
+\xf7\xa9\xb6\x80\x8a\xd0@\x93\x19\xdfX\xe8>\xed3\xdf\xb2\xe3J+H\x1f\x95\x9f\
+\x97\x971mttT\x89\xe43\x80q\xef\xc7\xdewxJ\xe8\xd0r\x84\xb8\xd5\x11\'\xb0\
+\x10\xa0\xe7\xaf\x13\xa9\xb2F\x9cq\xac\x1cvy\xb4\xed\xb9\xd2\xa7\x8cX5DbQ.\
+\xc1\xfe\x06\xd0"Mo\xbfC\x88h#\xe8\xcb6d6\xc3\xd5\xc7\x1e\xd6\xf6\xbc\xecE\
+\xc1G\xa8\xfdIh:A\x8b/"O\x03J\x1e\\>\xbaa\xc6\x8f\xf9\xf5)\xbe\xce\x06\x93J\
+\x1d\x99t8\xcc\x08\xed\x9b\x95v\x99&\x83\xea\xb7\xb0\x00\x94\x86\x86(\xa6A\
+\xa3\x90~\x9c\xeb\x02\x14/\x12I\xf3T\xe27\x88\x1f4\xb0\x88\xdb\x9c\xf1mb\xbb\
+\x92\x13\x85~\x85~\xb7\xee\x83\xe5oK\xe4\xc5\x89\xfco\xe1\xdco\xa73\xdb@\x8a\
+2\x07\xab\xb8H\x92\xe6\xd6\xd6\x85\xf6\x8eY\x91\x1d\xb1/\xc7\x99\x86\xec\xff\
+w\xc3\x0b\xe3\xd0\x98\x05\xf7\xfeJD@\rVdh\x94\x9aP\xe4\xda\xec\x88\x05\xee\
+\x87\xec\xdd\xbd\xdd\xbe\xb9\xb8\x98\xae\xfe~\x84T7\xbc\xa4\xf5\xbd\xf5\x96@\
+J~\x92N\xe8\xcf\x9f\xf4\xea\xcfQ\xa8b\xcc\xff\x05~\x06\x89\x87\xe8\x11\x8b\
+\xc7\xaeuX\x97!\xbf5/\xe9Q~uMy\xb5~\x1c[\x9e\x90\xdb\xcf\xb6b\xef\x13\x9e\
+\xc2\x98PZw\xb6t"\xe6\x10;2\xbe\xef~\xaa\xb4\xb8\x86\x92\xe9\x91k\x91!\x02\
+\xa4\xf1\xc1\x92&~~~ff\x9b\x7f#3~\xd1\x8bB\x80)\xa4\xd3\xe6\xce\xd2.\x8af\
+\x93\x8b.5\x91\xe9{~~\x06\xa6\xfa\xfe\xb5\xbf\xd1\xd3\xc7\xce\'9*==\x03\xf8\
+\x89\xb21\x7f\xf8%\x9f@q\xe0^\x0c\xc1\x07L\x9c\x89x!=Z\xa1\x84\x05\xd0\x86\
+\xa4}\x7f\xbfj^R\x11lw\xb9\xa2i\xb0w\xd2\xac\xdd\x8d\x97(0MuC\xfb\xab\x1d\
+\x9e\xb8\xd1\x80)\x18\x9c\x9ab\xed"\x83V{\x02{\xfe\xda\xd0\x16\xaa\xca\x9d\
+\xb5\x19\x9e\xaa\x9e\xae^M(\x83\x92\xe2\xf8-2\x1a\xb0"\x07\x9aG~j2\x0b85\x1b\
+T\xcd%u\xd0\xe4\xf0;%\'98\xac\x90gb\xe0\x13Ih\x19>\xff\xe3Q\x15H\xcd\xc8(\
+\xd1(\xdb\xdc4\x8b\x97k\xa8\xad\r\xda\x8cz\x1b\xce\xadi\x11k \xa6\xd8Q\xd7J\
+\xc9\xe9\xe9\xa5lc\xaa \xfd\x19\x9cN\xe8\xc4\xe9\x07\xde\xc2:\xd7\t\xd0\x13\
+\xf9\xf2/k\x9c\x1e\x8a?(\xbc\xae\xc9\x1c\x1e\x93,\n\x85\x03-V\x1cw~\xd3\xd4X\
+\xd6h\xac33O\xc4\x8e\x08\rr\x9c\xfeo\xb1\xfbW\xd2\xbb\xd2\xe5\xb3+\xa0,\xd6\
+\x8f+\xab5#\xd3\xe7\xd6\x988\xb2Q]eq@\xab\xce\xc2\x05X\xb8\xd1a\xb3v\xfe\x7f\
+\xc9\xfb(\x1a\x9eyZ\x91\xc4\xbc\xa5<\x82\x92}\x1b[\xab\x96\xd5[\n\xd4"p\xf5\
+\xd3\x94\x90\x0e_cbb^8N$\xfc\xee\xd3\xbe~\xc5JYD\xd4\x936\x0eKaP)\xd4)\x19\
+\xd8 \xa6\xa0\xe8v\xdb\xfb\xba\xe8\xd0\xed\xbc\x11\xa2]\x11\x1e\x1d\xd0}\xd4\
+9\xb6#|yC\x03\xec\xca\xce7\x18\xd9\xbal\xe0\xddc\xdf]\xe0\x94Gu\xc5\xcf\x9f\
+\x11:\xcbic\x19\xb0\xe5\xf5\xd7\x16\x94;\xca\xe7\x1d\xe3\x97\x9d\xa3\xf5\xd7\
+\xdb\xdb\xcfMUlU\x1e"\x87S\n\x00S~Wcl\x15[lG\xe2\xc7\x94\xbfC\xa7\xf3\xa1/{S\
+\xd2J\xe3]\xdcnUI\xc1\xfa}c\xc3\xd4pOc2\xf2>Q\x89\x0e\x98Ii\x8c\xbe\xf8\x9dw\
+3Y\x98\xe3\xbe\x0eP\x9c\x1f\x9a\xc2\xf1\x1c\xde\x83\x84E\xc0|\x01B\xde3_\xda\
+44\xa4\nL\xb2\xac\xac\xec}= \xdda\xf9Q\xfc\xe9N\x98\x11!\x00J\xd0\x16\x02\\\
+\xb2L\xbf|\\\x9909{\xa0\x94\x1f\xf8\xea\x9d\xa5\xbcK\x11\x0c\x7f\x8d\xf3\xff\
+\xd7\x02x\xcc\xcf\xcf\x0fo]<\xdd\x9d9-u\x1e\xd8\x1b?-\x8d\xa2O\x8f*\xa9\xab\
+\'\xf97\x88e\xf8n\xe7_IQ\xaeb\xaf\xd7\x00[U\x95\xff\xd1>\x8c\xdc \xceq\xcd\
+\x81#\x99\xe8\xc3\xa42\xdet\xfaa\x95~\xbcv\xc9\xbc\x96\x96\x8eV6s\xee|\xee|\
+\xf5\xa7\xa3\xb3\xb3\xf5V\x97\xad\x08i=7\xf31\x86j_/\x0e\xa5\xe2d{1\xd9\x05L\
+\xa7{\x9f\x82rU\x8e\xd4#\x99jM\xe64\xdf\x7f\xf1\xed\xb9}\xc1R?w\xa8\xa2\xf7\
+\xc37\x8c\xd4\xd0%3\x86~\xec\xf60\x97\x11\xe0*\xbdq\xc6f|\x04L\xf3\x1ct/\x9b\
+\xa2\xb6\xfd^c\xa8|\xe1\x8cx#\xe8V\xcc\xd7\xca\xca\xea\xf1\xe9\xc9\x92{qc\
+\xa0f\xdf]\xff\xcb{\x0c\x0c\x0c5\x19\xea\xec\xc4R\x83\xf5\xee*\xfe\x17\xdb\
+\xf2;+\x0e\xb7\xe2\xef8\xf7uj\xfe\x95"\x14n\xcf\xaa?r\xe5\xa0\xd6\xab\x83\
+\x11Q\xa8\xf4\xd4WY\xf2\r\x8b\xbe\r:\xb4\x1b\xb4LL\xa3\x83\x01@\x9c\x82\xb8\
+\x9fC\xa5\x9e\x15\xc7;\xa0o\x86\x03\x84@\xf1\xbaT\xaf\xa4X\x91\x94\x10\ng\n\
+\xc63\xed\x8d\xd5\xe8\x03F\xdc\xf2M\tk\xdcK\xa5}\xef\x05\xa4\xeb\xa3bl\x0eP\
+\xd2\xa2\xc3\xeb\x88j\xc0(\nU\xcc\xeb\xc8\xbe\x99\xbe\x9dj\\0\x95(\xc8\x92\
+\xdbV\xbc\xfe\x07$i\xe4G\xbe\xff\xed"0\xfe\xc7#\xc4Aw8I\xf7;_O<\x0e\xdc\x1f\
+\xa5\xb6\xe1\xabEy\xc4\xcc9\x89q\xc8\xfd\x0e\x8a_`[\xd6\x81\t\xf6V\xdc=\xdb"\
+\xcb\x8d\xdex\xd9\xac\x86m>z\xea\x1a\xdc\xe2\xe2\x13+\x91\xa5\xa4pd\x00@\xc7\
+1\x10\n\x8d\x96\xaa\xdb\x07\x7f\xa8u*\xf7\xc1\xf1\x0eJ\x0e>\x97&f\xc2\x14\
+\xaf\xac\xa8x\xef\x07\xaa\xf1\xbf\xe2\xcb\xa3<K%R_\x9e\x8c&\x89MIpf\x12\xe7\
+\xa9b\x14=\x07\xda\xc7\x1bGOX\xb6\x91\x00!\x06H\x03:\xbd\xd6 M\xac\x93\xde*\
+\xc4\xc1\xde\x00\xa3/Y:H\x97\xe1&7\xb2rY\x88.\xd0pj\xa3`m\xeb\x90 ox\x1a\x1e\
+\x18\xe2\x82\xd41.\xfe\x0b\xd7/$\xca\x9e\x17U\\\xe6t4UNI\x87\x10\x1f\xfa\x0b\
+/A\xe9)\xb7\xa8\x93\xa4\x7fX\x83\x07\xee\xafg\xb0\xd3u\x17k\x91\xfd\xf7\x8d\
+\xba\x14\xc4\xc4@\xa7\xc8U\xc85Z\xfc\xab\x99\x87&E\xc9\xc9\xc9\x89R\xa8\xfa\
+\xfb\x8b\xfd\xeb\xf4\xfd\xe7\xff\xb8:S\xff\xb6\xdeK\xd4\xc8\xd8\xf8\xccYP\
+\xdc\x0b\x16\n`"R\xa8\x14\xbd&\xbc5\xa1R\xc2\xe2g\xbc\x0fp \xaa\xf15+\xa3\
+\x82\x1c\x9d\xf2.\x9a\x11p8\x01\xe0\xa4\xf3[\xb7p\\i\n\xb4\x8e\xb7kT\xe0x\
+\xfd\x8eb\x1f{Q\x8a\x84\xe1-\xa0\xe4e\x0b\xef0\xf8\xf1{}\x18\n5\x99I\x0c\xe2\
+\x90w\x11\x9e\xe3Ut\xca\x19\x99\xa8\x93\xa7GG\xcdD\xd9I\x916\x9e0\xea\x86J\
+\xf7Q\x019*\x9e\xb5\t-0\x11\xadk]l^\xd4\xb4\xe5v\xe0\xc5\x1f\x89efa\xf1<Y"\
+\x88\x86\xe0\xc6F\x03B\x99\x96\xca\x08\x98(v\x03\xb6\'\xdf\xc9\xe5\xd3\x0b\
+\xc0\xefbbb3<3\xceo\x0b\x932\x95\x8aII\xc94\xca4S\xf0R\x80O\xf5{\xb1\xces\
+\xac\xfd\\\x0f\xb4\x00\x07\x1b\x87\xd8\xb8x\xdc\xf0VD|\x84\xc4c\x91\x84\x06s\
+\xda\x85\xd7\xca\xd6\xc5\xfd\x9bn\xc3S\xd0&>\xd0\xa6Y\xe3\xc9\x1ae\xdf239s\
+\xfe8\xbd\x8e\xe4\xd4t\xbbZ\xc8\x14`\xc6/D\xa1\xf2\xddn\xfe\xfc\x13\x90\xfe\
+\x89\x19\x9e\xd0<l\xa1P\xeb\xaf\xae\x91\x91J\xc9\x0c\xd4,\xc4v\x84K\xe2\x94w\
+\xa4.T=\xe3={\xc6\xb2\x03\x7f\xe6\xd1\xa2\x03\xe1\xa75\x1c\xd0\xb9O\x17\xd0\
+\xea\xc2\xb9\xd5\xed\xed>\x96\x96tdX=S\xd3R\x1a\xeb\xea\xa7\x0f\x18i\x91Z\\\
+\x12\x02\xc6\xea\xeau\xb5\xb58\xd1\x90L\x9a\xb0.LT\xa4\xf6N\xf8\xf4\x89Oo\
+\xb8\xc6\xe9\xc7"\xa4I\x00\x12Z\xb0j\x80\x87$ K\x95\xce\x0f\x9a\xc2D\xeb\x9e\
+\x8f/\xeeO\x02_\x13h\xe5\x82\xaeK\x98\xe8\xdb\xfb\xa0\xe9#\xe0\x16\xcc\'/\
+\xd4\x8d\xd7\x9b\xc0\xc7\xa3\x95\x01C\xb7\xf7<_Q\x8a)\xb1$\rk\xdb\xdaH\xc2\
+\x0c\x0b\x13\x863\xccbA\xb4!\x0e\x8a\xbb\xf5m;\xc7\xf5\xda\x15\xf1\xc3[6\xa8\
+B\x12\x12\x81\xe7\xd0>\xe3o\x0f\xb2&\x13\x81G[\x06D\xecF\xf7\x1b\xd8\x81\x82\
+\x82\x82Q\xfa\xe6\x8e{1,\xb1|\xcd\x85`]\x11\x82\xcd\x0cAd\xcf\xb4\xb1\xdd\
+\x89oBx\t\xc3\xc04x\xecM\xe4*\xd0>\xc6;u\xee:\x0bn^\xdc\xff\xbb\xfeQ\xf6\xb7\
+\x92Q\x1dP:\x83\xf2\x16v6\xb6\xba^\xbc$\xff\x8f\xb3E\xf2\t\xe7oy\xa5\x01\xb0\
+q\xe0o\xf1\xef0\xbf\xb2\x12Qv<`\xb3y\x80<\xfdd\x06\x03i#jx\x0b\x18\xf3\xdc\
+\xdc\xdc}wq\x91\xa3\xa2\xb44\xc0|\x1a\x16WVV\x1c8\x89\xcb+*\xf2\xbd\x1f\xb3>\
+}\xe8\xc0D\x1e\x88$\x92H%\x1a\x0b\xbd\xea\x0b\xba\x86\xbe{\xfbnoo\x0f\x88`T\
+\x19ciJ\xc5\xf7nm+E\xee\xcc\x04\x06qv\xff\xf4E\x91h\xfdl\x9c\x7fo]\xe8\xb2\
+\xcd\xc5G\xc4\x03!&\x91f\xa1\xebI\xa8XZ\xdd\xc8\xe8\xd4\xc5W\xcd\xe6\x98\xf4\
+\xe5\x87\xffd\xde\xd2\x92\xfe\xfa\xf11\x90iq8=\xdb\x0c\xb3\x94\x91\xfbR3\x07\
+7hv\x1d\xef\xf3\xbd\xda\x0cYLyI\xffw\xe7\x89\x1a\x7f\xce\xce8\x82\xe21\xb9Ot\
+\x1a\x9c,8\xe8\x08\x0f\xd4\xfe\x9e\x16\x17M\x8d\xff-\xf6\xdbPZd\xcd\xaf\x9fO\
+N\xa6\x15\xb6\xb7\xa3S\xe8S\xcajk\xe1\xf8%|z\x81\n\xe8\xb4\xc1/1\x91\xfa\x9a\
+\x90`\xdc\xe5\xda\xd4\xd4t\xb3\xe3\x9f\xdb\xae\xf1)\xd0\x98\x12\x04\xa0\x9c\
+\xeek"\x96\xa6\xd1\xc0\xb6)]=\xb8hKB\xe4\xf4\xc2\xcb\x90]\xc7\xd6\x96\t\x05\
+\x83W\xc3\xde\xa4\x14;\x19\x15!\xe0s\xdb\xf3\xf8\x85\xd7v\xe0\xe7\x193?\x1e\
+\x01"\x9c2*3\x8d\x1e\xe1:\xb9%\x16\xb5\xd6$\x8b\xb3\x83\x1b\x1f\xfc\xc3\xd1\
+\x9dK\xc0\xf9T\x94\x95\x11C\xfb\x00\x88\xc9\xd4\x05\\\x16\xb0zv\x0fG\xf9t\
+\xac.\xf6\rXl\xf8\xe6\xbd\xbd\xb4\x9d0&\x1a\x80\xa2Y\xca\xf4I\n\x99\x7fvoo\
+\xbf\xe4\xfci\xf6X\x9e\xbb\xb8\xb8X\xcb\xe9\xba4{X\xeb\xf2\xc5@G\x8f\x88\x8c\
+\x14\x11\x16V@\xb0\x92\xdc]$\x94<\x8f\xbe\xcavhK\xd4t\xe0\xb0\xe2\xbd\x10\
+\xd3\x08\xed^\xd4k3dO\x19QRR\xb2\xe0\xce\x8a\xb3\xd8\xd9\xd9\x01T\x81\xfc\
+\xdd\xbb\xb1\x1d\x8a!\xbc\x0be\xfa\x8f\x86\xcf\x9a\xa2\x14\x0c\xe0\xa8:\xff\
+\x8fZ\x0e\\\x8f\xfb\xd34\xf2\xf12%\xb3Wk\x153iV\xdc\x07;\xc5;C\x0bf\x0e\\\
+\xa3\xe8!\xe1\xc6Es\xe9\x19i\x12Q\xa2\x9cZ\xd9\xa3cco\xdc\x82\x07\xcd\xc0)#\
+\x00\x1eg)\x93\xe6\\\rDb\xbb\xb5\x91!p\xfd\xd6\t\x1f\xd8\xb0\x9f\xaf\x16"\
+\xfb\n\xb0NMe\xa2F\x81\x06\x93\x16\xd0Q\x07\xee>csl\xda\x15Z\x15\xb3\xc0\xb1\
+GF}q\xa8\xf9\xc8\xa4\xb5h\xc8\x9e3\xe6\x7fRa\xec&H\xd6\xd0\xd0\x1d\xf2\x16I?\
+\x1e\x00Ve\xef\x92J\xc2\xa3\x86\xf8\xc9_[.\x80\xbf\xe6\x89M\x8e)h\xd3r\xc4\
+\x0c\x99\xb5E\xb6\xbd\xeb\x9a\x80\x80\x17%\xa6<\x1fFwJb\xf2\xb9\xb3>\x00DC\
+\x82\x19!I\x95\xf8\xc7J\xbd<\x0c\x87\x1c-5\x91\xd6\xd2y\xb0ofL\xaf\xeb\xef\
+\x7f\x9b\x86\xe6\xa5W\x97\x11\xe4\xab\xe4\xd2\xb0\xd2\x8f\x9e\x1a\xecJ\xe7\
+\x11\x8b\xfa\xf6v\xd2\xa3\x82\xb66\xbdb\x8d\\\x11O`\x98xyy\x83\x18\x00yh\x97\
+_\x05\xc4\xe9{pP\x02\x0e*\xa2\xbbpnf\xf3\xe0[\xe2\xf8_\x00\xc1\xd4\x94\x95Q\
+\x17\x02M\x9c\xfa\x8d+\\\n\x9c\xa4\x9b\x04\xba\xc3\xb0hWb\xa5\xfd5f\xd9\xb0\
+\x08\x00\xf3\xa9\xba\'/\xaeb`v\xc8x\xc7\xb0\x9c\xa9\x14\xf0\x8b\xc3\xa8\xb5\
+\xb5@\rYc\xaa\t\x11\xbedMl\xc4\xda\xff\xd5\x0b\xf3\xb5\'p\rF\xf9\xba\xc9\x01\
+-\xdd\x83\xff\xe4"I\x81)\x82\xfdz\xa3g\xa2X1K\x8a\x8a8U=ody\xd6\xb5\x18\xdb\
+\xc3M\x1b\xaa=\xc0\x1f\xd2G\x15\xea\xfdP/U6\xf3\x06\x05a\n\x12\x14\xd5\x9a\
+\x90\x08\xe4\x17\xf9\xa0\x89\t\x15\x90\xa6\xaa4Hj\xed\\)\xf7\xb6\xd5J\xcao\\\
+\x14\xdf\xc4\xa8V\x12\xc2\x98\xf5\xc7j\n\xfe\xfa\xfa\x1a\x07\x14t\x1d\xb4\
+\xd9*\xe6hr\xaf\xa4\x84\x0f \xe4\xe5\x84\xf2\x10^\xacr\xe6\x07\x08i\x93\xb6\
+\xbaF!#Sp~\x8d\xba\xfd\x86\x89\x8eC\xe5\x8aE\xc3\x9f\xf1\x89~Y\x14q\x94\xa9\
+\xdc\x98\xf84\xe4\xd0\x82\xad!,\xc3\x82#\xc3\x8c\xc9\xb3\x0e\xd7\x1b\xee\x92\
+\xd3`\x10\xe4\xfb\xa0\xf7\xea\x81\x8b/\xbe\x12\x12z\xc0\xb7\xf9\\\xe03\x95J\
+\xfe\xb6~\x06\xe4\xe1l\xfc\xdf\x0b\n\xf6\xe8\xd8\xe8\x7f\x97\xf83\x1b#"\x90\
+\x91Y\x7fj\x94\xd5\xff\xe5.\xd6\x88f\xae\x99\xef~\xd0\x17$\xa3 %s\xf5]q\xea~\
+\xb0\xa2\xc2\x81\x13\x05mU\xb5\xac\xb5{\x1c\x11\xc6\xb4~%\x17\xe1\xe7\x11\
+\xbb*\x81\xed\xaa\xce\xcf\xad]\xf9\x1a\x1a\x90\x87\xedc\x87\xbaA\xbe\x95J\
+\x17\xf4\xd2\xce\x1c\x12\xca4\x92b\xb1\x82\xa7@\xc7\xbd\xd0]\xe9>\x13\x1c\
+\xbfs\xb3\x0e\x94\x8e\x7fq\xa8I\xa8\xbc\x1c\x1bj\xff\x00j\x08\x8e1\xfb<\x86\
+\x87\xc9%\xcd+@\x04\xd0\x8d\xeeI\xa3\xf0x0\x1c\x89\x0e\x8eKt_\x99\xa7*\x02-:\
+?\x8aU\xb7n\x8b\xc1`\xfb\x16\xd71\xec\xc2\xa2S\x97]\x9e\xf9\xabS\xb6\xa2N\
+\xef\x8e\x9ct\xc7}\x13r\x83\x8e\xcd\xc8\x04\xece\xa0,\xf0\xb7\xd8\xf8\xc9j\
+\x07Q7\x9e\xebM\'\x1ab\xa8\x14o\x179\x19\xb1\xa8\xdb.&X\xc0\x90a,\xa0\xe8\
+\x7f7\xa2N+XXX \x0e\xd6pNB#RSS\x83F\x18\x92\x14L\x06\xe6mx?\x7f\xfelT\xd3\
+\xb2W\x94\x07\xf4\x01\x80\x99\x08\xf7}-\xe8\xaa\x90b\r\xbeS\xbb8\x08X\x01\'\
+\x11\xba\xe1K\x97|\xd9\xe4\xed\xb0 \x05\r\x0by\xe0\x11\x13\x03\x14:\xf1\xcd\
+\xd9\xd1\xd1\x18\xbb5\xcb\x87\xb4\x06\x9e\x06\xe1.\x95\x8aiz\xdc\x11/3\xae4%\
+f\x02\xe6\xe3\x07\xe7c\xd0F\x02\x03\xe1P \xae\xbah]\x94a\xd0\xa2\x85\x9e\xa1\
+\xa1rq\xf2O\xa5\x06\xa3\x92\xc0\xeb\xfd\xa4Y36fV\xee,e\xf4\xe2\xcd\x88\xab_M\
+\xf6\xf3\xd9\xd9\xd9K\xcb\xcb5F]1\xff^\xf2\xf6\xee~[\xd4[\xe7y\xcb\xd5\xccON\
+\x8c?\xbe\xe9^0\xe3MR\x98\x98\x9c\xf4\x15\xcd{\xdax\x02f\xbc\xbc\xbd\xbc\xb3\
+se\xefJ\x8f5\xbd\xbd\xbd\xbd\xc3S\x1e\x80\xf7\xa5\xbbg\xee\xeb\x13\x17_\xd7\
+\xb6\x95\xdf\xabIC^\xa2\xc4\xdf\x00H\xd8\xb1\xdc\xb9Q\x9d_\xe6_\x94;]\x8d\
+\x85\x80\x05\xbe\t([}4\x95\xa2\xbe\x14\x07\xd0\xb8\xb2\xb22\x0eR\x08p\x04\
+\xb9\xb8\xdf\x7f\xf7\xd8\x00CQR\x82\xe2\x92\xf5\xfa\x1a HJ\xeb\x82r5\x98\x0c\
+\xb1\x18G.j\xfd\x96\x18\x13i\xf1\xe8\x1f\x80CV+\x0cwB\xe4\x10\xb0\xeb\x1f\
+\x99\xbb\x7f\xe3\xe3\xb4\xda\xae\xa5\xa5\xc5\'$T6s\xa0\xa6\x02\xf0l\xc3\xa2\
+\x83\x96\xc7\xec\x8d\xfd\xbc\xaf\x8fO\xf3\xe7\xe5\xff\x1eD \x93-Y\xa6\t>\x87\
+@\n\xd4P\xbf9r\xb8\xbb\xb3\xb2\xb1\xb5\xc9\xaf\xeeuLdd\xa4\x15q\x93K\x90\xa6\
+\xd88\xbc\x88K\x08\x88Xu\xb8>5\xeb\xef\xbd\xfd\xef:\xce\x8e\xab\xd0\x9c\x16 \
+\xdd\r\xef\x1e\xad\xacg\xf2\x7f&~\x88\x95\x03+\x8fFD\x85\x0e\x99\xd9\xda\xdb\
+\xcb\x1c\xd9\xe1\x87z\xba\xbb?gs\xf5\x0fS\xc1H\x9b\x90my\x10\xf9\xa7F\x885\
+\x9b\xa3\xb4\xfa\x1f\x18\xa8?\xbf\xc3c|\xd1\xb5\xac\x15B)\xda\xdf\x18\xf8\
+\xb6\xeah\xed\x8c:\x86\xbb\x82\x02\x0e!i\xee\xec\xec\xf4<[\x9b[\xad*t\x8bJ_\
+\x00\x92\xad\\\x91:{\xc6\x9bcx\xe6S\x0bn\x12L\xe4H\xe4H\xe6\x0fi\xd1\x90\xcd\
+\xc3\xb4\x8ai\x9b\xc6\xe6f\xed\x025\x088\xa9\xb9\x99\xdf7M\x0c7\xfax\xb9\x05\
+\x1b\x02\x8dZ?GwKh\xf7\x94hy\x02L\xc8*\xa5\xb8\xa9\xb8\xa9\xf5G\xe6<\x9d\xc4\
+\x98\xbej\xda\x9c\x9a\x99^\xd5\\\xf9ay\xf0+|\xfe$\xca\xd8\xd5\xd4\x86L\xfd[\
+\xee=\x0fkN\xfco\xf9\xf9\xc6zz\xd4\xc9\xd4\xb5(\x1b5\x0b\xba#A=\x80.K\xd0\
+\x05\xa2O\x08\xe1\x86\xf5>\x98\xc3=\xc8@\xceI+\t+L\x8bL\xed\xec\x98\xd3T\x9e\
+\xfc\x1a~\x97\x88\xfb\xddO\x99\xd5\xdd[\xf9\x8b|9\xa6\x02\xc7\x0e\x15N\xdbL\
+\xadX98`\xea\xc8!LR\x9e\xf3\xf1\xf2\x0e\x9a\xd5y\x89~]\x90\xea\xa5\xac\xd5Y\
+\xa4\x04\xfe\xfe\xb8A$\xfa\xb7\xf7*\xd32U\xa8V\xfe\xa7\t\x1f\xeb\x9f\xee\xed\
+\x7f\x15\xae_\x01\xad=\xaet\np\x14\xcf\x8b\xb2\xe7[\n\x8d\xc4\x1a\xb5\xa8_\
+\x19XIc\xd1\xc1\xbd\x80$u\xee\xc7\x0b\xace\xe6\xe7;9:\x9e\x1e\x1f_\xfbty\x95\
+\xac\xbf\x86:Q\x8a?\x8f\x02\xc79<<\\\xa7.\x03\x8b\xa9\x93\xc4\x9f<R\xf2@\x1d\
+\xda\t\xd7\xcf\xb4\x87{YR\xcf\xcf\x19\xdb\xa5R\xa7e<\xea\x0b\xee\x93\xa4\x82\
+s\xdf\x1d\x1dU\xa2O\x81\xc7\xab\x9c\xb6!\xa3\xa4\x84A_\xb0\x9bg\x1d\xde\x97\
+\xcc\xc0\xddzw\xad\x01Uk\xc8\x8f\xd2/\x01FH`A\x1f\xef#Ds\xff\xaeR\xf2)\x8e-=\
+=\xbd0wpt\x14\xdd\x07=L\x9a\xbav\xc8\xc5&\x85F\xdb*e\x07o\xbe\xcbY\xf0\x9b\
+\x02mo\xd0\n\x10U\xfe\xfd\x1bt\x85\xff\xa9L\xc8\x828\xff\x87~\x8c_\xfe\x0fKd\
+7:8\xfa+\x91\xd1\xf1\xc2]\xe1\x80\xfa\xd5Q\x112\x90x\x12\x1e$npm\x7f\xf8:h\
+\x8e\x07\xd7\xdc\xac\xd4\x8a}\xf1\xf4\xdc\xab\x17Bv]\xe9r\x13 \x8d\xef\xcf\
+\x1c\tu\xf3^\xa1\x80h\x93\x0c\x0cC\xfcUJxRFXYY\xe3\x12\x12\xec\xff\xbb\xee\
+\xf6\x06\x0e\x19\x04\x18\x86\xbb\xf0\xdb\x93\xd2Y;\x80\x87C:\x0c\xb4\xb4<\
+\xa0\xbd\xc1\x80O\xab\x94\x04\xab\x98\xce\xc9\x7fUZ(FF\x04\x0cE\x90,}l\'\xca\
+\xe6W\x8aK\x18\xc1\xa0\xfc\xd8@<"\xd2\xa5\xe24\xa3\xe4\xbfa\x1b^}\xd6\xf4\
+\xe4d\xdc\x8c1>~~\xc2o\xd8?g\xfe\xbb\xc2\xf8q&\xa5n\xc8\x869-l\xdc\xfe\xdf\
+\x12\xc0\xd1S\xb6M\x97\x85f\r#\x86\x9a\xba\xee\xb0\xd7\x17\x07\xfe\x0eS\x19\
+\xf8\xbf\x88f\x99\x9cN\xacl\x1c\x9f\x17\xd4\xa0W\x7f\xfaS\xa7\x80\xf8\x1a\
+\xd0\xfe\xea\x19x\xe7\t\xc0\x19`\x88\xa9J\x96^\xd4+\x80\xcb\xde\x9d\xfe\xfe\
+\xb7\x9d\xfa9\xa5\xaa\xa0\xc0\xd4\xc2\x82\x167z\x132x\x02N\xb2\x11\xa5\xe8\
+\x81A\xbb\xe3,bcc\xc5{\xb0QC\x92:h\x1c\x13\x86%\xf6R\xa6\x91y+2\x92X\x93\x14\
+\xb4I\xe3\x99\x8b\x99SF\xb6]\x17O\x96[\xec\xf9\xf4\xc35\xa8SFL\xca\xd6\xb0\
+\xd7\x19\xc0\x91\x03\x05\x1aevvv@\xd4\x8c\x8c\x88x\x0e\xe8Y?\x9b\xb4\xe0\xfe\
+\xef\x02^h\x1f\x9c\x1a?\x98\xcf\x07\xfe\xf4\xad\x7f\xcc\x0b\x8e\x10\xe9K6\
+\xb4\x82\x18#\x0c=qlg\xc1\xb7\xcd\x05c\x02\xc1\x83\xd2,\x8c9\r\xf8h\xe2x\xb9\
+\x9c?\x11\xe7j\xbd\x94\xc4\xef\xde5\xe8,\x02\x04\x88\x10\x1c\x04\x90M\xc5\
+\xec\xbeQ\xca\x1f\xab\x86E\xd6B\xffV/\xfa\x94\xa4\xb1\x9dS\xf5\xbb\xd21\xa4O\
+x\x98\xc8@\xa5UTT|,\xfb\x07l\x97\x97\xdcTU\xd0L@\xc0\xda\x1c\x1c\x9dMp\xe0R\
+\xbc\xb8_\xfb\x9e\xce\x06\x9e\x1d\xec\x9d\x02\xabw\xda>\xfd\xe9\x10\xac\xa6\
+\xdd%\x1dz\xa6\xb4\x8b\x91\x8d\xe3L\xed\xaf\xe1\xa8\xed\xa9zv\xdb\xc6\xbe\
+\xfe\xc5\x15\xdd@\x90\xd5\xd0\xe1y\n\x8e\xe8\x83\xda\xa5\x13\xae\x95\xc278\
+\xd9\xd9!,s8\x95\xc0EJ\x9dpU\xb8\xb3\x92\xbe\xb1\xba\x02`\xd3\xa0\xd9\x81\
+\x9a\xe9\x18\xdb\xf9>\x9d\xcd\xe0\xbf\xa7\t\x8cX(*F\xf7\x99H\xde\xe5\x01P\
+\x16\xef\xfd\xebX\xebV\x92J\xcd\xc0\xc0\x17(\x83\xffX\xc3\xe5_\xe3\xff\x9eh\
+\xd1+\xfe\xf5\x87:\x90\xf3$\xc9\xc1\xf6\x8c\x841\xbe\xffNn|\x80\xa3\x9f\x04\
+\xe6\xa8\xe0Iz\xbe\xad:\x9fR\xe2\xf4K\x02\x05\x8c\xf2\xbf\xbb\xf2H\xc0\xf5\
+\x84\xbc\xbf\xd2)XDj$\x1d\xa3\xfdf\xbb_\x9e\xf0\xd1e\xe9S\x98882>\'j\xbd\xf4\
+tv\xf9j\xe6\xec\xa5\xb1w[&F\xd1Jn\x82\xd9qq\x91\x83\xe9\xdc\xa2\xe1\x97\x83\
+\xde\xa8\xd8\xf91\x1d\x84\xdd\xf3\xbad\xf0\xece\xf0gTO\xfc;\x18\xe7\xb5\xb7\
+\x9aP\xce\xb9}\xdeuWa\xf8tr(T\x9151\xc8s\xa3\xbc\x1a\xcbS\xa7\x9a\xd2\xcc\
+\xdf\x86\xb3\xdc\xf7%\x8e\xa3\x8f\x7f\x81\x10\x19\r\x13\x81\x96:8L\x127\x19!\
+\xb9j\x9d2\xa1\xe9I\x1f\xec\xf8\xed\xe0\xc1\x7fl\xec\xbdB~\xf7\xd9\xcc]\xd7\
+\x93\xff]\xc0mC\xfe\xe7\xca\x95sh\x84\xde\xa4\xe1\xafl\xcc2\xcd\xec:\xfa\xd0\
+\xa8m\xd7\x870\x7fij\x1d\xa0!\xa0\x7f\xebt\xc7\xc5\xf9\xea\xcaw\x88\x88\xd2B\
+n\xb1a\x94#X*d\xf7/\x18\x94\xfe\xd7\xa0\xf3\xa1\xb9\xb9\xb9\xf0p\xa4\x1f\xa7\
+\xa4\xa4\xa4\xb7\xa7\xab\xcb33[.\xbe\xdb\xaem\xf3\x02\x91\xa8\x9b\xb7\'\xcb\
+\x10\xcdDcIZ4D\x84\xef\xb8\x84\xb61,\xf1i\xa1:(/\x18\xdd\x9b\x85\x1aiJ\x04h\
+\xf2\xa9J\xc5\x9a\xf4\x7f\xc6\x7f;,- \x1a}g\xd6\t/\x95*\xd68p\x17f\xcd\x8cp\
+\x95y\xd6\xf6\x03\xbc\n\xf6\xea\x04{\xdd\xcdqZ\x92\xabR\xa6\x14u\xbb\xbd\xde\
+\xfe\xb7\rM\xeb;<,\x9f<\xddg\xe5I\xfdtx\xd6\xa2\xf79\x1b\xfc\x965\x98aq\xa8c\
+\x99\xd2\xc4<\xbb\xccc\x10\x9d\x9b\xf21\n.}\xa0\xb6\xd3\xf5atp\x10\xd1\xd9LT\
+[0\xe2\xf7\x15\xcd\xd3\x7f\x8fi\xd4d\x06\x1a\xc5R\xaf^\x8d157wuy\xb9B\xa3\
+\x0c8\xe5\xa4\x01\xf9\xfa\x86\x86\r\xa7\xc8\x01\xd3)_\xa1hI\xc87\xcf^\x92\
+\xf7JJ\x97WWD\x84\x84Pn\xa8!q\xf1\xfb\xf7\xef\xf7\xdf\xf2\xf1\xf1\x15kWL\xdd\
+\xc6DM\xb1\x06EMmD\xec\xab\xb0\xe3l=\x17\xa4GJV\xbf\xf1\x14\xc4G\xdf\xa1\x9d\
+\xf9\x9co\xf6t}\xbb\x1e\xb83\xe0\x04\xbbs\xca?<\x11\x9b]\x16\xb1k0\x15\xa7\
+\xa1\xae\xec/\n\x81\xe7|\x88\xee\x104l\xf3Cz%f4\xfc\xfd\'\x19\xba+E\xe4`\xe1\
+\xe5\xd5w&\x7f\x82\xd8\xde\r\x85\x02\x86[\xf8\xeb\xa3\xaaj\x02\x04\xac\xa7\
+\xa7wpt\x14\n#DE\x04\'\xfd\x1e\x8a%\xa2\xd9\x88\x1aq@\xf8\x07\xbb?\x1d\xf6n\
+\x93\xecGF\xa2\xb8\xc1\x9es:\xda\x87\xe6\x11\x9eoB\xd6qW\xd6\x00\xef\x03t\
+\xb9J\xc5@O\xaf\xcdz2\xaf\xbc\xbc\\\xe2\xb5&0\xee\xee*\x0c\x91o\x1d,N\xc4a\
+\x0cN X\xef\xbf):CJ\xff\x1e\x11\x11\x11\x17\x17\xb7\xb3\x93\xa0\xd9\xc6\xdc\
+\xa4D\x971\xd6\x87!\xd9\xcb\x91b%\x95\xcb\x8e\x83\xd9\xff[\xb6\xd1\xb8jb\xb8\
+2\xd8\xa2C\xa5\xe2\xbf\x15%\x0f\xdeZ\x8e\xec\x1ao\xda\x84\xcaM\x189\x85\xf8\
+\xa2\x03Y\xc6\xeatY\t\x13\xd6\xd7:m\x1b\x8cj$<\x0eS\x87O\xb8\xb2>lmm\xc5\x06\
+#\x11\x7f\x01\xce\xc4\xd6\xd6\xd6\xdf\xdf\xdf\x84K\xad\xbbY\x14\x17\xeb\xa8\
+\xb1]\x92\nz\xf5\x00\x18\x99`g\xa3\xf7\x0c\xa0\x0c\x86\xe5lUee.\xc2\xb9\xfc9\
+o\xb3\x02\xc1\xe5\xbc\xdaK\x95\xcd\xfd\xfd\xd2`R\n\n,z\x01\xf0\xa1\xc8\xf2\
+\xde\x8d\x0fh\xcba\xf5\xb1V\xa5\xe4\t\x1a\x8a}np\xf9\xcf\x9b|Y\x04L\x19^c\
+\xdc\xe1\xd8\xb2\x8c\xfdr\x99\xa8\xc9\x1c\x9e\xc8\x8ff;\x9f\no\x9b_+\xa3\xf4\
+-\xaa\x16\xc1\x9cI\x9a\x1dg\x9al\x8e\x80] ;77\x9c\x8a4H\xaea1\xee\x91\xab\
+\x91B\x8d9MHHh\xbe\xfaS\xac\\\xd1oB<\xf5O\x9f>9:\xb2sO\xa1\xb2\xd76\xf4\x99d\
+\xe6\xe4\xc4\xfe\xf7\x98M\x92qGb\t2IVN\x1b\xb2\xb0\n3S3\x85\xf9\x9b\xdb\xdb\
+\xcb\xf0`\xd7\xfe.\x03N\x93D\x98\xbc0\xce3~\xa7\x82\xe9\xe2\xca\xd9-\xd3E`\
+\xe9#\x0e\xa8\xbcC\x11g\x164\xa2L9\x9c2c\xe7!W\x04b\xb4\x1cY\xad\xd2T\x84\
+\xfb\xab\x1e\x12\x93~v\x1fua\x00><=\x95\xabc\xaew7\xf1\xc7I\x1a\xd8\x80\x92\
+\x053F0\x85t\x19\xbe\x8d\xb9]\x80\xb8W\xd7$d\x19\x156\xc6\x96\xee\x0c\x1a\
+\xd7\xadW\xf13q\xcfB\x0e\xa9a~\xbe\xd9\xc2i\x99\xac\xd0P\xa0BsUP\x12)]\xf5?\
+\xce\xcc\x98\xbc\xba\xb0\x07%\xa8\xe9\xaa}\xd7$\xed\xdf\xa8u2\x82/\xcd\x17\
+\x087\xc4\xf2\xc6\x06\x87\xb8\xeb\xb8\xa83\xc1!D\xa0\xf5\xf2!\xeeR\xc6\xcb\
+\xfd\xa4/\x01o\xa0\xaaXs\xe7\x8c\xce\xa7\xb78}\xb6\xae\xa2V\xda\x84\xf9t\x05\
+X\x0c\xc6\xa8\x9c\x94\xd2h\xff\xdey\xf3\xe6\r\r\x8dv\xb8a\xb5\x1a\xa3\xdf\
+\xd5\x15$\xec\x9b\xb4T\x00<\x88)\x15=\x95\xa1\x81\x16\x1et0v- \x17\x91-\xd0\
+\xc4\x98\x8a\xfe\x0f\x847}\xba\xda\x91\xf4$\xb9D\xf9\xe6\xb8\xe2\xe9\x96\t?f\
+m\xcd(^n\xe0\x8e\xf9\xd3W\x02\xec\xbaMG\x7fuF\x04\xce\xe2\xc9\x80\x96\x90 \
+\xff\xfe\ti\xd5g,\xa2\x07\x9f\xe4\xc32\x1cyI9IM\xc4\xddx\xb4\xa8\xc4\x96K/Q\
+\xc6M\xb8\xa4\xa4\xe5Y7\x1a=g\xc6\x82\xc07\xc8\xb4\x7f\xf1\x18\xbd\xfav\xea\
+\xb8\xd1\x03\xb0\xaeldO\xe0\xaa\xeba\x93\x8c\xe1~\xa4/\xd8\xdaO;x<N\x02\xc5-\
+\xac<\x84Ll>\x8a\x05\x8f\xc9\x92\x85a\xf5\xa4\x87\x15\xb2Y\x02\x89\x08z\x93\
+\t\xb3\xf3\x90\x1dV\xc716+\x9b\xbfhm\x85\xabf\xe6\xd4P\xdf\xdfc?r\\||8^r}\
+\x8f\xb3\\\x9d/TO\xc5\xc7\xb9\x03\x803\x05\x87d\x81@\xb4\xc2\xe7IN\x01y\xf6O\
+\xd1\x8c\xa4\xf1\xbd\x13\xf6\xf3\xf3u\xee\xc6\x8f\xc8x\xe1\xd3\x13\x13m\x1b\
+\xa4\xdb\xbb\xa5\xbdL\x11\xb55\x9e\x13\x18Z\xd8yAT,A[:\xa9:\xcdN\x9f\x01\xe9\
+\xa1o\x18\xd9hMQ\x1a\x94\x1f\x92-\x0eGB\xc2Ah\xd4\xfb\xac`\xbd\xf6\xb0\xb1\
+\x93\xa6\xa0%\xdd\x1cV\x92\td\xaf9\x9a\xdd\xd8\xe7\xfc\xf5\x17\xf6U\xb6\xa8\
+\xc6C\xa7\r_\xc6\xafb\xean\xe1\xc6%\x16(C\x1f\x0cGt\'\x8b\n\xeb7\x17\xa6\xcd\
+k\x8dP\x8b\xa3\xc1\xeb\xdf\n\x94\xbd\xbb3\xf1\xbd\x0eA%\x98\xeaz\x9d\x1d\x1d\
+\xef6\x15\xee\xa3\xe4\xbf{i\x1d\x8c\x88\xfeLl@\x86ga\xad\xe5\xded\xf8\x81\
+\x16H\n\xa3<\x89$6\x87\xb8\xe2\xf2\x1a\xf9\xd6\xa7\xa0\xc0\x12\x8e$Uu\x07\
+\x0f\x83X\x820\xd2\xd3\xd2]\x84\xb6_u\xee:\xacW\x00\xcc\xad:m\xa1\xb5\xa7\
+\x05\xa2\x90\x19\xdd\xdc\xc6<v\xc2\x92C4\x04!\x95\x15\x1c\x03\x01\xa7\xa4\
+\xa4P$\xec\xed\xfe\xc9\x11\xf1<\t[\xe6\x17\x10hq\\\x15\x16\x85:\x14<\x99)\
+\xe5+\x93\xe1\xdd<\xc0\x99\x10>\x07\x90\x85\x91\xbf\xef\x98"\x8e\xec+\xc1\
+\x0fK\x80\xe1\x1f=\'\xee\xe2\xaf\x13\xf50v\xa7h|\x18\x8c\xac*\xad,\xe5\xd5\
+\xbe\xbd\xbd=to\xff\xf5\xebW}}\xbd\x97(\x10\xe5\xb3\xb3I\xe9\xeci\x95\x8aq\
+\xfd\xfa\x0el#\xfd\xed\xcc\xbc\xbdI8\r\x1c\xe8~\xaa1.\xb54\xbb)b\x9byUOFz\
+\xe6\xe6\x14\xfdM?T\x13l$\xd6=\x7f\xdc\xa5b\x0c\xf2\xa1n\x12^\xdf\xbb\x12\
+\xb2&C\xc5\xe9\xecns\xb0T\x11\xa5\x90\x89\xa16\xc8\xa2IS\xb2\xde;\x8d\xdb\
+\x1d\xea\xed\xafZ`k]\xe93q>YBoY\x8eo\xb0\xa8\x1cQ\xdb)\xffYB\xce\x9du\xdc\
+\x90\x9b\x7f3\xf9\x94\xa5\xe4\xf5t{\x12\xf2\x1cb\xc3\x1b#\xa4_\xac\x01J\xfac\
+\xc7\xc2\xce\xfeu\xc8\xcc\xdc\xdc\xdc\xdf\xfa\xc9O<\xdf\xd2\xe6\xb7\xd8\x96\
+\xb8\xffc\xaa\\\x11|\x12\x96\xd6\xcbmGNv\xd4dlX!\xabR9?M\xf5 \xb4\xb2\xb42Q\
+\x81\x96\xacpS\x9bf\xfdZmL\xc62\x82\xfb\xdf\xda\xcf\xc4/@\x888\x9c\xe1\x95\
+\xcdV2\xa7+i\x84\xdf\xe4\xd4\xa7\x15_\x01\xcc\x10W\xb3\x1c^\x92\xaaU\x125h~\
+\xd9\xd3A~\xd9\xde\xa2\x15\x03\x03\x1d>\xe5\xe6\xfa\xda\xc2\xda:\xb4\xcd\x82\
+?\'\xd1C\x8eu\xbc\x14\xa5\xf7\xfd9\xe9t;n\x95=gi\xb5q\xc7\xab"\xa3d~\x1e\x8c\
+F\xc9P\xc35I\xd5\xc5\xe5\xc1_Y\xb64\xb6\xd7^[\xbco\x10mV\x1f\xdc\xeeuQ8k\x15\
+\x8e\x12\xf5\x0e\x1d\x17\x89\xc7\r\xc2\xc7\x15/G\xa3a\xc6xp\x1e[\x11\xe6\xa5\
+\xb8d\x11\x8a^\xc9c\xa8\x97ZH0P\xf2+\xd6\xbd\x8d\xba\x8e\xcf\xff\xb1\x9f\x9d\
+]\xdb\x99\x05\n5\xdd1\xf5L\x9aG\xac\xa4\xe8d\x0fn\xf81{\x08\t7\xd3\xa64\xffL\
+\x02\x90_\xe2\x18\xcb(\x0b\xf5Ad\xbf/\xd8U\x90\x0c(\xe1c\x84D\xe8\xd5\x150=\
+\x92P\xc5Ex\xf9X9\x1a\xa0\xb4S\xafiZ\xf7K[K\x01d\x86\x14\x81\x8c\xb6\xa3Qc\
+\xbe{U\xcd\x1f\xe9Yb\x9e\x01\xa1)8\x18\xfe\xec\x1bQ\xb1\xa0\xa0\x83\xa9\x14<\
+~$\x94\xb4\xb7O\x9d\x91\x00\x05\xfbU\x99:\x83\xe6\x9a\n\xdcJ\x00\xb1\xa8\xd3\
+\xbd\r\xd8`\xb2\x11\xbe\xe4\xf9\x10\x9d\xb70\xb4e]\xf0\xe1\x0bYA#\\\xbc}\xfb\
+y\xed i\x9e\x96@5\xa9\xd2E\xa3\xd0\x9cBO\\LG\xdaX\x14j\x01\xbc\xf8\x8dO\xd7\
+\xf0W\x8a\x01\xdd\xf0K\xb0\x8e\x98)e\xae\n\x11VdA-\xba\xa5\xf0\x17\xf4\xc1rj\
+\xf1\x8e}\xc3\x01N\xf5\xe8k_\x99P\xd5-\x18\xe5\xc3\xec\x86S\xe0\xd1\xb2o\xfe\
+\x12\xc6\xed\xbb\xf7\xb9.\xef\xbe]W\xd3C\xc2H\xe9\xd5\x9fS\xcf0\xbe\x98\xd48\
+AG\xe1P-\x94\x8a/\x8f8\x02rC\x19\x81\x11\x14V\xb8\xfb\x824#@ARa\xa7P\xcd\xdc\
+\xaf8\xf2=\xe9\xf4\xf6"\x08\x1f\xea\x03\x11\x07\x83\xa8\x0b\xcd\xa7\x05\xa3N\
+\xcc\xea%\ry\xf8\xf9\xe7\xa6\xa6\xa8n\x1f\xbe[\x1c\x10\xafY\xc3\xd7k\x89\xad\
+\xe1\x13\xdd\x014)\x8fE\x19\xfc\x17\xd9\xc0\t\x10J\xfc\xa7A\x1b\tb\xf4\xde\
+\xe7\xa9\xbd7\\\xa2\x15>\xeb\xc4$!<\xd8\x96\xea\xf8 0:^\x97?8\xfbn\xf2h\xec\
+\x1a\x82\x08r\x99z{\x11$Y\x1f\xc4\xc8\xa8\x8a\xe8\xf0|\xf5\xfa\xf0\xf3\'=\
+\xe7,\xce\xfcwQ\xacp\x1fA"\xac\x90{,\x9d\xaf\xbe\xbf\x05\xbfz\xc9h\xc4\x1c\
+\xde\x97\x15\xcb\x7f\xcf\xf7\xdbB#OX\xd8q\xd5\xd2\xd1y\x17/\xe7H\xd2\xc8\x9c\
+\x93\xa2\x95\xf0\xd0\x84\x8a\xad\xc7J\xf8l$9\x9d\xba\x9dwY\nu\x86[\xdfA\xa6M\
+M\x1d\x91\x05?S$\x17( ^FI\xf7"\xb4\x1d\xfa\xc2\xd6T\xcda5\xcf\xf7\xf2\xa2\
+\xa7\xa6\xdf\xa6\xbc\x90<.(>b\xbd\xa7j@\xda\x9c\xc7\x9d\xfe\x9a+\xd2;>\xb4\
+\x85R\xc9xk\x12\xec\xfdc%\xd6\x1d\xb4\x93\x8aJi\xd0~\x9e\xc3P\xb5N\xb8\xfa\
+\x87\x99\x00%\xcb\x0b\xd1\x85\x1dJ>8b\xf4\xaf\xe5\x13\x1frG\x8b\xae\xa0\x93_\
+\x06\x15\njC\xc1\x8f\xf8\xe2\xdf\xf1\x97\xa8\xefH\xea\xa4K\r\xa83\x068\xa0J\
+\xa6\xca8\xe8\xe1!;\xc2\xd4g\xd13\xb2E\xa0\xa90\xaa\xb31Ir\x94g\x08\xe2\x81i\
+\xc5\x1f\xf4*\xaekT*0}\xbeF\xfdBsG\x87\x81&\xcepS0\x912d\xc58h/D\xeb\x17:\
+\x08\xd4g\x85\xaf\x84t\x8d\x1a\xfd\xdf;i\xcf1\xce\x87\x00\x1dU\x10*qb2\xa7)~\
+"\xceA\x9f\xbf\xfa\x89I<\x15\x002y\xd3UQ]m\xe5\x80\x00\x97\xa7@\xb7[\xd2\xdb\
+\xfc\xe7MfO\x7fO\xea\x1e>\x16\xf4\xa3\xa8\xf6\xb4\x80r\x8f\x03h\x1az7\xc3W&\
+\xa1\xf8\x0c\xb3}\x0e4\x9c\t~\x83\x12\x85\n}\x9b\xda ;F$B\xe2\xbc\\\x93j\xa0\
+\x8c0\x1a\xee\xa3[y\x92\xa4\xf0\xa3\xa4D\xfe\x98\xc8\xf5\xe6P+r`zj\nn\xab\
+\xc4\xe2\x03\x96c\xb0\x8d\x10\xf8"\x0f\xa6\xcc\x90\x18\xebz\xea\xc7\xc2\x85\
+\xf5wq\x9e\x16gh\xa8\x10\xf9v{\xa8\xe1\n\xb7\xeeP4\xea)\xa8\x8eq\x82\xc9\xec\
+=\x02+\xaa\xee5\x0e\x91d\xa7\xc9,\x04\r\xad\x1fe\n?\xe8\xe3j\xe0\xc3\x00\xc0\
+\xbds\x87\xe1\xce\x9c:\xe8\xf8\xdbD\x100\xa8\xcdP]W-\x08\x01\x9eX\x14\xfab\
+\xc2\x08\xd7\x80\x02\xe5\xc02$\xf6\x03Z(OD\xe4\x1c\x07d\x1deP3?\xf0J\xb3\x81\
+:\x87\xac\x84\x90\x0e\x1c\x9a\xa1\xde\xd7-A2\xacq\x84L\xf2Zll\xe6/\xf0dX(9\
+\x84\x7fq\x88\x19\xd0\xc3\xff{c\xd09\x9el\xa0\x92\xfb\x99\xf7\xfb\xc0\xca\
+\xda\xc2k(\xd6\x13\xa7S~\xbe =\xc7\xafCN)\xaf.\xa3i.\x0b\xda\xf5\x14\x87?!\
+\xb9\\L\xce#h\x948A\x81\xa3\xfa\xfd#5\xa9\tA\xb7%\xa8\x1a?\x9e\xaa\xdc%\xfa\
+\x0b\xee\xba^EVUN\xbf4\x97w\xa2\xd4\xbf\xd9\xec\xfc\x8d%\xead\x16\xab\xa2Z\
+\x0fO\x81\x8c\xb3\xbe\x9el\xf1\xfeW\xe0b\x0fls(\x96#\xf0\xccR\xffm\xcb:\xec0\
+@I\x85\xec8\xa8\xce\x93j"\xc3\xac5\xe9\x14VB)D\xd7l\xeca\x04\x87CE\xf1m>L\
+\xeb\xddS\x94\x14\x931Z\x02A\x1c&a\xb5\x82\xb1\xa9\x06U\xa8\xbb1\xfek\xd2\
+\x90\xd9\x81\x7f\xcf\xddD\x956s\xa7\x9bQ\xe5\x03*|\xa2S\xa8 \n\x1d\xf9\x8d7\
+\xacs\xd1\x029.\xe1 \x02\x1b\xa9\xc2*\xda\xf4\xfb#\xa7\xce5\xc6P\x0bc\x16+\
+\xa3\x001P\x19\xb4r\xe7n8\'\x00\n\xf9\x81\x8c\x90\xb1\x08\xa2!j\xdaa\xaaI\
+\x9e\xbd\x8d\x08\x02\xf0\xae4\xa9\xdf\xf0\x17\xec\x15l\xe7\x18\xdbM\xdc=\xb3\
+\xa3O,\xe8\x17sxw\xdaJ\x8ad+6\xe5\xfd,\xe2\x18\xebT\x8f\x877>\x88Z-\x8c\xa8>\
+(<\xa7g\xfa\xe3\xd4\xc4\xa04d"\xbd\x1f\xb1\x8bf\\\xf6\xff\x0c\x0c\xc2\xe4xk\
+\xa7\xd1\x99\xce\xdd\x89A\xd3$Q\x89\xe9b\xb3\xec\xac\xdd\xd7\x0b\xaa\x03\xb6\
+j\xabL\x8c\xb6{E\xd1\\\xb9\xa2\xe9\xa3\x1b@\x9f\x9e\x0e\xbb\xfd\xfd\x8c\x05\
+\xc5\x06\xf2\x18\xf8\xc5\xc9C\x85\x99&k\xc0\x8b=R,\xbc\x15\xb4\xf0\x84\xed\
+\x9e\x02\xec\\)\x10\x88\t\x17\'&\x8d\x91_L\xae9\x9e\x18(\xcc\x9b@Q\xcf\xfe\
+\xf6P\xb6\x05A@\x8dL,\x134h\xfeSY\xb9\x153L\x1d\xc2\xebl\t\xf7\x01\xde\xe4\
+\xb9\xd6\xfb\xec[\xcb\x8aI/\xc6\x87$9\x99\xec\xcb\xa6\x1d\xe7\x7f\xa6V\xcezi\
+Jt\x86\x9e]F\t\xb5\x94\x1bb\xe9w!\xcf\x08do\xdf\x11\xfam?\x83 \x9c\xc4\xf0\
+\xe6\xbf\x88\\\xfc\xf8\xefE\x1c\xa55r\xc8\xd6\x87\xb6CleKf\xb8\x949\xf9\xf9\
+\x7f\xb9$\xce\x1fY\xf6\xe8\x17\xa8\xd5\x92_b\xb2\xb0\'`\xca\x96x\xb2\xd0\xf7\
+\xf5*p^\xfa\xc6\xc1\x0b\xe6-\xe0\tk6\x92\x122\x8a\x7f\xbf\x16\x90\x8d\x93\
+\x1cD\x92M\x90\xe9\x8c\xdb\x8dg\xc3\xac\x88\xfe\xcd\xcb\x8e<\x7f\xee[\xf4r}\
+\xd2}b\\1[e\xf7\x8c\xc3c\x9d\x9f\x8f\x98\x18G\xc4\x95\xba\xdf\x0fY\xc4\x08\
+\x81ikhh\x80\xafO\xf0\x12\xe2\xac\xbf\x00\xcd\x93T(c\xfb\x19i\xe1\xce\xca"\
+\xcdi\xa6\xdcfj<\xee\xc8\xf8\xf6\xac\xa6\xa6&\x12\xfej(6\x88\x92\xae\n_>\x82\
+\xbc\xbf\x07g\xda\x1c\x93\xa3c\xeaC\xdc\x89\xa1!;\x14\xcd\xfc>&\x12\x1c\\2\
+\xe8\x19\xd11Z\\\xa3p\xa7+\'\xb8\xd1i\xbe\x87\xd5\xf9E\x90,I\x01\xb1\xc0W\
+\x90LN0\xbeQ\x14$\xdb\x0fj]\xaf\xaa\xaaB\x0fG\x18\x13|s\xe6\xa5\x01`,tTR* x\
+\xe1\xe3\xb9\x8aL\x81\xc50\x08\x18\xa5m\tm\xa7\xd4wx\xa0{$\xa3\x1a\x0cD\xe7\
+\x90\xff\xbf\x16@\x07\xa4}\xbf\xbb\xc7\xb5\xaaVOA\xf2\xce\x19\xbd\x13N\x05\
+\x14\x8d\x9fZ\xc3&\xef\xc2\x1b\xb9.\xe8!/\x8f\x92\x8e\x03\xe2\xeb\x15\xa1H`\
+\x10\xe3\x18P\xe5Ym0\xdf\xea\xcb\xa9(Tx\x9e.\x9f\xb8-\xffQ\x94Z\xe3\xb7"\xc2\
+\xd4\xc0\x9fg+LO\xd7<N\x18\x1f\xdb\xc3\xf8\x88\xa4<\xfe\x106\x12\xf8\xa8z\
+\x0b\x03]t\xa6j\xf8\x9d\xf2\xe7\xfe5#1x\x14\xa9\xf0\xd9J5\x84\xcb*\x19Z\xe4\
+\x98>P\xeaC\x80Y\xc2\x02\x1a\xad\xf7\xf8\'\xa9\x12=\xdc\xddk\xbdM\x9c\xc9\
+\x04\x9d\xe1\xba\xf4\xa0$\xe0@\xf8\x86m\x0c\xb8<\xeca\xc8\xf8\xbeI\xe9E\x9a3\
+\x1e\x08\x8cP\xcf\xc6~\xb3\xbf<?;\x1b\xfe\xf1\xdf\xfc|\x91C\x8e\x0e\xbf\xa3\
+\xe0\x9f\t\t\xf6w\x1c\x1a\xc2\xb9\xb1wJ\xcf\'f,\xbe\xdd\xbep\xe3QQ\xbe\x1e\
+\xa6X\xd2AA\x1fs\xc6\xe9\xc3>\xf5\xeaq\xcaC\x03[\xaf;\xbe\x9c\xe0\xc3\x8bF\
+\xc0M\'\xa3\x06!\x8c=\x15\xf7\xc6C\xb6\x9d\x85\xa1DP\x14\\\x90M\x08\x0e\x87d\
+\x05\xaezU"\xf1\x8f(9\xa1l\x9c>\x8cS\x08{\x8c \xdc{0<\x98\xc0tW+\x92d]\x06\
+\x8b@\xd6\xfa\xe9.\x80n\xe7C\x9e\xfb\xdf\xba\x8d\xd4sZ1>/l\x03\x1c\xd5\xd1\
+\x9a\x8f\x9c\x1c\xcd\x0f\xaa_\x9fM\x9f\xde\xec\x07Fe\x92\xbck\x9e?\xda\x81\
+\x90\xe7!^\xdd\xea\xb2\x80\xc9\xe3>D\xa7\n~\xdf\x11\xe3\x1a\x8b2\xc6\xef\x93\
+]\x19\x1e\xf6\x94p\xcc\xafm\xd8D\xf8\xca\xcf\xcfO_\x1e\xaa\xa6\x81\x9f\x1a\
+\x16\x19O\xf0\xb3\xbb\xdb\xc8\x9dT\xa8[\xd0{\x93V\xc3\x93@\xb1\x0c\x8d,\xf2\
+\x02C\xbd-\xd8\xf8\xdc\xb2\xb1\xb9ys\xb3\x00\x1b\xdew\xcb\xd8:\xbf\xf6\rX\
+\xaaN\xb8;\xa4M\xb2h\xfaG+\x01S\x1c28\xc4\xd0\x02}|\xe46\xe8\x04\xeb\xb6\xb9\
+\xf9[\x94\xcf\xfa\x99\xac\x04\xc7+>\x1e\x9e\xfc\x01Y>\rG\x94\xff\xd4mdTH\x01\
+P\x1f\xf0~^~\xe5j\x8c&\xcb\x92xLe\xf2\x08\xc3\x14\xe9\xca\x8a\x87\x06@Y\xb5K\
+\x95i\xf6\x97\x0f\xa1b\t\x02\xf1G\x12\x9d\xa7x\x87\x04_>\x98\xd5D\xee\xcd5\
+\xa3\x06\xf2\x03\xb9 \xf7&\x80\xab\xbb\x0f\x06`\x8c \x14\xc9Q\x1c\x82;\xa2\
+\x02:}6\x0b\x85|\xd4\xfb\xa6{\xb0\xa5r\x8c8\x86*z\x9c\xf7\x96\xea\\m0\xc3+\
+\x8c\x12\x96A\x8e\xa9\x92x\x197\xa1\x1d\x03\xe2@\xd0\x07\xfb\r\xc5\n\x15\x0f\
+\xfd\xdd\xa4\xedg\xe6M\x8d\x98-\xee\xa5\xde\xec\x8f-\xe6\xcb5\x83\xa3\xcc\
+\x8b\xca[i@\xc14k\xcf\xc9\x19)a\x01=\xb6DK\xf8Y\xfd\xba\xf9+`l\xf7\xf9\xf3\
+\x87\x12\x03\xf3[\xa9)\xea_\xf9\x07\x1f\xc5\xd7\xbcw\xe4k\x80\xf4\xc5\x99\n\
+\x7f\xd9\xf0&d\xb9_ =\x19/L\x90T\xfb\x93\xea\xfe\xa9bpr\x1bc\xcel\x84J\xde\
+\x14l\xd6\x86W\xf7=\x93\xad\xab(\x8d\xc9\x96\x10\xc2WaO2D\x17\xb8\xf7\\\x1aq\
+\xba\xe7\x1f\t\xbd\xc5\xb1|\xc2\nN\x836\xe4\xc0\x1a\xbfwN\x0c\x96Q\xaa1W\x88\
+I\x1e7g\x8c\x0f\x8f\x8f\x9f\xc7z\x9eY\xceA^\xde\x029\xe3@\xc4\xcc\xa4r\xd6M\
+\xea\t[,(\xec\xc4}\x83\xbd\x049\xd7c$\xa9\xe5D\t\x9e\x86L\xd0Eo\xe1\x14Sn\n\
+\xb6\xdd\xf5\xb3\xd0/\x0c\xf9\xbe\xba\xac+-\xb2Y\xd2r\xa2\xb1\xd1\xf1\xe4\
+\x9a!\xa5:\x04(z\x8a\x90of\xabJ\xb7\xb3\xe56\xd63+L.\x97\x18\xc3\xbc[\xb7T\
+\xbbEV*2>\xca\xc7\xcd\xc5l\xbcuD\xb7\xc2S\xfay\xe72DGG\x97\x18\xf5:\xaa\xd3-\
+]A\xed\xb6\xf7\xf8\x88E&85;\x8b\x04#\xb4\x80\xffi\x17+\xca\xbcbH\xef0\xb9\
+\xb2\x9aC\x90\x11\x8c\xb1\xf5\xd1K\x94\xc2E\x1b\xdc\'\xe6\xd6f\xf8d\xbc\x1a\
+\xa8\xec\x89b\x0c\xa5\xfflYl\x19\xc5\xc7\xe9=\x10\xf4\x11j\xf8U%\xf0:A\xa2\
+\x7f@\xc6i$f4\x06\xb0-J=\xb3\xc1\x8dV\xf3\xcdZ\x139\x81u\xe1_\xda\x1f\xeb\
+\xdf\xe8^{]\xf3x\xa0\x00%\x80\xfc\x0f{&\xa4\x06~\xac/\x02*\x8a\xfb\xb5\xd7\
+\xd0\xf4\xaf\xc2[\xb9\xa2$gAL=.\x9c\xfb\x87\xdf\x9eK)r`\xb2\x91\xa7\xdd@\x9d\
+Y\x19E\x18e\x1c\r\x14\x94z\xdd\xfc\xe5d\xc9\xfb\xf9\x1e\r\xf5\x1bH\x9d\x13\
+\x7f\xbf\xe7\x99\xda\x0f=1\xe4\x9e5Si\xa1h\xe3\xc7\x1b\xf6\xcc(\xc0\xae\xf6\
+\xb6\xf1Meg~\xfd,\x1b)\x0b\xfe\xdf\xb6\xda\xe1i\xde\xea*bK\xd1\x98z\x8c\xff\
+\x8d\xbf\xf7lI[6|\x86|!\x15-\x046X\x04j{\xa9 \xa42\xb1\x0c\xf1\x1ci\x84]\xd7\
+\x07\x82\xcd\xd88\xebr\xbe{\x95\xfa\xa6\xd6E-\xbf,\x06\xea\xd9\x92p\xfer\xcf\
+0\x07\x8ad\xf7\x9dSm\x88\xf0L\xb0\r\x9fD\x0cb\xc5/{\xe7O\x8b\x91g\x87\x87\
+\xfdP\x95\x8d\x91\x8bWe\xd4\xbe\x08\x14\xa7\xfcZ\xb7\xe3Z;\x86\xf5\xeb\x15\
+\xa6\x9e\xdd\xe8\x99\xa3\x9b\xd7\xcd=\t\x14/\x15\x08V\xe4\x7f/"\xc6.*)\xd9\
+\xbb\xbf\xc0\x9b\xb6\x19t\xe0\x8e\x1c\xd8\xd8\xeby~N\x8fl\x8e*\xc5Ds\xbd8W:\
+\'\xce$Cs\xac\x19\xde\xaa\xd3e\x9d\x9d\x9d\xcdd\xa9\x0b@ \n\xbb\x90\xf9\x9a\
+\xfe\xdfs!\xd8\x081N\xdf\x18S\xa7\xd03\x92\xc8\xe5\x8a\xba\xd4\xb7\xb4\x101\
+\t4k\x84\x8d\x92\x95\xd2\xdcY\xe5g\x9b\x04RH\x89\xe3}\x8a\x8a\xea\x84(J~%\
+\x19tn\x8b\xfe\xbdA\xab\xf4\x88\xe0\xda&\xfdM\x0f\xf0}\x179I\x06We\xb2\xee\
+\x87\xf5!\x0c\xf46`\xe4\xe1\x98\x88I\xea\xfa\t\x98\x05\x88\xc1\x1b\x1d\x82CQ\
+\xa4\x83\xdf\x83\xa2\x12\xa9LR\xe1\xab\xff\xfc\x8e\xf2x\xf1\xe1!\xd4\xa0\xca\
+\xdew\x17>\xcb\'z\x01E\x0ep\x89\x8b\x1b%\x1d\xff}\xf0\xad\xf2\x9f\xe5j8\x94\
+\x8f\x1bW\xaf\xcf\xaf\x11St-\xfe\x91\x11\x93H\xb8\x9b\x88\xcb\xf7\xc3\x81\
+\xe9\xbe\xf1~\xbakFc\x93nU\x07\xe2\x1c\xf8*a=\xb6\xefX\x83\xfc%\xb68\x13\xa6\
+\x9c\x15\x0cqG\x7f\xaa]\x8f%\xcf\x84\x90`E\xfa\xfa\xfa\xb6mr\xd3\xd10[I\t\
+\xb9}\xdd7\x87U<\x89\x88\x88\x08Q3h\\\xdc\x9fN\xd9\xb5\xb8j\xf5|=U\xa1\x8f\
+\x9d hU\xcd\xfc\x01g\xc7\xd9<\xa9\x8e}\x1a\xb1p\x96\xe5\x1f\x93\x97G\xc1\xd9\
++H\xa54\xf9\xb0\x85\xa0\x94\xfc\xd9\xa2\xce=\x8a\x89`\x1c!\x88\x1f>!\xf8P@d\
+\xaf\xfa\x93\xb1<\xe4\xfb).\xc8\xcf\x83\xfd\xe6Mf\xe4\xd6\xc0\xa4\xb5\xfb\
+\xdb\x00A\x81++\\\xeau\x92Z\xff!A\xca=3\'Jcx\x94$\x18J\x01\x0e\x11\x15}P\xa7\
+\x11Gy\x1c\xc8\x13\x8e\xa6\xf7@\xfc\xea7?\xd8\xcc\x0e\xe7\x19$\x8e\xaf\x12\
+\x1f\x8a\x07\x1a|\xff\xd0\x02\x9dQ\xe0EO6[_\x14\xff\xef\xdd\x869\xb7]\xb5\
+\xaa\x95\x87[u\x88\xebo\xff\x91\x82\x10\x0cg\x11\x07A\xc9\x14\x0f%\xdb\x1b\
+\x10+kt_\x81\x9d\x17\xadu\xd0\x81?\x8f\xb4\xa73h\xfb\xbd\xc4\x92\x7f\x1d\xdc\
+i\xd1\xeb\xe4\xc1\x97B-\xfaXF\x1dM\xedm:\x0fT\x03}}\x11aa\xaa\x7f\xc1\xc2\
+\xb4\xd5\x7f\xfe\xdayL\xe9\xcf\x1f\xdd\x946\xf5\x8b\xabA%\x91\x08Hkoon\xd2RS\
+\x891#\x80b\xee\x0b\x96J\x19A\xf4GRG\xc0$0Q\x0b\nbE\xd1\xb4\xbc\xbc\xbc\x9c*\
+\x88g9\x1c4\x13\xbfh.\xcc\xe2\xb8\xa3ifX\xfe\xfdI0\xb0\xef\xc0Y\x1a\x8f\xb4\
+\xc9\xf8\x16\xad\xc3c\xf0\xb1/\x8b\xc7(?\xe3\xa8\x1a\xf8\xf3\xb5@\x98\x7f\
+\x97\x116\x89\xeb\xef\x03>~~iQ_//A\x06\x06\x94l\xb5\xc5\xc5E\xbb\xa6\xf23\
+\xc3|s\x9f\xc7\x82\xf4H\xf7\xa5\xfa\xf6\xa5\xf6w\x032%*\xb9!\x8d\xd4\xfa\x90\
+\xc2\xb7\xf4\xff\xe8\x87~#\xed\x18\x93\x90\x90\xb4\xb5\xb5U\xbe{s2\x05\xf4{A\
+\x01u\xc6\xd8\xce\xdd\xd3\xb4\x87\xd3\xc9R\xcc\xee\xeen\xaf\x19\x9c\xfe\xaaR\
+q\xbd\xady\xca\xe4Q\xac\\\xd1N\x84\xabL\x9b\x14}\xda\x88\x05\xb7\xad\x95\x15\
+\'\xf1\xa0\xa2\xb5\x95U\xed\xde\xe0 99\xb5M\x98\x85\xa5\x18\xd5\x9fT\xa5b\rp\
+\xcc\xd0\xd6"P\xceq;\xbb\xa5?4l\x1d,\xe9\x08c\x0f\x1a\xdb\x1d,\xbfh\xcf\xbd!\
+\x8dG\xb6\xdb\xd4\xd3\xc3V(\xfe\xab+j\xa4\xab\xf6}T\xcb\x96\x97t\xbd\x13[\
+\x1a\xaa\xc686\xeac\xb2&q\x96sg\xfb\xbe\t\xef6\x1a\x026\xcd\xcfFE\x92\xb6k\
+\xd2\x97\xc6-\xd6`\xfa3N\x0bvg\xd7\xebh\x06\xe3~\xd5\x95\xaftlA9\r\x02\xf6\
+\xb7S\x9e\x9e\x91\xb1\xe3\x1a\xce,\xa0C\xadS\xaa\xc9l\xfb\x13\xc8\xdd\xa3;\
+\xae\xc5\x1a\xb6\r\x8b+\x8ew\xc7\xdf\xac\xb9j\x13K&R\x94\x8aonn\x84s\x1dmm\
+\x0fv\xef[\x95\xe9\xff\xefm\x83\xc0 \x00{\xa2\x88\x9d\x9f\x9b\xeb\xba\xba]\
+\xee\xea\xeaJ4\xf1\x10\xfe\xb6\xdf\x8e\xf4Y\xd7%\xcc\x06\xe9!}\xc8\x02Ej\xae\
+|\xb3\x9apj\x8f\x93\x18\x93\xf57<\te\xd4\xad\xdb\xc7\xb8\x95\x1f\xee(_Y\xb3\
+\x89\xd7\xb2\xb2\\\\\x88H\x1cZq\xfd\x88`2W"C\xf7u{\xfe#\xc1+\x02\xaf\x0cv\t\
+\xd1{s\xf4Z\xbc\xcc\x7f\x95\xe0 \x84\x9c\x1f\x1d\x07-\xf3\x93c\x99y&\x07\x87\
+\x12O\xb1\x085\x16\x061\x85\x7f\x16\xc5\xa5\xfez\xfe\xb0G\xe4,\r\xa4\xe9\x0f\
+\xbd\xa7\xfd\xa4\xb1Df\xea\xe8\x0c\xf9B\xbf\x84\xbe\\\xeb\xde\xd5\x9dV\x0fw0\
+f\x8d\x07\x02^\xa6\x96\x1cp\xf7\xb7\xc5\xc8\xce\xde)\xf0*^\x00\xc2\x1c\xa6\
+\xbbJe\xc4?\xac6\xdeU\xd4A\xb2\x05~\x97\xa1x\xbf \'W\x19\x8e\x84\x84\x19\xc4\
+UF\xb8D1\x854\x9c\xa7\xfbM=\xc6\x13\xd0\\%\xf6\xce\x85\xda\xf2X\x13q\\/g\xc6\
+\xccv\x149\x93\x98n\xb8a"\x1cT\xa9\x95\x02Mfj\xf6\x90T\x8a\x12Q\x82\x98\xf5$\
+P"\xce\xc9\xe9\xa9\xb8\xff\xee?k\x8a\xc5\x88\xe2w\x91\x08\xae$h\xf2\x827\n\
+\x8a\xb7\xf0,\xe4\xdf)\x14;\x91m\x06\xe2\xe2\xe3\xe1\xf1\xfa>\xf4\xaa\xca\
+\xdd\x8c\xb2H\xf8\x14\x9b\xfb\xa2\xa8]\xa7\xcey0\xa9\xe4\xef\xe3W\x92N\xfe]e\
+i\xbb_uwk\x95\xd7B\r|/\xdaM\\\xf7\n\x9f\x138]2\x07\xd3\xbdA\x99\xb2\x13~\xfb\
+\x8d9\xf2\xe3\xb6\xbb\xc8\xf4v\x90\xfa\x07\x977\x99\tu_=\xb5\xdf\xa6@`\xa2t\
+\'#\r\xc9\xf7\x90\x07\x83\xe3\xf8\xab-\xc5\x04%\xe6\xbf\x99?\x98PL\xdfXMp\
+\xd3\t\xf10\x82\xfa\xe2\x9aa\xb3/L\xc5T&\x02%\xf3\x89\xa6\xe6\xcc\\\xeb1\xa9\
+\xb4Q\xc3[\x0f\x07=0\xfc<N\xdd\x16\xc8\xe0)\x97\x9fy\x90Em \xa4\xbf\x10\x1b{\
+\xf2\xff\xd1t\x96aqsm\xd7\xc6\xbd\xf8\x8d;\x14\xb7\x02\x05\x8a\xcb\x14\xa6\
+\xb8\x15w\x87\xe2V\xdc]J\xf1\xe2\xee\xc5\xdd\xdd\xdd\xdd\x8b\xbb;\xf3\x85\
+\xe7;\xde\xf9\x07\x13&a\xef\xebZk\x9d\x99\x9d\xa4\xa9\xb88,v\x91\x17\xf5\r\
+\x16\x1f\x17\xd5\x8f\x810\x04\x96m\x16\xd7B\x81-4\xc0\x17rm?L\xd5\xfa\x1f~\
+\xc2\xd9r\x1dN\x85\xb5*q\x03\xd9\xe6\xc6\xd7!\x12\xc43\xa8\xe1\xce\xf6\xeb\
+\xf4\xf3\xca\x18\xa3\x1e\xb8\xae\xc3o\xd8\xe6#9\xabH\xdd\x98y4\xbf\x071#P\
+\x7f3\xebs=u\xfa\xc1\x02Iz\x03\xf5\xb9V\x0c\x19\xd3_\xf2\xd9\x12M\x91\xdbv\
+\xfc<o\x1f^I\x95\x01\x9b\x02\n\xbb\x99\xce\x90\x9c\x9d\xd9\xf7!|\xce\x89\xea\
+\x13\xb3\x17A\x1c\xa6\xd4*\xe0\x88\xb1\xa73\x17\x90\x89\xdb\xdb*\xca5~\xab\
+\xfeL\x86\xecx\xf5\x89\xd1\x9e\xf4o\x1e\xf1\xad5\xa3\xc6b.\x1f^)]C 2\xe3\x9c\
+&\x1e\xbb\x03\xc2T9t\xf7\'\xdf\xbe\xc1\xe7\xe7i5\x12E\xc3]Q\x05\xc7\xfc\x1co\
+\xb9/n\xa3\x92\xa6\x0bZ\x8e\x11\xb3\xdc\\&{^\x0bW1\\\x17u\xc2\xe4M6\xab\xd3h\
+\xe2\xc0?fd\x9bZ\xb4\\X\x08\xfb\n\xc7\x90\x97\xc2\xbf\x90X{z{<\x06\xde\xa3\
+\xdcE0\xda\x1b\xf6\xa1\x12\x8b\xa2\xa0{\xb4\xd3ua\xa5?\xd4\xbbx.\xe2\xdd\xa3\
+\xd6\xcf\xd9\x1a/\x85\xdc\xec\xf8\xf8\x8b*)\x81%G\xbd\xc3F\x93\x93\xda\x1f\
+\xb1E<<{\x83\xa2E\xf8D\xde\x0c*BP\xf1\x08M|7\xba\xea\x82\xe3k\xb9\xf0\x88\
+\xba?\xb5D;\x0bCv\xf7c\xb0\xf7\xa8^\xd8\x04\xaf\xd1\\0\xfd|\xe3\xf1o>\x99\
+\x0e\x11\x0b\x8b\xfesj\x1cO\x89}\x94^\xc7\x89\xb4zQ\x0f\xe9\xf1\xdb\xf0\x17\
+\xb3R\x0c?\xda\x91A&f\xf3\x83\xfc|\x84\xac\x06\xc6G\xe1\x85\x95\xc6\xc6\xc6f\
+ddx\xb1\x9dH\x9b\xf1\xeb\x17\xe02\x19\x9c\xe0\xb8|\xc2\t\x18\x8b\xb3\xaae\
+\xe4\x83\x7fH\\\xf4+\xdc\xce\xe8\x95\xc0\xca\xc4i\x0b\xf6\xa8\xc9eo\x898\xe0\
+\xf3\xa1\xb1\x8c\xca~\xa9\xa1\xd2X\x10\xf1o\x82)\xc4\xfd\x9c\xfd`\x19\xa3MC\
+\xa5\x10{\xd1\xae.:x\x8b\xe5\xd9\xc2\x8b\xcd\xc0\xc0\x80\x1c\xd2\xb3\xb6\xb6\
+\xd6*%B\x1e\x14\xaa\xd0\xa3\x85U,c\x81\xa3\xad\xa8;Dj\xab<\xbd\xb7\xdd\xff\
+\xf5\xd9w\xf8\xc6\xc4\xbdb\x01\x95\x01\xeby\x16\x8e\x19\xd1\xc2\'$\x8ew)\xc3\
+P\xf8\xfd6\xa9)\xdc\xdc\xf6\xf3\x89\x81\xbe\xf0\x9a\xfav\xcf\x9f\x89>H9\xb5\
+\xe9\x9e\xc7\xf4H\x86\x16\xd5\xd5\x01\x99\xd1\x01\xdf\xb4\xd1\xe3\xceXpw\x9d\
+M\x00\x9e\xfb\xf2r\x87\x0e\x887a\xbbD\xfaGI\x19n{Kf\x19~\x9c\xe7\xe9\xd7\xdd\
+Q>\x8f\xe4\xbawcL\x8b#Yy\xde\x81CV\xdb\xfc\x12\xa0\x18\xbb\xc0\xd2\x04E\xd0b\
+mUX\x1ch\x94Cha\xa1\xe1\x1eU\xde\x0f!\xc3\xff%\xe2\xac\xad\xf1*\xff\xda\xd3\
+\xdd\xdd]\x815\x88G\xb9\x95\xd1\x9b\x8eG2\x88\xfc \xfdz\xf9o}\xf1\xa1E+y\x98\
+\x04)\xfa\x00\xb0;\x14T\x94\xdfF\x9a\xb7_\xae\x08\x95\xcb\x8f\xda\x13\xfb\
+\x9f+}:\xf3N\xee\xb1\x15\xcf\x9f\xdb.\x0eH\xd0\x11\x1f\xd0.\xf4\x93\xcb\x039\
+\xd6\xeb\xef\\0g\xc1\x98\x9c\xcfO\x99\x1d\x839\xf0\x8b\x84\x03\xfb\xc2K\xd0\
+\xde\x0e\x13d\x02\xb17(fU\xfd\xc1\xb68Z\xb4o\xfbf=\t\x11\xf2gK=Ux\xb1\x179q\
+\x13\xfa\xd0X\x84Q\x121\x1f\xc5`j`\xac`d\xcc<u\xb1\x05\x8826\xa5\xa4\xa4\xfe\
+T\x06\x1dV\xff;\x93\xd2\xf5fi\xd7gd\xc5^{?\xb5\xb7\x06C\x17\x82\xf3\x8b\x84\
+\xff\xf9\xcen\x01\x8b\x82Bx\x801\x8b\xc6\xfc\x9cB\xbd\xf3\x96\xbd%1\x14\x17\
+\x05\x1e\xfd\x07G\xeaE(\xf5\x14\xbd\x88\xc7"\xb1)\xd5d\x91\x87\xbb\xfbf#\xc7\
+\xac\x18\x08\x10\xe7,\x0f\x1e..\x00^\xda\x9f\x8eJ\x1d\x9a\xba\x8fo\r\x15\xe6\
+\x17\x16\xf4Z]\xb1\xe2\xcd\xaa~\xc1\xf2|\x90\xef\xc8\xa9\xee>t\xf1\xaf$\x89\
+\x92\xb8\xc8ioo\xcf\xce\xce.,,\xcc\xa9\x86\xa9.R\xa7#\x95\x0b\x91+\x9c\xc1\
+\xb5`\'Rf\xec\x1213N\x02Q&%1\x9d\x07\xc2\x82\xf9\xf4\x1b\x92\t\xf1\xf1|F\xb5\
+y#TK\xc5\xdb\x7f\xcf\x9c\x907\x84\xc5\xc1\xe4,\xf81\xc1\xa6PE\x89e\x83)\xf5p\
+\xf1\x13\xd6\xb7\xb4?\x9e\x1f]\xeby\x939R\xadR}\xe2\xe5sx\x00s\x11\xd9\xf3Ro\
+<\x8e\xffLII\xe9T*\x9c\xc3V\xb7\xfa!\x80\xb5\xaa\xe6dG~\xf7\xfe\xadb\xd3\x04\
+!UrE\xc7\xc3\xed\xe5\xe5\xa5\x1d\xef\xcb\xd5\xbd\xae\x9c\xf0q\x8c\x1ei\xb0@\
+\x8fL5H\xcf\xc9\xa8w\xc3\xd7\xd6\xeb\xfe\x1c\xe2\x17\xab\x8b MM\xd1\xc5J\xa6\
+\x11\xcfg\xa0\x97\x12Ve\xe5\xfd\x07^\xf9\x0c\x06/\'\xd9\xb8\x182\x84C\x07\
+\xa8\x0f.\xad\x9b4\x9ds\x98\x86v\xb3\x16\xbfH/\x8c\xd2\xd1\xe3\x97t\xe4R<\
+\xd4\x8e\xaa\xb0F\xeavT\x1f[ ]U\x89\x88.\xb8ZY\xa1\xc5\xb4.\xb2cl\xf1P\x19\
+\x80\xde\x1e\x10\xa9\xf1\xa5\x9f.\x85\x0fx\xd4\x7fkh!\xf4L\xf1\xef\xf7\xf5f3\
+LsY[\x1d\xf1\xaf\x84\x04\x91\xd2\x19\xaa\xc20\x9b\x19\xf7\x96,\x1cO\x95)\x14\
+\xce|WS\xeb\x11\xde&\x1f\x8f<g\xc1\xb06\x08\xdfzS\xbb_\xe1?%\x8b.\xac\xab\
+\xfb\x8f_\xbb\xcd\xfd?/\xe8Tn\xee\xa8\xa8(?\xeb\xa9\xa5\xa5\xb0\x81\xa3[w?\
+\xc8\x17\x12t\x11\xdf\xac\x10\xfd_\xec\xc9\xb2i\xa7\x00HdA\xb1g\xf2a\x87\xd9\
+EF\t&\x13\x85\xc2\xb1\xb0\x13\x811\xf4E8\x08\xa0\xfd\x08\x05.\xab\xaa\xaaH\
+\xf9\x7f\xe61+\x96\xee\x85\x9d\xe2\xb8\xe8^\x18\\d2,\xdf\xbd$eb\x84\xf4\x00\
+\xc5\xb2\x05\xf5\x81\xf1\x9b\x00|\x16%\x15\xcd\x84\xa6\x96\x16\x9bn\xeb\x81\
+\x1d\xef$\xf4\xe5\xe2\x94\x91nER\xe1\xf9\x8c\x99\\T\xa4\xfa\xcf\xd3\xe5!\xfd\
+\xeb\x929\xc4\x13\x8f\xf6\xc7~br\xb5\xec\xd4\xf6\xb5\x90\xd7\xdc\xe9w\xd9\
+\x05}\xa9\x8dV\xaea`byn\xa4\rd\xa7\x0b\xdeN\xf6\xe6\xe4\xdc\x81\x89\xfe\x88\
+\xfdK`\xfe\x96 \x04\x99\xaa\t\xca\x01J\x06\x05\xd3\x9e\xdf#eus =\xbd\xe3j\
+\x02\xf2bi \n\xfd\xe2\xd9\xbf\xae\x1f\x97\x91\xb7\x8c\xf6\x91\xff\x97\x83l\
+\xb6\xeb\xbd[\x8a>\xa5\x99J\t\xa5Qt\x85#E\x12\xcc\xb3\xfd\x12\x1b\xf9Q\xf7#*\
+^D\x9fi\x9d\x05WJy9\xabk\x9e\x97\xd9\xf3\x9f\xda\xdc\xdf#\x1aWv\xeb\xc2\x15\
+\n\xf4J/\x9e4[\x8f\xf2A\xda\xe8\xe4\xa2i\xee\xb8R_\x9b\xae~\xd5\xb3\xcd@\x1b\
+\\\xa4\xa7\xa7\xab\x13\\\x8aW\xbel\xef\xb7h\xff\xa4"\x1dE\x1a-"%&\xde\x19m\
+\xea3\xf4{\xcdjL\x85\xc6\xe2f\xbfK()-\xc5:\xa3\xda\xd8J\xcd\xf49k2\xdbR2\xf8\
+c\x0f\x9d\xd0g\xf8\xc5\xf5\xc2\xac\x11m~\xab\xb8\xbc<\x98\x16\xfbc6J3?BX 5\
+\xac\x1a\x02 I~\x9b\xbd\x83\xe4X_\xa9\xb0\xb4\t\xf6\xe0ex\\e\xb4\x85\xc3\xd3\
+\xbfB\xf4h\xc2.\xa1|\xcd?\x92A#\xde\xd5\x1d\x1f\xdf\xb8\x0b\xfez\x04F\x1bRH\
+\x0e\xc1\xc9e\xa7\xa0\x1d\xda\xfd\x99\x93\x10\x80\xe8\x83 \xf85idnjjje\xe5\
+\xf9\xd4\xd6\x8b\xd8\xc9J\x9f\xe4\xcf\x8d_\xb7H\xd2\x87\xeb\xcd\x81\x8fHJ\
+\x14y\xf2\xd5\xc0\x18\x1b\xa5\xcbhD\xcd\xb0\xc8\xbe\x80\xd1\xe2\xa6Eq\xdb\
+\xdd\x7f\xb5Q\xc7 \x91\x11\xcc\x9c+\xecy\xdd\x1cL\xe9\xd3\xb3\xdb\x99\xe8\
+\x9f+{l\x89\x8b\xe1\xc6\x1f\x0b&[E\x0cat\x072(i{Jl&\x01\x90\x19\xfd\xa5\xae\
+\xac\x8d\xb4\x1d\x8a\xd3:4\xf4q\x84!\xbfW`wG^&h\x93\xad\xc0Qx\xebysP\xdb\xa9\
+\xb3\x11\xea\x1fT2<\\d\\\xec\xd1=\xa8\xb7\x1fc#\x03\x91O\xf5\xca\r\xd2j\xfb\
+\xf63\xe7\x89\xeaabV0fE\x1e\x94B\xf5\xc1jq\xd7\xa1\x8a\x15\x8a\xeb\xd1\xf5P\
+\xbc;\x92\x05\x8f\xc8\xe1\xbf\x84\xff\xd8\xbc\xae\xf3\xc7\xc7\xe5\xf2\xc4\
+\xdc\xcc\xa2\x07\x02\xbe\xc0`\x90\xde\x87\xdf\xa2v\x1e\x06\xeb\xc5q\x80\xe3\
+\xa5vG6<4\xe0^\xec\xfa\xf1!\xdb_K\xc7\x9a=\xeem\xda\x9d\xf5\xd6\x1a*\xda\xdb\
+\xdfV6\x9e\xb8\xb1N=\x0c\xc8\x07\xf4\xd49\x19\x8ayE\xbe\x9d\xc3\xce\xe0\xe5`\
+\xbfH\x9c@\xed\xe0_\xa3\xd3\xd6\x14\xff\xad\xb52\xed\xefSg&\xe3\x82\xd2\t\
+\x99\xf1cT\xf2\xce\xd4\xd3\xef:8=5\xd1g\xb3\xc8\xc7E\x83\xdf\x8c\xcf\xee>\n\
+\xc2\xd7u={\xdcG\x7f\xbb\xd1\xa7!\x82\x1f\xe4\xe0\xdf\xb7\xb1l\x86\xd5\xa2\
+\xff\xe7\xa0X0\xc7\xbfo\xbd\xb1\x8c\xae_\rp\xe3\xd4\xc6\xec\x8d\xd3L?\xad+\
+\x8e\x91\x91\x91~c\xbe\x074\x03l\xf4\x18JC\x04\xec\xfa\xcd\xa9\xd0\x83pSG\
+\xb4\xe6\xa6\x13\x7f\xd77\xccG\x0c\n9L,\xae\xb0\xae\xa4,\x9a\x11\x7f\xe1>\
+\x85\xdfC\xc6\x07\x9cM\x06=\xc1\xea\xcc\xdc<<jzzl1`+U\xad\x0c>\xf92\xd5\xa4\
+\xc3\x91\xc9r\x8c\xb2Y4\x84\x80>\xc3\xaa%\xab\x83,\x7f\x0f.\x01\x81\xbf\n\
+\xf47\xeem3[ \xc8FC\xf3\x06Q\xddRAA\x01\xab^smm\xadq\x95zpH\xc8\xae\xc3\xe3\
+\xc6\xcb\xe9\x86\xd0\xec\x95\x82\x8d\x9c\x8d\x98\xd8\xa0X\xee\x87d\xcd2\x98\
+\xc4.\xa6?\x8b\xa3j\xa5s_\n\n\x07\x06\x06\xd4TUg-\x13\x04\x19$?x#\xe9\xea\
+\xf1\xfa\x88\x96\xa9f\x17\xff\xf0\xf1\x11\x06\xcb>>>\xee\xec\xec$\xf4K\x81A\
+\x13cc\xdf\xf2\xa7\xa3R\xb9\xfb\x8d.\xdf\xde\xde\xb6\xb6\x0c\xdat\xf5\x94\
+\x95\x03\xc6\x83@N\xa7\xcbuaa\xc8\xd6\xc5\xe5\x95Y\xbfCCi\x80hZ\xa5>\xba\x7f\
+\xebf*\x88\x04\xdd\xbd\xf5\xd1\xe9\xf0\xe6i/\x1c%b\xd6\xd2\x99\x97$\xd1T\x8a\
+\xf2\xbcL\xc5X\x1aL\x95\xf0\xed\xd6\xbd\r\x88\xf7\xc5*\xe6W\x87v\xbc\xc0\\\
+\x0e_\xa1\xc4\xe4\x95\x1e\x7f\xaa\x15\xe6N\x1d\x03\xc5gf\xfa\\\xef\xc9r\xc9\
+\x8e\x8e\x8d\xe9hj\x12\x11\x90\xd8\xf1\xa5\xd1\xfd\xca$\xc8$ \' \xa8\\9\xa5\
+\x8dc\xc0D\x02\xde$\x8c\xea\xef\xeb\xfbz\x1f\xb9r|\x9d\xc3\xe2\xf0\xd5\xa4\
+\xef\xe4\x84\x99k\xf9#6\xb2\x0b\x13+k?\t\xa2\xe0\t \xdc\xc0\xb8\xf2\xbf\xbfP\
+/\x9d\xa3$8\xf9\xf9\x9fm!w\xb6\x89\x94#\xef\x0fYk\xab\xc4\xe0\xe1\x14\x16\
+\x16\xe6\xe4\xcc\xad\xafg\xa5\xa3{\x8e\xd2k\xfb\xc4\xc3\xd3\xe0\xb8 W\xd8\
+\x83\xacO/,\xbcq\xe8\xd4\xaf\xfa\xbe\xfeAy\xf4\xe4\xe4\xa4*w\xc0\xf3\xfa\xfa\
+\xa0\x16\'\xa2//y\xfa\xae\xectnnN\xa9\x18\xb7\xcc\x9b\xa2R\x90\x9d\x1d\x13\r\
+a\xec\xb3\xa9:\x92r\xdf\t\xce\xdd\xbd\xfb\xba2cB\xbb\xdbF\xfe\xc8k\xe2\x0fq@\
+i\x8eou\xdb\x9d\x1e\xf7\xc6R\x01\\s\x87\xbc\xdeo\x1c\xbb\x9d\x8f&cPm\xd9\xb1\
+;\x15\x96._\r;\xd4shQ\xaa\xfd+\xbe6VZ\xba\x99ub\xc6S\xde-\x91\xb0\xceuvv\x06\
+\xc4\xfa.\x0cy\xe2\xaf$\xa5\x1a3\x02^\xbd\x8dWcI\x89Tz\xe1\xf8\xc8H\x8bSSf(\
+\xd9oAv>\xbe\xe5G\xf3\xfd\x19=\xcfe\xd3\x9a\xa64\xd6\xc2\x91/\x9f\xbf\xcc\
+\xd5V1T\x12T\xa2}`H\x18\xfe\xb1P\xaeQ\xae\x85P\x81\xae\xdb\xe1B\x1a\xcek%9*U\
+-\xbfH:3\xf3\xeb\xf0P\xfa\xf55\x006\x00\xe0#\xdb\x8e\xdb\xfa5\x1b[\x1b\x8b7^\
+\xca\x0b\x88\xca\xabp\xaa\x97\x14WN\x9b\x96\x17\xc3\xc7\xf4\x8cn\x1fSO2\x9f\
+\xabB\xa4\xd2\xc6\x0eL,?"\xcc0Ps\xb4\xf3\xb9\x97%\x9b\xd2\xe7\x0b\x82O\xf2\
+\x85\xca^\x8f\xbe\xea$\xbe\x92\xdd\xfcY-f\n\x9f\xee\x99\n\x0ez\xc3\xb1b\x02\
+\xd0\xe0\xa4\xe1\xee\xfadG\x8f\xc2\x16\xe2\xb0\xc5\xc5\n\xff\xcb\xb0SV\xc6\
+\xe9e\xf1\xc5\xed<\xee\xb2\xa1\xe7i\xfc\xc4\x01G\x82j\xcb\xf10A\xf8\xb6|\xeb\
+,\xe3\x1b\x94\x89\xec\x1amb\xf6\r\x9c\n\x8d*\xb2\xdb\xb1\x18\xe3\x1f\nz\xfb\
+\xfcb-\x85\x87d7\x05\xbd\xf9\xedn\xba\xeb\x9f\xa4\x97\xb1\x14B\xe0\x17i\xed\
+\xa71\x139\xd0\xec\xd2\x1227\x17\xde\xd0~\x86\x07\xde\x14\xdc\xbc\xfa\x1b\
+\xd5\xcb\xaf\x00a\xc1F I\x03\xe1\xa3\xd3\xb0\\\xb7\xcd\x1d\xc0$\x15\x14\xc05\
+\xc5\n|_O\x81\xfd\xc8\x12\xa7\xfeF=X\\\xef\xb2\xc7\xa1\xba\x00\x1ai\xbb\x11J\
+\xf8w\xe8\xe4\x12\xf2?\x1b\xaa\xed]\xd2\xee\xfdH\xea\xed=\xd8f\x9f\xdb9\xb5&\
+\xcea\xd2o\xf9y/_\x08P@\xb5\xc0g\x82f\x9f\xbd\xd9\x16\x98\x9d\x9d\x9cD&\xbd\
+\x00\xdb\xde*\x03Q\xc5\x08?_\x0b\xc3\x1aC\xe9\xa8\xfe3\t\x1b4\xe6\xb6G\x1b\
+\xecF<\x94\xd2\xd8N\xecfh\x97\x94\xd8|{\xe8X\xddW\xb6\xfa2,#\xe1d"\x07>k\x1d\
+J\xf7\xf9z\xc7J\xcbR\x95\xcb\xd4\xc0\xd3\x17\xfc:E\xca\xae\xb58IY\xd1\xd1\
+\x01\x19=\xe4L\xa1\x92\xb5\xb7\xbf\xbc\xba\xe2\xd0\xbc\xc9\xbee\xc4\x9a\x9b\
+\x9f\xcf6aL\x11\xcf\xe9\x00\x8b\x89%\'\x13\xda:w\xdc\x8e\xd6L\x98\x0e\x19\
+\x87\xe8\t\xa7%\'kX\xfc\xed\xc5\xb6\xc6\xd7\xfckbj\xda\xfa\x80\xcf\xc6\xca\
+\xca\xca\xcd\xc5\x95\x85c\xa4\xabK\xe6>\x88\xf1\xe1\xc3\xe3\xab7\x97m\xf4\
+\xc06\x92\r""\xe2N\x15\xef|\x1c\x10\x1b\xc5\x1d\x1ce\xe4WN]\xfez\xac\x9e\xc7\
+?\x8eoF\xe96y\xee\xb6\xdd\xaf\xb7x\x1e^uvnF\x19\x8c\\\r_\xcd\x97a\xe0\xe3\
+\xe2\x82\xf3\x95\x1e8\xc8\xbd\x17\xcf\xf5.\xb2YBT\xb5JT\x18_\xdf\x82\\\x05T\
+\xd5\x15\x16\xa7\x97\xabw\xb3YFF\xc8\x19\xfe\x0b_\x1c\x1en\xf5!\x93\xe5\xfdL\
+46:\x1a\xe9e\t\x13\xe1S\xcf!Y\xca2w|;e\xae\x92\xaf\x94]\x965sxrt4<1!\xec\xf3\
+&&-]#W\xf8\xbc\x85\xe1\xe3z<_f\xce\xe5~4[l\xce\x95\x12\x17Wc\xb4\xff\xeb\xcc\
+h\xad\x9a\x99P\x93F\xb9Z\xc9\xce\xca\xea\xe4\xe1\x12gg\x07\x87N>#2\x90Z\xa8\
+\xe2\xfc&\x993\x0c\xb4=[\xac\xac\x94\x1c\xff\xfe\xec\xf5\x17o\x1f\x17\x97z\
+\xba\xa5\x03!\xa0\xd9\x85\x85}\xec\xec0\xb9\xb5\xbf\x7fOHO\x7f=q\x9c\xf0\xbe\
+\x84<N\x17\xec\xc9\x92\x92\x92"z_\xc5\x01\xd90\xe9\x89\rk\xea\xde\xe7\xe2u\
+\x9e\xa5\x0c\x7f\\\x8f\x80\x90LWS\xd3\xfd\xbc\xed\xfe\x17)\xbf)w\xea\x94\xed\
+\x84>\xfb\xec\xec<\xc9\x17OPza\xf0\xa7\xfd\xbd=V6\x9f<\xd5\xd21SNv\xe1\xb8!\
+\x9a\x91X\xd9e\xba\xb9#\xcf(\x89\x1a\x83\x1e\x84\xa4\x999\x9f\xc7\x1ex\x88ar\
+\xbbL\xee\x14\x88\nK!c\xe7\xd2\xf5E\xf5\x85x\xe3E\xc2@\xd4\xc0\xdb\xdb\xdb\
+\xc7\xa7C\x9b\x15\xf1\x07plzT1E*\x8c\xb9S\x04(\x81x\xb0\xa8_\x83\xbe\x1e/T\
+\xdc?\xe3\xbf\xa0\xb6\xaf4\xd8&\x11\x0f\xc3\xfa\xf9z\xf4\xa7\'%\x15\xbeod\
+\xf2\xdd\xa6\xdc\xb1\x1f\x0b\x85\x85p\xf8\x03\x10<\xe4\n\x95+\x16\xe4\xe5e\
+\x11\xfd\xbb\xf4\xe9y\xb9\x9cr\xab\xaa\xb2s\xaa\xb7\xaf\xf2G"""\xb0c\xd1\xd0\
+\xd1\xef\xda7R\x93\x93\x9b\x802M\x8fvi\xd6f\x1d"\xfa\xc6E$\xe8z\x91\xc5\xa5\
+\\\xf2\x9b\xc9?[_\xd4\xdb\xaf\x00\\\xd3\xd8x\xe0\xd2"X\x93\xc1\xa2E\xa6T:\
+\x17-p\x05\x96\x93\x93st\xe4$\x19r\xa2\xee\xd3\xe7$@[\xd5\xd8_g\x119\xeby\
+\x135\r\xee\xd8\xfa\x93\xd1\xfeI \xd0\x87\xbd\x1b\x98U\x05\xc0\x00[\xfe\xa0\
+\x8f\xf1\xef\x1c3| \xfe\xbaO\xfe\xea\xa6\xcb\x7f\xb3|qq1999==\xbd\xb8H\xd0:\
+\t\xa22hX\x89&\xe5\xc7\x8b\x92\xc8\x9d:\xd8\x95N\x9as\xb3\xe4\x15^\x15\xadr\
+\x96f\x12\xb0\xd4\x86- ~9th\x99\x0c\xe0\xa5\xa33\xb3\xb0(.k\xf3\x1aK\xf9\xcc\
+\x91le\xa7\x7fQv\xd6\xa0\xc2\xf8\xfd5\xe0\xfd;\xc5\xe3\xd3\xd3\xb1\xf1q\x17\
+\xbe\xb4KW\x12N\xa6\x94G\xf3:\xbe:Mxq\x16VV\tIw\x02\x81\xe5\x0f\x0b\xc2\xea\
+\xd1\xca\xfc\x05\x85\xf6.\xf1\xdc\x7fFiG\xf1\xdd\xdb\xd6\xf9\x0cw\xd1\xefV\
+\x91\xccML>RS\x1b\xb9\xd8\xcc\xef_g\xabM\x94-\x96\xfd\xfd\xcb\xdc\xa4\xed}\
+\xb9\xdd\xe7\xe7\x07\r\xf1\xafp\xf1J\x97\xc8U,UY\xb5N\x01\xfb\x1b\x94)\xd0o_\
+\xbar\x11E\x95\xf5\x02\xea\x0eL\x85t\xbe\x92\x85\xa9)\x05\x01\xa8\x87\xbc\
+\x8e\xaf\xa32\xabs\xff\x16\x98\x84\x836i\xd0\xf9m\xab\x19a\xf5\xec\xfc<\xb6\
+\xa2b\x0c\x82\xade\xdd\xb2>\xfb\xc3V\xc8+O0\xcb\xa3\xdb\xa3K\x8b\xd7\xf3\xaf\
+S\xc6\x84#\xc0N\x14\xb5\xd4\xf8\xb9\xb9\x11\\\xbc~\xfe\xbc?\x9c),\x8d\xec\
+\xa7\xcbxhU\x05\x1a"\xd1\xc6\xcd\\\xda\xc8H\xdc\xc6\x86u/\xde,\xd3c\xde\x98;\
+\xdb=\'//0S\x0e\xb02\xc0\'dMq\xee\x7f,X:\xcfO\xc5,\xa0\xb7\xb9<^\xed\x8e$\
+\xb1\xb6\x08\x92\x95\xa9>\x03\xd9o?#\xcdO$\xab\xa1\xe1\xfe&Y\x99\x98\xccj\
+\xb1\xca\x08q&\xd0\x8e8\x9aD\xa8[:\x13DU\xa5\xdd\x00\x9e\x07\xeb;|\xf9\xf2\
+\xc5\xa1\xe9e\xbeL+\x1e\xdc(\x98\x01\xdf\xb1a\xcc\x1d\x04C\tXI\xe9\xdc\xde\
+\xbf\x7f\x9br\xd81\xda\xac\xe4$\x04\x81\x11!\x12\'R\xf9\xd8\xce\xf4\x03\xbfH\
+\xaf\x1b\x05g\x94g.\xb5\xec\x93U\xf0PX\xb0\xbe\xc5\xa3|\xa5\x8a\x19\x1cv\xef\
+\xec\xd8,-\xd7]\x98\x9d\xe5\x15\x14\x14tu\xae\xac\xad\xc5\xad\xf8\xb2iie\xe5\
+y=\xc6SXHz\xfd\xe6\xf6\xdd\xe6\xac\\\xa7%R\xc2\xc8\xc6\xc6\xe6\xbe\xeaL\x84\
+\x82\xdd}\xa6`&q\xc8\xb8\xda\x8e\xd7\xb3\x182\x9d\xc0\xa46\tc\xee\xe4\x84K\
+\xb1\xd0|\xe4\x1c\x036v\x19\x8f+\x1c/\xad\xa8`\x9bK\xfc\x15\x1d\r\x14\x7f>\
+\xc7\xe1`h]v6\xb4N6\xd9\xe3(\xb5\x95\xd4\xb21>C\xfd\xe7\x1b\xc9\x9fM:\xb6\
+\xad\x8f\xfd\xb37\xc6:\xd6k\xe4\xd3oM\x1f8\xc3\xdd*\xb3A~\xb2DZ|\xd4\n\xab\
+\xd0\xc7\x94(VV\xdc\xc4%\x1ab\xd9\n\xa2\xa2]\xeb\x85wxx\xb8T\xe3?\x9b\xb4\
+\xd5\xdb\xd9\xad}vR7\x16[\xdd8\x9bi\xebjk\xb7gO$\xb5;\\\xd6v.\xed\xa4\x0bj\
+\xc8\xd3\xd2SS\x9f\xa79\'\xac\xcc\xcdE\xa2\xf3tV~\xd6\xd5\xd7\x9a\xee\x9b\
+\x02\xca\x18=\xb0\x93a\xff\x8e\xa9\x03\x92\x13n\xda\xd8\xf3n\x037\xb5\xce\
+\xbdG\x97\xae(\xa8\xa8+\xcb\xcb%%%\x95`CO\xe5\xe9\x9d\xc1\xd1Q\xde\xe7.\x8d\
+\xd41S\x80\x82s\x15R\xe1|\x89B\x0c77O\x10\xcd\xa6X\xb9c\xc0\xda\xa4\xadG\x97\
+\x8dsG/v\xae\x16nn\x84?\xd6\x8a\xac\x9d\x0c\x1dH\x8e\x1f\x81\xe0he\xd2\xc7#|\
+~\xd9\x18Fs\xbc\x90\xca\x14\x95\x90\xad0x~\x1f0\x7fd\xc7g\xba/0\xc24\xb2u\
+\xa1\xd4\xb7\x8cRV\xcfE\xa4\x93(\x95\x8f\xd2DR\xf6W\xba.\xdf.2$$d"\x9d_\x12\
+\x84\xb3\x83\x03d\x84\x8f\x1f?V\xa9\xa3\xfd\xb8\xea\x8f"\xc6\t\xeb\xcd\xf3\
+\xaa\x06f\x87\x02,\x80\xe7s|\xda\x90\x94(\x06T\xe3!\x9b\x10it\x9f3\xdf\x9a\
+\xb2\xbc\xe0\xed\x00\xe46\xda\x84C\x03\x10H\xc0\xba\xa4\xf2Mk\xdc\x80&llT/V\
+\xd96\xcb\xd98\xeb\xee\x86Y}~y\xf1t\x15\x99\xc7b\xe2\xd9\xf7:\x9d\xfc!\x0cy\
+\x9c\x98\x8a\xd7I\xfcx|rbee\t\xba\xf9\x04\x08-7\xb7\xcb\xe3\xf4\xae:30\xc7\
+\xc9\xa3\x05\x91\x91h\xf9J\xc8>\xc3\xe7\xf7\xe7\x8bM@\t\x9c\xad\xfd\\_\xab\
+\xb7&\x1e}(kh\x01\xec\xa2\xaf\xcfW\x86\x96\xdf\xeb\xc8IW7C*\x9f\x88\x9c<\xba\
+o\xa7*!\xe1\xf0\xf0\xf0\xaan7??\xbfK\xbf\x128\x84l\x05}\x14\x05z\\\xb3q\xcf\
+\xdf`\x1a\xf6\xd1Pz\x12\xf4\xdc\x86\x05[\x9fg\xad\x91\xdf&+\xf5\xd6\xc0V\xd3\
+\xea\x87\xd7Oi\x9c\xe8u\x8c\xe7\xf2\x1dO\x85\x80w\xb4x\xafM\xaf\xae\xfe\x9d9\
+LIM}\xbd\xf6\x06\xb6|\xbe;\x05\x86\xc5k\xff\xc9\xc1Q\xa5J\xdd\xd3\xc6\xc5\
+\xc5\xd0A\xc0H6X\xbb\xbc\xa8\xa4\xbc\xfb_\xa9\x02=\xedi\\\x0c\xf8\xdf\xdd\
+\xe9J\xb0C\xcf|HC\xce\xc2\xf5\xd8\xe5%|\x07\xb9u\xc7\xd33[P\x8ft\xf6\xe4\xf4\
+I\x1a\x1d\x8fd\xfeo& 8\xb5?lG\xec\xe0\xec\x002\x0bH\xc3O>\x12\x9e`\x9b?c\xa6\
+\xd1\x03\xca\xea\n\xe6\xa4U\x86\xbeUk\xf6\xdf\xc9\xfa\xd9)|\xa3\x88y\xd6{\
+\xde\xce+\xde\x84\x83h\x06.\xd9\x07j\x19\x86\xae\xe3\x0f\xd4V/\xd0s~l\xf6\
+\xa7\xe9\x0c4\xbc\xaf\x00\xabZUO\xc5\xc5\xff\xf6e\xdc\x07r\xd7\x10\xd3\xd4\
+\xb5\x1b\xf6\x9f\x10\xd5w\xc5Q~\xdf\xb5[\xe1\x8eg\x9d\x13\x84u\xe8s\xdaD\x0c\
+Jj\x11\x10\x18G\x81CZ\xf2\x9b,\xa5\x1cR\xd5(e\xfbxI\xb6\xa7\xf1s`:\xa1\xac6\
+\x04v\x18\x1f\x06\\3\x14\xe9\xd4\xbcp\xfc\xb5\x1e\x83O\x83~\xd9\xcf\x10\x11\
+\xd5h\xe7\x8fT\xfe\xb4\x15\x87G\x9b\xeeo7\xac*\xc7\x1f\x1fNzt\x98H~\xf1S\x91\
+\xb8\xb7\x91a\xc2B\xfa\xcf\xce\xce\xe6\xe7\x8d\xafj\xaf\xfeo-\xc0<\x00;\xd0\
+\x0b\x05sG@z5\xe7rx\x1a-\x0e\xbf\x92RY\x86\xfdj\xb4\xa4t)\x14\x00\x9b\xa3\
+\xc2\xf8U\t\xe7:\xfdt(\x18\xd5\x17V\xf7-$\xc9\xeb\xfa\xba\x08\xb5\xdbq_\x86\
+\xcc\x16%\x1f\x86\x8br\xb0\x93\x02\xc3\xffNT\x8blyzi\xe9\x8b\x9dIVKKKi\xa9t\
+\xb1\x8a\xf7^\x8c\xf5\x1fD{L\xe3\xc1?Gf5\xcb"\xea|v\x9b"\xf7U6\xc1\xc8\xf5\
+\x02\xb5\xf9\r\r\x0b[v*4u\x7f\x06\xfa\xfb#%rUK\x8f\x0f\x0e\x1a{"g\x8f\xa3\
+\xc9\x04-\xb9\x93c,\xfd\xea\xc3\xb5\xcb+5\xac\x8bL\\\xff\x1e\x7f*\x1d[\xf6\
+\xfa\xfb\x9co\xdb6\xdbZ\x9c\x0f\xb9\n\xe9R\x80\x12\x91\x99\xe9/\xd0#{\x82\
+\x8f\xabH\xe1\xa9\x13\x98\xbf]\x04^l\x18\xaf0y\x16!=S\x801Cn{ \xa7\xb7\xee\
+\x90+6HIe\xd6f\xd3~F\x9b\xeb\xe5\xf6!g!xR[$\x06f\x87\x19\x11\xe3\r-\x81v2\
+\x1aT\xf2c\xcf\x86RY\xfd\xe3\xb0\xb5z\xec\xf3N\xfd\xb3\x16\xe4\x8b\xfb~Tl"s\
+\xf3S\xa4\x04\x87\x95\xf7\xeb\xf2-\xac\xf0\xe3P\xf1\xban\xcd\x12\x1c\x9bo\
+\xa8R\xb8\xff\xe3g;8\xaai\x8b\x91\x0b\x0c\x03\xf8$cC\xc4\xf4\xfaQ>\xbe\xed\
+\x0c{\xe2(\ttV\xb1\xec\xc9\x1f!\xba\xd7\xcf\xaf\xea\x96\x95\xf6\x9bQg\xb9&\
+\xf9&G\x9e\x9f\xb1\xa0\xcb\x90X\xe1\x1f7n\x7f,$%&B\xe9\xa9\xa9\xa8\xea\x7fZ\
+\x05\xe4\xc9\xe3a\x8cXK\xe8\xa4\x03\x0c\x8a\xf6\xdc\xc3"\xab\xbb\x10R(LKO?uh\
+\xa2\xa5\xa3stpXn\xb0\xf9\x10$v\xa9\x9e\x16{\xed\xafY\xd6\x1f\xa0\xad\xa9ytz\
+\xda\xf6\xc9\x8a2g;g\x1a\x91\xfco\xd2p\x1eP\x99hhh|f$\x1a\x1a\x18\xbcf$E\xce\
+Qe\x7f\xe1\xc4E\xbf\x973b\x87=x\xb6\x8bPl\xbaxp\xa5\x88Q\xc5\x0e\xe7i\x91\
+\xaf/\xaf\xae\xb6Z\xaf\x98\xc9\xd0\xe2T\x8a7i\xeb\xaa\xaa\x9ar\x11\xc5\xb8\
+\xf68\xec\xdf?\xf3X/\xcf\xae\xaf\xbf\xff\x8a\x9d\xc0\xb0\x8a\xc0}\xc1\xcc\
+\xcc\xac\xe3\xed\xe98\xc6\x0e\x94\xf8\x115H\x0c0\x17s\xda\xc7\xf1\x15\xdb\
+\x8e\r\x0f\xec\xd2\xc9\xa8\x98\xec\xbe\xce\xee\xbffg\xfd\x93\x93\xf9\xd2I\
+\xf2\x19\x02n\x808\x00\xe1\x86\x9f\x14=\x0c\xa4\xa4\xa8\xa1h\xf1\x17\xa4<\
+\xe6\xca\xfc\xabe\x80\xe7\xb7Z\xde\xf2r\xf3\xf1By\xc7\x0b\x06\x1bS\xc2p\xc7s\
+\x0b\xe4\xe7q\x8fV\x9b\xee\xf9X*\x8f\xa3\xa3\xa3b\xfb\xa9\x1d/\x90rde\xc7..\
+\xd8\xb1v\xf7\xf7\x81\xad\xa6\xa6\xa6\xf4\xd9\t\xd0\x10\x8c\x98>}/\x97*VQUUu\
+\x17\xc8\xe0\xf0Z\xaa2\x1a\xb0\xe3\xbc\xbe\xbe\x96\xa5\x9d\xe9}\x80c+<#\xfc\
+\xa9\xf1\xfeZ\x02\x92GaA!\xa0\x80\xba\x15?_\xf6\x1e\x80c\xd4\x98X\xbd\xba\
+\x92\xa4\x8d\xfbV\xb1\x10\xd2c\x80\x0eM\x83=\x04\xec\xf1#\xf6\xd0\xf4\xb4\
+\x92\xb7\xf7\x9b\x96m\x07\xa9:Z\xafm\x1f>>,\x0b\xcbX\x8c]\xaf\xd0g\xfb\xd7\
+\xa7\xcfu\x8c\x15^?Z\x9c{\x89\xc2@\x9b\x0f\xae\xabdT\xcbO\x17\xaa\xf9JK?\xcb\
+\x81\x1c\xb1\x96\xd4\xf1\xb2\x0b\xe8b\xea\xdc^\x8a\xfd\xf7x5S\x13ALt\xb6\xbe\
+\x9d\x86}S\xb3L\xef\'\x8b|1\xc2\x8e\xff$\x17\xab\xcb\xdd\xd76^\xa3!\xf67\x07\
+\x8a\xf7\x91\x1e7\x05e99\xd5\x05\x05{O\xce\xd2\xaa\xf3\xb0\x80\xd6\xff\xb7\
+\x9b\xc0W6nZc\xd0\x05Y\xea\xca\xd4ivjZ\xd5\x7f\x98\x12~3\xbf?\x83pX\xd6\xa4\
+\x1f\xf3\xf3\xf0\xf0\x9bq$_]]\xe9+\x10\xec\x93E\x0f\x1c\xda\x95\x0f\xc5\xd3\
+\xd08\x01\x85\tD3\x0f\x11\xa8{\x03\x08\xa2\xcf\xddL\x97\x9f(.$\xc2K\xedK\xac\
+\xbcE\xe4\x08\x0e\xdc^PI\t#\x94s\xd2\x13\x104\xbd\x03\xba\xa0bm\x05\xf0B\xcc\
+\xd0K\xf7\x98s\xffH\xca\x80\xcf\xf206\xdc\x9eOs%\xa3\x01\xa68\xf2\xacsvz\xbf\
+\x1c\x1d\x80[9\xda\xccecn\xc03\xafdb\xe2\xe2\x98$\xe8\xff\x0c\x8e\xdf\xdeBw\
+\xf3z\x1d\xcdNOc+\xd1\xfa\xa6\x03t\x85r\x9f\x91\x0b%#_\x04\x91\x07#]\xab\x0c\
+\x8fMY:/\xee\x0f\xef2)\x15\xd765\xb9\x19\x18\x18XXX\xd8\x1bL\x19VU~\xef\xbc\
+\xda\xb2\xdb\xdb\xdfoI\xe3\x8c\xf0\x0b\x8a\xfcL\x98L\x98\x8c\x1d\xabn\xad\
+\xfa\xbf\xabnz\x80\x88A_\xa1\xdd\xe1\xdd&\xa1L\xa0\x8e\x06\xcaU,\x1c\x89I\
+\xb8\x85\xfa\x98\xc0\xfd%\x1f\x1f%\xc8\xee\x9e\xbd\xa9\xd7\xf0S\x9df\x94/\
+\xa1\xbd+\x10\xa97\xce\x17\x0e\x9d\x0e\x12\x98\x93F\x00\xf5\x00\x18\x00HSH\
+\xb8.-\xafat\x99\x9d\xd3k\xab\xab\xda\x8a\x1a\x97\xa9z\x90=:\xe1/\xc0\x84\
+\x98\x98\x08V\x02$\xfc\x01\xc3f\xf1b3\xb8\xc2\xeb\xf4\x07\xe9\n\xbf\xd0\xf3\
+\xd2DbR\xd2\xc4\xf8X\x86\x90\xd7\xd3\xcb\xe3u[[\xe1\xba\xb0\xfd\xf4\xae\xc3\
+\xf7\xef\xdf\xb3i\xc8\xca\xac\x80\xb2WSU\xf5\x85\x18\xf8\xbd\x1b\xe1\x06\xe4\
+\r\x83\x8bHv\xe0\xeeW~\xfe\xc7N\xf2\xa6\xa6&\x05\x9eS\xfe\x15|u\xb4\xd9\x85\
+\x85\x86\xba:\xb76\xdd\xe8\x15\xea\x91\xd8\xaezI\xeb\\\xa0\xc1\x9a\xcd&2\x8e\
+\x9c\xe7h\xe3\x90u\xec\xedq~\x91\t\x96\xa8\x96FI\xec,.\xfe\x993%&\xad1\xfd;\
+\xf4\'\xc3E\xbb\xcd\xdd\xd9\xed1\x17\x98\xb5\x86\x01q\x90\xacl\xd4\xb3\xeeb\
+\xe1\x949\xabn\xe3\x81\xde\xc57\xf3\xa85\x1b\xc8f\x00\x06\rv\x98\x899\xb8t\
+\xce\xe6\xf8\x00\x08\x1cv\x13\x8d1\xd0eE\x7f\x1b\xbdOS\x96\xac\xbc\xff\xc5H\
+\xcae\x08|\x11<\x05\xccSw\x83\xe4\x9d\x19\x01JsbM\x1c\xce\x8b\x8a\x8a2y\xaa.\
+\rPS3d\x92\xf7\xb9<\x8c\xd8\x17\x0e\xec?\xb9\xb8\xa84\x19\x84\x19\n0\xe7\xca\
+Q\xdd\xc7\x99:\xf83\'|\x0e\xe9\xe7\xe9\xf8\xc4\xc7\xb7\xfc\xb3\x1e\xa8\xf6\
+\xe7\x19y\xe1\xd7\xf7\xf6~\x1eo\xc9r\xa5x\xf2\xe8\xb8\xa7q\x08\x07\xa6mwwW\
+\x9f\x9e\xdd"\xb3v\xc9j\x10\x9a\xc7\xda\xeaiY\r\xc2\xccCw\xbf{\xde\xa6\xad\
+\xa7\xd7\x01\x00\x91\xfe\xa8\xc8*\x14\x0b\xb4[\x18\x80\x9c\xd2\xb2\xa63\xe4\
+\xfdo\x85\x05t8ap\xd4\xba\x86\x18{\xd2\xaf\xaf\xea\xbb\xf4\x84\xdeP\x1b\xac\
+\xcc\xf4\xbd\xcc\x17K\xa4\xe9\xceu\xce\xa4+\xf5\xa5\xd7s\x96u\x8cll\xb6\xaf\
+\xcdDI+\xffE\xf7112988L\xdc\xde\x1a\xe4\x1cu\\Q^\xa1\xb2\xab\xbcP\xe7\x00\
+\xb2\x81\xa3\x08\xf0\xf1\xb8\x0e\xff\xf5\xd5\xd5\xaf\x8e\x9f\x02d\x11?\x05\
+\xdf\x1a\x0b\xc0=Kpo\x92 NNV\x19\xef\x83tmee\xea\xb7D`g\x0f\x94\xea]\x95\xee\
+5\xd8\xc8\xf3\xac\x85=\xc8\x92^]\xe7\x1d\xb3\x1b\xe7N\xbc\xb7\xee\x82\xf4h\
+\x9a\xd9\xb6<\x9d/@Y\xac\xb5\xba\xcd\x98\xd61$H\x05tM\xce\xaf\x973L\xbf_\x99\
+4\xe4S\xb9\nh\x1f^?0\xd9\nK\x7f\xb9W4{\x80\xb0O\x10\xd1\x07P\x9aOW\x08\xfa*\
+\xc0o1\xe6\xf1\xd8\xc8\xf9J\x84Za}\x86\x97u\xc1u(A\xdd\x9c\xc71\xa6Ra`\xb1\
+\xd8\x0f\xc4\xdc\x81b\x94\xa9s\xaajj\xfb\xb7\xee\x13\x19\x82\x80-\xbcz\xfb\
+\x88\x8b\x8b\x03\x80c&\xcc\x8b\x8a6\xb7eW\xa4R\xf2\xfeXO\x84\xdc\xfa)\xc7\
+\xfd\xf1%\xab\xfa\xecl\xe20P\xf7\xf9}\xa9J\xc9\x84\xf0\xe5\xa3+3\xfa\xf6\xcc\
+\xd6\x02\x06\xb9\x80+\xe6\xc1N\xbd\xf5\x8a\x13_\xfa\x94\xf9\xe8\xe0\xa0\xef\
+\xd4\xbc\xb0\xba-Gj\xfbC>\x9b\xe0\xc3f@\xb4\xe0\xdd\x1f\xd5R\xe7/:@\x80WM\
+\xbd\x15\xd6}\x8eNH\xf8o\xd33\xad\xc5\xe2\x87\xed\xc4\xd0\xd0k\x17\x80\xbc{\
+\xa9\x1d\xebu?\xf6\x81\xc9\xd5\xd1\xd6>qh\xda,\x01\xe7O\x8bw\x08\xa8\x94\xb0\
+xy\xde\xef\xfc\x97\xf0_\xe7\xa3 \xd9\xc4\xcd\xacSq=\x175u\xcf\xaeC\xdb\xca\
+\xf5\xb8\xbf\xcf\'\x12d\xbdf\'\x06\xa2()\x1al\xd7\xf7\xab\xc9\x93\x93\x93\
+\xbd\xcc\x9e-\x8f-SSSq\xc2@\xde\xba\xde\xa6\x12{\xad>\xed\xc3\xe6\x7f\xb9T\
+\x13-\xa5\xbb6\'\x0f\x9dhk\x86L\xeb\xd2\x85}t\xcb\xc6\xd5\x8aUl\xa2\x07\xf6\
+\xaf\t\xa3\xfa\xaf\xf1\xc7\x81\xa2\x04@\xd6z\xbd\x95\xd0\x95es\x88I\xad\x1cM\
+\x9b\xd0\xae9\r\xd0\x03\xd0\xec\xf4\xb2?\xc87p\x9e`\xf8CPP\xd0\xf9]\xabr\x1e\
+\xc3\xaf\x81\x1d\x89\xdcK\x00\xfb\xfd\xfa\xa0b\x87\xab\x99\x97\xb2\xc5CVmxb\
+\x83\x06\x89L\x99\x1c\xb3\xa2\xb7]Z\x00\xd7\x80\xec\xd9B\xeer\xa3s\x80\xa3\
+\x03\xdd\xec\xf8\xbc|\x8a\x84T@\x9e*PQP\xc8^Ws\x99F\xaa4&\xb4\x15\rb\xe4J#\
+\xfa\xb6\xff\x04\xa1^\xa1\xd6\xf2Y[}T-aY\x9bme\xe0\xa1\xe39\xf6\xfb\x0b\x84z\
+\x10\x15\x10n\x99b\xc0\xbe\xf0\x14+(:\x84\xcc\xfaFFF-?!I\x1e\x93.\x00\x10\
+\xdb\xa2a\x18\xe8n\x05\xa5\xc7\x1e\xbflvn\xae\xae\x92\x98\x86\xecE\xb1\x1cy\
+\xde\x02\x06\x02H\x86\x96\x07?\x89\xb3\x10\x1266\x98\\\x0c\x03q\x9a>&\xba[\
+\xb3\x0c]\x85\x84\xe0"\xd5\xb6\xd5\xfeq:\x1f(5h\x16\xd8\xb6@\x8cFZe\x98\x06\
+\xc4rI\xb9+|1\xfe\xa0W\xacN9 \xc5\xdb\xbd\xb9\x05\x04\xf8~\x81\xcfF\xc1r\x13\
+ \x1b\x85Q\xaf\xa60\x08\x14\xbe\x14\xa2\x90\xe7e`m@m\xeaimm\x9522\xc9\xafR\
+\xaaX\xe8\xf9\xf0~\x0e\xd0\xfb\xf4\t\xa8\x8d\x1e"\xe8;\xaak\xdc\x88>mV5[\xdb\
+\xf3"k\x80d-\xb9\x82\xa4\xf2\x1d\xec?\xb1\xf3\xefK\xe0\xf9\x86\xce\x13\xcd[:\
+kJ\xd1\xbc\xdf\x87U\nL56z36\x11\xa0\xdb\xfe\xbfkMfK\x04\x92f\xbe\xab\xab7\
+\x1a\xf4\x04WUU\xfd\xdcp\xbb?\xaa\xeb\x02\xbc2N^(9=\xdd\xeb.\xa0F\x12\x9d<L"\
+\x17\x98\x10\xc6\x84\xe1-\xbb\xde\x1d\xfb\xd49nN\xce\x9d\xd4\xcc$\xa9\xfcK\
+\xd7\xd1\x8e\xcd\xd4\xdb\xd1>\xa3Ks\xae\x140\r\x8c\x9f\x88\xbd\xbd\xbd\xbc\
+\xfc\xc4T\xae\xe4\xad\xc9\xd3\xf8\xf8\xf8C\x99+;A<\x98\x06I\xdd\xdd\xc3\x03p\
+j\x13\x8ed\xe7\xde\xe6\xcd{\xa3i\xaed\xd9\xf4h\x97\xf9\x85\x05\xdb\xd5F\xc0"\
+\xd2\x8e\xf9\x17\xaem\xe4y\xb1\xfbs\x07\x04}\x00\xc1\xb5m\x7f<v\x08\xd8:,\
+\xcc\x94\xb8\xcbkl$` \x0b\xe8\xa2\xd0\xa0\xa6\xa4\xfa\xe3N\x8f{\xe5*\xf0~+\
+\x1fS\xa9\xe4\r\x1d\xd5\x82\xe8\x8d\xf0\x80V\x10\xc8\xbb\xc3\xc7\xd5U\x9d*\
+\x06\x94;U_\xcf-\x1b\xb37\xc9\x86a\x11\xfe^\xb2\xc4<6*\xfb\xc5t\xfdt$r\x924$\
+K\xb5n\xca\x00\xa9\xd2\xe3\xba\xdf\xa7\xff\xf4X?m\x9a\xf5\xb1p\x19\xafq\x9b\
+\xd9+//oZ\xd2\xa8\x93\xfa|\x9e\x9a\xf4\xad&\xe3m{&[\xe1\x80\xa7\xe3-j\xc8\
+\x98*\'1q\xbez\xbaz+\x86\x18\xe0`\x9b\x06~\x02\xb4D\xe2\xe1}\xafk\xa9|%\xda\
+\xb1is\xaey\xac\xd2\xecUL\x94@\xae\xaf)\xfa\xec\x0f\'\x8e\x13\xba\x02>\x06\
+\xddB~M\xb4DQ\xeb\xcd\xce\xa5\xb5\xb5\x00\xca!\xe8\xe1\x84-\xba\n\xe0\xa1\
+\xc1WW\x93=\xac\xee\x0b\xf1p\x08x^\x14"n\xb8?\x9f\x02\xf8\xbe\x9b\xcd\x82\
+\xfa\xd6g\xbdR?\xb4{\xa5\xa6\xeb\xd6g\xce\xc5\xcd\xc5\xa5\xf2\xfd\xfb\xe9R\
+\x8d\x19\x90\x92\xca\xa8U\x17"\xa5\xcb\xc6\x17,\xeb\x94\x92g\xad\xb8\xd5\xd4\
+\xd4~\x84s\xf1Y\x13\x06\x06\xe3\xbdx\'\x8d\xdc\xf6\xc6\xc9\xb3>\xbc^t`\xca\
+\x18L\xf2\x91\x8eGFF\xca\xa6\xf2l\xf4\xbc\t3@\x10M \xae,W\xc6\xae!\xb1\xc6\
+\xf7\xf9\x1bZ\x99\xd2\xa0;\xe4\xe7\x81[\xc6\xedj\xcb\xca\x9f\xd0\xbc\xf6\xf6\
+B\xf57\x8cE\xd1q\x06]\xb4%\xbc\n\x9a\xf7\xf0\xcd-\xd0\x01\xea\x10\xb5\x98Y\
+\x0b\x04[\xfc[t\x06\xdc\xbd\x1b)4s\xe8ln<\x01*\x9b7\xd8@\x8c4\x8d\xc4\xfb\
+\xfde\x0f)\x14}\xc79\x94\x8f-\xbb\xfe\x023?\xeb\xa3MN\x1b\x1b\xff\xe3\xd2u\
+\xea\xf3\xd5\xa5\xbf_\xf9\x98\x9dK[c.bi\xfcA\x0c;0`\n\x17\xca\x8aP$\xf8\x81\
+\x95\x95\xf89\xe2\xea\xdfhl\xf7\xab\xb0\xdb\xf6?\x0c\x9f\x07\xf1x4\xe1\xfb\
+\x17\xc7A"1\xe4\xc4s\xcev\x7f\x7fB\xdf\x18\xde\xc6E\xa4\xda\xe3KV\x95\x9d\
+\x1a\n"F3\x11D\x98;\x84+6W\x10 >\x93QdiU\xef\xd1?\x10\xaa\xb1\x98\x10\x8bT\
+\xd8\xdb\x9f8\xd3c\xbfu\xc2\xe7\xf1\x11@\x9c_\xbf~\xbd\xaf]\xb0\x94orc\x08D\
+\x90\xcb\xfc\x02/\xf4\xdf\x0f\x1c,,\xa4&\xc3s\xa3V\x8b:\r\xc5|Du9\x15\xff\
+\x93\xb33\x89 \xec\x8f\x16\xc2lo}\x11\xf4\x15\xe3c\x8a\xb7\xad\x0bF\xf2\xe1\
+\xa2\xd4\xf4"Kbff\xfb~\xb0\x88\x93\xc6\xb2\xb8\xb2\x9b\x1c\x8eiD\xff\x85L~\
+\xc6u6Q\x97\xd9\xba?\x82_#\x7f\xcb\xa4\x1a\x9cZ^N\xc9\x81i?\x1a\x9af\xbaV\
+\xdcc\xd0DW\x8eW\xf8\x0cu%\x80|\xdb\xfd\x12`\x10\xe5\xd1q\x11\xffp\xeb1+\x90\
+\xd7\x91)\x96v\xb5\xba\xe6\xf5u5\xf3\xcb\xcb\x03\x8ey\x89\xbaa\xbc.\x89\xfbU\
+\xef7\x15\'l\xac4O4\xe6\xd9\tl\xac\x856Q\xe7\x91\xe3\xdbpF>\x8a\xd2\x88W\xf6\
+\xcfy\xd0\xc7S\xa6u\xf6\x1f\xc3\x8aN\xd7Z\x8b\xe1o\xda\x83\x83\x11\xe2M\xb7\
+\x91\xd0\x0bs\x8b\x8b\x91=\xc4\x0c\xc4r\xa7\xa0\xae%\xbb`\x84\xd1\'\x1f\x80\
+\xbck\xf0\xb2\xfd\xf9yo\xbf\x90\xb6p2\x1c\xd5+9\x0c\\8\xb3U\x08\xb8\xd7\xc5u\
+\xe8\xc1\xe5Zt@LXN\x83\xcf\xdb\xbe\xda\xc8\x07\x04\x80\xa7\x96\x975cT\xf8\
+\xa0\xc9\xd1\x0bk\xe4e\x17\x0bi\x01\x88\xf2\xf5\x1e\xe0\xa0t\xf5\x13t\xd3\
+\xa5\xc8\xae\xb7\xb4to~Vo\xe89\x9cL:\xd4\xf8\xb2\xbf\xd9\x95\xb9U\'W\x08K\
+\x8cq\x1fn\x86\xb3\xca\x03\xc8\x00\x87a\x9f5\x1dU\xeeThH\xc4y\x0e\x9a\xb1\
+\x95\xd5\t:\xe8\xdc\xe9ao_\xd1c\x80/G}\x8e\x98\x88\xa8\x91\xcb\xe8\xfelm\xcb\
+\xce\xd5\xb8WSQ#{\xe6\xd0\xdb\xed\x00\x1f\x14\x18VPZz\x0c\xe4\x06\xcf\xad\
+\x17xUB\xca\x9c\x81f2j\xaa\xc9\x8f\x06w(A\x86\xe7\xca\x1e\xc0\x1fz?\x9d\x0bG\
+\x81\xa8`\xd5\x10\xce\xd0b\x0bhoL\xc4\xc3\x03WPj\x9c`>\x0eE\x18R\x92`8\xfc9j\
+;\x85\xc4=A\xe6\xa7bz*\xc8]&\x1a\x0b\x0b\n\xd2\xd0\x0b\x95\x8a\xe1""H\x1f\
+\xa2K\xd1\x0f\x80\xe4P\xd8\xfb\xe3\xc71A?\x1d\xa5\xed7P(\xd6S\x85\xe7\xe2\
+\xcfr\x8cY\xc1\xbb\x7f\xd0\x1f\xd2\x04\xec\x1d\xcc\xcd\x07\xcd\xb9\xca\xff\
+\xfeefaI \x1c\x06\x19H\x94\xa9"~U\xc0J\xd07$\xd7Cs\xb5@2\xa0\'l\xcd\x92\xa1\
+\x88\x01C%\x1b=i\xba\xb8p\x0b\xa8\xc7\xe8\xa5\'\'Wy\xeb|\x98\xc5gH\xc6\xc1\
+\xb2\x80\x84x\xbb\x99\xdf\x14\xc8\x8a\xfd\xc8\x99*b\x96\x96\x00\x01G\xbc\xdd\
+\xb0-\x95\x8f\xad\xcdZ\xacR\xc20]\xa4\xc2\x98,S\xa0B\x0f\xe8\x82\xb9S2<7**\n\
+\xd6\x86\xd8\xba\xd9M\x01\x0bY\x87u\xe6\x1fW\xc8\xeb=\x1d\xed\xf9\xec\\`\x8f\
+\xb4~\xea\xa6<\x10\x84\xbc\x99\xda-fh\x03\xba*\xab\xabc\xe3\xe2\x8c\xd8\t\
+\xb6/\x1fnj\x03\xb0\xc3\x12\xe7\xf1j\x96\xac\xb8!\xe5b\xdc\xc2\xc2\xe4\xc2\
+\x88"\xfd\xb6\xde\xaf\xa9\x80\x89\x03\x06p\'T\x87?\x03\x9d\x11\xda\xb3\xd5\
+\xe8\xd4$L\xa2\xdb\xec\xf5|W\xa6\xd5@\x83\x8d\xbcjQ\x8e\xd4\x1fO\x1974<<\x1c\
+:x~\xbf0;ken\xbe8\x7fI(k\x103\xb3e\xe7!\x00\x04\xf6"p\x00\x1c\x8a\x1d\x7f\
+\xb1\nc\xdc\xd0\x89K\xcbF\xc7\xef\x84[\xdf\xecU\x05mm4\nv\x12tb4\x84~\xa9\
+\xd0\x83\xd1C\xce\x99\x99_\xae\xcc\xba\xea\xea\xa1\xa5(\x08\x01\xf1`\x8aphBn\
+\xa2(\xa2(\x89|%\xb7\x97\x87\xb0\xc3C\x8b0\x90!w\xaa\t\x87\x06W3I\xc4\xc0\
+\x7f(}E\xd6*\xd5\x1293\x87\x0e\x8e\x8ef\xfb\xa6\xb6hZ\x1c\xf3\xc6\xab\xcd\
+\xce?\x8c{K\xe6,\x81\x94\x18t\x8d\xffv\xab\x07q\x9e)\x90\r\xdd\xccp\xbb[\xaa\
+\xfb12q\x9b\x0e\xf8K\x8d\xe3\x19\xc0\nB\x15\xf2\xd5\x12\xdb.\x1e\xb3\x8c\t\
+\xd9\xab\xbeq\x12\xb9S\xae/\xf5*\x8c\xce\x13\x8du|e=\x9f\xd6\xe6\xe7\x13\xc1\
+4@fnl\xadn%P\xff\x93\x96\xc2\xcc\xca\x88\xce\x8c\xb0\xeeq.\x18YTc6\x01\xc8\
+\x017\x0f\xcf\x0f\xae\x14R~\x97Z\x1b\x8b\xd7\xb1\n\x1f\xc7\xdb\xe5\xac\x05\
+\x1e\x1e\x8b\xcc\x94\xf4\xd4\xcf\xa9c\xd1\xe7\xde\xab\x87\x0e\xcdkd\xcc\xcf\
+\x12\xb9\x9f\xf0"\xfav.\xdbk\xbc\x00\xa2\xbe\xb9\xbf\xef\xb8u\xb9\xbf=^\xb88\
+W=Q\xd5\xd1!egFC\xa0\xed\xa0\xdc\xeaK\xbc\xcd\xac\x83\xf0\xac{\xf6\xec\\\xd6\
+\xd6\xd5\xcd\t\xaboLO7\xffx.\xf7 I\xca\xf6(\\AV\xc7\xd6\x10\xa4\xf2\xbf\x1c\
+\x1dm\xc4\xfc\xea\xe8\xf7{\xe4T\x0c\x14\xd5\x07\x10\xd1\x10\x9f!|p\xd8\xb9\
+\x8d\xb9\xb9\xba\xaeny\xd1_s\x0b\x8b\xb2\xe2b\xe8SaiZ\xd8t<\x12\xd0(\x1b\x03\
+\t\x1c\x9a\xd3qh\x82[\xaf\xaf\x8c\xfe\x043\xd5\xe8C\xa6s\xaf\xfb\xed\xd1wP\t\
+\xb3\xe0\xe8\x00%U\xd2JB\\\x1c*\x19W\x01`\x89v\x00\x022%U\xa0a`h\x05\x07\x03\
+\x03K\xff\x0fE6\xa6\x00x\x95\x95\xb1\x90 S{Fm\x84K\x83\xfd\x9b\xe3\x0f\x8b\
+\x0f\xc1\xbc\xd8Hp0\x11\xd0\x07\x8b\xef\xa0\x1a=\x90\xc6:\x90\xf2\x99p\xd5\
+\xcf\xect\x19\x05\nz\x05\x08\x98\x00\x1e\xbd\xb4z\xfe\xf9\x10)\xcc#Y\xd7Z}r;\
+\xf6\xf8\xbf\xbb\x1d\xc4\xc8\xd0\xc2\x0e\xfb\xe2\xa6L\x99\xaf\x02\xde\xa9\
+\xa5E\xccl<"\xae\xb5]\xf5\xd0/K\xfc\xf5a\x0fq\x03\xd2\xb5\xd5#9\xbc\x90h\xbb\
+\xd1\xbe\xb6\xeb\xa0\xd3\xee\xe4\xe6b\xc3M\x80\xb6\xedo\xdbg\x03\x10\t0\xfc\
+\xd4w\x12\xc3"\xc5*\xeds\xaf\xf37\xb3\xb5|\xf2\xa7\xd7\x8f$\xbf\x0e\x15\xd8U\
+\xb4\xd4\x88\x91\xe0\x80\xe3\xc5\x0c\xb5Ynu;]\xbe\x02*(s\xe2\xbe\xae\xc2\xeb\
+\xc37\x06 ^G\xf4\xf5\xf7\xf7spp\xbc\xdf\xca\xddq_\x0eS3J\x82z\xb1\x1d\x98\
+\x9b\xde\x9d\xcb\xc8H4\x02a\xac\xa8e\x89Se\x1c>k\r\x03\x83\xec\x9e\xad\xa2\
+\xff]K\x0f\xb8r.\xc3\xac9\xca\x0fK\xcb\xf14!\xc7\xb7\x97  b\x13G\xf5\x87\x90\
+{?\xf4\x86\xc5\xf9\xf5\x89\x14\xd7\xcf:\xac\xc1|2|\x9e\r\xfc_%\xa4\x11d\xaak\
+jZZ[\x8f\x8d\xc6\'&&\xd6\xd7\xd7\xffZ\xb6\x1a\x1b\x1b;\xd5jh\x7f#\x87|\x12<u\
+\xbd\x1a\xa2\x03\xc0\xa3\\\xbb\xfdJ2Z\xc8\xc5\xc8\xf5\xe0\x04\xd1Lq=Wu\x9f\
+\x1a\xc286\x1a\xd9gh\xce\x955s\x98\xa2\x95\xb2P\xa6\xc5cY\xf35G1\xaa`\xf2\
+\xd4\xc5\xcc\xd441>\xde\xb7\x1f\x16\xa5`\xca\xbc\xd5\xee\xcd\xdfd\xf0\xca\
+\xfb|\xa8I\xe3<\x82\xad]\xfd\xff\xdfp\x85g\xc3\xb3\xa6\xe1>^\x8c\xd5\xe7fJ\
+\xd2\x9a\x9a\xbb\xc2\x16\xddY\x14\xa0\xc1{\xd5{\xad\xc4c\xbc2U\x0fGO\x00w\
+\x06v\xec\x9b\xb4\xc9P\x82\xc6\xd3\x04\xdb\xca\xdd\xd3\x0b\xc0;\xf7l\xe6\xd2\
+\xce\x00\x9c\x85_\r\x0b\xbf\x1ee\x12\xa1!l\xaaV\xba\xad\xf2dq\xe2\x8f\xeb\
+\x01\xb5\xd5\xf6sl\x9d\xee\x16\xd2\xf1\xb6\xcfVn\xb9\xef\x1a\xb3\xbd\xbe\x13\
+\xa4\xee\xdc\xc9_)\xcc\xe6>n\xc8;v\x1aN\x80\xb4I&\xca\x10\xe2O\x81\xef}*\xbd\
+\xe1\x19\xe6\xe8p\xa8#\xde\xb9h`\x88\xd1\x10\x9a\xdf"\x8e}2:\xb7i\xde\xcar\
+\x17\xb5mT\xf0\xa0\x02@V\xd5R\xc6\x92\xf1\xde\xaf\x14\xbbG\xcc\x8b\x9a\x17X\
+\xc9\x93\xa2\xad&\xa3S\xa2\x0f\x8c\x82\xf4\x1a\xab\x8c\xaa\x9b\'\x8bM;\x8bSF\
+sss\x7f\x03\x93\xa9\xea\x11U1\xde\xd7\xb6l\xa2\xdb\xedl=Q\x153\xb8\xe0\xed\
+\xf7\xcfM\x08\xde3\x7fD\xf5\xc0\x94\xbc@\x89v7H\x1a\t\x92\xca\xdb\xf8N\xcf\
+\xf0\x1f\xbd\x89A\x98\x9c\x93\x04ZH\x0f":\tTu\xa5\xd1>\xd0\xbd\xe8\xe7ijNR\t\
+R\xf9\xf4g\xc3\xafv@9   \x8c\xd2r"J6F\x96\x0f\xb4P\xc5\x84\xce\x99\x06Y}Rf\
+\x0c+:\xb7"\x17#F\xa2"\x13tw\x02l\xa7\xc5\xe5\xf4\x84\x7f\xe5\xe7\xcd\x81b\
+\x16%zH@\x9fb(=v\x94\xc3\\\xdc\xc8n8(\xb7\x03\x07=vdJ\x11\x05vb\xe7\x12\x94\
+\xa3\xe8\x89J\x84b\xae\xae\xfd[\xaf\xf3t\x08Z\xa4\x92+`\xc9X\xc8\xfd\xa6H\
+\xaep\x05\x80&6\x8cW1\xbd\x82\x8d\xe7\xd9uR\xfe\x9f\xad7cIHG21H\x18\x9c^\xc9\
+\xed@@\xa9\xf5\xf68\xd4b\xcbf\x96\xcd\x9dbG\xe9\xdc\xf9\r7\x05W\xab\xf9\xb5\
+\x8d\xbb\x92\x8c$\xaa\x8fW\xa3\x0f77%\xda.\xfaT\xe8\xc2\xc7\x9e\xff\xaa\xb4\
+\x07r\xec\x03\xc1\xfcZ\xa7\x7f\xceG\x82\xfeo\xab\x8al\xef\xdf?\xc3t\xba\x9cx\
+"\xe2\xbd\x97\x08DP\x13\xcc\xb4wk-\xd5\x12\x82$\x14XH\xd8;\xeflq\xe5\xfd6\
+\xab\x9c\x13B\x11\x02>\xb2\xb2\x1f\xba\x11\x8d\xf7\x00Q\xafx\x91q\xc7\x92\
+\x1f\xfb\x05\x85\x9e\x00\xa6\xf9-\x16\x07\xa6\t\x03m\xd7\xa4\xa7\x83O`\xa5D\
+\xdd\xfdu\x08\x8e\x0f\x90\x8eP;\x95]xItt\xa2\xe7\xe6\xe7\x88\xd0\x82ccc\x97\
+\x96\x96\xee\xdd\xd7\x99\x98\x99#%r#""\xfc\xf4\x7f\x87\xc2te\xa90\xde\xb2=\
+\xe0\xc1\xa2n]L\xef\xc9\xa6jii\xd5\xd4\xd4\xa0\xa2\xa2\x86\r*\xd8\xfc\xfe\
+\x1b\x13\xb9,\xc1\x14\x95P47w\xe8\x04&\x19\x1f\x1b\x93}\x7f\x0e\xa8\\a\x9c\
+\xc9\xd0\xa8\xa9#\x80\x7f\x00o\xcf\xff\x93M\xe5\xbe\xbd\xbb[>u\t\x03\xc1\xf0\
+\x92\xdaKr\x11\t:>\x8d><<HY\xedv?\xa2\x92\xeb\xbe\xd8\xd9\xdb\x03|\xf5\x1c\
+\xc0i\xb6\xb7\xb7\x07\xa4\x0f\x04D\xc4\xad\xb9\x9e6\xba\x1c\x05z\xa7\xbd\x9b\
+\xe47\xe9\xd7\xfc\xfc|\x00\x0f\xc9\x00X\xbc\x1d\x1bw\xdb4\xc9\xe2\x0e\x0ee^`\
+\x91\x17\xb8\xecU{\xfb\xc74Hmjl,#\'\x87\x10 \x1a\xbdB\xadA-\xaa3\xe6q\xde\
+\x86\xf8\x9fB\xcb\x9a\x1c\xa8J\x9d\x19;\x0c\x17\x1f_\x8b\x19o\xd6i\xb3\xc9U \
+\x03\xcc\xab\x04\xd1o3\x8e\x02\x15\xabl?d+\xd0\xf3\xf0\xf0\xb0\xb1M\x98\xd6\
+\x14;8\xd6i\x02\x9c\x04O\n\xceW\xfa6\x0f6d\xaa\xd2g?p\xfa\x82\xf9Av\x99\xee#\
+\xcd\xa1{\xeb1\xa056\rt\x95\x04\n\x8c\t\xbe\xdb?\x16\x16\xea\xeb\x1a\x9a\xcc\
+V\x95\x8a\x9d\xba\x85\xb0\x90%\xa5\xea\xf2\x01\x90\xd7,\x9b\xb7\xe2\x06\xa0\
+\xbd\xb9\x99\xafp\xe6q\x90::k\x9b\x97,"\xf3u\xf3\xc4P\x9f\x92G\xf2\xbf(\t\
+\xa3*W\x012@\x80\x94J\xe7\xea\x15\x8f\xaf\xae\x1chH\xfc\xa8\xd9-2U\x06\xff\
+\xb3\xac#\x92\xd9\x02\xfe]`\xd4\xd2\xf9\xbc,\xdd\xdc\x96>\x9dR\xe4\x00\x95\r\
+\x8c\xcb\x84\xd7\x99\xe3\x18\xcbX\xd1\xcf\xf5v#\x0f/\xaf\xd7\xcd\xcd\xcdb\
+\xe5B\xef\xe7\x95\x8dac\x0e\x05\x82u\xb7\xe7\xf4\xb86:\x80\x1fB\x07\xb6\xaf\
+\xdb\x1f\x0b\xa2d\t\xb0yl\xd7\x05\x1c\x9f\xd0\x90\x90\x96\x95t\xcc\xcc\n\xa7\
+\xcc_^p2C\xf4"=\xf1\x8e\xb47\x91\xf4U\xd8X\x99i\xb1\xc3RRR\x84G\x9f2\xdb\r~\
+\xc9K\xbeM\xe7c}\xf5\xfd\x1d[j\x1e\xfe\x87\xbc\x05v\xff\xe9\x89\x9dT\x8c8\
+\x00\xaeK\xa6ba\x84\x0f\xc2\x90\x95\xdeg\xd8\xa5\xf9!\xd9K\xb1!\xe4\x0c\x8fb\
+\xb7"\xa2\xed\xe7\xa3e\x956gJ\xf7\xb6e\xa37\r\x16\xaf\x06R\x83\x98\nt\x88!>\
+\x95\xbaHW|\xfcA\x811"\x13\xd2\xb9r\xb5HB`\x86^|\xfc\r]\x8e\x1f\x13\xac\xc8Z\
+\xe5\x1b\xec"NWe\xfc\xc0\'nn\x84K\x9f\xd0ob*\x92\xcay\xf6\xbc$)T\x1fT\x04EvL\
+\x0c\xa8fU\x0bI\x8e\xc6?\xf3\x93v)\xe8[:\xa0X\x8fP\xb4t\xc7U\xc8\x15\xf2;<\
+\x0c\xb6\xfa\xbcm\xcac\x88\x15\xc3/ \x1f\xb6\xd8\xf1Z\xd5,W\xd6\xd7 \xd0n\
+\xe0EIp\n\t\x95+\xd0\xfb&Bn6|\xc2S\xa1LY\xb1n\xd3Ow\x10\xfe\xf1R\xe8\xb3c/\
+\xb3\x1e8\xf1=\xf0\x02\xf4jp\x9a\xaeO\xaf\x0f\x84\xfe9\xd4=\xb6f\x02\xd8r:*W\
+<\x91\xef\x88\xe5h\xfan\r\xf2\x8b\x8av}|T\xa0@\xa6\x7f\xed{P\xe6SyHL\xec|\
+\xa8G\xb7\xee^\xc9o\xfd\x83\n4D\x00=\xae\x01}O\x1d\x12\x1d\x19\x15%\xfamn+OM\
+\xcf\xeb?(!\xef\x13\x80q=<<\xf4\xde\xd6G\xacOO\xf1"\xe0\xc1\x94R\x1d\xd9\xe6\
+\xe0o\x9f%\x91\xe0D;\xe0r\xe1\x19\xff\xbe_\x8c\xafMB\xec.\xdf\xbd\r\xaa\xe7\
+\xaf\x8f\x96\xae\n[)\xd4\x86\x1c[\x1e\xd7\xd7\x0b\xb72^\x99\x91\x92f\x1b\xcb\
+b\xe3\x04\x8eH\x8d\xfc\x11\x8a\xc4$\x85\x13\n|\xfd\xd3\xf3\xab\xe3\xe7\x0b\
+\xd0&\xe1\x11\x11\xa5%%@\x9b\xec:\xb8\x1d\'\xaaRU\xffR733\xf3\x0b7\xb8\x15i\
+\x97\xa2\x8a\x19\x1d\x1f\x07\x18\xaf\xbd\xbd\x9d\xb3p\x82\x99\x99\xb9h\xee\
+\x08\x15\x9f\x95B\x19>?$*\x95\xdb\xbf\xd9c\xf7*!(\x08>Y\x06\xc1\xd5\x160k\
+\x85\x93\xae\x13\x11\xed2\x19\xda\x9da=\x15\x1c\x83]D\x820\xf2\xd0\x07B\xe6\
+\x86\xad-\x03\xe3<\xc5=\xac\x88>\x91\x1a@0S\x06NEIZ\x1a\x1bC+W9\x8f\x19\x98\
+\xe9UvK\xa8\xa6\xccy[\xe1\xaa\xca\xf4\xd9\xcd\x9bl\xb6|\xb5\xf3\x95\xbe\xab\
+\xa9\x01\xdd\x14B\xbd\x05\xec\xba\xb6\xa1\xc1\xcc\xd88\x8b\x9e\x17\x17\x852\
+\x99-\x06l7\xe0\xd4\xcc\xcf\x95w\x99\xba\x93\xd5\x02\x17 Z;\x1f#\x95?Jqtt\
+\x84\x02\x07\x93\xad`\x0e\x1c\nP\xe3\xba>\xaf\xb7\xc0\x16\xd1\xdeg\x8a\x05\
+\x94[\xe6\x1f?~th\xf2\x9c\xe5v?\x13#\x7f(|\x1f\xb5\x8f\xd8T0\x85\x04ymOO\xee\
+\x00\xc8\x03\xfdX\x95\xf0\xc7\xc4\x9c\xbe\x92`p|\x1c\xd0esv\x82\xd1\xd1\xc1Y\
+\\\x0b\xc6\xa8\x04\xe0\x8fo1\xe6s\xb7\xebJJP\xd0\xc0\x02\xbd\xeb\xeb\xeb\x15\
+/Cj\x96?\x8e\xbd/\xaf3\x8d\xeaB\xfc\xf5\x99\xf1\xf8\x1d\x9fd\x98\xf1\x1cyI\
+\x01\xcd\x13\xa1\xc8\x9a2\xaf\x17j\xad\xfb\xfb\xf7/0|\x8d\x8d\xbcDQW\x98\x8c\
+\x0c\x0ca *\xc7\x1a\xc7rB|\xf1l\x11\xf1\xab\xeb+\xa0w\x013\x9f\xb3\xbc}x\xe8\
+\x8d2\x18\xc9\xf3\xc2\x1eJR\xb2\xb6\x90\x95\x1d\xcb\x97N\xda\x7f\xbd\xfe\xde\
+oy\x01!"&\x0ea\x16\xbf~{\x04\x1a\x1c\xad);;[q\xa5\xa8^\xa5\x94a\xda\xf3\xed:\
+S\xef\x82\x8d\x95\x8d\xadgjp\xd8=\xab\xb6\x167o\x14\xc8`a\xa0\xceM\xd0\xf7\
+\xb9\xe9\xe9\xd8\xdd\xe6\xaf\xd9\n\x7f5\xe2\xb6\xf4.\xa0\x91n\x9e\xf1989\xa3\
+\xc9\x85\x81\x9f\x80\xd4\x95\xad0h\xc5}\xea\xe3\xecC_[\xdbZ\xfd\x97e\xaex\
+\xee(a7\x01 @\xe4\xb2\xa1aw\x11\xca$\xe9y\xf0\xff\x1eT\xee\xd4\xb2\x96\xff\
+\xf1\xe3\xa9\xd6\n\xe4\x9f<\xe4_\xc5\xdbS\x85\xa8Q@\rs\xf5\x0e\xe8\x8a\x98z;\
+3\x0fk\xd2kEX\x05J\x1d\xa9s\xd7\xe56\xfdxGS\xdf\xb9=e\xcd\xa3\xaa5\xe9\x8b\
+\xa7\x08\x03c\xacN\xf3fNns{^\x1e\x1cZN_P_*\x8f-\x10\xe6eV.\xd5=ML\xfa\xf4\
+\xd9\x81\xc4\xfc\xd5\xcd\xed5\xe0\x16x\x03A+5TJJ\xea\xfd\xa4\x9aG{e\xa1\xd7\
+\xf1\xfc\xee\xeenIII\xf9\x00yEq\xf1\'\x02\xb4\xe3\x85\xb9\xd9\xb9\xf9\xe2\
+\xeb9@\x90\x80<\x14\xed\xb9\x17\xb3\xbc\xccW\xa7\xd9\xf7%4\xb9\xc5\x83%\xac\
+\xd6$\xa3c\xfa\x98\x88-\xad\xc3\xd7\x9c\n\x17\xc5\xa0k\xb5\xe5\xa7-`\xe0 \
+\xaa\x9e\x9e\x1e\xb2\x06I\xc6\xb8\xed\x8d\xd1Q4\x12o\x80C\xc6\xe2\xfd3W\xa6\
+\xa7IP\x02=\x85\xc8{\xdd6\xa7\x12\x80\x10\xf5\\UY\t`\xd1\xf4\xe4$\xd0\xd1\
+\x92\x92\x92#\xc3\xc3\xef_\x91\xc5\xa5\xce\x1c\xaa\x14\xab\xa4\xa7\xa7\x03\
+\x06\xf7\x07\xd7\x89/}\xc8\xb8\x1b\xeb\xc4\xc5\xc3T\x82V\xf3gB\x05\x8b\x1ac\
+\x02\xe6\nB\x08\x8a\t{\x8c]\xde\xf5\x94\x1c\x15P\x8d\xf1\xa0\xe7\xb0A}v\xa0\
+\xaf\xd3\xf9\x7f\xa2\xf7WL\x99322A\x91\x03\x0e\xe3\x9f\x06\xcbDJB2:6fme\x15\
+\xff7&\xad\xc3\xcef,%\xb2\xd30\xab\xa4\xe4\xe8:\x13\xd2\n|\xba\x8c(\xc8\xbd\
+\x8d\xcc\xc6\xe7\xfb\xf7\xb9\xe1a\x14\xb9\xaa\xeaj\x0e>\xbe\x14\x00D\xb4\x1b\
+}st\x04D\x03\x07\x80C\xd1"[v\x00\xdc\xa4\xa0\xe0=x\x12\xa0\xa6\x88e\x8b\x88R\
+V@@\xf1qq\x9c_\xbeh\xa8\xab#\x99\xea\xda+2\xe0\x14\xc5\x87[\x8d^\xf1\xa5\x97\
+WUQr*77\x12@a\xf2\x1e\'\xb7\xb8\xdfZr\x11\xb9m\x05\xe1\xbf\xadl\xbc4\xc0w@\
+\xd6~\xae\x97\x95\x95\xae\xd5\x98a\xc0\x14\x014\x07\x04\xff4A\x8fy\xd3\x9a\
+\xa1\xdd+0oue%\xbb\xe0\xa9\xc2\xee\xde^\xf15\xa6\xf9\xc3+j\x10|\x90\\R.X\x99\
+&A*)))\xcc\xdce<.\x99!hY\x8c\x02\xf3\xb7T\xbeyA\xb0\xc6\xa1\xea\xc9|\xab\x0f\
+\x19\xda\xd9\xa1\xc5\x80\xff\x86\x9e\xba\xba9w\xaa\x99\xa0#c\xc2\xb0\x15\xb7\
+\xed\xff\x16\xaa\x18}5\xf9\xaa\x18CK\x14\xa5\x19\xcc\xcc4\xc2\xc4Q\xfc\xb7\
+\xac\xed\xf4\xbc\xe3\xf9\x1e\xa8\x86\xf2\xb2\xb2\x1e\xaapxr\x84\xbe\xdc\xfb\
+\xa7\xba\xe3"\xf9\xae\x88\x1a\xf24\x1d]\xddv\xc9%r\xdb\xccA\x88\xe4\x0cY\xa7\
+\xf4\xaa\xae\x7fl\xce\xfd\xdf6:\xbeG\xbbnh\xc5\xac\xf3\xf7S\xa5/v\x8a0\xf4}F\
+\x06\xfbi\x81\x08\xedh\x84\x0e\x83\x14(\x9c\xd3k\xe9\x18_\xdb}\x8b\x98\x07oh\
+\xda\x05.\xfdg\x18\xc4s\xac\x14\xc3\xff\x95\x0e&\x8a\x1a\x91\xb4\xe9F\xc3p4>\
+e\xad\xea\xc3*\xafY\xd6\x8c?\xef\xfb\xa1n{\x99wS\x1c~\xe4F\xa7\xcc\x01\xd3\
+\xf8\xa7\xbe\xaf\xd5\xf7>Le\xbb\xcc\x1ax\rQ%\x07\x0b\x91P\x00\x1e\xd0x\x13c\
+\x07\xd7J]\x15B\x94\xfbG\xa1\xfe=\xa9\xd93f4}\n\x82\x87\x07\x02*wi\x19E\x07\
+\x14\x12\x0eh \xd3\xe3\xed\x0b\xc2Pc^\xc5\xfd\xeb:\xe0[\x13>\x8fn \xf5\x8biQ\
+\x84l.\xebs\x00\x06}\xc5\xdat\xd9\x8e\x1e\xb3(\xd0\xbeS\x1d\\O\xaea}\xa8IU\
+\xd7#pp\xf7\xc5\xbe\xf8z\xf0\xc2\x88\x8b\xf2\x86\xab3d\x0f\xdbU&RZ\x01d\xd6\
+\xf2rVz\xf4\x00\xdc\x8bd\xc9\xfa\xb9\x85\x85\\\x84\x1b|a\xc8\xfbm\xd6R\xb8\
+\xb9\xdf\x17)\x07\xa7\xf5\x19\x8a\xben\xa4#0R\x07V\xbc?\xc6\xf5\xfd\x16\x07\
+\tR\x9cXk\x04\x84%\xf4\x15\xc6\xc8\xfd3fr^\x97\x87l\xa7^\x96\xe7?\xdb\xafIk\
+\x86V\xdb\xeb\xd2\x93\xc1\x80k\xe2T\x81\x7f\xab\x01\x14\x04\xfa\xb9\x8d~\xe3\
+\xce\x9e,K\xba\xc2\xefK\x1e\x11\xa0:\xbb&S\x98\x16C!\x9c\xc9\xaa\xef\x15}\
+\x1a\xd7\x0f\xc9ybY\xff\xa6\xb6\x83\xcfv<$\xe8\xf1\xe7w\xa0(\xec\x88\xfc>]e\
+\x1f\xcc\xaf\xe0\xb2\xf7\x95\x82\x9a\x891t\xcc\xe7\xff\xb7\x16`\x84\xf8\x9b\
+\xb9\x08U\x06\xaa(\xef\xa0\xe5\xa6f`\xcf\x16\x10v\xd3\x04\xecc\xff\xeb\xedc\
+\x1a\xc0\x7f\x8c\xb5\xc3\xb4W\x95j\xca>L]8\x06\xa2\xa0\xfa\x9dm$\xda\x7f\x13\
+Ir\xb2r\x94\xff\xda?q\xc0\xe5\xe1\xeb\x9c\xe1J\xf5\xa5\x17\xea\x16\xec\xd7\
+\x7fQ\xe80\x94\x90\n\xa7o\x04\x17\xd3\xe4$u\xdc_E\xf8\\R\xf1\x9a\x99\xf3D\
+\x1al\xdd\xba\x1b\xa8\xb4R\xfeAT\x0e\xf5\xd3\xa3\x9d\xc6T\x94\x97\x97\xa7!\
+\x11\r\x11\x93\x1a\xa7\x05\xc1\rj\x16\xce@\x13\x84\xa0\x08\xc2u\xf4\xf9\x92\
+\xe3\xa3QQ_\xf8\xa8|\xe0\xe1\xe2bw\x85F\x84\xf6\x08\xee1X\x95\t\x86\xea\xad\
+\x0f\xf2e|\xa0\xe3%A_\x14\x96\xce\x80\x17\x87\xa6A\xed\xb4=\\\\\xc7B\x0f\xf9\
+\xd4\xa0i\xad\x1a\xa4\xd4\x05\xc7\x9f;\x15\x8a\x0e\xbf\xaaAB\x0cc1{\x942J\
+\xfb\x12\xc8\xbf\x16u\xeb\x1e\xd1\x07\xf3_\x13\xf0\xaf\x11D\xf5\xaby\xdf\x0c\
+\xbf#\x8f\xc9\x9dr\xde\xb3\xa3\xa3\n,,,hvy\x19\xe5ir\xf6\x86K$\x04\xcc\x85R\
+\x82\xd1\xdb\xfd\xbb\x1d9\x18FyfF\xb7\xa2\xc1M\x19\x95\x87\x99:\x9b\x8b8\x14\
+V\xce\xaf\x18\xeej\xf8\xcf\xf0g\xa2\x0f\xa0\xc9^\xd0\xe2@\x1d\xa5z]+\xbe\x9e\
+\x9e3$\xfe\x14\xe7\x11B\x01y\xfff\x9f,\xe2|\xb9\x9d)\x1f\x84q\x01ki!\x9e=\
+\x19t\x8d\x8f\x80\x88\x00tc\x93\x0c\x12\x1b\xd4\xdbN\xfa^\x14\x8b\xef\x13\
+\xe5T\x10l\xc9\xf5\xdc\xa2_\xa8\xd0\xcaR\xd3\xe6=\x1d6r\x9b\xae\xcf\xd6K\x10\
+|\x07\xb91\x82\xf1\x83\x1f\xc5f\xdd\xcc\xd6\xea\xd5d\xe2X*\x0f\xf0\xe6\xef\
+\x8bs\xb0\x14\x9e\x85\x8c)\x8e\x04\xfb\xf3uNf\xe6\x15\xb1\x1a\x8b\xf5\x9e\
+\xd6h\x0c@\x88]\xb5\xd8Q\x12^\xba\xe4\x86\x1d\xe6\\D\xbf@{\xaf\xd7\xf4\x8fJ\
+\x83\xffa&\x87\xf7\x19*%;Y:H1&\x88\xd5\x87\x86ZZZ\xe2\xa2\xc0o"\xf7r<\x0c\
+\xe9\x930\xb3\xb0t\xe9\x00\xae\xbc\xd0\xb3U9d\xa5\xf4\xfe\x90\x95\x0cm\r\xdd\
+\xe2\xa2\xbf\xbc\x1ewV\xde\xde\xdeT1\x9dB\x14\xa3\xc0f\xc9c{\xe1\xc3\xe1]~\
+\xa25K\x91B\xdd\x7fT7\xb7\x98p\xc3\x01~u|\xd9{\xc0\x91\x17\xa2L\x90RSUm\xd5\
+\xb5e\xc6\x8b\x03\x88\r\xce\xea\xc7\x0fq\xde\x00sr\x7f\xfa\x87S\x87&\xed\xdc\
+)\xa8\xf4\xc4\xbf1h\x18\x18\x1e\xfb\xad+\r\xb6\x18Abd\r\x85M\xf9Myy\xc666\
+\xe8\xf7w\xa3\x87\x9c\x00\x98\xfc^\x12\xcd\xf8J\x15\x83\x86\xaekmn\x0e\xf5\
+\x11\xba\xd6\x1f\x08\xaf\xfd\xfd\xc1@D\x96\x14\xba\x0e\xf5\xe8\x8f\xc2\xd6\
+\x0f\xbc!\x8a\xda\x9b\xde}\xdbM\xd8e\x13z\xcd\xff@\xcc]4gY\x9e\x9aV+/\xb7H\'\
+%-\xcd\xc9\xc9\xf1~\xb7@c\x98\x04\xa4A1.\xa2\xba_\xea\x94A\x0e\xcfw\xa7\xae\
+\x02\x08B}\xbd\xff\x1a\x7f\xf4\x7f>N\xfeae\xf5\'=\xf5\xf6\x19\x1f\xf8|`D\xb4\
+Y\x17\x00fy\xbc\xc6\xc7{y3\xcb\xf0\xaa/k\xb3vr\xba\x81\x90<\ng+L\xee:\x88&\
+\xe2\xd8c>\x11I\xe7O\xefg\xfa\xb0b\x871?\xbcZ\x9fZ\xef\xec\xe0\xf8\xdcHf\x8e\
+L\x8ct|\xb2\xf2\xdb+\x1c\xd8\x91\xa8\x85\xf8\x9e\xf8\x1d\x1d9\xc7\x83\xe1\
+\xfcE\xcb\xeag\xf7o\xe1\xf1`9\x8ae\x18\xe3JTJ\xf4\xd9y\xbd\x1d=\xdd\x97\xb1\
+\xa2\x070I\x07\xf34\x8421\xbev\x01j\x04\xc4\xa1\xa9\xc4DU\xf6\rL\xf3\x9eS\
+\xba\xec\xfa\x8f\xf9\xb3Qg\xbf 1^\xcf\xb0\xf7\x90M\xd5\xbb\x97\xf1\x18=R2rrD\
+\xafe!\x03\xdb\xf5E\x98\xcf&\x7f\x1b\x18f\xe4\xfb\xd6t\xdc\xa1\xf3~\xc4\t6Q\
+\x0c\x8ey,\xd3\x9d\xd8\xb6_"$\xda\xd3\xc2\\\xcf\xb7V\xed\x0eV\xa0\x93\xf3\
+\xda\xf9\xaeXmz\xdd\xfc\xde\xde\xc9[@\x9a\\[\xd5\x8d\xd9\xcf\xac\x0ecF\x90\n\
+\xf7\xc7T\xfc\xf6\ry\xd5J\xe4R]\x1ej\x02;f1%\xe3y\x0e\xbb\xd9\x9c\x16_\xab\
+\xc8\xbe\xb2\x1f9o\x8f\x926\x8a\xb4\xb2\xf7\xf0\xf6)\x06\xeb\x07\xd0\xa8\xa7\
+=s\xa5j>n\x07\xf8\xe6\x85\x01\xba\x14v\xac\xa1\x07\x83[\xd4\xed\x8fn\xe6\xfa\
+J\x0eQ})\xc8A\xdf\x904\xd1\xd1\xd0Z/\xbaQ\xf5\xcf9\x8bU\x9d\x9a\x08\xfb\xe9\
+\xa8|WD\xd6\xb0\x9c\x03\x04\xc8\xc3@\xcb\r\xf5\xc7\xb7\xeey4\x9d0\x08\xfe\
+\xa1\xe7\xdd\xc7\xfd\xc7UUU\xe3\xe3r2\xe2\xfa\x88\x9b\xf3[TX\xd9\x80\xea`k\
+\x90U\x1dr6\xb0\xf7\x1a\xf8\xe0\xbf\xd1\xff\xe7\xf0\x08\x19Xn\x91\xa8s^\x7f\
+\xec\x8e\x86B\xfea\x9b\x8d\x1a\x0b\xf5\r\x0c\x03\'\xb1j\x85Fp\xc1\xf2\xabj\
+\x872]\xbf\xc1\xa2\xd0u</\x9dV\xe7L\x86\xc3\xac\xec0\xe4q\xd2ty\xdcc}f/mf\
+\xfcKir\x86E\x81l\xaa\x93M\xe1\xdd\x8a\x85\xd2\x8a\xc5\xb1V(\xa9\x9dU\x00\
+\x0b\xbb\xfeo\xf6\xe6,T\xec\xe6l\xd4e~1\x98u\x0c\xe1\x1b\'\xc4\xb4\xc4\x8c\
+\xb9\xb6\xd6\xd6@L\xad\xe7;\x81\t\xc8U\x0b\xbbv0,\x87\xd2"\xea\xa4e]\xfd3\
+\xf7\xaf\xfd\x96\x16w\xa8\x08\n\x98\x1a\x16p\xe1j\x93\xa3YW\x8d\xbeum\x0e\
+\xae-;\x01:\xf9\x17\xcf\xadn\xf8\x905\xbf\x83\xf31r\xc8\xbf\x97\x89\xf1\xb6\
+\xa75\xb5\xe2\xaf\xd5\xad2\xd9s\x96\x0c\xaa\xe4\xda\x08\xc6v\x91*(ob&A\xacx\
+\xd1\xf6\x02>O7\x16\xda\x1f[z\xdex|\xaey\x1a\x07q\x0b>\x04\xb2M\x93\x87\xdb\
+\xf8\x12\x13\xd9\x91\xff\xce_\x8b\xfd\xcd\x8a\x92\x06>\x84e\xa6)\xa3\xf80\
+\xe0\x0fzV\x00\x0f\xe8>\xdaV\x9c\xf4"YI\xeet\xb4\xd4\x98=\xb7S\xa4F/\xd49\
+\xd7\xe5\xde\x9f\x0b\xe1]\x88\x0b\x8b\xa0\xdc\xf1/\x1e\xa8\xc0l m}S2Bk\xe8\
+\x9c\x16o\xd4\xf2\xbc\xc5\xbb\xd5\xdd\xaa\xb2.\xe6\x98\xbc\xff!l\xd9\xc4\xe0\
+Ysg\xf4\xf2\xc5\x12\xd5\xe15[\x01\xa9\x8f\xf3\xe0\x14\n\x11]T}\xd5\xc8\xd8]L\
+\xfc\x87X\xe8\xc4~\xee\xbcSh\x152\xa5\\!\xce%\x1di3{\xf9\xc7\xc0\xc1\x11\\\
+\xa1\x0e\x0c\xd1\xbd\x83\xb6\x16\xb4\x91I\xe4quk\xcf\xad\x08\xb6M\xf0A*\xaf\
+\xa9:\xb2B\x9d\xf6\x831U\xd9\xc7\xc0N\xb9\xd4\xe9\xdfH\x94\x80\xf3\xe6\xe1v\
+\x8eXL\xfb\xf9}xA\xae{\xf5e%\xa5\xecm\xdb\xcc\xd1\xc6Ey\xd8\xe2E\xff\x86H\
+\xf9\xef\xdfP\xe1\xc1\x0f`\xb0\xd0\xab$\xca\xee\x1e=\xc18`\x03\x81\x99)9\xa4\
+\xecS]\xa9\x8fYI\x11H\x07\xd8\x0f\xba\x81\x93\xa1EX\x8bF\xb6\xa4\xe9\xa4\xf8\
+\xac\xda\xfa\xea\x08\x9f\xfd\x974\xf8\xcf\xb0~s?\xe8j\x7fOc\x86\x82P\xf7P\
+\xbb\x84\xa4\x87\x1f-\xcc\xcf\xf9k\x04z\xf8\x11\xda\xdd\xac\xeb\xac\x9a\xb8\
+\x92\x13\xa2\x05\xf3l\xbc \x83\x92\xb3\xe6f\xa6g\x89\xa2\xfa\x96WV\xac\xef\
+\xad\x05&\x8aG\xe6\x9c\x82w9H(tI\x06ded\xb2\x02Bq\x9a\x1c\xf7\xd1A\x81a":\
+\xe1H\xaa\x7fYr\xbf\x15]\x88gjU[;M\x8aV\xf5<@\xee\x8f!\xa8\x1f\x10\x82~\xd1;\
+\xcd\xe0\xaf\x82C;\xd3\xe4\x1f\x98\xaa\xc7\xd0u*x\x14\x86\xccZ\xc5G\xc8\xa2_\
+Q\xa8\xcc\x07QCx$\xea0an\xed\xcd\xaa\xfa\xfc\x88+,\xac\xc4~JC;\xfe1\xefB^\
+\xa9f\xda\x1c\xf5\r\xdc\x10C\x15\x0fHy\x03#\x19\x10 8\xa3\xc4\'e\x15\x05%d\
+\x9ah\x088*1\xd4\xe0\xa2\x17L\x0f\xd1E\x93y\xbc=\xb2e\xc98\xdf\x1e\xd5\r\xa3\
+\xe8H\x9a!~ 9\x08\x0c22"@(\x15dE\xad\x13\x06@%\x89U\xb7\xe4\xef\xe4\xed\xedm\
+\xb6qh\x08\x86\x1f\xb2\xc92\xd2\xe1O\xdeY\x80\x0f\xf8\x18\x08J\xa30\xcc|v\
+\x14EQ\xfe\xf2\xa3\x98\x81\xc2~\xe1"Y\xf2\xe6uq\x06\xfc\xc6\xee!\x813j\xfd5\
+\x8e^\xa2G\x9b\x86~`(\x97\x8d\xf9\x07\x8bL\xd0=0\x9c\x94\xa6\x87;z\xc0<o\xe1\
+}\xd9\xb4RQ\xd9\xa4al72Ud\xb7k.\x82\xc7\x8d\xc4\xa4\x7fPS\x7f\xeb\x1aU\xb2\
+\xb7\x83\xcb|\xfb\xa6\x86\xef\xfd\xa7=\xa7\xad\xb5\xd9\xa2\xb9\xf8\xc6|\xc5R\
+:ZZ\x04\xb9\x0f\xad\x8f{\xf2\xb5\x9a\xa7\x1do+\x1d\xb5\\\xd6\xf3\xeb\x87\'\
+\xd1a\x91\xb8\xcdOG\x0e\x9f\x87Y\xa1\xca\x14\x1c\x97Yv\x12Y\x8d\xce6,\x8d\
+\xa4QJ\\T\xca\xdf0\x08!\x99\x90\xa5/\x8d\xa1\xfa\xa1(\xdf\x82\xb4\x06\xedj\
+\x83\xd5\xb4*\x87\xf3#\xe6\x84\xdb\xee\x88@W\x81\xd4Q\x9e\xb5\x05\xe0\xef\
+\xbb\x17\xe3x\xf7_\xf9H\'\x1bE\x1e\x1a\xba\x19\xc4\x1b\xf7\x9438\x100t\xf6\
+\x1bd0W\x1e;\xc0\xb7U|\x06K\xbd2\xd1\xd1]\x16!\x06\x84\xb3E\xec\x81\xbe\xd7^\
+\xa6\x9b\x84\xfa:\x07FQ\xdf/\x01RwE\xba\xe0\xf5\xafG\xceC\xf1\x97\x11\x1bT\
+\xe2E\x12"\xbfe\x80\xf2\xc5U\xfd\xea$3]\xd3\x198\xbd\xb2"]\x06\xc7\xde\xe4y\
+\xad\xb5\x11\xd8s4\xd9"\xbe\x8c\xc2\xb2{\xba\xdd\x93\xa7\xbf\t\x8f\xc8\x14\
+\xcf\x12\xa4\x06+N\x94\xd0\xea\xa7\x0c\xdb9j\'p~\xfd\xaco\xf3m\xc4\xb6\xa8\
+\x07G\x8c]\x1b\x0b\x1fS4(\x81\xe8|\xf1l\x05 \x95\x1e\x0e\xb05\x1a|\x8b\xdc\
+\x01\xeav\xca\xa6l\xe5\x9f*\xb3\xc0\x1b\xe9\xadM\xbc\x1f\x9c|\xb8<\xa4\x93\
+\xa6<\xe9\xe8\x06\xa9\xe2H\x1a\x17\xcc"\x17\xc4\xd4$\xb7\xf5qt\x99\x00B\xc1\
+\xd0%a\x1ar\x11e\n\xb8\xffmk\xd3\xf9\x836-\xc8\x16\x14\x90u\x8f%V\xae\xdb&Q6\
+\xe0\x96a\xa4\x1el\x90\x8c7\rT0\xe6\x8cN\x9b\xfb\x98\x15\x87\xc5\xace\xf0Z\
+\xad\xe2\xd7\xaf\x98S\xdbCq\xf2\x8a\x87\xdebH\x04\xed\xb8\x89\xf5^\xe98\x8c?\
+\x8eP\xbd\x85\xba\xe9\x12\xb7\'\x8b\xa1\xf5\xea\xca\x89\xb8\x9b\xb4\x1e\x0e;\
+\xbcV\x14_\xa3\x9f\xd9a\x19\xd1Q\x8c\xe20h\x9b08y\xa5\x18\x9f?\x10`\xb8?\xe3\
+J\xf3\x7f\xfe\x0c\x9f|\xea\xc9\x1a\xbd.D\xb3m\xcc\x91<sxrr\x94w\xdb\xea\xc4\
+\xb76=\x1d>#b\xf1\x1b\x93\x8a\r\n14k(\x89\x15\xfc\xbaM\x8a\x19>\xbd\xd2\xaap\
+\xd0\x05[\n\xab\x81\xde*n\x81\xad2\x9a\x8aK\x8f\x13\xdf\xbf\xef\xd2\xc2\xb0\
+\xe2\xc9\xd0\nB\xfaD\x14\xd5\xa5\xff\x1bSiC\xa1b\xce2\'\x86\x1e\x94u\xf5(0)\
+\x14\x06\xca\x81\x1c\xbe-7/k\xb3\x9aU\xa9KHJ\x02\x1d9\x05\x9e=\xbe\xe5\xe6\
+\xe6\xae\xaf\xab\x1b2\xe6\xf8V\xfc\xef\x11?\xe3\xfc\xe4\xe4oE\x85<3\x9d\xf7\
+\xd3L&\x104\x15[\xc6\xdb<\x96)\xdd#\x0c\x14\xcc\x8a=\x1eK\xd9V\xac\xea\x85\
+\xdfv\xe4\xad\xdc1\xcf,`%M\xdc\xdd\xdd===\xbd\xbd\xdb\xdb\xda\xda\xaa\xaa\
+\xb0\xa27\x03\x101lV=+j\x9d\x92t+\xe4i\xb0\x97\xe60\xa4\xa5\xc2}.\x02\xc8]\
+\x9cNv\xdctK\xe7\xea\x1b\x1aV\xac\xb8;60\xfcXD\x02.O\x97\xe6\xfe\x86\xe2\xde\
+\xde\xdfO\x8c\x8e\xae\xb6\xf1\xa3\x849\x85:f9-\xcc\xcf\xd3\xc6\xbc\xb3\xb6X9\
+\xe6\x7fa\xd3\x87\xb5*\x8c}\x1f\xc5\xe6.\xca2;>\xf3q\x0f\x9b4z\x91>o\x8e\xc3\
+\xb5\xd6O\xec\x8f\xec:\xd0e\xf0a!\xc1\xa5\xa4\xa6~\xa5R\xb4\xfbtp\xfd<]\xccu\
+\x87\xe1y\xb3\xbd\rL/\x00G\xc1\xe5_\xbe~\xbc\x14\xa8\xf8\xcd\x04\x950d\xacJ5\
+\xc5>2\xe8\xe4\xae\xc3\x98\xe0\x0fC4R\x9d\x01\x8fA\t*f\x8e\x96\xc8\xd5\xa6\
+\xed\xb1\xd7fMrdk\x8cGIX\xcf\x8a\x1eHr\xcb\x18\xf8r\xb6V\x83\xdf\xdd233\x83\
+\x1eb\xa4\xaf\xbf\xd9\x1b\x86\x83\xab\xe6\rY\x7f\xd5f\xe5\xd9\xff#]\xa8&R=}\
+\x8c&0q\xbe\xd6r\x7fw\x8a\x91\xd8\x9d\xad\x13\xabC\x14\x85P\x14\xe5\xe7\x07\
+\xed\xd39\xc1!\x93[\xa7\x98;\x05\x87\x1f\xc0<\xc2\xf8}\x18\xcc\x9b\xf3\x9b\
+\xc9\\\x0c\x11\x99\xfd\xe034\x1d\x82\'\xfe\xbc\xa7\xf9\x16\x12\xd3\x8cHA\xd6\
+\xb2,\xca\xf4\x83\x98 \xb1&*"\xb2\xf5U\xd7\xbf\x9ed\x8b\xb3\x1e4.g\x8a\xd2\
+\x1a\x9c\x7f\x13\xe7\x9f\xde`\xbb:\x9b23\xa4ic\xa9b\x908\xa8\xbb\xed\xc1,<\
+\xf4\xf7\x98\xb9\x00w\x1a\x88\r\x16\xcf\x14*l\x077\xf3#y\nU4\xb4\xb6\x92\xc0\
+f\xa0kNz+^\xd4N\x8c\x15\xccX\xf0aM\x16+\x862t\xa3fs\x99\xf3\xa5\x077\xd7\x83\
+i\xba/\xf5\xbd\xb3\xfd\x83:\x1fwp;_\xc4m\xfdq\xf9`:\xa9\xc7FG7\x13k\x1b\x1a\
+\xf6\xaf\xdd\x82\xc4>}\xfe\xb2{\xeb..\x9d]P@+\x86\xb4\xb9a7.dw\x01\x05\xf7\'\
+^\xca\xc4Z\x87\xa5\x1f\x96\xabD\\\x9aR\x0c`\xf2\xf6\xfa\xf2\xfa\xea\xea\xd8i\
+\xccU\x9b\xfb\xe1a)\n\xcc\xa2\xf2r\x1bkk\xf8V\x19F\xa0@\x9a\xe5\xd3x\x15\xbf\
+\x7f\xbf=\x98\xca=;;\xebu\xd8\x96\x14~\x8a\xa9\x9bzZu\x9c\xc0\x12K\x93+\x1c\
+\xd9mv\xd8\x95\x12 \x83<Nl\xa4dd\x14\xb4\xab\x05b\xcev\xce\x0c9y\x89{\xa5\
+\xe7\xa3\x93~\xce\x9dr}[u\x8b\xe8\x8b\x95+\x04r*\x90\x967\xce3\xd3\xeb\xf6U\
+\xd5r\xa7\x8adhg\x0e\x9d\x7f4\xd5\x81\xb9\xd0\xb2\x9e\xdf^\x9fKKK\xf7I~\xadZ\
+\xa23\xf2\x11Xp\xa7~(\\][\xf3\xda\xec\x84FB\xc1\x16\xab\xd5d\xb1\xe3=tr\xb7t\
+\xd7T\xfb\xbe{\xfd\x1c/\xf5\xb1S\xac\xe3i\xb7\x02\x89\xd2\xb0\xca\xd5\xd5\
+\xf5\xe1!l\xa7\xab\x8f\xc2\xa6a\xc8*\\"\x07\xc3\xac\xb0K\x7f\xee\xd0\xf9\x0f\
+\x0c-\xed\xc0\xce\xa5\tJt\x97\xdbg\x1e\x1e\xb6\xa0\xa4\xf7s@\x1a\xe8\x89N\
+\xdc\xa9\xffaa\xad\xb2\xfd\xefy\xe6LI;a99\x86\x19\xfb\x9d%\x9d\xc2b`E\xc5O#\
+\xecS\xea*:\xe5\xa6y\xa3OO\xcds\xff\x8f\xa6\xb3\x0e\x8b\xe2\xfd\xda8\xcd\nKJ\
+\xf7\xd2\r"\r\x02.\xb5\xd2\xdd]\xd2%\xd2),!-\xd2]\x02\xd2]_ZJ\xa4\x84%\xa5\
+\xbb\xa4\xbb\xde\xf1w]\xef\xfc\xcb\xec\xc4y\xce\xb9\xcf\xe7\x9ey\xe6\xc1\x9e\
+\x8b\x9b[\xa5d\x8a\x9e\xfe\xf3@\x81A\xa5\x0es\x92,=\x01P\x93\x1ae@\xc2\xe9q\
+\x02\x849\xbeu\x86o\x11\xf6\xc0\xc6\x1a\x9a\x83\xaej\xf6J\xad\x8a=\xe8jj\xdc\
+\xa4\xdd\x17\xa7\x1c\xe5\xfb]\x18~{_\xa2\xa11\xfcf\xbd\xbb\xbb{n\x8e\x19[\r\
+\x92\xca\x03\x97V\x80+0\'\x85\xe0\x89\xba\xeeO\xf7\xe4\x84\x96\x1e\x8d\x8clv\
+\x8f\x140\x84\xfbJ\xa4HA\xe2py\xf2\x12\xcb\tw\x9d\xbf|*C\x93\xaa\xc2{\xffm\
+\x85\xba-\xd0\xebBE=j\xb7y*0\xa8\xeb\xd4eB\xd7\xeb\xa3\xd7\x91\x93\x0bf7L\
+\xfb\xe4\x84\x01\xfdTu\x1f\xc5\xb5f\x87\x8e\x08\x19\xa5G\xaa\xb0\xf1T\xcft\
+\x058\xee\xc4-\xd4\x0f\xafJ\x8c\x8b\xab\xb2\x05\x8dlN\x8b\x02\xa9\x04\xeb#W\
+\xdb\x07z[\x17\x10\x0b\n\xd8\xfb\x17u\xcd\x1bEN\x16\x1d\x1d\x1d\x89\xe7\x9d \
+\xdc\x01\xdc\xedT\x97\xe7x\x97\xc2Q\x8cX\xa4\xb5?oA\xf9\xbd\xc8i\x93\xe1+\
+\xb4W\xde\xe2y\x19:\xda\xda@\x8e\x05\xcb&)1\xbe\x15\xa87\xa8\xc4\x82C\x0b\'m\
+\xf93\xb4\xd8\x8b\xb5\xd8\xbd\x8e\x97\xa9\xe3\x07!\xd8\x98X\xc0>\xbf\x1a\x1d\
+f\x89\xb1\xfa?\x8c\xbf\xf1:\xdb\xd4dQ\xc9\nV\xa1D\x1abM\x03\x9c@\xbeWDJ\xaf"\
+}"\xacdV\xbfR\'/\xf8s4 O\x8bM%G]\x0fKA"\x1e7\xf8\x18\xcf\xd3\xd3\xd3]\x8f\
+\x07]\x1d\x8f\xd1\xcd\xbcf\xdfJJb\x11r\x13~\x80\xe8\xf3\xa5\x83eottu\x01\xb9\
+\xf95\xb6\xa0\x9f\x82(\x150\xa9&u\x18;9\xe1-\x15#\x8cbl\xce\xb0\xd4\'\xe1\
+\xf3\x1b\xef:\x11\x1f\xa9\xd1)O\x1eq\xe5K?l\x1d\x7fS2{Pm\xdc\x953\xbe\x83\
+\xf4V\x80"\x167\xa2\x8f\xf6\x041=\xcdN\x84U\xa6e\xa0\xad\r\xc7\xa4\x0e\xd4\
+\xee1S+\x99}\xc7H\xc8\xdd\x87\x98\x9d\xb5\x14\xe7\xe7\xe7\x9fF \x1a\x1b\x1b\
+\x93SS\xbb\x1eg\x16\xa9\xa9\xa9\xd7\\\xd3<I\x94m4[\xbf\x1b\xc9|\xde\xde\xa6\
+\xde\xb3\xca\xd8\xf1\t\xb7\xa6\xcb\xc07\x8d\xfb6\xc5\xf1\x15]\x06\x87\xc0^I`\
+\xa2o\xa4\xca\x065\x1a\xf9\x81\x98\x9e\xc0\xbf\xddr\xacs\xabu\xd4J\x07%:\xc4\
+WQZ\xd5E\x95\x9fB{\x88\xd8\xf8\xbe=\xe1\xab\x1d?E\xf5\xecu\xcf\x91a\x947T\
+\x83\xddg\x7fS\xd39U\x0c\x1f\xc4\xfa\xef3\xd4j\xe98\x9c\xa5?J6\xc5\xdf\xbey\
+\x02\xb2\xd5\xf3\xc3\x8a\xb9\x1e\x05\t\xa0e\x0br9N\x02\xf9^\x82l\x93\x9d\xf3\
+\xdb\x06\x03\x1c\x8f\xf4\xc9\xda\x99\x83\x8f\xc4\x0b\n\xbf,\xb8\xb8\xb8\xaa\
+\x9f\xfa\xcaKT\x83\xea\x1c\x9e\x03#\x1b\xd7\x87\x07\xb1"\x10\xd8n\xdc\x06\
+\x01 ?;\x18\xc7tSaI\xf8\xa0\xc9\x9c\xe9\xe0\xbd\x9e\xa5\x81\x81\x81\x17\x19\
+\xca!\xd1\xb3|W\xe6\xb7\x19\xfe\xeaoRm\x83\xbd_vW\xe8c{"\x9a\xf5P\x93\x9cl\
+\xe9\r\xe4\x8b\x10\xb8kO\x97\xb4\x1f\x17dm\xb0\x99\xe8\x17j\x0b\xb7\xbbX\x8f\
+\xb08X\x17\xaf\xa5\xc6Ax\x98\xc4\xc6o\x7f\xcf\x8d:\x93p6\x12\x1b\x18|\xf8\
+\xa6_\xa0V\x88q\xcc\xe3M\xc2o\x7f\xb9\x9a\xfe\x96\xa8\xef\xe4\x89$k\x1c`\x83\
+t\xa5\xed\xea\xae\x87Y\xb5^(\x17\xbe\xb2p\x16\xc8\xb1\x86\xe0J,[\xa5R\xc7\
+\xeff\xc8\x9c\xa8\x80\xca3B\x8dAIOq\xd0\x86\x9f\x020\xa0j\xa8\xb9\xf8u\xab\
+\xfay(\x86Ej\xaf\x85\xc8\xc0\xa5n\x05\xd6\xbb5b\xdc&-s33\xdf\xd4\xcb\x1b\x89\
+u\xa0\xa0\xd45*O\xcc_N{\x03nTh\xe2\xb4o|e\x1e\x8f\xec\xa2rfN\x8e\xff\xb4JCB\
+\x01<G\xa0\xb1[]e\x8e\x98\xe0\xa3@\x99\x88\x95\x0c\xb3(<\x11\xb6NT\x1d^^\xd1\
+S"O\x9f\r \xae\xe4\x7f\x87\x0b\x07\'\xb2\xe75~K\xd7#\xd9\xc3\x0c*S<923*\x00\
+\xf4\x00X\xbd%\xbf\x057\xc1\xf2S\xeeq\xdf\xbc\xdd\x8f\x13\xec\x1c8\x8c\xb1@\
+\xbd\xbc\x87\xb9\xd3\xed\xfc\x8dO:\x8a\xa3\xd1!9\xafZ\xfd\xb0U\xfd<\x898v\
+\xa9\xf5\xea\xdd{\xbe\xf4\x90\x90\x90A\x9d\xba!\xf9\xd7A\x1d\xcb\xc1ok\xb7\
+\x86\x8bn\xff;\xc9\'f\xf7\x0fy\xa8Or^\xb9r\x92\xdf\xa0\xed\x8b\x02\xfd\x12\
+\x81\x85\xd0\xb0p^\x02\xe4\xfd\x9b\xb4Wr\x85o.\xac\xb1\x8fK+\xe8l\xd2\x9d\
+\xfa\xf1\x8a\xab_\xd5W\x1c\x13\x97\x06I;\xda7\xe4\xb7\x9b\x8a\x98\xd5W\x06e\
+\xacK\xc2\xb3\xc9\xbf\x0c\x9d\x17\xeb\xf0\xe8\x06*tM\x05\xd7\xde\x18\xc4\x80\
+\x9c\x83%sRT\xbfe\xa6\xaf\xde\'\r\xc9\xd45\xd6a<\xd5 \x17\x97\xe3\xedj\xacFi\
+\xef\xc0\xd5\x03\xa0\xd1PL\xee\xda\x99\xfb\xf6\xde\xa0\xfd\x89\xb5\x9e\x97\
+\x8e\xc0{\x9er\xa8\xce7P)\x89\x07\x8a\xe9\xe9)\x10\xab\x88\t\x9e!b\xd5\n\x82\
+\x00\xaa\xc6\xca/\xecj\xbf:\x96-\x06D\x8f\x9b \xe1\xa2\xb0\xd8\xfd\x97CC\xca\
+\x0b\n\xc9\x1f\xe8+\xfe\xe7,\xc1\xa3\xbf\xe3:\xfa\xfe"\xf9\x13\x0b\xbc6\x10\
+\xc7\x04\x9d\x01\xf1SSc\\\xfc|+WH \xe46\xf5\x98a\x1eL\x9d\x07\xb59\xe3C/u\
+\x0fK@\xafn\x9e\\\x98\xb3u\n\xa3X\x07\x02\xea\x19A\xbd)\x02\x1dJ\x92\x8f\xcf\
+\xafb\xcbB\x81\x99g\x00\xae\xa4\xceZ"7\xde\xff\xeby\xdc\x97\xfc\xbe\xbf\xb0\
+\xe2$\xada\xbc\x88\x10<\xc02\xa5\xdd\xf3\xde\xae\x9b\x14\xfd~\x97\x1b\xa4\
+\x19\xed\xd6s\x10\xdbo\x19"\x85\x14\x0bn\x80\xba\x92]\x98\xd1\x8c1sX\x8a\xc6\
+\x1a\xe0P\xd0\xc3R\xa6\tiP\xfdF"\xe9h\xa7\xe6|9Q\x92\xab\xe0\xbd\xd6\x84\xa8\
+\xcb\xb4\x17S\x89<a\x88\x84l\'1\x8ag\xbdf\xb8\xc00\xd7H]\x8d\x0e\xdbC\x1fW\
+\x9f\x1fv4\xc9\x84o@OyV\xcek\xea\xf2\xdel\xb3\xee)\x9c\xc1\xf33]\xd3\x81\x97\
+Rpzx\x874\x7f\xf7\xd3Y?\xe9p\x93M\xd4\t\x19\x08\xa2\xa9\xa9)}\x8c\x8b|\xf7\
+\xb3\xe6\xd7\xf4\xf4\xd7\x1e\xb3\xee>\xd2\x17\xf2tQ\x1c\xc9|\x1e\xe9\xf0\xb4\
+\x95O\xb3\xd1\xe8\xc8jj\xae65\xf4\xa3c\x0b\xaf\x0cx\x1b\xc2FY\n\'[V\xf5On\
+\x038GL\xba<\x1f\xcf\x83\x9ev\xa6?\x92\xbe?\xbd\xac\x0e\xc0\xd9\xf5\xcd\x13\
+\x83A<\x91\x94`-\x1c\r\xc4\xbb\x9b|\x02\x02\x1f\x81\xfex\xfd\t[\xe0hyy\x19\
+\x15\x13\xcf\xa8\xcd\xe3\x05\x15\xdaa\xae9y\xc53\x10K:\xb0w$\xc3\xda(\x9f\
+\xc0:)\x18\xd5\xe3\xc6\xce\x0cj\r\xb3\xc3\xc3;6\x1bxE\x06N\x13\x823Z\xff!\
+\x885\x88\xb5A\x8eK\xc2u_3\x1b\xe8Y\xfd\x8c\xac\xf1\x16\x04$F\xf0\x0c!\xb4\
+\xe6%4\xa6\xa1A\x0e\x94O\xcf:]\x9e\xea\xac\x85B\xe4\x88R\x81H\x84\x85a\x95\
+\xf2\x1bP\x1af\x18`\x8e\x83;\x1f\x92\xbb\xde<\xd7\x7fh\xc9\x91:LB\xc9\xc0^\
+\xeb\xde\xc9\xb9\x17\x87\xfc\xd89\xc7\xc9\xa20\xd3O\x11t\xd8\xc5\x08F\x1a\
+\xa9\xebF\xe9\xba\xf9\x1d\xadw\x02\x1f\x89q\xd5sn\xfe\xc5\x8c2\xf5\x9d\xebx\
+\n\xf9l\xee\xc6w\xc4\xff\xd4\x0f\'\xb0\xee\xfc2H\xb1Y\xc9\xf6P\xb9\xeb~C%\
+\x8a\x86\xe9\xe4\xb9\xba\xeb\xe9\xee\xd3{d4\xb2\x8b\xcf"q\xd2\xa4\x1e\xf7\
+\xbaS9\xf4m\xa7R\xc9k\xe2\xaf2\xcdv\xe5\xe8\t ^\xa0\x95\xc8\x01\xe1@\xff\n\
+\x02\r\xa7\x9e<Q|\x10pe\xa7k0a\xf7\x9d\xb1\xec\xceN\x89\nq\xb3\x18@\xf1\xe6\
+\x1c\x1d\xa6\xed\x7f\xa1\x80Gx5\xd8rD\xc49\xa8\xc6Q9~O[\xc9\xce\x92"\x7fZ2\
+\x07\x90BsA\xd2\t\xfd\xd6\xbfS>\x9e&\x84\x15\xeeL\x05\xd9<\xdb\x1a\xc1m\xb7\
+\\\x9dF\xe2\xc6\xb6\xd6\x83C!\xae6\xc1\x7f\x17\x1c7>P\xe1&\xe3\xf7\xd6\x1df\
+\x8by\xd5\xa4\xf4\xfe\t\xcfa\xeef)\xa2;~\xf9B\xbe[^\xaaH\x19\xd4S\x8f\xfd\
+\xe2\r\xf8u{_\x1c\x9ee`~(U\xee`i\xa887\x00\xa9\xcd\x8d\x8d\x1d@\x04\x90\x04\
+\xbe@\xe9\\WWC\x00_\xf8\x99\xa0\x1b\xdc\x0b+V\xa5y#\x07B\xae\xa2y\xc9\n\xa59\
+\xc1\x05,H8y\xc8\x88kf\xca"<\x1d\xf7\x1cT\xc5"q>\x97\x18O\x8eV\x9b6~\\xe_4\
+\x11\xf2^\xcffu:8\xc1\x1f\x9d\x13\xc3\xf9\xe5\x92\xb45<n\xcc\x16\xb0\xa8\xbe\
+k\xd1<t\xfd\xdd\xb1\xcc\xe8\xe2\x9f& 9\xdc7P\x84\xdd\xd9i\x86.Y\xad\xc7\xe5@\
+&T\x87r\x9e\x84\xd3\xf1-\x96\xf3\xe4\xd0\xc2m\x93\xe6\x03-\x9b\xf0\x9c\xb6\
+\xb6\xb6\xd3\xdb\xcb7M\xf3\xb0\x90\x8e\xa2\x04\xb6\x16c\xe7\x9fW\xad\xfe\xb7\
+g\xc0\xdd\xa9dK05$\xbe\\Oq\x95H\xbb-\xcd!ur\xc1\xba\x7fn\xfc\xd8\x18\x8c\xe7\
+\xd4*\xc5\xff&?\xff\xa7\xa7Z\xde\xe2\x16\x89B\x99\x85\x19*\xf7\xd5\xee$C\xa9\
+Z\xb0\xa5\xd7\xde:S\xb8\xf9\x04\xd2\xe0\'i\xca\x919\x8d\xbd"\xad\x9fZ:\xbb\
+\xfc\xf6\x02\xb1\xaf_\x1d&R\xa1\x88\xa1q\xb2\xb3\xa1\x8d\x87\xe1\x7f\xfe,;\
+\xe6\xd2\xee\xe2w\xebb\xca\x1c&\xc5\x1b_\xc0\xe2\x9a\xb5\xf2\x18q\xdcy\xf58\
+\xab\xb6\x88\xc9\xd8c\xcb\x0f=\xce\xfb\xfe\x1d\xeb\xc0\n\xb8?\x92\x9dK_\xd4\
+\xbc\x1f\xd0o\xb1\t9\x915p|\x94\x0c,3\'\x8aF\x03\xe3*\x92m\x81\xc8\x84\x17\
+\x10p\x1f\xd0t\xa5\xaaQ `$t\xb2$\xb5\xa7\x02^\t\x8fW\xc0o\xccT\x8e\x8e\x8e\
+\xbc\xfe\xfe\xe9\xa9\xc2\x87\xbc\x84\xba\xfe\x02\xa1\xe55+\x82\xec\xec\xeb\
+\xec\xa7\xed\xa1\xd3\x93z`FE(\xc8J\xd0\x95L|<\xa4H\x98O\x1c\x1a\n\xdao\x0e\
+\xf1\xcb\xe7\xd6uh4\xc0\x8a\xcc\xfb\xda#E\x17\x9c9d\xdd"\xe6\xf5\xb7\xa1\xb1\
+\xf164\xf0k\x82+o\x9a\xe6.8pc\xdb/-\xd8\x95\t\xe2\xaf\xe1Pu\xbf\xdd\xdc\xf9\
+\x8e\xf2\x86?\xa7d\xab\xe4\xc8\xfc!e?9A^~\x07\xce\xb5\xfb\xe6\xe1Y\xcfh"E\re\
+I\xe6\x17\x9d\xde\xfeS\xc2\rm\xd0D\xd0\xe3\xc2G\x8d\xe0\xaf.+M\x15\xe7@Do|\
+\xd7\xb2d\n}\xf3\xbcL\xef\x9f\x1c\xdewy_mu\x05\xdcN\xac\xf5\x81R:\x9f\x1a\
+\xab\x81\xa4\xac\x7f?n\xb1\xab\xf1\x15\xc2\x85\xe6\xd8\x8a\x7fA\x8fu\x10\xbd\
+Y\xf8\x9a\t\xfe.\x01\x85:m\x99\xcc\xb6\xc4r\x14\xf2\xc9\x97fI\xcd\xac\x8f\
+\x9e$\xb6?l\x92\x0f\x12fS\xa3e\x8e\xc1\x10\xb2=@\x86\nM{\x13\x9b\xfb\x02\x02\
+\x9a\xe6\xe0\xf0\xb0Iz\xe1\x83\xe9N\xfes\xfc%\xb4\xa8&\xfb\x8d\xdf\xd5\x15fs\
+\xad\x10\xfe\x10\xcc<\x00\xf5\x13\xfa\x08\x01\x8dQ\x11at4\xf2\x9aO\x88#\xf6\
+\x9e\x84\x15rQ\xf7\xdbman\xc28\x0f\x0fO:\xd7`o\x1a\x0c\xc9:\xa4\xb5\xa8\xbc\
+\x01\xe4\x9f\x0c}|\xfcOxh(\xa0\x89\xd2\t\xbaA7\xe0G\xd1\xfdg\xdb\x94.\x1ae\
+\x92\x0f\xfb\x0f\xad\xe7\x01\x83\xf7\x19\x19\x15\xd89\xe8\x1f[\x17:V\x0b\xa0\
+\x01\xc0\xa9\x85d\xd3l\xf1\xa1t\xe1\xa1oi^\xc8K\r\x15\xeb9\xfaz\xd9\xda\'\
+\x01\x0e4\x1d\\\xf5Z\xe5\xfd\x14}c\xb0-?El\xa4\xa1\x10A\x84\x06\x1b\xdb\xaf\
+\xa8\xc8zX\x08z\xb7u\x0b6)7\xac8f\xc9\\2\xe0\x8e_\xf60\xd0\x88\x99\xc7\xff\
+\xac\x99\xe7r\xd1\\\xd2\xb0\xe1\xf5\xa9\xf9\x1d\x87\xb9\xed\x7f\xc5\x1a*\xb4\
+v\x19\'(\x0b\xff\xbd<\xa5\xad\xfb\xf0P\xad\xf6:\x89f\xc5\xb3\x82\xfe\xf1\x19\
+q\x1c@\xcaA\x99#\xc9\xca\xb1N}G&kY[\xfdx4\x9b\x13\xb4v\xfbR5\xdb\xfb\xe8\xbe\
+\x1a\x12BD_\xdb&\xe6\xd7\x14&\xdd\xcbC\xbc\xef9i\xfa\xe2\x18\xed\xb1h"\x18\
+\xe9\xd8\xa8\xcb\x93\xfaR0\xf8\xca\x96|\xde\xdc\xcb\xf1m/!4\xf8\x809\xcc\xc3\
+\xc3\xa3\xdb>\x85\x08m\x19N\xec"\xfd6\x8f\xa6\x1e\xa9A\xb4\x966\xb4gbv\x16\
+\x93\xd6D\x83\x95\xcf|\xcdZ\xef[e\xe5\x11\xe2\xb8S\x01d\xd7 \xa8\x91\xc1\x05\
+\xe3\x8bl2C\xf1\xbb=\xdb*\xd7\xad\xce\x16\xbf%\xc2\xa0!\x91\x82\xc2\\\\x\xc2\
+g\xe6\xeb\xdf\x9b\x06=~\x84(%8\x9bu1\x14\xf6\x00d"\x87ml\x16\x10H\xcb\xe5J\
+\xf7\x01\x08\xd0\x9cH\x01\x9eh#\x01\xf4\xee\xfe\x9e\x92\x82b\xb9\xf5\x02\xf7\
+\x1bD4s"\xb4D\x06\x89\xc8\xc3\xf2T\x8f\x95\x08\xca\xbe<9\x8f<\x01Q!/\xf2\xfa\
+\x10\xeb\xd3S\x1f\xacO,\xe0\xa3\x16c\xbb\xd6\xed\xb9\x82\xe1++\xbf\xa3I\xcam\
+\xd4=\x99\xe1\xf0\xcbV[\xa6\x97`!*\xaf_$\x834M\x99\xd9\x88#\x0b*\xff~\xb0o~\
+\x0f\xbd\x9a\xf45\x8f\xe0\x0f\xaf0\xc7uPa-\x19\xf3\xa3\x96h\xd4*HgDYYG\xbc8\
+\x1e>\xef\x82\xb9\xef\x14Dt\nm\xb1\xc2\xca\xbd=\xbav\xf6\xb3\xe1\xe2\x8c\xd5\
+>\xf8n\xf7\x18\xaf"\'6\xf8|\xe4\xf10\xa5\x16t\xbf\xcf\xfe\xa7\xa6\x14\xeb\
+\xde<\xcd\xedu:\xf8\xb2#\x9f\x9e<Fk\xdf\xc4\xf5\xf1q\xe5\xf9\xf1\xf6\xc3\x0e\
+\x00|Z\xf1 H\xa98%\x18\xc3<\xc2r\x84\xed\x05\xb9X#-\x82\xb4\x88v\xce\xdd\xda\
+\xce+\xe1;\xe1\xaa\x81\xe6\'L\xa7\x18\x08\xae\xcc+\xb0_\x1f(\x7f\x81&\xa1=o\
+\xd7\x0bR\x9f]\xd7\xfeJ?\xf8\xb8V?\x839L\xe7I\xbd\x1a\xc3\xec\t\xd0i\xd7\xd0\
+\xeeU\xf9\xd9`\x9dUff\xe6RR\xfc\x16~\xbdn\xbb\x94\xb7\x12\x06\xee\x83\'\x0ca\
+d\xe0\xf0\x856\x03\xc0H\x02\xf5J\x06\x13~\xfb\xa0\x9a\xfb\xb1\xcc\x83\xa3\
+\x85\xba$\x1e\x03\xb2)\x1d)\xd5$\x05\xdbph\x10\xa4\'\x0f\x14\xce\xfc\xa1R\
+\xca\x1cQ\xc3\xa4\xaf\xad\xcd\x94\xccgk\xb8\x8a\xe2\xe9\xe1\xa9\xf6\x16\xeda\
+e\xf1\xdf\xe6\x07\x88\x1bx#q\x8d\xe0\xe7\xe2{}A\xc2([\x8e\x86\xd2\xd6\x85\
+\xbf\x8by\xb7#\xbc`\x90g\x9e:\xe4\x88\x94\xd9\x9aK\xb9\x12D\xce\x97\x1e3\xbe\
+spp \x8d\x8c0\xe3\x05\x140\'\xe8\t;\xe8v=\xba!\x15\xd0\xa9\x1f\xe7F^\xbax\
+\xf8?\xa1\xf2\xcc\xff\x99\xe9\r\xfc\xcah\x05\x93b\xc1%\xb8\xe7\x07B?\x9b\xf9\
+D\xeb\xc6\x9f\xbc\x96\xa9!\xcao\t-!h\xe3L\x84m\xd6*rf\xebKp7\x91\xda\x87\x1d\
+\xba.N\xde\x90bp-\xca\x17\xd6\xa4\xfb\x00\xbd\x1f\r\x16\x96\x00\xe4\xd3+\r6\
+\xf8\x9b{\x7f\x89\xafy\xea\xaboy\xf6\x01\xbarlR\xee+\xd4\xed\xbc\xc4J\x99\
+\x01\xaa\x07HX\xba\x980\xf6\xf3\x12\xc9srs\x0e\xf3\x88\xa9E\x92m\xda\xa7\xfd\
+\x9d\xe7SZo\xcc\xbe\x18\xa2^\xd9\xee\x91\xda\xb6\xdf\x03i\tNrv,E\xc1\x1fKv\
+\x98\xa8>\x17\xa9M\xa1\x98\xe5\xec\x88x\xcf\xba\xfc\xadY(\xad\x9c(\x18\xc7\
+\x14\xfcQ\xbe\x12\x90l\x9e\x0e\x88\xd2\x17\xe8\x8b`\xfc\xb3\xd1\xe7kCS\x86 E\
+,\x82\x97\xda8\x05\xf3\xc8\xdc<\xdaM2\xd6#\x9e+rey\xd4\xd9\xd4i9\xb6\xfb* \
+\xe4\xa3\xb0\r\x1fHJ \x1b\x15\x7f\xa6\x92\xda\xb4\x0cU\x08\x85\xc4H]\xd3\xbd\
+ \x05\x15@>ln\xc1\xe6i\xe7;c\x0c\xc9\xc2\xfe\x9b\xbc\xdf\x08W\xb1a\x90^\xf9\
+\xf5Xv\x1eHX\xa2B\xa3\x01\x17\xa1\xfb\x7f\x80L\x00L\x9a\xadQ;\xe6\xc0\xd1\
+\xe0\xdeE\x9f\xac\xd2FjT\xeb\xedXoF\x1e\xa5\xe6\x03n\xef{r\x15\x04\t\xd0,\
+\x06P\xa6\xa5~=\xc1\x96\x13\xbcRU\xc5\xe7\xcfT$\xe5\x81\xc4I]\xfe{\xf4\xad\
+\xe6*\xfb+\xe6\xa5Vjy\xe2\xa4\x99`~+M,:>\n\x1d\xeb\xe2\x17\x04\xb6\xd0\xeeO\
+\xac\x15\x1f\xc7\xaa\xb6\xe2\xd5g7\xf3F\xde\xb3\x00G\x0b\xd5\xbe\xc5glP\xb7\
+\xcal\xd0\x82_\x11\x932\xc4\xf2E\x89\x97\x83\x15Z%A\x05\xb1\xb2\xf2\xcc\xbc\
+\xfe\xbdM\xcd\xc2-%\x0b\xc3\x7f\x85\x95\x13\xf4\x88\xe7z\xc9\xc7\xd71\xd2q\
+\x8b\x9c\xfb\x8e\xa2\xac\x08\x04=U\x8b\xc7\x1e!\x02e\xced\xb3p\x18\xefv\x17\
+\xbe\xc8w\x13E\xf7\xb6\xe0\x18\x13\x05\x99\xbb/\x9f\x0cw\xa6y|\xc7\xf0\xc4W}\
+\x7f\xa5W\x16\xfd+zJX\xf7C\x02\xf49\xfd\xb3\xde\xe4\x15\xa1\xfd\x10Pp\x99\
+\xa3r\x1c\xe8\x03\xf6\x96\xf2\xef1\x05\x1c\x01\xaf\xec\xf2p\x83\x03\xbb0G\
+\xcf;;\xae~\xb8vQ\x7f\x0c\xf2\'0*\x05\xf5j\xc5}\x98\xa3\x06\x8c\xc7p\x92\xaa\
+\xb9\x02\x05\x05E\xef\x17x\x16\xca\x92\x1fUk\xbfE\x0f\x96\xdc\xa2\x8b\xf8\
+\xf8\xf0\x08\x91MR\x94\xe7*]ft\x1b\x03\xdb43ee\xec\xea\xb9%\xc1\xc0z\xd0\xde\
+o\xa6\x18\xbd\x0b\x19\xfc_S\x1a\xe4\x10\xb4\x8e\xb4\x9e\xd7\xa1888\xcf7\xf1+\
+\x80\xb2\xa7m\xc3z8\xf1#_\xcc%\xbdpa\xb2\x89]^6\xf1P\x02Af\xe48\x94\xcb\xf0U\
+\xc9c\xe5d\xb4oD+\x8e\xf8w0\xe9A~\xd2R\x11xy\xcd\x84@w\x15\x88\xd9\x90\xe9\
+\xdf\x9c\x19\x02\xf5"`\xde/\xaf^F\x0f6\x10\x1b0*\x0c\xd83\xa0S\xaf\x85\xdb\
+\xf0\xa5\xf7\xc9\xe3b\x8f\x04.\x0e>\x93,p,Ip\x87\x93>E\xa6\xacY\xb6\x87vY\
+\xdfwH\xfcg}\xff\xe6B2_\x144\xe4\xf4\xee\xdd\xab\xe0k\xddj\xa3\x0e!A\x9d\xf7\
+e\x99\xfe\xbc\xb7w\x07\xd5\xd10\x024U\xe9\x9e\x84\xc8\xc8\x0b_\xe3\xecbn2\
+\xb0\x8a\xb2\xaa\xaa\x92RXj\xca>\xe7G\x8aX\x1b{\xdf\xbb\xad\xd4.\x03C]\xbf\
+\xfb\xd0\xc5\xc2\xc2\xc2\xe3\xae\xe7@^2-\xf6\xe4\xb0\x045\xde"\xadR\xbd\x947\
+\xd7S\x1fn\x1b\xff\x9b\xb4\xa5\xa2\xa2:<\xdc\xf7\x07\xe4_\xbf2\xd67\xe4\xb4\
+\xc9\x84\xeeU\x0c\x8e\x9aB\xbe\x1a\xcb\x92\t\xd0\x89%\x1fJh\xefP\x9f\x96\xda\
+\xbd\xfa\xc2f\xd5x\xc3\x08\t\xd4\x19\t\xdf\x15k\xf2F\x8co\x9dc\xc1?\x99\x93\
+\xa5+a\xf8\x8ck\xb17\xba\xacH\x9c\xdc\n\n\n\x86\x87\x87;\xffi!\x00c\xbc\x8c\
+\xda\xfc\xc3\xe0g\xf6\n?*\x1c5:\xa4\xdbB\xaaX+\xea\xb3L\xf9\xbc\xf6s\xc1x\
+\x9e\x90^\xa5ND\x9fj\x80X\xfa\xff\xcf\x05@NO\xf5UD=\xf1T(>\xdbM\x92?^i\x7f\
+\xee\xa3}8i\x1d\x7f\x83Im\x12%S\xd7\xd0p\xb1\xda\x83\x1a\xa5\xd7{\xfe\xd0\
+\xb7\x17\xd1j\x84{e\xae\x99\xa4\xa9P\\WhI\x0b\xd9\xdc\x8e\xcd\xc4+\xa1\xed\
+\xc5\xae(.\xbb\xdcS\x15W\x06\x99\xeb\x93\x84\x91t\x8cu\xf3\xc6h\x14\x03\xf7\
+\x18\xd6\xc4\xf3\xf5C\xe0\xed\x88)\xcd\x1b_--Fwa\xaa\xb0\xc8\xd5\xe7\xcc5a\
+\xf6\xb4\x17\xf3F)\xe6>9\xa6\xfa\xfa\xa7\xde\xe2^\xc7q\xdb\x1f|\x8a\xa1\x93M\
+%\xb1\xf8(,\x9f\xd6\xd7-\x12a_MG\xc6\xc7\x16\xc4D\xaf\xde:\xcc\xad\xb9\xba\
+\x92sw\xa5\xc4\x871hNM}\x88?\x04\xd4\xed\xfe\xfa\xb8\xd9\xa0\xd2\xa4\xba\xb9\
+\xb5\x95\xfc\x07f\xc9\xc8\xde\xf5\xbd\xf9\xcb\x98\x01\x05\xfa\xc4\x18\x1eyEE\
+\xaf\xc4X\x9cl\x13y\xd0\xe9\xad?\x02\x81\xa8\x11\xc4\' \x80Xyx\\l\x9f\xe0\
+\xe4\x8co\x9f\x8b\xc0\x8d\x90\xc5,\xb3M0!\xd9\x88\xc3\xef\xd0\xfc!\x9bz\xa4}\
+\rb3(H&\xbdHc\xfbv\xa7+\x0fa//\'\x07\x82\xb8\xf2K\xf8]\x1d\xfe\xfc\xf9s\x92%\
+\x9e\x10J8\xf2"\x11vQn\xfaH\xb1\xa0<\x17\xafR\x12zn\xa0\xae^\xab\xc7\xb9\xbc\
+\xd2H+\xa4U\xc6)4\x9b\xd6u\x86\xa8\x06\xf5\x1c_\x88\x14\x99r\x11\xc5\xff>\
+\xc0Y\xc4\xd9\x88\x92"\xf0\xaa\xa5[}G\xee\xe1\x9aJ\xc87\xbf\xbb\x82%I\x0e\
+\xc2\x90\xba\x81\x84\x91] nv\xf0\xee\x8e>\xd4_<f;\x8a\x19<77\xbcjnx\x14\x8ek\
+\x7f\xec9\x12\n|\xc0\x80\xfc0\xb2\x94\x83D\xb8/\xc4\xc81\xe4\xdc\x03\x92\xa2\
+\xae\xa6\xab\x99\xf4\xd1\xde\x1e\xcb\x8d\xb9W+\x8f\x19\x13\x03\x83n?\x0eQ\
+\x01o\xa0Oy\xaa^y\xd8\x0ez\xdc\x16:\xfd\xd8K\xb1y\xac\x84\x86\x9f\x1c\xbc\
+\xf5\x99\xc9\xc1\xd6\xb6\xb4\xb99\xf5\xcb\xb8\xfa\x05s\x98\xab8O\xf2\x13\x06\
+K(U&\x08\xebFZZzh\xa7L8\xab\xe6\xbcH\xbd\xdc\xce\x90\x06\x87\xc5\xa3\xfe\x84\
+\xbc\xe6\x9a@\x86J\xd8{\x15p\xed\x80\x83\xa4\x96pO\xb3\xd6\'\xc3\x84\xf0\x14\
+\xbf\x13\x16\x0fz\x07\x99\x93\xab\\\xdc9_\xfb>\x93q\x80\xaf\x90\xf7\xdd\x82\
+\x97\x0c(\xfd\x84\x0f\xe6\xd2\xfc\xc8\xa3\xdak\xebtD}\xd7\xc4\xff\xb9\xed\
+\xba<_\xae<\xc1Q\x8c#\xe9\xf6\xf2(\x7fb%4\xe6a$\x0bf\x1e\xad\x1dzp\xe9\xca\
+\xbf\xc5\xa9\xaf\xbf\xca\xf7\x8a\xb0}\xf8\x94\x89\x98\x9d\xbd\x1e+\xf6\x82\
+\xf5,D\xe2\x7fB\n\xdbi\xb5=\x14\xaa\xb0jC.\t\xfb\xcf\xae~\x956\n\x84M{1\x8f*\
+H\xae\xac\xefO\xf86\xc1\xaf\x07\xfd]\x90\x8c\xff\xcdg \x14\x1dg\x95\xba\xa2\
+\xa2b\xac\x10\n\xca\x0e\\\xd77\xab\xde&&\xdf\xf2\x98\x90\x16L\xe7\xdc\x13\
+\xe6\x9a\xbc\xb6\xed<\\\x01\xd9\xac\x1d\x1f\x84_\x186\rb\xd4D\xa3\xb0-p\x11\
+\x0c^\xd9\xd3\x9b<\xaf\x9d\x06]\xd0\x95F\x93hO\xe6=\xc9\x90\x99\x01\xdd\xc2\
+\xc8\xa6^(G\x81eR _N\xbd\xcc\xe3\xecbo\n\x10$\xd7(Y[\x05\x01C^w[\xa2\x88]\
+\xec&\x85\xe0\xd3\xc7\x11\xc9\xe7\xd7d\xdb0\x9c0\x1b\r\xa8\xa9=\x15e8\xf22\
+\xad\xb0@p\xd1\x12\xe0;;\xc4\xd0^1w\x9b%\x06A\xd5\xa3\x9b\x1am\xbf|\xeaA\x9a\
+\xe0\xa6\x91_K\x0b\xf9\x85J};\xd4w\xfa\n\x8b.1\x95\r\xc0S"\xfaO\x18O\xafQ\
+\xc7\xc5}/"g~\xd7\xa8S\x13\xd0\x07\x97\xfd\x86R\x0c\xed\x87\xe1\x97\xcec98j\
+\x85aN\xf2Q\xab\xb4\xa0\x90a`\x84\xf68\xf2Mj\xd0\x07@\xfe\xd0\x89\xba\x9e\
+\xf6\xf6\xcf\xeb\xb7W\xe7\x11\xc89\x04j\xa5\xa3\xd6\x8b\xb0\x9fh\xb0Y:5\x14t\
+\x87\xb39\xf6\xd4#mA\xbfK\xec{\xb6\x96\xb1\xb3\xc9Z\xe5W\x04\x7f\x91\x98\xb7\
+\xf9\xf4\xa9\xfc3\x0bV:\xca\xe0yi\x94Et\x18\x03\xfeyQ#\xb1\xed\xf1\x04\xf5\
+\xbay\x9e\xad,\xdd9`\xa6M\xda\xbc\xf7z\xe1\xd8\xac?a\xc5`\x86d>\r;\xc0\xfa\
+\xc4y\xfe:\x06\x90BB\xf2m;\x81\xfe\x00\xa0\xf2=\x16\x0f\xcdtNM\xd3\xfd\'\x87\
+/\x88O\xc3\xe0HkJ\x10G\xad\xa4\xf8\x99\x13\xf8\x8d\xc1\x1d\x97!\x19Z\xfc\x9b\
+` \x8d\x11\xcf\xffy\xaf\xad\x03EsvV7l\xb5\x7f\xb8\xffc\xc39\xb7\xf1%t\xe1\
+\xaa!`gq\x85\x80@\x9d>\x11\xa9\xecu\r\x19\x1d\xba\x97\xc2D\xd3\x1bl\x1a22m\
+\x80T\xbc\xd7_\x94#2\xd6\xf8\x92\x92\xf0.DQ\x19\xac?\xf5L\xac\xae\xbe\xd7\
+\xd5\xf9\xfd\x12o\xe0\xe5\xf0V\xca\xb7\x99\x94\x94\x14o\x7f\xf2\x0f"\xe3\xe7\
+\x96\x96\x96\xd1\xd1\xd1\xc788KO\xabW!\xa8\x98O\x17\x92\x8f%\x80\xed.o\x04\
+\xb4\xf2_f\x84GD\xbc6\xc2\xa0\xa9\xc3\xc4\xa5\xd9\xdd\xdb\xe3\xe2HZ\xf1>\xee\
+0\xe2n\xfe\xef?p\xb2\xa2VS\x91\x06\x1b\xfd/5V~\x01\x11k\xc1tJ\n\xcfEG\xc1R\
+\x99\xba\x18N20s\xd2\xf0\x84\x06\xacp\x92U[!KB\x8bC\xd9&\tao\xad\xdf\xf4\xed\
+[\x13\xd4\xd0nBW\x88\xff\xd0F\x7f\xc6\xbe\xd1\xf3\xe3\xc7\xfe\r7(L\x9c&b4\
+\xf4?\xa5\x1e\x18y\xce\xce\x01\x17\xce`\x1c\xb5&+Q\xae\xef\x95\xa6s\xea\xbd\
+\xd8\xcaS\x1c4_\xd8\xf7\xa2T\x86>$\x15\xe3\xe6j\xd2v\xda\xa2v\xee\xfd\x91Z(f\
+k\x07\xb0\xb5\xb4x[[\xcb\xd2\xa7t#M\xd9\xf2\x87\x7f\xca\xff\xf9SAX\xeeE\x1f\
+\xb4\xf4\xba\x90\x10y\xf5\xf1\xe4\xe4\xa4\xb1|\xf6\x97\x80M\xc2>\x17\xc9H\
+\xa6\xa4\x0f*X\'\x12\x17\x84j\xe3\xc8\xc4\xb4\xbe\xc1\x12\xa7\xc8\xf8\x85C\
+\xb7J\xaeP\xbdd*y4\xd0\xfbbW=\x11F\x14?\xb8&\xd0\xcd\xab\xc4\x9d\np\x8b\xe5\
+\xb5\x9c\xb9\xf97\xadR\xa0L\x88\xb0\xfa\x11\xe5\xb3\xdfJJF\x99\xeb5\x8a\xc1\
+\xe8\xd2\xbc\x0c\x85"\xfd7?\xbcuuu\xf9\xd2/\xee\x1f\x81\xcb\xa1Od\xcdVz\t\
+\xfd\xaa\xb0\xb5\xbe\xbe\x0e\xfc\x89\x95\x0c\x1a\x19\x17\xda3\xcc\x9c\xf4.\
+\xd6 i\xd4fcD\x9dQ_1\xbfF\x86\xde\\?e\xa7\xfed.\x8f\xef\x1e\xa3\xe3-\'\xc9\
+\xfdC\xa7\x16;\xfa\x87\xb5\xed\xed\xed\xc9Iu2\xc7\x16R#&&\x8b\x14\xeb\xae\
+\xd3X\x97\x8am\x9dV\xf0\xf5\x03\xf6\xf8\x88U]f\x9fP\xce\xe3t\xbdb\xbe+\xfc\
+\x9bE@\x80\xb1q\x95\ncj\xfd|E\xedB)\xc2^HP\xf0!\xba\xd3\xe0\xc3R\xea\xd3\xba\
+"4\xd4\xce<A\xd5\xf2\x9e\xcb\x03Q\xf5x_?\xcf\xd9r\xa4\xb6\x1d\xe1\x8fa\xa2\
+\x86\r\x9e\x1b\xc7\x87\xda\x9a\xc5\xfb}\xee(\xc6\xc6\x98Jh\x0bf\x89]\xdc\xc2\
+\xd8I68\\\xb5\xf4>_\xca?8~8\xfb\xa2\xc4}\x9f\xcd\xb9J\x1d\xfb\x8cC0Iy\xf11Et\
+?=\xb4\x0f^\x15\xbe\xb8\xf5t\x1d\xf4,\xb9\xfe\x85\x10\n\xfa\xf2\n\n\xabl\xfd\
+{\xbb\x93\xcb\xc3F \x9d\xf9\xd6\xe4\x9b\xb0\xebj^$\xd1-i\xc0\xc8i\xd8r^\xaaB\
+1C\xb3\x1c\xe1\xb0u\xb2F\xb1\x1a\xeb\x80\xdc\xe0\xa7\x9e\x84\x18.\x07;\xfbD\
+\x18\xa3|\x8ep\xc1\xec\xc1\xd40?\xf3\xc6\xef\xdf\xc6F\xe1\x1fD\xb3\x17\xb0*\
+\x17\x8f:\x83\x9e\x9f\xdc\xc5\x97\xa7\xa6\x0c54\xfc\x9f\xfe\xdc\xe6,\xe7\x90\
+\x9a\xfa\xfe{\xab\xe1.\xae\x82N\x08\x0c\xc0\x1b\x9ax-vm\xf6\xe4\xfe\xfe~\x85\
+b\xc2\x8a\xc0\x1b\xab\x98\xd8\xd8-\x9d\x0f\n\xc9u\xd5\xd5\xc7}x\x921\x83\xa9\
+\xf5\xe5\xf3XN\xf0&\xe8\xe2\xcc\xcc\xf6\xe5\xdd\x0f&&\xd647r\x95\xc2\xc9\x8b\
+\xeb\xeb>\x7f\x8c\xf4\x12=\xfa\xaa\xfa\xe9b\r6\xee\xbeSqSCC\xca\xf8\xc1\x00\
+\tSV\xb2\x0c?\xab\xea\x8a\x89\xa8~\x0b84\x7fv/QR\x88\x9f?R\x86\xbe\xe1\xd4\
+\xd4\x7fO\xb6k\\\x15\xe4s\xb1K\xf0P\x99\xda\xdbC\xa1\x19\xabR\xfd:]Y\xb4\xa3\
+*?\x1f\x92\x0b\xb8\xf2\xcf\xd1\xd1/ \xf4\x89\xb6\xc7\xcb\x1d\x13\x8b\x08[~\
+\xbf\xeb\xbfLa`\xa0\xbe:\xc4\xeck\xf5\xc0\x18\xa8\x9f\x89\xb6\xb6\xb6\xf6<D\
+\xbbR\x8e\x0f\x0e^\xa7+\xb5\x1a\x8d\x1dy676\xe2\xe4\x90gef\x9e\xdf\xfa\xc7\
+\xc6\xc6\xd6|\xb3!\xd7\xe7K.\x18\x96\xfcf\xf7\x1fF\xab6s\xd2m\xc0S\xab\xfc\
+\x95\x92\r|\xa7\xbe\xef\x18\x8f\x87\x87\'4\xd6\xa1V/\x8f\x8d3u\x04\xf5IV\xcf\
+\xa8\x1b\xaf\xda!h\xb63\xe0\xc8u\x0fP&\xc2(\xab\xe5\xbd\x87\xd5\xab\xca-\xef\
+\x82\xaa*\xeel\x15\xbf\x8eN\xe9\x08\\7*\xccF\xd3\xdc\xf1\xd9\x99\x19\x92X9\
+\x16\xe6\xc1\xb5\xf2\xc4Q\x1b\xdd\xfa\xf2V\x04U\xea\x1a\x15nD\xdf\x9a\xabOV\
+\xd4\xa6;\x100\x88\xee\x90\x1e\xb9\xde#q\x06V\xb1\x06\xf9\x0b\xf9_\x02\xdb\
+\x19\x19\x06\xfb9*\xa0(\x99\xbeD\xdb\x96\x06\x8fT\xad\x9f\xac\x9bgMMM\x1e\
+\xa2o$^\x99h\x18}\x19\xd9\x9a\x99\x9d\r\xed1{\xe76\xack\xf2doj\x9a\xbb$\xc1\
+\x91\xac\xf0\xde\xc6F\x1c;\xa7\xc3\xefJ\x81\x91\xb0Xc~i\x89\x8b\x9d\xd0\x87D\
+\xbc\xb8\xb8=\x8eZl\xe0\xdc\x9f/\xd1\xc8\xd4t\xc7\xa7\xb3\xa8\x881\x1d\xd6\
+\xeb\xfe\xf3\xc8sp\xc3\xadp2\xf22E\xf4O\t:\xe5\x80\x8f\x931W\xa0,\xe2\xd5\tn\
+\xf2p\x1e;\xd9\xdd\xa7pt.K\xf5^\xb1\xefHe\xc9D\x9f\xa3\xb9\xb8*\x01\xa5\xd9\
+\xb9\\\x17\xa8h\x10\x92)*\xca\x9b\xb0\xe4\xa7\x00\x00\xf9\x8eZ\x0f\xe9\xc8\
+\xf6\x01\xdb\xf8\xef^V\x11\xcf\x8dI\xd7\xdd\x92\xaet\xfej\xad\xe5`\xdb\x95We\
+ee>ZKg\'\rVx\x8d\x81\x05S\xf5\x84\x8e\x9c\xe5+X\x8b\x95\x8e\xf0\xbb2+6\xa21+\
+\x1d\xb0oh\x134\xd3p\xd4\xaeq!\'\xe7ou\xd0\xc6\x81s\xf3\xfdl\xd7]\xe3\xb0\
+\xe3\xddoS\x7f62\xb0/\x89\xf8e\nF\x8a5`\xb3\xe7\xe7\xc8\xda\x85DEnW\x137\x12\
+\xa7D\x9e\xaf\x0c]\xda\x8d\xb8#\xfa\xdc\\\x0e\x9777\x8b`\x8c\n\xccIk\xaedu\
+\x13\x1aeD\n\x8b\x94\x94\x94\x00v~\'FZ\x9b\xe0\xd3\x10\xa7\xd1e%\x9a\x84M\
+\xe7\t\x81\xb3\xfe\xad\x16\x8a\xdb\x8e:\xa6I\xb6\xd6j\x14\xb7\xe3C\xf4\xbb\
+\x06\xe9\xee1\x10\ncO\xfe\x0c4\x9b\xb6\xb1\x9ds\xc0nU\xcf\n]\x83\xb2\xcf\x93\
+\xb1\x94eU]\xf0\x06*{\xcc\x86\xb6\xdc%\x9f&\xe3+u\x1c\x82\x82\x82,D\x90\xdd\
+\xf23\x85\x9c\xd7\xcf\xd6\xb1@L\xcd\xa7\xba\x06\x95)\xd6\xfai>q\xe0xW\xaa\
+\xf7|\x99\x9b\xee\xb7\xc5\xd1\xa9\xc0X\xebq\x8e\xed\x9c}\xd1\x88\xea1\x03N\
+\x9b@\x83$\x99\xbb!\\\xac!\xf2J\xa2\xe7\xdc\xdf\xd8x\xe9\xe1\xc1\x9f=\xd9\
+\xde\xd11+\'\x03\x90\x16\xeb\n\xf0\xd8L\xd1\xc4sj\xadu\xbfl?\x99\xa0\xca\xbf\
+\xe5\xc4\xf0\x80r\x9aw$\xf9=\xeb\xda5c\xcb\x8f\xdb\xce\x90;\xfe\xef\xcd\x9c\
+\xc8\xb6\x81\x81\xa1\x15\x1f\xb98\x0c\xc8\x05\xee\xd4\x95\xe6\xeals\xb22-v\
+\xc2(\xb5i\xfc\xe8\xfe\x9b6\xcb\xc188\x14R2\x85X^\xce\x19\xd9\xa2\x0bE-QK]\
+\x843\x94ULl\x9d\x8b\xa49\x01\xa6\xd0C\x9b%\x8c\x88\x98xp\xbd\xf6\xdb7\xe6\
+\x94Dso\xf9B\xf5\x16g\xcaX\xb9\xe8~z\xfa\x02)\x08X.\x17\x8e_\x80\xb0\x17\xa0\
+\x88=\xea\x1c\xa5=\xb1\xae\x9fObQ\x95cP\xcf\xf9\xe7\xd8%o\xcbT\xb9\xb81\xf2\
+\xe4\xdd\x1d6g\xee\xee\xdaf\x0f\xfa\x96\xef\xee\xef\x99\x08\x8777\xbf\xb6\
+\x19\x05<\xfcpk^\xccVb\x14\xb0W\x0e\x08\x08`O\xbeCT\x07\x06\x1c\xcc`\x9ez\
+\xfb\xff\x11\xfc\x8bw\xf3:=f9\xcfea\t\xec\x14\xcdU\x18\xce\xfe!\xe1S/\xba\
+\x15\x9b\x94\xc8\xde\xe1~Qh\x16\x91\xf7\x13\xa2m_\xeaD\xc8\'\xa4f:\x96\x94l\
+\x8d\xec\xe4O\x04y\x8c<\xd8=\x0cC\xcb4(\x82]J,\xf69q\x7f\n\x86\xa1\xb9\xb4\
+\x19:\x0c\xf8w\x05^\xa2\xdf\xda\xda"\xd9c\x11Sx\xc6\xdc\xba\x9a\x9a\x9a\xf0&\
+\xbe>\xb7\xbf\xe8\xa4#CcY"\x1b\xeemj\x10 \xb0\xf7\xedW\xb4"ga\x013\x81\x1fn0\
+\xd044\xca\xb4\xbc\xbc\xbcf\x9f\xaa\xf6\xf6\xf6\xccx#\xc5y\xff#\xea\xfcx@r\
+\xd1\x04\x14SA\xc1\xba\x15\x9f\x9d`\xba{+U\xce\x08p\xe7\x84P\xc0\xb5\xbc\x05\
+\xbd+N\xba}\x10\xad\xb8\xc7\xcf\x0e\xef3\xaf\xd5\xab\xd0b\xff\xd0J\x95\xdc.\
+\xe9\xb1\xabfm\xbd\x15\x1fta\x99\xb3\x93\x99\x999\xb5\xd7\xd0\xf7\xf7\x84\
+\xdb\xfb\xdc\xe1\xb6\xa9I\x10\xa0\xf7 \xbf\xe6\xc5J\x84=a\x14\x1as\xa4\x1e?s\
+J\xe4c\xa0dL\xb3\x8d\x8d\r\x00\xcb\x16Z\xec\xf5\xf1R\xddF\x96U\x13:P\xd1\xef\
+eel\xc9\n\xb7\x8f\x81\xa5\x8f]\x97\xe7\xcd\r\xc4\x0b==o\xa1C[#\xa9@\x95?\x04\
+v\xcd\x1e\xbc\x9eM[\xdbDW5\xbc\xa08\x91uo\xf5\x7f\x8d\xb4\xd6\x02d\xe3\xd8\
+\xa8\x18\xe1\xf0V\xb1ZK\x01\xb4|\xea@/\x05\x18:\xcd)M\xdc\x08\x06"pl\\\xec\
+\xfe\xe5\xdd(2]\xaa\xb4\x83\xa3\xbd\xfdO[~\x89\x8fge~\x96\xd7\xd0\x1e5\x07\
+\x07\x0e=\xe7\xa3\xa3#\xa6~&\xd8\xa0\x82\xa2W\x7fja\xfa/\x05\xbb=\xee\x8f\
+\xad\x06\xf9jH\xd4\x80;\xb3\xfb\xfbm\x96\x1cc\x1c\x9c\xa1\xf4\r\x00%\x0f\xd1\
+%\x04\xa2\xb1\xddM\xa8b\xd0\xf5o\x8f\x19o\xee8\xfcS~[\x9b\xa8x#\x80/R\x0b\
+\xf4\x04\xa9\x03\xeb\xaf\x94\x94TJ\x14\x8b5z\x8b\xc0l\x88J\xc3\xe6\xe9-\xfb\
+\xd0e\xe0H\x1c\xfc\xc4\x14\x8dr\xd5S\xd7\x17\x1e\xa9\xe5?}$\x0c-\xbf\x87\xf0\
+\x12P\x90`\xb5B\x81~N\xcc^\xa9\x93ih|\xc9s\xe7-\x11\xbd\x1f\xef\xd5\x939j\
+\x03\xc1\xb7rj\xb0\xa8s^\x9c\n/\xa3\xfa\x16\xa0S\x0e\xe4# \x81\xb9o\xfc<\x1d\
+=<\xfe\x08\xaa\x80^\xa0\xa1\x08E\xb8L\x10!6\xae\x94$\xd2\x8cLL\xc2\x83\x81^\
+\x18f\xd7\xbb\xd6\x17\xe1\x93\x03\x94\xfe\xb0\xcc\x17|\x94\xcb\xaf\xc7\x0f\
+\xe3\xc70\xc6/?\xdc\xd7\xd7~y\xbc{K\xa0(l\x7f\x81nGn/\xa9\xae\xc3\xdc\xe5\
+\xbb\xf5}\xf1\x88\x04H\xfdD\x90\xb9$\xf13\xd4\xc9T\xf8\xf0\xdd\xdb\x9d\xc2\
+\xa2"ac\xb5\xa7\xc1A:\x92\xb0(\xb3\x8b\'\xe3\xfc;\x1a\x88\x15`\xdc\xdb\xa5g\
+\xbd\nP\x1a4\x1fy\xf2kh\x95E\x9c\xff\xbb^~\xbe\xae?\x07\xf2+W\xe4\xc3\xf6\
+\xf4\x9e&\xa0\xf7\xb6\x8c\xfb\xee\xad|T%\xea\xe5\xe6\xfd\xba&&\x12\xaf$B\x86\
+*\x8b\xcb\xd0G\xec\x9c\x05RGm\xae\xff\xda\x01\xd7Y\xa6\xb5\x7fs\xba\x11\x96\
+\x10u\x1a\xd5\xea3\xb8\td\xf3p\x19x\x90m\xf3\xcc\x8c\x97(V\xeeuz\xb2\x92MqK\
+\xa9\xb7\xa5%C\xea\x08\x17\\\xda7{\r8x\xbe\xda\xd0\xc1%\xd09\x1f<\x05\xda\
+\xdb\xea\xeaP\xaeU*u\xb0\xcb\xdfAA\x9c\xd7z)\x1f\xdb\x97666\xc4\xc7\x81R\xfe\
+\x91{\xae\xc2\xc2\\V\xf5h\xdc\x82c\xeb& $\x04`\xcb2e;i\xf4\xc0jwH\x18Ut\x10{\
+rFv\xe3\x87t0n\xfc\x88\xd5\x97\xa8"@;\x15\x7f\xb4\x1a9[Z\x86&\xf2\x8dK\xdc\
+\x1fF\xbdd\x11\x15\x13\xe3\xe0\xe0x\x9e}~0\x1d\xd6\xda\x87\x93\xe6\x0c"\x93\
+\x81\xc3\xdd\x16\x85G\xeaxw*\xaa\xaaTJ\xa6\xc8\x9eo\xe8a?\xcd\x1e\xde\xf3\
+\x91\xc7\x0f\xbe\x16\x15\xfc\x1c!\xd6Ie<R\tA~K-\x91:\x92\xe9\xf0\xab|\x1e\
+\x01 `9\xc2\xfe\xc6\xc7\xe8?\xefW\x84Qf\xd0\x9e\xbbc\xe3\x93\xbf\xce\x7f\x1e\
+\x97c\xaf7\xad\xb1\xe0F\x04`8\xef-!\xb4\xae\\\xbf"}X\x0b\x0bFC\xa1b\xc9\xc1\
+\xb5\x04\x80\xc3\xbf\x87\x8ax\x17\x18\xa4\xa1\xba\xdc\xa6!\xfb\xb8\x90\x1ff\
+\xbc\x80\x02*\xd9hzy5O\xedy\xb4\xff\x19\x19\x19\x19\xf3ai\xa8b,\xfe\x82\x8a\
+\x89\xb7{\xe9\x0b\xc2o5\xaez0\x90\xc8\x1d\x7f\x1e\xe8\xcbt\xc4\xfa\x8f\x98\
+\x98\xf8\x9e4\x80x\xe1s\xd3\x1b\'\xc0+\xb1\xa8d\xdd\xf4\xf3\x04B\xb8\t\xaa\
+\xab\xab\xbd<<j\xc0Ik-\x7f\xf6\xd9-\xb0\xc0\xc70\xfe\xac\xe1\x8a\x8a\xad\x99\
+O=tw\x0f\x14\x8d\x06\xd5S\xaf9\xeb[ZJ\x85v\xdd\x90\xf8\xd3"\xdc\xa4LMM}|Z\
+\x17\x8fp\xd1P"p\xa9\xef\x863%C\x86\xaf\xdfK\x8a\xa5\xa9|[\xdb\xc4\x99\x95\
+\xab\xd5s\xf4\x12\xc6\xa5\x15\x01\xb0A$\xae]\xc8s\\\xc2!7\xd3\x8b\xec\x02C\\\
+\x0b\xdc\x17\x13\x1776>>\x0bd\xf0\xfd\x9eH\xd7\xb8\xd7v}\xd0\xe7i\xea\xc4\
+\xb3+\t\x0f\xd1l9+\x93\xf7e\xf5\xe3\x0b\xef\xdf\xdb\x9c\xb5\x8aW28&VM\x93\
+\x86!\xc1?\x99\xf6\xce0l\x86\x96j\xe0\xb3\xc1\x8e\xcd\xcb\xc2go\x8e\xa9\x9e\
+\xc5*\x9f7n\xf0g\xd5\xd5I\xf1s^@\x12a\x9b\xdd=\xa8\xc0\xad1\xf41PSS\xd7\xd7{\
+z|G\xa2\xc8/\xe5\xdcO\x90\x05\xd5\n\x1a\xe4\x92{\xdb\xd8\xda\x82d\x0f\xa5\
+\xe8\xa4\xfa\xd3zV\n\xcc>\xd6\xf4\xc4"\x06l9g\xa6\xad\xb6\xbc\x97;V\xefVV\
+\xeeW\xbc_\x06q\'\xf3\xd5\x98K\xcd\xc7\xa4<\x86\xb0\x8b\xb9\x9et\x1f\xe19\
+\x9b\xb6y\xbf\xc8S?$!v\xff\xce\x1e\xab\\\x8e(P\x9eX^\x96\xf0\xb69Y\\y\xc2\
+\xfd>\xb3M\xf1z\x7f\xff\x86\xec\xa8`\xf2\x8b\x80\xf6\xb6T\xc5\xd36\xa5\x0bn\
+\x0e\xb9\xa3\x83\x83\xdf\x96a5\xc0\xd7\xb9~\x7f\xcf\x83\xf1\x90\xaa\xa4\xf3\
+\x85\xe5\n\x13i\xf0*s5\xb9qb\xbc\xe8\x92\xa5[\x07Zjl\xd1\\\xa9"f\xa6\xd7\x18\
+"\xca\x14ie:\x13%\x90\xb6\x00\xa7^e\xd2\xd14\xbcV-\xf8i*\x8egi\xfaW\x95\xa0=\
+G\xc3\xd7\x8d0w!\xf4n.x(\xd0\xa4Y\t\x96Z?`\x06\x08S\xf1\n\xa3gZY\xe5\xb0\xc0\
+\xafr\xfa\xfe"\xf1\x83f_\xc6c\r\xba\xa9=\xc9n\xd1\x9e\x98\xf8z^\x90\x04\x87)\
+\xaa\x0bu?\xa0\xd4\xb4\xc0w\xa2\xcb\xd5\xf5\xf3\xa5\xc9s\xd9\xf9\xd6\x13\xc8\
+\xc2\xf3\xe9Xw}\xf2\x8e\xe4\xb1b\x01\x7f\x15\xb6\x83C\x06\t7\xa7\x19Sy\r\x9e\
+\xb2uj\x98w,Q\xcd\x1d\xa0\xf6\x9a\xa3\x1e\x07\x8bOy\xfdw\xdc\xf5\x1c\xff\x1c\
+\xfe\x12\xf9\xf1\x96\xf6\xf9\x15\x86\xdaF4O\x07h\xe6\xfc67\x9b\xf2!\xe9u\xef\
+\xa7\x87\x14\x9b\x90\x13yX\tN\x16\xc5\x8dp\xaf$\xfay\xc1\xf0\xb5\x9e5\xf5\
+\x9a\x97z\x12\xeew\xec\xba$\xeeU\x95\x8d (LQ\xf1`\xf9\xca\xb3\xe3m\xee\xf8\
+\x96\x1b\x15n\xbb\xe5\xd8\xab\xc1\xba\xc3\xcaD\xc3\xeb\xe3\x15\xaf\xf6%\xc0=\
+\xea\xcb\tz\xdb\xd4459\xa7Z\xa5.\x1e\x85gq|\x0f\x06`\xb0\xb8\xac\xb1\xb33P\
+\xa0\xfdg\x9dcc\xed\xddB\xe3\xc1\xe0]\x1c\xb5\xa8\x87m``gy\xf9\xc1S\x80\xa1\
+\xa7\xc0\xe2\xefi\xdf\x9b!\xf3\x1fs\x82\x99\xb1\x89|\x14\x8d\xe1\xd6\xf3]\
+\xf7\xed.\xfe\xdb\xaa\x12\xf5T\xf1~\x7fhrv4\xf7\xac\xe0M\xf4\xe9\n\xc3s|P\
+\x98\xbfH[\x97\xc3\xb3n\xe7]\xb2\x17w\xc7\xf9\xb2\xdfq\xfe\x10c\xb2\x02\x17\
+\t\xf6WO\xfd\x94\xd1\xcam\xc0\x88\xb5\xb5\xb5\xb1sp\xa0\x86\x04C\xf3\x87\xaa\
+\xb7\xf4S\x88\xa3d$r\xf1\xb6\x7f\x86\xe1\x97i}n\xbc\x9e\xabea*\xfer\x1au\x8a\
+8\xfc\xaeQ\xc6O\x11+\x1fO\xc3\xc5\xc33Xpt~+C\x9f\xd8cV\xfa\xfd\xfb\xa7\xdc\
+\xd9\x81\x81\x81\x12\xc0J\x95H\x9e\xdb\xd5\xea\xfd\xf3\x19\xb4]\xb7\x850\xfe\
+?K\x88\xf3K\x17\xffGy\xc9;u\xf6\xe4u\x9f@\x1b\x1b\xe6D\x98\x99\x88\xbd\xb3\
+\xf3\x95\xb7xXB\xa1|\xfc2Ek\xb2Bq\x1eY\xc4\x03\xadso\x8f\x19\x0c\x92:\xb8\
+\xfe\xaa\xb8\x8eJV\xcc\'\xddB\xa0\xdd\x9e/s\xe2\x8b\x14\xb7tsx8F\xa3A\xecGB\
+\xfc<\xa0A\xad]Gt]\x90\x9a~\x1e\\\xc7\x8d\xb0d\xfbo\x987?\xda\x9f\x91\x82$\
+\x91\xbeV\xef\x17\x8c\xbc~\xb8b\xf6@O\x8e\x99\x9b@\xfaQ\xc5\xe4\x1b~jdDx\xf8\
+\xf2\xdd\xad!wj\xf4\x8eO\x8a5\xd0\xbc\xcb\xcb\xcb\xb5\xd9\x89\xc1\x95t\xef\
+\x86`\xe9\x00P$+l\xd1^>\xab\x0bSu\xfay\xfd\xfb\x88\xbf\xb4\x97\xfe\xe9ge\x95\
+DVvUY\x19\xd0\x8f\xc4\xc7K4\xca\xccx\xd1\xba\xb5\xd5\xd5k\xfdz\x92U\xbe\xb1\
+\xd0\xc4\xact\xb9\x00\xea\x95\xac\xc0\x12\x1d\xfd\xd9\x98\x86%n-\xfe\xf9\xe6\
+e\xcd\xcc\xf7\t\x9d\xdf\x18I\x1a\xfac\xb0\xe2\x131\xe6\xb0U\x12<0\x18\xf0\
+\x93s\xa5q\xb1\xb1\x00\xb1\xab\x9d\x89\xb8\xaeJ\xbd\xd7\xddy\xf4\xbb\xa6\x15\
+\xf7\x9e\xf8\xf3\xe7aw\xb2px\x18\xf3\x8cO\xb6\xa3\x9f\x9e-Y8[%Y\x83\x89$\x1a\
+\x00\x0b\xc4\xe1\xfe\xcd\x8f\x16\x95\x92\xcc\xec\xc6hE\x05\x05EE@\x0b[\xbf?\
+\x0c%\xb2x\xe7<\xffN\xed\x9c\xae\xad\xde\xf8\x890\x05N`\xcb\x9faE\xef\x03H\r\
+{\xd2\xc8\xd8\xe3EV\xa7A\t\xcf\x90\x12a\xc8(\xd5\x8c\'\xbd^\x81X\xbb\xa8j\
+\xb6\x04\x1c\xdc+\xe10\xbesv\xc3\xf8\x83S\x9b\x1d1TI\xf0\xb7O\x89\x8eL\xaa\
+\x87\x16\x81\xa6\xb5Bp\xab9\x87\xf7D\x10"t]\xcd\xf3\xbc\x7fI\xfb\xc4\xdb~\
+\xb7v\xdc\x80\xb4l\xf7\x98\xab\xc3`\x07\x91*\xd6\xe0\xe2\xe2\xd2\xa6,\x97\
+\xa5O\x1cv\xdc\xdf\xdf\xb7wr\xea\xf8p\xaf\x12\x10\xf0\x86\xf1\x95S\xd3\xa9\
+\x1a\xab\xb0\xa7\xcb\xd7\x9d\xfa\x86\x05#CM\xbf\xcd(\x86\xb5\xe2\x9a%s<t\xe9\
+\x96\xad\xf2V\xed\x18\xd1\xd4\xa9d\x18wsC\x03\xbf\x90\x90)\xd0!\xc8\xc0\xdf~\
+\xbfK\xd6@L-\xf6\x9d?\x0c\x9dD.\x1e\t\x02n\xa0c\xf9\xe0\xd2\x9a\x8f\x83x\x01\
+\x8bS\xcc&\xa9,\xdf\xfc\xba\xbb\xbb[,u\xd9m\x8e:J\x86\xbe+e\xd0{yn\x8e\x8c\
+\x9c<\x84Eh\xa4\xce\xd8\xd8\x98s\x04\x17\x07\x07\xfe\t2\x04-\xdc\xc9\x851Z\
+\xf1\xe9\x8b\xd3\xa4\x92\xcc\xd0W\x94\xe2\xd1\x88\x830B\x95\x95\x95\xf5\xb6\
+\x80\xecT\xc3\x96\xca\xfb\xeb!\n\x0c:\x86$\xc4\xca\xda\xba\xff\xf8\x9c2v\xc0\
+2 \x00\x07\xe7\x92\xb3OEE\xc2\xd6v\xceXW\x974JF\xad\xdb\xc5\xd99\xfc\xc4\x99\
+=\x99\xa29VZ\xbc\xfe\xfb\xf7\xef\x0bz\xb1X\x91*\xd5}\xee\x9b\xa7\xde\xa5F\
+\xef\x01\xdc\x95\x1f\xec4\xfeb\xbcw\xf1Y\xeb\xe7\ri\xc0\x9e\x95\x81\x16\xa3\
+\x06+\xd1\xf5\xc0\xdfS\xf1\xf8lT\xd34%f\x80\x19W\x91.//\xc3\x12\xbc\x02oG:\
+\xfc\xae\xc7FG\xd1C{\x0e\xeduvSb\x9d\x80C\xb0Q)0\xa62\xadkhI\x03mN"\x15\x8f\
+\x13\x03@3\x02\xfa3\x9e;\xc0\xe1\x17\xd7\x89\xe7\x8eW\xda\xe8\x1a\x1a\x1a\
+\x92\x87\xab\x97#n\xfd;\x1d\x82R\x8d\xb8i))\x1d\xec\xed\xa1\xd6\xcb\x1bW\xbf\
+\xc4\xb2\xc5\xc7\xf3\xd9\x13UJ\xca\xbf\x7f\x97;\x8e\x0bO\x81\x02fP\xe1\xb3"k\
+x\xbc\xa3#>\x14\xaa\x081\xd6\xd6f\xa4\x90\xe3\xaf\xe2\xd6}I\xcf\xce\xcd\xce\
+\x1c\x864\xa7k\xd0\xa6(#\x83d\xfb\xa3\xe0\xd5P\x08G\xf2\x96M\xd2\x0b\xb89\
+\x1c\x8aL$7\xfb\xc4\xdd\x82!\xe1{\xc1J\x04xU6\xef\'j\x9f\xf5\xa1\xa9\\\xef\
+\xbb+\xccf\xf5\x00\xa5\x92)@\x8f\xbf\x8aPPxr\x10}\x06\xe4\xa0\xd8\x15t\xb7\
+\xfe\xa6\xe3M)H\xaep\xb2O\x1e7\x1e\x1c\x7f"\x1e\x04\x0c\xfa\xd0t\xe7\xc9\x03\
+\xe9\xfa\xa9w7)\x195\xe5Ga*\x83\xca\xab\xa4\x12I\xbb\t\xdd\xf7\xba\x92T\x81A\
+-\x0e\xcfO\\/\xc4\xc3\xb9\x7f\xbf_\xc0\xce+\xe3/\xaa-{\x10G\xf4\x16\xc7\xca\
+\x89\xc6O\xec\xdf\xaf[HE\xa24\x8c\x8f\xae_n\x86\xbeK\x1a\xd6\xaa,\xdf\x96\
+\xf8\xf5\x87\xb2\xfdzz\xb8\xe4\x89\xf7V\xd2\x1d\xac$\xce\x84\x1e\xad\x02\x14\
+\xec\xf5\xedJ\xebE\xdc\xa8`\x8e\x12\xa3\xa2\xa2"\x10\x84o%\xdf\x00)Y<\xf2\
+\x1c\x13\x13\xc9\xd1\x1d\xda\xc2\xe8X;I\xec\xf3\xbb>\x84\x8fy\x88v\x14\xcc\
+\x1e\x00\x85\xdc\xb7\x06+\xd6pu "\x98\xfc0\xfeFW_\xbf\xacrbff&\xff.Y\xa5\xb8\
+\xb0\x96\xf5oG\xbf\xc5\xbbb\x8ds\x80x\xf6\xbe\x97N\x10B\xb3Tt\x99\xeb\xbf\
+\x8c\xda\x9c\xdf\x1aI\xe4\x8ay\xdcL\xac\xae\xae\x0e\r\r\xc1\xb1I\x8b4\xd8\
+\xe8\xde\xe8\xf9\x03\xa9\xf5\x8d\xb9D8Nz~\xe0\xc8s\x85\xa2\x15\xbeL8\xfe\xbe\
+\xd1\x00\xe7\xc2\xff\xdc\xc1Gk\xd5\xdc-\x1e\r\xef\x8bX\x04.-4"\xc8\xca\x9b\
+\xb19\xe3%\x01\x81\x04>\x18\xfe\xc3\xa2v\xd8\x11\x10^Ccc\xf8l\x00_\xfa\xc5\
+\xad?\xc0`\xc0~\xdc\xc9\xb0*\xd3\xf6\xe5\xa5\xa5\xd8\'\x11\x1d\xf1\x1f\xb8a\
+\t\xed^\xf2\xe6\n\xf1Rv+\x9d\x01\x1f>|\x18\xb6:\x03\xf0\x90j\x10\x07\x0f\xcf\
+2\x9c\x8f"\xf6\xb6Q\x9c"\xf6c\x8a(`O\xc3\xdf\x95\xe8\xa6\xf4B\x08\xd8\xf8\
+\xd2\x95\x97\xd1yR\xd7\xf2\x9e\x81\xbcs\x16\xbf{\xfd\xfa5}b$~\xef\xb9?``\x00\
+\xd9\xc9}\xfa1E\x18e\xe5\xe4\xc4Ec*7)\xe3\x1dm\xc7\x89\x84\xa9\xf8\xb5\x9d\
+\x9fb\xd4\xc0Y\x19\xa2\x8bD\xa3\x08\naw\xa6o5\xd2\xa0\xff7\x89\xf93\xb2\xcf\
+\xcf\xb9\x8e\xc9\x8c\x8c\x85\xe5\xe5\xe5\xad\xad-\xc3f\xf9\x93awm\x11\x8dG5V\
+\xb4\x10W\xc6\xe7I\x98\x96\x16\xe3\xfe\xc1\x81X\xc0\x9d\xc7\xcai\xa7\x19/hD\
+\x99\xea\x05X\\s\x8f\x91\xe8F[\x01\xa1!L\xa4\x07>\xf1\x17l!+\x1aB\'7L14\xb6\
+\xd6\'\x11\xb66\xaa*\xc9\r\xa4\x98\xdb\x01\xac\xcd7\x8d\xb2\xfe~Y\xb9\x9f\
+\xfe\x7f?\xe4\xa2\x06Yy\xda\xd88:\x82\x85|\xed})\x92\xe3\xbc\xfd\xc9\xbf\x15\
+&\x13\xb7Qh*\xf3\x93$\x01En\x89\xfa\xd7\xb8\xa7\xdf\x8c\x93\x06\x18\x11\xfc\
+\x82i-\xf6\xc6\xdaZ\xb7\xad\x9f\xc9\xaf\xdf\x8f\xb1&+D\xf4\x9dn\xf1\x04\xe9\
+\xebW\x01i\xd4\xd4\xd0\xc0\xcd\xc9\xc9\x9a\x8ce\xce\x95\xa0pA\x9f+?\xaa\x9a\
+\xb6\x99\xfa\x95h\xf1\xfd\x11T\x8d\x01\xed\xd2\xce\x0b?0G\x0bd\x04\xc3\\@\
+\x11beKs\x93*\xd9\x99\xca}\x88t\xdb\xb6l^\x91~V\x84\x1d\xb3\xa0\xabw\xff{\
+\xf5\xa1\x96E5\x08T\xa1\x9e8F\xac\x81BV\xa9\xc0l\x88\xef;,v\nW\x85\x90I\xe2K\
+\x95o3\xbe7\x1f4\xd4\x02\xfa\xbdz\xf4\x13\xf1\xe9y4\xe9,\x8b\xd2\xd9\x95\x0e\
+\x1b\x0c\x9cX\x89\xdc\xe7\xa8a\x8b\xb0\x1e+\x1a\x89\xa9Z\xef\x8a\xc2\xc2\xd0\
+\x11\xd7\xd5\x14\x0f\x0f\x8f\xe0\xc7\xb8\x00h1K\xb2\n\xca#V\x8c\x19#\x15\xf2\
+|\xd5\xe4B\x0b\x1b\xa6\xef\n\x86+\xa4\x12\x14\xac\x17.\x19\xe2\xcd<\xcd\xf9K\
+\xc0&\xba\xff\xd3}\xd8\x1f\xc2\x17]\t\x9fT\xd0J5\xb2\x98\xbb#\x851`\xd6\x0b\
+\x7f\x17\xbb\x15Pnfm\xeaG\xc7\x16F\x99_"\xae>\xf7[\xae>@\xe2++&.\xaf\xae~\
+\x7fA\xf6\xf0c\x95\xc3\xcf\xa0\xc2\xceAWH\xeb[z\xbb\x1cM\x9bx\xbeA\xb8\x96\
+\x1d7\x86\x9b?\x80\xbb\xe4\xfc\xc7?~\xc4\x15\x80\x1fT\xcd\xd7\x8b\x01\x86\
+\xd6\xf0\xbf\x03\xa3\xd7HHNv\xf6\xf0\x17\xa2\xa5?Z\xb0\x85\xdd\xcd\xda\x12\n\
+4\xc3\x0f\xe7\xeb\xdf\xf7\xc4\x847\xe5N\xbcK&\xfa\xccGg\x8d\xb5\xd7QJ\x11l,\
+\x87%\xce\xf4\xb0?\x96-\x86\xf7\xbe$\x11\xf6{\xfc\xf9A\xf2\x89\x810J\xedg\
+\x8a\\\xe5\xb60\x1bD\xc6\xb8j\xe0\xc5\'\xbe\xb0Y\x16U\t\xf4%\xcc\x9c\x1d\x95\
+\\\x89\xc7uE\x1eBh\xc2\x8e4:K\xd2\xb0T\xe2\xe5\xd9\xd6Hu\xd7\x93(\x04\xeda]1\
+\x95\xdb\xb8\xeb\x8e\xfb\x96\xb5\xcft7\x9bc:\xbf\xd7\xb6 \xabaPT\xf3\x85\x90\
+\xde\xe1\x17\xa7N\xc3\x1b.\xeaL\xad\x87+/\xe7.\xf9\xc7\\\x8b4\xde\xe2\xfcyaq\
+q\xaa\xa8p<*a\xd0U\x9c\xe5\x18\xb7\xa5\xb5B\xf1\x17\xcf4\xb0\xaf4?!\xce\rj\
+\xadmEI\te,G\xadL\x05\xc2\x9e\xbd!9\x0c\xbf\xfcc\xbd\xf9k\x817p\xa4\x98\x9d\
+\xfa[\xa3e\t\x07\xf9Y\xa4\xad\x80\xcf\xa7(d\xa8\xf1C9o\x9cPQQW#\xea9\r\xf5\
+\xf5\xff-Y?\xfe\xcf\xea\x1f\xc7.\x19\x1a\x19U\xb8\x94\xee\xf0Q5\x1c\xf4\x13\
+\xd6\xea\xd1c\xb8\x00\xe3\xc6\x96\xbc\xc5\xd7\x14\xb3\xd3\xea\x1b\x8dn\x95\
+\x06\xf4\x83e\xf4\xe3\xdd\xb9R\xcb\xb1\x9cQ\x9b\xd9\x99\x19\xb5\xcf\xf2\xbf\
+\xe3,\x04\xfa\xf8Z\x11Y\x1ae\x15\xf5\xd3\xf9s\xe1?k\xfcz\xb4\x8d\xb4\x8c4\
+\x8c\n\x84vc\xe5\x18\x0e\x03@\x90+}\xb1\xd5\xf0\xdd#\xf3X\xa0\x834\xdd7\x19q\
+\xc7\x93\x90\xb2yt\x99\xabi\xea\xe8\xd8\xd4\xeaY\xf1\xa5K\xae\xca\x07\x85\
+\xec\xdc\x1aq\x93\xc6\xca\x9e\xdf\xfe\x19\x18\x90Su\x89G\xd8\xcb2\xd0%+ \xd3\
+\xfc\x93t]\xed\xc6\xff\xfe\xcbR(^XX\xc0\xa5\x12OP)q\tr\xf5c\xfboz~^D\\\xdc\
+\xc8\xc0\x00K\x97\xdeH\xdb\x91\xbd\x98=ud\xd2\xcb5\x91\xa0`*\x18\xa6\xc5\x88\
+"\x815\xc8f9\x82/\x86F\x82\x9aN\\\xb5\xa0\x87\xf3\x87 u\xb8\xa2\xba\xda\xd2I\
+\x97=\x99\xc7\xff\x14=\xc5\xfa\xbc\xd5\x9f\x95(\x86G\xde\xc1\xc1\x9e<\xa5\
+\x87\xbe\xab\xdd\xbcY\x8f^\xa5X\x830\x8a\x91\nW\x8c*\xceU\xf8\xe1\xe9\xfe\
+\x98c\x13+n\xa7\xf6\x83\xb9\xf8\x97\xf1\xea\x97\xd0\x0b\xdf\x00\xe7\x8f\x1fG\
+z\xfe=\xbbg\x1a?\xd7L\xd2d\xae\x7f1;z\xe49.\xb2\x8d\x12\x1d\x82\xe5$\x0b4\
+\x9b\xe8~\x14\xf1\x9b\xdf\xbf\xbf\x0cn\xac\xf9,\x8b\x1c\xc7\x0cXP\x8d\x97\
+\xfcfcL\x9b\xe3j\xcbo\xdc\x16\xad\xd5\x03\xb7\x93:\x14"\xac\x04\x8b5\xca\x14\
+IyZ\x97\xfeN\x95H\xa6\x8f\xdaD\xac\xd0\xea\xb0\'\xebV\x19!\x93\xb6\x00[[\x1b\
+\x85\xe7v\xba\xd2\xf6\xccP\xe5r\xe8\x1b"\x86\x88\xfe\xdc3\xcf0g\xc9\x06\xf9`\
+v$8\x06\x01\x14\x97ZB\t\x87\x07\xdfw\x85\x82\x9c\x8d\x8d-\xdc\x14?\xe5\xd1\
+\x90\x81\xe1O\x04yh\'\x05\xb7\x94\xd4S\x8f\xe9\xeaQ\xf3\xb2\xc9\xbf\xd5\xcd}\
+\xc0\x86k\xcf\x81\x0f\x0cD=)*%\x86\x06\x06\x01&\xc7\x8b]7\xb2\x8a\x9a#\xf5\
+\xb9\x81$=N\xe2\x9d\xff\x11\xe1j\xdbr$\xb3[\x8bwV\xcc\x92_`\x048\x0b\x90\x82\
+\xe1\xee\xe5\xe5\xff\xa6\x1b{\xdbx\xce\xd0\xc4\xca\xf9\xf9\xb6\x95|+\x01\xb6\
+\x8f\xa2\xc6..<_\x00K\xe0\xa6^\xab\xc5\x9e\x9d\xf9\x8c3g8\x17\x07\x95S3h\xc3\
+\xbe\xaa8AH7\xc7X\xeb\xa7\xcd\x85\xc2\x15\xda\x83\xe7\x1du \xba\x91L\xeb\xbd\
+`\xed\x94\xf1\x9d}.\x92bh\xfe\xa4-Ee,\x10i\x1aS\xc1te\xce\x91^{\x9b\xf1\x1c\
+\xc1\xc2I\x90\t\x05x\xff\x15\xe8Ck\x96F\xb1\x12#a\x8f\x99\xeb\xd8+!QA\x8aXY\
+\x9f\x9c\x95\xf6\x92\xc7\x895i\xe3\xfbv5\x02\x19\xca\xba\xa6\xaa\xab\xc7\xeb\
+\x15]V\xa2\xc7\xc7\xc7D\x18\x9a-}\xad\xcca\x96\xd7\xddC\xa7\xbf\x84\xae\xa9)\
+\x9e?\x91\xc1\x1f\x80\x1a\n\x12Y9\xa9\xf8\xd2\x95$rU\x99\xbf\xecZ4\x1d\xd9E\
+\xcb\x15\xc0&S\xa1\xe6\xd1\xfd\x05S\x0722a\x84t\x14!\xe0>\xef\x0e\xc0oc\x9b\
+\xe6\x1d\xccV\xa9*\xc5\xd5\xc7T\x98{\xf5\xdd\xdcx\x07r=\xc3w\xba\xf0q#XXhW\
+\x15P\x8a\x94t\xb5\x90\x90\tP\xd42\xb9\xa0\x91\x13\x96\xe5-\xa5z\xba\xda\xe8\
+E9\xff)A\x92\x15P\x9f\x90\xbe|\xb5\xe5g\xe7&\xd8\x00QRx\x166}\x92\xe1i\xcf\
+\xd0f\xd72\n\xefS}\xcdd\xf7\xffs\x01h1HPs\xd0U\xc5;\xc5\xdf<\xba\x16\xd4\xf4\
+\xa7\x16\x02LX\xa9\xe30\xa1\xbbs~\xd0Kc\xc5\\_\xd7\xd9Y5i\x1bL[\xa8\xfa\xe9\
+\xad\xcb\x04\xe5\x85E\x94\xb7\xe7\xcc_\xd3\x8b\xa3\xa5\xfa\xe6\xef\xdf\xb1p\
+\x15\x9f\x82W\xeaW\xcb&t\x0e\x17\x9b\xc7\xad\xf8\x98R^\xe6\xab\xc1\xe8\x13\
+\xc3\xa0\x108\xd4-`\x97"\xe3\xe7\r\x96h\xc9\xd0\\\x1d\x85&\x0e\xb70$\x0c\x9f\
+\xc0,\xaf\xbe\xfe\xaaU\xfe\xaa\xf1\x8f\x81r\xec\xbf\x99\x87\xd8\xd8\xd8\xff\
+\xa6\x9bD\xf4\xf5\xd4\xfd[y\xa7o\x8dw(\x910js^5\xe8n \xf6\x9a/\xfdW\n;\xd2R\
+\xd3\x7fQ\xfbH\\\xf8\x13\xc9+;\x97\xf4i\x83\xf1\xc1d\x02G\xce\xccaj\xebt)\
+\xe6J\x98d\xc97I\x1e\xa2\\@\xbb\xe5\x9b?\xe6|J\xcc\x9e}Vb\x9eZ\xb7X\xddO.\
+\x9f\x0e\x04{\x87\xc6\xc6\xe2\xc4\xca\xfd+u\xbet\xef\x9cx\xb9\x82\xa8M>\x8dF\
+\x7f\x89AXzSS\x13K\x9cD\xbe\x06\xdb \xcb\xc0T\x99Gv\xf1\x98\xc8\xf1\x0f\xfb=\
+W\xe1\xe0\x95\xaa\t\x9d\xa6\x86&N\x1e\x9e\r\xc8H\x95\x8du\x05x\xee\xf7 \r\
+\x1e\xc6"p\x91\xaf\xb6C\x92d\xfb\x03\xbd\xbd\xbd\xc7^\xbd\xf7\x9a\x13\xb0W^\
+\xcc\x11\xbcp\xac/\xd7\x8fj\xe1o\xce\x00\x066\x98\x12(\xd7b\x85\xf4\x91-\xb2\
+\x94\x17\xe8\xd2\xe7*\xef%r?\xfc\x9a\x7f\x83MS\\\xf7\xf0o~\x90V\xc95xT\xa4\
+\xdb\xe510\x88\x9f\x908\xba\x7f\x01\xcb\xe9\x9d\xdb\xbb\x80\x80\xc7\xdc\xc7\
+\xf9\xdc#\xe7?\xd4\xf1\x83\x04\xd8\x15\x15\x15\x1e\x9e\x9e\x84P-vDkn\xce\xd4\
+\xdeG\xbe\xf4\xc3\xed\xd8L\x00ErvZ\xc1%Zl\x8a\x9f\x155\xca\xb4\xe8\x13\xa9\
+\xc8\xbcm\x00\xd4\xa0\x88\xfd;?\x85qR\x06\xcdg\xe5\xe6\x963\xa5\xebJ\xc9\xf5\
+\xe6\xc5\rv\xe2N\x95~+\x91\xa4\xff\x8ee\x8a\xb9~\xefG\xd4KS\xef\'\xec\xfb\
+\xebcZ_/\x98\x91F\xaf[\x96I\xb5\x97O\xd6\x9e\x95\xaf\x8f\x0f\xf9\xaab9\xc2@G\
+g\xdb\xcd\x8f0J\xc6\xd0p\x91g\xe5\x96\t\xfe\x13\x92T\xa2K\x8c\xac\xee/b\xa0\
+\x9f\xcf\xc1\xcd\xae3D,\xda1f\xeee\xe6]\xbd5\xc3\xde@\x9cf\r\x80IH\x07f\x05\
+\xb6u\xe4\x83\x81I\x99V]\x0c\x98w\xf94\xca-\xf8\x13`\xc8iOx\x00p.\xd3RH\x93?\
+\\\x9a\xaa\x02|c8\xf2\xc4?+^X\x8f\x1a\x1c\xed\xcf\x9d\xbb&,Ex)\x8a:\xd1\xa3\
+\x00\xff,\x87\t\x9b~\x01\xa1\xa7\xcf\xf0\x12\x15\xb0\xff\x18\x14$)5AII\xc9\
+\x9c4lS\x0f\x18;\xa0\xc2B\xdfc\x1c\xd5_\x15\x17\x17\x1bqG4\xae\x01\xd1\x88lm\
+r\x04|\x9dD\xee\xd4\xc1\x85DW|"\x1f\xb0G\xfd<\x9e9? \xec?\xb5\xb7t\xca\xb5\
+\x99\x93F\xc7~\x01N\xba/\x02\x8f\x07\xfeo\xf2\x0e\x10\xc6\x87\xd6\xf3\xd9\
+\x88\xaa\xd8?\x14Q\x83\xebKo\x96\x06U\xa9\x9ew\x82\x9ev\xfe\xe68\x1f\x924\
+\x06\xc7\x17\x16OA\x91L\xd4(i\xe9y\x8b4\xcb\xb4\x82\xaf\xf3\x16\xbbZ\xc8\xa4\
+l\x83\xdb\x90$\xc0\x1bt\xe6\x93\xf9MU\x9e,$f]\x11\xcf\xcd\x9d\xab\xcb\xf5\
+\xac5+\xe1\xe6\xd1Z?\xd3\x94\x99\xa1\xa0>\xc7\x8c\\\rm\xc1\xdd\x07|h^6\xecH?\
+,\xbe\xf7\xd3\xec\xfd6\xa5\x8b\xbb\xb8\xa9C\x15\xea\x93c;\xc7\xeb%\x83\x0c\
+\x83\xe7\xbb\x91 e\x81s\xf5-9Sj\x7f\x93\xbc\xb7\x05\xb5dC\xfdR\xac\t\xd0\xcb\
+\x903\xab\xc4\xda\xc2g\xbcd\x938MM\xe4\xa0\xfcoLlE\x7f/\xe4\xe3v\x12\x0b(\
+\xb1E\xff\xe0wP\x90\xd3\xb8\xf1\xb4\xd8\x8e\xedy\xb6&6\xaa()qzw\xb0\x9aJ?\
+\xd2SD\xbf5\xb1\xd8]\x82\x84/UXH\x19\xeb\xb2\xb2\xcaaAC\xbf\x06D^\xcew\xac\
+\xfe\xb6o\x04\xe2Wz\xd1\x1d\x97B\xd4\xd0\xe1zY:\xe0\xac\xadM,z\xa4\xa9\xa9\t\
+\x13@\xbe\xc97\xb29Lb\xff*\xedGz!\x11\xcc)\xb5Nb\x82\xacQ3\xd8\xaf/\xd5\x84F\
+\x8a\xc5\x84\xea\xeb\x190x\x9f\xf7;j\\\xb3\x80\x1bA\xfd\xe3\xd4\x95\ns\xd4E\
+\\\x85\xa21\xc3Z9,A\xce\x81A%\xc2f\x1b_\xd9\xa9A\xd0\xa4\xc5\xf5\xadq\x95\
+\xdco\xdc\x9f\x825\x18\'\xcee\x00\']_\xb7\x1b;g\xf19\xb3jI\xbbj7\x8b[\xce\
+\xf90\'\x89\x04\xdc\xf1\xdf\xf14h \xb5\nM\x90G,S\xa3< \x8f\x81\xd2\x950\x9a[\
+f\x8c0e\xdey\xbdW\x05\x84\xdd\xfd\xe9H\xdc\x14\xf2Q\x15\x84\x99\x972\x7f1\
+\xc8e\x90\xb9\xe9\xd6\xdb\xd4K\x0b\xcf%M\xa1\x0c\xbco*\xbc\xa4\r\xb7\xf2\x98\
+\xd3\x9c\xa8\x1b\xb6\xfa\xdco15\x85\xf76\x87X\xf1\x87N\xf9\xe5\xcd\xe9\x06w\
+\x89"\xe7\xbf\'\x03\xde\x7fr\xa2\x86\xdd\xe2\x17_\xc6\xcah\xee}m\x9c\\\x98\
+\x9cW\xafb\x97\x9f\xe0\x00\x9f\x10\x0eo\xad\x17X@e\xc4\xc7\x03\xfe\xd4\xa9\
+\x82\x12S\xd9.D\x03\x94\x95q \x8c\x84Q\xdd>\x84\xda\xb9\x1c\xa9\xd5s\x8e\x1b\
+\x7f\xd1u\xed\xf6\xb8\xe1F\xdc$\xd1\x1f\xcaE\x9c\xe0:\xf4)y\x18)\n% \x88I\
+\xf5\xf8\x9e\x87H6\xf7s\x01\x1eu\x18\xc0\x15j\xffUV\xe2\xa8s\xe4y\x87\xe1\
+\x9f\x9c\x03\xb5\xf9\xe1\xc3\xeb\xca\xd2\xbe1\xb2\x1f4\x8b\x01\x99S{F\xfa\
+\xfa\xc3;\xe7\xda\xda\xda/7^\xb2\x17\xff\xb4\x12\x84\x84\xe3\xc1\xa1\xb3\xd5\
+\xa6\x92\x81\x0f\xde\xa2\xd9999@m\x89\x8f\xf7=0tR\x8d\xda\xd4\x97y\xf0e\x9b\
+\xb0\xb1q#\xe3O\xd87r\xf3\xf0\x94#\xecO4\x88\xb0dY\xc9P\x1a\xe3v|R\x07\xd9d\
+\xfa\x01\xad\x06*\x048$`n\x00\xf3\x12\x96\x80>\xfeI\x8fS.&\xb6\n+\x0e+\xae\
+\x19\xaf\x84\xf6\xbb\xd6w\xa0\x16\x0fe\x06~\xfe\x12\xd8\x96\xa1O\x1f\xae@\
+\xd2G"\xe3\x84\xa0\xed}\x81V!\xe9iBt\xf3H\x82\x0fbd\xe5\xf2\xd58\xe1\xbd\xa7\
+[\xb6\x80\xd7\xe3%\x931\n\xf5\xcf\xcf\xcf\x7f\xcb\x9c\x84\x1e\xfa\xb6\x9b\\\
+\xaak\xca^@@\xa0qiii\xcfJ4u\x9c\xe1o\xb4L\x1f\x9f\x8e\xcd\x04\xe5\x0f\xa6u\
+\x00\xd9E\x12\xb4D\xa3\xee\tce_S\xa5\x8eo!\x97\xa5(\xa4+\xd9\xa0k`s7\x8f\x1c\
+\\\xee}\xff\xfe\xf4\xf7\xf9\xb6\x9d\'\xe7q\xfd\xd7\xaf_\x95\x8b\x0c\x80e<\
+\xfa\xfb\x97\x86\x9c\xfcm\xc4M\x14K\xce\xee\x9b\t\x87\xdc\xc6z\xce\xfb\xb1b\
+\xafU\x9e\xc3\xcb;V1M\xb2{\xb3\xf2\x8a\tj\tw\xb2\x0f\x7fB1\xf1\x9eJ\x9f\xe3\
+\xaf>\x1e\x02\xac\x88\x9a\x8e\xe51`\xd8\xec\xec\xd3\xd1\x19\x15\xf5\xa2R\xe7\
+\xfewP`\xd9\x98\xc6\xf5\xdf\xc6\x033\xa6\x7f\xabs)r\xb2\x18\x18\x1a0L\xc2X\
+\x89\xec\x9d\x9dI,\xee\xd9\x86HW\x98\x1c\x0f\x13Q\xfa\xde+"\xa4J\x9d\x18\xfe\
+\x84\xfd\x87\xa4@U\x00{\x0b\xfeM\xad\x10|h\xfb\xa0\x99n\xfe\x15\t\x1e\xbc\t\
+\x87\xc3\xdd\x16\x85\xbd\x17,\xaf\xe5\xde8\xc7\x9bT\x93\x12G\xfdg\x92\xabP|\
+\xc1\xed=i!\x0bJ\x1d\xaf.\xec\xc79"\x85\x9c+\x99|\xdb\xdd\xdd\x95\xaat\xb8\
+\xbf\xa9\x16\x98\xad\xac\xaef\xd8\xa9\xae\x9f\xeeaL2\'\xabq\xder\xbfM\x1e\
+\xd1=\xc4\xf5\xf3\x17Q\x00M\x1e\x80\xff\xa2\xcf\xde\xdd\xb5\xb5\xc8P\x81\xc3\
+\xbf\x0c[q\xe7F\x04FW}\xc7\x1a\'\x8f\xe5"gK\x1a\xd9I<z\tE\x12-\xb0\xf5O\x84\
+\x11a\x85\x03\x02ETpp~\x9bu>f\xc6\xfaU\x891D\xdc\xbaH\x89/1\x8c\xb4\xb8\x146\
+\r8\xe9\x95\x95\xae\xba:>>>B,8\x15\xee\xe0\xd3\xe3\xfd\x96{\xeb\xc8\x1e}Xd$+\
+E4\xdb\xe6\xd9\x12N{\xb1\x06\xdb\xb7\xe0\x82\x02\x8bJ\x9dz\x97\x95\xce\xe4\
+\xe4d\x0e\xdd\xaan\x9e\xaf;>\xa1=\xab\x9e\xed\x93\x08S,\x1eu2\x80\xb98nj\x14\
+\xf3y\xc5Qx\xcd\xa3>\xcbp\x8e\xa4\x10\xa5\x0e\xe9\x91S\xd8\xd04\xcb\x97i\xcd\
+\xcc\xceVWT\xf8\x9f\xf48\x01\x18\xf9\x07\r\xc2\x98hdCN\xde\xc7++\xdbo\xe8\
+\xfaq\x1e\xe1\xa8\xae^\xabS\x0eW(\x99=\x88\x96+$\x8c*jk\xbb\xfb\xf7Q\x96\xd9\
+\x90\x84\x03\x105Q\xd1+\x9f?9\x88C\xf6\x9f\xb5\x89\xb6d\xbf\x8c\xba\xef\x01\
+\xb7\xbe\xcb\xf0\x16\xef{{\xfb\xfd\xeed\xe1\xd1\xd1Qy\xabv\xc9\x14\x80\xea1\
+\xdd\x9d\r\x1e\xa9\xad\x03@t\xcen\xff\xbc\x97\x14\x83\xe1U\xf3\xbeKfJz\xa7DR\
+\n\xb2\xe2\xe3H\xd8\xb2\xb3\xaf\xfb7\xafP.[\xa9\x1c\xb1Lq\xdbmQ+\xfe\xf1\xac\
+\xacy\xc5\xb7\xbd\xad\xad\r \x91uX`n\x90\x85Eo\xfb*\x82\xf2"\xcf\xe0\xd3\x19\
+\x1a\xc6\xd7\x9a\xacw\xa0\xf9\x95F\xda4\x82V\xa3\xc0\xa3\x85\x8f\xcd#\x97@\
+\xa2\xd8}\xfcx\xf90>vyI=\xf8%xZ\x15\x10\x88,\nWa\xaa\xc1\xbb\xbb\xc3\xaby\
+\xc0`\x0c[\xfd>\xb8\x94\xa3O\xac\xfa\xcb\x9d;\xcb\x914\x9c\xc0gYa\xd2\xe1.\
+\x90;\x82\xbd\xd6\x01\x9a\x84\xfb ;\xd5jfIv0x\xd8wc\xaf\x06\xad\xc6\xe1`!9v\
+\xa9c\xb7\x08\xf0\xad\x9f\xfbz}yH\xa2\x1exNx\xf5\x96\xaa\x91\xba\nV\xa2\x04\
+\x1d\xea\x9b\xdf\xc3&\xe5\xc6\x87\x96fc\x1f\xa9\xbc@\xd7.\r\xc4\r\xd6G\xd2*X\
+j\xeb@\xc8\x80\xe6/\xdc\xcb\x96c\x9a\xe1\x0b|7\x04~R\xfb=\xbc\xe0\xcd\x95\
+\x06\x03\xae\xaf\x9b1\x08\xb9\x9c\x1d\xb2\xb2\xafX~\x06\x94\x95ji\x81\x17\
+\xbb\x93\x88\xf2Y|r\x8d]\xd6\x8f%\x17\xb7\xfe5Hom\x90\xdf9\xe69\xd3\x8ea8\
+\x8c~\xc4\x0fcDo\xcc\xea\xec\x94\x88\xdbH\xc8T{\x16\xcf\xe0s\x15\xc7\x8b\xc7\
+\x19\xb2L@\xf9\x01\x8a\x95\x02M\xaea\x15\xa6\xceOLt\xd7\x805(7)\x12\xb4\xfa\
+\xb5eQ\x93\x17\x90_\x18c\x9c\xf4v\xac\xd6\t:\xff\xac\xaa\xe1\x1c9\xcf:.\xa4\
+\xc1\xd4\xba\xf2\x12\xab"yc\xdc0CW9\n+6\xa3B\x8a\xc5\xf6\xb8"\xe90f\xd4\xd4\
+\xc2\xce*\xf0M\xd4\xc1\x87N`\x86\xf0n\xa6\xb8h\xa5\x96/\xfeo\xe1\x8d\xe0\xbb\
+\xf5+\xe4\xf1\xe8\x8a\x10\t2\xf1\xf1\x8e\x8b\xdf\x8a\xae\xef\xe0~\x1a@\x03\
+\x0f3\\\xe2\xbe\x06\xac\xad\xdb#\x04\xe9\xf5\xabW\xc8\x9a\x85\xe8\xe3(\x18\
+\x92\x1e\xfa5B\xdf\x83\xd1\x8e&\xe6\xf5\xc5\xaa6\xcb\xa6J\\7\xfep_O\xb4K\xf7\
+nX\x91a,\x7fV\x93\x16\xffxG\x84\xa6^\x8aM\xf9F\xd3<2g\xd8\xaa\x14\x85+\xf9\
+\xf1\x0f}9\xaa\xd2\xa3\xa7\x8f\xdf\xf7ge\'\x97U+\x88\x07f\x8f\xdc\xca\x9fV\
+\xd2\x89\xb8\x99\xe7\x99\x94\x19{\xcd\xc6\xe5\xbc\x92\xff\xac\x9bGp\xbe=\xfe\
+\xfc\xa9\xa0\xaf\x9f\x8e\xb0\xcf\xce\xcd\xcd\xcd\xc8\xf9\xa6T\x07\x94\x86\
+\xb1sjd\xa4p\x9ct\x1e\xfc\x8c\xb0r\xc5LT\x97}\x040\x13\xd4\xb8\xf2v{U\xe0\
+\xc1\x00\xa3\x93\xf8bJ\xb6\xdd\xa1\x93\xc8\x91-\x03CC\xd4w9\xf8\x84X\xe1F4,l\
+\x9c\x14@\x1e\x9f\xb9L\xea\x11\x91\x11\x86\xbdgQ\xcd\xf9\nc,\x9fG\\]yz\x1c\
+\x87GD\x1c/S#J\x11R\x1b\xef~\x10\x12\xedL\xf6\xa1\xeeD\x10\x9e}\xea\xc9\x03\
+\xb0\x03\xc6H5\xc8\x05\x97\x06\x18ESs\xea\xbf)\xfd\x15\xb5j-\xf6D\x86`[\x19P\
+\xd9\xf7\xef\xf6\x8bS\x9e.\x879}k5\x06\x95\x12\xb9\xf1#Vj0L0\xc1\xa5l{\x1fr\
+\xd0MF\x86\xc1\xc4\xe7\xa1\x019C\x80\xc4r\x9a\xaeW\x82V\x8e<\x17\x1d\x9b\x8a\
+\'~kx\xbf \xa2HV`c\'\x14\xd9\xc9\xce/\xc6\xff\x94\r\xe3\x07\x1b:o\xb2}5\xe8;\
+\xffO\xc6\x08\xcbN*J\xc6\xa2V/<|\xf9\xfc\xf6\xbf]\xbe<\xdf\xea\xa9=h\x8f\x1a\
+}"\xd2h\x1c\xc9\xa2\xab\xb6\xdb\xd2\x8c\xbb\x03\xd5 \xf9E\xb8\x117\x0b\xfb\
+\x02g8\xc0\xf4^\xf6\xee?\x0f.3\x1c~\xd1k\x84)T\xfe\xa7\x948\xb2\xd5\xaa\xc4\
+\xdc@\xa4\xc0\xf8\x05\xef\xfd7\x05E/D\x9a=\xbei\xc5\xd6\x8c\x8cl\xc1\xbfe\
+\x0f\x82\x87\xfe\xd9\xe4q\rV\xc0\xb2A\x89\xa1\xc5Z\\\xf0\xd4\t:4\x0e#\xfa\
+\xc4<\xa6\x18\x16L<\xa5\xca\xd6\xbf\x9b\xc3I$\xd1\xd6vv{?\x939\x84\\\xfe<\\n\
+\x99\xf6[\x9e\xf6\xf4\xf4xqw\x14VNH\xdc\xef\xa9\n\xfdo\xebz\xea\xa3\x8d\x8b\
+\x8d]\xea\x10\xc3\x12e\x18\xc3N\'\xc8Vp\x9d\xf3\xbbnp\xe0h\xb0\x88J\x1b\xb1R\
+\xb2\xd1\x14\xcd\xee\x14\xf2\xc4\xf3\xd9\xba~Z\xf3\x93\xe8R-\xe3\xc4\xd4\xea\
+\xd99\x8f\x8a,m\xaajjk[\xb0\xa8\x05\xc2\x1d\xf4<\x1b\xe4b\xe7t\xea-\x8eo\x94\
+4l\xc5\xc4\xd4\xcf\xc5U9r\xda\xa2\xd6V=\xa6\x81\xb9gb\x9e\x8c\xcb\x83\x0fRSz\
+\xd3\xef\xe6\xa2\x8a|b\x90\xa6\xc0\x7f\xe4\xfcm\xb4\xabvR\xbdk\\R\xec\xf5\
+\x86g{\xfc\xe5\xe5\xe3\xdaF\x10\xfd\x84`\xd8\x00\xd2SnN\xce\xd3\xb2\xa4\xbf\
+\x8b\xbf\x85x\'U\xc0\xd9\xee\xabl\x15\xcc\xd0\xb0\xbd\xbd\x08\xd0sM\xd2\xa3\
+\xf1}\xa3\x01\x0e\xfbC\xe9\xeb\r\x15U\x15\x89\xee\x16.n\xf6\xc0\xc3uUP\xd9+\
+\x04\x12\xd7\xf3yn\xd7\x96\xe9\x85\xb5n=\xd09\x8d\x8d\x8d\x99\x93\xd8\x88\
+\xb0\x96\xda>:\x8cT\x84\xf0\x13\xe25(\x94\xa1\xc4S\xb3\xa2\x82\xdd\xc1d\xdc}\
+l\xc4X\xc0\x90\xd5\xc7\xd6\xff{o\x86\x96t=b\xfat\xf6\xf0 ^\x10\x909J\x02\xc6\
+(L\xb4\xe5KV`NjEhC#\x15\xca\xf82\x7f\xc9\xe7\x08k\xa8\xe7\xbf\xf1\xbd\xd8\
+\xfdq\xf3\xe3\xbf\xa9V\xaax]\x1d\x1d\x8d)\x89d\x05b#\xb0\x8a\xaa\xa4\xffz\
+\x14\xcb\x80\xd3\x86B1!\x99@\xad\xcc/k\xe1we?v\xceo\x01\xd2<\xd5\x97\x1b\xb0\
+n\xd1\x13\xdf\xc6\xbb\xa1\xaa\x8f\xd3,QE \x10\xf3\x8e\x82\x83Y\xc6ej\xfa\x95\
+:H~\xaf\x02ed\x1ajk\xdf\xf2p\x0e\x04\xb1\'\xf7\xee\xc8\x16\xc1\xb4\x18\t\x15\
+\x7f\x10\xd6Z\xf5\x1cX\x93\xcbi\xb0\x97UW\xd3\x06\x06\xa5%\xf2\xc5|\xed\x11B\
+\xb9&\x89\x95}D\xa6e\xf3\xd0\xf6\xc9!U\x99"\xfb]\xe6\xb1?Wk\xc9\\\xff\x02\
+\x99\xf7\x06\xf7C\\\xeb\x84\x06+\x19\x18\xaa\xf65\x05/awm<:\xfas<\xb5\x18\
+\xc0\xe7\xcc,\xb42\x05k\xc3\xc3\x98#\xa7a\x08\xfb\x0e\xb7\x8d\xf0\x16\x19G\
+\xbeL\x00\xbe\xde\xf7\x84\xbe|\xc7(\xd4.9G?\xe9*\xd1\x05\x80W\x8f/\'7;@\x15\
+\xef%/\x0f\xff\xcd\x17<??\x97\xbc\xe9\xc1[\xaf\x15FJ\xdc\xb32\xf8\xf7\x7f\
+\xe9T%\xa6&\'_IH<-O\xe0?\x89\x1c\xc6\xf9\x94|\xf0\xb3\r}\x17f\xd2\x81\x8a\
+\x89[\xc0\x82n\xf3\x83{\xb8\xea%\x8b\xca\xd7\xe4d\xe3\xff\\\'\x8f\xdc#R\xa0%\
+\xaa\xb9O\xe5]w\xe5\xb7\xb7>\xb6\x1cQL\x16\x890\x8f\xdd\x89\xfc\xb2\xb22\x0f\
+Q\xa7\xfa\xd8\xea\x8a\xa2\xc9\xba\xf9\xb99\xbd\x7f\xdcv&Q}}\xb65B\xd1(\xc7\
+\x8a\xc5{kv\xb6\xf6\x8b_\xfb\xb0\x07\x83 \xb6\x8e\xaf\xf5$\x80b\xf3\xf9\n\
+\x97~\xf3\r\xf8n\x7f&E\xc7\xba\xb5\xae\xb5\xe6\xed\x97\xd5\xda\r\xdb\xfb&\
+\xcd\xc7g\xd9\x10t\xe1\x80\\ON\xf2\xf0\xa8~K5k\x16\xb3(8\x03\xd1J8N\xddg\xef\
+\x8e\xc7\xaa\x04\xa7\x99\xb19\xfc{Y\xcb\xda\xb8\xb18)\xba`\xc9\n\x81Y\xf2X9\
+\x8f\xa7j\x93\x8e\xf0\xa1\xdc\x81\x02[z\xd0\xc7\xd5\x13\x94_\xf50F\x0b\x9bQ\
+\xb5\x85\x974\xbf4\x84#\r\x9c5\x93\x04\x88\xb0 \xdb\x98\x06\xb8\xb4\xd2\xea\
+\x19\xf8\x05\x95\x13\xb8`\xb0\x1a\xfe\xf2\x8f\x1f2\xccI\xfaX\x98\x99\x19\x15\
+\xa0\xcb\xc5\x85\x85,\x95\xf7N\xc6\\\xdaM\x85)~\xd3|d\xeb\x9f\xcc\x16\x10\
+\x19\x07\xab\x10<\xd3\xef\x11\xf5S\xef\xbb\xbc=O~\xd1q33a\x17\xf4\x84Df\x0f\
+\xf3\xf6\x967\xb0\xe5\xe5\xac\xc9\x1d/\xc9:\x04\xe3\x7fjBQ\xc6\xf9%`#|\x04rx\
+\xe2R\xae\x9c$\x0b\xed&kF\x12\xf0\xc1\xaa\x9e.E\xe0\xbd\x0fm\xbao\xeay\x1d\
+\xaau\x99\x85\xaf\xc1\xdb\x97\x83\x816\xe5\xc8\xe7\xe4\xd5\xaf\\\x9c\x14\x1c\
+\xa8\xc1\xbb\xd27o\xf7\xf5Ts\x8f\xb14\x1d\x9a\x1e\xb0\xa6\xcc\x12F\xa7\xdc\
+\xed\x92X\xdd\xb3\x00\xf2\xf2\xef9\x80\xff\x1fMg\x19\x15G\x13fa\xdc\x1d\x82;\
+|\xb8\xbb\xbb\x13\\\x82\xbbe\xd0\xe0n\xc1\x1d\x82\xbb\xbb;\xc1\xdd\x1d\x02\
+\x04ww\xf7\xed\xec\x9e\x9d_\x9c\x11\xa6\xab\xea}\xef}\xee\x9c\xee\xae7\xde\
+\x01\x14{?\x87\xd7\xf9\x9c\xe7\xaf\xb6\xfa\xe7\x83\x888\xd7Ou\x0c\xf4\x85_\
+\xe6,\xc3\xb1\xe6d_HU\x9ci\xc9\xcc\xee6\xf4\x97YI1\xcf\x8e\xce\xfc\x8fH\x15j\
+\xaa\r:\xb9\xf8\xad///\x97@M\x87\xd3Y\xa1\xeb\x14\x93\xf7\x8aYB\x8b\xeb+\r\
+\x92\xcc)\x7f\x1eZ\xaca\xe7\x08\x03\x8a!Y\xfc\xd1^"m\xed\xc9g\x16\x8c"\xabz\
+\x1e\x92{/\xd7\\\xcb?;\xc9\xc8\'\'\'\xe5\x8a \xde\xa0tl:\xfc.\x85\x16\xb6Z\
+\x91BEp~0P\xeaYe*\xc1\x05h\x12\xae\x1b\x9b\x07\xa38Zw\x17\xfd\x05"\x9b5\x08T\
+^V\x16\xfc\xc2IV\xa8\xa71\xc5\xc6V\xdb\x0e\xe4\x95\x17@\xc8\xf2\x12`\xc3\xc7\
+\xef\xef]\x8a\xea\t\xc9\xb1\xe1\x9a\xc9\x0e\xa8\x99\xd0\x81\x9aR-K\x1cw\x18U\
+\x97\xabX\x9c\xe0\xcf\x8aR\x8f\xc0\x06{@\x1a\x011\xe5\x90\xe0\xba\x87\x98kG\
+\x0e\xf6\xddv\xac\xeeK\xd9|\x85+k\xd1\xfa\xfb\xd0(\xf8\xe3.\xfc\xef\xdf\xbff\
+l\xf0\xf8\x02d\x03\xc6n4\x1ar4Y\xa4\xb7\x9555\x86\xfa\xfa\x9c\xf8\xd1\xdf\
+\xaa\xf5~\xf0\xe9\x932K\xf4\xc5\xab\xd3%\xe9\xea\x9b\x17"98"\xb4A\xb0\xf1+#,\
+\x9c\xde\xb5\xe91a /\xa5\x9f\x8a\xc9\xe7\xa1\n\xbf)\xe7)\x03\x02\rt\x90TA\
+\x00\x047\xca\x97EN\x1d\x94\xca\x19\xcd?\x7f\x16\xc7\xf6\x1d\xe9\xca\n\xd5K\
+\x1d\xdb\x08K\x03\x1c\xdb2\x8dSon\x1c\x8bTy\x85\x84P\xa2\xa9\xa6\x03aS:\xc5t\
+\xd1#\x87\x95\xf5K\xe0%)\xf1\xa5\xfa$\xe1f\t\xee\x00\xdd\x12\xf9\x0f]\x0c`\
+\xd1\xd9:\x95\x9a%\xeax\x99J\xcd\x8a\xe1\xf3pfi\xfa\xc6\xa4\xe8?RW\xfcG\x83\
+\x12\x04\x81\x87\rv)\x91r/d3\xe2\xeb8\xcb\x01\xe7n9S\x12\xc0\'\xf5\xa8\x1a\
+\xda\x8d\x1f\x0f\x85\x1e\x9f\x01\x8d\x195\xab/*\xfa/\\b\xa7\x96\xdfJQ\xc5\
+\xb6r\xa3\xc5\x9e\xa4T\xc8\xc7\xc7\x87F\x86\x9b\x8bK\xe8=\xbc\xc4\xcb\xcb+\
+\x8b\x89z\xc4\xcf3\xcb\xd8\xc7\'\x0b\xcb\xdf\xecN\xfe\xdf\x1e\x8f7\xffn\x8c\
+\xa1R\xe1\xe5\xe9im}:7z\xd7\xd3\xd33[ \x9d\x92\x9cl\xd7\xe1\xb6\xfb\x14\xbek\
+d\x1b\x14H&[V\xd8\xdd\xdd\xdd\xd5\xe5kjJ\x91&c\xd1\xfaU[{\xa5\xcb\xe7\xb5o\
+\xfbjao!:\x83;/)u\xd4\xcc\xcc\x11\x8fl\xef\xbce\x83\x0b\x17IP\xb0S\xac\xb1;\
+\x0e\xa5\xb5\xb39\x96\xb3[\x9d|\xdb\xc3\xd7\xdb\xbbC\x9d\\\x96\x81\xfa+\xd5\
+\xbck9\xc9^\x08\xcdG\x0eV \xc4\x18\xfaZ\xdb\xc7\xe3%\xfa\xa7\x9ab \x0b\x03z\
+\xb8\x84\xf2_\x84\'H\xe5\xb3\x00\xfc\x89\x83\xdd\xa22\xa3\xc2(\xb9\xb2>\x1e\
+\x1cEX\xb6f\xa4\xa3\xf1\xd8WU\xcae\xb4\x88\xa01\xa2\xa0j#\x84\x7f?\x12\xaf\
+\xff\xd6\xd0\xf9=\xaee\xab>\xf2\xc5\xf3\xa7\x10.R\x00,~\xe4\xf0\x80\xc9\x0f\
+\x06\xe2q\x07\xc2.\x88VE<z\xf9bU4\xf4\xb1\xaajP\x93\xce\xcc\x08\x1d\xbd\xf3\
+\xb4\xef\x89v\x96\xc1\xe1\xbdg\xec=\x11d\xa2\x83\xb9\xf9>0\xde\xe7\xa6\x8e0\
+\xac\xef\x0b\xf8?\xc2q1\xf4\x81`\xc9\x80m\xd8\xe6m~\xb7\xb1\xde\xb4\x96\xaeX\
+s\xcb\xe4.)\xb1\xd0\\RUY\x89\xe4l*2s\xd3\xf6\x99\xd3\xe6\x86jw#0?d\x1f\xc0(]\
+\xe3\x1d\x87z\xa3-D0\xea\xff\x93\xc5(\xc3\xe8\xc4\x08\xe5\xb4\x91\xd5&@\x7f\
+\x9e\x91W$\xd4\xee\xbcxu\xcan\xb5&\xef\xf81\xe3\x83\xab\x88}\xfd\xc2>\x81+x\
+\xaa\x16Y6#\xab\x0f;\xfd\xaf\xa2n\xe8O\xb2\xa6\x9e!\x98\x15\xa3\x9e\x04\xa5z\
+\xc6\xf1\x04\xc6\x1c3mU[\xf8\xb7\xd7]17\x12\xb3t\x1e\xdb\x97\xc9\xc7\xafT\
+\x14fD\x06\x9d\x97\xaf@\x966|t1\xfc\xb6\xd5r\xf9\xce%\xc0\x80\xb4\x15\xa8Z\
+\x96\x99\x96v\xfd\xfa\x9e\xa6\x9dvd\xed\xdc~\xa8\xaa\xa6\xda\x92h\xfb\x9c\
+\xfb,\'1\x80\x19\x19\x19\x19\xc3\x1a*\xf7%%%\'\xf4\xef\xea\xde@!\x9d\xe6\x17\
+&T\xb7e"\xd3]\xd3\x86>0\x8fl\xdd\xf2\x8b\xcd\xee\xd8\xbf\x85>\x0bB\xbb\xe9C\
+\x841\x91\xd1\xe2\x98\x1cv&Y\x8a\x8f\x17\xf6\xbe\xf3\xa6\\\xab\xe71\xc2\xb4\
+\x9f\xd3\xd3\x90\xe4\xdb\xfe$\xdf,\xf7#\x92\xb6\x8d\xb7\x97!\xbf\xd5\x18\x08\
+rs\x87\xbe\x90\x98\t\x0bf\xf3\xe2U]={#\x04C\x0c\x18\xbc\x89\xe0U\x81\xa5`\
+\x93DN\xe3\xd5i\xb3\x9e\xb3\xde\xde:\xde\xce>\xde\x1f2\xf1\xc5\x84\x86a,\xca\
+j\xb4WD\xc8G\xc4+\xe1!\xc1\x1c\xb5>\xdc\xdd\x89X2\xaad\x95.\x82\xdc\xce\xd6\
+\xd0\xaf`\xbb\xde\xe6\xe4\x0b\n\x9a\xdd\xfc\xde/^/\xbb/o\x9f_^^\x98\x0c\xbbl\
+8\xf0\xaf;i8\x18:W\xea\x1b\x9c\xec\x1a7[]N\xb1/\xea\x9a\xac\x97\x0e\x0e\x0e\
+\\]]\xb3\x85|,t\x07\x9bO \x17\x1fT^5\xfa5\xa0\xf8\x81\xba\x8f\x8f\x8f\xf7\
+\xec\x14\xf2\xd3\xe8\xea\xdf\x06\xdb\x9f\xb2\xe2\xc0\xc6\xc6\xdehs\x82E\x90\
+\x04\x06\xbe\xeaf\xc3\xbc\xa1<7\xbfZ\xa0N\xa7Q\x8e\x8b\xc0\xf5\xc9\xf6D\xa2\
+\xfa\\\xb0\xe5\x08\xe61][\x9b\xa4\x93\xe5:_\xac\x90\xbb\x8a1{\xb6\xc6\xe0\
+\xf6\x94\xb7\xaat\x06\xed\xd8\xbe\xdeb\xbfn\xf7!\xde\xb0b\x93\x9d\x9e\xce\
+\x86\x8b\xc4\x97\xe5\xca;A\x12\xb5\x7f\xe3\x97\xdc\x97@\xc9s\xc2K\x18cY\x91m\
+\xbe\xdb\xc8\tm\xbd]3\xe6C\xeb\xde\x89\xfb \xcc\x05\xbd\x85n\x03\xf1\x1f\x06\
+ae-\xb8\x981\xc4:\x9bR\x8a=$_g\xc8\x1f\xaa\x81a\xa7R\x01\x0e\x01\x06\xf2\xa1\
+\'\xa6\x81N\xf8\xebk+\xb6mR\x87\xa5\xea\xac\x19\n\xd8P\xe9\x04J\x89\xbfO\xf4\
+o\xaeap.\x01\x13\x95\x13ss\xaaq\xb6\x17\xae\x9b*\xd4\xe5\xc6\xb4\x90\x89\xc4\
+\x10\x03\xde\x11q\x14\x0e\x13H\xb0\xfc\x08\x086h\xe8\x8d\x1cW\xa6\xb3\x96\
+\x11\x05}\x87^\x82\x06\xcd\xc3\xbfoz\xcd\xe3l\xaf\x94\xbc\x0f\xc4\xefY[*\xf8\
+\x97E\xa8\xf8\xb4\\\xdd2\xae\\\x8f\xc2\xc4\x8b\x89\xbc\x89\x85\x18\xa3|\x7f\
+\xe6\xf4\x1f\xe6(u\xd1\xd0\x04\xfaU\xd3jy\xb5\xbc\xa2d\x9cc\xd93\x80s\xc3\
+\x93\x13\x02\xdd\xf2F\xd3\x05\xf5\x14\xcd#P(`\xae;\xbeL\x10q\x8e[)z\xbbHO\
+\xa2\x97\x9c\x88!\x1f\xdb\x80\xcb\xcb\xe0\x13\x0e7J\xc54\x7fP\xc2e\xc8\x89\
+\xbb\xfc\x14\x17&"\x8f\x98vU\xfa\xb6\xbd\x1c\xc1\x9d\x9c\xeb\xf033?/\x0f\\\
+\x92\x84\x07\xe7Z\x17\x01\x11Q)\xcb\xb3\xa2\xba\xfa\xe2\xd4\xf0\xd3\xd3\xde\
+\xde^\\\xbc\xbf\xee\x92\xa4\xff_\xc2\xdcr-\x99\xb5\x02Y[\x03\x1c\xdeI\xcc\
+\x9cR4\xe0\xe8\x7f\xc4G+D\xf1\xc1\xce\xc9\xa9 q\xf3\x1d\xbe\x9f\xba\x90\x16\
+\xee7\xa9\xfc;D\xc2\xaf_\xc2\xc9PO\xf5\x0f\x9fj\xf6\x9d\xf0\xbfH\x10\xe8\xf0\
+\xc8?,wD{H\xc2"#\xc5\x0b2V\xf7\x1f^\xdf\xbf\x97}\xb7\xfeS9:6FL\x88o\x96\x7f\
+\xef\x08s\xb5\xcch\xae\xeb\x7f!!-\x1d\x1a\x1azxp\x00\xe1\xbf\xd2\xfa\xbd`\
+\xd2\xa2\xddq\x1f\x81MKF\xfb?*\xca\xc04aV^<b\xec\x83\xc7\xd7\xb6\x1d\x9a|\
+\xed#\xfc\xd4\xac,\xc9\\\xc4\x01zfna\x07a\x87\xfd\x9b\xa4l\xa1\xdbtN\xeb\x99\
+R\xaf\xcb\r\xc1\x8b\xce\xac\xac\xac\xa6\x18-\xcc\x1dLUU\xb5\\x\xf0\x80\xda`\
+\x8fn:\xaa?6\\\xe276\xb9~"\x15\x8b0\xfc\x06\x84\x12fuZ\xd5\xfa\xd6i\xff6\xd7\
+a\x82\xf95|\xf9\x981Q\x9c\x98\x88\xa5\xa3\'\x11%x\x9aMD\xdc,\xb6\x01\x19\xe3\
+\xcf\x97\x85R\x03\xf4p\x1d?\xa1\xcc\xdf\xff\x8a\x06\xbcus\xec\xb3\xb1q\\\xf8\
+\x88^\x9c\x80t\xf7\x13\x165\x17\xb1\xf9\xc7\xfc\xd0\xf3\xb3\xf0\x98\x15t<Rj\
+\xda&\x89r\x05\xa62\xfar\x9b\xb5\xa5\xb8\xbe`<\x03;\xbd\x93\x89\x89\x18@\x81\
+\x90\xf2\xf2\n\xe2\x1c\x03\x98\xc5@\xf4\xb9U\xcb`\xd6k\xe51i\n\\\xfc\xd9lE>\
+\x07jj\x8eW\xf1\xadY\x15\x0c}\x11\xee\xe9\x16\xd9\xea\x9d#Wt\xb5P\x14\xf3\
+\x16\x03\xe9\x94/\xf2!\xb5\xd6\x95\x97\x97\x177S10\xd8\x9c\xffm\x1a\x1c\x1c\
+\x94\x95\x95\xad\x85\xa7cf\xde\x04\xbeFQq\xaa\xc6\xcf\x87I%\x0bjPT\xdd\xdb\
+\x99/k\xf5\x9c\x89\x89\xe9\xc1]\xd0.\x05\x98\x8fN<<\xbc\xd1\xd1Q\xfch\x18\
+\xecQ\xc1\x83l\x97\xd3?U\x86\xdd]\x9d\x9d\xef\xa0HpV\xe1\xf1L\xf2J\x11"2\xce\
+\xff\xaa\xac\xc4\xe3Gm`\x08\xfecb\xaa~\x18o\x92\x94\x94D\xfc\x08\xfe9M\x04\
+\xe5!DG\x07\xb2\xb1a`cstw_\xb6kQRP\xf49\xf4\xf3\xb3\xfc\xf1\xe3\xba\xfb\xe3\
+\xb4{\xcf\xd1\x03X\xba\xd5sE\x19\x99\xe5.\x1f\xfe0\xe3\xfd\xfd\xfd\x95\x95\
+\x15`\xda\xb6\x1f\xef\x9b5\xc91\xf6;\x93\x85\xd0`\xfb?\xf2\x11RGP\xd02\xc2z\
+\xcf!\xe9\x99\x05\xff#\x1a\xebv_\x01\xd6L8\xf9\xf3\xb0\xfe\xe03\x82%\xed+\
+\x15\xa6\xcb\x88\x84\xb6\x98A\xda\xffm\x8f344,\x91\x96\xb5\xda\xd2\xfe\x84\
+\x1f\xd6"y=\x84\xd1\xe2\x85R\xef\xbasK\xa7\xb1\xb6\xd1\x99#\xc9\x159IMA\xd1o\
+R\xb7\xd6\xee\xa6T\xa6\xfe\x90\xea\xf5o\xff\xd6-:\xce\xff\x16\x8f\x9d\xc5\
+\x04\x87.\x1f\x1b\x1c\xfe\xabWfATUS\xb3\xfa\xc1\xaa\x8a\x87W\x11\xc1HC##+\
+\x0b\xaf\x8b\x17\xb2\xc0A\xcb\xba\xcf\x9e\xf3\xcca\x06m\xb1\xdePF\xfb=))Iyv_\
+\xea\xdf\xdd\xd63\xd7\x08\xb3\x14S\x12\xd2M\x9at\xce]\xdb\xdb\x86\xa1b\xe6c\
+\x88\xf8\xb3\x9f\xef\xd8\xab\x18\xab\xac\x98\xb82&\x1f/7\x01\xfcrrr\x02*\xcd\
+\xb3\xb3\xab\xabk\x03D\xa4IC\xd9\xa6\x872\x16\xd7oLM\xde\xbe\x1e\xc3\xdb\x93\
+\xea\x01h\xbcG[[\xd8\xedR\x95.ul\x9c\xb8)\xec\xa4\x9fDP\xb1,\x1c\xbdi\x9dx\
+\x06\x18\xba\xc2W(\xf0\xb7\xe7\xe7\xd7\xc7Kk\x0e\xfc\xad\x139Z\xc7\x01\x0b\
+\x85\xaf2w\xccO\xb3e\xf5>\xc3\x0f\x07\xc2\x1c\xaf8\xd8\xeat\x8b\xeb^\xfa@\
+\xdfT\xa6\xf1\x9a4\x8c\xf5Sh\xe1\x94\xba\x9b\x8e\x02G4\xa3;\xbb\xb9\t\x081\
+\x06\x06\xc6\xce\xeenFF\x06\x7f\x14\x91\xe0\x01\xb1\x1d\xde@\xcc\xd8\xb1\x81\
+\xb3:R+\x9f\x04T8\xba\xde\x9d\x96F\xa5\\\xd1\xc9\xe9\xe5\xf0XFVZ\xc3s\xd9\
+\xa4\x9a\x9a\xda\x0cmZF\x06\xa0\x97\xc0 \xae\xcc\xd93&\x8b2\xe43\x98\x0c\xa8\
+\xc8\xab4O]\xdb\xf9\xff]C\x05\xaf-b`@|`y\x1fp\x92\x90\xa0\x9aDW\xdcU\xddUP@A\
+Eeq{0\xc9\x975eR\xd7q\xbb\xd9M\x9a\xaf\xf1\\\x01\x1c\x81M\x01W2\xef\x9e\xd3G\
+\x11\xb3\xcf\xe8\xb9\xab\xa1u\x1b_7\x8b0\x0f\x87U+\xe8\xe8\x92`\xb9\xd6X\xdc\
+\xc0`c\x92\x80\xdb\xcfs\xa7\xe4\x1e\xf9\xfe\x88fz||\x15xVKKKL\xac\xafX!\xc3\
+\xd1\xd1I\xf1\xf3\xe6\xae\xc9\x9a\xd1\xb1\xedM\x97\xd9\xeft\xdd\xb0{\xd5\xf4\
+\x02\x8f\x88\xe8=\xf7y\xac\xefM\xcc\xd5\xf5\xa1\xcd\xe9\xd0n\xa3\x83\x97C`ye\
+%\xdc\xd1\xe8\x0c\xe3\xb6&\x8e\xcc\xf1)uhx\xae\x87,\x18\xcc\n<\x0f\x1d,Z\x84\
+\xf4\xe0\xa6\xa4\x8e\xf0\x8am\xb8~\xe7\x13\xed\xe7\x0f\xdf(f\x18e\x8fE#\xff\
+\x12\x8cL:\xd1*\xd6\x8c\x89\x89\xc7\x03&k$\t\xc3\xb5\xc5\xe9#\x1f\xd1\x80\
+\xea\xda\xda\xb8\xce4e\xdb\x93\xb33\t-\xb8\x9a\x8b\xa7V\xf7\xbb7\xb6g\xca\
+\x81\xb1\x132t\x9a\xa3|I\t\xab\x0fX/\xd8dN\xa3\xad\x9es\'\x9b5\x94r\xa4\x85\
+\xd70\x1avzL;C\t\xa8\xc3\x95\xf2r\xba\xa1\x88\xe9\x9cn\xb0\xe5\x95\xd3[\xb2L\
+\x98A\xe8\xea\xec\xe7\xe7\xe7\x15\xde\x15\x83\xe9~q\x93\x13!\xf8k\x16/\xf5mJ\
+\x19\x04\xc9b\xb6y3.Y\xb9\xb2\xf2r\x04\x9fWe\xfa\xab\x17\xef\xcc\xa5-F\xc2\
+\x8d\xcb\xbfM\rV\xe2\xe8\x8f\x13\x04\xd1R\x05\xb3a\xea\xf9\x8d\x8d\xce&\x8e7\
+J\x7f\n\xf0\xa3\xcd{ ^\xe5\x1aF\t\x89\xbe@F\x87\x04==\xe5#\xf3\x9f\x9e\x9c\
+\x10\x1fW|\x93+\xbd\xc9=&\nbB\xf0l\xec-\xa0\xe5g\xb7,CM\xe7\x01J\x01\x11\xc1\
+y\xc6\xd9\x9f\x83\xa2\xdaE\xd5D\xceB\x93\n\xf6\x84t\xb1\x00[D\xe2\xe8\x804\
+\x1f0bK\xc5\x1c\xf4&\x8c(\xee\xe8\\\xfb\xe3\xfb\x97\xf4\xbf\xe9;\xc8\xffQ<\
+\xc4\'[3\xda\xb8\xa2P\xbb\xb8\'KI\x0f\xe6\xc6\x92\xee5\xde\xa6qopD0\x82I\x15\
+\xa0#qcYSQQ\x93)-\xffo"\xd4V\xd3\x9dw\xac\x82\x0e"\'\x87\xf8\x12\x11\x96\xb9\
+;\x15>*\xbb\x9c\xd3W\x8a\xa2hK\x1c;<c\xe3\xffd2\xf2\x1d\xbe\xf7V<\xd3\x0fm\
+\xee\xe7\x86xl:\xf4.\xe7\x1b\xd8\xa8\xd8\x88\xe6g]f7K\xf2\xe9g\xa8\xd0\xaf8\
+\xca\xa0O\xed\x8e<(\x8bl\xae\x0c\x05U\x1a\xa4I\x18\xcaR 8\x17\xff\xfdw\x11\
+\x8a\xa0\xf7\xa3QX8=\x9c\x83\xf7\xb9J\xf4\xcfm\xac(kA\xe2\xd8\xd4\xf5\xeb=\
+\xd8\x194\x9b\x83k\x14d\x94m\x8b\xfd\xe9a\xb6\x81q\xccV\xab\xd4\r\xcd\x8a/\
+\x9f\xc3\xf4\xed\xed\n\tb\xe0\xc9\x04:\xce7\xb7\xb7\xb3\x8aj\xdf\xbeqs\xd9\
+\x91\x10\xb4\xa0"\xa3\x98[\x98\xf1d)\xe6\x12\xb7\xa2\n\x10+\xd9\xd91Q\xad\
+\xa6\x076\xe9=\xff\xc4i}\xf2\xc2\xdc\xd9\xd5\x9e\xc7p]\x8ak\x87B\xafmll4\xf1\
+\x1al\xd0\x98\xeeZ\xba"\x96\xb3\xb6F\xf8\xe3{\xea\xd7\xb9\xa6\xbc\xe9\xd0\
+\xf2\x1a\xa3X\x01)\x05F\x7f\xfa\xfb7\xdf\x10\x7f-\xf1\x8aMs \x04Q\xcb\xdd\
+\x96c.5\xc8\xca\x1d\xd7\x10\x8b\x04\x07\xd5\x0c\xf1g\x80[\xc1\xec\xc8\xc1\
+\x11pL\x1b^\t\xaa7/\xde\x0e\xeb[-AW\x9f\x03\x88\x11m\x08\xe9\\\x15n[AF7W\x99\
+\xc3W\xee\x02,\xa2_\xe5\xe5\xdb\xdd\xb7M\x8c\x8d\x8d\xad\xad\xe9\xa3\xe6h\
+\x8f\xa8\xb2\xd1H\x0c\xd5t\x7f\xf2\xce\xb8\xdez\xfa\xe8wNZ\x98\xa2\xb6.\x19z\
+eY\xc7=-\xf2\xb4D5oqk\x92\x94\xda\xfd^\x08"Aq\x18>\xbd\x05\x0c\xc1\t\xf0\x93\
+X\xef\xed\x91\x81\xbd\xbd<q\xe6\xbe\xb4\xf40\xa1\xcf\xb6\xe9\x82\xa0\x95\x85\
+\x05\xa8`\x8c\x8eY\xf7y+\xbcZ,[\x9a\xc0$\\\t\xbbh)S[\xdb\xf3\x14\x10\xa8\x1a\
+\x1f\xc9 \'\x96~\xe0\xeb\x8d.\xdf\x15uh\x7f\xc0\x1c\xe9G\xec\x7f\xfe\xdc\xfa\
+C\xd0Zsj\xdeRo\x8d\xb1\xd6\x1f\x92\xe3\x97\x9fKV\x1ck\x9f\xd3d\x08\xc2\xa9Y\
+\x19\xd1\x11\x11\xd9\xd9\xe9c\xe3\xe3\xbaW\xcc\xa9\x13\x16\x15.<6\xe6\xb8\
+\x85\x053\x89\x17\x8f\xb0"\x87pe\xbd[u\xc3\xec\xdf:\xea\xcc\xe4W\xb0C\xd7\
+\xebjk\xc1t\xe5\xad\xb6z\xc1\n\xaa:\x15\xf2\xe2n\x1c\x9dT\x8a\xa43\xe80\xbc\
+\xe2\xbcI\xf1\x93\x122\xcf\x1ea\x17@\xf7\x03{\x94_\xdd\xf5\x1b\x1aJo\xab\xf4\
+\xea0\xbc(\x94|k\x86\xf9\xd9\xd9\xd545\x9333\xcfn\x9f\x89\x03A\t\x89\xe9\xe9\
+;\xf7\xee\x0b \x97V\x01o+\x07\xb8.\x8a\xdd\xdd]\x9d\xaa?\xdb\x0e\xee\x82\x06\
+\x85\xb8\xa8\xc4\x02\xcb\xaa\xcd\xd0\x03\xd4O\xe9\xa2y\x02LL1a\x1b~\x9f>WpD\
+\xae\xb0\xbf\xdf\xc3\xc3n\x89\xae\x96\x07\xd5=|\x8d}\x15z\xf1\xc9\xd9 \xcb\
+\xd0\xf0\xff\xff\\\x00\x97\x0c\x004==\xf9\xd0\x83CCk\xe6\xaao&<\xb69\x93\xb3\
+\xb3\x89\xf1\xf0<6\xfd6\xf7\x1d\xcb\xd4\xe9hlu\xab\xfe\x04?\x0b\xc3\x9b\xaak\
+j\xe6\xebA\x04\xd8\x86\xf6\xc7\xec\x891\xa5\xb44\xea!\xea\xe2II4\\\xac\x04\
+\xf4\xfav\x1a\x00\xa9\xf5\xfc\xf6y\xad\xe1Bd\x0b<\xf4\x020\xaa,~7&N}\x0e\xb7\
+\x0c\x00\x18\xf4RUUU\x13\x13\xf6\x1c\xdbH\x0b\x0e\x08\xdd~[X\xde\xde\xdc\x0e\
+\x081i\xa2\xf5\xa0f\xe6\xe4P\'h\x87\xc0\xccT\xd5\x16\x1b1\x12jnu\x9c=\xbef\
+\xa4\xa7\xf3\xf1\xf3\xed\xa3;\x8e0\x19p\xea\x11\x11\x13\x87\x84y\x1d\x1f\xcc\
+\xc9\xa70\xadw:q\xd3\xd2~\x1fOf\xfc\xfe\xfd; 4\x80\x85\x186X\x9c\xb75X\xda7\
+\xb6l\xb69\x9545qRQ\x15\xb7\xb6.o;\xbc\x9du\xfbRa\xa0\x91\'\xa9@C\xf3a}J\xd4\
+5<\x07?\x03@T\x98\x18\'h\xbb\xd6\xf8c\xb5\xd9\xf6\xf5\xe1\xdc\xcb\xcaca~\xd7\
+\xb1\xcds\xe2\x00\xfa3\xd0z\x88\x93\x85\x05\r\x98\x81\xfd\xb1$\xeb\xa5\xea/8\
+8~\xd79\xdd\xad\xf7j\xba\xaf//sss\x8d:\xb6>>\xef\'\x8b\x15\xe3\xe3\xe3%%%\
+\xb32(\xda\x03\xd1\x19\\\xc1\xc1U\x1d>\xa7\x9a\xaa\xaa\x18^\xa5\xf5\xb59\xb8\
+\xd3\r\x01.\xb2\xb2\xc7j\xff)\xe5\x8d\x13{\xfb\xa2\xf7\xe0d\x05\xb6A/\xbf\
+\x1f\xf9\xab\x8e\x9c\xeb\xb6\xa4\xc8\xbe\x1e\xd6U>\xdb\xb7\x82X\x80E(\xc7\
+\x9d}\x0b\r\xfc"O.\xa7$\x1b\x1b\x13!\xa5\xcd\xb6\x85zt\xffR\x92\xedIGM-]\xb1\
+\x88r\x87\x1a\x15\xa5\xf3\xf3Kki\xd1\x98\x13\x12\x14@j\x98\xf1\xb3\xcb\xb3++\
+\xdfI\x9a\x86\x87\x86\xc4f>\xa4^\xa3\xb7\xf3\x8c\xbb\x85\x95\x95s\xc7G\'\x8f\
+//I\xf0\x9a\x12H\xd5P=It\x1eEx\x08\x88\xf1\x87\xba\xa0\x02z:\xd6\xded\xcc)\
+\xe3\x19\x98\x85Q\xb3\x85=;7\xfem\xe3L\x94@Y\xc5\xacs\xe9\xcc\xc7j\xdc\x93\
+\xf9\x1f\xf9Q\xcf\'m\x96&]xiI\xc9\xe1X\x12}CC\x03\x9d\x86\x9e\xa6T\xf2&\tX\
+\x1e\x0f\xf9Nx\xdd\x0f/--wO\xcf\xdfK\xa7\nrr\'\'\'\x9e\x97-\xc8F\xf7\x06\xb6\
+\xac\x0e\xe0\x0c\xf4\x14\xf4T|0\x99\x81\x1dkk\x00\xa7\x85\x85Q_\x89\x93\x96\
+\x18\xbb\xf1\x18\x81\x87\x9d\xf2q\xfe{4\xd9\x01\xd1\xb8BS\x9b!\x19\xc5t\xb8d\
+LXCUu\xee\xcf\x1f*\xd4\x94\xd7\xf7\x8f\xe6\x87f`u\x00\x95\x9eWc\xd7JR~`\xe7 \
+0\xa37\xf3\xed\xf63\xaa\x15f\xe4\xf4\xb9\xec\xea\x94+\xaa\xdf\xee|\x91p!\x17\
+\xc0\n\x93\x91\xa2\xc7~C\xd4m\xb6Q\xa1K\x12\xb4`\xaf!\x95I\xf8\x85\xa1\xc6 \
+\x0e\xa94\x92\xd3\x03B\xac\xcf\x9d>$\xa8\xd36o\xecc=\x08\x0b\x8f\xd1,S?\xc8\
+\x16f}\x0eh\x16#\x85B\x82p>\xfb\xe9\xf8MU\x07\x83\xe8\xdfCABk\xa5F\xaf\xad\
+\xafQ\xace\xf5]\xf46\to\xc99\x9f\xaf\xac\xb5\xb0\xb5\xb0p\x01\xa8\xa1\xae\
+\xebG\x94v\xf1/\x15c\x93\x93\xeb\xed\xf6\x86RR0p\x9f,\x14\x12\xe2*\xa6\xa6\
+\xbb\xd3~\x1f\x88\xeaP\x9f\xce\xba5Z\xe1\x9c\xe8\xf4\xe8\xcb\x93\xad\xba\xb9\
+B\x10\xe0\xc1GGG\x1b\x1b\x1b\x00\x1d\xa1V{\xa3\xc1Aq\xd9o\x10\x12T\xb0\xa5M:\
+\xb6\t\xa0\xc1\r\x0c\x0f\xe3\xe0\xe0ps\xeag\xa7g\xbb\x8b}H\x00\x85\xfc\xed\
+\xdb\x12\xffe\xc7n-\xff\xd8\xd8\xd8\xce\xce\xceT\xa6P\xc1"(\xc7\xe3\x00\xafI\
+\x07\xe0\xac\xaaEP8\r\'#0\x7f\xe7\x07\x93\x19\x00\xd1\x9a\xeb\xb6\xfc\xfe\
+\xe9\n\x86\x05\xf5,\xc1*,\xd0S\x1d\xe3\xc1dq9s\xbb\x1f\xe2W\xfd\xcc\xf8\x1f\
+\x9c\xe3\xbb\xdfs\x92p\x94\xf9\xe0\xe7\xc8\x15+\x0f\xbbq=zC\xfa\xb2c\x8aG\
+\xc0\xfb\xfb;\x10\x9a\x94W\x027\x88\x97 x5I\xf0\x89\xff|w1|\xff\xfb\xcd\x18\
+\xd6@9W\x9c\xce\xdc\x8a\xcb\xffGx&\xc9F\x13\xb9F\xe4O>\xa8m0\xfc+\xa4\xc7\
+\xe7-\xd9:?\x82\x83\xf9\xb8\x81\xcd&kKsss??\xe1\xd5\xa9z>AbR\x18\x80)\xbe\
+\xac\xd2\xcf\\\x06LK\xac\xa2\xa6\x9bq\x1c\xe3\xd3\xe0\xe4R\xa1\xee\xe5\x1f\
+\xabb\xd6\xdbaXYb-\x90\xca\xc8}\xa5\xa5\x99\xd1\xd0\xd0@W\x11\x17\x87l@\xca\
+\xeb?\xbc\xf5\x88\xe7dq\x07\xc7\xd4\xfd\xb5\xa2\xae\xab\x8b\xc8\x0f\xd9\xd8\
+\x84\x85u\xe4\xaf\xcc\xa1\x0fz\xc1TpX\x83\xb7\xd7\x93X\x1f$\x90\x17 Fu\xb4Ap\
+%4\xce\r\x19~\xd7\x91\xaf\xf1R5A8\xd4\xdeA\x04\xd6Y\x8b\x88\xf4\x11M\xd5r\
+\xf0SET\x82\xb5\x15@\x084dW\xa8\xa9\xc9I[\x10\xa8\xcfz\xb9\nw%n\xd4\x06de%\
+\xa3\xa8\xc8\xc4\xc0\x10\x15\x1b\x99\x93\x9a\xb9\xb7\xb3?\xbd\xe9\xfb\xda\
+\x19\xf2\xd8\xc8\xc78\x91\xc8\x08\x99\x0c\xe0\xb6a\xc7\xedm\x914q\xfe\x8f0X\
+\xe52#\x81\xc0\xb0\x99C\xa7\xeb>\xc9\x8a\xc5\x08\xfcZ>\x95h\x0b2\x04O>\x96p\
+\x16~\xea\xd7\xbd\xd1_\rvK\xebvK\xdd>\xef\x869L\x9b\xc9iI\x1eoO?\xb0>i\x96\
+\xdf\xa15\x84\xdf6\x86\xa5>\xe4\x89\xbc$\xab>\xe2\xe2\xb2\xa5e\xf6HT?w\x99\
+\xc5RzM\x85\xb7\xebL\xdb^>\xc1\x88\x07\xff\x93>\x836\xb2\x9d_\xac\xf8\xf6s\
+\x1a)m\xab\xb5\x95\'\xed+6\t\x89\xb0\xa0`\xb4\x08\xc0\xe9_\xca\xa2\xe4\xbe\
+\xca\xaci\xd6)0\xa5\xac\x9e?\\]]\xfd\x84\x15\xee6\xde\r!8\xe7\xee\xf9W\xe9\
+\x06\xb1\xb0f\xeea\x8bf\xe6f\x01\x9d\x97\x8emb}\xa1g\x13\x99\xf9\xc8\x92\xfd\
+\xfd\xfd[8(:0\xa2\xca\xdbZ\x1cT|\x7f\xbb\xb7\xa4%K\xda\xda\xf0.\x13F\xcd\xde\
+\xdf!\xc3\x96/\xd7\xdb-\xad\xb8\x00\xd7\x82\xc3\xf4\x144\xe0\xe9\xf9\xbf\x8d\
+l\x95i\xf6\xd0o\xf6\xf6\xcc8\xf6\xe8\x93\xe4\x8a\xb0\xb4\x9f\xbf\xee\xaf\xf3\
+\xbb\xf5\xd2\xc1\xa3">\xc2B\xd4F\xe2\x11\x13\x1bt\xfb\nv\xb4\x00\xf2-\xd2\
+\xed\xb4Ld\x13\x191\xc9BO\x81\x98\xc5\x1b\x87\x94K\x8a\n;\x1cr\x01\xa3\x82\
+\x96\x1c\xa6|OC\xbfZ\xaeN\']IA\xa2\xf7\xdc\xb3\xefH\xfb_x\x98\xe7\xcb\xc4\
+\xf3s\xc5\xc3\xc5\xaau\xc3_\xe5\x0f\x7f\xcf\xb9\xb0I|`\x80\n\n\xa2;[\x8f\xaf\
+\xc8\xdf\x90\x01\xe7\x02\xa3@l\x17\xa4s*%\r\x83\x94\x11\xc2j%\xd1m\x1f\xd4\
+\x10q\xe2\xee\x96\xf4\xfe\x0f\xc5?\xf0ydk\x8b4L\xa3\xb3\xb3\xf3h\xe3{\xfbF\
+\xb1j\x99\x85\x85EHh\xd5\xe9\xd2\xa9-W\x86\x1e\x93t\x9a\x1a\xad\xa4\xdd\xfb\
+\xc2\x1fF\xa0(\xdf\nj\x8a\xf6\xd3U\xcb\x00\xaa8\xedr\xbb\xcc2\xec0u\xe3qtr*\
+\xc8\xcf\x07\x0c\xf1}<\x85\xd9m\xfd\xc2\xf3j+`\xb9\xb9\xd1\xb9\xb6\xd1CSJs\
+\x9f=\t\x08\x01\x88\xb7\x88\xad\x06\xc8.\xf7\x80\xab.\xc2\x963\xeb\xffNLL\\X\
+\x99]\xf1\xa8\xe8\xe7e\xad^:\xed=\xf9/\x1f\xfa\xb3/\xd7\xdcA~%Y!\x83\xcbC ;\
+\xd8\xc3\x8f\xf4\x8a\x94\x95\xec\xba\xed0\xdb\xebz&\xd2\n\xfb\xe4\xf7\xbc\
+\xf9\x05k\xefb}MM\xcd\xb0\x8d\x9d\x9d\xdd\xbf\x89\x8b\xe8-\x85\x08Z~%\xa5\
+\x11)\x8f\xed!\x16\x8f:\xe7]\x1bBT\xbe\xea\xff\xe5\xfe\xb5w\x86@\x1f\xccZ\
+\x18\xe5\x16u\xd7\xf4\xc8\xaf\x8e\x80\x16\xde@\xd2\xc6e t\\pZ\x8bt\xac\xd9\
+\xee\xfc\xf4\xb4\x1d\xd4\x9a\x9e\x9ep\xe2:-Z\x9d!s\x90\xfeC\xb4\xe9b\xdc\xb0\
+Z\x83.\x89h\x08EbK\x02\xaa\xc1\xd6\x0eZ:\xcb\xaf\x87\xad\xb6\xb5\x15N^V\x88\
+\x05\x8ewDs\xc4hn\xec\x06\x97\x86\x86\x94\x19\x17\xafijz\x9a>i\xac\xdd\xed\
+\xe2\xe5\xfd\xa3*\xe7/\xdd\xafQ\x80}\xd3\xb4\xd3F\xea\xec\xd7\x7f/zT\x98\xee\
+G$\xd1\xd2\xd2J,,m\n\xb3\xb2n\xa3B%&p\x08p\xac\x99^\xac\xb4~\xdf\xdd\xda\xca\
+\xcd[aae\x05\xef\xbf\xdc\xdb\xdb;>\xfe\x8eW\x85K\xe0&\xe0~E\xca\xcc\xfd\xadL\
+\xbd\xb8\xb8819\xf9b\xb9\xad\xe0\x19u\x12\x87I\x8f\x81N\x07u\xcen)\x8b\x9fL;\
+\xd6\xc9\xc4\x1b\x04\xf2t_\x06q\xa5\xc12@\xb2\xce\xb2\xe6\x0e\xb0\n\xcf\x1df\
+\x00\xbeT\x1b\xfb\x97\x9d\x8d=nB<\xa0\xa6\xa5e\xd3\x86-vY\n\xc8?{\x8e\xbc:\
+\xf0%\xc5\xc5\xfd\x9a!\xa3\x9a#g\xae\xfc\xd8\xf8\x03\x9d@\xfe\xe8\xc6,\x9c\
+\xb1\xdf\xec\n\xa6"\x91\tq4\x9fz8\x8a\x19\x80f\x8f\xaf~\x8d\xe7\x0e_.\x92\
+\x96\xd8\xd24\xb34\xa7\xa6\xa4\xdc\xf2mu\xbb\xdc\x08\xbe\xc5\xa1\xa2\xa2\x9a\
+\xe3<\x9e\x9c\x9c\xb4h\xf0\xf8\xf1c\x96\x93?\x03\x8d\xa4f\x11DVO\x932\xde\
+\x02\x14J^\x7fh\x18\r\x05\x05\x05\'\xe3\xfdF\xa7\x97T\x81J\x91jSKK\xc6\xe4\
+\x01u\x0eCfVV\x93\x16\x83~K\xbb\x1e{\xf5D\xe5\x04P\x04}}}\xa2\xe3\xb9r_RR\
+\xe3p\xd1\xaf\x076\xa6/\xbe\x8c\x8e\xdc"\xde\x02\xc24\xa7:\x8f\x98\xc3\xd0\
+\xe1vI\xfc\xa2\xfc\x16\xd0\xb3\xdc\xea3\xc4)h\x85\xf7UQqjj\xea\xe1\xf5\xbd\
+\xae\xae\x0eMZ\xc0a\xcb\tp\xa8\xef66QQQog\x1b\xd3\x1b\xedn5\x1d\x1d\x02[\xa8\
+\xce\xce\xce\xde\x87~~%\x85\xad\xee\xf7\xe9\x8b\x80\xa2\x17\xdb\xa99:\xde\
+\x00\xcd7\xeb\x8b\x0f\'\xf0\xb4P"\xe4r\xd5\xf6\xd3\xbe\xfb\xdd\xd5\xad\xe5\
+\xdf\x15\nk\xcb\xd4l\xb7\xf1\x0f\x19\xbf\x15(\xfe\xc4\x1f\x97\xd1j\xce\xef\
+\x83\xf8\xecKS\xe5\xf4\xac\x87\xf1{O\xa1->\xa4\rRPIH\x04?\x07\xfd%\xd4\xf1aS\
+\xc1\x07\x029e\x9f9M,\xd8L\x88\xe2\xab\xe2\x88\x04\xdc\x1dv\x87\x00P\xb1U\
+\xadX\x04\xf73\xeaaC#\xc6\xceN\xc9IIL\x84\xa2\xf7\xea\x11s\xdfrm\xd7gg\xd2\
+\x13K\xa2SL(D\xcf\xf8b\xb1]\x1bY\xb8e\x9b\x8e\x96\x03f-\xdd\x1c6\xb4\xf7\xad\
+b\xb1<\x15\xf7\xb3O\xac\x92\x8e\x8bLHT\x8a-v\xb8 B#\x80\xba\xfd\xc7\xfc\xd0\
+\xdd\x9dsO7P\x03zm&\xe6**\xe8\xb5|\xa1\xfd\xc4\x98DY)9\xb0\x9f\x9b\xe0\xe3"^\
+^\xed\xaae\x95\x95\x95g\xac\x8f_y\xa8\x815"\'\'\xcfm\x01\'\xef\\\x15|\xdc\
+\xc9\xc3q;[f\xe5\xe6\xa6\xfe5zrz\xaa\xcd\xb2\x0b\xb0L\xb6\x81\x1a\xdc0\xb8\t\
+5i\xbfH\x04\xac\x028\xeb\xecl\x82\x18D:\x18\xdf\xe4o\xea%2\xcb\xe4Q3\xb44\
+\xd2\xfc\xbe>1\xdc\xcb\xe0\xf1\xfe\xbc\x0c\x84M\t\xd60R\xf2XK&\xcd/\x91\xc9\
+\x9c<\x89\xa8:0\xbb\xbb;\xff\x05\xef!$\xe4\x12\x0b\xb8\xfb{}#$S_A\xcdy#\xd5\
+\x067@FE\xb5\xd4\xc6I\xa2\xab\xb6\xb1^\xf9\xedr\x8a\xc6\x8d\xae\xb2t\xceD.\
+\xa7 \x0f\x1d0f\xecvw\x976\xbb\xc2\xcb\xc6V\xef\xfb\xee\x19\xda\xafb`\xf0\
+\xb1\xd2\x99\x03\xad.%q\xb8)lh``\xd7\xb2:[\x02\xa0\xbbQ\xba\x96\x8a\n\xab\
+\xa0\xa0m\x0b\x7fD\xc4\x1f\xf1\xf4\xef\xc6\xbed\xc0\xc8\x04\x04\x08\x9b\xbb]\
+\xdb\x89\xc6\xc4noo=\xda\x9e\xa7\x05?\xf5\\]\x9b\xc5\xf2p\xf1\xf0~L\xb6\x1a\
+\x81&x\xeev\xc8\xcf\x97\xeb\n\n\n(\x84\x85?7\x04\xd5L\xc4Llll\x0c\x0c6\xf6\
+\xc7S\xbc<=\x1d\x1d\x1dgD\xce\x1dx\xa6>N\xce\x9e\x9e\xdc\r\x0c\x0c\xcc\xcc\
+\x00\xe7\xa1\x06^\x02\xd8\x93\x14\xcd?v\xc6R\xe8\xf6xmM\x8f\x14\xe7\xf6\xd6o\
+\xad\xd6X<\xac\x9c\xfaA\xde\xc1\x85\xf4\x08\x8c\x8eH\x17\xe6\x1a\xd2\xa6\x14\
+\xcb\x06-h\x87\xa9x\xf9\xf9q\xdat\xfb\xeac\xb6_\x02LM\x89\x1b"\x085g\\~Xz\
+\xda\xaf4\x92t\xb9G\x04\xab\x07\xd3\xe0\r\x13\xf5\xc7\x97\x19+\x0e\xf8kx\x80\
+\xa6\xf1\xa3\x8bmN\xff\xc0\xb5\xbdy\x9e\xde\xe3\xa0v\xc2\xe9.\xbamx\x0c\x9f^\
+\xc3\\\xc0zN\x08\xda\xda\xdabbb\xeaTqqs\xb7\x94\x94\xc0\xbeb4\xd2\xd4\x19V\
+\x8d\x19B\x9b\x1b\xdbi\x8fN\x8d\x19\xb4\xd8\xad\x17\xc9\xa7XXZ\xb65\xdc\xf7\
+\xfe\x84U\x8e\x8d\x08\x0f\x0f \x89Q-c\xf0\xaeG{\x94\xfb\xfa\xf5\xab\x9d]\xb5\
+j\xd9\xdd\xeb;\xd0\xa2\x8d\xadp\xd9z_\xbf"\xf9\x0f-,\xa8\xcb\x18NNL\x884\xb1\
+\xa9dQ\xc6\xc6\x01\xd6\x97-\xd4\x00\x88\xc8\x0c\x1b\r\x85v\xab@&\xb4\xfc\xfc\
+<g||<\xd8\xe7\xa6\xbd7\xc9\x84\x07\x07\xad\xbf\x15\xcdT>@\x98\x801\x19\rb\
+\x12A\x0f\xa8\x84\xd4\xd2\x00\\{&2\x91\xff\xfa\xf1\n\xbc\xf7\xdf\x96\xc1\xbe\
+\x9dU\x85\x85<\xdc\xdc\xdc\x14\xec\x90\x8f\xb0\x0ec\xc0\xd3\x01\x01\xe06\xcd\
+e\xb4e\xe5\xa9Z*k7\xc0A\xba\xfb\x90\xa2\xd5\xeaT\x01"%\xb1\xf7\xf8\n\x18\xe9\
+\xa0\x03\xad\x19CNeZbjBJ\x06\x011v\x88\x04\xd8\xc2of\xbf\xe7\xf1\xe3c\xfc6\
+\xbd.\xcf{P\xc6$\xccC\x9eAM(\x015z/&/9\xf9N\xd7\xa7\x10\xcf,o\x1b\xafggWM\r3\
+//\x1e\x1f\xafrCvFFdTT\xe2\xf8\xfe7\xa1\'Rv\xfa\x86R+\x1f]/]999R\xb4V\xc7}\
+\x84\xb0<\xbb\x96\xd7\x97\xfb\xe6\xab+\x87\xa7\x94\x90\xd0\xe0\xfb\xc7G\x00\
+\x82\xeb\xab\xcc\x1dn\x1c\'\xa7\xe8\x92\xe4\xaeR\xe4\xe4\xe5[lW5\xf5T;,&\xf1\
+WGJ\rj\xa6\xc7\xc6\xaa\xcb\xcb\xd332^\xd7\xed\xfd`\xc3\xef\xa2&\x90R\x89\xf0\
+\xa3\xa5\x0e[\xd5\xbeT@\xbc\x00\xb9\x05\xc8\xbd\x0b\xb3+\xe8\xd8\xd8\xd8@\
+\x86y\xb9;\xaeM2\xa6h\x8e\xbf\xb9\xb9\xd1\xcdj\xb9utZ\xaa\xd2\x855\x0f}~\xf6\
+(\x99\x87G\xe6I\xbes\xe6!dy\xc6\xc0\x13\x8d:\xd9\xce\xb1\xaa\xfb\xde\xf6\xa7\
+o@4\x1e\'\x0c\x8cl\x0b5\x17\x07\x11\x82pd\x0c]\xa8\x87\xed\xccT\xd4\x7f\xbc\
+\xef\x13\r\x02\xcc\x1d\xea7Z\x9f\x12\\\x1eG\xd8%\xf2\x0f\xe4\xde\xd5\xff\x8a\
+\x06l\x90\xdd\xd9\x15\xbf*\xe6\xb7c\xe3\xe2\x82\xb1\xa0\x85^A\xd4E \xde\xd4L\
+\x1fNNM\\\xbb\x0b \xdf#\x93]%Y\x91n_\xbb+\xd7seL\xe4\xc6\xef\x02_\x1e\xae\
+\xc3\xd7\x05m\x06\x1e\xef\x8b\xdaF@u\x82\x19\xbftj\xce\x98\x9e\xb7\xbd-\x1ej\
+ 1\xce\x88\x1e\x80\xee\xbc7\x82N\x9e\x9e\x9ai\x96,\x84y,\x0e\xf3\x82#q\x85\
+\xd4t\x17\x08\x91\xb5\xfc%2D[\xe1\xb7\x85\xcd\xda\x94\x0fT\xae\x98J\xed\x7f\
+\xe0\xce\x9e\xad\x86B\x0f\xed3\xce=\x90\xdd\xd7\xe2|5\xc9\xec=\x9f\xf1X\x08\
+\xb1\xc3\xa6Dul\xf9i\x99\x99\x1dE\x95g\xe5\xbd\x0e7{\xb2=\xc9\xb5\xfb=\xf0PS\
+%\x9a\x15*\x04\x96\n*a\xcf\xfe\x11\xa81\xc8\x06\xb1\xe1\x96\r+\xcb \xc9\x12\
+\x9f\xe5\xd9\xca\xf9\x13\x80;\x99J\x0b\x95\xb5B`\xc08v\xaef\x1a#\x05\xb1c\
+\x8da~\x9a\xd200@u\xc9\x88ng\x99n\xf2\x87p\xd7\x9b\x1f%\xd7\xb3\xd9\xac\xd7x\
+\xbf~\x91Mp=[3\xc6\xab\xcd\x9d\x16dd\xb4\xbdU\xcbx<[q\xfax\x83\xaeY\xca\xc8\
+\xcc\x8c"\xc4\xee&rs\xf7\xf5\x15\x1a1z\xe2(\xfd\x19\xe6Lz\xb1\x8a\xfc\xfdo\
+\x13\x92\xd6\x00\xf6+\xda\x90\xfe\x88i\xae\xff1\xed\xf1\xe2\xa7\x03i!\x91Q\
+\x9axsk\xebS<3\xa8\xdd#+\r~B\xf0%\xae.q\x9bR\x8e(K\xc0\xe3f$\x9e"::\xda\xea\
+\xd3H\xdaH\xeb\xaeq\xbd\x95\x98\xe8\x0bd\x92A\x98\xae\xb1\xce\x8e\xef~8xiN\
+\x86\xc7\x95\x80\x10\xac \xb15\xc2\x9f@\n\x99\xde?n\x17\xb8\xd4\xc67\xb7?\
+\x1c\xcf{\x0eo\xc9qz\x84\xfd\xae\xa7\xa6\xaf\xb7\xd7(\xfbm)\xa7\x89\xbc\x85\
+\x18\x19\xcf\x17\xcaZ\x8c\xcc(e\xe7\xb6\x99\t\x87\xa8\xd9\xfd\xed\x9btzQ0\
+\xa6QI\x0e\xc5g\xcd\x8a\x82\x12`\x15!\xa8F\xd3\xe6-Su \x8d\x08\x05\xd9%\xa0\
+\xb2\xf4\xbc!t\xecX\xb2\x94\xef\xe1\x9e\x99&\xbe\xb6\xc2\x1b\xd3\xa2\xfb\xb9\
+\x8c\xa80Z\xaal\x05s\n1\x11\x1b\xa3P\xb1\xa0\x8b\xda#\x9ah\xfd;\xcd\xbf\x19\
+\x06[\xe3\xa7\xe8\x92h\r\x8a\x91\xf7Z\xd37d\x98T\x86\x1f\xfch:V\xcaN\xdb\xe3\
+\xbd\xc8bF\xbbZ\xd2\x95gOA\xb7\xd8\xaac\xe0\x92\xa8\x024\x07\x14\xf5c\xb73[h\
+\x0b\xa74Z\x88=\xbd\xde\x87I\xdf\xae\xd2\xd0<\xad@ \xb1\xd5X\xf3\x9e\xb9\xc5\
+\xc5`\x12y\t}}\xfd8H\xa9qe{{{`^5\x11\xd0`\xaf\xd9\x0c\xa0\x8fT\x9e\x91\xc8O.\
+/-1)\xbd_\x81o\xa5\x84\xd86\'\xdf\xbe\xac\x9b\xe8\xeevg\xc0\xf9\xf4*\xdf\xa3\
+\xc5&\xc3\x81\x15\x81\xfb@M\nD\x8bfq\x80\r\xa3\xe1\xe2j\x06\x10\xe6\xfe\xfe>\
+--\xed_\xa0\xacX\xe4\xe5\xe5\xed\xec|7\xcaFBA\xce\'s\xbb=(\x19\x1b\x1f_]]\r\
+\r\xadjl=\xc2\xf5\xc2]TS\xae\x85\xcf\xb3 \xdd\xca\xc9\xca\x8a\x0e\x8f\t\xb9W\
+(d\xab\xcf\xcd%\xa5z1\x9e"!&\xbex|\x05(\x8dO\xc5\x96\x03\x9f\x9a\x8a:\xdb\
+\xbb\xde\xe1\xfedQ\x0b\xab\x87j\xaf\x96\xf0\x97\x99\x89\t\xc4-\xc2\x8c \xd2\
+\x9eH\x14\xf8\xcc\x11*\xd4\x1f\xac\xcak\xf7\xce\x041t\xf4\xeb \x9f\x85.\xd7\
+\xf3\xbf\x03\x12\xf7\xe7\xab-\x16z\xf3+\xda+\xd2]\xee{\xe7-\x9b\x0f\x9e\x1dF\
+#w\x8f\x8f\xed\x16zF\xf4F[[dfr\x91\x91\x0e\x98\xb3V\x1c\x98S\xf0\x85`\xc6\
+\xf4\xfd\x8d:U:U\xc9\xd2#\xebL\xdc\xfc\xa4\xff\xfdW\xdc\xc3\x1d\x1fvV\xe0\
+\xda\xb8V\xa9W\xf7\xef\xd8\xa8\xb9\xa9\x1d\x84\xc1\xd8\x83\xe3v\xe06\xf8\x81\
+$y\xef\x9e\xe7\xf5N\xd6\xd9\x12+y38\xc6\x0b\xb3\x80\x8d\x80\x80\xf0\x00h\xa6\
+\xe9p\xcc\xc8\x88L\x90c\xb7\xcfeK\xf7\xeb\xfaeM\x93\x1e2"bld\xa4\xb5}\xb7hd\
+\xa4Mn\xe0\x13\x17#\xa3B\xc9<\xfa\xec\xceN\xbeA\r3 \xed\x04\xfd\xed\xdd\xbe-\
+UU\x93\xa0\xa6\x13\xe7\xdf@\x86-,,\xbc\xbe\xbe..\xa6\xca\x99n\x01\x04s\x06/$\
+4\xd4\xb8\xd7\xe4\x84+oI\xb7H\x95\x16+\xe2\xe3\xc3\xd7]\xa97\xe5\xfe\xe5\x9e\
+k)J^\x8a\xadJq\xd5\xa5}\xfc\xf2\x11`@@K\xbc\x0f\xd8s\xaa\xab\xab?\xd6\x84}\
+\xaaKK\x8f\x9c>\xefxc\x87\xd5\x0c\r\r\x95\x95\xaf\xaaR\xba\xa1\xbf\xac<n\xfa\
+}\xae\x1bv\x9f:\xf0\x1c\x1c\x1e~\x1eN|6nZ\x11\x10\xe2g\xa6\xa5\x97\xf9\x945\
+\x97\x94\x1c\x02/\xb6\xb7\xb6\xb6\xd6\xd6\xc6eddd\xfd\xb2=\xe1\xc2C\nY[[;;;\
+\xdb\xd91\x01\x14<\x88\r\rnY\xfa\xbc\xc4\xcf\x83\x8f\x8c\x0c\xfcZ\x18\xbd7\
+\x16\rZG\xa0_H\x18\x11\x11\x91\xe5s\xa0\xcd\xa5}\xfd\x08\xab8\x97\x1f-d\xd2\
+\x0e\x92\xf0I\xb6\xd7W 9\xf2SRZ2\x92\x94d\xe8\xa8\xf4\xfc\xac\xadaiU\'4\x04\
+\xf6r\xa3}\xf7\xbd\xa0\xa4\xab\x9a\xf8\x0f\xb7\xbf\x832J\x10\x1a\x9bQ\x1f\
+\x01\xb7]\xab\xe5: \xfd[\x97\x1f\x17\x97\\6k\xb5U\xf9;\xdc\xdd\xbe)j\x9aW\
+\xa0D9s%\xa5\xd8\xa5]\xe8\xb5}L\t\xd1_\x18j"\xe4\x12\xfc8\xb5v\xb1\x96S\xbc\
+\xac\xc4\x15\x11\xf7\xccO\x007\x9b\xee\xc6hi\xd8\x80t\xca\x15Kn\x9f\xbd\xd16\
+\x96\x1b,\x95<<x)\x7f\xda5n\x1eu\xac\x03\xf5\x02\x05oK&\xb4)\xe0\x88\x9c\xb8\
+it\x03n/\xeb\xbeE5@\xfdUQ\xc1\xc2\xcc\xc2]\x90x|F\xc4D,\x7f\xe9P\xdck-\xd5T\
+\x80\x95\xac\xeeE\xc4E\xd1n\x8a\xc0\xfe\rj@\xf4H6\x18.\xb36\xc3VN."\xca\x0c2\
+\x19\x9c\xc7\xe3\xd5\xbb+\xdb`\xfe\xadO\xe0\xaf\xfb\xdc\xfc\xfc\x17\x84\xc1\
+\xbfM\xd6^^\xaf\xda\xf2\x91elxixl\t+R\xb6t\x1a\x99\xaa\t\xb9\x9d\x9dXC\xbb\
+\xe0a\xe8\n\x01d\xbf<\x8e\x81x\x1f\xf0\x85\xd9\xbf3\xf5\xc8J%\x1e\x8fpr\xdd\
+\xcb\xd5\xbaI\xa7M/\xc6\xe2\xdf\x9d\xfa\xc4\x1b\xb6\xed\x1e\x89*\xd5h\xbc)\
+\xa9\xca___\x01\xfc\x83x\x84\xac\xfd\x16ZEo\x17\xdbG\x8d\xb8T\xa9\xed\xf5\
+\xfa\xe7\x9c>\x85y\xb3\xcd\t\xd6\x82\x1a\x987\x06&\xa6\xa9\xa9Q\xbb\x0fq\xf6\
+\xbf\xdf\xa3\x87P\x96;_\xbc\x85j\x96\xbcZ^c\x04\x04 \x82L&<4*AFFF\x16CE\x89\
+\x94[M,X\x00n\xa39\x8fL\x8cM\x8cN\x8a\xc2&\xea1\xd9\x83@\x00I\xae6~\xff\xf5\
+\xef\xef\xdf\xdewG\xe3\xc5v\xf3\x04\xc2\xbe\xbbsE\xf2@0\xb0\x18\x82^c\xfa\
+\x97\x00\x04\x7f\r\xb3\x7fS\xa9\xf3\x99/V\xf0zx\xeb\xec\xdfv?\xc4\xb9\xcc\
+\xe5\xac(+\x83\xd7\'\xfewg\xd7\xd5\xfb\xe6CC\xef\rPS\xb2\xb0\xfe\xc7\xda\xed\
+\xb4\xf4\xc8> \x13\xdb7W\'\'\'\x00\xe1\x07\x07\x07\xb7\xb5\x01\x95\xf9\xb3\
+\xe0\xde]`+\xa4\xfe\x105\x19R\x85H$\xf1\x1d3\x18\x12\x979,&\x02\x86\x19.u\
+\xf3l\x8dA\xf8\',\x89\xb5\x8b\x16\xf6\xc7\xe3\xeb\xd0\xa6>\xe87\\-\xb8\'\xa4\
+\xbf\xe5\x15$B\x0e\xc3\x00\xba.\x0c\x83\xac\xac\xac\x16Q\x80ox\xbf\xc3\xa2\
+\x11\x1111\t\t\t\x01\x89Z\x05\xa6:\xddb\x80\xdf[fY\xc9\xeb\xc41{\xc5\xcd7h\
+\x08T\xf2$\x15\xf8\xeb\xeb?\xe8\x15\xebv\xa8\xbax\\Fxa\xe11S\x13cf!\xda\xae\
+\x16S\xcd\x11\xb6mmm\x0ex\x08m\xd6\xc6\xf7\xa1\xef\xc8;\x7f\x02^\x03\xf2z\
+\xc9dZ545c\xa2\xa3E\xaf\x1aJ\x96\xa0\xba\x05\x11\xb8\xa0\xa7\x85\xcb\x85RK\
+\x15\x11RB\x01Iqk\xbf$\xa5\x0c0@\x0e\xc4J\xbd\xba\xfa\xcd~\x80\xcbL3\xe3\xb3\
+K\xb0\xb9\\\xfb\xa3\x7f\x10\x11\xe7\xf3*\x14\x95\x8d\x8d\xbd\x83\x98y"rpc\
+\xf8l\x82\x90\x1c\x8f\x06,w~\xf2\xb7\xfe\xd5j\x95\x90rVb*\x14\xadD\x8e\xbd\
+\x10\x97f\xf0/\x0b\x92&v\xe5\x94R\xc5\xbe\x8f\x9c\xe4d\xaa\xd88\x80\xc5!\xc1\
+?\x07\xf6\x82\xd6\xed\x86\xdd|F$\x07LB7i\xec\x8eyXTR\x06w\xd3\xc6\xa7\xc64\
+\x07\x07b\x96+\x9f\xd2\xd0\xd1\x95*\xbdT\rU\xea\xde\xe7\xa7\xbd\xf1\xf9\x04\
+\xb2\xb2\xb2PB\x0b:;\x05\x99\x98P\xf6\xc3wvvD\xc7g\xa2\xac\xf9T\xf1\xfeK\x19\
+\x9f\x8dh\x07tr*F\xf13\x90\xa4\xd9\xca\xb3\x93xO\xc6\xc6\xad\xc5~\xfd\xe2\
+\xf22\xd4\x8d@\xee%N\xff\x98\xc5\xd5_q\xf7\xf1\xd5xFJB(G\xa9Hu\xd4J\xd2B\x93\
+\xea/\xeb\xbf\xcd\xac\xa9d\x9e\xa4\xf3\xb517\xe4\xe4\x8aT\xa5\xea\x83\x82\
+\x82\xc2\xc3\xc3!aQ\x1a[Z\xfaW\x8e\x1f\xce\x99\x1aV\xd6|\x0bl\x8d7\xba\x9d\
+\x96\xa6\xe4q\x98\x0ej\xc6\x1e\xdd\x05\xd08\xc1\xd5XT\xb2\xd4ut\x10H\xf2Z\
+\x97[ON@aW6k\x8d\xc7n\xdd\xef\xe7\x8b\x15\xdf\x00\x83h\x01\xb2\xaa\xf9xrN\
+\xf6\xd3q\x90\xd3\xbf_\x1ecb|\x81\x92\x8a\x8a\x8d\x15\xfe|>\xec\xf4\xbb\xebx\
+n\xe0\x06\xe4%\x0f|\xdf\x99\xaf\xd3\xa0f\xf3\x12\x96\xcf\x7f=\x9b\xba\xa3\
+\x7f\x9b\xc6\xbb>\x0e\\L\x80\xf6\xe3\xf1\xaa\x19U\nV\x066\xf5S\x1e\x82\xd3\
+\xbf\xe4d\x18\x1999\xf8\xb3\xae\x0c\x8e\xfb\x8dL\x1e\xbdix\x00\x12Y\x85\r;\
+\x96\x189\x10\xa8\x83\x92\r\x81\xe0\x83\xb8\x13\xc8E\xae\x0c\xe4J\x86\xfc\'\
+\xd2\x8b{\x07\xba\xfa\x10\x929\xc5-YwD\x0c\x9d\x0e_\x9b\xb5\xec\xb4x\x95\xc6\
+<8\x10\xa1\xf8Oq`\xa1%b\x07D((\x19\x19\xab**"5\xc4\x95q-iE\x11^\xe0\x9c\xf2\
+\x858\x04\xa2&2\x03\x91\xc40n@{p\x99\x8c\xe2\xcf\xa8\x17\xbf\xb7\x1a\xc9n\
+\xf7|\xa5\x15S\xff\x935\x81\x96`\x9d\x0faL\x00\xb8\xd7\x07\xed\x05\x11\x11\
+\xc1Y"(\x88\xc4\x13\xd7\x96\xbb\x1a\x15\x19\x95z`\xb8 -BH\x9d5\x1e\xea.\x11\
+\x95\xb8\xeaWT\x88\xff\n\xd7\xa9\xab,Bp\xa1\xf2UI\x9e\x13J\x18\x8c\x91\xe42\
+\xb7W\xa7\xc1\xc5\xf8\xc0h\t\xe9q\xf4J\xe8\x96\xc4\xd0\xf0 \xe4\x9cx\xb6\xa4\
+\xc4\xc42d\x1f\xacFl(\x14\xbf\xac\x9c\xa2\xe2\x050\xb7 P\xdfe_J\xbe\x0f&\xa1\
+r\x95""7\xf5\x1a$q\xact\xcdR\xe4\xc5W\x99\xa5\x00\xce\xe6\xe6f9\xb9QPS9\xe6\
+\xe2\x96\x9cc\x8e\x06\x90:[\x82\x8c\xc3\x04efUX\x13T\xfbl\x19,.\x01\xd0 OH\
+\xc4\xb0+\x01\x82bh?++oZZ<+/\'<X\xe9\x8b\x08\'4\xff\xce\xdc\xdc\xdc\xcb\xebk\
+\x92\xdc\x7f\x15\xfeA\x85\xef\x95\x0f\xc8\n\x93\xc3]!\x81{:\xe8\x9e\xfd\x00(\
+\xc5\xad\xc2J\x9fQ\xd8r\xd7\xf8\xe9}lJO\x7f\xa2\xbf\xc21e\x84\x9d\x84oH\x91-\
+\x0b9\x8c\xa0\t\x15<\x19\xc8\xe6\x81\t\xb8\xbe=\xfd\xc0n\xa4]\xd5\x81i\xb4G\
+\xae2\xf7G\xd0\x93G\xd0\x11\n\x18\x06\xb1e8\xeb\xac7hL\x03\x06\xc5\xcd\xc9\
+\xa9\xff\xbc\xc5\x06}\x98z4\x1dl\x19\xc1\x9dl\xc5\x91\xce^2\x8d6\xbb\xb7`\
+\xe6\xad\xe7\r\x1c\xbc@\xdf\x16%d$}\xee\xddZ\x0e\xacf\xfdr55\x9d\xec\x14\x8c\
+-"eQ\x90=7~\xb4Al\x8b\x89\x17\xf4\x15\xe5\xd0\x9bX\xd0)\xde1\x12^\x83\xdd\
+\x12\x00dc\xcd\xc9uJ\xd8n\xa9;\xd2\xfb\x87\x87\x90x\x83g\x10Q\xa1\xa6C7\x8dX\
+\x86\x99.\xed\x03\xbb\xcc\x1bZ\xf9\x8b\xdfY\x9df\x86\x10Y\x90>\xe0\xd6\xd4\
+\xbe\xf6B\xa3\x97\xe2\n4\x80\xd9\xe5\xb1\x7f[\x18\xeaE\x1d\xfe\xc1\xa5\x0fJ\
+\xcfLg\xd8\xd0\x12\x13\xa5\x87Z\xc3\r\xedvx\x82\x15~B\xcd\x98\xb4hXa9|\xc6\
+\xc4\xfd\x0e{\x8a\xad%\xe8\xd9h\x8c<$B\n\xfd\x8aS\xe1\xfam\x1b\xd7\xd3\xcbk\
+\xb6"\xf2\'\xd6$\xe9\xd6\x82rc^i}\xfd\r\x10Q\xef]\xeeg\xe0\x82\xcdS\rj\x0e\
+\xc3a\x8f\xb2\x83\xca\x14%\\\\\\\xa8crJ\xcb\xaa\xc0\t\xb2\xc2\xca\xcb\xcbY\
+\xf4c\ty\xfb\x16\xa1\xe2\xdf\xab\xd4\xe9\x9e\xdf\xc4\xef4\x12(9j\xcb\x16A?4\
+\x99\xb3\xb6\x1b%\x94\xb9\xf7j\xa2\x10C&@\xf1lQu\xeaT\xce\xbc\xbb\x05\xbb\
+\xff\xce\xa9\xf9\xce\x82K\xda(&*`\x88$\xec\xffUBR\x92\x02\x12\x9c\x08l\x14\
+\xbeqL&\x0ei\xe1\xa4QRRR\xb1\x043^W\x0e4v\x7fj\x1b\x8aJ\xf2r#\xcf\xdc\xb6\
+\xde\x80\xc3\xa4GI\x0e\xb5\xbc\x92\xc6\x0b\x88g\x99\x89\xc9,\xf5c\xec\xe2g\
+\xab\xdf\xe7\x07\xf4\'D\xfd\x8b\x08i\xae2\r_\x14\x11\xbdf\xe5\xc4\xd8\x08\
+\x02*\xe2\xa3g\xe7\xe0\xe0 @.\x01"`\x13;\xda-\xa7m\x87\xd9\xb111v\xf6\xdd\
+\xacl \x05\x05Yz`\x95\x8b~\x03\x91*M;\r\x90\x0eb\xa6\xd0B\x12r\x91\xa1C\x11\
+\xf3^\xd6~?\xcd\xa0\x01R\x91Z\xb7\xcd\r jm\xe7\xdcO\x7f\xbe\r>\xe2o@V\xa4Pw+\
+V B\x11\x87\xa5\x12\xf6G\xe7\x9f#\xa1O\xb6\x16_\xbe^R$*\xa8So;\x91\xdeS\xff\
+\x1a\xb5[\xff\xcd\xc9\xc77\x16\x0e\x96\x10\x8f\xb7\xc4\xf1\x1b^\xd2\x91\xac\
+\xb8N\xb1b|\xda0\x98=.+MMC\xc3\xe5j\xab\xb7\xa3C\xa0HU[S\x13PU\xfb\xb5\xd6\
+\x1f\xe7\x7f\x9b\x02DD\xca\xd4\xa9\xca\x7f\xdd\xdc~\xf3\xf9\xb8\xcdQRZ\x8a\
+\xe2\x1dj\xd1\xb01\x8d\x00G!\xa5\xa5\x85\x1f\x13^\x8b\x95\x90\xb0=\xb7\x95(T\
+\x96yPi\x1f\xb5y`f8\xfb\xdbt\xba\xd5\xfbS[[\xdb\xb3S\x88\x99\x99\x99\x9fz\
+\xf5\xdc\xd5\x9a#\x1dP: \xe7W\x1b\xda7\xc4\xfe5\xa77\x03<\x89.\x89\x8e\x8enl\
+\xdf\x91\x93\x93\xb3\xce\x90\'7\xda\xe5\xf4\x8f\xa4\x94\xd4\x98Lq\x84\xc6\
+\xe0\xc0@\xeb\xfa\x05\x80z\xe3)\xccj\xb5v)))888-NK\x8amz(0A_\xa9\xc6\'\'\x15\
+\x14\x15c""~\xbb\x9cj~\xfd:\x91\xd7\x1f\xeaz\xf1\xf7\xfb\t\xd7\xe2\xe2"5U9 \
+\x96\xd1R\xbb\x80\xa8_]]%\xa1\n\xb1\xb8dXXXL}\x9cTR\xca\x96kiHK\xc3\xaa\xbf\
+\x03o\xf7(x\x97z\x8dn\x06tU\xc3f\xd5\xf7\xf9\xc6<Z\n\xf2 p\xd0\xe4\xf8\xe8\
+\xe8\xe8\xf4\xb4\xdft\xd9\x97\x99IUNn\xec\xe1|u\x1f\xfd\x06\xd0d\xcbl\x8f\
+\xa1Wi $\xec\\{\xce\xb4\xc0t\xb1C\xf8\x86\xf6\x833A2\xcd\xaf\xad\x112\xc8\
+\x8e\xe70\xe5\xa4e\x1f_^J\x83z\xe2\xfd\xe0\x0cqE\xbbJ!\xe0\x18\xe2\xca\xb8\
+\x8b\xb3\xed\xd0`\x85\xab?\x86\x81N\xffb\\\xaf\x90\xc1u\xfe\xfa\xfa\x1e\xc9\
+\xf6\xdb\xe7\x94+\xacg\xc7Ob@Or\x01n\x99"\x8a\x98S\xb8_ilj\xd4\xf7q\xe9\xb2\
+\xaf\xf6_\xd6\xf3\x04\x9d\x8c\xe0\xc4\x02\x93a\xfb\xe5\xcb\x8f\xba:\xb7\x8b\
+\xb5\xb4\xcct(N\x17\x13G\xd5*M\x80g\'&Z=\'\x0e&*\'\x80\xd1vtt\xbc\x7f\xd6\no\
+\xa1rpr\x06\xa0!h\x18\xfa\x91\x1a\xe1\xe1\x86\x85\x85\xcd\x9c\xde\x93Zl>n\
+\xb6D/\x0f\r\r\'&$&\xa7\x0b\xb1\xf2\xc2\xcf\xd5)\x96 \xae\xa1\xf6\xa8,\x1d;\
+\x8b\x91\xe2\xfe\xed\xcdO\x14\xfcj\x11\xa0P\xed\xa5:\xbd\x80\x7f\x15\x89\x8d\
+\x83\xc3\x88\x1d9\xbe\x1f\xa1.\x05T\x03;/\xef\xf3Z\x9bS*\xaf\xe6)\x0b\x8d3Z\
+\xbf\x0eB[o\xbbf\x10K\x02\x86Z\x87P\x8e\x1e\xd3\x92\x15\x87P\x0e\xaa-\x9c28d\
+\x04\xb8\xe0~\x9c<$\x85S\xa5Ze\x06L\x9e\xcaH\x84\x86\x86\x86\xcfuNwjJJ\xe8+j\
+\x80\xa7\xa3c\xbd\x1e\x93\x92\xa2bH\xab\x82\xa6f\xb2f\xc5\xfb\x9a\xf0\xbbZ\
+\x90\xdeG\xc6\xe6\x1b\xcc\x93\xc0\x16_\xe8\xfa\x8f\xa6A\x87W\xd7\x94\xfe\x8b\
+\x9eNDP\xf1u\xf1\xec%j!%\xb5\xa5\x85y\xdf*j\xb5e\xae{\x9e\xd2\xdb\xdb\xeb\
+\xe1\xa6\xb5\xfb\xb4\x10\x08\x18\xd6\x16>\xb9.\xd9\xbc\x15\xc7\xc8CII\t,,\
+\xec\xbfS5\xd9\xd8v\x0c\xaf \x1fb\xa3\xa2\x06\x9a\xe1\xd5\xb2\x1e\x1e\x1e\
+\xa2\t\xb8\x87\x06\x07\xf1\xa2\x87(\xa4c\x12\xed\x98\xcc\xcfy\xc9#\xa2\xa3\
+\x93\xc6\xf7\x81jd\xeex\xca\x97\xfb\xc2nBD\xeb\xf7\xdb\xfb5\xe6<\x83\xcb\xf6\
+\xa5\x9d()\xa4"\x84\xa4\xf3\x83\x82\x1cb\x97\x86\x8a\xef\xe0\n\x07%6:v\xbds\
+\xc9\x9c\xa0i\xfdq\x93\x99\x96QVVa\xa5\xde\\\xde\xc0 {\xd0D[Oo\xc1\x8a\xe3\
+\xf2\xe3E?\xf5\x0f\xf3\x13\x8e\x85\xa5e\xf7\xfdM\xcb?\x9e>=mw\xbb$~S\x8c\x90\
+\x8f\x18\x1f\x1f\xdf\xe4\xbb\xffsw\xc7\x91\x18H\xa6\x0bL1\xb7\x90\xd0\xc7\
+\xc3\xaa=\x7f\xd6\x14P\xef\xad\xad<\x95\n\xa9\x9f+\xbc+\x14\x7f\xd0\xbfze\
+\x0e\xfd\xbboM04\xee/\xcc\xd9\xbe>\x08hyH\x94PS\x1b\x9b\xafT\xbf\xf2\xa4z\
+\xc6\x03\x969\'\xe6#*\xec\x8d\x8e"\xb3 r\x96\xdfB\xf7X\xd0\x81\x04Q\xd0\xeb\
+\xef\x851\x98\x12N\x0f\xc1\x01q\xd5a\xde\x03Q\x88\xe6?\x0c\x84\x930\x17JAA\
+\xfd\x8a\xc5\x8f\x0f\xb7n\xbf\xcb\x16\xe4/_V!?zZ\xba\x9e\xabJKG|^\x1f\xed+\
+\xdc\xf9\xb8\xb9\xdd,@0\xc1>-^v\x160y\x956\xde6\x95\x15\x15\xe3V\x1c\x0fww<\
+\x841\xd5\xab\xfa\xd0\xd0\xd0\xf8\xd1\xc5\xa7SYAO\xeeM:\xc8\xbaB+\x08+\xd1\
+\x0f\x04\xdf\xbf\x7f\x7f}\xbc\xccIKk\xf3\xedd\x14`\xb0\xb9\xec\xeaL\xdc\xd2\
+\xd3\xfd\xffs\x01\xac\x97\xaa\xd3\xb2\xb3\xb3\x1d\x14\x9f\xbc\xbb\xaa\xf9\
+\xf5I\xe1\x80r\xa3\xc1\x99\xfe/[?\x81rrz\xba?C\xa6J\x13\x16\x02\xb5\x9e\xad\
+\xfe\xe0\x90\x15\xd5\\\xb0\x93\x8a\x83\r\x80J|$\x18uz\xeaL\xcc4\xbc4\x84\xe0\
+>^\xd6\x98"\xb3\xef^\x1d\x9b$h\x91\x81\x12P\x1f6@o\x9e\x9d1P\xc6\x86\x86\x86\
+\xe83}S\xcaI#b\x1b\x00w V\x0f\xae\xac<\xab\xd2\x15\xbe\x7f\x895\xa8\xf1.\xc6\
+\x10TgK8_\x7f])\xd8\x14JG\xcb\xd9r\xe0A\x82\x81\xac\xe5\xcb\x98<p\xe0\xd1\
+\xac\xd6[Y]E\x8c?\x06\xb2\x04\xa9\x07\xa8\x89\x8f\x9f\xfa\xf5)<\xa7\xa7\xbf\
+\xa6\xb1\x91\x83\x8f\xef\xdf\xd5\x87"\x82Y\x98\xbbv)\xba\xcdb0\xc9\x17gg6 \
+\x10\xc2\xdd\xe0\xfc\xfc|\x8e\xc7A\x1a \x99Z\xd7\xe0s\xdd.\xa7\xc9\xe3\xfb\
+\x81,\x06bb\x81\x8b\xa0\xaa\xeaj\xa96\xc5*Mi)\xa9\xbf6\xcd^\x8f\x17U\x86\xdd\
+\x1b\x87\xb7\xbdz\x1cll\xf5yy\xe0\x0b\x13@0\xe1\xc4\x8f\xa6\x94\xddWJ\xc9\
+\xf9\xd8?NM\xc5M\x03Vt\xb4\xb6\xcc\x9f\xc0\xef\xe3\xfd\x16\xe6\'x\xc8\x1a~4\
+\xd5\x16\xaa\x83[gY\xc9\xea\x82\xadN\x91>\xa7\xa0 \x10\xaa__^\xe5\xe5"\x84\
+\xdb\x1f\x1bxyyq\x98\xf5$\xe2\xcd_\x1f\xceas\xf8\x81\xc5\xb7\xa0y\xae\xd2k\
+\x9b\x035Q\xfd\xf7_RJ\x8a\xdfn\xc6\xe6\xd3\xa5\xe1\xdb\xe3\xd1\x91\x15\x08Tn\
+P\xf3\tX\x86R\xfb\xba\x10\xd7EO\x17\x90\x95G)\xf6*\xbe\xd5<xv\x12\x11\x11\
+\xd9gy\x8e\x9b\xd4\x8dP\xec\x1d\xa9\x81\x81\x85\xbf\x14MZDFD\xe8hi\xf5\xecQ\
+\x93\xc7\x0e7\xd4\xd6\x82M\xc4\x9a\x82\x93\xf7]B\x87\x11_\xc1\xf2`\xf7\xe8\
+\xa0\xe1\xe0\xc0\xbe\xe5\x0c~\xce@S\x0e}\xc2A\xd5J1l\xbe\xfdL\xae\xf9DNg-G\
+\xd1\x8b\xe8\xc9fn~7b\x81\xf6\'n\xe2\x90\xae\x03K\x16\xad\xaa\xaa\x82\x84\
+\x84\xbcE\xbc5\x8d\xb9.+\xa3m_\x9f5>\xd3\xaa\x13\xd3lv9=Y\xachI\xb4\x1d\x9d\
+\x18i]\xf4 \xe0\xb4\xdd\xba%\xaeI\xc1\xc61\xa7dw\xc9\xe0\xe3\xe3\xa7\x0cV\
+\xd7\xd6~\xeeMBe\x10\x87D\xfb\x15Z\x1a\xe2\xb3\xb01\xbb2\xbb\xb1a\xd7\xb2\n4\
+y\xa7o\xa7\xaf\xa7\xe7\xcb\xd8\xfe\xbf\x0b\x95\x8f\x0e\x1f\x9f\xbd\x8d\xe9\
+\xfb\xdf>\xfcK\xf1\xa9\xea\x9dY\xdbs\xa9\xc2\x1c\xdd\xdc\xdd[\x97N\x91QQ\x95\
+\x14\xe4\xb3\xd2~\x0cJH\xff\x14\xa9^:\x05\xfa\x10\x19F\\__\xff\xabs\xa3\xe9D\
+<Z\x0e\xd8<\xb87V\xa6\xbc\xe4\xe8\xaf\xe7\xe0\xe7\x81 \x89\x1fr\xe2\x8c$\x11\
+\x8f\xf8\xd1\x07R\xaf\xc8\xb8x\xc2\xcd%\x8c\xb4\xac\xe6\n\xbd\xe9\x8c\xe6\
+\xba\x8eNN.|D"\x97\xa3\xe1\xa3\xc0\xeaEK\x99\x924\t\xdfN\xb0_I\x13\xe3\xe2\
+\xf2\xb8]\x10r\xe5\x03\xad\x92\x0c\x8eX~\xfdx\xb1\x0e\t\xe9\x06,@u\xb5\xa2T}\
+U\xce\xdf\xf4\xc4D,\x02\x82\xd7\x8aO\xde\xc8\xea\x8f\xbb;g\xab\xea\xc2\xe2\
+\xc2\x00Ia\xae\x8b\xd4\xf4t)\xa2\x7f\xde\t4\x93g\xa7\xefe\x97O\xd9\xf72\x1as\
+\xed\xd0\xd0\x1a\xbd.\xef\x8b5\xdeB\x0b\x89\x81\xbes\xfd\x96\xf6\x17\xd8\x17\
+\xc8\x00\xff\xd5sEEE.\\\xa4\xa3{\x9d6\xc7\xff\x1a\x05\x85\x80\xb2H\xbd\x02\
+\xe2J\x0b@\xca\xf9\xf9\xf9\xd2\x95\x9a\xc1b\xb3kkH\xf7\xd7i\xc7i\x0f\xcd\xcd\
+\xc7eeuu\xac\xa5U\xfda\x1e\n\xca\x8f&\xce\x0b\x9a\x86\xdfj\xd4\xe9\xd8\xd9\
+\xd8\x90&a\xaa\x14#\xb9\xca\xfd\x85\xfd9\x81\x0c\x94\x94\x92A\x1f\x1bG\x11$\
+\x11\xd3\xe0\xfb\xee\xa9\x0e\xcb\x88-\xaf\xa44\r\xa4\x90\xe1!"\xc4[\xc4\xd7O\
+\xe3\xee\xd5s\xa9NZz\xfaW \xf4\xf2\xe4\x00\x83\xd4m\x02-.,$\x8e\xda0\xd1\xd2\
+V\x97U\x01R\xd8\x88\xa2\x1b\xc9\x85\x15\x90\xce(\x8b\xe1\xfe\n\xac\x8e\x04\
+\x14\xa3\xc8\xd9-~\xb4T&\x16%M`\xe0y\xb7\xe7=\xa8qZ\x0c\x93\x15H`\xab%.\xee<\
+\x0c6\xff\xb5\x82a\xa9#X\xb5{\xac[\xb4\xe4Q\x86Zd\xc6fN\xed\x00\xc1\x96Y\xcc\
+\x87\xfc\xef\xf0\x9d\xf8\x01\xb1\x89\x82\x89\x94\x03\\K]W\xf5\x07\xc0\x84XX\
+\x8a\xa6V\xe9\xdb\xbf\xd4\xec\xb3\xc9\xf3\x0f\r\xdd\xf3\xdc\xc5eA\xa0\xf4\
+\xf9c3\xfc\xb5\xca\xd5AO\x8d\x99|\xbaU\x1d\x006\xc1\x98o\xd1\xe2Y*\x87\x17a\
+\xcb+\xca\xcb\xbb^\xd7/\x15\x15\x15\xc4$3\xc28\x8e\xf1\xc1\xce\xbeR`>\x07\
+\x83\x8dJN\xc4\xee\x9fJ\xb4U\x14\x0e$\xce\xcd\xa9\x96\xcc\xd3\x8e\xd9kK\xcb\
+\xa8\xf3yW\x16\x94-\x1db\x16\x8d\x195 \x9a\xc5\x8c\xc6 \xed\xfe\xb4\x83\x83\
+\xc9(Tf\x81A\x81YMBebgf\xe1\xe4<\x97\xe7\xe4,(\xe0R\x81\xd7\xa5$\xf5\xec\xdc\
+\xa8\xaf2\xc7\x8f\x86A\xe1\x05\xb2\xb4\x18\xd9w\x17\x1d\xd9\x04B\x94\xe1\xe4\
+z\xb6`\xb1\x04Jx\x07|\x7f&\xb0\x00K\xc5\x9c\xd9\xef._V\xe9E|L\xd7\xddJ\xed\n\
+4\r\xeb:!\x86aBH\xb0\xd6\xc0f\x89\xf8\xbc\xc3\x82\xdf\x05\x88\xa7U\x8d\x90\
+\xd0\x1e\xbb\xde_\xc5\x19.\xd4\xd4\xe6]\xcf\xd6f\x1d\xab\x8a\x1a\x1b\x9d7?\
+\xde\xdf\x00u\xcfW\xa7s;[\xfbq\xdd\'\x89]bd\x979i\xa1V\xb1H\xad\x94\r\xc5\
+\x88!\xdc{\xec\x8co\x8f\xff\x03_E\xc1\x1f\x0cJ\x11\xbdv4t\xee\x86;\xfa\xabpU\
+ME\r\x00\xcdsH\xf7\xc3\x005OMM\x01!\xbeH\xf5{\xc7\xf7\x01\x85\x84\xf4\xf4bu\
+\xba\xc5pP\xa7\x01j\xb4\xac\x8a%\x19\xd4C\x03\x92\x962\x91QQ\xd4p\xf9\xcfkY*\
+Q\xab\xd8&.\tD\xe5\xec\xa4\x82\x82\xe6\n\x18H\xa7\xb8\x14v!\xcf\x0f\xf6\xe7\
+\x14\xe2A\xdc\x94\x9d\xe8X[\x04\x91NX+\xc6\x05\xfel\xfe\'\xef\xef\xdf\x8f\
+\xafw\x87S0\x14\x19\xc5!\x85\xdf\xb6Q3\xd2\xd3\x01\xe6\x03\xc6p]\x94\x9e\xde\
+\xd7\xd7\xf7\x8bZ)\xdfb\xf7\xfeY\xebs\xf7\xf8\xc6V\x02\xea\x1c\x16\xbb\xba?\
+\xf4*\x88\x8c\xbc\x92T\x02j\x9f\x99\to\xe3\xdc\xf5\x0b\xbd\xbc\x00q\xec\xd2\
+\xa1\xb8\x9b\xbfjY\xbf-\xb8{fX\xeaZ\x04\x01N\x914\x9a<Y\xc9\xbf\xf4\x19\x88\
+\x9dz%\xd2\xad`\x81\xb9\xc4\x10\x1e\xf6\x9f\x92\x83@\x83\xe8\xaa6!\xaa\x10\
+\xf6/mU9\x1a\xc2\xbef\xad\xbc8\x96m\xc9\xdfBZ=\x12\xce-\xaf(\xc5\x82fW\xdbB\
+\x0e\x17g\xda\xe4\xffNN\x9dD\xbag\x9f\xddX:\xbd\xdd>dY\xc7m\x92\x12\xd8x[8\
+\x08\x84 j\x7f\x04\xb9\xe8$\xce\xdbp\xad\x02|\xd9\xe3\xd5\x1f=\xf2\xe7\xf7\
+\x9a\x12\x19\xed\x7fX\x88*\xb4\x03t\xb1.PF\xad\x8b\xa0\xe0\x8d\xf0\xe1]\xe3\
+\x0f\x06;\xd4\x92\xf9\xe3k\xf7\x9e\nh\r\xcd;\xe5\x1e\x1a\x06\x86\xb7\xe3p\
+\xcc\xdao\xb9[k2\n\n^\x1f\xc18\xa9\xfa1.yuu\xf1aS\x99B\xf3\xae\xbb\x9e\xae\
+\x16(\xdf\xd0ttu\x81\x94H\xc5uR\xa6\x94b\xcf\xbe\xc1\xa1Z\x8b\x0c^\x04\x9eJt\
+t\xff\x02x\xb2!\'\xae\x81\xdf\xb9\x8b7\x7fq\xc5\x8a\x19\xd0\xee!t_--\x0f\x07\
+\xf6\n\x0b\x95\xd555\r8q3\x15\xa9\x15\x89\xcc\x14\x9f\x96\xc2\xbb\x03q \xe2o\
+\xe9\x93\x1f\x9f[\xae\xd8S\x95\x19\x10d\xe4\xc7N\x180ez\xf7y\x00W\xfb\x95\
+\xf9yg\xe5\x14\xa8\x1510\xe7\xffk\x8a\x88\xb6T\xf1\xdby5\xa8\xd4^\x99.\xc9h\
+\xbd\xff\'^D\xa2f\xc5"\xa8I\xcc\x9e{\x80\x03\x85\x1d\xef\xd5UM\r\xc8\x05\x8b\
+@\xdd\x89r\x93\x92\x87\xf6_\x1fLo\x0cH\x9c\\p]+\xbc-\xb3\xf1t\x9c.\x84\x83\
+\x12\x8fj\rD\xee\xb0\x99\xaf\xdc\x05\xe4\x8a\x1cM\x1c1\n\xfd9\xa1\xfd0\x14M\
+\x8b\x8c\x104\xb39\xf0\xa3\xe7\x8f+\x97\rD%Z\xbf\xd7\xbe\x15\xe4s\xf1r\x86+R\
+\xba\xe4\xe3\x17\x81kr\xc0,\xf5\x9c\xde\x1a\xb3\x15\xf8GeA\xfd\xe6F\xed\x1c\
+\xca\x82R\xe5\xeb\xc2\xd7\xc4C#\xbd\x7f\xf1&\xa5\xc8-\xcb\x03\xb9i\x18\x1bo\
+\xd7]\x12A\xae\x92@\xb94\xf2\x8a\xac\xc3\xbd\x9fW\xca\xf3s\xf0\x0c b\xa2s.p;\
+\xec\x05\x07L\x91\xc3A\x91\xf0:B\xb9uP\xcaV.\xffL\xb9\x7f|\xbc\xd5\x90\n\x88\
+\x16\xce\xcb\xcf\x87H\xf4E\xdb\xfa\xf1\xdb}=\xc8\x8enF4\x06V\x92Y\xd6;x\xe9\
+\xf4K\x85\xa1wF\xe7\xc7\xee\x92Q6\xe3\x07\xa7\x99\xf8NV\xed\xbeNd\xde\n\xa9,\
+FJ\xdc6i\xa0\xbc\x05Q]\xfaD\xb1\xa0\xd7\x83\x15\x07~\xa2\xe4\xc6\xd35\x01\
+\xb3\xcf~\xd1\xa4\x92muM\x85t\x01\xf8N\xcd\xed!\xb3\xb3\xab\xeb\x9f\x85?"\
+\xc9\x08.3\xe9\x7f\xf1ei\xb3\x04<T\x0bf\x8d*\xa4\xe11\xc1eLMMgC\xc8\xdf\xc8\
+\xadz|G\x90\xf2\xa5\xdf\x05\x06x\xa7\x03\xd8W}#\x99\x0b\xa4\x93\xfcZwb\xa8[\
+\x12\x93|*\'s\x92\xd9?\xc9\x1a\x19\x88\xc74~\x82;\xa7\x00i\xce\x89\x8f\x04\
+\xa1\xcf\xe0y\xcb\xf1z\x08#F^)\xcb32,\x82\x0b\xeb\xdf\xdd\xd3\xcf\t\xc3O\xe6\
+\xe6\xe6.\xec0]y5\xa5\xbf\xc0n\xa6\xb0\x1c\x12\xe2\x13\x06\xb6\xf3_\x848YN{v\
+\xa26\xf9\x90\x10|\xbb\r\xbd\xe2\x92\x97\xb0F\xf8\xa3\xf8U\x91\xbcq\xd7W\x88\
+\xbc>F\xcbE\x87\xa8\x18[\xcf\xcaA\xf2\x07\t\xda\xec\xfa\x05\x7f\xe5j4\xe7\
+\xce\xd3\xf5\xaew\x1cCU4\x8e\xbf\xfa.\xa1[\xfeGl=\x0b\xb4\xd7z\xeaC\xbf\xbe\
+\x14.`\xd6\x069\xa8ip\xf0\xd8\xe2S\xd7\xa1\xd7\x92\xe6\xe6\xffYd\x15*\x8b4\
+\xaeZ4\x9co4\xb4\x83\xdc\x16\x81\xae\x9e\xa4b\x97qy\xfb\xbe\xbeN\xc5\xf4Z\
+\xa0`\xf5\xe7\xbc\x0f\x16\x03\xfd(\xa9At\x9a$y\x7f\x9f\xbc\xbb\x7f;.\x11\x83\
+\xcfx\xe640\xf6\xe4\xfc\xbc\xc8h.\x80N\x10}\xdb\x997K\xf1\xab\xefW\x8c\xb3_O\
+\xe7\x99\x0c[\xe2\x12\xbd<\x08\x8a\xbe\x17\x9f\xe8E\xf5\xa4\\\xd1\xd4m\x91\
+\x8a\x1c\xd3X\xd0\xc7\xeeoo\xe7-\xf1\xc2\xd8\xb64}\x0f\xe2\x12\x0c\x89\xc5\
+\xb3V\xe5\xae\xdf\x02\xb4e$\xccu\xc7\x13~\xfd\xa2.\xa1\xcaR,1\xef\tL\r\x9b\
+\xaf\xd6n\xa9\xa8\xaeF\xf1Q\xe0l\xe2\xbcw\xb9G\xbeG\x966\x14\x8a\x98\x8f\x8c\
+\x0b%\xf8U\x1b\xbf\x15\xe4O\xeb\x9f\x8a#\x1c \xee\x1f\xe7C\xfc9\xc0\x17\x96{\
+0\x1d=\\\r\x8dK\xb6\x87o\x00\x9b"\x9c<\xf8\x89\x8e\xe7\x0b\xc0\x94\xc0\xfd\
+\x01m\xa3.]\xd2\xd8h\x99\xacl\xc2B\xf8\xc9Q)n\xc9<\xbc\xb6u\xcd\x12\xe2oE\
+\x05\xdb\xe8E\x90F\xc5b+\x98\x04%-\xd6\xd6\xaf\xf7\xcb\xcfC~\x92\x9b"B.\x02@\
+c\xdf\xe5\xe4\xe5\xa73\x85~6\xc1\x14\x19\x91\xf3=t\x9a\x92\xad\xdb\x90\xbf*\
+\xa8\xd2t\x180\x9f\xbcI\x0c8\xe3\x90\x07\xd2\x11k\xa6MD!\xd9\x1c\xbc\x91\xa1\
+.\xaeg)\xda\xf4\x91\xa9\x11y\xf1\x8f\x1b\x99\xf2\xf6\xc7,\xfd\xfd\x1b\x01?\
+\xd1UG(\xad\x1c7\x1e\xa6\x17B\xa0#\x99\xc5\xac\xbc\x16g\x8c\x11oPsyr\xc2\x96\
+1\x01g\xde\xab\x7fz\xc1\xb5\xb8\xf0\xa7t\x114\xe2HQ\'6Q\xa4N\'\xee\xed\xde\
+\x8b\xbe#i\x0c\xb4\x9fB\xb2\x04\x94\xa4\xf8Z{f\x98+\xf0p\xcb`2h\r3\x95\x82\
+\x88\x8d\x05\x0eN|C\xb17F\x7fm\'++\x8b\x07\x8c\xe3s\xae\xc0M\x00\xff\xaf\x18\
+\x13\x13\x97\xd3\x19\xfd\x9b\x19\x08\xa4\x13\xb6\xc3\xd9\x8cwphl\x89x\xec\
+\xdb\xcf.\xefr\x89\x88\x88\xb8\x08\xbaw\xeb~\xd5/R\r\xf7Bm\x87s\x80\xdd\xc3\
+\x07\x82I\xba\xb3\x82\xb5u\x85N\x95\x94\x08\xc2\x01\x86\xb4wf\x89wY1L\xe7D(J\
+\'\x8d,\x86*\x19\xf9o\xf7m\x1355\xcc\x8eBT"Ot\xe1\x1c\xa2k1_\xcev\xb0H\xf6\
+\x95\xdd\xeb\xbb\x87\x87\x9dh\xef\xbf?*\xb60\xaf\xa8\x7f\x9c{\x9d\x89\xf9/b\
+\x96X\xdf\xaae\x0c\x16n\xf5\xffK\xc7\x97\x1d7\x114-p\x95\x91\x816\xcd\xa1X\
+\x9d\x17\xa1\xaf\xf0v\xb40\xa3\xa9\x1baA$\xb25+f\xbe5\xdb\x82\x02\xb1\xdar\
+\xb1; \\\x1b\xb9\xf3[\x0f\xb2\xd9\xcb\xfb\xe78\xd5\x9d\x1dt\x95\xc5\x0b\xbaD\
+\xf8g}\x9bg\xff!\xad\xb0\xdb\x06vn\t\xa8\xab\xbaZ\x0f\xff#\xb09\xfb\x0etZ\
+\xa4\xe2\xa2\xe9\xc3$,\x04\xb4\xef\xa2\x1aP6\x07\xf7\xcf[E\x8c\xc4\xb5\x94\
+\xef\xdf\xed\'\xa6\xa7\x95\xe4\xe5\xf9}\xdfxT\xfd\x81XS\xbb\xe2\x1f\xaa\xc2B\
+_lTB\x17\x07\xed\xfd\x946oy5Z\x9b\xd2\x0f\x0e\x19\xe5O\x1f`\xde\xd3\xe73\xf9\
+\xa4\xdf\xa3\xd6[r\xb0\x1b\x00\x871p\x1e\x0e\x97\x0b\xe6\xacL\xebn\xcaK\x88\
+\xa2\xd8\xdc\xe0T\xdf+j\x91c_W\x90L-\xd0#\x99}\x0b\x07\xbe\xf5-ZWM\xbd#@\x8f\
+Y\xee\xa5czWTFY6\xf6\xa1\xd1$\x14\xcb\xcbh\xe5\xcbOh\xf6\xc1\xf5\x9a\xf3\x03\
+\x97"\xd5\xe7\xb9o\x06}s\xcf/\xd65?\xbfk\xaa\xa8\\\xbf!2g\xf2{a\xb7\x82A\xef\
+K]\x8f\x86v;\xb464\xdcN\xe6t\x86W\xca%\xd6\xed\x0b\xae\xb0\x19\xf1\xfex\x0b\
+\xca[\xb9\x02>\x17\xa8\nf\x97\xf1K\x98\x1f\xfe\x0b\xde?K\xdb\x1b\x0c\xb4\x15\
+s\x0f\xe3!\xc9\xf9\xef\xad\x9a\x88\xdf\xedl\xb9\r\xf22p\x1b\xc3\x14*V\x01\
+\xd3!y\xc0\xf7\xad\xc8\xebc\x18\x01\x1cp\xee~\xa8\x90o\xa4\n\xbf\xa5\xb2\x9e\
+J\x1e\xdc\xd7\x9a\x8cf\xfb\xe0\x113\xe8\x0enQ}\xafH\x846\xc5w\x89P\xc6\xc5\
+\x8b\xf9Zj"!q\x89/;\x81\xe62\xa8Y:\xbc5\xf9 |\xdd`u\xe8\x9b\x9f\x9bC!\xf2\
+\x8c\x0f\xfc\x13\x7f\x05\xb1\x8f\x06\xa6\xe2&\xe6-\xf0F A\xabK\x088T\xae\xa1\
+\x7fX\xe6\xae\xe2\x04\x13\xc2\x94\x99l\xc2\x80\xc2\xc6\xee\xb5\x91\xef\r\xaa\
+h\xdf\xf4\x9e\x13\x82\x1d\x91\xf8Oq\x05\x05\x05\xe9\x18\xc2\xf0\xd8Hi\xf2-g\
+\xbe\x00\xcf\xad\x8e\xebb\xb9\xde}\x98\x89\xcf\xb3\t\xc2`1||b)\xee\x819(\xd8\
+B}\x84\x83\t\xe0\xfd\xa8\xb6\xc2\x9d\x06?\xd0\xb1(\x12\x01{\x06\xf3\x10\x99\
+\xc7\xca|6\xd1\xbap\xe0i5\x8bKK\xfa\xce\x95\x96S\xe5\x89=\x8ey\xf8\xe9.\xea\
+\xeb\xeb;_D\x15;\x0c\x99\xf3U\xe54\xad\x8a\x01\x10\x8d\xd9?\x1b\x8eU\xd0\xc7\
+\x19\xfd\xdbVm\x7f0 .MY\x92\x07\xee\\\xd6f\xc8\xf8q/\xdc\xaf\xd3\xee\x12\xef\
+fU\x08v\xe1\x80L\xa0u\x81\xee\x8a\x8c\x8cj*j\x0f\x02y\x02\xce\xad\\@\x96\xff\
+\xd4\xfa\x04\x08C\xa5\xf57\xe4\x90\xbd\xbd=?\xbf\xfbE\xa0X\xe5\x80\xef`\x9d\
+\xfbnk;\xd8\x06A2\xea>\x1fF\x15<44\xd4\xbe\xee\x86&\x90P;J\xd1\xba\xd5\x08m=\
+\xac\xaaNB\xf9\x12W\x8d\xa7\x08+Ak{\xcd\xc8@\x18(\x03\xa2\x05\xc9\xf4\x9a\
+\xe8\xc9\xc84e\xd6U\xbe}N\xd4(\xee^ww\xbf\x80F\x0c\xf1\xaa\x8d$a\x93-I\xc9e\
+\x13.\\W\x03\xd0)\x15\x8a\xa3\xa2W\xc5\xa9\xba\xa7\x0f\xf5O\xe6\xe5z\t\t2\
+\xd8\xa1%\x03\xc2\x8ep.\xdf:\xdcMe\x01\xa7\x11o\x00\x1f!\xb7\xb33\xe8\x10\
+\xfel\x9bVRT`\xdb\x13:u\x15U\x81\x9d\x0f\xd15Y\x86J\xbe6\x8e\xaf\xeb.6\xaaZ\
+\x04e\xa5fJ\x0c\x01\xaeV\xf7\x0c)GI\xbe\x8c\xa6\xc2\xe2)-\t\xc6L\xffW9\xc8\
+\x19l\xd6b\xf0!"\xe4\x05\xa6f:\xf4[=\xa3\xce\xe0\x03\x82\xb7\xa3\x8a\n:4\xa7\
+\x07\xcb\xe1\x12V\xe5\xbd\'I\x1d\xbb\x1aM!\xc0\x8a\x05\xb3a\xbf\xa5\x00\x93S\
+\xb0U\xb8\x1eJ\xc8\xdb6\x0eB\xdd\xda\x90\x97\x0bg\xa7@\x9a\x12{v\xfd\xc1C\
+\xd8:}rz\xf2# ==\x9d\x85\x04\xccz\xf7b\xb3\xce\t6\x991v\xf8\xe7@W}=\x86\xb5(\
+\xf0\xcf3&\xb1\xeb\xd5\xb6\r6U5]\x01\x0e\xcb\x85!\xac6\xed~\xf9\xdb\xed\x1d\
+\x1d\x88)\xae\x1e\xff\x9f\xf1*NQ\xbe\xc3x\xf8/p\x0c\xee7\x03\x06\xec\xd7\x87\
+\xcb\xcf)\xfa\x1a\xb4\x7fjxvVYQ\xb1\xabC[\x9f]\xe3\xf7~\n@w\xaeJ\xe5\xa0Y\
+\xc3Jm\x11\xe6\xac\xbc\xa1\xc7\xf1\xa6\xa1\xcf\xfd \x8e\xc1\x96#\xa9\xe6\'{\
+\xc9\xb4{\xa7A*4m\xd2\xd8\t\xe4\xe2\xbf\xa5\x95\xf8k\xa7g\xa8V\x9b\xdc\xa2]\
+\t]\xb9J\x11\xb1\xf93u\xc2\x12\x1eUL\xa2W\x9cC\xd2\xddH\x1f-\x05#S\xab\x9a\
+\x88\r\xee&\x85\xf5\x93\x15\xe8\x90n\x80\x152\x15-\x8d\x8d\xf3\x96#(\x89\xff\
+\xfb\x98\x96\xa6 f-\x97\xb0\xf8\xd5\x060\xc6\x96\xe6Hs\xb3\xf3AC\x82\x92\xb7\
+\x9e\xb7\x8c-I\xc1\xf9\x90\x8bDw\x82\xd8\x8f\x8f\xb7`\x80\x13D\x16:m\xac\xb5\
+\xcd\xcd\xcd-4-\xee\x03@ke\xffNY \xa7cd\xb4\xb5\xb2\xf2\xafD\x83nw[\x8e\xc4\
+\xf7\x8f[\xda5\x97\xcc\xd2nA\x14\x15\x15\rP\xac\xd2\x84dS\xa7s\xd9a%\r\xec\
+\xc1\x003\xe4c\xa07\xb0\x17\x80~\x87`\x84\xc4\x96\xa5mjn\xde\xf9\x96\xab\xea\
+\x0fQ(F\x96\xc7j\xf7\xe7\\\xecn \x00\x1e=\xaf\x1c\xeb\xa6b\xa5;*\xec\xe4\xe4\
+\x84\x8e\x9e\x1eh\x83\x07ja\xde\x98>~\xba[yQ\x0b\x04\xec\xe5Z\xb5mE\xc1\x1fo\
+P%\xad@\xba\xd4+\x824[_\\\xe4\xe4\xe0q\xdey\x82G\x08\x19\xa39\x0e\x9fB\x19\
+\xc9\x17\xdf\xf2D\xd8\x08#<q\x8a\x95\xbb\x0e\xc1HTt\xb0\xf1\xae\xb8\x1a\xbfR\
+\xfa\x8a\xe4\x8dE\x10\x87\x8e\xdec\xd1u\x8a\xcb8\xfc\x81:J\x8a\x80\x81M\x19\
+\xdcwx\x9b\xdf\xf72i\xefk\nH\xb8\x12\xa1\xf0\xf6\xad\x87\xca3\x05y\xea\xbc\
+\xb1\x1f\x90\xbb\x0e\xae\xdd\xa5\xa4m\xf1\xa3\x8b\x81\xb0\xf2\x98\xbdN\x1d\
+\x93\xe3\x9e\x9a\x12\xade\xb9\xce\x04\x05\x01\x88\xc8\xee\xf5\xb2M\xf3S\xab\
+\xfbBUv\x95grX+\xac\xecW\x8f\xa7)\x1c%\xc5\x91 \xd4Q\xe6\x81\xcahi\x19F\x96=\
+\x1b]\x18\x06\x9a\xfb\xdbH\xd9RR\xa6\xf7Fan`=\x1a\x9c\xd3R\xc3\xaf\xf3Be\xd2\
+\xeb\xf8Hc\xce\xd6V\x1a\xf4^W\x80\x02\x13\x13M,\xe3IFy\xfe\x8dj9%\xf0f@\x166\
+25\x11\x9f\x98\xe0\xb6\x1cz\x8a\xb0\x0c\xe3\xc0\xd1q\x01X\x9a-\x97.P\xb3\xcd\
+\x04K_\x10\xc2\x8d\x05\x82\x88G\xd8\xc2\xc2N\xcfe\xc3iE\x9c]\xcf\xff\xc2o\
+\xf2\xa7\xca\xdep\x93\xe7\x1c\x16\xab\xd3\xc0\x99\xd8\x07\xf0\x10\xa2kW\xfd\
+\xf9\xf8\xf0U\x86\x07k\x03b\xdcE\x9ad(\xc9\x1f|\xd2\xc4\xe5O2\xfa\x10\xbe\
+\x9c\x91\xcf^\x88a\xdf \x83\xd8\x96\xba\x7f73\x90G\x08\xd6,\x81\xd6\xdbt\xac\
+\nN\xba\xf5\'f\xe5\x90\x91W\x96"//-5\xb2Bn\xe1i\xc6\xc9\x98\x841\x81\x80F\
+\xf4\xf2\xe3[\xe4]\x91\x18\xd8\xc2c\x84\xff\xf1,\xcb\xc0J\xb3\xb9\x93\xdc\
+\xf3\x81=G\'\'\xfa?4\x9duX\x14\xef\xd7\xc6\xe9\xae\xa5A\xba\xbb\x05\xa4c\t\
+\x01i\x91\x92.\xa5C\xbasi\x90\x96\xee\x92FB\xba\xbb\xa4\xbb\xbb\xbb\xd9w\xbe\
+\xbf\xebz\x87\x7fXv\xd8y\xe2\x9c\xfb\xdc\x9f\xd9yf\xf0a\xb8\xa8M\xdcW\xbe\
+\x99\x14\x84{\xa1\xda\x83\xa0\xd0\xa7XC\xaf\xed\x01{\xa3\x8a\xff\xe2^Luur\
+\xb2sv\x05\x88\xe5\xd4\x17\xad\xf2?%%\x90s\xd1?\xba\x98%?\x19s\x017t\x93\x05\
+\x81\xb1\xaf`\xd6\x1e\xc1\x8ad\xc2\x85\xee0\x0e\xa0\xa3\xb9T\xf9\x9e\x7f\xce\
+0\xab\x86\xc7!)\x9d\xfd>\xfe\x18P|\xb5\xb2w&*\xab\rF"\xef\xa17\xf1\xc8F\xee\
+\x88R\xe1)\x12\xf5\xc7\xb03\xc3\x0fwm\xc2\xe4\x17\xff\xe3\xf1H\xdfi~\x08\rOa\
+\xd9\xd9p\x87\x14\xca_\xf6Q[\x07\xd3\x1f8\xa3\x9c"\xd3H\x1d=/\xd8cP\xdf\xbd4\
+\x07\xa4\xc0\x9em\xb5\x7f\xad\x84v\xdc\xde-\xe3\x17\x84H]\xa4\xd3o\xa5\x1eKI\
+\xf6\xa99\xe6\xd1\xf0\xc8\x9dG?\xc8<\x98\xf9\xdb\xc61&\xd2\x95~w#\x00\xe5\
+\x12\x11xy\xd9\xda\xda\x02\x9a\t\x1e\x01#\x10gW\xc4-\xca\x13Q\x06.d\x05\xbe\
+\xc8h\x9e0/(\xb2\xban\xc0E\xf6\xa5\xbd\xcc\xfb\xbd\n|\xcc\xedt\xc1\xdc|1\xea\
+\x0e\xaa\x03w\x8d[\xc1<h\x13\xc9\xcb\xcb\x12\x0f\xee`\xef+\xb2\xe5\xdd\xeb\
+\xd7n\x8d\x19f@\x15\xbd\xbeP.G\xb6\xd7;~~I\x10D\xee\xfdPw\xc3n+P\x95-\xe8\
+\x1bx<f\x10{\xbfXf\xb9\xe8WZ]\x8ds\xdd\x0b\x88\xb3b\x90\x12\xb2\xb9\xf7\x9b7\
+\x1b,\xfb\xbc\xae\xefE\x10\xf4aO\xa0C\x12\x0c\xbd\xbb\xf53\x7f?\x0c\xb0\xb0\
+\x80\xdf\x1dC#5\xad&X7\x80\t\xc6b,\xaa \x94\x0e\xac=\xae}\xebO!c e\xf1\x1e\
+\xb5\x1e\xa5\x95\x9e\xee\x17z\xee?\x0e\xd1\x89\xa8P\x0e\xca\x97\xe2\xddQ(\
+\xce\x01=\xdd\x1bQ\x97\x12\xf7\x9d\xd1\xef\xc0\xf5\x11X:#\xeax\xce^%\x8a\xe0\
+]\x0csjUK16\xf1\xb7A\xc3>B\x18\xa6\x93\xebk\xed\xf7\x8e\x9a\xadF\xf9\x07p\
+\x12YC\x0e\x12K\x1b\xef\x15\x14\xc1\xef\xfb8\xbb\xe1\x9b\xce\x00\xcb\x1e(\
+\xb5\x7f\xeb\x89M.\x86P\xc72*\xb4\xf1\xef\xb7M8\x15\x8a\x10\xd9\x83\x10\x8dT\
+)\xdcK\xdd\xc0p\xdf\x95\r\xd8\xbf\xe7\x9ef\x02\x16w\xe9\x9c\xbb\x8d9u\xe1\
+\xba[N\x12\r\x8f\x98d\xe3tS\x84\xca\x05;-\xf8\xb7Z\xf3\rC\x91\x9c%3%\xc5\xb0\
+\x17\xa5G\xda\xdb\x96\xe3\xde\x97b\xee\xb6\x9a\x7f\x01aAR\xf0p\xd1\x95\x95\
+\x95\xdb\x03\xb1\xd2\x03I\xdf\xd0;QT\'\x06\x14\xa2\xdf\xd7\x1c\xaa\'\x0c\xd9\
+<=\xcdw`}@\xdd\x8bu\x92\x89C\xc0\xcf\xe8S\x8c\x12\x88\x9eE.\x0bX\xdbnt\xbe\
+\xcc\x0eT\xbe\xa0\x9b\xd1\xb9\xf8\xa0x+N\xf2\x11\x04\x02\x83\xeeh\x8d[v\x0b6\
+j\xe25\x07yGH(\xc9\xa1\xf9l\xe1q\xf6\xcc\x05\xcc\xea\x9c}\xfe\x11\x81f\xb0\
+\x9d\xf2\xd5\x93\x0c4\xfa\xd8t\x13?\xd5\x03\xf7\x90\x03-\xb9\x0cF\x19x5\xcc/\
+\r]418\x86x\x18\xc5;\x88 B=\xcf\n\x85\xb8}\x8f\xc0\xd8\x03\x80e\xf07q\x0f\
+\xd8\xf6\xf7\xff\x0b]\xfa\x108\x19w\xc7#u.\'\x03\xa1ju\x7f\xd8\x18%\\\x14\
+\x92\x0b\xde\xd1G\x1c\xb8\x95\xa9\x94\xd8@\xfa\xf0\xb4\x8f\xe0\xef\x7fH\x1b\
+\xa6\xb70zo\xf0\xbe0I\xd7\x05T\xf4::I\r\xc7\xb5\x0ey\xb5\x19`\x91q=r\xebQ1u\
+\xe3kf5R#\x10\xe8\xe2\xb68\x16\xaa\xfe\xbe\xb8\xb6C\x12\xb0\xb3\xfa\xf6\x82(\
+53BF{\x07\x9a\xcc\x08G1\xbb\x00\xbc~\xf9\xac\xae\x9a\x1al%>g\xe4/\x97h\xe7\
+\x15\xd4\x0b8\xda\x0f\x1f\x16\x81\xb0\xe15\xac\xcf-\x01b\xa8\x14\xef\xdf\x1b\
+PO4)KB\xb7p\xce\xa4?2\x1f\xdez\xe6\xc8\x13\x03\xd8\xa17<\xac\xba\xc1\x95>\
+\xda\xdc\xdc\xec])e\xe4\x81\xeb\xcf\xe5H\xbdq-\xdb\xf5\x8bR\xdc\x1e\x94\xd8!\
+=\xfc\xd6\xdav\x8d\x80\xdf\xf7\xc0\xfd\xc6#\xb3\x11\x9b\x05\x95\xeb\xb8\xb5\
+\x15\xd9@\x94m\xfd*%\x84\xf3\x90\xb2\xf1\x91\xcf~\xc1\x86\x1f\xb0+I\xd6g\x9d\
+\x01Q\xb1\xea\xa5\xc1\x17\xe8K\x9a\xd5\xafN\xca1\xcf\xe9\x8aOL\xc5\x01/\xc8\
+\xea\xa7\xd9\xcb\xc9\xb9\xca\xe2\xc7\xae\x1f\x7f\x06\x97Q\xd4\x825\xa7\x00\
+\xe8\x98\x9e\x9c\xf4O\xa3\xe2\xcf\xdb\xb0C*\x05\x05\xea7\x05S\xbb(\x17\xc4\
+\xe3\xff\x8e6.\x94\x9b\xc3\xecf\x0b\x9b\x04\x8aNt\xf8\xd0\xc7\xa2?\xceJ\xa9\
+\x99\t>\'\xcf\x03`\xba\xa8\xfdw\x16 ?"e\xf4N\x99\r\xac\x04\x8d\x84\x85\x14`\
+\xbe\xddZ\xbe\xa2\x85$fgWi\xb2\x08\x0b\x0b?\x0605D\x9b\xf8~\xfb\xc6\xecO\xec\
+Y\xcf\x04\xa3U\xf8\x00\xefh\x1aN\xf6\x1ec\xe3\xb1\x84k\xd3\xd5\xac\x84\xf2G\
+\x17\xe7\xec\x8c\xb7z\xdeL,90\x94V\xc1z\x15s\xa6\xeb\xe2s\x8b\x8bC_\xa0\xc3\
+\xc8)\x99\xdb\xe3\xeboon\xd1\xd1\xd1\x83e\x11\x11\x119\xdc\xeb\xcb\xcbz\x1az\
+A>\x04\xb3-\x07\xf1\xc4\x9d\xb0\x82\x9b0\xa4\xd6\xdf\xadc\xbc7\xff{\x94\xbc|\
+4\xd5#m"L!&\xbb\x84\xa0\xb8 R\x85\xf2;\xa7\xc7\xda \x1e\x0f\xf0\xcd4\x1e#\
+\xa4\xa4\xbc<2\xe0\xb3nmw\xa8\xcd\x15u\x90\x1e{/\xa3tCXC\xfa\xfc\xa1\xda\x82\
+\xfd\xe1\xdf\x8bM\xd3\xe67J\x93\x0cN_\xbc\x91\xd8x\x89e8\xa1\x10qcx\xf0\xc1\
+\xec\xaam\xf78\x86\xf2\xd9\xe4\x85\x83d@\x8c\x17\x17\x1f)&\xd17X7ZL\nR\n\xc2\
+\xd9s\x0f<k[[LfOx\xf1|*\xdd\x98\x00\x1a\x1a\x8d\xd7\xdfZ\xe5\xd3\x87t\x8c\
+\x1e\xa2\x06\x0e}\xcc(\xcd\xf0_\xe1e\xc80)L&\xc7\x89\x8c\xbeej\xb1=V\xdfm6\
+\xd7Y\x02\x04J\x80\xc6,\xcc\xd8\xd2\xd1\xb1\xbe\xe9\x00#\xadU>+\x7f-B\x81-\
+\x81\xf3B\xe8\x0f\xca\xe1\xcd\xf5\r\xc7A\x85\x16S\x1d\xd7\xd4\xd4\x80\xae\
+\xc9\x1c\xdc,d\x91\xce\x14\xa3e\x83|(\x8aI\x9d)\xf8[$\x1a4\x82\x86\xef\xaa\
+\xab:\x1b\xecI\xaa\x8d\xfe\xe06\xd37\xb95\xd3\x10\xe0\x8e\xf2\xc21\xf2\xef\
+\xbc~\xca\xf7\xc1\xad\xf5\xa9P\xd6\xd3\xd5]\x02\xca\t\xef{\x1a\x05\x05\xa5\
+\x0f/!=\x0b\xc9\x06O\xc3\x8a\x98\x98\x98@\xd1)///j\xd8\xeb\xbd\xc43:\xcc\x95\
+\x8d<c^\xa8\xe7\xe3\xe7\x87\xf3\x8a\x88\x89`fc\x03\x8a\xc5kB6\x19#M/\x08\\\
+\xef5a7\xe2/\xa3\xce\xc4\xc0\xc0\x18@\xbeQ\xbb\xa5H"\x87\x83<?\x88\xa3\x93\
+\xe3\xd4\xd5\xe23\xf2\x87\x10&\x0eR@\x91\xbe5\xb5\x8d\xf0>eo\x9e\xfa\x1c7\
+\x92\x96\xd2\x9a\xe0\xed\xe0\xc5\xafW,\x10\xd7\xfa\x93-&\xc7\xb5\xe9\x07$q\
+\xbfg[\x1a)\xa1\xdetb\\\xdeI^\xc8\xc1Lic5A$5\xab\xe7\xc3\x1c\xfeo\xc4d\x862\
+\x8d<S\xec>?W7\xc9.\xec9\xac\x93\xb5\x9e\xdf\xed@\x8d\xb7\x83n\x80\xb1\xfcd\
+\x1c\xb3 \xc4\x8eF\xec\xaa\xfe\x0e\xe0\xe0\tp\x1d\x8e\x8b\x02\xa8\xbf\x0e\
+\x97\x01\xb1\xc6\xa5~`\x83qc\x80\xa7{4\x9e\x1f\xeb\xed\xf0\xcav\x85\xa4\xdf\
+\\\xc4\x88DP\xc4\x08\xb9\x04\x9d\x06:\x10AK:\xb3\xa1\x0c\xa7?`+u\x04~\xff\
+\xe4\'(\t\xff2\xf2\x8d.t\x01/\xf0k}G\x07e\xa6s}o{x0\x07\xa7.\xeeg\x1e}\xa8\
+\xc0\xea\x91t\x7f\x9aa\xa6\xef\xeerU\x8eZ`>\x7f\xb0\x11\x15\xed\xe7\xd3J)\
+\x8c\t\xd1_\x9d\x1a\x00\x99\x02\x9a\x87\xd7@B\x03\x87\xe0/\xe8\xf7\xdf"\xdfv\
+\xefDTr\x95\x14{\xe1\xbbWS\xa08\xe0\x10\xe7i{\xdd,\xcb\x81\x9a\x8c\xdf\xc1\
+\x0c\xc476\x16\xba0d\x0c%[\xb3\x97\xd4\xe5\xa1\xfe\n$ Y\x917IK\x1e0\xad\x11u\
+\x04h4\xdf\x00\r\xe7\xa5b\xcb\x0f7Y(F\xe0B\x85\xfbhC\xa9\xc8]z\xa8\x0f\x9d\
+\xa8F\xceC\x84\xe27\x8a (\xe7\x98k)\xf8a\xd1\x86\x87V\xc7\xfcf\xc4\x86\xc744\
+(\xb8\xc7$\xbd\xa9\xd2\xe8\xdc\x9f.hia\xf2\x82\xcb\xf9*\x8e\xcd\xa8!rfC\xa7\
+\x91\xb5\xa4[\xca\x04>cb\xbf\xcf\xb7\\\x93%-\xbc\x17-\r\\0e\xe5\xa0\xb8YsY\
+\x04\xba\xa0\xb8\x1e}p\xbe \xf5w\xd0\x17\xca\xdb\x10\xea\xe6\xe2!D\xe7.\xca\
+\xa1j!\x84\xc0w\x84\x1e\xe3\xbbcN?\x18\x93\x05c\x9b\xc9\x13Dg\x0f\r\r\x11q\
+\xea\xaf\xd48\x87-\xe4\x0f\x8d\xea`1\x80\xe2C\x8d\x04\x06\xe1j\x9dk\xa5=\x07\
+\xdd\xc75\xb8n\x9f\x97\x0b\xef\xa9\xe1\rW\x17\x16P\x0e\xcd\xf6\xc4L\xae\xce\
+\xd7\xea\xd2GH\xe4\xda\x1d\x10D\xa7\x16t\xbf[[\x87\x97\xfc\xf9C\xf0\x0e\xb5\
+\x89Q\xfb\xa6\x1c[\xb3\xe3\xb1N\x00\x90\x87X\x1f(\xb1\xbf\x04\x1aOf\xb8\x95\
+\x95\x03\x8a*\\O\x0f \x7f\xd0\xb7\xa3rAE\x94%\xeeG\x19Z\x91\x9a\x87\xd8!\xbf\
+\xa31\x8d0,J\x13;N\x86#@\xb6\xe1h<lF;\xeaSqk9\x82g6\xfa\\%\xd0\xce\x86)\xdd\
+\x08\x1e\x0e\x1e\xb1\xf3\xe85\x84\xfb\xe6X\xe3\x87 \\\xb5\xbb\xba\x91\x00i{\
+\x8d\xfcw\xef\xae\xed\xcb/\x8e\xd6\xdd\xa1\xb2`\x1ce$\x8a\xf1a<\x8aX\xe4}\
+\x10\x0c\xb6\xebs\xa17\xecM\'d\xa2\xbaL`\xb8\x81\x1a\x17\x1e\xe6\xdaG\x8c\
+\xf3\xafO\x1f\xf6N\x9a\x1289\x17\xb6\xe6:V1<5ce1\x02Y\x1b\xc5\x08\x8e\xbe\
+\xf2\xf2\xbf\xf3BZd\xad)\x81\xaf\xe2+2Ak\xd84\xb5\xba\x15($\x82\xf4\xb0\xd9\
+\xbf \x9d\xba\xb0\n\xb1M\xf0\x87?\x87l\xba\xa3\xc7\xc54\x8c\xc8.U\xfc\xf1\
+\x11Du+\x89\xa8\xd3\x07\xd0\xea\xcd\xd0\t\xedMb1\xc5+\xdf\xc2\xe0\xfd\xde\
+\x94\x1f\xe9\x90/\x10\xb9\xa1<|\xef\x1c\x14\xab;a\x19?\x91i\xabq\xed  \x9bY9\
+@\xdc\xf0\xf1\x1d\'\xb2;r\xe6\x8fc}\x9f\x0f\x86\x12\x18\xe3C\x1c\xad\'\xc3\
+\xb7\x19a\x0eY\x93\x14N.\x80jA\x86\x85\\\x8f\xe1\xb0Ld\xcf\x84\xca\\\xed\xfc\
+\x05\xfb\ru^\x82\xa6[a\x98\x0b\x8d\xc6\xef\x82\x99x\x9fHE\x18z1PY\x11\xd5\
+\x07\xf9E\x89\x9fq\xba\xf2Rg\xba\x1f\x13+\x0cM\xf9\x0c%\x82\x7f+\xdc\xc9\x8e\
+\x0b\xec\rs@0B\x1fbgZ\xf1\x0e\xed\xe0A$\xbf\xa6|\xc7#er\xd3\x08Y\x14#\xfa\
+\xc7]\x9a\xec\xb9d\xbc\x07\xcf\xab\xf7\xd7\xa1Z\x98\n\x8e\xb7\xc6R9\x11\x1b6\
+\xa73\x11\xdc\x8b\xbfb4\x92A\x89\xd6O.A\x7f)a\x86\xc9u\x8d\x7f@\x9er\xdc\xa9\
+e4\xce\x89x\x08\xc3\x96\xef\x8f\x83\xafG\xe6\xc0\xbc\xf1y\x94\x8dk\x8d\x8f\
+\xe2\xf5n\xaa\xf0\xb5Z\x91\xfa\xb5\xf0K\\\xe0\xb5\xe1\xc9;\xeb\x16\x8f\xd7\
+\x83\x11\xb9\xf0\x83\x85\xfbX\xea\x93\x17\xf4\xbf\xc3o\xbf\x020vw\x86\x12\
+\xf4)\x8d\xfd\xe1[\xa3D\xbd\xeer\x94z\x94\xd0\xf0\xf5\xe3\xe4\xc5\xdc.<h\xa4\
+r\x91\x9dN\x06\xf7\x9b\xed\xd9\x85y\x19yY\xf1\x0cr\xf0\x11t:\x97\x04\x019\
+\x03\xe2\xb3\xaa\xe3N\xc8\x9b0\x82\x1f\xdfx_N,\x12\t\r&\x82r\xa8\x9e\xe8\x92\
+G5\x9di0*\xf87\x8a\x13N<b5\x1f\x08O\xee\x08\xf7xl\xa0\xdf*\xfb\xe5M\x05\xaeu\
+\xa0\x81\xf2\x90\xf9\x90\x1a/\xcb\xcfA~\xe0\xa7\xfc\x11\xc2Y\xb48\xf7MD\x8e?\
+\xc4A\x80V\xb8SV\xf4\xd8\x95Z\x80!/\xf8\xc1=\xf4\xb2\x06[[\xae\x15\x7f\xe7T\
+\xd5\xed\x80\x1b\x1d\x17\xe6\xf2\xd2\xf1R\xa4\xb0\xd9\x03\xc4\xa9\xa7Q\xcd_\
+\xf0\x0c\xb1\xfd\x10_\xe0\x00k2w\xfa+5\x11<$\xd1\x9e\xcd&\r\x9f\x97\xc6\x88\
+\x98\xee-\x83\x8c\x95\xa9\x15\xa6\x1aR\x87\xfa\x82\xf7\xaa\xd9\x14\x849\x86\
+\xf4#\x8f\xf4\x00\x1fi\\\xcf\xc9\x89\xa7\xba\xe4$\xc3fe\x0c\xb0I\xf1l\x07\
+\xb7O\xc0\x0b\xc7\x86\xfc\xe1\xce\x9f\x04t\xfe\xea\xd4\xc5\x10\x01?6J\x00OW\
+\x0c6\xea7X\xea0\xcf\xa0i\xa9\x94\xcbb?\x1d\x04#[\xe7/\x0c\x96\xa3\x8f%\xccZ\
+\r\xce\xb3D\xbd\xfc\xf7\x15\xd1\x10=K\xa6\xa2 T(&\n\xf2\x0f\xb1d\x1f\xb6\x1c\
+\x04s\xde\xc0\x92\xfb\xd8F*\x1d\xee\xfb\xfb\x00\xa1\xb4\xb8\x9e\xe2\xa3\xd3T\
+TTx\xb3\xe6q\x8f\xda\xf0d\x0b{\x11rY\xfa\xfa\xfaJK\x079\xafx\\Y2\x8a;\x91\
+\x9bq\xc0d\xbb\xda\xd80\x15.\xdb\xf0W(\x8f8Z\xdf\xe5cj*\xa2w.v\xedQ\x12v\x83\
+L\x03:p!\x8f\xc4o\xebQ\x12"\x84w(:m\x82_\x02~f\xa3\xbcwd\tP\x1d\xe31\xea\xaa\
+\xc8HN\xbeS\xc5`\xb4:Q\x04\xcf\x81X\x05\xebZgM\xdf\xac\xf8~\x01\xeead\x12F+X\
+|\xffk\xe4\x9d\xd9\xe8fa\x84\xb4?F\x92\x02\xfd\x1eW\x16\xbe\x0fy\xab\x01\xe7\
+\x1e\xfb\\L\xe1\xae\xac\xcb\xdeV\xa5\x14#\x1b\x13\xbdA\xec<\x0f\x1f\x153>\
+\xea\xe5%\x98T*\xd9\x06L\xf7\xff\xd7\x02\xc8\xfd\x92\xeabsi\xef\x90\x86\xc9\
+\x05\x00\xd9\xa1\x98\xe5\x86\xee\xc1\x1b\x17TM\xcf\xf6\xcb\x9db*A\x1b\xe2\
+\xf9\xfag\xbe\xd9:\xf5\x90[\x91\xbd\xf0C\xc1NtH\xd5\xf6\x97\x8e\xab\xf7\xbe\
+\xdc\x02\xc9\xec\xa2\x8d\xd9\'\xc45\xb1/7\xbd\xa8f\xdb4\xe7\xc4u}\x80\xa2\nr\
+\xb2\xb1\x898\xbe\xf4>^\x13a\x91{\x82\x96\x1c\xb4\x85.\xfd!\x18cHJ66\xcd\x83\
+w\x91\xfc\xf8\xb9\xf1\xb00,\x0c\xd0\x8e\x8e\xa7\xa3\xff\xd6\xe8\x8e\x1e\xf2\
+\xca\xbc\x8b\xb8\xba\xbe\x8eW\xa0cd\xb4\xfe\xa1\x9b\xb0\x18\x8c\xb6\xbeW\xcc\
+\x0f\x0ci\xc3\x9f?\xb7@\\\xdf\xde\xddi}\xfe|Y\x8a\xe3\xb6\x1d\x17WV^\x8e\xae\
+\xf7\xaa\xa2\x92!\x11\x18\xaaG\x1e\xb7\t\xe8\x98\xa7\xa8\xc1\xd4G\xfa`\x1d<\
+\x9e\xd8\x87\x00\xedx\xf3\x93\xd0`\x84SNm\xf4\xe4\xf7\xd0>\xe9\xcdez\x04Q\
+\xc2H\xc2\x03vtc\xc1\x088{\x8a\xd8} 9V\xb4\xd5utP\x93\xd1\x85e\xd3?Y\xb8\x8e\
+tU`\xf0d\x0f\xd9\x04n\x8a\xf8K\xd0H\x950(\xd8]m4\x91\xa7\x8b7\x84\xecc\x89a\
+\xaf\xa1\xbc\xb4\xb6\x19T\t\xa9e\x96\x8e\x82/\xb1\xbf\xfa/\x1c\x01/\xcd\xad`\
+\x14\x18\xe3&7\xb7\xc8\xc2\xee\x1f\xfe\xcd\xfb\xde\xe8\xfa|\xf5\xb1\xb4,6\
+\xa8\n\xf3/\x10R\xc3t\xbb\x88\x93\x86+\x88\xa5D\x7f\x1c\xae\xac\xe4\xe8_\xdb\
+\xd0\x94\xee\xfa\xdb\xa6\x9d,\x07\xf7?\xab|\x91\xc5DJ\xbb\x169\xa1%\xfa<[\
+\xe5C`\x18\xa0>\r\x08,\xe8{\xb8\xe8\xd1\r\xd3\x1f\xc2l\x7f\x9f\xb7\xd1*eh\
+\x05\xaa7\xf56\xf0\x8b\xf4.h\x01Y\x9dz\xc5\x9e\xac{\x83D\xe9\r\xc8$\x04\xf0\
+\xb8\xe3~\xda\xb4\xe5\x7f\x0e\xc4\xb3\xed\xed\xbf\x93\x91`\x95\n\xad/ZZ\n?o\
+\x0cz\xbc\x08\x96Y\xb1\xfc6\x1d\xa4\xa5\xe1\x95K\xe5\xf9;\xbes\xbd\\\x84\x89\
+g\xfch9s]\x7f\x9c\xa0|\xf3C\xa1\xabs\xae\xad\xd0:\xfe\xbdl\xceGZ\x93#\x989\
+\xfe\xef\x9f\xfa\xca?\x08b\'\xc4\xbcT\xeaw\xf1\xe8^5\x86vu\xc4\xe9Z\xdd\xf3,\
+\xf4\xdeK\xf1q|R\x12\xec\xd2\xc9\xb4`:\xf4#\x96|\xcb\x8eE\x0c*\xd0\x0b\x95)I\
+\x08\xdc\xf4\xd7v\xc2\xf8 v\xf2\x8d\xc6d\xf4\x980!O\x1b\\\xb8\xab\x8bN\\$\
+\x98\x8b\xadw\x10\x16\x16\x8e\x92\xc9\xcbP\x87jf\xc3P)\xbd\x8a:g\x94\xe7]-\
+\x18W\xb9\xfd\xde\xe19\xfdG\x0b\xee\xd6\xf6{RLbX+\xc28:\xd4Fr\x85\xa0\xce\
+\x08\x7ft\xaa\xb3\xc1\xf1QI\xa6\x83[O\xb7\xd3\xa5pBY\xad\x13\xf5\xf2Y&t"BB\
+\xfe\xaf\x9e\xa9E\x81\x86\x10\xa2\x0cA_\xb8#\xa2\x1b\xab\xc2\x8a\x9a\x9a\xf8\
+:\n\\\x1b\xac\xf8G\xdaj\xcb#w@\t\x9a\xe0\x17\x86\x02(\x02\xf4\xe0\x82\x1fo);\
+\xfa\xd7!\x96`+$|\x18\xeeI\x9c\x14\'1S\x88.\xe8\x9as\xbf\xf2\x01\x8c\xd4\xf0\
+\n\x10\x84\xfcO\x84\\\x83\xf4\xb1P\xdepL2gTsq\x1c\xfb\xf6\x97\xdd%\xe0\r\xe0\
+\x08y\xb5\xb5\xb5V\xd2S@,\xaf\xbd,\xa6\xcbu\xf8\xe0\x07r\x08U\x8c\x9b\xf1\
+\xb7]\x9d~)\xc3\xd6\xfcBY\xe2*\x94Y\r\xd3\xbb\x93Bw\xd8\x1c41?;\xabS1\x07\
+\xcc\xf6Y\xf5\xd2\xcb\xcc^\x1c_uI\t\x8ah\x15\x95\x7f mo1\xfa\xf1\xe1\x99h\
+\x8bG\xd2N\x02*H\xcc\xb3\xfe\xf3G2\xed\x81\xb4\xaf,R\xaf\xa9p\x94\xe3\xe8yr]\
+\x1d\x1dN\xde\xado\x94\x9e\x89w=\xe5\xb5M\xd9\x93\xb86:\x08(]\\\x9b\xd9]&\
+\x0c\xeeH\xe9\x9d=i\xa5\xaa0\xdd\xb0\xd2A\xd4|\xbd(9]\x11\x99p`\xbecW\xc9P\
+\x94\xc3WuS\x11\xb4\xbd\x1d|3\x92@\x86\xd4\xcc\xb4\x1e\x1e:\x14\xe9\x8d\xc60\
+\x99`X)#\xc5V\t\xff\xb7\xe8\xcfd\xc4\x04\x8d\xeba|\xf6\x17\xe7\xbb\t\xf0\xc4\
+i\x81\xfa\xa8\xaa75(\xb5*\x14w\x1e{\xfb\xaf\xcd\xe3\xe8\xc9]8\x973q\xe3\xd0]\
+\xba\x08?\x1d\xd8\xc3*\x12\xa3[\xe2_\x98\x93b\x85Tv4\x1fq%\xc6\xca\x91zX\xd7\
+}CNQ\xa7\xe2\xfb\xe0\xf0\xe2\xce^\x96:\xbc1\x89\xb0B3p\xf4;-bD\xba7\x1d\xfc{\
+\xca\xb5\xca;\x9e\xfeT\xd91\xb3z]\x86\x101\x95\xdca\xa2u\xfe\xb1f\x07<\xcf\
+\xe8\xd8XH\xb0$\x10\x8b\x84\x8e7e\x05\x85\x85!\xd5\xef\xa0\xbf\x9c\x11\xc9\
+\xd8\x0b\x10\x1f\xa4-\x9e\xb3\xbd\xba\x18\xbb\xbb\xb5\xcf^\x88";i\x96c\x91\
+\xbf\xa4?\x92\x04\xff\xde\x9a\x0b[=1\xbe\xf7\xbdp%:\xff\xc2\x01+1\x08k\xeb\
+\xaa\xb8|\xbe\xe1\x95?e\xe5{9>\xc1-\xa3\x06\x0b\xc7\t\xc3)\xcb\xf4\xb0\x7f\
+\xe1\xf7\x9f\'\x9747.\r\xdc\x00D\x9c\n\xd4v#\x82o\xcfV\xba`\x10\xe0\x8a\xb4a\
+\xb6\x90(\xb1\xbaO\xe5\xf0MJ[[\x1b\xf2\xee\xd7\x177;\xd2\\\xaa\xb9\xa6\xfa\
+\xaav R5;\x01[%\xfe\xd3h\x84k,\xdb\xf4\xfc\xc5\x90\xc7\x9d\xf6\xf1\xbf\xdeuc\
+\xe2k\xba\xc6\'\xe2jy\xe38A\x0e\xae\xb3\x9fE\x9e\xc8\xb7\xb6\xb7\x0c\x81\x84\
+\xc3\xb9\x0b\r\xad]4{;\x9aoW\xf8o\x81\x92\xea\x83\xc4\x1f\xec\x15\xb9\x1cxpp\
+\xe1\x0b\xe0\x99\x8d\x10\xe0\xaf\x85\xef\xdaL\xc1.\x80q\xcd\xc5\xd7\x028\xab\
+l \x9eV\xce\x01Q-\x88*\x0f\xc0\xb2\xbb\xf0b)m8\x9c.\x8f\xb6\xb5\xb99\xad\x18\
+\x92\x14\xd912\xf8\x9f\xd5U\x93\x8c|\xd0\x94c\xa8\xf3\xac\x11\x0e\xb9\xfc\
+\xc6\xf5\xc0\x9e8\xbe\x0b\xadN"\xa8%\xb1\xc2\xa0\xcds\xbb\xe8S\xb5\x99\x82\
+\xca\xc7\xc6E\xdb1?\xab\xfe\xafY\xe9\xe9-\xc6\xdb\xa1\x0b\x0b\xdawR\xcc\xde\
+\xb5\\\xfc\xfc\x00/\x9d-^\xdfOkh\xd8\xda\x9e\x82\xe9>\xfe\\?\x8f\x85\xb8\xd3\
+\xa8\x93$%\xc5\x13\xe0\x91\xe3\xe1\x91\xc33\x8a\x90T\x10SP\x84"[Xh\x15\xad\
+\x9euj\x9dg\x10\xbb)G\x01\xc21,\xbf\xe7:\xe1\xb3\xc7\x9b\xad\xfc\xf1\x93\x1a\
+K\x92\x86\xc6t\x9e\x1f\x05FH\xcf\xee\xa6"\xb4\xde\xe3Z\xe3\xa2md|4\x1c\xe2n\
+\xb2\x1b\x91\xb4e8\xad>\xedv\xbe\x98\x99\x944;=\xbd}\xfdxuu\xe5z\xb6\x94\x96\
+\x90\x10\x84>\xfd\x12\xb67S\xaf\xd9\xb8lKR\xdd\xdb\xdf_TT\xd4\xbcz\x064\xb2|\
+\x96\x94\x88\x88\x88\xb0\xc1i\xec\xd7\x1f\x96\xcfJ\xd7\x94\xbf\xc6,\xae\'\'\
+\'\xff[s\t\xfc{7#\xba\xb3\x93s\xbd\xd0)\xe4G\xafI\x8d\xd5\x0f\xdd\x11\xff\
+\xbe\x19[\xd2\x9a\x18\x17WW\x06::\xa6\xa4a\xcb,\x0f\x06ZZx\xac\xb8jS=!#\xc4\
+\xe2\x08\x8d\x9a\xf7xl4\xe2\x95\x8c/\xeb.F\xb4\x8f\xe7no@\xad\xad\xd2iAZKg\
+\xfdRY\x1f\x1d\xa5\xac\xa4\xccB\xff\xb1Ts\xb8\x87\xb6\xfd2\xda\x1eh\r\x85\
+\xcfc\x89u\xff\x7f\x8b\xaeKKK\xf1\xf0\xf0\x0e\x7f\xdd\x9cd\x9c\x1c\x96\xa6m\
+\x1a\x1f\xb7\xfb<W\xea\xb7\xff[Z\xfa\xce\x93\xee9*\xbaill\x90mob\xd2\xfd~\
+\xbb\xac\xacL\xbdT3D\x85pog\xa7u\xfd\xa1}d\xd7\xf3bC\xd2\xd1\xb1F\x89\xc1\
+\xebU\xae\xea\xeb{\xfdg\xf5\xb1\x94\r\xbb\x9b\x93\xba\x89\xf1\xd1Q\xa3+lL,L\
+\x0c\x8c\x95\xf6\x1f\xcfo\xaf\x12\x86\x86\xeb\xb1\x06\xd0x\xf5\xd2\x97^F\xf1\
+\xdf\xf5\x90A!\x91\x8c\xc4D|"\xa2\xf9\xa9\xa9\xa9\xf5\xf9\xf5\xe9\xe9\xfc\
+\xd9\xef\xc6\x0e\x84\x04\x04\xabks\x84$$\xa8\x86TY\x0c\xdas\xe8Z\x15\xa1\xf4\
+\xeb\x8cN:)\x91\xd0\xf0\x19\x10.L1\x0e\x93\xd4N\xc4\x85ko\xf9\xbcz<\xede\x0f\
+\x89\x86\xe4\xd8\xded.QW\xa5\xa4Gr`)O\x9ec\x9c\xa5Nx4\xc1\xd5e\xc0\xe3\xff6\
+\t\xc7E\xed_\xe9XS\xe8\x10\x0e\x98?\xba\x15\x1f\xe7\xf1m\x17\xa4\xbb:)\xc0\
+\xb44\x81o\x94\xae\xd8\xdelw8\xff}Ie\xb6\x86\xf2\x16\x8c\x82\xb9\xf2V\xe8\
+\xe5\x0e\xc0?.\x02\xdb\xf5\xe0NxI^\x9e\xd4\x0b\x02\r \xbe\x93\xccT4U\xf3\x91\
+\x81\x10\xdd\nWA\xb2u\x8f]\x82\xe0a\xc0i}\x08\xd4\xfe\x0b\x0fq_\xe3\xe1<\x83\
+\xd6\x04\x0c\x19\x1a~\xf1;\x9a\xd1c\x9a\xca\xf4\xbc\xc6o\xb0\xce\xf8\xee\xdf\
+\xf2\xe7\xcf\x1f\xc0b\xb7_\x0f\xb3R\x19\xc2\xc2\xf9\x13\xbe3k\xb5\xe5\x7f\
+\x07\xb9\xb1\x15\xa8\xac\xca\xfdsp\x11v\x12\xa8\x9e\x16\xc0\xc0\x84\x0f\xdaL\
+\xc2Rs%\xebYhj\xdb\xd5U\xd4\xd5%\x95\xea\xfe\xb5D:\xe2\x8f\xb8d\x0b\x1c\xc8\
+\x96\x7fY\xc5\xd7I\x84\x97v\xfb\x82\x08\x8bw\xe8<\xe1isel\xe8\xd3p\xd3\xe4\
+\x86\xa33\x05\xa6\x00\x88\x83\xd2\x04vk\x9c\xd5\x93o\xf8\x8d5\xdf\x7fw\xdc\
+\xaf\xe6\x1dj0\x8e\x1d4gc\x95\xf0\x1f"\x18\x8e<"\x05\x9b\x83&\xe2/\x8c\xfen\
+\xa0\xaep\xd8\xe5\xc6D\x9d\x85\x98U3\xd3\x04W\xda\xba\xfb\xb4\x15\x1f\xe9\
+\xf6\xf6\x16\xde\xd6v<\x11\x0e\xe8\xd7\x9a\xc5*\xc7N\x02it\xe8\xbbo\xad\x14U\
+?z#\x08\xf3\x81z\xab\xf5\xd6\x17LFJ\x11jR%E\xbdz\xda\x9e\xc0\x97\xa6\xae\x9a\
+\xf3<\x07\xf5$1\xb9B\xb9\x02\xa0\x15_\x8d\xc6\x17=\xcc\xb2sG\xaf\xf2O0\xdd\
+\xd1\xe0~\x80\xe1U\xc2h\x81\x99\x08bZ\x87A\x15\xb2U\xec\xf10\xa6\xb8\xd5\xa1\
+\xa44\x02\x1fK\xa7\xc2\xc2\x1fkF/en\t&\x8aN\xa8(3\xcc^\'P\xfdU2=\xd1q0\x9c\
+\x9e\x87J?JT\xe3\xf3\x99/\xb4Y\xde7\xd7Yb\x8eA\xfd\xbc\xd6)\x08n}\x8a\xa04\
+\x82s$\xc4\x12\x99\x82\xa3\x9f\x8c\xc1q\x8aR0\xcdL3\x08\x9c\xdc\xa2\xb0\xff\
+\xe4\xbf\xb8\t|N \x9b L\x9f99\x8f\x15\xad\xe0>=\x9f\xffdc\xfa\x8b\xe2\x93\
+\xfaP\xf8;\x8d\xba\x1f\xf9z\xd3\xf8\xdf0\xb9\x85>\xb2\x80v+Mq\xc0\xe0\x0ct\
+\xda|\xf8q\xae }\xb6\x0e\xf1\xac\xd1\x16\xca\xf6\xa0\x19t\x06\xbb\xcc\xfb\
+\x9d\x9d\xa8\x9eQ\xb7\xf6\x94\x89\xdd6\x91\xf3kM\xd8\xb9h.\x9c\xc8\xa6>\x13X\
+<c\r\r\x8d\xfd\x10\xf4a\x88<!Xm\xb5\xf8\xea\xd1\x9b\x8aT:\x90\x8a\x91\xd1\
+\xf2\xf5\xe9v \x86\x1c>/j\x02\x81\xf8\x939\x98\xae\x7fm\xdc\xcd\x95fK\xfa\
+\x93d\xf0\xfdZ\xd1\xe9\xeb+\x85\x1a\x133;;&7g\x9eQ\xf5\x12OB\x19\xcaI$\x01\
+\x13K/\x1fI\xca\xbf\xc1\t\x8f\x16\xbb\xd5\xbf\xcb\xb0\xe6k+o\x13U\x1e\xb3\
+\xc6\x12\x82u\xf1>\xd5\xf6\x94\x03,&\xb7\xc4\x12.\xf1\x0c\xbb\x9eG\xf2\xc0Q\
+\xb3\'\xc2\x98\xef\'\xf3\xc2\x84\'\xdcx\xd4\xb0\xf1\xaf\x88G\'\xb8\xa8\xf7^\
+\x18i,\x1b\x13\xa4\xefG*G\xea,&\xe0\xea\x93\x11x(\x95\x91s\xae\xb1\xaf\xc4&\
+\xc3\xa4#\x17~/\xd6q\x9dd\xac*\x17\xe4\x0b\xb4W\x83\n?U\xcb9\x1f(\xc3U\xd0o\
+\xac\xb7\xd6S\xb3\x0f|RU.\xae+-ev\x93\xb4;|R\x1fG\xbc\ns&\xda\xa9\xdd\x86a\
+\x84+g\xdc\xfa\x1c"\x15\xf0\x96@$`\x0b7\x82\xe2\x82\xac\xab\xa7\xdb\x8c\x87\
+\xa5\xabIW\xff\x8b\x80\x80hU\xf4\x9a\x92\xe8\xb98B\xfc\xeb\xc9\x99\xa7\xd5T\
+\xcf\xc5!\xce\xcb\x17\xf2R\x93J\xb9f)\xac\x7f\x95\xad/"f\x96\x92Q\x9f\xc0\
+\x07\x9ek\r?\xd2\xf5\xa9\xf7\xedP\xea5\x03G\x10VU\x17\x1e?\x04\x0c\x88\xfew\
+\xfd.\xd3\xbb||\x1e\x9f\xa5\x1bv=\x83Ln\x1f!24;\xd8\xd4\x92!\xfb\xd3\xda\x08\
+!+\xfd\xc9.h\xe6x\x15_bo\x01vQ\x12\xca@\xceT\xd2\x0f\x03\xf2\xfeC\x94V\xe6\
+\x96\xdc\x07C\x92\\\xf0`\x17\xd4\xf1\x04\xf4\x9e\x1d\r\x14\xd9e4\xd9w V&29?\
+\x8f\x9cy-\x97\xccF\x14\x12\x14\x8f"\xaf\xa0PVQzxp\xe0\xef\xe0ih\x98\xad[\
+\x81\x85\x8d\x1dFv\x95\xf1\xc1\x99\x8ft\xccx:w\x8dU\x14e\x9b\x96\x96\x16\xe8\
+qhXX\xcb\xea\xd9M\xd4M\xdcG\xeaO\x8c\xa4\xe1(y3u\x98u\xd4S\xd18\xa2.\xeaV\
+\xf6\xe7\x04\x05\x91\xf9yE!\xac4\xfa\xa2)\xfa\x95Y\xf2\xe6\x05\xfa\xd4\xe7\
+\xa7\xa7m[\xae^m>\xde_\r\xec\xb3\xe7\x97\x8bg\xadL\xf9\xb8\x01\x87\x1dw\x98\
+\xc0\xac\xd1.\x83o\xf2Go\xdc-+\x9b\x8f\xd9E\xf9%\xa3\xb7\xb7w$\x85\xa3x-\xfb\
+\xaf\xcb\xe2\xbfh\xf1EA\xb7\xb3\x15\xb9\x8ek&\x06\xdb\xa3\xd7\xd2\xa1!\xe6dt\
+"\x9cbc\x8f\x18\xde\xfe\x1a\x0b\xe1\xe0l\xa0M4\xbe\xe9\x1f\x9c\xf7\x16\xeb,\
+\x8f\xbf\x1f\x1f}?.\x1a4\x8b\xab\xe5\'\xc6`T\xc9X\xb9~\xcb\xfa\xbb$T\xa2O+7\
+\xe9\xf4\xb7p`W\xe8*\x05\xe8\x07m\xe9}1\x166\xa60YLAA\x01E\x8a\xf5\xd9J3\xb6\
+\xd8\xc3\xc6OzE\x85\xf6/\xb8\x84\x84w\xbb\xa5\x1aZ-\xf4.\xea\x07\xad\x1e\xd7\
+\xbe\xf5\xff\xdd\x9a\x91\x89\xa6?\xb8\x17!Z\xd6k[\x8d\x86b.S\x9eP\xbb\xe5\
+\xf7\xf9\x9b\xab\xe5\xe2]mhh(gY9\x84I\x1c\xba\x8cN\xc4\x01\x86\xaa[YY\xb9\
+\xb8\xdc\xd0\xef\x17F\xae\xc6\xf8=\x84%\xc5\xc7\xc7\xef\xee\xee\xc6\x0f\x0f\
+\x92\xf0Z\xd474`a`\r2\xa8ti\x96\n\xa9\xef6\x1d\\<y\x1f\x1eb\x93F\xf7\xf7E\
+\x12\x19\xb6\xb8\x8e\x9d\xba\xaa\xa4\xf3\xdb\x02-J`T\xb1\xb3\xb3sm\xd6\xb7k\
+\x14\xe6\xe1\xe1ag\xafh\xaf|s\x83>\n\xcf\xfa\x94\xe1\xfc\xa2Kg\xf3\xba\x11\
+\x8eu\xfd\xf1cw\xdf\xcf\xeb\xb0\xb6\xd0|y\x844\x9d\x946i\xd8\xef\xb1\xab\xe3\
+\xb7A\xdd\x9eF\xc2\x90\x15\x9f.\xfb\xdc\xcc\xb3\x86\xbd\x96\xd4\xbd\xe7\xde\
+\x99s\xb9fYTT\x14\xd0\x9c\xfa\xfaz\xe0\xcf\xe5\xb1Z\x1d\xed\xa7?hHIH\x16[,\
+\xcf/\xfel\x02\xc3\xd1\xd0\xd0\xa0"\xfez3\x9a\xc6K\x8c+\xbfH\xe5\xd3\x13\xb6\
+5\x7f\xbd\xc7\x10\x1d\x8c\xf3\xd3\xeeo*\xea \xdc\n\xc2\x9b\xa5\x92\xf4e\xb8\
+\x80D\x8eg\x94\xac\xa9\x97\x97p\x06\xa5\x9djO\x19\x86 r\x8a\xe8\xe2#\x11\xc9\
+\xfb\xa6\x84\x94{[\x9a\x9f\xac;\x90\xa3pH\xa3\x1b!\xdc\xf6\x13e\x84\xc7\xc2g\
+\x98\x0e\xc9\xb7\x8cr$\xdc\x10\xb2+Z\xc8\xd4\x17\xdadT\x7f\xb6\x87\xb7\x84r\
+\xd8s\x8f7\xb9\t^\x8bw,X\xbf\xedhp\xc5\x1d\x05P\xfc]p}\xcc$|\x96\x96\x96`\
+\x9e\xa9\xf3V\x10\x9b\xddsg\xbf\x07\xdc\x19\x93L\xd4\xd7\xf3\x1d<:\xad\xf6\
+\xda5R\x9fl\xd5\x8f\x1c\xbd\xb7&\xa6\rno\xd3[h\xb9(\xc0\x01o\x10}\x0b\xfc7\
+\x02\x0e\x0e\x85\xeb\xb5Z\xf9\x1c\xd2\x8a$ \x1c1,\xc5\x9f^\xd1\xd4D\x9c\x81\
+\xa2Q<\xfc\xa8G\x18\x89\xa8\xcdf\x80.1\xef|\xb1\xc18n\xc7(\xf0\t\x00\x08\x87\
+r\x98\xfe\x0e\x9bE\xf5\x8d\x90F\x1b\x8f?mm\xaf\x93]=\x12d\xf5\r\xf5\xc9II\
+\xe1\\\x8c+\x17\xe1cw\x8e\xcc\xb0\xc2\r\xba\x15k\x0f\xdd\xfdwww\x11\x11hs&j\
+\xa5\x9aQx\xa6\x15\xa2\xb2\x8b\x1f7x\xf1\xb2\xa6\x9bW\x1fU|U\xf19p?\xd1\x825\
+\x01r\xa4\x13\xc7Q\x06 \xeeg{SG\xde\xf42uI\x97#5\xf2\xa6\x8f\xb5"\xf0\x83\
+\xde\xe4\xa6\xb6\x930\xb2+V\x15k)\xfc%\xb4\xeb\x0ey\xe5\xd8|\xde\xfcf\x07\
+\x96\xfb\xe9\xc4y\xa2\xfd\xb1?\xdd\xe1Y\xa7\x1ey\xecz\x87SP\x8f\x8d\xd0h<u"\
+\xb6"\xb7\x1d\xf6\x82"}\x0c\xe9$z\xfaP?5e\x00E\xe4n\xb6\xcf\xde\x91\x05\xa1\
+\xec\x8f{\xc2\xc8C\xf9\xfco\xd0\xb5\xb3 \x96%2\xce\x8b\xa9\xa4\xf1\xfa\xc4\
+\xf1\xad\x93S<\xc2\xa8\x8c\x96\xec\x9d\xed\xdd\x8eN\xcbo}\xf8m^\xa8\xd1z{z^<\
+\xf9\x80\xd0\xf8\x0f\x97\xac\xf3\x1dO\xf65\xb3\xab\x1ftk0\rI\xac;\x83\xe8p\
+\xd4\xc8\xbd\x95R\xb9\x0b\x8f\xe3\xe3WWNm\xca\xb1%\xb0:\x9b1\xe3\xce\xcb\x8d\
+\xf6a\x81\xa6\x9fV\x1d\x0b\xdf\xd7VW\xc7\xf5d\x93\x0b\xbb\xfa\x0f \x1e\x8a\
+\xc6!n\x82\xfc\xd4>\x9b\xd7-\xf2\x8btH\xb6\xdaGM\xb4\xbd\x1e\xd3\x07\x94\xa1\
+Pa\x85\x1e\x9b\xe6\xde?z[)I\xf5X\x7f\xff\xce\xe2\xd0E\xbe/\xd4\xdbK\x01B4\
+\xa9a\x10\xa9\xf0\xd2\xbb\xcen|\x9f\nQ\xdf\xc0\xf9b\xc2FO\xf3S\xc9\x05\x05\
+\xa3\xd8*\xb5\xd9EG\x19\xac\\\x9c\x00\xef\x159\x1b(\xb8r\xe8\x92\x97"\xbd3\
+\xca\x98\x07d \x03\x9c\x04\xe9\xe2i\xf3U\xfa\xba\xfe\xdbm\x95\xa1^\xf3\xf7]N\
+\xc3\xc7\xbe\xd1g\x93\xf6\x9f\xafj\x83i\x8cD\xe8\x11\xfa\xd4\xf7\xb7\xf7\xf0\
+\nT\x11XTm`\xa9t\xf6nw:a\x87\xab\x8crS\xbf0\x84\xef\x15\x11\xaf\x04\x82p<\
+\x1eh!R\x08\xbe\x0e\x8e`\xf5\xd5\xbez\xec\xc4\x18\xae\xf41mk\x06\xc2\x04\xec\
+v^\xb3Attt\x01\x91\xfb\x17p_\xe7\xfb\xdb\x81\xe5\xe5\xe5\xf8\x86\xdenLK\xccV\
+\x15\x1c\xb1jmT\x96\xd1\xe9\xe2Or\x8a\xd8\xbf\xba\xe2mW\r\xdb\xd7\xabbs\x90\
+\xdd\xde\t\x83\xc0\xc1\xc8c\xca\xb0\x0c\x0b@I{\xf2n\xbf=\x9e\'" \xaa\xd9F5ZX\
+[?\x87\xe5\x8c\xdb9\x0bg\xc7n\xb4\xc9\xd8\t\xab\xb3\xa8\xd1&=z7\xb95VHc\xa4=\
+5\xd8yU\xb6c9\x89~\x02m\x99>LOO\x87jg\x13\xdb\xf6\x13\x1bD\xef\xf9\xdd\x88\
+\xaf-\xffA\x17\xfd\x99Q\x9fhE-\x1f\x83\x1a3\xb9\xd0\xa4m\xc4\x12\x19\x19\xd9\
+\x05\xc7 \xf5g*\xf8\xf8\xd63`\xb6\x0bE\x02\x93\xf2\xc0\xc8;+\x1d:\xcd\xfb/\
+\xed\x9b\xdf\xf5Hz\xcd\xc5v\x95\xe0\xcc\xcd\xb7\xe9\xe6\x1a\xca\xa7\xc5\x03\
+\x14\xaa\xbc\xc3\xe9\xa2\xba\t\xd4\x991\xa2\xcf\x9f+\xd8+R\xa15\x8e5\x16u\
+\xcd\xb5\xb5\xea\xa3\xc7?\xd7\x1d\t\x84\xa5O]\xdf9\x89\x98\x04"+3,\xb9\xe3\
+\xd0\xc3:\xcb\xe6\x93\x90[\xd5W\xb6\x10\x8b\xad\xcc\\\xff\xcd\xe2\xf6\xc6\
+\xdc\x1c:\xbbw\x9b\xb6r\xbf:\xc5\x16V\n=\xca\x9f\x1d\xd4\xe7\x9f\x11\xa8F@\
+\x07=\xb6\x8a=\x18z<z,x\x01\xf9C\x90\xb7\xedu\x7f"\x93\xc09\xf96\x19\x1b\xd2\
+\xd1)-E\x02JKJ{\xd5\xde4eH\x18\xda\xbf\x96dJ\x83\xc4\xd9K\x8b\xc7NY\x05G\xa0\
+\x92\xc2\xbe;z\xa7\xc4\x80\'\x04w\x86\x90\xb5_Q\xcbc\x81g\x00\xcc*\xb6\x82b8\
+\xe4\xd6h\xcc\x82\xf7\x17\xcf\xa5Gp\x8d\x92z\x0c/\xd1.\xaeU=\x1b\x9a\x81\x92\
+&\x98a\xa9\xe2\x04\x8a\x1b\xe1\xae\xfa\t\xd2\xf4\xdf\xb3\xce\xd7^\x9a\xdb\
+\x12\x15Sh\xe4c\xc2\x83\x80\xb0\x86\xac\xf2\x04|w\x15\xd9\x0f\xd8A\xbe\xc6\
+\xbe\xf3v\t5\x85G\xde/vg\xda\xf0\xe8B\xc4\xb0\xaa>\x10|\xf0\x86\xe6\xd7\x07\
+\xady\x99\x91\xf9\xf3\xc8\xbe\xad\xd8\xf0G\x06\x9b\x03F\x9f&\x99bL\xd1(i\x8b\
+\x85\xd9\xf5\x07\xd7\xe8\xd5W\xb80:\xeb\xbe\xf0\xe8F:\x97\xc3%\xb9:ag\x9c&.N\
+\xec\xe5\xc4?#BX\x91o\x0f\xfd\x83\xbc\x0cy\xa0\xc5g\x86\xd6\x95O\xe0ft\xa7\
+\xfb\x94\xf3Fm\xf6\x12\x1d\x9a\xdam\x8b\x02 ;`\xbeF\xfe\xb3\xd7\xd3K\x9f\xd8\
+\x87\x17gd\xf0\x93\x94\xecj\x11^OR\xc9DKB8\xdb\x03\xf4\x11\x18\x8d\xc5S\xef\
+\xa3\xc3\xe28XXs\x98a\xbeY\xb9\xf2\x0f%\xb0C\xd8?_\x1e*P\x9be/M\xd6YX\x97\
+\xdb}\x84\x9bXv\xd0>\xb0\xb4K\xb0B"b\x95X\xc6\x98\xdfAb\n\x8b\x8a\x02c\xfd3\
+\x85\xc3\xe7\x90\xec\x18Z\x86\x94\x98\xd8\x8c\xbf\xffEl\xc9}\x11\x7f\xe7\x14\
+K\x11+\x97?\x057\xbb\x7f\xe6\x0c\xbf\xd5O\xd5!h\xbar1y\x11\xd3\xb8>w\xd0^\
+\xb6<\x91\x9e^\x10\xa5J\xd3vr\xe9\x1e\xf3\xb2+oii\xa9\x99\x98\xfd\xc1\xb0J\
+\x1c(\x8d\xbc\x96\xe3\xa3Cc\xdciJ\x98\xb7\x98Z\xcb_(\x1e\x80\xbcj]k\x0f\xe8\
+\nh\xbetn\x9b\\V-\x15\xc9j\xff\xafd\x83\r\xb2\xab\xda^W\xfa\xce*\xbfMMs\xe8W\
+\xe7\x90\xf2q\t\xe2T\xa2\x9c\x1f\x1f\x1f\x9f\xb6\xe1\n1\xf3\xb1|_\xeaA\xc4\
+\x96\x93\x95\xcd:\x17\x147}\x8a\x02,Cd\x8c]U\xa3\xfdp\xa2=&\x06\x16\x06\x06\
+\xd6\x8d\xc1a\x97\x1f\x98\xef\x9bz\x89\xc2{\xd3Z\x9b\xda\xc7D\x0f\x07#.7\xc9\
+\xb3\x1eD\xc43\xb1\xfb\xe4/\r;{{\x16f\x16T5\xb1\xce\x9111\x14\x14\xa4Y@\xfb\
+\xba[E\x80\x02\x08$\xb1\xa3\xa3ctt4o\xd1\x04\x90\xba\xc0@\x1e\xbap|mH\x84(g\
+\t~kv\xc8\xddu\x19\x99\x9cTUPPpww\xb7W\xb1\x97\x93\x0bSb\xa8\xd3oR\xd5\xd3\
+\xe0\x15\xe1##\'\xcf\xcc\xc80\xe1"v\xf0\x12\xa5\x98\x18\xc2c\xb4\xb6\xfe\xee\
+T\xeb\x0cs\xc8K\x8c\xb1\x83\xac\xf3\xf7yE\xe0m\xa6\x19\xe1Zm\x17v\xfd\xb3=8\
+\xf8\xaa\x98\xb3\xbdd\xfa0\xeb\xe5-\x01\xf0\x1f \xd0p\xb8\x82[d\x7f\xbe\x89\
+\xbbUSc\xb1\xdb\xc4\xb3\x97\xc5hj\r\x97}\xee\x94\x95K\xcbj\n\xe7\xd7\xf6\x05\
+\x9f\x9a\xdc\xdc\xcd\xed\xe1X\xce\x0f\x9c2rr\xd9\xdfl_\x0f:\xe5\xb4Zv\x03\
+\x9e)Q\xd2\xf0\xa5\xc0\x17\xd9\xb7\x9e\xafoW\xaf\xe4\x99\xfboO\xf3\x1d\xfd\
+\xbd\xbd`\x16Z\xcc:\x0c\x96\xd9\xa8\xd4\xd4*\xb46\x15\xf1\xeb\xfa.#\xa0c\xf6\
+\xado\xfdIk\xac*\xbf\xddi\x18\x05\x8am\xbc\xd2z6\x07\xc7\xc6\xbe6\x7f\xa7_b\
+\xf5}I\xa0\xf4\x83f\x7f\xb1\xb40\x173\xb8YE\xe5thz^\x81\x87\x87\x8f\x15\xbd[\
+\xa0\x8d\x15\xf9\x19\x1f\x0f\xd4Lkk\xeb\xe7\xe7\xe7\xe5\x89\x86\x01+\x93z\
+\xdd\xd3\xfdl\x1f\x8a\xfc\xf0\x80t<\x10\x08\xd6\xc6\xc4\xc9IA[\xdb*v\xa4p\
+\xf6;0Q\xf8h2\xea\xea\xea\xa6\xa6\xa6\xb1#\xef\x99\xd9\x10\xfaxD\xc8\xcd\x83\
+\x9d\xe8\x82a(\xfa\xbe\xf6\xd5\x06~tKOqf}\x12\xc7\xdd\xc3F\xfd\x1a\xd0\x9b\
+\xbe\xab\xc2\xc3\x153\xcf\xfb\x82\xcaM\x91a\xe6Z\xa6V\xbc\x8bD\x11\n\x13\xae\
+\x99M\xc7\xe5\x90\xf3\x15\xdbo+\x11\xd6\x01\x9cC\x80Xf\xb9\xd6\n&\xfb\xc0\
+\xca\x9bN\xdf\x08\xd2\xf0\'D\n\x93\xf1\x03\x81D\x9fW\xea\xc8"\xb7Th|\x03&\
+\x0cq\x9b\x8dC\xd6\x1e\xc7\x95\tw\x8c\x1bU\xcd$\xd0O\xf6A\xcf\xa5\x0f\xd5\
+\xaa\xe3\xf4~\xc73\x9f>\x04\x00*\x9c\x96L\x99\xa1\x85\xc1\xd3\xe1\x1cP\xd8\
+\xf4\xb8\xad\xdb`\xbb\xda\xb0\xf9\x88\xe9\xde\xa4\xd4\xac\x08><<\xb4\xea\x96\
+\x84\xa3\xec\x8d\x00#\x88!Vh\xe9\xd5t\xc0\xd9n\x00\xc5\x9ez<\\\x10\xfdWd\xc7\
+\xdb\xad5\x18\xa1\x1d>\xe7\xde\xbfR\xf2\x1e\xeb\xd1Q\xcc\xf0\x9de\x9a\xfb\
+\xa3\xd5\x8a\xd1\x01\x8b7\xecU]\xc7\xc7P\x9cwRF\x12\xb9\xda;xXK\x15C^/\x9fZP\
+\xa1\xebb\xba\x8d\x89\x95\xd3p6D(;\x8f*\x19\xec\xfb\x06\x1253\x01"\x98\xed\
+\xe3KQ;)-t~\x82\xfe\x9f%\xa4n\x03\xe2{5[\xc1\xc1\xfc?\xa7\x8b\xf5.\x18-\xd0\
+\xa8h\xc6I\xe7f\xc8\xc3\xf8&\xff\xfe8\xce\xc9\xa3\xbf{ylmO*\xd7\n\x84#\x93A\
+\xc0\x9d\xb1\xef\xc5G\xe2mD`\xb0\xe7o\xaf\x8e\x7f\x1f\x0f\xd8W\x1e\xea\xe0\
+\x85\x13\xea\xda\\\x07\x03\xd5\xfc\xa9\xee\xc5\x9eKV\x16\x96\x8bv\x0e\xd9\
+\xb0\xa2yG$>;\xe6\x17\x0f\xc8N\x0e\x1e\xc5\xef$p\xf0\xec\x8e\xb2\x92o\xb8\'\
+\x11g\xe2\xa0\x93\xe3\xcd\xf1\xf1\xf9\xfe\x19y\xf6|\x98\x81(J%\x0b>\xda\xe8\
+\x9dN\x9de\x80\x12\xe2\x81\xcaY\x83\xac\xce\x80I\r\x95\xa4\x04x\xb9\xc1.\x88\
+\xd4\xdeSVh\x89\x1e\x10\xf8\x04\xb9\x88\xd7f\xc3\xf4K\xad0\xfa\xa8\x97\xc0\
+\xee\x05\xb5\xab\xabkm\xb3\x8f\xbc\xbf\x04UF\xef\x96\x11-VkO\xcd\xeb\xb3\x06\
+\xb3\xdd\xf0\x04b\x97\x8ba\xfe\x02\xa30gnJI\x00\r\x9f\x8f2\xa0:\xbbs\xbco\
+\xc6\xf6\xf5\x9e\xfc^#+##\x0bf\x9a\x12\x0b\xc6\xca{\xfa\xfb\xd4\xde\xde\x9e\
+\xb8\x83\xef\xbd\xe7\xe2\\7kr\xeb\xd9\x16\x14\x14\x04\xc8\xe1\xf6\xd6\xd6\
+\xd2\xc4\x1f\xb7\x1f?\x80|\x07\xa2\xcfy{\xdfS\xc4\x07>\x08~\x1828\x94\xc08\
+\xc1M\xda&F\xc9%\xc2{\x1e\x99f\x9b*\xca\xc7wr\xd7\xc4\xe9*\x0c\xf3\x10\xae\
+\xc9\x82\x1e\x89F\xe9}!\x992B\x80\x87W\xe7~i"\x97\xd2\xe3Q\x9a\x0e\x91b\x0c\
+\x19\xe7\x19\xad}\x1c(\xb9Vo\xdc\x8f(~\xd5\x7f.TL\xd9\xeb\x9d\x98:\xbee/\xd6\
+\xf3\xac\xba\x01d\xc5]\xc4\'\x92\x90]\xb7\xcd\xe2\x93\x89\t\x1cH\xf4)S\xce\
+\xcb\xcb\x13\xf6\xb3\x93 \xd9\xc5\xb7\x80\x8b\xc3\xd3C\xdb\x0f\xab<\x80\x08\
+\x10\x12F\xf4hQ\xfe\x87:\xfb\xaeE$\xd3\x96\x05k\xd9\n`\xc0\x9etwK\x99\xf3\
+\xe8HK\x07)\x17\xa3\xa3\xa2~\xfb\xb0\n\xc7\x89\x05\xc2\x01\xed\xee\xeeoW\x86\
+\x86\x844d\xd8}\xb3\xb1"#!\xd1\xa9\xb7\x02\x91\xfd\x002\xc4\xe8\xa2\xacgs\
+\x92\xc4\x85\xddR96\xd8\x9b\x00\x0b \x83a\x14\xf3O\xaf\x8ez)\xa7\x1b\x03\xc8\
+\x86^\xb7\x7f\x1c\xcc\xddg\xea\x99FB\xd0-\'\xb2\xbe\xfe\xb5\xf9&//\xff\xf9s\
+\x92n\x85\x81\x9az\xad\xcde\xadp\xf0\x05u^\x02\xa32\x1cZ\xe1\x94\x95\x97>G\
+\xdd"[\xc2\xd0\xdd\xf9:\xa5e\xd4\xf3K\xdd\x04\xa0"\x80\xdcWj\xd7\xd0PS\xe764\
+\xccy\x0f\x8b\xf0\xf08\xf5\x9d\x16\xc5\xc7\xffZ\xfa\xd5\x15 \t\x08\xe2\xcb\
+\x8b\xbd\xa1\x93\xc1\xcfO\xc9}\xfd\xfd\xcaY"\x8b\xcb\xfb\xce\x82\x7f\xbb\xa5\
+z\xa4\x98\nv]"\x8f\xc4>\xff\x97\xda\xd2\xa6\x05<W\xa5\xc5\xd944!R56\x8b\xb4\
+\xcc\xcc\xcc:::SSS-~\x8d\xcbf<\xcd\xfa\x95\xbf\x7f\xff\xee\xce\xcb\x13\x06-\
+\xbd\x8c=_lR\x8a\xe9\xdfL\xe6\xade\xad\x01D0\xf3\xfdO\xd67\xd1\xfc\xe9c\xc0\
+\xf3k\xb9&\xdbDDAB\xc3B\xf3\xf3h\xb8\xeda7\xd4\x9eV\xddA\x8fA\xc4\xd5\xbb.\
+\x8a`0\xd8\xc0\xf7\xad\xb5\xf9\xa3P\x10\x073\xf3\x90\x11\x17\xcc\x07Y0p\x00/\
+##*\xfa\x0f\xbb\xc9*\x0f\x0cw~\x06\n\xf0\xacq?\xbd\tV4\x1f\xfe\xe2\xc2a\\\
+\x99\xfa\xaa\xa2\xe07j\xac\xdd\xa0\xa1\xa3\xe7":-\xfe\xd0)T\xa7g\xa0\xa3\xb9\
+\xae\x9a?\x8c\xbf\n\x11\x86\x89\xa6\x1a\xc7\xa7\t\xa8R/\x95@\t\xb3\xa5\x8c)\
+\xfcG\x1a\xfe7g\xfa\x10\x1f>\x18H\xadZ\x08\xa4$NO_\xbf\xd5s\x8c\x94\xa6LL\
+\x17\x13\x17\x85T\xb19\xfa%\xe2^\xe9{\x99V\xb9\xcc,\xa3\x0b\x9f)^\x7f`fR<f,V\
+\xe4=\xa0\xbc\x07\xe8HWd\x9f\xdd\xdcU\xf4#\xdf\xf2\xca"\xd2\x19.\xbe\xe2\x1e\
+d7%\xfacC\xa8\xb6\x92\xd6\xf5B^\x83\xcby\xdd\x06\xf7\xf73*\x83\xada\x06\xf5\
+\x81,\xb3\x8d\xfb\xfc\xd4\x8b#!\xf6\x83E~N"\'\xb4e~\xe9_D\xad\x8e\x94\x89\
+\x14`\x89#\x93\xfeMOg\xb3x\xa3\x9d\x89\xba\x8d\x00\xd8uF&MC\xceFn\x08\xcd\
+\x12/\n\xb0\x8bz\xb9\x0f@=\'>\xe8\x1a%2\xa1c\x92\x1d 6uo\x8a\x82\xeeo\x1f\
+\x9b\xb84V5\xbb\xe0]\xaf/\x99\xfb\xd8\xcfs`)2\xe5<\xc6\xcaj\xc0\x1b\xa3v\xce\
+^\x95:\x9b\xbfs$\xad\xbey\xe0\x10W\xc40\xe1:\xf5\x9f\x86SZ\xb3\xba\xd80\xf0\
+\x97\x985j\xd6?\xbb\xf5l\xae\x8e\x92\xa2rF\xdbbE\xa1Y\xc9b\xbd\xde\xa3\xa7!x\
+Y\xdc\xcf\xbe\xbb\x7f\x06\xec\xa5\xaa\t$\x93\x00\xf9\xf2\x9b\xa6\x0b\xdd/\
+\x1d\xdc\xa5=\xce\xb22`\x0e\r\xaa\xf6\xc9\x02\x825\x13 \\=\x8b\x02\xa1r\xc8\
+\xd5\xd1c\x16\xc2\xae\'\x0b1\xe4\xc2\xfeQ\xbd\xd7\xc9"j\x89]\xfe\xa6\x9b!T\
+\xac\xb4\xe9\xe7\x05\x05 .\xd5\xf2\xfd\x98_\xdaE&)\x04\xdaD\x15Z\xe8\xe2\xfa\
+\x85\xea\xd4\xa9&\x1fx\xaf\x82\xdeo\xfe\xa5-\xb3\xec*\x1cG\'\x92\xa8RUS\x0b`\
+\xa92\xa8\x92\xab!\x99\n\xd6\xad\xe8\xff74\x81\x18\xad\xd2\x98\x8d\xdd\xf1i\
+\xba\xef\xa0\xda\xd9h\xac\x0fnuf\x86\x8eD\x84\x8c]ax\x13\x83\xc0<C<:y\x01On*\
+8\xe3bl\x16\n\xa7c5\x88m\x92\x0b\xd3\x8a&\xd6\xbfK\x18\xcaa\x8c\xec~\xb8\x9b\
+\x02sA|\x1df\xb2mb9\x96\xf5c\xf1\x07\t,5\x12Z\x11\t\xc8\x07:4\xbb\xb1o$\x82\
+\xda\xe02w\xd1\xa0\xcd\x0e(\xc8\xd0\xc8Ddl,r\x12\xca\x814\xbb\x16\xfa3\xbag\
+\xdb\x9a]\xe3\xa2\r\xffAd\\\xf6D\xfa\x0b\xae\x05`h\xfe+\xaa\xa9kx\xe9\xae\
+\x17b\x16\xc2.E\xbdQ\xe4\xa8\xe3Xv\xe8\xfeA\xa3\xd7\x7f.\x19\xdfq\xef\x0b\
+\x8f\xffx\xb9N\x80&\x8ap"\xdav\xdb\xda\xda\xce~\x9b\x85\xc1J\xf0\xab\xb1\xb2\
+\xfd\xd6\xb7M\x84,\xd0\x18\xb26\x83\xd7*M\xb8\x10\x851^\x0bp\xf2\xaf\xbf\xdb\
+\x00\xa4\xbcW\xfc\xc67\xf842]L\xec\x80(\xcb\xd0\xac\xef[\xd3b\xbdX[\xb8\x80\
+\xa4\xed\x93\xfab]^\xb7\x1cNPW\xd2t\xf0.\xfb"\xcf\xd6\xcb\x94\x15\x95J\xca g\
+\xaa\x89\xdeW\x9dLj\'\x9b\xd4U\xb2H\xe6\x1fA%\xe8\xc0y\xd0\xd0\xdf\x127w\x99\
+\x04^\x80\x1b\xfa\x83\xfb/\x10\x83\xf4\x1f\xaf\'\xadz\x85\xa3\x93\x1e\xc3\
+\x9c\x07\x89Q\xdd%\xe9\xdc\xeb\xe8&\x03\xd2\xb1\xd2\x01\xce\xa2\xe6\xe7\xe0g\
+d\x1cX<\x05gg\xf3\xd0\xe0\x92\x1bY\x8d\xfb=\xa5\x15_Zxz>Yf\xfb\ro\xa3\xae\
+\xf9vm\xc1\xd5\xdf\xe0\x82P(.=\xe7Nt\xf2\x06Uf\xe3Y\x1cdZD\xbf\xc0\xe0sj\xeb\
+\xc3D\xaf\xfe\xfb\xa7\x0e\xf0\x9d\x02\x0f\x05\x0c\x8f\xd0\x0b\xb1C\x1b\xa7\
+\xddR\xaf\xbfF\xeb\x83\xd1\xbaX\xd6\xceE\x12\x04\x85\xcb\x00\xe9\x93&e\x05\
+\x92YNE\x85\xad\xdf\xe3[\xde\x16\xcdF\x8c*\t\x92\t\x02/\xb2\x82\xafv\xe8\x81\
+\xdd\xd1\x0e&\x9f\xef\x16\x8d\n\xfe\xd1\xf5\xe0~|v\x8fJ\xa1\xfa\xa9\xb7\xe5~\
+\xe1HJW\xf7 \xaa_\xf2\x81V\xf9l\xba\xe1\x1a\x06\x97\x89\x8d>[\x9e\x0cX\x9d%\
+\xa9\xac\xa4\t\xa5f\xe7k\xedE\xcd\xec\x0c%rS$\x01\xde\xa4J\xd7S\xb6\xc9F\xff\
+\xd0W\xa4\xd8\xeb\xd1\xfd$)}\x95\x013\xe3\xac8a\x87\xe9\x07\xca\xafQ1u1\x80\
+\x05\x88WI\xe6c\xa9\xad9\x0e\xc4\x86\xf7\x8fo\xa1\x12\xc0\xb1\x8a&I\xfa\xf5\
+\x0b\xad\xbeU6\xffs\xa9\xe6!\xc9\xa1~\x9b\xa9\x93X\xf0\xe5g\xb92UQ\xdc\xe9gU\
+\xb7>\x16\x98\x1c\xc15(\xda\xd1\xf6-\xb7l*DHhbh\xf7\x8a\xf2\xcdA\x94x\xef\
+\xbf\xdb\xb5\xab\xa4c\xa1)(\xf9\x8a\x10\xb0\xc1\x12\xfb\x99L\xfc\xd4\xad@\
+\x8a\x88\xa4\\\x88L\xe7\xe7\x1e\n\x96\xca\x85\xd9\xa4\xc3\x1a,O/9]^\xfa\xa7\
+\xfb\xa3`\xd8e\xc1e\xf1\xc7\xe2\xfc\xfa\xba\xea\xba\xbf/c\x92\x02bm\xdc\xbf\
+\xdbB\x00u\xd8\xd9X2\x98\xf4\x9f2\xb9j03 8a~2\x07\'\xb7\xc6\x88\x083?\xe1\
+\x05\xb2\'\x04\xec\rhx\x18\xb49\xbat\x14\xder\x03M\x02R]\xe3\xe3\xbe\xafe\
+\xf6\x1f\xa88H\xe7<\xe5\xcf~\xef\x13\xc3\xca\xe8\xe8\r"\xf4\xf2M\xb3\x9e\xb7\
+k\xfc\xc46\xec\xa5\xd4\xf2\xe1\x05\x1b\x04\xe0\xfa\x84\xe8s\xc6\xf2i\x83\xdb\
+\xe2\xf1\xf1\x11\x91h=\x045\\\xe2-))~\xd5i\x8fO\x82\xd3\xd88\xb7\x04\x9d\x89\
+6\xb1\x81c\xf9b\x92+\x8b\x0f/\xcc\xd1\x94\x96\xa7\xdf\xc7\xc7\x07\x8cOAAAHX6\
+\x7f\xbc?\x91\xed\xb77\x9a\xd6_\xd4\x0f\x98\xf8\x8f\tR\xd1\xb2\xa6\xa6\x1a\
+\xa6\x9a3\xf5\x14)\x91\x10\\<<\x807\xf5&\xea!\xc5a\xedF)\xe5\x03\xdbw|||\x7f\
+=9\xe2;\xcc\x0e.o\xfe44\x00\xd5\xf1\xf5\xb8\x03\xb9\x82\xd0\xfa\xff\xaf\x05x\
+\xcb\xae\xae\x1ez}\x85\x07`\x0f\xa8\x1dmmm@\xda\x00\x11\xf5\xef\xdf\xbf\x9f?\
+\x7f*\x85}\x02\xacj^u\tD\x05[5\xda\xb0\xed\x895I!)33!1Q\xf3\x8b^z|Z|Jvl\xa5\
+\xa5y\xf0U\xfe0|\x87\xcf}\xa3\x9a\x9a\x1a\xb8`\xfe\x18\xf6\x90\x93\x85C\xc8\
+\xeb\xee\xf7\xc0\xf6\xe1\xf9\xf9\xfd\x7fk\x13qI~_]9e\xcf\xbb\xed\x0e\'\xb5\
+\xbe\xb4\xd2+&\xbb\x8bd)\xa6p\x80\xa6\xaevGT2\x85~Tn\xebk[i\x9b\x98\x98|\xb5\
+]\x85\xc7\x16Q\xd5\xd4\xef\xbd\xbf\xe0\xa7\xbc#\xe71\x0f\xfe\xe76\x8b\x8e\
+\xa2ab\xd2\xfd\xf2x\x9d\x9f\x9f\x0f\xecN\x9fN\xa3Wk6T\xf6\xb9\xdcb\xec\xd7{.\
+\x87\xcf\xb9\xaaM\xabv\xe5\xb3\x7f\xbd\x1f\x9d2\x95\xe5\xc0F\xdd\x92y\x06\'\
+\xac\xd9\xe9\xa9qI\x99I\x19\x19\xb5T^\x92\nN\n\nN\x11\xa9tP\xd2\xd1%s\x99\
+\x90\x90\x96\xf9\xae\xd6P\xb7\x07\x15\xca\xcf\x14\x826B|\xccl\xc1\xc8\x1d\
+\x15#\xa1\x01\xb6\x00oTU\x9d\xf7\x86\xe3\te\x8e[\xf1\xe5\xb1\xa9\xfb\xd4\x93\
+.P\\\xa5\x8c\x1a)\x95\xb8]\xf5~\\\xff\xcc\xa9\x826\x84\xaa\xe9\xa3vk~\xcd\
+\xfc6\xe16;\xf2>G\xafA\xaf\x0bzt\xfb\xd4\xd0\xc0\x1f"\x15\x10a\xbd\x81\x8cC\
+\xach\xe2\x15-\xa1\x13[\x80R\xbb\x85\xe1\xb9;\xeaqb\x15`\xdb\xa6\xacR\xd0\
+\xe1\xf2\xc8\xc3\xe4\x03H\xfc\xc1\xce\xec\xf7?VK\x04\x98\xc3[D--MC_l\x0e\x9d\
+\xbd*E\xea\x0f6\x81\xc4\xbc\x10\xa5\nHLN\x0e\x8d\x81\xff\xef\xf2\x9b)+|x\xbc\
+\x0c\x8c\xa3\xc7\x92\xca\x9e|\xe9\x11\xda:\xb1s_\xbf\xc6\xd4\\\xc9`\x15p\xe7\
+_\xb8m\xffU\xa5\xaa\xe7\x88\xde\x08H\xab\x81\xbd\xb11uk\x12eb2\rL<\xcc\x0f\
+\xbb\xdc\xdd\xc8$\xdd\x1f\xf9}/gq\x884\x90\xbe\xe8c\x0b\x90`\xe3\\\x9f\x88Z\
+\xff\xbf\xa0\xc1q.\x06\xcb\xa1\x7f\xf4+\xd1\x91\xc5\x18+n\x1a\x1a\x1as\xc2\
+\x8b\xe7\xa7K\x88\xd1\x0e\xde\xe8\xa5\xfam\x06\xb1Zn\xa1RuP\xec+\xce\xfc)H\
+\x93\xac\xd4\\\x14/\xaaK\x89\x87:\xa4\x82\xa6\xd1\xb4q\x0b\x9a\x9f\xab[\xa1\
+\xa5\x98\x81\xb7jE\x8e;\x84\xeb\xafI\xe8D\xcd\xaa\xa0\x00n\xd0\x98J\xe5\xc4\
+\xf0c\xf9j\xf8\xf4\x12\x9b\x156\x88l\xdd\x00\x8a7\xa8\x02$\\iu\x84\xb9\x13\
+\x80\xc7\xd0\'\xa4x"o>\xd9\xb8\xb9\n\xbd/\xc0\x00\xf3\xa9C\xa6\xff\xabg\xc5a\
+\x1br}o\x117Q.5cH\xc1\xb6dY8 2\x11\x9a\xc08tU\x9f\x1d\x95\xd9\x13\xceulW\xa3\
+"\x8a\x1eG\x1c0\x0eh\xe4\xc7\x96O\x86\x04\xd0ho\xef\x17\xa2\xcf\x9fe\xf3A\
+\xa8f\x97Sk\x1b\xa6\x16\x95\xb0/x\xe88\x8a\xe1\xb4n\xce\xdbr-\x96\x9f\x88\
+\xf2\xb7\xfd\xd1\'\xc8]L\x81}\xa60\xfb\xc5\tQ\xd8\xe6v\xe6=\x1b\xb4\xd9r\xec\
+\xcdh\\\xab\xe6\xd1Oq\x9a\xf5c\xf4\x19,\xc4\x90`\x06\xfd\xba6\t\x9a\x86\xd7\
+\xc3\xfd\rM\x04N\xa1x\xf1Z\xf9\xd3$.HA\x92[^\x9d\xd6\x81\xe9f\\\xc4\x18H\xf0\
+/B\xfe\xd0\xfd\xb1O\xc3\xa3\xc3\x081_\x7f\xa2\x1b\xbf\x91\xf9\x7f\xe7#=\x05\
+\xe8\xd3\xad\xf5\xd5\xd5\xc4$P6\x7f\xd6\x8a\xef\xf6\xc7-\xb8w\x03zss3::\x8a\
+\xc7\xa8\xdc\xa4/\x8a\xbd\x92\xbdwy\xe3\x88\xb6\xa1Wk\xff>\xd3fG\xc3\xe4h\
+\xed\xa0\xe4\xa0\xa4\x84\xa9\x87Mz\xe8^\xc1\x00\xf0\x97\x8cZ" \n\n1AAyp\xe9}\
+1\x85\xb0\xeb\xe8\xfe\xadk\xc6\xb1\x04\xa3\x0e\xc0\xbf6\xfa6.\xff\xdb\x00[\
+\xd6\xd9)a\xafR\xb5hsv|\xfc\x1c\x0b}\x88\x15\x7f\xbb\x8c\x9d\xaf\xfc\x1a\x19\
+\x11!\xe2\xfdp199yqqq\x06]y\xedj\xc7\xce\xcb\xcb\xc7\xc5\xc53\xe3Y\xbc4\x1d\
+\x18+\x1e\x85\xde\xd9C\x1b^\xc7x\xa29\xfa\xcdx`A3N\x7f\x11w\xe4\xbf}\xfb\xa6\
+\x98\xc2\x9e\xc9\xed#\xeb\xe7\xd71\xb1\x7f|v\xf6\x06\xf8\xd5\x96\x96\x96L\
+\xe5\xfd\xc5:K\xeaH\xba\xbf\xde\x02p\x17\x0bw\xfds\xecU\xad&\x7ft\x9e\x9f\
+\x9e\xfc\xa7\x9e\xb6)\xa1\xee/\xeec\xdd!\xe8\x80\x02\xb9\x9d,8\x16\x9d\x8e\
+\xa6\xdb\xb7\xeb\x18\x1aVM\xf5\xe9\xc7J\nZq\x99\x07\xf30\n#S\x0fm\xf7\xc5\
+\xee\x9b\xed\x9bY\x98s\x0c\x1a\xc4\xa5%\xe9\xa8\xaan\\\xba\x03\xc6\xb3\xa7\
+\xa7\x07@\xe80\xbf\x07\x87S\rk9)\x14\xf9\xb7\xe0\xe0\xe06\xaf;\xe54\x1e\x99\
+\n\xad\xe2\xb5lR\\\\\xc0\x929\xef\x0c\x822\x95SRS\xad\xea\x16-\xc63\xc2\xa9\
+\xe6\x8d\xb8\x82CC\x87w\xaf\x00E\xc1\x99J\x19+f#\xe2\xc8\xa1,\x18\xd8\x95:\
+\x11\xc1\x95\x02R\x1b\xf2\x8b\xb0\x0f\x16R1\xa2u+\x93t^\xe66\xef\xd5b\x12\
+\xed\xd8H\x89\xb3j\x02\x85\xa6z\xa1\xb42<T\xe6m\x0b\x15\xf1\xc1h\xc9\xc5\xff\
+\xc3\xe9s\x1d\x9c\xc7\x03\xfd\xb3\xb0\xc2t\x07\x8a\xaf[{\x1d^\xe9\xf3\x8e\
+\x073\xd5\xdaz\x8b%\'\xc4D\xb0P\x0e,\x11\x14Q\x06\xcbU@0\x0f\xc4mC\x9b\x92\
+\xcd\x1em\x11\xff\xa9\xc8\x7f\xdfO\xa9%\x17O\xfd\xb5`\xbb\xfb\xe7X\x99_Qq\
+\xba\xd1\xa5"4\xe1\xc6\xff\xfe\xfd&\x1f\xe1\xden\xdbg\xad~q\xd0;"\xd6/\x83\
+\xd3\xd3\xd3m\x06\x9c<B\xf2\xdbuk\x91\xf3\xc72H\xa0D\np\x81V\xf9g\x96\xd95Q/\
+\xea\xef4h?\x8c{@\xc6\xe2\xf3^4\x04\x04\x04\xd9>o\xccG;\x0e\x1a\xe8\xe8\xe8S\
+\xea\xdf\x1b\x977 \x81jP\xbb\x91\x0ch\x15\xd7TM\xc8\x07\xb2\x18\xe9l2\x166\
+\xb6\x99\x87\xcf?\x97\x97\x96\xeauO\xbf\x98\xf5\x12\x10\xec\xd8\xdf[\xa8\x93\
+\x81>\xc0eDj\xabY0\xa0\xc4#\x05:\x87\xe1\x1e\xbc\x82\x17\x11.\xa0\xd55_bA\
+\x0c\xb5D\x01\xb4Qa\x9cT\x07@-&\xc7\x1a\x18>\xaf\x18\x1e\x1e\xb4\xb8\x88\x1d\
+2\x0bd\r\xa1X\x1e\x1eVHR\xf8\x93W\x80\xe0]\x9a\xc21\xa2\xb6#\x90>\x16\xb7\
+\xfe\xe1f\x88\x1a\x06\xd6X\'m\xf1]\xd6\xba\x11\x7f\xba\xdf\xe30g\xaf\xb3\xb3\
+P\xe6\x84\xd8=\x9b\x01\xa7a{\x86\xc7\x80\xaaVgr\xe4!5\x0f\xf9\xf6\xcef\r^|\
+\xcf&\xd3W\xc3\xb2\xd9\xef\xf7g\x8b@\xdd%\xa5\xa4<w\x10\xfc\xef,\xa8\xe5\xf2\
+\xdaZ\xcc\x13f\xe7\xda\x7f\xe7\x16I\xb3!\x93\x1ad\x94\x94\xd8|\xf8p\x98\x1b\
+\x0b\x80@\xf0\x9e\x1c\x88\xa4$=\xce\xee\xf4fX\x1e\xd0\xfd2\xee\xb2\xd9u\x10\
+\xd4JLtx$\xea~\x9f\xd3T"\xa4\xde\xf7\x1e\x05\'\x03\xe6\x87\x86\xaa\xaa\xbf!\
+\xaa\xf2\xdb\xb2@\x8c\xf3%\x9b*\x1d\\\x05\x9e\x18L\x045\x06\xfb\x8a\xeb\xf8\
+\xd16|\x98\xd8\x07\x04+*P@\x19\xcc3\xec\x9a1\x12h\x07Q\x08\xe1\xd1\xc6\xd7\
+\x1b\xef\x96\x8c\xd1\xe6\xcd\xb4\xdc\xb2\t\x8e\x83\x987\x1b\xc1\x97\x80\x9b(\
+$\x8a\xca($u\x08-$P\xf8\xd4\x9d\xe0\xc6\xb3\xcd\xb5\x05\x13C\xbf\x82\xbdb\
+\xc3\xbd\xefH\xd5\xa7~\xc9\x8a/p\r\x99RY^iC\x0b\x0f\x02\x85\x91D\x18\x7f\x19\
+\xe3\xb4\x97\xe5\xc5\xceB\xdb\xf2cC@\x99\x81\x7f\x84<(\xdd\xa5\x9c#\xd3s\xa7\
+\xe4\x84\x1f\xb4\xc4\x8a\xc3\x86~\xf0\xa5\x00F\x98\x1b~\x9a\xf7\x1f\xc9\xe5\
+\xb0S\xbd\xe0)0c\xdd\x1c5\xe6#\xe5\x80\xe8\x1b<\xcfV\xcd~\xffa\xe0k`\xe0K\
+\xe1\x9e\xe0\x9e\xb3`\xd3\x80\xd5q\xc7\xdf@\xba\xb1\xe6\xc2-4\xd3\x1f\x8e\
+\x82AcQG\x12\xb5\xf7[2\xb4\xa3\xa8\xb0\x90z\xbf\xdb\xdcC\x8d\xe1 \xfd+Vo\x17\
+\xcc\xfdE\xe5\xd7,8c\xce\x1d9\xbf\xed?M\xe2\x03\xfd}\nY\xb4\xc2\x1d\x0f\xa9S\
+V\xbd\x0cro\xb9L\x87G\xa0K\xf1\x00H\x0bj\xbd^8t\xa0>\x99\xb7\xb8\x0b.\n\x85\
+\x92\xbes-\xcb\xa0\xf7\x1f\x8a \xf7US\xc1\xa5\xcc\xe7\xd9\xf8\x0e\xb2\xa1\
+\x0cq\xe8\xc9b]\x8ft\x8f}R[\xe1\xf4q\x96v\r\xdc*\xa7V\xe4\xad\n\x81\x1fM\x1e\
+\xc0e\x00^\x9f\x1d\x1cHP\xdb\x029z}u\xdd\xd3-5\xd2\x90B\xfep\x1dPr\xc0\xf4\
+\xdfm\x9cZ\xf8]l\xff\x15\xa8\xa6)\x11\xe2\xe2n\xb9\xb6L\xb8eeg\x7f\xf0\xbb\
+\xdc\xea\x13\xad\\c\xcc\xf6\xfe\t!}\xf7\x8e\xf2u<\x9f\'\r\xe3\xa6\x17\x1c\
+\xfc\x90\r1\xe3I\xd3\xadh\xd0\xfd-\xcaA\xd4\xedK#U\xeeg\xafr\x0e\xb4\x84;MI\
+\xa1\x90\x87\x9a:\xc0\xfaC5E\xca\x88I\x8d{\x9b\xc15\xb3\xf3~\xc8\xb5\xdat\
+\x9er\x96 \t\x01\x01\x00\xc0\xb5\x16\xa7K%%\xf2\xe5}\xa4\xa4\xa4B\xce{\xa3\
+\xf1\xf1\xa04\xa5\xd0=\xe8\xb7\xe9\xa2\xb1\x8c\x0fu555#k\xb7\xf3\x1do\xb3\
+\xdb\x97fff\xbfuZ\x1a\x06vI)H\xf9\x891\xf4\x0c\x16yd\x18"cb\xd6\x9e\x8e+\xca\
+\x9e5I+,\xfaoHb\xd9\x0c\x95\xc1\x99\x99\x99\x80\xe4.\xfd\xb59p\xca\x16\xf7\
+\xf3\x1d9L\x9e\x1e\x1b\x03\xdf\xc4B\x9b\xbe\xdf.\xcd\xf2\xa4\xfd\xae\xad\xe5\
+\xa1\xa3\xdb\xa1\x84\x1efkA\xaf\xbfgJ\x86\xb1\xb0\xf5\xe3P\xe0\x81r\xc3\x10\
+\xa2\xa5\x1b\req1_\xe5\xc1\xc1\xc9t\xc1\xbf\x81\xb6\xc6\x8d_|\xbd\xa5\x91\
+\x9eq\xda\xbbI\xfe\xd2\x00\xc8\x1e\x0bm\xe2\xf2\xda\xc2\xd2\xc2\xe4\x81S\xb3\
+S\xad3\xc3\x11\x1fC\xef\xf7\xa3\xd8\xed\x0c\xee\xd4x\x80\xe3\xf7:&I\\@\xa0\
+\xe1\x04F\xe5\x86\xc6\xc6\xfcbt\x1b,\xf2}\xa1\xff4\xcd4\x9bW\x1f\x8c@B9\x8an\
+\x16\xe2\xe9\xe5I\x8e\x85\x8cd\xe6\xe2\xc27b\x99\x9b\x84\xf5\x91\x8fa#\xeb\
+\x02=#\xf5\xd5p\x06\x0e\x0eA*\xf0\x0b\xc1{q\x12\xd6@\x19,\x9c\xa7\x10\x0f\
+\x8fw\x86\xff=\xd8,\xdc\x075syA|\n#(\xc8\xfee\xa8?Z|\x112\x8e\x86\x7f\nX\xbc\
+\x83\x1dDE\x91\xa5\nvB\xc5\xabV\xfc&\xdc\x92\x92\x1a0e4\x81\x02\xac\xe5\xd1\
+\xf5\xa3 \xab$\xdc@\xd1\x98\x85\xb4YL\xa83\xea\x18\xf5\x0b\x9c\xc3\xd5\xb6ON\
+\x01=\x99\xefK \xbax\xe1\xb1"(\\0S\xd9\x9b\xc2\xa5\xb4\xc6\xb1\xe6\x82\x8a\
+\x8f\xd4\xd6\xc07K\x9fc\xdf\x10\x1c\x8a\xe8\x83w\xb2\x8f\x07r\x9aj\xf5\xe8.,\
+\x98\xfa@\xd4\x0e\xdd\xc1\x16l\x1eBx\xb3\xa4\xfa\xa9\xb9\x93\xf7\x9an\nS\xb6\
+\t$h\xef\x13\xbf\xbc\x81D\x96\x99\xb1\x01\x85H\x17\xd0\xe0\x15\x99\x7f\xaa\
+\xeb\x17[E\x9f\xe2\xce\x906\x8e\xec\xdf\x86\xe7\x8dh\x82A\xab\xd6\x07{(\xad\
+\xa8y\x1a\xfe4\xa0\xa0D\xba\x8a\xcb\xf9gF1\x0fZ\x81\xb4b\xe2\xac%0l\xb6} \
+\xd4\x94,a\x92@M"P\xd5\x8cs\xe1e$%\xdcj;\xd6\x90*\xaf\xadc\x1d~\x97\xf0ev\
+\xf14\xd8\x14\x83CtFms\xdd\x890\x98y\xda\xc8\n\x0f\x8e1\xd1\xa0\xd8\xb2\xd5\
+\xe8\xaa51\x9a\xd3\x86\x8e\xc6\xa8o\xea\x1f\xedV\xb90B\x9f\xb9ZP\xa2)\xa1l\
+\x16\x08\x84+\xb2b<\xbe\xde7LO\xfd\x8d0Z\x18\x8e\xee4\xe8e\x15\xfb\xee\x14\
+\xde\x8d\xb8<=\xdf$l\x86\xea\xc9\x18&qpxP\xd6\x94\x1e?\xe0K\x95\x0em \xbe|\t\
+\x85s7A\xb4\xf4\xef\x0e\x1a\xdf(\x84\x00-G5\x0bT\xad+\xeb\x9a\xd8R.Ze\xdc\
+\x15\xed\x996Ux\xcb\x0f\xa6o\x1f2D\x1e\xd3\x17j\xe6N^_)\xea\x95c\xd6K&2\xcc]\
+\xc2\xf4\x9e\x02,e6\xc6\xe8;\xb9\x8bE\x85\xc0\xc4\x0b\xd8c\xef\xec"L\x8b3\
+\x91\x91\xa4<\r\x8c\x1d\x11.=>*\xd4\x8d\xe6\xe2\xca\xf3w\x1d\xe9\xb9\xcd\xbf\
+\xec\xcf\xff4\xce\x05\xa5\x8e\xf6\xa5\x87P\xf7\xb9\x91\r\xf9\x99IV\x7f\x90\
+\xef\xa6\x98\x8ch\x7f\x1e\xb7\xef\x0bQ\xcd\xe8\x17D\xe9uP\x85\xfaYM\xf5\xc8O\
+9\xe7\xb0Vj\x10C\x1c\xf8\xaa\xdb!a&\xff\x94\xe3\x0b\x02\xb2I\xc4\x86\xa8E\
+\xb1\x06]*M\x1eS\xca\xdf\tR\xd5\xf6\xfe\xfe\'\x03\x9e\x80\x1exL\xce \xf6\xbb\
+\xe3*S_q\xca*\xa1\xd1\x91\xd0\x88\x9c\x80\xcbd\xb8\x07\xb1\xbd\xe5\xe00Iy\
+\x87\x93l>=`\xf0\xcb\xb6+\xfe<\xb8\xf7lI\x93W\xe1\xd9C\x8d\xfa\xb6@\x073&\
+\xa5B\x847\xb4^\x84\xa8N\xf0qn\xf2\xd8\x878obt\x9bf\xeb\xae/Z\xf5\n\xa1o(\
+\x8a=\xa0\x116\x1c\x9d\n4\x9f\xd8*\x1e\x80\x12\x13\x9e\x06\xa53{\x1e\xca.\
+\xc1\xd0\xffW\x8d\xd3\xdah\x9d\x02\x08\xd8\xcb@\xfa\x8a\x1c\xcc\x94\xf9\x8c\
+\xe2\xc61\x8f\xa3\x13\xd5X\xfb\xd7\r\x19\xdc6\xf8\xce\x93\x1a7G\x1e6W\xb6\
+\xe4J\xed\x80Oj\'\xcbr\x8b\xa1\x90\xde>HGH\xb6\x04}l,Rv\xc7\x93\xd5\xed\xb8\
+\x9bk\xde3\x0c\x8f\xefF\xf6^\x80\x14\xf8\x9d_\xed\xd4\xe2)\x82\\\xc5\x90\xd9\
+\x91\xc8z\xf3\xf3\xeb\xaa\x9f3\x9f^\xcb\xef\x03\xceN;\x12\x14*"X?@\xa37\xc3\
+\x82\\\xd1d>\xad\x05|d\x9a\x94\xb7x\x8enz\xc2%\x15\xcc4<\xdc\xe8\xfb\x94\xae\
+Z\x91\xea\xd0\xa5_\x1f\x9d\x1ba\xccG\x9a\xb6p\xed\xea\x8bB%\xeeB\xc9\x85x}[I\
+\xbe\x9d\x10\x04F\r\xf8rb\xd5\xce\x8fk\xd1N\x17\xb2\xb29\x0f\xa5\xeb\xf0\x1b\
+\x18\x88\x7f\xb8\xa6\x91\xe4\x8d\xa6X\xbb\xbc\xbc\xbc\xc8d\xece\xa8}c\\\x03\
+\x87\xfb\xc9K!&\x8d\xd0\xedtH\xcdH\xc5O\x9f\x89\xac\xa3\x06\x8c\xad 6\xeb\
+\xf3\xf4\xe6o1\x83\xbbY\xca\xf1f~,\xe0\x08\xc7\xf9\xd3\xe2\x078\xba\x8b\xac\
+\xac\xe1\xb1\xaa\xe2\xd2\x04\x9b\xae\x9f\xb7}mQ\x15\xd7k\xb4\xcb\\\x80Dx\x10\
+PRN\xcc\x07F\x86\xb4\x8c\x93^A\xce\x1c\xf6Z5+\x80\xb7\x96\xe7l\t#\xe9\xc5\
+\xc4(\xc01+\x9c"\xe3+\xd3}\x07\x80+\xf0{;k\x0b\rE\xba\xd2\x90\xab\x83\x86{Y\
+\xf1\xa77/\x93\x1e\xab\xa99N\xe5\xaa`\x81@\x11("\x1c:!\x924\xda\x0em\x86)\
+\x0ej\xc8\xca"9R\xf6\\\x1a\x0e\x1a\xfd\x85\x94m\x06\xe7\xd7\x8f\xa3\x16\xce]\
+[pq\xb5FB]\xd9\xdd\nc\x9d\t\x97\xb1\xa8\x1fin\xc2\xa3\xab.\xc6*\xc5\xac6\x1c\
+\xbe\xf4ez\x8f\xa6\x13\x1eH\x87\xc7\xa7,\xdc)\xbc\xb1\xcb\xb9\xb0o\x06D\xd8\
+\xaa\xbdH\x07T\xf46~\xc3\xe3\x87\xd2\x0b|\xedU\x84\x0c\x89\x7f\xf5\x97hBX\
+\xccS/U\x8d\x80\xc7A)\x94L&\xa6\xa1\x0e2i\\\xc6\xc1\xdeF}}V\xe4\xe4^\x08\x95\
+\x95.\xed\xbb\x03s\xc3\xe2-\x14t\xeap\x8f\xef8\xe2\xe8\xe9\xe8,\xce\xcd5\x00\
+|\xd7\xcb\xdc\xeadj\x1e \x0e\xd8\x85l\x00\x8f0\x10\x8bal\xf9\xf5n\xa7\xbeG\
+\xcb\xa2\xb3S\x01V\xfeH\xed@I\\\xeb\x818\xf2\xb3\xb34B\x0c\xdb\xa5N\x0c\xb9p\
+\xb2\x08\xe7\xee\xa1e\xd6\xde\x8f\xea\xdaZ\xdcwp\xb8\xee\xa5\xa5\xa5[\xefM\
+\xfa\xb8I\xa3\xf3\x9c9>\x82\xa7\x9a\xea\xf3ht\x04G\xbe\x08\x91a}\xc4\xe9\n5\
+\xcc\x8e\xa3\xf7\xcf\xb4\xad[\xcc\xf8\xf5\x0b-[y4\xb6\xd3Z\x83\t_\xe23\x99\
+\xb0+\x06U$0W\xf3\x8a\xc5\x97E\xba>\xf5\x7f\xaf\xbd\x19\xb7%\xe1\xc4M\xef\
+\xf1XA\xf1Cf\x80\x15C\xf8\xe6\xe6\xe5%\xcc\xc0\x98P\x1aAR\xd8y\xe6\xf3Q\xd6\
+\x1f\xee\'\xf8\x05\xbfw\xd3S4\x0e\x9ai\x85\x9c1\xf8jhb\x92\xb9.\x96\xac\xca\
+\\\x05".\xd5f\xa8\xfe\xcb9:\xd2\x03\xdf\x8f;hH\xf41\xb8\xcf\xab\x11\xe8\xe7h\
+\x0f\x01=\xfdJ\xc9\x848Bp\xd4\xc1~\x0f\x98\x90\xf6\xaa\xb8}c\x99V\x8fw\x98]_\
+\xe5y\xe4\xde\xb4}J\x1bU{\xda\x18O\xfe7\x1b!\xbaU\xc7\x85\xaf\xb5"\xab\x83\
+\xe0\xee\xeen__\x1f\xe0Zb\t\xc4\x80\xf1\xba\xfa\xc4i\x03\'\x80T\x8f\xe4\xcf@\
+#\xfe\x99\xa1\xd6\n\x86\x87*\x02\xd6Kd?\x0e\xab\x8f\xd2\xd3m\xbf\xe5\x01\xf5\
+c\x1c\\\x8f\xea\xde\xa9\xd4\xef>\x87\xd4N\xb7\xa4\x97^\x02\x93\x8e\xb8U\xbb\
+\xa0\x885\xb6 \xe3\xc7\xab]\xd2hB\xc9\xdeT,\xf4\x8dw\x00\xdb\xfd\x0e\xc4}\
+\xa9\xa8@l=\xc6\x05\xdd\x88\xab\x06J\xf2\xfe\x19\xb3\x08\x9a\xe6\x10\xb23Q\
+\xaaw\x1d#\x05\x8bn\x91\xd8\xbd\xed\x8e0$032"/\xa6\xa5\x18\xf8~SJyw\xeb}6hem\
+=}|\xbbR\x1e\xb8\xc0\x05D\xa7u\\j\xc0Vfh\xe3\xa5v\xc0\x85\xc2\x8d\xf4\xb7\
+\x1b\\\xe6\xb4\xd9\xbcg\x91\xbd\xdfi\xda\xe9\xd5\x0f~J\xefx\xbfr[\x18\xf8\
+\xcbr\xb6\x81\x837t\x94z\x9c\xe2PO\xe9\xb8\x07\x89\xf2\x99?6`c\xc1\xdd|\x06\
+\xef\xe2f\xddI\xcc\xc4U\x9fE\xe4\xa0+\x7f\x8f\xf3\x0b0\x12\xb5\xf7\xbd\xbb8\
+\xc8\xe1\r\xf0\x88\xe45#\x8a\x99F\xa3\xea\xf4<*\xfd#\xd3\'c\xbe<\x12W\xa1\
+\xdf`\xc3,\x04U\x1b\xec\xb5\xef\x1b\x18\x08\x92\x86\x93A^\xa1\x99Y\xe8\xf5\
+\x16;\x7f\'\x08K\xd3\x1d\x1b\xb1\x19\xebS_\x1bWB\x17\x9b\x1f\xd0$\x1b\xd5 \
+\xd8\xd6z\x1a]q\xf1\xa9\xb3\x9fSvuR\xd8\x94\x89\xd1\xc9\xa8Qd\xf3\xa3\xc3d\
+\xdcS\xd7\xa7\xce\x02z?\xf2\x94\x97\x1d8y\xd8\x88C:W\xdef\xceH\x04n\xfbvY\\-\
+\x0e3X\x87\x04\x10S\xae;I*;\x9c\xff\x0f2\x1c\x0e\xcbR:s\xcd\x17\x04T!GS\x83\
+\xf6q\x15X\x17F\x93\x12G\x9b\xee\x0b\xf1\x80P\xcb:\xfb\xf5\xf6\x80\xaer\x93\
+\xaa\xda\x82\xf8\xf4M\t\xc0t\xa6\x86\x01\xbe\xa6\xcd\xa0j\xca\xaa\x8b\xfcEKG\
+\xc7\xd2\xb2x<\x07\xc8c\xbe\xbf\xa9\xc1\xbd\xc1\x07\x07\x07ssZ\xb1\x03\t\x89\
+\x89\xf5oa\xc7_9\xbeh\xfcw\xdd\xaf\xad\xacl\x7fw\xabH\xec@\xddy\x90OB\xb7\
+\x94\x08\x85\xca\xed\xd4\x11\xe0^|||^__\x01\xb6k\x13m\x03\x80\x94\xd2\xef\
+\xa5f\xd6\xa4\xd9\xfd\xd2\xc4T:_\x89\xc1\xda\xc6&8\n\xf9\x9a\x88\xf2\xe1:[OO\
+\x8fw\x7f\xa2q\xd9\x16\xd83))\xc9r"K\xd4\xeb\xee\xb7z\xa9&K\x92\x84\xdd\xed\
+\xed\xad\x0e\xbbV\'\x7fw\xb7T\x00\xf8e*\x143<\x1c\x155\x1c\x15\xd8uuu5<<|h\
+\x88\xf9z\x8f\xa1\x90\xae8\'\x0c\\\xa8\xfe\x8d\x8f4}l\xce\xfc\\\xbd|\x96\x99\
+y\x08\x9d\x88\x03\xa0\xe6HBv\xb8\x94\xa1(\x12^\x85\xf9\x14B"\xf17\t]]uuuCCJ3\
+\x8a\x9c\xd1\xcc\x9f\x19\xdd\xa2\x9b\xc0\'\xc8|\x8a4\tG\xd1K\x193\xe3y/ @)x\
+\x11\xef}4\x93\xb1BV\x8d\x84\xf7\x1a\xab\xcfg\xd7T1rw\x94\xfc\x85\xf5\xee\
+\xcb(\xd0\xbc\xbemz\xf0\x8c\xc7\xa6\xb7\xbb\xbb`\'\xa3\x95\x1d*::\xe2\x92\
+\x99\xba\xf6\xe0fO\xd8\xaa\x9d\x9b\xb2r\xcc\xc0viy\xc5\xf6].g\xbaJ[\xfb\xe9-\
+\x80\xb1@\x13\x17\xfe\xdaP\xb9\xf5\x07\x85\xce\r>\xb8\x13\x94\xe7`Be>\'\xedv\
+#Br\xee\x9b\xf4\x01\xe6\x8a\x8f\x8f\x07\x03\x98\xef"\xb4\xfax\xbd\x9f\x9e\
+\x9e\x9e\xc2\xa6S\xeb\xb2\xf8\xef\xef\xd2\xdf\xb7\xb7\xb7\xeb\xfd\tll\xccc\
+\x0c\xa1\x96UB\xcb(Ee\xe5o\x1f\x9cI\xb9\xd2\x8f\xf2g\x81\xfe\xfd\x12\xf5r\
+\xd5\xd0H\x00\xa0\x87\x89\xa9\xd3hdh\\RqB~\xf0K\xbe2I\xae\xf7\xb5\x80\xbd\
+\xf7\xcb\xe5\x0033\xb3\x11\xd9{b\x0c\x07\xd6\xe1\x86\x14\x9f\xef<\x98\xd8\
+\x98\xc0\xe7\xc1\xf7\x98\xfe\xd1\xa6\xde\x1a\x8f66\n\xd9psP\x83\x81^\xf0\xc2\
+-\xb103\x7f[\xdc2\x9f\x9f>\xaa,\x15\xf7\xbd\xea\x1d*\xf9\xa6\xb61\x88eS\xde\
+\x92\xef\x8a\xbc\xdf\xc1#Eb\x1d\xa5\xa8\xa4\xb4\x110\xc8"\x917.2cC\xe5$\xf5\
+\xc6\xbf\xb9\x99k\xdcn>\xae8~\xbf\xee\xb7\xbe\xe90\xfaIi\x83\xf9\xd7\x07?_II\
+\xc9\xbd\x97G\x8a\xd8\xe2?\x85\xefYY\xd1\x13\x0c\x89\xf2\xe1\xf9\x959R,-\xf7\
+gf\xe7\x86\xcdj\x01\xc1\x01&\xd5km\xdd\xf9\xeed\xb1T\xa3\x984Z6Minfffe%\x03p\
+\xd7\x14\x14k\xf3\xf3aE\xe5K\xbf~\x01\xf1Y\xadU\xae\xc9bT\xa7Z,\xe9\xf4\xbc\
+\x19\x08\xc7\xa6R\xfd\xf4\xf7\xa9\xab\xab\xeb\xe4$\x83"\x85\x95\x9f\x83\xf0\
+\xea\x84Q%\xe3\xf7\xef\xdf\xfaM\x0e\xb9f\xe2\xbd\x08\x1c\xee\xee\x8e\x16ZE\
+\xb2\xe5\xe1\xbc\xfd\xf4t\x0c;\xbb\xfb\xbc\xa5\xd7\x1b\x1b9\x03\xdbi\xe2~b%T\
+@`Ma\x86/\xc3Q\x91\xd7\x95\xf9swo_\xc2(\x16OY\xa1\xa3\xa1\xd5\xd6\xd6\xedh\
+\x14\x17\x15\x1510\x16\x1b\x89\xfeY\xb6E\x16\x17\xd3\xfe\xa2\xf7\xce:\xaa\'3\
+\x16\xa2j\xd0\xe2\xca\xce\xcf\xef:%\x1d\xc9%\x93\xcb\x19\xfc\xee\xf8\xd2\xfd\
+\xe8\xf8\x88\xd3\xa055!\xd3\xf4\xb4V\x16\xccD\t=s\xab\xab\xad\xeb4_[_?wj\x16\
+\xe2\xcc\x80\xd6>\xe2\x83<|\xd6\nG\x92\xb7~\x12\xed\xedrs\xbe\x8f\xe1\x7f\
+\x13|+\xb9\xea\x8ci\\?sl\xf6\xd4\xe7\x08\xebq\xbc\xdc\x92I\x19\x91\x01\xe7\
+\xe6\xe6n\x8c\xa2`b\xbe\'\x8d\x16\x15\x15\x9d\x95+\xf7\xf2\xf2j\x13;\xbf\x98\
+t\x00\x83{\'\'U\x9d\x9d\x9d\xa5\xa4\xe0\xb4\xeb\xa7X\x9e6)\xc5F\x07\x07\xdd\
+\xcd\x86\xae>\x1aS\x03)1B\xc8\xf9\x8e\xb8U\xc8r\xfc\xff*;\xf3o(\xbf?\x80#;\
+\xd9\xc3g\x103dK\x0c\xd9\xb2\x8f\x06Iv1Ih,\ta\xca\xd7\x16\xc64\xf6!\x8c%\xd9\
+\xa3O\xe5\x83$YB\x8c5\xa5\x1a\x92\x9d\x06#c\x1fC\xb2\xcf|\x1f\x9f?\xe0{\xce\
+\xf7\xf9\xe1\x9es\xcfy\xces\xee\x0f\xef\xf7\xbd\xaf\xd7}\xde\xe7^Il\'\xa1\
+\x8aW~\xa13\x83\xffO\xb3\x1b;v\xae\xe2\xf3)\xb5\x0f\xbf\xdf\x9a\xaaz\xbc\xf5\
+\xb6\xb4\xb5\xcd\x18\xf8u0WO4\xad\xe4\xaa\x16x\xcfs\xff\xe1\xc3(\xe3\xc3\xdf\
+\xc3\x99\x99\x02L:\xf6\xf3\xcc\xcc\xd1\xf7\xac\xd3G\x90\xd6\x1f\x8cs\xeb\xa2\
+\x10Y\xb4Y\x83\xb3\xfc\xec\xa7\xfa\xb4=\xb42\xd0\x1b9l\xfd\xb6b\x15^/\xb2\
+\xb9J\x92\xc8\x93R\xbf\x19\xe7z\xaf\xb7)\xa1\xd2\x97\x0e\xae\xc2\xca->\xbe\
+\xe2\x15%\xc8\x82\x1d@\xdb2{\nW-\x00d\x1fBu\x8e\xc0!\xae\xbb_Z\x00\xa9K\xed\
+\xe5l-\xcd\x94\xd0\xd5f\x1d\xe9\xff]\xf6\x90\x1f\x8dtr\x08t[k\xb93zF\xf4\x0c\
+dU\xb5\x1c\xd5\xa7"\x8b\xd3\x12T\xc5\xca\x16-\x12\xe0\xd5r\xeaFI\xbd\xdeL\
+\xde\xdf\xd3}Y\x87\xd8\x04\xe2\xdb\xae;\xf7Iq#Ud\xe5_5K\x8a#\xdc\x17%\x14\
+\xf5\xfe\xc6\\\xba\'\x8e^\x8br\xafb\x95\xe8"\tI\x0bG=m\x06Y\xc4\x9e\x93\x14d\
+5\x83W\xa7\x93\x01\xafp\xc4\xda\xe8\x97\x8e5\xed\xec\xd4\xe0\xa3\xa0$s\x90\
+\xf5\xf4\x170\xbb\x86JrP2\xe7:Bq:\xb5\xf9\xcc\x82\x8cY&\xe7>\xaa\x08"\x97F\
+\x86\xa9?Up\xd7\xbf\x9f\n\xd1^\x90\xa0\x867c\xb7K\xab^\xe0\xa7\xd4}\xf5L\xe2\
+\x13\xa0\x8aL\xe3\xe2\x90y\xedfu\xe6\x7f\xc6\xf4\x99\r\xc4\xbd\x17\x9b\x82IF\
+1\x93\xa1\xa2\xe9\x9e\x1f\xa4h`\xe6|8<n5\xaeCPmrrR\xdc\t7\xc2LMN\xd1)\xf9\
+\x93\x86\xf1\x91\xe3u\xfc, \xb8k1\xec\x17I4\x19\xe7e\x8d\xce\x0c"(Z\xa4\xc7\
+\xdd@\xa00\xf8\xd08\x04\xa5\xc3]7U\'\x92\x8e\xbbn\xf8\xe9\xb3)\x1dy\xdb\xd3\
+\x01D\xcd\x10\xde\xde\x1e\x16\x14k@!=\x85\x9a\x9f\xab\xf3\x0f\xa9\xa6\xac\
+\xf1f\xcf]\xfcvU\x85\xc3i\xadvo\xdb\x82\x03>+\xfb@1\x85\x8c9\x9a\x88(3\xed\
+\xd4\xc1%\xe4\x1eq\xb3]9\xaco\xd4\nIu\xbb\x99\xab\xb2\x84lQ\x85R\x84\x92\xe7\
+*\xf4U\xda\xc3\xea\xc3\xeel\xa3\x03\x9b\xb1mJY\xd04\xb9V\x01j\x12\x10b\xa4h\
+\xb2\xb5\xdf\x96\xe97k\x96\x96\xb2!\xfd\x0b?)z\xca\xfb\xb8\xd7\x02 \xa6}\x85\
+0^y%Ox\xcds\x9bOZ\x08H\x97b\x8f\xb9\xdc\xc6\xf7h\xd0Q\x01[\x9bI\x1b\xb6\xc4\
+\xd8\xbc\x1f|)\t\xbd\x15\x0b\xf9\t\xa1}\xb1\x7f#S\xfe\xe7OX\x84"\xa4\x07\xd1\
+\xe3l\xe9\x06\xfe\x03\xd2\xbd|\xb6\xb9;Y\x13\x86i?\xb5\xaf\x00&\xcb\xf7\xb6U\
++\xea\x10~\x9d\xfa\x94#`5\xc1Kj\xcf\x12\xcc\xa0j(\ts!\xaem\xd5rB\x12$K8G\x91\
+\x9e\x9a\xb3\x17Y\x14\xb2\xf3\xf2\xfa\xee\xc9\xca\xc9T\xec\xc1\x00#\x87\x8a\
+\x9c\xaa5\xabP\xbf\xb4\x16\x9bj\xfa\x1f/\xd3P\x96Z\x16\xb5\x8d\x12K\xa3\xc73\
+\x9d\x07\xa5~u,\x16\xcd\x88d\xd3-gIiP\xfa\xe8\xea\x0e\x92K`F\xce\x80\xf7\x1a\
+o\xdf\x02\xae2v\xcb\xc5#\xe2)E\xd9p\xe5\xce\xd1\xf9qi;\xf9\x1c\xef\xd0:_\xdc\
+\x82d\x1a[\x1f\x07\x144\xee\xc5Q\xf1\xd7\xfeM\x18\xcd\x08\xfb\xb8\xd7\xd0Q\
+\x84E\x01\x92\xd4\rf\x91\xc6\xc4 \x858\xc34\xf78y\x9f\xb0\xae0\x7f\\8\x9d\'u\
+7\xeb\xfa\xa3\xd7\x17\xf5\xd6\xc3\n\x11\tBO\x98\x8c\xf8\xa0Vx|\xee\xf3\xc7\
+\xb8\x9b\xcc\x88\xa6\xbd\xcbGeZ\xb11%\x12\xeaF9\xaf2\xe0\xb1\x95\xe2\x89g\
+\xa1\xbc9.\xe5\xe7\xac\x9e\x945\x0f\xe0\xf8\xf49\xa1?\xe5\xdep\xd1\x1c~\xfe\
+\xbbgw\xbaW6\x90k\x9a\x86)\x9c\x9e{I#c\xd4\xe99|n\x96\xd4\xd8\xc3\x82Ec.\x9e\
+\xc6\x08\xe1s\xd9\xd27\x85\x85k\x98Q\x96\xf0\x1b\x7fMD0U\x8dU\xcf}\xe0\xab\
+\xb9\xbf@jR\xcf~\xef\xd8\x1b\xd4T7\x88\xd7\xdd\xbf\xad\xc8\xd7=G\xd5\x1d\xeb\
+4\xe4\xdc\xe4\x99\xdd\xf7\x12J\xdd0\xb4\x0b\x05\xd6\xf5\xea\x0c\x06\xfd\xbb\
+\x15$Hz\xe38\x15\x8f?M4T\x13\xa5D\xd0\x80\x94O\xfa\x8f^\xf1^\x9ak\x8d\xa8\
+\xed5\x87gk\x9b\xf5\x19x\x13\xfd\xce\x07F\x02\xe3\xdd\xfa\xda\xb6?\x08W\x98]\
+\xc0H\xabsF\xca9m\x11\xb7O\xff\x16\x8c\xf8k\xc4\xef\x1d\xaf\xc9\x82\xb1e\xea\
+\x14\xda\x0b\xc1\x9a\xafj~g\xf7\xfc\xed\x9e\x83Ocu\x0e\xf5\x8e\x84\xdb\t\xe6\
+\x9e\x05\xc0+\x80\xd3x\x91\x91R|In\xaa\x1c\xba\x1cG\xf6\x0b\x1cDW\x95<\xd2\
+\xc6d\xaf\x15\xf4#\xa7\x81\xd3^"SB]\xd0\x8c\x9e\xbb]\xa0\xb6D\xa8\xaeV\xac\
+\xb8\x04\xd6\xb9\x9f4\xae\xcc\xd2\xdd\xb7\x8cm~\xb8\x16\xb0\xc5Xf\x1f\x94\
+\xc1\xf3\xb1\xc4z\\\x04Y\x7fE+O\xb9\'\xe6\x17\x05\x1c\x16-3+\x88\xf1\xd4\x84\
+q\x82Z\r\x12\x939\x13<B.\xcd\xe7_\x11`o\x19\xe4\x8d\x023\xfb0\xc5C\x88h\x14\
+\x04\xc5\x1dw\xeb\x18p\xe5\xcb$\xd5+IC\xe1=P\x8d\xbag\xd0\x10\xa2\xe4E+\xb9\
+\xf9\xcd^\xb6\x1f\x1bbn`tD\x02\xfa~&\x91\xd6\xd6\xec co\n\xf7\xcb\xc9\xf9\
+\x12\xa9~OI\xef\xbb\xc9\xa1\x95h+\xea,MW\x9e\x8f\xdf\xb2\\\xa4C\xf1\x05\xb8\
+\xa7\xfa\xf44\x810~\x93B\xc5\x9a0\xf94M\xf1\xc5\xdc\xef\xf7\xd6`\xde\xc4q|\
+\xd6;\x8f\xa0\xa5p\xdarT\xc2d\x12\xfak\x11\x7f;T6\xb6\xb7\x9f1\xfe|\x1c]^\
+\xa5\xb5\xa8\x1c\xf9djL\x87\x11<\x8dh(9\x8aZ\xceO\xaf~\x85\x19\x8c\xa2\x96|P\
+\x11!\xcei\x86#\xdb\xaf;\'\xea\x90\xa6\x1ax\xee\x1a@XX\x920&\xf9\xfbE\xac\
+\xe6\xf2\\\xeeLd\xdbh#i\'\xd1s()lV?qE\xb6q\x02\xbc\x9c\\\xf1\xcc\xda\xa4(O\
+\xd7\xb2.\x18\xdevD\xc0w\xe6\x87\xa7\xd0\xb4\r(\xbd\xbf.\xff\x1e\xe9=\x82pY\
+\xee\xa1<\x95\x8f\xd4St`]\x8b\xc4\x81\xd2\x88.\xa1>\x0cJ\xdb\xa4j\x90G|\xe9\
+\x92\xd5\xfc\x1fB+\xd8\xb2S& .\xfcG\xc5\x8eRdcE"D\xb53.3\xc5A\x1d\xce\xba\
+\x8c\xfa\xf6C\xe6n\xaf\x96\x92\xcd\xdb\xe9\xd3\xf7\xb1M\xc1\xe1\xe4#\xb1\x07\
+W\x02\xc5\x07\xc5\x1f S\xf5\xa1l\xbd\x1c\x82<\xf1\xf3\x01BBTd \x17\x07\xe6\
+\xa8\x13\xcc\x16\xfa\xc3*M\xd8\x13\xa3\x00\xa5;\x87`\t\x88\xba\x1c3\xd3\x83\
+\x02c\xa8\xafD)\xc2\xd9[\xefT\x84\xde\xd1\xd3\xd5\x19MP\x0c\xa9\xef\xd2\'\
+\x82\x06f!\x86k\t:\x08\xef\xaaEA(\x84\x85r\xd6\x86\x0b\x95\x87[\x85\x183\xeb\
+\x94\x97\x04\x12\xbe\xba\x83\\D \x95\xce\xa4o\x1b\xfb\xc1x&\xc7\xbc\xb2\xdb\
+\x97\x859]\x07\x1f\xfdI\xbf\x11B\xe7\xb8\xe0\xb7\xfb\x9a\x8d\x82\x1e|\x14Fu\
+\xfd\x7f\xba\x93cc\x0c1\xcd\x94\x14\xbbH\xae\xfcR\x16\x99\x16\xccw)\xcd\x82\
+\xaa\xf0/\x8d\xdb\x12kW\xb8\xe2IW\xf3\xd9\x96\xf4"Vh\x19P\xbe\x0e\x81\x19&\
+\x13]?\x0f\xec\x0c\x8c\xdeQ\x96\xee5\xaa\xba\x9a\xe7\xd2\xd8v<:\xa5\x9c\xfb\
+\xd9\xbf\xae\x9dA?\x1c{}\x0b`\xab\xc8\xdd&}4\x1d\x8d.)(\x00\x89\x8aFm\x92\
+\xb1\x83"a\xbb\xef\xc3\x19A\xbbD\x06\x898<<\xec\x88w\xac\xbe5\xda\x100\xaa+\
+\xf98\xc4g\xef\xe4\xff\xc2\xe7\x1fJ\xae\xe9\x1b\xc0\xe2k\x1cC\xeb=8\x88R\\\
+\xc1w\\^npA\xff\xa25\xaf\xae\xac4\xb6\xbd\xfdU\xbe\x8d\x8c\xfd\xd9t\x8a\xc8j\
+q^M\r\x1d<\xa6zr\xf8ja\xb0\xbc\xfc\xb9\xa0H\x9f\x81\x80Z\xba\xff\xe4\xef\xa5\
+\x9c\x85\x1ck\xe3\x98\xb9;\xc6\xc7\x13\xb3\x83q\xdf\xca\x1eVUW\xb7\xb5\xb9U\
+\xe0*\x0f\xcaW\x06\x16\x1d\x95>)\x01\xe9\x07F\xf0\x1au\x00\x0cNe\x8c\xa1}|}\
+\xe6\x8bj\xdd\xd7\xf9]\x12\xb1~o~}Y\xa6\x94\xc4\x04}\x9c\xd278\x1b\x1e\x10\
+\xb0J\x8c=\xb8\x98\xf1\xd1PG}.@\xfe\x03\x0f\xe8\xe6 \x83\xe1{\r\x004\xd4\x95\
+\x8dG\xd3\x00\x98\x15\xa2\xeb\xfe\xba\x90r\r\x96\x95\x9bU\xdc*\x13\xfe\xf1\
+\xb1\x94\x87\xd3\xf5ed\xa8r\xae\xffI1\xc0Y\x98\xbf\xbfr4\xe6\xed\xba\xcf\xa8\
+\xeay:\xab\x14+M!\xda\xc8\xc3\x1e\x05(\xbe=`\xee\t\xa6\xea\xbe/o\xd9\xd8\xf0\
+\xf1p\x1c\x97\xbd\x13\xf1F,y\xf4\xdc\xc6\xa5\xe2\x9cv+\t32O\x06\xc8d2m\xb8\
+\xd0\xe3g\xda\xa9\xbc\xd7j\xbd\n#\xfe;\xa9x!\x81\xbb\x98&+\'\xd6\x81\xcf\xfd\
+\xec\xb9\x8e\xf6\xa8!\xfe\xabV\xcfv@\xef\x82\x07\x1f\xd1\x19:\xbeu\xa8\xba\
+\xa5Kh\xd4\xb0|\x96\x8bt\xb0\x90\xbd\xb3y\xa3{\xadN\xe1W\x19\xad\xa1\xd5\x1d\
+\x83\xa6\x9d\xa8\x0f\xddso\xc2n\x9c\xe1f\x0b(\xb5\x8bk\xe3\xcd\xfe\x8e%\xb1\
+\xafU\n\x01_\xcb[\xb2\x8dc\x89K\x16\xe1f\x8b\xb5\xaf\x18Z\\X\x08)-"R\xaa*\
+\x8d7Bt\xb9q\xdcO7/\xf3\x9a\xf4H\xe3C\xc7*G\xfcK\x89I\x8e-\x97\xf1\xb7a\xad(\
+\x9eo\x8c\xe0\xef\x84\xabq3\xf8\xd3"M\xd0\xc0.\xcd\x82\xc3\xccd\xc0|\xdb\xff\
+\xbdl\x87\x9a\x0e\xb5M\x11\xd1!O\xe5\x0b\x0b\xbd\xe4\xae\x9f\x08\x94\xf1\x9b\
+\xcd\x9d\x7fqM\xf5I\xd5\x88\xbf\xdd\x06\xbb\x02C\'\x00\xc6`H\xd4?~ u?\xc1\
+\xadb((b#2\xc4E\xd0>\xd0Me\x1b\x81h\xad\xd6.<-\xcc\xdf\xc3zd$\x88\xd1U\xd1\
+\xd2:\xd9\xf5\xe66\xd0\xad\xe5\xf4\xecR\xbe\xe5\xe1\xea\xe4&\x07\xa6\x88\x93\
+z|\x92\xe3\x7fuS\xb6\x01\x7f\x14;#vCE\xd4.\xf1\r\xd0\xd2\x0c\xce\xc9\xd3\x0f\
+\xba\xda\xda\xbev\x8c\x7f\tvm\xadfH|\xda\xa6\xf3\xa943\xd0\x17\xd9\xe9\xa6\
+\xa5c\x1c\xf7\xcf*\xe2|>d\xcf\xa0^w/\x87jtK\x8fw\x02\x81\t m\xe2Ab\xc1\x01ys\
+\xa4x\xc6\xa6~BRB,@\xbb\x10\x96\x15\xd44U4c\x93\x8c\xe8l\xa5\xef>q_\xd1\x1dc\
+\xbe\xa3\x1f\x0eS\r\x0b\xfcj\xe5u8\xf5\x10\xdd\xf1\xf2Y;\xb3\x9a@\x90\xca\
+\x8d\x16o`\x12\xb3\x93\xf4\xd2\x93W\xb1\x84\xbf\x8b\xfazr\xa4s1u\xcd\x1bT\
+\xa4\xf6\xcf?E3\xdf\x00f.z\xde0\xe0\xaf]\x088`\xb3I\x08UJ/b|.d/\xda\x08*\x83\
+\xf9e\xbf\x8d\xcf\x1f\xbe\xf7\x88\x89\x89\xd9\xfa\xa4\x16 l\xbd@\xcb\x93z\\\
+\xb0\x11;x$\xfa\x05\x18\xfa\x8b4;\x9b\xa7z>\xfb\x15\x03`\xf9\xdc\xcc|(\x9a\
+\x1e]cNi]\xb1\xb6\xb5MZt\x81\xc7\xe3\xcd2\xd9\xd9kM58\x19\x92\x92 ((}hhH\xe3\
+i\xe0\xd7\xc9\x86\x16\xf1\xe2\x9a\x01s\xb8\xbd\xbd\xbd3ndu\xc7\xa6\xd4\xe8\
+\x18\xf3\xee\xddd\x01hB\xe4\x06\x80\xcc\xbd8\xb1\x18#RW\x02\x8f\x98\xb7\x9a\
+\xf8v4_!_\xc25\xee\x94\xa1\x9e\xf8\xa4$\x8a7E \xcb\xb9\xa2\xaa\xd2\x90Nz\xc8\
+hE\xa2\xcdlm\x89\x19\xe8-r\xe4\x83l\xd7oE\x1bo\xc3\x95r\xaf\xa6;g\x17\x17?X\
+\x9f\xdc\x9c\x9d\xf5tp\xc0\xb7\x12\xef\xbd\x0f\x81U\x8c\\+\xd6\xd3\x02\xab\
+\xc3\xaa\x86\xde\xff[8\xcbo\xb0\xc9$wr\x07\x90t\xcc\xef! ]\x01 \x07\xc4\x8e\
+\x1d\x8bI\xee\xea\xee\xee8\xec\t\xa7|\xb5.\xd8\xaaQ\x02\x02\x99\xbc\x9a\xc0\
+\xb6n\x83\xc8dP\xa8\x13A\x99~\x81\x92<\xd5s\x1c\xeb\xd4O\x8fN&\xc1\xd6\xf0\
+\x0b\xf9\x0c\x1e\xd7\xc1\x8d[@\x04\x96\xb1\xad\xffl\x98=\xe2\xff\x1f]\x06\
+\xff^\xc2\x05\xe3\xfe\x9dd\x01&\xe0\xb14\xb3\x81\xbf6\xf5|\xf4_\xee\xf7^\xe1\
+' )
+
+def getGameraSplashBitmap():
+    return wxBitmapFromImage(getGameraSplashImage())
+
+def getGameraSplashImage():
+    stream = cStringIO.StringIO(getGameraSplashData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getGameraWizardData():
+    return zlib.decompress(
+'x\xda\x005@\xca\xbf\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00\x94\x00\
+\x00\x01<\x08\x02\x00\x00\x00\xa9f\x0f\xb4\x00\x00\x00\x03sBIT\x08\x08\x08\
+\xdb\xe1O\xe0\x00\x00 \x00IDATx\x9c\xec\xbd\xef\x8f\xe3Hz\xe7\xf9!\x15\x94BR\
+(\xc5\xccdU\xa9\xab\xd5\xdd\xd93e\xbbm\xb7o\x1aF\x1b7\xb8\xdb\xdb\xf5\x01\
+\xb7\xc0\xe20\xfbj\xf7\x80}q\x7f\xd8\xfd\t\xf7b_\x188\x03kc}\xb81vl\xcfy\xda\
+\x83\x19\xbb\xec\xa9\x1e\xe4tgO\xab\xabUU\xcc,ffH\nI!\xf2^\x04IQ\x14\x95\x95\
+=c\xdf\xf9\x80}^dJ\xc1\x88`\x90"\xbf|~|\x9f\x87\xde\xf8\xbf\xf9m\x00\xf0\xc2\
+\xdeF\xfe^\xaf\xf3\xb9<R@ \x87\xfcW\xf9\xe7-B{#`\xf3\xf0J>\x12\xc1\xd1\xcb\
+\xd5\xe8d\x05\x02\xdf\xaa/\x02\xf9\xbb\xd5\xae>\x1d e\xf9\xff\xcdJ\xbf\xa1\
+\xb8\xd5RYp\xd9\xd2()\xcbZ\x87\xfd#m\x9c\xe1\x9e\xf3\xffS\x88p\xff\xba\xf6;\
+\xdc\x9c\xb5\xd7t\xd2\xb3\xacg\x019W\xdfh"\xaf\xed\xb9\x0f\xd9*\xfb\xc7]\xe2\
+?O)\x8f\xf7\xd7\x94l\x95\xfd\xcaS\t\x95M\xdbt\xa3`\xd9\x93\x97\xed\xa3\xd3\
+\xde\xe0\xd5Q\xe6\xcb\xa3\x10\xd8\x88\xf6\xa1a-\xbb\xaamM\x05\x80oA6\xf7\xaf\
+~\xad\x8e\xadmz\xa3\xb8\xb1\xe5\xa8;\x16y\xf7\x1a\xee\xb3\xa3\xfd\xc3\xfc\
+\xd5\xa4\x15\xb0Y\x1f\xd8\xd6t\xba\xee)\xc2\x0b{\xfePM\xde\xe9\xcb\x91\x0c\
+\xc6\xb2\x1f}\x95\xca\xdfj\xab\x9f\xa1\xfee\x8a\x06\xfc\xe6\xd5w\xb7+\xa3\
+\x0blX\xdc\xb9\xa3\xee\xaf\xb0\xa9Ul\xda\xb0h5u\xab\xb6\xd7\x16\xf0\xc6\xfe\
+\xfb\x9bj{tkk\xd1m<\xb4C\xf3\xfc\xbf)\xe2\xf6\xfah\xd9z\xa7wy&\xcd\x99M\xecR\
+\rd\xf0\xed\xd6\xe0\x01\xd0\x96\xad\xfbO\xe4\xban\xcc\xa6U\x19U\xfb\xba/\x1b\
+\xb3\x01\\\x1f\xf7\xb9af\xd9:4E\xeb\xc0g\xa0\xd5\x06\xd8\xach\xb5\xd9\xac\
+\x9a\xfb\x1c\x9a\xea\xee\x99\x1b\xc6\xee]\xden\x8f\x8d\xed\xfb\x8dw\x0f\xb9C\
+\x84\xca\xa6\xc3t\xf9 \xbb\x8c\xc4g=\x7f(E\xd8Q/\x82`\xae\x82\xd1F,\xad\xd9t\
+D\xef\x9esm\xc4\x926-\xdb)\xbf\xb6\xfc\x86g\xf8F,\xa1\xe8\xd6c#\x96\xee\xf3\
+\xe6h\xd9\xb2\x1d\xb7\xb5\x94r\xb6\xe6\xe1\x87\x96\x01}q\x04\xc53=\x7f\xb23\
+\xb37y\xfb=dfo\xb6\xf3\xec}}\x83\x88o\xd8\xde\xb4\xc9\xed\xb1*\xadn\xb03\xe2\
+\xfaQ{\xf9h\xb3\xf8M\xf9\xf5\xb8\xd7\x1d\xf7\xc4\xa8\x1b\x88\x96?\x10\xad\
+\xce\xa2\xa5\xfa\xf7Z\xe8V\xbaw~}c\xb7\xee\x9d\xa3\xde8m\xadC\xe3C\xa6{\xa0\
+\xfd>\xf3\xdc1\xed?\x91\xbc\xe1HE\xeb\xe5\x89g\xdfI\xd7g<?[_t[\xc1\xb7\x19<\
+\xf0d\x0b\xffm!r-\xc8\x17PUI\xf6$m\xba\xa0|Kj\xf3\xb1\x8dC\x1a\xa7:4g\xd9\
+\xb96\xb0\xda\xcd\xb7\xf9\xd6\xb2O\xe3\xc2\xbe\x91x\x82lo\x9d\xfb\x8d\xae\
+\xa5\xda\xeeUv\xbd\xdf\xb9\xba\xc9\xfbU\x17)T6}\x1c,\x07b6\x18\xbcz(ND\xef\\\
+\x06\xad =\x1a\xf6\x8e\x1d\xc8\x08\x91?\x8a$+\xc0\x886`\xed\xf6A\xe0:\xe4[\
+\xd9b\xb6\xa5u\x08%\x84\xd8HVF\xb4\xdd<n\x86\xc69\xb7\x13V\xa7\xaa|\xde\xd9o\
+\x01\x92n\xf2\xe6>{\xf2\x86\xad\xb6\xbeU\xb2\xc2\xee\xf5\xb7\xdb\xce\xdb\x96\
+\xa0\x07\xb0\x9e\xbb\x86rH\xb5\x9b\xa1-\xf7\xd4`C[\x06\xc2\xb4\x00\xa4\x99\
+\x03F\xf6\xa4\x99\xe7\x13\x16"\xae\x1f\xb5W\xe3\x96:#\x18o.\xc6+1\xeav\x8eE\
+\xab\xe3\xb5\xd4:\x90\xebt\x07%D\x8b\xce&\xb7I\xd3\xbd\xc3\x14{\xed\xfb}\xb6\
+\xd2\xa2\xbfayG\xff\x16\x1d\x08\x8a\xddQ\xd95\xbb-\xf5\xfd\x96\x03[[\xaby\
+\xfb\xa8\xd8m\xdfn\xdd\x1cp>\xb4\xe8\xd7\xb6V[\xdc\x1a*\x7f\xd3\xbd\xc9\x81\
+\xfe\xde\xae\x83\xdd\x0e\xb5\xaf;\xb2A\x00-\xbcr\x9eRD\xeb\xe5\x89\xf0\xdeKg\
+\xeff\xc9x}1\xe8\x9e|\xd7\x93-\xafM[\x8cSA\xcdzL\xa9\xb7\xdc-U\x04\xcbg(n\
+\x9a\xc6\xa9\xaa\xd8\xe8~\r\x8f-\x00z\x95n\xae\xc3\xfe\x0c\x9e\xc0\xf9\x08<\
+\xdb|\xedx\x95\xdf\xb9\x8aW>@\x03\xe8e\x95\xad\xfb-\xee\xb9P\xfd{\x87\x87\
+\xc2\xe7\xae\xadw\x8c\xe2\xc0@q\x92]G\xfc| n\x07\xadW\x0f\xc5\x89\xd8\x9c\
+\xcbM\xab\xcbq\x9f#\xe3-\x00\xb9\xd9\xde\xd4\xc2\xdf\xba]l\xaa\xab-\xeek\xad\
+\x9b\xf5\xb5@!\xa8\xc2# \x03\xe1\xc0\xc4!I\t\\\x96\x96\xb1_\xd0}(\xd7\xdd\
+\x1cZi[Z\x80\xa0\x80V\xff\x1a\x1f\xec\xb0\x9c\xad\x14\xc9\n/\x07\x16\xc3\xce\
+s\xc6\xa6\xda\x14j\xb8\xdc\xac\xf2\x15V\xba\xc8@\x98u\xe5\xbbE\x06;\xa0\xef\
+\xb6\x96\x8d\xdb\xcev\xe7\xaf\xebPn\xadMrH\xaa\xbb\xde\xeeb\xcfF\x91\x9b\x9d\
+Fo\xf0\xaf\xbf\xd3}\xe7H\x9d=\x0c\xc6\xa7\x9d\xb1l\x8f\x1ev\x8e\xdbY\xdfv\
+\xe4\xe3\x96\x04\xf0\xb9\xb1\x157\x80\xc0\xb8E\x96_S\xee\xa5=\xa7\xac\xfc\
+\x03\xcf\x95{J\xca\xce\xb3\xe1\xd7\x9c\xad&\xfb\xb0\\\xdd\xc4a\\\xfd\'\xdao\
+\x13\xfc\xd6\xd0\xbb\x93\xc3\xa64\xbfo\x13\xb9\xb9\x18\x04\'\xdf\xf5dK\xb4\
+\x11r\xect\xa7l\xd7J\xcd\xf2\x91\xdb\xaf\xf7\x04\xd2\xa0\x02\x89\x8d\xe27u\
+\xa86\xb6*-\xaeO\xa3*\x08w\xe9o\r\xc0h\x012\x81_|\xae\r\xaf\xe2\xe4\xaf\xa3\
+\x1c6\xafg\x17\x93k;\xadI\r\xbd\x0b\xd8\xf4n\x07\xad\x87;\xb0i\x8fr\xa4*\xf0\
+\xd0AM\x15\x16\x1a\xa1\xf2\xa04\x1dsU\xc3\xcc{\xd5\xc0\xb0\x80\\\xc5bG\xa5\
+\xdc\xc2\xcb|\x7fZc\xefqS\x96\xb0\xe7\xf0\xdf\xaa\xed\x91\xda\x9dc\xa9!\xa1\
+\xc3\xc6\x1d\x8c\xdd\x95RQ\xc4\xd4\xfb4\xa0\xae\xdc9/rS\xc7\xe7;D\xbcz\xb4\
+\xd1\r\xdaf\xdaR\xeb\x96tH%\xc81\xca=\xe9\xb7\xd8\x95V~\x10\xffN\xdd\xf2\xb0\
+4\x8f\xaajqE\x1f\xb1\xd7yU\xb4\xdfw\xda\x03\xd2+\x86\xf4\nlO\xabkp\x9d6;\n\
+\xadW\xd5\x84\xf7dU mM\x07n\xc4\xdeU\r!7\x95\xf3\\\x1dU[\x0f\xa5\xb6\xe9`s_\
+\xdb\xdcw\xeb9\xd0p\xf0\xd2:\x80u\xf7\x94\xed\xd8][>\x15\xe0\xd0\xc9\xe2\x89\
+\x06\x95\xf5W\xdb\x9d\x93;lg*\x8f\x03\xa7\xb5V\xf5\xc3C\ng\xa3\xdc\xad\xa36v\
+.\xe5\xd0\xa8\x0c<KVY\x7f\x03lF\xe9\xb0c\x85\xd7F\xa0\x00\x9bj\xe1+\xf7\x17\
+\x90\x9e`=/\xedM\xeb\xebC\x80Y\xd30\x1b\xb7\x02&X\x94v\x8e\\w\xa1\xae\xbf\
+\x01\x82\x8d\xad]H\xb6y\xe6\xad\xe2ZQ/w:\xacV@\xbe\xc9CnV\x8d\xddT\x05x\xb5\
+\xb7\xa2\xaa\xa3\xee\x8a\xdb\n\xa8\xac\x18R"\xa1\xb1\xda[\xe5\xed\x95\xc6\
+\x86Q\xb2~1\xca\xc6\xd3\xb6k\x106\xc2\xa6iu\xfa-\xd5oIw\xff\xf6\x1c\xa4T`\
+\xb3\x8a`\xbd\xc3\x18\xb5otWq\xa3\xdcZ]w\xb3\xe7\xf0\x0eUpOD\xb1\xa3^M;\xad\
+\xee\xce\xdf\xee\xf4\xd0-\\]\xbc\x00RR\x9f\xb4i%\xa2:\xa4\x02\xb3\xcbbk\xba\
+\xd7X\x1fU>\x8cj\x10\xea\xd1\xcf\x98\xb9\xbf\xb5\xf5y\xf4E\xeb\xe5\x89\xd8\
+\xbc\x93\xcer\xdff\r6\x9d\xecC\xd6>Z\xde\xed\xa8,e\x1f\x87wf\xdb\x9b\xa4\x84\
+\xd3\xd6!\xa84\xdbn\xaeCi\xdd\xdf\'\xa0U\xea\xab\xd5\xc7AU\x11u\x1d|\x8b\'*X\
+\xda\xe4\xc0\xcc\x87\x94+\xaf\xcc\xd6\x88\xbd\x8dR\x85PU\x99\\\x17{\xacB\xbd\
+P\xd9\xf4\xb1\xd8\xfa6OW\xcf<\xffq\xdf\xdf\x04v\x04Hi\xb6\xe3\xcb\x99\x8b\
+\xf1\nO\xdbL\xe1\xe9=\xcdV\x89E\xb1\xd7\xbak\\\xd5\x8c\x0b\x9bO\xae\xf0\xb4h\
+\xd0\x90U\xd7\x03\xf4"\xa3\xf1\xfa(\x8f\xd0\xbf\xc6\x0e\xcb\xfe\xb1\x9d\x97@\
+\xb7\xaf\x1c\x96\xa8%W\r\x06{\xc3g\x91\x7f\xce\x95\xc0\xa0P\x17\xf7ly\'U\x8d\
+\xb1f\x80W\xadl\x87\x8d\xa6\x95ci\xfel\x92"\xc7\xcc*rz\xb4\xd7\xbdU0\xaf"g\
+\xa3o\xf3\xba\xd5\xe9\xb7\xd4MW\xae6\x0c\xc8\xe7\xf9\xa6&\xaa\xf3\xc85\xc0]\
+\xa3\xf9Y\x98\x8bw\x18\x8d\xde\x01\xdff)=\x87\xba\x05l\n\x10\xad\xed\xb1\xd6\
+\x1c\x98U\xd8l\x80\xf7{\xc8]\x0e\xc9\xdd\xadA\x93C\xb5\xde\x7f\xc3\xd2=\x83Z\
+x\x80\xb7\xeb\xc9\xcc\x98y\xf8\xd9\xee\xf9\x11\xad\x97\'\xd8w\xd2\xd9Y\xe9\
+\xdbL\xa1\xd5{W\x08oS\xb9\xa4\xee\x03A\xfb\xb0\x96Bk\xefv9\x14Zr\x98YW;\x0b\
+\xf1\xeb\x1a\xcb\xc1U\xe5\xf6;\xc0V7\xcb\x11\xec\xc0\xcakkf\xcf\x84g\xb7\x91\
+\x03\xe6|ukuSMKl\x94\xd2\t\xe0z\xf6\x05T\xd0\x92&\xb3\xbd\x12\x12*|\x9ba\xf0\
+\xb0\xcf\xc6k\xa3\xd2\x10\xd1`\x02W\xc5\xa9\x9d\xb9y\xbb\xa7\xb8\x08_Y\x7f\
+\xc7\x90\x97\xc5\x93Y\x17\x91F\x87\xa2\x9a\xac\xbc\x19\\K\xbb\x88\xe0\xaf\
+\x829\x0b\xf6\x919\xef,\x16\x86\xf6N8\x89\xcd6\xcaS\xf5V\xa6\x1aP\x9d\xb0\
+\xf9@jFw#D\xef7\xbaH\xd0\x1er\x1a\xac\xac\xfcz\x06\xdb<\xa1\x13)r\xa7\xa5\
+\xb1\xdb9\xbd\xca5x@\xee\x80\xcd~K\xae\xda\xa4+\xdamV\xab\x83\x8e\xc4\x94]k\
+\xbd~\x14\x88\x8a\x132\xad\xe0\xd5]!\xe9\x16\x1d\xb6\xb4\x9f:`\x96j\xa4O\xbb\
+\xc0\xbd\xda\x85\xb3\x1f\x9f\xca\x17\xe97\xab\xa0\xbf\xa6l\xe7\xac\x80\xf9\
+\xea\xdeN\xd1F\xa3\xfe\r0\xb1a\xf9\x86\x90\xd0\x1a<\xf2\xbf\x1c\xf6%\xdeS\
+\xafs\xe2f\xb8\x7f\x18\xdd\x01f\xb5%\xb0\xcd=\xef\x96\xd25\xda8\xa4\xa6v6\
+\xca\x1dJ\xe6\xb6OE\xa5|\xa3-_\x1dE\x93y~\x87\xf89l\xb2\xac\x86\x84\x06\xe9\
+\xb1\xa0\xd5g\xeb\xdbtF:`6m\xdb\xe4K\x04D\x11\x8b\xb1Y\xbd\x83J\x85i\xb5\x9d\
+\xd9\xab\xbd\x95LW\xf9\xce\xd3!eT}\xf7\xcen\x88\xaa;hr\xfe\x81\xbds\'\xf7\
+\xee\xa7\xad\x1b!\xddq#X_\x936\xc5\xb6\xac\xcaU\xd0\rT,\xeeR/\x85\n\x88mP\
+\x9d=^\x96\x03=)\xf4r\x9e\xcf\xb0k\x98\xd3\x08\xb0\xbbzi\xb5\xc3V/5v\xdf\x8a\
+\xa7\x84My\x96v\xb7\xb09\xcf\xfa\xb6#\xbb\x81t\xc1 \xe1\xd0\x0f\x80\xd4\x81\
+\xb7s\xbe\xecJ~\xcb\xbb\x0evG\x9f\x93\x90\xe6\x16\x19X\x8c@\xf9\xb4+\xc8\xb9\
+\xef\xb7\xac??\xdbh`\xb5u\xb1\xd6\x0fdo5\xa5\x91#\x04I\x19\xb7\xf2\xb1)G\x90\
+\xb6Y\x15\x13:\x97f\xba;I\xa3\x0f\xa1\x8a\xd8\xabZ\xcb\x9e\x98\xea\x97\xe2\
+\xd9\xb1\xe3\xc9\xac j9I\xdd\xd5\t\x1c\xd2ls\xd8T\xe6\xf7m"[_}\x14\x0c\x1e\
+\xb8\x90\xd0!\xdf\xa6p\xf0br\xaa\xef>\x90\xba!\xfb\xfb/\xa1\xa6<\x19\xb5\x81\
+\xfb\x94\xa1\xaa+\xc0\xfd\xcew\x04\xdfk\xd2*\x06R\x8b[\x15\xa1\x9f\xea\x84\
+\xd5\xc3\xac\xc1{\xedkk\xb7\x0f\xf7C\xc5\xaaT\xf1\xf0\xfe\xc1\xa0F)`\xd3\xf9\
+6\xb3/\xc4F\xba\x90\x10\x96V\x10\xb0\x1bI\xa7DN\t \xbc\x9e\x12=\xbd\x99\xdbl\
+^\xc2\xa6\x93\x12<]\xbb\xca\xda\x88\x1d\x0c\x91\x81p\xd1\x9c\\_-pR\xb0\xa9\
+\xc5\x89\x0e\x11\x9c\\\x8b\xf6\xefR@J\x84\xd8\xe2\xaa\xd7\xab\xfaf\xab\xbeP\
+\\`k\xf7j\x90^S\xf4\xe7>Q\xa1\xb5-\xfb\xd8T\xe7ZnAF\xaaQ\x89rY\xcf\tzy\x9f\
+\xa0gZy\xe8\xbc\xf6w{t\x8d\x04\xa4\xac\xff\xba#\x1fo\xe4\x95@\xed!R\n\xd2\
+\xa0\x01I\n:?\tu4\x93\x80AK\xd2"\xc8R;\xcb\xab]\x9d\xf0.&R#\xd1\xa8\xce\xa8m\
+\x96\xbc\x7f\xbb\xf8\xb0\xc1k\x91\xaeH\x81v\xb1\xa4U\xee\xbc\xdd\x99\xbf\x08\
+\xc1x\x9b]\x97f\xf1\xf9\xae\x8b\xa6\x18\xe5\x15\ndo/\x80\xd5\x08\x8f\xfd\xf2\
+\xef=\xec\xfa\x03\x04\xa4\x96\xff\xb6\x10^[\xd4\x15\xb3\xd2\x01\xd8\xaf\xb44\
+2\x18\xf3\xb5\x14\xe8z\x87\xbc1\xd6\x93\x82/\xf0L\xbd\xfdP\xff\xc6i\xd7U\xdb\
+\xbfp\x1d\x94\x8d-[w\x1d8\x82\x93\xa3\x15y\xbbt\xa97\xb2\xb0\xaa\xe1$\xef\
+\xb0R\xdd\xc8\x83\xdaNr\xc0\xae\xafj\xbc\r\x04\xa4p\xf5\x10y\xd9\xb7\xe1\x1c\
+\xaf\xcf\x11\xd5\xb0\x8e3"\x8bh\x8b\xdc\xac\xdc\xf5dZm\x87\x93\xc2\xeb\xb1\
+\xa9\x1c\\\x17\x95\xb5\xab\xfaj)\xc2/\xb4\xbb\xdd\x87\xf16\xb0Rhz*k\xdb}.N)\
+\x95\xb3\xe3\xbc\x9a\xfb\xed\xf9W\x91\xc3\xd1\xd6\x80\x0ch\xaf{+b\xe8\xe5\
+\xcb\xb0\xb9\x975\xdf\xe4\xcd\xdb\xf4\x9c\x97\x80.\xee\xaf\xf31\xde\xf5\xd7\
+\xdbi9\xb8\xf2\xbb%\x00\x1a\xf6\xb5m\xf7\xe6;\x04\xa4\xeex(F\xc3\xceq\xdb\
+\x19\xe9@\xeb\xf0}\xb3k)\xef|\xad*`\xfb4\xa1{\x9a\xae5-.`\xd0\xe8&\xbd\xb7\
+\xef\xf4\xffg\xd2\x18\x06*7\xb9\x0f\r\xb0Y\xfa6\x1b\x99\xea%L\xd5\xc2\xe8\
+\xb5\xb4\x9aZ\xcc\xa8\x91\x90yH\xfc\x8a^W\x95\xc6\xbb\xaf\x8aK\x87\xa8\xf5\
+\x87\xe4\x9b\xc6\xb3\xcaQ\x03\x98\xed\xea\xc6\x83b\xebm\xe5\xb3\xfbZcL\xa9\
+\xc2iY:+\xf6\x91\xdf\x13\xf4\x0f-Inm\x90:l\x9e\xae\x9ey\xf2q\x9f\x8d\'\x86\
+\x8d\xb1\x1e\x17\xc2v\n\xa1\t\xb6\x89k*kko%\xd7\xdd\xbc1\x00\x90\xeb\xae#\
+\x7f\x96_\xb19\xb8\xdd\xa1\xaa\xedQ\x8c\x00\xf4"\xdbzA+q%\x17E\xaa\x87\x99\
+\xee\x90\x92\\$t\x9b\x1e\xb0\xb2\xf3m\xbb\xd0\xce\xa7\x9a76I>\xca9+\x9a\x0e\
+\xa2]\xc9\xab*\xe7\xc9\xe1\x17\xda\xa6\x87s\xd8\x06\x00\xdaf\xcaz\xb0\xcd*i\
+\xaf{\xd8|`{?E\xab\xf2\xec\xaf\xc3f{\xf4vp\xbcr\xb0\xd9\x18\x12*\x91j?\xe6k\
+\xb9:t\xc0U\x11\x9c\x00\xae\xb3\xfb\\~\xadJ\x8b\x8e\xb7G\xf0\xfe\xafR\x95mH\
+\x88\xe7g\xd9\xa7\xe3\xd6[\xbf\x91\x82\xdf~w#\xd8H\xaf\x0cm\xbb\x0b\xbb\xd4\
+\xbe\x00\xc4\x0eqh#\xb6\xd4\xf4\xaa\x943\x94=\xab\xcc\xcf\xac\xe8\xd3\xaa\
+\x90\xc6\xf3\x81\xd4\x07Vg+\xe5\x90:w(\x04\x13\xd8\xad\x92Y\xfaH\xd7\x02_\
+\xec\\)\xeei\xd3\'\x87\x81\x1c$\xdf\x04\xd1\xfdJ\xe7o$\x0e9kx\xebd\xb0\xd7\
+\xb9\xecPI\xaeL?\xebm\x86r\xfd0\xea\x8c\x84\x08\x00I\x071p0\xae,\x08\rh\x91\
+\xc3\x8e\xca\x97\xa8\x01\x8dR\x81\xd6\x0bUL[\xd9\xa3([\xaa\x7fwE\xec\xfd\xdd\
+\x15U9\x1d\xc6\x16~B!\xd8\xa3\xb5\x97"\x0ff(\xed|v\xb3ID[\xa4\x03\xefe~^\xb2\
+\x87\xfb\xa3Vf\xeb\x0f1\xd6JQ\xe0\x97U%\xd8\xd6vq\x07\xf6\x96\xd2\x00\x8c\
+\xf7\x16q\xfd\xa8\xbdz\xa7\xb58\xcb\x93+\xdb\xa3aP\x84\x84`\xdd\x91T\xceu#KL\
+\xd5>\xd8\x1d\x9b\xca\x89\x9baP`\xe3\x160K\xb4,\xf1\xf3\x8d\x92\x15\x00\xee\
+\xdd\xcbH\x7f\xa3li\x140\xfa&\xa3\xaag\xe3\x10\xe1\xf8\x9bU\xd4\xf8\xa6\xb2C\
+@\xca>\x1doT\xd8\x1a<p\xb0\xd9\x11^3m\xaf"%z\xe4Y\x8d\x16\x0f6%#h\x97\x90Y\
+\x85\xb8\xac\x8a\xc0\x95!\xf9l\x07\x90gg\x06\x00\x0c\x99<\xa0\xad\xec#\xa7\
+\xb3|\xb7k>\x00\x83U\xa8\xcfL>O\r\'k+l\x9c\xb3\xb1\xfd\x0e\xbcur\x08u\xf71Y\
+\x9cd\xd7\x91X\xf6J\xd8\xcc\xc2\xc8\x7fW\x88@\xca\x8e\xc2\xc3*}\xe0\xca\xae\
+\xc3\xa6\xd5\x1aU\xbf\r\xbe\xd1WP\xe5l;\xdd4`\xcc7\xa8y!\xc5A\xcc4\xd6\x96\
+\x88\x9ac\xa6\xeb\xbc{\xca\x8c\xb5R\x88\xb6HW\xb2\x02}V\x01\xee\x84\x94+l\
+\xcb]\xbf\xe0\x81=\xafl\x89\xba\x9a\xbb\xd1R\x1cV5w\xe7/y\x9b\xdb\x9c\xf4"\
+\x92\xee\x03\x9d7\x9f\xb1:l\xfezr72o\xc5\x19\xb0\x1b\x96\xf7\xc7[\'\x96\x9b\
+\xca\x90; \xd7m\xf2\xefq\\\xdf4\xaep\x9f\x13u\xaf\x93Y\xd763\x15\xa6\x83\x07\
+\xad\xde\xbb\x1b\xbe\x19l:9\x04wo\x1c[\xe6\x92;;fi\xb3\xcenF|\t_N\x1c~\xae\
+\xc8\xfc]\xcc\xdc\x87\xca\x12\xc0\x9d\xacl\xe6\xe3\xd5\xba\x1d\xc2\xcc\xbeh\
+\x06\xb1*\xd7\xb4Q\xc3\xbc\x83\x80Z\x1d\xb5?\xf0\x904\xbap\xf7\xb4M\xf90\xf2\
+G\x82@\x11b\x1b\xf0\xe7\x10\x8a\x16\xf3\xdd\xb1\xed\xb0\xb6I\x85\xdc.\x00\
+\x84\xb5V\x88\\\xc5\xb5J\x0b\xc4\x9d\x1c\x9er\x9d%\x12j\xe1\x94\xedB[\xce\
+\x97\xa7\x9b/\xeabGl\xbb\x15\xa8%\xb8\xb2~\xa1\xba\x0fTW\xeb\x85\xc2V\x15\
+\xe0\xc2g[\x98\xf9n\x94f\xab\x96\x97\xd0\xbau\x088\xb6\xaa\xe0D\xdc+\'\xa6\
+\xf4\x91\xb6\xd7[^Vn\xa4\xcb\xb3\xa8;~\xb0\xef\xdbl\xcb\xfb\xfa\tK_\\\xd5\
+\x84\xaf5V\xa5j\x9e\xefC_\xad\xf1\xd0$\xdc\xcf\x93Y\x92\xc6\xef\xeeV\xf3%\
+\x96\xfd3f\xe5A\x95G\xf4\xcf\xc1\x81\x90\xc3\xa6\xbf\x0b\x9b~\xfb]!\x9b}\x9b\
+\x87\xa4t\xa3\xedgb\xd2\xe4\x96\xdc\x14\x8a\xa8g\xd9\x07g\xaf\xa0\x0b\x97f\
+\xfb\xd26D\x98%^ZQ\x05\xef\x00\xed\xbb\xb3\xc5\x1b%\xab:rw=\x99\xbe\xfd\x06\
+\xb3\xed#\xde\xa1R$\xdfT\x1a`S\x05\x81\x12#,\x91hPW\x0e\xf2\'Kg#ov6j2\xd3-\
+\xfc\xa2\xbb!\xa1<Qhg\x8d\x00\xa2\xa0\xcd\xaf\x99\x06\x8c\xd6L\x01O\x0e\x01e\
+\x07\x05\n\xddf\xe6\xda\xb5W\x1d\xa1o\\Omm\xdb/\x16\xd5\xf5\xcc\xda\xee\xeb\
+\xc9E\xca\xa7\xd70jWT\xe0Q\x81;7\xbc\xea\xf3\xdc\x1f\xb2\n\xe6zq\xe0<W\xc2^\
+\xb9\x91~{\xd6.\xb4\xcdV\xe78/\x7f\xd4\x92\xff\x08\x14\xc7v%\xb2\xb3K\xfe<t\
+\xc95\xf09[t6\x94\xb5\x9czpS\x04\xbe]\xe7\xad_4\xcdi\xa2\xeb\x02N\xbfq5\xc4\
+\xcd}\x89\x9d\xf7\xcd\xdf,VR\xab>W.\xac\xb1\xe0\x9eWc\xab6>\x1dv`\xd3e\t\xdd\
+\x1d\x12:$\x8d\x15\x8dJ\xe2P\xb9\xa27#\x86i6c\x0f\xf90k\x9dK\xdeQ\xfa\r\x03=\
+\xe5\x92r/\xeenH\xab!\x1b\xa8\x89=U\x1d\xb2\xfdz\x98\xefz\x87x\xe2\xcd4\xce\
+\x1c6GE\x96\xd0z\xf5\xf3\xe3~ A\x89\xf7\x1a\xa1F\xfbI\xe3\xce\x14mw7\xb8\x0e\
+*u\xac\xf2]\xe7\x9e\xedm\'I\x87\xdbR!\xe9\xb6.\x87\x15-\\\x92\x91\xedm\x11X\
+\xcc)\xe1\xc5*-n\xf1\xaf\xf3\xfd\xa6{\xf4u1o\x13\xad\x88\x11\r9Jw\x8b(\x9e\
+\xbf\x96\x96\x8bm\xe5\xa9F\x0e\x96w3"\xab\x9c\xa8\x92\xd5\x9fS\xfa\x8b\xdaG\
+\x86\xb6\xab\x98tH\xdaD\xee\xc3\x8axg\x83\xf7f\x9f\xe7\x8e\xb6Y+\xe5\x11\xc8\
+\x9b\x94#\x9f\x9d\xbf\xf7>\x0fo\x10\xbbKn)\x03\xee.+\xbc$U\xa6\xac$\x94\x91\
+\xa9\x16\xb7\xabJOQD\xb7\xca\xb5\x89b\xdaMS\xe4\xfd\x9b\x8a\x8b\xe6W\xc9\x00\
+\xfb-\x8d\x9b*\xa4\xd0\xad\xb4\x9b\x00y\xc3\xa0\xc5m\xf5o9\xf0\x8d\xc5O\xf2H\
+\xba?{\x97\xe7g\x9b\x8b\xee\xb6\x94\x07cO\xe4<s\xaf\xa0>\xe6\xac\xec\x03\x89\
+?wH\x9ded9T\xec\xc0%\xa1\xbb\xeb\xbf\x05\xad\x82&\xe4f\xd8T\x14\xd7\x1a\xd9\
+\xd2\xad\xed\x10JW\x15\xc52\x14^\xe6%U\x8d\xf1T0\x90\x00\xb7&\x8f\x19U\xc7\
+\xe6\'D\xe0\x99\xfc\x03\xe4\xd9\x97\xe5z\x1aY\xa6\xe5A52\xacj\x7f\xbd\x026\
+\x1b\xb9\xa3e\xcb6\x92~\x9c~v"\xde+\x93+\x819^\xcff^\x0f\x95\x86F\xd8-\x83h\
+\xdf\x1f\xd4\xf4\xf0V~\xe5\xaa\xa9\xaeX\xa7\xb0\xf5%\xea\xde\xce\x0f\xab\xec\
+\xee\xbe\xca\xc9\x0f8\xa1v\xf6R\x91\x9c\x8a\xe9\xd7\xfb\xb4E\x01S"\xc6lWr:\
+\xd8F\x82Vz\xae\xfdD\xf9\xed\x02\xabK\xf0\xefi?\xc9Y\x8c>\xa4\x95\xd4u\x01\
+\xb6wWR\x95;\x03\xb6\xd7X{\xa4A\xbc\xca\xae\xb7\x10Z\xe0\xb0\xd7c?\x92\xde\
+\x1a\x05\xf28t\xb0Y\xf06\xef%\x02S\x0b\xad\x1d\x8c\xa8\xbdI\xec\x01\xba\xa0E\
+\xef7V\xf7"\x90vK\xaa\x97nU\xe5\xa6{\xef=?\x10\x89(\'t\xc3\xdd\xe7\xf20k\x07\
+\xb8\xbf\x8b*l6b\xe6\x1beU\x01\xe1\xea\x84\xaeeK@\xaaj\x9bA\xef]\xc7\xdbd\
+\x8f\xa5s\x10!\x0f\x9c\x9e\xf2N\xbfg-\x0e\xdf\xd2:\xb0\xe9\x8d\x04\xa4*\xe90\
+(\xf6R\xe2m\xa3\xd4b1\x99aQx\x03\x9c\n\x1fXo-\xb2\xae\xf0 \xdf\xd4\x15^5\xae\
+T\xca\xba\xc0[\xe0\xd6\xc0nb\xe9~\x90\xf3n\xf1\n\x0f\x06`\x8b\xb1\xe5\xc1\
+\xda*l\xf6\xb2WQ\xfaYo>l\xa9\\\xdb\xf48\xae\xd3\xdd\xf3Bw\x07\xf6\xb6\xc2\
+\xb4\xda5n\xfc\x8e\xec\xe2\x9e*."\x87\x03\xd5\xda \xfb\xbb\xd0\xbeU\x07\x7f\
+\xed\xca\x9c~\x1b\xd0ie\r\xe9\xb6\x83\xf2\xdb\xa7^zy\x0bp\xba\xeb^=\xee\n \
+\xec\xa9d\xae_/\xec\x8b\xeb\xabW7\xb9\xf9\xf5\xe0\xa8\xeb\xe61\xab\xf4\xd6,]\
+\xcb\xa3\xee\x89\x1b\x02\xbc^T~\xa2BC\xba\xe5!\x0e\x99\x7f5\xd9\x92\xe1\xef\
+\x82\xcd<$$\xcf\xda_\x8d\xfd\xee\xb8\x15\x8c\x96\xad\xd0\x13Jtd\xb7FwoD\xad]\
+9\xc0j>\xd0\xb9\xc0d\xb3;\xb6\xf1G\x12o\xdc\xbbD\xec\x93\xb9\xaa\x10\'\x10!"\
+\xc1J\x92\xca\xa8\x08\x10LG\x8c$g\x80ez\x81\x98d_\x01\xcak\x85<\x04\x12\xa6:\
+\xdb\x18o\x11\x82\xa2\xaf\x88\x15g\xe5$\t\x06Hv\xf6\xfe\xf2\xee\xd5\xbeI\xf2\
+\x83-`\xb3\xfa5m\x17Y\x06[m\xd3K\xc6\x9b\x8bA\xff\xe4\xbb-\xd9j\xed\x96\xf2p\
+\xb2_\xb7\x8dJK\xdeX\xf9\xf9|Q\xefY\x95C\x16\xf4\xa1\xfeo\xcc\xdf\xac\xd7\
+\x11r\xca\xa4\xcd2K`=$2B\t\x14\xc4\x164\x08"\x85\x8c\xb6Ou\x0b\n4\x8c\x13\
+\x94%\xb6D\x02`2\xe5\xc5\xf3\xaf\xd7\xf3\xeb\xa07T\x8f\xdfz2F\x84(\xd0!*a\n\
+\x11\x98\x18\xa3\xb95\xf8"\xd7f\xabO\x91[\xb3W\x8c\xae\xe9\xf0\xf7]\x01\xfb\
+\xb0\xe9\t,(\x81\xb6M\xc9\x95.K(\x13u7\x95\xcb\xf7\xb1bN\x91/\t\xc8\xcdJ\x8b\
+\xcaBv\x9f{\xaa\xe4\xd8\xee\xcb\x01\xed\xd1xm\x9b\xcdw\xe6\xdf\xfb\x9d\xf7!4\
+/\xd9QU\n\x04\x98tJ\x0c\x02A\x1fu\xb6\x14\xef\xab\x10H\xe6\xfau`\x8f\xbb\xe2\
+\xe30\x0c\xc3\x9c\xb7r1\x8d\xb9\xbd\x8a\x97\xf3\xa8\xd3;{pB\x18\x91\xc4:N~\
+\x18\xc7?\x98L~\xf0\xe5\x05\xf0\xf1;O\xfe}x\xf6q8&\xccUVB\x80$\x9e~\x92&\xaf\
+=\xfbbu%\xec\t\x0e\x96K\x08\xcd\x1e\xae\x88\xebFwP\xc9\x18\xca[\x1a\xad\xf2:\
+l\xe6\x9f7\xe0U\x92+;\xe3\xd9g\xe3 \x18e\xadP\xa2^\xf7w\xb5M\x8b&\xb7\x82\
+\xcb+5\xaf\xe7V\xe8c\xaa\t\xd9lq&\x95E\x97\x7f\x9bVYJZ\\\x02e\xbd\xb8\xbb\
+\x9e\xf5\x02c\x91\xb6pO8\r\xb0\xd4\x12M\xb61^\x02\xc8l9\xf6\xde\x16\x9c+\xce\
+\x120$\n\xfb}\x18\x93;h&\x1f\xc4S\xa61D$cNF\x98\x98\x91\x85gL\'\x08\xfd\xd3@\
+<\n/F\xd1\x1f!?AA\x04\x93\x18e\x99&h\xcd\x85Fhb\x93\r\xe0\x85\xf4\x86\xbb\
+\xda\x9b\x83\xd0-\xf4\xad\xb8\x02\xda\x9cT\x93\xfd\xf3W\x904)\xa8.#\xa4\xf8\
+\xba\x9d\xa7\x016\x81\xa0\xf7n[z\x99\xdc\xde\xddw\xa4\x1f6Z\xcd\xfb\xd2r\x89\
+-\xc5\xd7F-t\xbf\xa2\xfb\xddu5]\x87\xc0\xeeD&\x9c\x8d\xec[2\x83xuc\xae\x9f\
+\x03j\xf88yp$\x0b\x92L\xfe\x98\x1d\xa1#\xfa=\x80p\x8e>O\'_\xea\t\xa8w\x94\
+\x0e}\x97H<\x8a\xffg;M\x17\xf3I\xb77\x1e\x8d|"_\x87\xf4{\xcc\xe6O\x92\x98\
+\xc9\x94\xe4\xd5M|\xfd\xdc\xed:\xe8\r;\'\x0f\x91\xad\x8d\xa4/\xb6\xdcK\x0c^q\
+\xc5\xfa \x8bZ\x1f\xb6R(\xa9\xees\xb0\rhYJf\xf1\xd8\x85\xcd\xa3\xb9/\x07?W\
+\xbd@\x82g\x8f[\x9b\xc0\x95V\xab\x9f\xb3&\x8d\xb2,.\xb7_\x84s\xdb\xb2\xdai\
+\xd4\xbe\x15^o[5n\xb3\xaac\xacO\x9e?n\xebU\x91\xf3!\x08\xec\x8e\xbbU\xf9mg,\
+\x9f\x9a\xd9\x8bt\xf1ls{\x94]\x01\x0f7\'\x1f\xea\xfe)\xfd\x17\xe9B\xcdS\x03\
+\xa7\xaa\xff\x07\xd9\xf0\x8c\x13\xda\x11\xc0<\xfeDN\xbe\xbf<\x9f\xeaD-\xc3\
+\x0f\xc3\xf0l\x1c} U<L\xcf\xedU\x92\xe80T\xa1\x94\xd1\xba\x17\xc5>\xf0\xcc\
+\xe8\x8bI\xfcW\x97q\xfc|\x92\xae\x96\x81\x1c\x0e3/<=z\xe8\x9f\x9c\x85}\xa5\
+\x1e\x9ez\xe9m\xf6p\xe0\xbd\xbc\xcc|\xdd^)o\xd7\x07\x1b\x80KB/\x1d\xa1\xa5\
+\xac\xe7\xdb\xca\xf0e\xe7\xf5\xbcV+\x9eZreg\x1c\xb4G\xad\xce\xb1p9\xe9\x07\
+\x92+\x1b\xa4H\x9f,K\xcc\x95\xd2X\xe8\xc3]\xf7\x0e\x0fw\x92%\x0f\xb8\xf2\xd2\
+\xb2\xec\'\x98\xdd>\xee:\xda9\xf8B7\xebZ<\x93\xad\xf5,\xb0z\xf9|\xb4~\x96m\
+\x94\xb7\x8d\x95K\x96\x7fA;\x84\x11\x06\x98\xc2\x84d\xfa\xef\x85\x99z\t\xb3O\
+Fb\x84P\x84\x80\xc6h$XE\x02\t\x90\x83\xe4\xf42\xbex\xadc\x03\xa0\xf4\xf2\xb8\
+{\xf3\xed\xe0\xb9Z?\xcb6\xd2\x9b+\x8cD\x800\xc4\x86\x10\xf4\x01\x8b[\xecU\
+\xed\xe8\xbb\xa4\xceZ\xa3\xfb\xb7\xa9:%\xaaYB\xaeLqZ\xc0\xe6\xa1(\xcf!s\xfbP\
+\xe7<LS8\x12\x1b\'94\x7f\xba\x07)\xb5\xa0\xf9>wh\r\xbe\xa0e\x90\x06{{\xe3\
+\xadg\xcc\xaf7\xbd\xa1\x08\xfa&\xe8\xb2^\x10t\x95\x0c\x90\xd8\x11*"+\xfcP2\
+\xfe\x9e|fm\xf2ty\xf5\x13{\xf2Q\x12~\xa8F\xbe\x8a|\xe24I|\x8cu7\xf8b>\x01&\
+\xd3g\xd7\xab\x04]Xr*\xca\xda\xa1=:\xf3zCq\xf2V\xa6 \xdc\xaa\xde\x12\xb4\xcd\
+U\xb4uQ\x1c\xa9V\xf1\xa3\x94\xacH\xe7l\x94V%\xab\xa8\xe2\xdb\xd4\x9f\x9d\x84\
+\xef\x95YBK#7b\xd9\x17Ge\xf0\xa58C{\x8a\xa2\x1d\xe2_\x97\xa1\x99\x9d\x90\x90\
+E\x93\xb9\x19\x8c\xb3\xae\x82\x82I\xbeW\xe0\xc0\xc5\xd0\xf3\x94\x99B\\\x12Pf\
+\xae=9\xdcYIq\xfbmCB\xa6\xa2.YNY\xcc\xec\xec\xf3`\xf9\xd5\xeb\x18\x18\xae[o\
+\xf5"%\x84\xc6\x86V\x0b\x1b\x8e\x85|\x92\x9d\x9cqR\xfa\x1a/\xb2\xabO\xc4/\
+\xff\xca\x8bO\xd2\xab\xde\xeao\xbek\xfbgv\xf4]\x1bMm\xfc\x13\xab/t\xb2\xd0I\
+\xd2U\xdeB?\xd7\xab!\xc4\xfa\xf5d\xa1\x01y\xa4N\xb2\x8e\xbf\xea\xbe\x9b\x86o\
+\xf7\xa2\x01\x9d\xf7\xba\xd1\xb1/\x80_\xceOV\xc4\xdb\x97\\\xb8\x02q+]\xad\
+\xf9\\\x952y\xca\xdaV\x194wQ\xf5\xbc\x80\x9e\xcd\\h\x9e\no\x93\xc9\xb8\xd7\
+\xdd\xa9\x80\xe4C\xb7%\xd7.6\xed\xc2\x13\xb5\x84\xcaB\xd6.\xe7\xba\xd0\x9d\
+\xdc\x95\\}0\xf6(b\xdcw\x869\xea\xc6I\x8b\x8esxm\xf2\xa2p\r\xcat\x05^\xb6a#@\
+\xb24D\x1a\xad\xf5k\xab\x97r\xd4\x0f\xd1\x82\xd0\xa9\xc4\n\xa10*\x87M5E\x03\
+\x96\xf4\x1cy\xa1\xb1S\xe0z\xfa\xa4\xaf\xb0\x7f\x8cp\xb0\xa9\x11\xd3\xf3\x95\
+\x9d\xbd\x00X\xac\xe9\x06\xfa\xcb\xcc\xea\x0e\xb0RY\x1a!"\xeff\xd4\xba\xe8\
+\x0b<\x19\x918\xf3?\xe1\xa5\xce\xf7\xa86\x0c\x8a\xfauy\x91\xd2\xa62G\x8dU;\
+\xbc\xc6\xcf\xcd\xbc\xcd\xcc\x1fwT\xcb!R\xcbe\xf1\xe4\xe7e+\xfbD\xee5\rk\xa9\
+\x16\xcc\xac\xcep\x88\xd9\xb80\x19\xe0H\x9b\xd5\xac\xf0F\xf1v3\x13\xf3}\x15h\
+%A$V\xac\xe7\xd7\xeb\x99\n\xfa\xb60\\T\xd0\xb3\xa0C\x11\x8eP\x11\x8e\r\x98$\
+\x18\x8b:\xb7\xa77\x93\xe5\xcdDc\xb3\xa33\xdb\x1bOC1\x92\xa9\x82g_jq\xf9\xe3\
+\xe5\xfc"\xdf\x17#u3M\xac\x0e\x85J\xa4\xcc\xda!\x0e3\x83>\x83#"\xa23\x92\x18\
+iY\',mfC\xafZ?\xd3\x99\xedeu\xb8\xbb\xe3\xec\xd5\x04\xcc\xea\xe7=\x02R\x16\
+\x8a\x8d\x0c\xfd\x87\xc2\x06R\x14\xbc\x89\xca^\x8dYJ\xd9\xa1J\xe9\xc9\x83\
+\x1d\xb9\x1eX\x10&sQv\xd0\xd8~H\r2,\x81\xed\xae\x0f\xf4\xcc\xa7\x15\xb8\xdb$\
+\x97\xca)8e\x01\xcc\xc4\xcc\x08t`\x81\xd0j!Ck\x12,\xa1T\x1f\t5""FE!\xa0m\x02\
+<\x15\x17O\xdb\x1ae\x12\x84sB\x9d\x89pl\x88\x94\x8a\x07\xfa\xa9\xa7\x7f63\
+\xdeB\x03\x89\x11\x85\x89H(\xadR!p\xbb\xb6\x83T\xa8 \xfc\xc8\xa8P\x8f\x91$s\
+\xfd\xbak\xff\xfeU62\x83\xb6\xe8\xbd\xdb\xbb\x02~9?\xc9W\xbb\xa5\x02\xcf\xa9\
+\x96\x94?\x90v\xe4>\xe7\x9d\x85\xde\' u;\xc7\xedV\xc7\xb6T\x07\xd6\xd5\x9c\
+\xf4"\x97\xdc\xaf\xd0{\xaa\x92+r\x9b\xfa\xd6R\xc1\xdbyT\x1e\xe2=\xba\xea6\
+\xe2`Z\xda\x8ed\xcc\x0e%\xb0\x9d"\x00\xc3\xd2\x10Z\x8c@\xe7\xee\x10B\x89P\
+\xd8\x1f0\nw\xdc\x05a\x82\xd6\x08\r\x0b\xb3\x99%3\xc0\x9a\xf5\xe8l\xa4\xb0\
+\x8a\x91\xc2L\x99j\xc4\xc2|1K\x8c\x0bT\xf4C\xb9\x91\xfd\x98\xd0\x92\x98l\xbb\
+\x92\x1fx\xea,\xffed\x82I\xb0\xa07x\x1e\x11{\x04Q\xc0\xab;.\xee\xf6c\xb8\xad\
+\xaaN@j\x05\xdfN+YB\xd5\x11yI\r\xb7\xa4&~x\xb1\x8e\xbbxU%\xfd\xb26y)+\x9b\
+\x01\xde\xdeV7\xd0\x8d\xca\xb1\xb4\xd8\xef\x01\x1eS.\x12\xac\xd9}\xc5A(\x94L\
+U\xe4\xab\x8a\xe95\x8d!I\x89\xd3\xdb\x9b\xc9\xf2f\x02\xccg/\x81\xe4\xf4[6\
+\xfcP\x87b<B%\xa96\xfe\xf2\xd5Mg\x9d\xf3\xd5\x96\xc1\x89\nzn\rv=\'\xe8"\x03@\
+J\xec(\xdf{\xe4t\xa9"\x97\xbc\x8c\xe0s8\x0b\xe9\x8eW\xd7UeK@\xca#\xe9\x9dg\
+\x9e\xff8O\xae\x14;\xb7W\xce\x84\x14Y\x95\x98T\xad\x93Y\x13e\x07\x08]%4\n\
+\xb3\xa5\x03Y\xb1h\xbei\x0e\xcc&\xac\x05r\x0e|~\xf0SS\xb0w\xe4.{\xe7t\x97O\
+\xe7\xd9\xebr\xda0T\xa1\x92\x1fH\xa5\xc2\x10p>L@\x93Lm|\xae\xa7?\xba\x89\xaf\
+\xb5ND\x98?\x9f\x13Bc?\xb0\xd1\x90\xb7\x8f\xc5\xe65-\xaf{\x9dx:1v\xa1\x93\
+\xae\n\xa3n\x84+\xcef\x13+Bi\xe9\xab\xfe\xfba\x10e=\xc09K\xe3\xa8\x07$\xbe~\
+\xbd\xb0\xb7\xe2\xe1\xca\xbc\x04\x10\xa3\xb6HW"\x07\xa4v\x85\xf7\xbe\xb2~\
+\xfbN\x1a\xbc\xa3}\x96\xc9\x95\xb9\xb6\xd9\x1e=\xa8&W:\xd8\xbc#=\xbc\xa4\x82\
+\xd7\xa4E\x07f\x8e\x8dQi^\xeer\x11\xb7\xbc\xf1\x92\xd0^\xf2\xe4\xcb\xf9)\xb2\
+\x812f\xe5\x0c-:P\xf1\xfe\xd6\xaf\x83A\x8b[Ib\x08\xc9_\xcf\x90\x1b\x12\x12\
+\xabH\x14\xa1"\x16D#\x8cC\xa1)X\xec9\xd3x\xea\xc5/<\xd8\x9a%\xa2\x1f\xfcD]\
+\xca\x11"\x87\\\x01\xa1Fh\x84\xc9\x06\xd2KD\x05\x90\rV\xb2\x94\x0c\xc2\\\xa9\
+v\x7f-\xce\xbcG$\xbc,\xe8F9x\x1e`\xe3\xdf\x9d|\xa4\xd8\xd76k\xc9\x95\xaec-=|\
+\x1f\'\xf7%\xbdG\xe7\xfdK\xeb\x10\xe4zE2f\ru\x9d1\xbe\xde\x8dk\xb7\x0c\x14\
+\xbema\xd0\xb77\xc0\xb4p?F\xc3\xc7\t\xa8\xa0\'B1\x92\xa9\x8d|\x17\xdfq\n\'\
+\x13\xc4\xab\x1by\xf9\xe3\xd9\xfc\xc2/\x12e\xd7\xf0\n\xba=\x19\xca\xd0\xf4\
+\xbf\xc5\x83#\xa7\x7fN\x8d/\x13\xab\xd7s[L\x08\x98d\xfdb\x1e\x0f\x83\xbeyp\
+\xf4dL\x18\xa2!\x8e\x89\x13\xb4\x01\xf0\xe4N\xf8\xde\xc9\xccn\xd3\xf3\xdd\
+\xb1\x1cJo\xafr\xa5\xc4Iv\xdd\xdd\xcb\x12\xea\x8b\xcd\x12)ETMl\xaf\xe0U\x99+\
+T\xcd\xc4\xa9K\x8e\xae\x95\x85\x1e\xe0\x84\x0f*S\x15;j\xd8K=\xc0\xa0\xec\x00\
+4Ba\xa79\x89\x88\xc5eQ\x11\xc3!\xe7\xa5\x9d],\x93x>\x1b\x17\xa3\x86\xf3\x160\
+h\x89\xb1\x15\xa1T\xa1U\xa1\x96Q\xa7\x17y>\x10?J\xe3p~\xd1\x8d\x9f&\xc9d\xfe\
+7\xcc\xd7s;\xef\x89\x1e\xbd\x00`\xc5Xt\xc6\xb1\x18Fo\xff\xc1\xa3a,\xe7\x17:~\
+\xaa\x93\xdb\x8d\xfd\xbd\xd3\xd1X\xc8P\xc9\xcfY\xff\xf0\xfa\x17_\xce\xd6\xbf\
+\x15<\xfc\xb7\xe1\xa3\x8f\xc3qb\xed\x7f\x9e\xc5\x7f~\xf1E\x04\xa7R|\xf8\xce\
+\xdb\xef\x9f\x86.d_\x1e\xcb\xad(|\x17{\xbc\xfa\x06)M\x85W\x8f6\xdd\xe6\x9ct\
+\x1f\xae:\xf2\xa4P\x8df\xd5\x174\x14\xc92>9%\xd0\xbf_%\xa2\xed\x8dWAH\x80\
+\x0c\x9f\x1c\x1e\xebb+\xc6\xfb\x9e\x9b\xc5$4\x00\x00 \x00IDAT\x1e\xeb\xb1\
+\xa3p\x0e(\x8c\xf4\x90A\x82\xb5x\t\x89\x99Z\xf4\x0c@\xf5\x85j\t%e6\x90\xde-h\
+\x81\x90\xb9\xd3\x12\xc5Y\x88\x82\x93\x84p\xcaD\x13O\xa7\xd7\xf6b.\xce\xfao\
+\x87ld?\xd6\xe6)6RB\xb1\xfcS\x9e+\xce\xa6\xe8xz\x9d\xe8\xe5\xa7O\xe4\x88P1\
+\x02\xce\xf9j:]>\x1f->E\x8f\xd0\xc0\x94\xe4|\x1a\x0b\xd5Q\xfd\x07_x"\xc4:-\
+\x14pW\x9b\xf7\x8d34\xe1\x10l\xde?\xb9\xb2\x94}\xf0\xcc\x19{\x07\x14\x90\x95\
+\xd9\xde\x85%>{\x07\x12\xc9i\x9a*3\x182\x85\xe7`\xd3\xa1ey1\x9bB\xcfT\xb77\
+\xe6\xfa\xb9\xb0S+F\x80\xd7\x1bn@\x04y\x85!\x1bt\x05^\x02"\x14r\x84\x15\x88\
+\x90\x10D\xccdJ\xf4\xea&\xbe~\xfe\xa8\'\x97\xc1\t\x10Bk}e\x83\x13\x1b\xf4t(4\
+\xd8\xc4\x8a\xe4\xe9\xfaj\x1a\xf7\xa4<\xfb\xc3\xf0\x0c)P\x93\xff\x10<\xffz\
+\x03\xe6\xf1[vD\xacI&\xeb\xf5g\xff\'Ggb\xfc\x81:\xc3\xb1\x0fUL\xac\xf3\x15\
+\xf7v\x0fmf\xdfP\x15\xc4\x81g\x83\x91\x1e\xf9\xef\xf6q\xb0\xf9\x8fV\xc4k\x9f\
+9\x1f\x17\xca\xbc\x94\r:m)5mvg\xabP\xc6ZI\\Z\xbb6\xddf\x9c<\xf2\xbb\xc0\xa5\
+\x9dM\x97\xf1$]\xba\xe8\x12\x10\xa5}\x89eI\xa6\x06\x03ZJ\x08\t}\xd5?\x16\x9b\
+\xd0\xc8(\x1a\x9f\xb9\xf1\x11\x17\xd9U\x1c\xce\x9fN\x12k\x12+C\xd7\xad\x9c\
+\xffXl\x80D\xe8\xbf\xf2\xe2tu\x99.\x17\xefu\xff\xe8\xbf\x95\xdf\xfe\x83G\xc3\
+8\x9c\'\xc2L\x12\xd3\xa7\xff\xbe\t\x12c\xce\x85\xf9D}E\xca\x07\xe6\xd1\x1f\
+\x9a(2cn\xaf~4_\xe1q+\x1e6\x94\x10)\x0eyu\x80\xe4\xd9\xa6\xb7b^/\xe5\xb1\xeb\
+\xdb\\\xdf?\xb9\xf2\x90\xcey\xb8\xbd\x04\x8aF\x93\xbf\x14\xaf\x9c\x7f\xaf\
+\x9bSD\xdbe{\x0bV\x05U\xde\x89\xc53H\xc3\xd4\xea\xfcZQ\xfd\xad^*\xbd[\xa7@\
+\xc2Ra\xc1(B\x85\x91|\xe8\xbcf1*\xe6\\s\x91\x8f\xe5A9Vs\xa18\xd3\\L\x91\x9f}\
+\xff\xd6\x9c\'\xf1\x87\xfc\xdf\xdf\x95\x1f0\x1b\xf3\xa1\xeb\x93\xa0\xff\x024\
+\x171L\xa6\x16\xb8x\xe4=\xf5d\x88\x86vB\n8\xe5\xb3\xaar\x17\x87\xdd\xcf\xf7y\
+PT\xb3o\xb3\xd46\xef\xff\x1a\xbaCd\xcb\xc6\xec\x9e\xf4\xb0\xdaY-\x82Tm\xbc\
+\xfb\x05\xbe\xa5W\xd3)\xe6\x1bY\xe8\x9c\x06k\xd6j\xbd\xb8^\xe7\xe7E\x04\xdb\
+\xbb\xc7\x82\x1d\x1c\t\x102/\xfe\xaa\x15O$2$<\x03\x08\xe1\xf4\xe5\xc7/\xe6y\
+\xe4G\n\x84\x0b\x96$8\xe2\x8eJR9M\xfb\x9f\xfdY\xfc\xd9\x9f\x88?{"\xc7\x1f\
+\xaa\x8f\xfe%O\xfcG=\x80G\x00|\xf5\x9c\xe4\x9c\xf5?\xfc\t0\x1b}\xc7\xfc\xe6[\
+*$\xb1\x98\x04\x04\x1b\x87\x90\x12`V\xc4E\xeeYI\xa9Y\xdbl4\xd2\x7fE\xf9\x86d\
+S\x85\x87\xd8\xd1KK\xe7\x00\x85\x99o\xe5\x82\xc2\t\xe0\\\x82\xa7\xe6\xf3R\
+\xcf\x04NMn\xa4\xcf\xec,\xc6\xc6K\xbd\xde\x98\xa0%\x01\xbd\xc9\xdd\xf6\xa7\
+\x8e\xe6`xKtl\xea\x03\xccy\x14\x9c\xbc\xaf\xc2\x8f\x91>\xdf\xca\xe7zH\x9a\
+\xdc@\x9cX\x1b\x96\x19\xfa!:N\x00\x17g\xff\xdf_\xfeb\xddy\xca\xe2\xa7\xdf\
+\xd2\x7f\xfd=\xfb\x93\xef\xc6\x91z\xf2\xa4\\L\xa2\xa6\x9f\xa8\x8b\x1f<\x9c\
+\x18D\xd4\xfb\xe4=o\xf4\xbe\xb6\x9fo\xc4\x8b\xf9\x95\xf0Or\x06\xe9\xd2\xf1\
+\x94\xe6\x90g9\xb9S\xb7_C\xa9-ze\xe3]\xf56\xef(\xb6\xf9\x8f+\xf7\xac\x90y\
+\x9f\xca\xbde\xae\x8d\xccC\xde\xd2d\xd7\xc6\xbb-aS\xa8\xedQ\xc9l@\x01\x9e\
+\x96\xa4\xb0\xc1\xed\x88\xd1\x983\x18\x87\xd9\xbb@\xe2\xfd\xd2\xd1\x8d\xaa;2\
+<\xd5H@s1%y\xf6\xc7O\x81\xf0\x83\x93\x8f\x9e\xfc\xce\x88\x91\xe4C\xc3\xd3\t\
+\x08\xa6U\x86\xa7\x93\x04\x930\xd5H\x89(\xa9\x87\xd5\x8b\xcf\xc9\x1d%7\xf3c\
+\xa9\xc2\xe6}\x92+\xef\xce\xfb>$w\x97\xf8\xb8\'8\xd7L\xf8* W\xf7\xbc}\x1bA\
+\x13lV\xf5\xe7<|#\xf3\x19\xd6\x02\xf7\xfa\xa4$DD<\xea19b,\ty21ONo\x00fs\x00\
+\r&\xfe\x98$\x05\x14\xc8i\x1aM\x7f\x00\x84\x7f\xf7\xfb\xf2\xf7\x8e\\\x86\xc4\
+\xf9\xe4\xe3\xf3\xf3g\xc2N\xc7\xa3\x7fq\xf6\x81\x18\x15L\xa7\x17s\xa6\x17\
+\xb8b\x11\x1bI\xf4\x84$F\xdb\x9c\x15V\x96\'\xbd\x83l@q>w\xb4\xcd\x13\xf1\xde\
+8}eDG\x10`\x0f\xc0\xe6\xa1_\xc8\xbf6\xabD\xb6CGz7\xad\xb6\xab\xbd\x99\xff\
+\xdd\xbb\xac\x1a\xc5\x98\\\xbb\x91\x07\x14\xa52\xc0\xe4Jv\xb8\xfc\xf4\x9ac\
+\x93\x8ao\xf3E{!l\xfa5\xcb\xe5r\x01h\xb1\x13\xea<\r\xc4\xc0\xb4\xde\x93C\x06\
+\x95\xe5\xdd.\x98r\x9c\x0e>>\t\xc3\xb9\xd8R4KoW\x12_\x18\xc8\xae\xce\xed\x15\
+\xf0\xe4\xf4$\x96\xf3\x9f\xd8\x0b\xe0l\xf4\x93\xff)z\x02\xe88\xf9O\xbc\xfe\
+\xd3\xf4\xe7\x17\xaf\xbf~\xaf\xfbG\xff&>\xfb.\x91z\xf2\xc4\x0f\x8f\xd2\xe4\
+\xe6\xa2\xff\xf3\x1fy+\xe0\xb8+\x9e\x98(\x96\xe6\xf3\xcb\xa4\x1a\x85\xbdD9}\
+\xb2\xf1$h2a\xbbV.\xee*\xe5\xd1\x92\xfb\xefal\x90_\xed5\xe2{o\xb9]6\xb6W;\
+\xdc\x13]\x0b#\xdd\x85\x84b\x83\xd5\xd9\xc6x\xb7\x80\xcc\x06\xee\x83\x13\x99\
+\r\x94\xd7\x92\x08I$\x98ZF\xae\x7f\xbe\x15\xa1\xb0\xcer\x1f\x15\xe0V\xe5j\
+\x02\x8a3\x85\x01tA\xd4ta&K|N|~\xfe\xb7q\x92\x8e>\x88Fjt\x96{\x00p[\x01A\x94\
+\xa0\xc9Q\xd4\x96kvR\x18\xef;>\xde\x9ax\xe1w\xfe\xc7\xf6\xc9;\xbd\x87g\x9d\
+\xe339\x1c\xf7\xde\xfa\r \xe8\xbd\xcb\x81\xa8M54\xf3\x8f%\xd52\x1d\x87fv y\
+\x7f\xed\xc7\x9dKk\xd0f}=\xcfo\xcda\xb0\xeb\xfc\r\xba\xc8 \x94\x0e\xfb\x00\
+\xd0\x18\x831`\xd6"\x0c\x14D#d\xb4S\x0eP\x83M06\xf7\x03\xa8\xe2\xa9\xe5\xda\
+\x13K<\xcd\xf7\xcb\xbaR\t\xb8p~\x8ed*B_E\xf9\x90\xc99\xa6\x0c\xfd\x97\x8fcS9\
+\x06\xa0\x08\x8a\xd6J\x92\x1e\xa8\xb7\xc9am\xf3\x1bj\x8fwK5HD\xbe\xe0\x9d\
+\x1d\xb8\xf8\xbb\xb2\x83j\xf2\xdf>NRX\xe8\xc2?\xa1\x02\x9b\xb9\xb6\x99\xea\
+\xf5\xc6\x00A*;jg\x8fo\xd9\xce)}4x\xdd\xf7[\x16\xc9\xe7\x81\xf8"\x99^\x98\
+\xe5i"\x06\xb2\xf3Q,C#\xa3N/<>*\xb5\xcdD\xd9\xe4u\x9e\xe1}\xc6I\x0e\xadI|\
+\xb1\xbe\xfa\xfe/\x9e\xff\xdd\xe5\xd4[\xe8\x0f\xa2h\xf8\xe0\xed\xf7\xc3\x00H\
+\xb4\t\x95L\xb4ym[\xef\xcb \xcaz\xa1=J^\xdf\xfch\xbe\xeaO\xbf\x1a\xd0B\x8a\
+\xf7d\xff\xd8n^w\xd5\xf1B\xbf\xa6\xb5\x83\xe4@N\x9b\x9f\xb7\xc5\x16N\xdfP\
+\x01i?\x92^\x93_?\xef\xbb&\xbfZm\xf6V\xc53\xbeap\xca\xc2\x14?\xb0\x83M={\xe5\
+\xbeV\xb5M \x84\xc2NG\x12\x85H\xc7]\x8f\xb3\xa5\x03\xd8\xa8\xd8:b\xac0\xa2\
+\x88 &E\x8c)D\tF\x96\xe9\x84\xa71L\xce\xff!\x99\xdc\xa8\xe3\xee\xd9w\xbe\x13\
+\xc1\x98\x0f\x1d\xe4:\xbc\xb5\xc4"\'&\xe9\x0b\xb4\xce^\x00x}\x85\n\xf7n\x0b\
+\x87\x9c\xb9\x87\xbdIih\xae\x80\x94\xf9c\xa4\xf3\x14\xe7r\xc8`\xf7\xee\r\xa4\
+\xfb\x11\xa2\xc6\xa2F\xe5<\xb5\xad2\x7fqze\xe9\xbb\x03m\xd1\xd2\x82\xa4\x029\
+\xc6 no\xbc\xf5l=\xbf\x06\xbc\xdepgT\xd0\xb7A\xd7\xc8@JPXE\x08\xda\xa2bD\xb2\
+f\xbd0\x0e\xc3\x06GH\xa2\x11aa\xa7\x0b\xe7Z\xb6\xd8\x82\x88\xae\'\xdf3\xafn\
+\xd6_\xfe\xa5\xbd:O\xe0\xc5\xef\xfc\xbb\xb3o=\xe2\x89\xefx\xa1vN\xce\xfb\x0c\
+\xd10=\xc7L\xd7\xb3y<<y+\x0c\x89Bb\x0bf\xe7\x08\xfb\xb9!\nlc}\xb3"\xa7\x9e\
+\x06\xd8t\x15\x90\x02\xf7\xb6\xdf\xfb\xdd\x04\xf7\x03\xd2\xbc2F\xe5\nr*\xd3\
+\x1d\xd3VA\xd5Ae\x19:g\x0f<\xab\x8eM\xe1\x9f\x94\xc8\xe9\xdc\x9b\xb7\x1b{\
+\x9dn\x98\xafI\xb7Z\xdd\xb0\xd3\nR)\x976c\xe0\xf0\xf3\xfdB\x1dM\x84\x99\x08\
+\xf39K\xe0\xd2X\x15\xaf#\xa5d\xda\xfe\xa0\xddv!\xa4\xf0\xf8(Y\xdf\x00\xb1\
+\x9eG\x9d\x1e\xe0\\\x9a\xffi~\xf1\x7f\xdd\xfe\x02\xf8]\xfd\xe9\x7fo~\xf3\x7f\
+\xe1}\x07r\x9fL&\x896\xc0\x93\xf5\t\xf0#s\xfd\x94\xab\xc1\xc9\xe9{\x0f\xe4\
+\xfb\xa7a$$\xb7W?\xf2V\x14\xee\x85*l\xee\x94M\xae\x9c\xed\xbb* \xed\xfb6\x0f\
+\xa9|\x0e<\x0f\xbd\x8c\xac j\xba\xddV\xe3;\xfe\x9b\xe2\xc5UL\x1e\x1ch)g\xdb\
+\x11Y\xf4\xd4(\x93m\xf4\xec\x95\x9d^\x03\xa8\xaa\xceb]\xc5l\xa1\x16!\x0bQh\
+\x98\x80\xd3<Ahb \x81\x10m\xb2\x81\xf4\xae\x14\x91"Q\xb4\x15)\xa0\x0b\x12\
+\x99"\x05\xf9\x15\xe3\xc7\xc8\xe9\xf4\xfa\xe2\xd1\xe8O\xbd\xd9\xa7\x8c\x80\
+\x98\xf3\x0b\x92\x98Df\x83\xb1\x17\x86\xc8)\xcb8\x13\xd2#B\x9c!\x05\xa3\x18\
+\x9d\x90&\xc5\xc5\xbd\xd99\xba\x86K<\x7fs\xe5>l\x96!\xa1\xf2wvp\xb7\xaa\x94\
+\xc1\xac\xca\xfe\x8b\xcc\xf6e\x1f6\xf7]\x9a\xfb\xd5;k\xae\xce}OiS\xfc\xafF\
+\x95C$ko\x1e3\xbf.\x03C\x80(8\x83V\x8c\xbc\xde\xd0\xe1\xa7\x0c\x03-\x19\x91N\
+\xddUeP\x90\x18\x94Y\xdb\xf5B\xc0\xe5zf{\x91\t\x039\x02A\x18"(\xf0\x10\x80\'\
+\x90X\x9e8\xfb=\xf2O\x1f\x03\x98\xe7\x1f\xbf\xf8\xeb\xaf\xe7\xd3\x9f\xda\x9e\
+4\x1f\xfc\xa1\x1dA\x82H\xb0\xa0\xce \xe2\xb4\x87\x9d\x7f\xec\x8c\xf7\\\xf6\
+\x03\xee\x12\xcc\xd6\xe1\xd9j\x84\xcdj\xbdM[\xbc\xee\xdc\x9d\x0f\xc5\xa0\xa4\
+_:{\xd9}-\xc9\x9c\xa5l\xdf\x97q\xeb#\xa6\x80\xe4\xbd\xea\xc9\xae\x17vs\xd6\
+\xb7%\xafWi\x15B\xbb\xceZd;\xf8Y-\x01Z%m\xee\xca\xd6NO\x17B\xa4\xd34\xbe\r\
+\xecu\xba\x19\x06\xf95v\x9d\x16\x0f\xf4\x144\xc3N\xcb\x85\xd7\x87\xd1\xdb\
+\xc7\xe5\xbb\x93\x04\xc0k\xd9\xba\xb43\x8d\xd5:1\x08m\x82\xd3D\xfc\x0fb\xf8\
+\xe4\xf4\xa4P5\xe3\xc4Z \x14\xa2\xd4<\x81\xad\x16*i\xf5\xfe\xe6g\x83\x97\xc0\
+\xbf\xe3\xef\xfe \x1b\xfe(X!\x17\xc0\xbf\x0e\xdf\xc9\x13<\xe7\xf1\x9f\xf5\
+\xe2g7/\x17\xfe\xd1\x00q\x1aTJ\x8b\xd8\xc2\xaf\xb3+o0\xd2\xabr(\xbe\xc3\x01\
+\xc0\xac\x91\xdbkT\xf9\x9ai\x7f\x1fo@\xadg\xf1\xb5\x81\x81\x01T\x13\xcfK\x85\
+\xd3\xea\xa5P\xf9p\xab\x97yx\x1d\x80Pu\xb4\xeaGJ*\xa2\xda;\xf4tn\xef[KR\xe8\
+\x1c\xb8ne\xf4\xa7T#\xab\xba\xa5`\x048\xa3~\xca\xc4Y;\x118og\x82\x11L\xc7|(\
+\x18E\xe8)\xfa\x82\xb8Ll_U\xce\x12\xc5\x03\xab\xf6\xd8:Xos#\x10\xc2\xab\x96\
+\x0bN\xc9_]\xc1\x9e*xH\xd5,\x81t\x9f8\x04;<\xf62\xac\xe3\x15\xc9D\xb5<\xa0\
+\xfd\x97e\xec\x7fu/\xbc\xa8\x91\xdeMAzw\xe9B\xe5\xcf\xe2`s6\xbf\x00\xfa\xbd3\
+\rV\x8c\xb2\x9e\xb4\xbdq"\xc58\xdcN\x9cs\x8d\x1c~\xde\xde\\\xafg6\xe8\'\x83#\
+Bt\x08\xd16\rNU^\'H\xc5\x9c\xb70\x8e\x90I\x9e\xcc\xde\xef1\x9b\xe7\x8fJ\xf7U\
+\xcf\xf3\xf8\xa1\xd1`\x99A\xdb\xb0\xaepv<Kf\xf1]\x16\xd5A\xba\xfbnH\xc8\x98K\
+)O+\x87\xe1\x95P\xb6\xffSU\xbb\xe5/2+\x92\x862\x8b\xd7#\x9b\xe3\xb9\xfb0\x1d\
+\x02\x08\\\xe2\x8f{\xcb\xa5\xd7\x86t\x88\xd8a.\x95\xb5\xe3t;\xbf\x93\xd4|\
+\xf7Q U-?\xc8\xa5\x08U\xbb\\\x8a\x99v\x81\xa1\xa0R\xf0 \xc0[hz$~7L\x7f\xe0\
+\xc6fk5\xd0bl\xc5P\xbe\xfd~\x18D\x9d^\xbc\x9c\'\xda\xbc\xa6\x05\\\xda\x99\
+\x0e\xecm\xb0\xb94\xf6\xcct\xe4\xbc\xfd(8\xf9\x83\xac\xcd\xe0$\x14\xf5\xa7q(\
+\xc4\x85\xe1G\xd7\xd3\xe3\x85\x0e\x95\xfc\x981g\x91\x1f\x1eU\xfb\xa4IQ\xcbm\
+\x1e\'\xd6&\xd9M,\xe6\x9f{\xe2\xf2\x96S\x16t+\xb6]\x80+B\x82\x05\xa1\\`\xa89\
+$\xd4X\x01\xa9\x96\xdds c\xe8.qC\xf6S\xd7s^\xf8\xe1}\x01\xd5\x9au\xee\xed\
+\xbd\xd5,\xc5\xeaV\x97\x0f^\x83MK\x02\xc4\xdaX\xbd\x85\xe5\xb0\xc0\xa8\x04\
+\xa1\n\x1d]\xc8\xa0\x1fJO\xbe\xed\xf0\xcd\xd9\xec\x80&\x169\x0b4I\n\xea|\x19\
+E\xda\x8f\xfb(\x8cFN\x99\x00\x0e`G((il\x13\x18\xc3\xc4})\xd2\x94b\x8dL0\xa6b\
+\x05\x992%bO\xea\xbeM\xa1\xc2\xf6\xe0\x81h\xbf+\xe57\xf3^\x1e\xe4\xb1\xcb\
+\xbc\xaa\xc6\xd2f\x99ecs8\x92\xb733\xa8\x13y[bk9x\x82N%,u\xe8\xa5\x12\xae\
+\xbd\x16\x1eZ\x8b\x9dw\xa9\x03\xc6\xc0\xedMk}uys\x01\xcc\xe6\x17\xfd\xde\xd9\
+\x1d\x87szt\xd6\xed\x8d\x1d\xb7sj\xfc$Y\xb3^08\x92\x12Q\xf5[\x06]%\x03!\xebt\
+\x85H\x11\n\x8ce\xa2\xf3\xcf",~\xf0$\xcfKr\xd1\xf6\xe3\x87\xbc~\t0\x9b\xa3\
+\xf3`\xd3\x96\x984sE\xf6\xec\x0e7\xb5T\xcb\x9b\x8dt)\xf2z\x9b\xb7&\xb9G\xddG\
+v^\x8d^\xd5\xec{(-n\xb13\xd3J\xd6/m\x9a\xb2X\xbd\xbc\xbd\x02\x1e>\x1c\xb1D\
+\xf8\xbe\x90i\xd7;\xed\x88T\xf6\x84\xcb(\xd7~2\xbd~\xc5\x9a\x90c\xd9\x16*\r\
+\x11\xf3\xea\x8b}w\x8a\xc5\x99&\xcf\xcf\x1er\xbeh/L\xb0\xd2\xcbd\xe2/\x01\
+\xfc5\xe6\x87\x00\xbd\x80yCm\xdd\x10\xab\xd2pl\x85\x90\xa1\x01\x8d\xd5\xcb$\
+\x0b\x06o\xd9\x0e\xa0\xb1\xb7\xc1f\xa9\x17,\xe9\xd0\x1d\x98V\xf9\xee\x10\xdb\
+\xf3\x1f\xf9\xddc\xb3\tU\x1e\'\x8c\xb2^\xa8\x8e\xb0$S\xe1\xaa\x85\x00e\xc1\
+\x10\x9f\xa3<X?\xcfU\xd6\x12<\xf3\xa5\xec\'\xec\x15-;Fzg\xdcj\xe7Fz\xbf\xa5\
+\x1c\xd7\xbd\xe7\x10\xa9Z\xccM`\xaaSY\xa4\xcd) \r\xbe\x16\x831L\x01\x17\xcbv\
+\xfa\x9eP\xf2%\x03Q\x14g\xa3\x88\x86\x84yN\x8dH\x18X\xa6\x82\x81\x02\x91C\
+\x8a\xdd\xd9\xe7\xae\xec\x17>\x93u\xad\xd57\x08\x8b\x88\xb5\xb5z\x89\xde\t\
+\x95\xd9\xd9\x1aP`\xfa\x81\xfb*\xfa\x01j\x16be\x11PH\x10\xb0\x08\xf7\xec\xe5\
+\x84\x05\x10\xe6l\xf6R\r\x89@;\xadU\x11\xaa\x02\xc35\xd2\x05\x06\x8b0S\x94#\
+\xe7\xc8\xf1\xed\x93\xb2O\xc9z\xaa\x89\xae\xe5\xa4\x97\xda\xa6\xab\xb7\x99\
+\x828j\t\xc6N\xe5shX\xe6\xdf\xa6\xa2n)\xb7\x8a\xd4\xcb\xbc\x1ag-\x85\xe7\xd5\
+\xcdf=\xcbn>]\xcc\r\x10\x1c\x9d\xe5\xcc\xc9\x93\x87\x1d\xd5R!J\x10F\x18\x8b\
+\x14\x8cF\x8ca:er\xc14\xde\x00\x1a\xfa\xaa\x85\xcck\n\xdd\x9am\xb8\xc4\xa1\
+\xb1\x03\x90j|\xdc5\xe6\xefP\xab\xea\x9c\x06a\xec\xe9|\xf2bnJ\x0b]!^\xcc\xcf\
+[+\x80\xdb\xf6\xa8\x9f\xcdg^\xaf\x9f\xcd\x81[\xefF\xf7\xce\x84\xcc\x1f9\xc3v\
+\x08\xd8U\xd2jo\x1fB\x9bU\xe2\xda3P\xab$\xb62\xeb\xc9Mpb\x07GB\xa2\x15#\x9b\
+\xda\xd0O \x14$\xc59\t\x05\x84d=\x8e\x1f\x02O\x80\xd7/a\x8e\x89\xb1I*B_\x8a\
+\xa2\xbc\x8d;\x87I:\x15\xfe\xc8\xa6\x80v/\x13\x93 j\xb09\x1f\xe6\xa5<,}\xc29\
+^\x8b\xd7n\xbc\xf4C@\xf9m\x9d\xae\xea.\xad6\xecB\xd9i\x90\xbe\xb8\xber\x95\
+\xd6~\x96\xbc<\x82/\xae\xaf%\xbcw2$\xe3\xa1\x7f\x02\xa8V?j\x87\x1f\xf92\x94*\
+\x12R*9\x12\xca\x97G@\x1a\xde|\x12M>\xe1\xe6\xfc\xf5Wf\x0eKT/8;~x\xbaL/\xf1u\
+{\x05(\xdaF\xb4\xcb\xe2\xc0\xf9\x02t\x01\xa1\x05\xfb\xbd\xba\xcc\x17\xed\x85\
+\xb2\xe9Ea\xad\xdb\x9b\xaf#\x04J\x91j#\x88\xcd\xdc\x17\xe1\t+]d\xa9\xaaL\x18\
+\x13\x86X\xe7\xc9\xde\x88\x10h\x99$\xf1\xb6\xcf7\xcf\xe8\xccS\x03G\x9d\x13yy\
+\x0b\xb5$\xf4DhU\xc6\xf0Xlj\xf1\xabP\xc9\xa8\xd3s%D|r\xe53m\xdf\xe8_\x9e?3:\
+\xb1\xe6,f\x14E@\x9c\xa5@\xbc\x9c#I\n\x0e\x8e\xd3{\x8f\xed\x06[\x81MW8\xaeR\
+\xca\xa3\xb7\xe9|\x89W\xea\x14f\xbf2\xdbn\x8cmg\x93 \x8dI\xac6\xe6\x17W\xc9\
+\xba%\xb4\xb6Jm\xc6\xa9\x1c\r\x9f\xb3\x06d\xb6Q^\xf2\x94Q\x88uq\x99\x88\x10\
+\x08\xb3w\x93\xd1/\xe3\x0fD\xcc\xf99\xc7I\xa1\x8f}\x82T(H\x0b\xfc\xb4{UGm\r<\
+-\x9e\xdaAx\x1f|\xed\x90szmc\xe8z*\xe7\xcc\xa3\xbf\xccP7J\xe6\x08\xa3\xf3]\
+\xc4t\x03\xd1\x0fB\xd5)\xf2\x86\xbc\xc4\x01\xf2\xd6\xc0\xbf\nU\xc7eY\xee\xae\
+G\x83\x16\x84N\xefuJ\xa3DTr\x94\\\x15\x911L\x181\xf9\xc0N\x0bt\x1da\x9d\xc9o\
+\x89\xa7$\x1aA=\x84\x19q\x87\xb6\xe9\xed&W6\x96\xe0\xa8g\x00\x15_\xad\x81\
+\xdb\x9b\xf8\xfa\xf9\xfa\xe6\xe2\xfa\xea\x1c@E@\x14}\x14\xf4\x86\xc3\xa0O\
+\xd0\x15a\xa0\x14J\x11F\x8cFT\xf3\x1c\xc3\xe1*\xb9n\xeb\x84\x8b\t\x9fO\x98\
+\xc5\x9b\xe5\xd5\xcb\xce\xc9\xc3\x96\xf0{\xcas\x95\x85\xaa\xd5\xeajKrz\xa6\
+\xabo\x19X62\x07O\x17\xf8N\x92uk\xfe\xd5\xe5\xcd\xc5bn\xbcU\xc5\xbbf4\xf2 \
+\xc3u\xd3f_;\x9d\x15\xf9\xe9\xfd\xde\x99\x15\xa3H\x98*\xa2n\xc7\x06\xc5\xabY\
+\x82n\x18\x06(\xc6\x8a\x9cw\x18nc\xf4I\x82\x8e\xd3\xa9\xf1G2U\x91\xef\xb2\
+\x07]\xe3d\x9a\xea\xe4)\xd0j\x87\xdd^alHqP\xdbt\xb0\xe9\xca\x14\x97\xa2h\xef\
+h}V\x94E\x86\xa5\xbe\x11\xfe\x89M\xaf\xcc\xcd\xea\xc2,_\xde^\xbd\xbe\xbaN\
+\xcd\xf5I\x00\x10xC\xe0\xbd\xec\xbf0\xe3\xe1\xe0DH\xf9\x01\x8fN=\xde\x97\xe1\
+X\x85\x8f\xe5\xe3\x9dr\x81\x83S\x060 \x95\x97\x9f\xc9\xcf\xfec:\xb9X\xbez\
+\xf9\xe5\xf4\xe1\xc3QDw\x14\x9e\x00\x88\xbc\xae\xa6\xa2]\xa9\x00\x0cr^\x96A\
+\xcec\xeb\xe6\xa4\x8a\x9f31\xb3\xedd\xa2\xec\xc4hm\x9fo\xf7*\xc0\xa2\xf0\xe7\
+\xf2(5{\x15\xec-~\x1a\x02m\xe6Qy\xa1\xf5H\x8c\xfb\x11~\x18J;\xb49\xb4VEA\xe8\
+\x89\xf2\xc1\xd9\xa7\x7fl6a\xf9\xb6\x11\xcd6F\x1f\xa2m\xf2\xcc\xe8P\x9b\x91\
+\x8d\\\xfd\x1eB>\xd1\x93\xef\xeb\xf3\xa9I\x00%\xc2qY\xd4J\xdfY\xdd\xbdj\xa4\
+\xd74\xcc}q\xb5\xda\x04:&1\xe7\xcf\x93gW\x89\xce\x7f\xd7p$\xd5qW\xf4\x03\x00\
+\xd5\x97\xa3\xa1\xcc\x06\xd2\x1b*\x8c\x0b^G<\x01\xa2\xdcx\xcf\xd9\x92N\x12\
+\xef/\x7f\xc8\xc5\x05\x89\x9e~\xea\xd4T\xc9Hm\x99<\xe6\x9e\xf5\x87\xab6;\x90\
+\xd7/z\xa1\xf9Ro_\x00\xa0\x9a\xe2"\xba\xa2\x0c\xa9\x16R\xa8n \x86\x1d@\xdb\
+\x94BS\x05\xdc\x01\x8aQ~\x9f=\x12\x1b\x07\xa4\xc5\xed\x1c5B_\xc9q\xca\x8f\
+\xb7\x12\xa0/\x8e1>\xe7Y<\xbd\x04\xe4\xe8TU\x1c\xd4\xcd\xdafP\x86\x84\n\xa9z\
+\xc3\x0eq\x81\xac\xe1\xf2\xea\xeb\xf5\xfc:\x8e\x7f\x82\x8e\xa5\x89\x85\x8c\
+\x00\xab\xa2\xa4\xd0\xd6\x82\xa3\xb3Mo(z\x11a\xe0\xaa\xa1\x88\x08\x1b\xa2d\
+\xbe&\x15\xc2p{s\x87\xd9\x7fw\xf6\xe9\x1f\x8as\xfe\xfe\xc7_\xaf\xe7\xd7\x16\
+\xd4\xf0\xb1~0\xe8J\x0f\xc8\x04k\xb3\x13N\xaa!\xb9\x83\xd0M\xe5\xdd\xe2n\x9d\
+\xd2\xd8l>\xe9}\xfd\xe3\xf9\xfaF\xe5\xde\xb5&\xcc\xdc\x19\x98w\xd3\x12 k\x8f\
+\x9cR\xda\x86\x99\xd7\x03\xd6\x902\x15\xbd3 \x94\xe1\x12\x1c\x8a\xda\xde\xb8\
+@I\xbb\x98O6\xbd\xb7\x01\x85gC!A\xc9\xd4\x86\xbe\xcd\xb7\xe3\xb8\xa0\x80\x8d\
+r\xb5\xd0\x15\x18\xb9\xbd\x99\x00\x91\xaf^\xa5\x1a\xd8\xac\x12\xeaFz\xa9mR\
+\x87\xcd\xd2\x0c\x1f\xec\xfeje\xfc\xda\xdc\xacb\xad?[\xdc~qu}\xb2\xbc6\xae4P\
+\xa0\x00\x96\x04r\xc8\x9aa\xe6\x85\xd9\xd1C\xff\xe4\x14\xf1 \xed>\xf2N\xde\
+\x97a$\xe4\x19\x91\xd33q\x98\xb9kv\xa7\xe1\xe5\xf3\xb3\xe7\xff\xdb\xf4\x93\
+\xf8z\xfd\xf2\xe5\x94\x84\xc7\xf2q$Z\x91|\x08\xe4\xca\xa7\x15{\xb6_EL\x85\
+\x92\xa4g\n\xab\x85\x88\xd3x\xdaO\x9e\xebUl_\x03\'\xac\x91\x85\xc2lV\xf9\xe7\
+Jl\xf0\xaa\xc8I;\xd1kd\x1b\x8b/\xc36s\x85 \xe3\x8av\x9b9\xe0\xd4\xae\xa1\x01\
+\xe8\x8a\x10\x08\xad@#d\x18\xbb\x8c\x07\xed\xaeP"-\xfa\xaa\x8f\xe18\xce-z\
+\xc7Pz\xc7\\GJ\x8d\xec\x9630\r\xe3\x8b\x029.\x8c\xc1\x98\xaf\x8d\xe6\x90\x91\
+\xee\xb4\xcdZH\xa8\xf0\x1f\xee(u\x12\xdf\xd5\xca0\xd9:yq\x9d|\xf2e\xa2\xad}1\
+\x07T\xdf\x7f\xa9J\xe7E\x1c\x8e\xe4\x0b\xa5\xa2q\xfa|\xb4\x86\xb5\xccD\xe4%\
+\x12Qh\x9b\xa2\x80\xcd6\xb0\x83\x9c\xa3[Fg\xc9\x87\xf13\xa6\x86\x99\xd5\xe6\
+\xb9\xba\x05\x04R\x156\xbe\x93*\x8aV\xab\xb2\x03\xd0-\x90\xb3\xf4\xd5\x8f\
+\x16fy\xf9\xe9L\xbfn\xa17/\t\xb6\xf8b\x80\x152@\xb5v`\x13\x80\x97\x86\xc4\
+\xaeB\x01\xf2\xb5\x8a:\xe4E\xa6\xd6\x9a\x80\xc5Zug\x14\xc6>\xbcT\xc2w\xce\
+\xd2\x8d+6\x0f-3\xbb\x94\xba >}\xa5\x085\x82]\x93\\!\x9c\xf1>b\xa4\x910\xd2\
+\x18]\xfc~\x0b\xb3\x99%\x9e5\xeb\x1d\xd8\xf4\x8a\x90\x90(BB\xe5tw\xd7\xcd\
+\xb0\x86d\xf2,\x8e\x7fb\xe3g\xd6=Ze\x08(\x19Y\x13\x03BF\x16\x86\'ODOn\x8e~\
+\xcb)\x9c\xb7Q@\x88\x8d BJJ\x07l8\xdc\x89\x0e\x86\xd9\xbb\xc9u;\x9c>9;\xe7\
+\xfcb\xb3\xb9zi\xe6\xd7@\xd0\x1br\xf2PH\xdf\xb9@\xab\x9e\x01\xc0\x90\x01\xee\
+]\xc0e\x8cH\x16\x7f\x01\x9bX;\x9f\xc8\x9bI:{9_\x17~\xedm\x80\xa2Q\xf3\xd4\
+\x805F\xe1H\x96\xca\x93\xc1&\xe8\xaa\x96\xd4\x1b3X/nY\x97\xe3\xb3\xf6\x08x\r\
+\xfdlN\xff\xa1\x90\xe53\x0c\x05Y;\x14\'gH\x94L\xb5\xa9sA\\\xdaf(8W\xb9sUi+u\
+\xf1\xd86\xf1\x12\x83\xd1[\xd8lo.zi\xff\xa1\x1c\xb9W\xb0u0s\xbcGv\xe7\x19n\
+\xd3\xab*\xb7\xc7\xc9\xa5\x9eik\x7f\x9c\xfc<]\xbe\xfeb1q\x03\x8e\xb2\x10*\
+\xdc\x8b\x05\xf2H\x9d,\xbf\x7f2x\xf4\xce:X\xfa\x036Df\xf8\xbb\xcb\xf0}\x13\
+\x8em\xaep\xfa\x0fN\xa1)wa\x00\x03&\xf6\xef\xfeH\xff\xf2i\xf2\xf9\x8f.?\x07\
+\xde\xc9\x86\x0f\xfd\x93(\x1aFi\xfa\xc8v\xa9\xf0\xe3n\x0b\x0c\x1d \x1c\xb0\
+\xbb\\\xcb\xaa\x1c\x8b\xcb\xe4H$m\xfd5\xf1\xb5\xd6\x06b3\xbf\xb2\x19%\x84\
+\x9az\x84\xd9\x15{(\x94[\x90me})d\xf9\xf2\x85\xd8T\xdf\x0e\x9c\xff\xf7e\x88\
+\xe61m \xb7\xf7U8n\x8b\xa1|\xfbXlB)\x13k(\x8c\xf7\xc8\xf3\xe3,\xb5\x97W?\x11\
+:1Z\x10~`,\xee6\\\xbe\x02T\xa7\x8bdb\xcd3*\x15\x90\xbac\xd9\x19\x07\x93\x9dW\
+\xb0mWR\xbc\xa9\xe7\x84]\xb7\xa1!\x84\x99\xce\xbc\xf8o\xd7\xc9\xcf\xd6\xe9\'\
+\x00\xd9;\x83\xe7{o2\x10\x8f\xd67\xa3V2\xbe\xfd\xe5\xe8D(g\xa7/\x9fy\xc9\x08\
+\x05q\x94\xdfw\xf3\xd2T\xdf\xfb\x019\xff0<\xffpr\xcezs\xee\xc7I\xba\x0c\xae~\
+\xf9\xed@\xa8\xb5d\xa4\xe8\x86\xdb\xca\x96[G\xa8@P\xbc\x01\xd3\xc1\xa6$*\x02\
+.\xeeV\x90\x0b3\x9b%^\xfc\xec\x15:\xdb\xbc6\xaf\x97k\xa1d\xa82\x0805\x9f\xf5\
+\xf6\xd6\xde,6\xad\xae\x83\xd6B\xa5\xa9\xe9\xa5\xa5\xe8\xd7\xc0?\xa8\x16\xc7\
+\xdd\xe8\x91\xea\x87r#\xc53P\xcc\x00\x9d\xfb?-\x981\xe3Q^W\xe4d\xc2S\r\x9aD\
+\x81"\xd4$\xd0\x05\x9c\t1%\xd1\x17I3l\xfa\x15\xd8\xdc\xe7\xfcT\x8b\x0b\xb9\
+\xf8Hg\xfeU6}f\x9f\xff0s\x16\xd2S\x94\x0c\xf5\xae\xb5\xa4\xc2\'VE\xebv(z\xd2\
+\x88Q4|\xec\n\xaciEX(\x9c\xce\x82\xaa\xc1f)\xf2\xe2\xe3h\xfa\xf1\xe4if\xce?%\
+\xfe\x89\xd3`{\xa3\xef8\xdd\xd5\xc8\xfc\x117\xb3\xdb%\xda\xbd\x08Q\xb9\xf8\
+\xb2,\x92\x9dO\xc4*\xe9]~\xd6Z/n\xcd:41V[@(!\xa55\x07l$\xab\xadPB\xdea\xa8\
+\x94,\xf8\xf2\x00\xd4\x8b6\x8fzO:Gc\xdb\x1b\xebP\x8c\n\xccT\x05\x07\xde\x91<\
+\xd5\x9c0\xfe\x9e\x9e"\x13k!\x81\xc5|\xf2\xc0W\xa201#\x9d\x98\xe4\xd9]F\xfa\
+\xc0\n\xe0\x16[\x82\x8f\x93*\x04y\xf6:\xb1\xfagk\xb3\xbe\xfa\xc5:\xd3\x8b,\
+\x01\x1e\xc9\x90\x8c\xa3\x1aGp\xf1S\x19\xa8\x880\x1c\x1c\x1d\xa5\xbe\xdc\x84\
+,\xdbg\xe9\x83\x8fR\xf9DD\xd2\xca\xd2T\xf7\x07\xa74I*/\x9f\xab\xe7\xffep\xf1\
+\xe7\xea\x0b\x87\x9c\xacyg\xf6\x7f<\xf4O\xce\xcc#\x85t\x89\x8a\x97f\x0b\x9b@\
+7\xbd)\x196\xe5\xca=}\rh!\xacI\x92\xd4"X\xf4\x13\xe0\x85\xd6?\xb7\xb3\xc5f\
+\x9e-\x96\xa1\x14\xaa|\xa7\xba\xd9\xbb\x84\x9d\xf6\xbf\xd7|E\x80\x03\xde\xfd\
+F\xeb9\xa7\x9e2\x8f\x87\xc7\xf2\xb7\xadtd\xa7\x1c0\xf1\x15a\xe9\xf2\xd3$\xcf\
+B\xfd9\xeb\xeb\xf8\xab\xc4X l\x8b3\xa4\x12\x02\xd0\xca^\xd8\xa4\x99\xb7\xe9\
+\xb4\xcd@\x96\xe1i\x0b\xbd]%\xb3\xbc\xab\xa4F\x9b\xe9\xec\xfc\xfbk\xab3\xf5B\
+\x06}q\xa3\x1aH\x12B\xc9\xd5\xa8\x95\x1e\xdb\xab\xfe-\xaa\x0f\xb1\x1c\r\x9fe\
+\xfe\'^g\x84\x04\x1db\x1cc\'\xaa\x84\xd1kjg<\n\xcf?\x14\xe7\xac7\xd3A<\xb9\
+\x056\xe3\xf4\xf9h\xfd\x0c+\x0bU\xd3\xee\xbe\xd5H\x16U:\x05\x1af\xc5\xaf!\
+\xc9#\xec\x14J`\xf7zz\x9b\\\x98\xf8\xfcV\xea\rxS\x81\x94\x07\xed\x0f\xaf\xd3\
+P)#[f\xee\xf7t\x9e\x1b\xad\x84\x0b&\x0c\xd6\xa6u,?+\x1f\xe6j\xaa\x8e\xbb?}\
+\xa4\xe4\xc8\xd5\xef\tGH\xc1\x89\x8b\xa4\x03\x8eWo\xb1\x9ap\xcaW\x1a\xd12\
+\xb3\xae\x14.k\xde\x1d\x8dF6\xbf\xb9\xb2\xd46\x0f\xbd/\xb2\xccb\xb1\x06{{\
+\xa3/\x7f\xcc\xe4)&\xde\xc0\x06B\xa1\x80\xc4j\x9c\x9eY\xb1\xd6\xb3v\xb8d\xda\
+\xef\x9d-\xe6\x86\xa331\xfe\r\xc6--\x90!Z\xa0BF\xce\xd9\x17\x9e\x93<\xa9\xe3\
+g\xf2D&\x88\xa7\x1f\xab\x0b\xcc\xe4\xd9\xf0\xe6\xe2z\x95\x10}\xb4\xe9\r\xc5\
+\xc9[\xce\xe5\xb4\x16\x8e\xab\x93\xbf\xfdg_l\x11\x98\xd1\xebyk\xbd\x85\x93\
+\xe5*Y]~f_}&\xf4\xd4\xf5P\x87]\x9d\x1cx\x95dM\x94PH\x19\x825\xc6\x82\x92\xb2\
+\xea>}\xd5\x1e\xa5L\xdf\x1d\xfd\xa1=9s5@t\x9cN\x12_HF2\r\x9f\xf8!\x90\xc0\
+\xe4?d\xcf/,\xd8\xde8\xac\xb2\x1e\xedn\xe18g\xa4G\x9d\x91\x10\x01VG\xc8\xd8\
+\x9aN\xc1\x93t\xe0Y\xd36gvv\xb1\x8c\'\xfe\xf2\x88\x8bI\xa6\x97\xd7\xfa\xf1\
+\xf1\x91SV\x8e=\xba\x1d\xe7o$\x0e\x00\xf2Z\xbe\xb2\x8f\xff77\x83\x94\x8c\x87\
+\xc9\xc9\x19\xfd\x8f\xde\x1d=\xb1\xd1Y\x14\xf9\xe1Q\x8e\x99\x9b\x01\x83\x17u\
+\xb5s@j.?S\x9f\xfdG\x9e\xfeu\xf6\xe5\x17\xeb\xebGx\xef\xa6\x7f\xf1v/\x1ap*\
+\xd39\xe0\xdeIq[\xd0\x81\xbai\x85\xdb2w\x04gK\xa1s\x87R\x84R\x01I\x12\x7fm\
+\xf4\x17\x8b\xf8\x99\x8e\x17f\xf9\x96\xec\x84\xd2\xd5\x18\x83B\xa7\xb0\x05r\
+\n)\xdcW\xf7AI\xa9\x0f<\x17\x95\x90\x88\xb6\xc2\xd7*\xbd2\x19\x96\x13\xeb\
+\xe1\xf4O %\xb6\xd9\x07\xeb\x9f\xbc\x15\x8b\x8f\xd4\xf8\x0c. \xb1:c\xf8\xbe\
+\x0c>f\x0ch\x9b\xfcP\xc4\x93#\xa3\xb0\xe3\xca/\xa7\xad\xb5\xc64\xf36\x9do\
+\xd3i\x9b>76\x87\xa3\xbc\xdcn9\x85$q\x94\xc8\xe4\xc5$\xfe\xfe\xe7\xc9\x8b\
+\xb9\xf7\xe5m\xf6\xce@\xf5s\xc3%\n%2\xc8\x99\xb5J()\\\x84\xa5r|\xfd\xf0\xd18\
+\xf2:#\xc6\x85\x873\x7f&W\xf2\xc1w\xbe>\xe3\x93s\xe2\xe9\xf4\xef\xd137\xdce\
+\xd9\x94\xc1\xcb\xea\x8b\xd8\x8a\x16\x17\x8bO\x80\x96\x999\x97c\x19\xac\x01\
+\xe2\xe9\xa5\xfe\xe4\xd5\xec\xf5\xec\xe6\x97\x1a\x08\x86\x9d\xee0\x00\xb2ef\
+\xf6\x9evRn\xcf\xa2\xa8\xdc\x0b\x9bE\x0e\xa4\xd92\xcb7\xc9@\xd2\x02\x8cB\x17\
+\x9e^\x15\xc9\xdaI\x08U\xc79-)(\xa3\xa5\xb7\xd3\x12O\x99j\x12\x87\x96\x8e\
+\xe6\xe4\x82\xec\x9a\xa4\x99\xb7)\xda\xefZ\x08\x84Ga\xedR\xbe\xc6\xa2\x02Gyx\
+\xfa\xf6\x86\xeb\xe7\\\xfc\x19\xc9y\x06<\x05\x19\x02BF.\x82\xac \xb1\x84Je\
+\xedQ\xcat\x03>\xa3\xebU\x02\x0c\xdb\xe1l\xf4\x9d\xee\xb7\xde\x12O\x90\xbb\
+\x81\xa1\xdc\xc3\x99<q\xdf\x12P\x16\xc5\x13q\xfe\xc4;\x87\xa7\xcf\xd67\x17\
+\xc1\xd1\x99pZ\xabD\x801(\xb0\x15:\x86u\xc0\x0e\x14\x94\xa1l}\xb5)\x8ad*\x81\
+\x8e\xcfc\x13\xc7\xc9y2y\nx\x0e-E\xf1\xd0\xb6\xda\x1a\xcd.\x84\xeaJK\xa9p\
+\xee(\xa5VW6\xc9@v\x03\x80u\xee\x01\x90j\xd3&\xea=\x11RY\xa3_\xcc\xcf_1J\x99\
+\xbe}\xf2\x91\n?t*\xa8\xa8z;\xcf\xed\xed\xcd\xc4\x9e\x9c\x8d\xc3T\x84\xbeMR\
+\x05:N\xa5N\x9a\xcb\x14\xcb\xacu\x1a\x84Kk\x81\x126\xdd)\xa9\x02\x11\xa0l\
+\x1a\x07\xf6\xeb \xfe;u9YL^\x98$\\\x8aNG\x9d\xfa\xbe\xb3\x06\xbb\xf4\x16\xcb\
+\xb9\xafz\'Y\xe7a\xda\xeb\x89\xde/\xcd,\xcd\x16\xad\xd5\x12`\xc9;\x83w\xff\
+\xe5\xfc\xbd\xef\x99\xdf93\x91o*\xb4\xc6\x03*\xfa\xff\x1a\xde\xfc\xd9\xd1\
+\xb3?R\xbf\xf8y|\x91\xbeZ\x8c\xd3\xb7\xde\x0e\xa2\x0f\xe5\t\x80\xe4E\xba(\
+\xc16\xc7I[<\xe4\x96\xae\xc0\x18\xa1\'B\xa1Blr\xf9\xfagf\xf6\xf7\x93\x89I\
+\xb4{\xbd\xdao\xc8N\xe8\x885\xf9\x99\xcb\xdf\xd0U\xbe\x8a\xc5\x81\xa7\x06e\
+\x10\xd2\x19\x13\x85\xe5n\xac\xcei\xfa\xd6]8J\x0b)\xa5\xb2BJi\xe0J\xb5S\x93\
+\xf8"|\x9c\xae\x86\xe4q\xe2/|1\xb7\xf3\xd4$\xca\xff\xe1\x07B\x9d\x89\xf0#\
+\xa1Dv\x12Y\x1f\x98\xc6\xf1O\xd0I[\x87V\x8d\x13>\x0c\xcf\x08\x99\xc6\xf1\x05\
+\t\xaa\xc1\xb7\xd9\xf5\xc3T(\x9c\xb6i\xaa\x85\x90q\xe7\xc7\x15v-\x19G\xbe\
+\x01\x8b|\xf9S;\xffYG\xfdB^\xbd6\xd9;\x9b\x9b~\x06\x08%\xad\xbe\x05\x84Z\xdf\
+\xa8,\x8e\xa0\xbbN\xd6-15e\xc0(\xfd\xed\xab\xe7\xdf\x19|B\x1c\xa2\xabu\x83E%\
+\x97\xd8Q\xc7sD\x1dE\xcf>\x90\xcf\xfe\xadL^\xa8x\x92\xe9\x0fZS\xb5\xf8\xb4\
+\xf0\x1b\x98\xe2\xa7\xd3\xd9F\x16\xe9\xe7\xaeR\x87\xbb\xfa\n\xb4\xd4\x80\x99\
+\xae\xa6\x9f\xc4\xf1\xf9\xecr2\x03\x8e\x8e\xe5y\xdf\xeb\x9ez\xad.\x9b\xc5&[\
+\x02\x18\xed\x90\xa6\xd4-s\xe0\x91\xaa\x03x\x9dM\xd19\x03\x8c\xa1;\xf4 X\\\
+\xaf\xb1\x1b\xa9\x84\x08\xad\x8a\x04\xc7\x9e\xe9\x07r\xb6\xd6\xaf}\xb8\xf9\
+\x87\xe3n8,.)\xbb\x92\xb3\xb5\xa6\x0f\xd7\x17\x8f6r$F\x08x>b\x04L1\x1a\xbd0\
+\xb3\x8ddD\xe8\x8a\xd2kF\xee\x85:\rFzk\xf0\x00\x7fl\x85\x1f\x08\xafI\xab\xda\
+\x81Mg\xa7\x9b\xdb\x9b\xec\xcb\xbf\xe4\xea\xfc:9oe\x7f\xbey\xfa\xfb\xda\xb97\
+e\x84\x89q\xbf\xbf\x8c\x12\xf2\x90\xba\xd5\xb1\x02\xa7\x85&\x7f\x16\x89\xe8\
+\xa3/\xcf~\xcb\x8c<\xa7vn/\x14\x97\xdd\xe2\x8a\x0e\x81\x96\xa8\x10\x9d \xa6O\
+\xd4Sf\xcf\xbf\x8e\xe6\xd7\xe1\xf0\xb1\r\xba\x16\xcfi\x8f/\xe6\xf9\r\xfb\xa8\
+\'3\xb8\xa23,j\xc49\xddr]$\x99mV\xc9\xcd\xe5g\xfa\xeb\xbf\xb5FgXG_\x93Ree\
+\xe2\x97C\xbf*\x1d\xbb\xa6\x82\n\x95[\x06\xb6\xac\xc4JKE\xd6\x18Y\xb4\xa0"O\
+\x1ew\xe5q\x0f\xf4\xc6P8Q\x13\xd8\xb4\x01\x06\xd9\x91\xed\x9fD\xf9\xfd*\xb2\
+\xa3q\xd2\x1b\x8bPh\x99\xd3\x8dn\x9f_\xb8\x00\x10\xd1\x87D\x05i\'N9\x00#@\
+\xdc\xbf\xc8\xdb\x0c\x106O\xb7\xe8\x08Q\r\xa6K\xbd\x850\xfa\x95W\x00\x00 \
+\x00IDAT\xcd\xdc\xe6\x95|a\xae\xbf>\x8d\xaf}\xf3\xe3\xe0\xab/^\xd2\xca\xfe\
+\x1c\xe7\xde\xac:A\x17P\x06\x89\x02\xcc\x8dv\x8d2P\xad\xcb?\xfem\xf5\xfe\xd9\
+\xd1\xdb\xaa\x13>\xb92@\xd8SQ\x98\x9b\x95\xd2J \xa7\'\x19\x90\\\xd9\x9f\xffg\
+\xbe\xfc\x9b\xf4\xab8\x9d\xb9\xfa\x99\xe1B\x7f\xe1w\xe77\xd7\xdb\xb4\xd7\x04\
+\xe0\xad\xa3a\x98.\x94\n\xcbS.t\x02\xdc\xc2R\xebs3\x9f\x98\xab\x85Y~X\xa48\
+\x95`\x08\xe4H\xb8g\xea\x95Z(\x16\xa4 \x07R\x9bo\xb2B\n\x81\xc8\t>\xd2\neEh\
+\xa5S\x8d\xe2JE#)\xda\x11b\xa8TW\x85\xc0B\'@7\rC+\xce\xb4T&\xdf\xcbd\xfd\xea\
+gf6\x80\x0ft\xf4\xa4xa\x1c!\xb1\xd6w\x84\x84\x8e\x1c\x01\xa9\xe6\xff\xa9\xbe\
+\x10On\xc1JXd\xac\xb9\xf9\xa4\xb5\xf9\xe9\xc0\xfb\xf2\x16\x98\x1d\x9bk\x15\
+\x94\x9a\xa7\x932Hd_\xe4@$\x1e\xad\xd5\x13>\xf9\xe0\xf6Y\xffRy"D\x84H\xb0\
+\x95;\xd0\x14\x10\xea<\x9f\x93\xe9H<\xfb\x17\xcb\x0bm\xe2O\xbeD\xdb\\\x8f5q\
+\xe9]L\xf4\x1a\x10J(u\xa3\x8e\xbbbh\x85\x0c\xacY\x03B\x06\xcad\xb7&[&VOV\xaf\
+?\xdd\x80\xf8\x92MPd\xc3I%D\x88\x94\xd2\x18\x03b\xb3\xa8D\xa4s\xe5\xd3b72\
+\xcf6\xda&\xae\x00^\xc7\x83M\xab\x0b2p\xdcXIK(*\xd1\n\xbf\\\xa4z\'\xb8\x18v\
+\x86\xa3\xeeF\xe6^\x82Yb\xfa\xe1r#\xdd\x0b;\xf2\x13\xa0\xe9\xc6\xd39\xf0\xc3\
+\x11\n3*\x9e&SL\xb3o\xd3E\xd2%^&\xea\xb8\xb9\xf5IT\xdf\x14j\x10\xc6\x86\xeb\
+\xf9\xe2\xcb\xbf\x8c?\xfb\x13?\xfb\xf3\x8d\xf7\xaf\xf2"\xcdU\x1c,\xab\x07\
+\xcb\xc8\x9a\xd89?-0\xfe\xae\xf7\xee\xbf\xe2\xf1HF\x9e\x8a\x08#\x1c\xdbXW\\\
+\x94\x90G\xdb\xb5y\xa2\x13x\xfa=\x9e}\xdfN\x9e\xba\x90\x93\x81P(-\xa4\xb2&\
+\xb1Z\x9b$D\x18\xa9\xa4PZJ\xa4\xfa\x7fh{\xa3&\xc7\x91\xe4L\xf0\x03\xe1 \x83d\
+0\x13\x99\x85\xeabwg\xf7\xa4f\xebF\xad\xdb\xde\x9d\xb6=\xd9\xae\xcc\xeeao\
+\xed\xee\xe1\x1e\xce\xec\xfe\xea\xbdhMk\xa6\xbd\x1b\xd9\x8el\xe7L:]\x8f\xd4\
+\xd2\xd4hkzr\xa6\xb2\xabX\xd5\xccL$3H\x06\t\x07q\x0f\x1e\x11\x08\x90\xcc\xea\
+n\xed\x9e?T%\x01\x10\x04A\xe0\x83\xbb\x7f\x9f\xbb\x7f\xa0> u\xd2\xb3\x8b\x9d\
+:a`\xbd|\xb7zx]\xce\xaf\xc2/\x13\xa5d4\xf4e\xa6\xb2\x0cx\xb0wM7\x86k\xf1\xf0\
+\x985\xa4I)\x05\x95\xa9ae\xd7\xd2\x14d\xa2\xce \xdd\x80m\x15\xe8\xf8\xd1\xe4\
+d\x94\xaa\x9d:\x19\xaa\xe2\xa1\xaf\x00l\xb6%\xac\xd9(\x9d\xf6\xf3\x07@\x9f8\
+\xa1\x912\xa5*_X\x00\xaa@\xf1\xdcx\x86\x1d\xf3]\x87\x12\x9a\xd6\x13\x07\x9b\
+\x00\xb1\x060\x00\xed\xc9\xdd\xd5\xd6\xc1\xe6^\x86\xd3\x10\xcd\xcd\xfcE\xcfT\
+\x83_\xbf\xb5H\x9b\xbf\xc8748\xd5\xc7S\x11k\x008\x19\xe0\xad-\x9f\xa9|\x92\
+\xcc\xff\x87\xde\xdf_\x8e>\xfe\xa2\xa7\x9e\xab"\x10\xeb;\xdb\xf1l{\xeaD\xcaj\
+\xae\xbe\xfd\xc7\x9f\x99\xd7?\xb7W\x8b\xf5\xafe\xd5\x93^\x0f5\xce|r\xa0\xc1\
+\x06@\x92\x0cP\xe3c\xce4\xab){\x9d\x85\x81\x05\xac\xb5s\xb6\xd7>k\x1c\x0bCr\
+\xd0\x94\xf2\x9c\x94\x02J\xb2\xf1\\N\x0bF\xf0]\x0f"w\xad\x14\x00\xc5D\x8aD\
+\xcf#k\xc5\xdb\x84\xec\r;\x00\x85\x1a\xe5\r\x06J\x03\x98Xh\xd2\x00\x84\x1c\
+\x0f//%\xb0#*a\xfe\n\xf3\x8d1\x05\xf4g\xa6\xc8I\x17Z\x03\x98\xc7C1\x06\x17\
+\x98]\xa4\xd9t\xa3\xce\x86\x02\x9b\x99Z\x1c\xc9\xbczo\xb3\xab\'\x97\x16jdg\
+\xf5\xf6\xaf\xc7\xf5o\xeaSS1p\xa3\xeb=\xd8t_U\xab\xf2\xad\xa0\xff\xe4\xdd\
+\xb3\xc1\xea9\xbe\xfc\xe3\xea\x1a"\xe3\x14\x96\x99\x00`J\x0c\xa7\xce#L\x81\
+\x95,\xb9\xfe\xec\xf5\x0c\xe5\xf5/\xe6\x8b\xaf\x1a\xb3\xdc\x01\xd8v\xe7\xb9T\
+\xcb\x1a@vZ+E\x0f9\x94\xc2\x8b\x821\xcc\xb0\xaex\xce\xd6\xdaz]\xafo\xacl\x06\
+@0\xb3Z2\x80\xf2\x99\xba\x9e\xd6\xdamO\xecEC\xf2.\xf1\xd7\x9aMc-\xc0~\xb67\
+\xa5J9\xb0]\xde-\xd3!\xcb\xaf%\x01\xbeRD\xdaB\x11 c6\xe9z\x98\xd0\xe9\x80T\
+\x02@\x83\x9a\xbc\xae\xd58\xb5\xf5\xb2\xb4\xe3\\\x89g;T\x16\x8e\x0c\x82\xbd\
+\xc2|\xc6\'#\xfb\x7f\xfdd\xf9T\xe5a\x86]\x0b\x9b\xbd\xd7\x97\xc9\xaf/\xa0\
+\xf3\xdd\xe4i\xe2\xbdM\x1b\xdd81+\x8dcS\'\x14\xd0\xac\xae\xc7\xb3\x17\xf6\
+\xf5/\xee\x03\x1f\xd4\x85M1\x0e|\x89-u\xfe\x1c\xba\xa8?\xfd\xb7\xd5\xa7\x1f\
+\xda\x1c\x86\xc09\ni\x10\x14qJ\xe2s\xea\x12e\ts\xfd\xbf\xcd^\xbe(\xaf\xfe\
+\x1cv\x0e\x87\xbd\x1d\x86_\xc0P\xf98\xda*%\xd8%P\xc6f.\x81\xf6\x1ef\x86 \x80\
+I\'\xf9\x87\xfe{\xae\x01XX\xb6\x16\x11f\x1eRA\xf2A\x8d\x99\xcb\x1f*jh\x94(\
+\xdf& \x1b\x02\xd0\xa9\xda\xa9\x13\x05hU\x00P\xaa\x00\xf0\xed\xce\xd0\xb6\
+\xdcx\xff\xb6\x16\x1d\x82*`\xe7\xab\xf2\xeb\xc4\xde\x95\xd9\xf0\xe4\xc9\x8fY\
+]\x00\x10n\xe8\x91 =K5Zo3>\xc4\xbd \x1d\xc0t%\x03)\x01\xa0\xec\x9b\x17\xa3\
+\xf9\xdf\xaa\xb7\xbf)g\xe5\x80\xf3\r}(]\xc0\x87\xce\x9d\xbb\xd9u\xf2\x95\'\
+\x03`\xfd\xcb\xc9\xe4\xe3\x7fn\xfe\xf2\x0f\xf9\x9f_n\xe8\xacG\xb9\xd5\x85Q\
+\x00D\x03\xdfn]\xceK\xe6\xb2Z\xfc\xcc\xbc\xfe\xf9\xee\x9b_o\xfe\xe1\xa6\xd9\
+\t\xf1t\xbe\xa9\xde\xd8\x16\t>T\x03\x00I2\xf8\xb8I\xc0\x00\x932\x14\xa8\x06\
+\xe3{}\x1d7\x8b\\Qa\xb4SOK\x8d\xa7eK-f\x063\xd1~4\xfb\xe1\rD\x8a%\xed\xd9\
+\xfa\xa5\xb9R\x03\xad\xa5\xc3\xc3\xdc\x18\x18\x14Z_$c=\x18J_\x1f6\xf6\x9a\
+\xec\x1b#d\x95\xb9\xd0Z[\xca\x93\x01\x12\\\xab\xe5\x9c\xcd8\xe9=\xb5\'\x17*\
+\'\xed\x88\xa1N\x9bb\t\xd2}n\xf3d\xaf\xb8RLyb:Z\x12\x93\xaejm\x97\xef~\x91\
+\xf2_\xd2\xee\x8eo\xc1|F\xd9\x98\x80-(\x05\xd7\x00\xe6IR4\xcd<q\x17\xba\x1e\
+\xf7\xb6\xd3\xf2\xcb?\x9e\\=\xbb\xd1\xc9\xb3\x1c\x00L\xee\x1a\xa9!L[\x12\xfc\
+,a\r\x043\xdf\xcc\xbf\xaa\xd3\xb7\x1b\x00\xd9\x98fHx\xd9^d\xb3qR-9;\xad\xcb\
+\xd3\xcc\xd34\x0c\xc0ZV\x8a\xac\x058\xa9\x96\x9c\x1d\x0c8\x90\x853\xc2\xf0t\
+\x03l\xd2a\xaa\x94\x9f\xd0`9x\x9e\x12\x92\x87\xe5\x80@h\r@\xe9\x81D\xee\xaa\
+\xcb\xd3\x8e\x9f\x8f\'y\xa6\xa6\xa7k\xbb4W\xcdf\xb3\xa2S>\x9d\xee\x86\n\xda=\
+t\xec\xda\xd6\xf73\xe6\xfb\r\xd6\\\\fMNC5\x04\xb0\xb6\xbbd\x06\x00\xcd4{\x1a\
+!Y\xa7\xdff\xf06\x01lz\x17)\xf5\x02\xa5\x18F\xee\xaa(\xb7IQCuR\xd0\x86\x01<,\
+\xaeGo\xfef\xfe\xe6o\x1b[\xa6\xcd_$\xc9\xff\xb8w\xb9\xe6\x90\x9e\xde\xce\x0c\
+@\xf9\xf3\xea\xdf?_N\x7f\xda|0Uy\x02\xe5&*\x90W\xbf9\x8c\x9dc6C\xf9\xed\xa2\
+\xbc\xf9\x9b\xf2\xfa+\xd8y\x00\xe7\x1c\x94\x00\x0f\xcd\x7f\x040I\xfeg\x06&J\
+\x83t*T\xb8\x87;\xb6\x06J\xb3\xc7L\xab4uc\xf0\xc4\x7f\x9dF \x17\xb0\xba\xf0\
+\xef\x95o\xbb\xefm\x86\x9f\xc8\xf8\xd4\xa5\x0b\xf3\xbb\xcf\x8b4\xff\x88\xd5\
+\tT1\x04j;O\xed\x02@\xadN\xa0\nV\x85\xb5\xf3\x12\x96\xad\xe9\xdb\xc5\xb6\xb6\
+i\xb5^\xa9\xb3\xbe:Q\xf9g\xf2\x11\xd6\xce\x8d\x9d\x0b\x90\nf\x9a\xf9\xcb\xe4\
+\xe2_\xfe\xd1\xe9\xd9\xd9\xd3ggE~6:9U\'\xf9\x13E\x89\xfa\x88\xc8\xa1P\x0c\
+\x9b\xc3\xddB:\xb3\t\xb1\xaeW\xd2-\x94\x1b}\n\xe0\xcc\xdc\x00(A\xbf\xba\xbe\
+\xfaO\xd7o\x7f3s\xbe\x86\x03\xb1\xe1\xa0Y\xbb}\xde\x0e\xb2\xcd\xbd\x19\x9cj\
+\xf16\x01\\<\xbd\xf8\x17\x1f>\xf9\xf0\xb4\xf8\xd1\'.\x8e9\x1bR>\xd2\x05\xa9\
+\x9c\xb8d\xc2\xc3\xed\xcb\x9b\xdb\xab\xd9\xec\x17\xb7\xcb\xab\x9b7\x9b\xdb;A\
+\xe0\xcd\xbd\x91\x8f\xd8\x83\xcd\x8b\\\x17\xfe\xda7\x96-\xd8X\xcb\xd6\x9d\
+\xfb\x00\xe3\x00\xc2Q\x05\xd3\x9e\xf7\xd1 \xa8\xee\xddi\xb9\x8d\xc7\x81v\xad\
+e\x03\x8ey"\x05j\xcbV,kE\x1f\x8fF\xc3\xd1H\x92\x9f\x92%\xb0\xc0\xa9\xc7\xd2\
+\x07\xe0\xde\x18\x04g\xc2\xda\x8fG\xa3\xa7\xa3\x93\x8b<\x07`6\xeb\xd2\x1f\
+\xa7,\xb9.\xcb\xef\xd5\xcaCj\xc9\t\xd6k\xda]\xd1\xb7K"@\xbeg{3\xcdP^\xff\xec\
+\xc5\xd5/o%Z\x07\xf0\xe4\xf2\x14\x00\xb8\xae|\x13\x98{\xddr"\xf4l\x94OU\xfe\
+\xd9\x87\xd3\xe9\xa9F\x01@\xc6>\x86\x1e\xbfB\x82\xccP^\xff\xf2w\xe6\xd5\x83\
+\xc8G\xd8\xb0\x14l\nx\x02X\xdc\xb9/~r\xa6\xce\xfe\xf0T\x17\ngC~\xb5^\xde-}\
+\xee\x91\xc15\xc8\xab\x838b\xc3\xa9\xa3\x93\x13\xde\'\x19$\xf2\xc6d\xd0\t\
+\xd5\xc3\x92t\x98Be\xb0\x95\xf0A\xcd\xa6\x89\xb7\x8cP\x17\xa4\x81\xb3aq:\x96\
+\xed\xb7\x0b\xbb\x90L\xde0"\xc8\xd6\x95\xf1\xb1\x87\x06p6,\x9e\xe5jz\xea\xe7\
+\x0e\x97v\x16\r^\r\xbaMU~\x8e\xd7\x85PB\x83\xc1O\xa1\xb2\x8a\x9a0N(E+\xe0\
+\xa1\x08(\xc8\x02\x96Y\x11\x00\xa30U\xce\x19\x99\xcew\xf6\xfa\x17|\xf5\x8bks\
+-\xa9\xb2\xf9W_\xc0\x83\x9b7\x7f\x94*\x07\xc0\xaa\xa8\xce\x9f\xf3\xf9\x94\
+\xf3\xcf\xa1\xc8\xfa\xcf\xd0>\xc5\x17\xd0R\xa2\xf2\\\x17\x12\x9e\xcd\xcd<\
+\xf1\xd0w\n\x88\'\x92\x80\xf8\xaf4\xeb\x8bL\ra\xd7\x8dqub{\xfcN\t\x04\xd8\
+\xd4J\x1bk\xf6\xd8\xf3\xe6\xe0\x8fvU\xa4>\x8a\x91\xb9\xf1\x1e\x96\xac\xb5\
+\x00\xa0\'*\x030Tg\xacN\x00l\xedbm\xef\x8c\xbd\x03\x00\xa5\'Q\xe5r\xe8Y\xf5\
+\x80j\x94\x9d\x98\xf1\x07J\x15(\x9e\x03\xd0\x802\xe5\xbc|a\x81\x9e]\xa0\xf56\
+\xe9\xa6\xd8\x9d\x8d\xea\xd3\x8f\x07\xc5\x90~A\xf2\xa9\x8c\x01(\xe8\xdb\x83\
+\x06\xe9Yo(=\x82\xeeT\xba\xe4\xe5\xdcr\xce&g}a\xf1\xf9\xe5%\x00\xe4\xf8\x05^\
+\xfe\x1f\xe6\xc5\xffY\xbd}k\x01\xb8\x98]\xf0S\xf0\xed\xa3S\x7f\x9a\x1a\x00x\
+\xb2\xe9}\xbc\x1a_\x8c>\x98\x9a<g"\x16\xee\x91\x1b\x9c.\xcd\x92m\xf9\xe2f~=\
+\x7f\xb7X?\x08Y\xff1I\rG\xef\xf7\xaa^\'\xab\x00}\xa9\xdd\x00\xf8P\rr\x90f%Nf\
+i\r\xd0N?L\x12\x87\x99gp\xe1<\xe0\x04|\x14\x85\x1c\xda5\x81\xe0\xf8e0E\xae"\
+\xd1\x82\r\xb7Y\x18M\xca\xf1\x89\x8c\x80L\xc44U\n\x8c\xf1\xaa\xb7\xdc\xed,P\
+\xb25l\x8d\xb5\x9a\x15T_\xa3\xa7\x80\x10\\8qp\x83S\xe8\x0f-]\x98<\xcf\xb5af\
+\xd8\xbf\xc2\xfc\xde\x98\xd2Z\xecy\x9b\xc3\x8b\xd1\xdfO+uf\x056%H\x0f\xdf\
+\xc7\x88.\xa8Y\xead\x97c\x1aZS\x1a\x94sc\xb5\xb9)\xa6O4\xae\xa5)\x10\xe3\xf2\
+\n\xb6\xff3[\xff\xb2\x16\xf0\x0c\x9e\xa7\xb8\x857\xba\x85\xac"\xed\xfdV\xd5\
+\x0f\xcf{\xb3K&u\xef\xc5\xe1\xeel2J;\xbb\x99\xbf]\x96\xbf\xda6\xbf\xb1\x00\
+\xfd\xf6Y\xfd0m\x9c6\xd2\xa0\xbe\xeb\xado\x12\xb8(\x9b\x00\xcc\xc6\xc9\x0c5\
+\xc8\n\xfaY\x93\x04\xb8n]_wI\xb6\xab\x00d\xe3$\xc2\xcf=O\xcbE\xdc\xee\xc0r\
+\xb7\xb6^\xd7@\x16\xfcOq5\x03\x966\x9b&\x19\xd4\xe9\x90\xa1j\x15ug\xb3\xd6\
+\x02\xa8\xd7Y:\x04T\x03\xd4\xd0)`\xddc\xb2\xc5\xd2%\x9d\x0eN\xa7\xcb\xa1\x02\
+\x80\xb5]&e6\x7f\x9b\x98W5p0K\x08\x1e6Y5C$\x0c<p\x93q\x02\x80<\x19M\x93\x13}\
+\tM\x02[\xbb\x17\xaf\x0cn\xfe\xe6\xdb\x95\xa5\xf3).\xbf\xe0\x0b\xe49\xca\x12\
+\xfa\x1a\xd3\xab/q\xf5\xf3\xab\xf9K\x01\xcf\xfb\xe4\xdf\x04\xe4\x8c]\xb19X\
+\xab\x9cI\x97y1\xcaN\xf6\xc4\xe1l\xcdj\xf9\x0e\x0f\x0b\xb0\xb9/_\xe6 \x89\
+\xa3ETIJ5f\xae\xfc\x05\x0b\xc0X\x13\xcezp\r\x8f\xe40\x0fV\x1d]\xbbg&p\xe8\
+\xf2:"\x8f\xc4ZF\xc9/wK\xd8\x18\xbf},\x07e\x0f\xb0\x80\x86\x82\x01\x04E%\x9c\
+O\xabu\r,\xf3\x1fm\x94\xce\xe1B\xfdQ\xf9\xb5)\xdf\xe10H/\xaa\xf1`\xf0\xa7\
+\x13\x0c\xb4\xba|\x92\x99\xb7\xf7\xb7\xd6l\x1fP\xdfX~\xa2\x08\x19>\xa4\xc1s\
+\xad\x9e7\xe7\x97\xf99\x80\xab\xea\xf6\xcf\xe6\xaf_\xe2%F\xf8\x8c\xf4\xe7\
+\xb6\xf8\x9c/5r\xe4x9{\xf93=\xfbs\xfa\x87\xc9p\xf9\xfaN.\xd8\xbf\x94#\xfeP\r\
+\xc4\xdf;mj\x00\xf7I\xda\xac7\xc9pp:\xaf\xa7y\xae\x1a\x15\x1a!Z\xa0\xb4\xd6`\
+w\xcb\xcdd\xb3\xba\xc0\xe6\x8d\xdd\\`\x90\x0c\x07C\x1e\x9dS\x05\xe3"\x18\xad\
+\x94r\x8e\xa5-\xad%E\xe2[\x1eH_;v\x18\xda\xef\xd9\x11\x05\x99\xf5\xbf\xa2\
+\xa44=\xbav\xf2\x9c]\xc8m/\nv\xb4\x91\x8f\xfd\xadV\xca)\xe7\xd1\x8b\xaf\x1d\
+\xe50\x19J\xa9g\xd0\x1f\x92\xbe \x05\xe0\x9a\xed\x15\xcffdU\x0c\x9bR\x93\x9e\
+MI\x9d\x8d\xd3\xc1\xf8\xf3B\x9aW|Pb6\x87\x01\x90\xa3\xd2(\xbe\x01\xbf\xc0T\
+\xc3z\xc5\xfe\xee%\xc8\xa0\xb0\xb3\x9b\x17S\xf5\xe70\x1a\xd7S0\x80\xd9\x9fX\
+\x03\\\xffr|\xfd\xabm\xf9v\x08\xa0h\x1a\xc1\xa8W\xa8\'\xcf\x12\xca\xa9R\x13\
+\xd2`\x033K\xac\xd9\xbc\x01~\xf7d\t,\xd33\xe5\xa4;\xa8y\xb6v^\xa2KZ\xd2+\xd4\
+\xd9i\xad/\xb1*\xb4d,\xdd7v\xd9K23\x00\xb0\xc69\xb7\xd9\x98\xba\xd8\x18\xbfl\
+\x9fd\xaf\x0e$\xfa\xd9\x98\x04E\x1d\xfc\xb6\xf1\xb8\x0b\xe7\x95\x1f\x9f-\xcf\
+\xa0\xf6\xd4{\x1f3,\xe9:\xae\xce5\x05Hji\x95\xf2\xd5x\x1a\x08W\x8c\x83h\xa6)\
+O/\xdd\x1e\xd7\xb6\xbe\xf9ub^\xd5Z\xa7\x0e6\xa9\xfc\x9c\xae\x8a\xaa?\xcd\xa6\
+?\x1d\x8c\n\x95g<E!\x17\xfe\x0c\xba\xac\x00P\x9eAc\x9a\x03p\r\xd0 srgh^_\xd1\
+\xb6d\xe0\xa1\x9f?\x008\xb9\xd0EO\x86\xe7\xaa\xc5u^\xbe\xd4\xd2\xc2\x90\r[\
+\xf3\xd0\xfc\xc7:\xf9\xb7\x13\x95C\x17\'\xf9\x8f\xfb\xeadk\x17\xb6\xfcZ\x999\
+\xbc_\xc7\xd1\xbdb\xa28:@\x9cRzR\xfcw\xa7\xf9\x8f\x8a\xfc3\x00\xf3\xf2\xc5\
+\xd6.\x00\xac\xed]\x06h\xbb6\xe6\x9a\xbd\x84\x81\x0f\xb0\xf1{vw\xe2.u\x1e`\
+\x19!\x9cW:>\xbc#RO\xb96\xf7\x1c\xd7\x98\xa9\'MJ\x89S\x1a>#A&\xb0\xe9\xf61\
+\xfe\x00\xca\xe5\n6\xb0\xc9\xec\xefa\xef\x8c\xd2\x0e6u\xfdJo\xce\'O>\xf8\xa4\
+\xfa\xb3\x7fA\xd3\xcf\xf3\\H\xdb\xf2n\xf1W\x93\xadP8gT?\x1f{\x1d\xf7\xb7\x90\
+Q\x8f\xb3\xf9\xfc\xffEz\xdf\xff\xe6\xcdb\x0e\x00\x16C\x9d\xe7%\xc3*Xk\x8c\
+\xb9\x06,\x99\xb9^\xdd\xdaf]\xaf\xce\x86h\xd6c\xe0\xaf\x85y\xf9g\xbb\xd1\x10\
+\xa3\xf5n\xf5\r\xad\xe6\xca\x86\x10\x18@\x08\xa8\xe3\xa7c@\xb9K5\xfe\x82^|1|\
+\xa614\x9bu\x89\xcd\xb7\xbb\xc5r\xb7cf\x00\xa4\xe9\x9a\xcd\x1c\xa6\xb4\xfc\
+\xc6\xfb\x9f\xf1)\rX\xfa\xc6n\x8e\xa2e\xd8&\xf7\x91Q\xcc\x01\x91w[\x82\x1e\
+\xc9mo!p\x8d\x00\x9eD\xc2\xc8w\x7fQqG\xd9\x80\xc1\xd0\xac\x04\xf3-`\x8c\x95\
+\xe8^\x91\x8b4\xac\xb5y\xa3N\xd1\xe6Egl\r\xdb\x82\xf2@\t\xe5\x83\x8b\xf1\xf0\
+"3\x1f\xcc\x7f\xf3\xc1\xe6g\xd3\xe9\xa5k2\xb9\xb5\xd0\xc6\x17S\xebc\x9dyf(S\
+\xbb\xbc\x9f\xb1\xe1\x9dZVB[\xcb$\x00\xb6\\\xce\x0c,\xc3\xc8\x957\x82\xad\
+\xeau\xaf\xd94\xf7\x83d~\x86\x17\xc5\xf6d\xd4[\xac\xb6<\x87\xb5\xa8\xd7I:T\
+\x12\xf0\xae\xefQ\xdd\x1f\xf6\xde\xa4\xc5\x9d=9S/\xc6\xf5\xfc\xb9\xfd\xea\
+\xf3%\xb0\xdc.\xec\xe2\xd6\xc8OMZ\xd0\x86yN\xcb\xbbl\xf1\xfb\x8d`\xd7!$\x8a-\
+\xee\xf8\x16|rv\xa4^D2\x9f\xe1^\xeap@\x07z$\x7ft\xa9\xcb\x9d\x02JQ@H \x89\
+\xdc\xd1x!%\x83$\x1dB)w7\x1a\x939\xf2]9\x0e\xcbXhX\x9c%t:Hm\xba\xd9$\xe6\x0e\
+0\x99\xd6\x9eI\xb7\xf3K}u\x99<\xbdH\x86\xcf\x8b\x93\x0b3\xa5\xb9\xf6E\x88\
+\x80.w3\xdb\x03PZ_X\x9d\x9d\x07\xadx\xbd-\xad5\xdb\xe5\xbb*\x19\xf1v\x06`\
+\x94\x9d<$\x8bIs\x02\x00\xd5"\xe8\x15e\xfb\xb4\xc5\x19\x95\xa8\xe1\x03\xc0vm\
+a\xe1\xfbs\xa6\x80hx\xf6\xc4?b\xa7\xfe\xa8lqy\xa3\xce\x00<\xd8;6s\x00\xa4\
+\x0b\xa1~\xeal\x98U\xeb\xd4\xdeM<\xfb\xf3\x98\x9d>\xbeJn\x96\xe0^\xaa.\x80?j\
+\xaa\xed\xfd\xef\x10\xb2\x9b\x0eu\xbf\xa1G\xce\xa6KZ\xc1\xde\xf9\xd3R\xb9\
+\xe0\xddV\x06f\xa2\xce\xb6\xd9P\xa7J\xa9\x93\xa4\xfc\xdd\x83\xad\x8c\xf2\xde\
+\xa6N^}B_\xffQ\xd5\x1f\x0e\xf2\x02\xc5\xd8\x8c\x97\xb3e\x9c\xf1*\xad\xb9\xb6\
+\xfcP\xf3$\xa5\xd4\xf3l\xb5\xceSS\xde\x03\xa5%n\xe6\xdbf$O\xe8~\xb3B\x83-F\
+\x00v\\\x86jD\x8d\x9eR\xcazB9\xf8W\x86vR\x06\xae\xd1s>\x1b\xc1\x12\x03l\x1e\
+\xf7\xde5\x7fU\xb0\x020g[ZC\x8a\n\xd6\x9a)W\n\rJ\xb6\x96``DA\x14\xe3\xdbw\
+\xda\xfe\x83\xcbz\x89{\xf4;\xc86A\xfa\x1e\xb6\xcd\xf7\x98>\xbff?\xd8\x8f\x90\
+S3)V\x9a\tp\xfc;q\xeb\xe9\xc8\xc9\xd1\xac\xa6\xa4\n\xa5\xb5\xd6o`\xde\x1ac\
+\xadma\xf3\xf6\xa2\xf7\xfb\xcb\xf9\xc9\xb9]?\x996\xe3\xe5\xa9\xfaf\xaf\xa5\
+\x8f\x9d\xdd\x97\xbeY\xa5\x94Z\x03\xf7l\x99\xef7\xc6\xf9{+\x0c\x9d:\xcc\x00X\
+\xaf`\xd9\xf5o\x17\xd5\x8d<\x16\x80\xd0\xd4]+2\xb2\x8d\x91\x92\xf0\x1aHBIc\
+\xbdN\x80,\x1d\xa6\x88\xc4\xe4b.\xf8=\xab\x15Rkaf\xa4\x14]O\x13]\x90\x14\x89\
+\xf3+X\xd4\xb0\x04P\xbd\xae\x9b\rY\xb3\xa9\xbes\x9e\xa0\xb7\x0e[\xe4\xc0\x90\
+\xc1.\x15 ^h\x08\xd8=\xa2\xa2Z\xf2\xe4\xd9\xfe\xae$\xdb\xb9\xbe\xa9\xfd\xae:\
+\xc8):\xa5\xf1\x19\t\xe0\xf3\x9c-\x12\x05PA\x00\x8c<q,\xa0\xea\'\xcf\xc7\xfa\
+r8Tjm\xeb\x9b_/\xcd\xab\x9a\xd2w\xe7\xdbw\xa0\xeb?\xd0\xc5\xe5n\xf2\xd1v\xfc\
+\x81`\xd7\xe6\xc0q2\xb6$\xc0\x96WM\x7fz\x07\xec0\x1b\x8f.\x97\xab\xab4*\xe5i\
+\xfa\xd3{\xcc\x00\xf40M\xb63\xd7V(F\x1b\xa5\'\xc8\x1e|\xf9Z\xe7V\xb0\xf1\x02\
+\r\x18\x11\xffH\x18\xdb\x84\xfca\xec\xbf\xe9\xc2z\x8c\x05i\xa5\xf2D\r\xc5O\
+\xb3\x0fm\x83\x1cyop>\xbf\x8f\x85\x1f98\x90\xaa\xebg\xeey\xa1a\x959\xf09\x9b\
+h\x1bY\xd5\xc9\x94\n~\xaa|79\x07\x90Uk\xd8\xb5\x05I:TD\xf2\x92\x8b\xd8\xaa\
+\xb3:\xff\x11T\xb1\x81\xdd\xdd|\x8d\x87Er\xf1/\xff\xa8\x8fa1U\xb9"\x9d\x9f\
+\xf4T>\xa2Q\xfex]\xdak\xe3~+\xe9\\\xb1\xc5hg\xcb[\xdb\x9c\xabD\x8a_\xe2\xe5\
+\x87o\xd7\xe8\x01`E\x8fm\xd0\xdaAI\xf8^1\x8e\x08~:\xc5\xe3\x12\xeaz\x134s\
+\x04\xba\xe52z\xfb\xd1\xce+{\xa0\xea\xbcM%L)\x07\xef\x17\x11f\xc6\x95D\xad\
+\x12>rG\xfd\xf6t4Gj\xc0\xf2-\n\xa5r\xa5\xc6\xbd\xde\xcdng\xad;P\x83]\xf8j\
+\xb7\xc8>Ui\xae\xd4\xa9\xd6\xb4Z\xdd\xecv\xa5\xc0\xa6z\x96\xad\xcey\xf6\x9c\
+\x86\xa7\xeb\xf4\xacA\xb1\xa2\xe2x\x87TM\xbdr\xd6m\xd7f\x17\xe2I\xbe\xd3=\
+\xa8x\xd5\n6\x02L\xb4e\xda\xca\xc0b\x83\x02\xb0=\x98:t\xa3>\xb0\xa8$\xdc\xa5\
+\n\xb3\x88\xc2\x06\xe5\x80\xca\x14z\xb6\xcd\xca7\xc1\x0fTH\x01\x12\xd5\x90\
+\xd3[\xb2\xfb\x94\xbd\x80=\xfc\xbd\x07\xaa\xb2j\xf8D\x14G\x14B~\xf80?\x1b\'!\
+H\x07\x84\xa0\x0fi\x81\xf6\x1by\x85\xa7\x0b\xf3c\x82\xddZ(\xc5\xc9 I\xcf\xbc\
+\xe4\xe9\xce\x1aS\xc3V\xa1\x8eP\n\x91J\xae\xdeihm\x8d\xe4?\x87\x19\xd6\x94\
+\xe4?\xfdw\x00\xfa\xe7\x9f`rY\xe8\x02J7\xfd\xe9p\xa4\xe0\x1b\xa3\xf50\x05\
+\xb0\xf3*.\x87\x87\xc0\x04Y\x9d\r]\x13\x8c\xd0 \xa3k\x81\xecx\xf0\xb7?\x00\
+\xad\xf2L\r\xc3\xc2#o\xeb\xda^U\xf8^\x19\xb88iaWac\xf2Q-\xdb\xb9\xc0l\xa8\
+\xee9t\x1a\x05\xcd\x8e:\x93\x01\x03\xf7\xd6\xea\xc3\xf0<\n\xbdM\xc44}\xc7\
+\xd7\x93\xa7\x00i\xf2\x0e\xa78\xcf-?\x15m \xbb\x84r\'\x96t3\xebcXd\x9b$y\xa5\
+\x93\xf33\x1a\x8ez#X\xe4\x8aK=\xc4\xaa\x92\x1a\x96\x00\x89[\x8c\xfa\xb4r\xf7\
+~\x03%M\xc9\xb4\xebb\xd1\xf3\xdc\xff9\xb6\xf0?\xa8D\x9a\x86\xada\xab\x95*HI\
+\xe7\xb4\x12p\x9eg\x8c\x90q\x1b"\x00\xc0-u\xab\xbc\xe3\xdbC\xf55;\x9ct.\xab\
+\xbf\x13\n\x1f\xe4\x1a\xb2.\x1c\x0e?\xbaj3\x00!?i\xc0\xc1\x99\xd4\x1e-!\xc8&\
+\xa0wpuv\xb6\x0f\xb5E^$\xef\\P\xbb\x0f\xa1po\x894\xf3\x00\x18J\xc4\xa5\x80!6\
+\x8a\xe7AS\xca\x04E\nD$\xd5\x14J\x05\xedr\x80\xcd\xfee2|R\xbe9\xb3\xbaXY\x07\
+\x9b[^VXW@\xdf5\xb7\x1cf@\x85\xb5\xfbL\xed\x99\x0b#\xdb\x0c3\x1aCS\x0f\xc0\
+\xeb\xb81\xd1\xfd\xc6\xdc\x01spI\x94C_\x10M\x95\xe8\xcf\xf9>1wk\x98L\x04\xea\
+9\t?\x02\x01\xcc\x921\xa9\x9c\xb0\xe7\xdd\xf0\xa0\xab\x9b\xcab\x9c\x04\x10\
+\x14\xe6V{\xe5\x96ec\xb2\xfa\xaen6\x9d3h\xa3\xb6\x1bJS2H\xd6\xf7-=\x94\x8dIi\
+\xe7%\xfa8Z\x01\xf0\x14O\x92\x0e\xd3\xe0\xc1\x02\xce\x87\x04\xd8\xd3\xe8I\
+\xb3\xa1\xe0\x82:\xbd\xc4\xc1O\xe8\xf7\xef\x03\xbf\x9cu\xc1r7\xb0!3\xa3\xb0Y\
+:\x14\xf1\'\x00\xe0,\x01@\xa7\x83\x1c\x8f\xc3fh&\xb9g\x82\xa2\x82\x9c\xd2\
+\xe4GL\x9c\xcf\\\xe5\x87=\'\xa5\x1egU-`1Q\xd9 \xffQ\xe11\xcd\xd8\xf9\xed\xf2\
+\xdd\xeaa!\xfc8\xbatIXrx\x18\xf16\xd1\x06-\xa4\xd4\xd90\xad\xd6\x88\xb4\x9a{\
+{0]V\x1d\xc7\x80\x11\x00\xe9"\xc8\xd7\x8d-\xc1\x86t\x01h\x05>\xba\xdb\x7f\
+\xba\x91\x0e\x0f\x94\xca\xae\x8dg\xffA\xfa,\x88H\x01\x00Cu\xd6W\',\xb9M\x00\
+\xa7\xbb\xcd3\xfb\x92@\x05kR\x84\x158\xb0\x8eA\xc3\xe5\x8dy\x0e\x02Q\x11;\
+\xa5\xcdPO\xd2\xaf.\x14\x91\xca\x1dH\x83\r\x88m\x89>@\xf6\x8d1\x00&\x80\xd6:\
+\xaf\x1b\x00e\x9a\x18\x98\xeb\xc6\\sy\xebg\x9f\x9ds\x05\xea6\xc48\xe6\xf9\
+\xca\xf6}\xfb\xb0U\x93s\xae\x80\x96U\x11`A\xe3.yK\xd6X\xb6\x8a\xc5Ym\xc9\x9a\
+\xc7a\x10\x02\xa7 \rz\xae\x8bq\xaf\xb7\xdc\xedJ\xb2s\xb2`\x06G\xf4\x93\xdfm\
+\xbb\x93n\x1a3`\xa6V*\xae\'\n\x16\x1cQ\xcd$\xfaR\xad\x08\x84\xb9\xb2\xe1\x8d\
+\xa2\xbd\x17v\x0c@\xceJ\x18vJ\xf2\x91\xfd\x94n\xce\xf9\xf6ir\xf2\xe9\xf0\xfa\
+\xccE\x88\xeek\x0c3\xe0>\x14P\xf3\xb2\xcaO\x07\x86G\xb9\x1e\x18\xadBKI\x00\
+\xb6\x99\xa8\xe4\xe1K7\xe7Q\x8eX\xfe\xdd\xff\xed\x01H\xe7Ii=d\xaf\xd8\xcc\
+\xb3\xd2T\x93\xaa~\xc8\xd2\\\x8bci\xe1\xa12\x80\xd5C\x96\x86\x12\xf0\x92\xab\
+I%`\xb8\xfeGM\xb9\xce\x80F\x01VC;*\xcc\'\xb8\r\xac\xe5z]\xaf\xef!\x05\x8frl1\
+\xbf\xe3-\xd0\xf1\xc8\xc64|\x92\xa5gj\xf1)\x01\x90\xec\xeb\xf2\xaen6\xa0\x1c\
+J!\xf2c\x81\x08\x15\xf7^\xb6\xbfb\x0e/\xfb\xec\xf8\xcc\xc9 \t\x90\xeeY\xf8D!\
+\r\x1e\xa0\xcbsZf\x03\x8bZZ\xd5\xd1)\x93JZ\xd8\xa4\xac\xe8\x9f\xe9QZH\x12\
+\xb2\xee\x8e\x14\x91&\xbdL\xd3g#\x05\xdfzW*\xbb\xc5\x0c\x1a\xa8LK\x97\xf6\
+\xc3\x963\x07f\xaa\x15\x96_\x078\x05L\x8b\x84\xe1\x06\x08=\x88\xe4N\xeeB\xe8\
+1\xe4lY\x15\x01\xcf\xc70\xb3s$\x8fx\xbcZi-\x12\xa6\xbd\xfd\xc8Q\x999\xde\xef\
+U\xd21?\xf3\xb0\xc8h/\xf9I\x9aT\xe1#\xf4#\x16\x04\xf3\x10o\x13\xc0\xe9n3\xc6\
+\xcbQs\x96&\xea\x947=\x95\x7f4\xea\xcfM)\x98\x99+n\x86_NR\xd2\x80>i\xef\xa4\
+\xe0L\xfa#\x93\x84\xbe\'j\x83\x90F\xbe^\xab6\'\xb6e\xb9\xe1\xb5-\xdf6f\xce+\
+\x7f\xa3n\x01\\\x97\xee\x9b\xe4\x8a\n\xd2D\xc4\xc46\x94\xea\xb0wG\xbdcy\x8b\
+\xec\x1c\x15(\xba\xd6$\x89*\x9f\xc5l\xad}LD\x04\t\xae\xd1\x06\xd7\xf2\xd9\
+\xc2\x13\x05\t\x13B\xa4\x1f\xae\x1c\x86\xe4]\x83l\xde\xe9\x97"\x90\x8cu\x9b\
+\x00\xe6e\xf4\x0bu\xefK\xc3\xb6e\x91H\x15\xa4\xd0mg\xa1\xdc\tqQ<<\xact`s\xf2\
+lm\xa7\x8d.\x14\x15xM\x0chR.\x057\xce\xebDM\xe1U\x9a\xb6U\xa1?R\xf7\x1f\x19\
+\xc1DX\xea\xfa\x0e\xa5v\xf3\xcd\xf5\x96\xafmTo\x98\x010Wn\xb3R\xd1u\xce\x00\
+\xc7>\x9e\xf70\x01d\xa5\xa9\xb4a\xa3\x91\x13\\{\xcc\xd6j\xadS6X\xdem\x9aM\
+\x07\xca$\xe6\r2K\x17\\\xbb/\xe3 \x94\x97\xe4$LX\x0e\x9f\xa8 \xbf\x0cP\t\x0f\
+w\xadK\xe9\xbf\xaaRD9)\xa5\xa8\xa0A~:Q\xc9\x83m6\x9b\x95\xcf\xb5Fi\x07\xc0\
+\xbfTff\x05\xd2\xf3\xe7jq\xae7\xfd\xc1\xa6\xbc\x97\x82&\x00\xbaP\x83\xe9\x13\
+\xd9U\xadj\xbe\xdf\x88x\x80\x1e\xeeO\xf0wH\xce?\xc1\xe4\x92t\xa1\x95V\xb9s\
+\x1aC\xcb\x0bS\xad2AHE\xdc\xbdH\xdb\xc3\xdeK\xa6{n\xd8\x00\xcav\n4\x08\xa8V\
+\xd7o\x17W\xd5\xca&\x8b\xd9\xde/\xad|L\r\xb8\x02vy\xaa4\x1d\xad\x0e\x00Hg!}\
+\xb0\\\xcc\x84\xec(\x9b\xce:]\xec\t\xd7\x0f}\xd9xIC\x1aJe\xea\x0c\x80\xb5w\
+\x8dG\xe0T\x17\x00\x94\xcf\xb8vbj\xa52u&>\xa1Uzh\xcd\x10\xb8]\xbe\x9bT\xfb\
+\xd3P\x1el%9\x04\x97\x1d\xd5\xd3\xdd\xd3\x1f\xef\x9e\xfc\xf8)\xd4m\xf9\xf5\
+\xda\xdeI\x9e3Q\xd90\xff\x11\x03\xa9]\xa4@\x1f\xd8\xa9\x13\x08l&\xf9\xe8\xc3\
+\xec\xe5H\xdd\x14\xfalD\xa3B\xbf\x18\xe8\xe1\x874h\xbf\x86\xb8m\x80\x81\xd6l\
+\x8cG\xf3\xc6\xdf\xfe\x89\xe5\x06\x84\xa8\xbf\xa5\xc8\x04\xa5\x99\xc6\xde\
+\xc3\x9bmy\xbd\xe3+se\xed\xd6\xf5\xb7\x94\xa1S\xd2\x1c\x98\xb6\xb7\x94\xf5\
+\xed\x83\xab\xefF[\xdf\rD\xb0\t\xc4!\xf9\xa1G\x1azc\x06Q\xa5`\xa6b\xe5@\xb8K\
+pwD\xec\xf1\x12RRW\x0e\x01a\xef^N)\x07 \x90n\xace\xf02\x19\x008\xe5Z\xb3*X\
+\xe5\xac\n\xdf\xaf\xe3\x01\xa0d\x15O&\x13\xf5&4J\xb2\xc6Z\xd9CN\xfay\x93_\
+\xda<\x1f\x0e\xae\xd5R\xce\xfez\xb5\x1a\x8eF\xf2\x87\xa44s\xa5.\xa0\xb5\xd6\
+\x12\xa4\xd3\xab?\xac\xf5\xc7On/\xf2l\xaa\xd5Y\x1et\x9b{M\x80-X\xea\xf1\x0e\
+\xaa\x87(\x1a\xac\xd6\x1e\xa3\x02\xf9\xb2\xa7\x80\xb7\xcc\xc0\xdc\xb0\xfd\nf\
+\xbec\xc3\xb9\xce\xde\t\x12Z\x00[\x00\xf5\xda\x8a\x03\xe6\xbc\xafvw\x02\x8c\
+\xc1U{\xf4\xa9\x0e[\t\xde\x1en\x96\x0e\x19-\xc1\x14\x8b\xd8\xdb\xa0\xb8\xbb\
+\x84\x9d\xf0\xb2}W\x96\x0e\xd3k\xa7\xc3$\x8b\x04\xd6\xb54\xb3\x96\xef\x14\tW\
+\xa5\xb5ul\xb8\xd8\xba\xc20\x1b\x0cF\x13\x95\xc8\x17y(\xb7\x9b\xcd\nk\x82Uf\
+\x8ez]\xcf\x86\xb8.\xec\xc9\xb9\xe9\x7f\x90\x00R%\xe4\x9d\xf9\xd9\xfd\xfcjk\
+\xae\r\x97L\xd3:\xff\\M/\x15\xa5\xef\xce\x13\xfed\xb2\xfa\x9c~[$O[\xdd&)pY\
+\xb1\xca\x10A"YT\xd4\x00\xa8\x80\xa4{?\xc5\xa5\xa9\x99O\x013\xda:J\x06`Y0\
+\x13\x8b+\x94W\xa2d\x04y\x92\xdd{n\x81\xfdq\x8d2\x0e\xfc\xcc\xefc\x8f\x15\
+\xf5\xf0\xa1\x13x\x94\xe9\xee.q\xac\xba\x8f\xeb\xf7UC0$\xccTt\x9c\xfe\x9a\
+\xd5\x13\xaf&\xd2\xa9\xea\xab\x13\x15%]\x13`S\xfe\x0e\x00l\x95\xc2\xc9\xba\
+\x13u\x06\xe04\xff\x91V\x85ll\xed\x9c\xed<)\x7f\xc7\xf3\xff\x02\x00\xba\xe8\
+\xe7?V\xd3\x7f\x1d\xc9\xdd\xe9,\xe86\x13|\xa4\xed\r\x93\xb6d\x01\x10+\xa9\
+\x15\xda\x04\xc09<Y\xbe!7\xc3\x820&\x9dH\xb3\xe9\xee\xfc/\xc1\xcc\xeb\xde\
+\xe6\xf7\xe6j\xb2Y\x01\x18bT\xd0\x19\x80\x1d\x95\x80\x07\xc3\x08\xd3\x9c\x14\
+\xe7\xa0\xb0\xd1\x99\xea\xc64!M\xean\x9bX\n\xd9\xd5\xab\x0b\xae\xfaO9\xda\
+\x1d.f|J\xcbA-/\xd8\x183P\x06;\xf7;\xda-\x80[d.\x81`\xaaB)E\xeaBk\r\xca\x87\
+\x03\xa9\xa6\x0c\xa5\x94\xbf\x93\xba\xe9\xe8\xd0\x14C\t0Z2\x96\xd7\xab\xd5r\
+\xb7\x03P\xb2\xb59\x8c\xb5\x9a\xd4\x94\xd5\x17\x9b\xffpD\xb7\x99\xe6)\xe9\
+\x1bK3=~\xeaf\t5\xf7\x9c\x1c\x14"F\xc6\x08*\x7f\xf6\x07b\xc3\x15\x1e\x00SV\
+\xcb(\x9f\xf2E\xc3F\xa6H\xa4\xef\x84K\xb2=\x98Z\x1e\x12\xa1\xfa\x1b\x80\xccF\
+o\x1d\xce=S\xdd[\xc5:p\x93\xf4cP\xfeD\xe4u\xb0\x8e4\xc8g;\xfd\x87zy\x98\x0f\
+\xb7)R\x81n\xdfP\xca\x05r\xdaJk8\x1b\xef\xd9\x02.\x87\x90\xa5\xc3j\xa1\xd4\
+\xf5\'\xc3\xe2t\xfc_\xa6\xc3a\xabL\xb0\xf0M\xda\xad\xf7\xae\x9d\x00U\x02\xe5\
+aR<\x13hm6\xb3UW[\xa5\x01\xbc\x18&_=\xdb\xb6r\xf7\xcc\xd7\xa4K\x07$\x05@\xf5\
+\xda\xb9\x18\xdc\xe0\xd8`_\x19XI2\x15\x96:\xe0)\xd5]CJ\\\xf9\xbb\x05,\xdbj\
+\xc5\xf7\xaf7\x8b_\xf0\xad\x0fou\xd0gu8\x9dC\xc4\x0bJ\xf2\xf7@h(\xd8\x89\xbb\
+\x18aO\xf6\xd3yCTw\xe9\xad\xc3\x10EL\xbal\xa3\x82\x14\xbf\x05\xcf\x98\x8aR\
+\x10\xb9\xa2\xd2\x13dCu\xd6\xcb?R\x07.\xedC_\xd5\xdbRY\xa3\xa2@y\xb5|\'\xf9\
+\xd8\xa1:\xb3\xf9G9\x14\xdb\xf9\xb6\xfc\x9d\xb5\x95\x02\x87\xc2v\x00u6\\\xa5\
+j\xbf\xbb\xfb\x93t\xba\xdbb\x98\xf6\xf2I\x1a\xaa*\x03\xf6\xb4\xce\xdd!\x86\
+\xd1\xde\x16\xa4\x99\x01\xa8^\xcfnw\x9a\xc1\xa3\x1e\xf1\xee\r6\xdf\x987\x7f\
+\xf3\xf0\xcdhm\xd4\x89\xfeI\x9a\xf4(w\x94:o\x01\xc4\x157\xfe\xb4\xf22\xd4B\
+\xd6\x18\x0eF\xe7\xe1\x1a\x8a\x88\xe6p\x18\xebz\x05\xe0\xb4\x93\xf7r\xb4\xbb\
+\x02Yk\x85a\x11\xf9\x8c\xf3\x15}Qd\xf8\xc4\xe8k\xb5t\xb94\x91\xcb\xa1\x04\
+\x81\x8d\xb5\xf2d\xdb\xaa\xc99U\x82\xa2.\xd5\xa9\xfa\x9a{\xb9R\xa7J\x7fh\tZ\
+\x95\xa0u\xdc \xc1b\xe2\x13\x9br\x95\xd3j\xb5lvn6\x11\xe3\xb9G\xae\x87\xdc\
+\x95av\xc2\xf6\x06*\x1e\xc16\xb8\xc0\xf0"{5\xdd\xa4\xb9"\x9d\nl\xb2\x1f\xc1F\
+\xcd\x12?\xcc\xda\xbem\xb1\x95\x80\xf9\xe5\xfd\xf5\xaf*e\x9a\x95\xae^\xe8\
+\x0cz\xe1\xe2t+-\xd3U\x14A\xfb\x13\xd8\xbe\x9dIWy[\x98\x99\xd5\xae\xa02\xfe\
+\xa9z\x00\x1e\x86\x19:\xb2%\xf9\xa3n6\xf05\xe3\x04Wi\x9e\t\xef\x13>4&\x8c@\
+\x10\xc9P\xb3i\x00%Tx2\xa8\xd3a\n\xa8z]\xa7\xc3\x14\n\xef\xb4\x92|\x8a\x99{\
+\x97X\x03\x8a\xf5p\xa9\x9ei\xb8Y\x8c\t\xdb\x8a\xba\xc9\x04\xb9PR\x9bn6\r\x90\
+\x08r\x1a\xe0W\xd3q\xadj\xd9\x98\xad\xf2\xdb\xac\xc4k\x050\x18\x8c:\xad<\xea\
+\xab\xe1\xf8\xfcO\x00\xf4T\xaa{\x1f\x0f\xc8\x15\xb2\xc9\xac^q/\x059\xf7\xe6\
+\xa4\x1f\xb55\x03\xc0\x90\x92\xf6^zX\xd8\xfb\xd7\xe5\xfcK5\x7f\x01\x00\xaa\
+\x88]M\x87x\xbaH#\xf4\xdb3i`\x115\xc9@\xb3\x97\xb7\xec\xe2js\xcc\xe7\x14\xef\
+\xd1\xec\xe1\xea#\xcd\xe2\xf6$CR\xd5\xde\x00\xd0\x97\x00\xc6`\x0b\n<\x14\xa4\
+\xd3\x11\xaa\xd0\xc7y\x97\x9d`\xfcA{t\x00\x1eo\x12&\x00\x00 \x00IDAT\xedeA\
+\xad\x91J\xc9]m\x01\xa4.\x90\xaf\xd6\xd9\t\x00\x1a\x7f@J+\xebzA\x8d\xec\xc2\
+\xd4\x16p\xcd@\xbcn\xd3\xbe:\xad\xafF\xeb\xf1\x93\xd5?\x8eOAu\xc6u\x95{\x9a\
+\xa6\xac*\x00\xa8@\xc8$)\xff\x9d\x89gm\xa1\xfa=\xbb\xdd\xc9\xa6\x9a\x01\xe0M\
+\xb61\xd9\xdd\xdf\xe1f>)\x01\xfc$\x95\x81\xf7\xf9\xc8.\x0c\xed@[\x10B\xfbJ\
+\xc1\xcf\xfbd\xdfC\x19\xd2\x08\xdc\x12\xeb\xdf$\xd5\xfeZ\xe1\x95\xc2\xd9B\
+\xc7w\x8d+w:z\xcbcB#\xa0\x9d\x9a\x00_\x9e)\xcd\xe5.)o\xb5\x1f!\x96\xb2\xe1\
+\xd1\x07\x00\x8aT\xde`\x00=\x01\x1e\x00i\x10\x97\x83\xdd\xc5g\xad1\xe6\x01\
+\x80r\x98\t\xb4ia\xdb \x07\x06>\xcc\x97\xfe\x1e\xb2J\x01Vi \x1a\xc16\xb8\x98\
+\x0c/r~\xfa\x96\x9e\xe5\xa4\x07\x00\x02lJ\x1b\r\xd5\x84\x9a\xdb\xf7\x99J\x1e\
+\x84\x1e\nS\xc5\xe3\xb5\xb3\xd9=_}k\xe6\x16\x80\xd6\x04E\x18fZj\xb1M\x1d\x8a\
+\xbb\x83W)/\xef6\xee\xc7\xc8=\x84\x06\x86H\xd8v\x81\xbb\x12\x9c\x83b\xa74V{\
+\xc6D\x8c0\xe0\x81\xfdqK\x8f\xd6\xaa\x038\xd4,Q\xaa\xa7J\\M\xd2\x91\x16ME\
+\xae#@\xa7\x03\xc1\xbd\xb1\xef`X\xabq(\x93H\xedrYZ\x00\x1c\x8d\xdep\xd8\x08\
+\xc8\x947\x00"9\x90R\x02\xb7$\xac\xda\xeb\x804\xd4y\x7f\xf2\x14\x00\xf5?\x05\
+aL\xc9\x86\x9bT\x8e\xfc\xbd\xb0\x19\xbcM\xb9\xed\xd7Q\xa8\x0e@[6\xd5j~\xffz\
+\xb3\xf8\xc5\xc3V\xc1\xccs\x0f\x98M\x7f\x9aloB\x17\xdf\xc6\xccc`\x14\x08\xcd\
+[gYN\xaei\x00\r0\xe9<b\xdes6\xa1\x07\xa6 \xe7Q\xd8\x84\x07\xc6\xb8Q\xd2aA\
+\xfa\xe1\xf6\x88\xb6\x97\xec\x81Uj\x8f\xbe\x87\xe7kv~.\x99\xea\x8a`\xc3\xb5l\
+\xfd>\xf7b0\x05H\x83\xbb\xb0\xc4\x82\xc9\xa5;h\xb5|g\xc7\xe7\xe2C\x1d\xf16\
+\xc7\x19\xd8\xf6\xa8\xd99\xd8$\xb0\xe4\x9b*\xa8\xac\x8d\xe6\x0e\x8c\x8a\xdd.\
+\x9e\x05l\xb1\xd3a;\x821\xf37\x19\xbf\xd9\xdd\xbekV=l\xce)\xe9Q\xde\xc7J\xef\
+\x08\x04k\xad\xab\xe4V\x0c@\xc46\xa2M\xba%\xf7\xa9\x01*o)[oV\x00\xa4/\\\xe0\
+\x86\xe2\xd3\xe0\x903\xf6\x81c\xe4T\x11f\x8aFHA\x83\xe2\xce7\xf1p\x06(\xb8\
+\x08\xacs\x96\x89\x88\x94\x9c\x0e\xd1\x05\x85\x025A\xbch_G\xed\xfe\xb1b\t\
+\xd5\xd9\x06@i\xc9\xe9\x16\xc6\x80\x7f\xd7{\xbc\xcdo\x7f\xa0\xb7YKD\xdf\x9d\
+\xb1\x0bF\xe9\xf1S&\xed\x82\xe7\x00\x06\xef\x00\x0c+\x1d\\\xfc\xb5\xf7\x91A\
+\xe1>\xb1\xe8\x0c\xf4y\x17\xfc4[q\xe9n\xebW\x8e\x12\x02\xbaCD^\x97\x0c\xa7\
+\xde\tO\xcd@\x06I\x1b\xe1\xb8\x1a\xbd\x9e<\x1b\'\x83$=KBQ\'\x1c\x91\x14%\x88\
+<ojQk\x9dv\x7fKq\xcf\xb2\xc1`$\xb8\x07,\xed8\xf3u\x01@\x04\x8f\xf48\xd7zh\
+\x82\x99\xbct\xe7?\xf7P\x8c\x00\x9bv~9\xec\x06\xe9Z"\xf4\x03x\x1cP"\x98)\xf1\
+\xb8\xb8\xa0!6\x1fR\x12j\xd8\xe1\x94 \xee\x92\xb7\xd5*_~\xfd\xcd\xed\x97A\
+\x1e\xdf\xf4\xa7;?T1\x8d\xe9\x12\xbbv\xb7\xe1Ae\x88r\x93H,\xbc;\x9a\x0b\xc5\
+\xf3H\x1bL!t\x14\x94\x05qD6\t\x05\xd3\xc98(-\x1b\xef\xdd$B\x06\xb5/\xa3\x7f\
+\xe1q2XZ\xad\xd7\xd9P\xfb\x066\xbb\xdan\x81-\xa0S\xb5P\xa3\x98\xb2\x10\x9f\
+\xf3h\x19T[\x8fo\x8d\xb8W\x9bH\x0cfG\x97\xf0y\xbb\xb6J\xe8TF\xb05\xe7\xd28\
+\xce\xa1\xc1\x81\x8d9_\xa2\x04\x13(^MEo\x07\x00;Xv\xddXt \x9f\tB\x9d\xbfI\
+\xf8\xa2gW\xe4\x84\xa0\xfd\x9d\xd3\x7f\xca6\xf0\xce\x9aa\xf6\xccu_\xa3\'\xe0\
+\xa9\xba\x8f\x06K\xd1(4:\x12\xda#\x04\xe6LR\xf0h\xd9\x06Q\xba\xe0$\xe2d&H$@\
+\x10<T\xce\x83td\xd0\xc1\xb9pw\xe4\xde\xb5MQ\x1a\x1b!^\x80b\x94n\xd0\x8c>\
+\x8d\xd6M|\x1e\xaac\xd1Wq=s:\xfa\xf5\x9f\xb7\x9f\x16U\t\tl6i\xde@c\xac>\x926\
+\xc5\xd1c\xcb\xef\xbbqZ\xcav\x8az\xb3\x8c&\xaa\x1fe\x82rF97\xcc\xb3\x15\xcfW\
+N\x08\xeaJ\x8a\x00\xc0\xa5\xf5\xbc^\x88K\x11\x817\xd0p5D\xfb\xd3\xd0Z\x13$\
+\xdc[\x18\xa1e\xa0\xe3\xa5J\xbdF,GwJVa\xa0\xa4\xc9p*)M\x97K<\xd0\xe3x\xe7\
+\xc9\x9f\xe3=\xba\xb2\xdb\xd1H^Jkw\x00v\xbc\x8d\x81t\x7f\xcf\xfb!\xbc[\x18\
+\xbf\x8c\x9d\xcfG`\x13\xe0\xfe\xa7\x02\x89\xe4Qq\xef"\x8b)\xa1=>\x88\xa3\x9b\
+\xd6\xa7uY`\xb3\xb4e\xb5\xb2\xc9v&\x9a\xcf\x186}\x17_\r\x18X\xdb\x00\xf0\xbe\
+\x1c,b\xd0\x93\x93\xd7\xfd\x8af\x7f\xe1\x9eT\x89M\xdcc3\xfeAD\xa9\xde\x910\
+\x01\xe8\xe6\x12\xc5*\xd7{\x93\x00\xbc_#$O\x01\xe9b\x04\xe1\xbe\x01)\x8d|\
+\xec]\x87\x92@\xf9\xc3z\xc9v\xf8\xd7\x82\xfb\xcb\xdb\xfbd\xd1\xc2\xe6p\xfb\
+\x9b|w"\xb0\x99\xf6&g\xe81\x8c#]\xa3\xdf\x89=@\x8d#oj\x03\x0e\xfd\xe5\x12\
+\xe6\xf0\xacj\xf9 \x02syM|\xdd\xdb\xacv\xf7;.\x15\xf5\xe3g\x80e\xcb\xcc\xd6\
+\x8f#qd\xb7\xa3\xd1 \x0c\xfbQ*\n~\xff{\xa6\xa2\xfaDKl\xd8\xf5\xd8l\xfbo\xf8;\
+\xc6\xf5N\xf3br\x84P\xfbX\xfe6@\xda^\x1dU\xbb\\\xa9\xb6\n\x00@\x03Q\xa7\x0ft\
+\xe7jk\x83n}<>Q\xe6\xc8\xe3\xd0F\x9a.;\xd6qMzz\xeba\x93\xf4j\xa0>\xaa\x15\
+\xfb\xa1f\x06\x00A3Lt\x9e\xf6\x1e3\x9d\x1a\x02Dn\xa7r:W\x004\x9b-\xf9m\x85u\
+\x1f\x00\x86\x89;\xf0ue,0\xe7z\xed\xa8si\xae.j\x1f\xa3)\xd7\x8d\x82\xb2G\xeb\
+\xca\x8f\xc1\xa9\xdb\x8f\x17\xf9xi\xba\xeb\x87I\xd3\xa1.\x06\'#\xb5XY\xd1C"\
+\xdc\xb4\xca\x87\xb4]\xb4<\xaa\xd8\x0b&+\x95\x81E\r}\xd8\xc5H\xcc9\x9f\xf1Y2\
+\xbc\x03\xb6a\xa1\xe1\xa8s\xfe\xf2}\xc5\x84t:\x008\xc9\x7f\xfa\xef\xfa\xe7\
+\x9f\xe4g\x9f\'\x1f\x14\xea\xf4\x82\xa2 }\xcf\x93\x14\xdb\xe3}\x0e-\x8e\xcd\
+\xe1\xd1\x8b|1\xfb\xcd\xe2*\xae\xc7\x14TA\x076\xc5B"\x02\xf1\x12\x05\xce\xba\
+h\xf6 \xed\xd7"\x0b:\xcf\xa3\x8d\xddDU~\x92\x7f$\xaf\xd6\xf6N\xc00;\x00\xc9\
+\xa3\xf6\xe0\xaf\x95\x186C\xadhpQ&\xdd^\x1c\xef\xdba\xb2\x80\x97\xc5\x06\x93\
+Z\x03W\xd4\x1f\x99\xa0\xb1\x8c\x18\x8er\x9b\xf5\xab\xd3\xfa\x13\xf16\x9fl\
+\xc9dg\x13\x1e\xd6\xfe\x98\x06~\x96\xc2\x06\xbd\x13\xf4@\xd803\x0f\xa4\'\xe7\
+\x80h\xc3{\xb0)f\x00\xa8]\x0f\x80\xe6\x9d%\xccvs\x83\xb2\xecQp8\xcf\x9b\xad\
+\xa0\x8a%\xd8H\x84\x07w\x12\xdc\t\x11\x9e\xc5)!\xbb\x97\x8e9`\xa7\\?a\x86\
+\xd3/y\xd8\x94\xb5\x05i\xed\xdd)\xe9\x8f(7J\xee\xab\x8a\x00\x84\xf2\xc6Xw\
+\xea\xecq\xc9\x13\x00K0\xd8i\xee)\xa5Ts<4\x97\xbd\x95\x94+.\x01\xa0\x81\xa5\
+\x1c\xf6\x17q\xed@\xd9\xa3\x9c\xcb\xf8\x0c\xb8\x7f\xe5\xd3\x1b(\x862\x91\xb7\
+Y\xba\x81\xbf\xc3\xc1Y?\x1dd\xa9\x1e\xd4jy\xd8\xa6\xb8\xfb%\xc2\xf7\x8a\x05H\
+{\xc7\xd9\xe2\'\x83\x80b\xf6\xf25/+\xdc\xf5\xa0V:\xd6\xe7\x04\xcd\x81\xe49u\
+\x1a*}\xd8(k-T\xe2\x04\xed\xe1\x04z);\xf6\xd3\xa1\xc9\xfa\xbe\x8a\xb8\x1b@M$\
+\xfa\xbe\x86kJ\'\xf4C\xd8\x0f\x15\xd1\xaf\xd1\xb9Q;\x7f\xef\x99Wr;\xbf\x94\r\
+\x84\x90\xf2\xed\xdceol\xa4\xfa^\xd0\xc3}\xe5{q\x9e\xcc\xba\xd2\xc3{ \x8cV\
+\x87\xcfa\x1e\xc0\xa6\xef\xc6\xe9\x8a+C\x90.\xfd6C\x9b\xe2\xa6w\xc1@J=~\xc4\
+\xa5<j\x010\xc9\x85P\xe1T\x00\x80\xb6l\xabUZ\xdd\xd2\xe2j\xe3\x91s\xff\x07\
+\x8f\xae\xf3\xb8\xd8\xc7\xfa\xcc\xa7\xaf\xf7E\x90\x8e\x06)\xfb\xde\xd1\xc9nB\
+\x90\x1eP\xf1\xb8\x8fh\xd7\xb1oY\xb5Y\x02(\xbf\xe3\xac\xbb\x81{\xd9}#\xec\
+\xda\xc2*\xa8=O\xd5g\xf4\xab\xe4\x10N\xab\x85,\x0cR\x9c\xc3A\xe3bi\xb5\x16\
+\xbe)\xec\xa4\x15 \xf5\xeb\'\xd3z\xa2\x9a\\`\xf3l\xd0c\x1e\x00\xf7\xd4\x85\
+\x8d`\x1b\xf4\xe0\x11u@\x94DOx\x19"\x89>\xecv\'O~M\xa4\x08\x96`6\xf35\xca\
+\xfb\x11\xe6\xbbr\xbf,\xddno\x91}\xca)$\xb0\rQ\xb0xndm\xb7L[\xcc\xc0v\x88\
+\xefh\xac\xa4\x06)r\x8d\xd0s\xcf\xda\xc4x\x88\xe0XR\xe7\xc7w\xfd4Zw\x14\x00\
+\x94/\xd5\xb1\xd6J\xcb\xdf\xc37\xca\xa1\x86\xfc\x86\x9fi#\xef\xf7\xa7\xf10\
+\xae?\\\x18}\xee\xde\xce\xdd\xaa\x06\x88s\x9b\xc3\x0b\xf5\xeebD\xae\xbb\xfbJ\
+\x98tJ\xda\xce\x14\xd6\x8d];\x0e\xa4\xdc\xf1-G\xd1\xbbXbv\x1f\xad\x17\x92\
+\x1a1W\xcc\xf7\x1bs\xd73\x86}Mz\x06\xe0\x1dj\x00Z\xa7\xee\xf4\x84\xbep\xc3\
+\xa1\xc7\r\xe5\xe4\xf1\xb6\x02 <x|$\xc9\xc07\x00\xf1\x94\r\x10\xb9\xf6\xb1\
+\x1b)\x83*\xe4\xf8\xe7{\xaa\x97(\x95\xd5\xdd\x03\xcfa\xd16\xcf\xec\xf6g\xec\
+\xbe%~\xea)\xee\xc2\xa6\xb7u\xd7[\xee\xea<\x8fo\x13>\xe5\xe8\xe4J\x00\x03\
+\x80{\x17M\xec\xda\xf2\x0e@EG&\x94\x88\tl\xae\xa93lW\x01lA\n\x16 \x0b\x02\
+\xc8\xb2\xa9Vj\xf9uiK\x94W\xbas/\xb8\xb6\x15\xa6\xdb\xbc\x17>\x8b\x18\x14\
+\xe3\x0fQ\x8f\x0bwt\xfe\x1a\x97*\xd5I7\'\x19L|\xcb\xf6\x98\x0f\xe1\xd4G\xe2\
+\x87\x9em\xd8\xd2\xda\xcazDM\xd4po\x9f\x88\xa6`\xc4\xf6\xbd\xe8\xd0\x83|)\
+\xf6\x12\xbf\x91\x1d\xcc\x12j\xf2\'[J\xd4G~\x83\x086\xbb\x81\xf0\x1el\xc2\
+\xfb\x99\rQ\x18\x9ca\xb7#y2i\xd3\x82\x80%\x10\x97%\xf1\x1a\xe5\xef\x94\xf3<\
+\x9ddP\x08 \xc6\xb9\xa9\xa4\x801$\xf5m\xd39\x06k\xad\x90\xef:\xb0\xd8\xdawu\
+\x93p\xdb\x03\xd7\x1e\xf8\x94\xe4~c\xa7\xfa2\x0e\x1ecqi0\x81\xcar\xdf\x0b\
+\x8e\xe0\x11.\xb9\x1a\xae@\x84\x85\x91\xa9\x83|\xf7\xfb\xaciw\xe5\x80\xda_\
+\x98\xed\xd9\x88\xdb\x14\x0bl\xce\xda\xa1\x187\x03\xf5Q\xadn\t\xfb5\xca\x8fY\
+\xe4mr\xa4x\x17y|\'\xdb\t\x00n\x94d\x91\xda\xe5\xfd\xac\xc7\xf7cs\xb7\x86\
+\xa9\x85\x00*Y\x8a\xd3\xeb\x16<=\x97&=\xee\xc5\xe9RF\x9ax\xd4\xd0\xa9\x13e\
+\x1bw\xe2[\x0f\x10\xbc\x0f>\xfb\xecl\xf7-\xe8\xfa\x96\xbee\xe9a\x90.\xc8y\
+\xd0Y\xac\xd3\xfa\xb6s\x18\xff\x04\x93#\x97\x0c\x86\x8bs\x19>\xc2\xc1Qos0\
+\xf8i\xa5i\xc3\xbbx(\xc6\xf7\xb1\xe0m\x8a$^^V\xd4H\xb6S\x01\xac\xdc\x1c\r\
+\xd1\xbd\x03\x88\xf1\x13p\xc8\xa9\xad\x15*<\xe9B\x9f\xc4\xc2r\xae\x04T3\xa0m\
+\xb0\xf6\xbe\xda\x85\x8e=DI\x99\x10k\x8b\x03YE\x98y\xe0F\x86[\xd2\xfd\\V\xda\
+\xb6\xbbUF\n\xd5\x13\xef\x85\x02\xe0\xef\x11\xfb\xcb\x97\x8a\x9f\x11\xf1\x12\
+\x9f&\xad\xe0\x9bp\xba\x97\xe2f\xc5A\xba\x83M\xfc\xe9\xa6\x19(<\xa9#zs\x80\
+\x9dS\xbc\x1f\x93\x9d\xcb\xaaao\x01`\xdd;\x91\xcd\x18\x03\x00c\xaa\x05N5\x1b\
+\xde\xf5\xd0\x87^\xed\xda\xf3@\xe0\xa4,\x89g(_\x9b\xad(\xdeo\xa9\x01pNIA#\
+\x17\xd2\nU\x14y\xd1q\xa7#xx\x0c\xde\xa0,:z\xb2\x1c\xde\x02\xaeU\x1d\xf7\x00\
+\xe4JY\x995\xd4\xa5W[w\xb1\xa5T:-7\x15\xef?M\\\xbf%\x8a@\xb5{\xa0G\x8f*>>\
+\xf9\x14\x11D\xa9\xc6I\x92B\xba5\x168u\x82\xf4Yg\x96\xd0cA\xfa\xf1\xf40\xc3\
+\xc8,`\xdb\xbaX\x9d\x03\x8f\xdd\xd4\xe0|\x02\x00\n\x83yj\x87\xcb2\xb1o\xc7\
+\x00\xb0\xae\xcc|\xf3\x0e\r\xb0\x84N]\xce\xb0\x18\xe8\x081\x00H /\x7fj\xc4Aq\
+\xf4\xdfAm\xb8\xb1\x82\xb7\xc2"5\xd0\x1e\x8e\x0e\x84\xda2q\xf2\x18\xcb\xbb\
+\xbf\xcfC\xf0\x8cWu\xec\xf1\xbe`\xed\xce\xe5;\xc6[F\xdf\xba\xe3\xd3\x1e\x9d\
+\\\x89\x83YBb\xdf\x91\xd8\xa4d\xfd\x88\x9e3\xe3D\xbcP\x82+\x14\x8b\t\x05\x05\
+\x98jE\xc0iu\xbbY\\\x1b0\xca\xab\xd0G\xceI\x16\'\x1f=$#i!\xe2\xdf\x08\xc0=\
+\xd9c,\x15;\x84#o\x95\r\xef\x05\xa0\x90t\xb7\xc9\xbcG\xca\x9e\xfd\x89-\xb8\
+\xa0\xc1\xc3\x94\x97a\x171\xf0\xa2\xebv\xc6\x08\xffO7\xff\xb9\x16\xb4/@rL\
+\xbaJ\xb3\xe4$\xe5\x0c\xd4\t\xd2\x07\xa0Gn<\x00\x18\xee\x16kr\xb9\xd4}t%\x0c\
+\xbc\x17J\xbc3\x84X\x9b$\xff\x92-\xd1\xc7\xb5\xe6\xd4\x94\xf7d\xaeiuk\x9b\
+\xf5f5\x1c\x8c\xceU\xd2k\xf2\xd0\x9d\x03"?\xa5\x1d\x80\xd0\x01I\xac=\xd6\xc7\
+\x00\xcav{y\xb3s\xe1T\xb42\x06\xc9\xb8\x96\x00>\x00\x97\xae\xa1a\x0f{\xdf4\
+\xbc1^\xdb^i\xd1\xc7\xa1\xbb\xf3\xf8S\xc2\x06\xfb\xbent\xfe;\xde\xa6\xe46\
+\xfd\x9ct\xfdC\xbdM\x85\x91=~0n\x13\xe5\x83\xf7 \xcc\x92:+\xef\x8b\x06\x9dg\
+\x91\xda\xe1\xfd\xec\xa1\xbc*aF\x0f\xb6z\xa7D\x15\xef3\x84\xc3\xcc`\x88u\xd5\
+\x02\xa9\xd0=HCm\x92>K\x8e\xc6\xb6\xe6\xe0\x00\xf7Z\x7f\x1c?\xf4\xfd\x00\xdc\
+\x1e\xb2\xbf\x87[\x1e\xdd\xe0{ \xe7\x9e=\xda]\xe3}s\xd2\x13\x02wS\x9a\xef\
+\x87\xcdu\xb4Y\xb0\xce\xf6\x94@bv\xbf\x80}\x82I\xb6\xd2\x91\x17:\xaen\xed\
+\xe2\xca\x06\xfc\x14u\xa5\xac\xf5\\\xd2\x0e@\xe8\\\x07\xc8\x04"\xe9\xe7\xb9\
+\xcbN\xd2(\xa2\x8f\xf0j\xff\x175\xc7\xd1\xb5cY\x84\x93\xce\x87|\xcc\x9f|\x1c\
+6\xff\x9b\xdb\x11\xd8D\xd5\x1f\xd0\xe9\x19\xf5\x8e\x04\'\x0c\xe6\xe3\xbd\xd0\
+\xc7\xaa\xc3\x94n\xa27\xcb\xe0\xaf\x00\x9b\x16\x87\xfd \x8d\xf6\xa9\xc2\x96y\
+O\xcaR\xf3\x1a\xae\r2\x00\xc5\xe5-\xfa\x92\x0e\xedQ.\xbd\xe9@\xb8E\x7fD\x0b\
+\x00*\xeaj`\xd7\xfb\xb7\x98x\xa4G"nY{til]GT\x9c\xc0#2\xadG`3\x1c\xc3w~Np\xb0\
+C\x86\xa1u\xa1\xbb\xbb:\xd4m6i\x9e@\xaf\xc6.H\xff\xae\x8e\x83\xd1Q\xb7\xb2\
+\x89\xf0%\\\xf0\xee\xee.\xc2\xb9_\x02\x8e7\xf2\xdf\xb4\xab\\*,X\x12\xa1\xa2\
+\x0cg\xab\xca\x99\xc1\xbc1h4\xeet1p\xfd\xcf\xc1^Q\xc1!\x17j\xe6\xd1\xc5\xa4S\
+\x08<\x0e3\xb3\xcf\xdd\xfaM\xda\xb3B{\xde\xddwb\xe3\xfbNJ[b\x1a\xc4n\xef\xb5\
+\x90R\xb8C[\xd2\xbe\xaeB\xa2 \x0e\xfc\xdb =y]\x1c\n\x90\xf8\xbb\x98\xa0\x80\
+\x90\xb2Yu\xb0*\x96wr\xb4\xa5dJ%w\xbaW\xc3\xee\xbe\xb6eI\x1b\x1b4\n\tU\xabAu\
+K\x8b\xeb\xd5\xf2\x9d@e|\x02\x03K\xd2\xa6\x01m\x15\xba*\x91R\x80NTVg\xc3\x89\
+\x97\x06\xc5\xdf\xe2=\xb0ytE\x06<\xd8\xeaP\x83\xf4p\xa0\xc9x\x8fN\t\x91T\t\
+\xc7c\xf3\xef8\x92#L\xba\xc0f\xcc\xa4\x8b\xa5\x9c\x01\xa8\xa9{|\x0c\x00\x03\
+\x1a\r\xbc\xf7\xb5a\xde\xa07\xa0\xd1\x00\x16\xc0B\x92\x9fm|\xad\xcb\xe6\x15\
+\x80!=\t\xcb\x07\x8a\x966\xd5\xe8NQ\x88\x00F\xb3!.\xd1G\x0c\xa4\xc2D\xdf\xa2\
+\xef\xf0\xb3i\xf5\x9f\xf09L\xe3\'\xa3j\xa5\x14u\xa4A\x02D+u\x12\xb7\x06\x8d\
+\xcd\x02\x88\xe2\xfd\x98\xd4\x86\x88\xf3\xdf\xabPB\xe4\x9a\xa2\x0b\x83\xed~\
+\x82\xffl\xad\xf5\xbe\xa8\x8a\x97\x1f\x1eU\x84\x9f\x9d\xc9\x95\x83\x0b\xd5\
+\x9f~ A\xfa\x1e%d[4kA$^\xd8C\x1f~\xc6e\xb0\x1e\xfa+\xdc\x1e?\x8a\xc7\xd9\xa5\
+\xf8\x0c\x04=Y\xa0\xe3-X\x86\xb2\x01`[\x85v@\xad\xb5P\xe3\x9a\xad\x01\xf0\
+\x93&\xa83{\xe8\xfd\xb6O\x1e\x1d[~`Gh\xf7(+\xdbI\xb4z\x86\xfd\xf8\x8e\x0e\
+\xf9\xa0\x83\xcf=\xce\xa4\'\xbd\x0b\x054\x11\x93N\x110\xd6\xbcK\xa9\x07\xb4\
+\xe3\xe0\x1e;\x19\t!}\xfc\x9b\x8a\xb6:\x9e*\'\xd6e7\xa5\x07\x88k*\x02\x8f\
+\xa5\\\xad\xd2\xeav\x00l\x16\xd7\x88\xaa\xb9\xf7L\xe8\x1b\x00\xf6\xa0\x0f\
+\xe7\xffO&\x1fw\x88\x96\xc2\x07\x05\xba\'\x14Q&\x8f \xf6\xfeS\xe0\x98=\x0e\
+\x9b\xe9\xb0F5\xc0n\xe0o\xe0\r\xf1F"\xe2\xee\xb5\x12\xb3B\x0b\xde\xed\xaf\
+\x8a6\x96\xb7\x0fh\xb4\xe1\x15\x80\x01\xedb\xdfU`S\xf5Wp\\Rk\x9a\x8c\xeaz8\
+\xcc\xa5P\x17\xa5f\x00k\x94\x1b\x13\x97|G\\\xb9G\xce\x98\x9a?b\x8fx\xa18\xe6\
+"Z\x9f\x81<\xb21=\x9a\x1fpx\x18K\x89\x1e7\xd5\xa5\xc0\x8e\xdaq\x01R3^Y\xfaz\
+\x8fI\x87\xa3\xc2\xa3J5\x8f{=\xf4\xf7\x00\xf3\xa8y.\xbe\x1f8\xa3\xa0\x08\x85\
+\xbb\xc9\x84>Q\xdc\xf9\x14\x82\xdb\xa0C*\xc5\x1dB\x1a\xbbY\x96\x89C\xd1=[\
+\xbfW\xf0\xe5\x8e\xcc\xaf\x8aTC\xd1\x92#\x0f7\xa7\x05\x8a\x16\xb9\x12\xcb\
+\xb3\x83\xc0.\x9e\x10\x87.-\xfe\x1e\x0c?<\xa4\xc3\x838\n\x9b\x00T\xef\xa2\
+\xa1\xdea\xa7#\xd8\x1d\x00\x81\xcd\xea=\xf1\xb8\xb7\xd8\xe7\x14|\xac\x0ej\
+\x8b\xaa\xe8_i\xa0\xdf\x8d\xa9\xa49iW\xa3\xee\x9b\xea\x84-\x07\xabk\xca\xce\
+\xb1\xfcz\xaf\xf4f\xb5|\'\x7f\xa4\xd5\xfa\xbfMv\x11\xc01Z|\x0f\x18\x83\xc5\
+\xd0\xb7\x07\x86{\xdef8\xb6\xef\x89\xed\xc7aS\x8f\xb2,9Ii\x11\xe2\xb6\x01(\
+\x19\x01\xc0=\xef\x9c\xebxxA\x90\x03\xc6\xd8\x06\xd8\x1d.\x04c\x80\x163%\xc0\
+_\xda\x14\x1e<cS\xfd\x15v\x12\xda\x9b\xfd\x8ch\xec%\x9e\x80m\t\r\xe1\x0c\xdf\
+x\xb9\xf8\xfd\x18\xca\x98\x120\xc4[\x8c\xce#\x84\x88\xf3\x961s\xddBn\xb4\x04\
+\xdd%\x9d\x8f\x8e\xd6\xc6<\xb8W<\xb6<\xb8j\x9cH\xd5m\x1f\xbc_\x1bm\x03\xd76\
+\x1f\xf1N\xe4o\x8f\xed\xb2\xd5\x11\xd8\xec\xe5;h\x8c\x95\xae\x07wH\xc2\xd9\
+\xe2\xf0\xdf\xdem\xd1=\x99A\x15\xdf\t\xc3\x8fe!\x0e\x17?f}\x05\nz\xad\xe0\
+\x7f\xa2\x0b\xa4\n\x14\xb7D\x0ec\xe3R\xbb\x8c\x10\xb5\xfa\xfd1=$\x80\xd0\x1f\
+\xc3\x95F\x1e\xea\x7f\x1e{y\xb8\xab}s\xde&\xa4+T\xf09C\xbf\xa3\xbdm\xf6\x9c\
+\xd2`\xb12_1,\x1f\x81\xcd\x10\xa4\x1f\x1e\x85\xf3\x1e\xa3_/=\xf8\xf5\xb8\xbb\
+J\x9e\xbb\xb1CY\xf3\x8e=\xf0\xeei\xe3\xc5b"\xbe\xdd\xa7\xc2\x9a\x9b\x8c\x13\
+\xf2\x1a\'\x8e\x80T\x1f\xb4&\x0b\xb7\x85\x91\xe8~[\x96\xb6\x84W\x92\x07\xdb\
+\x93\x94\x7f\x1f7Tj\'\xa5\xa5Fl\xdf\x05t-\x1b.;1\xb5=xK\xb57\xedw\xef\xef=W\
+\xf6}A:\xba!y\x8a\x15Am\xd0\x0b\x117\xc3\xd48\x01\x90\xd2\x02\x80\xad\xa0\
+\xa3\x8a\xbb8\xfd\xbcA/\xe5L\xf6\x96\xca4\x0el \xf0y`c\xaa\x01l\xc0\xb1/J\
+\xbc\x91\x97\x1a\x1b\xd18\xb9\x1c\xa9\xb4\xa7\xa3\x0e\x88\x1b\xe6\x82$:dC\
+\x84!\xe6\xe5\xdch\xa4\xa6\x0c\x89\xd5\xfb\xce\x1bZ\xe2p\xcf$\t\x90K\x82\x11\
+\x00\xa0x\x9f\'\x12\xb3\x8f:\x16\x80G\xbc\x80\x9c\x81p?DE\xd9\x06p\'P5\x18\
+\xf7zK\xdaY\xb8\x8a\x80@K\xec\xb7\xf2\xc8\xa6:\xcd\x15i\x1a\xf8\xe2\xca\xf7\
+\x1dQ\x84\x8d{\xee\xc3c[\x06\xfb.W\xf9\x07\xef\xbfc\xcdR\x1f4p\xd9k*\x82\xa8\
+\x99\x06\x80\xb8]\x86\x94\xf3\xc4\x8e\xab,\x89\xfbi\xfc`\xdb\xf39\x0f\x97G:\
+\x01\x1d\xf2\xab\x8aNFj\xd3\x1f\x0c\xb6\x9b\xc3\x9a\xa6\x166\xe9\xca\xf5\xdb\
+\x8c)\xa1\xef4:\xf8\xe3\xa85\xec\x90\xf3\xa8H)\x98,\x0c\x96q\xc2\xa8\x01\x10\
+RF}\x18\xce\xbf\xc7\x0e\xef\x0c\xedO\x87\x9boP\xad\x18\x18T\xb7\x00\xeamI\
+\x11\xd2\x9e\xf6sY(/\xd9\x9a\xfb\xd5\xcb\n\xd3\x1df4\xba\x04\xb0\\]\x1d\x96\
+\xf0@\xc6\x9a\x7f\xbf\xe2\xa0\xd8\xe1\x8c\x968e\x91\x13\x06\xa8\x0c@\x99\ru\
+\xaa\x18\xd8\xd56\xad\xd61r\xb6\xb09\xc4G\xa1\xb8Re)\x1a\xa0B\x96\x9cT\xcd\
+\x02@\x96\xf8Z,Z\xf8\xa1\x8b\xed\xa1\x10\xc1D\xe8\xbd\xe7\xa9v\x8c\x00\x1f\
+\xd1\x07\x91Rd\xf7B\x1e\xc9\xda\r\xf5$\xa1*uH\xb2\x85\xb8\xa3\x06\x03\x005U\
+\x01\x8d;\xa7\x06\xab\xa2\xb7\xa3\xd5\xce\x10\x82\xde\xde\xa1\x90\x7ff[\x02\
+\xd9\xb2\xdc1\x80\xdc\x0f\xe3\xca\x95n\xf4\xe9\x19\xb5\x8cDY\x9a\xab\xb2\x9c\
+\xa1\xbc\x9e\xbf\xeb\xa9|dG\xb9\xe2\xb2\xe72\xab{vK\xfd\xf3\xe6x\xbc\xab\xba\
+.\xa8%\x97\x16\x084\x96\xa5H\x1c\x05\x14a\xc0G\\\xe4Nm\xce\x01\xef\x81\xcd\
+\xbd\xc6q\xdd\x93\xef-\xf4\xf7\x88J\xd7\xdf\xb7}\xbbP\x1f\xab*z\x9f\x1d}\x0b\
+G\x88z\xf8\xa1\x1a\x96\xa1\x83[\xa3\x8f=\xd4\x82\xe3\xaa\xc1\x1a\x97\x1a\x96\
+\xbaS<J\x18\x83+\x83\xd2\x00vvS\x82`\x96\xbc\xac\x00\xe8\xe0\x91\xae\xab\xd0\
+\x04\xe9\xb1o\xa5\xbb\xb5\xea\xc6r\xdb1\xa9\xd5g\xb2\xf2\xc9X\xed\xb5U\x9dm\
+\xfc\xdb\xdd\xd7<N\t\xf5.\xc6\xd4C\x94\x99\x8c!\xf4\xb0\tRh\xfaq\x18\xa7\x1f\
+\x15$\x85;\xe5\xd0\xdb\xdcC\xce\xf0\xe9\x15\xbb\x8d\xe3:\x01F-\x88\x1ao\x9cR\
+\xaf\x01j\xdeY\xa4\x88\xae\x1e\x9f\xd8\x96\xd95\x99\x068\x04w\x84i\xee\x86\
+\xbf\x8f\xbbT\xb1^\xc1\x00f\x0e.w\xd7eop{u\xb3\xb8\xe2\xf2j\x94\x9d\xdc\'\
+\x8b\xb0\x99\xa0h\xcb\xec\x1f~\x85\xa8>H\x10\xf2XV\xb3\xb2\xd1\xf6\x81\xb7\
+\x8aK5c_\xb7S%\x14\x17W\xb6L\xba\x00]\xc8p\x82\x07>]\xbd\xa1\x12\xc0\x80\xf3\
+%\x97\xb6\x82\xcaBXG\xb6a\x08~\xa2;,\xd1\xedRIm\xe6@\x11\x80\xa5M\x896\x83\
+\xae\xc7(1\xbb\xd8\x98j\x10@naY\xbd\xcb3\xd7J/ \xaase9\x93\xc3\x1e\xab:\t%HQ\
+>\xfe\x015\x80\t\x06?RcL\x86\x7f\xf0$/H\xa9BMI\xf7\xf2\xfd\xc7\xd8\xae\\\xb8\
+D^\x0e\x94\xf3\xaboo\x7f\xc6\xaf\xff\xae\x9a\xdd\xf7\xea|\xb7\xdek^to\x8c$-c\
+\xd6F\xaa\x8d\x9cn?\x94[\xc6\x14E\x97*\x92%\x16\xed,\'1\xdd\xb8\x97J\xe9S\
+\x9f\xcd\xf9\xaf\xf56\xffk\xec\xf0\xa1\xf8\xfe\x1c\xe91\n\xfeQc\xb4]\x9bl\
+\xf2\xd0v\xbdK\xc6\n\xa4a\x15\x8a\x1c*\x87&L\x01\x14G\xa4V\xd7\xf2\xdf\x1c\
+\xd2ll\xc6\x98\xcf03\xa0\x90\x01\x08\x96\xda\xe5\xfd\xec\xc19\xa8\x87$N\x97Q\
+j\x1b\xcd\xe1\x00\x15=U\x84\x83\x1c\xa9ka\xed\xbb*\x8ds\xf5hMz\xd2\xbb u\xa4\
+ (4\xde|\xcf\xc2\xa3\xcd\x91\xbe\x8fu\x9as\x1e3\x1bM\x15=\n\xb0\x19\'q\xdf\
+\x01\xf5\xe0\x9f\xca\x93\x13RH\x14\xc6\x04\xad\x91\x17\x000\x9dB\x1f\xfcd\
+\x9a1\x8b\x1e\\\xe3\x05\x96+ h\x9f\xe6\xb0\x00\x95\xbb\x99\xed\xb1\x85\x14\
+\xda\xcb\x96\xf5\xb6dk\x1e#\xa7b\x8by\xfc\xc3\xa8<^\x1b\x0f\xb9\x83\x9f|W\
+\xf7\xf1\xf1\xf9\x17i?\x7f\xbc&\x1dCX\xc4h&RL\xf6\xba=\xd72\xed\xa0\xb3\xc7\
+\x869tz\x1f\x806\xf4\xc8\xaf\xc7\x08{\x160\x94\x0cg\x12\xf9\x1f\xe2R\xc6\xee\
+\xe5\xde\x1e\x10\t\x9f\x02\xa2\xf2n\x87u{\xfb\xd2X\xe5\xc3\xc1\x94\xf2\xe7\
+\x1fP>\xd2\xcf\x15\xd9\\\x07\x90\xecM\x9e\xc4\xbb\xdc}{\x03\xb4A\x83\x83\xcd\
+\xd5\xbcd.\xef\xda\x87\xd9\\\xad\xa0\xf0\xdb\xb2Z\xf2\x92\xfb%\x80\xd2\xf2\
+\xda\x96\xf7\xc0\xebf\xbb\xe3\x12]A~(w:re:\xa5\xa8\xf4]h\xd3\x97\xbf\xb75\
+\xc2\xb8\x90\xae\xf5(\xff\xc8\xfe|J\xf9\xa3L\xfa\xe0@\x80\xf4~\xff\x90\x1c\
+\xb6t\x90\xed\x87\xe8\x97\xfc\x91}\x0f\xe4\x8c?1^\xe5\xc41~\xbc\xad\xdfl\x9a\
+C\xe7\xa0\x1c\xaa\xc0\xf3Cx\xcc\x1b\x97\x08,\x93\xdf\xcb\x1f\xf3n8\xcf\x98\
+\x950e\xfb\xc0r\xfb7\x90yzncA\xce\xf2\xaa\x94\xc6\xa1\xf1l#\x85T\xe6\x9e\x1f\
+\x9a\x99G\x89x\xdd>\xe6\xcb\x99%}\xfc-\xbaPt\xf9t:=}\x94\x12\nr\xf7=\x89\xd1\
+c\xd6\t\xb5x\x07\x80\xbd\xbe\xe8\xa8\xc55DA\xa9\x00\xa0\xa7\xb0\x89Z\xcf\xed\
+\x19E\xee\xe8a\xaa#\x05j\xde\x11\xa0\xec\x0e\xd5\xdaN\xc6\x00H\xf5\x94NH\x83\
+\np\x8ex\xb0\x90`f\xf4C=\x17>\x97-\x02\xb1+\xde\xffl\x06\x19\xad\xb9\xa7f\
+\xa1\x92m\xe5<2^~mm\xd9\xacl\xb2\x9dux\x07\xeb\x04\xa5\xc7\xcd\xab\xfa\xbb\
+\xa6\xb5\x9d\x1bR\xd2\r\x16@N(\xfd4\x8d\xa6\x9f\xd3H5\'\x97\xef\x85M\x06\xe8\
+\x9e\xb8\xf3\xc9qnsoy\xfb\xe2\xfbd\xb1\xc8Q\xf0!\x12\x87\xe4-A\xc9#\xf3/\x04\
+9\xcb\xf5;\x00\x01\x1bi\xac\x00\x14\xc3\xd3\x01\xd1\x04\xf4@\xbc\xb4i\x99\
+\xbe\xe3d\xa7R\xe4\xd9Y\xa1\x8a\xe7#\xfb\\\x17J\xab)t/n u\x80b;\xbb\x00pe\
+\xe6\xb0\x98\xfb\'B\xb92w\x1b\x06\xd6ow\xebg\xbd\xe1\x99\x9f\x04{\xc7\xe9\
+\x92\x96\x90\xb6x\x96\r\xa1mTB%\x80\x82F\x10*\x9f]\x89\x93`i\xa7\xab\'\xf9\
+\x02\xa8\xee\xd4c)\x95\x02C\xbc\xea\xdd`P4\xe8%C\x00\xd8\xa2\xd8%\x1f\x0e\
+\xcf\x7f\x00l\xc6\x16$\x9a\x81\n\xb70\x81X?\xca\xb6\xffP;\x8a\xd2\xecQ\x91\
+\x8de\xb3\x01\xa0\xa6\xa7\x00\x14\xa6\x9e6\xb26J\xfehP\x01\r@0\xf3\xfb}n\x07\
+$\x83\x95\x8e\xdb(\x95\x8f\xe2\xad\xf79\xc5\xf9\x9c\xcb!I\x08\x7f\xb7\x86"=\
+\xcc\x8co\x88\x17j\x9a\x8e*\x8eB\x97\xe6v\x89"\x8d\xc4\xa0a\xc3\x0e?5\x85\
+\xc2R\xd6\xba\xb8\x98\x1c+\xae\xec\xfd\x04\xd9\xd0\xaa\xde\xd1\xe2\xca\xa0x\
+\xaf\xa2%\x0c\xa4\xec\x96$\xddZ\x94\xea\x11\xb0\xad\xb9e\xe4\xc5\xf6\xa0\xb2\
+\xddI\xf4\xfc\xa0\x87\xc5}\xb5\\\xcd~y\xef\x13\x8f\xa7\xfd<;\xb9\xd4\xa7\x1f\
+\xad\xcf&J%\t\xcb\x94\x99Zv\xde\xa8\x84\n\xa8\x1cD\x90i2\xfa\x18\x82\x85\x02\
+\x06S\xc22l\t\xcbX\x1a4Q\xd9\xc9c\xa5!l\xa1,\x9bj\x85\x9b\xbf\xa9V\xed\xcaq\
+\xb3\xda\x01#`\xd5\r\xdbM\xd7\xc3\xec\xac\x8d\xbb\xca\xcb\xce\x19\x08)$]\xc4\
+\x8f\xe2\xea\xa8\xb7\x89~\x7f@\xa7-l\xee1\xc6\xc7~\x8c\x01h\xe1\xb14\x06\xd5\
+#\x1cz0\x02\x80\x96\'\x8a\x90\xb3\xb3\x99\x04\xda\x16P\xf9\x83\xbd\xb9\xa9\
+\xf9\xdd\xf2\xf6w\xd5}\xba\xf1\x94\xce\x06iuz\xd2\x9c~P\x9f\xd3X\x85\xe0\x1d\
+tO\xa4\n5z\xbe\xeb=W\xc5\xa5.\x0ecp\x88?\t\x00\x98\xb1\xb1\xd6\nZ\x96;s\xb7\
+\xe1\xb7\xab[\x00a\xa2\x07\x00\xbd\xda\x01\x18\xeb6\xf6]\x9a%\x00\xe6\xf2z\
+\xc3\xd7\xbd\rz\x15s\x1b\x02\x8a\x8e\xfb\x96\xfa;[\x16j_\xe4\x7f\xdb\xf4Gv\
+\x11W\x8cz\r\xe7\xf6\x16\x99\xf8\x99\xb7\xdcHC\xe6\xa5\x1e\x9d7\x83^2\xdc5\
+\xeb\xdb\xed&S\xa7\x93\x8d\xfda\xb0\xf9\x98\xc3)\xb0\x89\x1f\x02\x92{BP\x0b\
+\xf3\xdd\x0f\xcafY\xbe\xbd\x9e_?\x98\x97s~\xbb\x02@\xcfF\xfcvE\xcfF\xf9T\xe9\
+\xb3!=\xcb\xd5\xf4T5\x13\x89\xc4\tJ\x9c\xcc\x10\x89\x1f\xb5\xe0\x9d\x960\xf0\
+cKJ0wu3{\xa9Q7G\xca3Mscyv\xcb]\xc2(\xb4\xc5\x03\xf6\x89x\x87\x93\xe8x\x98\
+\x00\x10\xe6q\xe8\x14\xa6\x16\xd8\x04@\x9ab\xd8\x84a\x9e\xe6?\xac\xb8\xf2\
+\xd0\x04E\xd9gA\xb9\xfb\x0b\xbc\xc7Amg\xddx\xc2\xc8M\x13}\xc4\xcf\x84\xadP\
+\xadq\xff\x1a\xf3/\xb5\x99\xb3\x9d\x1b[*\xe5\xfc~\x0b\xb0*\xa0\x8b\xa2\xf8B_\
+|\x96j\xe8\x1c\x9a\\0\x8e\xbc\xa3\xc6;\xac\xf2\x12\xdf\x92\x80r\x0ek \xad\
+\xa7\xc9\xba>$\xf2(\xb2q\xe8\x9d\r\xe5\xe5}\xb5\x04p\x8eM\xbe-K[\x12\xd0[\
+\xde>$\x0b\x99&/\xddDcB\x1c1Nvg\x15\x1d\xfb\xca\x86\x19\x9a\xad!\xc5@\xaeu\
+\xe9JI\xe7\x00\xa0\x8b\xeeP\x8c\x98I\x7f\x0467\xe8\xc5\xe9J\x82\x02\xb9P\x9d\
+\xe8\xe0y\xf2\x9e\xbbI\x86y\xf3\xfe\xa1K\xb63\x89:#\x89\xe8\xc8\x80\xcd\xa6\
+\xbc\xdem\xae\x9a7\xaf\xd77\x00\xd6My\xd2\xb8\x1f\xef\xad-\x87\xf8\xdf?\xc8\
+\xfe\xc3\x8f\x9b\xff\xf4\xaf\xf1\xc9\x8f\x86\xc5\x1f\xe8\xbc\xc8\x95RjJ\x1a@\
+p2w\xe5bvP\'".\xdf\xbc\xb4\xbf]\x967r\\\xbb[\x00\xb4\xda\xbd\xe1\r\x80\xc4<X\
+PU[\x00\x93\x94\xb0\xc1C\xdd\xbd0\x13$r\xe3\xa6\x04\x80y\x1e\xba\x89:\x89Q\
+\xe3\xbe\x85&r\xb5N]yOO\xb5\x01\xe89\xb6s\xbb\x02\xe1\x96\x1b\x10d\xc2\xcdy3\
+\x90K\xf16\xdb\xc8\xcb\x1f\x9c\xdb\xfc\xfe\x8c\xf6\x0f\xc9\x8bu\xf6)4MW\xa5\
+\t\xd3\xd4f\xf9-\xcfn\xcb\xebE9\xb3\x02\x9b{V\xfc\xb3\x93\xfc\x8f?\xb9\x98\
+\xfe(\xc7\xf4\x02 \x14{h\x19\xc7\xef\xe5\xc1#\xa0\x84\xb5\x98\xc7q7|\x14\xc8\
+\xc6\x02\x10\xff\x16f\t\x00\xf2\xe43\xfbM\xef\x1f\xa3\xdaM\xc4\x98\xef\x17\
+\xd7?n\xc6t7\xd3\xe4S\x11\xd0\x9fL\xf6\x87b\xc4Lz\xfc\xae\x10\xaa\xc7\xb2\
+\xa2\xb8\xd6\xf20\xe1\xf9\x9d\xdcz0\xd1\xcf\xcb>C\xf7$\x06\xe2<\'=,\x9eT\xb7\
+7\x8b+.gj\xfe\xc2\xd8#\\(\xe7\xcf\xab\x7f\xff\xdc\xfe\xf7\xff\xab-`/\xa1=Z\
+\xc6\xce\xa4\x04\xe6\xc6_\xf7a\xae{\xf00W\xa6\xc9\xe4\x04Uk\x00\x1a\xb8\xaf\
+\x96\xbc\xba\'\x9e\xc9[\xd6+{\xbf-\x85m\x17\xdbE\xd7\x84\xb8[\xc2\x10u\xa4J\
+\x91Wy\xdcq\xd8\xeb\xf4\xae4\xb0\xefA\x94P0s\xe8\xe2\xb4\x9fS\x08\xd2\x0f; \
+\xd5\xa8\x8e\xb2\xe1\xa61\x00T\xe2\xbb\xbb\x93#\x80T\xf4\x18\x03\xc0\xfc\x9e\
+\x8e\xde\xd1f\xa8\x00P\x9ae8I\xb1\x1a\x93\x0e\xdd\x93\x80N\xf5:%e\xb9\xe3\
+\x19\xca/\x9b\xf2us\xb3n\x8e\xfcx\xa3\xf5/\x9fn\x9e|1\xff\xd9E\xff\xfcO\xcc\
+\x8f/t>\xb5\x1a\xc0\x8c\xcd\x94\xf4\x8c\x8d%\xabX!h\xe0!OK\x00x\xb9\x9b\xa3\
+\x87\xbb\x8c\xdf\xf6n-\xb6\x0f\xa8\x85ns\x80\x99\xd9\x84M\xd9\x1bbU\xfd~\xbb\
+|\xda\xac\x83S\xdcK\x86\x05%#r\xce\xa4\xf2}2[\x95\x11`\x81[\xeaL\xd8\xdc\x1d\
+^|\xd1\xd9\xbb\xb5\xcd9\'\x02\xa4}\xac\xa4\xc3\xde<\xed\x17\x00\xc6\xe8a\xf8\
+\xa9\xce/\xd4\xe3\xb0\xe9&W\xfe\x10;\xa4\xdd\xbf\xbf\xc5\xb7\xe9A\xbb$\x00`\
+\x94\xa9]~s}_\xbe\xb8\xb53c\x96\xbbSS-\xeel\xf3I\xab]\xa6g#\xfd\xbc\x98~V\
+\x14Z\x15\xf8,\xf7\xdd\x92\r\xde\x93\x9erfpe@\xf3fc\xa3\xc9q\xe1\xe6\x12g\
+\xb2\xbc^\xc0\xb0\xb8\x7fl,i\x85\xe0\x07"\x12d\x1e\xdc1\x08w[W\x87\tt\x05\
+\xf6\xa66h4\x12\xc8\xc4\x8daF\xe3\x0c@pbi\x9cA\x8fI\x0fH\xab\x1c\x07\xb3\x84\
+\x046\xc3\x08\xb6\xc3/\xf9\x9e\xe1k\x878\x19SE{{\xb3\xae\x99\xd8\x91\xc1\xc1\
+\xe2\xd5\xed\xbb\x9d\x0f\x0b^~\xbd\xb9\xfd\x92\xb7\x8a\xcc\x1c\xe5\xcb{ m\
+\xfe\xa2\xfe\xea_\x85M\x94\xcaQ|\xc6\xc5\x17|\xf1\x99\xbd\x80!\xe4\x85\xcb\r\
+\xee\xd9\xe1uo\x18f\x0e\xfavQW\xcbju\x0f\xe0\xd9Hqv\x9eV\xb7\xf5\xb6\\\xde~\
+\xf9pk\xc4\xc5\x95\xed\xb5\xca\x19 U0\xfcH\x15\xa5\x01\x8c\xb2\x93\x87d\xb1k\
+Nv\xe3\xf3\xde\xf2\x16\xbe\x11\xb1\xf8\x9f\x9dV$G\x0e\xcbh\xb4\xfeg\xd3\x9fn\
+< K\x1fc\xa6i6:=\xcd\xc6\x98\x9c0\x8e\xd5\xa4S\xadT\x9d\xaa\xde\xfe\x8f\xa1\
+\xfa9\x00s \xbc\xf1\xba\x82\xfd%\xee]\xfe\x8f\xbd\xbd\x95M\x05\x80\x90\xa1\
+\x93\x7f\x07\xe0F^\xfa}9\xf9\x90\xd9\xcc\xd7\xb6\xfc\xcd\xae\xfc\xdb\xcd\xc6\
+\xae\xcd\x83\x87\xcd\xb4\xf9\x8b\xb0\xedI\x93\xab\xcd\xff\xf3\xc5\xee/?\xb3\
+\xcf~\xb4\x99\x9e\xf5(7G\x1c\xf1ru\xe4\xa1s\xb7\xe1\xbf\xe7r^\xdf\xbf[\xde\
+\x02\xf8\xa4\x9fMvt\x91\x10\x9d\xe4\xf3r\xfe\xd5\xee\xea7\x9b\xbb\x7fX\xdf\
+\x86\xa0L\x1c\xdd\'\x9b\x1e\x00l0\x1c\x8c\x04\xe8~\xdcl})\x90\x96\xb9?\xca\
+\x18\x0b\xbcv\x93\xe3\x0f?\xd9\x99\xf8\x9f\x02\x98\x10\xe7\x01\xd61)\xces\
+\x87>Vw\xf4]\xfb\x00\x00 \x00IDATDE\xae\xb8\x19~\x99\xa5J\x81\xf5(\xd7D\x06P\
+\xfd\xde\xd1\x9a\xf4\x864Z\xd8L:cj\xd1\xb8(ro\xcc\xd0c\x98\xf9\xd8\xd1\xf2\
+\x01\x94\x11d\xb8\x86:|\x93\x86e\xd0\xdch\xfbUY^U\xe5\xdb\xfah\x03\xc4w\xcf\
+\x06\xf94\xfd\xf23\x9eM\ra\xae\xda\xb9v\x10\x08\r\x19K\x1bQ\xe1\x92\xab,1\
+\x9f\xa3\xb4\xb3{~[\xd28\xfb\xfd\xf4\xbc\xd0\xf4\x02\x05\x00\x03\x9a\xbd\x1c\
+\xcd\xff\xda\xe8\xdf\xb8\xfd\xdd\xebl\x9b6\x00~\xabj\x00g\x83\xec\xe1\x0c\
+\xab\xa2\x8fa\xf5v0\x06P\xab\x1a\xe0\xd4\xa6\xf7T\xb9>\xedk\xe7\x1e?\xca\xab\
+\xd9\x9e\xac\xfd\xda\xa1\xee\xc2#\xe7*\xd7\x035\x95\xb2\xdfH\xcf\xdfT\xc7a\
+\xb3\xf1UB\xc0>\xee\x05\xd8\x0c\xda$\xa7\xee}\x8c7\x7f\xe4\xd7\xdb[\xdcpG\
+\xaa\xb4\x87\x99\x16\xc0\xc3"_~\xfd\xe6v\x86\xdb\x97(_\x1e\xeeP\xab\x1c\x00\
+\xab\xa2:\x7f~3\xfd\xe9\xe9\xf9\x87u\x0ehHR\xd7\xf8\x0f5\x0cX,\x19;F\x8f\x00\
+?\x11\xb4\xb1\xa8_\xbf\xa9f\xbf\x14O\x92F\x8a\x9f\xfc+\x9e\x9c\x90\x82*\x99f\
+?\xc7\xf5W\xf7\xd1\xe7\xce\x81\x1cD\x00\xbbA\x96E\xa2\xce\x86\xbe\xd3\x9d\
+\xdc\xa0\xa6\xb6}\xdfvx\xf5\x880i\xff[X\xd7\xb4\xa4\x84\xcaa\x9b\xfe\x94Fjpr\
+\xc9\xd9\xb9\xceFP\x14~{z\x146U\n\x00\r\xb2\xe4\xc4W\x9d\xef\xde\xa3y\xdep/\
+\xc5\xa2f\x17\x08\x8b\xd4S,;\xb6\x10h\x15\xa1*Cxc\x08\xff\xb5\xdc\x97\xf1\
+\xa3)\xc3\x9bd\xbe\xdb\xde\xa4Y9\x1a\x1c\xb9|\xd5\xc4!d\xb1\xfd\xbf?5\x7f\
+\xfa\xf1\xa8x\xba\x1a>\xcb\xce\xb1\xc1\xd9\xb0=\xd6\xbb\r\xdf\xa0\x07\xbb\
+\xe3\xddm }\x9f\xf5\x86\xbf+\xef_\x98\xb7W\x9b7\xe9v\x83\r>\xef}\xfc\'\xc9\
+\x9f]\xb2\xba\xa4\xfc\x8a\xca\xff\x8c\xeb_\xe5\xdbW\x9bonv\xbb\xcd}\xe7\xd3/\
+0H\x86\x83\x8f9\xd3\xacrn\x9bo`\xef\x8f\xae\xbec\x15\x92\x06\xdd\xc7\xef-7r\
+\xa1\x15\xe3A/\x19~\xda\x1b\x9f\x0e\xd5\x87\xa3B\xfbYosf\x00\x0f\xa8\x13=\
+\xfe\x0e\xd8\xe4\xa4Cj\xbf7tS\xf0\'\xa3;\xd7\xfe\xc8B\x00\xc06z n\xfd\xc6Q}\
+\x03\xd0i\xb0\x81Y\tegz\xf7\x96\xb7w-\xb7Rzh\\\x01d\x0c\x80\x9dZ\xdf\x16\xc9\
+\x8b\xe7\xe3\x1ck\xc7\x9fy\xb4)\xc1\xc0\x9c\xa1\x0f\xbc\xd9%\xc3\xccf\\\xbe\
+\xe0rVi\xe0\xaf/\xe7\xdf~\x91=UR\xa4\xa0\xbe\xb5\xc3\x9b_/\xcd\xabQzg\x93\
+\xfb\xf1\xbc\xde\x15MS-9\x1b\xd3\x0c\x00\xd5\xe5io|\x06*\x0e\xdb{2\x8eC\xa5\
+\xbb\x94\x8d\xd99\xf7r/$\xd7\xcc\xba\xb9\xbdH\xf2gO\x7f\x93\xa4Q*5\xb7`4K$\
+\xf4\xe8\x086\xa9I\xdf\xd3\x977\xc7\x82\xf1=\x0b\xcavg\xdd\xe8\xfe1\xaby\'Lz\
+,+\x8a\xc1S\x01Sa^\xa2\x8c"\x80\x8f\x81[\x0c\xaa\xd5=\xf1L\xc2\xe7R\xf4\xea\
+\'\x97|\xfa\x91}z\xa2\x00\xab\x9c8\xb7bW\xb3&s\xe2\xe2.\xf4\xe9\xed\x15\xf9\
+\x0c\x00\x03(.\xf9\xd3\xff\t\'\x17F\x936\xbc\x99\x7f\xb5\xbb\xf9\x1a\x0f\x8b\
+\xc6\xce-\x1b\xedo)y\xfe\xe7@C\xda\xaab\xa2\xb2\x83\xaas\xb1Gc^m]\xeb\xe9R\
+\xa9\xdc\xda2\xa4\xeet!\xdf\x82N?\xa2\xc9\x89$\xc2\r@\xa1gi+w?\x1c\xc1V?\x01\
+\x1f4\xee\xc0\xfb\xb2^\x03\xec\x02\x9f.\x7f\x0fh\xb7\xe1\xee\xbf\xddm\x00W@\
+\x04`O\xba\x99t\x13H\x05\x1bQ\xc5\x00\xb0\x91*\x8e\x84\xc5Vx\xa8\xf9\xde\xda\
+\xabf\x0e\x00\x1b\\\xee>,6\xe3\xa2\xd4\x9a\xe8\t\xc6\x00\xde\xee\xd6\xd2m\
+\xfe\x01\xf5\x8de\x00\x97j \xe5E\x86\xf9M5\xbf\xb7v\xbb\xf9f\x9c\xac\x86\x83\
+\xd1O\xe8\xc5\x17\xbb//\x91\xc3\xa0\xbc\xb9\xfb\x95]\xbem\xcc\x9c\xcb[\xca>"\
+\x00p\xa33\xbd\ri\xf4)\xa59\xf9\x02\x1f/_\x0fX\xd9R?v\x0b\xd5\x06\xec\xb7\
+\xde\x87\xf8\xc0`7\x1e\x14^f%\x91x\xa1\xc6E\xa65\x13\xefz\xc4;\xb8l\x91\x96\
+\xfd\xbfg\x04\xdb\xe0(\x93n\x1fw\x97\x8e\xda!ItH\x06\xc1uBq[\nM\xcf\xb0\xb1\
+\xc4=\xac=@\xbc\xdc\xc5\xef%\xf3\xd5\xdc\xcc\xadP\xcf\xe5\x1f\xb3\x9a"\x87!\
+\xe4\xde)\x81ij \xb1\x89\xbb\'\xaeP\x11rFi\x9bI\xf9\x9b[\x9e\xaf\xcc\xbcY`\
+\xa8\x8b\xc1v\xaa^M\xeb\xa1\xb2\x00\xecl;\x7f\xbb4\xaf\x96\xb0(\xb9\x92\xa8n\
+^\xd6y\xf4\x18)\x07\xf6\xdd\x99\xd2]\xd846\xa2xZ\xcb\x9c\x93w\x08\x95\xb0\
+\xbaP\x000\xcc\xe8\x99^\xe8T\x8f\x1d\xbd\xe5O\x9d\xd7X\xc9\xa9\xf8\xce\x0eH\
+\xc1\xe2\xba\xf2\xefo\x8f\xc9\x84\x02\xdf\x94zV\x1dHE\x8f$G\x1a\xff\x8b\xe8\
+\x86\xe7\xbd2~[\xa1Z\xcf\xee_\x13\xcf\xe6\xe5L\xe8\x12\x06\xf0\xf3\xff\xa5\
+\x1e\x9dr6\xe6P\xb6\xa32\x02`+\xed\x01\x8d\xb3!\x03\xa8\xd6\x83\xea\xb6\x9a\
+\xbdH\xb63m\xd1\x9cLG\xcd\x8a\xc6\x1fl\x94\xde\x8c\x7fL7\x7f\xbb\xb5\x0bc\
+\xdfI3y\r\xd7\xec!\xefv\x8fh\x00\xa8"Q\x998\x9c\xbep\xb2zL_\x04\x00\xaa\xcdU\
+\x02\x8e\xe8)u!\xda\x80\xe2\xf4#\x00\x98\x9c\xc4\xdf}\xef\x91uD\xee\xee\xfam\
+\xe2$E\x9b\xdb|\x1f\'\x0e\x008\xa1\x1e\xbam6\x8f6\xf7\x10K\x91\xc5\x98\x9cz\
+\xd5\xbe\x93\xb5\x03\x89e\x83A\xac\xd8\x0c\x0c\xbb\x8eF\x87\x02\x98\x83\xcd\
+\xa64\\\xbe6\xdb\xed\xe6\xce\xae\r\x00u\xa2\xbf\xd8\xfd\xfa\xb4J\xff\xa8\xaf\
+\x98r\xe3\xfa$\x93\x1b<\x94\x012\xa7\x03\xb0\xc0\xcc\xcc\x1fj\xfe\xb0g\x7f\
+\x8f\xe59\xdd\xf7v\xf9\x1f\xe9>\xe0\x92\x92\xd2!\xe4\x9cW \x04Q\x90\x9c\xc8\
+\xf3\xf8\xcaT}\x8d\x9e"\xe5[\x8a\xc3\xb25\xd2\xc9Dp\xb2\x8b\x96\xb2\x9fy\xda\
+\x97\\\xe5\xaeYc\x8c\x87\x9e\x9a\xec\xec\xa5\xfe\xf04K?\x9cL\x01\xbd\xd7\xd8\
+dO\xbc\xda\xe9\xb79\xbc\xd0~\x96\xd08\xd5\xe3Zmc2\xef\xfd\x80\xe9am\xdf\x9f\
+\xb1N\xa1\xb4\'\xect8y\xa0\xd2$Y\xd2\xc3h\xd7qG\x01\xdf\xdfc\xaf\xdd1@\xa69\
+\xc3\xdb\xfb\xf9\xdb\xaa\xfc\x95\xc4\xef\x00\xeew\xff\xe6\r]>\xfd\xf5TR\x87\
+\xee\xa8L\x93\xa8\xe4\x01\x80m&:ql\xb8i\xce\xf0\xf6j\xfe\xd6`]\xbd\xb3=\x9cU\
+\xafO{2 \x12\x00\xdf\'\x00\xcc]O\x00\xd0\xa0\x01 S<\xde\x85J\x91\xa0,\x1a&-Q\
+\x0e\xc08\x82\x19h\x0c\x08\x88\x1cKy\x9f\x82\xb1\xcc\xba\t\xdf\xb4\xceG_MS=~\
+\xfak7\x9eN:?\xb7\xb8\x13caG\x80\xd4\x1c\xcc\x12\x8aA\xef\xfd\x80\xf9\xa8;\
+\xe5\x1b\xc4\x1d\n;\x81tsPb\xb99\xa8\xafl\x8fU\xde\x1a\xefFZtV\xab\xb4\xbamf\
+/\xe2\xf8\xbd\xfc\xcf\xcfO\xcf\x9f\xcf\x02\xfe\xf8=\x04>2\x94)\x97\xf7\xaf\
+\x89\xff\xbf\xe2\xbe\xae\xc7\x91$\xbb\xee$yIF&\x83\xac\xac\xea\xacn\xceLi\
+\xb6v\xb7\xd732\x06\xde5,\x01\x0b\xdb0\xf4 \xbf\xf9_\xf8\xff\xf8W\xf8\xd1\
+\x8f2 \xc8~\x10\xec\x15<\x96\x16\xf2\xc8\x18I\xad\x9d\xdeF\xcdlM7\xbb;\xab*\
+\xc8\n&\x83\xe4e\xa6\x1fnd0\xf9U\xdd\xbd\xbb\x80\xefC\x81\x95L&\x93\xf9q\xf2\
+~\x9c{\xee\xb8*\xdcdiR\xe7\xaa\xe1hY\x15\xd4\x7fL\xb5\xf0C\x90\xaaC@\xec:\
+\x94\x16\x93.\x9e\xad`\xbc\xa9#\xe1\xc2\x077\x01\xb8\xdfI\x00u/ggx\t\xa0\x99\
+\xbal\xeev\xe8\x8dj\xb6D\x1d\x95\xf2\x00\xea \xfd\xbd\xad\xa9\xce\x01@\x06\
+\xb4\xf9\xf6I\xf6\xff\x86\xdd\x915\xa5\xfd|\xc6\x8d\x0b\x83\xe5\xa7n\xd1\x90\
+*E;\xce\xe7\x06<\t \xe4\x8b|\x9c\x98\xeb\xe2\xcd\xff\xed\xdd/&\xd6\xf4X\xcaC\
+\x976;\xe9\xa8A=\x93\xc6\xc2W\xc0\x07m\x7f/\xde\xaf9bk\x1c\x15e\x91\xa3:\xa3\
+\x89n}<b\xe3\xe0\x9bq\xee\x81I\x1f\xceZ\x0b^\x86\x86v\r\xa9\x01)6\x8e\xd2\
+\x94\x8di\xa7\xf2ZU\xe6\x16\xdd\x92\xea1\x1f\xbc\rF\xf5\x8f\xb8%\xdfc\x94Q\
+\x94\xb4\x12$\x9dL\xf5{:\x060@[\x08W\x01$+\xf7\x12@cR\x89\xb7-\x02R|qB\xa3\
+\x93&\x01\xe9\xfd\xab\xe1\xc7\xa8G;\xb0\xd9\\~Lnn\xc7\x0e\x12\xe0C\'\xbe\xf0\
+\x82\x1c\xb8r\xdf\x7f\xfbO\xb9\xf9\xc7;\xca\x1d\x00\xce\x14i\xd2\x7f0\xa0~\
+\x87Fg\x99V\x00\\5\xb0\xb3\xb7a#Oh=3\xce\xd8E\x938\xa4\xebN\x1c\x00\xd2\x8c3\
+3N:\xd67\xeb4*\xd5a\xb9\x9a\xad$d\xdbp5e\x05\xcb\x00\xb4&l\xd0r\xd3\x19\xa4~\
+\xfc\x04\xc0V\x1a\xb9\x9aq\xd4\xdfy\xfc\x1c\xbc\x06\xde1\xb9r\'W\x19$\xe3\
+\xd6\x8d_\xb2\xc3\xbd\xdcj\xd29\xd2\xcb\x83#Qy\xd8Hx\x1d\xde=HL\xd2\xa1\x10\
+\x0e\xd8U\xd1^\xdd^\x8f\x9fE\xd3\xb1i\xb0TN\xce\x9e\xc6\x89b\x1a=I\x14\x80\
+\xd7\rj%\xf1\xa6@3/\xb6\xbc\xc78\x91Z 5\xe7\xf0J\x89\xa7\xec\x9f\x05~\x8a\
+\x05\xb7f\xb7\xb3h\x8b\xd6\xb7Kw\x07P\xe7*\xc3\x0b\x95^\x02\x88\x86\x9f\x9dt\
+\xfa\x00\xd0\x89wj+\x0e\xebp`w\x8e\xaaX\x9bZ\x07`S\xbcM\r\xcd\xb0D\x1aMW3\
+\x9c\xfd\xbd<\xcb\x90Z\x0b(\x10D\x14N\xacG[\xbf\xaa\xf9V\xf00\t[\xb1\xb94Z\
+\xeen}[\xf4c\x03\xaa\nZ\x82w\x00\x04\xbb\xc8\xedc\\\xebE1\x9d\xfc\xe6\xf5\
+\xf7~\x83\xf7\xc9p\x99~\xaa\xfar\xd9\xffa-\x84!\xd2\xc7a^\xe4\xcbr\x89:\xd3(\
+\xbd\xe7H:i97\xb5BG\xc1\x05\x80\x84\x128\xa4\x8a\x05\xf5&5\xe3\x08\x8006\x97\
+HJ6\xb7\\\x9d\xa9\x08\xec\xe1\xf1\x8c\'\xb7\xae\x02P\xf6{\x8f\xa3\xf8S\xd5?\
+\x89\xbf\x1a\xb4I\'\xbf\xd0T\xfb\xc0 8\xb6ZUv6i\xd3 >E\x9d\xec]\xd3\xbe\xb03\
+\xda(\x1e$ }\x88Lq\xab\xd6\x82\xdb\x97\xdc\xdc_\xf8\x80\x1d\x14\xf6\xdc\xb1=\
+Y9o\xe4]Y\xd3v\xb3o\xbfz\x05O\x8f\xac\x19;R_\xd8\xabw\xbbP\xad\x9e\xafl^\xa3\
+q\xa6\xa4\x90\xed\x115 \xa1"\xca\x92To\xae\xa4\xa0\x01\xb2\xa9\x95\xef\x90\
+\x8bDo\xb3\xde24\xe9\xd3X\xfd\xf8I\xa6US<\xdfV\x9b{kSn\xdb\xfc\xe4\xad\x7f\
+\xfd\xbb\xc7z\xd2\x83\xba;\xde\xafA\xf2X+\xe5\x07\xb7X\xd6\x80\xbc3\xebm\xdf\
+\xed\x04\x00\xb7R\xaa\xb3s\xb0\xdc\xaa``\x04\xb4W\xb7\xaf\x0b\xb7\x9a^E\xcb\
+\xb1\xb1\xd6\x00)\xe9\x00eUw$|\x87\xe1\xf2\x06\xc0\xb4\xfbH\x82t\x99\n\x04\
+\x85\xaa;\xdaR]\xaeg\xbb\xa7\x89\xee\r/\xd6u\x91\xdd:\xd3\x9d\xdd\xde\xd7\
+\xc8)\xb5\xf2\xaa;\xda)\x9a\xb3\xc4\xe3\xf2\xd5gOQ\x97\x9c\x82\x06A\xf3\xc4P\
+\r\x9b\xe1\x89"\x1e]\xf8\xd7\x8f\xb0?\x1c\xa4w\xda\x8a\x1f\xad\x8f\xfb\xff\
+\xfb6D\x0b\xc0\x82\x14\xd8\xfaN"\xd2`\xeb\x9b\xd9\t\x0bf?\xb7\x854\x80\x1e\
+\xdc\x02\n\xdbX\x8a\x1aN\xf7s\xaaC\xd5\xc2^\xc2s\x0b6CG\x15\xf9\xd7\x1c\x19S\
+\xb2U\xb0\xd6\xbc$\x7f\xeb\x07\xe1\xb8\xdb\xd2\x0b\xc5K{\xce\'\xc0m\xb3\xc3\
+\xdf\xee66Ji\xfbc\xdd\xd5:\xbd\xe8\x12\x00S\xf2\xdc\x99o\x1d\x15U\x11\x8ek\
+\x97\n\x00\xcb2\x91\x16KAK\xcf]G%\x0c\xccl\xf9\xbf?\xd5i\xb6\xf8\xf3\xac\xa3\
+\x03l\xde\xd7O\xb5H\xf7\x01\xac\x91\xa0V\x9d\x02\xc0\x8d\xf1D\xc1>\x186\xf7i\
+\xed\x1fJt\xf7\xc7\xe2]p\xfa0~\xee\x10\xef\xd56\xa2\x90\xdf%\x02\x10x\x98m7\
+\x03 \xae#O\x162\xf4\x8d\xc7sw\x84B\xc9Y\xa3\xb0%t\xfa~\xe7\x93\x8b\x93\xb5\
+\xeak\xaf<o\xdc\xf8&\xbf\xba\xdbho6\x87\xfc>@\xb9\xcc\x14e\t\x8d\xcet\xff\\G\
+\xed&`\xfa\xaf~\x17lz\x85\xd2c\xbc\xcd\xc5^\x90.\xb6\xaf\x99\x19\x96|\x90\
+\x1d\x1b\xc2\xbeY\xf8 ~\xee{\xd2\xd8D\xd0\xdc\\H\x8a\xa8vG1{\x01g\x97\xb37\
+\xc5j\ng\xd9\xe6\xd6\x1dH\x1bI7\x97ViJ\xda\x92J\xb5^wA\xc3\x9f?I\xd4\xa2s\
+\xa6;\t\x03\xab\xe2\x1a\x80\x9d^U\x85\xd35T\x96\x18\xb70\x12\x94\x86\x10\x93\
+\xeaX\xde4`\xd3\xd4\xe5\x9eYrBIF\xc0\x8e\xab\xb9\xe9r\x02\xd0\xf0\xed\xb9\
+\xa1t\x8aM\x90\xee\xb6JBi\xeb\xf1\x9a\x0e\xf36k\xa9a/_\x1c\xb4\x8b\x87\xd4\
+\x92\xc4f\xb3\xcb\xb2\x19\xb6\x0b\x1265\x8d\x17P\x0bl\xb9\xa6"\x08\xef\xb7\
+\xb9}~B\x1bQ\xb0\xed@~K\x8a3\x08\xc7\xf9_L\xc8M>\xb6&\xb7\xc6\xb9%\x00\x99RT\
+\xb9\xc5\xdc->R~\x0fo{\x1d\xa9\x92K\x9b\xfa\xc7\xf1p\x16\'\xff\xba\x7f\x9a\
+\x0cO.\x92\xde\x85zF\rF:w\x8dq\xfc*\xe6\x08\xd6\x08\x9f"\xe9\xa4\xe5\xfc\xa5\
+]\x96ln\xe1\xa7\xc8\xc9\xf0\x0e\x0bvn\x99\xf7\xbb\xb7K\xcfTo-\xe3\xb4\x1a\
+\x0em++\xfb=\x1dKh\x11\xe9p\xc3)9\x8c5\xb5\xe0d\x93\x07\xae\x8f\xc3\x9aV\xbb\
+\xb0\xf9\xce\xe6\xca\x80f\xdb\x0f\xd8\x87\xea>\x07\x010\x84\xde\x07Qwg\xe1NZ\
+\xf5\x9dd{IZj\xb8\x80\x9c\x95\xfb\xfe\xfb\xeb\t\xcfV\xe6\x1f\xef\x00\x0cV\
+\xeb\xbb\xc5\n@\x18\x07\xea\x14\x94C\xbe.\x01d\xed\x16g\x8aFJ+R_\\H\x80\xbf?\
+V)\xa0\xf1\xeb:C\xa4\xed\xcc\x87\xfcugPz\xd2#\xd5\x01 \xb9S\xefsj\x92\x9e&\
+\x00B\xc2\xdc(\x8d\xc0\x87\xea\xc7<\xbcf\x8ep\x176\x83\xba{\xd3\xdbl\xda\x0e\
+\xef\x08us\xa5_X\xbfj\n\xbf7k@!\xf0\x0f/vp\x18\xdbP,\xab\xed\xa4U\xa9\xf6<\
+\xc5%\xdb\x8f\xdf\xd9\xe7t\xfc\x8e9\xb7\x9a\x149M\xffiU8\xdc>\x07\xd0&du]FLJ\
+\x8b"\xaa\xc7\x00t\xd6\xef\xa6*Q\xd1_|\xc6\x9d>:17\x90MK)\n\xc0j\xce\xc0\xa3\
+\xd5f\xfc@\xb649+\t\xffS\xe1D9k\xc1\xeb\xe2\xaa\x85\x11\xd7=\xa1&\xa44G?]\
+\x03\x94dN\xb5\x9aY\x8b\x1d\x85\xd2\xcd?\xaa\x85\xfa,\x1c& \xa5\xad\xc7k\xac\
+\x9a%\xa1\xc6\x91\xab\x0fOm\x016\x01,\x88\xf7O8\xc3\xad)\t\x8eS\xf3S\xc1z\
+\xb4\xd5c(\x95\xf7\xadoll\x8e\xc9\xad\x91\xd4\x002!\xda\x0c*\x9a\xb7\x86\x91\
+cKn\xe4\x98\x93\x96.J\x07Xp^\xdaU\xec&\xad\xb5\xfc\xa0\xb4\xf4%\xbd*\xd6\xe9\
+\xdc\xa2\x96\xdf4-_\xfc;\xe9=\x07\xd0i\xab,\xf9\x85,\xd9T\x94\x14i\xf6\xe0\
+\xec\xfd\xd3\x06\xa2\xa7]k\xb6=\xa0W1Gs\xfb\xb2\\\xe6\\\x9dW\x1bnDk\x19\x03\
+\xf8g\xad\xbf\x02\xf0\x08\x14\xd1\x16wr\xdd\x9c\xb8\xd48\x02C\xb4\x16`\xb90?\
+\x186\xb1\xed\xe9\x85\xddT\x8d\x8a\xcf\xfb\xd8\xce\x07\x8fm\xff\x9d[x\x00BC;\
+\xa4\xad\xd6*\xbaw\xd5\x00\x80j\xb0\xd9\x9b\xe6\xaa\xc3\x93\xb0\x9b\xeb\x87u\
+\xc2\xc2&\x96\n\x8a\x92\x9fe\xdc\xd8\xf2\xf8\xc6\xd8\x05\xe7\x05\x1a\xcdA\
+\xacu\x96\xb6\xa0\xfb\xbe\xa7\xfe\x03aSV8\x0c\x9b\xd4\xfd\x94\xb7\xf1p\xdfv\
+\n\xeb|\xe4(\xee\x80\xe4\xc6\xea4\xe9\x01\x01\xf9\x86\xf5(:H\xb0\xdf`ic\xcb\
+\x92\x03\x0c\x02\xc8!Y\xd9L\xee\x07\x02O\xb8@\xb4c\xab\xe8\xd8.lW\xa0B]\xe6\
+\xc0\xbb\x9b%5\xa2\x02\x90\xc9\x1d(\\5\xbd\x9a,Mp8\xa13JGL\xa3urr\xd2\xe9\
+\xbbA\x7f\'\xd3{\xac\x00\xd7\x0c\xdb\x8f\xc0&?^\xd3\x11\xd8\xdc\xdbk\xf1\x8b\
+\xfc\xed|`EG\xb5\xbc\x0f\xb3[#\x11\x0f\xca\xb5=\xcd\xb6\x13\r{(\xb7\'\x80\
+\xa1\xf1\xaf\x85dYw\x1b\xac\x9d\x00K\x0fex\r\x12glBPi\xf7@\x03\x1f\x00\xe7\
+\xf6*\xfb\xd2\x06v\xf4\xf4\x01\x80\xe8\xe0\xa9\x88\x00TuO\xde\x00\xed\xfd9\
+\x0c\x9a\xea\\\xb6`\xe9\xc2X@+<+\x17\xc5t\xf2\xa6_\xdc.\x17nj\x07\x83O\x86&J\
+\x1f\r\x1f\xb7\xceH\xa9\x13\xc7\xc1\xd5\x0c\xe1\xf9\xc1=i\xbe\xfb l\xfen\xcd\
+\x95\x07\x8d\x0f<4?\xd8\xb6\xa0\xa3\xf1z\x7f\x85\xa3V5\x9a"\xa3\xbe\xfc\xeb\
+\xa2{\xc2\x88\xa4"S\xff\xfd-voG!\x99a\x08\xe9\xd8\x8e\xd9.\xf2\xeb{\x1a\x1bc\
+Y\x9a\xe8\xd5\x8f\x9f\xec\xb4b\xed4\x11\xecZ\xadk\xeaQ\xe4aos\xdf\x9a\xcd\
+\x95x\x97>\x92\xa0\xe5\x8e\x1bY5\xe4>v\xc6b\x06\xdb\x97\xa7;\xd8\xc5\xb9\x93\
+\x0f\x0ck\x1emd\xda\xce\x03t\x1a^+\xb6\xaf\xaa\xf0\xb7M\xad}\xd5\x91P\x1a\
+\xc3~\xad\xca\xad\xdc^\xd3\r\x03\xe9j>Y\xcdN\xc6\x7f7Y\x1ams\xd6\x99JG\xd1\
+\xf03J2\x89\xd0=`\xd6\x8e\xe51\xf1\xa8f\x92\xf3ps\xe5\xa2\xdf\x0b\x04\xa4\
+\xdd~s\xdaho\xa2\x9eP\xc9\xec\xa89\xae:\x18\xa3\xdf\x1c\x1dH\x98\xb1\x05\xb0\
+\xe6D\xb8\xee[j\xf05ZZI\xd0\xaf\xbc\xdc\xf1\x9a\x87\xf3\xea\xa6\xde@\xe7}r9B\
+\xa1?\x88<k\xf6\xb0\xb3F\xd2&\xbf\x82`\xd1\xaa\x9a\x1ef\x0e\x10V\xd5t\xeb\
+\x8ah7\x12r\xdb\x17\x99\x86\xdb\xaf\x9b\n\x96\xda\x85\xb9\xd6\x8b\xefnM\xde1\
+\x9d\xe8dh\xa2\xb4=|\xdc:{\x04:\x1f\xc6\xf3\xd6p\xc6\xd6\xac\x16i\xdck\x1e49\
+ba\xc9\x8c-|=\xea\xff\x9f\xde&\x1f\x07\xb7\x1d\x00\xfc\xad\x01\xf6\xe0\xf6\
+\x7f\x17\xb8\xf6\x9b\xadf;-Q\xef\x83\xb1\xe2\xee\x9a\xd7\xd7\xfc\xda\xd8\xbb\
+9k\x9dv\xd6;\xda#\x9e\xc7.\xf6\x1eG\xfeh\x97\x90\xf06\xb1-\x9e\xb9o\x1f$\xa7\
+\xd9\xb4\xa0 \xbc/z\xdc$\xc6W\xdb~\xd7\xc1\xdd\x10\x8cm\xfe\xc5\x03\xe0\xb9\
+\x87\x81b\xebC\x14\xc5\x83kV[\\S\x00 \xb4\xdf\xf9\x94e\xb7\xa2\xd5\x1c\x93\
+\x97\xd5\xf4JB\xf5@\xcb_\'\'\'I\xc6\xaaSQ\x15\xa4\x98\xf7\xbfWl\xab4\xb6\x0f\
+\x9b\xb4V\xed\xd6 \x01y\xd8\xac\xc53\xfdN4P4\x88m\xae\x91\x84\xdcf\xd3\x82N;\
+\x80\x8d\x08\'\xd1\x02,H\x0b\xec\xde\x0b\xcc\x8eH\xed\x84\xf0\xa1\xc3H\xf9\
+\x83\xa5\x03\xc0\xaa\x0e\x9c\x0c\xe8i\xfc\x05\xb0\xc6\x11\xd8lT\xa5}\x9d\xba\
+\xf6T?\xc8\xeeWw\xa4\xca8z\x04\xc97\x92Wd\x12_t\xcb\x11\xad\x7f\x99H\x91|\
+\xb74*\xaa\xaf\xab\x15~P\x9d`\x06\x01\xcf\x81\xea\xa9n\xcb-\x13\x8b^=4\xa4A\
+\xda\x90\xda\x10m\x96<\xa8\x80\xf4\xde\xb0\xf9\x00\x06\xbe\xbf\x90\xfb\xbe\
+\x1f\xbb\x7fW\x1f,&\x1c\xf9\xde\x87\xbe\xe5\x9d_\xf4A\xb6\xd9\xd4!\xd0\x93\\\
+\x81\xad\xd6.\xbaw\xe3\t\xec,7[w\xf9\x06?1j\xce\x95{x\xff\x81Cs\xd2\xcb\x06\
+\xdd\x1d\xef\x07\x9bm\x1cu\xf0B\xf0\xfe\xc0\x8064\x82\xeef#\xd2~cQ\x85-\x84l\
+\x1f\x87\xbb\xa3R\x9f5ln\xfb\x1f\x0fY\xd3\xb7<\xf8u\xf4\xe0\x06\xe4N\xa1\xfb\
+\xe9z5\xeb\x00\xabb2\xe21\x1a\x94\xa7\n\x10\xf0\xa4\xb3\x8f\x047\xaa\xe3\x8d\
+\xff\xcdo:\xda\\\xb9\xf16\xb7as\x7f\xc77@\xfa\xf0\x9dr\xc4\xf7\xe8\x81Bt\xef\
+K\xf0\x8c\x1e\x91\x07[\xee\t\x1fi\xa3\xf3Y\xbf+\x7f\x0fN#\x02@{\xa3\xdc\xc4\
+\x18\xbd5\xadv$C\x0f\xf8\xc9\x9b\xf7Nd\x8dw\x18M\x00h\xeb\xe0\xcbF\xb5\x08x\
+\xdd;y\xdfYG\x0b\xaf\n"\xf1\xfb\xa4\xb5\x060\x8dJ\x00\xc3\xb2\xa5Z\xe9#G\x03\
+_\x8f\x82\xa3M"Bl\xff)\xf0\xfb\x81M\x1c\x81\xc7\xe6\xc2\x90"iN\xabl\xda\xbe\
+\x04q\xe0|\xfe\x1e\xedC\x93\x0cM\x98\xdd\xf9\t\x0fX\xe8\x85\xf4v\xc8\x11u\
+\x87\xb2\xac\xe2y\xee|u\xd3\xb6n\x87\x83\xb0\x19\xb5.\x16\xc0\x8e\xba\xfb1\
+\xfc\xdc\x9f\x90\x1e\xacYp\xdf\x19\xa1\xce{qw\x13WC\x03\x11\xb6\x01Y\xd8\x9e\
+M2\xe71^h\xd3\x02\xd6\xb5\xa9\xd5n|]\x13\x03\xf7)\xa6\x07K\xf6b\x15U1Es>0\
+\x0eI\x8c\xddJ\xcax\x9b\x19\'\xf7S\x00hL\x1az\x886\xa2:\xd8f\xb6o\xb6\xdc\
+\xd8\xd5#\xb0\xd9i\xebH\xcb\xa9\x17\xe7\x10\xf5\xef\xf0\x05\xf4\xfa\xb2\x08\
+\x0e\xe7Q\\\xadOI\xc0\xbd\xba\x8c\xfea^B\x13$\x85\xea)\xff\xf6i}\xd0\xcb\x9d\
+\x86\t\x9b5T\xb6\xb9##\x8c\xc3j\x0bj\xcd\xab\x9b8z\xe4\xabK\x8c\xe04\x02\x00\
+NP\x8f+\xda\xffQ\xd2\xd0\xb4\xc1m\x9ah\xaf\xe7\xbc\xd1\xf2\xd3M\x85\xba\x18\
+\xf6\x88\xfc\xf2\x01s\xb0ZI\xd9+\xccK\x92\xbf-\xfb\xb6\xd4\xe7\xb2K\x1f\x9c\
+\xdb\xfc\xed\xec\xc3\x12\x8f\xbf\xa7o\xdcO{>\xe0a\xbeg\xc6\x00\xef\x02\xde}\
+\x1ei\xd3\x84k\xa4\xa36\xd7\xd5\xdf#\x9b9j\xe1\xdb\xdf]\x12:h\x07YC\xfboEu\
+\x0c\xbe\xe0\x8a\x1ao\x1d\x13\x9dk~\xb6)\xf9\xfe>\xc0\xb8oM\x078xh;\x1ef\x13\
+N\xa9\x8e\x8eeI\x18W$?\xaeN~n\x86\x13\xad\xe8\x88\x04\xbd\xda\xe8\xdd5\xb1\
+\xa8I\xcel\xd6\xaa>\xd4\x1a\x04\xb2\x06lb\xf9\xeb0\x82-\xa5\xf6\x9a\x87mL\
+\xf7\xcbtD\xaa\xe9\x05I}|\xe31\x12P\x07\xda\xb2B\x8f7o\x85\xd0{UM\x1f!\xf5d\
+\xce0\xa8\x88\x9a\xe1\xfcIC\xbexB\xf5\x05-(\xdd\xfcvyq\xcc+#RR\x87:\xbc>5?r"\
+\xcd8b\x91\xeekV\xd2\x9dd\xc9y\x9f\x93&\xb2\x10\xd2\xfeI[>\xaa\x17n\x12\x92\
+\n\xef\x82\xe4=\xd6\xe7\xc3\xf8I+F\xdd\x1d\x7f\xef\x16\x00\x06j\xd7[\x96\x04\
+\xc4\xbbL\x03\xf6\xdd\xb9\xcd\x83\x98\xf3\xfe\xf6;\x96\x90\x1e\xd8&\x0e\x01\
+\xe3\xb1\xefj\xee\xc6\xc1\x95\x1f\xc83l\xd9~\x18\xbe\xe3I6\nLa\x99\xaa\x06:j\
++PCTd\x1c \xf4\xe0\xf7\xf0\x11\x87\x86`\xc3[\x0f\xe9m\xee\x90\x7f\xdeG\xc7c\
+\xdf\xda\x8d\xc3\xd6\xd4\x8e[pu\x106\x83\x03\xb9\x8f\xa5\xcd\xe0\xbd)\xd1\
+\x89\xed\xd0\xf5`\xb9\xaa\xe9\xb8\x06\xc0\xdc\n\xd5\xb9\x0c\xb1\xf6\x0eP+\
+\x15\r\x14\x00\xdc;8W\x85z\xfd\x01\xd8t+\xac\xe6\xa24\x02`ULB\xb3\xa4J\x91\
+\xa5H\t.\x85\xcb\xe1\xacGRw<\xc2<h[W\xdeQo\x13Z\xae\xc6P\xfen\xaa\x107\'\xb2\
+5\xb6kC\xd6qS\xfb\xa6\xba,\xbeQ^BOd\xf2\t\x00fl\xfb\xf5\x9a3\xb6\xc0\t0\xd9\
+\xd4D\xea*\x12Br\x8f\xdd\x1a\xc9\xbc}\x13\xe3\x11\xea\xe2\x0e\xea\xfc\xa7\
+\xd4t\x04\x1e\xc3x\xa3\xd9~XF\x90\x1f%_4c[\xb9\x99\xd4\xb2w4?\x01<\x89\xcfDC\
+\xe9.\xe2\xd7\xcb[\xe7\x96\x82\x81n\xa3\xce\xc1\xa8\xf9\xea\xb6\xb8\x93e\x93\
+\xc5\xfa\xa4\xd7\x1e\x94t\x19g}\xd5\xff\xa1\xeadU\x92\xea!\x18Ha\xaa\xe9\xf3\
+\xa4\xbc\x9b\xf3\xb7\xae\xa1\x06\xff\x81\xee\xcb\xefT\x12z_\xa8\xf9\x1d\xad\
+\x9a\xed\xec\xc6\x0e\x14\x7f02\xef\x01\x9d\x02\xb9j\x12\xfem\xae\x93E=\x19\
+\xd6\x06\xc0\xc0\x19\x8c\x19\xc6\xd4#\xdb\x02\xe9H^\x1bxA\xe3`\x99V\x1a\x19\
+\xb0\x99\x8c\t\xbf\xb7\x19#\xb7P\xa2\xf3\x19\x86\xbf7E\x92\x03\xbb\xa9\xb9D5\
+\x06\x18\x1d\x86\xcdv\xf7\xd3\xf5\x83\x07c\'\xa5\xd9t,\xf7U:\x1f\x90\xe8|@\
+\xe5xg\x85\x00\xa7\xa2\xf5\xe1\xb0\x0e\xd9\xcb\xfdX>|\xe4\xf0FE(~\xb3^\xcc\
+\xaaC\xb5K\xd9\x1c+L\nP^(\xde1\xdc\x18d\xd8\xa1\xd2\x80\xc4\xe0\x9b\xbdv\xec\
+V\x85\x9e\xbd\xf0\xbbT\x8f\x0c\xae\xba)\'\x17\x94\x92\x1a\x81\x1a\x8d\xf0\nP\
+\x04\x96\x06\xb4\xbc\xf6K\x15\x94\x83q~\x0f7"$\xf5\xde\xaaN"7\x8c\x90\xedwa\
+\xf3Q{\xd4\xef@S\xa7\x8ft\x06\xb3\x93\xc4R\t\xb9\x82\xb139\x08\x00\xa3MS\x9f\
+\xbc\xe4Z\xaf\x98\x0f\x93\x01\xfb\xf5\x05%\xfcC\x1f\xe6\xfb\xdb\xa7\x01\x1c\
+\xa2~\x1c\x11\x88kM\x1d\xe9\x97\t\xee\xd9d\xa7|\xbf\x86/\xd0\x0bSH\x83\xbd\
+\x86t\xe3\x10\xdfc\xbd\xb0s\xd1i\xef\xb4\x15\x00\xb5\xe0\n\x03\xd1D\xa2\xbe:\
+\xa9e\xdb\x07h\xabn\xf7I\xe7\xec\x8f\xf5\xe8R\xe1\xea\xed\xeds\xba\xbd\x0e\
+\x1e&\xfb\xe9\x183;\xd3`\x10\x0c[C\xfcj\xcd\x1f\xb5)\xed\x92L\x17\xba_\xf1G\
+\x96R\xa6K\xf2R\xe5w\xdc>\xa5u\xaaU\xd6K\x00\xe4\\\x18rw\xdc\x06p\xca\xeb;\
+\xb4ox\xf6\n\x0b[\xdc\x89\xc0f\xd8w\r\xa4\x11\x91J\xd9\x19ta\x1c\xff~*\xe9\
+\x1c\xc2\xc6\xf7Y\xfb\xfd\xec\xb7\x00\xc3-\xf6N\xed\xf5\x05wN\xa0F\x90\x8d\
+\xc7\xb7"\xcfNz[\xd9D+\xd4,J\x15\xdd\xcb`\x86\x11F\x17\xb8\x1c\xc3\x1a\xd8q=\
+\xce\xb2a\x9b\x87\x96\x05\xdc\xf8\xa6\x9f\xaa\xb5\xea\xa3\x9e\xc3n@)X\x8d\
+\x1e\xa1N\x89i\xa4\x004.Q\xcb#\xd7\x1b\xf1\xcdG\x06p\xe3I\xda8sV\xf7\x85u\
+\xaf\x1b\xdfuT\xa6\x98\xcbO\xde\xa7$\xe4\x7f3\x00\xa0\x7f\x84c\xf9[\xd8~\x85\
+\xe8\x01\x82\x93X\x80Sl\xd7h67\xe6\xfd\x14\x80\x9b\xbc$\x1e\xcb\xd0\x1fi<\
+\x0f\xc64JO>\xd6\x83\r\x8d\x85\x14\xd4\x08i\x86\xf4\x12\xd5\x1b\xd8\xef\xc0W\
+\xb0\xf7\xd3\xf6\xea6N.vvf^\\\xaf\x97\x06\xce.T\xc8_\x03\xce\x12\xf8uq\xd5O.\
+\xa5/~\xdd9\x13\x19O\xadDK\xccO\xc0\x94\x9e\xfa8\xb9p\xab\xe2du\xab\x97\x06\
+\xf0Ty\r\xd2\x00+\r\xe0\xbe\x9b\x028oiu\xd0\xdbT\x9d.\xad;\xc0\xa6$\r\xa0\
+\x8d-\x07l\xcb{d\r\xb2\xcc\xef\xcb7\x11\xd8\x9cm\xd3\x8a\xc3[\xf5\xf2\rf\xc2\
+W\'\x9c\xaf\xc2\xd7\x931!\xfed\xed\xb2\xee\x12\x81\x98\x83\xf3f\x99\xef\xb1\
+\xb6\xc5\xddd\xb1\xbe\x00\xbe3FW\xf3V\x14ge\x04i3O:\'\xbd\xf6\xa0M\x97qv\xa1\
+\x15\x00\x8fc\xb4~Z\x9d]\xe2\xac\x85\x1f\x95\xdd\xa9\xc5\xf3\xff\xc2\xd7\xbf\
+\xb9y\xfe\xad\xa3\x8bL\x87\x9b@n\x11k\xad\x8f\xec\xf6\xbc\xffI\x02\xe0\x17`/\
+\xd4\xa8\x17\xe9\x85\xa2Ti\xf9\xa0\x01Y"f\x83.\x88R\x10\x10\x83\x9d\x81sF\
+\xd3<\x8c\xf2s\x000p\xd0 h\x95\xae\xab\x0f\x87\xcd=\xdf/\xd8N:\xf1}\x11\xefC\
+(7\xef\xbf\xc1}\xb4\x94*6\xe7\xc5N/\xa4\x8e;\xea\x89\x0e\xb0&\x98f\xebk\xeb)\
+>\xbf\xc0%p\x01\\_\xe3\xea+<\x1b?\x7f\xc9y\xd1\xec\x00\x12\xad\xa4\xb6k/\x16\
+\x05\x9d\x1c\xae/\x02\xe0\xc9\xa2\xae\xf2A=\xd1\x82\xae[:j{\xa5\x86\xb9\x9bE\
+\x86-\x98\xdd\xaa\xed\xda\xbd\xe5\xa2;T\x00\xa0:UJG\x83\xf4\xb5j\x1dTww\xaej\
+\n\x177q\xf2 \x8b\xd2\x1f\xcf\xbdt\xe8\x0e\xef\xe8\x81|iX\xe1`\xd8~\x10N;\
+\xec\xb5\xa9\x00\x90c\xbb*NV\xb7<\xbd\x12AN\xd8\xbc\xd9\xf6Xv\x86\xe8?\xae\
+\x86\x17\x00t-\xb0y?\xbd\x06\x10\'\x17v\xd4\xba\xceZi\n\xe0\xa9}^V/\xbe\xeb\
+\xbe\xfa\xdbU\x94D\xcb\xf1]w\xd4\xaf\n4\x86_\xb4W\xf3n\xadT\\k\xc7a\xdd\x89\
+\x93\xfe\xe3b\xf6\x06\xf0\xa31\xca\xce\xb0\x00\xd0\x7fLJ\x03J\xa9\x8ct\xfajz\
+\xbd^\x9a\x80\x8a\xf5\xe1\xce\r\x9c\xaa;@\x97n\x1a\xe6\xeah\x95\x1d\r\xd2\
+\xb1:R\xe3\xa1\xed\x97\x9b{m\x8b\x94\x1e\x9c\xcc5\x0f{T\xaa!\x01p\x05/\xb8\
+\xd5F\x01\x06\x11\xf78\xddLZ\'\x19\xf8I\x07\x06\x12\x05c0\\`-\x02\x90p>rF\
+\xc8\xea\x9aYu[\x00\xd0\x85\xb6>\x82v\x04bs]\xb2\x85yY.s{\x87F\xdb\xe3-\xba?\
+\xaa\x96\x19\xb4\xeef@\xc3\x97\xef\x02\xce\xbd\x1a\xdb\x7f\xaf.\xbfH/\xc5\
+\x9f\xf8\xda\\}\xdd\xb5\xaf\xfa\xf9kk\x1d;E\n\xf0!\x9e\x83\x9fx\xfe\xa8l\xc5\
+I"\x02.\xb9\xb5\x0eP\x15z\xd0\x14\x157e\xe9\x08\xb9+\xc0\xd0h\xa5\x95R\x16\
+\x97:\x05\xa9\xf4\xa62\xed\x08\x04\x94H\xd7\x95\xee\xf9 \xe1\x9a\xdc\xd6\xdc\
+*\x05y\x04\xa6qO\xf7\xe2\xa32\xc5\xbb\xb0Y\xfbr\xc7\xc1\x90\xa5\x8b\x7f\xf3=\
+\xde\x96\xf5\xbb\xc1\xa8\xfe\xeb\x82\x08@c\xfd\x87\x9f\x9b\xe4\xc53=z\x93\
+\x02\xbb\x86\xfe\x7f\x98C\xd4,\xcd8\xa4\x95\xfb~2f3Ya\xde\x83\xe3B\x11P|\x07\
+\x00\xfc:=\xd1\x97\xf1\xba\xde\x86\xb4\xae\x03\x98\x19\xe7^\xcf~\xf9\xd9\xeb\
+sE#\x8c\x00\x8cA\x16\xc8\xc7\x91{\x1d\x01\r\xc5\xd6\xbb\xb9d\x81(\xe3a\xa2\
+\xba\x8f}\xe3\xd7\xbd\xe9/\x16\xc50jw\x87\x80:1n\xce\x93\x85\xd7\xa0\xd3\xd0\
+\x8a\x11w\xe8\xc4\x91Z\xf7\xd3\xcd%\x1b\xab~\x03\xba\xd5\xdc\xd5B\x03\xa6N|\
+\xab(\x1b}\x04\xbcK\xca\xa3i\xed\x07\x9d\xf7}\xfa\xe5\xbe=\x00\x9e\x07\'\xad\
+\x1f\xb4\xdd\xd0\xbb)\xdb\xab\xbc\xd3\xe4\x1c\xa8\xd1$\xe7V\x05f/\x9c3\n\xd0\
+ R\x1a\x00;\xdbrS\x00]5\\(\x9dBy\xe1~gQ\xeb\xc5\x15\xf7/\xcb\xc1\xc7\xa7\x9f\
+\xfc;{y\x06y \xe5%\xf2\xe7\xb9\xcb[n\x1a\x80q\xe5\xe6\x0e\x0e\xd0\x03\xd5au\
+\xdaRC\xad2\xeb\xf2\xb6\x9b\x96k\xc7m\xc5@W\r501\xdf\x0e\x80{\xb7\x12Ac\xc1[\
+\xc0\xcf\x01\xe9\xaa\xa1V\x99R\x99L<R\xd6O\xb6q.\x07`\xe0\xc8Y\x00Ze\xc8\x9e\
+\x02\x87\x84\xe3\x046\x1b\x04$\x9f\xab\x14\xb7s\x8f\xbaS\'\x1eY\xfc\xcf\xdd\
+\\\xb8J\x08\x80\x9d\xdaP\x97\xf1[ 0,\x9c\xc7\xc9\x9di\xec\x0fY-:\xe7{\xd2C\
+\xf1\xac[\x90-\x01\xbf\xbb\xaf\xb0\xf8\x88z\n`g\xcc\xc2O\xe3\x05\xf0\xb9\xd6\
+\x97i\xaa\x89\x8c\xb1\xd7\xc6HG\xcf\xbd\xf3c\x1a\x9a\xac\x92Ie\xaf\xa9\xd0\
+\xf3\xd6\xcf\xf9\x7f\xfc\t_\x8e\xb2l\x9c\xe7W0Wd,\xec5[W\xab?8r\x0e`\xc7\x9a\
+\xe9\x932A\x81s\x0c\xdf\x16S\x00\x93\xf9\x92\x05^\xad\'r\x01\x80\xc6\xa3\xd6\
+\x06]\xef\x81\x89\xb5\xce\xb9\x94U\x06\xfd\xb9\xcaR\xd2\x00\xacfI\xb6\xd9hn\
+\xe6\x0b\x0b\x9e\x17\xc5y2\xbcPiJ:\xd3\xfa\xb0L1i8\xfa\x95\xee\x9f#\n`\xb8\
+\x11o\xdf9;@\x9d\xc1\xf6\x19\x9f\xddC\xedO.\x96\xb2\xf32SR>e\xc15;\x90kAN\
+\xf7\xb0\xec\x12\xc3\x1e\x84VU_\x1c\x92\'t\xd5\xbaV\xd4L\xbd\xe6\xc6\xeb\x19\
+\xe6\xabo~\x16\x9f+\xa5qiqe\x01w\x95\xe7\x93\x19\xee\xe68\xf50\xd8\xeb%k\xb5\
+&\xd5\xa9L\x7fa\x98s\xce\xffh\xf1\xe5\xc8\x8d\xc0@:\x86\xb3Ps\xb7\x9e\x8c\
+\x99\'\x0b\xe9=\xe7\\$\x15\x894^\x9c\xb5\x00,\xba\xab\xde\xb25-\x1c\x1c\x03\
+\x1b\x814\xd1_\xea\xf5\x92\x81\x8aj\x05\x88\xce\xbdY.\x0c\xc3\x01\x8a\xb3\
+\xcb\xce\x97\xa3:\x00\x02\xc9\x19\x9f\xbb\x12\xe8D&\x82K\xaaQ\xe7\\\xa5\x02\
+\xe3GaS\xd4\xdd\xdf\xb3\x06D\x8d\xbf\xbbd\xcb\xdaE\x14\xe6O\xac\xa2~\x18T\
+\xc1\xa8\x0cfv\xcd\xdb\xb2!\x07\xb9L\xc7\xda\x91\x02\x8a6\x8b|\x0c\xa42\xd5X\
+\x119v\xab\xc2\xde\xfc-\xcc\x95\xb1\x16Z\xcf\xd2\xa7\x17\xe9\xe7\x00\xe0\xf2\
+\xc2\xbc\x88\xdc\xdd\xbd\x93R\x80\x1e\xa8\xce\x12\x88\xd5i\xa9\x86\x02z\xee~\
+\xfa\xe6\xbf\x0e\xd5\xa3\x7f>\xce\x9e\xfa/\xc8\x9f\xc7@\x0c\x18\xb8\xd2\xbc\
+\x9c\xbb;\xe7?\xae"\x15\xb3:\xed\xaa\xa1\\\x08\x89\x9b\xce\xfd[\xdeD\xc4\xb8\
+\xab\xbc\x9c\xe6\xd2M\x01\xb4\x81r\xed\x00\xe8\xb6b5\x84\xca\xb8\x1e\x89.\
+\xdefs\x0b#u\x01\x9d\xda\xac\x05l+ 5G\xb0\xb9\xf6\r*\xa8\x87\xdd\xbfm\xf3\
+\x10J\x006s.\xc0\x90r\x12\xb3\x03cDgO[\xad\xa7:S\x99r\xb9\xfb\x9b\xc5\xf8\
+\x9f\x9c\x1b\xcf\xee\xb0\xc0i\xff\xd1\x16g\x9e\xb6\xef?\xb6\xa8s\xaaB\xbf\
+\xd9\x1d\r\x0c\x08IR\x04\xdb\x15\xd5\x93y\x15";\xb9\xd2f\x0c\xf3\x92\x96\xb9\
+\xb9\x83\x85\xcb\xa3\x9f&\xfa<\x19Z\xc5\xcfm\x9e\xb3\xb3\xcei\xa52!\x11\xb1J\
+\xa5\xd8\x06\x18rj\x8e\'.\xfb\xc8\xe8\x0bRv17\x14\x01H\xd7\x95iGV\xd9yYLx)\
+\xf0\xab\x99N\xca.\n\x9c\'C\x00o\xcb\xe9\x8cJ\xe3\x1c\x00\xa5\x94\x02\xfae\
+\x0b@\x1c\xea\xfe\n\xf3\xa2\x00\x80\x08\xb3\xb2\x04\xa3_\xb4\xce1L\xa3^\xfa\
+\xe8\xd4\xdc\xdc]QG\x82\xf4\x01\xa0\xb5\x7f\x8f:\xed\x00\x00\x11\xaaIDAT\x06\
+p\x01\x95\x92\xceX\xe7\xd6ny\x9b\xe3\x8bvgT\xb5\xd36\xe9\x9b\xda\xdbT\xefr\
+\xff\x9a\xd6<\xcda\x16\x06\x08\x04H\x06\x06\x84\xe9\x05\xd2\x146\xc3\x08@\
+\x0e\xfb\x1c\xce`\x06\x800P\xd0G\xca\xe3~\xe3\xf5\\\xe0\xe5\xf6\x1b\xbe\x98\
+\xe2#o\x10\xe0\xc5\x1e\x08c\x8dK\xe0\x1c\x80\xc5U\t\xf3\xe6/\xa7\xf6k\xf3\
+\x82\xd7WO[\xa3?:\x01:\xf93L~\xb3\x9e\xdf\xac\xf5\x05\x94\x92k\xc6!Hb\xfa\
+\x9b\xca\xa8\xcb\xa8\x9fn;~\x00\xd0\x01N\xe0V\xf9\xd8p\xce\x00\x93\xe6\xe1\
+\x99\xee\x0e\xe5Q\x1a/\xcc\xc4\xe6\xeb\xf5\x9d\xeb\x9f\x824\xa0h\x98\xa8\xee\
+\xd0\x93\xfb\xaa\x94"\xd3\x01\xb0|s?\xbd-\xac]k\xdd\xce.\x13u\x99j(\x8bx\xee\
+f\x931\x03 \xd5\xd1XT)\x9d{R\xaf\x03\xe80l\xb6\x8f\x13\x90\xf6\xdb\x1e\xc3\
+\xf2`\xcd\xd8\xb9\xd9M)\x9d;.\x8d\xac\xc6\xc5\x17\x00@\xe3?\x8a\x9eC\x8fW\
+\x93"\xd7I\xd6\xce:a4\xdbAkc\xa3\xe3!F5\xe1\x87\x1aK\x14\x90\xaa]^\xba\xf8\
+\x8a\x8f\x9f\xff\x05\xcc\x1b\xb6W\xf8\xe5\x05\xff\xe5\xe7Ze\x89ya\xc6\xff\
+\xa0\x00\xa5\xd2\x8e\x8a\x9b\x1f\x89\xd5\xe9\xd4\xbc\x94\x85-u\xbaV\x9b\xb4\
+\xa7 \x1e\x80\xae\x1a.\xdd4\x01\xa6\xe6%\x00c\xafY_\x0c\xd3\x8f\xbbj\xd8vS6/\
+\xd9\x19H\xf6D\xa5\x1d\x15\xdf\x03\xb1:\x15\xc7R\xb6`]nfo\xca\xfb[\xf1t#uz\
+\x92\xfe@\xa5\x9f\xc3\xe51\xb0\xae\xab\xb5rD\xad\xb8\xa3\xf2K\x83\xb7\x19/?\
+\x16\x02\x92\xee\xf4\x15\x81x\xc3\xdbl\xfe\x9e\x05m\xdd\x10\xfb\xf4gO\xcb$\
+\xee\x81\x02\x066\xd9\x9e\x9fE\xea\xb4\xa4?u\x9f\x030<\xfeo\x9d\xfck|\x7f\
+\xd3bj\xabO\xf8\xd1\xbb\xb3j\xb4%\x1fwon\x06hk"NZT\x94\n\xb8 \xf5\xf4\xd1\
+\x19\x00\xbe\xb9\x05pe6IT\xb6\xce\x9e\xce\xaf\xd5l^\x14\x9c\\\x7f\x84_\xa6Q\
+\xef\x9b\xf2\xedD/%\xf8=\xe9n\x0b\xb0\x97\x98\xd0R\x8e\x83\xe0a\x9cx\xc4\x9b\
+\x97\x9e\xcb\x14#\x91\xd7\xdfS\x91;\xa7\x14i\xfaJ|N\xbf\x90\x1c\x1c+\xa54\
+\x91f:I\xba(\xf1\x93x\xd3\xcdl\xb0x\x1bM\xbf\xa7\xc2:v`\xcdjdU\x06\xdd\x94j\
+\x15t\x8d\x93\x04\x0e\xdaQ\x1a\xf7\xf0\xfe\x95\xf4}6\xfb\x0e\x0b\xe8\x98\x8b\
+\xb8_\xcf\xd3\xd0)\xe8\x12\x19a\xc4\x18?\xc3\xb3\x1c\xe40\x06\x10\xdad\xb0\
+\xcdi\xf4:ip\xbc\xd1x\xa7\xfa-\xa5`\x14\xb20\xabW#\xd3\xe0\x11F\xa1N\xdd\xac\
+\xdah\xa4\x16Fr\x86\xcb7\xf7\x00\xa6\xa2\xdb6_!\xee\x0c\xa3\xf6\xa2\xdb\x03\
+\xd0[.\xa6\x85\xe3\x9c\xfd\x93\xd7\xc3\xdd\xe6\xb9\x90Of\xc3\xa8\r@\xd6_\x98\
+\x89\xbd\xb6l\x98RRJ\tB\xc2\xb1\xcd\xddz\xben\xc7m\xf9\xab\x94\xa2\x8c\xb2\
+\xcb\xf3l\xf4\x03\x00aO\xe0V\xf9d\xc6\xbf\x99\xcf\xeef\xf7\x9dv\xaa;Z\xb7\
+\xa1(\x1b\xa5\xde)u+\x00\xf7\xae\x1a\x88\x16\xa1\x94\x82\x8f\xc1\xe6\xa2\xd1\
+\x1a\xf3\x80\x14R\x80\xd0\xfd\x15\xf6\x03m\xf1\x0cW\x1a.\x85\x1dA\x03l\x80\
+\xfc?(\x072+\x00\x94v\x02\xe9\x91\x1aD\xa0\x15\x10S\xd4\x84Gy\xbe\xb1\x82\
+\xd2\xc84\x008\x0b\xca\xe1\xee\xa7\x06\xe0N\xa2G-\x00\xd6\xb5\xb4e\xc3\x98\
+\x17\xd7qr!\xc3H\x945p\xf9\xady15/\x1d\x9c\x82\xea\xa8X\xfc@\xae\xeb\xf2\x0c\
+\xb0yi\x9d\x11\xac\x8b\xd5\xe90\xfd\x91\xec\x8cu\xf9\xd2M#w\xc7\xea\x14@\xac\
+\x86\x00\x04!\xad\xbdf\xd2\x96\xad\xd6\x17\x02\xb6\xca\xcd\xe5+\xc2A\x88T\
+\xacF\xffJ\xa2l\r \x7f.\xd1\xb7\xb8\xa6\x95y\xa5\x01\x06\xa2\xf4#\x00\x85:\
+\xed6\xb0:\x06\x9c\xd2\x00$Z\xdf\n\xd2\xc5\xdb\xf4\xb0Y\xdfIM\xd8\xf4\xbd9\
+\xe0@\x86\xf4\x0c\xf6\x83`\xb7\xbd,.\xa7\x0e\t\x00\xb5,\x9e,\xce\xfe\xd8\x8d\
+Rb\xb3\x9a\xfe\x8d\x9b|\xebf\xf7X\x008/\x85\xd5S\xdf\xc4\x8cJyi#\x94\xa8\t?\
+\x1a\xce\x88\x0c\x11\x97\xad\xcf]\xf7i\xff,\x8bZ|\xa1M\x7f\xfa\xfc\xe6\xf6\
+\xda\xb8\xdc\xe4Y\x9ei\xf0\x05\x01\x04\x0b6C\n\xb5M\x86\xbbv\xe6\x8a\xcd5K\
+\xc2\x82RR\xfd\xb25+KvL\x8a\xfa\xad\x16\x00\x0c1\xa1%\x80\x93n\xf7\\\r\xd3\
+\xc8\x97\x0b\x0c\x16o\xcb)\xba@\x89\xf3d(\x08\x86\x18\xdf\x94o\xbf\xa7BPZ[\
+\xba\xa4\xf4$\xe9\x8a#\xaaA\'I\x17\xc0\xa4X\x9et\xbb?\x89\xfeZ\xdb8M5\x80\
+\xeb\xe8\xad\x0f\xc0\xcb\xe2\x86J\xa3\x1d\x00\x05\xa4\xa4\xfa\xad\x16J\x08\
+\xfcJD\x0f\xad\xc4\xe3\x95\xdc\xdcV\x90^{\x9bL\x9azj\xd8QS\x00\x0c\xda\x86\
+\xbe\x90%[\xee,<\xd8(\x14\\AU\xcfw\xd08S0\x7f\x05\x9dB\x1bt\xc7XX\xf8\xe7\
+\x92\xaa\xe4\x84O\x04\xae\xeblW\x024\xa9\xe36\\\x17\n\xad_"%\xbc\xbc\xc0\x17\
+#h \x1d\xe3\xcc\xc0^\x01v\xfc\xeb\xfd\x9aK\x9d3ts\xd7\xb1W\xfd\x85\xe1:v\x96\
+\xb4\xa1\xbc\x86GH\xd5\x81[y\xa4R\x11\xb0\x94\x7f\x01\xf4\x96-\x00\xdd\xc7\
+\x83*\xa5X\xc5\xb2\xd9\xb7\xae\\\xfd\xaa\xf5\xdd_[g\x17J\xd3\xf5S\x1e\x9e\
+\xa9i\x01\x80\x86\x89\xea>\x1e\x00\x10\xa0\xfe\x9f\xb8\xe9>\x1eT\xa9O\xa2F&\
+\x82\xc3\xbd\x8b{\xcb\xc5\xb4\xa8\xbd\xdc\xe6h\xe0\xb8\xd3\xebU\x834\xaa\xd2\
+u\xac\x00\xc4s7\xc3\xb1J\xba\xf4\xa4\xaf\x8f\x97\xb0qx0z\xb4\xe2=\x12\xb8\
+\x02\xbbM\x9d\x96\xe4\xc0+\xf0\x08\x16\x18[p\x0e\xbe\x9f\xaeW3\x00\xd4\xa9\
+\xf3\xe0\x9d\x18@\xd0j\xdb\xd3\x14\x0c\xf7\x10,@)\x19Ur\xd6JS<I\xc0/q\x99\
+\x97\xdf\xbc\xf8n6\xbd.fo\\\xffqox\x01\xe0\xbc\xe5\xab\xb3\nP@\xecr\xeb\xf2\
+\xdb\xd9\x9b\xedYi\x00 \xf9I\x7f\xdc\x1aO\x84\xa5\x9b\x06P\xed\xaa\xa1x}!\
+\x15yjMn\x9e\xe1\xeaK\xc5\x16@\x94\xfd\x84\xd5\xa9\xb87-5d@\xabL\x01\xb7\xe6\
+\x85D\xeea\xcc\xa5X\x1b`\xa0\\\xbb\xf6j\xbe\xee\xc4\xcd\xbdZw\xe2v[q\xed\xa0\
+\x1a8a\xb3\x1d\xe8I\xc7\xaa\xdb\xa3\x93S\xb4\x0e{\x9b\xcc[@\n\xefUf\xa4\xb8\
+\xbc\x9d\xd30\xdaJ\x90YU\xcf\x0ek\x9cM\xf4\xd1\xc7\x18?L;\xc6\xb9kvy\x87\xf3\
+\x85]\xad\xdd\xa0$\'\'w\xc1\x95\x1e\x0c\\\x1bu\xd0\x8df\x14Ip\x009\x03\xe0\
+\xda1,4\xf0\xb3\\\xff\xfc\xe9S\x9d\xa5H\x81\x14\xff=\xff\xe5\xff\x9a^\xff\
+\xfd\xfcMV%O\xa1/b\x7fY\xe8^LZ\x898\xb0\xb9\xb9\xfb\xa6x\x1b\x90-l^\x1c\xcb\
+\xa6y\xd4Rh\xba\x7f\xe7\x18\xa6q\x0f\x0bh\xc4i\xaa\r\xec\xff)\xbe\xbb\xd4En\
+\xac\x05_\xf2W\x9f\x94\xde5=\xc7\x10\x80\x00\xef7\xe5\xdb\t/\xc7\xcei\xa6\
+\xa6\xc4\x7f\xaa$\x90\x85c\xef\xabiP\xc0\xf0X%\x1a\x04\xe7w@>\xf8`s\xe5!\xe1\
+\xb8\x87\xfb\n\xd5\xa1\x87\xdf~\xb3\xcc\xcej\x81\x88\x98o\x93\x1eu\xff\\X@\
+\xd8\x82_j~\xca\x8doD\xca2\x1d\xe9\xd1\xe5\xa8.|\xe3\x19\xc6\xcf\xf1\xd5\xf5\
+\x9f\xfd\xbd\xb1\xabt\xa4\xd2\xcb\xf4d4\x88U}\n\xeb\x9a\x8b\x1bO\xf2\xab\xb7\
+\x9c3\x00\xfa\x838;\xe9\x03\xf0\xd9N\xf8\xc4\xf30Q\xa8\xbdJ\x00M\x7f\x0f@\
+\x95R\xac\xfas7\x8b\xc6s\xf1\x18\x9d\xf3\x1e\xa6\xce\xd4\xf0L\x0b`\xca\x9a\
+\x00\xa2\xf1<\xbf\xca\'\xbf\x99U\x8b\n\xc0\xc6;\x05\xd8n\xd1\x0f)\xdb\xf26\
+\x05\xb1\x17\x8b"\xa4F\x8f6WJIh\xd5p)\x1f.\xd3H\xd7\xcc\xfe*\x1a\xd8\x95\xaa\
+\x17\xb8[\x15\x00tG\x9egp\xab\xa2\xbd\xba}\x04\xdcL\xaf\xc2j\xa4R\xee\xff\
+\xc8\xe3\xad\xac\xa9\xea0\xd3\xb1|\xe4\xf5\xf8/\xdbK\x18kA\x9aFOy\xf4s;j\xe9\
+\xacE\x8c\xec\xab?\xbd\xbe\xfa3mr(\xd5M\x7f\xb4H?\x8e\xa1\x04\xeb\x18 \x9d*k\
+\x8c\xbbN\xccK\x89\xc4cu\xcaj\x88:\'\x19`M\xbeq#\x91\xa7\x86\x00\xa4\xe8#K\
+\xe4\xda\x94P}\xee\xeeP{\x98\x92\xeal\xd5\xeb\xfb\x95]\x1e\x99o+\xf3J\x12~L\
+\x1a*\x8dT\x0c\xc0\xb9\x15`\xd99\xa7\xd4@\x9d\xca\xfe\xb0\xd2\xe4\xec\xd2M\
+\xe7k\xd7^\xcd\xcb\x1aB\x81m\x99\xe2fn\x93j&\xfb\x06$i\x173\xd1\x94[g/\x14,\
+\x15\x99`"\x12\x0bl\x80\xae)G\x99\x86\'g\x04\x19\xcc\xf0\x0c9\x00\xe3(U\x0c\
+\x07M\xa9\xae\xd7$\x95\x86\x11\xea\xc2\xd81%?k\xd9\xef\xec\xf7\x83E\x81\x05Z\
+\xd7\x89\xb6\xbd\x7f;\xf9\xe4g\xfc\xc3Q\x96}\xa9\x9f_\xd0\xb3\xe7\xba\xd0h\
+\xfd\xb8L~\x12\x9d\xa7\x8f6\x8f\x19\xb6\xce.\xe6\xc6-\xde\x96\xd3\t-O\xba]\
+\x94\x10$\xbc\xc6l^\x16\xe2\xdb\xc6I\xe2\xd3\x8f\xb5\t\x06J\xbaX\xea>~5\t\
+\xdb\xbb\xd8x\x98\xdd\xae\x87\xbb\x1a3\x01\x08P\x8f\xc9\xc9\x08`E>x\x070f\
+\x07\xc0\x11+\xa6\x11\xab\x93\xb2{\x8e\xa1@\xe5\xbc,n\xaa\xd2\xb1\x13\xc7XP}\
+\xe3m\x9a\x0b5\xbehwGq\xef\xb4[\xf5o\x9a\xb0\x19$\x85\x19\xeeX\xaasG63@\xe5v\
+\xd0-S&7\t\xe5\xb5P\x80\x1a\x02\x8an\x1c\x01`\xe7\x00\x90\xeaX\xcdOh-4H\xedI\
+Ar\t\xe7R\x1f\xff\xfe\xba0\xcf*7^\x93V\xc0\xeaWX\xfd\xe6g\xf6\x87\x9f\xbb\
+\x11x\x0c\x95\x8fO\xf3\xd7Q\xaf\x97\xbc\xbdL~\xad>\xda\xd9e\x0b\xcc]\x19\x8d\
+\x93|Ra\xbe\xec\xa5\'\x83T\xbcJ,\xa7\x81U\xec\x80\x16\x80\xa9\x887\xc4\x9d^o\
+5H\xbb\xe27\x02\xad\xe0\x97\x02\xc9r\xea\xf9\xd0\xd3\xc2\x05\x97\xd5\xa3\xa5\
+Y\x02\x80[-\xa7\xadi\x018b\xab\xb1I\xbf3\x00\xb6$\\\n\x00\xcf5\xe3\xb4\x93\
+\x9d\xf8\xa3\xbd\x9c\xb6\xa6\xc5R\xcaF\xb2\x1b\xc3\xa8\xbd5\x82m\xa7\'=\x08\
+\x0b+DKT\x15o8\xe7!d\x0e\xb6sJ\xe5_\xed6\xde\x0b\xd5\xe3~f\xd3k\x00\xbd\xe1\
+\xc5\xba\xa1\xd9+\xfcp\x00\xb4\x14\xf6\xff\x86\xb2\xb8PZ\xde\x15\xde\xf8H\
+\x95\x9c\xb6\xc8\x94\xd7\xe3\xd2\x9a\xafy\xfc\x952\xb9c\x9b\xea\x0c\x00\xdb\
+\xfc\xe6\xcf.\xe3\xd1SN?\x07\xa0\\.\xed\x01\xa7\xeaB|B\xb6\x86t\n@g-\xe4\xa5\
+\xb2&7\xcf\x92:Q)p\x14\xf2\x96M\x8b\x1a."\xab!\xd7\xeb\xb4\x1aA\xb4\x9cp\xc1\
+\xcfV\xd3\x1d\x05\x9c\xcb\x05f\xd9MeS;\xbd\xd2+7G\xed\x94\x85\x14kQC\xf7\xdc\
+\xddE\xf5j\xf2\xee\xfd\xc1 ]`S\xce\x00\xd1b\x13\x80\x13f\xdc\x96\xa1i!\xe2\
+\x0e\xa6\xd9\xfa\x8a{}\xbe4\x11\x1a\x9d\xea\xec\x0c\x16\xce\x80\xe60\x00\x06\
+S\xc8\x1e\xc8\xd3\x9c)M\xeb\x1eL\x83\x06Y\x11\x9e\x14\x14\xeb4\xa3\xec\x8b4\
+\xfd\\i\x9d\xa5\x16\xe6\xcb\xfc\xf9\x9f\xbb\xeb\xd2\xbe\x9e\xaf\x8b\x8fUrF\
+\x11\x80[U\x9d\xf1\x97\x99M\x9fB\x0b^y\xf7\x8ctzS\x010\xed\xe8\xc2\xaa\xa7\
+\x17\xa3Q*\xbd"\xf8\xc5W_?3\xb9\xc7F\xc9^\x86J\r0+\xeb\xc6vf\x88#\n\x84\xa2\
+\x8fT\xb7\x11\xdc\xd1\x06\x90\xa2\xf0\tL\x8d\x18R\r\xc7\xc2\xbf\xdb\x85$\x04\
+\x00\x90"\x00\xec\xd8\x12\x0b\'q\xa4TH\xb1\xce\xb8\x04`\x1a}`\x96\xbd\xcb\
+\xa8\x15\x1d\x1e\xc1VO\xae\xdc\xf56\x03?\x8c\xe0|\xc1\xba\xbe\xe5\x02\xf3\'\
+\x8cx\x10\xe6\xe46\x11\x88+\xf7\xbd\x8c\xa5h\xbb6\x00\xa9Y\xcb\xcf\x16x\t63\
+\x0e\xf0\xb2\n!\xdc\xd6H/\xf0\x05\x00\x03{\x85\xab\xab/\x7fi\xae,\x80T\xd7\
+\xd7\xb1[Au\xa0\xdb\xfa\xd4\xbb\x8e\x02e\x92\x96\\N]w\xa8\xaaQ|\xae>\x19a$\
+\xad:c\x8c\xdf\xba\xefW\xbf\xf2U\xd3\xe0U\x86\xf4\xa6\xdfp\rh\x94\xd5Aw\x9do\
+\xec-\x17\xf2\xc1\x81\x8a\x96S7\xad\xd6\x98\xaf\x046\xabQ\x1c\\\\7\x9e,\xdf\
+\xdcO\xc3\xb8\xb0m?.\x88\x0f\xc8\xf6!I\xd7z\xd8\xbawD\xddj=_\x8b\x9b\x1a\xf5\
+\xa2-o\xb39\xb9\xb2j\x0c_\x08&\xb0)\x98I{,[\xf9K\xb5H\xaf\xeb\xc4\x1a[\xfe\
+\xa7\xefmY\x1a\xd4\xe4\x1fI\x0c:\xa5\xa9\xa6\xfdPM\xa7\x14\xe4\x94\xed\x0brr\
+raS2\xaa\x1c\xbb\x16\x1b\xfe\xf5\x8b\xff|\x7f\xfb\'\xc6<\xd7*E\x8d\x99\x06\
+\xc8t\x06\xe8r0,\x1at\xca0\x87W\xb7UW\r\xad\xca\xaeUF5\x90\xc6.\x9f\x9b\xba\
+\xc1\xa7\xf1\x8b"w\x077\xb7\xce\xc8\xa1\xb5\x00\xe9l\xa0NY\x9d\xca\xef\nEs\
+\x89\xdf\xe5n\x15T\x0c\xa5\x1f\xd4~&\xbb\xfc\xde|\xbb\xc3\x85\r0\x18P4V\xa7\
+\xdc\xc0\xc9\xfaL\xcf\x01\xc7\xce\xf9=\x91\xdc\xe6Y5\xc9:\x8b\xa4\xc1\xdb|\
+\xb4\xa4N\xfa\x83p%\x04\xf72.\xa7\xe8\xc2-\x93\xe0X\xee\x98e\xde@%A\xeaX\xbe\
+\xabE\xac+\xc4.\x00\xee\x95\xdalb\xd0x|\xeaz\xe4\x19t\xed\x03Yg\x1dk\xd2`\
+\x95Z\x9dZ\xber\xee\xd9\xd5\xd5\x8b\xd9,\x99\xdb\xa4\x87GQ\x0b3\xc4\xbdd\x1e\
+\x15\xa7\x00f\xf8\xa4\xd7\xf9it\xe6S\xa1\x11\xd0\xc5\x8c\xcb~\xab\x85\x08\
+\x13\xbb\x84\x85d\x1a7\x99\xc9\x08\xdf\x94\x9b\xa1\x88\xc1&\xbc\xb4\xc4\xd0^\
+\xd8\xdb\x81\x15\x93f\xd2\xd6\xe7*\x0fj\t\x07o\x93\x98\xfaE+\xac3+K\xe6F\xee\
+TR\x9d\xc3\xee\xa4\xf0\x89F\xbf\xcd\x12\x93by\x92tge\x19\x00\xd3\x11\xd8q\
+\x9d\xa0\x82\x136\xd3\xfd\xbf\xe8\x14g\xdc\xbd4\xfab\xd5M\x7f\xfa\xf2\xe2\
+\xa43@\xf7Q\x0b\x186a\x93\xe0\xb0y\xc8\x1dv,\x01\x12I^lbj\xa1\xa46?\xa6\x00\
+\xcc\xdd:\\j\x8d\xaa\xf4\x0er\x06\t\x99Nd\xa2*]\xaf\x154\xfc\x1d`\xfe.\xba\
+\xfd\xc7\x15\xe5U\xbe.\x97\xedJ)\xba\xc3\xdc\xb95x\xadto5R\xd7\x7fPI\xc9f\
+\x03>qg\x18\xb5\xa7\xfeP.\x01 \x9e\x0c\xa3v\x8d\xa8\x07\xb5\xca\x94G9\x7f\
+\xc5\xd7u(\xcd\xf20\x1f6ZU\x16\xdd\x9e \xad\xa0\x9cT&B\xf4\xbd9\\\x9a\xa5\
+\xc0T\xaf\xb9\xa9:m\xa5\x8b\xe3\n\xf3\x1dY-b\x0b\xca<a\x8d-(\xfa\xfe\xb3rz\
+\xa9\xed%_s\xa7s\xb9\xd6i{p\xbeh]\xb4\xeb ]\xca\xe2TS\xdf\xb7\x9cL\xe9\x01\
+\xf4G8\x06 -\x81\x01-%\x8e\x0e^\xa5p\xb9\x07K\x17\xfb\x7f\xd5`\xe9\xa4 "-0\
+\x81<\x99n\xd3\xb5\x03\tG\xfc\xd2\xf5\xd2\x947/\xd2\xfb\x97\xec\x9cf\x1bVuR+\
+Q\xda\xe9K\xa1P\xa2\x061A\'I6\xce\xeb%\x0e\x8e\x1b\xf5 \xd4o\xf9\xa3\xa7NQ_\
+\xb0sw\xb7\'\xa4\xe3\xf1-X; -\x00\xcf\xe4D}\xd0\xea\xb1|*e@\xea\xe9Q\xedaF\
+\x8d\x1d\x08\x16H\xa1\xcd\x9d\x11\x0bE"\xfa\xe1\xf07Z\xcfN\xe9\x05\xb7\x07\
+\x8f\xfb\xdfBu{\xd5\xc9\x00\xf1&H\x87\x17\x84\xf6\xa5\x99.\xa8(Q\xb7\xdeD\
+\x0bOu\xac:\x03\x00\x83N;m\\ff\xc1\x00\xe65l~D:]W\xa8\xb1\xdc\x94\x11\x08\
+\xd6\xd6\\\x9fz\xcc\xa7\xcf\xf8i\x15\x98\xdeBn\x84\xf0p\x1cYp^YC.\xd7\xe5\
+\xad\xab\xc2\xbcr\xeb\x1c\x144H\xd3W\x19\x131\x010\xec\xa4B\xad,i\xa6O\x92\
+\x04]L\x8a\xe5\x98\x9d\xf8 \x12\x0e\xcb\x16&\xdc\xb8\xf6-\x10\xa0\xac\x0b\
+\x00\x01\xdf\xfc\xf2\x12\xe7\xc9p\xe3^\xfaC\xeb\xb7\x13\xb2\xa0V\xe0N\x8c\
+\xa1\x95\x0f\xc9\x01\x8c\xd9}v6\x04\xf0\x93S_X7\xf3\xc5\xdbb\xea3\x03\x8d\
+\xaa~\x08\xf6\x01x\xa8\x07\xa2O\xff\xd3\xbf\xe9\xa5?\xeed7\xc8z\xb1\xfe\\\
+\xca\xe8\x00\xe8d\rl:w\x0e\x0e\x88\xdc\x19$!\xa3"v\xfa\xa6\xdd\xf8F\x9ahHu\
+\xd4\xe8Qh\xc3A\xdd\x893w3\xf1?\xfd\x9e\x81B`\x0b\x01\xd5:\xad\'\xae\xa9,\
+\xafL\xb90\x13\xceyv7\x03\xd0>U\x00\xe0Vl\x18@\xd4\x8b\xfa\xa7\xb5\x8f\xe7\
+\x9cxhQ/\x92|\xa3?\x8c\xd6;\x90g\x9f\xfa\xf4c~\xf5\xd6^\xdbP\xf2\xf6?v\x83i\
+\x1b\x0bh\xd9\x1d\xaa:0\xdfX\x8d\xb4{I\xc1\xbd\xac\xb0sN_h\xf1]\xab\x94jB\
+\xfb\xaa\x8e\xfa\xe5\xab7\x8e\xb4x\xb6!\xf6\xa7\xf8W\xff\xb1J\xb8\xd3\xb9\
+\x0c\xa3~\xd1\xbahSKQ\xe4P\xa1Ni\xce\x81\x98$\xf7!=\x83+\x00\xb4\xdd\xd9\xad\
+\xe4\x9eR\xc4\x009^\x15\xd7\xeb\xa5y}\xfbU?\xb9\x14\x92y\xa6.H\xa7:\xab\x9f.\
+yi\xf3\xe7\x8bF\x17\x8c\xe4oX\xe9\x91\xba@\x1d\xd8.\xddt\xe9\xee\x84\x1c\x1e\
+\x10Cj\xd9\xd6\xbc\xb2v\xac\x95f\xd2\xa4\x948c\xe2\x89Uj;\xa5N\xba\x02\xa0\
+\x94qN\xd7\xc3\xb8\x140L?\x1e\xa6?\xd2\xd9S\xb6\xa6\x18\xff\xb5\x19\xff\x83\
+\xb5c\x00Z\xe9P\roZ(\xb8\xfb\xf3\xb1\xfdn #\xed\xc3\xaf\xd8\xdc\xdd\tT\x86\
+\x1d`\xe0^\xc5\xf1v\xc5\xbci\xact\n%\xc7\xa1\r\xdc\xbb\xbb\xb02\xfd\xe1\xe0o\
+\x00<\xee\x7f\xbbnw\x1f/K\xdb9\xed\xb4\x0b\xaf\xe3\x01\xf4\x88\xe2V\r\x0b%\
+\x00\xc8\x08\xb3\xfa\x84m^n\x8d<\x03$\xf1h\t61\'\xf8E\xac\xd3T\xd1\xa5R\x9a\
+\xe8\x8b\xf4RV\xfc\xda\\}M\xf9+k\x01|\x04\x82V\x80\xef\x91!\xad\xd8:\x1b\xcd\
+\xaf1\xbbf\xdf\x92\xf3\xa8l\xc5\xf0\xe8!|\xcb+6\x06\x0c\x87T\x91\xb6\x04\xc0\
+8g\xeb\xa9N\xfe\xac)\xd2 \xdf\'o\xd9\x825+\x01\x12\xad\xe8\x932\xf9\x97\xea\
+\xd3\x94tv\xa1\x9fc|\xad\xcc/\xae\xafsg\x01d\xacG\xac<l\x06\xab\xab[\xe2\x10\
+\x86\xd7\x10 -p\x9e\x0c%\x15\xb9\xff\x11\x00\xe8B@{\xfb\xfc\x1c.BAJ?~\xfe\n\
+\xcf\xcb\xc2\x7fQ\xbd\xf2\xff\x03\xb6\xf0\xb3\xed\xc0\xc1\xd6\xc3\x00\x00\
+\x00\x00IEND\xaeB`\x82y\x94\xf1\xa2' )
+
+def getGameraWizardBitmap():
+    return wxBitmapFromImage(getGameraWizardImage())
+
+def getGameraWizardImage():
+    stream = cStringIO.StringIO(getGameraWizardData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconData():
+    return zlib.decompress(
+'x\xda\x01\xb5\x07J\xf8\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00 \x00\
+\x00\x00 \x08\x06\x00\x00\x00szz\xf4\x00\x00\x00\x04sBIT\x08\x08\x08\x08|\
+\x08d\x88\x00\x00\x07lIDATX\x85\x9d\x97il\\W\x15\xc7\x7f\xf7\xbd\x997\x8b\
+\xc7\xe3\xb1g\xbc\x8e\xf7=\xc1N\xea4[\x1d\x15%\x12"$ AP+AAB\xa2\xdf\x90@\x02\
+\xf1-BP*\x15TQ\xf5C\x10RU\xc4\x0eJ\x89\x88\x8a\xd4\x12\xba@\x85\xda8\xb1\x9d\
+8q\x12\x1b\xc7\x8e\xeb}<\x8b\x97\xd9\xb77\xef]>\x988q\xe2\xc4v\x8e4\x1fF\xf7\
+\xdds~\xe7\x7f\xce\xdd\x84PTvb\xd24$\x80\xeaSq}\xc7I\xec\xe7\t\xc8\xaf\x8d\t\
+E\x15;r\x06(;\x9dp\xd7\xba\xce\xb4\xf3\xb5\xd3_\xa6\xe2\xeb\xde\'u\xb1s\x80\
+\xbb\xd9\x0b\xb7\xa0c\x7f;\xb1T\x92/\x9d>\x8e\xd5k\xd90\xbe\x13\xb3\xect\x02\
+@\xd5O\xcb\xf1\x96z\xf0\xda}\xc8\x06\x13\x87\xcf\x81\xbe\x9cx\x12WOV\x02\x8b\
+G%.\x92\xecvtr;:\x81\xc5\xbf\xb3>\xda\xe0\xebQ\x03\x8f\x93\xb3\xb9\xbb\x81X$\
+\xce\x9f\xc2giT\xebI\xe4\x92[\xce{T\x83n\n\xb0U-\xa7\xcf\xce\xd1Z\xdb\xc2Jr\
+\x95\xfe\xfe\xabX\xe2\x16\x0c\xbb\x89\x995\xd7>p\x82\xd2\xa9`N\x9a\x10\xbb\
+\xe7s3\x88\x87\x00\xd6\x83\xab\xe0\x7f\xa5\x12\xf7I\'\xc1\xbe%V\xbf\x9f@\xb8\
+\x04\x9d\xaf\xb5\xd2\xb8\xaf\x96\xce\x86vf\xa7\xe7\xb1\xfb4\xe2\xee\x04\xa1\
+\xbfEp\xb6:\x98{5$d\xab!\xd5\x1e\x81Zg\xa1P[@\xfe\x16Ho\x0ea\xd9,\xb8\xa8\
+\x15\xb4\xfe\xb5\x0ewS\tR7\xc8\\\xcd\xe29\xe0\xe6\xc5s\xdfdpf\x88\xe7\xda\
+\xbe\x8a\xd3\xe2@qX\x98\xd7\x02\xc4\xe3q\\M.\xac\x05\x15\xdf\x0fJd\xe4\x8d\
+\x15\x0c\xb1\xa6\x86\xeb\x94\x13\xd1"\x88\xff8\x05\x89\x87!\x94\x07\x83c\x85\
+\xae7;h\xdb\xddL\xde\xc81\xf3\x8b\x00\x15c\x95\x1c}\xb5\x974Y\x9e\xef>\xc5\
+\xc5t\x1f\xa9|\x1arp+=\x86>b\xb0go\'-\xbd\r4\xfak\xf1\x9ctS\xba\xbb\x04\xe1\
+\x16(9\x85\\*\x87zPy(\xd1MK\xd0\xfd\x9b\x0e\xaa{\xca\x89\xa7S\xecw\xed\xe3/W\
+\xces\xea\xad/r\xd8\x7f\x08Mj\x18\xbaA\xbb\xda\xc6\x8d\xccM\x8c\x82Iq\xcc\
+\x89\xddjCu\xa8\x14\xe3\xc2\xde`\'\x9d\xce\x92\x9f\xd2\xc9\xef\xd5in\xae\'X\
+\x16&\xe3\xcf\x12\x9dK\xc2\xf8\xc6x\x1b\x96\xa1\xf5\x19\x0b\xdd\'v3\x13\x9c\
+\xe7\xa8\xf7Y\x02\xef\x85\xa8\xfda5\xbb\xaa:\xd1\xa4\x86\xae\xeb\x18\xa6\xc1\
+\x92\xb1\xc4^\xdb\x1e\xdc\x9a\x1b\xcd\xa7Q\xecr1;\xbe\x80!M\x92\xa4Pj\x04\
+\x02\xc1S\xcd]\x1c\xeby\x96\xe6\xa2F\xdc\r\xc5\x94=_\x02\xf6\x8d*(\xf7\xff\
+\xf9\xca/O\xd0?\x7f\x95\xf2R\x1f\x13\xa1;\x0c\xf4\rq\xec\x0bG\xf0\n/y=\x87i\
+\x98\xdc\xc9OR\xa5V!\xa4@\x08(/\xf2\xd1\xd0\xedgrj\x86\xd1\xc1\t\x86\xfbF\
+\xf1\x15\xbc\x04\x86C\x84F"\xbc^\xf1k\xd1\xd9\xd4\xce.\x7f\x07\xe6\x1e\x13\
+\xfbwm\x1b\x15X\'\xf1)d\xeb2\xa4\xa63<U\xd6M\xff\xaf\xae\xd1\xf5\\\'\xf1\xb9\
+\x14#\x99Q\x06\xd3C|Z\x98"\xacG\x88\xe9q\x14\xa1\xa2\t\r\xbfV\x8d\x9e0\xb0\
+\x18\x16\xac\xdd*\xfe}\x95HU\xe2\xf8\x9c\r_o\x19%\'\x9c\xf2\x8f\xc7\xcf\x91\
+\x9f\xcb\xe1\xb1\xbai\xf8l\r\x8e\xe3\xb6u\x15\xd6K\xa0uX\xb1d\xac\xb4u51\xda\
+7\xc1\xf4\xebs\xb4U\xb4\xe0(r\xd0\xa86p\xd0v\x80\x16K3G\x9c\xbd\x98\x98L\xeb\
+3d\xc9\xb2P\x08p\xa9\xef\n\xfbz\xbbP\x84@1\x15\\%N|\xdd\xa5\\\xfe\xfd\x10\
+\xd9\xda\x1c\xf9Y\x9d\x8fO\r\xa2\xd9\xacX\xab,\xf8\x0f\xd5\x80x\xa0\x07\xbc\
+\xb6R\xbc\xce2\xbc\xb62\x06\xce\x0cA\x05\x84\x8aC\xb4x\x9a\xb0\xe3\xc0\xc4\
+\xc4DbbR\xa3\xd5p34\xc2\xf0\xd2-\xe4u\x81\xcbR\x84R\xac\xa0\x9a*\x12I\xd6\
+\xc8QX1\xc0%\xa9x\xc6\x07\n\x14\x92\x05\x82//\x11\xbe\xb6\xccl\xdf<\xc8\x07V\
+A&\x96\xa5\xb9\xa4\x91\xb1\x8f\xee\x90\xfcW\nK\x9dJ\xa7\xa7\x9dT!\xbd\x8e)\
+\x10\x80\xe4zr\x98\x93u\x9f\xe7fa\x04[\x8f\x95*\xca\x99\x9bY\xc0\xa80\xf0\
+\xd9\xcb0\xe2&\xbe"/\xb3\x8e\x00\xd6zu=X\xfcr\x92\xec\xb2\x95|V\x07\x150\xee\
+S`\xf5Z\x94\xfe7\x86\x98\xfa\xd9,d\xc0\xfdt1v\xd3N6\x98E PP\x10\x08\xe6\xf5\
+\x00U\x96*\xac\xc2\x8a\xdbZ\xcc\xaa\x8c!\xa5\xc4\xa18\x08L\x86\x08\x06#d\xc9\
+\xe1,\xb2\xe3\xee(\xa2\xbe\xbcf\xc3Z\xcbO\xe80\xb7\x16|\x83\x02\xd2\x84\xbf\
+\x7f\xef\xc2:mz9\xcd\\x\x014\x88\x9aQ\x16\n\xf3\xa4\xf4\x0c+z\x94C\xc5\xfbQP\
+\xd1\xb0q\xe9\x9fW\xd8\xdd\xdeNt,NuU%\xc1p\x98\xf9\xc2"\x9eF7F\xc8\xe4\xd6\
+\xe0\xf8Z\x14\xe3\xc1\x1dg\xed\x80\xb2\xdc\xdd\x16\xa5iH\xee;\x82r3y\xea\xca\
+\xfd\x8c.\xdff\xc5X\xa1\xd3\xba\x0b\xc5\xba\x96\xca\x1d}\x92\x80\xb9\x88\xe6\
+\xb2B%\xdc\x1e\x98\xc4\xd1\xa5\xd1\xd6\xb3\x97\x06\xb3\x96\x84\x99`jv\x0e\
+\xbbf#\xfc\xfe2\xe4\xee\x05|\x10b]\x1c\xa1\xa8\xe2\xee\x0f@\x8e\xc3tx\x96T(M\
+\x8b\xd6\x82*\xd6\x1a\x0c$\xedZ\x1b\xcb\xa9\x15@P\x96\xf1\xd0\xeai\xc2Vg\xc3\
+H\x18\xe4\x92yt\x0c\x9a\xea\xea\xc8\x199\xb4\x8c\xf5\xe1\xd47\x03x\xc8$\xfc\
+\xfbw\x9f\xd0\xd4VOTF\x11B\xa0\x08\x05\x04\x0cgnp\xc0\xf34~\xad\x86]G[I\xf7\
+\xa4X\xb9\x12e!\x10\xa2\xd8]\x84\xcb\xea \x19L\x93\x8ad0\xf3\xe6\x13\x02\x00\
+\x91\xf7\x97\xa8w\xd4r#v\x13\x04,\xe4\x03|\xbcx\x91\x14)J\x147\x08\xc1b$\x84\
+CuP_\xed\'\x15L\xa3\xea\n6\xa1\x11\x1a\x8fP\xf1\x19/\xd9\x0b\xf9u\x85\xb7\rp\
+\xf7\xe3B\xbf\xc1\x85\x8b\x1f\x90\x8f\xe78w\xfd<\xc2\x84c5G\xe9\xd0\xda\xb9\
+\x9c\x1d@\xb5+D\xf3q\x8c\xd2\x02\xc1B\x04\xc5\xa603\x16`\xe0\xbda2\xcbY\x96\
+\xde]}l\xf6\xb0\x8dK\xe9\xa5o_\xa5\xf7\xeaA\xca}\x15\xa8\xa6\x05E\x15T*\x95\
+\x94\x087oO\xbcC\xec?\t\x96f\xa2(\xc7\x05\t{\x02\x97\xd5\x89\xaf\xbc\x8cDE\
+\x82\xc0\xb9\xc8\x96\x00\xaa\x10\x9bWA\x08\xe5%\xa4\xfc\x89\x8cIF\x82\xb7\
+\xf14\xba1}&y\xa1\xa3guf\xc4\x0cG\xca\x0f3\xf4\xc9u\xf2S:\xc2\'p5:\x89\r$\
+\xc8\xe5rD\xdeZE&\xe5\x06E7\xb3m\xdd\x8ac\x7fN\x89K\xff\x18\xa0r\xac\x82\xa4\
+H0\x10\x1ad\xbfs\x1f\xc5J1\xb5u\xd54\xed\xa9\xa3:S\x81\xf1\x8e$aI\x129\xbf\
+\x82\x194\xb7\x0c\xbem\x80\x9a\x1f\xf9d\xf9\x0be\xbc\xf2\xd2k\x8c\xbe9\xce\
+\xe1\xda\x83|8\xf7\x11Q#\xca|b\x91px\x89\xa8\x1e#2\xba\x8c~\xb6\xb0\xe9\xa6\
+\xf3(\xdb\xfaaR\x03e/x\x98\x9f\x0e"\xea\x05\x17^\xfe\x90x&N\xdd7jX$\xc0j8\
+\x86\x195I\xdf\xc8"\x97%\x94\x00\x85\xed\x03l\xad@\x00f\xaf/\xe0\xc2Ia\xb5\
+\x80\\\x95\\<}E\xbc\xfb\xe2\x07\xa4\x96S\xc8\x11I\xf2\xd34\xd4HJ\xbf\xe5F\
+\x1ca\xfd\xd6\xb3\x1d\x13\x8f{\x1d\xdf\x7fE\xc7\x02X\x81{o\x10\x942\x81Y\x90\
+\x88\xa4*\xfcg\xca\xa5\xbb\xc1\xc5\x7f\xffp\x07y\x8e\xf53e\xab\x1ex,\xc0\x06\
+\x88\xadL\xf9?\xa8\xc2\xfa\xde\xbf\x1d\x80\xff\x01{#K\x0c\x88X\xdaI\x00\x00\
+\x00\x00IEND\xaeB`\x82;o\xb6\xee' )
+
+def getIconBitmap():
+    return wxBitmapFromImage(getIconImage())
+
+def getIconImage():
+    stream = cStringIO.StringIO(getIconData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconBackData():
+    return zlib.decompress(
+'x\xda\x01\x9e\x06a\xf9\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00\x18\
+\x00\x00\x00\x18\x08\x06\x00\x00\x00\xe0w=\xf8\x00\x00\x00\x04sBIT\x08\x08\
+\x08\x08|\x08d\x88\x00\x00\x06UIDATH\x89}\x96]l\\G\x1d\xc5\xcf|\xdc\xb9\xbb{\
+\xd7\xbb\x8e\x9d8\xb5\x13\xd7\x04\x12\xa2@\x88\xa0\x16\x89T\xe3\xa0|\xb8<\
+\xb4\x82Z\x10\xa0\xf0P\xc0iq\xd3\x17PA.(\x02\xc1\x03\xe2\x01T\t\xa5\x0f|\x15\
+\t\x01Q\xa1jR*/\x8d\xdb\x12\t\x84\x94*M\xe3\xd8\x8d\xebm\xd3t\xedl\xd6\xf6\
+\xda\xde\xf5\xdd\xf5\xde;w\xee\x9d;<\xd8k\xb5$\xe1H\xf34\x7f\x9d\xdfhf\xce\
+\x7f\x86\xe0\xff\xc8u\xdd\x84\xe38\xed\x84\x90\x0c!$\x05\x80\xafOE\xc6\x18\
+\xcf\x18Sk4\x1a\xcb\xd9lV\xde\xc9\x83\xdc\xc98\x9dNo\'\x84l\x05\xc0\x00\xc4\
+\xeb\xb5\x11\x00\xd3\xac\xe3\x9c\x13\x00\x8c\x10\xb2P\xa9Tn\xdc\x0et\x0b \
+\x0c\xc3\x0e\xc6\xd8nB\x087\xc6\xf8G\x8f\x1e\xcd\x0e\x0c\x0ct\t!X\xb5Z\xf5k\
+\xb5ZP\xa9Td>\x9f_-\x97\xcb\x11\xa5\x94SJ\xb9\xef\xfb\x0c\xc0\x95R\xa94\x7fG\
+@\x14E\xdb\x18c\xbb\x8d1\xde\xe0\xe0`{___\xc7\xce\x9d;;}\xdfW\xc5b\xb1<??\
+\xef\xfd\xf9\xd2\xdc\xdf\xbaj\xd3\x07S\xa9\x14\xe5\x9cCk\x9d`\x8cERJ\xa1\x94\
+b\x96eM^\xbcxq\xe6\x16@\x18\x86\x1d\x9c\xf3\x8f\x1bc\xd4\xc8\xc8H\xf7\xbe}\
+\xfb:m\xdb\x16\xf5z\xbdQ\xadV\xeb\xe3\xe3\xe3\xe5\xe7\xc7\xeb9*R\xf8LG\xf5\
+\xbeL&\xa3\x19c\x04\x00\x84\x10D)e\xea\xf5z\xa2^\xaf\xdb\xb6m\xbf666vs\x03\
+\xe0\xban\xa2\xa5\xa5e?\x00522\xf2\xa1\x83\x07\x0f~\x94\x10b\xa4\x94\xfe\xd4\
+\xd4\xd4\xdc\xd9\xb3g\x17\xa6U\xf7\xcb\xdd[;q\xb3\xea\xe2+\x9fJ\r\x08!\x88\
+\x10\x82PJ\tc\x0cZk\xc4ql\xa4\x94\x98\x9b\x9bK9\x8e3v\xfa\xf4i\x8f\x03@:\x9d\
+\xde\x0e\xc0\x0c\x0e\x0e\xb6\x1f;v\xac\x0b\x00\x18cdbb\xa2\x98\xcb\xe5*\xd3\
+\xaa\xfb\xe5\xa1G\xbe\x8d\xfc\x1bWp\xb3:\x81\xf6\xf6v\x9eL&\x89eY\xb7;C\x93\
+\xcdfe\x18\x86;\x01Lp\xd7u\x13\x84\x90N\x00\xba\xaf\xaf\xaf#\x93\xc98\x8dFcu\
+jj\xaa4::\xba\xf2V\xb0\xfd\xdc\xf7\x1e?\x81\x87\xbf\xd4\x8f\xcf\xff\xe7u\x00\
+\xc0\x96-[\xb8\x10\x02\x96e\x11J\xe9\x06$\x8ec\x13\x86\xa1QJ!\x08\x82\xed\
+\xc3\xc3\xc3\xef\xf2\xf5{\xce\x8e\x1c9\x92\x1a\x1a\x1aj/\x16\x8b\x8bKKK\xf5\
+\\.W}+\xd8\xfe\xd2\xf7O<\x86\x93C\x87\xf1\xdc\xc5\x19\x14\x93\xad\x00\x80\'G\
+\x9e|\xf1\x93\x0f<\x86\x8a[\xc3\xc2\xb2\xbb\xb1z\xef\xea?\xf0\x87g~\xfd\xa0R\
+\nJ)bY\xd66N\x08\xc9\x18c\xcc\xe1\xc3\x87\xef\x8a\xa2H{\x9e\xe7\x9f9s\xa6\
+\x9c\x0f\xef\x1e\xfb\xce\xa3\xc7q\xf2\xf8\x11\x14k>\xce.G\xd8r\xef\x01t~b/\
+\x1e:\xf53<\xf0\xb1\xbb\xd0\x99X\xcb\xdd\xe5e\x89o<r\x12\xf9\xebm\xd8\xb4i\
+\x13\x0f\x82\xc0\xf8\xbeO8\xe7\x9b\xf9zB\xe3T*%\xe6\xe7\xe7\x97\'\'\'\x17\
+\xf3\xe1\xddc#O|\x17?|\xa8\x0f\xefU=<\x9d_\xc6\xf9\xe22\xa4\xab\x90\xd9\xda\
+\x82\xd8N\xa0PW\x98\xf3C\xbc\xeb\x86x\xe5\xf2,\x82\xd6N\x80\x0b\xa4\xd3ifY\
+\x96\xe1\x9c\x13Ji\x96c-\xfe\xdau]Y\xab\xd5\xfc\xe7\xc7\xeb\xb9\xe1o~\x0b_\
+\xbb\x7f?\xce\xbfW\xc1\xabe\x1f\xcf^_3\x8f\x83\x18\xd7\x16V\xf1\xbb7Jx\xf0\
+\xc3ilu\x92\x98]Q\xb8V\xaeaQ\x06 \x86 \x91Hp\xcey\xbc\x0eH6{K\\\xadV\xfdB\
+\xa1P\x93o\xff\x1b\xbf\xbfp\x00\x7f\xe2\x19\xa4>\xd2\x85\xd5U@\x96%\x10\xc4k\
+\x95A\x84\xc2\\\x19O\x15f@(\x01\x08\x05e\x1c\xc40\x18b\xe08\x0e\x0b\xc3\xb0y\
+\xe8\x94c\xad\xbfX\x95JE\xce\xce\xce\xfa\x03\x87\xf6\x7f\xee\x95\xd1_\x9d\
+\x03\x00\xa9>\x8b\xbd\x07\xba\xf06:@\x16\x1b\x88S\x14m\xed\x14=m\x0e45`1\xc1\
+;K\r4<\x02=~\x19\x00\x90L&)\xa5\xb4\t\xd0\xdc\x18\xe3\x11B\xb2\xf9|~5\x95J\
+\xd1l6\x1b=\xfa\xf0\xe0}\xbf\xf9\xe3\xa9\xb14\x80\x99\xcdGq\xcf\xden\\\xe21\
+\xf4\x9b\xd3X\xbc\x01,\xe7\xaf\x01f\xdd\xc4D0\xdaG\\\x9a\x85\t}\x08!8\x80(\
+\x8ec\x08!j\xdc\x18S\xb3,\xab\xb5\xbb\xbb;\xea\xe9\xe9a\x8c1"\x84 ?\xf9\xc1\
+\x89\xfb\x7f\xfc\xf3S\xa3\x00p\xd5\xbd\x17\xbb\xef\xe9\xc1\xd5\x99\x19\xe8+\
+\xaf!(\\\x86\x89\xd7\xb6\x811\x06;a#X\xad\xc1\xf8+\x10B0\xad\xb5\xb1,\xcb\
+\x00X\xe4\x8dFc\x19\xc0\x0e\xcb\xb2`\x8c\xb1\x00\x98fx\x9e\xfe\xc5\x8f\xbe\
+\xf0\xf8\x13?}\x01\x00\xae\xbeS\x00*K\x00\x80\xfc\xeb\xb9\xe3\xc9d\xd2\x12B\
+\xd8\x89D"E)\xb5\xe28\x8e\xa4\x94\r\xa5\x14e\x8c\x11\xce91\xc6\xcc\xd0l6+\t!\
+\x0bR\xca\xac\xef\xfb\x89(\x8a\x04cl#<\x7fy\xe6\xa9/\xae\xe6N\x01\xe5\x12 \
+\xbd\xe6\xaa\tc\x8cr\xce\x13\x00\x88\x10\xc2PJ\x19c\xccf\x8cQ\xc6\x18\x89\
+\xa2\xa8\xd0\xdf\xdf\xefR\x00\xa8T*7,\xcbjH)m)%\xd1Zo\x00\x8c1\xe6\xef\x7f\
+\xfd\xed\x97\xeb/\xfc\x12zq\x0e\x00\xa0\xb56Z\xeb8\x8a"\t TJ\xd18\x8eC\xad\
+\xb5\xd2Z\xc7\xeb\xb7r\x1c\x00(\x00d\xb3Y\x19\x04\xc14\x00\x15\x04\x01_YY\
+\x11\xcd\xde\x12E\x91\x89\xa2\xc8\xbcz\xee\xb9\xafzo\xbe\xf4\x01\x80\xd6:\
+\x94R\x86J)\x19\x86\xa1j\x02<\xcf\xbb\xd0\xdf\xdf\xefn\x00\x00\xa0T*\xcd\'\
+\x93\xc9\x89z\xbd\x9e\x0c\xc3\xd0\xbc\x7f\x18c\x8c\xd6\xda\xfc\xeb\x9f/~\xbd\
+19\n\xad\xb5VJi\xa5T\xa4\x94\x92A\x10\xd4}\xdf\xf7\x94RQ\xa3\xd1\xb8\xb4g\
+\xcf\x9e\xa9\xa6\xef-\xed\xf6\xd0\xa1C\xdd\x8e\xe3|\xba\xab\xab\xcb\xec\xda\
+\xb5+\xccd2\xac\xb5\xb5\x95\xa5\xd3i\xe68\x0eK\xa5R\xd4\xb6mf\xdb6ek"\xeb\
+\x0fO\xecy\xde\x85\xf7\x9b\x03k\x0f\xfa\x07T(\x14j\xbd\xbd\xbd3mmmD\x08\xd1\
+\xd2l\xc9M#c\x0c(\xa5\x88\xe3\x98\x98uI)\xaf/,,\x9c\xef\xed\xed-\xfe\xaf\xdf\
+m\x7f\x15M\r\x0f\x0f;;v\xec\xd8\x96\xc9d6;\x8e\x93miiI&\x12\tj\xdb\xb6\x16B\
+\xd4\x00,\x1acf\x9a\xfb};\xfd\x17\x13\x0e_\x8e\x18\xdb\x8c\x8a\x00\x00\x00\
+\x00IEND\xaeB`\x82\xed\xb8 ^' )
+
+def getIconBackBitmap():
+    return wxBitmapFromImage(getIconBackImage())
+
+def getIconBackImage():
+    stream = cStringIO.StringIO(getIconBackData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconCcData():
+    return zlib.decompress(
+'x\xda\x01z\x04\x85\xfb\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00 \x00\
+\x00\x00 \x08\x06\x00\x00\x00szz\xf4\x00\x00\x00\x04sBIT\x08\x08\x08\x08|\
+\x08d\x88\x00\x00\x041IDATX\x85\xc5\x97\xafs\x1bG\x14\xc7?\xab,X` \x10 \x10\
+\x10P`\x10\x10\x10 P PPP`\x10`\xd0?\xc0  \xb0 @ @0\xc0\xd3\t4\x08\x10\xd0t\
+\x0c\x0c\x04\x04\x04\x04\x0e\x08\x08\x08\x08\x1c8\xe0\xe9\x1c\x10X\xb0\xe0M\
+\xe7M\xb7`\xf7\xce\x96m\xd9N\xea6;\xb3\xa3;\xdd\xbd\xfb~\xbf\xef\xe7\x9d1\
+\x9dg|\xcf\xd5\xf9\xae\xe8\x80\xfdZ\x03\x83\x89\xcdq$\x9a\xff\x95\x80\xc1\
+\xc4ay\x8c\xaa\x10T\xf8\xf4j\x1a\xff-\x11\xf3\xd8\x1c0\x98xZ\x9f *\x04\x11\
+\xbc\xf8|\xec\xf9\xd2_\xf1\xadD\x1eE\xc0`\xe2Y\xfd\x1b\x82 \xea\x11\x85 \x9e\
+\x90\t\x88\n\n\x8c\xfb\xab\xaf&\xf1`\x12\x1aL\x9c\x84!\xce\x81\xb3\x0ek]\xba\
+`\xc1Z\xda\xf3z\xe5\xbf\x06\xb7]\xf7\xe6\x80\xc1\xc4\x0b\x19\x01\xa0\xd6\xa1\
+\xe2q8\xc4\nV\x1d\x16p\x16\xd6\x85\xa7\x9c\xfdy\xcb\xb69\xbe\xcf+{\t\xec\x80\
+\x03\xaa\xd2\xdelq8\x0b\x8a\xb0\x9em\xa8\x8a\x1a{\xd0\xd9\xb1=;\xf7HH\xb6\
+\xef~\xed\xeeM\xd6;C`0qP\xc0\xe4r\xdc\xb2\xb4\xd9\xfd.o\x80\xe5|CY\xd4\x00H\
+\xb8\xb2\x1dO=\xaa\xa4-0:\xf5|\xfc\xe41\x98x\xdd3\xb0\'\t\r&\x0e\x96\xf9D\
+\xe1\x87\xe7}\x8e^\x1c\xa5dSA\x14.\xa6S\xd6\xcb\x1a\r\x82\x04A\xc3\xdf\x04\
+\xff\x17g\x1f\x05\x15A$\x91\x12\xc9;HKj4\xec\xb5\xdex\xb8\x0fX(\xb7\x05\xa3\
+\xba@\x03\xbc\xffq\xc8t~\xcefU%\xff\xb6<;\x9c\x9f\n\x12 \x90\x12\xb4y\xba\
+\xb5`\x9dC\x830]\xcdo>\xfe\xfe\xa5\x02d5\x1a`x6L\th\xbb(\xd2\xba\x7f2Jn\xe7\
+\x1a\x98\xb5\xe0\x1c\x84\x1c\x9e\xd9f\xc5\xda\xcb\xce\xf3\xf7\x96a\x13?\r\
+\x10j\xf8\xe0O\x90-\x88\xa7U\xae$wOF\xbb%h\x1b\xd5\xd9\x0b\xd6\xc2\xb4\xacXn\
+\xb3\x9a\xc7\x10@I\x80[X\xf4\xcfx\xfd\xba\xc7\xf4\xd5\t\xef\x0e\xfa\xa8\x82\
+\xd7\x14\xd7\xc1\xc0ST\x198+n\xc1\xf3\xba\xd8\xd4\x14\x95\xcf\x8av\t\xec\r\
+\x81\xd4I\xed\xfc\x97)\xe27\xa0\x82X\xf8\xf9\xb0\xc7\x9b\xbaO\xa1\x15\xa7\
+\x97\xa9\x1a6u\xda\x00\xaf^\xc2\xa1\x03\xac\xc3Za\xb2\xf2\xcc*\xc1\xdeP~\xaf\
+\x07"\xd1,\xdf\xc2\xeaxE\xb7\xa5\xeaP@T\xe0@x\xf3\x02.\xdev\x91\xc5\xd1\x95\
+\xd3TX\x95\xc2x\x95z\xc6\xe7E\x02o\xdd~\x87\x07\xf6\xf6\x81\xe0\xe79\xe09\
+\xe4\xd6\xe1\\\x17m\xda\xb1\x85i!l\xeb\x06]@Ie\xe9=_f\x15\x8b\xcb\xe6\xda\
+\x9d\xe2\xef&`0\xd1\xfb\x02\xd7\x18Y\x87s\xbd6V\x07\xae\x8b\xb3\x8e\xf5\x06\
+\x16K\x9f:\xa2\xe4\x1a\x0f\x1e\xcd\x85\xaf;\xa0\xd2\x96\x93\x16\xbf\xedt\xc4\
+\x9d\x1c0\x98\xa8RA\xa8\x92\x81\x05HqN\x9d0\x9do\xca\x9a\xf5\xba\xc2fq*\t@\
+\x9bf#\xa9:\xa0\x97l\xd3M\xe8\xfc\xe4V;\xee\\\x07\xdf.\x07\xe0\xcf\xae\xe2\
+\x94U\xd86\xa5\x1de\xb9\xa1*\xab\xa4K\xc1\xd9\x04\xb6\x03\x1e\x1a\x02I\xbdZ\
+\xd0\xd9\xf1\xc3\xb3\xc0\x02R\xcf\x91z\x84J\x016=\xc4\xb9\xe7\xb8\x83\x1eUYP\
+U\x05A\x04\x9a1\\\xcd\x99|x\x89\xdfn\x10\xef[p\r\xd2\xe6\x05\xe7\x83\xbd\x13\
+q\x97@\x16\xaa\n\xea\xe7\xf8r\x84\xca\x1c\xb1pY\xce\xa9\xebU\xebV\x91\\\xf7\
+\xd9f\xf6\xf9\x88\xe9\xe7~"p\xdd\x03\x93\xd7\xdf6\x8eC\x1e(\xdb\xf59\xa2\xe7\
+\xd4m\xba\xa77\xa2\x86\xe8l\xb9;fg\xe3A\x04\xe8\xff4\x86\x8b\xc3\x07\xdf\x90\
+v<\xa0\x9a\xe2*\x9a\xa7\x99\x08"B\x08\xc2\x81\xeb\xa6\xebY\x98\xf7\xc2tq{\
+\xc6G\xa2\x89DS\xec\x89\xf9\x83\x1e\x90 W\x04\xf2o\x08\x82sW\rD\x15.\xee\x00\
+\xbfI\xe4!\xf0[\x04|H\xf3>\xb4\xea=".u?\x054)?\xfd"O\xf2M\x007^H\x9a\xb7\x95\
+\xc5\xf80\x11\xd0\xd4^U\xa1\xdb\x85M\t\xef\x86\xf5\x93\x81\xdf"p\x93\xc8\xe4\
+\xb4\xd7\xfe\xa7\n\xc7\xef\x9f\x16<\x81u\x9e\xed\xdd\x9d\x8e\x8d\x9d\x8e\x8d\
+\x7f\xfc\xfe"v:6\xdew\xef7\xef\xc7~\x98<\xb9\xf2\xbc\x1e\xf5u\xfc_\x81\x03\
+\xfc\x03\x16\xa8\xcb\xbc_J\x89>\x00\x00\x00\x00IEND\xaeB`\x82\xb1\t"\x02' )
+
+def getIconCcBitmap():
+    return wxBitmapFromImage(getIconCcImage())
+
+def getIconCcImage():
+    stream = cStringIO.StringIO(getIconCcData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconChooseImageData():
+    return zlib.decompress(
+'x\xda\x01\x99\x04f\xfb\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00\x18\
+\x00\x00\x00\x18\x08\x06\x00\x00\x00\xe0w=\xf8\x00\x00\x00\x04sBIT\x08\x08\
+\x08\x08|\x08d\x88\x00\x00\x04PIDATH\x89\xad\x96_\x88TU\x18\xc0\x7f\xe7\x9e;\
+sw\x06\xff\xcc"\xb3\xeb\x8a\xd0\xa0ldjF`\xc6\xd4\x16(\xf8\x98\xd1\x8b=\xf4\
+\x14\x82D\xb5P\x0f\x11\xd1C\t=\x98\x15\xd4C."\xb2\xf4$F\x14d\x92&&i\xb2\x89\
+\xe1F\x84\x95\xac\xeb\x9f\x9d\xdd\xadugf]\x9d\x99{\xef9\xe7\xeb\xe1\xce\xee\
+\xba\xb9SR}p\xb9\x87{\x0e\xdf\xef\xfb{\xee\xa7\x94\xa7YH\xde\xdd\xf3\x8e(\
+\xa5\x88\xa2\x08c\x0c\xce9\xac\xb54\x1a\r\xea\xf5:\xb5Z\x8dj\xb5\xca\xe0\xe0\
+ C\x97\x86\xd5\x82J\x00\xbf\xd5F\xa1P\xa0X,\xe2y\xde\xbc\xef"\x821\x86\xa9\
+\xa9)\xca\xe52\xfd\xfd\xfdtuu\xc9\xe9\xef\xce,\x08i\t\xb0\xd6\x92\xcf\xe7\
+\xd1za\x0f\x97/_\xce\xd4\xd4\x14\xf9|\x9em\xdb\xb6\x91N\x7f \'\xbe9y\x07\xa4\
+%@DZm\x01\xa0\xb5&\x97\xcb\x91\xcdf\xd9\xb2e\x0b\xd9l\x16c\x8c|{\xea\xf4<\
+\x88\xd7J\xc1\xdd\x88\xe7y\x04A@\x18\x86\x14\x8bEz{{y\xbc\xe7\xb1y\x96\xfdk\
+\x0ffDk\xcd\xe1\xc3\x87\xe9\xe8\xe8 \x08\x026o\xde\xcc\xc8\xc8\x88\\\x1a\xbe\
+\xac\xfe\xb3\x07\x00[\xb7n%\x9d\xd2\\\xbe|\x91\xb3\x03\xa7\x18\x1b\xb9J\xf7\
+\xeaU\x88\xb3\xf2\xbfx\xb0n\xdd:\n\x85\x02\xe5\xc9\t\xc6\xc7J\x8c\x8f^a`\xe0\
+\x1c_\x1d\xfb\x9a\xbb\x06\x88s\x00\x18kI\xa5R\xf3\xceX\x13\xe3{\xb0dq\x16\
+\xb1\xcbHk\xcb\xb5\xabWf\xcf\xfcm\x88\xc49^-n\xe4\xd0\xdb\xbbP\x9e\x87\xef\
+\xcf\xd9#"8\x1b#6\xc4\x99\x06)%d\x83\x14\xed\xb9\xa5\xb4/Y\xf4\xcf\x00\x11\
+\xe1\xf5\'\x8a\xbc\xf9q\x1f=\xf7Z\x9e\xec\xd9\x04M\xafD\x04\x17G8\x13\xe2L\
+\x04.\xc6\xda\x10O\t\x81\xaf\xf0=;\xab\xa7e\x88\xbe|i\'\x1f\xee{\x99\xc9\x13\
+{\xd9y\xe0<G\x06~\xb8-,\x11\xceF\x88\x8dp6\x06\x17#6\xc6\xc3\xe2)\x87\xef\
+\xa9\x85\x01\n%\xcf\xe4\xda\x00x\xff\xa3\xe7\x99\xbe1\xc9\xf6\xddG9sah6d&n \
+\xce &\xc4\xd9\xb8\xf9\x84`f`\x11J\xcc\x9d\x00\x85\x92\xd3\xfb_c\xcd=9\xb8y\
+\x83\xe9\xf1\x12\xdbw\x1f\xe5\xfb\xa1k\x008g\xb1q\x84\xb8\xb8i}\xdc\xccA\xb2\
+V\x12#\xb6\x81\x12\x8b\x87\x9b\x03(\x94\x00\x94\x8f\xedF\xe2\x10\xa2(\xc9L\
+\xd0\xc6\x8bO=\xc8\xa3\x1b\xba\x01\xb8\xef\xfe\xb5L_\xfa\x95g_\xe8ebl\x94#\
+\x87\x0e\xa2}\x9f\xfd\x9f}2\x0bT&\xc2\xd8\x18\xdc\x9c\x07\xaa\xf4\xf9\x1b\
+\x92]\x9cK\x14\x038\xc04\xb0^\x80\xf6\x93X\xdaZ\x05\xd29\xb4\xaf\xa8\x855\
+\x02\xa5\xf0\xdb\x0b\xa4\xba6p\xf2\xcc)\x1e\xe9\xd9\x84\xd8\x18k"\xac\x8d\
+\x18\x188\xcb\xd3;\xdeByZ\xf9\x81\xce\xc0t\x04a\x03l\x03K\x1dM\x86je\x88\xda\
+\xe4(\xa5i\xcd\x17?V\x01\x18\xbf\x9e\xbc\xf5m\xe5\xdaw\xf0@3\xd9\x06\xb1\x11\
+\xcaYp\x06\xed%\x81\xf2\x01\xac\xaa\xa3\xdb\x14xmh\x97$9\xa7V\xb0\xa8}\x05\
+\xb9\xb0Lw\xa1\x93\xb0Z\xe1\xa1]?\xf3\xfb\xf09p\x06\x17\x87\x88\x8b\x91\xa6\
+\xd5bc\x9c\t\x11kH{\xb0\xb6{%?],%\x00-\x19\xac\xad@\x83$\xfe\xd2\xa0Z)S\x9b\
+\x1c\xe5\xea\x1f5\x8e\xfcf\xe9;>H\xe5\xca\xf9f\x05E\xb8[7!\xad\x9a\x89N@\t$\
+\xe9\x0bHz\xc1\x0fo\xd5\t$Dg3\xb0\x08\xf0\x13\x0f\x96\xa53\xe4:W\xd1\xb1\xb2\
+\xca\x03\xebk\xf4\x1d\x1f\xa44>FW>\x87\x8bB$\x05\xce4{\xc14\xab+\x8e\x11\xb1\
+\x88\x8dg\x9b\xd2\x0f2\x8a\xb0\\G\xd7\x1b\xf8\x1e\x18\x07\x96z\xf2\xdf\x9d\
+\x1c\xa5|\xddp\xe8\x97:\x00\x9d\x9dy\xea7o\x90\xf2\x05q&\xa9{k\x9ak\x83\x88\
+\x05\x11\x04\xc3\xcc%\xa1<\xcf\x17\x80\xb3\xafl\xa4ku7Af)\xa4A\xa73\xd8`)\
+\xd3\x13%V\xef\xd8\xc7\xb1O\xf7\xe2\x9c\x9b\xab{\x1b\xe3\x9a\x1d\x9c(7`#D\
+\x0c\x13\xd7+\xbc\xd7\x7f\x9c\x0b\xc3\x13J\xcdL\x153\xfdp\xf2\xb9\xf5dsm\xa0\
+s<\xbc\'\xb9r\xd7\xafY\x85V\x82\x15\x0f\x91\x18\xf0P\xd6\xa0\x14(\xe50V@{(\
+\x1c\x88`b\xc3\x85\xe1\t\x05\xa0\xfe:\xb6\xcc\x80\x00\x04i9\x8e\xdc\xad\xfc\
+\t\xd6\x99\x88\xe2\x05\x05y\x0b\x00\x00\x00\x00IEND\xaeB`\x82\xfdD\'\x91' )
+
+def getIconChooseImageBitmap():
+    return wxBitmapFromImage(getIconChooseImageImage())
+
+def getIconChooseImageImage():
+    stream = cStringIO.StringIO(getIconChooseImageData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconClassifyData():
+    return zlib.decompress(
+'x\xda\x01!\x02\xde\xfd\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00 \x00\
+\x00\x00 \x08\x06\x00\x00\x00szz\xf4\x00\x00\x00\x04sBIT\x08\x08\x08\x08|\
+\x08d\x88\x00\x00\x01\xd8IDATX\x85\xed\x97\xcdJ\x02Q\x18\x86\xdf\xa3nl\x15-B\
+\xf2\x06\\x\t\n\xe2\rDD.\x06\x97\x11\xba\n\xbc\x89 \x84p\x11\xb6q\x99\x0bs\
+\x11\x12.\x04!JpS\x90\xa1\xe4\xae\x08\x14\x13L\x11Lg\xc49-\xc2iF\xe783\xeah\
+\x8b\xde\xdd\x9c\x9fy\x9f\xf9\xbe\xef\xfc\x0c!\x16+\xd6)\xcbZ\xdd\xff\x01\
+\xfe\x02\x80m\x9eIT\x1cQV\x1f\xb1X\x89\xa9\x00T\x1c\xd1z3\xc6\xec\xdf\xd9>\
+\xa6F \x88\x91e\xa8e.\x83\x986b@\xcd\x95\x02-\xa9A\xb2"c\n\x00K[\xc1M\n\x00n\
+\xde\x8d\xbb\xab\x02\x99\x0b\xa0p[U<{|.C\xf39/\x87D<!=\xeb\x02\x90W} \x10W\
+\xf4\xa5Ra\xdd\x10\x9c\x97C\xf2>\xa9h\xd3\x04\xd0Q\xf5H\xa5\xc23\xdf\xe1\xf1\
+\xb9\x10\xba\x08M\x99\x03\x1a\xab\x80\x8a#:\xf9r\xb5\xafU\xabz\xe0\xb7\xf2\
+\x8f\xce\x0fi\xba\x98\x96\xda\xfb\xe5>\xfaO<a\x02\xcc\xdah\x8c\x84\xdc\xe9\
+\x88\x90\x83\xd3}\x9a\x7f\xce+\xda\xe5\x00S)XV\xc8\x9d\x8e\x08\t\x9eq4\xfb\
+\x98\x9d9V\x01\xa0g\xa3\xa97c\xcc\x90\x03\x90\xe0\xf6Nv5\xcd\x01Y\n2\xaf\xd7\
+\xb4\xd2\xaehN\xd0\x92\x7f\xc3\x8fh&\x8a\xc9\xb0\xcb\xd5{\xe8\x81\xaf\x0e\
+\x95)h|5P\xfe,/\x0c\x90\xbb\xcc\xa1\xf4Qb\xf6\x0b5\x01B]\x00\xf0\xb3)J\x00-\
+\xbe\x85b\xb3\xb80@\xbb\xd6\x06\xb1\xa9\x9fE\xfc;\x0f\xb1+\x82v\x894`e\xf7\
+\x81\xb1\xf9\xb8\xfaW\n \xd4\x04Us`\x05\x87\x11\xeb\xcb\xc725\x02Z\xe6\xa6\
+\x00\x8c\x0bpV\xd8\xe5\x92R`\xb7\xda\x97\x03`!\x18\xbc\rt\x99+\x00lC\x1b:7\
+\x1dP\x91y\x0c\xe8\xd2\xe0e\x00\x10\xe82\x07\x0c\xde\t\xcd\xd0\xda\xff\x0b\
+\xfe\x01\xd6\x0e\xf0\r\x00\x00\xe8s8\x01+#\x00\x00\x00\x00IEND\xaeB`\x82:\
+\x0b\xe4i' )
+
+def getIconClassifyBitmap():
+    return wxBitmapFromImage(getIconClassifyImage())
+
+def getIconClassifyImage():
+    stream = cStringIO.StringIO(getIconClassifyData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconConfirmData():
+    return zlib.decompress(
+'x\xda\x01\xac\x02S\xfd\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00\x16\
+\x00\x00\x00\x16\x08\x06\x00\x00\x00\xc4\xb4l;\x00\x00\x00\x04sBIT\x08\x08\
+\x08\x08|\x08d\x88\x00\x00\x02cIDAT8\x8d\xed\x94\xcfK\xd3a\x1c\xc7_\xcfw\x13\
+\xb5\xd0\x8ae\xb8\x8b\x9a\x11lzNf\xd6\xa4\x0eA\x17\xf54\xc4\xb3P&t\x92\xa0\
+\xff\xc2\x8b\x87@\n\xba\x95x0\xc8K\x17YaBP\xb3X\x86\x8c(\xdb\x1c\xd9\xbe\xfb\
+\xba\xf5\xfd\xe5\xf7\xbb\xed\xe9\x10\x85s\xdfM\x83\xba\xf5\x81\xe7\xf2|>\xcf\
+\x8b\xf7\xe7\xf3\xbc\x9fG\x08\xc5G\xa3\x98\xbayC\xe6\xf3yt]\xc74MVVV\x88\xc5\
+b<z\xbc \x1a\x9d\xf3\x1f\x06\x9d\x9b\x9bC\xd7u\x0c\xc3@\xd34\x1c\xc7\xe1\xed\
+z\x02@6\x82\xd7\x05\xff\x82f2\x19fggI\xa7\xd3d\xb3Y\xfa\xfb\xfb\x99\x9c\x9cD\
+\xcd\xe7\x1b\xc2\xeb\x82s\xb9\x1c\xd9l\x96\x99\x99\x99\xaa\xb6\xe3\xcf_\x90L\
+&\xe5\xf4\xad\xa9F\xcd\xa2xm\x8e\x8d\x8e\xc8\xf9\xf9y4M\xf3<\x14\x0c\x06)\
+\x16w\x19\x1a\x1adltDz\x16\t\xc5W\xb3"\x91\x88\\]]\x95\xe3\xe3\xe3\xd2+/\x14\
+\x1f\xc3\xc3\xc3rqqQF\xa3Q\xcf\x1aO\xc5\xb6m\x93J\xa5(\x95Ju[\r\x06\x83\x04\
+\x02\x01\xe2\xf1\xf8\xd1G\x91H$~\xbb\xa0Q\xf4\xf4\xf4\xd4\xcd\xd5\\\xde\x9d\
+\xe9\xb0\xbc\xf7p\x13\x00\xf5\xeb\x1bb\xa3\xdd\x12\xc0q\xca\xe8\xa6\x8b\x10?\
+G\xfadi\x81P(\x04\x80\xac\x94\xa5P|U\xee\x10\xfb\x1f\xc8\xdd\xdb}\xd2u\xcb\
+\xb8\xae$\x91\xd48\xdf\xdb\x8e[\x96\xb8\x8e\xc4-\x95\x11B\xe0\xb8\x15\x00*\
+\x952K\xcb_\xb8v5H\x93O\xe1\xe9\xb3\x0c\xfb\xe15\x8a\x9d\x92\x9f\xcbW.2\x18-\
+q\xf2T\x07\xe1\xf0\x00g:#4\xb7v\x02`\x167Q\xd5\xf7\xac\xbd\\fbB\xf2jm\x9d\
+\xadt\xee\xf0Q\x84B]\x84\xc3\x178\xdb{\tU\xdd`W\xdb\xe1\xf3\xd6\x03\n\xda\
+\x0e{{6\x8em\xb3g[X\x96\x81e\x19\xe4\xf2\x16B\xd4\xbe\x91\xaa\xcbKm\x87\x01h\
+ni\xad)\xf4\n\xa1\xb4\xd1q\xba\xdd3W\xa5XQ\x14\x8e\x07b\xe0\x1f\xa0\xb5\xed\
+\x1c~\xa3\x9dc\'L\xa4\xdf\xa0\xa9\xc5\xc4\xb2,L\xd3\xc44M0\x0c\xb0,d\xfa\xbe\
+\'\xd8\xd3n\x7f#\xfe\x83\xff=\xb8\xca\x15]\x1d\xef0T\x1d\xd7\xac`}/S\xb270\
+\x0b;\x14\x8a\xb9\xba>>\x92b\xbfOAU\x0bl~x}$U\xdb\xdb:\xdfr\xbb|\xfcT\xacM\
+\x1e\xfcGG\xaewK\xe0\x8f\xd7A\xce\x0f\x8d,5c\xa3{\x9d\xd7\x00\x00\x00\x00IEN\
+D\xaeB`\x82\xbctBr' )
+
+def getIconConfirmBitmap():
+    return wxBitmapFromImage(getIconConfirmImage())
+
+def getIconConfirmImage():
+    stream = cStringIO.StringIO(getIconConfirmData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconDeleteData():
+    return zlib.decompress(
+'x\xda\x01_\x03\xa0\xfc\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00\x18\
+\x00\x00\x00\x18\x08\x06\x00\x00\x00\xe0w=\xf8\x00\x00\x00\x04sBIT\x08\x08\
+\x08\x08|\x08d\x88\x00\x00\x03\x16IDATH\x89\xb5\x96\xbdo\x1be\x1c\xc7?g_\x9d\
+\x94\x0b\xa0p\xbdX\x89K\xa2\x88%lud\x85\x85(\x192\x92%\x8a\xd4\x8d\x8a\t\x84\
+\xc4\xc6\xd0\x81\xc5(\x12\xff@$\x0fL\xacQ`*\x0c\x0c\xad<T\xa8!\x90\x86\x17\'\
+"r*\x0b\x01jCLHj|\xf7<w\xcf\x8f\xe1j\xcb/gb\x86~\xa5G\xf7<\xba{\xbe\x9f\xdf\
+\xcb\xa3G\x07\xcfYV\xe7\xa2X,Z\xfb\xfb\xfb\xa6\xd9l\xe2\xfb>\xbe\xef3h\x1e\
+\x04\x01\x00J\xa9\t\xdf\xf7\x9f\xee\xed\xed\x05KKK\xa6\x17`w.\x96\x97\x97\
+\xad\x9d\x9d\x1d677\x13\xa3\xf1}\x9f\xb3\xb33\xea\xf5:\xab\xab\xab\x94J%2\
+\x99\xcc\x93(\x8a^+\x14\n\x8f\xcb\xe5r\xb3\x17\xd2\x05\xf0<\xcfRJ\x010;;\x9b\
+\x089==\xa5\xd1h\xe0\xba.\xf9|\x9eR\xa9D:\x9d\xae\x0e\x82\xa4:7;\x8ec\xb5R\
+\x1f$\xd7uq\x1c\x07\xcf\xf3XXX\xe8\x82\x8c\x8e\x8ef\x0b\x85\xc2\xd5r\xb9\xdc\
+\xf6M\xf5\x1a\xb42\xb8\x0c\xe2y\x1e\xb5Z-\x11\x92\xcf\xe7G\x8a\xc5\xa2\xd5\
+\xb7\xb1V\xab\xd9\xf3\xf3\xf3R\xadV\xc5\x18\xf3\x9fcmmM\x16\x17\x17ennN\\\
+\xd7\x15@\x001\xc6\xbc\xa9\x94\xf2*\x95J\x1azz\x00pY\x89Z\xda\xda\xda\xe2\
+\xe2\xef\xbfxT=\xe4\xf1\xef\xbf\xf1\xdd\xf7\xfb|\xf4\xf1\'X\x965\x96J\xa52\
+\x8e\xe3X\x89\x80aJ\x04`!\xbc8\xe6\xe0yY\xac("w\xbd\xdez\x95\xa2\xe3\xf8\xf7\
+\xf5\xe0\xe2\xe2\xa2=\x97{\xf7\xfa\x8c%\n\x89\x82\x7f\x08\x9b\xe7Dw\xb6\x99:\
+\xfe\x95\xa9\xec5r\xd9k\x89\x81\xf4\x01:\xb5\xb1\xb2\x82\xa4\xd3\xc9/\xbf\
+\xfe\x12{\xfd\x16\x1b++8#6N\xa6\xbf\xa7\x89\x80\xce\x12\xbd}|\xcc\x06 \xe94\
+\xfa\xc7=L\xa4\x89\xb4\x8f\xf9\xea\x8b\xd8\x1c\xb8\xb9{\x1f\xa3\x07\xf7\xad\
+\x0f\xd0\xd9\xe4\x99\x99\x996\xc4\xbeQ \xaa\xfc\x84\x1c\x1du\x99\xe7\\\x07\t\
+\x03\xc6F\xaf\xfc\xff\x0c\x00\xa6\xa7\xa7\xbb \xf6\x8dB\xdb|\xca}\x01\x13\
+\x06\x18\xed\x13\xf9O\x87\x03$\xe9\xd5\xdc$\xb7\x1f\xee\xb6\xd7\xb7\xb7?\xe3\
+zv|\x98\xad\xfd\x00\xadu{.b\x90P\x11\x1d\xfc\xdc\x8e|\x03\xb0\xd7oq\xe5\xc1\
+\xb7q\xe4\xda\xc7\xe8\x00\t\x93\x8f\xf7\xe0\x0cDb\xf3\xc3JWYn\xee\xdeoC\xae\
+\xfe\xf0\x0b\xa2\x03\x8c\x0e0\xc3\x02,+>n&\x0c\x88\x0e\x0f\xba\xccs\x13/39>\
+\xc2\xfa\xdd\xcf\xdb\x90\xb1\xa3?0\xda\x1f>\x03\x11\x89\x01:\xc0\xde\xde\x8e\
+\xcd\x1f\xdc%\xe7\xbd\x84\t\x03D\x07Lf_\xe1\xad;\x9f\xc6\x90\x87\x07H88\x83\
+\xbe\xab\xa2%\xa3}\xc2\x0f\xde\xe5\xc3\xf7\xdf\x89K\xa0\x03$\nbH\xa8\x98\xce\
+N\xf0\xde7[<\t\x15\x12\x85\x033H\x04\xa8\xf3?yt\x0e\x12*$T\x98gC"\x85\xd1\
+\xf1S\xb4\xc2\xb4\xd6\xcf\xbe\xbb\x14\xd0h4\x04\xe0\xf5\xfc\x1b\x83\x12\x1bF\
+\x11\xf1\xd5\xdd\x0f899\x11\xa5\x94g\xdb\xf6\xaceY\xe3@\x9a\x9e\x1f\x83\xcb\
+\xccE\xa4n\x8c\tZ\xc1>w\xfd\x0b\x1f\xfb\xe2^\xc8wMZ\x00\x00\x00\x00IEND\xaeB\
+`\x82Q\xdf\x93\x05' )
+
+def getIconDeleteBitmap():
+    return wxBitmapFromImage(getIconDeleteImage())
+
+def getIconDeleteImage():
+    stream = cStringIO.StringIO(getIconDeleteData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconDetailsData():
+    return zlib.decompress(
+"x\xda\xeb\x0c\xf0s\xe7\xe5\x92\xe2b``\xe0\xf5\xf4p\t\x02\xd2b \xcc\xc1\x06$\
+\x8fl\xc9\xb1\x06R,\xc5N\x9e!\x1c@P\xc3\x91\xd2\x01\xe4[{\xba8\x86X\xf4&'H\
+\xbcz`\xc3\xcc|\xb8\x9e\xcb0\x97QYj\xbe\x94\xd9\xa2\xd9\x9e\xb1\x06\xaf\x92r\
+\xd2\x82\xc4{vI\xcc\x9ey\x85u\xb1\xde\xb14\xb5RF\xd3\x18\x9fhq\xbeZ\x06\x86\
+\xae\xd3\x12'\xa6\xde\xf0p\x02\x1a\xc3\xe0\xe9\xea\xe7\xb2\xce)\xa1\t\x00\
+\xcf\x97#\xd3" )
+
+def getIconDetailsBitmap():
+    return wxBitmapFromImage(getIconDetailsImage())
+
+def getIconDetailsImage():
+    stream = cStringIO.StringIO(getIconDetailsData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconFileData():
+    return zlib.decompress(
+'x\xda\x01V\x04\xa9\xfb\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00\x16\
+\x00\x00\x00\x16\x08\x06\x00\x00\x00\xc4\xb4l;\x00\x00\x00\x04sBIT\x08\x08\
+\x08\x08|\x08d\x88\x00\x00\x04\rIDAT8\x8d\x9d\x95OLSY\x14\xc6\x7f\xef\xf5a\
+\xd3E\x81\x97\x00\xd5\xc4B#\xb6q\x07\x04*\x0bP\x08\t%\xa2\x04\x17\x92hX\x98\
+\xc0f\xe0\xcdB\x17\x84\x8dL4\xael23\x0b\x83\xba\xd2\x05qf6$l\xd8X\x08!\xe9\
+\xc2\x8d\t\x19\xb1\x12 @!\x81\x92bi\x11\xfa\xff\xdd;\x0bGb\x01\xff\xcc\x9c\
+\xe4l\xee\xc9\xfd\xce\xb9_\xbes?\x14\xd5\xc2\xd14\x0cC\x02\xf2\xa4\xda\x8f\
+\xe6\xc9\x87 gggeKK\x8b\xec\xec\xec\x94w\xef\xde\xfd\xcfM4\x8e\xc4\xcf\xc6\
+\xa0t:\x9d\x008\x9dN\xacV+\xd1h\x94\xcb\x97\x9a\xa5\xae\xeb\x9c?\x7f\x9e_\
+\x7f\xfb]9z\xefh\x1c\x03\x0e\x85B\xdc\xb8q\x03\x80l6\xcb\xd8\xd8\x18kkk\x8c\
+\x8c\x8c\xa0\xeb:\x91H\x84\xcb\x97\x9a\xa5\xd5j\xc5\xe3\xf10\xfa\xe4\xe9\x89\
+M\x94\x7f\x9f~\x18\x16U\x91\xd3\xd3\xd3\x8c\x8e\x8e\xe2\xf7\xfb\xa9\xaa\xaa*\
+\xa8\x7fnRTTD.\x97ccc\x83\xf2\xf2r\\.W\xc1K\n&6\x06\x07dMM\r\x00\xdb\xdb\xdb\
+TVV\x1e\x9b\xc4\xe5r166V\xd0DUU,\x16\x0bR\x98\xb2\xb7\xb7\x97?\xfe\xfcKQ\xbf\
+\xbc\x14\x0e\x87\xf1x<\x008\x1c\x0e\x14\xe5\xdbTVUUq\xcf\xef\'\x9dN#\xa5$\
+\x18\x0c\xf2\xf2\xe5K\x00\n\x80_\xbf~\xcd\xde\xde\xde!\r\xdf\x0bEQ\xf8\xe5\
+\xce\x1d\xdcn7B\x08\x92\xc9$W\xae\\)\xa4bp\xe0\'\xe9p8\x0ei()-\xfd.p6\x9be{{\
+\x9b\xea\xeaj|>\x1f\xd7\xae]#\x977\x95\x82\x89\xd7\xd7\xd7\xa9\xa8\xa8`kk\
+\x0b!\x04#\xf7\xeea\x9a\xe67\x81777q8\x1c\x98\xa6\x89\xae\xeb466\x1e\xd6\x0e\
+\x81gff\xc8d2d\xb3Yzzz(--\xe5\xe6\xcd\x9b\xb4\xb6\xb6\xf2\xe8\xd1\xa3\x13\
+\x81\x87\x87\x879w\xee\x1c\xa6i\xb2\xbb\xbb\x8b\xddn\xff\x82&\xd5\x8218 m6\
+\x1b\xe5\xe5\xe5h\x9a\x86\xaa\xaa\x98\xa6\x89\x10\x02\xab\xd5\xca\xfa\xfa:\
+\xab\xab\xab\xec\xec\xecp\xf5\xeaU\x86\x86\x86\x08\x87\xc3\xdc\xbe}\x1b\xaf\
+\xd7KGG\x07\xed\xed\xed(\xaa\xa5Pn\xa1P\x88\xb6\xb662\x99\x0c\x81@\x80\x83\
+\x83\x03\xce\x9e=\x8b\xd7\xeb%\x99L\xa2\xeb:eee\xe4\xf3y666\xb8u\xeb\x16\x91\
+H\x84\x8b\x17/\xa2\xaa*%%%\xd4\xd4\xd4\xf0\xf7\xdb\xf9B*\x82\xc1 \xe9t\x9ah4\
+J}}=\x13\x13\x13\xb4\xb6\xb6\x12\x08\x04\x08\x06\x83,..\x92H$\x10B`\xb7\xdbq\
+\xb9\\444\x90\xcb\xe5\xd8\xdf\xdfg\x7f\x7f\xff\xd8")\x86aH)%6\x9b\x8d\xe5\
+\xe5e\xba\xba\xba\xe8\xef\xefgoo\x0f!\x04[[[\x8c\x8f\x8f3;;\x8b\xaa\xaa\xd4\
+\xd6\xd6\x92\xcb\xe5\x10B\x90\xcf\xe7\xe9\xee\xee\xa6\xb3\xb3\x13S\xc8\x02\
+\xd1[\x92\xc9\xe4\xfd\xea\xeajR\xa9\x14\xd1h\x94\x87\x0f\x1f\x92H$\xf8\xf0\
+\xe1\x03RJt]\xe7\xc2\x85\x0b\xc4b1b\xb1\x18\x0b\x0b\x0b\xc4b1,\x16\x0b\x9a\
+\xa6\xd1\xd4\xd4\xc4\xd2\xd2\x12kk\xe1\x07_\x02\xabuuu<~\xfc\x18!\x04\x99L\
+\x06!\x04;;;\xe4\xf3y\xa2\xd1(\x0b\x0b\x0b,//3??OCC\x03>\x9f\x8fT*\x85\xa6id\
+2\x19\xe2\xf18\xa7O\x9f>\xa6\x18\xcb\xdb\xf9w\x0f\x8c\xc1\xc1\xfb+++\xcc\xcc\
+\xcc\xf0\xe6\xcd\x1b\xce\x9c9\xc3\xa9S\xa7\xf8\xf8\xf1#\xe9t\x9a\xb9\xb99\
+\xde\xbf\x7f\x8f\xc3\xe1\xa0\xb8\xb8\x98x<N6\x9b\xa5\xaf\xaf\x8f\xf6\xf6v\
+\xe6\xdf\x85\x8e\xed\xbe\n\xf0\xe4\xe93%05\xad\xa0\xa8\x8a\xdb\xed\xe6\xc5\
+\x8b\x17477\xe3\xf7\xfb\x89\xc7\xe3LMM\xd1\xd2\xd2\x82\xddngrr\x12U\xfd$\xff\
+\xe2\xe2b\xbc^\xef\x89\x1a?\xf6\x1f?y\xfaL\x81O\xce\xe2v\xbb\xe5\xf3\xe7\xcf\
+y\xf5\xea\x15\x00\xd7\xaf_\'\x95J!\x84\x00 \x91HPVVv"\xf0\x0f[\x8da\x18\xd2\
+\xe7\xf3I@\xfa|>\xd9\xd3\xd3#5M\xfb\xaae\xfd/\xa3\xfcl\xb6\xbd\xbd\xbd_\x05\
+\xfe\x07=\xf2\xc7sN*\xbd\x9b\x00\x00\x00\x00IEND\xaeB`\x82\xc9p\x11\xe0' )
+
+def getIconFileBitmap():
+    return wxBitmapFromImage(getIconFileImage())
+
+def getIconFileImage():
+    stream = cStringIO.StringIO(getIconFileData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconForwardData():
+    return zlib.decompress(
+'x\xda\x01\\\x06\xa3\xf9\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00\x18\
+\x00\x00\x00\x18\x08\x06\x00\x00\x00\xe0w=\xf8\x00\x00\x00\x04sBIT\x08\x08\
+\x08\x08|\x08d\x88\x00\x00\x06\x13IDATH\x89}\x96]l\x1cW\x15\xc7\xff\xf7cf?\
+\xc6\xde]{\x9d\x8d\x9d\xc4\xb5L\xec\xd4\x11U\x10\xb1\x00Q\xcb\x91\x9284RJ\
+\x91\x05iH\x91\xa0\x92#p\xfb\xd6J\xc8%\xca\x0b\x10!\x1e\x10\x12O\x04T\t!\xa4\
+\x944\x05\x95\x07[\xc1\x12\xca\x03i\x04\x89J\x12\xa3X1)\xadc\xaf\xd7\x1f\x89\
+w=3\xbb;3w\xe6\xce\xe1!\xbb\x96\xdd&\x1cit\x1f\xe6\xea\xf7\x9b{\xce\xb9G\xc3\
+\xf0\x7f\xc2\xb6\xed\xa4eYy\xc6X\x861\x96\x06 \x1b\xaf""\xaa\x13\x91S\xab\
+\xd5\xd6\xb3\xd9\xac\xff4\x06{\x1a\xb8\xa5\xa5e\x0fcl\'\x00\x01 n\xec\x8d\
+\x00Ps\x9f\x94\x92\x01\x10\x8c\xb1\xd5r\xb9\xbc\xf8$\xd1g\x04a\x18\x16\x84\
+\x10\xcf2\xc6$\x11y###\xd9c\xc7\x8e\xed2MST*\x15\xcfq\x9c\xa0\\.\xfbsss\xd5\
+\xb5\xb5\xb5\x88s.9\xe7\xd2\xf3<\x01\xe0N\xa9TZy\xaa \x8a\xa2\xddB\x88g\x89\
+\xa8>::\x9a\x1f\x1a\x1a*\xf4\xf5\xf5uy\x9e\xa7\x8a\xc5\xe2\xda\xef\xfe\xf6\
+\xd1\xef\xf7%W_XXX\xf0\xd2\xe94\x97RBk\x9d\x14BD\xbe\xef\x9bJ)a\x18\xc6\xbfo\
+\xde\xbc\xf9\xe03\x820\x0c\x0bR\xca\xcf\x13\x91\x9a\x98\x98\xe8>p\xe0@W"\x91\
+0]\xd7\xadU*\x15\xf7\xf6\xed\xdbk\xef\xcf\xea\xa9\xea\xbf\xde\xc1\xf1\xe3\
+\xc7\xbf\x96\xc9d\xb4\x10\x82\x01\x80i\x9aL)E\xae\xeb&]\xd7M$\x12\x89\x7fNOO\
+/\x01\x00o\xe6\\\x081@D\xde\xc4\xc4D\xf7\xa1C\x87\xf6\xb5\xb5\xb5\xb5p\xce\
+\xf5\xd2\xd2R\xe5\xe2\xc5\x8bK\x8f\x1e=\xf2\x01\xe0\x8bo\xbe\x8d+W\xaeL\xe7\
+\xf3yQ(\x14Dgg\xa7\xdc\xb1c\x87\xe8\xec\xec\x94{\xf7\xee\r\x07\x06\x06\xaa\
+\xc9d\xf2K\xa7O\x9fN\xa3\xd9\x15---{\x00\xd0\xe8\xe8h\xfe\xe4\xc9\x93\xbb\
+\x00@\x08\xc1fff\x8aSSS\xe5B\xa1\xc0\xda\xda\xda8\xd6\x80\x97\x9e?\x08\xe0m\
+\xfc\xfa\x97g\xa6\xcf\x9f?\x7f\xe2\t5\xa4l6\xeb\x87a\xd8\x07`F\xda\xb6\x9dd\
+\x8cu\x01\xd0CCC\x85L&c\xd5j\xb5\xea\xec\xeclirrr\xa3P(\xb0|>\x8f|>/0\xb7\
+\x86\x9d\xed)\xbc\xf7\xa3W\xf0-\x00\xe7\xce\x9d\x99\xbcp\xe1\xc27\x9a\xf08\
+\x8e)\x0cCRJ!\x08\x82=\xe3\xe3\xe3\xff\x95\x8d>\x17G\x8f\x1eM\x8f\x8d\x8d\
+\xe5\x7fu\xf9\xfaO\xca\x15\x07s\x9f,\x82\xf1n\xdc+\x02(V\xd1j\xe9\xc7\x90(\
+\xc6\x8d\xff\x94p\xe3\xe7\xdf\xc3\x97\x01\x8c\x8f\x9f\xf9\xcb\xa5K\x97\xbeID\
+\x14E\xd1\xa6@)\xc5\x0c\xc3\xd8-\x19c\x19"\xa2#G\x8etFQ\xa4\xeb\x9e\x8fW_\
+\xff>^8\xd8\x8f\xbe\xb6\xc4\xb6\xe3\xff\xfd\x93\r,\xd7\x03\xbc_t1X\xa9oJN\
+\x9d:\xf5\xa7\xc9\xc9\xc9\x97\xa3(""\xa2 \x08\xc8\xf3<&\xa5\xec\x90\x8d\x1b\
+\x1a\xa7\xd3iseee\xdd\x0f\x14\x9e\xdf\xb7\x0b\x93\xf7\x16q`w;\xda\x93&J\xae\
+\xc2\xf5\xa2\x83\rO\xe1\x0fK.\xe0*\x00\xc0O\xbf\xd2\xb5)9q\xe2\xc4\xbbW\xaf^\
+\xfd\xb6\xd6\x9a\x0c\xc3 )%\xe3\x9cge\xa3\xd0\xda\xb6m\xdfq\x1cO\xc7\x84\x0e\
+\xcb\x84\xed\x84\xf8\xf1\xea2z\x93\x02K\x11\xc3\x8d\xd5*\n1\xc0V\xd6\x01\x8a\
+1u\xf7q\xca\xc6\xfa\xdb\xf0\xee[\xaf\xe0e\x00\x87\x0f\x1f\xfe\xe3\xb5k\xd7\
+\xbe#\xa5\x8c\x1b\x82Ts\xb6\xc4\x95J\xc5\x9b\x9f\x9fw\x1e\xae\xb7\x80 \xa0\
+\xad\x14\xee|x\x0fw\xea\x0e`\x98@\xc2\xc2C3\x05P\x0c2R@\xf0X\xf0\x8bj\x8c\
+\xbb\x7f\xbd\x81\xea\xe2\x1a\x00\xc0\xb2,\x11\x86a\xb3\xe8\\\xe2\xf1|1\xca\
+\xe5\xb2\xbf\xb0\xb0\xe0\xd9a7\xdc D\xbb!\xd1\xfe\x85g\xd0\x93K \x91\xb60\
+\xbfRF92\x00\xec\x04_\xf6\x10w\xa5P\xe9\xca\xe2\xee\x07s\xa8~p\x1d\xf6\xe5\
+\xb3\xb8\x7f\xff\xfe\x98\xd6\x9as\xce\x9b\x02-\x89\xa8\xce\x18\xcb\xce\xcd\
+\xcdU\xd3\xe94g\xae\xc0\x8b?\xbb\x8c\xbak\x03\x00\xee\x02\xd0\xdc\x0078\xa2\
+\x9e\xcf!fi$\x9e\xdb\x85\xc1\x9e\xdc6\xf8\xf2\xf2\xf2kZk\xa9\x94b\x00\xa28\
+\x8ea\x9a\xa6#\x89\xc81\x0c#\xd7\xdd\xdd\x1d\xf5\xf4\xf4\x08\x00X\xfc\xed\
+\x0f>}\x7f\x00\x00-\x07O\x83\xbd\xfe\xc66\xb8\xfb\xde98\x8e\xf3\xc30\x0c\x13\
+Z\xeb\x10\x00\x9a\x85\x06\xf0P\xd6j\xb5u\x00\xbd\x86a\x80\x88\x8c\x97\x9eK\
+\x8dt\x8e\xbc!\xf3\xf9\xbc\xe8\xe8\xe8\x90\xb9\\N\xb4\xb6\xb6J\xcb\xb2\xc4\
+\x8bo\xfe\xe6\x9dL\xb5\xbe\r\xeeV\xdd\xb3\x9c\xf3tc\xe0\xd5\x84\x10\xb1\x10\
+\x82I)\x19\x11=\x90\xd9l\xd6\x17B\xac\xfa\xbe\xbf\xcf\xf3<\x16E\x91\x16B\xc4\
+\xcd\xaff\x8c\xb1\xadka\xe1#|\xbc\xb8\x06\xfb\xf2Y\xd8\xb6\xfd\x16\x00a\x9a&\
+)\xa5\x84\x10"!\x84\x08\x85\x10,\x8a\xa2\xf9\xe1\xe1a\x9b\x03@\xb9\\^4\x0c\
+\xa3\xe6\xfb~\xc2\xf7}\xa6\xb5\xdeL\x0b\x11\xd1\xd6\xb5\t_^^~-\x8a"\x1f@\xa8\
+\x94\xe2q\x1c\x87Zk\xa5\xb5\x8e\x1b]y\x1bhL\xd3l6\xeb\x07Ap\x0f\x80\n\x82@nl\
+l\x98\xcd\xd9\x12E\x115o(\x80\xad\xdd\x12k\xadC\xdf\xf7C\xa5\x94\x1f\x86\xa1\
+j\n\xea\xf5\xfa?\x86\x87\x87\xedM\x01\x00\x94J\xa5\x95T*5\xe3\xban*\x0cC\xda\
+\xfa\x10\x11i\xad\t\x00n\xdd\xba\xf5]\xad\xb5VJi\xa5T\xa4\x94\xf2\x83 p=\xcf\
+\xab+\xa5\xa2Z\xad\xf6\xe1\xfe\xfd\xfbg\x9b\\\xb1\xb5KJ\xa5\x92\xdd\xdf\xdf\
+\xef\xc4q\xfc\x0ccL\xe6r\xb9XJ\xc9\r\xc3`B\x08\xf6\xea\xd7\xbf\xfag!D\xb3$\
+\xa4\xb5F\xe3$\xb1\xd6:\xaa\xd5j\xd7\x07\x06\x06f\xb62\xb7\t\x00`~~\xde\x19\
+\x1c\x1c|\xd0\xde\xde\xceL\xd3l5\x0c\x83q\xce\x99\x10\x82\t!\x18\x11\x81s\
+\x8e8\x8e\x195\xc2\xf7\xfd\x8fWWW\xaf\x0e\x0e\x0e\x16?\xcd{\xe2_E3\xc6\xc7\
+\xc7\xad\xde\xde\xde\xdd\x99L\xa6\xc3\xb2\xaclkkk*\x99L\xf2D"\xa1M\xd3t\x00<\
+$\xa2\x07\xcd|?)\xfe\x07\x99\xe4k\x84v+\x10\xc3\x00\x00\x00\x00IEND\xaeB`\
+\x82V\x11\x19\xf8' )
+
+def getIconForwardBitmap():
+    return wxBitmapFromImage(getIconForwardImage())
+
+def getIconForwardImage():
+    stream = cStringIO.StringIO(getIconForwardData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconGuessData():
+    return zlib.decompress(
+'x\xda\x01\xd5\x02*\xfd\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00\x16\
+\x00\x00\x00\x16\x08\x06\x00\x00\x00\xc4\xb4l;\x00\x00\x00\x04sBIT\x08\x08\
+\x08\x08|\x08d\x88\x00\x00\x02\x8cIDAT8\x8d\x95\x92ML\x13Q\x14\x85\xcf\x9b\
+\xe9\xbfH\t"\xd4\xe0\x0f\x05!\x1a4Eh\x94\xb81\xc1\x85+\xa3\t\xd1\x15A\x97& +\
+\x8d.\\\x1b%\xda.\xdc\x18\xc3B4&\xc6\xbdQ\x84\x95\x02\xf2\xa3`L\n\x04j\x0bT"\
+PJ)\xb4\xa5\xed\xf0\xe6\xba01\x8e3e\xa6\'y\x9b\x97\xf3\xbe\xdc{\xcecL\x10\
+\x91O$s:v\xc2\x03\t"2\x92\x0c\x89s\x10\xe7\x90rYd3\xdb\xc8\xc4WX\xbe\xb7B>`\
+\xb1\xd3I\xfe\x81 \x8e^\xec\x84\xcd\xee\x80\xd9j\x87\xd9b\x87\xc9j\xc3\x81\
+\xa6\xf3\xa8ni\x03\xc9\x9c\xcc%.\xd2b\xb0\xff\'&\x99S\xcfP\x18}\x81(>\xf9:\
+\x10\x9b\x0f`\'\x97UN&\x88t\xa1\xeb1\xd6\x92\x9b\x08}\x19\xc4\xfa\xc4;0ATxT\
+\x13\x1f\xa9\xa9C_ \x8a\xa9\xb7\xcf\xb1<3\xae\x86\x02\x80\xcc\xd9{\xdfM\x94\
+\x15\x15\xe3p\xcbu\xfd(H\xe6\xd4\xf5\xe4\r\xa23\x93\x08\x8f\xf5\xa9\xa6P\xac\
+*\x88l\xae\xbf\x17\xf6}\x95\xa8\xbf\xe1\xc3\x9e\x1a\xaf"\x12\xd5\xc4#?s\xd8L\
+\xacAJo\xe5c\xfe\x95\x94J\xa0\xbc\xc8\x04\xb3h\x05\x98\x12\xa5\x02\xaf~\xff\
+\x08\xee\xa8@\xed\xb9V\x14\x97\xee\'gi\x99f9\x00\xb0\x18\x9a\x83\xc5*\xc0\
+\xc4w\xc0Sq\xe5FZ\xe5\xd5^{\x80\xa2\xca*8\x9c.X\xb9\x84o\xcf\xba\x10_\x9cU\
+\xc4\xd2\xe0=C\xed\xf7_\xe0\xe5\x87ILt_\xd1/\x8f\t"\x9b\xeb\xbd\x8b\x8d\xe91\
+\xa4\x16\x03H\xacD\xb0>?\xad\xf0x\x1a\xbd\xd4\xe1\x7f\x85\xd7\xe3!l\xfe\x18\
+\x81\xad\xc2\xad^\x87\t\xa2\xe6\x01@\x00\xc8\xe1\xf6\xd0\xbf\xf7M\xa7\x9b\
+\xa9g(LM\x0f\x87\xc9}\xa9\x93,e\x87H\xf3}>\xb0\xd6\xa9\xf74R\xcfP\x98\xbc\
+\x8fF\xa9\xee\xea\x1d\xb2\x96WiB\x0b\x02\x9flh$\xff@\x90\x9a}\xe3T\xd3z\x8b,\
+\xa5\x95y\xa1L\x10\xd5\xe5i\x89dN\xfe\x81 \x86C\xeb\x08\x05g\xf1\xb5\xbbm\
+\xd7?\xaeY^>-,\xaf \x1c\x97\x90\\\nB\xb0\xed\xd5\xf5\x1b\x06\x8f.1dC\x9f\x91\
+\xf8\x15\x81\x9cK\xeb\xfa\rE\x01\xfc\x89\x03\x00\xac\xaej\xe4V\x17v\x8d\xa1 \
+p\xa12\x1cE\xa12\x195\xba=\xcd\x94Ng\x90\xda\x88"\x19]\xd2\x8d\xc2\x10\xf8\
+\xe0\xf1St\xf9\xdeSDb\xdb\x88$\x19Fn\x9f%F\xf2\xaepC\xe0x,\x86\xe1\x85\x0c0\
+\xd5\x8f\xd9\x89A\x80K\x80N7\x86\xcb3\x97\xb8\x88\x88\xc0\xb7\xb7@\xb9\xb4n\
+\x14\xbf\x01y\xf6\x16\t`\\\x85x\x00\x00\x00\x00IEND\xaeB`\x823\xcbH\x81' )
+
+def getIconGuessBitmap():
+    return wxBitmapFromImage(getIconGuessImage())
+
+def getIconGuessImage():
+    stream = cStringIO.StringIO(getIconGuessData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconHelpData():
+    return zlib.decompress(
+'x\xda\x01\xd5\x02*\xfd\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00\x16\
+\x00\x00\x00\x16\x08\x06\x00\x00\x00\xc4\xb4l;\x00\x00\x00\x04sBIT\x08\x08\
+\x08\x08|\x08d\x88\x00\x00\x02\x8cIDAT8\x8d\x95\x92ML\x13Q\x14\x85\xcf\x9b\
+\xe9\xbfH\t"\xd4\xe0\x0f\x05!\x1a4Eh\x94\xb81\xc1\x85+\xa3\t\xd1\x15A\x97& +\
+\x8d.\\\x1b%\xda.\xdc\x18\xc3B4&\xc6\xbdQ\x84\x95\x02\xf2\xa3`L\n\x04j\x0bT"\
+PJ)\xb4\xa5\xed\xf0\xe6\xba01\x8e3e\xa6\'y\x9b\x97\xf3\xbe\xdc{\xcecL\x10\
+\x91O$s:v\xc2\x03\t"2\x92\x0c\x89s\x10\xe7\x90rYd3\xdb\xc8\xc4WX\xbe\xb7B>`\
+\xb1\xd3I\xfe\x81 \x8e^\xec\x84\xcd\xee\x80\xd9j\x87\xd9b\x87\xc9j\xc3\x81\
+\xa6\xf3\xa8ni\x03\xc9\x9c\xcc%.\xd2b\xb0\xff\'&\x99S\xcfP\x18}\x81(>\xf9:\
+\x10\x9b\x0f`\'\x97UN&\x88t\xa1\xeb1\xd6\x92\x9b\x08}\x19\xc4\xfa\xc4;0ATxT\
+\x13\x1f\xa9\xa9C_ \x8a\xa9\xb7\xcf\xb1<3\xae\x86\x02\x80\xcc\xd9{\xdfM\x94\
+\x15\x15\xe3p\xcbu\xfd(H\xe6\xd4\xf5\xe4\r\xa23\x93\x08\x8f\xf5\xa9\xa6P\xac\
+*\x88l\xae\xbf\x17\xf6}\x95\xa8\xbf\xe1\xc3\x9e\x1a\xaf"\x12\xd5\xc4#?s\xd8L\
+\xacAJo\xe5c\xfe\x95\x94J\xa0\xbc\xc8\x04\xb3h\x05\x98\x12\xa5\x02\xaf~\xff\
+\x08\xee\xa8@\xed\xb9V\x14\x97\xee\'gi\x99f9\x00\xb0\x18\x9a\x83\xc5*\xc0\
+\xc4w\xc0Sq\xe5FZ\xe5\xd5^{\x80\xa2\xca*8\x9c.X\xb9\x84o\xcf\xba\x10_\x9cU\
+\xc4\xd2\xe0=C\xed\xf7_\xe0\xe5\x87ILt_\xd1/\x8f\t"\x9b\xeb\xbd\x8b\x8d\xe91\
+\xa4\x16\x03H\xacD\xb0>?\xad\xf0x\x1a\xbd\xd4\xe1\x7f\x85\xd7\xe3!l\xfe\x18\
+\x81\xad\xc2\xad^\x87\t\xa2\xe6\x01@\x00\xc8\xe1\xf6\xd0\xbf\xf7M\xa7\x9b\
+\xa9g(LM\x0f\x87\xc9}\xa9\x93,e\x87H\xf3}>\xb0\xd6\xa9\xf74R\xcfP\x98\xbc\
+\x8fF\xa9\xee\xea\x1d\xb2\x96WiB\x0b\x02\x9flh$\xff@\x90\x9a}\xe3T\xd3z\x8b,\
+\xa5\x95y\xa1L\x10\xd5\xe5i\x89dN\xfe\x81 \x86C\xeb\x08\x05g\xf1\xb5\xbbm\
+\xd7?\xaeY^>-,\xaf \x1c\x97\x90\\\nB\xb0\xed\xd5\xf5\x1b\x06\x8f.1dC\x9f\x91\
+\xf8\x15\x81\x9cK\xeb\xfa\rE\x01\xfc\x89\x03\x00\xac\xaej\xe4V\x17v\x8d\xa1 \
+p\xa12\x1cE\xa12\x195\xba=\xcd\x94Ng\x90\xda\x88"\x19]\xd2\x8d\xc2\x10\xf8\
+\xe0\xf1St\xf9\xdeSDb\xdb\x88$\x19Fn\x9f%F\xf2\xaepC\xe0x,\x86\xe1\x85\x0c0\
+\xd5\x8f\xd9\x89A\x80K\x80N7\x86\xcb3\x97\xb8\x88\x88\xc0\xb7\xb7@\xb9\xb4n\
+\x14\xbf\x01y\xf6\x16\t`\\\x85x\x00\x00\x00\x00IEND\xaeB`\x823\xcbH\x81' )
+
+def getIconHelpBitmap():
+    return wxBitmapFromImage(getIconHelpImage())
+
+def getIconHelpImage():
+    stream = cStringIO.StringIO(getIconHelpData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconHomeData():
+    return zlib.decompress(
+'x\xda\x01\x08\x05\xf7\xfa\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00\
+\x18\x00\x00\x00\x18\x08\x06\x00\x00\x00\xe0w=\xf8\x00\x00\x00\x04sBIT\x08\
+\x08\x08\x08|\x08d\x88\x00\x00\x04\xbfIDATH\x89\x9d\x95\xcdO\x1bG\x18\xc6\
+\x9f\xb1\xd7\xc6Vl\x0b\xd7@\xc1\x95\x83\xe2\xa4M\x081JP#\x93\xa4\xc2B\xca\
+\xa5\xea!R/\x1c"\xa5)\x12\x11\x97\xfc\x07\x95,\xf7\x90\xfc\x07(\x12\t\xca\
+\xa1\xb4\xca\xad\x12Q>\xaa\x1aa\xf5\xe4J\xcd\x07P\xd3\xdaq\xec\xd8\xb1\xdd\
+\xb0\x8b\x975\x1b\xec\xdd\x9d\xd9\xe9\x81\xda\xc2\x04J\xdaW\x1aiG\xf3\xce\
+\xf3{\xe7\x99\xd9\x19\xe0\x80H$\x12\x16Q\x14\xed\x008\x00n\x18F\x9f\xa6i\x9d\
+\xa2(\xda\x13\x89\x84\xe5\xa0\xf9m\x11\x8b\xc5H*\x95\xb2\x8a\xa2h\x17E\xd1^\
+\xa9Tl\x8a\xa28\x82\xc1 \xcfd2|ll\x8c\x07\x83A\xce\x18;\xae\xebzW\xb5Z\xed\
+\xf8O\x90W\xaf^\t\xa3\xa3\xa3\xcdJ?\xd4u\xdd\x17\x0c\x06y.\x97\xe3\x0b\x0b\
+\x0b|aa\x81\x8f\x8d\x8d\xf1\x91\x91\x11n\x9a\xe6\xa0\xae\xeb\xdd\x07AZ\x03\
+\xb1X\x8c\xb8\xddnk\xb3o\xb5Z?:q\xe2\x84\x14\x8f\xc7Q*\x95 \x8a"DQ\xc4\xd4\
+\xd4\x14\x9cN\'zzzV\x04A\xe8q\xb9\\\x9eP(d\xdb\x0f"\xec\xec\xd8\xed\xf6\x16\
+\xe0\xd8\xb1c\xbf\xc5\xe3q\xe4\xf3y\xcc\xcd\xcd\xb5M\x8aD"\xe8\xed\xed\x85\
+\xdf\xef_)\x97\xcb\xa7\\.\x17B\xa1P-\x91H\x18\x91H\xc4\xdc\x17@\x08!\x00p\
+\xfe\xfcy\xcc\xcd\xcd\xa1T*\xe1\xc6\x8d\x1b\x10\x84\xb64\xe4\xf3y\x0c\x0e\
+\x0eb``\x00]]]+\x92$\xed\x0b!\xcd\x8fT*e=r\xe4\xc8\xa1\xb3g\xcf*\xf3\xf3\xf3\
+\xc8\xe7\xf3-\xf1\xc9\x89\t\x84N\x9f\x06\x00,?{\x86\x99\xd9YPJ\xd1\xdf\xdf\
+\x8fl6\x8b\xe7\xcf\x9fC\x92\xa4S\x94\xd25UUk\xcb\xcb\xcb-\x08i\xfa\x9fL&\x0f\
+\x15\n\x85\xcd\xf9\xf9y\xe4r9\xdc\xbcy\xb3M\xfc\xf0\xe1\xc3\x00\x80B\xa1\xd0\
+\x06\xe9\xeb\xebC\xb1X\xdc\x17Bb\xb1\x18\xb9~\xfd\xba\xfd\xdc\xb9s\x8dG\x8f\
+\x1e!\x99L\xe2\xce\x9d;\x10\x04\x01S\x93\x93\x18:s\x06~\xbf\xbf\xcd\xa2r\xb9\
+\x8c\xa5\xa7Oqkf\xa6\r\xf2\xe4\xc9\x13\xc8\xb2\xdc\x06!\xa2(\xda\xc3\xe1\xb0\
+\xf6\xf8\xf1c<x\xf0\x00\xf7\xef\xdf\x87 \x08\xb8r\xf92F.\\@oo\xef^\x87\x03\
+\xb5Z\r?=|\x88\xef\xef\xdd{g%\xa2(\x0e2\xc6\xd6\x14E\xa9\t\xe1pX\xbb}\xfb6\
+\x12\x89DK|||\x1c\x83CC{\x8as\xce\x01\x00\x1e\x8f\x07\x9f\x86\xc3\xb0;\x9d\
+\xb8{\xf7.*\x95\n\x02\x81\x00\x00\xc0\xeb\xf5\xfe.\xcb\xf2\xc7.\x97K\x17VWW}\
+\x03\x03\x03\xeb\x0e\x87\x03\xca\xfa:&\xae]\xc3\xf0\xf00:;;\xb7\x15\x8d\x06~\
+\xfc\xf6+H\x85"^.\xad\xe2\xaf\xb7\x1c\xb3\xe9\r\xc0h\xc0\xeb\xf5\xc2\xe7\xf3\
+!\x10\x08 \x99L"\x9b\xcdB\xd34(\x8a\xf2\x05\xe7\xdca\xb1X\x04\xc14M#\x93\xc9\
+\x1c%\x84\xf8\x03}}\xbf\xec\xaex\xe6\xeb\x08\xfa/\x8ec\xfcZ\x0c\xd5\xdc\x12~\
+\xbd\xf5\r&>\xe9\xc4w\xf9-\xd8\xa9\x02\x8f\xc7\x03\x9f\xcf\x07\x00\xc8f\xb3\
+\x93\x00d\xcey\x8ds\xbee\x9a\xa6aQUU\xa3\x94\xca\x9c\xf3\xb2\xcd\xe9lUn\xb3\
+\xd9\xb6\xed\xf8`\x14\x9f}\xfe%\xd8\xc6K\xbcM=\xc4\xd1\xe1a\xf8\xac\x1a\x98\
+\xae\xef\xb55*\xe7\xfc\r\xe7\xbcB)\x95UU\xd5,\xd3\xd3\xd3F\xb5ZU)\xa5r>\x9f\
+\x87\xd5\xba\xfd3\x13B@\x08\x81R\xccA\xabIx[L\xc1\xb2\xf1\x02\xb5\xd4\xcf\
+\xe8\xb0m\xab1]\x87\xc3\xe1@www\x13\xd0\x00\xb0A)\xadV\xabUuzz\xda\xb0D\xa3Q\
+\x9eN\xa7\x19c\xcc\xd8\xab$\x931\xd4k241\x8f\xc6\x9b\x0c\xa8a\x80\x90\xf6\
+\x1c\x8b\xa5u\rQ\xce\xb9\xc1\x183\xd2\xe94\x8bF\xa3\xdc\x02\x00\x8b\x8b\x8b\
+\x9c7\x8f\xc7;\x04\x13\xbaZEc\xed\x05Lj@\xd3\xf7N\xdb\x11mZ\xefu\x97k\xeaf\
+\xeb\xbbi=\xdd\xa7\x9e\xdd!\x1c\x94P\x11E\xd4\xd6\xca\x10JK\xa8o\x19\xa8\x1b\
+\xdb\xfe\x08\xbb}\xfa\xbf\x00B\x08j+qt\xa8uP\xc6\xa1\xeb\x003\x0f\x9a\xb5\
+\x07\xa0\xe9\x9b$Ix\xfd\xfa5\xea\xf5:\xdcn76\x1a\r\xfc\xb1T\x84\x85Ql5(4S\
+\x80b\x00\xd9\\\x0e\x9b\x9b\x9b\x90\xd6\xd7!IRK\xe6\x9f\x86\xc5\xc5E\xde\x06\
+`\x8c\x99\x94\xd2\x80 \x08\xc5\xddU\xfc\xf0\xe7\x8e\x15\x81\x82\x03\x98=y\
+\xb2-\xe7b\x07\x01\x00\r\x00\xdb\xb9\xc9\x02\x00D\xa3Q~\xf5\xeaU\xeap8T\xc6\
+\xd8qBH7!\xc4\r\xc0\x8a\x1do\xc6\xbf\x04\x07\xa0q\xcee\xd34\xeb\xba\xae\xb3\
+\xe6@\xeb\x89\xf4z\xbd|hh\xc8\xb4\xd9l:!\xa4\x0e@\xe1\x9c\xcb\x9c\xf3\xf5\
+\xf7lU\xd34eJ\xa9*\xcb\xb2~\xe9\xd2%\x13\x00\xfe\x06[\xba\xed|Z\x9c\x8b\xca\
+\x00\x00\x00\x00IEND\xaeB`\x82\xc3Mi\xc0' )
+
+def getIconHomeBitmap():
+    return wxBitmapFromImage(getIconHomeImage())
+
+def getIconHomeImage():
+    stream = cStringIO.StringIO(getIconHomeData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconImageData():
+    return zlib.decompress(
+'x\xda\x01\xe5\x03\x1a\xfc\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00 \
+\x00\x00\x00 \x08\x06\x00\x00\x00szz\xf4\x00\x00\x00\x04sBIT\x08\x08\x08\x08\
+|\x08d\x88\x00\x00\x03\x9cIDATX\x85\xb5\x97\xcdN#W\x10\x85\xbfv_c\xc7\x04&B\
+\x8c\xa2\x8c\xa2\x89\xb2\xc92\x1b$\xd6<\x03/\xc3\x03$Y\x98\x1d\x8f\xe1W\xe0\
+\x1d\xbc\n\xca*R\xc40\x82\x0c!\x8e\xcc\xc8\xc6\xdd\xf7VU\x16\xb7\x7fl\xcc\
+\xb8\x8dg\xb8R\xab[\xdd\xd7uN\x9dSU\xedN\x92V\xca\xaa\xf5\xdb\xaf\xbf\xd8\
+\xc3\xc3\x03y\x9e3\x9b\xcd\xf0\xde#"\xa8ju\x9e\xcdfdYF\x96e\xa8*\x93\xc9\x84\
+\xf1x\xcc\xc5\xc5\x05F\x92\xac\x8a\xefV\xa2\x03\xe3\xf1\x98\xe3\xe3\xe3\xa6m\
+\x15\x89\xfb\xfb{\xc6\xe31\x00\x83\xc1\x80\xf3\xf3sKZ\xe9\'I4\x12H\xd3\xa8\
+\xd0\xe1\xe1\xe1\xca}fF\x92$L\xa7SF\xa3\x11\x93\xc9\x84\xc1`@\xbf\xdf\xe7\
+\xe4\xe4\xe4\x93$ZM\x04\xa6\xd3i\xd3\x96\x85\xd5\xeb\xf5\xd8\xdb\xdbc{{\x9bN\
+\xa7\xc3\xd1\xd1\x11\xfd~\x1fS\xb1\x8d\x08\xa8\xea\xb3\x08\xcc\x93\x80\xa8\
+\xdc*\x12\x8d\x046]\xbd^\x8fN\xa7\xd3H\xa2\x91\x80\xd9\x93\xca\xad\xb5\xba\
+\xdd.\x97\x97\x97+I\xbc(\x81v\xbb\xcd\xf5\xf5\xf5J\x12\x8d]\xf0\xb9\n\x9c\
+\x9e\x9e\x12B\xa8\x8e<\xcf\t!ppp\xc0p8\xb4\x17%pvv\xc6\xbb\xcb\xbf\x98L?\xf2\
+\xcf\x87\x1b\xfe\xbey\xcf\xd5\xbb\x1b\xee?N\xb9\xba\xbab8\x1c~9\x05\x92\'\
+\x06^\xbb\xdd\xe6\xed\x0f?r{{\xcbvo\x87\xafw\xf6\xd8\xdf\xdb\xe7ntG\xda\x8a\
+\xfb_T\x01\xef=\x00\xbb\xbb;\xa4\x89\xd2z\xbd\xcf\xf6V\xbc\xf7\xe6\xdb\xd1z\
+\x046\x99\x03\x00"\x81\xc4\x02y6#\x05\xba[-$\x07\xe9\xed\xf2\xe6\xbb\x84\xff\
+F\x1f\xd6#\xb0)\xb8\x89\xaf\x0e\x00\xd7\x82\xaf:m$8\xdc\xee\x0e\xdb\xc5\x8c\
+\xf8\xe2m(>\xaf\xc1Up-\x08a\x86\xa8 \xe2\xe9n9\x12\xf5\xb84DbM\x01\x9fc\x81\
+\xf8\x1cSA5\x9eM|\xfc\xbd\x14`i\x8b\\ft\xda)&\xb2\x1e\x81u\x15\x08>\xab@\xcd\
+jpSO\x9a\x1ay\x96G\xc0\x04r\x15:[\xe9z\x04\xd6!(\xa1\xce\xd84\x12P\t\x91\x88\
+zL\xa4\xaa\x85\xf8\xdc\xd7\xaa4\x01\xac\xb2\xc0\xcc\xa2\xec\x16\xfd6\x8d\xe7\
+\n\xbc$\xa4\x82K\x94<\xd4*\x98}\xa6\x05"\xa1\x06\xad$\x0f1[]$\x14m\xa9;\xc2\
+\xc4\xe3\x8a\xb9\xb5\x11\x01\t\x8f24\xa9\xc1\xcb\x1aP\x8f\x05\xbf`\x833%\x0b\
+Y\x0c\xa2kZ\xf0\x98@\xcc|.\xb0\x96\xe0\xbe\xce\xde$\x82?\xee\x08\x8bE\t`l`A5\
+`Jy\xe7*\xbd\x02\x17A-_\xb2@U1\xf1\xa4\x89\xa1\xc5\xdeg\x13\x98\x1f0\xa6u\
+\xd0J\x01{\xc2\x02d\xa96b\xac5\x15(\xbb\xa0\x9apEFR\x82-\xc9>wm\x8f\xc0\x8b{\
+\x98\xd0\x02~\xfe\xe9\xed\xfas`\xde\xeb%\xd9\xe7kb\x8eH\xe9\xb9\xa9,\x14\xa4\
+\x88\x92\x98\x07\xf7\x0c\x0bT\xf2E\xf0\xf9V+A\xe7\xed1\xadA\x83\xafgE\xf0P\
+\xd8D\x08\xcd\x04\xa4\xf0\xca\xd4/O\xb79\x9f\x17k#,\x14e\t\xae>\xaf\x03\x87g\
+\xb6\xa1\xa9,M\xb7*\xc3\xb28\x1f{.sm\x18\xfcB\\M\xd6$P~\x19yQ\x10!\xd0\x02Mq\
+\xe1\x01\x01B\xb2\x85C\x11\xf3\x80\x81\x1a"E\xa6\xaa$\x80\xa8\xc5\x17\x7f\
+\x91u\x946\x00\xae\x99\xc0d2A\xb2\x7f\xf9\xe3\xf7Q\x91\xc9\x03\xa8\x82\xe5E\
+\xf6\x02\x1a\xe2`\t\x81\xa4T\xc1<\xe6\x05\xb5Xp\xa5\xe7\x9a\x84\xeaE\x04\x81\
+\xa4\xe9\xf3\xfc\xf5\xfe+\xfb~\xff\x1bp]\x083p]B\x088Bu\re@\x07a\x86s.\xeeq\
+\xc4\xbf\xe3tq\xae\xd8\x13\x02\xc5\x03\xfe|\x7f\xc7\xff\xf8dO\x1dW\xde\x8a\
+\x88\x00\x00\x00\x00IEND\xaeB`\x82\n7\xd5\x1f' )
+
+def getIconImageBitmap():
+    return wxBitmapFromImage(getIconImageImage())
+
+def getIconImageImage():
+    stream = cStringIO.StringIO(getIconImageData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconImageBinaryData():
+    return zlib.decompress(
+'x\xda\x01X\x07\xa7\xf8\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00 \x00\
+\x00\x00 \x08\x06\x00\x00\x00szz\xf4\x00\x00\x00\x04sBIT\x08\x08\x08\x08|\
+\x08d\x88\x00\x00\x07\x0fIDATX\x85\x9d\x96\xcdo\\W\x19\xc6\x7f\xe7\xdcs\xbf\
+\xe6\xc3\x9eL\xc6\xf9\xa8\x13\xbb"$]\x15$\x16\x11\x88RETl\xaa\n\x94\xb6B]!*\
+\x16\x80\x94}\xb6 `\xe1\x7f\x815\x12\xf2\xae\x8b,P\xb2\xa9\x10RW\x91\xaa6,PS\
+\xcb\x8e-\x8c\xf3a2\xd3\x99\xb9s\xcf\'\x8b;\xf7\xdaNj\xbb\xe2\x95\xae|\xed{|\
+\xde\xe7}\xdf\xe7y\xce\x11BF\x9c\x14\x7f\xfa\xe3\x1fBQ\x14h\xad\x99\xcdf\x18\
+cp\xce\xe1\xbdo~\xcef3\xca\xb2\xa4,K\xbc\xf7L&\x13\x86\xc3!\x0f\x1e<  \xc4I\
+\xfb\xab\x13\xb3\x03\xc3\xe1\x90w\xdf}\xf7\xb4e\r\x88\xd1h\xc4p8\x04`}}\x9d\
+\xbbw\xef\x06!\xa3cA\x9c\n \x8a\xaa\x0e]\xbf~\xfd\xc4u!\x04\x84\x10L\xa7S\
+\xf6\xf7\xf7\x99L&\xac\xaf\xaf\xb3\xb6\xb6\xc6\xed\xdb\xb7\x8f\x05!O\x030\
+\x9dNO[r$Z\xad\x16\xfd~\x9fv\xbbM\x9a\xa6\xdc\xb8q\x83\xb5\xb55\x82w\xe1\xff\
+\x02\xe0\xbdo\xdeC\x08_\xfb\x1c\x07\x02\xaa\xce\x9d\x04\xe2\xd4\x11\xfc\xfc\
+\x8d\xef\xd2\x8e\x02\x1b_>$R1\xce\x18\x8a\xe7\xcfy\xfc\xc5\x17\xfc\xf0\xbd\
+\xf7\x08!\x10E\x11B\x88f\\5\x884M\x1b\x10\xc0\xd7\x8e\xe3X\x00\x9f\xfe\xfdo\
+\xe1\xcc\xcak\xc4q\xdcT\x19B I\x12\xda\xdd.\xe7VW\xd9\xdb\xdb\xe3\xf1\xc66\
+\xd7\xbe\xf7:Q\x14\x91$I\x03\x06 \xcb2\xb6\xb6\xb6X]]=\x16D$\xc4\xcbSx\xb4\
+\xb5\x19z\xe7\x97I\xd3\x94,\xcbh\xb5ZdYF\x96e\xc4qL\x14E8\xe7PJ\xb10\xe83\
+\x99L\x88\xe3\x18\xadu\x03@\x08\xc1\x9d;w\xb8v\xed\x1a\xde{z\xbd\x1e\xcb\xcb\
+\xcb\xc4q\xcc\xd5\xabW\xb9w\xef\xee\xef\x84\x90\xbf\x17/\xfa\xc0\xf6\xa3\xad\
+\x90\xe79Y\x96\xa1\x94B\x08\xd1h\xde9\xd7t\xc3{O\x08\x01k-\xde{\xb4\xd6\xe4y\
+\x8e\x10\x82N\xa7C\x1c\xc7\xdc\xbau\x8b\xdd\xdd]\xac\xb5\xcd\xa3\xb5\xc6ZKY\
+\x96\xdc\xbf\x7f\x9f#\x00v\xb6\x1f\x85V\xabE\x9e\xe7M%\xce9\x8c1x\xef\xb1\
+\xd6\xe2\x9ck\xe6]\x83\xd3Z\x1f\x01\xd9\xe9t\xe8t:\xf3=\xb7\x98L\xbf\xe2\xc9\
+\xde.\xff\xd9\xdda\xfb\xd1.\xa3\xaf\xa6loo\xf3\x97\xbf\xae\x1fp\xe0\x9f\xf7?\
+\x0ey\x9e\x93\xa6\xe9\x91\xcd\x9ds\x94e\xd9T\x1fB@J\xd9\xa8CJ\x89R\n\xe7\xdc\
+||O\xe8\x9f-\x00\xe8v\xbb\\^y\x95\'O\x9e\xd0nu\xe9t\xfb\x0c\xfa\x03\x9e\xee?\
+%\x92\xe2(\t\xcf\\\xf86J\xa9\x97\xda\xae\xb5\xc6\x18C\x08\x01\xef\xfd\x11\
+\xa6\xd7Q\x93NJ\xc9\xca\xea\x12\xfb\xfb\xfb<{\xf6\x0c\xef=\x9dN\x87\x85\x85.\
+\x91\xf0\xc8\xa5\x01\xed\xc4\x00\xf0\xca\xf9\xfd\x03\x00\x9f~\xf2Q\xc8\xb2\
+\x0c)e\xd3\xf6z\xbe\xd6Z\x84\x10\x8d\xd3\x89C\xd6^\x83\xa9GR\xaf\xfd\xec\xe1\
+cV\x061q$\x10^W\x04N$N\x83k-\xf0\xcaE\xc1\x7f\xf7\xf7\x0e\x00t\xcf^iZY\x13\
+\xac\x9ey\x9d\xa0\x06q8y\xfd\xb7\x1ap\xfd\x7fWV\xce\xf2x{\x83n+EIO\x1c\t\x94\
+\x84<\x8dqV\xa1\x16\xba\xb4\xe7\x1e\xa1\x00"\x95\xa3\xb5nf\xed\xbdGJ\xd9\x98\
+\x0c\xd0\x90\xf1\xb0\x0c\xeb\x8457\xac\xb5\xd5\x1a\x11\x18\x8fG\x0c\x9f\xb7X\
+\xec\xe4\x94\x89$I\x12\x9c3d\x89\xa2(\nTd\x0f\x00\xfc\xfa7\xbfeuu\x95^\xaf\
+\xd7T>\x1e\x8f\x9b\xaa\xea\xf6\x1bc\xe8v\xbbMW\xeao\x87\x15\xe2\xbd\xa7,K~\
+\xf2\xd6\x9bL\'cf\xe5\x8cV\x16C$Q\x91D\xbb\x19i\x1c\x11\xe6\xa4U\xd5f\x95\
+\x94j\x8d\xd6\xcc\xaf7w\xce5g\xfc`0`<\x1e\x1f\xe9V\xfd^wq:+\xf9\xf1\x9b\xdf\
+\xc7:\x8b\xb3\x1a)=\xce\x96\x08!P\x02\xb4w\xa4It\x00 \xce=\xc6\x18\xa6\xd3)\
+\xce\xb9#\xa6\xe1\x9cc4\x1aQ\x14\x05Y\x96a\x8c\xa1\xd7\xebQ\x96%\xb3\xd9\xac\
+\x91_Y\x96\x00\xd5\x85%J\xaa\xb1xK\xf0\x86\xe0\x1c!8\x10\xa2\xfa=\x18p\x87F\
+\xd0:\xa7pCGQ\x14\x8d\x12\xb4\xd6L\xa7S\xc6\xe31Z\xebF\x9e5\xb8Z5\xf5M\xa9\
+\xe6\t\x80o-"\x08\xe0]\x03BE\x11\xc6U\x12T\x82\n\x10\xf3\xe3x\xfd\xcf\xf7\
+\xc4\xe6\xe6&\xb3\xd9\x8c\xa2(\x9a\xeaF\xa3\x11eY"\xa5DJ\xd9(\xa4v\xbc(\x8a\
+\x1a"\xd6\xc6\xa4\xb5\xe6\xc3\xb7\xdf@\xe0\x11\xc2\xcf\x81XB0\x04w\xf0\xa8\
+\xb9\x9a\x1b#\xca.&\x94e\x891\x06c\x0c\x93\xc9\xa4Ir\x18@-;\x80\xa2(\x9a\xb6\
+{\xef)\x8a\x82\xd0\xed\xb3|\xf1\x1cI\x1c\x91\xc5\x8aX\n\x04\x8e\xe0\x02*xJ[\
+\x8d\no\x0f:\x00\xf0\xf1G\xff\x10\x9b\x9b\x9b\x14E\xc1d2\xc1\x18\xd3$\xad\
+\xc7R\x9b\x90\xd6\x9a\xf1x\x8cs\x8e\xf1x\x0c\xc0h4\xc29\xc7/\x7f\xfa\x16\xb1\
+\x92\xb4\xb2\x84N;\'M\x04\x02O\xf0\x06\x17\\\xc5\x01o\x08\xb8\xa3\x00\x00>\
+\xfb\xfc\x81\xd8\xd9\xd9i\xc8\xa8\xb5n\xbe\xd5Z\xafg^W\\\x14\x05\xc3\xe1\x90\
+\xd9l\xc6\xfb7\xdf\xe1\xf2\xc5s\xb4\xf3\x84\x85n\x9bn;%\x89\x15"Tj\t\xce\x10\
+\x89\x80\x98\xf3\xe2\xc8\x08\xeax\xf8\xe5\x86X\xb9|)\xb4\xdb\xed\xc6t\x8c1G\
+\xdc\xb0\x96\xe7d2\xa1,K\xb4\xd6\xbc\x7f\xf3\x1d\xae\xbc\xbaL+O\xe8\xf7\x16\
+\xe8\xf7:t\xf2\x848\n@\xa8\x94\xe0\r\xc1W\x95\x1f\xf1\x81\x17\xe3\xd1\xf6\
+\x8e\xf8\xd6\x0f^\x0f\xc5\xbf\x87\xb4\xdb\xed\x86lu\x07j\xaf\xd0Z\xa3z}~\xf5\
+\xc1M\x96\x06=\xdaY\xca\xd93\x0b,\x9d]\xa4\xbf\xd0&Kc\x04\x81\xe0\xaa\x11\
+\x04k*\xf6\x07\x87\x04\xbesm\xe5\xf8+\xd9\xc6\'\x9f\x0b\x80\xd7~v#L7\xf6p\
+\xd3\t\xd2\x83\xf5\x1e\x91e\xf8\xc53|\xf0\xa3\xeb\xac^\xba@\x12G\xb4\xf2\x94\
+\xfeb\x97\xa5A\x8fA\xafK+WH\x19 8\x82wM\xf2\xe0\r\xceyD0\xa0\xbe\xc1\xa5ty\
+\x04o\xff\xe2C\xce\x0f\xce0\x99TD\x93\x04Bp\x08 \x89%\xad<e\xb1\xd3\xa2\xdf\
+\xeb\xd0_\xac\x92G\x91D\xf8\xca\x80\xaa\xe4\xa6\x01\x82\x9bw\xc2\xda\xd3\x01\
+dY\xc6\x85\x0b\x17\xb8\xb8\xb4\xc8d\x9c\xe3\x9d\xc5{\x03! \xf0d\xb1\xa2\xd3\
+\xcdY\xc8S:\xed\x8c,\x89\x902T\xc9\x1b\x17\xac\x92{s@j\xec!\'<)\xe28fii\x89\
+\x95\xcbK\xcc\x8a1\xcehB\xb0\x04\xef\x10\xde\x13\xc7\x92,\x96$J\x12+\x89\x10\
+\x1e|h\x92{\xaf\x0f*?\x14^|C\x00eY\xd2n\xb7Y\xec\xf5\xe8\xb6RL\x08U\xeb\xdc\
+\x18\'\x04^$\xa4A\xe3}u\xe8`=\xd6\xcd+\xf5\x1e\x018\x1f*\xc1\xcf\xab\x06\xe6\
+g\x81:\x1d\xc0t:E\xb8!\x0f\xff5\x9cWR\x80\xf7\x10t5_\xe7\x10\xc1U\xc6b\xed\\\
+\xf3s\xeb5\x0e\x1f*\xc2\xd53\xf7\xc26\x07\x11X^\xba\x96\xbf\x18K\x83\xc5pi\
+\xd0\x03\x95\x81\x9d\x81\xca\xb0\xd6\xa2\xb0\xcd;\xd4\x1b*\xb03\x94R\xd5\x1a\
+Eux\x91\xa1\xd4|\x8d\xb5\xcc?\xf0p\xe7)\xff\x03\xefr\x03\xfbGX\x1cS\x00\x00\
+\x00\x00IEND\xaeB`\x82\xf5\x12\x8cO' )
+
+def getIconImageBinaryBitmap():
+    return wxBitmapFromImage(getIconImageBinaryImage())
+
+def getIconImageBinaryImage():
+    stream = cStringIO.StringIO(getIconImageBinaryData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconImageBrowserData():
+    return zlib.decompress(
+'x\xda\x01Z\x08\xa5\xf7\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00#\x00\
+\x00\x00$\x08\x06\x00\x00\x00\x03\xdc\x83\xe1\x00\x00\x00\x04sBIT\x08\x08\
+\x08\x08|\x08d\x88\x00\x00\x08\x11IDATX\x85\xcd\x98}lS\xd7\x19\xc6\x9fs\xee\
+\xbd\xf8^;\x89\xe3|5\x81@\x1c\x12\'!I\x83\xa8\xc2\x80\x8e\xe1\x14\x06I\xd0@\
+\xa8\xa3|\x156\xe8&m\x83RU\xa0U\xa0\xa1\xa4 D\xbbU\x1a\xad\xb2iL\x15\x1d4\
+\x14m\x94@\xa4iC\xa8\x12\xd8\xa5\x10\xd1,\x1d\x9bX\xe9\xda2\x08"\ts\x92\xe2\
+\xc4\xdf\xbe\xf7\x9c\xb3?\x1c_HH\x88;-\xd2^\xe9\xc8\xd69\xbe~\x7f\xf7y\xde\
+\xf7\xf5\x95\x81\xff\xa3 \x93~\x80\x90p\xf2\xbd\x10\xc2:\xb58\x8f\x89\x82\
+\xfc\xdcp8\x14\x12\xc1`P\x18\x86!\x08!\xe1\xe4\x9a\x8a|\xf2c\x0fY\x10C\xc3\
+\xc3\x00\x80h4\x8aP0\xa8q!\xa0\xaa*\x14E\xf9\x9f+6\x99M\xe1\xbe\xbe>m\xec\
+\xa6\xa2(\xb0j\x1a\x1e\x02\x8b\x8c\x07\xf6u-\x1eW\x99\xba:/\xf5x\xdc|\xa2\
+\x8b\xe2\xf18b\xb1\x18\xc4\x08\xccD\x8a}]%\xe9x\x9b\x1e\x8f\x9b\xbf\xb7\xb1\
+\xcc*=\xa4\xdb\x9e={\xd0\xd0\xd0\x80\x86\x86\x06tvvB\x08\x01!\x04\xc2\xe10\
+\xfa\x07\x06000\x00\xbf\xdf\x8fP0\xa8\x05\x02\x01M\xd7u\xad\xa7\xb7\x17\xbd\
+\xbd\xbd\x8f\xec\'\x15\xf3z\xbd\xa3\xf2\'\xd3\x89q\xf6P\x9co\x8b^\xf9\xeb\
+\x97\x16\x00X\xd9P\x8fw\x8e\x1d\x8b\x10Bq\xf8\xf0a\xed\xda\xb5k\x00\x80\x03\
+\x07\x0e\xa0\xa6\xa6\xc6\x84Ke\xf5\xf7\xfb\xb0t\xe9\xb2H,\x16+\xea\xe8\xe8\
+\x18t\xbb\x13.\xc8\x00\xc4\x95\xfe\xbfa\x96\x9c\x07\x00(t\x14\x98`\xe9\xcb~\
+\x98\x94\x15\xb9\x19\x14,\x1a \x15\x95O\x8a\x97w\xbe\x18\x81$!\t\xd6\xd4\xd4\
+d\x82UVVN\n\x93\x0cEQ\x16\xce\x9f?\xff"\x80`R\x05\xf1\xf6\xa7m\x98F\x15\x00\
+\x80+\xbb\xc8\x04\x9b\xf7\xfc2p\x9e(\x9d\xd2B\'^_\xb9J/vU\x0bE\xcb\x10V{\x9e\
+\xb0X3\xc4\xe7_\xdc4\xbf|\xacb.\x97kB \x9f\xcf\x87\xfa\xfaz0\xc6\xaa/]\xbat\
+\xc3\xedvs\xd3\xa67>y\x07\x00\x90\xa9\xdaM\xb0B#\x0b\x95\x85e\x00\x80\x9aMu\
+\xe0\x9c\xa3\xb4\xd0\x897\x1b\x9f1r\x9csyVa%W\xd3\x1c\x82\xd2D\x1f\xf4\xde\
+\xfa\x07\xc0\xa2 \x86\x8e\xfdo\x1e\x1b\x05V\\\\\xfc\x08LCC\x038\xe7\xab#\x91\
+\xc8E\xab\xd5\x1a4a\xd6\x9c\x7f\x19\x00Pe/A\xe64\x1b\x00 \xcd\xaf \'\'\x07\
+\x0e\xcd\x0ec8\x86\xb9%U&\xd8\xf3\xcfm\xc2\x8e\xb9\xf3\xe39\xb3\xaa\xb9\xc5j\
+\x17\xe0\x1cL\x8f\x82\xeb\x110#\x8a\xc1;7 \x84\x01"\x0c\x1c\xfc\xed\xb9Q`3g\
+\xce\x84\xcf\xe7Ccc#8\xe7\xeb9\xe7]\x92$\xdd4[\xfb3\xff-\x00@@\x0f#]It^ux&\
+\xa0R\x0c\x04\xbf\x02\xa2\x1c\x81;Q84;\xae\x9f\xf4\xa0zS\x1d6\xd8-T\xb5e\x0b\
+JeA\x01\xc4\xc2~\x12\xf6\xf7\x92Xx\x08T\x96\xa1Z\x1dB\x92$\xb1g\xdb\x92\x08\
+\xc47!t\x1d\x1b\x7f\xda\xa4\x1d=ztT\xed$C\x06\x80_6n\x99\xb1k}k\x8f\xb3u9\
+\xba\xd1\x07y\xa4\xe3\xd9\xfd \xee\x1a\x03\t\xcb\xe4\x1c\x13,i\xcb\x90\xef\
+\x16\xd52\xf3\x84`Q(\xd6tQ\xb3}\xa3\x9a\xac\xb13\x9b\xd7\x18\x19\xd93\xb8-=K\
+X3r\x85\xa2(b\xf0\xee\xe7fCL\x08\x13XP\xda\x87s@Z\xd0\x0eb\xd1 IQ\xf8\xa9\
+\x1f\xf7\x86\xfbq\x9f\x04\x01\x00\x83\xa2\xdf\x04\xf3\x85\xef\xa3j\xfe\\lj\
+\xbf@)\xf5\xd0\xf6\xad\x1b\x8d\xb4\xec\xe9\x82s\x8e\xeb\xbf\xff\x10\xa0@\xcd\
+\x86:\x99s\x8e\xb6\r+\r\xc7\x13E<#\xeb\t.xL\x00\x00\xe7\xdcl\x8cG`\x9a_m\x16\
+\x00\x10\xf8w\x10j&\xa0H2\xd2d;\x94\x98\x82iq\x0b\x86\x11\xc0\xbd\xc8\x03\
+\xb0\x90\x1e\xc1\x8f\xbe\xfb=\x14m\xdd\x83bG\x01\xaa7,\x91\x01\xe0\xc9\x05\
+\xf3\xf0\xd1\x9d.84;\xfe\xf8\x9b\x93pf\x14\xa2j\xe3b\xf9\xf4\xba\xe5\x86"\
+\xcb\x82\xb1\x04\xccc\x951\xadz\xb5\xb5\'\xf3\x07\xf3`\xcd\xcf\x82\xa2(\xb0D\
+\xad\xa0\xb2\x02M\xb2\x81\xc5t\x13\xacg\xa8\x17\xbf\xee8\x0e\x00(H\xcf\xc7\
+\xaf~q\x18E\xe9\xd3Q\xec(@\xfb\xa7\x1f` \xf8\x152\xac\xe9pf\x14\x02\x00\x82\
+\xfe\x01j\xcb\xf0q\xc2\r\x02\x08p\xce\x1f\x0f\xb3\xeb\\k/\x00\xfc\xbd\xe9\
+\x0c\xb2\xb3\xb2\xf0\xbb\x0b\xed8p\xf20\xb2\x0b\xa6CQ\x14(\x92d\x82\xd1i\x12\
+$I\x8c\x0bfS\x12\xbf\xab\xe5\xb9N\x9c\r\x9f\xc7_\x8e}\x80\xda\xad\xcb\xe9\
+\xa9g\xedTUUA\t\xc0\x18\x9b\xd8\xa6\xd1A\x00B\xb0m\xe9\x1a|\xbfn5\x18c8q\xe9\
+O\xa3\xc0l\xe9\x1a$e\xda\xb8`\x94R\xd3J\x9b\xa2\xe1\xe9\xfc\xa7\x00\x00\xb1H\
+\x80(\n!\x94\x00\xba\xae\xa7\x04Cf\x159\xc5\x9d\xee[\xc8\xb4\xdb\x13w \x04\
+\xd6-\\\x81\xb5\xdf\xf86\x18c8\xdbu\x11\x07\xcf\xb4\xc0\xe1\xc8K\tl00\x04J)X\
+\xd0\'\x19\xaa\x85\xab\nE<\x1eOU\x99D\xe8\x86\x01\xc6\x98YlIiW\xcd\xfd\x16VV\
+-\x02c\x0c\xe7?\xfbxR\xb0W>|\x03\xa7^?\x8a\xb5\xafl\xc3\xbb\xf5Y\xc4\xa6\x11\
+\xc4\xe3q0\xc6R\x85!\xd0u\x1dB<(6\xcey\x02n\xe4\x95s\x8e\xa5%\xf3\xe0\xde\
+\xf56\x18\xe7\xf8\xe8\xce\xf5\t\xc1\xfeu\xefn\xe2\x06\xf5\x18\xb1*\x14\xb1Xl\
+\xdc"\x1e\x0f\x86l\xde\xbcE\x9c8\xf1.8c\xa0\x92\xf4@\x99\x11\xa58\xe70\x0c#1\
+/Dbf,((G\xfb\x8f\xdf\x02c\x0c\x1f\xf7\x84\xf1\xf3?\xef3\xc1\xbe\xe8\xb9\x05J\
+)$=$e\xa8\x04\xa1P(\x91\x88\x90Iap\xdf\xefGk\xeb\t<\xbdh\x11\xb2s\xb2\xa1Z,\
+\x10B\x80\x10b*\xc48\x1b\x81L\x80%!9\xe7x*O\xc1\xc9-\x87\xc0\x18\xc3?\xa3>\
+\x1c<\xd3\x82g\xbf\xb3\x16\xab\xb6\x1f\xc0\x0b\x8d.#\x16\x8b\xc9\x92$\xa5f\
+\xd3\xd5\xabW\xd3\xd3\xd2l\x01J\x08\x08\x01\x8e\x1c9\x829\x15\x15\xb0\xa5\
+\xa5\x01HLPB\x00\xce\xc5\x03\x85\x92\xf6\x8dX\x98\\+*\x16 4\xa7\x07=7z\x00\
+\x00\xd9vU\xd6u=\xf5\x9a\xe9\xec\xec\x0cG\xa3\xb1<EQ\x16\x02\xd0d\x89\xfe\
+\x81\x8c\x80\xb5\xb4\xb4\xa0\xccU\x06[\x9a\xcdLH\x081A\x92\xf5\xc4\x18C\xf1\
+\xec\x12\x9cm?\x8b\x8a\x8a\n\xf4\xf4$`\xac\x16\xc9,\xe01.\x8d\xff\x0c\xecv\
+\xbbyGG\xc7`8\x1c\xbe\xc09\xef\xd2\rV\xad\x1blu\\g\xeb\x7f\xb2\xfdE\xac\xa8\
+\xaf\xc7\xe2\xc5\x8b\xd1\xd9\xd9\x89\xe1\xe1a\xe8\xf1xb\x8d\xcc\x0f\xcey\x02\
+\xe4\xec\x19T\x94\x97\xc3\xe5*Cnn.^\xda\xb9\x03\xfb\x8f_\x83a\x18\x88\xc7\
+\xe3\x90\xc6d\x9f\xb0\xb5G\x9eKC\x00nz\xbd^Z[[{[U\xd5|\xc6X5!d\xf6X\xc5\x0e\
+\x1d:\x84\xd2\xd2RX5\r\xce\xe2\xd9hkkCe\xe5\x1c\xb8\xca\xca\xd1v\xfa}\x94\
+\x95\x95\xa1\xbf\xbf\xdf\xb4Y\xd7uH4\x85\x02N\x15L7\xc6\x07\xdb\xba\xed\x05,\
+}\xa6\x0e\xae\xb2r\x9c~\xff\x14\\.\x17\xe6TV\xe1\xf2\xe5\xcb&\x8ca\x18\xb0ZR\
+J\x9fZ8\x9d\xddr(\x14\xb21\xc6J8\xe7UB\x88U\x84\x90\xf5\x12%B\x96\xa8Pd*\x9a\
+\xf6\xfdL|\xd2\xd5%\x9a\x9b\xf6\x89\xf7Z\x8f\x8b\x97v\xee\x10\x00\xc4\xde\
+\xbd{\xc5\xec\x19\xe9B\x08\xb1\x8e1V\x92\xb22\x13\xc5\xed\xdbE\x86\xcd\x06\
+\x03\x0f)f\x18F>!d\x94b\x87^{\r\x84\x00\xbbw\xef\x1eu\xbd*?h\xef\xfd\xfb\xf7\
+O\xfa\'\xc4\x7f\x15^\xaf\x97\x8eUL\x08\xb1.\xa9\x98,Q\xf1\xdc\x92"!\x84\xd8*\
+\x84X\xc5\x18+\xf6z\xbdtjh\xc6\x80\xd5\xd6\xd6j\xaa\xaa\xe6\x13B\xd4\xa4b#\
+\xc7\x11\xce\xf9\x97\x9c\xf3\xfbW\xae\\\xf1M5\xcb#`I\xc5F\x96S\xd7\xf5\xfc\
+\xe4\xd9\xb8sf*"Y\x13\xdd\xdd\xdd\xd1\xa1\xa1\xa1\xbb\xf1x\xbc\xdf0\x8c!\xc3\
+0B}}}\x8a\xc7\xe3\x11Sn\xd3D`uuufn\x8f\xc7#\x9a\x9b\x9b\xc5\x7f\x00\xb1\xbe\
+\xf0\xc2n9\x80M\x00\x00\x00\x00IEND\xaeB`\x82\xc7D\xdc\xec' )
+
+def getIconImageBrowserBitmap():
+    return wxBitmapFromImage(getIconImageBrowserImage())
+
+def getIconImageBrowserImage():
+    stream = cStringIO.StringIO(getIconImageBrowserData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconImageComplexData():
+    return zlib.decompress(
+'x\xda\x01\x9b\x04d\xfb\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00 \x00\
+\x00\x00 \x08\x06\x00\x00\x00szz\xf4\x00\x00\x00\x04sBIT\x08\x08\x08\x08|\
+\x08d\x88\x00\x00\x04RIDATX\x85\x9d\x97Kk\x1bW\x14\xc7\x7f\xa3\x19Y\x8aT\x9b\
+\xd4\xd8}8\x0f\xa7\x85nR\xd2B\nY\xb4u\xe2/\xd0EB\xba,\xb4\xd0u\x16%\x8b|\x01\
+\x83\td\xe1M\xbe\x837\xf9\x02Y$\x8b@ \x01o\x1a\xba*\x14\xdby4i\xea"\'z\xcd\
+\xbd\xe7\x9c.f4\xa3\x91d\x8f\xec\x0b\xc3Hw\xce\x9d\xf3;\xe7\x7f\xee\xb9R@\
+\xc9X[[\xb3n\xb7K\x1c\xc7\xf4z=\x9cs\x88\x08\xaa\x9a\xdd{\xbd\x1e\xfd~\x9f~\
+\xbf\x8f\xaa\xd2n\xb7i\xb5Z<{\xf6\x0c3\x0b\x0e{\x7fT\x06\xd0j\xb5\xb8v\xedZ\
+\x99Y\x06\xb1\xbf\xbfO\xab\xd5\x02`ss\x93\xfb\xf7\xef\x1bp D)@\x18\x86\x00\\\
+\xbat\xe9P;3#\x08\x02:\x9d\x0e{{{\xb4\xdbm677Y__\xe7\xd6\xad[\x07BT\xca\x00:\
+\x9dN\x99Ia4\x1a\r\xe6\xe7\xe7i6\x9b\xd4j5VWWY__\x07\xb0c\x01\xa8\xea\x91\
+\x00\x86! \xc9\xdca\x10\xa5\x00\xc7\x1d\x8dF\x83Z\xadV\nQ\n`6!sw\xefB\xa5\
+\x92_\xcb\xcb\x13\xd7\xd6\xebu\xb6\xb7\xb7\x0f\x858\x1e\xc0\xa3G\xc5\xef\x97\
+/O\\[\xadVy\xf9\xf2\xe5\xa1\x10\xa5\xbb`*\x80\x95\x95\x89k\xeb\xf5:\xb7o\xdf\
+\xc6{\x9f]q\x1c\xe3\xbd\xe7\xe2\xc5\x8blmm\xd9\xf1\x00vv&\x19\x8eMmll\xb0\
+\xb3\xfd\x17\xed\xce;\xfey\xfd\x8a\xbf_=gw\xe7\x15\xfb\xef:\xec\xee\xee\xb2\
+\xb5\xb5u\xcc\x0cL\x18A0\xbe\xcd\xab\xd5*g\x97?\xe3\xcd\x9b74\x1b\xb3|0;\xcf\
+\xc2\xfc\x02o\xf7\xde\x12V\x12\xfb\xe9k`m\xadXx\x83\xeb\xdc\xb9\x03\xd7:\xe7\
+\x00\x98\x9b\x9b\xa5\xd98\xc1G\x8b\x0b\x9cZZda~\x81\xa5\x8fO\x02S\xd4@\xd6\
+\x07\x9e>\x9dl\xb0\xba:qZ\xc4\x13\x98\'\xee\xf7\x08\x81\xfaL\x05\x89A\x1as,}\
+\x1a\xf0\xdf\xde\xeb\xe9\x00\xb2q\x04\x00\x11\x8f\x89\xcb.\x80\xa8\x02\'jU\
+\xc4GDs\xb34\xd3\x1e1\xbd\x04/^@\xa7\x0333\x87\x02\x88\x8bs\xe7*D\x15\xf0\
+\xbe\x87\xa8 \xe2\xa8\xcfD\x04\xea\x88B\x9f\x80\x95\x01\x14Z\xf1\xe3\xc7\x10\
+\xc7\xf9\xf7\xb3g\x0b5 .\xc6TPM\xee&.Y/\xa9\xb3\xb0B,=j\xd5\x10\x13\x99\x0e\
+\xa0\xb0\x0b\x1e><0z\xef\xfa\x99S\xb3\xdc\xb9\xa9#\x0c\x8d\xb8\x9f\x80G\x01\
+\xc4*\xd4f\xc2\xe9\x00\n\xe3\xc1\x831\x003C|\x1e\xb1i\x02\xa0\xe2\x13\x10u\
+\x98HV\x0b\xc9s\x97g\xa5\xccg&A\xb7\x0bO\x9e\x14\x9e\xd9\x95+I\xda-\xd1\xdb4\
+\xb9g\xce\x07@*D\x81\x12\xfb<\x0bfG\x95`D\x7f;s\x069\xbd4\x92r\x9fD\xabE\xa0\
+\xc4&\xdf\x11&\x8e(\xed[\xd3\x03\x8c\xa4\xdf\xae\\.\xa6|\xe0|\x00\xa4\x0e\
+\xf3\xae CdJ\xdf\xf7\xd3\xd4N)A\x060R\x80\xba\xf2]\x9er\x1d\xec{\xc9\x80\xcc\
+\xbb\xf1\x1daIQ\x02\x18G\x90 |\xff~L\x7f]\xf9\xb6P\xe9\x99s\x11\xd4\xe21\tT\
+\x15\x13G\x18\x18\x9a\xdaN\x05\xd0\xecvY\xbes\x07\xd2\xbe\x0e\xa0_\x9e\xc7N}\
+\x92\xbd4\xcb\x80M\x90\x00\x19\xab\r\xa0\xbc\x0f(l\x007\xb8wo\xec\x99\xfcv\
+\x03\x19\x14\xd7X\xda\x87>\xdb\x88\xf3t\x0e\x13*\xc0\x85/\xce\x1c\x9a\x81o&M\
+\xfa_~\xc2]\xfd\xa1\xe8\\\x87\xa2\x1e\x02\x19hn*\x85\x82\x14Q\x02s\x10\x95K\
+\xf0\xce`Vk5\x82\xaf.\xe0\x7f\xfd\x19\xff\xe3\xd5\xdc\xa9\x8e8\x95|NMs\xa7\
+\xde\xe5\xbd\xc2;He\xc2\xfb\x83\x01*\xf0=\xc0\xf5\xeb\xd7\xed\xe6\xcd\x9b|}\
+\xfes\xc4\xf5s\xe7R\xd4\xb9\xe0|8\xed"\x99suC\xe7\x88?\xe264\x95\xb1\xee\x96\
+E88\xfdF5\x97\xa1m\xe8]\xe1\xbd\x1aL\t0\xf8g\xe4DA\x04O\x054$\xf2]\x04\xf0\
+\xc1\x0c\x11\x8a\x98\x03\x0c\xd4\x10I#U%\x00D-9\xf8\xd3\xa8\x81\xf4,\x88\xca\
+\x01\xda\xed6\xd2\xff\x97?~\xdfK#\xe9\x82*X\x9cF/\xa0>i,\xde\x13\x0c\xb2`\
+\x0es\x82ZRp\x03\xcd5\xf0\xd9A\x04\xfe\xe0\x7f\xad\x83\xb1\xb8\xf8\xa1\x9d^8\
+\tQ\x1d|\x0f\xa2:\xde{"|\xf6\x19\x06/\x8c\xc0\xf7\x88\xa2(\xb1\x89H~\x8eS\'\
+\x8aR\x1b\xefI\x1f\xf0\xe7\xf3\xb7\xfc\x0f\x8c\xbb,\xe4\xd5\x12R-\x00\x00\
+\x00\x00IEND\xaeB`\x82~%\x19\x15' )
+
+def getIconImageComplexBitmap():
+    return wxBitmapFromImage(getIconImageComplexImage())
+
+def getIconImageComplexImage():
+    stream = cStringIO.StringIO(getIconImageComplexData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconImageCopyData():
+    return zlib.decompress(
+'x\xda\x01\x13\x03\xec\xfc\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00\
+\x18\x00\x00\x00\x18\x08\x06\x00\x00\x00\xe0w=\xf8\x00\x00\x00\x04sBIT\x08\
+\x08\x08\x08|\x08d\x88\x00\x00\x02\xcaIDATH\x89\xb5\x92Ak[G\x14F\x8fF\xcf\
+\x91\xed6\x91\xa3\x10c\xd7\xd0\x14\xecE\xa1\x04\xbahS(Y\x05\xb2q\xa1\xc6\x96\
+\xbdi\xfe\x89\xf1\xde\xbb\x90?\xd0\xfc\x876\x9bB[\xb0\x137\x10\x9cU\xb0J)]$%\
+\x90\x1a\xe3E\x1cb\xcd\xbc\x99{o\x17\x92^%E\x92\xe5\xd2^x\xbc\x073\xef~s\xe6\
+\x1e\xf8\x9f\xab\x04\xb0\xbd\xbd\xfdzvv\xf6R\x08\x01\x11AU\xf1\xdesrr\xc2\
+\xf1\xf11\xbb\xbb\xbby\xa3\xd1\xb8\xe9\x9c\xdb?o@\x06P\xa9TXYY\xa1Z\xad\x16\
+\x0bf\x86\x88pttD\xadV\xbb\xb0\xba\xba\xfaHUo9\xe7\x1e\x9f; \xc6\x88s\x8er\
+\xb9\xdc\xbb\x98e\xcc\xcd\xcd\xb1\xb4\xb4\xc4\xda\xdaZ\xa5^\xaf\xff\xac\xaa\
+\xb7\x9ds{\xe3\x068\x00U\x1d~\x82,\x03`qq\x91\xcd\xcd\xcd\xc9z\xbd\xfe\xa3\
+\xaa~y.\x82q\xea\xfe\xfdoi\x9e\xbe\xe5\xfd\xf7\xa6\'?\x98\x9f\xff\t\x98\x1e;\
+\xc0\xccFo\xca2ff.355\xcd\x8d/j|\xf6\xf9\x8d)\xef\xbdu$\xd8\xd9\xd9\xf9\xed\
+\xe0\xe0\xe0v\x96e/\x07\x06\x8c\xba"3c"\xcbX^^\x1e%\xc1\xc7\xf5z\xfd\x87\x94\
+\xd2WY\x96\xbd\x18\x9b\xc0L\x91\x18H1\x1fG\x82O666\x1e\x88\xc8\xd7\xe5r\xf9y\
+g\xcf\xd0!\x9b)\x92{$6Q\x93\xa1\x84}\x12\\___\xff>\xa5tm$\x81\xa9\x92b\x13\
+\x8d\x1eM\x01\x1bq\x85\x9d\xea\x92\xe0\xfa\xc2\xc2\xc2w\xc0\xa7E@7\x81JBR@\
+\x93/\xde\xa6\xc3\t\x00\xee\xdc\xf9\x86\xbf^\xbd\xe2\xcf\xe7\x7f0?;\xc3\xaf\
+\x8d\xc6G\x87\x87\x87\xef\x12\xb4\x9a{4\xb6\x9bG\xdf\n\x924\xb4\xb9\x99\x81\
+\n\x97\xab\x17q\xd7>\xa4\x92\x19Wj\x97\x8a\xf5"\xc0TZ\xf7\x1dC\xfb\xe4\xad\
+\xef\x16\xc1\xe0+\xeaH`\xc9\x83x&\'\x1c\xb5\x99\x8bL^\xc8z\x03T\x15M\x11\x89\
+\x8a\xa6\x80D\x8f\xb5I4yT\xdf%($H\xed9\x89\xa7d\x91\x89\xb2\xe1J: @\x02\x12]\
+\xeb\xc4\x9d\xc6\xed9\xf4\x13\xf4K )`\xa9ER\xd2@\t\xeb\r\xc8C \x04\x8f3 \x9e\
+"\x12\xb1\xbc\x89JKSI\xb1\xf8a\xa0\x04]\x0f\x12(Y\x1f\xc1\xd3\xfd\xc7\xf9\
+\xbd\xbbo\x0c\x15L"\x86\xa1\x1a@\x94\x92F\xa6\xaf.\x96FIP\xcc*y45\x01\xe9\rx\
+\xb8\xf7\xe4\xea\xc3\xbd\'\x03\x07\t\xb0\xb5\xb5\xf5\xc8Tn\x0e\x93\xa0\x9b\
+\x06\x89T\xb2ro\xc0Yu\x96\x04\xad\xe6m\xa2\xfc\x94+\xd5\xa9\x7f\x110B\x82\
+\x82$\x06,\xe5\xa0\xff\xccl\xac\x80\xb3$\xb0\x98#\xc9c\x92\x93b\xc0\xfa\x87|\
+V\xed\xef\xff\xf2\xf6\xde\xdd7\xaf\xbb%\x90\xb6\x04N#\xaa\tU\xa5D\xc24\xf1\
+\xec\xf7\x97\'\xe3\xf4\xfdO\xeao\xdf\x81\x8er\xa4\xfc\x98V\x00\x00\x00\x00IE\
+ND\xaeB`\x82\x8b\x7ftv' )
+
+def getIconImageCopyBitmap():
+    return wxBitmapFromImage(getIconImageCopyImage())
+
+def getIconImageCopyImage():
+    stream = cStringIO.StringIO(getIconImageCopyData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconImageFloatData():
+    return zlib.decompress(
+'x\xda\x01F\x08\xb9\xf7\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00 \x00\
+\x00\x00 \x08\x06\x00\x00\x00szz\xf4\x00\x00\x00\x04sBIT\x08\x08\x08\x08|\
+\x08d\x88\x00\x00\x07\xfdIDATX\x85\x9d\x97]\x88]W\x15\xc7\x7f\xfb\xdc\xf3q\
+\xcf\xb9\x1f\xf3\x91\x99\xcct\x1ag \x85(\x18\x92\xd0\xd8\xd0I%\xa9\xb5yH\xaa\
+X\x82\xd5\x16b-\xea\x83\x0f}\x13,\xf8Rj-4>\xf4M(\xf8R\xacVb#\xf8 \xa2m\xf5!\
+\xd8\x98<\x0cD\t\x95\x84\x96aL\xbc\xd3$w\xee\x9cs?\xce\xe7\xfe\xf0\xe1L\xce4\
+i&).8\xdc\x03w\xb3\xd7o\xaf\xb5\xd7\x7f\xad#\x84U\xe3n\xf6\xca\xcf^6I\x92\
+\x90\xe79i\x9aR\x14\x05J)\xb4\xd6\xd5o\x9a\xa6dYF\x96eh\xad\x19\x8dFDQ\xc4\
+\xc5\x8b\x171\x08q\xb7\xfd\xed\xbbz\x07\xa2(\xe2\xf8\xf1\xe3\xf7ZVA\xf4\xfb}\
+\xa2(\x02\xe0\xd4\xa9S\xbc\xf3\xce;FX\xb5-!\xee\tP\xab\x95\x11:p\xe0\xc0]\
+\xd7\x19c\x10B\x10\xc71\xbd^\x8f\xd1h\xc4\xa9S\xa78y\xf2$/\xbc\xf0\xc2\x96\
+\x10\xd6\xbd\x00\xe28\xbe\xd7\x92[,\x08\x02&\'\'i4\x1ax\x9e\xc7\xa3\x8f>\xca\
+\xc9\x93\'1Z\x99\xff\x0b@k]\xbd\x1bc\xee\xf8l\x05\x01e\xe4\xee\x06q\xcf\x14L\
+\\z\x8f7^\xfe\'\xafj\x8fD[xF3+\xa09\xcax\xe5\xdd\xbf\x00e\x9a\x84\x10U\xbanB\
+x\x9eWA\x00wL\xc7\x96\x00?y\xeaa\xf3\xefb\x86h~\x1e[)\xeeS\n)%\x9e\xe7\x11\
+\x04\x01\xbe\xefs\xe2\xc4\t\xe6\x12\x8f\x9f\xfe\xe6\x178\x8e\x83\xeb\xba\x15\
+\x0c@\xbd^gee\x85\x85\x85\x85-!\xee\x08\xf0\xcc\xd3\xdf6\xce\xae]<\xbe};sss\
+\xcc\xcf\xcf\x03T\x17,I\x12._\xbe\xcc\xee\xdd\xbb\x91R\xf2\xdcs\xcf\xf1\xfa\
+\xeb\xafWp\xb6mcY\x16\x8e\xe3\xd0\xe9t\x00\xb6\x84\x10\xb7\xeb\xc0\xb3\xdf9a\
+\x0e\x1c8\xc0\xbe}\xfb\xd8\xb1c\x07\xb6m\xd3\xef\xf7\xe9\xf5zDQD\x92$\x18cH\
+\xd3\x944M\xe9t:DQ\xc4\xf2\xf22\xaf\xbd\xf6\x1a\xcdf\x93f\xb3\x89\xe38<\xff\
+\xfc\xf3\xac\xae\xae"\xa5\xac\x9e<\xcf\x91R\x92e\x19KKK\xdc\x02\xf0\x83\xef\
+\x7f\xcf\x1c>|\x98\xfd\xfb\xf7333\x83\xe38\\\xbf~\x9d\x95\x95\x15\xe28\xe6\
+\xea\xd5\xab\xf4z=\x82 `ll\x8c \x08\x08\xc3\x90\x8f>\xfa\x88$I\xb8q\xe3\x06/\
+\xbd\xf4\x12\xdb\xb6m\xa3\xd9l\x02p\xf5\xca\n\xa3x\xc0\x8dk\xab|\xbcz\x95+\
+\xffY\xa5?\x88\xb9r\xe5\n\xbf\xfe\xed)jB\x94\x85p\xf2GO\x9a]\xfb\xbe\xc2\x9e\
+={\x98\x9d\x9d\xc5\xf3<\x06\x83\x01kkk,--\xb1\xbc\xbc\xcc\xda\xda\x1aI\x92\
+\xa0\x94"\x8a"z\xbd\x1e\xb5Z\x8dF\xa3\x811\x06\xcb\xb2\xf8\xf3\x1f\xff\xc5\
+\x97\x0e|\x1e\xc7q\xf0<\x8f\xb1\xb1q\x8c\xb1h6\xdb\xd4\xfd\x16\x13\xed\x80f\
+\xab\x8e,4g\xfe~v\xf3\x0e\xfc7\xdf\xc1\x17gg\x99\x99\x99\xc1\xf7}\xc20$\x8a"\
+.]\xba\xc4\xe9\xd3\xa7\xb9p\xe1\x02Q\x141>>\xce\x83\x0f>\xc8\xa1C\x87\xaa[\
+\xefy\x1e\xbe\xef\x93\xe79=\xfb*\xddn\x17\xcb\xb2\xd0Z\xd3l6i\xb7[\xd4\x84\
+\xc6\x9a\x9e\xa2\xe1\x16\x00\xcc\xcd\xf4\xca\n\x12\xc2\xe2\x97\xaf>m\x16\xbe\
+p\x98\xed\xdb\xb7s\xff\xfd\xf7\x13E\x11\xc3\xe1\x90N\xa7\xc3\x8b/\xbe\xc8\
+\xf9\xf3\xe7\xc9\xb2\x0c(%wyy\x99n\xb7\xcb\xc1\x83\x07q\x1c\xa7\x02\x19\x8dF\
+$I\xc2[\xef^fq\xef<\xbe\xe7 \x8c\xc4\xa9YXB\xa1e\x01\xc2\xc2\xf7\x1c\x06\xc3\
+\x88\xdf\xff\xe1O\xa5\x10\xad\x17\xdb\xf0<\x8f\xd9\xd9\xd9J\xcf{\xbd\x1eo\
+\xbe\xf9&\x17.\\\xb8c\x99^\xbcx\x91s\xe7\xce!\xa5$\x8a"\xfa\xfd>q\x1c\xb3\
+\xbe\xbe\x0e\xf9*\xebk]\xc2\xf55\x92x\x88*2l\x0b|\xcf\xc1\xb5mZ\xed\x16\x8d\
+\r\x8d\xb0\x01r=F\xbb\xdd&\x08\x02\xfa\xfd>I\x92\x10\xc71g\xcf\x9e\xddJ&\x00\
+8s\xe6\x0c;w\xee$I\x12\x92$a4\x1a!\xa5D\xc4}\x86\xc3>Q\x180\xd6\xf4\xc9\\\
+\x0b\xd7uQ\xaa\xa0\xee\xda$I\x82]\x93\x9b\x00Xu<\xcf#\xcb2\x84\x10\xd4\xebu\
+\x84\x10\xac\xac\xac\xdc\x15\xa0\xd3\xe9p\xfd\xfau\xb2,\xa3(\n\xf2</\xdbt6"I\
+b\xe2\xd1\x904K\t\xea\x0e\xd4,\xec\x9aE\xaeR<\xa7\x86Qj\x13@\xa9\x94\xd1h\
+\xc4p8\xac6\x1b\x0e\x87w\xd4\xf9O\x9a\x10\x02\xcf\xf3\xc8\xf3\x1c\x80\xa2(\
+\xc8\xb2\x8cT*T\x91#\x95D\xc9\x1c\xcb\xd2(Y\x1e\xce\x16\x90k\x85\xe7\x96\xf7\
+\xc6\x02\xc8\t+\x95\x0b\xc3\x90\xb5\xb55\xb2,\xab\x14p+\x9b\x9b\x9bcrr\xb2\
+\x12\x1ecL\x99>\xec\xb2Qi\x89\xd1\x05F)\x8c*\xcaG\x17\x18S\x80\x92\x9b\x00E0\
+$\xcfs\xc20$MS,\xcbb8\x1c\xb2w\xef\xde\xbb\x02<\xf2\xc8#\xb4Z\xad\xaa\n\x8a\
+\xa2,\xb1\xd4m!0\xa0U\x05a\x0b\x8dV)\xc6(l\x01\xc6\xa8M\x80\x9f\xff\xf8W\xe2\
+\xfd\xf7\xdf\'\x0cC\xd6\xd7\xd7\x19\x0c\x06\xf4\xfb}\x16\x16\x16x\xe0\x81\
+\x07\xee\xe8\xfc\xa1\x87\x1e\xe2\xc8\x91#H)\xab\xf1\x0c\xcaR\xfc\xe1\xd1\x87\
+\x11h\x84\xd0\x1b \x12c\x8a\xcd(\xa8\x02{\xa3\x1fVB\x94\x8c\x0f\x18\x0c\x06\
+\xd5\x8d^[[#\xcfs\x8e\x1d;\xc6\xd2\xd2\x12\x1f|\xf0\x01a\x18211\xc1\xe2\xe2"\
+G\x8f\x1e\xa5\xd3\xe9`\x8c!\x8ec\xa4\x94\x84aH\x1cL\xd0j\xd4q\x9d\x1au\xc7\
+\xc6\xb1\x04\x02\x85Q\x06\xdbh2Y\xea\tZ\xde\n\xf0\xc6\xabo\x89\xf8\xa9\xdc\
+\xec\xdc\xb9\xb3\x02\xb9\xd9\xcf\x17\x17\x179|\xf8p\xd5n\x01\xae]\xbb\x86\
+\x10\x820\x0c1\xc6\xd0\xe9t\xc8\xb2\x8c\xef~\xed\x10\x8em\x11\xd4]\x9a\r\x1f\
+\xcf\x15\x084F+\xb4\xd1\x18]\xa6\xc9\xa0n\x05\x00\xf8\xdd\xdb\xa7\xc5\xe3_}\
+\xccLOOc\xdb6J)Z\xadV\t\xbc\x11\xe64M\x91R\xe2\xba.\x83\xc1\x800\x0c\xe9v\
+\xbb\xf4\xfb}\xbeu\xfc\xeb\xb4\x03\x97\x86\xef\xd2n5h5<\\\xc7F\x18\x856`TAM\
+\x18\xb4R\x15\xc8\xa7\xe6\x81\xf7\xfe\xfa7qp\xf1a355\x85\xef\xfb8\x8e\xc3h4\
+\xa2V\xabU\xfa\xae\xb5FJI\xb7\xdbe0\x180\x1c\x0e\xf9\xe6\x93\xc7h\x06\x0e\
+\x81\xef29\xdefr\xbcI\xd3wqj\x060e%\xe8\x02\xa3\xcb\x93\xdf\xa2\x03\xb7\xdb\
+\xd9\x7f\x9c\x13\xfb\x9f:b\x82\xce:SSS8\x8eS}\x03\xc4qL\x9a\xa6\xe4y\xceh4B\
+\xb5\'x\xf6\xf8\x13\xf8\xbeC\xa3\xee\xb1m\xa2\xcd\xf4\xb61&\xdb\r\xea\x9e\
+\x83\xc0`T\x19z#\x8b\xf2\xf6\x1b\x85\x05\xec\xd95\xbf\xf5H\xb6\xf4\xf6\xbb\
+\x02`\xf73G\x8d\xbd\xda\xc5\x93\x1a\x17\x8b8\xcf\x91\xaeK\\o\xf0\xccc_f\xa2\
+\xdd\xc0uj\x04\xbe\xc7\xe4X\x8b\xe9\xa9q\xa6\xc6[\x04\xbe\x8de\x190\n\xa3U\
+\xe5\xdc\xe8\x02\xa54\xc2\x14`\x7f\x86\xa1t\xfb\xc7\t\xc7\x9e\xf8\x063S\x13\
+\x8cF}\x94RX\x18\x8cQ\x08\xc0u,\x02\xdfc\xac\x1909\xdedr\xact^\xabY\x08\xadJ\
+\xa7\xb2\x14\x9f\x9b \xa8\x8dHHyo\x80z\xbd\xce\xec\xec,\xf7M\x8f1\x1a\xfah%\
+\xd1\xba\x00c\x10h\xea\x8eM\xb3\xe5\xd3\xf6=\x9a\x8d:u\xb7\x86e\x99\xd2\xf9M\
+\x15\xdcp\xae\x8b|scy[\x19ne\x8e\xe30==\xcd\xfc\xe7\xa6I\x93!\xaa\xc81Fb\xb4\
+Bh\x8d\xe3X\xd4\x1d\x0b\xd7\xb6pl\x0b!4hS9\xd7:\xdf<\xf9\'L\x8b\xcf\x08\x90e\
+\x19\x8dF\x83\xb1\xf1qZ\x81GaL\x19:5D\t\x81\x16.\x9e\xc9\xd1\xbal:H\x8dT\x1b\
+\'\xd5\x1a\x01(mJ\xcd\xdd85\xb0\xd1\x0b\xec{\x03\xc4q\x8cP\x11\x1f^\x8a6N\
+\x92\x80\xd6`\xf22\xbfJ!\x8c*\x85E\xca\xb2\xe6oJoQ\x8a\x8f0\x9b9\xd7BV\x8d\
+\x08$\x9f\x1a\xcbo\xb7\xe9\xa91\xb3cj\x1c\xec:\xc8\x14\xec:RJld\xf5\x0e77\
+\xb4A\xa6\xd8\xb6]\xae\xb1)\xc7q\xea\xd8\xf6\xc6\x1a)\xd9\xf8\x83\x0f\xafv\
+\xf9\x1f$!\xc2\x1d\xbbp\x07<\x00\x00\x00\x00IEND\xaeB`\x82 |\xfc\xb2' )
+
+def getIconImageFloatBitmap():
+    return wxBitmapFromImage(getIconImageFloatImage())
+
+def getIconImageFloatImage():
+    stream = cStringIO.StringIO(getIconImageFloatData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconImageGreyData():
+    return zlib.decompress(
+'x\xda\x01s\x05\x8c\xfa\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00 \x00\
+\x00\x00 \x08\x06\x00\x00\x00szz\xf4\x00\x00\x00\x04sBIT\x08\x08\x08\x08|\
+\x08d\x88\x00\x00\x05*IDATX\x85\x9d\x97\xb1k\x1cG\x14\xc6\x7f+?\x8e)\x062\
+\x84\t,f\x8b#\x18UW\xb8\xb8B\x04\x91(\x9d\n\x17.\\\xb8p\xe9\xc2\x85\xba(D\
+\xc12\xb6\x91D\x94^\x90\x84$\xbd\xfe\x82\x14\xc1\x04\x17.\\\xb80A\xa4Ra\xcc\
+\x16[l\xb1\x98\xe5\x18\x8e\xe1.\xc5\xee\xcc\xed\x9e\xcf\'\'\x03\xc3\xee\xed\
+\x8e\xe6\xfb\xde\xf7\xbd\xf7f\x95$\x1b\xd7X7N\x8e\x8f\xe6\xce9\xc2\xf4\xde\
+\xe3\xbd\x07\x88\xd7\xee{\x80\xba\xae\xa9\xaa\x8a\x8b\x8b\x0b\xe6$\xc9\xba\
+\xfde-:PU\x15w\xee\xdc\xb9jY$\x10\xc0\x01\xce\xcf\xcfy\xf6\xec\xd9|\x1d\x89+\
+\t\x884K\xc6\xe3\xf1\x95$\x02\x91\xb2,q\xceq~~\xce\xe9\xe9)\x07\x07\x07\x1f$\
+\xb1\xf11\x1b\xfe\x97\xa1\x94\xc2Z\x8bR\n\xa5\x14;;;\x9c\x9e\x9e\x920\x9f\
+\xff/\x02\xc1\xe7\xffC\x02\x1a\xe5\xd6\x91Xk\xc1/?\xff4\xd7ZSU\x15/_\xbe\x04\
+\x9a\x9c(\xcb\x92\xaa\xaa0\xc6p\xf7\xee\xddf#\xe9o\x15\x14\x08$\x80\x95v\xac\
+$\xf0\xfbo\xbf\xce\xb3,c4\x1a\xf52\xdc9\x87\x88`\x8cA)\x85s\x8e\xb3\xb33\xd2\
+4\xe5\xf6\xed\xdb\x88H\x8f\x88R\x8a<\xcf\xc9\xb2\xec\x83$\xde\xb3\xe0\xd1\
+\xe1\xc3\xf9\xbd{\xf7\xd8\xda\xda\x8a\x1b.G\x07\xc4rTJQ\x96%ggg\xd4u\xdd\xb3\
+LD\xc8\xf3\x9c<\xcf\xa3\x12\xcbv$\xdd>\xf0\xe8\xf0\xe1\xfc\xf0\xf0\x10\x11\
+\xe9E]\xd7u\xbcv\xe7r\x7f\x00x\xf0\xe0\x01ZkD\x84\xbd\xbd=\x8a\xa2\x88d\xbd\
+\xf7q\xads\x8e\xd7\xaf_s-I\x1a\x11\xbe\xdd\xfff\xbe\xbf\xbf\xcfl6ccc\x83\xc1\
+`\xd0\x8bt:\x9d2\x9dN\x99L&\x114<\x9bN\xa7\xf1\xd9\xdb\xb7o\xd9\xdc\xdcDD\
+\xd8\xdd\xddek<f\xfb\xcb/\xb89\xda\xe4\xc6\xe7\xd7\xb1\x9fZ\xae\xa7\xd7Q\x83\
+\r\xfe\xbe\xf8g\x91\x03\xe3\xf1\x18\xe7\\\xf4V)\x85\x88\xc4\xdf]\x1b\xba\xd1\
+,\xab\xf0\xe6\xcd\x1b\x8a\xa2 MS\xb4\xd6d\xc3!eY\xa2\x95Fk\x8b59eU\x12\xb6\
+\xbb\x96$\x1b|\x7f\xf0\xdd|ww\x97\xd9l\xf6\x9e\x87"\x12\x15\x98L&\xd4u\xcd\
+\xbbw\xef\x98L&\xf1wP \xac)\x8a\x82\xe1p\xd8\xdbc\x86g\xa0\x06\x0c\x060\x9b\
+\xce\x98\xba\t\x7f\xfc\xf9W\xa3\x80\xb56F\x19\x00\xc3\xd4Z\xa3\xb5\xa6\xaek\
+\xa0\xdfr\xbby\xd0\xfd\x9b\xb2,)\x8a\xa2\x8d\xb2IT\xd5\x86\xec\x95&\xcdR\xca\
+\xaa\\\x94a\x96e=\x02A\xe6\xb0\xb11\x06\xad5\xb08h\xaa\xaa\x8aY\xdfMB\xef}\
+\xb3\xa6,\xd1J\x10@\x01"\xa0\x94\xe0\xbd Z\xa3\x95,\x08\x18cb\xcb\r\x04\x02\
+\xa1\x10i\x96e\x00\x14EA\x9e\xe7\x11|\xd5\xe9X\x96%u]QU\n\xa35N\x81\xa0\xda\
+\xb2m*L\xf0\x0b\x02\x01p\xdd\xb8\xbc\xbc\xe4\xc5\x8b\x17\xb1#^5j\xe7p\xae\
+\xc6y\x87r\x82(\x8fHC\xb2\x9b\xd0\x02M{UJ\xf5\x12p9\xd3\xf3<\xe7\xf9\xf3\xe7\
+\xbcz\xf5*fx\xa8\x94\xaer\xd1F\x1f\xf2\xc2!\xa2\xc0;\x90\x06\xd0{O\xeb@C\xa0\
+,K\xac\xb5=I\xc3\x0c\x9e\x87nf\x8c\xa1(\x8a\xd8\x8e\x03\x89n\xfe\x0c\x87C\
+\xbc\x07\xbco\'x\xf1\x88\x0f6\xb5\xcf#\x81\xaa\x8c\x07\xc7r\xe4\x81@\xb0(TDU\
+Uh\xad\xa3\xa4]5\xd24m\xbdm\xc0<\x0e\x85D\x85\xa5}\x13\tx\xe7#@\xb7U.\x97[\
+\x908\x9c\x90!\x11\x83}A\x854\xb5\x1d\x88V\t!F\r.&\xdf\x06\xc0\xd1\xf1I\x12\
+\xa2\\5\xbb\x99\x1e@\x02\xe8\xf2\xda\xd1h\x84Q\x82(AIS\x86\xd2\x92\x10<\xde\
+\xd7\x0b\x1b\xe8T\xc1\xf2A\xb1\x8e@\x00\xef\xae\r\xcf\xc77o6*)AkE\xe3l\x9b\
+\x07,\x80\xc35\x1e\xc7\x8f\x9f<MV\x81v\xc1\xbb#\x00v\xc9\xdc\xbf\x7f\x1fk\
+\x04\xad\xa5\xed\xa0!/|\x03\xee}T#\xd8\xd1\xfb\x1e8:>I\xbaj,G\xdf\xb5`y\xee\
+\xed\xed\x91\xa5Mi\x1ac\xb0\xa6\xe9v\xa1\xdc\xda\xb2\xe8\xec\xb5\x82\x00\xc0\
+\x0f\xa7?&\xe1\xa3\xb2;>Db{{\x9b\xc3\xc3\x03\x86\x99A+\x855\x1ak\x0c\xa6\xed\
+\x13\xef\x81{\xdf\xf4\x04`t#[\xfdI\xf6\xf8\xc9\xd3\x04\x9a\x0f\x94\xd0\xf7\
+\x83*J)\xd24%MS\xb2,\xc5\xb62k-\x18m\xb0\xb6\x8d^K\xd3n=}\xf0\xee\xbd\\\xf1Q\
+zt|\x92|\xbd\xf3\xd5\xfc\xd6\xad[\xa4\xd6\xc4\xb2\x0b\xae\n\xcd!\xa3\xb5Bk\
+\x8d5\x1a\xa3\x03x\xd4\xae\x05l[\xbdw\x91H\xcc\x89u#Fl\ru]\x81o\x13\n\x10<\
+\xaa\xed\x0b\x8b\xac\xef\x80{\xd7\n\xe0Z\':\xe7\x8d_*\xc3u\x04\xac\xb5\x0c3\
+\x8bs:\xd6pPB\x84\xa6\xde\xdbk,\xb3\x1e\xf8\xaaJ\xfaH\x02\xce\xb9&Bc\xd0^\
+\xb5\x9bz\xc4\xd7mU+\x14\x8e\xd0v\x1be\x83\xdc\xbe{\xe9\xdc\x04\x02r5\x81\
+\xba\xae\xc1W\\^V\xbd\x0c^D\xd6X\xb1\xa8s\x1fUj\xec\xa2\xe7y$\xda\x92H\xae\
+\xfa\xf7\xfc3\xfb\xc9<\xb3\x06\xe2\x91\xda\xf6}|\xbc\xef\x1d-\xde\xc5\xcf\
+\xbap\xfe{\x14"\xc1\x1aO\xfb\x82\xcb\xbc\xe4_\xa7]K\xae3E\xc2\xdd\x00\x00\
+\x00\x00IEND\xaeB`\x822\xd3\xa0\xe2' )
+
+def getIconImageGreyBitmap():
+    return wxBitmapFromImage(getIconImageGreyImage())
+
+def getIconImageGreyImage():
+    stream = cStringIO.StringIO(getIconImageGreyData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconImageGrey16Data():
+    return zlib.decompress(
+'x\xda\x01z\x05\x85\xfa\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00 \x00\
+\x00\x00 \x08\x06\x00\x00\x00szz\xf4\x00\x00\x00\x04sBIT\x08\x08\x08\x08|\
+\x08d\x88\x00\x00\x051IDATX\x85\x95\x971h\x1cG\x14\x86\xbf==\x8bW\x0cd\x8b\r\
+lq\x85\x8aTF\x85\n\x15\xc6\x18\xa2\x80!\x98\x08\xecB\x85\n\xbbsa\xf0\xc5\xa4\
+\x94\x13\xc7\xb2,\t+\xe0\xc2\x85\x08.\x03n\xaetg\x13\x14p vT\x98\xa0\xc2\xb8\
+rq\xc5\x16Wl\xf0\n\x96x\x8a\x89.\xc5\xee\xcc\xed\x9dN:e`\xd9eo\x98\xff\x7f\
+\xff{\xff{{Q\xd4\x9a\xe1\xb4\xb5\xbd\xb59\xb0\xd6\xe2/\xe7\x1c\xce9\x80po\
+\xfe\x0eP\x96%EQ\xf0\xee\xdd;\x06D\xd1i\xe7\xcb\xa9\xe8@Q\x14\xac\xac\xacL\
+\xdb\x16\x08xp\x80n\xb7\xcb\xde\xde\xde\xe04\x12S\t\x88T[\x16\x17\x17\xa7\
+\x92\xf0D\xf2<\xc7ZK\xb7\xdbegg\x87\xb5\xb5\xb5\x13I\xb4\xcer\xe0\xffY\xaaJ\
+\x92$\xa8*\xaa\xca\xd2\xd2\x12;;;D\x0c\x06\x93\xf6\xcb/\x7f\xfc9\x98\x15\xa1\
+\x15E\x1c\x8d\xed\x89\x80\x7f\x07\x03~\xfb\xfb#g\x8b\x7f\x94\x04\x0c\x95;I\t\
+\xd1s\xe7\xf8\xfd\xf5k\xfe\xda\xfb\x95\xab\xb7\xef\xf0~\xff\r\xcf6\xee\x87\r\
+7\xd6\x1fr\xfe\xc2E:\x9d\x0e\xd7\xaf_\xa7(\n\xf2<\xa7(\n\xe28fuu\xb5:HF\xb3\
+\xe9\x15\x98FB\x00~\xfe\xae\x03\xc0\xd5\xdbwx\xb6q\x9fG/\xf6\xc2A\xef\xf7\
+\xdf\x00ptt\x14\x80\xe28FU\xb1\xd6\xb2\xbb\xbbK\x9a\xa6\\\xbbv\r\x11\x19!\
+\xa2\xaadYF\xbb\xdd>\x91D\x0b\x18\x01\x1c_\xe7/\\\x9c\xf8\xde\xdbQU\xc9\xf3\
+\x9c\xdd\xdd]\xca\xb2\x0c\xd6\xf4d\xb3,#\xcb\xb2\xa0\xc4xM\xc8\xd1\xe0\xe8\
+\xd8\xe1w\xaf\\\x0e\xcf>\x05^\x81&\xb8\xbf|\x7fx\xfa\xf4)\xb7n\xdd\xc2\x18\
+\x83\x88\xa0\xaa<~\xfcx\xe2\xde\x85\x85\x05\x0e\x0e\x0e\x06\x12q\xdc\x1dME\
+\xee^\xb9\xcc\xa3\x17{A\xdaq\xf0\xf1\x83\xbb\xdd.\xab\xab\xab\x18cx\xf2\xe4\
+\tY\xafGiK\xf2~F\xbf\x9f\xd1\xeb\xf5)KK\x96\xf5888@&zc\xc2j\xb5\x86\x8em\x82\
+\x8ew\xc9^\xafG\xbf\xdf\'MS\x8c1\xb4\xe7\xe6\xc8\xf3\x1c\xa3\x06c\x12\x928#/\
+r|\xa9LmD\xe3\x04\xc6\x81}\xde\x9bm\xfa\xf9\xf3\xe7\xac\xac\xac\xe0\x9c\xc3\
+\x18\x831\x06p$\x92\xa0Z\xd5H\x9aT\xddR\x0e?}\x1a\x01\xba\xb1\xfe\xf0X\r4\t4\
+\x81\xcb\xb2<6#\x9cs\xe4yN\xbf\xdf\xaf\xa3\xac\nU}\n\xd5\x90\xb6S\xf2"\xaf\
+\x08|\xfc\xa7"\xe0\xf3~\xfe\xc2\xc5\x89\xae\x98\x9d\x9d\x05\x86\x83\xa6(\x8a\
+c\xd1{\x85\xca\xb2\xa4\xc8s\x8c\n\x02( \x02\xaa\x82s\x82\x18\x83\xd1\x8a\x90\
+|\xff\xcd\xd7\xd1\xb7\x9d\xdb\x83\xc3\xc3CfffB\xa4\xadV+\\\xb3\xb3\xb3\xa1\
+\xb3\xf5\xfb}\xb2,\x0b\xe0\x93\xa6c\x9e\xe7\x94eAQ(\xb11X\x05Ak\xdb\n\xd6Z\
+\x047\xac\x81\xe5\xe5\xe53\xd5\xc1\xcb\x97/\xd9\xdf\xdf?\xd3\xde\xd2Z\xac-\
+\xb1\xce\xa2V\x10u\x88T$\x9b\xcdJ\xa0\x1a\xb9\xaa:\xd2D\xc6+=\xcb2^\xbdz\xc5\
+\xdb\xb7oC\x85\xabj8\xacy\x17\x11p\xbe.,"\n\xce\x82T\x80\xce9\xb4\xe9\x82<\
+\xcfI\x92d\xa2\xbf}\xce}7\x8b\xe3\x98~\xbf\x1f\xda\xb1\'\xd1l\xc3sss8\x078W_\
+\xe0\xc4!\xce\xa7\xa9~\x1f\x08\x14y\x18\x1c\xe3\x91{\x02~,\x1bc\xc2;cL\x90\
+\xb4\xa9F\x9a\xa6\xb5\xbf+0\x87E\x91\xa0\xb0\xd4\xbf\x04\x02\xce\xba\x00\xe0\
++z\x92\xdd\xbc\xc4\xc6\x98\x11\x17\xf8\xf4y\x15\xd24i@\xd4J\x08!j\xb0\xa1\
+\x01\xb5\x006\xb7\xb6#\x1f\xe5\xa4\xabY\xe9\x1e\xc4\x83\x8e\xef\x9d\x9f\x9f\
+\'VATP\xa9l(5\t\xc1\xe1\\9L\x03\x8dN\xd8\xf4\xf34\x02\x1e\xbc\xb9\xd7\xbf_\\\
+X\xa8TR\xc1\x18\xa5\xcal]\x07\x0c\x81\xfd=4\xf8\xf5\x07\x1b\xd1$\xd0&xsy\xc0\
+&\x99\x9b7o\x92\xc4\x821R\xb7`_\x17\xae\x02w.\xa8\xe1\xd31\xf2M\xb8\xb9\xb5\
+\x1d5\xd5\x18\x8f\xbe\x99\x82\xf1\xab\xd3\xe9\xd0N+k\xc6qL\x12W\xdd\xce\xdb\
+\xad\xb6E\xe3\xac\t\x04\x00\x1e\xed\xfc\x14\xf9\x8f\xca\xe6:\x89\xc4\xa5K\
+\x97\xb8wo\x8d\xb9v\x8cQ%\x89\rI\x1c\x13\xd7}\xe2\x18\xb8sUO\x00\xe6\xbfhO\
+\x9e\x86\xeb\x0f6"\x80\x1f\xef\xfd0\xf0}\xdf\xab\xa2\xaa\xa4iJ\x9a\xa6\xb4\
+\xdb)I-\xb31Blb\x92\xa4\x8e\xdeH\xd5n\x1d\xa3\xe0\xcdg\x992\x8e7\xb7\xb6\xa3\
+\xaf\x96\xbe\x1c,//\x93&q\xb0\x9d\xcf\xaaP\r\x19c\x14c\x0cIl\x88\x8d\x07\x0f\
+\xda\xd5\x80\xf5\xe7\xbd\xb3\x81H\xa8\x89\xd3V\x888\x89)\xcb\x02\\]P\x80\xe0\
+\xd0\xba/\x0c\xab\xbe\x01\xeel-\x80\xad3\xd1\xf8\x8f\xe1\xc6lx\x1a\x81$I\x98\
+k\'Xk\x82\x87\xbd\x12"T~\xaf\xef\xc1f#\xe0\x93\x9ctF\x02\xd6\xda*\xc28\xc68\
+\xad\x0fu\x88+kW+\x8a\xc5\xb7\xddJY/\xb7k\xde\x1a\x0f\x9e\x80L\'P\x96%\xb8\
+\x82\x0f\x1f\x8a\x91\n\x1eFV\xa5b\xe8s\x17T\xaa\xd2\xc5H\xce\x03\xd1\x9aD4\
+\xed\xef\xf9\xe7\xc9g\x83v\x12C\x18\xa9u\xdf\xc7\x85\xe7\x91\xd1\xe2\xaa\xae\
+X\xcd\x86z\xb8\xa1\x88\xf8\xd48\xea\x1f\xf8\x90\xe5\xfc\x07\x9cW\x13&\x88\
+\x9bi~\x00\x00\x00\x00IEND\xaeB`\x82\xe1\x98\xa4\x15' )
+
+def getIconImageGrey16Bitmap():
+    return wxBitmapFromImage(getIconImageGrey16Image())
+
+def getIconImageGrey16Image():
+    stream = cStringIO.StringIO(getIconImageGrey16Data())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconImageListData():
+    return zlib.decompress(
+'x\xda\x018\x05\xc7\xfa\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00 \x00\
+\x00\x00 \x08\x06\x00\x00\x00szz\xf4\x00\x00\x00\x04sBIT\x08\x08\x08\x08|\
+\x08d\x88\x00\x00\x04\xefIDATX\x85\xc5\x97]lTE\x14\xc7\x7f3\xf7\xeen\xbb\xb4\
+P\xd9\xd2\x96n\x0b\x15\xa3\x06\n\x06-V\xe3WbH\x88h\x13\x13Ix\xf0\xd9\xc4\x10\
+\xf4\x8d\xf0\xe4\x8bhBL\x88\x0f\x06%&j\xc4(\xd1\xa6*\xd1D\x02Q\xf1\x03\x88\
+\x1f@4*\x88ZI\x04\xb5|H(\xd8\xdd\xee\xde\x999>\xdc\xbb\x97mw\xbb\xbb\x88\xc1\
+y\xd9\xdd\xf98\xe77\xff9\xe7\xcc\xacR\xdaC\x9c\x15\xa5=\xc5\xff\xd0\xb4\xdc\
+\xb8\\6\x8e\xbc\x858+\xe2\xac\\u\x00\x80\xd6\xa64=\x1b7\xb0\xf3\xd5\xcd\\m\
+\x08\r0+\x99\x8c;D\xe4?\x83hDU\r0Q,N]x\x85\x10%\xc7\xa7N\x8e\xd6\x9d\xeb\x03\
+\x9c\xbe8^iD\x04\xa5\xd4e\x05g\t\xfa\xc4\xf1\x9f\xe8\x9a\xdf\x05\xe2\x1a\x03\
+\xb0\xae\xfaf/\x07B\x9c\x95_G\x8f\xb1\xa0\xb7\x07A@@Q\x9f\xdd\x0705H\xebA\
+\x94v}\xea\xcf\x93d2\x19\x00\x14 \x08\xa2\x1aT\xc0\xb8\xda\x13g\x82\x10g\xe5\
+\xc4\xcf\x87\xe8Z\xb0\x18\xa5\x14(]\xf2\x8e\xc2a-d2\x19\x06\x06\x06\xa6Hl\
+\x82\x02{?\xdd\xa7\x1a\x06\xa8\x06!\xce\xca\xe8\xb7\xbb\x99\xd7>7v\x1eC\xe0\
+\x104\xb9\xdcE\xd6\xac^\xc1\xd0\x03\xab\xe9]\xd0\xc7\xd2\x9b\xefA\'\x9a\x98\
+\xf5\xc8\xa3q\xf1\xd3\xe5\x00\xd6\xd9\x9a\x10cccq\x84\x1f\xdc\xfd\x02\xf32s/\
+\r*@i\xb4\xf6b%\x12\x89\x04\xa9\x84_\xd5Vz\xfd:$\xdd">@`K\x00\xf53\xef\xa5-\
+\x8f\xb3bI\x96\x9e\x9e\xcei\x12\x018\x9c#\x8c~\x01c\x0c\xc92\x80\xc9\x89s\
+\xa4\xdb\xba\xa7,\x8b\x00\xc2\x9d[[[\x81p\x8eC\xa6q\x8a\x08*\x92\x1dl\x08#\
+\x8eD"A\xb2)U\xd3^\x04`B\xe3\r(\x10\x02L\x9f\xe7\x10\xd1(\\\xa4D\x08\xa55\
+\xf8\x9e\xae\x0fP4\x11\x80iD\x01[\x01\xa0$L9!\xcc}\x89(\x94\x08\xcdM\xc9*V\
+\xa6\x01\xc4G0\x83\x02\xd6\x18\xc0a\x82\x02\xc6T* b\x01\x8d\x12\t?q\x08*\xea\
+\xaf\xdd|\x80B\x10*\xe0J\xd9\x109DJ\xce\xa2\xef\xae@\xd1Y\\E\x10\x84\xebD\
+\x01\xd8\x12\x15\n\xa1"`\xaa+p\xe9\x08L1_\xe6<\n(\x17\x02\x89\t0\xa6\xf2\x08\
+\x04\x81(\x85\x95R\xf1\xb8\xaes\xfee\n\x04!\x80\x08b\x0b\xb1\xc3ps6t\x8e\x80\
+\x9d\x04\x91\xca \x14\x17W\xc0x(\xfa\xed\xea\x14\xb9)\x00\xc68\xc4\xe4\xcb\
+\x1c\x86\x9fJ,"\x16\xb1\x05\\\x95,\x90R\x01++\xc5D\x8e\xb5n \x0bR~\x82\\1\
+\xc0\x89\xc3\xd9b\xec\x10\xc2\x00\x13qXcq\xa6HP\xe5\x08\xca\x15 \x1e*\x15\
+\xa3\xda\nh\x8e\x1eb\xf4\xcc\x19\x1e\x1e\x1cd\xfcB\x8e\xf7G\xb6\xe3\xec$b\
+\x03\x9c\x99DL\x01S\x9c$(L`m\x1ek+\r\x86\x0f\x18A\xb0\x08\x16\'\x86\x89\xbf~\
+c\xf3\xa6\r\xa0j_\xc9\xbe\xd2\x9e\xca=\xbfM\xb6\x02O?\xf8\x10\xfbG^Ad\x84\
+\xa1\xa1!\x840\x10\x83b\x1e1\x16m\x8a\x95\x16\xc4!X\x14\nS4\xb8\xfcY\x86\xdf\
+|\x8d?N\x9f\xa3\x7f\xd9rR\xc9$\xd9\x9e>f\n\x05\x1f\xa0\x04\xf1\x04\xf0\xd8\
+\xaa5\x1c\xf8\xf0m\x94R\xdc\x7f\xdf\xbd\x98`\x12\x9b/\x10^\xb0\xc5\xf0\xc6\
+\x8b\x9ar6z|8\x8aA\xc0s[6\xd15o\x0e\xad\x99^\x96g\xaf\xa3\xa7w!Z\x87\xb7db\
+\x86K)\xee-Wb\xed\xe0*>\xffb\x0f\x9e\xe7q\xc7m\xfdH`\xb1\n\xc4\x14*\x0c\x9c?\
+?\xce\xd9S\'\xd8\xf9\xee\x08\xd7/^B\xeb\xacV\xba\xbb:p\xe2\xa1\x94\xc2\xf3<\
+\x12\xbeG"\x91\xa8\rP\x0e1\xbc~\x1dko_\xc5G\xfbwa\x8c\xe1\xae\xc1~\x94)\xe0\
+\x82KG "\x14.\xfc\xce\xf0;\x1f\xd0\xdc\x94b\xc9\xd2\x1b\xc8vd\xf0\x93\xcd\
+\xf8\xa94\xd9\xcev\xb4\x9fD\xf9)\xb4\xd7T]\x7f\xa2Wq\x15\x08\x86\x0f\x1d$w\
+\xe7j>\xfb\xf2;\xbe\xfa\xe6\x18\x93\x85\x1cV\xf2q\x068\'\xbc\xf8\xfaNfg\xdah\
+\xef\xee\xa0+s\r}\xbd]\xf4vw0\x7fnKUg\xd6Z\xf2\xf9\xfc\xcc\nTSb\xe8\xd6\x95|\
+|`/\xd6.\xa3\x7fQ+\xce9\xacu\xbc\xbc\xe3=\xba\xb3mt\xceie\xd1\xb5Y|?\xc5\xf7\
+G~\x01 \x97/\x10\x18\x03(\xb4V\x14\x03\x83\xefy\xe4&\n0\xedi\xa9\x94\xf6f\
+\x94G\x9c\x95\xf4\xfau\x0c-\xbb\x89\xd9\xfbv\xb1\xf2\xee\x01~8r\x84\x84\xef\
+\xd1\xdb\xd7\xc6\xd7\x87O#\x08\xce:<\xed\xa1<\xd0J\xa3\x148+(\xa5\xf0\xb5Bi\
+\x1d\x164\xc0\xf34[\'<tK\x0b\xb9\xed;j\x03L\x87\xe8<\xfc\ts\x9a!\xdd\xda\xce\
+\x85|\x91=m=5\xd7\xd6k\x87\x9fy\xb6>@\t\xe2\x96\xa7\x9e\xe4\xc7\xb1\xb1\xb8/\
+\xb10\xcb\xf8\xb67\xe0\xf8\xd1\x7f\r\xa0\xb4\xa7\x1a\x02\x00\x90tK\xc5\xbd\
+\xaar\x7f_\xf1_\xfa\x7f\x00\xe2\xb4\xfckLg0\x06\x00\x00\x00\x00IEND\xaeB`\
+\x82V\xedS\xe5' )
+
+def getIconImageListBitmap():
+    return wxBitmapFromImage(getIconImageListImage())
+
+def getIconImageListImage():
+    stream = cStringIO.StringIO(getIconImageListData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconImageRgbData():
+    return zlib.decompress(
+'x\xda\x01\xa1\x08^\xf7\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00 \x00\
+\x00\x00 \x08\x06\x00\x00\x00szz\xf4\x00\x00\x00\x04sBIT\x08\x08\x08\x08|\
+\x08d\x88\x00\x00\x08XIDATX\x85\x9d\x96\xdb\x8b]W\x19\xc0\x7fk\xed\xb5/g\xef\
+s\x9b3\x97L\x936\xa9)\xd6\xaa\xadi\xbd\xb4RE\x83"H\xf0\xc5J\xdfD\xd0\xa7\x16\
+#T*\x04\xb4xA\x8b\x04\x15j\x1f\xfc\x0b\n\x12P\xb4\xb6\xf4\xa1\x0f"EL\xadFm\t\
+%ms\xed$3\x93\xcc\xcc\x999\x97}_\x17\x1f\xce\xe4LS\x9b\xa4\xf8\xc1b\xef\xcd^\
+\xac\xef\xf7}\xdf\xfa.BH\x8f\x1b\xc9\x93?\xfb\xa9\xcb\xf3\x9c\xaa\xaa(\x8a\
+\x82\xba\xae1\xc6`\xad\x9d>\x8b\xa2\xa0,K\xca\xb2\xc4ZK\x9a\xa6\x0c\x06\x03N\
+\x9e<\x89C\x88\x1b\x9d\xafn\xa8\x1d\x18\x0c\x06<\xf4\xd0C7\xdb6\x85\x18\x0e\
+\x87\x0c\x06\x03\x00\x8e\x1d;\xc6\x8b/\xbe\xe8\x84\xf4\xae\x0bqS\x00\xcf\x9b\
+x\xe8\xfe\xfb\xef\xbf\xe1>\xe7\x1cB\x08\xb2,\xa3\xdf\xef\x93\xa6)\xc7\x8e\
+\x1d\xe3\xe8\xd1\xa3\x1c9r\xe4\xba\x10\xf2f\x00Y\x96\xddl\xcb5\x12\xc71\xbd^\
+\x8f$I\x08\xc3\x90\x83\x07\x0fr\xf4\xe8Q\x9c5\xee\xff\x02\xb0\xd6N\xdf\x9ds\
+\xef\xb9\xae\x07\x01\x13\xcf\xdd\x08\xe2\xa6!x\xf0?Os\xe1\xe5\xa7y=\x83\xa2\
+\x02\xaf\xf2\xb0r\x96T\xf6x\xf4\xb5\x7f!\xa5\xc4\xf3<\x84\x10\xd3p]\x85\x08\
+\xc3p\n\x01\xbcg8\xae\x0b\xf0\xc7\xaf\xe1\xf2\x91\xe5\xbe\x18\xeaBP\xa7\x8e*\
+\x05\xafPd$T\xe1<O\xddw\x88 \\\xe4[\x7f\xf9\ra\x18\x12\x04\xc1\x14\x06 \x8a"\
+.\\\xb8\xc0\xbe}\xfb\xae\x0b\xf1\x9e\x00\xbf\xff\xbarw\xcf&\xa8\xd6\xadx\x9d\
+;\t\xf7\xdc\x8b\xa9%\xd5`D\xbd\xb4\x82Z3\xac\x9d\xda\xe2\xde`\x91L\xed\xe2\
+\x17\x07\x9f\xe0\x91\xe7\x8e\xd0n\xb7\x89\xe3\x18\xa5\x14RJ|\xdfgyy\x19\xe0\
+\xba\x10\xe2\xddu\xe0O\x87\x1b\xee\xde\xdb\xf7\x12\xdd\xf1e\xc2\xc5\x8f#d\
+\x83\xfa\xca2\xf9\xf2E\xca\xd5\r\xf4z\xc68\x8d)\xab\x19r\xddcp\xa5A\xbfn\xf0\
+\xef\xfe\xdb|\xe7w\xdf`vv\x96f\xb3\x89\xef\xfb\x1c>|\x98\x95\x95\x15\xb4\xd6\
+\xd3UU\x15Zk\xca\xb2\xe4\xc4\x89\x13\\\x03\xf0\x87\xc7\xe7\xdc\xa7\xee\xfe0\
+\xc9]_%\x98;\x80\x0c\xbb\x94gO\x90\xbf\xf1\x0f\xca\x8d\x94\xf1\xe9\xf3\x94g\
+\xfb\x8c\xe5>\xd8u\x1fn\xe6\x83\x8c\xc7mN\x9fIY1\x05\xe7\x8ae~\xf4\xcc\xc3,,\
+,\xd0l6\x01\xb8\xb8t\x814\x1b\xb1vy\x85\xd5\x95\x8b,\xbd\xbd\xc2p\x94\xb1\
+\xb4\xb4\xc43\xbf=\x86\'\xc4$\x11\x9e}\xe2\x0ew\xe0\xa3\xb7\x92\xec\xff\x12\
+\xe1\xc2\x01\xbc\xa4\x87\xde<G}\xf9\x0c\xd9\xab/P\xbcu\x92b\xb5O\xb9Y\x91U\
+\x0b\xa4\xe3YF\x9b]R3\xc7Ht\xb8,k\x06\xca\xf1\xecs\xa7\xf8\xfc\x17\xf7\xe0\
+\xfb>a\x18\xd2\xe9tqN\xd2l\xb6\x89\x1a-f\xda1\xcdV\x84\xae-/\xfd\xf5o;w\xa0\
+\xf0C\xfc\x99\x0f\xe0/\xdc\x83\x97,Po\xbc\x89\x1e.Q,\xbd\x84\xde<\x83M\x0b\
+\xea\r\xa8\xeb}\x98\xc6\x0c\xb5\xbf\x8b\xcc\xdbE\xbf\nYm86\x8c\xcf\xd86X\xcf\
+\x06\xac\xac\xac \xa5\xc4ZK\xb3\xd9\xa4\xddn\xe1\t\x8b\x9c\x9f#\tj\x00v\xef\
+\xea\x03\xdbu\xe0\xd9_?\xe8>y`7\xa2\xb9\x0b\x19\xcfRl\x9d\xa2.V\xa9\xfa\xaf\
+\xa3\xf59D"\x91\xa1\xc0\xf3\xc1\x8a&\xda\xdfK\xa5\xee\xe0\xb2js\xba\xe18\x1f\
+:6{]\x86\xdd\x0eE\xaf\xc77\x7f\xf52\xab\xab+\x8c\x87[\xa4\xc3>\xc2\xd6D\x81$\
+\xf0 \x8a\xdb\xec\xbee\x81\x99^g\'\r\x0b\xeb\xe3\x1a-\xfc\x85\x8f`\xcc\x88\
+\xaaX\xc5d\x97(\xc7o\xe1\x94\x877\xdf\x80\xb1F\x8a\x8a"\xb8\x8d\xbcq\x0fg\
+\xc2\x19N\xc5\x96\xf5\xd8c\x10{\x8c\xa4#-C\xd22\xa7T5\x9b\x1b\xeb\xb4\xe2\
+\x10%-\xbe\'P\x12\x1a\xa1\x8f\xd1\n\xd5n\x91l\xd7\x08\x05`\x82\x08\xd7Z\x98X\
+_.\xa3\xed\x18-RL\xbb\x87\x0c"l\xab\x85\xe4\x02\xde\xb9u\xf2\xea\xb3\xbc\x12\
+\xef\xe6\xd5Y\xc1Z+b\x18IR\xcfQR\xa0KIe\x12\xccx\xc4x<d\xb0\x15\xd3i6(\x03I\
+\x10\x04\x18S\x13\x05\x8a<\xcfQ\x9e\xde\x01\xb0*BDm\xb4\xcb\xb1\xca\xc75\xbb\
+h\xd1\xc7\x85\xb7\xa1\x9d\x01\xa3\x11{\xee\xe2l2\xe0\x87\xe7\xbe\xc0\xd9\xf9\
+\x804\xf4\xc0\x1a\xf0\x0c\x94\x19\x149x\x15\xd4\xc00%\xcf3\xb2tLQ\x16\xc4\
+\x91\x0f\x9eDy\x92\xca\x14\x84\xbe\x873f\x07`\xe8$\x1b\x94TzD\xa93*[\xd07\
+\x9a\xdc9RkY\xae-\xc7\xf3\x9a\xd7\xef\xfc\x1c\xbd\xfd\x0b\xb4\x86\x0e[\x19\n\
+mq\xd6\x82\xcd\xc1J\x18\x15\xa0S\xa8rL]\xa1\x8d\xc6\xe8\n)-F\x97\x08!P\x02*k\
+\x08\x03o\x07`\xd3T\xbc]\xe64\xb8BiJ\xc6&g\xbd\xacY+\x0b.\xd6%o\xe8\x9aUfh\
+\xfb\xf3\x089\xe0C\xedY\xd6+\x8fAi\xc8\x8d\xa3(}j]\xa0M\x8d\x1d\x0c\xa0\xcc\
+\'\x8d\xcaj\x9c\xadq\xc6\xe0\x9c\x01!&\xdf\xae\x06\xf3\x8e\x10lJ\xc7\xa5\xd2\
+\xa0\xcc\x06\xb5\xf0)P\x9c\xc9\n\x96t\xc6\x92\xd1\x0c\\L\xe8\xdf\x022\xc2\
+\xc8\x1c\xcfd,\x841\xa1\x14\x8c*\xcd\xc8UTuJ\x99o\xa1u\x81\xc6"p`\xcd\x14By\
+\x1e\xb5\x99\xa4\xa0\x12L\x80\xae\xa6\xe1/\x1f}A\x1c?~\x9e\xd3\xe9\x807\xc7[\
+\x9c/3V\xac\xe0\xbc6l\xd9\x06J\xce\xe3y-$\xe008\xbf\xc4x5m\xa3I\xf2-\x92|\
+\x8b\xa8\x1c\x13\xea\x02\xb9\xb9\xca\x8f?\xbd\x88\xc0"\xc4U\x10\x8ds5\xce\
+\xec,\xb5\xdd\x0f\xa7\x85(\r\xe0b\x991\x12\x96Q\t\x97\x8d%w>Ju\xf0d\x03O4\
+\x00\x85s5VT8=\xa6\xdc\xda$,,\xf9\xb8\x8f\x9f\xe6\x94kK8\xa5h5\x13\x02\xdf#\
+\xf2\x15\xbe\x14\x08\x0c\xce8\x94\xb3\x94\xba\x9c(\xb4z\xc7\x03\x00\xcf?\xfe\
+g\xf1\xe6\x89K\xack\xc7J\xad\xc9*\x81\xf0\x9aH\x12<\xd1@\x08\x85\xf3$\x16C\
+\x95\x8d(\x07\xcbXWP\x0cW\xf1\xcb\x12}\xe9\x142\x1b\xf0\xfdO\xcc\xe1+I\x1c\
+\x054\x93\x06a \x10X\x9c\xad1\xceL\xee\x80\xadq\x98k\x01\x00^\xfb\xc9q\xb1\
+\xf4\xca\x12\xd9\xa6\x81B\xc1\x10\x84\xf3p\x048\xe7\xe1\xb4Fg\x19u>\xc4b)\
+\x07\xeb\xd4\xe9\x06\xd9\x95s\x98\x8dU\x1e{`\x0f\xbdN\x9b\xa4\x11\xd0n%\xb4\
+\x92\x90\xc0W\x087\x99\x9e\x9d\xa9\xf1\x84Cl\xdf\x8bkBpU\xae\xfc\xfc\x9f\xa2\
+\xfb\xd8\x03.\xdc\xb3\x88\x88\x1bXa\xa1\x1e\x83\x10\x18\xaf\xc6+}d\xe5\xa8\
+\xc6\x9a\xea\xe22\xf5Z\x9f\xaa\xbf\xc9\xb7?\xb3\x9fV3!n\x04\xf4\xbamz\xdd&\
+\xcdF\x80\xef9\xc0M2\xc1\xd68;\xb1\xfc\x9a:\xf0n\xd9z\xea\xefb\xf6\x07_q\xfa\
+\xd2\x15\xc4\x1e\x1fO5\xb1u\x05f\x8c\xeb\x8fq\xe3z\xd2\x9c\xd6\xb6\x90~\xc4w\
+\x1f\xdcO\x1cG$Q\xc8\xecL\x9b\xf9\xd9\x0e\xbdvB\x14\xfa\x08\x1c\xceLB\xe0t=\
+\xb9\xfd\xce \x81\x8f\xdd\xb9\xf7\xfa#\xd9\xc6\x93\xcf\x0b\x80\x85\xef=\xec\
+\xaa\xc1\x06\xc2\x8b\x10*\x81A\x8a\xb0\x02W\x18\x1e9p;3\xdd\x16\x81\xef\x117\
+Bz\x9d\x16\xf3s]\xe6\xba-\xe2\x86BJ\x07\xce\xe0\xac\x99*w\xb6\xc6\x18\x8bp5\
+\xa8\xf71\x94\xde}b\x8dC\x87\x0e\xb1kn\x864\x1db\x8cA\xe2p\xce \x80\xc0\x97\
+\xc4\x8d\x90N3\xa6\xd7m\xd2\xebL\x94{\x9eD\xd8I\x01\x9a(\xaf\xa7 \x98mOh}s\
+\x80(\x8aX\\\\\xe4\x96\xf9\x0e\xe9\xb8\x815\x1akkp\x0e\x81%\xf2\x15\xcdV\x83\
+v#\xa4\x99DD\x81\x87\x94n\xa2|Z\x05\'\xcam]\xed\x1c\xac\xdfQ\to$\xbe\xef3??\
+\xcf\xde\xdb\xe6)\xf21\xa6\xaepN\xe3\xacAX\x8b\xefK"_\x12(\x89\xaf$BX\xb0n\
+\xaa\xdc\xdaj\xc7\xf2w\x88\x15\xef\x13\xa0,K\x92$\xa1\xd3\xed\xd2\x8aCj\xe7&\
+\xae3c\x8c\x10X\x11\x10\xba\nk\'M\x07m\xd1f\xdbRk\x11\x80\xb1n\x92\xf0\xdbV\
+\x03\xdb\xbd@\xdd\x1c \xcb2\x84\x19p\xfa\x8d\xc1\xb6%9X\x0b\xae\x9a\xc4\xd7\
+\x18\x843\x93\xc2\xa2\xf5v\xceo\x97\xde\xda`\xdd\xe4\xc2]\x8d\xb9\x15z\xda\
+\x88@\xf3?c\xf9\xbbe~\xae\xe3n\x9d\xeb\x82\x8a@\x17\xa0"\xb4\xd6(\xf4\xf4\
+\x1d\xae\x1e\xa8@\x17(\xa5&{\x14\x93q\x9c\x08\xa5\xb6\xf7h\xcd\xf6\x0fN_\\\
+\xe7\xbf@`\xff\xb6P H`\x00\x00\x00\x00IEND\xaeB`\x82\xd2\xb8-Z' )
+
+def getIconImageRgbBitmap():
+    return wxBitmapFromImage(getIconImageRgbImage())
+
+def getIconImageRgbImage():
+    stream = cStringIO.StringIO(getIconImageRgbData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconImageUnknownData():
+    return zlib.decompress(
+'x\xda\x01\x1d\x08\xe2\xf7\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00 \
+\x00\x00\x00 \x08\x06\x00\x00\x00szz\xf4\x00\x00\x00\x04sBIT\x08\x08\x08\x08\
+|\x08d\x88\x00\x00\x07\xd4IDATX\x85\x9d\x97k\x8c]U\x15\xc7\x7f{\x9f\xc7}\xdf\
+\xb9\x9dN\xa7S\xa8v\xb01\x82"X$@L\xac\x8d1XK?`)\x13\x0b\x06? \x1a\xc0\x04C\
+\x80\x12$\x08Q\xa3C\xd2D\x07H@yh\xc4\x9aA\x08\x10\x85(\xfa\x85\x04h\x95\xe1Q\
+\x18\xa9@)}\xcc\x94\xdby\xbf\xee\xbd\xe7\xb1\xf7^~\xb8wF\x85\xe9\xcc\xc4\x95\
+\x9c\x9c\x0fg\xe7\xac\xdf\xfe\xff\xd7Y{\x1d\xa5\xb4\xc7R\xf1\x93\x1f\xffH\
+\x1a\x8d\x06I\x92\x10E\x11i\x9ab\xad\xc59\xb7p\x8f\xa2\x888\x8e\x89\xe3\x18\
+\xe7\x1c\xb5Z\x8d\xe9\xe9i\x06\x07\x07\x11\x94Z\xea\xfd\xfe\x92\xd9\x81\xe9\
+\xe9iv\xec\xd8\xb1\xdc\xb2\x05\x88\x99\x99\x19\xa6\xa7\xa7\x01\xe8\xef\xef\
+\xe7\xb9\xe7\x9e\x13\xa5\xbdSB,\x0b\xe0yM\x85.\xb8\xe0\x82%\xd7\x89\x08J)\
+\xea\xf5:\x13\x13\x13\xd4j5\xfa\xfb\xfb\xe9\xed\xede\xf7\xee\xdd\xa7\x84\xd0\
+\xcb\x01\xd4\xeb\xf5\xe5\x96\xfcO\xe4\xf3y\xda\xdb\xdb)\x14\nd2\x19\xb6l\xd9\
+Boo/\xe2\xac\xfc_\x00\xce9\xa0\xb9\xc3\xa5\xae\xc5 \xa0\xa9\xdcR\x10\xcbZ\
+\xf0\xec\xc8K\xec\x7ff\x80\xb3\xdf>\x93C\xd5CDs\x06\xe6\x0c\xd1TDd\x0c\xaf\
+\xdf?\x80\xd6\x1a\xad5\x9e\xe7\xa1\xb5^\x80\xc8d2\x0b\x10\xc0\xa2v\x9cR\x81\
+\x8d=\x9bdc\xcf&\xd9v\xc5yt\xcc\xc1\xc0\x91?3\x15\x1d"\xf2\x8f\x10U\x86\xd8r\
+\xd1\xd9P\x1c\xe3s\xdf;\x93s\xbe\xb3\x99\x99\x99\x19\xa2(\xc2\x18\xb3\xa0H6\
+\x9b\xe5\xe8\xd1\xa3K*\xe1)\xf5Q\x86\x8d=\x9b\xe4\x96\x1bwp\xfc\xe8Q\x06\xf6\
+\x1dc|\xce\xf2\xd0\xaeG\xb8x\xfd\xa5|m\xc3el\xeb\xde\xc9\x9e\'\x9e`\xd7\xce\
+\x1d\xf8\xe5:\xf5\xb0J\xdf\xef\xef\xa5\xe7\xa2]\x08\x82\xa7=j\xb5\x1a/\xbf\
+\xfc2\xabW\xaf&\x8ec\x82 \xa0\xad\xad\rk-\x1b6l`\xff\xbe}w:\x91\xbb\xd4\x87\
+\xfb\xc0\xc6\x9eM\xd2~\xf1\x04\x95j\x85\xc3oj\xceM6\xb0y\xf3f\xba\xbb\xbb\
+\xd1Z\x93\xc9d\x08\xc3\x10\x11\xe1\x9a\x07n\xe6\x96;\xae\xe0\xd1\x17\x1edlp\
+\x8c\xe8\x83,O\xde\xf1GN\xeb:\x8d \x08\xb8\xfb\xee\xbb\xa9V\xab8\xe7p\xce\
+\x92$\t\xf5Z\x9d\xb9\xda\x1c\xd3S\xd3\xbc~\xe0\xc0\xe25\xd0s\xd1U\xf4\xdd\
+\xfe0\xc7\x9f\x1aV\x9f\xfc\xea\x1a\x89\xa2\x880\x0c)\x95J\x94J%\xb2\xd9,\x00\
+\x7f\xd8\xfd+\xbe\xf5\xf8%t\x9c\xd3\x85.{d\x8e\xc1\xbb\x87\xdf!\xf0\x03*m\
+\x15\xae\xbe\xfajFGN2W\x9bazj\x92\x89\xb1QFF\xc7\x99\x98\x98\xe4\xf8\xb1\xe3\
+\xbc98\xb88\xc0\x91\x93\x87pf\x0e\x00k-\xb9\\\x8e\xb5k\xd7\xb2j\xd5*\x8a\xc5\
+\xe2Bq\xd5\x1bu\xe4\xfd3\xc8\x9dg\xf1|\x8dS\x8a\xa9\xa9)fgg)\xe4\x0b\x14\x8b\
+E\n\x85<ss\xb3\xcc\xcdN\xd3^\xa9P)\xb71\xd2v\x92(\x8a(\x16\n\x8b\x03\xbc\xf5\
+\xc1\xab\x94\xcf\x0c\xc9\xe67\xc9P\xc6p\xff\xe0\x93l\xdf\xbe\x9dr\xb9L.\x97#\
+\x08\x02\x94R\x88\x12\ng\x8d\x11\xe4\xd7\xe0\x00\x85F\x804I1i\x8adB<\xed\x91\
+\xcbeQb\xd1\x80\xef\t(\xcbH\xb5J.\x9f]\xfc+\xa8\xee\x1f#\xdb\xa1Y\xbf\xb3\
+\xc1\xa7\xaf\xd1t\x15\xa7\xb9\xf8\xb6\x1ej\xb5\xdaB\xbfWJ\xf1\x95\x9b/\xe5\
+\xb2m;\x19>|\x02{\xdc\xa3\xab\xb3\x9b|&\x87R\xaayN\x98\x14gS\x94\x08\x81\xef\
+\x93\xcb\x86\x14\nE\xca-\x1b\x03\xdf\xff(\xc0{\x8f\xbd\xa6\x92\x91\x8f3:Pc\
+\xe4\x1f\xe3\x1c{\xf5\x1d\xaa\xfe\t&\x8e\xbd\xc1\xf0\xf00\xe3\xe3\xe34\x1a\r\
+>u\xe5\x85\xdcp\xe7\xe5\x0cV\x0f"#\x06\xbfQb\xebg\xb7R.\x95\x08\x02\x0f\xe7\
+\x0cI\x92\x90\xa6\t\xd6Z\x14\x82\xa75\xd90$\x9b\xcd\x90\t\x02\x02\xdf_\xdc\
+\x82\xf7\x1e{M\x01\x9c\xb13\'S\x83\xe3`\x84\xbe\xeb\x1eftt\x14\xdf\xf7\xd9z\
+\xfb7\xd8{\xcf\x1e\xee=\xf0\x0b\x0e\xbe\xf2\nqU\xb8\xb0\xfb|:\xdb\xd7Ri\xab\
+\x10\x06\x01\x88 \xe2\x10i\x1a#\n<O\xe3\xfb\x1e\x81\xa7\x08C\x8d\xf6\xd4\xd2\
+\xad\xf8\xfd\xc7G\xd5g\xd2/p\xfd\x97~\xb0p(\xed\xdas-{\xef\xd9\xc3}\x07\xfbx\
+k`\x80\xdaPBw|\x16\x9b>q>\x9d\xed\x1d\x14\x0b\x05\xc2L\x80\xe7i<\xad\xd0\nP\
+\xa0\x14\xe8\x16D\xe8\xfbh\x14\x8a\x15\xb4\xe2b\xb1Hgg\'\xeb\xd6\xad\xe3\xdb\
+\xf7\xdf\xc4o\x1e\xed\xe5\xbe\x97\xfa8\xf0\xc2\x8bD\xc3BrHqI\xcf\xd79\xbdk\
+\x1d\x1d\xed\x1dd3\x192\xad\xe2\xf3<\x8d\xd2\xa0\x1c\xcd\xecZ\xe1iAkApxZ/\
+\x7f\x18\xe5\xf3y\xba\xba\xba\xe8\xfb\xcb\xc3<\xf8\xcb\xbbx\xfa\xd5\xa78\xf0\
+\xc2\x8b\xd4\x86\x0c\xb3\xff\x8c\xb9~\xdbM\xac\xeb\xec\xa2\xb3\xa3\x93|>G&lz\
+\x1b\xf8M\x00\xad\x14Z\x83F\x9a\x978\x10G\xe8C\x92$+\x9b\x07\xda\xda\xdax\
+\xf7\xc4a\xfe:\xf6\'\xfe6\xf8\x0c\xd1\xa8c\xf6m\x9f[w\xde\xce\x86\xd3\xd7\
+\xb3\xa6}5\xa5B\x81l&C\x10\xf8xJ\xa1uSb\x10\x10\x87\xd8\x14g#\x9cM\xd0\x184\
+\xcd\x13vY\x00\xa5\x14A\x10\xd0\x88#\xf6\xfd\xeby\x92#\t\xe9\xf0\xc7\xd8\xbd\
+\xfdJ\xba::Y\xb3\xba\x83R\xb1@\x18\x06MI\x95Bi\x85BP\x80\x88El\x82\xd8\x14\
+\xb1)\xb8\x14%\x0eO5\xdb\xf3\xb2\x16\xccO:a\xb9\xc4\xc8\xf3\x13\xd4\x8f\xf8L\
+\x1e\x1b\xa4P\xcc\xb3zU\x85|>G\x18\x04xJ5\xfd\x06\x948\x10\x01\x1c8\x838\x83\
+\xb8\x18L\x8c\x12\x8b\xa2\xd9#\xac\xb5\xcb+0\x7f\xb4\x0e\xfc\xfc\x19\xd6\x7f\
+y\x15\x13\xfbc\xf6\xfe\xee\xb7h\x1f\xca\xa5\x02\x85|\x16?\xf0\xd1-\xbf\x95r\
+\xa0\x14\n\x87\xb8\xa6\xf4b\x9a\xd2\x8b\xa4M\x10\x9b`m\x82\xb3n\xe5\x00Zk^\
+\x7f\xec\x1d\x86\x8e\x1fejr\x12?\xf4\xa9T\xda\xc8\xe62(t\xb3\xc8u\xd32\x0f\
+\x85\xe0\xc0&8\x13\xe1L\x0c\x92\x82MQ.EaP\xe2\x88WR\x84\xf3\x16x\x9e\xc77\
+\x1f\xb8\x96F\r\x9c\x15\xfa\xae\xb8\x11\xa5\xc1oMAM\xcf\x9b;\x9f\x97\xde\x99\
+\x18g\x1a\xe0R\xc4\xc6\xe0R4\x96\xc0\xd3\x94\n\x01\x933s+\x9f\t\xb7\xfct+\
+\xb7}\xff\xbb|\xf1\xf2\xd3X{n\x9d\x87\x9e\xfd5q\x1a\x01\x96\xc0\x83\xd0\xd7\
+\xf8Z\xd0\xca\xa1\xa4\x95\xd0D(\x97\x82MPbPb\xc19r\xa1\xa6\xa3\x9c\xe7\xac3N\
+_^\x81\xf9\x98\x1cv\xec\x1d\xb9\x0f{$O\xed@\x998\xdb \x8e\x1aP,\xe2\x05>Hk\
+\xe7b\x11gP.\x01\x97\xb4\xaa>\x05\xb1\xad5\x06\xa5\x14\x1a\x03\xfe\n:\xe1\
+\xfc\xd4\xfb\xf7\x9f\xf5\xf3\xf9\xeb\xb6c\xc6\xde\xa0\x90/r\xc3U?D\x8c\xc5\
+\xf7\x14Z\x0bJ\x04\xdbJ b\x10\x13\xb7\x00\x92Vr\x8b\x88\x01k\xc0\xa6\x88X0fy\
+\x00km\x13\xc4\xa5<}\xeb=\x9c\xa8~@\xb5z\x92\x8c\xf6P\xce\x91\x0b}\xc0\x82\
+\xb3hk\xb1.\x85\xb4\x81\xb8\x18q\t\xb8\xa6"\x88EL\xfa\x9f\x17\x1b\x03\xacP\
+\x01\xa5\x9a\x8d\xa5\\\xcec\xcd*\xf2\xa1\x0fJ(d\x03\x92(\xc2\xf7T\x0b\xc2!&\
+\xc6\xd9\x18I#p\x0ed\x91\xe4\x80S+\x04\x98\xff3r(\xb2aH\xa9R!\x93\xc9\xe1\
+\xbb\x88\xd8X\x1aF(\xeaV\xb1J\x823\t&\xa9\x03\x02\xce\xa1\x00\xeb\xa4\xf9\
+\x03\xd0\xdauSZ\x03\x9cb\x1e\xf8\xef\xa8\xd5j\xd8x\x9c\x83\x83\x138k\xb0i\
+\x1d\x9c\x10Gu\xb4\x07\x99p\x88@+\x04\x8b\x8b#\\\x1aa\xe7\x9bNjq\xd2\xfa*Z\
+\x9e;\xd5\xaa\x83\xa6\x0f|d,\xffp\xac\xe9h\x93\xf5\x1d\x15\xf0\xb3`"\xf0\xb3\
+8\xe7\xc8\x05\n\x82\x1c\xce:P\x864MqV\xe1\x92:\xbe\xefc\x8c\xc1\xf7\xc1\x18\
+\x83!\x8b\xef\xb7\x92\x1aC\xeb\x01\x87\x86\xc6\xf87#\x194\xca\xa1\xed{\xf8\
+\x00\x00\x00\x00IEND\xaeB`\x82\xef\xae\xf7"' )
+
+def getIconImageUnknownBitmap():
+    return wxBitmapFromImage(getIconImageUnknownImage())
+
+def getIconImageUnknownImage():
+    stream = cStringIO.StringIO(getIconImageUnknownData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconMakeViewData():
+    return zlib.decompress(
+'x\xda\x01\xe8\x03\x17\xfc\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00\
+\x18\x00\x00\x00\x18\x08\x06\x00\x00\x00\xe0w=\xf8\x00\x00\x00\x04sBIT\x08\
+\x08\x08\x08|\x08d\x88\x00\x00\x03\x9fIDATH\x89\xad\x95MlTU\x14\xc7\x7f\xef\
+\x0e\xd20\x16h\x85\t\r\x91P\xb5\xb8\xc0J\xbbaS\x95\xd4\xe1\xd3\x18\x83A\x8d\
+\xf1#j\x17\x9a\xb0\xb0;\x17\xae\xc4\xb5K]\xb9\xa1\xf1\x93\xa6BT0hL\xc6:\x10\
+\xacT\xa5\x04\xe3\xc2V\x85\n\xa2\xd8\x96\xce\xc2v\xde}\xf7\x9c\xe3b^\x87\x8a\
+\xd3)\x8d\x9e\xcd}\x1f\xf7\xfe\xff\xf7w\xcey\xf7E\xd4\x88\x03\x07\x0e<\xd9\
+\xd8\xd8\xf8n\x14Ex\xef\t!\xa0\xaa\x88\x08\xe5r\x99\xd9\xd9Yfff\x98\x9e\x9ef\
+dd\xe4\xaf\xd1\xd1\xd1\xfb\x9csgji-\xab\xf5\xb0\\.\xd3\xde\xdeNWW\x17\xce\
+\xb9\x7f\xbc33B\x08\x94J%\xa6\xa6\xa6\xe8\xeb\xeb\xbby\xdb\xb6m\xfd\xaa\xfa\
+\x94sn\xf8\x86\x0cfgg\x11\x11r\xb9\x1c\x99L\xa6\xd6\x14ZZZ(\x95J\xe4r9\xf6\
+\xee\xdd\xbbi\xc7\x8e\x1d\xc7\x9ds\xf7\xab\xea\xb9E\rT\x153\xab)<\x17\x99L\
+\x86\xa6\xa6&\xb2\xd9,\xdb\xb7o\'\x9b\xcd\xae\t!|<88\xf8\x84snhn\x9e\xab\xb5\
+XD\xea\x8aW\x17;GCC\x03q\x1c\xd3\xd5\xd5Eoookww\xf7\xfb\xce\xb9\xbb\xeb\x1a\
+\x00\x8b\x12\xcc\'9v\xec\x18\xc5b\x91\x86\x86\x06\xf2\xf9|kkk\xeb\x17\xaa\
+\xba\xf5?\x13\x00\xec\xda\xb5\x8b\xe57e8\x7f~\x94\xd3C\'\xb8|q\x9cMw\xdc\xbe\
+\xc69\xd7sC\x04\xce9\x06\x07\x07\x17\x1c;::X\xb9\xaa\x89\xfd\xfb{Y\xd7\xb2\
+\x9e=\xbb\xbb\xe9\xdc\xb2\xb9\xaaS\xb3\xc8"R5(\x14\n\xfc~\xebm\xbc\xf7\xe3/t\
+\xb7mDU\x81k\x8d\xe0\xe32\x87\xc6.p\xf0\xec\xf7\xf4t\xb4\xf3\xedP\x81_\xc7/T\
+\xb5\x16$\x98\x8b|>\xbf \xa1J\x82I\x8c\xa9\xe0"8\xdc\xff\x16\xcdM\xabi^\xd5\
+\xb84\x82\xee\xb6\x8d\xff\x16O<\xaa\x1e\r\x9e}\xebW\x11\x82\xa7y\xcb3\\\x1a\
+\xfb\x8ee\xeeZ\r\x97L`fH\xf0\x88T\xc4U\x12\xd0\x04\x93\x84\x0f\xfb\x0f\xe2"e\
+\x99\x8b\xea\x1b\\OP\x15W%$e4\xc4X\xa8\x8c\x1abTb\x081\x0f?\xde\x03\xea\x89,\
+,\x9d@U\x90\xe01\xf1\xa8\xc4\xa8$i\r<&\t\x91%\x1cy\xe7u"\x0b8\xb4\xbe\xc1\
+\xfc\xa3\xa2P( \x12\xd2t\x94Q\xf1hH\xd2\xfbx\x1e\x85g\xdf\xd3/"I\x19\xf4\x06\
+\t\xcc\x8c|>\x8f\x05\x9f\n%iz*i\xb1\x10W\x8cR\x93\xc3}\xaf\x81z\xcc\x92\xfa\
+\x06\xd5\x1a\x98\xf1\xf9\xa7\x9fTv=W\xd4p\xfdu\x9c\xa6-\xe1\x91\xe7^"R\x01\r\
+U\xe1\xba\x06\x12bv\xeey\x90\x81\xf3\x97\x19\xb8p\xe5Z:\xe6(B\x8c\x05\xcfGS\
+\x11G\xa73\x0c\xbc\xf9*\x9a\x94Y\xee\xe0\xae;7,\x9e"\r\t\xc7\x8f~\x80\xaa\
+\x80i\xb5\xa0\x96RXJ\x86)\xa6\xc2c/\xbc\x82\x86\x184\x01dq\x02\x95\x98\x07\
+\x1ez\x94\xb5cgy\xb6\xa3\x93/O\x9c\xa4yC\'\xc5\x93_\xb1\xb6\xed^\x8a\xa7\x86\
+Y\xb7y7\xab\xcf\x15y\xfe\x9e\x9d\xf4\xbf\xf12\xa6\x82I\x02\xe9\x91R\xf3K\xf6\
+\xde\xa7\xff\xe0@\xe9\xcaOh\xf0\\\x1d?\x83\x9811v\n\x95\x98?~\xf8\x0c\t\x9e\
+\xdf\xce\x1cA\xc53\xfe\xf5\xdb\x98\x040\xc3\x08\xd5\xbd\xd74\x98\x9c\x9cd\
+\xe2\xcaE\xbe\x19>]IKH\x88,\xae\xb4\xef\\\xdfK\x82\xa6_\xb0J\xc0,\x80x\xcc\
+\x02\x7fN\\%\xa4\xad\x1a\xd52\xc8\xe5\x9a\xb6\xde\xb22\xdb\xb3b\xc5J@P\x05\
+\xe7@\xd5a$@D$\x02\x118\x94D\x0c2\x11\x0e\x03\x94\x90\x04~\xbe4U\x8c\xe3p\
+\xa8^\x8d\xff\x97\xf8\x1b1{\x9cp \xd0\xadN\x00\x00\x00\x00IEND\xaeB`\x82\xec\
+j\xd4\xa9' )
+
+def getIconMakeViewBitmap():
+    return wxBitmapFromImage(getIconMakeViewImage())
+
+def getIconMakeViewImage():
+    stream = cStringIO.StringIO(getIconMakeViewData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconMarkHighlightsData():
+    return zlib.decompress(
+'x\xda\x01\x8f\x01p\xfe\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00\x18\
+\x00\x00\x00\x18\x08\x06\x00\x00\x00\xe0w=\xf8\x00\x00\x00\x04sBIT\x08\x08\
+\x08\x08|\x08d\x88\x00\x00\x01FIDATH\x89\xdd\x95\xb1m\xc30\x14D\x1f\r\xb5)\
+\xd4\xdbS\xa4IRk\x02\x01\xdf\x9e#\x83\xa8t\xe1\x15\xa4=\x9c\x11\\G\xd9 \xb5\
+\xa0\x9f\x86d\x18I\xa4\x18\x04r\x91\x03\x08\x81"y\x87\xe3?\x92\xf0/ "\xba\
+\xc5\xf7~"\xaes:\xdf\xf4t\xbe\xcd\xd5-T\xf5\x15\xe8c\xe3n}H\xbe\x03\xe8\xba\
+\xce,\xda\x9a\xc0\x18#\xc0AU%5o\xc6\x97C>\x8e\xe3\x13\xa0\xb6]Ss\x935H\xa0\
+\xb5M\x01\xb5\x82y"k\xe4\xc30\xec\x01\xb5\xdf\xde\x8a\xb4Y\xe4\x99"\x8d#\xb4\
+\x85\xd6@\xf0\xef\x0e\x80~\xb2%\xae\x16\xcd*\xf9\x9aH$\x9a\x8d\x15\x88F\xf67\
+\x0e\xaeV\xc4#L\xd4t,\xca\xb7\xf4\xd3\x11E\xf6\xfaJ\xc2E\xae\x03\x1f\xcbT\
+\x9bFVD."r\x010\x00UU=\x94e\xf9\xd9u\x9dq\x93\x86a\xd8\x17E\xf1\xa1\xaa\xc7\
+\x888\xc6\x18\x17\xd57\xe0e\xea\xc0\xf3\x89\xc8\xfb\xc2\xfa\x86\x95\x13\xcbw\
+\xb1\x7f\xb8\xc8\xadA\xbfv\xe7\xb8\x03\xc8Bd\x935\x08\x0eS\x0e\\\xb1}\x18\
+\xa2\x0e\x82\xeb\xbag}{\x1c|\x10\xc2\xeb\xde\x89\xec\\\',0p\x00\x9e\x81v)\
+\xe7\xe0#\xdc\x02\xb3Ko\x81\xefN/\x9a\x88h]\xd7\x8f\x9b\xbc\xc9[\xe1\x0b\xb1\
+&I\x9cf\xaa\x8f\x9e\x00\x00\x00\x00IEND\xaeB`\x82Y\x16\xac\xbe' )
+
+def getIconMarkHighlightsBitmap():
+    return wxBitmapFromImage(getIconMarkHighlightsImage())
+
+def getIconMarkHighlightsImage():
+    stream = cStringIO.StringIO(getIconMarkHighlightsData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconMoveData():
+    return zlib.decompress(
+'x\xda\xeb\x0c\xf0s\xe7\xe5\x92\xe2b``\xe0\xf5\xf4p\t\x02\xd2b \xcc\xc1\x06$\
+\x8fl\xc9\xb1\x06R,\xc5N\x9e!\x1c@P\xc3\x91\xd2\x01\xe4\xf7z\xba8\x86X\xf4^\
+\xbd\xe2\xcd\xd7\xa0\xc0\xc3ra\xe6\xc3\x7f\xee\xdf6\x17*\xf2n\t\rH\x0eg{\xc9\
+\x9d\xc9\xbd\x84\xcbh\xe3\xda\xd3l\x0c!\x89i\xfb\xd7-\xf8V\xcd\x91\xe7(y\xa7\
+\xd5V\xe1\xd0\xcf\xcc\xde\xf7G\xac\x0b\xb6=^\xbba\xe7\xab\xbf\x12GM\xb9\xb7Z\
+0\xfa8\x9f\xff\x18\xf1\xd9c\xea*\x91\xbd\x96\xbd\xcfnH}2\xbbo\xf52\xf1\xa4\
+\xde\x19\x07\xed\n\x91\xed;\xff\xef\xbe\xf4\xee\xb5\x98]\xaf\xdf\xcb;\xc2\
+\xd5\x9d\x81\xf6\x87\x82\xb64\xf8L\x0e6\xb5s\xbey\xf2&c^\x86\xa7}\x92i\xd1\t\
+\xa0\xc3\x18<]\xfd\\\xd69%4\x01\x005\x16S\x93' )
+
+def getIconMoveBitmap():
+    return wxBitmapFromImage(getIconMoveImage())
+
+def getIconMoveImage():
+    stream = cStringIO.StringIO(getIconMoveData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconNextAutoclassData():
+    return zlib.decompress(
+'x\xda\x01\xad\x01R\xfe\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00\x16\
+\x00\x00\x00\x16\x08\x06\x00\x00\x00\xc4\xb4l;\x00\x00\x00\x04sBIT\x08\x08\
+\x08\x08|\x08d\x88\x00\x00\x01dIDAT8\x8d\xb5\xd5=N\x02A\x1c\x05\xf07\xcb\x12\
+u\xb5\x1a-H\x80b\x0b.a\x03\x1d-\r\xa1\xe0\x04T\x9c\x85k@OB\xe8\x08X\x12\x8e\
+\xb0\xc9jpD\xdd\x00;\xe3\xc7\xdfeld\xccF\x8c\xb8\xb0/\x99\xf67//\x93\x0ccV\
+\x06i\xc4JE\xdd\xc2\xc5B^\xa7\x02\xa7\x81\x1b\xb8T*\x1d\x157p\xa5RA\xbd^\xc7\
+\xc5\xb9\xf3+\xae7\x91\xde\xf7\xd8\xe6\x06\xcbB\xab\xd5\x02\x11\xa1\xd7\xeb\
+\xe9{\xf1\xc0v\xe17\x9d\xce\x9fm\xaf\xdb\xed\xef\xc6J)h\xadQ\xab\xd5\xd0h4pu\
+\xc9\x0f\x9a\xc5\xc0D\x04!\x04<\xcfC\xb9\\F\xb3\xd9\xc4\xd9\xe9Ib\xdcL\xa1\
+\x94B\x18\x86X.\x97X,\x16\xa8V\xab "t\xbb]\xfd\xf8\xf4\xbcs\x96\xbd\x1a+\xa5\
+0\x9f\xcf!\xa5D\x14E\xf0}\x1f\xae\xeb"\x97\xcb%j\x1c\x83\x95R`\x8c\x81s\x8e\
+\xf5z\x8d~\xbf\x0f\xcf\xf3\x12\xc1\xb1)\xa4\x94\xe0\x9c#\x08\x02\x0c\x87C\
+\x8c\xc7c\xd0G\xf4\xef\x19b0\x11\xc1q\x1c\x04A\x80\xc1`\x80\xe9t\x9a\x18\xfd\
+\x01\x0b!0\x1a\x8d0\x9b\xcd\x10J\x95\x18\x05\x00\xc6\xac\x0c\x8a\x85\xbcv]\
+\x17\xb6mc2\x99\xe0\xed\x9dv\xa2z\x13\xed\xfd\xfc\x0cLDX\xadVP/\xaf\x075\xdd\
+\xc6\xbc\x8al6{44\x06\xfb\xb7wGC\x81\xaf)\xd2H\xba_S\x1a\xf9\x04LL\xcb\x1fL]\
+\xc1\xd2\x00\x00\x00\x00IEND\xaeB`\x821e\xb3\xca' )
+
+def getIconNextAutoclassBitmap():
+    return wxBitmapFromImage(getIconNextAutoclassImage())
+
+def getIconNextAutoclassImage():
+    stream = cStringIO.StringIO(getIconNextAutoclassData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconNextHeurclassData():
+    return zlib.decompress(
+'x\xda\x01\xac\x01S\xfe\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00\x16\
+\x00\x00\x00\x16\x08\x06\x00\x00\x00\xc4\xb4l;\x00\x00\x00\x04sBIT\x08\x08\
+\x08\x08|\x08d\x88\x00\x00\x01cIDAT8\x8d\xb5\xd5=N\x02A\x1c\x05\xf07\xcb\x12\
+u\xb50\xa3\x05\x11(\xb6\xe0\x1c\xd0\xd1\xd2\x10\nN@\xef1<\t\xf4$\x84\x8e@K8\
+\xc2&\xab\xe2\x88\xba\x02;\xe3\xc7\xdfeld\xccF\x8c\xb8\xb0/\x99\xf67//\x93\
+\x0ccV\x06i\xc4JE]\xc3\xc5B^\xa7\x02\xa7\x81\x1b\xb8T*\xed\x157p\xa5RA\xbd^\
+\xc7\xc9\xb1\xf3+\xaeW\x91\xde\xf6\xd8\xe6\x06\xcbB\xab\xd5\x02\x11\xa1\xd3\
+\xe9\xe8;q\xcf6\xe1\xcf\xb7W\x7f\xb6=\xbd\xb8\xfcn\xac\x94\x82\xd6\x1a\xb5Z\
+\r\x8dF\x03\xe7g|\xa7Y\x0cLD\x10B\xc0\xf3<\x94\xcbe4\x9bM\x1c\x1d\x1e$\xc6\
+\xcd\x14J)\x84a\x88\xf9|\x8e\xd9l\x86j\xb5\n"B\xbb\xdd\xd6\x0f\x8fO\x1bg\xd9\
+\xaa\xb1R\n\xd3\xe9\x14RJDQ\x04\xdf\xf7\xe1\xba.r\xb9\\\xa2\xc61X)\x05\xc6\
+\x188\xe7X.\x97\xe8v\xbb\xf0</\x11\x1c\x9bBJ\t\xce9\x82 @\xbf\xdf\xc7p8\x04}\
+D\xff\x9e!\x06\x13\x11\x1c\xc7A\x10\x04\xe8\xf5z\x18\x8f\xc7\x89\xd1\x1f\xb0\
+\x10\x02\x83\xc1\x00\x93\xc9\x04\xa1T\x89Q\x00`\xcc\xca\xa0X\xc8k\xd7ua\xdb6\
+F\xa3\x11\xde\xdei#\xaaW\xd1\xd6\xcf\xcf\xc0D\x84\xc5b\x01\xf5\xf2\xbaS\xd3u\
+\xcc\xab\xc8f\xb3{Cc\xb0\x7f}\xb37\x14\xf8\x9a"\x8d\xa4\xfb5\xa5\x91O]t\xcb\
+\x1f\xf6\x04:`\x00\x00\x00\x00IEND\xaeB`\x82\x0f\x0c\xb6\x02' )
+
+def getIconNextHeurclassBitmap():
+    return wxBitmapFromImage(getIconNextHeurclassImage())
+
+def getIconNextHeurclassImage():
+    stream = cStringIO.StringIO(getIconNextHeurclassData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconNextManclassData():
+    return zlib.decompress(
+'x\xda\x01\xa9\x01V\xfe\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00\x16\
+\x00\x00\x00\x16\x08\x06\x00\x00\x00\xc4\xb4l;\x00\x00\x00\x04sBIT\x08\x08\
+\x08\x08|\x08d\x88\x00\x00\x01`IDAT8\x8d\xb5\xd5\xb1N\xc2@\x1c\x06\xf0\xefJ\
+\x89Z\x9dN\x07\x12`\xe8\xc0s\xc0\xc6\xc2\xc0B\x18x\x02^\rVBB\xd8\x08\xac\x84\
+GhR\r\x9e(\r\xd0;\x95\xbf\xe5\\\xa4\xa6\x11#\x16\xeeKn\xfd\xdd\x97/\x97\x1cc\
+V\x06&b\x19Q\xf7p\xb1\x90\xd7F`\x13x\x0c\x97J\xa5\xb3\xe21\\\xa9T\xd0h4ps\
+\xed\xfc\x8a\xeb]\xa4\x8f=v|\x83e\xa1\xddn\x83\x88\xd0\xedv\xf5\xa3xb\x87\
+\xf0\xde\xb2\xf7g\xdb\x1a\xaf}7VJAk\x8dz\xbd\x8ef\xb3\x89\xbb[~\xd2,1LD\x10B\
+\xc0\xf3<\x94\xcbe\xb4Z-\\]^\xa4\xc6\xe3)\x94R\x08\xc3\x10\xab\xd5\n\x8b\xc5\
+\x02\xd5j\x15D\x84N\xa7\xa3\x9f_\x96\x07g9\xaa\xb1R\n\xf3\xf9\x1cRJDQ\x04\
+\xdf\xf7\xe1\xba.r\xb9\\\xaa\xc6\tX)\x05\xc6\x188\xe7\xd8l6\xe8\xf7\xfb\xf0<\
+/\x15\x9c\x98BJ\t\xce9\x82 \xc0p8\xc4x<\x06}D\xff\x9e!\x01\x13\x11\x1c\xc7A\
+\x10\x04\x18\x0c\x06\x98N\xa7\xa9\xd1\x1f\xb0\x10\x02\xa3\xd1\x08\xb3\xd9\
+\x0c\xa1T\xa9Q\x00`\xcc\xca\xa0X\xc8k\xd7ua\xdb6&\x93\t\xde\xb7t\x10\xd5\xbb\
+\xe8\xe8\xe7\x17\xc3D\x84\xf5z\r\xf5\xfavR\xd3}\xe2W\x91\xcdf\xcf\x86&`\xff\
+\xfe\xe1l(\xf05\x85\x89\x98\xfd\x9aL\xe4\x13[\xc4\xcb\x1f\x0e\xcf\xf5^\x00\
+\x00\x00\x00IEND\xaeB`\x821\xca\xb7\xeb' )
+
+def getIconNextManclassBitmap():
+    return wxBitmapFromImage(getIconNextManclassImage())
+
+def getIconNextManclassImage():
+    stream = cStringIO.StringIO(getIconNextManclassData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconNextUnclassData():
+    return zlib.decompress(
+'x\xda\x01\xa2\x01]\xfe\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00\x16\
+\x00\x00\x00\x16\x08\x06\x00\x00\x00\xc4\xb4l;\x00\x00\x00\x04sBIT\x08\x08\
+\x08\x08|\x08d\x88\x00\x00\x01YIDAT8\x8d\xb5\xd5\xbdj\x02A\x14\x05\xe03k$\
+\xc9&\xd5$\x85\xa0\x16\x16>\x87v\xb66b\xe1\x13\xf8j\xda\x0bb\'"\xd8\x88\x8f\
+\xb0\xb0\tfb\x92E\xdd\xb9\xf9\xb9\xd9L\x9a\xb8aQ\x89Y\x9d\x0b\xd3~\xf7\xcca`\
+\x84p2\xb01\x8e\x15u\x03\x17\x0byc\x05\xb6\x81\xc7p\xb9\\>)\x1e\xc3\xd5j\x15\
+\x8dF\x03\xd7W\xee^\xdc|E\xe6\xd0s\x16op\x1c\xb4\xdbm03\xba\xdd\xaeyP\x8fb\'\
+n\xfe\xbe\x94\x10\xe271\x11\xc1\x18\x83z\xbd\x8ef\xb3\x89\xdb\x1byT-1\xcc\
+\xccPJ\xc1\xf3<T*\x15\xb4Z-\\^\x9c\xa7\xc6\xe3*\x88\x08a\x18b\xb9\\b\xb1X\
+\xa0V\xab\x81\x99\xd1\xe9t\xcc\xd3\xf3\xcb\xceZ\x0eJLD\x98\xcf\xe7\xd0Z#\x8a\
+"\xf8\xbe\x8fR\xa9\x84\\.\x97*q\x02&"\x08! \xa5\xc4z\xbdF\xaf\xd7\x83\xe7y\
+\xa9\xe0D\x15ZkH)\x11\x04\x01\x06\x83\x01F\xa3\x11\xf83\xfaw\r\t\x98\x99\xe1\
+\xba.\x82 @\xbf\xdf\xc7t:M\x8dn\xc1J)\x0c\x87C\xccf3\x84\x9aR\xa3[\xf0x<\xc6\
+d2\xc1\xfb\x07\xefE\x858l\x9f\x10N\x06\xc5B\xde03V\xab\x15\xe8\xf5\xed\xa8\
+\xa4\x9b\x89_E6\x9b=\x19\x9a\x80\xfd\xbb\xfb\x93\xa1\xc0O\x156\xc6\xee\xd7dc\
+\xbe\x01\xf4E\xca\xb3\x9b\xeb\xcc;\x00\x00\x00\x00IEND\xaeB`\x82u\xfb\xb0\
+\xc2' )
+
+def getIconNextUnclassBitmap():
+    return wxBitmapFromImage(getIconNextUnclassImage())
+
+def getIconNextUnclassImage():
+    stream = cStringIO.StringIO(getIconNextUnclassData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconNoninterClassifyData():
+    return zlib.decompress(
+'x\xda\x013\x05\xcc\xfa\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00 \x00\
+\x00\x00 \x08\x06\x00\x00\x00szz\xf4\x00\x00\x00\x04sBIT\x08\x08\x08\x08|\
+\x08d\x88\x00\x00\x04\xeaIDATX\x85\xed\x96KlTU\x18\xc7\x7fg^L\xdby\xd0N\x87\
+\xb6Pu\x01Mx\x89F\t$\x80\x11\xf0\x81\x0b4\x9a\x08\x1a\x84\x85\x9b\xca\xc6H\
+\xa2\t\r\x01K\x85\x08\x821\xac4\x9a\x10M\x94\x98\xba\xd0\xb4\x90b\x14\x08i\
+\x89\xc4\x04\x14m\x0b\xe5\xd5\x96J;\x8f;\xaf{;3\xf7\xdeN\xef=.\xa4E\x08\x8fv\
+\xc0\xb8\xe1\xbf;9\xe7|\xdf/\xff\xef\xcb9\x1f<\xd0\x03\xfd\xcf\x12E\xde\x93\
+\xf7+f1\x00r0\xb6\xef\xb6\x9b3\xaa6M*\xeed\x01\xee\x98\xfc&\x88\t\xe5\xfaO\
+\x00n\xa5\xdb9\xe3**Z\x91\xaa\xd8P!\x01\xe6\x9b\xf3i\xff\xae]\x14\x05p\xe2x\
+\xcf\r\xebe\xcbgO\xea\xfe\xba\xa7\xd6\xb1\xff\xb3\xfd\xe3\xeb\x89\x96\xe0\
+\xb6]\xdf\xdc\xbc\xf1\x06\x88Q[\xf0\xd8\x9cF\x9cN\'\xc9d\x12\x80P(\x84eY\xbc\
+\xf1\xd1\x06\xbe=q\x00\xbdS\xa7\xe1\x95\x06G}}\xbdk"\x00w\xed\xfa\xe6\xe6\
+\x8d\xff\x1c\x94\xb0y\xf3a\x06\x06\x06\x90\xf2Ff!\x04\xb5u\xb5\xe4\x16\xe7\
+\xd0\xbbtN\x1f8\xedR\x14E\xde\r@\x8e\x05\x1f\xd3\xad,\x1f\xeb\xfap8\x8c\xa2(\
+TWW\x13\x8dFi\xda\xbe\xdd\xb1\xfc\xf8q\xf1\xcd\xda\xd9V\xcb\xc7\xdf\x13\xef\
+\x8d\x13Z\x18"o\xe5ix\xb9\xc1\xd1\xd8\xd8x[\x80\t[.%\x88kQ\x16\xcc\xddA2\x99\
+d\xcc\xb1\x19U\x9b\xc4\xab{\xd6\xc8c\x9dG\x01H}\x9d"\x14\n\xa1\x95i\x14\x06\
+\n\xa2\xa9\xa9I\xdc\xaa\t\'l\xf9\xcd\x00c5\x97\x12j\xab7\x89\xf5\xfb\xd6\xcb\
+\xb6\xd3m\xc8\x02X\xc3\xd6\xf8\x19\x97\xc7\xc5\xd9\xb3g\x9ds\xe7\xce\xb5nv\
+\xa0\x88\x87Fp\xb3a[\xb6\xae\xa6\xe5T\x1f\xbd\xf1^p\x82,H\xa4-0\xff\xd4\x01p\
+Mw\xa1_\xd1k\xdcnwt\x1c\xa0\xb5\xbfUv\xa7\xbb\xef\x9a\xfcV\xb2m8\xbfg/\xe7.\
+\xe4\xd1u\x8b)^\'\x96%\x18\xce\x8e"\xa5D\xda\x92\x12\xaf$\x97\xb7A\x80\xbfb\
+\n\x9dg\x8c\x17\x85\x10\x87\xc6K\x10\xcdG\xe9JuM:\xb9GxXz1\xc8\x86\xbd\xed$\
+\x12\x11\xf2y\x15\xc3\x18F\x08\xf0N\xf1\xe0p\xba\xf1x|\x94\x96\x05)+\x9d\x8a\
+5:B$2\xc8\xb6-k\x0e\x16\n\x85\x9aq\x80\xa4\x99\xe4d\xfc\xe4\xa4\x01\xd6\xfd\
+\x1ef\xe6\xaaw\x89\xc7\x07\xe8\xeb\xfb\x03MK\xe0t:)\xf1z\xb9p~\x88\xa9S+y\
+\xe6\xd9\x15\x04\x83\xd3\xf0\x95U\xe0\xf5\x96Q^Q\xcbP\xa4\x8f\xa5KfG\x8a~\
+\x8a\xed\xbc\x8d9`R[;\x839\xf3\x17q\xfaT\x1b\xd9l\x1a\xdb\xb6\x08\x85\xa6\
+\xd1\xd6z\x90\x83\xad\xdd %\x9dgN\xf0\xc1\x87_\xe1\xf5\x96\x92\xcb\xa9hZ\x9c\
+\xba\xba:$%\xc5\xff\x05\xea\xcf*\xc6E\x83\xc4j\x93h\xa4\x17E\xe9gt\xb4\x80\
+\xcfW\x8eC\x049v\xf4\x1c\x0e\x87\x13)\xa1\xa3\xa3\x9bP\xe5ChZ\x02MK\xa0\xaaq\
+\x92\x89\xab\x8c\x8c\xe88\x8a\x05\xf0<\xecA\x16$\x97z\x93\xa8\xda \x85\xc2\
+\x08>_9~\x7f\x88\x9a\xe93X\xb1r\x19#\xa6I\xa1`\xf2\xf4\xf2\xe7H(C\xe3\x00\
+\x9a\x96 \x91\x1c\xc44\xf5\xe2\x1d\x10.\x81\x10\x82\xbe\xfe\x14\xc1@\x00\xbf\
+\xbf\x9c@\xa0\x12\xbf\xbf\x12\x9f\xaf\x9c-\xdbv\x12\xfd\xeb\x1d\x9cN\x07M;\
+\xf72R\xc8\xa1\xaa\n\xc3\xc3\tTU!\x93\x89\xd3\xd33t\x8f\xdf\xb1\x13\x0c\xc3\
+\xc2\xe3)%\x18\x0c\x13\x08T\x11\x08\x84\x08\x04\xc2\x08\x01\xb1\xc4e\\.\x17\
+\xb64Igb\xa8j\x0cMK\xa2i\t\xb2Z\n\xe0z\tJ\x9c%\x93K.\x01\x01\xa6\t\x1e\x8f\
+\x9f@ |-y\x88\xaa\xaaG8w\xa6\x0b%\xa1\xa3\xa6t:\x8e\x1e&\x97\xcb\xa0\xaa\tr\
+\xb94\xd9\xacF2\x95\x06\xfe5\x0f\xb8\n.2\x872H\xfbN\xf3\xe6uY\xaa\x85m\xd8\
+\xd4\xd4\xfaq:J\xa9\xa9\x99\x89\xcb\xe5%\x18\x0c#\xa5\xe0\xd3\xcf\xb7\xa2\
+\xeb\xa3\x98\xa6Ek\xeb\x97\xac]\xff&\xd9l\x12\xcb6\x19\x1eN\x91JF\x80\xe2\
+\xa7\xe2q\xd9\xb6=o\xdf\'\xefw\xd5\xbf\xf56\x12\x17\x1eO)\xba>\xcc\xe3\x8f\
+\xceBM[\x08\xe1\xa0"\xe4a\xc7\xae\xf70\x0c\x05\xc3\xd0\xe9\xef\xbdD{{\x17\'~\
+\xb9:\xeb\x9eG\xb2\x8e\x8e\x8esG\x8e\xb4\xb0d\xe9R\x9e\\\xb8\x92\\NEUc\xb4\
+\x1c\xfa\x81L&\x8e\xa6*ds9\x0cCA\xd7\rb\x91!.]\xbc\xcc\xc9_\xef\x93\x03cZ\
+\xb2\xa8R\xee\xde\xf3\x05s\xe6=\xc1\xd0\xd0\xe5\x1b\x92\xe7\xf31r\xb94==\x17\
+\xe9\xef\x1d\xa0\xed\xc7\xabH)_\xb2m\xbb\xeb\xbe\x01\x00\xac\x7f}\xb1\x9c9k\
+\x01\xcf\xbf\xb0\nE\xb9B4\xda\x87\xaa\xc6\xc8dTv\xed\xfe\t\x00)\xe5k\x80n\
+\xdb\xf6%\xdb\xb6\xd3\xf7\x15`L+\x97\xd7I\xb7\xbb\x80\xae\x8f\xa0f\xf2\x18\
+\xa6\xc5og\xa2>\xaf\xd7[}\xed\x88e\xdb\xb6\xe1v\xbb\xa3\x7f\x03\xa4Rw\xa2\
+\xb7\xa4\x8c\xd9\x00\x00\x00\x00IEND\xaeB`\x82\xf4qxO' )
+
+def getIconNoninterClassifyBitmap():
+    return wxBitmapFromImage(getIconNoninterClassifyImage())
+
+def getIconNoninterClassifyImage():
+    stream = cStringIO.StringIO(getIconNoninterClassifyData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconPrinterData():
+    return zlib.decompress(
+'x\xda\x01\xd2\x05-\xfa\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00\x18\
+\x00\x00\x00\x18\x08\x06\x00\x00\x00\xe0w=\xf8\x00\x00\x00\x04sBIT\x08\x08\
+\x08\x08|\x08d\x88\x00\x00\x05\x89IDATH\x89\x95\x96]l\x94i\x15\xc7\x7f\xcf\
+\xfb1_\x1d\xa6\xad0\xd0\xc2B\'\xc4\xb0f\x03\x1d\xb2\xf1\xeb\x06h)\x17[\xb3A\
+\r\x99\x15\xb7\x89\xe9\xea\x8d\t\x84D\x03Hbb2\x86\x05t/\x0c1\xf1\xca\xc6\x0b\
+\xb9)\xd5\x9aM\xba\xb3\x86%\xdbN\x82Q\xa1\x1a\x08\xb61\xda\x05&k\x91N\xbb\
+\xfd\x98\x8fwf\xdey\x9f\xe7x\xb1;#\xbad\xad\xcf\xf5\x93\xff\xef\x9c\xff9\xcf\
+9\x0fl\xe2\x14\n\x05\'\x93\xc9H:\x9d\x96\x93\xc7\x8fI\x10\x04\xcf\xf9\xbe\
+\xbf\xd5\xf3\xbc\xf8\xc6\xc6F\xa4P(8\xf9|\xde\xcaf\xb3j3z\xffq\xf2\xf9\xbcU\
+\xa9Tb\xe9tZ\x96\x1f\xdc\x96\xe5\x07\xb7\xe5\xe4\xf1c\xf2\xc5/|\xae\x05\xdb\
+\xfd,\xd8\xa6\x01\x85B\xc19\xfe\xd2\xf3\xb2\xfc\xde\x1f\xa4ZZ\x13\xcf\xf3\
+\xc4\xf3<\xa9VJm\xd8S\x99\xedn4\x1a\x9f*\x95J\xd1B\xa1\xe0\xfc\xcf\x8cZ\xd1g\
+2\x19\xa9\x96\xd7\xc5\xf3\xaaR\xab\xd5\xa4V\xab\xb5!\xd5\xf2\xba\x94V\x16e\
+\xf9\xc1my\xf1\xc5\x83mP\xadV\xdbR(\x14\x9cME\xbf\xf2\xf0N[\xb8\r\xa8V\xa4\
+\xba\xf1\x81T\xd6\x97e\xa3X\x90\xe2\xc3?\xc9\xd2\xfc;\x02\x881\xe6\xb3\xcdf\
+\xb3wuu5\xfcL\xaf\xb2\xd9\xac\x9a\x9f\x9f\xb7\xb7m\xdb\x16\x0eo\xe9\xa7\xa3g\
+\xff\xc7\xeeH\xe0ct\x13\xd1>\x81\xef\x114\x9b\xf8\xe5\x15\x00\x94R\t\xcb\xb2\
+\xc2\x8e\xe3X\xce\x7f\x0b\x8f\x8e\x8e\xda]]]N(\x14r\xbf\xf6\xd5\x83\xa5k\xbf\
+|\x07\xdd\xacc\xd9\x0e\n\x85 \x88\xd1\xe8\xa0\x0e\xa21\x81\x8f\xf6=D78\xf7\
+\xfa\x18"\xf2\x1a`\x01\x96m\xdb\xff\x06d\xb3Y5>>\x1e\x99\x9a\x9a\xf2\xb4\xd6\
+tvv\x92\xeaM\xd3\xac\xac`\xeb\x00+\x14Aa\x81\x02\x8c\x01\x13`\xb4\x8f\xf1=\
+\x14\x82)=\xe6Wo\xbd\x8b7\xfc\x99_\x00\xfc\xe6\xad\xf9\x17\x1c\xc7\tY\xadb\
+\x8e\x8f\x8fG\xf6\xec\xd9\xe3]\xbcx\x91\xb3g\xcf\x12\xb1\x15?<\xfd2\xda4\t|\
+\x0fS\xaf\x10\xd4\xcb\xe8F\x85\xc0\xaf\xd0lT\x08\x1aU\x1a^\x19]\xdf\xe0\xdc\
+\xebc\xbc\xf1\xfd\x08W\xae|\xa5eS\xdc\xb2\xac\xb0\x9d\xcf\xe7\xad\xeb\xd7\
+\xafw8\x8eS9s\xe6\x0c\xc5b\x91\xd9\xd9Y\x16\xff\xf9\x84O\'\x03v\xb8\x1b\xf8~\
+\x1d\'\xd6\x8d\xf6=\x9a\xde:A\xad\x82\xf6+h\xaf\x84\xd2u\x02o\x95o\x9d\xfd1\
+\xdf\xf9\xee1._\xf9=o\xbe\xfd\xd7\xaf\x03e\x11\xd9\xb0\x0e\x1c8\xe0\xde\xb9s\
+\xa7t\xea\xd4)\x96\x96\x96h4\x1a\xa4\xd3i\xf6\xee\xdd\xcb\x97\xbe\xfdS\xce\
+\xfc\xec\x8f\xdc\xff\xf3\xef\xf0\xdf\xbbA}\xf9\xef\x88\xf6A\xd70^\t\x9a\x15$\
+\xd0\x9c\xbb\xf8s~\xf2\x83\x18{\xfa\xfa[\x8e\xd7\x01OD|\xf5Q[Q\xab\xd5\xc8\
+\xe5r\xac\xaf\xaf\x13\x04\x01J}\xf8F\xc2\xe10\xb7n\xddbll\x8cW^\xc90:\xd4\
+\xcb\xc1}{\xd0\x91\x1e\x10\x03N\x88\xdd\x9f?\xc9o\xdf\x1c\xe6\xa5/\xbf\x8d\
+\x88|\x13X4\xc6<h4\x1aO\xd4\xe0\xe0\xa0\\\xbbv\r\xc7qH&\x93\x88\x08\xf5z\x9d\
+\\.\xc7\xd2\xd2\x12Z\xeb6\xe8iX&\x93\xe1\xb5\xa1\x1e\xde\x18\xff\x0b\xd3\xd3\
+\xd3\xcc\xdf\xfd\x1e/\x1c\xfc\xd1\x87-,2d\x8cyX\xaf\xd7\x8b*\x93\xc9\xc8\xa5\
+K\x97p]\x17\xcb\xb20\xc6\xe08\x0e;w\xee\xc4\x18C\xa3\xd1 \x97\xcb\xb1\xb8\
+\xb8\x08\x80\xef\xfb$\x12\t\xc2\xe10\xb9\\\x8e\x89\x89\t\x0e\x1f>L*\x95\xa2\
+\xbb\xbb\x9bX,\xc6\xe5\xcb\x971\xc6\x1ch6\x9b\x8f\x9d\xb5\xb55VWWq]\x97H$\
+\x82\xd6\x1a\xcb\xb2\xf0<\x0f\x11!\x1c\x0es\xe2\xc4\t\x80\xb6\x8d\x0b\x0b\
+\x0b\x18c\xe8\xef\xefg\xff\xfe\xfd\xf8\xbeO4\x1a%\x1e\x8f399\xd9\xaaC\xb7m\
+\xdb\xeb\xce\xcd\x9b7\x19\x1e\x1e&\x95J\x91L&1\xc6\x10\n\x85p]\x17\xad5\x8e\
+\xe3P*\x95\xb0,\xeb\x99\xb0\xb9\xb99\x00B\xa1\x10\x93\x93\x93\xb8\xae\xdbj\
+\xd3\x0e\xa5TX\x05A\xf0\x9c\xe38\xef\x03\\\xb8p\x81\xde\xde^\x92\xc9$]]]h\
+\xad\x89\xc5b\xd8\xb6\x8d\xd6\xba\x9d\xa5\xeb\xbaD\xa3Q\xf6\xed\xdbG\xadV\
+\xe3\xee\xdd\xbb\x9c?\x7f\x9eh4J\x10\x04\xcc\xcc\xcc "/\x1bc\xfe\xe6h\xad+Z\
+\xeb\xe7\x95R=CCC\xf9\xe9\xe9i\x00N\x9f>MOO\x0f\xbbv\xed\xa2\xb3\xb3\x93f\
+\xb3IGG\x07\xe5r\x19\xad5\xd1h\x94b\xb1\x881\x86{\xf7\xee\x11\x8dF)\x97\xcb\
+\xf8\xbe\xcf\xa1C\x87\x004`\xd4\xf2\xf2r(\x91Ht\xd8\xb6\x9d\xb0,\xab\x0b\xe8\
+RJ\xc5\x8f\x1e=:\xd5\x82\x8d\x8e\x8e\xd2\xd7\xd7\xc7\xf6\xed\xdb\x89\xc7\xe3\
+8\x8e\xc3Ha\x04.\xc0\xc4\xaf\'\xb8q\xe3\x06\x8f\x1e=bmm\x8d\xd9\xd9YD\xe4U\
+\x11y\xdf\x18\xf3H\xb5\x06\xdc\xd6\xad[C\xa1P(jYVL)\x15SJu\x00[\x94R\xf1\xc1\
+\xc1\xc1\xa9\x99\x99\x19\x00FFF\xe8\xeb\xebc\xc7\x8e\x1d\xb8\xae\x8b\xef\xfb\
+\xcc\xcd\xcd\xb1\xb0\xb0\xc0\xf4\xf44"\xf2\r\xe0\x891\xe6\x1fA\x10<io\x9c|>o\
+\xa5R)\xab5Im\xdb\x0e\x7f\x04\x8b>\r\x1b\x18\x18\x98\xca\xe7\xf3mX"\x91 \x14\
+\nq\xf5\xea\xd5\x96\xf8\x92\x88,\x06AP\xacT*\xa5\x8f\xad\xb4l6\xab\x06\x06\
+\x06\xd4f`O\xdb("\xaf\x02+"\xf2\xb8%~\xff\xfe\xfd\xe6\'\xee\xcc\xff\x03\xe6\
+\x8aH]D>\xd0Z\xaf\xb4\xc4\x8f\x1c9b6\xfd\xcd\xf8\x04XT)e\x8bH\xa0\xb5\xaeV\
+\xabU\xaf%\x0e\xf0/\xd1YU1"\x9dPu\x00\x00\x00\x00IEND\xaeB`\x82\xde\xa1\xe5\
+\xdd' )
+
+def getIconPrinterBitmap():
+    return wxBitmapFromImage(getIconPrinterImage())
+
+def getIconPrinterImage():
+    stream = cStringIO.StringIO(getIconPrinterData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconRefreshData():
+    return zlib.decompress(
+'x\xda\x01\xf4\x03\x0b\xfc\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00\
+\x18\x00\x00\x00\x18\x08\x06\x00\x00\x00\xe0w=\xf8\x00\x00\x00\x04sBIT\x08\
+\x08\x08\x08|\x08d\x88\x00\x00\x03\xabIDATH\x89\xb5\x94_L[e\x18\xc6\x7f\xa7\
+\x87\xd3v]\xe8\nm-i\x88\x9d\xa4\x17\x93?\x0e\x93I4\x0b\x8a\t\\h\x8c\x8b&\xbb\
+\xf0\xc6\x98\xc5K\x13/\x08\x17$\xbb\xe4\xda\xc4\x8b]ya\x88\x01\xe3\x8d\x1d\
+\x93\x98t@0s\xa4\x14\x07L\n\xc2\x96R\xc3(n\xad\xfd\xb3q(\xb4\x87\x9e\xf3y1\
+\xcb,\x9c"j|\x92\xef\xe6\xcb\xfb\xbd\xcf\xfb<\xdf\xfb\xbe\x92d\x91\xf9?Qw\
+\x92\xa0\xb3\xefz\x84$Ih\xb9"X@\xd1\xea(\x15Kh\x1b*\xd9\x9c,\xfdk\x82\xe6^\
+\x97\xa8\xefh\xe6\xe2\xa5\xcb\xf4\xbf\xf4>\x1b;\x0f\x89\xa6\x96\x99\xb8u\x13\
+G\xae\x80\xa6\xee\xb2~oC\xe8\x85"\xbf\xdd\xde1%\x92jY\xd4\xdc\xeb\x12\xde+o\
+\xf3\xcd[WY\x7f\xb2\xc5g\xcb7H\xcd\xdf!\xf7\xe3*;\x89m\xa4\xed}\xce\x9c\xb6\
+\xa2\xaa\x1a\x8eW|\xec>P\xc9\xae\x96\x8e\x90\xd4TP\xdf\xd1\xcc\xf5w\x86\xb8\
+\x9bY\xe5\xda/a\x1c\x8b\xf7\xd9\xfa\xfc6\x00\x8fs\xb2\x042\xf9\x8c\x0e\xc8\
+\xf0SJ\xe0sp\xe69]<IW[fJ\xd0\xdc\xeb\x12\x17/]&UH3\xf6\xe0\x0e\x99h\x94\xe4w\
+K5\xfd\xce\xe6d\x89\\\t\xf7\x8b\x0e\xe1.\xef\x8a\xaa8\xc9"\x1f9\xad\x9f\xb6\
+\x89\xe4\xce\x86\xf8\xea\xfe\xb7\xe2\xe5\xa1\xd7\x85\xc7\x830\x8b3;\x87c-f\
+\x15\t\xbdLY\x94\xf9!\xb5\x8a\xb7\xbe\x01\xbc\xf6ZN\x9a\xab9l\x91\xbbQ\x17\
+\xb6\xd63\xd4\x9fv`\xb7\xd9\x10\x17:Il\'\xd9\xd6\nd\xd4\xc7(\xb2\x8c\xd7S\
+\x14\x86a\x9e\xe48\x1c\xfcA\xc3\x9b\xad\x0c]\xb9\xca\xf9\xc6s\x14\xa4=\xbeX\
+\xbcA\xe6\xde\x1aJ]\x1d\x1f\x7f9\xc4{/\xbc\xc1\x87\xd7>!}}\tr{\xcf\xd4\x1a\
+\xba\xf0\xf9|\xa4\x7f\xcf\x1c\xdf\xa6\xeeF]\xb4|p\x9e\xf2k\x1dX\x9cv\xf4t\
+\x8eS;\x1a\xad\x9d\x17\x98\x9d\xbeI\xe9\xd7G\xe4\xc7\x13U\xd5\x0bC\x17\xc3\
+\xc3\xc3\x8c\x8e\x8e\xb2\xb4\xb4\xc4\xa3T\xbav\x9bfs\xb2\xc4\xd7?\x8b\x16\
+\xa0\xd4\xe2\xa3.\xf8<\x9d\xe7\xcerk\xe2\xfb\x9a\xc9\'\'\'\x19\x1b\x1b\xa3\
+\xbb\xbb\x1b\xc30(\x97\xef\x8aL6WErd\xd0\xdc\x8d\xbah\xff\xe8U\xf2>;\xc6\xde\
+>\xc5\xc4C\xd3\xe4sss\x8c\x8c\x8c\x10\x8dFq\xb9\\\xf4\xf5\xf51==\xcd\xfc\xfc\
+|\x95\x12\xd3I\xae\xd8\x95W\xd5\x9a\x95\x8f\x8f\x8f333C6\x9b\xc5f\xb3\x11\
+\x0c\x06\xe9\xe9\xe9!\x1c\x0e\xb3\xb8\xb8HEI\xcdU\xe1n\xd4\xc5\x81u\x7f\xa2\
+\xa3\xbdM\xf4\xf7\xf73;;K<\x1e\x07`kk\x0bEQ\x10B\xd0\xd4\xd4D[[\x1b\x13\x13\
+\x13$\x12\t\xf6\x8a%\xa9&\x81\x19\x84\xf1\x94T\x96et]g``\x80H$\x82\xd7\xeb%\
+\x16\x8b\xb1\xbe\xbe\x8e\x10\xe2\x99\xff\x16Y:\xd1\xba\xfe\xeb\x03\x00\xe3i\
+\x0e\xe1\xf1xP\x14\x05\xab\xd5\x8a$I Y$\xe9P\x1fUMr\xa5\xc2\x93\xc2\xef\xf7\
+\xa3i\x1a\x9a\xa6Q(\x14Lc\x8e\xac\x8a\x93\x90\x08C\x17\xa1P\x88H$\x82\xddn\'\
+\x9f\xcf\x93\xcdf\xff\x9e\xa0b\x810taFT\xb9\x0f\x85B\xac\xac\xac\xb0\xb6\xb6\
+\x86\xa2(,//\xa3\xed\x97M\'\xf9\xc8\x1fH\x16Y\xb2Y\x15\xe1\xf7\xfbI\xa5R\xa2\
+\xa1\xa1\x81d2\t\xc0\xe0\xe0 ]]]\xc4b1\x16\x16\x16p:\x9d\xc4\xe3qTU\xad\xa9\
+\xb6f\x17\tC\x17\x81@\x80\xf6\xf6v\x02\x81\x00>\x9f\x8f`0H8\x1c&\x99L\xe2t:\
+\x99\x9a\x9aBU\xd5\x03\xe5\xff\x88\xa0\x82Sv\x9b\xb0\xdb\xed\xd8l6\xacV+\x16\
+\x8b\x85r\xb9\xcc\xe6\xe6\xe6\xb1\x89OL\xf0_\xf1\x07G)\xcc\x970\x1c\xf9\xd6\
+\x00\x00\x00\x00IEND\xaeB`\x82\xfcW\xe7\xbf' )
+
+def getIconRefreshBitmap():
+    return wxBitmapFromImage(getIconRefreshImage())
+
+def getIconRefreshImage():
+    stream = cStringIO.StringIO(getIconRefreshData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconSaveData():
+    return zlib.decompress(
+'x\xda\x01U\x02\xaa\xfd\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00\x18\
+\x00\x00\x00\x18\x08\x06\x00\x00\x00\xe0w=\xf8\x00\x00\x00\x04sBIT\x08\x08\
+\x08\x08|\x08d\x88\x00\x00\x02\x0cIDATH\x89\xed\x95\xb1\xab\xd3P\x14\xc6\xbf\
+\x86\xa6\x90%\xe0\xe2\x92J\x96R\x04\xdfb\xc1\xc0\x1bDp\xa9\xca3O\x05\'\xd7n\
+\x99\xfc\x0f:\xf4o\xe9&"\xb4C\x11,\xe2\xa0{\xcb\x9b\xba\xb4/\x93\x8b\x90%\
+\xcdM\xee9\x0e\xb5\xd7$\xbdi\xfa\x147?\x0899\xdc\x9c\xef\xfcn.9\xc0\x7f\xd5\
+\xa8QN8\x8e\xc3\xfb\xb8\xd3\xe9\x9cTd\xb5Z\xa9x\xbd^\xdfI\xd34\xb2,+\x02\x80\
+f\xb9x\x10\x04\x00\x80\xd9l\x86\xf9|\x0e&\xa9.\xa8\x98\xc0\xfc\xfb\xf9\xc9\
+\xab7\xf0<\x0f\xcc\x0c\xd7u\xaf7\x9b\xcd\xbd8\x8eC\xcb\xb2\xa2\x82\xc1^\xcc;\
+\x08\x96\x19\xde\xcd?\xe2\xd3\xf7\x1f\xda\xce\x1f\xdf\xbe\x85\x8b\xfbg\x00\
+\x00"\x02\x11\x01\x00\x0c\xc3h\x9b\xa6\x19\x0184\xc8/d\x92x\xf9\xf0\x11^\xb0\
+\x04\x8844\xbb\x1c\x00H)Uc\x00\xecF\xa3a\x1flQy!\x93\xc4\xfb/\x9f\x8f\x12<;\
+\xeb\x1e4\x96W-\xc1\xe5\xf99.\xf7\x9dkI2\x1dA\xb5A\x91 \xc3\x87\xaf\xdf\x8e\
+\x12<\xbd\xeb\xfe\x1d\x81\xff\xa0\x87\xe7\xbf\xf6\x1b9\x92]\xf7\x95\xdf\xa0\
+\x9e\xc0\xf3<\xf4\xfd\xd7\xda\xce\xcb\xeav\xbb7\'`f\xf4z=\x153\xb3\x8a\xcb\
+\xb9\xfc;\'\x13\x1c+X\x95;\xc9\xa0\\`\xb1X\xd4n\x91\xeb\xba\x7fF\xb0\\.1\x1e\
+\x8f\xb1\xddn\x91$I\xe1>\x1c\x0e\xe1\xfb>\xa4\x94\x98N\xa7p\x1cGk`\xe8\x08\
+\x88\x08R\xeeN\x87\x10\x02\x83\xc1\x00A\x10@\x08\xa1.\x00H\x92D\xc5\xf9wN&\
+\xd8\x1b\x00\xbb?k\xd9@\x08\xa1NN\xd51\xd5\x12L&\x93\x02\xc1^:\x83$I\n\xe4\
+\xb5\x04D\x84~\xbf\xaf\x16\x0b!0\x1a\x8d\xd4\xde\xe7\r\xd24U\x8d\xe8\xba\x07\
+J\x03\'\xcb\xb2\xb6\xeb\xba\xd7\xf9\\\xd5\xd0\xc9\x0f\x99\xbc\xc20|\x0b\xe0J\
+Jy\xd5l6\xc3\x82A\x1c\xc7v\xab\xd5j\x1b\x86\xd1\x06`k+\xd4+"\xa2P\x08\x11Z\
+\x96\x15\x1d\x8c\xcc8\x8em\xd34\xd5\xff\xfc\xa6b\xe6(?2\xff\xb9~\x02\xf3\x93\
+7\xe1\xdew\x13\xed\x00\x00\x00\x00IEND\xaeB`\x82\xc1\xd1\nL' )
+
+def getIconSaveBitmap():
+    return wxBitmapFromImage(getIconSaveImage())
+
+def getIconSaveImage():
+    stream = cStringIO.StringIO(getIconSaveData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconSelectData():
+    return zlib.decompress(
+'x\xda\x01S\x01\xac\xfe\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00\x18\
+\x00\x00\x00\x18\x08\x06\x00\x00\x00\xe0w=\xf8\x00\x00\x00\x04sBIT\x08\x08\
+\x08\x08|\x08d\x88\x00\x00\x01\nIDATH\x89\xed\x96\xb1n\x830\x10\x86\x7f\x9bL\
+\x99\xd82\xc2\x0c\x0b\x8f\xc0\xda e\xe31x\x03\xaaD\xea\x03\xf8\x15X\xb2FP)\
+\xedx,\xcct\xee\xc2\x13 \xd4\'\xb8NV\x15\x15\'$\xc4C\xd4\x9et:\xcbw\xf6w\xb2\
+\xfdK\x16B:\xb0i\x0b\x00xz~\xe5\xb9\x1b\xbd\xbfl\xc4hBH\x07\xeb\xed\x91\xcf\
+\xd9\x94\xbc\x90\x0e\xc6\\\xce\xed\xfc\x92\xfd\x03\xfe\x00`\xa1\x07\xc9\xee\
+\xedl\xe1\xa5\xbc\xd1\xa6\xea\x00\x80\xd1\x1fK\x07J)\xbb\x80(\x8a\xd0\xb6-<\
+\xcf\xb3\x03\xd0\x90\xa2(&An\xbe\x838\x8eQ\x96\xa5=\x00\xf0s\\_\x1f\x07c\xcd\
+d\x1d\xac\xb7G|\xd6\xfb_\xf3UUa\xe5.\xcd\x0bM\xefw\xcc\x83 `":\xd1\x88\xeb\
+\xba\x9c$\x89Q\x07W\x01\x00\xb0R\x8a\x01p\x96e<\x0c\x03\x13\x11\x03\xb8\x0f@\
+Ct$"\xee\xba\x8e\xd34\xbd\x9f\x92\x85t\x84\x8ey\x9e\xc3\xf7}\x84ah\xac\x9f\
+\xf5\x8a\x9a\xa6A]\xd7\xe8\xfb\xde\xdc\x90\xedo\xcb7\x9c\x13\xc10\xccH^\x02\
+\x00\x00\x00\x00IEND\xaeB`\x82}\x0f\x8e\xfb' )
+
+def getIconSelectBitmap():
+    return wxBitmapFromImage(getIconSelectImage())
+
+def getIconSelectImage():
+    stream = cStringIO.StringIO(getIconSelectData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconSelectAddedData():
+    return zlib.decompress(
+'x\xda\xeb\x0c\xf0s\xe7\xe5\x92\xe2b``\xe0\xf5\xf4p\t\x02\xd2\x12 \xcc\xc1\
+\x06$\x1f\x94\xdb\xfe\x00R,\xc5N\x9e!\x1c@P\xc3\x91\xd2\x01\xe4wx\xba8\x86xt\
+\xbe\x9d\xea\xcd\xd5`\xc0\xe3\x92.\xa4\x9f\xce\x9a\xaf"\xbagb\x80ml\xaf\xf6\
+\xdd\x1f\x9a?\x0e\xb6\xcar\x88D\xfd\xba5!\xd1#p\xcfJ&\x86S\xcb\xb6\xef\x16\
+\xef\x8d={\x97\xb7\xeb\xd0\xcf\x04\x06\xbe\xd3?\x13\xd2\x8b\xec$\\7\x86\x17}\
+\x7f\xaa\x99z\x80\x9f\xe1\xe8\xa6\x02\xbb9rkn=\x94J\xfc\xe8\x98un3\xbf\xd1\
+\x03\xeb\x03\xaf\x9a\xaf\xcc\x89\xff\xca8\xdf\xcfd\xf6\xa2\xc0\x12\xde\xf9\
+\xd7\xa3\xbf\xdc\xe0\xcf\xe9\x9a}c\xa9Fq\xf7\xa4Y\x8ca2\r&\x8d\xb5\xecG\x80n\
+b\xf0t\xf5sY\xe7\x94\xd0\x04\x00o\x82N\x01' )
+
+def getIconSelectAddedBitmap():
+    return wxBitmapFromImage(getIconSelectAddedImage())
+
+def getIconSelectAddedImage():
+    stream = cStringIO.StringIO(getIconSelectAddedData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconSelectAllData():
+    return zlib.decompress(
+"x\xda\xeb\x0c\xf0s\xe7\xe5\x92\xe2b``\xe0\xf5\xf4p\t\x02\xd2\x12 \xcc\xc1\
+\x06$\x1f\x94\xdb\xfe\x00R,\xc5N\x9e!\x1c@P\xc3\x91\xd2\x01\xe4'y\xba8\x86xt\
+&\xa7\xa4$\xa5-PMHLHH\xf8\xb0\xe6\xee\x97\xf9A\xcd\xdb\xcc\x7f\x1b&MM\x00\
+\x8a\x7fXu\xff\xd7\xfc\xc6FFu5\xb7y\x13;g2J\xa7-\xba\xf2\xb4\xe5\xc0\nV\xe5\
+\x03Lb\x12\x87W\xd7i\xc7\xb5\xb6<)l\xbaXc\x90u\xf0\xc1\xf6\x86g?\x1b&^3\xbdu\
+\xa1\xbf9\x90\x9b\x83\x89!w\xb9i\xf4\xdaw\x16\x1a@\xdb\x18<]\xfd\\\xd69%4\
+\x01\x00\xf4/>\x95" )
+
+def getIconSelectAllBitmap():
+    return wxBitmapFromImage(getIconSelectAllImage())
+
+def getIconSelectAllImage():
+    stream = cStringIO.StringIO(getIconSelectAllData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconSelectInvertData():
+    return zlib.decompress(
+'x\xda\x01\x7f\x01\x80\xfe\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00\
+\x18\x00\x00\x00\x18\x08\x06\x00\x00\x00\xe0w=\xf8\x00\x00\x00\x04sBIT\x08\
+\x08\x08\x08|\x08d\x88\x00\x00\x016IDATH\x89\xed\x961O\x840\x14\xc7\xff-\xe4\
+\x06Y\xdc\\\xd9Y\xd8YX\x85\xe4\x16\x85o\xe0\xc87\xc0\x1c\xe6>\x00\xec.,\xae\
+\x06L\xe0FX\xd8\x19\x9c\\XM\x94\x10G]\xea\xd4A\x8f\xd2;\t\x89\x89\xbe\xe4\
+\xa5M\xff\xaf\xef\xd7\xb4M_\t\xa1\n\x964\x15\x00\xce\xaf\x1f\xd8\xdcD\xbb\
+\xed\x9a\x8c\n\x84*p6\x05\x03 \xf4Ct\xdf\xf7\x19\xa1\n\xbe;\x9d\xbbr\x99\xfd\
+\x03\xfe\x00@\xe5\x1dgSL\x06\xcat)\xa0\xbcq\'\x93\x17\x91#\xd4\xdd\xa8\x14j\
+\xbf\xef\x0c\x92$Y\x16`\x9a&\xda\xb6\x85\xae\xeb\xcb\x008$M\xd3\x83 ?>\x03\
+\xdb\xb6\x91e\x994N\x95FL\x18\xdf\xae\xb7\xf6\x1e+\xf21\r\x90\xdds7*\xf1T\
+\xdf\xe16\xba\xfa2\x9e\xe79\xceNO\xf0\xfe\xfa,\x06\xec\xb6k\xe2]^H\x8b\xce\
+\xea\xe5qo,I\x12X\x96\x05M\xd3\xc6\'\x8d\x15\t\x91\x03`q\x1c3\x00,\x08\x026\
+\x0c\x03\xab\xaa\x8a\x01\x18-6\x84*\xc7\x018\x84\xb7UU\xb1\xae\xeb\x98\xe7yB\
+\xc0\xd1\xb7\x88P\x85\xf06\x0cC\xe8\xba\x0e\xc30\x84\xf1\xb3\x9e\x8a\xa6iP\
+\xd75\xfa\xbe\x17/h\xe9o\xcb\'4"m\xe1\x00\xa1\xcb\xd0\x00\x00\x00\x00IEND\
+\xaeB`\x82W\xad\x9f\xc5' )
+
+def getIconSelectInvertBitmap():
+    return wxBitmapFromImage(getIconSelectInvertImage())
+
+def getIconSelectInvertImage():
+    stream = cStringIO.StringIO(getIconSelectInvertData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconSelectRemovedData():
+    return zlib.decompress(
+"x\xda\xeb\x0c\xf0s\xe7\xe5\x92\xe2b``\xe0\xf5\xf4p\t\x02\xd2\x12 \xcc\xc1\
+\x06$\x1f\x94\xdb\xfe\x00R,\xc5N\x9e!\x1c@P\xc3\x91\xd2\x01\xe4\xc7{\xba8\
+\x86xt&',0LHIHH\xf8\xb0\xe6\xf6\xa7\xf9A\xcd\xdb\xcc\x7f\x1a<\x9a\xd2\x12\
+\xd5 \\}-\xf7\xe7\xff\xf7\xf7\xed\xe7H\xccg\x9e\xa9Qj\xa9h\x90u\x90cCC\xdd\
+\xcf\x86\x00+\xf9\xb3\xec\x8b\xc5x\xe6\xb0~9\xc9\xbe\x98\x81+\xc1\xf4\x81(\
+\x1b[\xdb\xfc\x80o\x02,\xec\xfcrK*O\xb9028{\xd4\xe4\xca5\x05_\x03Z\xc5\xe0\
+\xe9\xea\xe7\xb2\xce)\xa1\t\x00\x89\x9d7]" )
+
+def getIconSelectRemovedBitmap():
+    return wxBitmapFromImage(getIconSelectRemovedImage())
+
+def getIconSelectRemovedImage():
+    stream = cStringIO.StringIO(getIconSelectRemovedData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconShowNameData():
+    return zlib.decompress(
+'x\xda\x01\xc5\x02:\xfd\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00\x18\
+\x00\x00\x00\x18\x08\x06\x00\x00\x00\xe0w=\xf8\x00\x00\x00\x04sBIT\x08\x08\
+\x08\x08|\x08d\x88\x00\x00\x02|IDATH\x89\xbd\x96\xcfj\x13Q\x14\xc6\x7fs2N\
+\xac\xad6E**\xf5\x05\xea\xa6\xe0&\xed\xdeU\x97\xbd\xed+\x08\xbeD\xc8\x03\x94\
+\xec\x04\x97.\'\x93n\xdc\xbao\x06\xa4P\\t\xe1\xff\xb6\x11)\xc1\xda\xe6\xffL&\
+\xe7\xba0\xd1\x9aH,1\xfa\xc1\xe1r\xb8\xe7|\xdfp\xbe;s\x07\xfe\'r9\xb5\xd3\
+\xe6\x94i\x13\x0e\xc3\x81\xa9<y\r\xa8\xe4\xf3r\xff;_|\x0f\xa2\xd3|\xfez\xf3\
+\x97\xaa\\N\xad\xeaD\xd1P\xd5W\xaa\xfa\x04 \x8a\xa2\xdb\'\'\'\x1eLoD= %"\x8f\
+\x01\x1c\xc7q\xe7\xe6\xe6\xd2c\x05\xb6\xb6\xb6\x08\xc3\xf0\xb2\x02\x02`\x8cy\
+\xda\xcf5\x8e\xe3\xeeX\x81R\xa9\xc4\xf1\xf1\xf1e\x05\x9c~\xcf\xa3\x8b\xf9X\
+\x81q\x08\xc3\x90 \x08\x08\x82\x80J\xa5\x02`\x01\xd7\x18\xf3\x0c\xc0\xf3\xbc\
+OA\x10x#\x8d\x17M\x06\xac\xef\xfb#\x86\xfa\xbeo\xb3\xd9\xac5\xc6Xc\x8c\x05\
+\xec\xd1\xd1Q[U\xdf\\\xe4Z^^\x9e\x99H`8\x8c1\xd6\xf7\xfdHU?\x18cv\x06\\\xcdf\
+\xf3:\x80;\xc9\x88\n\x85\x02\xe5r\xf9\xc7\xb8677\x01\xdcR\xa9\xb41\xa8\x11\
+\x91\x14L\xe0\xc1\xda\xda\x1a\xe5r\x99b\xb1H\xb1X$\x9b\xcd\x02\xa4\x00wcc\
+\xe3\x05@\x92$\x0fT\xb57\x91@\x18\x86\xac\xae\xae\x02P\xa9T\x06&;\x80\xbb\
+\xb3\xb3\xf3\x10\xc0u\xdd\xbdj\xb5zu\xa4y\xd8\x83\xe1\xf0}\xdf\xfa\xbe\xff#7\
+\xc6\xd8\xed\xedm\xbb\xb4\xb4\xa4\xbb\xbb\xbbg\xc6\x98\x97\x03\xae\xf5\xf5\
+\xf5[c\x05&\x88\xf3\x8b\\Q\x14\xdd\xfe\xdd\x88\xfe\xe6\xa3\'\xaaz0H\x1c\xc7q\
+a\xf4\x14}\x01\xae\xf4\x85\x06{\xcaw\x13{\xfc|C{\x03R \xe9\xd7\xb6DdyDu(\x7f\
+/"\x19km\xe1\xe0\xe0 \x03\x1c\x8a\xc8<\xf0\xae\xbf\x1e\x8a\xc8\r\xe0\xa3\x88\
+,\x00oE\xe4f\x7f\xbd\xa3\xaa\xcf\xc7p\xff\x1b8\x7f.\xb9<\x92$Y\x05\xea\xaaz\
+\xde\xedv\xcffgg\xeb\xbfx\x90\xcb\xb5\x17\xf2\xf9\x99\xaf\xadVk>\x95J\xa5\
+\xfbF\x89\xb5\xb6\x97N\xa7?\xc7q|WU#\xc0\xb1\xd6\xaa\xe38""\x9e\xaa\xc6\xd6Z\
+M\x92\xe4u\x92$\x91\xaaj\xbd^\xef\xc2\x88\xc9\xa7\x8d\xc1M\xd4n\xb7\xeb\x00\
+\xae\xeb\xa6\x9a\xcdf\\\xab\xd5\xaeu:\x9d\xb3\xbd\xbd\xbd\xce\xca\xca\x8a\
+\xd7j\xb5z\x00\x99Lf\xa6\xd1ht\x00<\xcf\x93\xfd\xfd\xfdxqq\xd1\xa9V\xabS\xff\
+\x81\xf8-\xbe\x01\xa4M\xf0\xc5\x82=\xc65\x00\x00\x00\x00IEND\xaeB`\x82\xe0\
+\xa9YC' )
+
+def getIconShowNameBitmap():
+    return wxBitmapFromImage(getIconShowNameImage())
+
+def getIconShowNameImage():
+    stream = cStringIO.StringIO(getIconShowNameData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconSortAscData():
+    return zlib.decompress(
+"x\xda\xeb\x0c\xf0s\xe7\xe5\x92\xe2b``\xe0\xf5\xf4p\t\x02\xd2\x12 \xcc\xc1\
+\x06$\x1f\x94\xdb\xfe\x00R,\xc5N\x9e!\x1c@P\xc3\x91\xd2\x01\xe4o\xf5tq\x0c\
+\xf1\xe8<\x1b\xea(\xd4b\xc0\xc1}\xd5\xfd\xdb\xff\xf7\x1b6\xa8\xa7\xcd\xe1\n\
+\xd9v\xfb\xea\x9d5>NLQ\x8b6%\xaa\x9e\n\xfa\x16\xce\xc1!o\xb4.3\xef\xecf\xbe\
+\x16\xfe\x85\x9b.\xcb\x8ag2\xaa\xb27HN|*\xf8\xf6\xe2\xe9\x99\x19N\x8d\xc56\
+\xe5\xe7\x94\xff\xd4w\x9bL\xb3\x93{_\xd3\xe2\xed\x12\xc7r3#\x86\x91o\x9f\x17\
+\x83F\xaa7\xe7L\xe7m\x1e3f\xa7\x9cdLf\x93\xab\x9c\x16\xe1\xb8\xf8\xb7\xc3I\
+\xdd\xc4\xd7\xea\xee\xb1\xb1;\x96\tZ2\\\x89:\x9c\xaeP`\xa0\x14>'\xf6\xcb]\
+\xe6>\xe6\xfe;\xb3Z\xcbrK\xf9%\xf8\xf6E\x06?T\x0b\xfb\xbe\xec\xc0\xfa\x8f\
+\x7f\xe6\xdat\xf3_6\xc8p]\x7f\xebh \xd0\x03\x0c\x9e\xae~.\xeb\x9c\x12\x9a\
+\x00eZ_d" )
+
+def getIconSortAscBitmap():
+    return wxBitmapFromImage(getIconSortAscImage())
+
+def getIconSortAscImage():
+    stream = cStringIO.StringIO(getIconSortAscData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconSortDecData():
+    return zlib.decompress(
+'x\xda\xeb\x0c\xf0s\xe7\xe5\x92\xe2b``\xe0\xf5\xf4p\t\x02\xd2\x12 \xcc\xc1\
+\x06$\x1f\x94\xdb\xfe\x00R,\xc5N\x9e!\x1c@P\xc3\x91\xd2\x01\xe4\xef\xf6tq\
+\x0c\xf1\xe8\xbc\x1az\x91\xaf\xc5\x80C\xfbr\xff\x9d\xff\xf5\xed\xcd\xd5\x06\
+\xde\'Z\x1evVY\n\t\xbf\x8d\xe1\x96MtI=89P.\xb5\xde9A\x96\xf1\x99\xdaf\xde\
+\xa5:&I\x87|O\x1c\xf0e\xeco\xd9\xd9\xd9\xea^\xb8\xe1\x84\xf2\xffi7D?\x9cX\
+\x9f"\xcf\x95rr9S\xf9\x84\xddLr?\xa7n\x9e\xb1-\xf3YAl\xe3\x1aU\xf6}/\xd8\x1f\
+\xea\x86\x1e\xcdO\x9f\xf8A-$\xecT\xc8C\xae\x92"\x86\x13\x1d36\xbf\xc8\xe9x\
+\xb5\xe9\x9f\x1d\xdf\xde\x0b\x8b\xfeE\xbc\xdez\xed\xa59\xc3\x84\xd2\xc5\x99\
+\xd5J1\xe1\x89\xbdoJ\xc4\xbf\xaeY\xfb\x86q1Sn\xfb\xb9k\x87\xbf\x9b\xfe?d\xa8\
+\xbb\xcb\xf8\xdf\xffK\xff\x19\xae\xc4\x15X\xbc\xdbvS\x04\xe8\r\x06OW?\x97uN\
+\tM\x00\xef\x12m\x97' )
+
+def getIconSortDecBitmap():
+    return wxBitmapFromImage(getIconSortDecImage())
+
+def getIconSortDecImage():
+    stream = cStringIO.StringIO(getIconSortDecData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconSubimageBinaryData():
+    return zlib.decompress(
+'x\xda\x01\x00\t\xff\xf6\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00 \x00\
+\x00\x00 \x08\x06\x00\x00\x00szz\xf4\x00\x00\x00\x04sBIT\x08\x08\x08\x08|\
+\x08d\x88\x00\x00\x08\xb7IDATX\x85\x9d\x96k\x8cU\xd5\x15\xc7\x7f\xfb<\xee=\
+\xf71\xc3\xbc.3\xcc0\x8c\x083\xa0\xa8\xa0X\xb0\xd1VT\xda\xa6\x80m\xa2I\xfb\
+\xcd\xa65M5\xa2\x89\xb5\t5i\x1a\x1bk\x0b\xed\x9766\x8d\xd6jk\xc5\xdaIl\xe2\
+\x0bR\x19\xd3\x18c\x02\x15HL\xa5\x1d`\xc6\x11\x18\x90\x0e\xf3\xbcw\xe6\xbc\
+\xf7\xa3\x1f.s\x10\x11h\xba\x92\x93\xb3?\xac\xec\xf3\xdb\xeb\xbf\xd6\xffl!,\
+\x9bK\xc5\x13?}\xdc\x84aH\x92$DQD\x9a\xa6(\xa5\xd0Zg\xef(\x8a\x88\xe3\x988\
+\x8e\xd1Z\xe3\xfb>\xd5j\x95C\x87\x0ea\x10\xe2R\xfb;\x97\xfc:P\xadV\xb9\xeb\
+\xae\xbb.\x97\x96A\xd4j5\xaa\xd5*\x00\xfd\xfd\xfd\xec\xd9\xb3\xc7\x08\xcb\
+\xbe(\xc4e\x01l\xbb^\xa1u\xeb\xd6]2\xcf\x18\x83\x10\x82 \x08\x98\x9a\x9a\xc2\
+\xf7}\xfa\xfb\xfb\xd9\xb1c\x07\xdb\xb6m\xbb(\x84u9\x80 \x08.\x97r^\x14\x8bEZ\
+ZZ(\x95J\xe4\xf3y6l\xd8\xc0\x8e\x1d;0Z\x99\xff\x0b@k\x9d\xad\x8d1\x9f\xf9\\\
+\x0c\x02\xea\x95\xbb\x14\xc4e%\xf8\xc6-\xab)\xd9\x86\x91\x0f\x87\xb1\x1d\x17\
+\x95\xa6\x8433\x9c\x19\x1a\xe2\xe6\xbb\xef\xc6\x18\x83m\xdb\x08!2\xb9\xe6!\
+\xf2\xf9|\x06\x01|\xa6\x1c\x17\x05x\xff\x9d\xbf\x99\xe6%+p]7;\xa51\x86\\.G\
+\xa9\xa1\x81\x85==\x8c\x8d\x8dqfd\x94\xbe\x1b\xae\xc5\xb6mr\xb9\\\x06\x03\
+\xe0y\x1e\xc7\x8f\x1f\xa7\xa7\xa7\xe7\xa2\x10\xb6\x10\x17\xaap\xe2\xf81\xd3\
+\xd4\xdeE>\x9f\xc7\xf3<\x8a\xc5"\x9e\xe7\xe1y\x1e\xae\xebb\xdb6J)\x1c\xc7\
+\xa1\xb1\xad\x05\xdf\xf7q]\x97$I2\x00!\x04o\xbc\xf1\x06}}}h\xadijj\xa2\xab\
+\xab\x0b\xd7u\xe9\xed\xede``\xcfcBX?\x11\x9f\xf6\x81\xd1\x13\xc7M\xa1P\xc0\
+\xf3<\x1c\xc7A\x08\x91\xcd\xbcR*\xab\x86\xd6\x1ac\x0cRJ\xb4\xd6$IB\xa1P@\x08\
+A\xb9\\\xc6u]\xb6n\xdd\xca\xe9\xd3\xa7\x91RfO\x92$H)\x89\xe3\x98\x83\x07\x0f\
+r\x1e\xc0\xc9\xd1\x13\xa6X,R(\x14\xb2\x93(\xa5H\xd3\x14\xad5RJ\x94R\x99\xde\
+\xf3pI\x92\x9c\x07Y.\x97)\x97\xcbg\xf7<\x8e\x1f\xcc2>v\x9a\xff\x9c>\xc9\xe8\
+\x89\xd3\xd4f\x03FGG\xd9\xf9R\xff\xb9\x1e\xf8\xd7\xc1\xb7M\xa1P \x9f\xcf\x9f\
+\xb7\xb9R\x8a8\x8e\xb3\xd3\x1bc\xb0,+\x9b\x0e\xcb\xb2p\x1c\x07\xa5\xd4Y\xf9\
+\xc6ii\r\x01hhh\xa0{\xc9\x15\x8c\x8f\x8fS*6Pnh\xa1\xad\xa5\x8d\x89\xa9\tlK\
+\x9c\xdf\x84\xcd\x1d\xcbq\x1c\xe7\x82\xb2\'IB\x9a\xa6\x18c\xd0Zg\x9d^\xab\
+\xd58r\xe4\x08\x83\x83\x83\xf4\xf7\xf7S*\x95p\x1c\x870\x0c\xe9\xe8\xe8`\xd3\
+\xa6M\xf4\xf6\xf6r\xe3\x8d7\xd2\xd8\xd8\x80-4V\xa5\x8dR.\x05\xa0\xb3}\xea\
+\x1c\xc0\xfb{_1\x9e\xe7aYVV\xf6y}\xa5\x94\x08!2\xa7\x9b\xef\xf0\'\x9f|\x92\
+\xe1\xe1a\xae\xba\xea*~\xf0\xe8\xa3\xb4\xb6\xb6\xe1\xb89\xe6fk|p\xe8\xdf\xec\
+?p\x80\xbf\xbe\xfc2[\x1f\xb8\x8f/\xdcr3^\xceB%\xa0\x8a\x8dt.\x12LO\x8d\x9d\
+\x03hh]\x96\x95r\xbe\xc1\xe65\x07\xb2\x0f\xcf7\xe0\xf6\xed\xdb\x89\xd3\x98\
+\x87\x1ey\x84E\xdd\xdd445!\x84C\x8cAI\xc9\xa2\x95W\xa3"\x9f\xc3\xfb\xf7\xb3\
+\xf3\xc5\x97h^\xd0\xc05W\xf7Q\xc8\xbb(\xe9\xe046P:\xeb\x11\x0e\x80\xed\x14H\
+\x92$\xd3Zk\x8deY\x99\xc9\x00(\xa5\x98\x9c\x9c\xe4\xe9\xa7\x9f&\x95\t\xdf}\
+\xe0A\xda\xbb\x16c;\x0e\xb1\xd2DZ\x91$\x92Y\xa9\x99\x8bR\xa2(\xe1\xea/\xdeJs\
+\xa5\xc2#?\xfc\x11\xbfx\xe2\xc7\xf4-[\x8a\x97\xab\xcb\xe4\xd8\xf2\x1c\xc0\
+\xf7\xee\xbb\x9f\x9e\x9e\x1e\x9a\x9a\x9a\xb2\x93\xcf\xcd\xcde\xba\xcf\x97\
+\xff\xd4\xa9S\xd4jU\xee\x7f\xf0!\x12\xa5\xf9\xe8\xa3\x11\xc2\xc0\xa7:\x17P\
+\x8b"\xc2T\x11(\x8d\x9fJ\xda\xbb\xbb\xb0\x1c\x97\xa5k\xae\xe7;\xf7\xde\xcb\
+\x13?\xfb%/\xfe\xf1)\x12\x15\x91wm\xcc\xd9\xa6u\xea%\xae\x8f\xd2\xfc\x8c\xce\
+w\xfe<\x80R\n\xdf\xf7ioo\xa7\xa5\xa5\x85\x86\x96\x16j\xd5\x1as\xb3U\x92\xc0g\
+\xac:\xcb\xcc\x9c\xcfl\x94\xe0\x1bC 5\x0b*\xad\x9c\x9c\xa9\x92/\x97X\x7f\xfb\
+\xed<\xff\xdc\xb3\x1c\x1d\x1eayO\x07\x89V\xe4s\xf5\xcaZ\x00nA\x93\xa6)A\x10\
+\x10\x86!A\x10 \xa5\xcc\xd6\xe3\xe3\xe3LNN\xf2\xd6[\x03\\\xb3z5MM-\xccII\x90\
+Hf\x93\xb3\x93"\x15\xb1\x92\x84aD(\x15q*\x99\xf2\xe7\x18\x9d\xa9Q\xb3r\xf4\
+\xf4\xf4000\x80\xd1)\xc6\xa4\xa0\xe49\x80\xe2\xc2\xfa\x1c\x87a\x98u}\x92$\
+\x04A\xc0\xe4\xe4$\xbe\xefcY\x16\xa5R\x99\xce\xaen4\x9a0M\x08\x94$\xd2\x8aP\
+\x19"\xa5\x08\x92\x94H*"+G,%a\x92\x92\xca\x84\xd8\x12\xac]\xbb\x16c$\xc6(\
+\x1c\x01\xc6\xa8s\x00\xfd\xbf\x1b\x10\xc7\x8e\x1d#\x8a"\xc20$\x8ec\xa2(\xa2V\
+\xab\x11\xc71\x96eaY\x16\xb6m\xe3:6Q\xaaH\x12E\xac\xc0O%\xb3\xa9$\x90\x8aXi\
+\x824f\xc5\x95\x9d\xc4Z\x91\xc8\x18)S\x10\x86\x85\x0b+`4F\xa5\x18\x95\xe2\
+\x9c\xfd\x1ffF\xe4-\xca\x11\xc71i\x9a\x92\xa6)\xbe\xef\xa3\x94\xc2\xb6\xed\
+\x0c I\x12\xa6f\xa6)U\xda\x98\x8d\x13\xa6\x83\x80D*\xfc$\xa9\x83\xc41\xbe[\
+\xc0\xe4sD:\xc5J\x15\x89\xd6$Rsx\xf00ycPi\xdd%\xd1\x9f\x90\x00\xe0\xedW\xde\
+\x15\xc7\x8e\x1d#\x0cC|\xdf\'MS,\xcb\xca\xecV\x08Aww7\x87\x07\x07\t\xa5f6\
+\x8e\xa9%)\xd3AH,\x04\xb58&\xd2\x86\xde\xe5=\xc84E\xa7\tE\xaf@k\xa9D\x8b0\
+\xec\xdb\xb7\x8f\xce\xae\xcez\x0f\xe8\x14\x83:\x1f\x00\xe0\x9f\x1f\x1c\x12\'\
+O\x9e$\x08\x82\xcc\x86\xe7c\xfe\x1f\xf0\xd1\xd0\x10I\x18P(\x17I\r\x04q\xca\
+\x8c\x1f2\x1b%,]\xbe\x0c/\xe7\xa0e\x02BPj\\@gs#\x13\xc3\x83\x18\x15q\xeb\xfa\
+k\xb0\x85Ah\x89\xd1\xe9\x85\x00\x00\xc3\x1f\x8e\x88\xe9\xe9i\xa2(\xca\xacx~\
+\x1a&&&\x18\x1a\x1abp\xff{T\\\x87J\xb9\x88\xed:\xc4F\xb3\xb4\xefJ\xf2\x05\
+\x17%%\xc5r\x99JG\'\xd7uw\xd1\x12G\xec|\xf69\xbe\xf2\xa5;(yV6\xff\xe7\xf9\
+\xc0\xa7\xe3\xc4\xe8Iq\xe5\xe7\xaf5\xe1\xc7UJ\xa5\x12\xb6mg\x86\x14\xc71\xbb\
+_\x7f\x9d\xc6\xa6&Z\x17\xf7@W\x17+V\xf4"\xd1\xa4Rc\xe5\\:\xdbZY\xbc\xb0\x95\
+\xd6$\xe4/\xcf<\xc3\xcc\xe44\x7f\x88$\xcb\xfe\xf1>7\xdd\xb0\x12\x8c\xc2\x02\
+\xae\xeb[r\xf1+\xd9\xc8\xde\x0f\x04\xc0\x8a\xafo0\xc1\xc8\x18*\xf0\xb14`YL\
+\xcc\xce\xf2\xa7\xe7\x9f\xe7kwna\xf5\xba\xf54,l!\xb2]\xa4\xed\x92\xb7-\x96\
+\x14\xf3\x9c9z\x98\xdf\xbc\xf0\x02G\x8f\x0e\xa1\x1f~\x98\xf2\x9a5\xbc\xfb\
+\xd4o)\x17\x1dV.\xebF\x98\x14\x9c\xff\xe1R\xdaU\x83M\xf7|\x9b\xf6\xb6f|\xbf\
+\x86R\n\x0bC\x18\x06\x1c?1\xca\xab;\x9f\xa3Pl`\xd5\xaaUt\xb4/\xe4\xf0\xf0\
+\x87<{\xe0\x00\xc2$\xdcq\xfbm\x1c\xf4\xf2\x8c}|\x86M\xbb\x7f\xce\xe76m\xe1\
+\xcfo\xbe\xc977\x84\xe4-\x05R^\x1e\xc0\xf3<:::XTY\x80?W@+\x89\xd6)\x98f\x96.\
+Y\x84\x85`\xdf\x81\x83L\x9e\x1eanr\x14\xdb\x82\xbb\xef\xdc\xc0m7\xad\xa6\xe4\
+\t\x96\xbe\x97\xe7\xf1_?\xc3\xa9\xb6\x0ev\xef\xde\xcd\xe6\xcd\x9b\x19\xd8\
+\xfb\x0e\x8b\xf3\x93\x17\xef\x81O\x86\xeb\xbaT*\x15\x96tW\x88\xc29T\x9a\xd4\
+\x1dM+\x84\xd6\xb8\xae\xc5\xaa\xbe\xc5\xe4\x1c\x0b\xd7\xb1\x10B\x83\xd6\xf5Q\
+S\x8a\xf5\xd7\xf7\xb2}\xdb=\xdc\xf3\xfd_!\xa5\xe2\xb5\xd7^c\xcb\x96-\xec{\
+\xf7\xef\x84Q\xfa\xd9\xb7\xe2O\xc6\xd2+\xaexl\xe3\xc6\x8dt-\xaaP\xcc\xbb\xe4\
+Ke\x8a^\x91\x05\x9eE\xa1\\$Wl\xa4\x98s\xb0,\xb0l\x10Z\xa3T\x8c\x01P\n\x81\
+\xa6\xb5\xb9\x91\x9b\xd7\xf6\xb2\xeb\xad\xbd\xcc\xceELL\x9ca\xe3\x97\xbfJ\
+\xa2\xac\xcbW \x08\x02\x84\xaa2|\xa4\x8a\xd1\n#C\xd0\x1aL\x821\n\xa3\x14\xc2\
+\xa8\xba\xb1H\x890\n\xad%\xc6\xa4\x98T\xa1\x8dF\x98\x94\xbcQ|k\xd3\x1a~\xff\
+\xea{\x8c\x8e:\xec\xda\xb5\x8b\xcd\x9b7s\xc1\xb5\xfc\xd3Qi[`\x16\xb75\x81\
+\xe3\x81\x8c\xc0\xf1\x90R\xe2 \xb35\xc8\xb3\xd9\x0e\xc8\x08\xc7q\xea9\x0eu/\
+\xc1\xc3q\xea9\xe1\\H-\xb6X\xb9r%\xdd\xdd\x8b\xf9/\xd1\xf5*U\x8c\xee\x02\x94\
+\x00\x00\x00\x00IEND\xaeB`\x82u\xc9f>' )
+
+def getIconSubimageBinaryBitmap():
+    return wxBitmapFromImage(getIconSubimageBinaryImage())
+
+def getIconSubimageBinaryImage():
+    stream = cStringIO.StringIO(getIconSubimageBinaryData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconSubimageComplexData():
+    return zlib.decompress(
+'x\xda\x01Q\x06\xae\xf9\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00 \x00\
+\x00\x00 \x08\x06\x00\x00\x00szz\xf4\x00\x00\x00\x04sBIT\x08\x08\x08\x08|\
+\x08d\x88\x00\x00\x06\x08IDATX\x85\x9d\x97\xebk\x1c\xd7\x19\x87\x9f\x99\x9d\
+\xd5\xae\xf6\x16]VV-[\x96\xa2\xe2\x84\x1ad\xcb\xae\xa3B\xdb\x04\xf5Ci()%\xae\
+\xfa\xa1A\xc1\xc4\xf9`(%%\xb5\xc0\xca\x1f \xbc61T%\x84.\xf4B(\xa5\x15\x04A(%\
+\x17S\x92\x14\xbb\x06\x9b(\xb2jDM\x1b9\x96\xe4\x8b,e\xe5\xd5jwn\xe7\xd2\x0f\
+\xb3^G\xd1J\xbb\xd2\x81\xc3\xcc\x9c\xf3\x9es\x9e\xf3{\xdf\xf3\xce\x8cA\x8d2:\
+:\xaam\xdb\xc6\xf3<\x1c\xc7\xc1\xf7}\xa4\x94(\xa5*W\xc7qp]\x17\xd7uQJQ,\x16\
+\xc9\xe7\xf3\\\xbf~\x1d\xad\xb5\xb1\xd5\xfcV-\x80|>\xcf\xb1c\xc7j\x99U VWW\
+\xc9\xe7\xf3\x00\x8c\x8f\x8fs\xe1\xc2\x05\rl\nQ\x13 \x14\n\x01\xd0\xdf\xdf\
+\xbf\xa5\x9d\xd6\x1a\xc30(\x95J\xe4r9\x8a\xc5"\xe3\xe3\xe3d2\x19FFF6\x850k\
+\x01\x94J\xa5Z&\xebJ,\x16\xa3\xa5\xa5\x85x<N$\x12a``\x80L&\x03\xa0w\x04\xa0\
+\x94\xda\x16\xc0\x97! Pn+\x88\x9a\x00;-\xb1X\x8cH$R\x13\xa2&\x80\xd6U\x94{\
+\xf3M0\xcdG\xb5\xab\xab\xea\xd8h4\xca\xad[\xb7\xb6\x84\xd8\x19\xc0\xc5\x8b\
+\xeb\x9f\x9fy\xa6\xea\xd8p8\xcc\x9d;w\xb6\x84\xa8y\n\xea\x02x\xfa\xe9\xaac\
+\xa3\xd1(\xe7\xce\x9dC\x08Q\xa9\x9e\xe7!\x84\xe0\xc8\x91#LNN\xea\x9d\x01\xcc\
+\xcdU3\xdc\xd0466\xc6\xdc\xad\x9b\x14K\x05\x96\x16\xefr\xef\xee\x02\xf3swY-\
+\x94\x98\x9f\x9fgrrr\x87\nT)\x86\xb1\xf1\x98\x87\xc3a\xf6u=\xce\xfd\xfb\xf7\
+\x89\xc7\x92$\x92-\xa4[\xd2,\xe7\x96\t\x99\x81}\xfd10:\xba>\xf0\x1e\xd6\xee\
+\xeeM\xc7\xfa\xbe\x0f@*\x95$\x1ekdW[\x9a=\x1dm\xa4[\xd2t\xb47\x01u\xc4@%\x0f\
+\\\xbdZ\xdd``\xa0j\xb3\x94\x02C\x0b<\xd7!\x04D\x1bL\xa4\x072\x96\xa2c\xb7\
+\xc1Jn\xb1>\x80J\xa9\x01\xd0\xda\xda\xba\xa1\xeb\xde\xc2M\xb4\x0cT\xb0Lh\x8c\
+\x84\x91\xc2\xc2J%\x89\x97sD\xfd1p\xfb68\x0e45\x81\xe7U\xfa[O\x9d\x82S\xa78s\
+6C\xdb\x9eN\xe2\x89$\xc5\xb5\x02K\xb7\xe7\xf9\xda\xde\xc7\x01\x98\xbd\xf1)\
+\x00R\xfaD\x1b,l\xdb\xc6\n\x89\xfa\x00\xd6\xa5\xe2\xcb\x97\xd7/\xde\xdc\xcc/\
+~\xf9\n?ya\x88XS\x13V4\x8e04\xb6\xd4tK\xc9\xa7?\x1b\xe2\x0f\xe7\xcf\xd1\xf3\
+\xe4afg\xaeb\x85L<\xe9\x10\t\x87\xd0RnS\x01\x80\x8f>\xda\xb0\xf8\x0b\'N\xd0\
+\xd4\xd6\x8e\xd2\x9a\xbb\x9e@J\xcd\x8a\xeb\x93+\xba$\x1a\xc3\xbc\xf4\xea0\
+\x18\x06=\x07\x9e\xe2\xbf\xd3\x17\xb1\x0c\xf0\x94$\xd2\x10\xbce\xb7\xf7.\xf8\
+\xf0\xc3u\x8f\x83CC\xb4\xecj\xa7!d\xd0\x182H\x9b\x9a(\x82\x08\x02S\xd9|\xb6\
+\xbc\xcc\'\xb9\xb5\x00\x02\xd0\xd2G+\x1f\xad}\x90\xa2>\x80\x8a\x0bl\x1b\xae\
+\\\xa9\xec\xfe\xcc\xd9\x0c\x89T3Ji\x0c\xadQB`*ID\x0b\xe2\xa6"\xd5`\x11Fq\xe3\
+\x8b\xfbL\x17\\\xce\x9c\xcd\xf0\xc4\xe1\xef\xa1\xb5\xc42@\xeb\xed\xba\xe0+\
+\xfe\xef\xec\xe9!\x9eH\xb0\xe8{4\t0\x94DJ\x81\x96\x02-\x04Z\t,\xe5Sr]\xd6|\
+\x9f\xbd\xfd\xdfy\xa4\x82\xf4\xb1\xcay\xab~\x80\xaf\xc8\xdf\xd2\xdc\x8a\xd0\
+\xe0\xbb.\x85\x90\x19\xecL\n\xa4\xf00\x95\x04%P\xbe\x87\xe7\x94h4!\x94J\x01 \
+}\xbb,m\x9d\xa7\xa0\x02\xf0\xa5\x00\x04X+\x16Ys]r\xb6G<bai\x81%\x04J\xfbxB\
+\xf2\xc0\xb1\xb1\xa5G\xc1\xb6Yv<:J\xab\xc1|*\xc8\x0b\x9a\xc0\x05u\xa5\xe2\
+\xd0\xdaZ\xc5\xff\x0f\xcbg\xff\x99\xc1\xc3\xe4^\xd1\xe1\x7f\xf9\x129G\xb0$|\
+\x96\x1d\xc5\x9c\xebP*\x15\xc9\xad\xac\xd0\x9ahfO\xbc\x91\x85+\x97\x00\x08\
+\x19\x1aC\x89\nHM\x05\xe2\xb6M\xd7\xf9\xf3P\xce\xeb\x00K\x1d\xbbi;=\xc2\xfb?\
+x\x8e\xd4c)f\x97\x96\xf0]\x8d!}\\\xcf\xc5\x91>\x85\x07+\x14\x94E\xe7\xeev\
+\xbe\x91\x880tz\x84\x99\x7f\xfe\xa9r\xfe\x1f^7U@\xc1\x98\x02\xfd\xdb\x89\t\
+\xd2\xef\xbe\xbb\xaeO\xfe\xea\x15\x00\xfe\xfe\xd6\xef8\x94\x88\xd2\x1eORT\
+\xb0\xe8\xb8\xac\x14VY\\y@(\xd9JWO\x0f?\xdd\xbd\x8b\x0f\xc6\xff\x12,*\x82\
+\x00D8\x98@\xef\xfe\xce-\x15\xf8f\xb5F\xf1\xd2\x8b\xf8\xcf\xff\x88\xb9\x1f?\
+\xcb\xbe\xfd\x87QJq\xfc\xd5a\xae=\x08S\x8a\xc5YM>FB\x1bt%\x93\xf46\'y\xef\
+\xaf\x7f\xe6\xb5\xd3#d\xb3Y\xf6\xf7\xfe\x90\x1bS\x13H\xa90\xb4\x0fV\xed\x18(\
+h@F"\xa8\xa7\x8e\xe2e\xdf\xc0;\x9f\t\x92\x89\xf2\xf9|\xe62o\x8c\xfd\x86o\xf5\
+t\xb3\xf4\xfe;4\x97\xd68\x10\x8f\xf1u\xe9s\xef\x83\xbfq\xb4{\x1f\xaf\x9d\x1e\
+\xa1\xb7\xf7 \xc7\xfb\x8f\xf2\xc7\x89w\xe8\xfd\xfe\xcfA8A\x1e\x10bs\x05L\xf8\
+.\xc0\xe0\xe0\xa0\x1e\x1e\x1e\xe6\xd0\x81\x1e\xa4\xefV\x16\xd7R\xa2\x95\xcf\
+\xec\xd4?\xd0H\xf6\x1fyv\xc3\'\xfc\xcc\xc7o\xa1\xa5\xa4\xeb\xa6\xc1\xb7\x8f\
+\x9f\xe0R_\x1f\xd9l\x96\xbe\xe7N\xf2\xf6\xeb/\x03\xdb8\x86ZI\xb4\x96\x8f\xd2\
+\xa9\x92\x81O\xcbm7.O\xa0\xb5D)Q\x81\xd3R\xa2\x94\xc7l\xa7\xe4\xe0\xf4\xb5\
+\xca\x9c\xd9l\x96\xc1\x93\'\xd9\x9b\x8e\xd6\xffg\xe4K\x85\x92\x12\x1f\x13\
+\xa1B\x18\xc2C\xa1\xf1\x8d\x06 \x84\xd4\xa0\xd0\xa04Rz(\xad\xd1Ja\x00Ji\xa6\
+\xde\xfb5\xd3\xd3\xd7\x98\x9a\x9a\xe2\xd2\xa5\x7f\x91\xcdfYXvj+P,\x16\x91\
+\xee\x17\xcc\xfc;W\xde\xb5\rJ\x81\xf6\xca\xbb\x0f\xb2\x9e&\xf0\xa9\xf1P\x05\
+\xed\xa3}\x89\xd2A\xc0i-y\xfb\xf5\x97\x19\x1c\xfe\xfd:%\xb6\xfcu\x06hkk\xd6{\
+\xd3M`EA8`E\x11B`!*\xf7 \xca\xd6\x16\x08\x07\xcb\xb2\x02\x1b\x8b\xe0s\x9c(\
+\x96U\xb6\x11\x82\x85e\x87\x83\x07\x0f\xd1\xd7\xd7\xc7\xff\x01\xbdw\x84\x14a\
+qv\x1b\x00\x00\x00\x00IEND\xaeB`\x82\x88\xfb\x15\x1d' )
+
+def getIconSubimageComplexBitmap():
+    return wxBitmapFromImage(getIconSubimageComplexImage())
+
+def getIconSubimageComplexImage():
+    stream = cStringIO.StringIO(getIconSubimageComplexData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconSubimageFloatData():
+    return zlib.decompress(
+'x\xda\x01m\t\x92\xf6\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00 \x00\
+\x00\x00 \x08\x06\x00\x00\x00szz\xf4\x00\x00\x00\x04sBIT\x08\x08\x08\x08|\
+\x08d\x88\x00\x00\t$IDATX\x85\x9d\x96k\x8c\\e\x19\xc7\x7f\xe7\xcc\x99=s\xdb\
+\x99\xee\xb6\xd3\x9dn\xf7\xd2u\xd9Z\xe9\xf6\x02\x0b\x0b\x04\xb5\x05\xab\x84n\
+\x01\x831\x80A \xe0\x07\x89\xfd\x82\x041b\x0c\x88(\xc5\x84h\xa2\x06E\x1acQS\
+\xe4\x8bD\x1a\xa1h\x8c\xa1\xa5\x91n\xacZ\xa0-\x94\xb2\xecv\x97\xb6;\xb3s\xe6\
+\x9c9\xd7\xf7\xe2\x87\x85\xa1\xa57\xe2\x93\xbc9\xef\x87\'\xe7\xfd\xe5\xb9\
+\xfc\x9f\xc70\xcc\x14\xe7\xb2G~\xf0\xb0\x0e\x82\x808\x8e\t\xc3\x90$I\x90R\
+\xa2\x94j}\xc30$\x8a"\xa2(B)E\xb3\xd9\xc4q\x1c\xf6\xef\xdf\x8f\xc60\xce\xf5\
+\x7f\xeb\x9c\xaf\x03\x8e\xe3p\xe3\x8d7\x9e\xcf\xad\x05\xd1h4p\x1c\x07\x80\
+\xed\xdb\xb7\xf3\xe2\x8b/j\xc3L\x9d\x15\xe2\xbc\x00\xa9\xd4|\x84FGG\xcf\xe9\
+\xa7\xb5\xc60\x0c|\xdf\xa7V\xab\xd1l6\xd9\xbe};[\xb6l\xe1\xfe\xfb\xef?+\x84y\
+>\x00\xdf\xf7\xcf\xe7r\x8a\xe5r9:;;\xc9\xe7\xf3\xd8\xb6\xcd\xfa\xf5\xeb\xd9\
+\xb2e\x0bZI\xfd\x7f\x01(\xa5Zw\xad\xf5\x19\xcf\xd9 `>r\xe7\x828o\n:\x0e\xbe\
+\xc4o\x1e\xfe7\x8f*\x9b@\x99\xd8ZQ1\xa0\xd0\x8cxd\xe7\x0b\xc0|\x9a\x0c\xc3h\
+\xa5\xeb\x03\x08\xdb\xb6[\x10\xc0\x19\xd3qV\x80\xef|\xf9r\xfdF\xd2\x85\xd3\
+\xd7\x87%%K\xa4D\x08\x81m\xdb\xe4r9\xb2\xd9,\xb7\xdez+\xdd\x81\xcd\xf7\x7f\
+\xf7s\xd2\xe94mmm-\x18\x80L&\xc3\xc4\xc4\x04\xfd\xfd\xfdg\x858#\xc0-7\xdf\
+\xa4\xd3\xcb\x97\xb3a\xf1b\xba\xbb\xbb\xe9\xeb\xeb\x03h\x15X\x10\x04\x1c:t\
+\x88\xe1\xe1a\x84\x10\xdcq\xc7\x1d<\xf1\xc4\x13-8\xcb\xb20M\x93t:\xcd\xf4\
+\xf44\xc0Y!\x8c\x8f\xea\xc0m_\xbdU\x8f\x8e\x8e\xb2v\xedZzzz\xb0,\x8bF\xa3A\
+\xadV\xc3q\x1c\x82 @kM\x18\x86\x84a\xc8\xf4\xf44\x8e\xe3p\xe4\xc8\x11\x1e\
+\x7f\xfcq\n\x85\x02\x85B\x81t:\xcd\xe6\xcd\x9b\x99\x99\x99A\x08\xd1:q\x1c#\
+\x84 \x8a"\xc6\xc7\xc79\x05\xe0kw\xdd\xa9\xd7\xad[\xc7\xc8\xc8\x08]]]\xa4\
+\xd3i\x8e\x1f?\xce\xc4\xc4\x04\xbe\xef355E\xadV#\x97\xcbQ*\x95\xc8\xe5r\xd4\
+\xebu\x0e\x1f>L\x10\x04\x9c8q\x82\x87\x1ez\x88\x85\x0b\x17R(\x14\x00\x98\x9a\
+\x9c\xa0\xe9\xbb\x9c86\xc3{3SL\xbe;C\xc3\xf5\x99\x9c\x9c\xe4\xe9?l\'e\x18\
+\xf3\x8d\xb0\xe5\xde/\xea\xe5k\xafb\xf5\xea\xd5T*\x15l\xdb\xc6u]\xaa\xd5*\
+\xe3\xe3\xe3\x1c9r\x84j\xb5J\x10\x04H)q\x1c\x87Z\xadF*\x95"\x9f\xcf\xa3\xb5\
+\xc64M\xfe\xf2\xe7\xffp\xc9\xe8\'I\xa7\xd3\xd8\xb6M\xa9\xb4\x00\xadM\n\x85"\
+\x99l;\x1d\xc5\x1c\x85\xf6\x0c"Q\xfc\xe3\xe5\xdd\x1f\xd6\xc0\xd1\xb8\x87\x95\
+\x95\n]]]d\xb3Y\xea\xf5:\x8e\xe3p\xf0\xe0A\x9e}\xf6Y\xf6\xed\xdb\x87\xe38,X\
+\xb0\x80\x8b/\xbe\x98\xd1\xd1Q\xe6\xe6\xe6p\x1c\x87\x1d;v`\xdbvK\x88\x1ex\
+\xe0m\xc6\xc6\xc6\x18\x1a\x1a\xe2\x92K.\xa1Xl\'e(\xcc\xf2"\xf2m\t\x00\xdd]5\
+\x80\xf9\x14<\xf9\xe8\xcd:\xd3}-}}}\x0c\x0f\x0f\xe3\xba.\xcdf\x93\xa3G\x8fr\
+\xdf}\xf7\xb1o\xdf\xbe\xd3\n\xb5\xa7\xa7\x87\x0b.\x18dhh9\x17\x8d\x8eR*u\x80\
+\x01N\xbd\xce\x9bG\xa6\x08\xe6\x8e\xf1\xee;\xef\xb0\xf9\x1b_\xe73\x9f\xbe\
+\x12\x91\x844\xbd&A\xd8$h\xba\xbc\xf6\xda\x7f\xb9\xe5\xf6\xcd\xf3\x11\x98K\
+\x16\xb2\xcc\xb6\xa9T*\xa7\xe8\xf9\xb6m\xdb\xce\xf88\xc0\xf0\xeaa\xbe|\xd3-\
+\xf4\r\x0ebgs$B\xe1\xc6\x11f\xb1\xc4\xc8\xc0\x10\xcb{+\x1cx\xf5U\x9e\xfe\xdd\
+\x1f\xe8(\xb53|\xe1r\xb2v\x1a),\xacb;\xf9\xf75\xc2\x02\x88U\x89b\xb1H.\x97\
+\xa3\xd1h\x10\x04\x01\xbe\xef\xb3{\xf7\xee\xd3\x1e\xcef\xb3\\u\xf5zn\xbc\xf9\
++,XT&\x93/P\xf7<\x1aA\x80\xef\x87\xd4\xa3\x04?\x91\x14\xca\x9d\\\xf8\xd9ut\
+\x94\xcb\xdc\xfb\xed\xef\xf2\xd8#\xdfc\xf9\xe0\x00\x996\x8b \x08\xb0R\x02\
+\xf8@\x8a\xcd\x0c\xb6m\x13E\x11\x86a\x90\xc9d0\x0c\x83\x89\x89\x89\xd3\x00\
+\x86\x86\x86\xb8f\xe3&\x8a\x1d\x9d\xb8\x9e\x8b\xd7pp\xebu\x1au\x87\x86\xeb\
+\xe1\xba\rjsU\xa6\xaa5\xa6\xdd&\xcb\xd6^\xc4\x9dw\xdd\xc5#?\xfc1V\xcaD\xeb\
+\x04;\x9dBK\xf9!\x80\x94!\xcdf\x13\xcf\xf3\xa8\xd7\xeb\xb8\xae\x8b\xe7y\xa7\
+\xe9\xfc\xf5\xd7_\xcf\xc0\xc0\x00\x0b\xcae\xe2(\xa6\xe9\xbaXJ\xa2\x84@\xc41\
+\x81\xef\x13\x84!~\x18\x11\x86!Su\x87\xe90\xe2\xb2\xab\xaf\xc6\xf3\x03\x0e\
+\xbd\xf56\x96\x01ZI\xec\xb6\xd4\x87\x001\xf5\x96\xca\xd5\xebu\xaa\xd5*Q\x14\
+\xb5\x14\xf0\x03\xdb\xb5k\x17\x9fZ\xb5\x8a\\\xae\xc0\xac\xe7\x11+M\xa8M\xa4R\
+H\xa9\x88\xa4\xa0\xe9\xfbx\x89$J\x04\xb5\xa6\xc7d\xbdA\xc3l\xa3\xbf\xbf\x9f\
+\x9d;w\xa2U\x82\xd6\t\xc8\x93R\x90\xe4<\xe28\xa6^\xaf\x13\x86!\xa6i\xe2y\x1e\
+k\xd6\xac9\x05 \x9f\xcf\xd3\xdd\xbd\x14!\x05N\xb3I\xbe\xa3\x03a\x1a\x84\n")\
+\xf1\xa3\x98PH\x9aF\x9aH\x08\x828!\x111\x91i022\x82\xd6\x02\xad\xe5|\x14\xf4\
+I)x\xec[\xbf5v\xed\xdaE\xbd^gnn\x0e\xd7ui4\x1a\xf4\xf7\xf7388\xd8\x020M\x93\
+\x94\x99"H\x04\xa5R\x07\x8b\xbb\xfb\xf0b\x81\'$M!\x89\x94\xc2\x0b\x03V.\xab\
+\x10)I,"\x84H\xc0\xd0,^\\\x06\xad\xd02A\xcb\x04\xeb\xfdy\xd8\x12\xa2`\x81\
+\x8b\xeb\xba\x04A@\x10\x04T\xabU\xe28f\xe3\xc6\x8d\x8c\x8f\x8f\xf3\xfa\xeb\
+\xaf\x13\xc71\r\xaf\xc1\x92\xc1O\x90\xcf\x168\xe6\xd4\x11R\xd0\x08\x02\xbc8\
+\xa6\xe6\xf9\xd4S\x19BC\xa3T\x82\x99Hb\xa5\x88\x85\xe2\xc0\x1b\x07\xb0\xb5F&\
+\xc1\xfc\x83\xea\xe4.\x00~\xf3\xe8\xef[Q\x98\x9d\x9d\xc5\xf7\xfd\xd6|\xbf\
+\xe2\x8a+\xb8\xfb\xee\xbbY\xb5j\x15s\xb5\x1a\xd9b\x89\x9a\xd7\xa4\x1eD\x1cw\
+\\B\r\xb3\r\x17_\x08\x86\x06\xba\x11I\x82Jbr\x99,\x0b\xf3y:\r\xcd\x9e={\xe8^\
+\xda=_\x03*A#O\x05\x00x\xe6\x8f\xcf\x1a{\xf7\xee\xa5V\xab\x91$\xc9)\xeb\x98R\
+\x8a\xde\xde^\x0e\x1f<\x88\xef6\xb0\xb3\x19\xfc$\xc1\xf1|\x8e\xcd\xd5\xa95}\
+\x96\r~\x02\x13\x8d\x121\x18\x06\xf9b\x89\xee\x8e"\xb3o\xbd\x81\x96!\xeb.\
+\x1b&eh\x0c%\xd0*9\x1d\x00\xe0\xa5\xbf\xfe\xcd\x98\x98\x98\xc0q\x9c\xd6\xc8\
+\x9d\x9b\x9b\xa3V\xab\xd1h48|\xf80\xfb_\xd9MQK\xda-\x13!\x13\xdc(d\xd9\x05\
+\x03\x08\x15#\x85 W(P\xaet\xb3\xbaw)\x9dQ\xc8\xd3Om\xe5\x9a\xcf\x7f\x8e|\xc6\
+l\xf5\xff\x07\xdf\xd64<\xd9&\xa7\xa6\x1e*\xac\xe9\x7f0\x9c\xa9a\x18\x06RJ|\
+\xdfGJI\x10\x04\x1c<p\x80\xa5\x8b\xcb\x14\xdb\x8b\xa4\nE\xfa\xfbz\xc8d\xda\
+\xb0\xed,\x85R\x89eK\x96\xb0\xa2g\t\x8b\x92\x90g~\xf5K&\'&\xf9{W\x17C\xcd9z*\
+\x9d\xa0\x12\xaa\'f\xf9\xd7\xfe\xb7\xcf\xbe\x92\x8d\xffq\xa7\x010|\xcb\xb5\
+\xda\x9a\x99\xc5\x16\x8a6L\x04\xe0i\xcd\xd6\xad[\xb9\xe1\xba1\x86G.\xa5\xbd\
+\xb3L\x98J#Ri\xec\x94I_\xce\xe6\xf8\xa1\x03\xfcl\xdb6\x0e\x1dz\x13u\xcf=\x14\
+\xd6\xae\xe5\xe5\'~A!g\xb1b\xb0\x17C\'`}\x8c\xa5t\xf1{\x01\x1b\xc7n\xa0kQ\
+\x07\xcdf\x03)%&\x9a \xf0\x99xw\x92?=\xbd\x95l\xae\x9d\x95+WR\xe9Z\xcc\x81\
+\xb7\x0e\xf3\xd4\xde\xbd\x18:\xe6sW_\xc5x\xc6\xe6\xd8\xf4q6\xee\xf8\x11\x97n\
+\xdc\xc4\xef_x\x81\x9b\xd6\x07\xd8\xa6\x04!\xce\x0f\x90\xc9d\xa8T*,)\x97hzY\
+\x94\x14(\x95\x80\xee`\xa0o\t&\x06{\xf6\x8eS\x9dy\x1b\xaf:I\xca\x84/]\xb7\
+\x9e\xab._C>c0\xf0O\x9b\x87\x7f\xfa$G\x17U\xd8\xb1c\x07ccc\xec|\xe5\x1f\xf4\
+\xd8U\xe0cD \x9dNS.\x97\xe9\xeb-\x13\x06\x1e2\x89\xe7\x15MI\x0c\xa5H\xa7MV.\
+\xef\xa1\xcd2I[&\x86\xa1@\xa9\xf9V\x93\x92\xcb.\x1a\xe2\xd1\xfbo\xe3\xb6o\
+\xfe\x04!$\xcf=\xf7\x1c\x9b6mb\xcf\xcb\x7f#\x08\x933\x17\xe1\xc96\xb0l\xd9\
+\x83\x1b6l`\xe9\x9229;\x8d\x9d/\x90\xcb\xe4(eL\xb2\x85\x1cm\xb9"\xb96\x0b\
+\xd3\x043\x05\x86RH\x19\xa1\x01\xa4\xc4@\xb1\xb0\xa3\xc8\x95#C<\xff\xd2+\xb8\
+^\xc8\xec\xecq6|\xe1Zbi\x9e?\x02\xbe\xefcH\x87\xb7\x0e:h%\xd1"\x00\xa5@\xc7h\
+-\xd1Rbh9/,B`h\x89R\x02\xad\x13t"QZa\xe8\x04[Kn\xdf\xb8\x96_\xff\xe9\x9fLNZ<\
+\xff\xfc\xf3\x8c\x8d\x8dq\xdaZ\xfeQ+/*\xe9\x9eE\x0b\xc0\xca\x80\x08\xc1\xca \
+\x84\xc0B\xb4\xee \xde\xf7\xb6@\x84X\x965\xefc1\xbf\x8e\x93\xc1\xb2\xe6}\x02\
+/\xa0\x11\x99\xacX\xb1\x82\xde\xde\x1e\xfe\x07\x02\x8e\xfc!\xc4\xe8\xd9<\x00\
+\x00\x00\x00IEND\xaeB`\x82\xbcQ\x9cA' )
+
+def getIconSubimageFloatBitmap():
+    return wxBitmapFromImage(getIconSubimageFloatImage())
+
+def getIconSubimageFloatImage():
+    stream = cStringIO.StringIO(getIconSubimageFloatData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconSubimageGreyData():
+    return zlib.decompress(
+'x\xda\x01\n\t\xf5\xf6\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00 \x00\
+\x00\x00 \x08\x06\x00\x00\x00szz\xf4\x00\x00\x00\x04sBIT\x08\x08\x08\x08|\
+\x08d\x88\x00\x00\x08\xc1IDATX\x85\x9d\x97i\x8cU\xd5\x1d\xc0\x7fw{\xf7\xcd[f\
+\xe3\r\xb30\x0b c\x10\\\x90\xa1`\xea\x86\x88u\x1chL$\xb1Mh0\xa9\x1f4)\xa6\
+\xb5\xd2`\x11\x8d\x8ahi\xbf\xb4\x89\x11\xeb\x16\xd74\xd3\xd0\x0f5A\xa3c\x9a\
+\xa6\xd5H\x14jSiA\x04\xcc\x13\x18"\xb3\xbe\xf7\xee}w;K?\x8c\xef\x01\xca\xd2\
+\xf4$\'\xf7|8\xb9\xe7w\xfe\xff\xff\xf9\xdds\r\xc3\xb4\xb8P\xdb\xfe\xc46\x1d\
+\x04\x01q\x1c\x13\x86!I\x92 \xa5D)U\x7f\x86aH\x14EDQ\x84R\n\xdf\xf7)\x95J\
+\xec\xdf\xbf\x1f\x8da\\\xe8\xfd\xf6\x05W\x07J\xa5\x12w\xdcq\xc7\xc5\xa6\xd5!\
+\xca\xe52\xa5R\t\x80\xe1\xe1a\xde}\xf7]m\x98\xd6y!.\n`Y3\x11Z\xbe|\xf9\x05\
+\xe7i\xad1\x0c\x83j\xb5\xca\xe4\xe4$\xbe\xef3<<\xcc\x8e\x1d;\xd8\xbcy\xf3y!\
+\xcc\x8b\x01T\xab\xd5\x8bM9\xabe2\x19Z[[\xc9f\xb3\xb8\xae\xcb\xca\x95+\xd9\
+\xb1c\x07ZI\xfd\x7f\x01(\xa5\xeac\xad\xf59\xfb\xf9 `&r\x17\x82\xb8`\n\x9e\
+\xdd\xf9\x8c\xce\xe5\xb2LMM\xf1\xc1\x07\x1f\x00P.\x97\x99\x98\x98`jr\x92\xe6\
+\x96\x16\xee\xbc\xf3N,\xcb\xc20\x8cz\xbaj\x10\xae\xeb\xd6!\x80s\xa6\xe3\x9c\
+\x00/<\xff\x9c\xee\xed\xede\xf1\xe2\xc5\x84aH\x18\x86\x04A@\x10\x048\x8eCSS\
+\x13\xae\xeb\x12\x86!;w\xee\xa4\xbd\xbd\x9d\xdbo\xbf\x9dT*U\x87\x01H\xa7\xd3\
+\x14\x8bE\xfa\xfa\xfa\xce\x0b\xf1\xad\x14<\xbc\xf5!\xbd~\xfdz\x96/_\x8em\xdb\
+X\x96\x85i\x9a\xf5\x97j\xad\xebGPJI:\x9d\xe6\xd4\xa9S<\xfd\xf4\xd3x\x9eG\x92\
+$\xf5\xb49\x8e\xc3\xe8\xe8(\xc5b\xf1\xbc\xe90\xce\xf4\xc0#\x0fo\xd5[\xb6l\
+\xc1q\x9c\xb3v^\xadV\xf1}\x1f\xcf\xf3\xf0}\xbf\xde\x83 8\xcb\x01\x86ap\xcf=\
+\xf7\x90\xcb\xe5p\x1c\x87\x8d\x1b7r\xf2\xe4I\x84\x10\xf5\x1e\xc71B\x08\xa2(b\
+\xdf\xbe}X\x861\x13\x84_lz@o\xda\xb4\x89\x19*\x83T*U\xdf\xad\x10\x82$I\xea\
+\x0b\xd5\x16=s\xf1\x9a\xa8\x8e\x1f?N\x7f\x7f?\xb6m388\xc85+\xbe\xc3\xf57|\
+\x97%W^\xc6\x82\xf9\xdd\xcc.\x14\xe8\xec\xe8 \xe5\xd8\xfck\xff\xbfO\xd7\xc0\
+\xc0\xc0@\xddd\xb5\xcav]\x17!\x04\x8e\xe3`\x9a3\xa0R\xcas\xc2\xc4qL\x92$\x14\
+\x8bE\xc6\xc6\xc6\x00\xc8\xe7\xf3\xf4\xf4\xceell\x8cl&O.\xdfJ\xa1\xb5\xc0\
+\xf8\xe48\x96i\x9c.\xc2-\xbf|P/]\xba\x940\x0c\x11B\xd4\x15\xdb\xd0\xd0@:\x9d\
+&\x8ecl{\x86\xb5\x16\xc6\xa9\xa9)\xbe\xf8\xe2\x0b\\\xd7\xe5\xed\xb7\xdf\xa6\
+\xa1\xa1\x01\xd34\x89\xe3\x98O?\xfd\x94u\xeb\xd6\xd1\xdf\xdf\xcf\xb2e\xcbhl\
+\xccc\x19\n\xb3\xad@6\x95\x00\xd0\xd5>y\x1a\xa0P\x98E\x18\x86X\x96\x85m\xdb\
+\xf5|)\xa5\xc8f\xb3d2\x19<\xcf\x03 \x8ec|\xdfgdd\x848\x8e\x99?\x7f>\xf7\xdew\
+\x1f\xcd\xcd-\xd8\x8eC\xd5\xf7\x19\x1d=\xc1\xc7{\xf7\xf2\xa7]\xbb\xd8\xf8\
+\x93{\xb9\xfe\xbakI\xa7Ld\x0c2\xd3HW\xa7\xc1\xd4\xe4W\xa7\x01\xba\xbb{\x08\
+\xc3\x10\xd34\xb1,\x0b\xcb\xb2p\x1c\xa7\x1e\xd6\xe6\xe6fr\xb9\x1c\x00\xbe\
+\xef\xb3k\xd7.:\xba:\x18\x1cZKs\xa1\x80\x93n@HM\xa8\x15\x19`\xcee\x8b\xe8l\
+\x9b\xc5\xc1\x8f?\xe6\xf57\xfe@KS\x9e\xcb\x17]J\x83\xeb \x85\x8d\xdd\x98\'\
+\xfb\xb5#l\x80\xa6\xa6&\x82 \xc00\x0cL\xd3\xacw\xdb\xb6\xf1<\x8fj\xb5JWW\x17\
+\x9e\xe7\xf1\xeak\xaf\xd2\xde1\x9b\x1f\xfeh\x03\xf9\x96YDI\xcc\xb4\xe7\xe3E!\
+q"\x88\xb0Pf\x05\x9d\xcf\xb3\xe8\x86\x1biik\xe3\x81\x07\xb7\xf2\xeb\xed\x8fp\
+\xe9%\xf3H\xa7l\x82 \xc0\xb6\xc4i\x00\xad5A\x10\x9c\xcbI\xf5v\xe8\xd0!\x86\
+\x87\x87\xf1*\x15\xd6o\xb8\x8b\\S3Q\x1c\xe2W*\xf8\x9e\x8f\x17F\x84B\x11hM\
+\xa4\xa1a\xa2\x19\xd3v\x98\xb7\xe4j~|\xf7\xddl\x7f\xf27\xbc\xf1\xf2\xb3\xc42\
+\xc4u,\xb4\x94\xa7\x01\xca\xe52\x8e\xe3\xd4\xdd^\x13M\xad\xe0|\xdfgtt\x14!\
+\x04]]s\xc867\xe3\xfbU|\xbf\x82\x0c\x83\x99q\x10\x11\x08Eh\x9aH\xcb\x9e9\x92\
+\xd3%\xdc\\\x96\x15\xabV\xf1\xcaK/r\xe8\xf0Q\x16\xf4u\x10+\x89\x9b\x9a\xf1\
+\x8f\t0>>N\x18\x86u\xe1T*\x15J\xa5\x12SSS\x8c\x8d\x8d1::\xca\x89\x13\'x\xef\
+\xbd\x11\xaeX\xb2\x04\xc7q\x19\x9d\x9c\xe4\xd4\xe4\x14\'\'KLO\x97\xf0<\x1f/\
+\x9c\x91\x96a\x98D\x89`\xd2\xf786]\xa6l\xa6\xe8\xeb\xebcdd\x04\xad\x12\xb4N@\
+\x9e\x91\x82\xf1\x89q\xd2\xe9t}\xd75S\x85a\x88\xef\xfbLOO\xe3\xfb>\xd9l\x8e9\
+\xdd\xbdH\xad\x18\x9f\x9e&\xf0}\x94H\x08\xa3\x84HJB\x05\xb1i\x92\xeb\xcc\x12\
+\t\x81\x8c\x13\x12\x11\x13\x99\x06\x03\x03\x03T&\x8f\xa3\xb5\xc46@\xeb3R \
+\x12A\x18\x86u\xc9\xd4D\x13\x04A]\xbfq\x1ccY\x16)\xc7!Q\x9a$\x91T\x82\x88$\
+\x89\t\xe2\x04\xa1\x14\xb1\x06a\x99\xd8\xaeK\xa4$JD\x08\x91\x80\xa1\x99=\xbb\
+\x8d\xca\xc4\x97h\x99\xa0e\x82\xfd\xf5\xf7\xd0\x04x|\xdb\x13\xc6\xc4\xc4\xc4\
+\xb7\xbe|5\xd7\xd7\xfc\x1d\xc71\xd3\xa5)d\x12\x13*\x8d\x97\x08JQL%\x08)\x87!\
+\x95("W\x98MdHB\x95 \x92\x98X)b\xa18x\xe0 \xa6\xd6\xc8$@)\x01J\x9c\x06\xa8\
+\x19\xae\xa6\xd7oz\xbev\x11\xed\xe9\xe9\xe1\xe0\x81\x03$\x86Ib\x18\x04\x1a*I\
+BU)\xaaRR\x15\x8a|[\x01\x91$\xa8$&\x93n`V6K\xab\xa1\xd9\xb3g\x0f]s\xbafj@%h\
+\xe4\xd9\x00\x8f=\xbe\xcd\xa8\xdd~kn\xaf\xed\xbcfE)%\xc5\xa3G\x91qD\xbe)\x8f\
+\xe9\xba(\xc3\xa6*\x04^$Xt\xe5UX\x08\x94\x88\xc10\xc866\xd1\xd5\xd2\xc8\xf8\
+\xe1\x03h\x19r\xe3\x8a\xcb\xb1\x0c\x8d\xa1\x04Z%g\x03\x00l\x7f\xf2)\xc30\x8c\
+z\x1d$IR_\\k\x8d\xef\xfb\x1c9r\x84\xcf?\xf9\x07\xdd\xf9\x1c}\xb3\x0b467b\xa6\
+\xd3\\1\xb0\x14\xdbQH!\xc8\xe4r\xb4utqe\xcf\x1cZ\xa3\x90\xd7_|\x89[o\xb9\x99\
+l\xda\xac\x9f\xff\xda\xb3\xfe9\xae\xb5\xbf\xbf\xff\xfec\xb7\r\x0e>*\x84\xc0\
+\xf7\xfd\xb3`\x0c\xc3 \x0cC\xbe,\x16\x99\xd7\xddM\xa1P\xa0\xab\xbb\x87\xf9\
+\x0b\x16\x90\xcf\xa7q\xdd\x06rMM\xcc\xed\xecdaw\'\x85$\xe4\x8f\xcf\xfd\x9ec\
+\xc5c\xfc\xb5\xbd\x9d~\x7f\x8a\xee\x8eVP\t\x13c\xe3|\xb2\xff\xe8\xd9\x17\x92\
+o\xb6\x87\xb7>\xa4\xa7K%&\'&\x18\x1f\x1f\xa7\\.\xa3\xb5\xc6\xb2,\x82 \xe0\
+\x96\xc1[\xb9|`\x19\xf99]\x84\x96\x83\xb0\x1c\\\xcb\xa47\xe3r\xea\xc8!\x86_{\
+\x8dC\x87>G\xdd\x7f?\xc6\x92%\\\xf7\xec3\x0c^\xd3\xc7\xc2Kz8\xf2\xd9\x7f\xf8\
+\xe9S\xaf^\x18\x00`\xd5M+\xf5\xd0\xd0\x10\xed\x85\x16|\xbf\x8c\x94\x12\x13M\
+\x10T)~y\x8c\x13\xa3\'i\xc8\xe4Y\xbcx1\x1d\xed\xb39|\xf8\x08{\xf7\xee\xc5\
+\xd017\xaf\xba\x89\x17\x8f\x14\xf9\xea\xb2\xab\x18\xfa\xe7>\x86\x86\xd6\xf2\
+\xce;\xef\xf0\x83\x95sq\xcd\x88\x9f=\xf1\xca\xc5\x7fL\xd2\xe94\x1d\x1d\x1dt\
+\xb65\xe1{\r()P*\x01\xdd\xc2\xbc\xdeNL\x0c\xf6\xec\xdd\xc7\xc4\xc9\xa3x\x13\
+\xc7\xb0LX\xf7\xfd\x95\xdct\xcdUd\xd3\x06\xf3>r\xd9\xf6\xbb\xe79Q\xe8\xe0\
+\xad\xb7\xdeb\xcd\x9a5\x8c|\xf87\xba\xdd\t\xe0\x7f\xf83r\x1c\x87\xb6\xb66z{\
+\xda\x08\x03\x0f\x99\xc4h-\xd0Jb(\x85\xe3\x98,\xbe\xb4\x9b\x94m\xe2\xd8&\x86\
+\xa1@\xa9\x99\xa3&%+\xae\xee\xe7W\x9b7\xb0\xe1\xe7\xbfE\x08\xc9\x9bo\xbe\xc9\
+\xda\xb5k\xd9\xf3\xfe_\x08\xc2\xe4\xdbE\xf8\xcd6o\xee\xdcGW\xaf^\xcd\x9c\xce\
+62\xae\x83\x9b\xcd\x91IghJ\x9b4\xe42\xa42\x8ddR6\xa6\t\xa6\x05\x86RH\x19\xa1\
+\x01\xa4\xc4@1\xab\xa5\x91k\x07\xfa\xd9\xfd\xde\x87T\xbc\x90\xf1\xf1S\xac\
+\xfe\xdem\xc4\xd2\xbcx\x04\xaa\xd5*\x86,q\xf8\xb3\x12ZI\xb4\x08@)\xd01ZK\xb4\
+\x94\x18Z\xce\x88E\x08\x0c-QJ\xa0u\x82N$J+\x0c\x9d\xe0j\xc9]CKx\xe1\xcf\x1fq\
+\xec\x98\xcd\xee\xdd\xbbY\xb3f\xcd\xc5\x8b\xb0\xad\xd0\xa4\xbb\x0b\xcd`\xa7A\
+\x84`\xa7\x11B`#\xeac\x10_\xcf\xb6A\x84\xf5k\x9dm\xcf\x18V\x90\xc6\xb6g\xe6\
+\x04^@92Y\xb8p!==\xdd\xfc\x17=\x89ts5\x95y\xba\x00\x00\x00\x00IEND\xaeB`\x82\
+\x11vi\xf8' )
+
+def getIconSubimageGreyBitmap():
+    return wxBitmapFromImage(getIconSubimageGreyImage())
+
+def getIconSubimageGreyImage():
+    stream = cStringIO.StringIO(getIconSubimageGreyData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconSubimageGrey16Data():
+    return zlib.decompress(
+'x\xda\x01\x0b\t\xf4\xf6\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00 \x00\
+\x00\x00 \x08\x06\x00\x00\x00szz\xf4\x00\x00\x00\x04sBIT\x08\x08\x08\x08|\
+\x08d\x88\x00\x00\x08\xc2IDATX\x85\x8d\x97k\x8c\x94\xd5\x19\xc7\x7f\xefe.;\
+\x97\xbd1{e\x97\x05\x14\xb3\x02*v\xa9\x12\xb5\x15\x11+\xec\xd2\x90HB\x1b[1\
+\xa9\x1f4\x01\xad\xb6\x1f\xa8\xadU\x01\x91B?\xd8\xa6\x04\xedE\xa3ES!\xf4CM\
+\x90\xc8\x12\xd3\x0b*Q\xd0&\x12A\x04\xcc\xb0\xb0\xd4\xbd\xcc\xee\\\xdeyo\xe7\
+\xd2\x0f\xeb\x8e\x0c\x08\xebIN\xde3\x99\xe7=\xe7w\x9e\xcb\x7f\x9e1\x0c\xd3\
+\xe2Jc\xf33\x9b\xb4\xeb\xba\x04A\x80\xe7y\x84a\x88\x94\x12\xa5T\xe5\xe9y\x1e\
+\xbe\xef\xe3\xfb>J)\x1c\xc7!\x9f\xcfs\xf4\xe8Q4\x86q\xa5\xfd\xed+\x9e\x0e\
+\xe4\xf3y\xee\xb9\xe7\x9e\xa9\xcc*\x10\x85B\x81|>\x0f\xc0\xae]\xbb\xd8\xbf\
+\x7f\xbf6L\xeb\xb2\x10S\x02X\xd6\x84\x87n\xba\xe9\xa6+\xdai\xad1\x0c\x83r\
+\xb9L.\x97\xc3q\x1cv\xed\xda\xc5\xd6\xad[Y\xbf~\xfde!\xcc\xa9\x00\xca\xe5\
+\xf2T&U#\x91H\xd0\xd8\xd8H2\x99$\x16\x8b\xb1x\xf1b\xb6n\xdd\x8aVR\x7f\x9d\
+\xbd\xfd\xf2\xc1\xf7t\xd4\xb61\r\x03\xa5\xabm\x0c@j\xcd\xdb\xb91\xbe\xad\xbf\
+\xf6\xfd\t\xbb\x8b\xc2\x9cH$*\xebI\xcf]\xce\x13v<\x12\xe1_\xef\xbc\xc3\x87\
+\x07\xf6\xb3r\xed#|r\xe8]vnx\xb2bp\xdfS\x1b\x99\xbb\xe8\x16\xd6\xad[\xc7\xbd\
+\xf7\xdeK\xa1P`tt\x94\xb1\\\x8e\xfa\x86\x06V\xaf^\x8deY\x18\x86Q\t\xd7$D,\
+\x16\x9b\x12\xc2\x06\xd8\xf1\xe8:\x00V\xae}\x84\x9d\x1b\x9ed\xcb\xbe\x03\x95\
+\x8d>9\xf4.\x00J)\x00"\x91\x08uuu\xc4b1<\xcf\xe3\xf9\xe7\x9f\xa7\xa5\xa5\x85\
+\x95+W\x12\x8dF+0\x00\xf1x\x9cl6KWW\xd7e!L\xa0\xea\xc0\x8b\xc7\xdcE\xb7T}\
+\xd6ZWJPJI<\x1eghh\x88\xed\xdb\xb7S*\x95\x08\xc3\xb0\nvpp\x90l6[\xf1\xc4\xc5\
+9a+\xad.9\xf4\xf1\xe5K/\t\xc1\xe4\xa6\x93\x00B\x08\xc20\xac\x9a;v\xec\xe0\
+\xc1\x07\x1f$\x95J\x11\x89D\x88\xc7\xe3l\xdb\xb6\r!De\x06A\x80\x10\x82\x9e\
+\x9e\x1e\x8e\x1c9\xa2m\x83K\xab\xe3B\x8f<\xbe|)[\xf6\x1d\xc0\xb6m\x86\x86\
+\x86\xa8\xa9\xa9\xa9\xda,\x08\x02|\xdf\'\x08\x02\xc20d\xf7\xee\xdd\xac^\xbd\
+\x9aT*\xc5s\xcf=\xc7\xd9\x81,N\xb9\xc8\xf0\x17\xe7\xf9\xdf\xf9\xb3\x0c\x9c9O\
+\xa1Xf``\x80#G\x8e`_>\xb7\xab\x87i\x9a4773>>N\x18\x86\x15\xe5\x9b\x14\xa0I\
+\x80l6\xcb\xf0\xf00\x00\xe9t\x9a\xce\x193\x19\x1e\x1e&\x99H\x93J7\x92i\xcc0\
+\x92\x1b\xc12\'.>\xa5\x10]\x08044\x84i\x9a\x04A\xc0\xd8\xd8\x18\x9f\x7f\xfe9\
+\xb1X\x8c}\xfb\xf6QSSS\xf9\xee\xe3\x8f?f\xd5\xaaU\xcc\x993\x87\x85\x0b\x17R[\
+\x9b\xc62\x14fS\x86d4\x04\xa0\xbd%7\x01\x90w\xdd\xaa\x83\xee{j\xe3%90\tp\xf4\
+\xe8Q\xba\xbb\xbbq\x1c\x87\xfe\xfe~\x82 `\xf6\xec\xd9<\xf4\xf0\xc3\xd4\xd77`\
+G"\x94\x1d\x87\xc1\xc1s|p\xf80\x7f\xdf\xb3\x87uk\x1f\xe2;\xb7\xddJ<j"\x03\
+\x90\x89Z\xda\xdb\x0c\xc6r_L\x00\x8c\x95\xdd\xaa\xb8\xcf]t\xcb\xd7VE4\x1ae\
+\xfe\xfc\xf9\xe4\xf3y\xf6\xec\xd9Ck{+\xcbzWP\x9f\xc9\x10\x89\xd7 \xa4\xc6\
+\xd3\x8a\x040\xfd\xda\xb9\xb45M\xe3\xf8\x07\x1f\xf0\xeak\x7f\xa3\xa1.\xcd\
+\xfc\xb9\xd7P\x13\x8b \x85\x8d]\x9b&\xf9\xa5F\xd8\xbf\xec\xbb\xdbxx\xddZ\x9d\
+\xcf\xe7\xb1,\x0b\xd34+7\x9e\x9c\xd1h\x94L&C"\x91\xe0\x0f\xdb\xff@Kk3?\xfc\
+\xf1\x1a\xd2\r\xd3\xf0\xc3\x80\xf1\x92C\xc9\xf7\x08B\x81\x8f\x852\x8b\xe8t\
+\x9a\xb9\xdf\xbd\x9d\x86\xa6&~\xfe\x8b\'\xd8\xb6\xf9I\xae\xb9j\x16\xf1\xa8\
+\x8d\xeb\xba\xd8\x96\xf8*\x07\xfa\xfa\xfa\xbeQ\x1e\xbc\xfe\xfa\xeb\x94\x8aE~\
+\xb4\xe6~Ru\xf5\xf8\x81\x87S,\xe2\x94\x1cJ\x9e\x8f\'\x14\xae\xd6\xf8\x1ajF\
+\xeb1\xed\x08\xb3\x16\xdc\xc8O\x1ex\x80\xcd\xcf\xfe\x96\xd7^~\x81@z\xc4"\x16\
+Z\xca\xaf\x00\n\x85\x02\x91H\x04\xadu\x95\xd0L\x96\x9a\xe38\x0c\x0e\x0e"\x84\
+\xa0\xbd}:\xc9\xfaz\x1c\xa7\x8c\xe3\x14\x91\x9e;\xb1v}\\\xa1\xf0L\x13i\xd9x\
+\x9e\xc7\xd9\xf1<\xb1T\x92\x9b\x97,\xe1\x95\x97^\xe4\xc4\xc9\xd3\\\xdd\xd5J\
+\xa0$\xb1\xe8\x84l\x9b\x00###x\x9eG\xb9\\\xc6q\x1c\x8a\xc5"\xf9|\x9e\xb1\xb1\
+1\x86\x87\x87\x19\x1c\x1c\xe4\xdc\xb9s\x1c8\xd0\xcfu\x0b\x16\x10\x89\xc4\x18\
+\xcc\xe5\x18\xca\x8dq>\x97g|<O\xa9\xe4P\xf2\\\xca\xe52\x86a\xe2\x87\x82\x9cS\
+b`\xbc@\xc1\x8c\xd2\xd5\xd5E\x7f\x7f?Z\x85h\x1d\x82\xbc \x04#\xa3#\xc4\xe3\
+\xf1\xca\xad\x85\x10\x95\x1aw\x1c\x87\xf1\xf1q\x1c\xc7!\x99L1\xbdc\x06R+F\
+\xc6\xc7q\x1d\x07%B<?\xc4\x97\x12OA`\x9a\xa4\xda\x92\xf8B \x83\x90P\x04\xf8\
+\xa6AOO\x0f\xc5\xdcY\xb4\x96\xd8\x06h}A\x08D(\xf0<\x0f)eEV}\xdf\xc7u]J\xa5\
+\x12\x8e\xe3\x10\x04\x01\x96e\x11\x8dD\x08\x95&\x0c%E\xd7\'\x0c\x03\xdc D(E\
+\xa0AX&v,\x86\xaf$J\xf8\x08\x11\x82\xa1inn\xa28z\x06-C\xb4\x0c\xb1\xbf\x14`\
+\x13`\xe3\xa6g\x8c\xd1\xd1Q<\xcf\xc3\xf3<\\\xd7\xadL\xcf\xf3*\xfa\x1d\x04\
+\x01\xe3\xf91d\x18\xe0)M)\x14\xe4\xfd\x80\xa2\xebQ\xf0<\x8a\xbeO*\xd3\x8coH<\
+\x15"\xc2\x80@)\x02\xa18~\xec8\xa6\xd6\xc8\xd0E)\x01J|\x05\x00T\xdc~\xb1\xc4\
+\xfa\xbe_iD;;;9~\xec\x18\xa1a\x12\x1a\x06\xae\x86b\x18RV\x8a\xb2\x94\x94\x85\
+"\xdd\x94A\x84!*\x0cH\xc4k\x98\x96L\xd2hh\x0e\x1d:D\xfb\xf4\xf6\x89\x1cP!\
+\x1aY\r\xb0a\xe3&c\xb2\xfb\x9d\xd4\xf6\xc9\x9b\x0b!*\x95\x91=}\x1a\x19\xf8\
+\xa4\xeb\xd2\x98\xb1\x18\xca\xb0)\x0bA\xc9\x17\xcc\xbd\xfe\x06,\x04J\x04`\
+\x18$k\xebho\xa8e\xe4\xe41\xb4\xf4\xb8\xfd\xe6\xf9X\x86\xc6P\x02\xad\xc2j\
+\x00\x80\xcd\xcfn1\x0c\xc3\xa8\xfa\x89\x9d<\\k\x8d\xe38\x9c:u\x8a\xcf>\xfa\
+\x90\x8et\x8a\xae\xe6\x0c\xb5\xf5\xb5\x98\xf18\xd7\xf5|\x0b;\xa2\x90B\x90H\
+\xa5hjm\xe7\xfa\xce\xe94\xfa\x1e\xaf\xbe\xf8\x12w\xdfu\'\xc9\xb8Y\xa9\xff\
+\xc9\xa7e\x18\xd5}\xe9\x7f\x0e\x1e\xdc\xb0|\xd9\xb2\xa7\x85\x108\x8eS\x05c\
+\x18\x06\x9e\xe7q&\x9beVG\x07\x99L\x86\xf6\x8eNf_}5\xe9t\x9cX\xac\x86T]\x1d3\
+\xdb\xda\xe8\xeeh#\x13z\xec\xfe\xd3\x1f\x19\xc8\x0e\xf0\xcf\x96\x16\xe68ct\
+\xb46\x82\n\x19\x1d\x1e\xe1\xa3\xa3\xa71\xae\xf4\xc7\xe4\xd7O\xfcJ\x8f\xe7\
+\xf3\xe4FG\x19\x19\x19\xa1P(\xa0\xb5\xc6\xb2,\\\xd7\xe5\xaeew3\xbfg!\xe9\xe9\
+\xedxV\x04aE\x88Y&3\x121\x86N\x9d`\xd7\xce\x9d\x9c8\xf1\x19\xea\xb1\xc70\x16\
+,\xe0\xb6\x17v\xb0lQ\x17\xddWur\xea\xd3O\xf8\xe9\x96\xbf^\x19\x00`\xc9\x1d\
+\x8buoo/-\x99\x06\x1c\xa7\x80\x94\x12\x13\x8d\xeb\x96\xc9\x9e\x19\xe0\xdc\
+\xe0yj\x12i\xe6\xcd\x9bGkK3\'O\x9e\xe2\xf0\xe1\xc3\x18:\xe0\xce%w\xf0\xe2\
+\xa9,_\\{\x03\xbd\xff=Bo\xef\n\xdez\xeb-~\xb0x&1\xd3\xe7\xd1g^\x99\xba\x1f\
+\x88\xc7\xe3\xb4\xb6\xb6\xd2\xd6T\x87S\xaaAI\x81R!\xe8\x06f\xcdh\xc3\xc4\xe0\
+\xd0\xe1#\x8c\x9e?Mit\x00\xcb\x84U\xdf_\xcc\x1d\x8bn \x197\x98\xf5~\x8cM\xbf\
+\xff3\xe72\xad\xbc\xf9\xe6\x9b\xf4\xf5\xf5\xd1\xff\xde\xbf\xe9\x88\x8d\x02\
+\xdf\xa0!\x89D"4551\xa3\xb3\t\xcf-!\xc3\x00\xad\x05ZI\x0c\xa5\x88DL\xe6]\xd3\
+A\xd46\x89\xd8&\x86\xa1@\xa9\x89R\x93\x92\x9bo\x9c\xc3o\xd6\xafa\xcd\xcf~\
+\x87\x10\x927\xdex\x83\x15+Vp\xe8\xe0\xdb\xb8^xi\x12^<f\xcd\x9c\xf9\xf4\xd2\
+\xa5K\x99\xde\xd6D"\x16!\x96L\x91\x88\'\xa8\x8b\x9b\xd4\xa4\x12D\x13\xb5$\
+\xa26\xa6\t\xa6\x05\x86RH\xe9\xa3\x01\xa4\xc4@1\xad\xa1\x96[{\xe6\xb0\xf7\
+\xc0{\x14K\x1e##C,\xfd\xder\x02iN\xed\x81r\xb9\x8c!\xf3\x9c\xfc4\x8fV\x12-\\\
+P\nt\x80\xd6\x12-%\x86\x96\x13\xc2"\x04\x86\x96(%\xd0:D\x87\x12\xa5\x15\x86\
+\x0e\x89i\xc9\xfd\xbd\x0b\xf8\xcb?\xdeg`\xc0f\xef\xde\xbd\xf4\xf5\xf5M\x9d\
+\x84M\x99:\xdd\x91\xa9\x07;\x0e\xc2\x03;\x8e\x10\x02\x1bQY\x83\xf8\xd2\xda\
+\x06\xe1a\xdb\xf6\x84\x8d=\xa1\xb0\x828\xb6=a\xe3\x96\\\n\xbeIww7\x9d\x9d\
+\x1d\xfc\x1fB\xb6,\xadW;\xd2>\x00\x00\x00\x00IEND\xaeB`\x82\x9f\xc9\\\xef' )
+
+def getIconSubimageGrey16Bitmap():
+    return wxBitmapFromImage(getIconSubimageGrey16Image())
+
+def getIconSubimageGrey16Image():
+    stream = cStringIO.StringIO(getIconSubimageGrey16Data())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconSubimageRgbData():
+    return zlib.decompress(
+'x\xda\x01\xac\tS\xf6\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00 \x00\
+\x00\x00 \x08\x06\x00\x00\x00szz\xf4\x00\x00\x00\x04sBIT\x08\x08\x08\x08|\
+\x08d\x88\x00\x00\tcIDATX\x85\x9d\x96[\x8c]\xd5y\xc7\x7fk_\xce\xde\xe7:\x9e\
+\xdb\x99\x8b\xc7\x1e;\x8e]\x17\x0f\xb5\x8d\r\xae\x92P\x1c.Mb;RCD\xf3RA\x04/\
+\xa0\x98\x07JUW\x11j\x12\xa54u\x93\x07@U\x9a4\x01\xa5\xc2i\xe4\n\x92\x98\x04\
+K@\x15!\x8b\xd6\x16xHK\x1c\x18|\x1f\x1f{\xc6\x1e\xcf\xed\xcc9\xfb\xbany\x182\
+\x86\x04\xdbQ?ii\xad\x87\xbf\xf6\xfa\xed\xef\xb6>!\x1c\x97k\xd9\xe3\xff\xf0u\
+\x9b$\ty\x9e\x93\xa6)RJ\xb4\xd6\x18c\x96\xf64M\xc9\xb2\x8c,\xcb0\xc6\x10E\
+\x11\xcdf\x93c\xc7\x8ea\x11\xe2Z\xdf\xf7\xaey;\xd0l6\xb9\xfb\xee\xbb\xaf\'[\
+\x82XXX\xa0\xd9l\x02\xb0\x7f\xff~^~\xf9e+\x1c\xf7\xaa\x10\xd7\x05p\xddE\x0f\
+\xddr\xcb-\xd7\xd4Yk\x11B\x10\xc71\xb3\xb3\xb3DQ\xc4\xfe\xfd\xfb\xd9\xbbw/{\
+\xf6\xec\xb9*\x84s=\x808\x8e\xaf\'\xf9\x80\x95J%\xba\xba\xba(\x97\xcb\x04A\
+\xc0\xf6\xed\xdb\xd9\xbbw/\xd6h\xfb\xff\x020\xc6,\x9d\xad\xb5\x1f\xba\xae\
+\x06\x01\x8b\x9e\xbb\x16\xc4uC\xf0\xb1\xff}\x8a\xf1#O\xf1v\x0ci\x0en\xeeb\
+\x9cn"\xa7\x8b\x87\xdez\x13\xc7qp]\x17!\xc4R\xb8~\x0b\x11\x04\xc1\x12\x04\
+\xf0\xa1\xe1\xb8*\xc0O?\x8fMZ\x86\xcd%\x90\xa9@F\x96<\x027\xf5\x88)\x93\x07\
+\xbd<\xb1y\x07\x85\xa0\x9f\xfb_\xfd6A\x10P(\x14\x96`\x00\xc20d||\x9c\xe1\xe1\
+\xe1\xabB|(\xc0\xf3\x7f\xe5\xd9\x91\xee2^u\x08\xb7c\x1d\xc1\xf2Mh\xe9\x907[\
+\xc8\xc6$\xdee\xcd\xe5\xb1y6\x15\xfa\x89\xbd>\xbe\xb9\xfd1\x1e\xfc\xd9\x1ej\
+\xb5\x1a\xa5R\t\xcf\xf3p\x1c\x07\xdf\xf7\x99\x98\x98\x00\xb8*\x84\xf8\xdd>\
+\xf0\xc2\xee\xa2\xdd\xb4j%\xe1\x9aO\x13\xf4\xdf\x84p\x8a\xc8\xa9\t\x92\x89\
+\xf3d\x17gP\xd31\xed\xa8D\x96w\x92\xa8.\x9aSEfe\x91_\xce\x9e\xe3\xe1\xe7\xee\
+\xa5\xbb\xbb\x9bJ\xa5\x82\xef\xfb\xec\xde\xbd\x9b\xc9\xc9I\x94RK+\xcfs\x94Rd\
+Y\xc6\xe8\xe8(\x1f\x00\xf8\xc9\xa3=\xf6\xe6\x91?\xa6\xbc\xfes\x14z6\xe2\x04\
+\xcb\xc8N\x8f\x92\xbc\xfb\x06\xd9LD\xfb\xe4Y\xb2\xd3\xb3\xb4\x9da\xe8\xdb\
+\x8c\xed\\K\xbb]\xe3\xe4\xa9\x88I\x9dr&\x9d\xe0+\xfb\xee\xa1^\xafS\xa9T\x008\
+\xdf\x18\'\x8a[\\\xbe4\xc9\xc5\xc9\xf34\xceM\xb2\xd0\x8ai4\x1a\xec\xfb\xd1~\
+\\!\x16\x0b\xe1\xc0ck\xec\xc6\rC\x94?r\x17A}#n\xb9\x0b5w\x06y\xe9\x14\xf1\
+\xff\x1d$=q\x8c\xf4\xe2,\xd9\\N\x9c\xd7\x89\xda\xdd\xb4\xe6\x96\x11\xe9\x1eZ\
+\xa2\x83K\x8e\xa4\xe9Y\x0e\xfcl\x8c\xdb\xeeX\x8e\xef\xfb\x04A@G\xc72\xacu\
+\xa8Tj\x84\xc5*\x9d\xb5\x12\x95j\x88\x92\x86C\xaf\xfd\xcf\x95\x1cH\xfd\x00\
+\xbfs5~\xfdF\xdcr\x1d9s\x1c\xb5\xd0 m\x1cB\xcd\x9d\xc2D)r\x06\xa4\x1cF\x17;\
+\x99\x175N\xb4\xe6\x88\x86&8\xf0\xea\x8f\xf1\xc3\x10\\A\x9a\xc5|\xf9\xcb\xff\
+\xcd\xae]\xbbX\xbbv-[\xb7n\xa5V\xab\xe2\n\x83\xd3\xdbC\xb9 \x01\x18\xec\x9b\
+\xbdR\x05\x07\x9e\xfc\x98\x1d\x19.!*}8\xa5n\xd2\xf91L:\x85\x9c}\x1b\xa5\xce \
+\xca\x0eN p}\x8b\x91\x15\x94\xbf\x92\x9fL\xfd\x8a\x99\x8ey\x86\xf3?\xe2\x81\
+\x87\xff\x96jw7\xc2w\x88\xdas\x9c;w\x9a7\x8e\x1e\xe5\xf9\xe7\x9ec\xf7\x97\
+\x1e\xe4\xd6O|\x9c\xb0\xe0\xa0s\xd0\xa5\x1a\x83\x03\x82\xb9\xd9KW\x00R\xe3c\
+\x8bU\xfc\xfa\rh\xdd"O/\xa2\xe3\x0bd\xed\x13X\xcf\xc5\xed-B[\xe1\x88\x9c\xb4\
+\xb0\x82\x1f\\x\x97pK\x17\xf7~\xf6>*\xf5\xe5\x88\xea2R\xeb\xd2\xd69\x15\xd9\
+\xe2\xc6u\xeb\xd8\xbc\xbc\xcc\xd8\x1bo\xb0\xef\x87?\xa2\xb3\xa3\xca\xc8\r\
+\xeb(\x06>Zyx\xb5*\xe5\xf7z\x84\x07\xa0\x0b!\xb6Z_\xfc\xfbl\x02e\xda(\x11\
+\xa1k]8\x85\x10S\xad\xe20N||\x9a\xefMe\xf8[\xfb\xf9\x8b\xfb\x1f$\xac\x0f\xd1\
+\x16.\x97\x12ESe\xa4\x99$\xcd\rFF\xf4u\xfb\xdc\xf0g\xb7\xd1\xd9\xdb\xcb\xa3\
+\x7f\xf7\x18\xff\xfc\xf8\xdf\xb3n\xcdj\xc2\x82G\x92$x\xae\xba\x02`\xbc\x10\
+\x11\xd6P6\xc1x>\xb6\xb2\x0c%f\xb1\xc1\n\x94\xd5\xa0\x15b\xf9z\x0e]:\xc3\xd9\
+\x0c\xbe\xf8\x97_\x80U\xc3\xcc\xe22\x9fKf\xc8i\xca\x94\xd4H\xd2<A\xb5\x9a\
+\x9c\x9f\xb18\x9e\xcf\xeaM\x9b\xb9\xff\x81\x07x\xfc\x1f\xbf\xc9\x0f\x7f\xf0\
+\x1dr\x9d\x12\xf8.V\xeb+\x00\x0b\xd6a\x86\x8c\\\xb5\xc8TLnRf\xb5"\xb1\x96\
+\xc8\x18&\xa4\xe1p"\t*\xdbXscN\xf7\xeaU\xe8B\x81(7(\xe1\x91[Cf,I\x92\x92\xc9\
+\x14\x95\xa5\xa4i\x81\xf3\xf3M\x82J\x99m\xb7\xdf\xce\xbf?\xf34\xc7O\x9e\xe6\
+\xa3\xc3\xfd\xe4F\x13\x14\x16\xcb\xdf\x01\x98\xd39\xe7\xb2\x84\xd3\xed)NG3\
+\x8c\xb5\xa7y;\x95\xbc\xde\x8axi~\x81\xe7\x16\x9a\x8c\xea\x1a\xaf\xee\xff)#[\
+o\xa2\xa7\xab\x9b\x04\xc8\x8d%2\x96\\\x1b\x946dZ\x91\xb6c\x924%\x93\x8a\xd9\
+\xa8Mc~\x81\x05\xa7\xc0\xf0\xf00\xaf\xbc\xf2\n\xd6H\xac\x95\xa0\xdf\x17\x829\
+\xc7r!\xd3xz\x06)|R<N\xc5)\r\x15\xd3\xd0\x8a\xa6-\x11\xf8\x03\xf8\x1d\xcb\
+\x18\x1c^\x89\xf6\x1dT\xa2\xc9\x8dF\x1b\x83R\x1a-ST\x12\xa1\xf2\x8c\\\x1b2\
+\xa5\xd0\xb9D\xaa\x9c\xcc\x11l\xd9\xb2\x85\xd6\xecy\xac\xd5x\x02\xac\xd5W<\
+\xf0\xad\x87\x0e\x8a\xc3\x87\xcfr2jr\xbc=\xcf\xd9,f\xd2\x08\xce*\xcd\xbc)\
+\xe29\xbd\xb8n\x15\xd7\xf3\xf0\n\x052\x0c\xb9V\x18i\xc8\xb3\x84<\x8dPy\x8a\
+\x96\x19y\xd4d\xdb@\x91\xcchr\x95\xa1\x94\x04a\xa9\xd7{\xc1\x1a\xac\x96X-\
+\xf1\xde{\x0f\x97\x1aQT\x80\xf3YLK\x18Z\x19\\\xd2\x86\xc4\xfax^\x07\xaeS\xc4\
+\x15E\x12)\x99k\xceQ\xca\x13Z\xb9\xa1\x19\xa5dR\x93\xc7-\xb2$%]\x98#\x06R\
+\x01\xc6H\x1c\xa9\xc9\x8d!W\x86\xb1w\xc6\x08\xacE\xcbd\xf1B\xa3\xaex\x00\xe0\
+\xe7\x8f\xfeB\x1c\x1f\xbd\xc0\xb4\xb2LJE\x9c\x0b\x84[\xc1\xa1\x8c+\x8a\x08\
+\xe114\xb4\x82\xb1\xb7\x7fM\x92\xe7\xc4q\x8b\x85<\xa1\x195\x91J\x914/#\xf3\
+\x84\x9b\xea\x01JJ\x8c\xcc)\x85E\xba\xcbe\xba\x84\xe5\xc8\x91#\x0c.\x1f\\\
+\xcc\x01#\xb1\xe8\x0f\x02\x00\xbc\xf5\xb5\xc3\xa2\xf1z\x83xNC\xea\xc1\x02\
+\x08\xebb)`\xadKr\xeb\x16\xce\x8c\x8d![M\x8a\xc5\x02*OI\xa3\x16\xad\xe64Qs\
+\x9e\x8d\xf5"\x8e\x00\xa3r\x10\x82r\xad\x83\xc1\xce\x1a\xd3\'\xdf\xc1\xea\
+\x94\xdb\xb6\x8d\xe0\n\x8b0\nk\xe4\xef\x03\x00L}\xe3\xa8\xc8\x8eMc\xa6r\xec\
+\x82\xc1\xb4\x0cz\xaa\x8d\xba8\xc7\xb4V\x9c\x18\x1f\xe7\xdd\xd7\x0e\xd1\xa72\
+\xfa=\x8d/#\xf2\xa4\xc5\xc8`\x15e5Z)J\x95\n\xbd\xfd\x83\xfc\xc9\x8a\xe5te)\
+\xfb\x9e~\x86O\xddu\x07\xe5\xd0Y\xaa\xff\xdf\xeeK\xaf\xe1\xfb-=r\xe1k\xe1-k\
+\xbf\xaa/\xb6pD\x01r\x81ie\x08\xeb\x91f\x92\x89\xa3o\xb2\xaa\xab\x93\xaer\
+\x99BXd}o\x8d\xb0\x18\x12\x04E*\x1d\x1d\xac\x1a\x18`\xfd\xd0\x00=2\xe5?\xff\
+\xed\xbb4\xc6\x1b\xbc\xda\xd7\xc7\xdah\x8e\xa1\xfe.0\x92\x99\xcb\xd3\xfc\xf2\
+\xd8\xe9\xab\x8fd3\x8f\xff\\\x00\xd4\xff\xe6\x1e\x9b7g\x10n\x88\xf0\xca\xe0\
+\xb8\\\xacVx\xf6\xbb\xff\xca\xe7>\xf3iF\xb6\xdeL\xb5>H\xea\xfa(\xd7\'p\x1dV\
+\x96\x02\xa6\x8e\x8f\xf1/\xcf>\xcb\xf1\xe3\'0\x8f<Be\xd3&^\xfb\xce\xb7\xa9\
+\x94<\xd6\xafY\x81\xb0\x12\xbc?`(\x1d\x19\xbd\xcc\x8e\x1d;\xe8\xeb\xe9$\x8a\
+\x16\xd0Z\xe3`I\x92\x98\xf1s\r\x0e\xec{\x86b\xa9\xca\x86\r\x1b\xe8\xef\xab3v\
+\xf2\x14O\x1f=\x8a\xb09w\xdc\xfeIF\xc3\x80K\x13S\xec8\xf8\rn\xde\xb1\x8b\xff\
+x\xe9%\xbe\xb0=!p4(u}\x800\x0c\xe9\xef\xefg\xa0\xb7\x83\xa8]\xc4h\x851\x12l\
+\'\xabW\x0e\xe0 8rt\x94\x99\xc9\xd3\xb4g\x1a\xb8\x0e|\xfe\xb3\xdb\xf9\xe4\
+\x9fn\xa4\x1c\nV\xbf\x1e\xf0\xf5\'\xbf\xc7\x85\x9e~\x0e\x1e<\xc8\xce\x9d;y\
+\xe5\xf0!\x86\x82\x19\xe0\x0f\xf0\x80\xef\xfb\xf4\xf6\xf6\xb2rE/i\xd2F\xcb\
+\x1ck\x15\xd6h\x841\xf8\xbe\xc3\x86uC\x14<\x07\xdfs\x10\xc2\x801\x8b\xa5\xa6\
+5\xdb6\xaf\xe5\x9f\xf6\xdc\xcb\xbd\x7f\xfd\x04Ji^x\xe1\x05v\xed\xda\xc5\x91\
+\xd7~A\x92\xca\x0fO\xc2\xf7\xdb\xeaU\xab\xbez\xe7\x9dw\xb2|\xa0\x97R\xe0\x13\
+\x94+\x94\xc2\x12\x1d\xa1C\xb1R\xa2P\xaaQ*x8\x0e8.\x08c\xd0:\xc3\x02h\x8d\
+\xc0\xd0\xddY\xe3\xe3[\xd6\xf2\xe2\x7f\x1d\xa6\xd5N\x99\x9e\x9e\xe2\xce?\xff\
+\x0c\xb9v\xae\xef\x818\x8e\x11\xba\xc9\xc9w\x9bX\xa3\xb1*\x01c\xc0\xe6X\xab\
+\xb1Z#\xac^l,J!\xac\xc6\x18\x85\xb5\x12+5\xc6\x1a\x84\x95\x04Vs\xdf\x8eM|\
+\xff\xc0\xeb4\x1a\x1e/\xbe\xf8";w\xee\xe4\xf7\xc6\xf2\xdf\xb5\xde\x9e\x0e;\
+\xd4\xb3\x0c\xbc\x10T\n^\x88R\n\x0f\xb5t\x06\xf5\x9e\xda\x03\x95\xe2y\xde\
+\xa2\xc6cq\x1c\'\xc4\xf3\x165I;a!sX\xbf~=+V\x0c\xf1\x1bD\xef\x1bbfy\x08\x8c\
+\x00\x00\x00\x00IEND\xaeB`\x82\xed\x1e\xcd\xc2' )
+
+def getIconSubimageRgbBitmap():
+    return wxBitmapFromImage(getIconSubimageRgbImage())
+
+def getIconSubimageRgbImage():
+    stream = cStringIO.StringIO(getIconSubimageRgbData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconSubimageUnknownData():
+    return zlib.decompress(
+'x\xda\x01\x04\t\xfb\xf6\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00 \x00\
+\x00\x00 \x08\x06\x00\x00\x00szz\xf4\x00\x00\x00\x04sBIT\x08\x08\x08\x08|\
+\x08d\x88\x00\x00\x08\xbbIDATX\x85\x9d\x96i\x8cW\xd5\x19\xc6\x7f\xe7n\xff}a6\
+\x06\x18\x9cAPPQ\xb6B\xa9\x8d\x96*\xc5\xca\xd0\xc4R3\x06?h*\xc5\x1akLjZ\xd1\
+\xda"\xc6\x15hSC\xadb\x15k\x13S2\xad\xd8B\x03\x16+\xa6U" \xd3 0\n\x08U\x86u\
+\x98\xfd\xbf\xdf\xed\x9c\xd3\x0fS&\xad\xe0\x0c\xe9\x9b\xdc\xdc/o\xee\xfd\xdd\
+\xe7}\xee{\x1e!\x0c\x93\xe1\xea\xc9\'\x1e\xd7\x95J\x05\xdf\xf7q]\x97 \x08\
+\x90R\xa2\x94\x1a\xba\xbb\xae\x8b\xe7yx\x9e\x87R\x8aR\xa9D.\x97\xa3\xbd\xbd\
+\x1d\x8d\x10\xc3=\xdf\x1a\xf6\xed@.\x97c\xf1\xe2\xc5#\xb5\rA\xe4\xf3yr\xb9\
+\x1c\x00\xad\xad\xad\xbc\xf5\xd6[Z\x18\xe6\x17B\x8c\x08`\x9a\x83\n\xcd\x993g\
+\xd8>\xad5B\x08\xca\xe52}}}\x94J%Z[[Y\xb5j\x15\xcb\x97/\xffB\x08c$\x80r\xb9<\
+R\xcb\xffT<\x1e\xa7\xaa\xaa\x8aD"A$\x12a\xde\xbcy\xacZ\xb5\n\xad\xa4\xfe\xbf\
+\x00\x94R\xc0\xe0\x17\x0ew]\x08\x02\x06\x95\x1b\x0eb\xc4\x11l\xedz\x9f][\xda\
+\x98zx\nG;\x8f\xe2\x16C(\x86\xb8\x03.n\x18\xf2\xe1\xba6\x0c\xc3\xc00\x0cL\
+\xd3\xc40\x8c!\x88H$2\x04\x01\\p\x1c_\xa8\xc0\xc4\x96\x19zb\xcb\x0c\xbd\xf0\
+\xf6\x99\xd4\x14\xa1\xed\xd8_\x19p\x8f\xe2Z\xc7p\xb3\'\x997w*${\x98~\xdf\x14\
+\xae\xb9\xfbz\xf2\xf9<\xae\xeb\x12\x86\xe1\x90"\xd1h\x94\x8e\x8e\x8ea\x950\
+\x858\x9fab\xcb\x0c\xfd\xe0\x03\x8b9\xd1\xd1A\xdb\xce\xe3\xf4\x16%\xeb\x97\
+\xfc\x96\x05\r\xb7ps\xe3wX\xd8t+\xbf\xd8\xb8\x91%\xb7.\xc6J\x97);\x9d\xac\
+\xdd\xf0\x1c-s\x97\xa0\xd1\x98\x86I\xa9Tb\xcf\x9e=TWW\xe3y\x1e\xb6m\x93\xc9d\
+\x90R\xd2\xd8\xd8\xc8\xae\x9d;W*\xad\x1f\x13\x9f\xdf\x03\x13[f\xe8\xaa\x05}d\
+;\xb3|z\xc0`\x9a\xdf\xc8\xf5\xd7_OSS\x13\x86a\x10\x89Dp\x1c\x07\xad5\xcb^\
+\xfc1\x0f\xae\xb8\x9d\xd7v\xbcLO{\x0f\xee\x99(\x7fZ\xf1\x17\xc6\xd6\x8f\xc5\
+\xb6mV\xaf^Mgg\'J)\x94\x92\xf8\xbeO\xb9T\xa6X*\x92\x1b\xc8\xf1\xe1\xbe}\x17\
+\xf6@\xcb\xdc;X\xfb\xd3W8\xf1\xe7S\xe2\xb2\x9bj\xb5\xeb\xba8\x8eC*\x95"\x95J\
+\x11\x8dF\x01\xf8\xe3\xf2\x97\xb8\xf3\xf5fj\xae\xa9\xc7H\x9bD\x8e\xc3\x91O?\
+\xc1\xb6l\xb2\x99,K\x97.\xa5\xbb\xeb,\xc5R\x9e\xdc@?}=\xddtu\xf7\xd2\xd7\xd7\
+\xcf\x89\xe3\'8\xd0\xde~a\x80cg\x8f\xa2\xc2"\x00RJb\xb1\x18\xa3G\x8ff\xd4\
+\xa8Q$\x93\xc9!s\x95+e\xf4g\x13\x88\xcd\x94\x98\x96\x81\x12\x82\x81\x81\x01\
+\n\x85\x02\x89x\x82d2I"\x11\xa7X,P,\xe4\xa8\xcaf\xc9\xa63te\xce\xe2\xba.\xc9\
+D\xe2|\x0fT]5f\xa5?\xee8A\xe8\x93i\x98\xbc\xb2\x94\xb5i\xeb;\xc8]\xf3o#\x93\
+\xc9\x0c\xb9\xbbR\xa9\xb0o\xdf>\xce\x9c<B\xdbK\x1f\x11\x1c\xb2\xd1\xdd\x16\
+\x1f\xee\xd9\xc7\xc7\x1f}\x8cc\xdb\x84R2\xban4\x86\x01\xa6\x10X\x96\x85m\x83\
+\xd6\x8ab~\x80\x03\x1f\x1f\xba\xb0\x02\x9d\xbbz\x886X\xd4\xcd\xa9PS\x9f\xa5\
+\xef\x8d>\x16\xfc\xa4\x85wV\xbf1\xf4\xbb\xadY\xb3\x86\xb7\xdf}\x9bi\xb3\xa7\
+\xf2\xdd\xfb\x97\x91\xb2\xb2$"i\xd2V\x923g\xce\xf0\xcf\xbd{\xd9\xb8q#\xf7\
+\xdcs73gL\xc7\xb6,bQ\x870\x91$\xfd\x9f1\xda\x96u>\xc0\xbf\xfe\xb0WLl\x99\xa1\
+\x0b\x9dGp{\x14\xe5\x86\x02E\xcb\xa7\xefx\x1f\xa7N\x9d\xa2\xb6\xb6\x96\xa7\
+\x9ez\x8aC\x1d\x9f\xb0\xfc\xf1\x87\xb1FE\xf0\x94\x87\x9f3\xa9\xaf\xbe\x84T<\
+\xc9\x949_\xe6&C\xb0o\xc7\x0e6lh%\x1a\x8d0y\xd2\xa5\x98\x86A\xd4q\x88F#Dl\
+\xfb\xc2\x00\xe7 \x00&\xdc\x1a\xd3\x03\xed\xbd\x10j\xd6\xde\xfb\n\xc7\x8e\
+\x1dc\xdd\x8b\xeb\x18(\xe7x\xf8g\x8f\xe0f$}\xf9.\x06z\xcb$\xccj\xa4\x16\x94\
+\xb0\xc8{\x92H\xc4a\xda\x8d\xf3\xc9\xd4\xd4\xb0\xe2\xd1Gyl\xc5\xc3\\>\xe9R,\
+\xcb\xc46\x05\x8ec`\x98b\xf8U\xfc\xd9\xeb\xdd\xe2\xaa\xe0Z~\xf0\xb5G0M\x93\
+\x8e\x8e\x0e\x0e\x1clg\xe9\xdd\xcb\x08\xab _\xec\xa58\x90\xc7);dcYl\xcbAk\
+\x85/C\xbaK%\xba\xbd\x80Kg\xce\xe2\xaee\xdfc\xcd\xcf\x7f\x89!\xc04\r\x1c\xcb\
+\xc2@ \xb8\x88\xb3 \x99LRWW\xc7\x981c\xd8{\xf4\x00s\xe6~\t\xa3\xd6!7\xd0C\
+\xa1?O\xd0]\xa1\xa9v\x02\xa9X\x82\xa8\xe3`Z&\x96i\xa2\xb5\xa6\xb3P\xa6\xd3\
+\x0f\x99\xf3\xf5\x1b)\xbb\x1e\xc7\x8e\x9f\xc444\x86\xa1\xd1(L\xc3\x18\x19 \
+\x1e\x8fS__\xcf\xdam\xaf\xb0\xf7\xfd\xddL\xbc\xfar\x0c\x13\xce\x0e\x14\xe8>\
+\x9d\xa7\xb1~*\x8e\xed\x10\x8d\xc4\x10\x96\x85\x10\x02-@!\xc8\xfb.\xa7r%\n\
+\xa6CSc\x13\xdb\xb7o\xc7\xd0\n\xb4\xc2\xb1\xc0\xf7\xfd\x91\x01L\xd3$\x93\xc9\
+p\xe4\xf4\xa78i\x87\xec\xe8,A(\xe9\xebr\x99\xd40\r\'\x96\xc0\x88\xc4\xc0\xb4\
+P\x08B\x04\xa1\x16\xf8R\xe2\x06!\x81\x0c\xf0L\x83\x99\xb3f\x80\x96(\xe9c\x10\
+b0x\xc2\x8e\x08 \x84\xc0\xb6m*\x9eK\xa8\x03Lm\xe0\x96l\xa6\x8c\xb9\x12\xd3\
+\x8eA$BhZ\x04\x86\xc0\xd7\x9a@+\\-\xf1\x94\xc4\x0b<\xc2\xd0\x07\xa1\xa9\xab\
+\xadCk\t*@h\x85)\x06\xd7\xf3\x88\x00\xe7\x92\x8e\x93NQ\xc9\xbb\xf4v\xf5S\xca\
+u\xe3i\x8d\xb4L|a\x12hM%\x94\xb8JQ\x0c$9\xcf\xa3\xe8\xbbx\xae\x8b\'%^ 9|\xe8\
+ H\x89\xd0\x12\x81D\x85\x83\xd9\xf2\xa2\x00\x00\xda\x9e\xdd\xc2\xd8\xda\xb1\
+\xec\xdb\xb1\x9f\x89\xe3\xa7"\r\x03Wk<4\xae\x00\x0fp\xa5\xa2\x10\xfa\xb8\x9e\
+\x8bW.a\x9b&\xd9h\x8cj\x14;w\xedb\xdc\xb8z\xb4\xf2@\xfaH\xe9\xa3\xa4\xbax\
+\x00\xc30\xb8w\xd9}8B =\x8fd:\x05\xb6\x83+\x15e?\xa4\xe0\xfa\x14<\x97\x8a[\
+\xc1-\x95\xf0|\x1f;\x1a\xa3>\x1d\xa7\xfb\xc8At\xe8r\xdd\xec\xa9\x08\x15\x0c:\
+E+\xbc\x8b1\xe1\xb9\x11\x98\xa6\xc9\xb3\xef\xfd\x86w\xf7\xefb\xdb\xb6M\xd4\
+\xd8\x06\xd5\x89(\x86iP\x96!y\xafB\xbeT\xa4\x94/\xa0\x85 \x99\x1e\xc5\x95\
+\xf5ud+e^[\xbf\x9e\x05\xf3o \x19\xd5\x18Hl\xd3 \x95\xb0\xe9\xcf\x17/>\x13\
+\xce{\xfa\x9b<\xf9\xe4\x8f\x98\xfd\xfd\xcb\xf8\xc7\xee7i{o;\xf1\xc0\xa7&\x11\
+\'\x1d\x8d\x91\x8a\xc7\x89Ec$Si\xc6\xd5\xd4ru\xc3h\xaa\xdc\x02\xad\xeb\x9eg\
+\xa0\xb7\x9fW\xfd\x90\xddm\xfbA)b\x8eAM:\xce\x15\x13\xc6\x8d\x9c\t\xcfU\xff)\
+\xc5\xef\xbb~\x8d\x91\x88\x13\xa6\x12\xac\x7fa\x1d\xc5\x9e\x1c3\xbfr-\r\xe3/\
+\xa1\x14\x8bPN\xa6 \x0c\x19m\t\xce\x1c\xfc\x88\xe7~\xf7*\x9f\x1c>\x82z\xe0\
+\x87\xa4\xa6O\xe7\xfd\x17\x9e\'\x95p\xb8b\xd2%\x18\x84`]D(=\x97zw?\xd3\xca\
+\xac{\x17\x11\xf6\xec\'\x11O\xf2\xd0\xfd\x0f\x92\xeb\xcf\xf1\xf7\xcd\x1b)\
+\x94\\&O\x9eBMM5\x87\x0e\x1df\xf7\x07\xbb\x11\xd2\xe7\xc6\x1b\xbeF[$B\xd7\
+\xe9.\x16n}\x9a\xd9\x0b\x17\xb1a\xdb6n\xf3]"\x86\x840\x1c\x19@J9\x08\xa2\x02\
+6=\xf4+Nw\x9e\xa1\xb3\xf3,\xd9D\x92\xc9\x13\x9a\xb8e\xe17\xd8\xb4\xe5Mr\xfd\
+\x9d\x14\xfbNc\xe9\x90\x96o\xcd\xe7\xba\xb9W\x11\xb7\x15M\x1f\xd8<\xb1\xf6%N\
+\xd5\xd4\xb3u\xebV\x9a\x9b\x9b\xf9\xdb\xcewi\x88\xf4\x02\x17\xa9\x80\x10\x02\
+\x81&\x9d\x8e#\xc3Q\xc4\x1d\x0b\x84&\x11\xb5qL\xc1\x92o7\x03\x12\x94B\x86\
+\x1e2\xa8 \xfd2Z)\xe6\xce\x9c\xcc3\xcb\xef\xe0\x8e\x07\x9e%\x0c%\x9b7of\xd1\
+\xa2E\xec\xda\xf1\x0e\x157\xb8p*\xfe\xefjjl\\9o\xde<\xaa\xab2\x18Z",\x8b\x88\
+\x13%\x1d\xb5\x90Z#\xec(\x8e\tJI\xb4\xf6Q\x81O\xe8\x97\x00=\xb8xPT\x8fJ\xf3\
+\xd5Y\x97\xb1\xe5\xed\x9d\x14\x8a.==]\xcc_p3\xbe4FV\xa0T*!\xbd^\x0e\xb6\xf7\
+\xa1d\x88\x0c\xca\xa04\x9e[\xc60!\xe2\x9c\xc46\x04\x1a\x89\xf2\\T\xe0"\xa5\
+\x8f\xd6\x01:\x90(\xad\x10: \xa2%w.\x9c\xce\xcb\x9b>\xe0\xc4\t\x8b-[\xb6\xd0\
+\xdc\xdc\xccy\xb1\xfc\xf3U[\x93\xd1\r5Y\xb0\xa2\x10\xba`EQJ\x11\xb3\x05\xd81\
+\x94T B\x82 @I\x81\xf2\xcbX\x96E\x18\x86X\x16\x84aHH\x14\xcb\n\x01\xa8\x14+\
+\xe4=\x83)S\xa60~|\x03\xff\x06\xdb\tpn,%\xf2\xa4\x00\x00\x00\x00IEND\xaeB`\
+\x82W\xe2Q\xa2' )
+
+def getIconSubimageUnknownBitmap():
+    return wxBitmapFromImage(getIconSubimageUnknownImage())
+
+def getIconSubimageUnknownImage():
+    stream = cStringIO.StringIO(getIconSubimageUnknownData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconUndoData():
+    return zlib.decompress(
+'x\xda\x01\xea\x04\x15\xfb\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00\
+\x16\x00\x00\x00\x16\x08\x06\x00\x00\x00\xc4\xb4l;\x00\x00\x00\x04sBIT\x08\
+\x08\x08\x08|\x08d\x88\x00\x00\x04\xa1IDAT8\x8d\x95\x95_lSU\x1c\xc7\xbf\xe7\
+\xde\xdb;\xa0t[\x0b\x1dl\x03V\xb6aCeh\xe2\x02/(}\xf1\x0f\xd1\xd7\xedAC\x9c\
+\xe8\xd3\x0c/\x9a\x98,1Y\x16MD\x13\xf62\x13}r\x10"\xa2\x0bh\xe4\xc1\x848m\
+\x013\x1cL\xc0\xb2\xa9\x13\xa4\x056K\xbb\xfe\xbf\xb7\xb7\xbd\xf7\x9c\xf3\xf3\
+A;\xb7\x01\x06\x7f\xc9y8\xff>\xe7\xfb\xcb9\xe7\xfbc\xf8\x9f144\xc4\x96\xf6\
+\x07\x07\x07\xe9~\xeb\xd8\xfd\x06WF4\x1aU\x02\x81\x80\xe2\xf1xTM\xd3\x14EQ\
+\x98\x94\x928\xe7\xb2T*\x89x<.\xf7\xee\xdd+\x1f\x1a\\\x03\xae[\xb7N\xdf\xf2\
+\xca\x13\xe6\xca\xf9\xd4g\xd3\x9b\x85\x10e\xc7q*\x99L\xc6>r\xe4\x88xP\x06\
+\x00\xfeN7\x91Hh\x86a\xac\xf1\xf5\x04\xc9\xd7\x13\xa4\xe1\xf1Q:w}\x92n\xa6n\
+\xd1\xb9\xeb\x934<>J\xb59\xcey[\xb5Z\xf5f\xb3\xd9\xbah4\xaa\x00\x00\xab\xa92\
+M\x93\xc6\xc6\xc6d8\x1cf\xa1PH\x0b\xf6\xef\xa9\x02@\xe2\xe8\x14&\xef\xfc\x8c\
+\xd1_N-;\xbcy\xc3F\xf4\xb7\xf7\xe2\xcb\xd88\xde\xfd\xf8\x10\xd2\'fBB\x88\xb4\
+a\x18\xa5X,\xe60_O\x90\xe6\x8f]m$"i\xdb\xb6\x03\x00[_\xdbe%\x8eNajn\x1a\xa7\
+\x13gq\xe6\xfa\x0f\x00\x00\xc7Y\x9e\x99g\xb5\x17\xe1\x1d\x8f\xa2\xbf\xbd\x17\
+[\x9b\xb6@J\xb9\x83s~\xd70\x8c\x92\x06\x00-\xfb\x1f\xcb\xa7O\xccth\x9afmxq\
+\xc7|\xe2\xe8\x14\x06&\x0e#\xfa\xfbe8\x0e\xd0\xd4\xb9\tk\xeb\xeb\x96A\x8db\
+\x15\x95l\x01\xa7/\x9e\x07\x00\x0c\x8f\x8fBQ\x94kB\x88\x90\xdb\xed\x16\xcc\
+\xd7\x13\xa43\x1f|\x81g\xde\xeaE-\xf5\x81\x89\xc3\xf8v\xe6\xf2"p!\x9e\xc2\
+\xe4K\xc7\x96\x81\x9b^\xde\t7\xd3\xe1\x7fz;\x8a\xd9\x12f^?\x05EQ \xa5\x0cK)\
+\xe3Zm\xe1\xa5\x0f\xcf\xe0\xfb\xe9\t\x0cL\x1c\xc6w\xd7\xae\xa0\xbd\xbb\x03\
+\x0b\xf1\x14\xce\xee;\x86U\x1d>\x10Q\x1f\x802\x00\x1b\x004\xb7\xfeU\xde[\x07\
+\x93l\xf8\x9a\xbc8pr\x00\xc3\xe3\xa3hxjs\xa4p\xf6\xf6\xe3\x1a\x00\xb4z\x9bq\
+\xe8\xf2\xa7H\x95S\xb8z\xe3W\x04\xba\xdb\x17U\x12\xd1\x01\x00\x05\x00y"*\x10\
+\x91\x05\x00\x8eQ\xedf\x8c5\xd4m\xf4\x8c[\xdb\x1a\x11\xd1\t\x9f\xbc\xf3\x1e\
+\x06\x07\xdf\x06\x80\x86E\xc5\xdf\xcc^\x00\x97\x1c\xeb76b\xee\xc78\xae\xbeq\
+\x12D\xf4*\x804\x11%\x89(#\x840\x84\x10U\x00PU\xb5NU\xd5\xb5\x95?\x8b\xddk\
+\x82\xeb/\x95~K\xa3\xfd\xa3}\x00\x00\xc6\x98\xae\x01\xc0\x8d\xdcmxV\xafB\xce\
+4 9\xb0}\xf7#\xf8cO+\x00XD\x94\x95R\xa6\x1c\xc7\xc9\xe5\xf3\xf9J.\x97\x93\
+\x00\xe0\xf5z\xad\x86\x86\x06K\xd7\xf5*O\x95a\xdd\xc8\xc2N\x16Q<wg?\x11\xd9\
+\n\x00\x9c\x9e\x8e\xc0\x9a\x9e\x87{\xae\x88\xc6[e\\\xf9\xfa"v>\xb7\x0b\xf5On\
+:\x0e@\x02\xe0\xb6m;\xb3\xb3\xb3"\x14\n\x89P($\x9a\x9b\x9b\x9dt:]\xe1\x9c\
+\x9b$$T\xb7\x86\xd2\xf99\x000\x00\x144\x00x\xff\x857\x17o;\xb6\xe2\x17\xaa\
+\xaa:\xc19\xef\xd0u\xdd\xe5\xf7\xfb\x97\xbdd\xd34\x89\x88hmS#$\x00"\xea\xa9\
+\xdd\x85v\xf7\xf8\xb5\x16\xf5s\xb5\x851\xe6\x05P\x87\x7f\xfdC\x02p\x88\xa8DD\
+\x8c1\xa6\xb8\xdd\xeeEo\x19\x1a\x1ab\xad\xad\xad.\xdf\xd6\r\x05\xad\xd3\x83\
+\xf2O)\x000\x89(\'\x8404\xce\xb9\x01`^Q\x94\x1c\x00\x15\xcb\x8dI\x12\x91#\
+\xa5,s\xce\x1d\xd34\xa9\x06=x\xf0\xa0\xde\xd2\x15\xb0\xb4N\x0f\xc4M\x13\xdc\
+\xb4\x9f\'\xa2\xa2\x942o\xdbvYK\xa5R\x96\xc7\xe3\xb1u]W\x19c\xf7\xb8\x9d\x10\
+Br\xcee2\x99\xe4ccc2\x1a\x8d*]]]\xae\xb6\xeem\x15w\x9b\x0f\xe6\xed,\xcc;\xb9\
+}Dd\x11\xd1\x82\x10\xa2\x98\xc9dlVS\xb0\x14\x16\x0e\x87Y$\x12\xb9\xc7\xfe\
+\xfa\xfa\xfaT\xaf\xd7\xebj\r\xb5\x95\x11X\x83\xd2\xf99\x10\xd1\xb3DT!\xa2t\
+\xcd\x84FFF\xec\x95{\x1f\x18\xff\xd8!\xd5\x9a\x94\xb2[J\xb9GJ\xb9[\x08\x11\
+\xb4m{\xfdR\xdb\xd4\xfe\x93\xb6$\x02\x81\x80bYV\xbd\xcb\xe5\xaag\x8cy\x00\
+\xb8\x88\xc8$"S\x08Q2M\xb3\x1c\x8b\xc5\x9cZ%Q\x1e\x16\x1c\x8f\xc7\xa5\xe38\\\
+\x08aI)\x0bB\x884\xe7<Y\xa9T\x16\x92\xc9didd\xc4^Z\x9e\x1eZq$\x12!\xbf\xdfo\
+\xfb\xfd~\xa1\xebzY\x08A\x0f\xaaw\x00\xf0\x17\xd8Y\xbb\x97~\x03\nW\x00\x00\
+\x00\x00IEND\xaeB`\x82AJ<\x9a' )
+
+def getIconUndoBitmap():
+    return wxBitmapFromImage(getIconUndoImage())
+
+def getIconUndoImage():
+    stream = cStringIO.StringIO(getIconUndoData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconZoomFitData():
+    return zlib.decompress(
+'x\xda\xeb\x0c\xf0s\xe7\xe5\x92\xe2b``\xe0\xf5\xf4p\t\x02\xd2" \xcc\xc1\x06$\
+{;ey\x81\x14K\xb1\x93g\x08\x07\x10\xd4p\xa4t\x00\xf9\x87<]\x1cC,z\xf7\x86\\\
+\xe4;d\xc0\xc1\xf2\xca\\\xba\xf3\xe5\xe5\xa4\xac?\xcfy\xe3\x8f\xac\xe1\x99\
+\xa1\x17:\xc9V\xa7|o\xdcKQ\x17-\x83M\x19+\xa4\x18\xe6(9L\x8bT\xe2Y\x99\xd0\
+\x91\xea\xbe/\xe6<\x13\xc3\x85el1;\x0f\xbf\xdb\xde\xae=\x8b+j\xf9L\xe3\xb5[\
+\xda7\x9dY\xa4\x14c\x99{\xd8\xed\x82r\xb4\xfb<\xe7\xdd\xeb\x8aW\xd8\xde.N*\
+\x8c\xdd.\x18\xf2i\x9e\xf1\x92\xa6\x87\xcb<X\xe3\xc4\x95\xef-\xaf8\xf6\xf0T~\
+\xdct\xe7uo\\]L\x94<Xs\xa7\xdc\xba\x92\xd4\xbek\xf2s\x9d_\xdb\xf9\xee\xde\
+\xa8\xd8\xbe3\xaff\x9a\xfb)\x8fm\x1f\xe5]_\xaf\xd7O\xd5M\xba_t\xa2_\xe6_\xc9\
+\xad\x8a\xd2\x8a[5\xd1\x87\xd5\xbf\t\xb7\xef)Q\x08\x98\xf4\xc5\x12\xe8\x1b\
+\x06OW?\x97uN\tM\x00cXk\x84' )
+
+def getIconZoomFitBitmap():
+    return wxBitmapFromImage(getIconZoomFitImage())
+
+def getIconZoomFitImage():
+    stream = cStringIO.StringIO(getIconZoomFitData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconZoomInData():
+    return zlib.decompress(
+'x\xda\x010\x03\xcf\xfc\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00\x18\
+\x00\x00\x00\x18\x08\x06\x00\x00\x00\xe0w=\xf8\x00\x00\x00\x04sBIT\x08\x08\
+\x08\x08|\x08d\x88\x00\x00\x02\xe7IDATH\x89\xb5\x95\xcbO\x13Q\x14\xc6\xbf\
+\x99\x81\x82P\n\xbd\x94D\x90WXh\\\x08(\xd1\x05Dq\xe9\xdf\xa0q\xc3\xa6\x1b\
+\xa3Ku\xa3\xb0\x11\x88\x1b]\x16L\x8c\x0b\x13\x93Fv,t\xc5\xc6\r&\n\r\x18c\x05\
+\xe4ab\x87G\xdby0\xcf{\x8f\x0b\xd2\x86"\xb5\x05\xf4Kn29\x939\xbf\xf3\xbag$IV\
+\xf0?UQ\xecE\xb8\xa1\x9e\x0e\xda\xd2\x99\xactb@\xce\xf1\xe8\xf8\x18\x9a\xce\
+\xb4\xa16X\x07\xd3\xd0\xb1\xf9s\x1d\x0f\xef?\xa0#\x83$Y\xc9\x1f\xc6\x18=\x1a\
+\x19\xa6\xf9\xe4wJnn\xd1\x8anQ\xd2\xd8\xa5D\xd6\xa4O;\x1a\xad\x1a\xbb\xf4xd\
+\x98\x18c\xb4\xff\xbb\xbf\x1dE\x92\xe4|\xe4w\xee\xdd\xc5\xcd\xa1!D\x9a[P\x19\
+\xa8B\xca\xf7a\xf8\x84\x94\xeda]\xb3\x90\xe1\x84\x1b\xd7\x07\x11\x80@bnn\xd8\
+\xb6\x9d\x91\x92\t\xe4\x9a\x1cn\xa8\xa7\x99\x8f\xb38\xdd\xda\x06E\x91A\x04l\
+\xd9.T\xc7\x87j\xbbHe5\xa4\x1d\x17\xe7\x18\xc3\xe5\xc6 .u\xb4\x95U*9\xe7|t|\
+\x0c\xc1P\x18\xbe\x00\x88\x00\xcf\xe7\xe0\x82\xe0\x08\x82\'I\xe0J\x00\xa6/\
+\xf0YM!a\xb8\x18\x1d\x1f;t\x10\x0e*\xdf\xe4\xb6\xae.\xd4\x06\x83Xs=\xd4\xf9\
+\x12\xb8 h\xae\x80\xe6\xf9\xd0\x1c\x1fi.\xb0e9\xe0\xc2\x85\xeezh\xbd2P\xcaw!\
+\x80\x85\x1b\xe1\x13\xe0\xd86,\xa5\x126\t\xe8.\xc7\xa6\xeda\xdb\xf3\xa0y\x1c\
+Y\xcb\x86\xc4-\x04\x14\tJ(t4\x80a\x9a0\x1c\x07i\xcb\x85\x17\x90`\x0b\x01\xdd\
+\xe6\xd8\xf6=d\x1d\x8e\xa4\x9e\x01q\x07\xc2\xb2\xa0Z\x1ejv\xb5\xb2\x00r\xeea\
+\xe9\xeb\x17\xb8\x90\xa1\x9a6\x96\xd2:6w]\xa4\xb8\x83\xb4\xed\xe3\x9be\x80g\
+\xd2pv\xb6\xd0\x11nB{\xf0\x146f?\x94\x05(\x98\xa2ws\x0b\xd8\xa8\xa8\xc2\xe2/\
+\x15\xa6\xbfW\xf3\xace\xc3\xe2\x0et5\x85@u\x1d\xae\xf5]\xc0\xad\xe6F\xf4\x1d\
+e\x8ar\x9a~\xf5\x02\x17\xeb\xaa\xd1\x19\n\xa1\xb6B\x06\x17.`f\xe0dvp\xb6\xbd\
+\x13W{\xce\xe3vK\x04\xef\xdf\xbc.+\xfa\xbd\x14\x0e\xb9\xc9K\x9aASk*\xbdL\xae\
+\xd3\xd3\x85\xef\xf4da\x99\xa6\xd6TZ\xd6M\x8aMN\x10c\x8c\xe2\xf18\x05\xb9[\
+\xf2F\xffa`\x8cQ$\x12\xa1\xd8\xe4\x04M\xcf/\xd2\xcc\x8fu\x9a\x9e_\xcc;f\x8c\
+\xd1\xe0\xe0u\xaaY]\xa1x<^zm\x14[\xd7\x8d,LB\x88\x02[\xae\xe6\x95o\xa7\xa8\
+\xff\xf93\xf4\xf6\xf6b`\xa0\x1f\xd1h\xb4h?\x8a\x02J)\xdcPO\xdd\xdd=%!E\xff\
+\x07\xa5\x94\xced\xa5Db>\xbf*b\xb1\x18\xa2\xd1(\x1d\x84\x14\x00Hp\x92d\xa5\
+\xec]_\x0e\xe4\xd8\x19\x94\x0b\xa9\xc8E\xbe?\x0b\x008I&\xfbU\xd0\xe4\xa3\x96\
+\xe8\xa0r\xeb{\x7f\x89\xfe)\xe00\x1d{L\xcb\xd5o;\'\xc1c<\x04\xf3W\x00\x00\
+\x00\x00IEND\xaeB`\x82\xc4\xaat\x83' )
+
+def getIconZoomInBitmap():
+    return wxBitmapFromImage(getIconZoomInImage())
+
+def getIconZoomInImage():
+    stream = cStringIO.StringIO(getIconZoomInData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconZoomNormData():
+    return zlib.decompress(
+'x\xda\x01 \x03\xdf\xfc\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00\x18\
+\x00\x00\x00\x18\x08\x06\x00\x00\x00\xe0w=\xf8\x00\x00\x00\x04sBIT\x08\x08\
+\x08\x08|\x08d\x88\x00\x00\x02\xd7IDATH\x89\xcd\x94\xbbOSQ\x1c\xc7\xbf\xb7\
+\x85\x02R\x9a\\.$\x82\xbc\xc2\xa0q\x10P\xa2\x03Dp\xf4o\xd0\xb8\xb0t1:\xaa\
+\x83J\x07\x038\xe9F\x891q01M0\x0e8\xe8\xa2\x0b\x0e\x18cyhL\x11\xe4eb[\xe0\
+\xb6\xf7\xc1}\x9e\xf3s\xc0\xdb@\xa5\xb6%\x9a\xf8\x9dN\xce\xe3\xfb9\xbf\xc79\
+\xc0?\x96PhA\x14E\xca\x9f\x93e\xb9\xe0\xfe\x92\x01\x9e\xf1\xc8\xd8(\x1a\x8f\
+\xb5\xa26X\x07]S\x91\xfe\xbe\x8e[7n\x1e\x1a\x943\xbf=|\x97\xe2\x89EJ\xa4\xd2\
+\xb4\xac\xecPB\xd5i6\xa3\xd1\x87\xad,\xad\xa8:\xdd\x19\xbeK\x07EWH\xfe\xbd\
+\xe6W\xaf_\xc3\xa5\xa1!445\xa32P\x85\xa4\xebBs\tI\xd3\xc1\xbab \xc3\x08\x17/\
+\x0c"\x00\x8e\xb9\xd9\xd9a\xd34#\xc5\x00\xb9PEQ\xa4\xb7\xefgp\xb4\xa5\x15~\
+\xbf\x0fD\xc0\xa6i#e\xb9H\x996\x92Y\x05\xb2e\xe3D}=\xceJA\x9cio-)U>\xcf|dl\
+\x14\xc1\x90\x08\x97\x03D\x80\xe320N\xb08\xc1\x11\x040\x7f\x00\xba\xcb\xf11\
+\x95\xc4\x9cfcdl\xf4\xc0F\xc8W\x857h\xed\xecDm0\x885\xdbA\x9d+\x80q\x82bs(\
+\x8e\x0b\xc5r!3\x8eM\xc3\x02\xe36T\xdbA\xcb\xb9\xfeb\xde\xfb\x01\xf5\xa2\x04\
+\x97\x00\xcb4a\xf8+a\x12\x87j3\xa4M\x07[\x8e\x03\xc5a\xc8\x1a&\x04f \xe0\x17\
+\xe0\x0f\x85\xca\x03h\xba\x0e\xcd\xb2 \x1b6\x9c\x80\x00\x93s\xa8&\xc3\x96\
+\xeb k1,\xaa\x19\x10\xb3\xc0\r\x03)\xc3\xc1\x91\x1d\xa5$\x80\xcf\x1b,}\xf9\
+\x0c\x1b>\xa4t\x13K\xb2\x8a\xf4\x8e\x8d$\xb3 \x9b.\x12\x86\x06\x96\x91amo\
+\xa2]lD[\xb0\x06\x1b3\xd3%\x01\xf6u\xd1\xab\xf8\x026*\xaa\xf0\xe9G\n\xba\xbb\
+\x9b\xf3\xaca\xc2`\x16\xd4T\x12\x81\xea:\x0c\xf4\x9e\xc2\xe5&\t\xbd\xe5t\x91\
+\xa7\x97O\x1e\xe1t]5:B!\xd4V\xf8\xc0\xb8\r\xe8\x19X\x99m\x1co\xeb\xc0\xf9\
+\xee\x93\xb8\xd2\xdc\x80\xd7\xcf\x9e\x96t\xfb\xdf\xe4\xbd\xe4\xafY\x95&W\x93\
+\xf48\xb1F\xf7\xe7\x17\xe9\xde\xfc\x12M\xae&iI\xd1h|"J\xa2(R,\x16\xa3Z\xd7*\
+\xf9E\xef\x83H\x92D\xe3\x13Q\x9a\x8a/\xd0\x9bok4\x15_\xc8\x19\x8b\xa2H\x03\
+\x03\x83T\xb3\xb2L\xb1X\xac\xe8\xb7Q0\x87\x92$\x11\xe7|\xdf\x9c\x97\xf3\xca\
+\xe7/\xa8\xef\xe1\x03\xf4\xf4\xf4\xa0\xbf\xbf\x0f\xe1p\xb8`=\x0e\xf7+b7\xd2\
+\xae\xae\xee\xa2\x90\x8a\x03\xceR)`Y\x96\x85\xb9\xb9\xd9\\z\xa2\xd1(\xc2\xe1\
+0\xe5C\xf2\x01e\x15\xad\x14H>@\xf8\xdb\x10\x1f\x00D"\x91C\xd7b\x0f\x04\xf1x\
+\x1c\xd3\xd3\xef\x8a\xee/\xbf\xb7\x7f\xc9k\xe3\xbds\xf97\xa7?\xac\xfd\x9f\
+\xfa\t\xd9\x9f\xb3\x87(\xb9M3\x00\x00\x00\x00IEND\xaeB`\x82=$k\xe5' )
+
+def getIconZoomNormBitmap():
+    return wxBitmapFromImage(getIconZoomNormImage())
+
+def getIconZoomNormImage():
+    stream = cStringIO.StringIO(getIconZoomNormData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconZoomOutData():
+    return zlib.decompress(
+'x\xda\x01-\x03\xd2\xfc\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00\x18\
+\x00\x00\x00\x18\x08\x06\x00\x00\x00\xe0w=\xf8\x00\x00\x00\x04sBIT\x08\x08\
+\x08\x08|\x08d\x88\x00\x00\x02\xe4IDATH\x89\xb5\x95\xbbO\x14Q\x14\xc6\xbf\
+\x99\x81\x05aY\xd8\xcb\x92\x08\xf20\x14\x1a\x0b\x01%Z@\x14J\xff\x06\x8d\r\
+\xcd6FK\xb5Qh\x04b\xa3\xe5\x82\x89\xb101\xd9HG\xa1\x15\x8d\r&\n\x1b0\xc6\xe5\
+!\x0f\x13wx\xec\xee<\x98\xe7\xbd\xc7\x82\xec\x86\xd7\xba\x8b\xe0\x97\xdcdrf\
+\xe6\xfc\xee=\xe7\xdcs$IV\xf0?UV\xe8E\xb8\xae\x96\x0e\xda\xd2\x99\xactb@\xce\
+\xf1\xf0\xe8\x08\x1a\xce\xb5\xa0:X\x03\xd3\xd0\xb1\xf1k\r\x8f\x1f>\xa2c\x83$\
+Y\xc9/\xc6\x18=\x19\x1a\xa4\xd9\xe4\x02%76iY\xb7(i\xecP"k\xd2\x97m\x8dV\x8c\
+\x1dz:4H\x8c1\xda\xfb\xdf\xdf\x96"Ir~\xe7\xf7\x1e\xdc\xc7\xed\x81\x01D\x1a\
+\x9bP\x1e\xa8@\xca\xf7a\xf8\x84\x94\xedaM\xb3\x90\xe1\x84[\xfd}\x08@ 133h\
+\xdb\xceP\xd1\x03\xe4\x92\x1c\xae\xab\xa5\xa9\xcf\xd38\xdb\xdc\x02E\x91A\x04\
+l\xda.T\xc7\x87j\xbbHe5\xa4\x1d\x17\x17\x19\xc3\xb5\xfa \xae\xb6\xb5\x94\x14\
+*9\xe7|xt\x04\xc1P\x18\xbe\x00\x88\x00\xcf\xe7\xe0\x82\xe0\x08\x82\'I\xe0J\
+\x00\xa6/\xf0UM!a\xb8\x18\x1e\x1d9\xb2\x10\x0e*\x9f\xe4\x96\xf6vT\x07\x83Xu=\
+\xd4\xf8\x12\xb8 h\xae\x80\xe6\xf9\xd0\x1c\x1fi.\xb0i9\xe0\xc2\x85\xeezh\xbe\
+\xde[\xcc\xf7~\x00\x0b\xd7\xc3\'\xc0\xb1mXJ9l\x12\xd0]\x8e\r\xdb\xc3\x96\xe7\
+A\xf38\xb2\x96\r\x89[\x08(\x12\x94P\xe8x\x00\xc34a8\x0e\xd2\x96\x0b/ \xc1\
+\x16\x02\xba\xcd\xb1\xe5{\xc8:\x1cI=\x03\xe2\x0e\x84eA\xb5<T\xedh%\x01\xe4\
+\xdc\xc3\xe2\xf7op!C5m,\xa6ul\xec\xb8Hq\x07i\xdb\xc7\x0f\xcb\x00\xcf\xa4\xe1\
+lo\xa2-\xdc\x80\xd6\xe0\x19\xacO\x7f*\t\xb0\xaf\x8a>\xcc\xcca\xbd\xac\x02\
+\xf3\xbfU\x98\xfen\xcc\xb3\x96\r\x8b;\xd0\xd5\x14\x02\x955\xb8\xd9}\x19w\x1a\
+\xeb\xd1}\x9c*\xcai\xf2\xcd+\\\xa9\xa9\xc4\xf9P\x08\xd5e2\xb8p\x013\x03\'\
+\xb3\x8d\x0b\xad\xe7q\xa3\xf3\x12\xee6E\xf0\xf1\xdd\xdb\x92v\xbf{\x84#n\xf2\
+\xa2f\xd0\xc4\xaaJ\xaf\x93k\xf4|n\x81\x9e\xcd-\xd1\xc4\xaaJK\xbaI\xb1\xf11b\
+\x8cQ<\x1e\xa7 w\x8b\xde\xe8C\x06\xc6\x18E"\x11\x8a\x8d\x8f\xd1\xe4\xec<M\
+\xfd\\\xa3\xc9\xd9\xf9\xbcc\xc6\x18\xf5\xf5\xf5S\xd5\xca2\xc5\xe3\xf1\xe2m\
+\xa3P\xbb\xaega\x12B\xec\xb3\xe5b^\xfe~\x82z^\xbe@WW\x17z{{\x10\x8dF\x0b\xe6\
+\xa3 \xa0\x98\xc2u\xb5\xd4\xd1\xd1Y\x14Rp\x1e\x14S:\x93\x95\x12\x89\xd9|\xab\
+\x88\xc5b\x88F\xa3t\x10\xf2\xcf\x80R!\'\x02\x94\x02)\x03\x00\x12\xfcPW\x94d\
+\xa5\xe4\xa9u\x10\xb2\xcf\xcfi\x0e\xfd\\\xfb\xde\x1b\xa2S\x05\x1c%\xb9\xf8\'\
+\'\xd3\x1f~t\xb1e\xce_u&\x00\x00\x00\x00IEND\xaeB`\x82\x80\x93v\xcf' )
+
+def getIconZoomOutBitmap():
+    return wxBitmapFromImage(getIconZoomOutImage())
+
+def getIconZoomOutImage():
+    stream = cStringIO.StringIO(getIconZoomOutData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIconZoomViewData():
+    return zlib.decompress(
+'x\xda\x01\x95\x03j\xfc\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00\x18\
+\x00\x00\x00\x18\x08\x06\x00\x00\x00\xe0w=\xf8\x00\x00\x00\x04sBIT\x08\x08\
+\x08\x08|\x08d\x88\x00\x00\x03LIDATH\x89\xb5\x95\xcfO\\U\x14\xc7?\xef\xbd\
+\x11K\x19\x86\x99\x07\x8d\xbfJK\xba\xd0h- U4%\x8a?\x96\x03l\xbal\\\xe8\x86?A\
+\xdd\xd8\xe2B ntYjlL41\x99\x94D\xe0-J@\xbb\xa9\x9a\xa2R\x08$\x9a\xa1\x94\xf2\
+C`\x18\x86\xf9\xfd\xe6\xcd\xbc\xf7\x8e\x8b\nf\x98\x96\x19\x1a=\xc9\xcdMn\xee\
+\xf9~\xcf9\xf7|\xcfU\x14U\xe3\x7f\xb5\x7f\x08\xc40\x0cy\x94]Q5\x0e\\\x8a\xaa\
+16:"\xd7\x8e\xd6\x03p\xf5\x9d\x0e\xa5\\P\xefM\xde\x14\x80\xf3\xd9m\xba\xba{\
+\x0e\xbc\xaf\x02\x04\x83\xc1G\xca\xbe"?E\xd50\x0c\xa3|\xaa\x0fX\x15\xf9)\xaa\
+\x86\xb8\x8e(\xaaV\xb64\xfb\xad\x12?\x15\xc00\x8c\xc3bS\xa9\xdf\xa13\x08\xf8\
+\xebd\xff\xd9N<\xf1P_\xcfn$]\xdd=\x15\x01\xf7\x0f\x0ep\xec\x99Fj\xbc\xb5d\
+\x93\t"\xebk|\xf4\xc1\x87\xf2P\xa2]\x1d\x1c\xf4P\xba\xae\xcb\xc7}\x97d&\xbc \
+\xe1\xad\xa8\xdcM\x99\x12Nge\xe8\xfb1\xf9=\x96\x94{\xe9\xac\\\xec\xbb$\xba\
+\xae\x97\xe0\x94\xed\x86]\xf0?V\x96e#g\xc9_\xa6%S\x89\xb4\xfc\x1cK\xcb\xd8\
+\x9f\x8b\xf2\xcd\xc2\xba\x8c\xacm\xcbR*#\x17?\xe9+%)\xf7\x06\x01\x7f\x9d\xdc\
+\x98\xba\xc5\x93\xc7\x1b\xd14\x15\x11\x88\xe6\xf2D,\x9b\x89\x89\t\x9e8\xd3\
+\xca\x8e\x95\xe79]\xe7\x95z/m\'\x1b\x8bJu`\x17\x05\xfcu\xd2?8\x80\xd7\x17\
+\xc0vA\x04\n\xb6\x83\xe3\n\x96+\x9cni\xc1\xd1\xaa\xc8\xd8.\xd3\x91Mf\xd3y\
+\xfa\x07\x07\x8a\x1a\xc1\x03\xf7\x15\xf9\xfe\x8f\xbf\x08\x94\x8e\x8a\xc6S\
+\xa7\xa8\xf1zY\xce\x17\xa8\xb5\x15\x1cW\x98\xda\x8c\x11\xb7m\x96~\x9b&\xd0\
+\xd6N\xd4\xb4p\xdc<\xa9|\x81\xe3\xed\x1dEA\x96\xd5\x81\x1e\xa8\xc7\x16\xb0r9\
+"\x96\xcdZ\xbe\xc0\xa6e\x11\xb7\n4\x9d~\x81d\xc1!a\xe6\xc8d3Ti\n\x9a\xcfWJ\
+\x10\x0c\x069\x9f\xdd\xe6\xab\xb7^cltD\xc4udltD\x00\x12\xf18\xe3\xe3\xd7\x89\
+E\xa2\xfc09\xc9\xce\xd66\xeb\xd3\xb7\xf1\x8b\xcdO\xbfN\x13N\xc51\x1d\x8b\xb4\
+i\x121\x0b8\xc9d)\x81\xa2jJWw\x8f\xb2\x7f\x07X\xba\x13\xe6\xe5\xce\xb7\xd9R\
+\xab\xa8y\xb1\x8d\rO5\xfa\xab\xed\xac\xaa\xd5\xe4\x9b[p\xe2;X\xb1(\'\x03\xc7\
+8\xe1\xadf\xf5\xd6\xcd"\x02\xa5\xdc\x87\x13\xf0\xd7\xc9\xf5\xdbs\xacz\x1eg~#\
+B\xc6v\x89\x9a\x16\t3\x87\xe9X\xa4"\x9bT\x1d\xa9\xe5\x8d\xb3g\xb8\xf0T=g\x1f\
+\xd4E\xe5\xcc\xf8\xfaK^\xaa=B\x93\xcfG\x8dG\xc5q\xf3\x90\x89c\xc5c<{\xa2\x89\
+\xd7[\x9e\xe7\xdd\xa7\x1b\x18\xff\xee\xdbR\xe7J\xc6\xf2\xae\xd8\xee$\xd32\
+\xbc\x1c\x91\xab\xe1\x15\xf9lnA>\x9d[\x94\xe1\xe5\x88,\xa62r\xf9\xca\x90\xe8\
+\xba.\xa1PH\xbcN^\x8a\x94\\)ICC\x83\\\xbe2$\xc6\xcc\xbc\xdcXZ\x11cf~\x0fX\
+\xd7u\xe9\xec|S\x8e\xde\xbb+\xa1P\xe8_E\x1f\xf6\xd3\xaf\xd7\x03\xe2\xban\xd1\
+\xd9n\xcd\x1f\xbb6,\xe7\xbe\xf8\x9c\xd6\xd6V::\xce\xd1\xdb\xdb{x\x82r\x16\
+\xf0\xd7Iss\xcb\x1e\x89\xe7?E\xe7~6\xb3\xb33{\xa3\xe2o\xd6\x83\xdcV\xd5I\xcc\
+y\x00\x00\x00\x00IEND\xaeB`\x823\xf0\xbbU' )
+
+def getIconZoomViewBitmap():
+    return wxBitmapFromImage(getIconZoomViewImage())
+
+def getIconZoomViewImage():
+    stream = cStringIO.StringIO(getIconZoomViewData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getIntVectorData():
+    return zlib.decompress(
+'x\xda\x01B\x02\xbd\xfd\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00 \x00\
+\x00\x00 \x08\x06\x00\x00\x00szz\xf4\x00\x00\x00\x04sBIT\x08\x08\x08\x08|\
+\x08d\x88\x00\x00\x01\xf9IDATX\x85\xed\x96=\x8b\x13Q\x14\x86\x9fx\xd7OV-T\
+\x08\x88 "\xa26\xd6\n\x96b-\xfb\x03\x04\x11D\xb0\xf1\x0f\x08\x11\xc1F\xb0\
+\x17\xc4\xc2\xcajA\x04\x0b;\xabm\xfc\xa8\xc2\x16+$\xcdF\x08\xa61\xce\x0c3s\
+\xee\xb1\xc8]\x99\xdc\x9d\x8fd\x92\xc1b\xf7\x85\xcb\xe4\xdc{\xcey\x9f\x99I\
+\xc2\x81}\xedu\xb5\x00D\xe4r\xceYd\x8c\xe9-\xc3DD\xce\x03G\xfc}c\xcc\xe6\xce\
+g\xcdY\x1b\xcb0w\xda(\xf0\xe0\xc0\x12Mj\xa9\xe5\xae\x9a\xb3\xd7\x94\xa6\xbcV\
+f,\xfa\xb9\x04\xe3v\xd9\xe1\xd4{\xf1\x95$I\xbbl\x01\xcf\x00U\xd5\xbb.~\xeb\
+\xf5\xfcP\xe5U\nP&k\xed5 r\xa6\xa8\xeam\xc0f\xfa\r\xe28>\xd3\x08\xc0x<>\x06t\
+\x81^\x18\x86\'\xe28>\x05lgzY\x07T\xe9U\xf7\t\xbc\x02\xc4Z{\xd3\xc5\xeb^\xaf\
+\x9795\xcb\x01P\xd55\x97\xff\xdc\xc5\xf7\xbd>\xdfG\xa3\xd1\xe1F\x00\xd24=\
+\x07\x8c\x80\xaf\x83\xc1\xe0\xa0\x88\\\x04~gz\x04"r\xb5\x88}!\x80n\xb7k\x80\
+\xcf\xce\xe4J\xbf\xdf_\xc1\xfb\xa7S\xd5\x87%-\x16\x03P\xd5\'\xce\xe4\x91\xdb\
+z\xea\xd5\xbf\xafjQ\x1b\xc0Z{\x03H\x81\x8f^\xbcS\xbb\x1d\xc7\xf1\xe9F\x00\
+\xa2(:\t\xf4\x80a\x92$\xed0\x0c\x8f\x03?2uVUoU\x98\xd7\x07\x00\xde1y\xf4w\\\
+\xfc\xc6\xab{1\x83y=\x00U\xbd\xe7\xce^\xbbx\xcd\xab\xf96\x1c\x0e\x0f5\x02 "\
+\x97\x801\xb0\x15\x04\xc1j\x9a\xa6g\x81_\x99\xfc?\x05\x03\xcd\xe2\x00\xee\
+\xae\xbe\x00\xa9\xb5\xf6z\xa7\xd3i\x01\x9f\xb2\xf9\xaa\xfa`\x0e\xf3\xf9\x00\
+\x98\xbcWe\xf2SCU\x1f{\xb9\xebs\x9a\xef\xf2\xaa\x1aH\xac\x8b\x03\x97s\x94\
+\xe9)*\x02d\x06\xd3U\x0f\xe0\x9fW\xe9@""\x17fh^)cL\xe1\xd9.\x80\xcc\x17\xaa\
+\x91\xa9\xb8\x08Fs\xd6\xde\x98\x8a\xf7\xf5\xdf\xf5\x17\x05d\x7fV\xcao\x0b\
+\x86\x00\x00\x00\x00IEND\xaeB`\x82\x83P\x06\xdd' )
+
+def getIntVectorBitmap():
+    return wxBitmapFromImage(getIntVectorImage())
+
+def getIntVectorImage():
+    stream = cStringIO.StringIO(getIntVectorData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getPlusData():
+    return zlib.decompress(
+"x\xda\xeb\x0c\xf0s\xe7\xe5\x92\xe2b``\xe0\xf5\xf4p\t\x02\xd2\x1c \xcc\xc1\
+\x06$\x8f\xf0\xef\xeb\x06R,\xc5N\x9e!\x1c@P\xc3\x91\xd2\x01\xe4\x1bz\xba8\
+\x86HLMNIIJkh\xfc\xff\xff\xdf\xbft +\xc5\x81\xc9\x87\x87\x85\xc1\x91\xb5\x87\
+\x87\x87\xe7\x7f\xa1\x97\x91\xa1\xb1\xd1\xa5\x83\xbc'\xc2\x12\x98\x19\x8a\
+\x048U?\xdf^|\x00\xa8\x99\xc1\xd3\xd5\xcfe\x9dSB\x13\x00\x9c\x8c \xed" )
+
+def getPlusBitmap():
+    return wxBitmapFromImage(getPlusImage())
+
+def getPlusImage():
+    stream = cStringIO.StringIO(getPlusData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getToolbarCloseData():
+    return zlib.decompress(
+"x\xda\xeb\x0c\xf0s\xe7\xe5\x92\xe2b``\xe0\xf5\xf4p\t\x02\xd2\xac@,\xc1\xc1\
+\x06$\x8d\xd4\xcd\x17\x00)\x96b'\xcf\x10\x0e \xa8\xe1H\xe9\x00\xf2\x83=]\x1c\
+C$\xa6\xbe\xed=\xc8\xdb`\xc0\xc3|\x9e\xf33\xd3\xee\x92\xd6>\xf6\x12&\x8e\xf5\
+\x0b\x98\xe2\xe7\xfdH>\xa9\xfeZ\xa5\x98\xe1\xd1\r\xe7gL\x1bd~\x89\t\xd8,\xda\
+\xf3\xdd\xb0!7\xf6\x91\xe9\xb5\xa8\xf7\x0e\xcfN\xcc\t\xf2\xdar\xcd\xe9\x19\
+\x0f\xe7\xf1\xcc}K\xf6\xbf\x88\xbe\xc8\x19]\x1d\xb6z\x9e-\xdf_\xa0\xf1\x0c\
+\x9e\xae~.\xeb\x9c\x12\x9a\x00\xf8\xf05\x14" )
+
+def getToolbarCloseBitmap():
+    return wxBitmapFromImage(getToolbarCloseImage())
+
+def getToolbarCloseImage():
+    stream = cStringIO.StringIO(getToolbarCloseData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getToolbarOpenData():
+    return zlib.decompress(
+"x\xda\xeb\x0c\xf0s\xe7\xe5\x92\xe2b``\xe0\xf5\xf4p\t\x02\xd2\x12@\xcc\xca\
+\xc1\x06$\xe3\xedu\xf6\x02)\x96b'\xcf\x10\x0e \xa8\xe1H\xe9\x00\xf2}<]\x1cC$\
+\xa6n\rt\xe4jp\x10\x08z\xfe?\xe0\xad\xf9\xea\xca\x83\xebd\x17\xdd\xa8\x9e\
+\xac\xd0\xc3u\xce1\xa81\xab\xa2$\xd8\x91\xe1\x82L\xce\xebG\x9fo\xc4>\xac\xfc\
+\xf2{\x19S\xc8\x82\xad\xcf\xce|Y\xbc\xbf\x82\xe1\xcf\xa6]5u\x0e\xac?\xbe\xb3\
+\x89\xdb0\xc5/\x17eb-\x01\x9a\xcb\xe0\xe9\xea\xe7\xb2\xce)\xa1\t\x00>y2\xf8"\
+ )
+
+def getToolbarOpenBitmap():
+    return wxBitmapFromImage(getToolbarOpenImage())
+
+def getToolbarOpenImage():
+    stream = cStringIO.StringIO(getToolbarOpenData())
+    return wxImageFromStream(stream)
+
+#----------------------------------------------------------------------
+def getXData():
+    return zlib.decompress(
+'x\xda\xeb\x0c\xf0s\xe7\xe5\x92\xe2b``\xe0\xf5\xf4p\t\x02\xd2\x1c \xcc\xc1\
+\x06$\x8f\xf0\xef\xeb\x06R,\xc5N\x9e!\x1c@P\xc3\x91\xd2\x01\xe4;z\xba8\x86HL\
+m\xedw\xe4b0\xe4ar\xff\xfc_}\xfb\xcd\xcbN\xda\x8d\xe7JE\x84\x19u\xa7sT\xad\
+\x9f\xe6=\xcd{o\xb8\xbf\xd0\x01\x86\xf4\x17S\x18&e\xe7\xfc\xb3H=g9[\xf2\xd2\
+\xeb\xee\xd7m\x9d\xfc\x97t\xf4\xe4\x8a,\xce_\x07\x1a\xc6\xe0\xe9\xea\xe7\xb2\
+\xce)\xa1\t\x003\xac*3' )
+
+def getXBitmap():
+    return wxBitmapFromImage(getXImage())
+
+def getXImage():
+    stream = cStringIO.StringIO(getXData())
+    return wxImageFromStream(stream)
+
@@ -0,0 +1,303 @@
+#
+# various editing techniques to improve kNN Classifier performance
+# Copyright (C) 2007, 2008 Colin Baumgarten
+#
+# This program is free software; you can redistribute it and/or
+# modify it under the terms of the GNU General Public License
+# as published by the Free Software Foundation; either version 2
+# of the License, or (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program; if not, write to the Free Software
+# Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+from random import shuffle
+from gamera.args import Args, Int, Real, Check
+from gamera.knn import kNNInteractive
+from gamera.util import ProgressFactory
+from gamera import knncore
+
+
+def _copyClassifier(original, k=0):
+    """Copy a given kNNClassifer by constructing a new one with identical
+parameters.
+
+    *original*
+      The classifier to be copied
+
+    *k*
+      If the copy shall have another k-value as the original, set k accordingly.
+      k = 0 means, that the original's k-value will be used"""
+    glyphs = list(original.get_glyphs())
+    return _reducedClassifier(original, glyphs, range(len(glyphs)), k)
+
+
+def _featureDatabase(classifier):
+    """Returns the glyphs of the classifier together with a *knncore.kNN*
+object holding their feature vectors (in the same order) with the
+classifier's settings, on which the native editing functions operate."""
+    glyphs = list(classifier.get_glyphs())
+    database = knncore.kNN()
+    database.num_features = classifier.num_features
+    database.num_k = classifier.num_k
+    database.distance_type = classifier.distance_type
+    database.set_selections(classifier.get_selections())
+    database.set_weights(classifier.get_weights())
+    database.instantiate_from_images(glyphs,
+                                     getattr(classifier, "normalize", False))
+    return glyphs, database
+
+
+def _reducedClassifier(original, glyphs, indexes, k=0):
+    """Constructs a new classifier with the same parameters as the original
+one (features, distance type, normalization, selections and weights) from
+the glyphs at the given indexes."""
+    if k == 0:
+        k = original.num_k
+    result = kNNInteractive([glyphs[i] for i in indexes], original.features,
+                            original._perform_splits, k)
+    result.distance_type = original.distance_type
+    result.normalize = getattr(original, "normalize", False)
+    result.set_selections(original.get_selections())
+    result.set_weights(original.get_weights())
+    return result
+
+
+class AlgoRegistry(object):
+    """Registry containing a list of all available editing algorithms. Besides
+the callable itself, the registry also stores its docstring, a displayname and
+type-information about any additionally required arguments. This information
+will be used by the gui to show a dialog to execute any of the available
+algorithms on a classifier.
+
+An editing algorithm is any callable object, that takes at least one parameter
+-  a *gamera.knn.kNNInteractive* classifier - and returns a new edited
+*kNNInteractive* classifier.
+
+To add your own algorithm, use one of the *register()* methods or alternatively,
+let your callable inherit from *EditingAlgorithm* to register your algorithm,"""
+    algorithms = []
+
+    def registerData(algoData):
+        """Register a new editing Algorithm using metadata from an
+*AlgoData* object"""
+        AlgoRegistry.algorithms.append(algoData)
+    registerData = staticmethod(registerData)
+
+    def register(name, callable, args=Args(), doc=""):
+        """Register a new editing Algorithm: The parameters are the same as in
+*AlgoData.__init__*, so see its doc for an explanation of the parameters."""
+        AlgoRegistry.registerData(AlgoData(name, callable, args, doc))
+    register = staticmethod(register)
+
+
+class AlgoData(object):
+    """Class holding all metadata about an editing algorithm, that is required by
+*AlgoRegistry*
+
+*name*
+    Name of the algorithm
+
+*callable*
+    The callable object implementing the algorithm. Its first parameter has to
+    be a *kNNInteractive* Classifier and it has to return a new *kNNInteractive*
+    classifier. If the algorithm requires any additional parameters, they have
+    to be specified in the *args* parameter
+
+*args*
+    A *gamera.args.Args* object specifying any additional parameters required by
+    the algorithm
+
+*doc*
+    A docstring in reStructured Text format, describing the algorithm and its
+    parameters"""
+    def __init__(self, name, callable, args=Args(), doc=""):
+        self.name = name
+        self.callable = callable
+        self.args = args
+        self.doc = doc
+
+
+class EditingAlgorithm(object):
+    """Convenience class to automatically register editing algorithms with the
+*AlgoRegistry*. If you implement your algorithm as a callable class, you can
+just inherit from this class to let it automatically be registered. Just add
+two properties to the class:
+
+*name*
+    The name of your algorithm
+*args*
+    Type info about any additional required arguments (a *gamera.args.Args* object)
+"""
+    def __init__(self):
+        AlgoRegistry.register(self.name, self, self.args, self.__doc__)
+
+
+class EditMnn(EditingAlgorithm):
+    """**edit_mnn** (kNNInteractive *classifier*, int *k* = 0, bool *protectRare*, int *rareThreshold*)
+
+Wilson's *Modified Nearest Neighbour* (MNN, aka *Leave-one-out-editing*).
+The algorithm removes 'bad' glyphs from the classifier, i.e. glyphs that
+are outliers from their class in featurespace, usually because they have been
+manually misclassified or are not representative for their class
+
+    *classifier*
+        The classifier from which to create an edited copy
+    *internalK*
+        The k value used internally by the editing algorithm. If 0 is given for
+        this parameter, the original classifier's k is used (recommended).
+    *protect rare classes*
+        The algorithm tends to completely delete the items of rare classes,
+        removing this whole class from the classifier. If this is not
+        desired these rare classes can be explicitly protected from deletion.
+        Note that enabling this option causes additional computing effort
+    *rare class threshold*
+        In case *protect rare classes* is enabled, classes with less than this
+        number of elements are considered to be rare
+
+Reference: D. Wilson: 'Asymptotic Properties of NN Rules Using Edited Data'.
+*IEEE Transactions on Systems, Man, and Cybernetics*, 2(3):408-421, 1972
+"""
+    name = "Wilson's Modified Nearest Neighbour (MNN)"
+    args = Args([Int("Internal k", default=0),
+                 Check("Protect rare classes", default=True),
+                 Int("Rare class threshold", default=3)])
+
+    def __call__(self, classifier, k=0, protectRare=True,
+                 rareThreshold=3):
+        # special case of empty classifier
+        if (not classifier.get_glyphs()):
+            return _copyClassifier(classifier, k)
+
+        # classify each glyph by its k nearest neighbors among the others
+        # (in knncore)
+        glyphs, database = _featureDatabase(classifier)
+        if not protectRare:
+            rareThreshold = 0
+        progress = ProgressFactory("Generating edited MNN classifier...",
+                                   len(glyphs))
+        try:
+            kept = database.edit_wilson(k, rareThreshold, progress.step)
+        finally:
+            progress.kill()
+        return _reducedClassifier(classifier, glyphs, kept, k)
+
+edit_mnn = EditMnn()
+
+
+class EditCnn(EditingAlgorithm):
+    """**edit_cnn** (kNNInteractive *classifier*, int *k* = 0, bool *randomize*)
+
+Hart's *Condensed Nearest Neighbour (CNN)* editing.
+This alorithm is specialized in removing superfluous glyphs - glyphs that do not
+influence the recognition rate - from the classifier to improve its
+classification speed. Typically glyphs far from the classifiers decision
+boundaries are removed.
+
+    *classifier*
+        The classifier from which to create an edited copy
+    *internalK*
+        The k value used internally by the editing algorithm. 0 means, use the
+        same value as the given classifier (recommended)
+    *randomize*
+        Because the processing order of the glyphs in the classifier impacts the
+        result of this algorithm, the order will be randomized. If reproducable
+        results are required, turn this option off.
+
+Reference: P.E. Hart: 'The Condensed Nearest Neighbor rule'. *IEEE Transactions on Information Theory*, 14(3):515-516, 1968
+"""
+    name = "Hart's Condensed Nearest Neighbour (CNN)"
+    args = Args([Int("Internal k", default=0),
+                 Check("Randomize", default=True)])
+
+    def __call__(self, classifier, k=0, randomize=True):
+        # special case of empty classifier
+        if (not classifier.get_glyphs()):
+            return _copyClassifier(classifier)
+
+        glyphs, database = _featureDatabase(classifier)
+        order = range(len(glyphs))
+        if randomize:
+            shuffle(order)
+        # the progress counts the glyphs moved into the condensed set
+        progress = ProgressFactory("Generating edited CNN classifier...",
+                                   len(glyphs))
+        try:
+            kept = database.condense_hart(k, order, progress.step)
+        finally:
+            progress.kill()
+        return _reducedClassifier(classifier, glyphs, kept, 1)
+
+edit_cnn = EditCnn()
+
+
+class EditMnnCnn(EditingAlgorithm):
+    """**edit_mnn_cnn** (kNNInteractive *classifier*, int *k* = 0, bool *protectRare*, int *rareThreshold*, bool *randomize*)
+
+Combined execution of Wilson's Modified Nearest Neighbour and Hart's
+Condensed Nearest Neighbour. Combining the algorithms in this order is
+recommended, because first bad samples are removed to improve the classifiers
+accuracy, and then the remaining samples are condensed to speed up the classifier
+
+For documentation of the parameters see the independent algorithms"""
+    name = "MNN, then CNN"
+    args = Args([Int("Internal k", default=0),
+                 Check("Protect rare classes", default=True),
+                 Int("Rare class threshold", default=3),
+                 Check("Randomize", default=True)])
+
+    def __call__(self, classifier, k=0, protectRare=True,
+                 rareThreshold=3, randomize=True):
+        return edit_cnn(edit_mnn(classifier, k, protectRare, rareThreshold),
+                   randomize)
+
+edit_mnn_cnn = EditMnnCnn()
+
+
+class EditMedoids(EditingAlgorithm):
+    """**edit_medoids** (kNNInteractive *classifier*, float *ratio* = 0.1)
+
+Prototype reduction by clustering. The glyphs of each class are divided
+into *ratio* times as many clusters as the class has glyphs (at least
+one per class), and each cluster is represented by its medoid, i.e. the
+glyph with the smallest sum of distances to the other glyphs in the
+cluster. Unlike CNN, the size of the result can be chosen in advance,
+and the kept glyphs are typical members of their class rather than
+glyphs near the decision boundaries, so that this works well after MNN.
+
+    *classifier*
+        The classifier from which to create an edited copy
+    *ratio*
+        The fraction of the glyphs of each class that is kept
+
+The clusters are computed with the alternating k-medoids algorithm,
+starting from a farthest first traversal, which makes the result
+deterministic.
+
+Reference: L. Kaufman, P.J. Rousseeuw: *Finding Groups in Data: An
+Introduction to Cluster Analysis*. Wiley, 1990
+"""
+    name = "Medoid prototypes per class"
+    args = Args([Real("Ratio", range=(0.0, 1.0), default=0.1)])
+
+    def __call__(self, classifier, ratio=0.1):
+        # special case of empty classifier
+        if (not classifier.get_glyphs()):
+            return _copyClassifier(classifier)
+
+        glyphs, database = _featureDatabase(classifier)
+        classes = set([glyph.get_main_id() for glyph in glyphs])
+        progress = ProgressFactory("Generating medoid prototypes...",
+                                   len(classes))
+        try:
+            kept = database.reduce_medoids(ratio, progress.step)
+        finally:
+            progress.kill()
+        return _reducedClassifier(classifier, glyphs, kept)
+
+edit_medoids = EditMedoids()
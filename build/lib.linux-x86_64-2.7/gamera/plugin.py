@@ -0,0 +1,349 @@
+# -*- mode: python; indent-tabs-mode: nil; tab-width: 3 -*-
+# vim: set tabstop=3 shiftwidth=3 expandtab:
+#
+# Copyright (C) 2001-2009 Ichiro Fujinaga, Michael Droettboom,
+#                         Karl MacMillan, and Christoph Dalitz
+#
+# This program is free software; you can redistribute it and/or
+# modify it under the terms of the GNU General Public License
+# as published by the Free Software Foundation; either version 2
+# of the License, or (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program; if not, write to the Free Software
+# Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+#
+
+import new
+import os
+import imp
+import inspect
+import sys
+import copy
+import types
+
+# These wildcard imports are necessary for backwards compatibility.
+from gamera.args import *
+from gamera.enums import *
+
+from gamera import util
+from gamera.backport import sets
+
+
+plugin_methods = {}
+
+
+class PluginModule:
+    category = None
+    cpp_namespaces = []
+    cpp_sources = []
+    cpp_headers = []
+    cpp_defines = []
+    cpp_include_dirs = []
+    extra_libraries = []
+    library_dirs = []
+    define_macros = []
+    extra_compile_args = []
+    extra_link_args = []
+    extra_objects = []
+    functions = []
+    pure_python = False
+    version = "1.0"
+    author = None
+    url = None
+    stable = True
+
+    def __init__(self):
+        for function in self.functions:
+            function.module = self.__class__
+        core = __import__("gamera.core")
+        if core is None:
+            return
+        for function in self.functions:
+            if not isinstance(function, types.ClassType):
+                function = function.__class__
+            function.register()
+
+
+class Builtin(PluginModule):
+    author = "Michael Droettboom and Karl MacMillan"
+    url = "http://dkc.jhu.edu/"
+
+
+class PluginFunction:
+    return_type = None
+    self_type = ImageType(ALL)
+    args = Args([])
+    image_types_must_match = 0
+    testable = 0
+    feature_function = False
+    doc_examples = []
+    category = None
+    pure_python = False
+    progress_bar = ""
+    author = None
+    add_to_image = True
+    release_gil = False
+    batch = False
+
+    def get_formatted_argument_list(cls):
+        return "**%s** (%s)" % (cls.__name__, ', '.join(
+           [x.rest_repr(True) for x in cls.args.list]))
+    get_formatted_argument_list = classmethod(get_formatted_argument_list)
+
+    def escape_docstring(cls):
+        if cls.__doc__ is None:
+            doc = ''
+        doc = util.dedent(cls.__doc__)
+        doc = doc.replace("\n", r"\n").replace('"', r'\"')
+        return r'"%s\n\n%s"' % (cls.get_formatted_argument_list(), doc)
+    escape_docstring = classmethod(escape_docstring)
+
+    def register(cls):
+        # add_to_image = add_to_image and cls.add_to_image
+        if cls.return_type != None:
+            if cls.return_type.name == None:
+                cls.return_type = copy.copy(cls.return_type)
+                cls.return_type.name = cls.__name__
+        if not hasattr(cls, "__call__"):
+            # This loads the actual C++ function if it is not directly
+            # linked in the Python PluginFunction class
+            module = cls.get_cpp_module()
+            if module == None:
+                return
+            func = getattr(module, cls.__name__)
+        elif cls.__call__ is None:
+            func = None
+        else:
+            func = cls.__call__
+            if type(cls.__call__) == new.instancemethod:
+                func = cls.__call__.im_func
+            func.func_doc = ("%s\n\n%s" %
+                             (cls.get_formatted_argument_list(),
+                              util.dedent(cls.__doc__)))
+        cls.__call__ = staticmethod(func)
+
+        if cls.category == None:
+            category = cls.module.category
+        else:
+            category = cls.category
+        if not category is None and not func is None:
+            image_type = isinstance(cls.self_type, ImageType)
+            if image_type:
+                pixel_types = cls.self_type.pixel_types
+            else:
+                pixel_types = [NONIMAGE]
+            for pixel_type in pixel_types:
+                if not plugin_methods.has_key(pixel_type):
+                    plugin_methods[pixel_type] = {}
+                start = plugin_methods[pixel_type]
+                for subcategory in category.split('/'):
+                    if not start.has_key(subcategory):
+                        start[subcategory] = {}
+                    start = start[subcategory]
+                start[cls.__name__] = cls
+
+        if not func is None and not cls.self_type is None:
+            cls.self_type.register(cls, func)
+
+        # the batch variant is a function of the plugin's Python module
+        if cls.batch and not cls.pure_python:
+            module = cls.get_cpp_module()
+            if module != None:
+                setattr(sys.modules[cls.__module__], cls.__name__ + "_batch",
+                        getattr(module, cls.__name__ + "_batch"))
+    register = classmethod(register)
+
+    def get_cpp_module(cls):
+        # the C++ module with the generated wrappers of the plugin module
+        parts = cls.__module__.split('.')
+        file = inspect.getfile(cls)
+        cpp_module_name = '_' + parts[-1]
+        directory = os.path.split(file)[0]
+        sys.path.append(directory)
+        found = imp.find_module(cpp_module_name)
+        del sys.path[-1]
+        if found:
+            return imp.load_module(cpp_module_name, *found)
+        return None
+    get_cpp_module = classmethod(get_cpp_module)
+
+
+def PluginFactory(name, category=None,
+                  return_type=None,
+                  self_type=ImageType(ALL),
+                  args=None):
+    from gamera import core
+    cls = new.classobj(name, (PluginFunction,), {})
+    if not category is None:
+        cls.category = category
+    cls.return_type = return_type
+    cls.self_type = self_type
+    if args is None:
+        cls.args = Args([])
+    else:
+        cls.args = args
+    func = getattr(core.ImageBase, name)
+    cls.__call__ = func
+    cls.__doc__ = util.dedent(func.__doc__)
+    cls.module = Builtin
+    return cls
+
+
+def get_config_options(command):
+    return os.popen(command).read()
+
+
+def methods_flat_category(category, pixel_type=None):
+    if pixel_type == None:
+        methods = sets.Set()
+        for pixel_type in ALL + [NONIMAGE]:
+            # We have to cast the lists to sets here to make Python 2.3.0 happy.
+            methods.update(sets.Set(methods_flat_category(category, pixel_type)))
+        return list(methods)
+    elif plugin_methods.has_key(pixel_type):
+        methods = plugin_methods[pixel_type]
+        if methods.has_key(category):
+            return _methods_flatten(methods[category])
+    return []
+
+
+def _methods_flatten(mat):
+    list = []
+    for key, val in mat.items():
+        if type(val) == types.DictType:
+            list.extend(_methods_flatten(val))
+        else:
+            list.append((key, val))
+    return list
+
+
+######################################################################
+# Execution statistics of the plugin wrappers (see plugin_stats.hpp)
+
+def _stats_modules():
+    # the loaded C++ plugin modules; a module may be in sys.modules
+    # under several names
+    modules = {}
+    for module in sys.modules.values():
+        if module is not None and hasattr(module, "_plugin_stats"):
+            modules[os.path.realpath(getattr(module, "__file__", ""))] = module
+    return modules.values()
+
+
+def _stats_pixel_type_name(pixel_type):
+    if pixel_type == NONIMAGE:
+        return None
+    return util.get_pixel_type_name(pixel_type)
+
+
+def enable_stats(enabled=True, trace=False):
+    """Switches the execution statistics of the C++ plugins on or off.
+
+    While switched on, each call of a plugin wrapper records the time
+    it took, the number of pixels of its image arguments and the bytes
+    of newly allocated image data or vectors it returned (see stats_).
+    With *trace*, each call is also recorded as an event for the
+    timeline written by save_stats_. The statistics cost about a
+    microsecond per call, so they are switched off by default."""
+    from gamera import gameracore
+    flag = 0
+    if enabled:
+        flag = 1
+        if trace:
+            flag |= 2
+    gameracore._set_plugin_stats(flag)
+
+
+def reset_stats():
+    """Clears the execution statistics and the trace of all plugins."""
+    for module in _stats_modules():
+        module._reset_plugin_stats()
+
+
+def stats():
+    """Returns the execution statistics recorded since enable_stats_ as
+    a dictionary. The keys are tuples (*plugin name*, *pixel type name*),
+    where the pixel type is None for plugins without an image as self
+    argument, and batch variants are listed under their own name. The
+    values are dictionaries with the entries
+
+    *calls*
+      the number of calls
+    *wall_time*, *cpu_time*
+      the wall clock time and CPU time spent in the C++ functions in
+      seconds; the CPU time is that of the calling thread, for batch
+      variants that of the process (of all threads), because their
+      images may be processed on several threads
+    *pixels*
+      the number of pixels of the image arguments
+    *bytes*
+      the size of the image data and vectors returned by the plugin
+      (image data shared with an argument does not count)"""
+    result = {}
+    for module in _stats_modules():
+        for name, pixel_type, calls, wall_time, cpu_time, pixels, bytes in \
+                module._plugin_stats(0):
+            key = (name, _stats_pixel_type_name(pixel_type))
+            if not result.has_key(key):
+                result[key] = {"calls": 0, "wall_time": 0.0, "cpu_time": 0.0,
+                               "pixels": 0, "bytes": 0}
+            entry = result[key]
+            entry["calls"] += calls
+            entry["wall_time"] += wall_time
+            entry["cpu_time"] += cpu_time
+            entry["pixels"] += pixels
+            entry["bytes"] += bytes
+    return result
+
+
+def stats_trace():
+    """Returns the calls recorded with ``enable_stats(trace=True)``
+    as a list of tuples (*plugin name*, *pixel type name*, *start*,
+    *duration*, *thread*), sorted by start time. *start* is the wall
+    clock time in seconds since the epoch. At most one million calls
+    are recorded per plugin module."""
+    events = []
+    for module in _stats_modules():
+        for name, pixel_type, start, duration, thread in module._plugin_stats(1):
+            events.append((name, _stats_pixel_type_name(pixel_type),
+                           start, duration, thread))
+    events.sort(key=lambda x: x[2])
+    return events
+
+
+def save_stats(filename, format="json"):
+    """Writes the execution statistics to a file.
+
+    *format*
+      ``"json"`` writes the statistics returned by stats_ as a JSON list
+      with one object per plugin and pixel type. ``"chrome"`` writes the
+      trace returned by stats_trace_ in the Trace Event Format, which
+      can be viewed in Chrome's ``about:tracing`` page."""
+    import json
+    if format == "json":
+        data = []
+        for (name, pixel_type), entry in sorted(stats().items()):
+            record = {"plugin": name, "pixel_type": pixel_type}
+            record.update(entry)
+            data.append(record)
+    elif format == "chrome":
+        pid = os.getpid()
+        data = {"traceEvents":
+                [{"name": name, "cat": pixel_type or "", "ph": "X",
+                  "ts": start * 1e6, "dur": duration * 1e6,
+                  "pid": pid, "tid": thread}
+                 for name, pixel_type, start, duration, thread in stats_trace()],
+                "displayTimeUnit": "ms"}
+    else:
+        raise ValueError("Unknown format '%s' for the execution statistics" % format)
+    fd = open(filename, "w")
+    try:
+        json.dump(data, fd, indent=1)
+    finally:
+        fd.close()
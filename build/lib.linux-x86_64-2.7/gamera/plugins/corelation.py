@@ -0,0 +1,214 @@
+#
+# Copyright (C) 2001-2005 Ichiro Fujinaga, Michael Droettboom, and Karl MacMillan
+#
+# This program is free software; you can redistribute it and/or
+# modify it under the terms of the GNU General Public License
+# as published by the Free Software Foundation; either version 2
+# of the License, or (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program; if not, write to the Free Software
+# Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+#
+
+"""Various functions related to corelation (template matching)."""
+
+from gamera.plugin import PluginFunction, PluginModule
+from gamera.args import ImageType, Args, Float, Point, Int, Check, Class
+from gamera.enums import GREYSCALE, ONEBIT, FLOAT
+
+import _corelation
+
+
+class corelation_weighted(PluginFunction):
+    """
+    Returns a floating-point value for how well an image is corelated
+    to another image placed at a given origin (*x*, *y*).  Uses the
+    weighted reward/penalty method.
+
+    *template*
+      The template image.
+
+    *offset*
+      The displacement of the template on the image.
+
+    *bb*, *bw*, *wb*, *ww*
+      The rewards and penalties for different combinations of pixels.
+      The first letter in the arugment name indicates the color of the
+      template; the second letter indicates the color of the source
+      image.  For instance, the value of *bw* will be applied to the
+      result when the template pixel is black and the source image
+      pixel is white.
+
+    +--------+--------+------------------+
+    | Image  |        | Template         |
+    |        +--------+---------+--------+
+    |        |        | black   | white  |
+    |        +--------+---------+--------+
+    |        | black  | *bb*    | *wb*   |
+    |        +--------+---------+--------+
+    |        | white  | *bw*    | *ww*   |
+    +--------+--------+---------+--------+
+    """
+    return_type = Float("corelation")
+    self_type = ImageType([ONEBIT, GREYSCALE])
+    args = Args([ImageType([ONEBIT], "template"),
+                 Point("offset"),
+                 Float("bb"), Float("bw"), Float("wb"), Float("ww")])
+
+
+class corelation_sum(PluginFunction):
+    """
+    Returns a floating-point value for how well an image is corelated
+    to another image placed at a given origin (*x*, *y*).  Uses the
+    sum of absolute distance method.  A higher value indicates more
+    corelation.
+
+    *template*
+      The template image.
+
+    *offset*
+      The displacement of the template on the image.
+    """
+    return_type = Float("corelation")
+    self_type = ImageType([ONEBIT, GREYSCALE])
+    args = Args([ImageType([ONEBIT], "template"), Point("offset")])
+    progress_bar = "Correlating"
+
+
+class corelation_sum_squares(PluginFunction):
+    """
+    Returns a floating-point value for how well an image is corelated
+    to another image placed at a given origin (*x*, *y*).  Uses the
+    sum of squares method.  A higher value indicates more corelation.
+
+    *template*
+      The template image.
+    *offset*
+      The displacement of the template on the image.
+    """
+    return_type = Float("corelation")
+    self_type = ImageType([ONEBIT, GREYSCALE])
+    args = Args([ImageType([ONEBIT], "template"), Point("offset")])
+    progress_bar = "Correlating"
+
+
+class corelation_weighted_map(PluginFunction):
+    """
+    Computes corelation_weighted_ for all offsets at which *template*
+    fits completely into the image, which is much faster than calling
+    corelation_weighted_ for each offset.
+
+    The result is a FLOAT image with the same offset as the image, in
+    which the pixel at position *(x, y)* holds the value of
+    ``corelation_weighted(template, (x, y), bb, bw, wb, ww)``. It is
+    ``template.ncols - 1`` columns and ``template.nrows - 1`` rows
+    smaller than the image. The best matching positions can be
+    extracted with corelation_best_offsets_.
+
+    The pixels are compared 64 at a time on bit packed rows, and the
+    rows of the result are computed in parallel when Gamera has been
+    compiled with OpenMP support.
+
+    .. _corelation_weighted: #corelation-weighted
+    .. _corelation_best_offsets: #corelation-best-offsets
+    """
+    return_type = ImageType([FLOAT], "corelation_map")
+    self_type = ImageType([ONEBIT, GREYSCALE])
+    args = Args([ImageType([ONEBIT], "template"),
+                 Float("bb"), Float("bw"), Float("wb"), Float("ww")])
+
+
+class corelation_sum_map(PluginFunction):
+    """
+    Computes corelation_sum_ for all offsets at which *template* fits
+    completely into the image. See corelation_weighted_map_ for the
+    layout of the resulting FLOAT image.
+
+    For onebit images, the number of differing pixels is counted with
+    bit packed rows. For greyscale images, the sum of the image pixels
+    under the black template pixels is computed for all offsets at once
+    with an FFT based cross corelation on tiles, which makes the runtime
+    nearly independent of the template size.
+
+    .. _corelation_sum: #corelation-sum
+    .. _corelation_weighted_map: #corelation-weighted-map
+    """
+    return_type = ImageType([FLOAT], "corelation_map")
+    self_type = ImageType([ONEBIT, GREYSCALE])
+    args = Args([ImageType([ONEBIT], "template")])
+
+
+class corelation_sum_squares_map(PluginFunction):
+    """
+    Computes corelation_sum_squares_ for all offsets at which *template*
+    fits completely into the image. See corelation_sum_map_ for details.
+
+    .. _corelation_sum_squares: #corelation-sum-squares
+    .. _corelation_sum_map: #corelation-sum-map
+    """
+    return_type = ImageType([FLOAT], "corelation_map")
+    self_type = ImageType([ONEBIT, GREYSCALE])
+    args = Args([ImageType([ONEBIT], "template")])
+
+
+class corelation_best_offsets(PluginFunction):
+    """
+    Returns the *n* best positions in a corelation map as computed by
+    corelation_weighted_map_, corelation_sum_map_, or
+    corelation_sum_squares_map_. The result is a list of tuples
+    *(offset, value)*, where *offset* is the position of the template
+    in the coordinate system of the original image. The best value
+    comes first.
+
+    *n*
+      The maximum number of positions returned.
+
+    *largest*
+      When ``True`` (default), large values are considered best, which is
+      appropriate for corelation_weighted_map_ with rewards for matching
+      pixels. For the distances computed by corelation_sum_map_ and
+      corelation_sum_squares_map_, set it to ``False``.
+
+    *min_distance*
+      When greater than zero, only local extrema of the map are considered,
+      and a position is skipped when its horizontal and vertical distance
+      to an already selected position are both less than *min_distance*.
+      Setting it to the template size avoids multiple hits on the same
+      symbol.
+
+    .. code:: Python
+
+      scores = page.corelation_weighted_map(clef, 1.0, -1.0, -1.0, 0.0)
+      for offset, score in scores.corelation_best_offsets(20, True, clef.ncols):
+          print offset, score
+
+    .. _corelation_weighted_map: #corelation-weighted-map
+    .. _corelation_sum_map: #corelation-sum-map
+    .. _corelation_sum_squares_map: #corelation-sum-squares-map
+    """
+    return_type = Class("offsets")
+    self_type = ImageType([FLOAT])
+    args = Args([Int("n", default=10), Check("largest", default=True),
+                 Int("min_distance", default=0)])
+
+    def __call__(self, n=10, largest=True, min_distance=0):
+        return _corelation.corelation_best_offsets(self, n, largest, min_distance)
+    __call__ = staticmethod(__call__)
+
+
+class CorelationModule(PluginModule):
+    cpp_headers = ["corelation.hpp"]
+    category = "Corelation"
+    functions = [corelation_weighted, corelation_sum,
+                 corelation_sum_squares, corelation_weighted_map,
+                 corelation_sum_map, corelation_sum_squares_map,
+                 corelation_best_offsets]
+    author = "Michael Droettboom"
+    url = "http://gamera.sourceforge.net/"
+module = CorelationModule()
@@ -0,0 +1,2 @@
+# automatically generated configuration at compile time
+has_openmp = False
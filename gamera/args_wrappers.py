@@ -156,7 +156,10 @@ class ImageType(Arg):
             choices = self._get_choices_for_pixel_type(limit_choices)
         else:
             choices = self._get_choices()
-        result = "switch(get_image_combination(%(pysymbol)s)) {\n" % self
+        if function.release_gil:
+            result = "switch(%(symbol)s_combination) {\n" % self
+        else:
+            result = "switch(get_image_combination(%(pysymbol)s)) {\n" % self
         for choice, pixel_type in choices:
             result += "case %s:\n" % choice.upper()
             new_output_args = output_args + ["*((%s*)%s)" % (choice, self.symbol)]
@@ -169,6 +172,14 @@ class ImageType(Arg):
                     result += args[0].call(function, args[1:], new_output_args, limit_choices)
             result += "break;\n"
         result += "default:\n"
+        if function.release_gil:
+            result += "Py_BLOCK_THREADS\n"
+        result += self.type_error(function.__name__, self.name, choices, self.pysymbol)
+        result += "return 0;\n"
+        result += "}\n"
+        return result
+
+    def type_error(self, function_name, arg_name, choices, pyobject):
         acceptable_types = [util.get_pixel_type_name(y).upper() for x, y in choices]
         if len(acceptable_types) >= 2:
             phrase = "values are"
@@ -176,13 +187,11 @@ class ImageType(Arg):
         else:
             phrase = "value is"
         acceptable_types = ", ".join(acceptable_types)
-        result += ('PyErr_Format(PyExc_TypeError,'
-                   '"The \'%s\' argument of \'%s\' can not have pixel type \'%%s\'. '
-                   'Acceptable %s %s."'
-                   ', get_pixel_type_name(%s));\nreturn 0;\n' %
-                   (self.name, function.__name__, phrase, acceptable_types, self.pysymbol))
-        result += "}\n"
-        return result
+        return ('PyErr_Format(PyExc_TypeError,'
+                '"The \'%s\' argument of \'%s\' can not have pixel type \'%%s\'. '
+                'Acceptable %s %s."'
+                ', get_pixel_type_name(%s));\n' %
+                (arg_name, function_name, phrase, acceptable_types, pyobject))
 
     def _get_choices(self):
         result = []
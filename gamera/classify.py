@@ -169,13 +169,19 @@ class _Classifier:
         G.add_nodes(glyphs)
         progress = util.ProgressFactory("Pre-grouping glyphs...", len(glyphs))
         try:
-            for i in range(len(glyphs)):
-                gi = glyphs[i]
-                for j in range(i + 1, len(glyphs)):
-                    gj = glyphs[j]
-                    if function(gi, gj):
-                        G.add_edge(gi, gj)
-                progress.step()
+            if hasattr(function, "grouping_pairs"):
+                # candidate pairs from a spatial index instead of all pairs
+                for i, j in function.grouping_pairs(glyphs):
+                    G.add_edge(glyphs[i], glyphs[j])
+                progress.update(len(glyphs), len(glyphs))
+            else:
+                for i in range(len(glyphs)):
+                    gi = glyphs[i]
+                    for j in range(i + 1, len(glyphs)):
+                        gj = glyphs[j]
+                        if function(gi, gj):
+                            G.add_edge(gi, gj)
+                    progress.step()
         finally:
             progress.kill()
         return G
@@ -198,23 +204,72 @@ class _Classifier:
             return classification[0]
         raise ValueError("Something is wrong here...  Either you don't have classifier data or there is an internal error in the grouping algorithm.")
 
+    def _evaluate_subgroups(self, subgroups, evaluate_function):
+        # Returns the scores of all subgroups and a dictionary
+        # {index: (union, classification)} of the unions classified
+        # in the process
+        import image_utilities
+        if evaluate_function != self._evaluate_subgroup:
+            return [evaluate_function(subgroup) for subgroup in subgroups], {}
+        scores = [0.0] * len(subgroups)
+        indices = []
+        unions = []
+        for i, subgroup in enumerate(subgroups):
+            if len(subgroup) > 1:
+                indices.append(i)
+                unions.append(image_utilities.union_images(subgroup))
+            else:
+                scores[i] = self._evaluate_subgroup(subgroup)
+        guesses = {}
+        for i, union, (classification, confidence) in \
+                zip(indices, unions, self.guess_glyph_list_automatic(unions)):
+            guesses[i] = (union, classification)
+            classification_name = classification[0][1]
+            if not (classification_name.startswith("_split") or
+                    classification_name.startswith("skip")):
+                scores[i] = classification[0][0]
+        return scores, guesses
+
     def _find_group_unions(self, G, evaluate_function, max_parts_per_group=5,
                            max_graph_size=16, criterion="min"):
         import image_utilities
-        progress = util.ProgressFactory("Grouping glyphs...", G.nsubgraphs)
+        # Collect the candidate groups of all subgraphs first, so that
+        # the unions can be classified in a single batch. The subgraphs
+        # are disjoint, so no group occurs twice. optimize_partitions
+        # takes the scores of a subgraph by position, in the order of
+        # partition_parts with the same arguments.
+        subgraphs = []
+        subgroups = []
+        subgroup_index = {}
+        for root in G.get_subgraph_roots():
+            if G.size_of_subgraph(root) > max_graph_size:
+                continue
+            start = len(subgroups)
+            for subgroup in G.partition_parts(root, max_parts_per_group, max_graph_size):
+                key = tuple(sorted([id(glyph) for glyph in subgroup]))
+                subgroup_index[key] = len(subgroups)
+                subgroups.append(subgroup)
+            subgraphs.append((root, start, len(subgroups)))
+        scores, guesses = self._evaluate_subgroups(subgroups, evaluate_function)
+
+        progress = util.ProgressFactory("Grouping glyphs...", len(subgraphs))
         try:
             found_unions = []
-            for root in G.get_subgraph_roots():
-                if G.size_of_subgraph(root) > max_graph_size:
-                    continue
+            for root, start, end in subgraphs:
                 best_grouping = G.optimize_partitions(
-                   root, evaluate_function, max_parts_per_group, max_graph_size, criterion)
+                   root, scores[start:end],
+                   max_parts_per_group, max_graph_size, criterion)
                 if not best_grouping is None:
                     for subgroup in best_grouping:
                         if len(subgroup) > 1:
-                            union = image_utilities.union_images(subgroup)
+                            key = tuple(sorted([id(glyph) for glyph in subgroup]))
+                            i = subgroup_index.get(key)
+                            if guesses.has_key(i):
+                                union, classification = guesses[i]
+                            else:
+                                union = image_utilities.union_images(subgroup)
+                                classification, confidence = self.guess_glyph_automatic(union)
                             found_unions.append(union)
-                            classification, confidence = self.guess_glyph_automatic(union)
                             union.classify_heuristic(classification)
                             part_name = "_group._part." + classification[0][1]
                             for glyph in subgroup:
@@ -594,6 +649,19 @@ class NonInteractiveClassifier(_Classifier):
         self.generate_features(glyph)
         return self.classify(glyph)
 
+    def guess_glyph_list_automatic(self, glyphs):
+        """[(id_name, confidencemap), ...] **guess_glyph_list_automatic** (ImageList *glyphs*)
+
+  Like guess_glyph_automatic_, but classifies a whole list of glyphs
+  at once. When the classifier supports it, the glyphs are classified
+  in a single call that does not hold the Python interpreter lock.
+  """
+        if not hasattr(self, "classify_list"):
+            return [self.guess_glyph_automatic(glyph) for glyph in glyphs]
+        for glyph in glyphs:
+            self.generate_features(glyph)
+        return self.classify_list(glyphs)
+
     def _classify_automatic_impl(self, glyph):
         return self.classify(glyph)
 
@@ -692,6 +760,9 @@ class InteractiveClassifier(_Classifier):
         else:
             return ([(0.0, 'unknown')], {})
 
+    def guess_glyph_list_automatic(self, glyphs):
+        return [self.guess_glyph_automatic(glyph) for glyph in glyphs]
+
     ########################################
     # MANUAL CLASSIFICATION
     def classify_glyph_manual(self, glyph, id):
@@ -856,6 +927,9 @@ class BasicGroupingFunction:
     def __call__(self, a, b):
         return Fudge(a, self._threshold).intersects(b)
 
+    def grouping_pairs(self, glyphs):
+        return _candidate_pairs(glyphs, self._threshold, self)
+
 
 class ShapedGroupingFunction:
     def __init__(self, threshold):
@@ -866,6 +940,9 @@ class ShapedGroupingFunction:
     def __call__(self, a, b):
         return self._function(a, b, self._threshold)
 
+    def grouping_pairs(self, glyphs):
+        return _candidate_pairs(glyphs, self._threshold, self)
+
 
 class BoundingBoxGroupingFunction:
     def __init__(self, threshold):
@@ -876,6 +953,18 @@ class BoundingBoxGroupingFunction:
     def __call__(self, a, b):
         return self._function(a, b, self._threshold)
 
+    def grouping_pairs(self, glyphs):
+        from gamera.plugins import structural
+        return structural.bounding_box_grouping_pairs(glyphs, self._threshold)
+
+
+def _candidate_pairs(glyphs, threshold, function):
+    # All pairs of glyphs whose bounding boxes are closer than threshold
+    # (plus some slack for rounding) are candidates for function
+    from gamera.plugins import structural
+    pairs = structural.bounding_box_grouping_pairs(glyphs, int(threshold) + 2)
+    return [(i, j) for i, j in pairs if function(glyphs[i], glyphs[j])]
+
 
 def average_bb_distance(ccs):
     """Calculates the average distance between the bounding boxes
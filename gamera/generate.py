@@ -24,6 +24,7 @@ import sys
 from distutils.core import Extension
 from distutils.dep_util import newer
 from gamera import pyplate
+from gamera.args import ImageType
 
 # this is not used directly, but is needed to support type conversions
 # between Python and C++
@@ -86,6 +87,7 @@ template = pyplate.Template("""
 
   #include \"gameramodule.hpp\"
   #include \"knnmodule.hpp\"
+  #include \"plugin_stats.hpp\"
 
   [[# include the headers that the module needs #]]
   [[for header in module.cpp_headers]]
@@ -114,9 +116,14 @@ template = pyplate.Template("""
 #ifndef _MSC_VER
     void init[[module_name]](void);
 #endif
+    static PyObject* call_plugin_stats(PyObject* self, PyObject* args);
+    static PyObject* call_reset_plugin_stats(PyObject* self, PyObject* args);
     [[for function in module.functions]]
       [[if not function.pure_python]]
         static PyObject* call_[[function.__name__]](PyObject* self, PyObject* args);
+        [[if function.batch]]
+          static PyObject* call_[[function.__name__]]_batch(PyObject* self, PyObject* args);
+        [[end]]
       [[end]]
     [[end]]
   }
@@ -132,11 +139,43 @@ template = pyplate.Template("""
           call_[[function.__name__]], METH_VARARGS,
           CHAR_PTR_CAST [[function.escape_docstring()]]
         },
+        [[if function.batch]]
+          { CHAR_PTR_CAST \"[[function.__name__]]_batch\",
+            call_[[function.__name__]]_batch, METH_VARARGS,
+            CHAR_PTR_CAST \"Calls [[function.__name__]] on each image of a list and returns the list of results.\"
+          },
+        [[end]]
       [[end]]
     [[end]]
+    { CHAR_PTR_CAST \"_plugin_stats\",
+      call_plugin_stats, METH_VARARGS,
+      CHAR_PTR_CAST \"Returns the execution statistics (events=0) or the trace (events=1) of the plugins in this module.\"
+    },
+    { CHAR_PTR_CAST \"_reset_plugin_stats\",
+      call_reset_plugin_stats, METH_VARARGS,
+      CHAR_PTR_CAST \"Clears the execution statistics of the plugins in this module.\"
+    },
     { NULL }
   };
 
+  [[# The execution statistics of the wrappers in this module #]]
+  static PluginStats plugin_stats;
+
+  static PyObject* call_plugin_stats(PyObject* self, PyObject* args) {
+    int events = 0;
+    if (PyArg_ParseTuple(args, CHAR_PTR_CAST \"|i:_plugin_stats\", &events) <= 0)
+      return 0;
+    if (events)
+      return plugin_stats.events_to_python();
+    return plugin_stats.entries_to_python();
+  }
+
+  static PyObject* call_reset_plugin_stats(PyObject* self, PyObject* args) {
+    plugin_stats.clear();
+    Py_INCREF(Py_None);
+    return Py_None;
+  }
+
   [[# Each module can declare several functions so we loop through and generate wrapping #]]
   [[# code for each function #]]
   [[for function in module.functions]]
@@ -189,6 +228,27 @@ template = pyplate.Template("""
         [[arg.from_python()]]
       [[end]]
 
+      [[# the image types are determined before the GIL is released #]]
+      [[if function.release_gil]]
+        [[for arg in args]]
+          [[if isinstance(arg, ImageType)]]
+            int [[arg.symbol]]_combination = get_image_combination([[arg.pysymbol]]);
+          [[end]]
+        [[end]]
+      [[end]]
+
+      PluginStatsCall stats_call;
+      [[for arg in args]]
+        [[if isinstance(arg, ImageType)]]
+          stats_call.add_image([[arg.symbol]]);
+        [[end]]
+      [[end]]
+      [[if isinstance(function.self_type, ImageType)]]
+        [[exec stats_pixel_type = "get_pixel_type(%s)" % function.self_type.pysymbol]]
+      [[else]]
+        [[exec stats_pixel_type = "-1"]]
+      [[end]]
+
       [[if function.feature_function]]
          feature_t* feature_buffer = 0;
          if (offset < 0) {
@@ -200,8 +260,17 @@ template = pyplate.Template("""
            }
            feature_buffer = self_arg->features + offset;
          }
+         stats_call.start();
          [[args[0].call(function, args[1:], [])]]
+         stats_call.stop();
+         stats_call.record(plugin_stats, \"[[function.__name__]]\", [[stats_pixel_type]]);
       [[else]]
+        [[# With release_gil, the interpreter lock is released during the call of the #]]
+        [[# C++ function; error paths inside the call reacquire it with Py_BLOCK_THREADS #]]
+        [[if function.release_gil]]
+          Py_BEGIN_ALLOW_THREADS
+        [[end]]
+        stats_call.start();
         try {
           [[if len(args)]]
             [[args[0].call(function, args[1:], [])]]
@@ -212,9 +281,20 @@ template = pyplate.Template("""
             [[function.__name__]]([[if function.progress_bar]]ProgressBar("[[function.progress_bar]]")[[else]][[end]]);
           [[end]]
         } catch (std::exception& e) {
+          [[if function.release_gil]]
+            Py_BLOCK_THREADS
+          [[end]]
           PyErr_SetString(PyExc_RuntimeError, e.what());
           return 0;
         }
+        stats_call.stop();
+        [[if function.release_gil]]
+          Py_END_ALLOW_THREADS
+        [[end]]
+        [[if function.return_type != None]]
+          stats_call.add_result([[function.return_type.symbol]]);
+        [[end]]
+        stats_call.record(plugin_stats, \"[[function.__name__]]\", [[stats_pixel_type]]);
       [[end]]
 
       [[if function.feature_function]]
@@ -264,6 +344,188 @@ template = pyplate.Template("""
         [[end]]
       [[end]]
       }
+
+      [[# The batch variant takes a list of images instead of the self argument. #]]
+      [[# The other arguments are converted only once, and the C++ function is #]]
+      [[# called for each image in a loop, which runs in parallel with OpenMP when #]]
+      [[# the function releases the GIL. Feature functions return one array with #]]
+      [[# the features of all images, the others a list of the results. #]]
+      [[if function.batch]]
+        static PyObject* call_[[function.__name__]]_batch(PyObject* self, PyObject* args) {
+        PyErr_Clear();
+        [[exec args = function.args.list]]
+        [[exec returns_value = function.return_type != None and not function.feature_function]]
+        [[if returns_value]]
+          [[function.return_type.declare()]]
+          [[exec result_type = getattr(function.return_type, 'return_type', function.return_type.c_type)]]
+          [[exec result_typedef = "typedef %s batch_result_t;" % result_type]]
+          [[result_typedef]]
+        [[end]]
+        PyObject* images_pyarg;
+        [[exec pyarg_format = 'O']]
+        [[for arg in args]]
+          [[exec pyarg_format += arg.arg_format]]
+          [[arg.declare()]]
+        [[end]]
+        if (PyArg_ParseTuple(args, CHAR_PTR_CAST \"[[pyarg_format]]:[[function.__name__]]_batch\",
+                             &images_pyarg
+        [[for arg in args]]
+          ,
+          &[[arg.pysymbol]]
+        [[end]]
+        ) <= 0)
+          return 0;
+
+        [[for arg in args]]
+          [[arg.from_python()]]
+        [[end]]
+
+        [[# the sequence holds the images until all calls are done #]]
+        PyObject* images_seq = PySequence_Fast(images_pyarg, \"Argument 'images' must be an iterable of images.\");
+        if (images_seq == NULL)
+          return 0;
+        int batch_size = PySequence_Fast_GET_SIZE(images_seq);
+        ImageVector batch_images(batch_size);
+        PluginStatsCall stats_call(true);
+        [[exec choices = function.self_type._get_choices()]]
+        for (int i = 0; i < batch_size; ++i) {
+          PyObject* image = PySequence_Fast_GET_ITEM(images_seq, i);
+          if (!is_ImageObject(image)) {
+            PyErr_SetString(PyExc_TypeError, \"Argument 'images' must be an iterable of images.\");
+            Py_DECREF(images_seq);
+            return 0;
+          }
+          int combination = get_image_combination(image);
+          switch (combination) {
+          [[for choice, pixel_type in choices]]
+            case [[choice.upper()]]:
+          [[end]]
+            break;
+          default:
+            [[function.self_type.type_error(function.__name__ + "_batch", "images", choices, "image")]]
+            Py_DECREF(images_seq);
+            return 0;
+          }
+          batch_images[i] = std::pair<Image*, int>((Image*)((RectObject*)image)->m_x, combination);
+          image_get_fv(image, &batch_images[i].first->features,
+                       &batch_images[i].first->features_len);
+          stats_call.add_image(batch_images[i].first);
+        }
+        [[# the calls are recorded with the pixel type of the first image #]]
+        int stats_pixel_type = batch_size ? get_pixel_type(PySequence_Fast_GET_ITEM(images_seq, 0)) : -1;
+
+        std::string batch_error;
+        [[if function.feature_function]]
+          feature_t* batch_features = new feature_t[batch_size * [[function.return_type.length]] ];
+        [[elif returns_value]]
+          std::vector<batch_result_t> batch_results(batch_size);
+        [[end]]
+        [[if function.release_gil]]
+          Py_BEGIN_ALLOW_THREADS
+        [[end]]
+        stats_call.start();
+        [[if function.release_gil]]
+          #ifdef _OPENMP
+          #pragma omp parallel for schedule(dynamic)
+          #endif
+        [[end]]
+        for (int i = 0; i < batch_size; ++i) {
+          Image* self_arg = batch_images[i].first;
+          [[if function.feature_function]]
+            feature_t* feature_buffer = batch_features + i * [[function.return_type.length]];
+          [[elif returns_value]]
+            batch_result_t [[function.return_type.symbol]] = batch_result_t();
+          [[end]]
+          try {
+            switch (batch_images[i].second) {
+            [[for choice, pixel_type in choices]]
+              case [[choice.upper()]]:
+              [[exec output_args = ["*((%s*)self_arg)" % choice] ]]
+              [[if len(args)]]
+                [[args[0].call(function, args[1:], output_args, pixel_type)]]
+              [[else]]
+                [[function.self_type._do_call(function, output_args)]]
+              [[end]]
+              break;
+            [[end]]
+            default:
+              break;
+            }
+          } catch (std::exception& e) {
+            [[if function.release_gil]]
+              #ifdef _OPENMP
+              #pragma omp critical
+              #endif
+            [[end]]
+            if (batch_error.empty())
+              batch_error = e.what();
+          }
+          [[if returns_value]]
+            batch_results[i] = [[function.return_type.symbol]];
+          [[end]]
+        }
+        stats_call.stop();
+        [[if function.release_gil]]
+          Py_END_ALLOW_THREADS
+        [[end]]
+        Py_DECREF(images_seq);
+        [[if returns_value]]
+          for (int i = 0; i < batch_size; ++i)
+            stats_call.add_result(batch_results[i]);
+        [[end]]
+        stats_call.record(plugin_stats, \"[[function.__name__]]_batch\", stats_pixel_type);
+
+        [[for arg in function.args]]
+          [[arg.delete()]]
+        [[end]]
+        [[if function.feature_function]]
+          PyObject* batch_pyresult = 0;
+          if (batch_error.empty()) {
+            PyObject* str = PyString_FromStringAndSize((char*)batch_features, batch_size * [[function.return_type.length]] * sizeof(feature_t));
+            if (str != 0) {
+              PyObject* array_init = get_ArrayInit();
+              if (array_init != 0)
+                batch_pyresult = PyObject_CallFunction(
+                      array_init, (char *)\"sO\", (char *)\"d\", str);
+              Py_DECREF(str);
+            }
+          }
+          delete[] batch_features;
+        [[elif returns_value]]
+          [[# the results are also converted after an error, so that they are freed #]]
+          PyObject* batch_pyresult = PyList_New(batch_size);
+          if (batch_pyresult == 0)
+            return 0;
+          for (int i = 0; i < batch_size; ++i) {
+            [[function.return_type.symbol]] = batch_results[i];
+            [[if result_type.endswith('*')]]
+              if ([[function.return_type.symbol]] == NULL) {
+                Py_INCREF(Py_None);
+                [[function.return_type.pysymbol]] = Py_None;
+              } else {
+                [[function.return_type.to_python()]]
+              }
+            [[else]]
+              [[function.return_type.to_python()]]
+            [[end]]
+            if ([[function.return_type.pysymbol]] == NULL) {
+              Py_DECREF(batch_pyresult);
+              return 0;
+            }
+            PyList_SET_ITEM(batch_pyresult, i, [[function.return_type.pysymbol]]);
+          }
+        [[else]]
+          PyObject* batch_pyresult = Py_None;
+          Py_INCREF(Py_None);
+        [[end]]
+        if (!batch_error.empty()) {
+          Py_XDECREF(batch_pyresult);
+          PyErr_SetString(PyExc_RuntimeError, batch_error.c_str());
+          return 0;
+        }
+        return batch_pyresult;
+        }
+      [[end]]
     [[end]]
   [[end]]
 
@@ -273,6 +535,52 @@ template = pyplate.Template("""
   """)
 
 
+def check_release_gil(function):
+    """Raises a RuntimeError when the wrapper of a plugin function with
+    release_gil would need the interpreter lock during the call of the C++
+    function: Python objects are passed to or returned from it, or a
+    progress bar is updated."""
+    if not function.release_gil or function.pure_python:
+        return
+    problem = None
+    if function.feature_function:
+        problem = "feature functions"
+    elif function.progress_bar:
+        problem = "functions with a progress bar"
+    else:
+        for arg in function.args.list + [function.return_type]:
+            if arg is not None and arg.__class__.__name__ in ("Class", "Pixel"):
+                problem = "%s arguments or return values" % arg.__class__.__name__
+                break
+    if problem is not None:
+        raise RuntimeError("Plugin function '%s' can not release the GIL: "
+                           "this is not supported for %s" %
+                           (function.__name__, problem))
+
+
+def check_batch(function):
+    """Raises a RuntimeError when the batch variant of a plugin function
+    can not be generated: the list of images replaces the self argument,
+    so there must be one, and the loop over the images can neither
+    convert further image arguments nor update a progress bar."""
+    if not function.batch or function.pure_python:
+        return
+    problem = None
+    if not isinstance(function.self_type, ImageType):
+        problem = "functions without an image as self argument"
+    elif function.progress_bar:
+        problem = "functions with a progress bar"
+    else:
+        for arg in function.args.list:
+            if isinstance(arg, ImageType):
+                problem = "functions with further image arguments"
+                break
+    if problem is not None:
+        raise RuntimeError("Plugin function '%s' can not have a batch "
+                           "variant: this is not supported for %s" %
+                           (function.__name__, problem))
+
+
 def generate_plugin(plugin_filename, location, compiling_gamera,
                     extra_compile_args=[], extra_link_args=[], libraries=[],
                     define_macros=[]):
@@ -315,6 +623,9 @@ def generate_plugin(plugin_filename, location, compiling_gamera,
 
     if regenerate:
         print "generating wrappers for", module_name, "plugin"
+        for function in plugin_module.module.functions:
+            check_release_gil(function)
+            check_batch(function)
         template.execute_file(cpp_filename, plugin_module.__dict__)
     else:
         print "skipping wrapper generation for", module_name, "plugin (output up-to-date)"
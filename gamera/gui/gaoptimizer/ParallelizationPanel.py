@@ -39,7 +39,7 @@ class ParallelizationPanel(ExpertSettingPanel):
         self.parallelEnabled = wx.CheckBox(self, -1, "Enable Parallelization", \
             name = "parallelization")
         self.parallelEnabled.SetValue(True)
-        self.parallelEnabled.SetToolTipString("Only available if compiled with OpenMP")
+        self.parallelEnabled.SetToolTipString("Evaluate the individuals of a generation on several threads")
         sizer.Add(self.parallelEnabled, 0, wx.LEFT | wx.RIGHT | wx.TOP | wx.EXPAND, 10)
 
         # if enabled choose the number of used threads
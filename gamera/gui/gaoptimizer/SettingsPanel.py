@@ -185,9 +185,7 @@ class SettingsPanel(wx.ScrolledWindow):
         notebook.AddPage(self.mutationPanel, "Mutation")
         notebook.AddPage(self.replacementPanel, "Replacement")
         notebook.AddPage(self.stopCriteriaPanel, "Stop Criteria")
-        from gamera.__compiletime_config__ import has_openmp
-        if has_openmp:
-            notebook.AddPage(self.parallelizationPanel, "Parallelization")
+        notebook.AddPage(self.parallelizationPanel, "Parallelization")
 
         sizer.Add(notebook, 1, wx.ALL | wx.EXPAND, 0)
         pane.SetSizer(sizer)
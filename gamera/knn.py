@@ -30,6 +30,10 @@ from gamera.plugins import features as features_module
 from gamera.knncore import CITY_BLOCK
 from gamera.knncore import EUCLIDEAN
 from gamera.knncore import FAST_EUCLIDEAN
+from gamera.knncore import STORAGE_DOUBLE
+from gamera.knncore import STORAGE_FLOAT
+from gamera.knncore import STORAGE_INT8
+from gamera.knncore import STORAGE_PQ
 
 KNN_XML_FORMAT_VERSION = 1.0
 
@@ -16,21 +16,11 @@
 # along with this program; if not, write to the Free Software
 # Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
 
-from random import randint
-from gamera.args import Args, Int, Check
+from random import shuffle
+from gamera.args import Args, Int, Real, Check
 from gamera.knn import kNNInteractive
 from gamera.util import ProgressFactory
-
-
-def _randomSetElement(set):
-    """Retrieve a random element from the given set
-
-    *set*
-      The set from which to select a random element"""
-    randPos = randint(0, len(set) - 1)
-    for pos, elem in enumerate(set):
-        if pos == randPos:
-            return elem
+from gamera import knncore
 
 
 def _copyClassifier(original, k=0):
@@ -43,22 +33,39 @@ parameters.
     *k*
       If the copy shall have another k-value as the original, set k accordingly.
       k = 0 means, that the original's k-value will be used"""
+    glyphs = list(original.get_glyphs())
+    return _reducedClassifier(original, glyphs, range(len(glyphs)), k)
+
+
+def _featureDatabase(classifier):
+    """Returns the glyphs of the classifier together with a *knncore.kNN*
+object holding their feature vectors (in the same order) with the
+classifier's settings, on which the native editing functions operate."""
+    glyphs = list(classifier.get_glyphs())
+    database = knncore.kNN()
+    database.num_features = classifier.num_features
+    database.num_k = classifier.num_k
+    database.distance_type = classifier.distance_type
+    database.set_selections(classifier.get_selections())
+    database.set_weights(classifier.get_weights())
+    database.instantiate_from_images(glyphs,
+                                     getattr(classifier, "normalize", False))
+    return glyphs, database
+
+
+def _reducedClassifier(original, glyphs, indexes, k=0):
+    """Constructs a new classifier with the same parameters as the original
+one (features, distance type, normalization, selections and weights) from
+the glyphs at the given indexes."""
     if k == 0:
         k = original.num_k
-    return kNNInteractive(
-                list(original.get_glyphs()), original.features,
-                original._perform_splits,
-                k)
-
-
-def _getMainId(classificationResult):
-    """Classification results returned from a kNN Classifier are in a list
-containing '(confidence, className)' tuples. So to determine the 'main class',
-the classname with the highest confidence has to be returned.
-"""
-    # classificationResult is a tuple of the form
-    #   ([idname1, idname2, ...], confidences_for_idname1)
-    return classificationResult[0][0][1]
+    result = kNNInteractive([glyphs[i] for i in indexes], original.features,
+                            original._perform_splits, k)
+    result.distance_type = original.distance_type
+    result.normalize = getattr(original, "normalize", False)
+    result.set_selections(original.get_selections())
+    result.set_weights(original.get_weights())
+    return result
 
 
 class AlgoRegistry(object):
@@ -163,52 +170,22 @@ Reference: D. Wilson: 'Asymptotic Properties of NN Rules Using Edited Data'.
 
     def __call__(self, classifier, k=0, protectRare=True,
                  rareThreshold=3):
+        # special case of empty classifier
+        if (not classifier.get_glyphs()):
+            return _copyClassifier(classifier, k)
 
-        editedClassifier = _copyClassifier(classifier, k)
-        toBeRemoved = set()
-        progress = ProgressFactory("Generating edited MNN classifier...",
-                                      len(classifier.get_glyphs()))
-
-        # classify each glyph with its leave-one-out classifier
-        for i, glyph in enumerate(classifier.get_glyphs()):
-            editedClassifier.get_glyphs().remove(glyph)
-            detectedClass = _getMainId(\
-                                editedClassifier.guess_glyph_automatic(glyph))
-            # check if recognized class complies with the true class
-            if glyph.get_main_id() != detectedClass:
-                toBeRemoved.add(glyph)
-            editedClassifier.get_glyphs().add(glyph)
-            progress.step()
-
-        rareClasses = self._getRareClasses(classifier.get_glyphs(),
-                                           protectRare, rareThreshold)
-
-        # remove 'bad' glyphs, if they are not in a rare class
-        for glyph in toBeRemoved:
-            if glyph.get_main_id() in rareClasses:
-                continue
-            editedClassifier.get_glyphs().remove(glyph)
-
-        progress.kill()
-        return editedClassifier
-
-    def _getRareClasses(self, glyphs, protectRare, rareThreshold):
-        """Produces a set containing the names of all rare classes"""
-        result = set()
-
+        # classify each glyph by its k nearest neighbors among the others
+        # (in knncore)
+        glyphs, database = _featureDatabase(classifier)
         if not protectRare:
-            return result
-
-        # histogram of classNames
-        histo = {}
-        for g in glyphs:
-            count = histo.get(g.get_main_id(), 0)
-            histo[g.get_main_id()] = count + 1
-
-        for className in histo:
-            if histo[className] < rareThreshold:
-                result.add(className)
-        return result
+            rareThreshold = 0
+        progress = ProgressFactory("Generating edited MNN classifier...",
+                                   len(glyphs))
+        try:
+            kept = database.edit_wilson(k, rareThreshold, progress.step)
+        finally:
+            progress.kill()
+        return _reducedClassifier(classifier, glyphs, kept, k)
 
 edit_mnn = EditMnn()
 
@@ -243,45 +220,18 @@ Reference: P.E. Hart: 'The Condensed Nearest Neighbor rule'. *IEEE Transactions
         if (not classifier.get_glyphs()):
             return _copyClassifier(classifier)
 
-        if k == 0:
-            k = classifier.num_k
-
-        progress = ProgressFactory("Generating edited CNN classifier...",
-                                      len(classifier.get_glyphs()))
-
-        # initialize Store (a) with a single element
+        glyphs, database = _featureDatabase(classifier)
+        order = range(len(glyphs))
         if randomize:
-            elem = _randomSetElement(classifier.get_glyphs())
-        else:
-            elem = classifier.get_glyphs().__iter__().next()
-
-        aGlyphs = [elem]
-        a = kNNInteractive(aGlyphs, classifier.features,
-                           classifier._perform_splits, k)
-        progress.step()
-
-        # initialize Grabbag (b) with all other
-        b = classifier.get_glyphs().copy()
-        b.remove(aGlyphs[0])
-
-        # Classify each glyph in b with a as the classifier
-        # If glyph is misclassified, add it to a, repeat until no elements are
-        # added to a
-        changed = True
-        while changed == True:
-            changed = False
-            # copy needed because iteration through dict is not possible while
-            # deleting items from it
-            copyOfB = b.copy()
-            for glyph in copyOfB:
-                if glyph.get_main_id() != _getMainId(a.guess_glyph_automatic(glyph)):
-                    b.remove(glyph)
-                    a.get_glyphs().add(glyph)
-                    progress.step()
-                    changed = True
-        progress.kill()
-        a.num_k = 1
-        return a
+            shuffle(order)
+        # the progress counts the glyphs moved into the condensed set
+        progress = ProgressFactory("Generating edited CNN classifier...",
+                                   len(glyphs))
+        try:
+            kept = database.condense_hart(k, order, progress.step)
+        finally:
+            progress.kill()
+        return _reducedClassifier(classifier, glyphs, kept, 1)
 
 edit_cnn = EditCnn()
 
@@ -307,3 +257,47 @@ For documentation of the parameters see the independent algorithms"""
                    randomize)
 
 edit_mnn_cnn = EditMnnCnn()
+
+
+class EditMedoids(EditingAlgorithm):
+    """**edit_medoids** (kNNInteractive *classifier*, float *ratio* = 0.1)
+
+Prototype reduction by clustering. The glyphs of each class are divided
+into *ratio* times as many clusters as the class has glyphs (at least
+one per class), and each cluster is represented by its medoid, i.e. the
+glyph with the smallest sum of distances to the other glyphs in the
+cluster. Unlike CNN, the size of the result can be chosen in advance,
+and the kept glyphs are typical members of their class rather than
+glyphs near the decision boundaries, so that this works well after MNN.
+
+    *classifier*
+        The classifier from which to create an edited copy
+    *ratio*
+        The fraction of the glyphs of each class that is kept
+
+The clusters are computed with the alternating k-medoids algorithm,
+starting from a farthest first traversal, which makes the result
+deterministic.
+
+Reference: L. Kaufman, P.J. Rousseeuw: *Finding Groups in Data: An
+Introduction to Cluster Analysis*. Wiley, 1990
+"""
+    name = "Medoid prototypes per class"
+    args = Args([Real("Ratio", range=(0.0, 1.0), default=0.1)])
+
+    def __call__(self, classifier, ratio=0.1):
+        # special case of empty classifier
+        if (not classifier.get_glyphs()):
+            return _copyClassifier(classifier)
+
+        glyphs, database = _featureDatabase(classifier)
+        classes = set([glyph.get_main_id() for glyph in glyphs])
+        progress = ProgressFactory("Generating medoid prototypes...",
+                                   len(classes))
+        try:
+            kept = database.reduce_medoids(ratio, progress.step)
+        finally:
+            progress.kill()
+        return _reducedClassifier(classifier, glyphs, kept)
+
+edit_medoids = EditMedoids()
@@ -0,0 +1,1321 @@
+
+          
+    
+  #include "gameramodule.hpp"
+  #include "knnmodule.hpp"
+  #include "plugin_stats.hpp"
+
+        #include "corelation.hpp"
+  
+    #include <string>
+  #include <stdexcept>
+  #include "Python.h"
+  #include <list>
+
+  using namespace Gamera;
+  
+        
+      extern "C" {
+#ifndef _MSC_VER
+    void init_corelation(void);
+#endif
+    static PyObject* call_plugin_stats(PyObject* self, PyObject* args);
+    static PyObject* call_reset_plugin_stats(PyObject* self, PyObject* args);
+                  static PyObject* call_corelation_weighted(PyObject* self, PyObject* args);
+                                static PyObject* call_corelation_sum(PyObject* self, PyObject* args);
+                                static PyObject* call_corelation_sum_squares(PyObject* self, PyObject* args);
+                                static PyObject* call_corelation_weighted_map(PyObject* self, PyObject* args);
+                                static PyObject* call_corelation_sum_map(PyObject* self, PyObject* args);
+                                static PyObject* call_corelation_sum_squares_map(PyObject* self, PyObject* args);
+                                static PyObject* call_corelation_best_offsets(PyObject* self, PyObject* args);
+                    }
+
+          static PyMethodDef _corelation_methods[] = {
+                  { CHAR_PTR_CAST "corelation_weighted",
+          call_corelation_weighted, METH_VARARGS,
+          CHAR_PTR_CAST "**corelation_weighted** (``Image`` [OneBit] *template*, ``Point`` *offset*, float *bb*, float *bw*, float *wb*, float *ww*)\n\nReturns a floating-point value for how well an image is corelated\nto another image placed at a given origin (*x*, *y*).  Uses the\nweighted reward/penalty method.\n\n*template*\n  The template image.\n\n*offset*\n  The displacement of the template on the image.\n\n*bb*, *bw*, *wb*, *ww*\n  The rewards and penalties for different combinations of pixels.\n  The first letter in the arugment name indicates the color of the\n  template; the second letter indicates the color of the source\n  image.  For instance, the value of *bw* will be applied to the\n  result when the template pixel is black and the source image\n  pixel is white.\n\n+--------+--------+------------------+\n| Image  |        | Template         |\n|        +--------+---------+--------+\n|        |        | black   | white  |\n|        +--------+---------+--------+\n|        | black  | *bb*    | *wb*   |\n|        +--------+---------+--------+\n|        | white  | *bw*    | *ww*   |\n+--------+--------+---------+--------+"        },
+                                { CHAR_PTR_CAST "corelation_sum",
+          call_corelation_sum, METH_VARARGS,
+          CHAR_PTR_CAST "**corelation_sum** (``Image`` [OneBit] *template*, ``Point`` *offset*)\n\nReturns a floating-point value for how well an image is corelated\nto another image placed at a given origin (*x*, *y*).  Uses the\nsum of absolute distance method.  A higher value indicates more\ncorelation.\n\n*template*\n  The template image.\n\n*offset*\n  The displacement of the template on the image."        },
+                                { CHAR_PTR_CAST "corelation_sum_squares",
+          call_corelation_sum_squares, METH_VARARGS,
+          CHAR_PTR_CAST "**corelation_sum_squares** (``Image`` [OneBit] *template*, ``Point`` *offset*)\n\nReturns a floating-point value for how well an image is corelated\nto another image placed at a given origin (*x*, *y*).  Uses the\nsum of squares method.  A higher value indicates more corelation.\n\n*template*\n  The template image.\n*offset*\n  The displacement of the template on the image."        },
+                                { CHAR_PTR_CAST "corelation_weighted_map",
+          call_corelation_weighted_map, METH_VARARGS,
+          CHAR_PTR_CAST "**corelation_weighted_map** (``Image`` [OneBit] *template*, float *bb*, float *bw*, float *wb*, float *ww*)\n\nComputes corelation_weighted_ for all offsets at which *template*\nfits completely into the image, which is much faster than calling\ncorelation_weighted_ for each offset.\n\nThe result is a FLOAT image with the same offset as the image, in\nwhich the pixel at position *(x, y)* holds the value of\n``corelation_weighted(template, (x, y), bb, bw, wb, ww)``. It is\n``template.ncols - 1`` columns and ``template.nrows - 1`` rows\nsmaller than the image. The best matching positions can be\nextracted with corelation_best_offsets_.\n\nThe pixels are compared 64 at a time on bit packed rows, and the\nrows of the result are computed in parallel when Gamera has been\ncompiled with OpenMP support.\n\n.. _corelation_weighted: #corelation-weighted\n.. _corelation_best_offsets: #corelation-best-offsets"        },
+                                { CHAR_PTR_CAST "corelation_sum_map",
+          call_corelation_sum_map, METH_VARARGS,
+          CHAR_PTR_CAST "**corelation_sum_map** (``Image`` [OneBit] *template*)\n\nComputes corelation_sum_ for all offsets at which *template* fits\ncompletely into the image. See corelation_weighted_map_ for the\nlayout of the resulting FLOAT image.\n\nFor onebit images, the number of differing pixels is counted with\nbit packed rows. For greyscale images, the sum of the image pixels\nunder the black template pixels is computed for all offsets at once\nwith an FFT based cross corelation on tiles, which makes the runtime\nnearly independent of the template size.\n\n.. _corelation_sum: #corelation-sum\n.. _corelation_weighted_map: #corelation-weighted-map"        },
+                                { CHAR_PTR_CAST "corelation_sum_squares_map",
+          call_corelation_sum_squares_map, METH_VARARGS,
+          CHAR_PTR_CAST "**corelation_sum_squares_map** (``Image`` [OneBit] *template*)\n\nComputes corelation_sum_squares_ for all offsets at which *template*\nfits completely into the image. See corelation_sum_map_ for details.\n\n.. _corelation_sum_squares: #corelation-sum-squares\n.. _corelation_sum_map: #corelation-sum-map"        },
+                                { CHAR_PTR_CAST "corelation_best_offsets",
+          call_corelation_best_offsets, METH_VARARGS,
+          CHAR_PTR_CAST "**corelation_best_offsets** (int *n* = 10, ``bool`` *largest* = True, int *min_distance* = 0)\n\nReturns the *n* best positions in a corelation map as computed by\ncorelation_weighted_map_, corelation_sum_map_, or\ncorelation_sum_squares_map_. The result is a list of tuples\n*(offset, value)*, where *offset* is the position of the template\nin the coordinate system of the original image. The best value\ncomes first.\n\n*n*\n  The maximum number of positions returned.\n\n*largest*\n  When ``True`` (default), large values are considered best, which is\n  appropriate for corelation_weighted_map_ with rewards for matching\n  pixels. For the distances computed by corelation_sum_map_ and\n  corelation_sum_squares_map_, set it to ``False``.\n\n*min_distance*\n  When greater than zero, only local extrema of the map are considered,\n  and a position is skipped when its horizontal and vertical distance\n  to an already selected position are both less than *min_distance*.\n  Setting it to the template size avoids multiple hits on the same\n  symbol.\n\n.. code:: Python\n\n  scores = page.corelation_weighted_map(clef, 1.0, -1.0, -1.0, 0.0)\n  for offset, score in scores.corelation_best_offsets(20, True, clef.ncols):\n      print offset, score\n\n.. _corelation_weighted_map: #corelation-weighted-map\n.. _corelation_sum_map: #corelation-sum-map\n.. _corelation_sum_squares_map: #corelation-sum-squares-map"        },
+                      { CHAR_PTR_CAST "_plugin_stats",
+      call_plugin_stats, METH_VARARGS,
+      CHAR_PTR_CAST "Returns the execution statistics (events=0) or the trace (events=1) of the plugins in this module."
+    },
+    { CHAR_PTR_CAST "_reset_plugin_stats",
+      call_reset_plugin_stats, METH_VARARGS,
+      CHAR_PTR_CAST "Clears the execution statistics of the plugins in this module."
+    },
+    { NULL }
+  };
+
+    static PluginStats plugin_stats;
+
+  static PyObject* call_plugin_stats(PyObject* self, PyObject* args) {
+    int events = 0;
+    if (PyArg_ParseTuple(args, CHAR_PTR_CAST "|i:_plugin_stats", &events) <= 0)
+      return 0;
+    if (events)
+      return plugin_stats.events_to_python();
+    return plugin_stats.entries_to_python();
+  }
+
+  static PyObject* call_reset_plugin_stats(PyObject* self, PyObject* args) {
+    plugin_stats.clear();
+    Py_INCREF(Py_None);
+    return Py_None;
+  }
+
+                static PyObject* call_corelation_weighted(PyObject* self, PyObject* args) {
+            
+      PyErr_Clear();
+                                                                                double return_arg;
+PyObject* return_pyarg;
+                                          Image* self_arg;
+PyObject* self_pyarg;
+                      Image* template_arg;
+PyObject* template_pyarg;
+                      Point offset_arg;
+PyObject* offset_pyarg;
+                      double bb_arg;
+                      double bw_arg;
+                      double wb_arg;
+                      double ww_arg;
+      
+                                      if (PyArg_ParseTuple(args, CHAR_PTR_CAST "OOOdddd:corelation_weighted"
+                        ,
+             &self_pyarg                        ,
+             &template_pyarg                        ,
+             &offset_pyarg                        ,
+             &bb_arg                        ,
+             &bw_arg                        ,
+             &wb_arg                        ,
+             &ww_arg                      ) <= 0)
+           return 0;
+               
+              if (!is_ImageObject(self_pyarg)) {
+            PyErr_SetString(PyExc_TypeError, "Argument 'self' must be an image");
+            return 0;
+          }
+          self_arg = ((Image*)((RectObject*)self_pyarg)->m_x);
+          image_get_fv(self_pyarg, &self_arg->features, &self_arg->features_len);
+                        if (!is_ImageObject(template_pyarg)) {
+            PyErr_SetString(PyExc_TypeError, "Argument 'template' must be an image");
+            return 0;
+          }
+          template_arg = ((Image*)((RectObject*)template_pyarg)->m_x);
+          image_get_fv(template_pyarg, &template_arg->features, &template_arg->features_len);
+                        
+        try {
+           offset_arg = coerce_Point(offset_pyarg);
+        } catch (std::invalid_argument e) {
+           PyErr_SetString(PyExc_TypeError, "Argument 'offset' must be a Point, or convertible to a Point");
+           return 0;
+        }
+                                                                      
+            
+      PluginStatsCall stats_call;
+                        stats_call.add_image(self_arg);
+                                stats_call.add_image(template_arg);
+                                                                                                        
+                                      stats_call.start();
+        try {
+                      switch(get_image_combination(self_pyarg)) {
+case ONEBITIMAGEVIEW:
+switch(get_image_combination(template_pyarg)) {
+case ONEBITIMAGEVIEW:
+return_arg = corelation_weighted(*((OneBitImageView*)self_arg), *((OneBitImageView*)template_arg), offset_arg, bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case CC:
+return_arg = corelation_weighted(*((OneBitImageView*)self_arg), *((Cc*)template_arg), offset_arg, bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case ONEBITRLEIMAGEVIEW:
+return_arg = corelation_weighted(*((OneBitImageView*)self_arg), *((OneBitRleImageView*)template_arg), offset_arg, bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case RLECC:
+return_arg = corelation_weighted(*((OneBitImageView*)self_arg), *((RleCc*)template_arg), offset_arg, bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case MLCC:
+return_arg = corelation_weighted(*((OneBitImageView*)self_arg), *((MlCc*)template_arg), offset_arg, bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'template' argument of 'corelation_weighted' can not have pixel type '%s'. Acceptable values are ONEBIT, ONEBIT, ONEBIT, ONEBIT, and ONEBIT.", get_pixel_type_name(template_pyarg));
+return 0;
+}
+break;
+case CC:
+switch(get_image_combination(template_pyarg)) {
+case ONEBITIMAGEVIEW:
+return_arg = corelation_weighted(*((Cc*)self_arg), *((OneBitImageView*)template_arg), offset_arg, bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case CC:
+return_arg = corelation_weighted(*((Cc*)self_arg), *((Cc*)template_arg), offset_arg, bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case ONEBITRLEIMAGEVIEW:
+return_arg = corelation_weighted(*((Cc*)self_arg), *((OneBitRleImageView*)template_arg), offset_arg, bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case RLECC:
+return_arg = corelation_weighted(*((Cc*)self_arg), *((RleCc*)template_arg), offset_arg, bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case MLCC:
+return_arg = corelation_weighted(*((Cc*)self_arg), *((MlCc*)template_arg), offset_arg, bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'template' argument of 'corelation_weighted' can not have pixel type '%s'. Acceptable values are ONEBIT, ONEBIT, ONEBIT, ONEBIT, and ONEBIT.", get_pixel_type_name(template_pyarg));
+return 0;
+}
+break;
+case ONEBITRLEIMAGEVIEW:
+switch(get_image_combination(template_pyarg)) {
+case ONEBITIMAGEVIEW:
+return_arg = corelation_weighted(*((OneBitRleImageView*)self_arg), *((OneBitImageView*)template_arg), offset_arg, bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case CC:
+return_arg = corelation_weighted(*((OneBitRleImageView*)self_arg), *((Cc*)template_arg), offset_arg, bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case ONEBITRLEIMAGEVIEW:
+return_arg = corelation_weighted(*((OneBitRleImageView*)self_arg), *((OneBitRleImageView*)template_arg), offset_arg, bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case RLECC:
+return_arg = corelation_weighted(*((OneBitRleImageView*)self_arg), *((RleCc*)template_arg), offset_arg, bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case MLCC:
+return_arg = corelation_weighted(*((OneBitRleImageView*)self_arg), *((MlCc*)template_arg), offset_arg, bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'template' argument of 'corelation_weighted' can not have pixel type '%s'. Acceptable values are ONEBIT, ONEBIT, ONEBIT, ONEBIT, and ONEBIT.", get_pixel_type_name(template_pyarg));
+return 0;
+}
+break;
+case RLECC:
+switch(get_image_combination(template_pyarg)) {
+case ONEBITIMAGEVIEW:
+return_arg = corelation_weighted(*((RleCc*)self_arg), *((OneBitImageView*)template_arg), offset_arg, bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case CC:
+return_arg = corelation_weighted(*((RleCc*)self_arg), *((Cc*)template_arg), offset_arg, bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case ONEBITRLEIMAGEVIEW:
+return_arg = corelation_weighted(*((RleCc*)self_arg), *((OneBitRleImageView*)template_arg), offset_arg, bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case RLECC:
+return_arg = corelation_weighted(*((RleCc*)self_arg), *((RleCc*)template_arg), offset_arg, bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case MLCC:
+return_arg = corelation_weighted(*((RleCc*)self_arg), *((MlCc*)template_arg), offset_arg, bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'template' argument of 'corelation_weighted' can not have pixel type '%s'. Acceptable values are ONEBIT, ONEBIT, ONEBIT, ONEBIT, and ONEBIT.", get_pixel_type_name(template_pyarg));
+return 0;
+}
+break;
+case MLCC:
+switch(get_image_combination(template_pyarg)) {
+case ONEBITIMAGEVIEW:
+return_arg = corelation_weighted(*((MlCc*)self_arg), *((OneBitImageView*)template_arg), offset_arg, bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case CC:
+return_arg = corelation_weighted(*((MlCc*)self_arg), *((Cc*)template_arg), offset_arg, bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case ONEBITRLEIMAGEVIEW:
+return_arg = corelation_weighted(*((MlCc*)self_arg), *((OneBitRleImageView*)template_arg), offset_arg, bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case RLECC:
+return_arg = corelation_weighted(*((MlCc*)self_arg), *((RleCc*)template_arg), offset_arg, bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case MLCC:
+return_arg = corelation_weighted(*((MlCc*)self_arg), *((MlCc*)template_arg), offset_arg, bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'template' argument of 'corelation_weighted' can not have pixel type '%s'. Acceptable values are ONEBIT, ONEBIT, ONEBIT, ONEBIT, and ONEBIT.", get_pixel_type_name(template_pyarg));
+return 0;
+}
+break;
+case GREYSCALEIMAGEVIEW:
+switch(get_image_combination(template_pyarg)) {
+case ONEBITIMAGEVIEW:
+return_arg = corelation_weighted(*((GreyScaleImageView*)self_arg), *((OneBitImageView*)template_arg), offset_arg, bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case CC:
+return_arg = corelation_weighted(*((GreyScaleImageView*)self_arg), *((Cc*)template_arg), offset_arg, bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case ONEBITRLEIMAGEVIEW:
+return_arg = corelation_weighted(*((GreyScaleImageView*)self_arg), *((OneBitRleImageView*)template_arg), offset_arg, bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case RLECC:
+return_arg = corelation_weighted(*((GreyScaleImageView*)self_arg), *((RleCc*)template_arg), offset_arg, bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case MLCC:
+return_arg = corelation_weighted(*((GreyScaleImageView*)self_arg), *((MlCc*)template_arg), offset_arg, bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'template' argument of 'corelation_weighted' can not have pixel type '%s'. Acceptable values are ONEBIT, ONEBIT, ONEBIT, ONEBIT, and ONEBIT.", get_pixel_type_name(template_pyarg));
+return 0;
+}
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'self' argument of 'corelation_weighted' can not have pixel type '%s'. Acceptable values are ONEBIT, ONEBIT, ONEBIT, ONEBIT, ONEBIT, and GREYSCALE.", get_pixel_type_name(self_pyarg));
+return 0;
+}
+                  } catch (std::exception& e) {
+                    PyErr_SetString(PyExc_RuntimeError, e.what());
+          return 0;
+        }
+        stats_call.stop();
+                          stats_call.add_result(return_arg);
+                stats_call.record(plugin_stats, "corelation_weighted", get_pixel_type(self_pyarg));
+      
+                                                                                                                                                        return_pyarg = PyFloat_FromDouble((double)return_arg);            return return_pyarg;
+                              }
+
+                                                    static PyObject* call_corelation_sum(PyObject* self, PyObject* args) {
+            
+      PyErr_Clear();
+                                                                                double return_arg;
+PyObject* return_pyarg;
+                                          Image* self_arg;
+PyObject* self_pyarg;
+                      Image* template_arg;
+PyObject* template_pyarg;
+                      Point offset_arg;
+PyObject* offset_pyarg;
+      
+                                      if (PyArg_ParseTuple(args, CHAR_PTR_CAST "OOO:corelation_sum"
+                        ,
+             &self_pyarg                        ,
+             &template_pyarg                        ,
+             &offset_pyarg                      ) <= 0)
+           return 0;
+               
+              if (!is_ImageObject(self_pyarg)) {
+            PyErr_SetString(PyExc_TypeError, "Argument 'self' must be an image");
+            return 0;
+          }
+          self_arg = ((Image*)((RectObject*)self_pyarg)->m_x);
+          image_get_fv(self_pyarg, &self_arg->features, &self_arg->features_len);
+                        if (!is_ImageObject(template_pyarg)) {
+            PyErr_SetString(PyExc_TypeError, "Argument 'template' must be an image");
+            return 0;
+          }
+          template_arg = ((Image*)((RectObject*)template_pyarg)->m_x);
+          image_get_fv(template_pyarg, &template_arg->features, &template_arg->features_len);
+                        
+        try {
+           offset_arg = coerce_Point(offset_pyarg);
+        } catch (std::invalid_argument e) {
+           PyErr_SetString(PyExc_TypeError, "Argument 'offset' must be a Point, or convertible to a Point");
+           return 0;
+        }
+              
+            
+      PluginStatsCall stats_call;
+                        stats_call.add_image(self_arg);
+                                stats_call.add_image(template_arg);
+                                                
+                                      stats_call.start();
+        try {
+                      switch(get_image_combination(self_pyarg)) {
+case ONEBITIMAGEVIEW:
+switch(get_image_combination(template_pyarg)) {
+case ONEBITIMAGEVIEW:
+return_arg = corelation_sum(*((OneBitImageView*)self_arg), *((OneBitImageView*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case CC:
+return_arg = corelation_sum(*((OneBitImageView*)self_arg), *((Cc*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case ONEBITRLEIMAGEVIEW:
+return_arg = corelation_sum(*((OneBitImageView*)self_arg), *((OneBitRleImageView*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case RLECC:
+return_arg = corelation_sum(*((OneBitImageView*)self_arg), *((RleCc*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case MLCC:
+return_arg = corelation_sum(*((OneBitImageView*)self_arg), *((MlCc*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'template' argument of 'corelation_sum' can not have pixel type '%s'. Acceptable values are ONEBIT, ONEBIT, ONEBIT, ONEBIT, and ONEBIT.", get_pixel_type_name(template_pyarg));
+return 0;
+}
+break;
+case CC:
+switch(get_image_combination(template_pyarg)) {
+case ONEBITIMAGEVIEW:
+return_arg = corelation_sum(*((Cc*)self_arg), *((OneBitImageView*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case CC:
+return_arg = corelation_sum(*((Cc*)self_arg), *((Cc*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case ONEBITRLEIMAGEVIEW:
+return_arg = corelation_sum(*((Cc*)self_arg), *((OneBitRleImageView*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case RLECC:
+return_arg = corelation_sum(*((Cc*)self_arg), *((RleCc*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case MLCC:
+return_arg = corelation_sum(*((Cc*)self_arg), *((MlCc*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'template' argument of 'corelation_sum' can not have pixel type '%s'. Acceptable values are ONEBIT, ONEBIT, ONEBIT, ONEBIT, and ONEBIT.", get_pixel_type_name(template_pyarg));
+return 0;
+}
+break;
+case ONEBITRLEIMAGEVIEW:
+switch(get_image_combination(template_pyarg)) {
+case ONEBITIMAGEVIEW:
+return_arg = corelation_sum(*((OneBitRleImageView*)self_arg), *((OneBitImageView*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case CC:
+return_arg = corelation_sum(*((OneBitRleImageView*)self_arg), *((Cc*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case ONEBITRLEIMAGEVIEW:
+return_arg = corelation_sum(*((OneBitRleImageView*)self_arg), *((OneBitRleImageView*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case RLECC:
+return_arg = corelation_sum(*((OneBitRleImageView*)self_arg), *((RleCc*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case MLCC:
+return_arg = corelation_sum(*((OneBitRleImageView*)self_arg), *((MlCc*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'template' argument of 'corelation_sum' can not have pixel type '%s'. Acceptable values are ONEBIT, ONEBIT, ONEBIT, ONEBIT, and ONEBIT.", get_pixel_type_name(template_pyarg));
+return 0;
+}
+break;
+case RLECC:
+switch(get_image_combination(template_pyarg)) {
+case ONEBITIMAGEVIEW:
+return_arg = corelation_sum(*((RleCc*)self_arg), *((OneBitImageView*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case CC:
+return_arg = corelation_sum(*((RleCc*)self_arg), *((Cc*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case ONEBITRLEIMAGEVIEW:
+return_arg = corelation_sum(*((RleCc*)self_arg), *((OneBitRleImageView*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case RLECC:
+return_arg = corelation_sum(*((RleCc*)self_arg), *((RleCc*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case MLCC:
+return_arg = corelation_sum(*((RleCc*)self_arg), *((MlCc*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'template' argument of 'corelation_sum' can not have pixel type '%s'. Acceptable values are ONEBIT, ONEBIT, ONEBIT, ONEBIT, and ONEBIT.", get_pixel_type_name(template_pyarg));
+return 0;
+}
+break;
+case MLCC:
+switch(get_image_combination(template_pyarg)) {
+case ONEBITIMAGEVIEW:
+return_arg = corelation_sum(*((MlCc*)self_arg), *((OneBitImageView*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case CC:
+return_arg = corelation_sum(*((MlCc*)self_arg), *((Cc*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case ONEBITRLEIMAGEVIEW:
+return_arg = corelation_sum(*((MlCc*)self_arg), *((OneBitRleImageView*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case RLECC:
+return_arg = corelation_sum(*((MlCc*)self_arg), *((RleCc*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case MLCC:
+return_arg = corelation_sum(*((MlCc*)self_arg), *((MlCc*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'template' argument of 'corelation_sum' can not have pixel type '%s'. Acceptable values are ONEBIT, ONEBIT, ONEBIT, ONEBIT, and ONEBIT.", get_pixel_type_name(template_pyarg));
+return 0;
+}
+break;
+case GREYSCALEIMAGEVIEW:
+switch(get_image_combination(template_pyarg)) {
+case ONEBITIMAGEVIEW:
+return_arg = corelation_sum(*((GreyScaleImageView*)self_arg), *((OneBitImageView*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case CC:
+return_arg = corelation_sum(*((GreyScaleImageView*)self_arg), *((Cc*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case ONEBITRLEIMAGEVIEW:
+return_arg = corelation_sum(*((GreyScaleImageView*)self_arg), *((OneBitRleImageView*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case RLECC:
+return_arg = corelation_sum(*((GreyScaleImageView*)self_arg), *((RleCc*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case MLCC:
+return_arg = corelation_sum(*((GreyScaleImageView*)self_arg), *((MlCc*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'template' argument of 'corelation_sum' can not have pixel type '%s'. Acceptable values are ONEBIT, ONEBIT, ONEBIT, ONEBIT, and ONEBIT.", get_pixel_type_name(template_pyarg));
+return 0;
+}
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'self' argument of 'corelation_sum' can not have pixel type '%s'. Acceptable values are ONEBIT, ONEBIT, ONEBIT, ONEBIT, ONEBIT, and GREYSCALE.", get_pixel_type_name(self_pyarg));
+return 0;
+}
+                  } catch (std::exception& e) {
+                    PyErr_SetString(PyExc_RuntimeError, e.what());
+          return 0;
+        }
+        stats_call.stop();
+                          stats_call.add_result(return_arg);
+                stats_call.record(plugin_stats, "corelation_sum", get_pixel_type(self_pyarg));
+      
+                                                                                return_pyarg = PyFloat_FromDouble((double)return_arg);            return return_pyarg;
+                              }
+
+                                                    static PyObject* call_corelation_sum_squares(PyObject* self, PyObject* args) {
+            
+      PyErr_Clear();
+                                                                                double return_arg;
+PyObject* return_pyarg;
+                                          Image* self_arg;
+PyObject* self_pyarg;
+                      Image* template_arg;
+PyObject* template_pyarg;
+                      Point offset_arg;
+PyObject* offset_pyarg;
+      
+                                      if (PyArg_ParseTuple(args, CHAR_PTR_CAST "OOO:corelation_sum_squares"
+                        ,
+             &self_pyarg                        ,
+             &template_pyarg                        ,
+             &offset_pyarg                      ) <= 0)
+           return 0;
+               
+              if (!is_ImageObject(self_pyarg)) {
+            PyErr_SetString(PyExc_TypeError, "Argument 'self' must be an image");
+            return 0;
+          }
+          self_arg = ((Image*)((RectObject*)self_pyarg)->m_x);
+          image_get_fv(self_pyarg, &self_arg->features, &self_arg->features_len);
+                        if (!is_ImageObject(template_pyarg)) {
+            PyErr_SetString(PyExc_TypeError, "Argument 'template' must be an image");
+            return 0;
+          }
+          template_arg = ((Image*)((RectObject*)template_pyarg)->m_x);
+          image_get_fv(template_pyarg, &template_arg->features, &template_arg->features_len);
+                        
+        try {
+           offset_arg = coerce_Point(offset_pyarg);
+        } catch (std::invalid_argument e) {
+           PyErr_SetString(PyExc_TypeError, "Argument 'offset' must be a Point, or convertible to a Point");
+           return 0;
+        }
+              
+            
+      PluginStatsCall stats_call;
+                        stats_call.add_image(self_arg);
+                                stats_call.add_image(template_arg);
+                                                
+                                      stats_call.start();
+        try {
+                      switch(get_image_combination(self_pyarg)) {
+case ONEBITIMAGEVIEW:
+switch(get_image_combination(template_pyarg)) {
+case ONEBITIMAGEVIEW:
+return_arg = corelation_sum_squares(*((OneBitImageView*)self_arg), *((OneBitImageView*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case CC:
+return_arg = corelation_sum_squares(*((OneBitImageView*)self_arg), *((Cc*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case ONEBITRLEIMAGEVIEW:
+return_arg = corelation_sum_squares(*((OneBitImageView*)self_arg), *((OneBitRleImageView*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case RLECC:
+return_arg = corelation_sum_squares(*((OneBitImageView*)self_arg), *((RleCc*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case MLCC:
+return_arg = corelation_sum_squares(*((OneBitImageView*)self_arg), *((MlCc*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'template' argument of 'corelation_sum_squares' can not have pixel type '%s'. Acceptable values are ONEBIT, ONEBIT, ONEBIT, ONEBIT, and ONEBIT.", get_pixel_type_name(template_pyarg));
+return 0;
+}
+break;
+case CC:
+switch(get_image_combination(template_pyarg)) {
+case ONEBITIMAGEVIEW:
+return_arg = corelation_sum_squares(*((Cc*)self_arg), *((OneBitImageView*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case CC:
+return_arg = corelation_sum_squares(*((Cc*)self_arg), *((Cc*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case ONEBITRLEIMAGEVIEW:
+return_arg = corelation_sum_squares(*((Cc*)self_arg), *((OneBitRleImageView*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case RLECC:
+return_arg = corelation_sum_squares(*((Cc*)self_arg), *((RleCc*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case MLCC:
+return_arg = corelation_sum_squares(*((Cc*)self_arg), *((MlCc*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'template' argument of 'corelation_sum_squares' can not have pixel type '%s'. Acceptable values are ONEBIT, ONEBIT, ONEBIT, ONEBIT, and ONEBIT.", get_pixel_type_name(template_pyarg));
+return 0;
+}
+break;
+case ONEBITRLEIMAGEVIEW:
+switch(get_image_combination(template_pyarg)) {
+case ONEBITIMAGEVIEW:
+return_arg = corelation_sum_squares(*((OneBitRleImageView*)self_arg), *((OneBitImageView*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case CC:
+return_arg = corelation_sum_squares(*((OneBitRleImageView*)self_arg), *((Cc*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case ONEBITRLEIMAGEVIEW:
+return_arg = corelation_sum_squares(*((OneBitRleImageView*)self_arg), *((OneBitRleImageView*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case RLECC:
+return_arg = corelation_sum_squares(*((OneBitRleImageView*)self_arg), *((RleCc*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case MLCC:
+return_arg = corelation_sum_squares(*((OneBitRleImageView*)self_arg), *((MlCc*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'template' argument of 'corelation_sum_squares' can not have pixel type '%s'. Acceptable values are ONEBIT, ONEBIT, ONEBIT, ONEBIT, and ONEBIT.", get_pixel_type_name(template_pyarg));
+return 0;
+}
+break;
+case RLECC:
+switch(get_image_combination(template_pyarg)) {
+case ONEBITIMAGEVIEW:
+return_arg = corelation_sum_squares(*((RleCc*)self_arg), *((OneBitImageView*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case CC:
+return_arg = corelation_sum_squares(*((RleCc*)self_arg), *((Cc*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case ONEBITRLEIMAGEVIEW:
+return_arg = corelation_sum_squares(*((RleCc*)self_arg), *((OneBitRleImageView*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case RLECC:
+return_arg = corelation_sum_squares(*((RleCc*)self_arg), *((RleCc*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case MLCC:
+return_arg = corelation_sum_squares(*((RleCc*)self_arg), *((MlCc*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'template' argument of 'corelation_sum_squares' can not have pixel type '%s'. Acceptable values are ONEBIT, ONEBIT, ONEBIT, ONEBIT, and ONEBIT.", get_pixel_type_name(template_pyarg));
+return 0;
+}
+break;
+case MLCC:
+switch(get_image_combination(template_pyarg)) {
+case ONEBITIMAGEVIEW:
+return_arg = corelation_sum_squares(*((MlCc*)self_arg), *((OneBitImageView*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case CC:
+return_arg = corelation_sum_squares(*((MlCc*)self_arg), *((Cc*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case ONEBITRLEIMAGEVIEW:
+return_arg = corelation_sum_squares(*((MlCc*)self_arg), *((OneBitRleImageView*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case RLECC:
+return_arg = corelation_sum_squares(*((MlCc*)self_arg), *((RleCc*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case MLCC:
+return_arg = corelation_sum_squares(*((MlCc*)self_arg), *((MlCc*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'template' argument of 'corelation_sum_squares' can not have pixel type '%s'. Acceptable values are ONEBIT, ONEBIT, ONEBIT, ONEBIT, and ONEBIT.", get_pixel_type_name(template_pyarg));
+return 0;
+}
+break;
+case GREYSCALEIMAGEVIEW:
+switch(get_image_combination(template_pyarg)) {
+case ONEBITIMAGEVIEW:
+return_arg = corelation_sum_squares(*((GreyScaleImageView*)self_arg), *((OneBitImageView*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case CC:
+return_arg = corelation_sum_squares(*((GreyScaleImageView*)self_arg), *((Cc*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case ONEBITRLEIMAGEVIEW:
+return_arg = corelation_sum_squares(*((GreyScaleImageView*)self_arg), *((OneBitRleImageView*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case RLECC:
+return_arg = corelation_sum_squares(*((GreyScaleImageView*)self_arg), *((RleCc*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+case MLCC:
+return_arg = corelation_sum_squares(*((GreyScaleImageView*)self_arg), *((MlCc*)template_arg), offset_arg, ProgressBar((char *)"Correlating"));
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'template' argument of 'corelation_sum_squares' can not have pixel type '%s'. Acceptable values are ONEBIT, ONEBIT, ONEBIT, ONEBIT, and ONEBIT.", get_pixel_type_name(template_pyarg));
+return 0;
+}
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'self' argument of 'corelation_sum_squares' can not have pixel type '%s'. Acceptable values are ONEBIT, ONEBIT, ONEBIT, ONEBIT, ONEBIT, and GREYSCALE.", get_pixel_type_name(self_pyarg));
+return 0;
+}
+                  } catch (std::exception& e) {
+                    PyErr_SetString(PyExc_RuntimeError, e.what());
+          return 0;
+        }
+        stats_call.stop();
+                          stats_call.add_result(return_arg);
+                stats_call.record(plugin_stats, "corelation_sum_squares", get_pixel_type(self_pyarg));
+      
+                                                                                return_pyarg = PyFloat_FromDouble((double)return_arg);            return return_pyarg;
+                              }
+
+                                                    static PyObject* call_corelation_weighted_map(PyObject* self, PyObject* args) {
+            
+      PyErr_Clear();
+                                                                                Image* return_arg;
+PyObject* return_pyarg;
+                                          Image* self_arg;
+PyObject* self_pyarg;
+                      Image* template_arg;
+PyObject* template_pyarg;
+                      double bb_arg;
+                      double bw_arg;
+                      double wb_arg;
+                      double ww_arg;
+      
+                                      if (PyArg_ParseTuple(args, CHAR_PTR_CAST "OOdddd:corelation_weighted_map"
+                        ,
+             &self_pyarg                        ,
+             &template_pyarg                        ,
+             &bb_arg                        ,
+             &bw_arg                        ,
+             &wb_arg                        ,
+             &ww_arg                      ) <= 0)
+           return 0;
+               
+              if (!is_ImageObject(self_pyarg)) {
+            PyErr_SetString(PyExc_TypeError, "Argument 'self' must be an image");
+            return 0;
+          }
+          self_arg = ((Image*)((RectObject*)self_pyarg)->m_x);
+          image_get_fv(self_pyarg, &self_arg->features, &self_arg->features_len);
+                        if (!is_ImageObject(template_pyarg)) {
+            PyErr_SetString(PyExc_TypeError, "Argument 'template' must be an image");
+            return 0;
+          }
+          template_arg = ((Image*)((RectObject*)template_pyarg)->m_x);
+          image_get_fv(template_pyarg, &template_arg->features, &template_arg->features_len);
+                                                                        
+            
+      PluginStatsCall stats_call;
+                        stats_call.add_image(self_arg);
+                                stats_call.add_image(template_arg);
+                                                                                          
+                                      stats_call.start();
+        try {
+                      switch(get_image_combination(self_pyarg)) {
+case ONEBITIMAGEVIEW:
+switch(get_image_combination(template_pyarg)) {
+case ONEBITIMAGEVIEW:
+return_arg = corelation_weighted_map(*((OneBitImageView*)self_arg), *((OneBitImageView*)template_arg), bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case CC:
+return_arg = corelation_weighted_map(*((OneBitImageView*)self_arg), *((Cc*)template_arg), bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case ONEBITRLEIMAGEVIEW:
+return_arg = corelation_weighted_map(*((OneBitImageView*)self_arg), *((OneBitRleImageView*)template_arg), bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case RLECC:
+return_arg = corelation_weighted_map(*((OneBitImageView*)self_arg), *((RleCc*)template_arg), bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case MLCC:
+return_arg = corelation_weighted_map(*((OneBitImageView*)self_arg), *((MlCc*)template_arg), bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'template' argument of 'corelation_weighted_map' can not have pixel type '%s'. Acceptable values are ONEBIT, ONEBIT, ONEBIT, ONEBIT, and ONEBIT.", get_pixel_type_name(template_pyarg));
+return 0;
+}
+break;
+case CC:
+switch(get_image_combination(template_pyarg)) {
+case ONEBITIMAGEVIEW:
+return_arg = corelation_weighted_map(*((Cc*)self_arg), *((OneBitImageView*)template_arg), bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case CC:
+return_arg = corelation_weighted_map(*((Cc*)self_arg), *((Cc*)template_arg), bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case ONEBITRLEIMAGEVIEW:
+return_arg = corelation_weighted_map(*((Cc*)self_arg), *((OneBitRleImageView*)template_arg), bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case RLECC:
+return_arg = corelation_weighted_map(*((Cc*)self_arg), *((RleCc*)template_arg), bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case MLCC:
+return_arg = corelation_weighted_map(*((Cc*)self_arg), *((MlCc*)template_arg), bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'template' argument of 'corelation_weighted_map' can not have pixel type '%s'. Acceptable values are ONEBIT, ONEBIT, ONEBIT, ONEBIT, and ONEBIT.", get_pixel_type_name(template_pyarg));
+return 0;
+}
+break;
+case ONEBITRLEIMAGEVIEW:
+switch(get_image_combination(template_pyarg)) {
+case ONEBITIMAGEVIEW:
+return_arg = corelation_weighted_map(*((OneBitRleImageView*)self_arg), *((OneBitImageView*)template_arg), bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case CC:
+return_arg = corelation_weighted_map(*((OneBitRleImageView*)self_arg), *((Cc*)template_arg), bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case ONEBITRLEIMAGEVIEW:
+return_arg = corelation_weighted_map(*((OneBitRleImageView*)self_arg), *((OneBitRleImageView*)template_arg), bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case RLECC:
+return_arg = corelation_weighted_map(*((OneBitRleImageView*)self_arg), *((RleCc*)template_arg), bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case MLCC:
+return_arg = corelation_weighted_map(*((OneBitRleImageView*)self_arg), *((MlCc*)template_arg), bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'template' argument of 'corelation_weighted_map' can not have pixel type '%s'. Acceptable values are ONEBIT, ONEBIT, ONEBIT, ONEBIT, and ONEBIT.", get_pixel_type_name(template_pyarg));
+return 0;
+}
+break;
+case RLECC:
+switch(get_image_combination(template_pyarg)) {
+case ONEBITIMAGEVIEW:
+return_arg = corelation_weighted_map(*((RleCc*)self_arg), *((OneBitImageView*)template_arg), bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case CC:
+return_arg = corelation_weighted_map(*((RleCc*)self_arg), *((Cc*)template_arg), bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case ONEBITRLEIMAGEVIEW:
+return_arg = corelation_weighted_map(*((RleCc*)self_arg), *((OneBitRleImageView*)template_arg), bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case RLECC:
+return_arg = corelation_weighted_map(*((RleCc*)self_arg), *((RleCc*)template_arg), bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case MLCC:
+return_arg = corelation_weighted_map(*((RleCc*)self_arg), *((MlCc*)template_arg), bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'template' argument of 'corelation_weighted_map' can not have pixel type '%s'. Acceptable values are ONEBIT, ONEBIT, ONEBIT, ONEBIT, and ONEBIT.", get_pixel_type_name(template_pyarg));
+return 0;
+}
+break;
+case MLCC:
+switch(get_image_combination(template_pyarg)) {
+case ONEBITIMAGEVIEW:
+return_arg = corelation_weighted_map(*((MlCc*)self_arg), *((OneBitImageView*)template_arg), bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case CC:
+return_arg = corelation_weighted_map(*((MlCc*)self_arg), *((Cc*)template_arg), bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case ONEBITRLEIMAGEVIEW:
+return_arg = corelation_weighted_map(*((MlCc*)self_arg), *((OneBitRleImageView*)template_arg), bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case RLECC:
+return_arg = corelation_weighted_map(*((MlCc*)self_arg), *((RleCc*)template_arg), bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case MLCC:
+return_arg = corelation_weighted_map(*((MlCc*)self_arg), *((MlCc*)template_arg), bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'template' argument of 'corelation_weighted_map' can not have pixel type '%s'. Acceptable values are ONEBIT, ONEBIT, ONEBIT, ONEBIT, and ONEBIT.", get_pixel_type_name(template_pyarg));
+return 0;
+}
+break;
+case GREYSCALEIMAGEVIEW:
+switch(get_image_combination(template_pyarg)) {
+case ONEBITIMAGEVIEW:
+return_arg = corelation_weighted_map(*((GreyScaleImageView*)self_arg), *((OneBitImageView*)template_arg), bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case CC:
+return_arg = corelation_weighted_map(*((GreyScaleImageView*)self_arg), *((Cc*)template_arg), bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case ONEBITRLEIMAGEVIEW:
+return_arg = corelation_weighted_map(*((GreyScaleImageView*)self_arg), *((OneBitRleImageView*)template_arg), bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case RLECC:
+return_arg = corelation_weighted_map(*((GreyScaleImageView*)self_arg), *((RleCc*)template_arg), bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+case MLCC:
+return_arg = corelation_weighted_map(*((GreyScaleImageView*)self_arg), *((MlCc*)template_arg), bb_arg, bw_arg, wb_arg, ww_arg);
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'template' argument of 'corelation_weighted_map' can not have pixel type '%s'. Acceptable values are ONEBIT, ONEBIT, ONEBIT, ONEBIT, and ONEBIT.", get_pixel_type_name(template_pyarg));
+return 0;
+}
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'self' argument of 'corelation_weighted_map' can not have pixel type '%s'. Acceptable values are ONEBIT, ONEBIT, ONEBIT, ONEBIT, ONEBIT, and GREYSCALE.", get_pixel_type_name(self_pyarg));
+return 0;
+}
+                  } catch (std::exception& e) {
+                    PyErr_SetString(PyExc_RuntimeError, e.what());
+          return 0;
+        }
+        stats_call.stop();
+                          stats_call.add_result(return_arg);
+                stats_call.record(plugin_stats, "corelation_weighted_map", get_pixel_type(self_pyarg));
+      
+                                                                                                                                      if (return_arg== NULL) {
+              if (PyErr_Occurred() == NULL) {
+                Py_INCREF(Py_None);
+                return Py_None;
+               } else
+                return NULL;
+            } else {
+              return_pyarg = create_ImageObject(return_arg);              return return_pyarg;
+            }
+                              }
+
+                                                    static PyObject* call_corelation_sum_map(PyObject* self, PyObject* args) {
+            
+      PyErr_Clear();
+                                                                                Image* return_arg;
+PyObject* return_pyarg;
+                                          Image* self_arg;
+PyObject* self_pyarg;
+                      Image* template_arg;
+PyObject* template_pyarg;
+      
+                                      if (PyArg_ParseTuple(args, CHAR_PTR_CAST "OO:corelation_sum_map"
+                        ,
+             &self_pyarg                        ,
+             &template_pyarg                      ) <= 0)
+           return 0;
+               
+              if (!is_ImageObject(self_pyarg)) {
+            PyErr_SetString(PyExc_TypeError, "Argument 'self' must be an image");
+            return 0;
+          }
+          self_arg = ((Image*)((RectObject*)self_pyarg)->m_x);
+          image_get_fv(self_pyarg, &self_arg->features, &self_arg->features_len);
+                        if (!is_ImageObject(template_pyarg)) {
+            PyErr_SetString(PyExc_TypeError, "Argument 'template' must be an image");
+            return 0;
+          }
+          template_arg = ((Image*)((RectObject*)template_pyarg)->m_x);
+          image_get_fv(template_pyarg, &template_arg->features, &template_arg->features_len);
+                
+            
+      PluginStatsCall stats_call;
+                        stats_call.add_image(self_arg);
+                                stats_call.add_image(template_arg);
+                                  
+                                      stats_call.start();
+        try {
+                      switch(get_image_combination(self_pyarg)) {
+case ONEBITIMAGEVIEW:
+switch(get_image_combination(template_pyarg)) {
+case ONEBITIMAGEVIEW:
+return_arg = corelation_sum_map(*((OneBitImageView*)self_arg), *((OneBitImageView*)template_arg));
+break;
+case CC:
+return_arg = corelation_sum_map(*((OneBitImageView*)self_arg), *((Cc*)template_arg));
+break;
+case ONEBITRLEIMAGEVIEW:
+return_arg = corelation_sum_map(*((OneBitImageView*)self_arg), *((OneBitRleImageView*)template_arg));
+break;
+case RLECC:
+return_arg = corelation_sum_map(*((OneBitImageView*)self_arg), *((RleCc*)template_arg));
+break;
+case MLCC:
+return_arg = corelation_sum_map(*((OneBitImageView*)self_arg), *((MlCc*)template_arg));
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'template' argument of 'corelation_sum_map' can not have pixel type '%s'. Acceptable values are ONEBIT, ONEBIT, ONEBIT, ONEBIT, and ONEBIT.", get_pixel_type_name(template_pyarg));
+return 0;
+}
+break;
+case CC:
+switch(get_image_combination(template_pyarg)) {
+case ONEBITIMAGEVIEW:
+return_arg = corelation_sum_map(*((Cc*)self_arg), *((OneBitImageView*)template_arg));
+break;
+case CC:
+return_arg = corelation_sum_map(*((Cc*)self_arg), *((Cc*)template_arg));
+break;
+case ONEBITRLEIMAGEVIEW:
+return_arg = corelation_sum_map(*((Cc*)self_arg), *((OneBitRleImageView*)template_arg));
+break;
+case RLECC:
+return_arg = corelation_sum_map(*((Cc*)self_arg), *((RleCc*)template_arg));
+break;
+case MLCC:
+return_arg = corelation_sum_map(*((Cc*)self_arg), *((MlCc*)template_arg));
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'template' argument of 'corelation_sum_map' can not have pixel type '%s'. Acceptable values are ONEBIT, ONEBIT, ONEBIT, ONEBIT, and ONEBIT.", get_pixel_type_name(template_pyarg));
+return 0;
+}
+break;
+case ONEBITRLEIMAGEVIEW:
+switch(get_image_combination(template_pyarg)) {
+case ONEBITIMAGEVIEW:
+return_arg = corelation_sum_map(*((OneBitRleImageView*)self_arg), *((OneBitImageView*)template_arg));
+break;
+case CC:
+return_arg = corelation_sum_map(*((OneBitRleImageView*)self_arg), *((Cc*)template_arg));
+break;
+case ONEBITRLEIMAGEVIEW:
+return_arg = corelation_sum_map(*((OneBitRleImageView*)self_arg), *((OneBitRleImageView*)template_arg));
+break;
+case RLECC:
+return_arg = corelation_sum_map(*((OneBitRleImageView*)self_arg), *((RleCc*)template_arg));
+break;
+case MLCC:
+return_arg = corelation_sum_map(*((OneBitRleImageView*)self_arg), *((MlCc*)template_arg));
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'template' argument of 'corelation_sum_map' can not have pixel type '%s'. Acceptable values are ONEBIT, ONEBIT, ONEBIT, ONEBIT, and ONEBIT.", get_pixel_type_name(template_pyarg));
+return 0;
+}
+break;
+case RLECC:
+switch(get_image_combination(template_pyarg)) {
+case ONEBITIMAGEVIEW:
+return_arg = corelation_sum_map(*((RleCc*)self_arg), *((OneBitImageView*)template_arg));
+break;
+case CC:
+return_arg = corelation_sum_map(*((RleCc*)self_arg), *((Cc*)template_arg));
+break;
+case ONEBITRLEIMAGEVIEW:
+return_arg = corelation_sum_map(*((RleCc*)self_arg), *((OneBitRleImageView*)template_arg));
+break;
+case RLECC:
+return_arg = corelation_sum_map(*((RleCc*)self_arg), *((RleCc*)template_arg));
+break;
+case MLCC:
+return_arg = corelation_sum_map(*((RleCc*)self_arg), *((MlCc*)template_arg));
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'template' argument of 'corelation_sum_map' can not have pixel type '%s'. Acceptable values are ONEBIT, ONEBIT, ONEBIT, ONEBIT, and ONEBIT.", get_pixel_type_name(template_pyarg));
+return 0;
+}
+break;
+case MLCC:
+switch(get_image_combination(template_pyarg)) {
+case ONEBITIMAGEVIEW:
+return_arg = corelation_sum_map(*((MlCc*)self_arg), *((OneBitImageView*)template_arg));
+break;
+case CC:
+return_arg = corelation_sum_map(*((MlCc*)self_arg), *((Cc*)template_arg));
+break;
+case ONEBITRLEIMAGEVIEW:
+return_arg = corelation_sum_map(*((MlCc*)self_arg), *((OneBitRleImageView*)template_arg));
+break;
+case RLECC:
+return_arg = corelation_sum_map(*((MlCc*)self_arg), *((RleCc*)template_arg));
+break;
+case MLCC:
+return_arg = corelation_sum_map(*((MlCc*)self_arg), *((MlCc*)template_arg));
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'template' argument of 'corelation_sum_map' can not have pixel type '%s'. Acceptable values are ONEBIT, ONEBIT, ONEBIT, ONEBIT, and ONEBIT.", get_pixel_type_name(template_pyarg));
+return 0;
+}
+break;
+case GREYSCALEIMAGEVIEW:
+switch(get_image_combination(template_pyarg)) {
+case ONEBITIMAGEVIEW:
+return_arg = corelation_sum_map(*((GreyScaleImageView*)self_arg), *((OneBitImageView*)template_arg));
+break;
+case CC:
+return_arg = corelation_sum_map(*((GreyScaleImageView*)self_arg), *((Cc*)template_arg));
+break;
+case ONEBITRLEIMAGEVIEW:
+return_arg = corelation_sum_map(*((GreyScaleImageView*)self_arg), *((OneBitRleImageView*)template_arg));
+break;
+case RLECC:
+return_arg = corelation_sum_map(*((GreyScaleImageView*)self_arg), *((RleCc*)template_arg));
+break;
+case MLCC:
+return_arg = corelation_sum_map(*((GreyScaleImageView*)self_arg), *((MlCc*)template_arg));
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'template' argument of 'corelation_sum_map' can not have pixel type '%s'. Acceptable values are ONEBIT, ONEBIT, ONEBIT, ONEBIT, and ONEBIT.", get_pixel_type_name(template_pyarg));
+return 0;
+}
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'self' argument of 'corelation_sum_map' can not have pixel type '%s'. Acceptable values are ONEBIT, ONEBIT, ONEBIT, ONEBIT, ONEBIT, and GREYSCALE.", get_pixel_type_name(self_pyarg));
+return 0;
+}
+                  } catch (std::exception& e) {
+                    PyErr_SetString(PyExc_RuntimeError, e.what());
+          return 0;
+        }
+        stats_call.stop();
+                          stats_call.add_result(return_arg);
+                stats_call.record(plugin_stats, "corelation_sum_map", get_pixel_type(self_pyarg));
+      
+                                                              if (return_arg== NULL) {
+              if (PyErr_Occurred() == NULL) {
+                Py_INCREF(Py_None);
+                return Py_None;
+               } else
+                return NULL;
+            } else {
+              return_pyarg = create_ImageObject(return_arg);              return return_pyarg;
+            }
+                              }
+
+                                                    static PyObject* call_corelation_sum_squares_map(PyObject* self, PyObject* args) {
+            
+      PyErr_Clear();
+                                                                                Image* return_arg;
+PyObject* return_pyarg;
+                                          Image* self_arg;
+PyObject* self_pyarg;
+                      Image* template_arg;
+PyObject* template_pyarg;
+      
+                                      if (PyArg_ParseTuple(args, CHAR_PTR_CAST "OO:corelation_sum_squares_map"
+                        ,
+             &self_pyarg                        ,
+             &template_pyarg                      ) <= 0)
+           return 0;
+               
+              if (!is_ImageObject(self_pyarg)) {
+            PyErr_SetString(PyExc_TypeError, "Argument 'self' must be an image");
+            return 0;
+          }
+          self_arg = ((Image*)((RectObject*)self_pyarg)->m_x);
+          image_get_fv(self_pyarg, &self_arg->features, &self_arg->features_len);
+                        if (!is_ImageObject(template_pyarg)) {
+            PyErr_SetString(PyExc_TypeError, "Argument 'template' must be an image");
+            return 0;
+          }
+          template_arg = ((Image*)((RectObject*)template_pyarg)->m_x);
+          image_get_fv(template_pyarg, &template_arg->features, &template_arg->features_len);
+                
+            
+      PluginStatsCall stats_call;
+                        stats_call.add_image(self_arg);
+                                stats_call.add_image(template_arg);
+                                  
+                                      stats_call.start();
+        try {
+                      switch(get_image_combination(self_pyarg)) {
+case ONEBITIMAGEVIEW:
+switch(get_image_combination(template_pyarg)) {
+case ONEBITIMAGEVIEW:
+return_arg = corelation_sum_squares_map(*((OneBitImageView*)self_arg), *((OneBitImageView*)template_arg));
+break;
+case CC:
+return_arg = corelation_sum_squares_map(*((OneBitImageView*)self_arg), *((Cc*)template_arg));
+break;
+case ONEBITRLEIMAGEVIEW:
+return_arg = corelation_sum_squares_map(*((OneBitImageView*)self_arg), *((OneBitRleImageView*)template_arg));
+break;
+case RLECC:
+return_arg = corelation_sum_squares_map(*((OneBitImageView*)self_arg), *((RleCc*)template_arg));
+break;
+case MLCC:
+return_arg = corelation_sum_squares_map(*((OneBitImageView*)self_arg), *((MlCc*)template_arg));
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'template' argument of 'corelation_sum_squares_map' can not have pixel type '%s'. Acceptable values are ONEBIT, ONEBIT, ONEBIT, ONEBIT, and ONEBIT.", get_pixel_type_name(template_pyarg));
+return 0;
+}
+break;
+case CC:
+switch(get_image_combination(template_pyarg)) {
+case ONEBITIMAGEVIEW:
+return_arg = corelation_sum_squares_map(*((Cc*)self_arg), *((OneBitImageView*)template_arg));
+break;
+case CC:
+return_arg = corelation_sum_squares_map(*((Cc*)self_arg), *((Cc*)template_arg));
+break;
+case ONEBITRLEIMAGEVIEW:
+return_arg = corelation_sum_squares_map(*((Cc*)self_arg), *((OneBitRleImageView*)template_arg));
+break;
+case RLECC:
+return_arg = corelation_sum_squares_map(*((Cc*)self_arg), *((RleCc*)template_arg));
+break;
+case MLCC:
+return_arg = corelation_sum_squares_map(*((Cc*)self_arg), *((MlCc*)template_arg));
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'template' argument of 'corelation_sum_squares_map' can not have pixel type '%s'. Acceptable values are ONEBIT, ONEBIT, ONEBIT, ONEBIT, and ONEBIT.", get_pixel_type_name(template_pyarg));
+return 0;
+}
+break;
+case ONEBITRLEIMAGEVIEW:
+switch(get_image_combination(template_pyarg)) {
+case ONEBITIMAGEVIEW:
+return_arg = corelation_sum_squares_map(*((OneBitRleImageView*)self_arg), *((OneBitImageView*)template_arg));
+break;
+case CC:
+return_arg = corelation_sum_squares_map(*((OneBitRleImageView*)self_arg), *((Cc*)template_arg));
+break;
+case ONEBITRLEIMAGEVIEW:
+return_arg = corelation_sum_squares_map(*((OneBitRleImageView*)self_arg), *((OneBitRleImageView*)template_arg));
+break;
+case RLECC:
+return_arg = corelation_sum_squares_map(*((OneBitRleImageView*)self_arg), *((RleCc*)template_arg));
+break;
+case MLCC:
+return_arg = corelation_sum_squares_map(*((OneBitRleImageView*)self_arg), *((MlCc*)template_arg));
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'template' argument of 'corelation_sum_squares_map' can not have pixel type '%s'. Acceptable values are ONEBIT, ONEBIT, ONEBIT, ONEBIT, and ONEBIT.", get_pixel_type_name(template_pyarg));
+return 0;
+}
+break;
+case RLECC:
+switch(get_image_combination(template_pyarg)) {
+case ONEBITIMAGEVIEW:
+return_arg = corelation_sum_squares_map(*((RleCc*)self_arg), *((OneBitImageView*)template_arg));
+break;
+case CC:
+return_arg = corelation_sum_squares_map(*((RleCc*)self_arg), *((Cc*)template_arg));
+break;
+case ONEBITRLEIMAGEVIEW:
+return_arg = corelation_sum_squares_map(*((RleCc*)self_arg), *((OneBitRleImageView*)template_arg));
+break;
+case RLECC:
+return_arg = corelation_sum_squares_map(*((RleCc*)self_arg), *((RleCc*)template_arg));
+break;
+case MLCC:
+return_arg = corelation_sum_squares_map(*((RleCc*)self_arg), *((MlCc*)template_arg));
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'template' argument of 'corelation_sum_squares_map' can not have pixel type '%s'. Acceptable values are ONEBIT, ONEBIT, ONEBIT, ONEBIT, and ONEBIT.", get_pixel_type_name(template_pyarg));
+return 0;
+}
+break;
+case MLCC:
+switch(get_image_combination(template_pyarg)) {
+case ONEBITIMAGEVIEW:
+return_arg = corelation_sum_squares_map(*((MlCc*)self_arg), *((OneBitImageView*)template_arg));
+break;
+case CC:
+return_arg = corelation_sum_squares_map(*((MlCc*)self_arg), *((Cc*)template_arg));
+break;
+case ONEBITRLEIMAGEVIEW:
+return_arg = corelation_sum_squares_map(*((MlCc*)self_arg), *((OneBitRleImageView*)template_arg));
+break;
+case RLECC:
+return_arg = corelation_sum_squares_map(*((MlCc*)self_arg), *((RleCc*)template_arg));
+break;
+case MLCC:
+return_arg = corelation_sum_squares_map(*((MlCc*)self_arg), *((MlCc*)template_arg));
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'template' argument of 'corelation_sum_squares_map' can not have pixel type '%s'. Acceptable values are ONEBIT, ONEBIT, ONEBIT, ONEBIT, and ONEBIT.", get_pixel_type_name(template_pyarg));
+return 0;
+}
+break;
+case GREYSCALEIMAGEVIEW:
+switch(get_image_combination(template_pyarg)) {
+case ONEBITIMAGEVIEW:
+return_arg = corelation_sum_squares_map(*((GreyScaleImageView*)self_arg), *((OneBitImageView*)template_arg));
+break;
+case CC:
+return_arg = corelation_sum_squares_map(*((GreyScaleImageView*)self_arg), *((Cc*)template_arg));
+break;
+case ONEBITRLEIMAGEVIEW:
+return_arg = corelation_sum_squares_map(*((GreyScaleImageView*)self_arg), *((OneBitRleImageView*)template_arg));
+break;
+case RLECC:
+return_arg = corelation_sum_squares_map(*((GreyScaleImageView*)self_arg), *((RleCc*)template_arg));
+break;
+case MLCC:
+return_arg = corelation_sum_squares_map(*((GreyScaleImageView*)self_arg), *((MlCc*)template_arg));
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'template' argument of 'corelation_sum_squares_map' can not have pixel type '%s'. Acceptable values are ONEBIT, ONEBIT, ONEBIT, ONEBIT, and ONEBIT.", get_pixel_type_name(template_pyarg));
+return 0;
+}
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'self' argument of 'corelation_sum_squares_map' can not have pixel type '%s'. Acceptable values are ONEBIT, ONEBIT, ONEBIT, ONEBIT, ONEBIT, and GREYSCALE.", get_pixel_type_name(self_pyarg));
+return 0;
+}
+                  } catch (std::exception& e) {
+                    PyErr_SetString(PyExc_RuntimeError, e.what());
+          return 0;
+        }
+        stats_call.stop();
+                          stats_call.add_result(return_arg);
+                stats_call.record(plugin_stats, "corelation_sum_squares_map", get_pixel_type(self_pyarg));
+      
+                                                              if (return_arg== NULL) {
+              if (PyErr_Occurred() == NULL) {
+                Py_INCREF(Py_None);
+                return Py_None;
+               } else
+                return NULL;
+            } else {
+              return_pyarg = create_ImageObject(return_arg);              return return_pyarg;
+            }
+                              }
+
+                                                    static PyObject* call_corelation_best_offsets(PyObject* self, PyObject* args) {
+            
+      PyErr_Clear();
+                                                                                PyObject* return_arg;
+PyObject* return_pyarg;
+                                          Image* self_arg;
+PyObject* self_pyarg;
+                      int n_arg;
+                      int largest_arg;
+                      int min_distance_arg;
+      
+                                      if (PyArg_ParseTuple(args, CHAR_PTR_CAST "Oiii:corelation_best_offsets"
+                        ,
+             &self_pyarg                        ,
+             &n_arg                        ,
+             &largest_arg                        ,
+             &min_distance_arg                      ) <= 0)
+           return 0;
+               
+              if (!is_ImageObject(self_pyarg)) {
+            PyErr_SetString(PyExc_TypeError, "Argument 'self' must be an image");
+            return 0;
+          }
+          self_arg = ((Image*)((RectObject*)self_pyarg)->m_x);
+          image_get_fv(self_pyarg, &self_arg->features, &self_arg->features_len);
+                                                          
+            
+      PluginStatsCall stats_call;
+                        stats_call.add_image(self_arg);
+                                                                            
+                                      stats_call.start();
+        try {
+                      switch(get_image_combination(self_pyarg)) {
+case FLOATIMAGEVIEW:
+return_arg = corelation_best_offsets(*((FloatImageView*)self_arg), n_arg, largest_arg, min_distance_arg);
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'self' argument of 'corelation_best_offsets' can not have pixel type '%s'. Acceptable value is FLOAT.", get_pixel_type_name(self_pyarg));
+return 0;
+}
+                  } catch (std::exception& e) {
+                    PyErr_SetString(PyExc_RuntimeError, e.what());
+          return 0;
+        }
+        stats_call.stop();
+                          stats_call.add_result(return_arg);
+                stats_call.record(plugin_stats, "corelation_best_offsets", get_pixel_type(self_pyarg));
+      
+                                                                                                  if (return_arg== NULL) {
+              if (PyErr_Occurred() == NULL) {
+                Py_INCREF(Py_None);
+                return Py_None;
+               } else
+                return NULL;
+            } else {
+              return_pyarg = return_arg;              return return_pyarg;
+            }
+                              }
+
+                                          
+  DL_EXPORT(void) init_corelation(void) {
+    Py_InitModule(CHAR_PTR_CAST "_corelation", _corelation_methods);
+  }
+  
+
@@ -0,0 +1,418 @@
+
+          
+    
+  #include "gameramodule.hpp"
+  #include "knnmodule.hpp"
+  #include "plugin_stats.hpp"
+
+        #include "edgedetect.hpp"
+  
+    #include <string>
+  #include <stdexcept>
+  #include "Python.h"
+  #include <list>
+
+  using namespace Gamera;
+  
+        
+      extern "C" {
+#ifndef _MSC_VER
+    void init_edgedetect(void);
+#endif
+    static PyObject* call_plugin_stats(PyObject* self, PyObject* args);
+    static PyObject* call_reset_plugin_stats(PyObject* self, PyObject* args);
+                  static PyObject* call_difference_of_exponential_edge_image(PyObject* self, PyObject* args);
+                                static PyObject* call_difference_of_exponential_crack_edge_image(PyObject* self, PyObject* args);
+                                static PyObject* call_canny_edge_image(PyObject* self, PyObject* args);
+                                static PyObject* call_labeled_region_edges(PyObject* self, PyObject* args);
+                                static PyObject* call_outline(PyObject* self, PyObject* args);
+                    }
+
+          static PyMethodDef _edgedetect_methods[] = {
+                  { CHAR_PTR_CAST "difference_of_exponential_edge_image",
+          call_difference_of_exponential_edge_image, METH_VARARGS,
+          CHAR_PTR_CAST "**difference_of_exponential_edge_image** (float(0.00, 1000000000000000052504760255204420248704468581108159154915854115511802457988908195786371375080447864043704443832883878176942523235360430575644792184786706982848387200926575803737830233794788090059368953234970799945081119038967640880074652742780142494579258788820056842838115669472196386865459400540160.00) *scale* = 0.80, float(0.00, 1000000000000000052504760255204420248704468581108159154915854115511802457988908195786371375080447864043704443832883878176942523235360430575644792184786706982848387200926575803737830233794788090059368953234970799945081119038967640880074652742780142494579258788820056842838115669472196386865459400540160.00) *gradient_threshold* = 4.00, int(0, 32000) *min_edge_length* = 0)\n\nEXPERIMENTAL\n\nDetect and mark edges in an edge image using the Shen/Castan\nzero-crossing detector.\n\nUses code from the VIGRA Computer Vision Library (Copyright\n1998-2007 by Ullrich Köthe).\n\n*scale*\n  The scale relates to the value b of the exponential filter.\n\n*gradient_threshold*\n  Whenever the gradient at a zero crossing is greater than the\n  given gradient_threshold, an edge point is marked in the\n  destination image on the darker side of the zero crossing (the\n  zero crossing occurs between pixels).\n\n*min_edge_length*\n  Removes all edges shorter than the number of pixels specified\n  (0 retains all edges).  Values near 10 are suggested."        },
+                                { CHAR_PTR_CAST "difference_of_exponential_crack_edge_image",
+          call_difference_of_exponential_crack_edge_image, METH_VARARGS,
+          CHAR_PTR_CAST "**difference_of_exponential_crack_edge_image** (float(0.00, 1000000000000000052504760255204420248704468581108159154915854115511802457988908195786371375080447864043704443832883878176942523235360430575644792184786706982848387200926575803737830233794788090059368953234970799945081119038967640880074652742780142494579258788820056842838115669472196386865459400540160.00) *scale* = 0.80, float(0.00, 1000000000000000052504760255204420248704468581108159154915854115511802457988908195786371375080447864043704443832883878176942523235360430575644792184786706982848387200926575803737830233794788090059368953234970799945081119038967640880074652742780142494579258788820056842838115669472196386865459400540160.00) *gradient_threshold* = 4.00, int(0, 32000) *min_edge_length* = 0, ``bool`` *close_gaps* = False, ``bool`` *beautify* = False)\n\nEXPERIMENTAL\n\n    Detect and mark edges in a crack edge image using the\n    Shen/Castan zero-crossing detector.\n\n    Uses code from the VIGRA Computer Vision Library (Copyright\n    1998-2007 by Ullrich Köthe).\n\n    *scale*\n      The scale relates to the value b of the exponential filter.\n\n    *gradient_threshold*\n      Whenever the gradient at a zero crossing is greater than the\n      given gradient threshold, an edge point is marked in the\n      destination image on the darker side of the zero crossing (the\n      zero crossing occurs between pixels).\n\n    *min_edge_length*\n      Removes all edges shorter than the number of pixels specified\n      (0 retains all edges).  Values near 10 are suggested.\n\n    *close_gaps*\n      Close one pixel wide gaps.\n\n    *beautify*\n      See the VIGRA Docs.\n    "        },
+                                { CHAR_PTR_CAST "canny_edge_image",
+          call_canny_edge_image, METH_VARARGS,
+          CHAR_PTR_CAST "**canny_edge_image** (float(0.00, 1000000000000000052504760255204420248704468581108159154915854115511802457988908195786371375080447864043704443832883878176942523235360430575644792184786706982848387200926575803737830233794788090059368953234970799945081119038967640880074652742780142494579258788820056842838115669472196386865459400540160.00) *scale* = 0.80, float(0.00, 1000000000000000052504760255204420248704468581108159154915854115511802457988908195786371375080447864043704443832883878176942523235360430575644792184786706982848387200926575803737830233794788090059368953234970799945081119038967640880074652742780142494579258788820056842838115669472196386865459400540160.00) *gradient_threshold* = 4.00)\n\nEXPERIMENTAL\n\n    Detect and mark edges in an edge image using Canny's algorithm.\n\n    Uses code from the VIGRA Computer Vision Library (Copyright\n    1998-2007 by Ullrich Köthe).\n\n    *scale*\n      The scale relates to the value b of the exponential filter.\n\n    *gradient_threshold*\n      This operator first calls cannyEdgelList() to generate an\n      edgel list for the given image. Than it scans this list and\n      selects edgels whose strength is above the given\n      gradient_threshold.\n    "        },
+                                { CHAR_PTR_CAST "labeled_region_edges",
+          call_labeled_region_edges, METH_VARARGS,
+          CHAR_PTR_CAST "**labeled_region_edges** (``bool`` *mark_both* = False)\n\nPixels with a label different from one of its neighboring pixels\nare marked black in the returned image.\n\nWhen *mark_both* is ``True``, both edges of the region border are\nmarked, resulting in a two pixel wide edge."        },
+                                { CHAR_PTR_CAST "outline",
+          call_outline, METH_VARARGS,
+          CHAR_PTR_CAST "**outline** ()\n\nTraces the outline of the image.  This result is obtained by\ndilating the image and then XOR'ing the result with the original."        },
+                      { CHAR_PTR_CAST "_plugin_stats",
+      call_plugin_stats, METH_VARARGS,
+      CHAR_PTR_CAST "Returns the execution statistics (events=0) or the trace (events=1) of the plugins in this module."
+    },
+    { CHAR_PTR_CAST "_reset_plugin_stats",
+      call_reset_plugin_stats, METH_VARARGS,
+      CHAR_PTR_CAST "Clears the execution statistics of the plugins in this module."
+    },
+    { NULL }
+  };
+
+    static PluginStats plugin_stats;
+
+  static PyObject* call_plugin_stats(PyObject* self, PyObject* args) {
+    int events = 0;
+    if (PyArg_ParseTuple(args, CHAR_PTR_CAST "|i:_plugin_stats", &events) <= 0)
+      return 0;
+    if (events)
+      return plugin_stats.events_to_python();
+    return plugin_stats.entries_to_python();
+  }
+
+  static PyObject* call_reset_plugin_stats(PyObject* self, PyObject* args) {
+    plugin_stats.clear();
+    Py_INCREF(Py_None);
+    return Py_None;
+  }
+
+                static PyObject* call_difference_of_exponential_edge_image(PyObject* self, PyObject* args) {
+            
+      PyErr_Clear();
+                                                                                Image* return_arg;
+PyObject* return_pyarg;
+                                          Image* self_arg;
+PyObject* self_pyarg;
+                      double scale_arg;
+                      double gradient_threshold_arg;
+                      int min_edge_length_arg;
+      
+                                      if (PyArg_ParseTuple(args, CHAR_PTR_CAST "Oddi:difference_of_exponential_edge_image"
+                        ,
+             &self_pyarg                        ,
+             &scale_arg                        ,
+             &gradient_threshold_arg                        ,
+             &min_edge_length_arg                      ) <= 0)
+           return 0;
+               
+              if (!is_ImageObject(self_pyarg)) {
+            PyErr_SetString(PyExc_TypeError, "Argument 'self' must be an image");
+            return 0;
+          }
+          self_arg = ((Image*)((RectObject*)self_pyarg)->m_x);
+          image_get_fv(self_pyarg, &self_arg->features, &self_arg->features_len);
+                                                          
+            
+      PluginStatsCall stats_call;
+                        stats_call.add_image(self_arg);
+                                                                            
+                                      stats_call.start();
+        try {
+                      switch(get_image_combination(self_pyarg)) {
+case GREYSCALEIMAGEVIEW:
+return_arg = difference_of_exponential_edge_image(*((GreyScaleImageView*)self_arg), scale_arg, gradient_threshold_arg, min_edge_length_arg);
+break;
+case GREY16IMAGEVIEW:
+return_arg = difference_of_exponential_edge_image(*((Grey16ImageView*)self_arg), scale_arg, gradient_threshold_arg, min_edge_length_arg);
+break;
+case FLOATIMAGEVIEW:
+return_arg = difference_of_exponential_edge_image(*((FloatImageView*)self_arg), scale_arg, gradient_threshold_arg, min_edge_length_arg);
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'self' argument of 'difference_of_exponential_edge_image' can not have pixel type '%s'. Acceptable values are GREYSCALE, GREY16, and FLOAT.", get_pixel_type_name(self_pyarg));
+return 0;
+}
+                  } catch (std::exception& e) {
+                    PyErr_SetString(PyExc_RuntimeError, e.what());
+          return 0;
+        }
+        stats_call.stop();
+                          stats_call.add_result(return_arg);
+                stats_call.record(plugin_stats, "difference_of_exponential_edge_image", get_pixel_type(self_pyarg));
+      
+                                                                                                  if (return_arg== NULL) {
+              if (PyErr_Occurred() == NULL) {
+                Py_INCREF(Py_None);
+                return Py_None;
+               } else
+                return NULL;
+            } else {
+              return_pyarg = create_ImageObject(return_arg);              return return_pyarg;
+            }
+                              }
+
+                                                    static PyObject* call_difference_of_exponential_crack_edge_image(PyObject* self, PyObject* args) {
+            
+      PyErr_Clear();
+                                                                                Image* return_arg;
+PyObject* return_pyarg;
+                                          Image* self_arg;
+PyObject* self_pyarg;
+                      double scale_arg;
+                      double gradient_threshold_arg;
+                      int min_edge_length_arg;
+                      int close_gaps_arg;
+                      int beautify_arg;
+      
+                                      if (PyArg_ParseTuple(args, CHAR_PTR_CAST "Oddiii:difference_of_exponential_crack_edge_image"
+                        ,
+             &self_pyarg                        ,
+             &scale_arg                        ,
+             &gradient_threshold_arg                        ,
+             &min_edge_length_arg                        ,
+             &close_gaps_arg                        ,
+             &beautify_arg                      ) <= 0)
+           return 0;
+               
+              if (!is_ImageObject(self_pyarg)) {
+            PyErr_SetString(PyExc_TypeError, "Argument 'self' must be an image");
+            return 0;
+          }
+          self_arg = ((Image*)((RectObject*)self_pyarg)->m_x);
+          image_get_fv(self_pyarg, &self_arg->features, &self_arg->features_len);
+                                                                                      
+            
+      PluginStatsCall stats_call;
+                        stats_call.add_image(self_arg);
+                                                                                                        
+                                      stats_call.start();
+        try {
+                      switch(get_image_combination(self_pyarg)) {
+case GREYSCALEIMAGEVIEW:
+return_arg = difference_of_exponential_crack_edge_image(*((GreyScaleImageView*)self_arg), scale_arg, gradient_threshold_arg, min_edge_length_arg, close_gaps_arg, beautify_arg);
+break;
+case GREY16IMAGEVIEW:
+return_arg = difference_of_exponential_crack_edge_image(*((Grey16ImageView*)self_arg), scale_arg, gradient_threshold_arg, min_edge_length_arg, close_gaps_arg, beautify_arg);
+break;
+case FLOATIMAGEVIEW:
+return_arg = difference_of_exponential_crack_edge_image(*((FloatImageView*)self_arg), scale_arg, gradient_threshold_arg, min_edge_length_arg, close_gaps_arg, beautify_arg);
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'self' argument of 'difference_of_exponential_crack_edge_image' can not have pixel type '%s'. Acceptable values are GREYSCALE, GREY16, and FLOAT.", get_pixel_type_name(self_pyarg));
+return 0;
+}
+                  } catch (std::exception& e) {
+                    PyErr_SetString(PyExc_RuntimeError, e.what());
+          return 0;
+        }
+        stats_call.stop();
+                          stats_call.add_result(return_arg);
+                stats_call.record(plugin_stats, "difference_of_exponential_crack_edge_image", get_pixel_type(self_pyarg));
+      
+                                                                                                                                      if (return_arg== NULL) {
+              if (PyErr_Occurred() == NULL) {
+                Py_INCREF(Py_None);
+                return Py_None;
+               } else
+                return NULL;
+            } else {
+              return_pyarg = create_ImageObject(return_arg);              return return_pyarg;
+            }
+                              }
+
+                                                    static PyObject* call_canny_edge_image(PyObject* self, PyObject* args) {
+            
+      PyErr_Clear();
+                                                                                Image* return_arg;
+PyObject* return_pyarg;
+                                          Image* self_arg;
+PyObject* self_pyarg;
+                      double scale_arg;
+                      double gradient_threshold_arg;
+      
+                                      if (PyArg_ParseTuple(args, CHAR_PTR_CAST "Odd:canny_edge_image"
+                        ,
+             &self_pyarg                        ,
+             &scale_arg                        ,
+             &gradient_threshold_arg                      ) <= 0)
+           return 0;
+               
+              if (!is_ImageObject(self_pyarg)) {
+            PyErr_SetString(PyExc_TypeError, "Argument 'self' must be an image");
+            return 0;
+          }
+          self_arg = ((Image*)((RectObject*)self_pyarg)->m_x);
+          image_get_fv(self_pyarg, &self_arg->features, &self_arg->features_len);
+                                            
+            
+      PluginStatsCall stats_call;
+                        stats_call.add_image(self_arg);
+                                                              
+                                      stats_call.start();
+        try {
+                      switch(get_image_combination(self_pyarg)) {
+case GREYSCALEIMAGEVIEW:
+return_arg = canny_edge_image(*((GreyScaleImageView*)self_arg), scale_arg, gradient_threshold_arg);
+break;
+case GREY16IMAGEVIEW:
+return_arg = canny_edge_image(*((Grey16ImageView*)self_arg), scale_arg, gradient_threshold_arg);
+break;
+case FLOATIMAGEVIEW:
+return_arg = canny_edge_image(*((FloatImageView*)self_arg), scale_arg, gradient_threshold_arg);
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'self' argument of 'canny_edge_image' can not have pixel type '%s'. Acceptable values are GREYSCALE, GREY16, and FLOAT.", get_pixel_type_name(self_pyarg));
+return 0;
+}
+                  } catch (std::exception& e) {
+                    PyErr_SetString(PyExc_RuntimeError, e.what());
+          return 0;
+        }
+        stats_call.stop();
+                          stats_call.add_result(return_arg);
+                stats_call.record(plugin_stats, "canny_edge_image", get_pixel_type(self_pyarg));
+      
+                                                                                if (return_arg== NULL) {
+              if (PyErr_Occurred() == NULL) {
+                Py_INCREF(Py_None);
+                return Py_None;
+               } else
+                return NULL;
+            } else {
+              return_pyarg = create_ImageObject(return_arg);              return return_pyarg;
+            }
+                              }
+
+                                                    static PyObject* call_labeled_region_edges(PyObject* self, PyObject* args) {
+            
+      PyErr_Clear();
+                                                                                Image* return_arg;
+PyObject* return_pyarg;
+                                          Image* self_arg;
+PyObject* self_pyarg;
+                      int mark_both_arg;
+      
+                                      if (PyArg_ParseTuple(args, CHAR_PTR_CAST "Oi:labeled_region_edges"
+                        ,
+             &self_pyarg                        ,
+             &mark_both_arg                      ) <= 0)
+           return 0;
+               
+              if (!is_ImageObject(self_pyarg)) {
+            PyErr_SetString(PyExc_TypeError, "Argument 'self' must be an image");
+            return 0;
+          }
+          self_arg = ((Image*)((RectObject*)self_pyarg)->m_x);
+          image_get_fv(self_pyarg, &self_arg->features, &self_arg->features_len);
+                              
+            
+      PluginStatsCall stats_call;
+                        stats_call.add_image(self_arg);
+                                                
+                                      stats_call.start();
+        try {
+                      switch(get_image_combination(self_pyarg)) {
+case ONEBITIMAGEVIEW:
+return_arg = labeled_region_edges(*((OneBitImageView*)self_arg), mark_both_arg);
+break;
+case CC:
+return_arg = labeled_region_edges(*((Cc*)self_arg), mark_both_arg);
+break;
+case ONEBITRLEIMAGEVIEW:
+return_arg = labeled_region_edges(*((OneBitRleImageView*)self_arg), mark_both_arg);
+break;
+case RLECC:
+return_arg = labeled_region_edges(*((RleCc*)self_arg), mark_both_arg);
+break;
+case MLCC:
+return_arg = labeled_region_edges(*((MlCc*)self_arg), mark_both_arg);
+break;
+case GREYSCALEIMAGEVIEW:
+return_arg = labeled_region_edges(*((GreyScaleImageView*)self_arg), mark_both_arg);
+break;
+case GREY16IMAGEVIEW:
+return_arg = labeled_region_edges(*((Grey16ImageView*)self_arg), mark_both_arg);
+break;
+case RGBIMAGEVIEW:
+return_arg = labeled_region_edges(*((RGBImageView*)self_arg), mark_both_arg);
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'self' argument of 'labeled_region_edges' can not have pixel type '%s'. Acceptable values are ONEBIT, ONEBIT, ONEBIT, ONEBIT, ONEBIT, GREYSCALE, GREY16, and RGB.", get_pixel_type_name(self_pyarg));
+return 0;
+}
+                  } catch (std::exception& e) {
+                    PyErr_SetString(PyExc_RuntimeError, e.what());
+          return 0;
+        }
+        stats_call.stop();
+                          stats_call.add_result(return_arg);
+                stats_call.record(plugin_stats, "labeled_region_edges", get_pixel_type(self_pyarg));
+      
+                                                              if (return_arg== NULL) {
+              if (PyErr_Occurred() == NULL) {
+                Py_INCREF(Py_None);
+                return Py_None;
+               } else
+                return NULL;
+            } else {
+              return_pyarg = create_ImageObject(return_arg);              return return_pyarg;
+            }
+                              }
+
+                                                    static PyObject* call_outline(PyObject* self, PyObject* args) {
+            
+      PyErr_Clear();
+                                                                                Image* return_arg;
+PyObject* return_pyarg;
+                                          Image* self_arg;
+PyObject* self_pyarg;
+      
+                                      if (PyArg_ParseTuple(args, CHAR_PTR_CAST "O:outline"
+                        ,
+             &self_pyarg                      ) <= 0)
+           return 0;
+               
+              if (!is_ImageObject(self_pyarg)) {
+            PyErr_SetString(PyExc_TypeError, "Argument 'self' must be an image");
+            return 0;
+          }
+          self_arg = ((Image*)((RectObject*)self_pyarg)->m_x);
+          image_get_fv(self_pyarg, &self_arg->features, &self_arg->features_len);
+                
+            
+      PluginStatsCall stats_call;
+                        stats_call.add_image(self_arg);
+                                  
+                                      stats_call.start();
+        try {
+                      switch(get_image_combination(self_pyarg)) {
+case ONEBITIMAGEVIEW:
+return_arg = outline(*((OneBitImageView*)self_arg));
+break;
+case CC:
+return_arg = outline(*((Cc*)self_arg));
+break;
+case ONEBITRLEIMAGEVIEW:
+return_arg = outline(*((OneBitRleImageView*)self_arg));
+break;
+case RLECC:
+return_arg = outline(*((RleCc*)self_arg));
+break;
+case MLCC:
+return_arg = outline(*((MlCc*)self_arg));
+break;
+default:
+PyErr_Format(PyExc_TypeError,"The 'self' argument of 'outline' can not have pixel type '%s'. Acceptable values are ONEBIT, ONEBIT, ONEBIT, ONEBIT, and ONEBIT.", get_pixel_type_name(self_pyarg));
+return 0;
+}
+                  } catch (std::exception& e) {
+                    PyErr_SetString(PyExc_RuntimeError, e.what());
+          return 0;
+        }
+        stats_call.stop();
+                          stats_call.add_result(return_arg);
+                stats_call.record(plugin_stats, "outline", get_pixel_type(self_pyarg));
+      
+                                            if (return_arg== NULL) {
+              if (PyErr_Occurred() == NULL) {
+                Py_INCREF(Py_None);
+                return Py_None;
+               } else
+                return NULL;
+            } else {
+              return_pyarg = create_ImageObject(return_arg);              return return_pyarg;
+            }
+                              }
+
+                                          
+  DL_EXPORT(void) init_edgedetect(void) {
+    Py_InitModule(CHAR_PTR_CAST "_edgedetect", _edgedetect_methods);
+  }
+  
+
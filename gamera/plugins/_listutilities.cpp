@@ -0,0 +1,185 @@
+
+          
+    
+  #include "gameramodule.hpp"
+  #include "knnmodule.hpp"
+  #include "plugin_stats.hpp"
+
+        #include "listutilities.hpp"
+  
+    #include <string>
+  #include <stdexcept>
+  #include "Python.h"
+  #include <list>
+
+  using namespace Gamera;
+  
+        
+      extern "C" {
+#ifndef _MSC_VER
+    void init_listutilities(void);
+#endif
+    static PyObject* call_plugin_stats(PyObject* self, PyObject* args);
+    static PyObject* call_reset_plugin_stats(PyObject* self, PyObject* args);
+                  static PyObject* call_permute_list(PyObject* self, PyObject* args);
+                                static PyObject* call_all_subsets(PyObject* self, PyObject* args);
+                                          static PyObject* call_median_py(PyObject* self, PyObject* args);
+                    }
+
+          static PyMethodDef _listutilities_methods[] = {
+                  { CHAR_PTR_CAST "permute_list",
+          call_permute_list, METH_VARARGS,
+          CHAR_PTR_CAST "**permute_list** (object *list*)\n\nPermutes the given list (in place) one step.\n\nReturns ``True`` if there are more permutations to go.  Returns\n``False`` if permutations are done.\n\nExample usage::\n\n  >>>from gamera.plugins import listutilities\n  >>>a = [1,2,3]\n  >>>while listutilities.permute_list(a):\n  ...    print a\n  ...\n  [2, 1, 3]\n  [1, 3, 2]\n  [3, 1, 2]\n  [2, 3, 1]\n  [3, 2, 1]"        },
+                                { CHAR_PTR_CAST "all_subsets",
+          call_all_subsets, METH_VARARGS,
+          CHAR_PTR_CAST "**all_subsets** (object *list*, int *size*)\n\nReturns all subsets of size *size* of the given list."        },
+                                          { CHAR_PTR_CAST "median_py",
+          call_median_py, METH_VARARGS,
+          CHAR_PTR_CAST "**median_py** (object *list*, ``bool`` *inlist*)\n\nThis is only for Gamera's Python-C++ interface."        },
+                      { CHAR_PTR_CAST "_plugin_stats",
+      call_plugin_stats, METH_VARARGS,
+      CHAR_PTR_CAST "Returns the execution statistics (events=0) or the trace (events=1) of the plugins in this module."
+    },
+    { CHAR_PTR_CAST "_reset_plugin_stats",
+      call_reset_plugin_stats, METH_VARARGS,
+      CHAR_PTR_CAST "Clears the execution statistics of the plugins in this module."
+    },
+    { NULL }
+  };
+
+    static PluginStats plugin_stats;
+
+  static PyObject* call_plugin_stats(PyObject* self, PyObject* args) {
+    int events = 0;
+    if (PyArg_ParseTuple(args, CHAR_PTR_CAST "|i:_plugin_stats", &events) <= 0)
+      return 0;
+    if (events)
+      return plugin_stats.events_to_python();
+    return plugin_stats.entries_to_python();
+  }
+
+  static PyObject* call_reset_plugin_stats(PyObject* self, PyObject* args) {
+    plugin_stats.clear();
+    Py_INCREF(Py_None);
+    return Py_None;
+  }
+
+                static PyObject* call_permute_list(PyObject* self, PyObject* args) {
+            
+      PyErr_Clear();
+                                                                        int return_arg;
+PyObject* return_pyarg;
+                                          PyObject* list_arg;
+PyObject* list_pyarg;
+      
+                                      if (PyArg_ParseTuple(args, CHAR_PTR_CAST "O:permute_list"
+                        ,
+             &list_pyarg                      ) <= 0)
+           return 0;
+               
+              list_arg = list_pyarg;      
+            
+      PluginStatsCall stats_call;
+                                        
+                                      stats_call.start();
+        try {
+                      return_arg = permute_list(list_arg);
+                  } catch (std::exception& e) {
+                    PyErr_SetString(PyExc_RuntimeError, e.what());
+          return 0;
+        }
+        stats_call.stop();
+                          stats_call.add_result(return_arg);
+                stats_call.record(plugin_stats, "permute_list", -1);
+      
+                                                              return_pyarg = PyInt_FromLong((long)return_arg);            return return_pyarg;
+                              }
+
+                                                    static PyObject* call_all_subsets(PyObject* self, PyObject* args) {
+            
+      PyErr_Clear();
+                                                                        PyObject* return_arg;
+PyObject* return_pyarg;
+                                          PyObject* list_arg;
+PyObject* list_pyarg;
+                      int size_arg;
+      
+                                      if (PyArg_ParseTuple(args, CHAR_PTR_CAST "Oi:all_subsets"
+                        ,
+             &list_pyarg                        ,
+             &size_arg                      ) <= 0)
+           return 0;
+               
+              list_arg = list_pyarg;                    
+            
+      PluginStatsCall stats_call;
+                                                      
+                                      stats_call.start();
+        try {
+                      return_arg = all_subsets(list_arg, size_arg);
+                  } catch (std::exception& e) {
+                    PyErr_SetString(PyExc_RuntimeError, e.what());
+          return 0;
+        }
+        stats_call.stop();
+                          stats_call.add_result(return_arg);
+                stats_call.record(plugin_stats, "all_subsets", -1);
+      
+                                                                                if (return_arg== NULL) {
+              if (PyErr_Occurred() == NULL) {
+                Py_INCREF(Py_None);
+                return Py_None;
+               } else
+                return NULL;
+            } else {
+              return_pyarg = return_arg;              return return_pyarg;
+            }
+                              }
+
+                                                          static PyObject* call_median_py(PyObject* self, PyObject* args) {
+            
+      PyErr_Clear();
+                                                                        PyObject* return_arg;
+PyObject* return_pyarg;
+                                          PyObject* list_arg;
+PyObject* list_pyarg;
+                      int inlist_arg;
+      
+                                      if (PyArg_ParseTuple(args, CHAR_PTR_CAST "Oi:median_py"
+                        ,
+             &list_pyarg                        ,
+             &inlist_arg                      ) <= 0)
+           return 0;
+               
+              list_arg = list_pyarg;                    
+            
+      PluginStatsCall stats_call;
+                                                      
+                                      stats_call.start();
+        try {
+                      return_arg = median_py(list_arg, inlist_arg);
+                  } catch (std::exception& e) {
+                    PyErr_SetString(PyExc_RuntimeError, e.what());
+          return 0;
+        }
+        stats_call.stop();
+                          stats_call.add_result(return_arg);
+                stats_call.record(plugin_stats, "median_py", -1);
+      
+                                                                                if (return_arg== NULL) {
+              if (PyErr_Occurred() == NULL) {
+                Py_INCREF(Py_None);
+                return Py_None;
+               } else
+                return NULL;
+            } else {
+              return_pyarg = return_arg;              return return_pyarg;
+            }
+                              }
+
+                                          
+  DL_EXPORT(void) init_listutilities(void) {
+    Py_InitModule(CHAR_PTR_CAST "_listutilities", _listutilities_methods);
+  }
+  
+
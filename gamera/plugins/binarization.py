@@ -37,6 +37,7 @@ class image_mean(PluginFunction):
     category = "Binarization/RegionInformation"
     return_type = Real("output")
     self_type = ImageType([GREYSCALE, GREY16, FLOAT])
+    release_gil = True
 
     def __call__(self):
         return _binarization.image_mean(self)
@@ -50,6 +51,7 @@ class image_variance(PluginFunction):
     category = "Binarization/RegionInformation"
     return_type = Real("output")
     self_type = ImageType([GREYSCALE, GREY16, FLOAT])
+    release_gil = True
 
     def __call__(self):
         return _binarization.image_variance(self)
@@ -66,6 +68,7 @@ class mean_filter(PluginFunction):
     category = "Binarization/RegionInformation"
     return_type = ImageType([FLOAT], "output")
     self_type = ImageType([GREYSCALE, GREY16, FLOAT])
+    release_gil = True
     args = Args([Int("region size", default=5)])
     doc_examples = [(GREYSCALE,), (GREY16,), (FLOAT,)]
 
@@ -87,6 +90,7 @@ class variance_filter(PluginFunction):
     category = "Binarization/RegionInformation"
     return_type = ImageType([FLOAT], "output")
     self_type = ImageType([GREYSCALE, GREY16, FLOAT])
+    release_gil = True
     args = Args([ImageType([FLOAT], "means"),
                  Int("region size", default=5)])
 
@@ -115,6 +119,7 @@ class wiener_filter(PluginFunction):
     category = "Filter"
     return_type = ImageType([GREYSCALE, GREY16, FLOAT], "output")
     self_type = ImageType([GREYSCALE, GREY16, FLOAT])
+    release_gil = True
     args = Args([Int("region size", default=5),
                  Real("noise variance", default=-1.0)])
     doc_examples = [(GREYSCALE,), (GREY16,), (FLOAT,)]
@@ -148,6 +153,7 @@ class niblack_threshold(PluginFunction):
     """
     return_type = ImageType([ONEBIT], "output")
     self_type = ImageType([GREYSCALE])
+    release_gil = True
     args = Args([Int("region size", default=15),
                  Real("sensitivity", default=-0.2),
                  Int("lower bound", range=(0, 255), default=20),
@@ -194,6 +200,7 @@ class sauvola_threshold(PluginFunction):
     """
     return_type = ImageType([ONEBIT], "output")
     self_type = ImageType([GREYSCALE])
+    release_gil = True
     args = Args([Int("region size", default=15),
                  Real("sensitivity", default=0.5),
                  Int("dynamic range", range=(1, 255), default=128),
@@ -235,6 +242,7 @@ class gatos_background(PluginFunction):
     category = "Binarization/RegionInformation"
     return_type = ImageType([GREYSCALE], "output")
     self_type = ImageType([GREYSCALE])
+    release_gil = True
     args = Args([ImageType([ONEBIT], "binarization"),
                  Int("region size", default=15)])
 
@@ -263,6 +271,7 @@ class gatos_threshold(PluginFunction):
     """
     return_type = ImageType([ONEBIT], "output")
     self_type = ImageType([GREYSCALE])
+    release_gil = True
     args = Args([ImageType([GREYSCALE], "background"),
                  ImageType([ONEBIT], "binarization"),
                  Real("q", default=0.6),
@@ -333,6 +342,7 @@ class white_rohrer_threshold(PluginFunction):
     """
     return_type = ImageType([ONEBIT], "onebit")
     self_type = ImageType([GREYSCALE])
+    release_gil = True
     args = Args([Int("x lookahead", default=8),
                  Int("y lookahead", default=1),
                  Int("bias mode", default=0),
@@ -420,6 +430,7 @@ class brink_threshold(PluginFunction):
     author = "Johanna Devaney, Brian Stern"
     self_type = ImageType([GREYSCALE])
     return_type = ImageType([ONEBIT], "onebit")
+    release_gil = True
     doc_examples = [(GREYSCALE,)]
 
     def __call__(self):
@@ -93,6 +93,7 @@ class convolve(PluginFunction):
                         ['avoid', 'clip', 'repeat', 'reflect', 'wrap'],
                         default=1)])
     return_type = ImageType(CONVOLUTION_TYPES)
+    release_gil = True
 
     def __call__(self, kernel, border_treatment=3):
         from gamera.gameracore import FLOAT
@@ -177,6 +178,7 @@ class convolve_x(PluginFunction):
                         ['avoid', 'clip', 'repeat', 'reflect', 'wrap'],
                         default=1)])
     return_type = ImageType(CONVOLUTION_TYPES)
+    release_gil = True
 
     def __call__(self, kernel, border_treatment=1):
         from gamera.gameracore import FLOAT
@@ -210,6 +212,7 @@ class convolve_y(PluginFunction):
                         ['avoid', 'clip', 'repeat', 'reflect', 'wrap'],
                         default=1)])
     return_type = ImageType(CONVOLUTION_TYPES)
+    release_gil = True
 
     def __call__(self, kernel, border_treatment=1):
         from gamera.gameracore import FLOAT
@@ -23,7 +23,8 @@ deformations to images."""
 
 import sys
 from gamera.plugin import PluginFunction, PluginModule
-from gamera.args import ImageType, Args, Float, Int, Choice
+from gamera.args import ImageType, Args, Float, Int, Choice, Class, \
+     ImageList, IntVector, FloatVector
 from gamera.enums import GREYSCALE, ONEBIT, GREY16, FLOAT, RGB
 
 import _deformation
@@ -197,6 +198,89 @@ References:
     author = "Christoph Dalitz"
     doc_examples = [(ONEBIT, 0.05, 5, 2, 2, 0)]
 
+# Deformations usable in deform_images: name -> (id, default arguments),
+# where None marks a required argument
+_recipe_steps = {
+    "wave": (0, (None, None, None, 0, 0, 0.0)),
+    "noise": (1, (None, None)),
+    "inkrub": (2, (None,)),
+    "ink_diffuse": (3, (None, None)),
+    "degrade_kanungo": (4, (None, None, None, None, None, 2)),
+    "white_speckles": (5, (None, None, 2, 2)),
+    }
+
+
+class deform_images(PluginFunction):
+    """Applies a sequence of deformations *n* times to each image in a
+list, e.g. for creating synthetic training data.
+
+*images*
+  The list of images. RLE images are not supported.
+
+*recipe*
+  A list of deformations applied one after the other. Each deformation
+  is a tuple of the plugin name and its arguments without *random_seed*,
+  e.g. ``("degrade_kanungo", 0.0, 0.5, 0.5, 0.5, 0.5)``. Omitted
+  arguments have the same default values as in the plugins.
+  Possible deformations are wave_, noise_, inkrub_, ink_diffuse_,
+  degrade_kanungo_ and white_speckles_ (the latter two only for
+  onebit images).
+
+*n*
+  The number of variants per image.
+
+*random_seed*
+  Initializes the random generators. Each deformation of each variant
+  uses its own random generator, which is initialized with a seed
+  derived from *random_seed* and the position of the variant and the
+  deformation, so that the result is reproducible.
+
+The result is a list with the *n* variants of the first image, followed
+by the *n* variants of the second image, and so on. The variants are
+computed in parallel on all processors.
+
+.. code:: Python
+
+   recipe = [("degrade_kanungo", 0.0, 0.5, 0.5, 0.5, 0.5, 2),
+             ("noise", 1, 0)]
+   variants = deform_images(ccs, recipe, 10)
+"""
+    category = "Deformations"
+    pure_python = 1
+    self_type = None
+    args = Args([ImageList("images"), Class("recipe"), Int("n", default=1),
+                 Int("random_seed", default=0)])
+    return_type = ImageList("variants")
+
+    def __call__(images, recipe, n=1, random_seed=0):
+        operations = []
+        parameters = []
+        for step in recipe:
+            if not step[0] in _recipe_steps:
+                raise RuntimeError("deform_images: unknown deformation '%s'" % step[0])
+            op, defaults = _recipe_steps[step[0]]
+            args = list(step[1:])
+            if len(args) > len(defaults):
+                raise RuntimeError("deform_images: too many arguments for %s" % step[0])
+            args += defaults[len(args):]
+            if None in args:
+                raise RuntimeError("deform_images: missing arguments for %s" % step[0])
+            operations.append(op)
+            parameters.extend([float(x) for x in args] + [0.0] * (6 - len(args)))
+        return _deformation.deform_images_batch(images, operations, parameters,
+                                                n, random_seed)
+    __call__ = staticmethod(__call__)
+
+
+class deform_images_batch(PluginFunction):
+    """This is only for Gamera's Python-C++ interface."""
+    category = None
+    self_type = None
+    args = Args([ImageList("images"), IntVector("operations"),
+                 FloatVector("parameters"), Int("n"), Int("random_seed")])
+    return_type = ImageList("variants")
+
+
 # class batch_deform(PluginFunction):
 #     """
 #     Performs all possible deformations over given range of arguments.
@@ -210,7 +294,12 @@ class DefModule(PluginModule):
     cpp_headers = ["deformations.hpp"]
     category = "Deformations"
     functions = [noise, inkrub, wave, ink_diffuse,
-                 degrade_kanungo, white_speckles]
+                 degrade_kanungo, white_speckles, deform_images,
+                 deform_images_batch]
+    if sys.platform != 'win32':
+        extra_libraries = ["pthread"]
     author = "Albert Brzeczko"
     url = "http://gamera.sourceforge.net/"
 module = DefModule()
+
+deform_images = deform_images()
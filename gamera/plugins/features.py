@@ -27,6 +27,7 @@ class Feature(PluginFunction):
     self_type = ImageType([ONEBIT])
     return_type = FloatVector(length=1)
     feature_function = True
+    batch = True
     doc_examples = [(ONEBIT,)]
 
 
@@ -203,6 +203,19 @@ class delaunay_from_points(PluginFunction):
 
   .. __: http://hal.inria.fr/inria-00090678
 
+    For large point sets (e.g. the centroids of all Cc's of a book), the
+    optional argument *method* can be set to 1 (*sweep hull*). The
+    triangulation is then computed with the radial sweep hull algorithm
+    described in D. A. Sinclair: `S-hull: a fast radial sweep-hull routine
+    for Delaunay triangulation.`__ arXiv:1604.01428, 2016. This runs in
+    *O(n log(n))* and stores all triangles in flat arrays, which makes it
+    considerably faster and much less memory consuming than the Delaunay
+    tree. Both methods yield the same label pairs unless four or more
+    points lie on a common circle, in which case the triangulation is not
+    unique.
+
+  .. __: http://arxiv.org/abs/1604.01428
+
     This can be useful for building a neighborhood graph as shown in the
     following example:
 
@@ -220,10 +233,15 @@ class delaunay_from_points(PluginFunction):
           g.add_edge(pair[0], pair[1])
     """
     self_type = None
-    args = Args([PointVector("points"), IntVector("labels")])
+    args = Args([PointVector("points"), IntVector("labels"),
+                 Choice("method", ["delaunay tree", "sweep hull"], default=0)])
     return_type = Class("labelpairs")
     author = "Oliver Christen (based on code by Olivier Devillers)"
 
+    def __call__(points, labels, method=0):
+        return _geometry.delaunay_from_points(points, labels, method)
+    __call__ = staticmethod(__call__)
+
 
 class graph_color_ccs(PluginFunction):
     """
@@ -395,7 +413,7 @@ class GeometryModule(PluginModule):
 
     cpp_headers = ["geometry.hpp"]
     category = "Geometry"
-    cpp_sources = ["src/geostructs/kdtree.cpp", "src/geostructs/delaunaytree.cpp"] + glob.glob("src/graph/*.cpp")
+    cpp_sources = ["src/geostructs/kdtree.cpp", "src/geostructs/delaunaytree.cpp", "src/geostructs/sweephull.cpp"] + glob.glob("src/graph/*.cpp")
     functions = [voronoi_from_labeled_image,
                  voronoi_from_points,
                  labeled_region_neighbors,
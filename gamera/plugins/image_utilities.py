@@ -380,6 +380,57 @@ class ccs_from_labeled_image(PluginFunction):
     author = "Christoph Dalitz and Hasan Yildiz"
 
 
+class region_properties(PluginFunction):
+    """
+    Returns the properties of all labeled regions in the given onebit
+    image, which are computed in a single pass over the image. The image
+    can be the result of cc_analysis__ (which labels the image) or a
+    labeled image as used by ccs_from_labeled_image_. Pixels with
+    value zero are background.
+
+    The result is a dictionary of columns, i.e. each entry is a list with
+    one value per label in ascending label order:
+
+    *label*
+      the label of the region
+
+    *ul_x*, *ul_y*, *lr_x*, *lr_y*
+      the bounding box of the region (in the same coordinates as
+      the bounding boxes of CCs)
+
+    *area*
+      the number of pixels
+
+    *center_x*, *center_y*
+      the centroid
+
+    *mu20*, *mu02*, *mu11*
+      the second order central moments divided by the area, i.e. the
+      variances in x and y direction and the covariance
+
+    *perimeter*
+      the number of pixels with a 4-neighbor that does not belong to
+      the region (pixels at the image border are always counted)
+
+    *neighbors*
+      the list of labels of 8-adjacent regions
+
+    Example:
+
+    .. code:: Python
+
+      ccs = image.cc_analysis()
+      props = image.region_properties()
+      area = dict(zip(props["label"], props["area"]))
+      large = [c for c in ccs if area[c.label] > 100]
+
+    .. __: segmentation.html#cc-analysis
+    """
+    category="Utility"
+    self_type = ImageType([ONEBIT])
+    return_type = Class("properties")
+
+
 class min_max_location(PluginFunction):
     """Returns the minimum and maximum pixel value and their location
 in an image. When the min/max value occurs at several locations, only the
@@ -436,7 +487,7 @@ class UtilModule(PluginModule):
                  invert, clip_image, mask,
                  nested_list_to_image, to_nested_list,
                  diff_images, mse, reset_onebit_image,
-                 ccs_from_labeled_image,
+                 ccs_from_labeled_image, region_properties,
                  min_max_location, min_max_location_nomask]
     author = "Michael Droettboom and Karl MacMillan"
     url = "http://gamera.sourceforge.net/"
@@ -46,11 +46,19 @@ class rank(PluginFunction):
     *border_treatment* (0, 1)
       When 0 ('padwhite'), window pixels outside the image are set to white.
       When 1 ('reflect'), reflecting boundary conditions are used.
+
+    For all image types except ``Float``, the runtime per pixel does not
+    depend on the window size, so that large windows (e.g. for background
+    estimation) are feasible. The algorithm is described in
+
+      S. Perreault, P. Hebert: *Median Filtering in Constant Time.*
+      IEEE Transactions on Image Processing 16, pp. 2389-2394, 2007
     """
     self_type = ImageType([ONEBIT, GREYSCALE, GREY16, FLOAT])
     args = Args([Int('rank'), Int('k', default=3),
                  Choice('border_treatment', ['padwhite', 'reflect'], default=1)])
     return_type = ImageType([ONEBIT, GREYSCALE, GREY16, FLOAT])
+    release_gil = True
     author = "Christoph Dalitz and David Kolanus"
     doc_examples = [(GREYSCALE, 2), (GREYSCALE, 5), (GREYSCALE, 8)]
 
@@ -77,6 +85,7 @@ class mean(PluginFunction):
                  Choice('border_treatment', ['padwhite', 'reflect'], default=1)])
     doc_examples = [(GREYSCALE,)]
     return_type = ImageType([ONEBIT, GREYSCALE, GREY16, FLOAT])
+    release_gil = True
     author = "David Kolanus"
 
     def __call__(self, k=3, border_treatment=1):
@@ -113,6 +122,7 @@ class min_max_filter(PluginFunction):
                  Choice('filter', ['min', 'max'], default=0),
                  Int('k_vertical', default=0)])
     return_type = ImageType([ONEBIT, GREYSCALE, GREY16, FLOAT])
+    release_gil = True
     author = "David Kolanus"
     doc_examples = [(GREYSCALE,)]
 
@@ -177,6 +187,7 @@ class kfill(PluginFunction):
     """
     self_type = ImageType([ONEBIT])
     return_type = ImageType([ONEBIT])
+    release_gil = True
     author = "Oliver Christen"
     args = Args([Int("k", default=3), Int("iterations", default=1)])
 
@@ -210,6 +221,7 @@ class kfill_modified(PluginFunction):
     """
     self_type = ImageType([ONEBIT])
     return_type = ImageType([ONEBIT])
+    release_gil = True
     author = "Oliver Christen"
     args = Args([Int("k", default=3)])
 
@@ -64,9 +64,11 @@ class dilate(PluginFunction):
 class erode_dilate(PluginFunction):
     """
     Morphologically erodes or dilates the image with a rectangular or
-    ocagonal structuring element. For onebit images, this is simply a
-    wrapper for erode_with_structure_ or dilate_with_structure_ with
-    special cases for the structuring element.
+    ocagonal structuring element. For onebit images, the rectangular
+    operator is applied *ntimes* to a bit packed copy of the image, which
+    processes 64 pixels at once; the octagonal operator is a wrapper for
+    erode_with_structure_ or dilate_with_structure_ with an octagonal
+    structuring element of the size *2\*ntimes+1*.
 
     The returned image is of the same size as the input image, which means
     that border pixels are not dilated beyond the image dimensions. If you
@@ -96,6 +98,7 @@ class erode_dilate(PluginFunction):
                  Choice('direction', ['dilate', 'erode']), \
                  Choice('shape', ['rectangular', 'octagonal'])])
     return_type = ImageType([ONEBIT, GREYSCALE, FLOAT])
+    release_gil = True
     doc_examples = [(GREYSCALE, 10, 0, 1)]
 
 
@@ -117,6 +120,7 @@ class despeckle(PluginFunction):
     require recursion.
     """
     self_type = ImageType([ONEBIT])
+    release_gil = True
     args = Args([Int('cc_size', range=(1, 100))])
     doc_examples = [(ONEBIT, 15)]
 
@@ -140,6 +144,7 @@ class distance_transform(PluginFunction):
     self_type = ImageType([ONEBIT])
     args = Args([Choice("norm", ['chessboard', 'manhattan', 'euclidean'])])
     return_type = ImageType([FLOAT])
+    release_gil = True
     doc_examples = [(ONEBIT, 5)]
     author = u"Ullrich K\u00f6the (wrapped from VIGRA by Michael Droettboom)"
 
@@ -192,6 +197,7 @@ class dilate_with_structure(PluginFunction):
                  Point('origin'),
                  Check('only_border', default=False)])
     return_type = ImageType([ONEBIT])
+    release_gil = True
     author = "Christoph Dalitz"
 
     def __call__(self, structuring_element, origin, only_border=False):
@@ -226,6 +232,7 @@ class erode_with_structure(PluginFunction):
     args = Args([ImageType([ONEBIT], 'structuring_element'),
                  Point('origin')])
     return_type = ImageType([ONEBIT])
+    release_gil = True
     author = "Christoph Dalitz"
 
 
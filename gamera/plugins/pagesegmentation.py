@@ -19,7 +19,7 @@
 #
 
 from gamera.plugin import PluginFunction, PluginModule
-from gamera.args import ImageType, Args, Int, Choice, ImageList, Class, IntVector
+from gamera.args import ImageType, Args, Int, Choice, ImageList, Class, IntVector, NoneDefault
 from gamera.enums import ONEBIT
 
 import _pagesegmentation
@@ -110,15 +110,23 @@ class runlength_smearing(PluginFunction):
       Minimal length of white runs row-wise in the almost final
       image. When set to *-1*, it is set to 3 times the median height
       of all connected components.
+
+    *ccs*:
+      The connected components of the image, when already known. They
+      are only used for computing the median height when one of the
+      above parameters is *-1*, which otherwise requires a connected
+      component analysis of the image.
     """
     self_type = ImageType([ONEBIT])
     return_type = ImageList("ccs")
     args = Args([Int('Cx', default=-1), Int('Cy', default=-1), \
-                 Int('Csm', default=-1)])
+                 Int('Csm', default=-1), ImageList('ccs', default=NoneDefault)])
     author = "Christoph Dalitz and Iliya Stoyanov"
 
-    def __call__(image, Cx=-1, Cy=-1, Csm=-1):
-        return _pagesegmentation.runlength_smearing(image, Cx, Cy, Csm)
+    def __call__(image, Cx=-1, Cy=-1, Csm=-1, ccs=None):
+        if ccs is None:
+            ccs = []
+        return _pagesegmentation.runlength_smearing(image, Cx, Cy, Csm, ccs)
     __call__ = staticmethod(__call__)
 
 
@@ -310,6 +310,59 @@ class rotation_angle_projections(PluginFunction):
     __call__ = staticmethod(__call__)
 
 
+class estimate_skew(PluginFunction):
+    """
+    Estimates the rotation angle of a document with the same criterion
+    as rotation_angle_projections_ (the variation of the horizontal
+    projection profile), but much faster:
+
+    - instead of each black pixel, each horizontal black run is
+      projected, split into the pieces that the shear moves to the
+      same row
+
+    - the rotation is approximated by a shear, so that no trigonometric
+      functions need to be evaluated per pixel
+
+    - the angle is searched coarse to fine on grids of decreasing step
+      width, where the angles of one grid are evaluated in parallel
+      when Gamera has been built with OpenMP
+
+    Arguments:
+
+    *minangle*, *maxangle* (optional):
+      angle interval that is searched for the skew angle;
+      default values are -2.5 and +2.5
+
+    *accuracy* (optional):
+      error bound for the skew angle estimate; when zero, the same
+      default value as in rotation_angle_projections_ is used
+
+    Return Values:
+
+    *rotation angle*:
+      The rotation angle necessary to deskew the image.
+      Can be used directly as input to rotate_
+
+    *accuracy*:
+      Accuracy of the returned angle.
+
+    When the maximum is found on an end of the angle interval (e.g. for
+    an empty image), a ``RuntimeError`` is raised, as in
+    rotation_angle_projections_.
+
+    .. _rotation_angle_projections: #rotation-angle-projections
+    .. _rotate: deformations.html#rotate
+    """
+    category = "Analysis"
+    self_type = ImageType([ONEBIT])
+    args = Args([Float("minangle", default=-2.5), Float("maxangle", default=2.5), Float("accuracy", default=0.0)])
+    return_type = FloatVector("rotation_angle_and_accuracy", 2)
+
+    def __call__(self, minangle=-2.5, maxangle=2.5, accuracy=0.0):
+        return _projections.estimate_skew(self, minangle, maxangle, accuracy)
+    __call__ = staticmethod(__call__)
+
+
 class diagonal_projections(PluginFunction):
     """
     Computes diagonal projections of an image by rotating it
@@ -339,7 +392,8 @@ class ProjectionsModule(PluginModule):
     category = "Analysis"
     functions = [projection_rows, projection_cols, projections,
                  projection_skewed_rows, projection_skewed_cols,
-                 rotation_angle_projections, diagonal_projections]
+                 rotation_angle_projections, estimate_skew,
+                 diagonal_projections]
     author = "Michael Droettboom and Karl MacMillan"
     url = "http://gamera.sourceforge.net/"
 module = ProjectionsModule()
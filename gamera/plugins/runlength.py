@@ -84,6 +84,7 @@ class run_histogram(PluginFunction):
 class FilterRuns(PluginFunction):
     self_type = ImageType([ONEBIT])
     args = Args([Int("length"), ChoiceString("color", ["black", "white"])])
+    batch = True
     doc_examples = [(ONEBIT, 3, 'black')]
 
 
@@ -139,6 +140,7 @@ class to_rle(PluginFunction):
     """
     self_type = ImageType([ONEBIT])
     return_type = String("runs")
+    batch = True
     doc_examples = [(ONEBIT,)]
 
 
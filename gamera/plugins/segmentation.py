@@ -27,6 +27,7 @@ import _segmentation
 class Segmenter(PluginFunction):
     self_type = ImageType([ONEBIT])
     return_type = ImageList("ccs")
+    release_gil = True
     doc_examples = [(ONEBIT,)]
 
 
@@ -264,20 +265,29 @@ def filter_large(ccs, max_size):
     return tmp
 
 
-def filter_black_area_small(ccs, min_size):
+def _black_areas(ccs, properties):
+    # the black areas are taken from the table returned by
+    # region_properties when given, which avoids a pass over each cc
+    if properties is None:
+        return [x.black_area()[0] for x in ccs]
+    areas = dict(zip(properties["label"], properties["area"]))
+    return [areas[x.label] for x in ccs]
+
+
+def filter_black_area_small(ccs, min_size, properties=None):
     tmp = []
-    for x in ccs:
-        if x.black_area()[0] < min_size:
+    for x, area in zip(ccs, _black_areas(ccs, properties)):
+        if area < min_size:
             x.fill_white()
         else:
             tmp.append(x)
     return tmp
 
 
-def filter_black_area_large(ccs, max_size):
+def filter_black_area_large(ccs, max_size, properties=None):
     tmp = []
-    for x in ccs:
-        if x.black_area()[0] > max_size:
+    for x, area in zip(ccs, _black_areas(ccs, properties)):
+        if area > max_size:
             x.fill_white()
         else:
             tmp.append(x)
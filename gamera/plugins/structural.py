@@ -22,7 +22,7 @@ between glyphs."""
 
 from gamera.plugin import PluginFunction, PluginModule
 from gamera.args import ImageType, Args, Rect, Int, Check, String
-from gamera.args import Class, FloatVector, PointVector, Float
+from gamera.args import Class, FloatVector, PointVector, Float, ImageList
 from gamera.enums import ONEBIT, ALL
 
 
@@ -48,6 +48,47 @@ class shaped_grouping_function(PluginFunction):
     return_type = Check("connected")
 
 
+class bounding_box_grouping_pairs(PluginFunction):
+    """
+    Returns all index pairs *(i, j)* with *i < j*, for which
+    ``bounding_box_grouping_function(glyphs[i], glyphs[j], threshold)``
+    is ``True``.
+
+    Rather than testing all pairs of glyphs, the bounding boxes are
+    stored in a uniform grid index, so that only glyphs in neighboring
+    grid cells are compared. For glyphs of roughly similar size, the
+    runtime is thus nearly linear in the number of glyphs.
+
+    This function is used by the classifier for pre-grouping glyphs with
+    a ``BoundingBoxGroupingFunction`` or a ``ShapedGroupingFunction``.
+    """
+    self_type = None
+    args = Args([ImageList("glyphs"), Int("threshold")])
+    return_type = Class("pairs")
+
+
+class bounding_box_radius_query(PluginFunction):
+    """
+    Returns for each point of *points* the list of the indices of all
+    glyphs whose bounding box has a euclidean distance of at most
+    *radius* to the point. A point inside a bounding box has the
+    distance zero. The indices in each list are sorted.
+
+    Like bounding_box_grouping_pairs_, the bounding boxes are stored
+    once in a uniform grid index, so that each query only visits the
+    glyphs in the grid cells around its point.
+
+    .. code:: Python
+
+       # all glyphs close to the centers of the large glyphs
+       centers = [g.center for g in glyphs if g.nrows > 50]
+       neighbors = bounding_box_radius_query(glyphs, centers, 30.0)
+    """
+    self_type = None
+    args = Args([ImageList("glyphs"), PointVector("points"), Float("radius")])
+    return_type = Class("neighbors")
+
+
 class polar_distance(PluginFunction):
     """
     Returns a tuple containing the normalized distance, polar
@@ -124,10 +165,13 @@ class edit_distance(PluginFunction):
 
 class RelationalModule(PluginModule):
     cpp_headers = ["structural.hpp"]
+    cpp_sources = ["src/geostructs/rectgrid.cpp"]
     category = "Relational"
     functions = [polar_distance, polar_match,
                  bounding_box_grouping_function,
                  shaped_grouping_function,
+                 bounding_box_grouping_pairs,
+                 bounding_box_radius_query,
                  least_squares_fit, least_squares_fit_xy,
                  edit_distance]
     author = "Michael Droettboom and Karl MacMillan"
@@ -137,6 +181,8 @@ module = RelationalModule()
 
 bounding_box_grouping_function = bounding_box_grouping_function()
 shaped_grouping_function = shaped_grouping_function()
+bounding_box_grouping_pairs = bounding_box_grouping_pairs()
+bounding_box_radius_query = bounding_box_radius_query()
 least_squares_fit = least_squares_fit()
 least_squares_fit_xy = least_squares_fit_xy()
 edit_distance = edit_distance()
@@ -45,6 +45,7 @@ class threshold(PluginFunction):
     self_type = ImageType([GREYSCALE, GREY16, FLOAT])
     args = Args([Int("threshold"), Choice("storage format", ['dense', 'rle'])])
     return_type = ImageType([ONEBIT], "output")
+    release_gil = True
     doc_examples = [(GREYSCALE, 128)]
 
     def __call__(image, threshold, storage_format=0):
@@ -62,6 +63,8 @@ class otsu_find_threshold(PluginFunction):
     """
     self_type = ImageType([GREYSCALE])
     return_type = Int("threshold_point")
+    release_gil = True
+    batch = True
     doc_examples = [(GREYSCALE,)]
 
 
@@ -83,6 +86,8 @@ class otsu_threshold(PluginFunction):
     self_type = ImageType([GREYSCALE])
     args = Args(Choice("storage format", ['dense', 'rle']))
     return_type = ImageType([ONEBIT], "output")
+    release_gil = True
+    batch = True
     doc_examples = [(GREYSCALE,)]
 
     def __call__(image, storage_format=0):
@@ -101,6 +106,8 @@ class tsai_moment_preserving_find_threshold(PluginFunction):
     """
     self_type = ImageType([GREYSCALE])
     return_type = Int("threshold_point")
+    release_gil = True
+    batch = True
     doc_examples = [(GREYSCALE,)]
     author = "Uma Kompella"
 
@@ -124,6 +131,7 @@ class tsai_moment_preserving_threshold(PluginFunction):
     self_type = ImageType([GREYSCALE])
     args = Args(Choice("storage format", ['dense', 'rle']))
     return_type = ImageType([ONEBIT], "output")
+    release_gil = True
     doc_examples = [(GREYSCALE,)]
     author = "Uma Kompella"
 
@@ -148,6 +156,7 @@ class abutaleb_threshold(PluginFunction):
     self_type = ImageType([GREYSCALE])
     args = Args(Choice("storage format", ['dense', 'rle']))
     return_type = ImageType([ONEBIT], "output")
+    release_gil = True
     doc_examples = [(GREYSCALE,)]
 
     def __call__(image, storage_format=0):
@@ -191,6 +200,7 @@ class bernsen_threshold(PluginFunction):
                  Int("contrast limit", range=(0, 255), default=80),
                  Check("doubt_to_black", default=False)])
     return_type = ImageType([ONEBIT], "output")
+    release_gil = True
     doc_examples = [(GREYSCALE,)]
 
     def __call__(image, storage_format=0, region_size=11,
@@ -240,6 +250,7 @@ class djvu_threshold(PluginFunction):
                  Int("min_block_size", default=64),
                  Int("block_factor", default=2, range=(1, 8))])
     return_type = ImageType([ONEBIT], "output")
+    release_gil = True
 
     def __call__(image, smoothness=0.2, max_block_size=512, min_block_size=64,
                  block_factor=2):
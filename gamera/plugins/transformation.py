@@ -48,11 +48,18 @@ class rotate(PluginFunction):
 
     *order*
       The order of the spline used for interpolation.  Must be between 1 - 3.
+      When *order* is 0, no interpolation is done: the image is rotated
+      by three shears that only move whole pixels.  This is much faster
+      and keeps the stroke widths of onebit images crisp, which makes it
+      well suited for deskewing by small angles.
+
+    Rotations by multiples of 90 degrees are always exact and do not
+    interpolate, independent of *order*.
     """
     category = "Transformation"
     self_type = ImageType(ALL)
     return_type = ImageType(ALL)
-    args = Args([Float("angle"), Pixel("bgcolor", default=NoneDefault), Int("order", range=(1, 3), default=1)])
+    args = Args([Float("angle"), Pixel("bgcolor", default=NoneDefault), Int("order", range=(0, 3), default=1)])
     args.list[0].rng = (-180, 180)
     doc_examples = [(RGB, 32.0, RGBPixel(255, 255, 255), 3), (COMPLEX, 15.0, 0.0j, 3)]
     author = u"Michael Droettboom (With code from VIGRA by Ullrich K\u00f6the)"
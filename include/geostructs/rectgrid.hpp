@@ -0,0 +1,70 @@
+#ifndef __rectgrid_HPP
+#define __rectgrid_HPP
+
+//
+// Copyright (C) 2026 Gamera developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+
+#include <vector>
+#include <utility>
+#include "gameramodule.hpp"
+
+namespace Gamera { namespace Rectgrid {
+
+typedef std::vector<size_t> IndexVector;
+typedef std::vector<std::pair<size_t,size_t> > IndexPairVector;
+
+// Uniform grid index over rectangles (e.g. bounding boxes of Cc's).
+//
+// The grid covers a fixed area that is divided into square cells of
+// size cell_size. Each rectangle is registered in all cells it overlaps;
+// rectangles reaching outside the area are clipped to the border cells,
+// so that arbitrary rectangles can be added at any time. Queries only
+// visit the cells overlapped by the query region, which makes neighbor
+// searches independent of the total number of rectangles as long as
+// the cell size is in the order of the rectangle sizes.
+class RectGrid {
+private:
+  Rect area;
+  size_t cell_size;
+  size_t cell_ncols, cell_nrows;
+  std::vector<IndexVector> cells;
+  std::vector<Rect> rects;
+  // for avoiding duplicates in a query result
+  std::vector<size_t> visited;
+  size_t query_number;
+  void cell_range(long ul_x, long ul_y, long lr_x, long lr_y,
+                  size_t* c0, size_t* r0, size_t* c1, size_t* r1) const;
+  void candidates(long ul_x, long ul_y, long lr_x, long lr_y, IndexVector* result);
+public:
+  RectGrid(const Rect& area, size_t cell_size);
+  // adds a rectangle and returns its index
+  size_t add(const Rect& r);
+  size_t size() const { return rects.size(); }
+  const Rect& get(size_t i) const { return rects[i]; }
+  // indices of all rectangles with a euclidean distance of
+  // at most radius to the point p; the indices are sorted
+  void query_radius(const FloatPoint& p, double radius, IndexVector* result);
+  // all pairs (i,j) with i < j for which get(j) intersects
+  // get(i).expand(distance), i.e. the criterion of
+  // bounding_box_grouping_function; the pairs are sorted
+  void neighbor_pairs(size_t distance, IndexPairVector* result);
+};
+
+}} // end namespace Gamera::Rectgrid
+
+#endif
@@ -0,0 +1,78 @@
+#ifndef SWEEPHULL_20261018_HPP
+#define SWEEPHULL_20261018_HPP
+
+//
+// Copyright (C) 2026 Gamera developers
+//
+// The algorithm follows the radial sweep hull described in
+// D. A. Sinclair: "S-hull: a fast radial sweep-hull routine for
+// Delaunay triangulation." arXiv:1604.01428, 2016
+// with the hull hashing and edge flip bookkeeping popularized by
+// the Delaunator library.
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+
+#include <vector>
+#include <stdexcept>
+
+//-------------------------------------------------------------------------
+// two dimensional Delaunay triangulation by a radial sweep hull
+//-------------------------------------------------------------------------
+
+namespace Gamera { namespace Delaunaytree {
+
+  // Unlike DelaunayTree, all triangles are kept in flat index arrays
+  // that are allocated once in advance: triangle t consists of the
+  // vertex indices triangles[3t], triangles[3t+1], triangles[3t+2],
+  // and halfedges[e] is the index of the opposite half edge of the
+  // half edge e (or -1 on the convex hull). No triangle history is
+  // kept, so that memory is linear in the number of points.
+  class SweepHull {
+  private:
+    std::vector<double> coords;
+    std::vector<int> triangles;
+    std::vector<int> halfedges;
+    size_t ntriangles;
+    // convex hull as doubly linked list with an angular hash
+    std::vector<int> hull_prev;
+    std::vector<int> hull_next;
+    std::vector<int> hull_tri;
+    std::vector<int> hull_hash;
+    int hull_start;
+    double cx, cy;
+    std::vector<int> edge_stack;
+
+    size_t hashKey(double x, double y);
+    int addTriangle(int i0, int i1, int i2, int a, int b, int c);
+    void link(int a, int b);
+    int legalize(int a);
+    void insertOnHull(int id);
+  public:
+    SweepHull();
+    // coords contains the interleaved point coordinates x0,y0,x1,y1,...
+    void triangulate(const std::vector<double>& coords);
+    size_t numberOfPoints();
+    size_t numberOfTriangles();
+    const std::vector<int>& getTriangles();
+    const std::vector<int>& getHalfedges();
+    // compact adjacency list of all Delaunay edges: the neighbors of
+    // point i are neighbors[offsets[i]] ... neighbors[offsets[i+1]-1]
+    void neighborAdjacency(std::vector<int> *offsets, std::vector<int> *neighbors);
+  };
+
+}} // end namespace Gamera::Delaunaytree
+
+#endif
@@ -36,6 +36,8 @@ typedef std::map<Node*, int> ColorMap;
 
 
 struct Graph { 
+   GraphPool _pool;        ///< memory of nodes, edges, lists and map; must
+                           ///< be declared first, so that it is deleted last
    NodeVector _nodes;      ///< list of nodes in this graph
    EdgeVector _edges;      ///< list of edges in this graph
    ValueNodeMap _valuemap; ///< STL-Map value->node for this graph
@@ -32,6 +32,7 @@
 #include <utility>
 
 #include "graphdata.hpp"
+#include "graph_pool.hpp"
 
 namespace Gamera { namespace GraphApi {
 
@@ -43,10 +44,11 @@ struct Node;
 
 // -----------------------------------------------------------------------------
 //some data structures used in graph or multiple algorithms
-typedef std::list<Node*> NodeVector;
-typedef std::list<Edge*> EdgeVector;
+typedef std::list<Node*, PoolAllocator<Node*> > NodeVector;
+typedef std::list<Edge*, PoolAllocator<Edge*> > EdgeVector;
 typedef std::list<GraphData *> ValueVector;
-typedef std::map<GraphData *,Node*, GraphDataPtrLessCompare> ValueNodeMap;
+typedef std::map<GraphData *,Node*, GraphDataPtrLessCompare,
+      PoolAllocator<std::pair<GraphData * const, Node*> > > ValueNodeMap;
 typedef NodeVector::iterator NodeIterator;
 typedef ValueVector::iterator ValueIterator;
 typedef EdgeVector::iterator EdgeIterator;
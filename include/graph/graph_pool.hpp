@@ -0,0 +1,297 @@
+/*
+ *
+ * Copyright (C) 2026 Gamera developers
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#ifndef _GRAPH_POOL_HPP_3B1E07C2A94F58
+#define _GRAPH_POOL_HPP_3B1E07C2A94F58
+
+#include <cstddef>
+#include <algorithm>
+#include <new>
+#include <vector>
+#include <memory>
+
+namespace Gamera { namespace GraphApi {
+
+/** Memory pool for the small objects of one graph (nodes, edges,
+ * the cells of the node and edge lists and of the value map).
+ *
+ * Every Graph owns a GraphPool, which is deleted together with the
+ * graph. There is one FixedSizePool for each object size, which takes
+ * memory from the system in blocks holding many chunks of that size and
+ * hands them out one after the other, so that the objects of a graph
+ * built in one go lie next to each other in memory. Freed chunks are
+ * kept in a free list and reused by the same graph; the blocks are
+ * only given back when the graph is deleted.
+ *
+ * Each chunk starts with a pointer to its FixedSizePool (NULL for
+ * objects taken from the heap, e.g. nodes created outside of a graph),
+ * so that a chunk can be freed without knowing its graph. As a graph
+ * must not be modified by several threads at once anyway, the pools
+ * need no locking.
+ *
+ * Compiling with GRAPH_NO_POOL disables the pools, which can be handy
+ * for memory checkers like valgrind.
+ **/
+class FixedSizePool {
+   struct FreeChunk {
+      FreeChunk* next;
+   };
+public:
+   union Header {
+      FixedSizePool* pool;
+      double align;
+   };
+
+private:
+   size_t _size;
+   size_t _chunk_size;
+   size_t _block_chunks;   ///< number of chunks in the next block
+   std::vector<char*> _blocks;
+   char* _next;            ///< next never used chunk in the last block
+   char* _end;             ///< end of the last block
+   FreeChunk* _free;
+   size_t _used;
+   size_t _nchunks;
+
+   void grow() {
+      if(!_blocks.empty())
+         _block_chunks = std::min(_block_chunks * 2, (size_t)65536);
+      char* block = static_cast<char*>(::operator new(_block_chunks * _chunk_size));
+      _blocks.push_back(block);
+      _nchunks += _block_chunks;
+      _next = block;
+      _end = block + _block_chunks * _chunk_size;
+   }
+
+   // pools are owned by exactly one GraphPool
+   FixedSizePool(const FixedSizePool&);
+   FixedSizePool& operator=(const FixedSizePool&);
+
+public:
+   FixedSizePool(size_t size) {
+      size_t align = sizeof(Header);
+      _size = size;
+      if(size < sizeof(FreeChunk))
+         size = sizeof(FreeChunk);
+      _chunk_size = sizeof(Header) + (size + align - 1) / align * align;
+      _block_chunks = 64;
+      _next = _end = NULL;
+      _free = NULL;
+      _used = 0;
+      _nchunks = 0;
+   }
+
+   ~FixedSizePool() {
+      for(size_t i = 0; i < _blocks.size(); ++i)
+         ::operator delete(_blocks[i]);
+   }
+
+   size_t get_size() const { return _size; }
+
+   void* allocate() {
+      char* chunk;
+      if(_free != NULL) {
+         chunk = reinterpret_cast<char*>(_free);
+         _free = _free->next;
+      }
+      else {
+         if(_next == _end)
+            grow();
+         chunk = _next;
+         _next += _chunk_size;
+      }
+      ++_used;
+      reinterpret_cast<Header*>(chunk)->pool = this;
+      return chunk + sizeof(Header);
+   }
+
+   void deallocate(char* chunk) {
+      FreeChunk* c = reinterpret_cast<FreeChunk*>(chunk);
+      c->next = _free;
+      _free = c;
+      --_used;
+   }
+
+   /// number of chunks currently in use
+   size_t get_nused() const { return _used; }
+   /// number of chunks in all blocks
+   size_t get_nchunks() const { return _nchunks; }
+};
+
+
+/// the pools of one graph, one for each object size
+class GraphPool {
+   std::vector<FixedSizePool*> _pools;
+
+   GraphPool(const GraphPool&);
+   GraphPool& operator=(const GraphPool&);
+
+public:
+   GraphPool() {}
+
+   ~GraphPool() {
+      for(size_t i = 0; i < _pools.size(); ++i)
+         delete _pools[i];
+   }
+
+   void* allocate(size_t size) {
+      // there are only a few different sizes
+      for(size_t i = 0; i < _pools.size(); ++i)
+         if(_pools[i]->get_size() == size)
+            return _pools[i]->allocate();
+      _pools.push_back(new FixedSizePool(size));
+      return _pools.back()->allocate();
+   }
+
+   /// memory of the given size from pool, or from the heap when pool is NULL
+   static void* allocate(GraphPool* pool, size_t size) {
+      typedef FixedSizePool::Header Header;
+      if(pool != NULL)
+         return pool->allocate(size);
+      char* chunk = static_cast<char*>(::operator new(sizeof(Header) + size));
+      reinterpret_cast<Header*>(chunk)->pool = NULL;
+      return chunk + sizeof(Header);
+   }
+
+   /// returns p to the pool it has been allocated from
+   static void deallocate(void* p) {
+      typedef FixedSizePool::Header Header;
+      if(p == NULL)
+         return;
+      char* chunk = static_cast<char*>(p) - sizeof(Header);
+      FixedSizePool* pool = reinterpret_cast<Header*>(chunk)->pool;
+      if(pool == NULL)
+         ::operator delete(chunk);
+      else
+         pool->deallocate(chunk);
+   }
+
+   /// number of chunks in use and allocated in all pools
+   size_t get_nused() const {
+      size_t n = 0;
+      for(size_t i = 0; i < _pools.size(); ++i)
+         n += _pools[i]->get_nused();
+      return n;
+   }
+   size_t get_nchunks() const {
+      size_t n = 0;
+      for(size_t i = 0; i < _pools.size(); ++i)
+         n += _pools[i]->get_nchunks();
+      return n;
+   }
+};
+
+
+#ifdef GRAPH_NO_POOL
+
+template<class T>
+class PoolAllocator : public std::allocator<T> {
+public:
+   template<class U> struct rebind { typedef PoolAllocator<U> other; };
+   PoolAllocator(GraphPool* = NULL) {}
+   PoolAllocator(const PoolAllocator&) : std::allocator<T>() {}
+   template<class U> PoolAllocator(const PoolAllocator<U>&) {}
+};
+
+#define GRAPH_POOL_OPERATORS(T) \
+   static void* operator new(size_t size, GraphPool*) { \
+      return ::operator new(size); \
+   } \
+   static void operator delete(void* p, GraphPool*) { \
+      ::operator delete(p); \
+   } \
+   static void* operator new(size_t size) { \
+      return ::operator new(size); \
+   } \
+   static void operator delete(void* p) { \
+      ::operator delete(p); \
+   }
+
+#else
+
+/// STL allocator taking single objects from the pool of a graph
+/// (or from the heap, when it has been constructed without a pool)
+template<class T>
+class PoolAllocator {
+public:
+   typedef T value_type;
+   typedef T* pointer;
+   typedef const T* const_pointer;
+   typedef T& reference;
+   typedef const T& const_reference;
+   typedef size_t size_type;
+   typedef ptrdiff_t difference_type;
+   template<class U> struct rebind { typedef PoolAllocator<U> other; };
+
+   GraphPool* _pool;
+
+   PoolAllocator(GraphPool* pool = NULL) : _pool(pool) {}
+   PoolAllocator(const PoolAllocator& a) : _pool(a._pool) {}
+   template<class U> PoolAllocator(const PoolAllocator<U>& a) : _pool(a._pool) {}
+
+   pointer address(reference x) const { return &x; }
+   const_pointer address(const_reference x) const { return &x; }
+   size_type max_size() const { return size_t(-1) / sizeof(T); }
+   void construct(pointer p, const T& value) { new(p) T(value); }
+   void destroy(pointer p) { p->~T(); }
+
+   pointer allocate(size_type n, const void* = 0) {
+      if(n == 1)
+         return static_cast<pointer>(GraphPool::allocate(_pool, sizeof(T)));
+      return static_cast<pointer>(::operator new(n * sizeof(T)));
+   }
+   void deallocate(pointer p, size_type n) {
+      if(n == 1)
+         GraphPool::deallocate(p);
+      else
+         ::operator delete(p);
+   }
+};
+
+// the memory of any allocator can be freed by any other
+template<class T, class U>
+inline bool operator==(const PoolAllocator<T>&, const PoolAllocator<U>&) {
+   return true;
+}
+template<class T, class U>
+inline bool operator!=(const PoolAllocator<T>&, const PoolAllocator<U>&) {
+   return false;
+}
+
+/// class specific operators new and delete for Node and Edge: new(pool)
+/// takes the object from the pool of a graph, plain new from the heap
+#define GRAPH_POOL_OPERATORS(T) \
+   static void* operator new(size_t size, GraphPool* pool) { \
+      return GraphPool::allocate(pool, size); \
+   } \
+   static void operator delete(void* p, GraphPool*) { \
+      GraphPool::deallocate(p); \
+   } \
+   static void* operator new(size_t size) { \
+      return GraphPool::allocate(NULL, size); \
+   } \
+   static void operator delete(void* p) { \
+      GraphPool::deallocate(p); \
+   }
+
+#endif
+
+}} // end Gamera::GraphApi
+
+#endif /* _GRAPH_POOL_HPP_3B1E07C2A94F58 */
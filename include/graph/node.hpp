@@ -32,6 +32,8 @@ struct Node {
    GraphData * _value;    /// < nodes's value
    Graph* _graph;
 
+   GRAPH_POOL_OPERATORS(Node)
+
    Node(GraphData * value, Graph* graph = NULL);
    ~Node();
    Node(Node& node);
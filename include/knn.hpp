@@ -176,6 +176,81 @@ namespace Gamera {
       return distance;
     }
 
+    /*
+      DISTANCE FUNCTIONS with bound.
+
+      These distance functions stop accumulating as soon as the distance
+      exceeds bound (usually the distance of the k-th nearest neighbor
+      found so far, see kNearestNeighbors::bound). The result is then
+      only a lower bound of the distance, but as it is greater than
+      bound, the candidate would be rejected anyway. To keep the inner
+      loops tight, the bound is only checked after every
+      bounded_block_size features.
+
+      Each function comes in two flavours: one for the whole feature
+      vector, and one for a list of feature indexes as in the distance
+      functions with skip. Putting the indexes of the features with the
+      largest weights first makes it possible to stop sooner.
+    */
+    enum { bounded_block_size = 8 };
+
+    /*
+      Accumulate the distance of a single feature; Metric is one of the
+      structs below.
+    */
+    struct CityBlockMetric {
+      static double apply(double known, double unknown) {
+        return std::abs(unknown - known);
+      }
+      static float apply(float known, float unknown) {
+        return std::abs(unknown - known);
+      }
+    };
+    struct EuclideanMetric {
+      static double apply(double known, double unknown) {
+        return std::sqrt((unknown - known) * (unknown - known));
+      }
+      static float apply(float known, float unknown) {
+        return std::sqrt((unknown - known) * (unknown - known));
+      }
+    };
+    struct FastEuclideanMetric {
+      static double apply(double known, double unknown) {
+        return (unknown - known) * (unknown - known);
+      }
+      static float apply(float known, float unknown) {
+        return (unknown - known) * (unknown - known);
+      }
+    };
+
+    template<class Metric, class IterA, class IterB, class IterC, class IterD>
+    inline double bounded_distance(IterA known, const IterA end,
+                                   IterB unknown, IterC selection,
+                                   IterD weight, double bound) {
+      double distance = 0;
+      while (known != end && distance <= bound) {
+        IterA block_end = known + std::min((long)(end - known), (long)bounded_block_size);
+        for (; known != block_end; ++known, ++unknown, ++selection, ++weight)
+          distance += (*selection) * ((*weight) * Metric::apply(*known, *unknown));
+      }
+      return distance;
+    }
+
+    template<class Metric, class IterA, class IterB, class IterC, class IterD, class IterE>
+    inline double bounded_distance_skip(IterA known, IterB unknown,
+                                        IterC selection, IterD weight,
+                                        IterE indexes, const IterE end,
+                                        double bound) {
+      double distance = 0;
+      while (indexes != end && distance <= bound) {
+        IterE block_end = indexes + std::min((long)(end - indexes), (long)bounded_block_size);
+        for (; indexes != block_end; ++indexes)
+          distance += selection[*indexes] * (weight[*indexes] *
+              Metric::apply(known[*indexes], unknown[*indexes]));
+      }
+      return distance;
+    }
+
     /*
       NORMALIZE
       
@@ -295,6 +370,342 @@ namespace Gamera {
       double* m_sum2_vector;
     };
 
+    /*
+      COMPRESSED FEATURE STORAGE
+
+      A compact copy of a database of feature vectors, which is scanned
+      to find the candidates for the nearest neighbors of an unknown
+      feature vector. The candidates are then re-ranked with the exact
+      feature vectors, so that the approximation only matters for
+      vectors at the edge of the candidate list. As the copy is stored
+      in one block and is much smaller than the vectors of doubles, the
+      scan needs far less memory bandwidth. The storage types are
+
+        STORAGE_DOUBLE  no compressed copy (the feature vectors are
+                        scanned exactly)
+        STORAGE_FLOAT   the features as floats
+        STORAGE_INT8    each feature linearly quantized to 256 levels
+                        between its minimum and maximum in the database
+        STORAGE_PQ      product quantization: the features are split into
+                        groups of pq_subspace_size, and each group is
+                        replaced by the index of the nearest of (at most)
+                        256 centroids, which are computed with k-means
+
+      The unknown vector is never quantized: the scan compares it with
+      the stored feature values (for STORAGE_INT8 and STORAGE_PQ through
+      a table of its distances to all quantization levels or centroids,
+      which is built once per query).
+      Selections and weights are applied during the scan, so they can
+      be changed without rebuilding the storage. Metric is one of the
+      structs used by the distance functions with bound.
+    */
+    enum FeatureStorage {
+      STORAGE_DOUBLE,
+      STORAGE_FLOAT,
+      STORAGE_INT8,
+      STORAGE_PQ
+    };
+
+    class CompressedFeatures {
+    public:
+      enum {
+        pq_subspace_size = 4,
+        pq_max_centroids = 256,
+        pq_max_training = 4096,
+        pq_iterations = 10
+      };
+      typedef std::pair<double, size_t> candidate_type;
+
+      CompressedFeatures(FeatureStorage type, size_t num_features) {
+        m_type = type;
+        m_num_features = num_features;
+        m_size = 0;
+        m_num_subspaces = (num_features + pq_subspace_size - 1) / pq_subspace_size;
+        m_num_centroids = 0;
+      }
+
+      // rows is a random access container of pointers to the feature vectors
+      template<class Rows>
+      void build(const Rows& rows) {
+        m_size = rows.size();
+        if (m_type == STORAGE_FLOAT) {
+          m_floats.resize(m_size * m_num_features);
+          for (size_t i = 0; i < m_size; ++i)
+            std::copy(rows[i], rows[i] + m_num_features, &m_floats[i * m_num_features]);
+        } else if (m_type == STORAGE_INT8) {
+          build_int8(rows);
+        } else if (m_type == STORAGE_PQ) {
+          build_pq(rows);
+        }
+      }
+
+      /*
+        Puts the num_candidates feature vectors with the smallest
+        approximate distance to unknown into result, sorted by their
+        index, and returns the index of the vector with the largest
+        approximate distance (kNearestNeighbors needs the maximum
+        distance for its confidences).
+      */
+      template<class Metric>
+      size_t candidates(const double* unknown, const int* selections,
+                        const double* weights, size_t num_candidates,
+                        std::vector<candidate_type>& result) const {
+        result.clear();
+        candidate_type farthest(-1.0, 0);
+        if (m_type == STORAGE_FLOAT) {
+          std::vector<float> u(unknown, unknown + m_num_features);
+          std::vector<float> w(m_num_features);
+          for (size_t f = 0; f < m_num_features; ++f)
+            w[f] = float(selections[f] * weights[f]);
+          for (size_t i = 0; i < m_size; ++i)
+            offer(result, num_candidates, farthest,
+                  float_distance<Metric>(&m_floats[i * m_num_features], &u[0], &w[0]), i);
+        } else {
+          size_t num_codes, num_values;
+          std::vector<float> table;
+          if (m_type == STORAGE_INT8) {
+            num_codes = m_num_features;
+            num_values = 256;
+            int8_table<Metric>(unknown, selections, weights, table);
+          } else {
+            num_codes = m_num_subspaces;
+            num_values = m_num_centroids;
+            pq_table<Metric>(unknown, selections, weights, table);
+          }
+          for (size_t i = 0; i < m_size; ++i)
+            offer(result, num_candidates, farthest,
+                  table_distance(&m_codes[i * num_codes], num_codes, &table[0], num_values), i);
+        }
+        std::sort(result.begin(), result.end(), by_index());
+        return farthest.second;
+      }
+
+      size_t size() const {
+        return m_size;
+      }
+      // the number of bytes used for the compressed feature vectors
+      size_t memory_size() const {
+        return m_floats.size() * sizeof(float) + m_codes.size() +
+          (m_offsets.size() + m_scales.size()) * sizeof(double) +
+          m_centroids.size() * sizeof(float);
+      }
+
+      struct by_index {
+        bool operator()(const candidate_type& a, const candidate_type& b) const {
+          return a.second < b.second;
+        }
+      };
+
+    private:
+
+      // keeps the num_candidates smallest distances in a heap (largest on
+      // top) and the largest distance in farthest
+      static void offer(std::vector<candidate_type>& heap, size_t num_candidates,
+                        candidate_type& farthest, double distance, size_t index) {
+        if (distance > farthest.first)
+          farthest = candidate_type(distance, index);
+        if (heap.size() < num_candidates) {
+          heap.push_back(candidate_type(distance, index));
+          std::push_heap(heap.begin(), heap.end());
+        } else if (distance < heap.front().first) {
+          std::pop_heap(heap.begin(), heap.end());
+          heap.back() = candidate_type(distance, index);
+          std::push_heap(heap.begin(), heap.end());
+        }
+      }
+
+      /*
+        The scans accumulate in float and in four independent sums, which
+        the compiler can keep in parallel (the precision does not matter,
+        as the candidates are compared exactly afterwards).
+      */
+      template<class Metric>
+      double float_distance(const float* known, const float* unknown,
+                            const float* w) const {
+        float d0 = 0, d1 = 0, d2 = 0, d3 = 0;
+        size_t f = 0;
+        for (; f + 4 <= m_num_features; f += 4) {
+          d0 += w[f] * Metric::apply(known[f], unknown[f]);
+          d1 += w[f + 1] * Metric::apply(known[f + 1], unknown[f + 1]);
+          d2 += w[f + 2] * Metric::apply(known[f + 2], unknown[f + 2]);
+          d3 += w[f + 3] * Metric::apply(known[f + 3], unknown[f + 3]);
+        }
+        for (; f < m_num_features; ++f)
+          d0 += w[f] * Metric::apply(known[f], unknown[f]);
+        return (d0 + d1) + (d2 + d3);
+      }
+
+      // the sum of table[s * num_values + codes[s]] over all codes
+      static double table_distance(const unsigned char* codes, size_t num_codes,
+                                   const float* table, size_t num_values) {
+        float d0 = 0, d1 = 0, d2 = 0, d3 = 0;
+        size_t s = 0;
+        for (; s + 4 <= num_codes; s += 4, table += 4 * num_values) {
+          d0 += table[codes[s]];
+          d1 += table[num_values + codes[s + 1]];
+          d2 += table[2 * num_values + codes[s + 2]];
+          d3 += table[3 * num_values + codes[s + 3]];
+        }
+        for (; s < num_codes; ++s, table += num_values)
+          d0 += table[codes[s]];
+        return (d0 + d1) + (d2 + d3);
+      }
+
+      // the weighted distances of unknown to all quantization levels
+      template<class Metric>
+      void int8_table(const double* unknown, const int* selections,
+                      const double* weights, std::vector<float>& table) const {
+        table.resize(m_num_features * 256);
+        for (size_t f = 0; f < m_num_features; ++f) {
+          double w = selections[f] * weights[f];
+          for (size_t c = 0; c < 256; ++c)
+            table[f * 256 + c] = float(w * Metric::apply(m_offsets[f] + m_scales[f] * c,
+                                                         unknown[f]));
+        }
+      }
+
+      // the weighted distances of unknown to all centroids of each subspace
+      template<class Metric>
+      void pq_table(const double* unknown, const int* selections,
+                    const double* weights, std::vector<float>& table) const {
+        table.resize(m_num_subspaces * m_num_centroids);
+        for (size_t s = 0; s < m_num_subspaces; ++s) {
+          size_t first = s * pq_subspace_size;
+          size_t last = std::min(first + pq_subspace_size, m_num_features);
+          for (size_t c = 0; c < m_num_centroids; ++c) {
+            const float* centroid = &m_centroids[(s * m_num_centroids + c) * pq_subspace_size];
+            double d = 0;
+            for (size_t f = first; f < last; ++f)
+              d += selections[f] * weights[f] * Metric::apply(double(centroid[f - first]), unknown[f]);
+            table[s * m_num_centroids + c] = float(d);
+          }
+        }
+      }
+
+      template<class Rows>
+      void build_int8(const Rows& rows) {
+        m_offsets.assign(m_num_features, 0.0);
+        m_scales.assign(m_num_features, 1.0);
+        for (size_t f = 0; f < m_num_features && m_size > 0; ++f) {
+          double lo = rows[0][f], hi = rows[0][f];
+          for (size_t i = 1; i < m_size; ++i) {
+            lo = std::min(lo, rows[i][f]);
+            hi = std::max(hi, rows[i][f]);
+          }
+          m_offsets[f] = lo;
+          if (hi > lo)
+            m_scales[f] = (hi - lo) / 255.0;
+        }
+        m_codes.resize(m_size * m_num_features);
+        for (size_t i = 0; i < m_size; ++i) {
+          for (size_t f = 0; f < m_num_features; ++f) {
+            double q = (rows[i][f] - m_offsets[f]) / m_scales[f] + 0.5;
+            m_codes[i * m_num_features + f] = (unsigned char)std::min(std::max(q, 0.0), 255.0);
+          }
+        }
+      }
+
+      // squared euclidean distance of the subspace s of a feature vector to a centroid
+      double pq_distance(const double* features, size_t s, const float* centroid) const {
+        size_t first = s * pq_subspace_size;
+        size_t last = std::min(first + pq_subspace_size, m_num_features);
+        double d = 0;
+        for (size_t f = first; f < last; ++f)
+          d += (features[f] - centroid[f - first]) * (features[f] - centroid[f - first]);
+        return d;
+      }
+
+      size_t pq_nearest(const double* features, size_t s) const {
+        size_t best = 0;
+        double best_distance = std::numeric_limits<double>::max();
+        for (size_t c = 0; c < m_num_centroids; ++c) {
+          double d = pq_distance(features, s,
+                                 &m_centroids[(s * m_num_centroids + c) * pq_subspace_size]);
+          if (d < best_distance) {
+            best_distance = d;
+            best = c;
+          }
+        }
+        return best;
+      }
+
+      /*
+        The centroids of each subspace are computed with a few iterations
+        of k-means on (at most pq_max_training) evenly spaced feature
+        vectors, starting from evenly spaced vectors of that sample.
+      */
+      template<class Rows>
+      void build_pq(const Rows& rows) {
+        std::vector<const double*> sample;
+        size_t step = (m_size + pq_max_training - 1) / pq_max_training;
+        for (size_t i = 0; i < m_size; i += std::max(step, (size_t)1))
+          sample.push_back(rows[i]);
+        int num_sample = (int)sample.size();
+        m_num_centroids = std::min((size_t)pq_max_centroids, sample.size());
+        m_centroids.assign(m_num_subspaces * m_num_centroids * pq_subspace_size, 0.0f);
+        std::vector<int> assignment(num_sample);
+        for (size_t s = 0; s < m_num_subspaces; ++s) {
+          size_t first = s * pq_subspace_size;
+          size_t last = std::min(first + pq_subspace_size, m_num_features);
+          float* centroids = &m_centroids[s * m_num_centroids * pq_subspace_size];
+          for (size_t c = 0; c < m_num_centroids; ++c) {
+            const double* features = sample[c * num_sample / m_num_centroids];
+            std::copy(features + first, features + last, centroids + c * pq_subspace_size);
+          }
+          std::vector<double> sums(m_num_centroids * pq_subspace_size);
+          std::vector<int> counts(m_num_centroids);
+          for (int iteration = 0; iteration < pq_iterations; ++iteration) {
+            int i;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+            for (i = 0; i < num_sample; ++i)
+              assignment[i] = (int)pq_nearest(sample[i], s);
+            std::fill(sums.begin(), sums.end(), 0.0);
+            std::fill(counts.begin(), counts.end(), 0);
+            for (i = 0; i < num_sample; ++i) {
+              counts[assignment[i]]++;
+              for (size_t f = first; f < last; ++f)
+                sums[assignment[i] * pq_subspace_size + f - first] += sample[i][f];
+            }
+            // empty clusters keep their centroid
+            for (size_t c = 0; c < m_num_centroids; ++c) {
+              if (counts[c] == 0)
+                continue;
+              for (size_t f = first; f < last; ++f)
+                centroids[c * pq_subspace_size + f - first] =
+                  float(sums[c * pq_subspace_size + f - first] / counts[c]);
+            }
+          }
+        }
+        m_codes.resize(m_size * m_num_subspaces);
+        int num_rows = (int)m_size;
+        int i;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (i = 0; i < num_rows; ++i) {
+          for (size_t s = 0; s < m_num_subspaces; ++s)
+            m_codes[i * m_num_subspaces + s] = (unsigned char)pq_nearest(rows[i], s);
+        }
+      }
+
+      FeatureStorage m_type;
+      size_t m_num_features;
+      size_t m_size;
+      // STORAGE_FLOAT: the feature vectors
+      std::vector<float> m_floats;
+      // STORAGE_INT8: the quantized features, STORAGE_PQ: the centroid indexes
+      std::vector<unsigned char> m_codes;
+      // STORAGE_INT8: feature value = offset + scale * code
+      std::vector<double> m_offsets;
+      std::vector<double> m_scales;
+      // STORAGE_PQ: pq_subspace_size values for each centroid of each subspace
+      size_t m_num_subspaces;
+      size_t m_num_centroids;
+      std::vector<float> m_centroids;
+    };
+
     /*
       K NEAREST NEIGHBORS
 
@@ -338,10 +749,12 @@ namespace Gamera {
       public:
         IdStat() {
           min_distance = std::numeric_limits<double>::max();
+          total_distance = 0;
           count = 0;
         }
         IdStat(double distance, size_t c) {
           min_distance = distance;
+          total_distance = distance;
           count = c;
         }
         double min_distance;
@@ -406,6 +819,18 @@ namespace Gamera {
         if (distance > m_max_distance)
           m_max_distance = distance;
       }
+      /*
+        The distance a candidate must stay below to become one of the k
+        nearest neighbors. Larger distances only matter for the nearest
+        unlike neighbor and the maximum distance used by
+        calculate_confidences, so callers that only need the majority
+        may stop computing a distance once it exceeds the bound.
+      */
+      double bound() const {
+        if (m_nn.size() < m_k)
+          return std::numeric_limits<double>::max();
+        return m_nn.back().distance;
+      }
       /*
         Find the id of the majority of the k nearest neighbors. This
         includes tie-breaking if necessary.
@@ -498,6 +923,64 @@ namespace Gamera {
           return;
         }
       }
+      /*
+        Same as majority, but for ids that are small integers in the range
+        [0, num_ids), e.g. class names that have been interned to the
+        indexes of a table of names. The histogram is a flat array indexed
+        by the id, so that no ids need to be compared. The remaining
+        classes follow the winner in ascending id order, which is the
+        same order as in majority() when the ids have been assigned in the
+        order of CompLT.
+      */
+      void majority(size_t num_ids) {
+        answer.clear();
+
+        if (m_nn.size() == 0)
+          throw std::range_error("majority called without enough valid neighbors.");
+        if (m_nn.size() == 1) {
+          answer.resize(1);
+          answer[0] = std::make_pair(m_nn[0].id, m_nn[0].distance);
+          return;
+        }
+        if (m_id_stats.size() < num_ids)
+          m_id_stats.resize(num_ids);
+        m_ids.clear();
+        for (typename vec_type::iterator i = m_nn.begin();
+             i != m_nn.end(); ++i) {
+          IdStat& stat = m_id_stats[i->id];
+          if (stat.count == 0) {
+            m_ids.push_back(i->id);
+            stat = IdStat(i->distance, 1);
+          } else {
+            stat.count++;
+            stat.total_distance += i->distance;
+            if (stat.min_distance > i->distance)
+              stat.min_distance = i->distance;
+          }
+        }
+        std::sort(m_ids.begin(), m_ids.end());
+        /*
+          The winner has the highest count, ties are broken by the
+          average distance.
+        */
+        size_t winner = 0;
+        for (size_t i = 1; i < m_ids.size(); ++i) {
+          const IdStat& best = m_id_stats[m_ids[winner]];
+          const IdStat& current = m_id_stats[m_ids[i]];
+          if (current.count > best.count ||
+              (current.count == best.count &&
+               current.total_distance < best.total_distance))
+            winner = i;
+        }
+        answer.push_back(std::make_pair(m_ids[winner],
+                                        m_id_stats[m_ids[winner]].min_distance));
+        for (size_t i = 0; i < m_ids.size(); ++i) {
+          if (i != winner)
+            answer.push_back(std::make_pair(m_ids[i],
+                                            m_id_stats[m_ids[i]].min_distance));
+          m_id_stats[m_ids[i]] = IdStat();
+        }
+      }
       void calculate_confidences() {
         size_t i,j;
         static double epsilonmin = std::numeric_limits<double>::min();
@@ -617,6 +1100,9 @@ namespace Gamera {
     private:
       size_t m_k;
       double m_max_distance;
+      // histogram used by majority(num_ids) and the ids found in it
+      std::vector<IdStat> m_id_stats;
+      std::vector<id_type> m_ids;
     };
 
   } // namespace kNN
@@ -23,9 +23,11 @@
 
 #include <Python.h>
 #include <vector>
+#include <functional>
 #include "gameramodule.hpp"
 #include "knn.hpp"
 #include "knnmodule.hpp"
+#include "native_threads.hpp"
 
 namespace Gamera { namespace kNN {
 
@@ -54,14 +56,23 @@ namespace Gamera { namespace kNN {
 
     // The id_names for the feature vectors
     char** id_names;
+    /*
+      The id_names interned to small integers: class_ids[i] is the index
+      of id_names[i] in class_names, which holds each distinct id_name
+      once (in ascending order, pointing into id_names). The
+      classification loops work on these ids and only translate them
+      back into names when the result is handed to Python.
+    */
+    int* class_ids;
+    std::vector<char*> class_names;
+    // number of feature vectors in each class, for use in leave-one-out
+    std::vector<int> class_sizes;
     // confidence types to be computed during classification
     std::vector<int> confidence_types;
     // The current selected features
     int *selection_vector;
     // The current weights applied to the distance calculation
     double* weight_vector;
-    // a histogram of the id_names for use in leave-one-out
-    int* id_name_histogram;
     /*
       The normalization applied to the feature vectors prior to distance
       calculation.
@@ -77,6 +88,27 @@ namespace Gamera { namespace kNN {
     size_t num_k;
     // the distance type currently being used.
     DistanceType distance_type;
+    /*
+      The storage used for classification (see CompressedFeatures in
+      knn.hpp). Unless it is STORAGE_DOUBLE, classify scans a compressed
+      copy of the feature vectors, which is built when it is first
+      needed, and only computes the exact distances of the num_rerank
+      best candidates found in it.
+    */
+    FeatureStorage storage_type;
+    size_t num_rerank;
+    CompressedFeatures* compressed;
+    /*
+      The number of threads of leave_one_out (0: one per processor).
+    */
+    unsigned int num_threads;
+    /*
+      The number of calls that currently read the data above without
+      holding the GIL (classify_list, leave_one_out and the editing
+      methods). As long as it is not zero, the methods that change or
+      free the data fail. It is only accessed with the GIL held.
+    */
+    int busy;
   };
 
   /*
@@ -93,10 +125,157 @@ namespace Gamera { namespace kNN {
     }
   };
 
-  static std::pair<int,int> leave_one_out(KnnObject* o, int stop_threshold,
+  /*
+    The kNearestNeighbors object used with the interned class ids
+  */
+  typedef kNearestNeighbors<int, std::less<int>, std::equal_to<int> > kNearestClassIds;
+
+  /*
+    Build the compressed feature storage of o, if one has been requested
+    and it does not exist yet.
+  */
+  inline void prepare_storage(KnnObject* o) {
+    if (o->storage_type == STORAGE_DOUBLE || o->compressed != 0 ||
+        o->feature_vectors == 0)
+      return;
+    o->compressed = new CompressedFeatures(o->storage_type, o->num_features);
+    o->compressed->build(*o->feature_vectors);
+  }
+
+  /*
+    Offer the feature vectors of o to knn, which collects the nearest
+    neighbors of unknown (an already normalized feature vector). With a
+    compressed storage (see prepare_storage), only the candidates found
+    in it are offered with their exact distance, together with the
+    farthest vector, which the confidences are relative to. They are
+    offered in the order of the feature vectors, so that ties are broken
+    in the same way as without compression. The confidences can still
+    differ from those without compression when the farthest vector or
+    the nearest unlike neighbor is not found in the compressed storage.
+  */
+  inline void find_nearest(KnnObject* o, const double* unknown, kNearestClassIds& knn) {
+    if (o->compressed == 0) {
+      for (size_t i = 0; i < o->feature_vectors->size(); ++i) {
+        double distance;
+        compute_distance(o->distance_type, (*o->feature_vectors)[i], o->num_features,
+                         unknown, &distance, o->selection_vector, o->weight_vector);
+        knn.add(o->class_ids[i], distance);
+      }
+      return;
+    }
+    // without feature vectors there is no farthest one either
+    if (o->feature_vectors->size() == 0)
+      return;
+    std::vector<CompressedFeatures::candidate_type> candidates;
+    size_t farthest = compressed_candidates(o->distance_type, *o->compressed, unknown,
+                                            o->selection_vector, o->weight_vector,
+                                            std::max(o->num_rerank, o->num_k),
+                                            candidates);
+    candidates.push_back(CompressedFeatures::candidate_type(0.0, farthest));
+    std::inplace_merge(candidates.begin(), candidates.end() - 1, candidates.end(),
+                       CompressedFeatures::by_index());
+    for (size_t c = 0; c < candidates.size(); ++c) {
+      size_t i = candidates[c].second;
+      if (c > 0 && i == candidates[c - 1].second)
+        continue;
+      double distance;
+      compute_distance(o->distance_type, (*o->feature_vectors)[i], o->num_features,
+                       unknown, &distance, o->selection_vector, o->weight_vector);
+      knn.add(o->class_ids[i], distance);
+    }
+  }
+
+  /*
+    The state of leave_one_out shared by its threads. Each thread takes
+    the next query with the mutex held, and adds its counts when it is
+    done. Once more than stop_threshold queries have been answered
+    wrong, no more queries are taken, so that the result of an
+    interrupted run still has more than stop_threshold errors (the
+    exact counts then depend on the order in which the threads
+    finished their queries).
+  */
+  struct LeaveOneOutJob {
+    KnnObject* o;
+    int stop_threshold;
+    int* selections;
+    double* weights;
+    bool all_features;
+    BoundedDistance distance_function;
+    BoundedDistanceSkip distance_skip_function;
+    const long* features_begin;
+    const long* features_end;
+    int min_class_size;
+    NativeMutex mutex;
+    int next, total_correct, total_queries, total_wrong;
+  };
+
+  inline void leave_one_out_worker(void* arg) {
+    LeaveOneOutJob* job = (LeaveOneOutJob*)arg;
+    KnnObject* o = job->o;
+    int num_feature_vectors = (int)o->feature_vectors->size();
+    // each thread has its own kNearestNeighbors object
+    kNearestClassIds knn(o->num_k);
+    int correct = 0, queries = 0;
+    bool wrong = false;
+    while (true) {
+      int i;
+      {
+        NativeLock lock(job->mutex);
+        if (wrong)
+          job->total_wrong++;
+        if (job->next == num_feature_vectors || job->total_wrong > job->stop_threshold)
+          break;
+        i = job->next++;
+      }
+      wrong = false;
+      // We don't want to do the calculation if there is no
+      // hope that kNN will return the correct answer (because
+      // there aren't enough examples in the database).
+      if (o->class_sizes[o->class_ids[i]] < job->min_class_size)
+        continue;
+      double* unknown = (*o->feature_vectors)[i];
+      for (int j = 0; j < num_feature_vectors; ++j) {
+        if (i == j)
+          continue;
+        double* known = (*o->feature_vectors)[j];
+        double distance;
+        if (job->all_features)
+          distance = job->distance_function(known, known + o->num_features, unknown,
+                                            job->selections, job->weights, knn.bound());
+        else
+          distance = job->distance_skip_function(known, unknown, job->selections,
+                                                 job->weights, job->features_begin,
+                                                 job->features_end, knn.bound());
+        knn.add(o->class_ids[j], distance);
+      }
+      knn.majority(o->class_names.size());
+      if (knn.answer[0].first == o->class_ids[i])
+        correct++;
+      else
+        wrong = true;
+      knn.reset();
+      queries++;
+    }
+    NativeLock lock(job->mutex);
+    job->total_correct += correct;
+    job->total_queries += queries;
+  }
+
+  /*
+    Leave-one-out cross validation on the feature vectors of o. Only
+    the features in indexes (all features when 0) are used. Because
+    only the majority of the neighbors matters, each distance is
+    abandoned as soon as it exceeds the distance of the current k-th
+    nearest neighbor. With weight_order, the features are visited in
+    the order of descending weight, so that this happens sooner; the
+    distances are then summed in a different order, which can make a
+    difference for neighbors at (nearly) the same distance.
+  */
+  inline std::pair<int,int> leave_one_out(KnnObject* o, int stop_threshold,
                                           int* selection_vector = 0,
                                           double* weight_vector = 0,
-                                          std::vector<long>* indexes = 0) {
+                                          std::vector<long>* indexes = 0,
+                                          bool weight_order = false) {
     int* selections = selection_vector;
     if (selections == 0) {
       selections = o->selection_vector;
@@ -108,73 +287,365 @@ namespace Gamera { namespace kNN {
     }
 
     assert(o->feature_vectors != 0);
-    kNearestNeighbors<char*, ltstr, eqstr> knn(o->num_k);
+    // the features in the order they are visited (unless all features
+    // are used in their natural order)
+    bool all_features = (indexes == 0 && !weight_order);
+    std::vector<long> features;
+    if (indexes == 0) {
+      features.resize(o->num_features);
+      for (size_t i = 0; i < o->num_features; ++i)
+        features[i] = i;
+    } else {
+      features = *indexes;
+    }
+    if (weight_order)
+      order_by_weight(features, selections, weights);
+
+    LeaveOneOutJob job;
+    job.o = o;
+    job.stop_threshold = stop_threshold;
+    job.selections = selections;
+    job.weights = weights;
+    job.all_features = all_features;
+    job.distance_function = bounded_distance_function(o->distance_type);
+    job.distance_skip_function = bounded_distance_skip_function(o->distance_type);
+    job.features_begin = features.empty() ? 0 : &features[0];
+    job.features_end = job.features_begin + features.size();
+    job.min_class_size = int((o->num_k + 0.5) / 2);
+    job.next = 0;
+    job.total_correct = 0;
+    job.total_queries = 0;
+    job.total_wrong = 0;
+
+    /*
+      The queries are distributed over num_threads native threads (see
+      native_threads.hpp), so that they also run in parallel when Gamera
+      has not been compiled with OpenMP. The genetic algorithms evaluate
+      their population on threads of their own and only call this
+      function when they run a single evaluation thread (see
+      setThreadedQueries in knnga.hpp), so that the threads are not
+      oversubscribed.
+    */
+    size_t num_threads = o->num_threads;
+    if (num_threads == 0)
+      num_threads = native_processor_count();
+    num_threads = std::max(std::min(num_threads, o->feature_vectors->size()), size_t(1));
+    run_native_threads((unsigned int)num_threads, leave_one_out_worker, &job);
+    return std::make_pair(job.total_correct, job.total_queries);
+  }
+
+  /*
+    The same as leave_one_out with weight_order and without a stop
+    threshold, but each pair of feature vectors is visited only once:
+    the neighbor lists of all queries are kept at the same time, and
+    the distance of a pair is offered to both of them. A distance is
+    abandoned when it exceeds the bounds of both queries. As the
+    candidates still reach every query in ascending order and the
+    distances are summed in the same order, the result is identical to
+    that of leave_one_out, for about half of the work. This is meant
+    for callers that evaluate many selections or weights on one
+    database (like the genetic algorithms), and does not use threads.
+  */
+  inline std::pair<int,int> leave_one_out_pairwise(KnnObject* o,
+                                                   int* selection_vector = 0,
+                                                   double* weight_vector = 0) {
+    int* selections = selection_vector;
+    if (selections == 0) {
+      selections = o->selection_vector;
+    }
+
+    double* weights = weight_vector;
+    if (weights == 0) {
+      weights = o->weight_vector;
+    }
+
+    assert(o->feature_vectors != 0);
+    std::vector<long> features(o->num_features);
+    for (size_t i = 0; i < o->num_features; ++i)
+      features[i] = i;
+    order_by_weight(features, selections, weights);
+
+    BoundedDistanceSkip distance_skip_function =
+      bounded_distance_skip_function(o->distance_type);
+    const long* features_begin = features.empty() ? 0 : &features[0];
+    const long* features_end = features_begin + features.size();
+
+    size_t num_feature_vectors = o->feature_vectors->size();
+    int min_class_size = int((o->num_k + 0.5) / 2);
+    std::vector<char> is_query(num_feature_vectors);
+    for (size_t i = 0; i < num_feature_vectors; ++i)
+      is_query[i] = o->class_sizes[o->class_ids[i]] >= min_class_size;
+
+    // the copies are made before any neighbors have been added
+    std::vector<kNearestClassIds> knn(num_feature_vectors, kNearestClassIds(o->num_k));
+    for (size_t i = 0; i < num_feature_vectors; ++i) {
+      double* unknown = (*o->feature_vectors)[i];
+      for (size_t j = i + 1; j < num_feature_vectors; ++j) {
+        if (!is_query[i] && !is_query[j])
+          continue;
+        double bound;
+        if (!is_query[i])
+          bound = knn[j].bound();
+        else if (!is_query[j])
+          bound = knn[i].bound();
+        else
+          bound = std::max(knn[i].bound(), knn[j].bound());
+        double distance = distance_skip_function((*o->feature_vectors)[j], unknown,
+                                                 selections, weights,
+                                                 features_begin, features_end, bound);
+        if (is_query[i])
+          knn[i].add(o->class_ids[j], distance);
+        if (is_query[j])
+          knn[j].add(o->class_ids[i], distance);
+      }
+    }
 
     int total_correct = 0;
     int total_queries = 0;
-    if (indexes == 0) {
-      for (size_t i = 0; i < o->feature_vectors->size(); ++i/*, cur += o->num_features*/) {
-        // We don't want to do the calculation if there is no
-        // hope that kNN will return the correct answer (because
-        // there aren't enough examples in the database).
-        if (o->id_name_histogram[i] < int((o->num_k + 0.5) / 2)) {
+    for (size_t i = 0; i < num_feature_vectors; ++i) {
+      if (!is_query[i])
+        continue;
+      knn[i].majority(o->class_names.size());
+      if (knn[i].answer[0].first == o->class_ids[i])
+        total_correct++;
+      total_queries++;
+    }
+    return std::make_pair(total_correct, total_queries);
+  }
+
+  /*
+    DATABASE EDITING
+
+    The following functions select a subset of the feature vectors of o
+    (keep[i] tells whether vector i is kept), from which a smaller or
+    cleaner classifier can be built. They use the distance type,
+    selections and weights of o.
+  */
+
+  /*
+    The majority class of the k nearest neighbors of vector i among the
+    vectors in candidates (vector i itself is skipped).
+  */
+  inline int edit_classify(KnnObject* o, kNearestClassIds& knn, size_t i,
+                           const size_t* candidates, const size_t* candidates_end,
+                           BoundedDistance distance_function) {
+    double* unknown = (*o->feature_vectors)[i];
+    knn.reset();
+    for (; candidates != candidates_end; ++candidates) {
+      if (*candidates == i)
+        continue;
+      double* known = (*o->feature_vectors)[*candidates];
+      knn.add(o->class_ids[*candidates],
+              distance_function(known, known + o->num_features, unknown,
+                                o->selection_vector, o->weight_vector, knn.bound()));
+    }
+    knn.majority(o->class_names.size());
+    return knn.answer[0].first;
+  }
+
+  /*
+    Wilson's editing: removes the vectors that are misclassified by the
+    majority of their k nearest neighbors, except for those of classes
+    with fewer than rare_threshold vectors. Only the vectors from begin
+    to end-1 are classified, so that the caller can report the progress
+    in between; keep must have been filled with ones for all vectors
+    before. The vectors are classified in parallel when compiled with
+    OpenMP.
+  */
+  inline void edit_wilson(KnnObject* o, size_t k, int rare_threshold,
+                          std::vector<char>& keep, size_t begin, size_t end) {
+    int n = (int)o->feature_vectors->size();
+    std::vector<size_t> all(n);
+    for (int i = 0; i < n; ++i)
+      all[i] = i;
+    BoundedDistance distance_function = bounded_distance_function(o->distance_type);
+    int first = (int)begin, last = (int)end;
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+      kNearestClassIds knn(k);
+      int i;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+      for (i = first; i < last; ++i) {
+        if (o->class_sizes[o->class_ids[i]] < rare_threshold)
+          continue;
+        if (edit_classify(o, knn, i, &all[0], &all[0] + n, distance_function)
+            != o->class_ids[i])
+          keep[i] = 0;
+      }
+    }
+  }
+
+  /*
+    Hart's condensed nearest neighbor: starting with a store holding
+    only the first vector of order, the remaining vectors are classified
+    with the store in the given order, and each misclassified vector is
+    moved into the store. This is repeated until a pass moves no vector.
+    Each call of run classifies at most max_queries vectors, so that the
+    caller can report the progress (the size of the store) in between.
+  */
+  class CondenseHart {
+  public:
+    CondenseHart(KnnObject* o, size_t k, const std::vector<size_t>& order,
+                 std::vector<char>& keep)
+      : m_o(o), m_knn(k), m_keep(keep), m_next(0), m_changed(false),
+        m_distance_function(bounded_distance_function(o->distance_type)) {
+      keep.assign(o->feature_vectors->size(), 0);
+      if (order.empty())
+        return;
+      m_store.push_back(order[0]);
+      m_grabbag.assign(order.begin() + 1, order.end());
+      keep[order[0]] = 1;
+    }
+
+    // returns false once a pass has moved no vector
+    bool run(size_t max_queries) {
+      for (size_t q = 0; q < max_queries; ++q) {
+        if (m_next == m_grabbag.size()) {
+          if (!m_changed)
+            return false;
+          m_grabbag.swap(m_remaining);
+          m_remaining.clear();
+          m_next = 0;
+          m_changed = false;
           continue;
         }
-        double* current_known;
-        double* unknown = (*o->feature_vectors)[i];
-        for (size_t j = 0; j < o->feature_vectors->size(); ++j) {
-          current_known = (*o->feature_vectors)[j];
-          if (i == j)
-            continue;
-          double distance;
-          compute_distance(o->distance_type, current_known, o->num_features,
-                           unknown, &distance, selections, weights);
-          knn.add(o->id_names[j], distance);
-        }
-        knn.majority();
-        if (strcmp(knn.answer[0].first, o->id_names[i]) == 0) {
-          total_correct++;
+        size_t i = m_grabbag[m_next++];
+        if (edit_classify(m_o, m_knn, i, &m_store[0], &m_store[0] + m_store.size(),
+                          m_distance_function) != m_o->class_ids[i]) {
+          m_store.push_back(i);
+          m_keep[i] = 1;
+          m_changed = true;
+        } else {
+          m_remaining.push_back(i);
         }
-        knn.reset();
-        total_queries++;
-        if (total_queries - total_correct > stop_threshold)
-          return std::make_pair(total_correct, total_queries);
       }
-    } else {
-      for (size_t i = 0; i < o->feature_vectors->size(); ++i) {
-        if (o->id_name_histogram[i] < int((o->num_k + 0.5) / 2))
-          continue;
-        double* current_known;
-        double* unknown = (*o->feature_vectors)[i];
-        for (size_t j = 0; j < o->feature_vectors->size(); ++j) {
-          current_known = (*o->feature_vectors)[j];
-          if (i == j)
-            continue;
-          double distance;
-          if (o->distance_type == CITY_BLOCK) {
-            distance = city_block_distance_skip(current_known, unknown, selections, weights,
-                                                indexes->begin(), indexes->end());
-          } else if (o->distance_type == FAST_EUCLIDEAN) {
-            distance = fast_euclidean_distance_skip(current_known, unknown, selections, weights,
-                                                    indexes->begin(), indexes->end());
-          } else {
-            distance = euclidean_distance_skip(current_known, unknown, selections, weights,
-                                               indexes->begin(), indexes->end());
-          }
+      return true;
+    }
+
+    size_t store_size() const { return m_store.size(); }
 
-          knn.add(o->id_names[j], distance);
+  private:
+    KnnObject* m_o;
+    kNearestClassIds m_knn;
+    std::vector<char>& m_keep;
+    std::vector<size_t> m_store, m_grabbag, m_remaining;
+    size_t m_next;
+    bool m_changed;
+    BoundedDistance m_distance_function;
+  };
+
+  /*
+    The indexes of the vectors of each class.
+  */
+  inline void class_members(KnnObject* o, std::vector<std::vector<size_t> >& classes) {
+    classes.assign(o->class_names.size(), std::vector<size_t>());
+    for (size_t i = 0; i < o->feature_vectors->size(); ++i)
+      classes[o->class_ids[i]].push_back(i);
+  }
+
+  /*
+    Prototype reduction for the vectors of one class (members): they are
+    divided into round(ratio * class size) clusters (at least one), and
+    only the medoid of each cluster is kept. The clusters are found with
+    the alternating k-medoids algorithm (assign each vector to its
+    nearest medoid, then replace each medoid by the member with the
+    smallest sum of distances to the other members), starting from a
+    farthest first traversal, so that the result is deterministic. The
+    caller calls this for each class, with keep initially filled with
+    zeros.
+  */
+  inline void reduce_medoids(KnnObject* o, const std::vector<size_t>& members,
+                             double ratio, std::vector<char>& keep,
+                             int max_iterations = 10) {
+    BoundedDistance distance_function = bounded_distance_function(o->distance_type);
+    const double unbounded = std::numeric_limits<double>::max();
+    int size = (int)members.size();
+    if (size == 0)
+      return;
+    int num_medoids = std::min(size, std::max(1, int(ratio * size + 0.5)));
+    std::vector<double*> vectors(size);
+    for (int i = 0; i < size; ++i)
+      vectors[i] = (*o->feature_vectors)[members[i]];
+
+    // farthest first traversal, starting with the first member
+    std::vector<int> medoids(1, 0);
+    std::vector<double> nearest(size, unbounded);
+    while ((int)medoids.size() < num_medoids) {
+      double* medoid = vectors[medoids.back()];
+      int farthest = 0;
+      for (int i = 0; i < size; ++i) {
+        double d = distance_function(vectors[i], vectors[i] + o->num_features, medoid,
+                                     o->selection_vector, o->weight_vector, nearest[i]);
+        if (d < nearest[i])
+          nearest[i] = d;
+        if (nearest[i] > nearest[farthest])
+          farthest = i;
+      }
+      if (nearest[farthest] == 0)
+        break;  // the remaining members are duplicates of medoids
+      medoids.push_back(farthest);
+    }
+    num_medoids = (int)medoids.size();
+
+    std::vector<int> cluster(size, -1);
+    for (int iteration = 0; iteration < max_iterations; ++iteration) {
+      // assign each member to its nearest medoid
+      bool reassigned = false;
+      int i;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 64) reduction(||:reassigned)
+#endif
+      for (i = 0; i < size; ++i) {
+        int best = 0;
+        double best_distance = unbounded;
+        for (int m = 0; m < num_medoids; ++m) {
+          double d = distance_function(vectors[i], vectors[i] + o->num_features,
+                                       vectors[medoids[m]], o->selection_vector,
+                                       o->weight_vector, best_distance);
+          if (d < best_distance) {
+            best_distance = d;
+            best = m;
+          }
         }
-        knn.majority();
-        if (strcmp(knn.answer[0].first, o->id_names[i]) == 0) {
-          total_correct++;
+        if (cluster[i] != best) {
+          cluster[i] = best;
+          reassigned = true;
+        }
+      }
+      if (!reassigned)
+        break;
+
+      // replace each medoid by the best member of its cluster
+      std::vector<std::vector<int> > clusters(num_medoids);
+      for (i = 0; i < size; ++i)
+        clusters[cluster[i]].push_back(i);
+      int m;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+      for (m = 0; m < num_medoids; ++m) {
+        const std::vector<int>& in = clusters[m];
+        double best_sum = unbounded;
+        for (size_t a = 0; a < in.size(); ++a) {
+          double sum = 0;
+          for (size_t b = 0; b < in.size() && sum <= best_sum; ++b)
+            sum += distance_function(vectors[in[a]], vectors[in[a]] + o->num_features,
+                                     vectors[in[b]], o->selection_vector,
+                                     o->weight_vector, unbounded);
+          if (sum < best_sum) {
+            best_sum = sum;
+            medoids[m] = in[a];
+          }
         }
-        knn.reset();
-        total_queries++;
-        if (total_queries - total_correct > stop_threshold)
-          return std::make_pair(total_correct, total_queries);
       }
     }
-    return std::make_pair(total_correct, total_queries);
+
+    for (int m = 0; m < num_medoids; ++m)
+      keep[members[medoids[m]]] = 1;
   }
 
 }} // end of namespaces
@@ -32,9 +32,16 @@
 #include <time.h>
 #include <map>
 
-#ifdef _OPENMP
-#include <omp.h>
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
 #endif
+#include <windows.h>
+#else
+#include <sys/time.h>
+#endif
+
+#include "native_threads.hpp"
 
 #include <eo>
 #include <es.h>
@@ -55,6 +62,17 @@ namespace Gamera { namespace GA {
     template <typename EOT>
     class SelectOneDefaultWorth : public eoSelectOne<EOT> {};
 
+    /**************************************************************************/
+    // The population is evaluated on the native threads of
+    // native_threads.hpp, which do not depend on whether the module has
+    // been compiled with OpenMP.
+    /**************************************************************************/
+    typedef NativeMutex GAMutex;
+    typedef NativeLock GALock;
+
+    // wall clock time in seconds
+    double wallTime();
+
     /**************************************************************************/
     template<class EOT>
     class GATwoOptMutation : public eoMonOp<EOT> {
@@ -259,10 +277,61 @@ namespace Gamera { namespace GA {
             typedef typename EOT::ContainerType ContainerType;
             typedef typename EOT::AtomType AtomType;
 
+            // Fitness of the individuals evaluated so far. Crossover and
+            // mutation often reproduce an individual that has been seen
+            // before, and its leave-one-out is not computed again.
+            std::map<ContainerType, double> fitnessCache;
+            GAMutex fitnessCacheMutex;
+            enum { maxCacheSize = 100000 };
+
+            bool lookupFitness(EOT &individual) {
+                GALock lock(this->fitnessCacheMutex);
+                typename std::map<ContainerType, double>::const_iterator it =
+                    this->fitnessCache.find(individual);
+                if (it == this->fitnessCache.end()) {
+                    return false;
+                }
+                individual.fitness(it->second);
+                return true;
+            }
+
+            void storeFitness(EOT &individual, double fitness) {
+                individual.fitness(fitness);
+                GALock lock(this->fitnessCacheMutex);
+                if (this->fitnessCache.size() < maxCacheSize)
+                    this->fitnessCache[individual] = fitness;
+            }
+
+            // whether the queries of a single evaluation may be spread
+            // over the threads of leave_one_out
+            bool threadedQueries;
+
+            // Leave-one-out with the given selections or weights. Both
+            // functions give the same result; the queries of leave_one_out
+            // are spread over the kNN object's num_threads threads, which
+            // only pays off when the population is not evaluated in
+            // parallel anyway.
+            std::pair<int, int> leaveOneOut(int *selections, double *weights) {
+                unsigned int threads = this->knn->num_threads;
+                if (threads == 0) {
+                    threads = native_processor_count();
+                }
+                if (this->threadedQueries && threads > 1) {
+                    return leave_one_out(this->knn, std::numeric_limits<int>::max(),
+                                         selections, weights, NULL, true);
+                }
+                return leave_one_out_pairwise(this->knn, selections, weights);
+            }
+
         public:
             GAFitnessEval(KnnObject *knn, std::map<unsigned int, unsigned int> *indexRelation) {
                 this->knn = knn;
                 this->indexRelation = indexRelation;
+                this->threadedQueries = true;
+            }
+
+            void setThreadedQueries(bool threaded) {
+                this->threadedQueries = threaded;
             }
 
             virtual std::string className(void) const { return "GAFitnessEval"; }
@@ -273,6 +342,10 @@ namespace Gamera { namespace GA {
     // specialization for weighting individual
     template <>
     void GAFitnessEval<WeightingIndi>::operator()( WeightingIndi &individual ) {
+        if (this->lookupFitness(individual)) {
+            return;
+        }
+
         AtomType convertedVector[this->knn->num_features];
         std::fill(convertedVector, convertedVector + this->knn->num_features, 0.0);
 
@@ -281,15 +354,18 @@ namespace Gamera { namespace GA {
         }
 
         std::pair<int, int> looEvalRes;
-        looEvalRes = leave_one_out(this->knn, std::numeric_limits<int>::max(),
-                                   NULL, convertedVector, NULL);
+        looEvalRes = this->leaveOneOut(NULL, convertedVector);
 
-        individual.fitness( looEvalRes.first / (double) looEvalRes.second );
+        this->storeFitness(individual, looEvalRes.first / (double) looEvalRes.second);
     }
 
     // specialization for selection individual
     template <>
     void GAFitnessEval<SelectionIndi>::operator()( SelectionIndi &individual ) {
+        if (this->lookupFitness(individual)) {
+            return;
+        }
+
         int convertedVector[this->knn->num_features];
         std::fill(convertedVector, convertedVector + this->knn->num_features, 0);
 
@@ -301,12 +377,91 @@ namespace Gamera { namespace GA {
         }
 
         std::pair<int, int> looEvalRes;
-        looEvalRes = leave_one_out(this->knn, std::numeric_limits<int>::max(),
-                                   convertedVector, NULL, NULL);
+        looEvalRes = this->leaveOneOut(convertedVector, NULL);
 
-        individual.fitness( looEvalRes.first / (double) looEvalRes.second );
+        this->storeFitness(individual, looEvalRes.first / (double) looEvalRes.second);
     }
 
+    // *************************************************************************
+    template <typename EOT>
+    class GAPopulationEval : public eoPopEvalFunc<EOT> {
+    // *************************************************************************
+    // Evaluates the individuals without a valid fitness on threadNum
+    // native threads, which take the next individual as soon as they are
+    // done with the previous one. The evaluation needs no Python objects
+    // and runs with the GIL released. The wall clock time of the latest
+    // evaluation is kept in evalTime for the monitor.
+        protected:
+            GAFitnessEval<EOT> &fitness;
+            eoValueParam<unsigned long> &evalCounter;
+            eoValueParam<double> &evalTime;
+            unsigned int threadNum;
+
+            struct Job {
+                GAFitnessEval<EOT> *fitness;
+                std::vector<EOT*> individuals;
+                size_t next;
+                GAMutex mutex;
+                std::string error;
+            };
+
+            static void worker(void *arg) {
+                Job *job = (Job*) arg;
+                while (true) {
+                    EOT *individual;
+                    {
+                        GALock lock(job->mutex);
+                        if (job->next == job->individuals.size() || !job->error.empty()) {
+                            return;
+                        }
+                        individual = job->individuals[job->next++];
+                    }
+                    try {
+                        (*job->fitness)(*individual);
+                    } catch (std::exception &e) {
+                        GALock lock(job->mutex);
+                        job->error = e.what();
+                    }
+                }
+            }
+
+        public:
+            GAPopulationEval(GAFitnessEval<EOT> &fitness,
+                             eoValueParam<unsigned long> &evalCounter,
+                             eoValueParam<double> &evalTime,
+                             unsigned int threadNum)
+            : fitness(fitness), evalCounter(evalCounter), evalTime(evalTime) {
+                this->threadNum = std::max(threadNum, 1u);
+            }
+
+            virtual std::string className(void) const { return "GAPopulationEval"; }
+
+            void operator()(eoPop<EOT> &parents, eoPop<EOT> &offspring) {
+                double start = wallTime();
+
+                Job job;
+                job.fitness = &this->fitness;
+                job.next = 0;
+                for (size_t i = 0; i < offspring.size(); ++i) {
+                    if (offspring[i].invalid()) {
+                        job.individuals.push_back(&offspring[i]);
+                    }
+                }
+
+                unsigned int threads = (unsigned int) std::min((size_t) this->threadNum,
+                                                               job.individuals.size());
+                // a single thread spreads the queries of each evaluation instead
+                this->fitness.setThreadedQueries(threads <= 1);
+                run_native_threads(threads, &GAPopulationEval<EOT>::worker, &job);
+
+                if (!job.error.empty()) {
+                    throw std::runtime_error(job.error);
+                }
+                this->evalCounter.value() += job.individuals.size();
+                this->evalTime.value() = wallTime() - start;
+            }
+    };
+
     ////////////////////////////////////////////////////////////////////////////
     ////////////////////////////////////////////////////////////////////////////
     ////////////////////////////////////////////////////////////////////////////
@@ -347,6 +502,7 @@ namespace Gamera { namespace GA {
             unsigned int pSize;
             double cRate;
             double mRate;
+            unsigned int seed;
 
         public:
             GABaseSetting(int opMode = GA_SELECTION,
@@ -357,12 +513,14 @@ namespace Gamera { namespace GA {
             unsigned int getPopSize();
             double getCrossRate();
             double getMutRate();
+            unsigned int getSeed();
 
             // setter
             void setOpMode(int opMode);
             void setPopSize(unsigned int pSize);
             void setCrossRate(double cRate);
             void setMutRate(double mRate);
+            void setSeed(unsigned int seed);
     };
 
     /**************************************************************************/
@@ -487,6 +645,7 @@ namespace Gamera { namespace GA {
             GAManualStop<EOT> manualStop;
 
             eoIncrementorParam<unsigned int> *generationCounter;
+            eoValueParam<double> *evalTime;
             eoBestFitnessStat<EOT> *bestStat;
             GAClassifierUpdater<EOT> *kNNUpdater;
 
@@ -24,6 +24,8 @@
 #define KWM12172002_knnmodule
 
 #include <Python.h>
+#include <vector>
+#include <algorithm>
 #include "knn.hpp"
 
 using namespace Gamera;
@@ -110,6 +112,91 @@ inline void compute_distance(DistanceType distance_type, const double* known_buf
 }
 
 
+/*
+  The distance functions with bound (see knn.hpp) for a distance type.
+  They are called through a function pointer, which takes the test of
+  the distance type out of the inner loops and keeps the functions out
+  of line, so that their accumulator stays in a register even in large
+  loops like the one in leave_one_out.
+*/
+typedef double (*BoundedDistance)(const double* known, const double* end,
+                                  const double* unknown, const int* selections,
+                                  const double* weights, double bound);
+typedef double (*BoundedDistanceSkip)(const double* known, const double* unknown,
+                                      const int* selections, const double* weights,
+                                      const long* indexes, const long* end,
+                                      double bound);
+
+inline BoundedDistance bounded_distance_function(DistanceType distance_type) {
+  if (distance_type == CITY_BLOCK)
+    return &bounded_distance<CityBlockMetric, const double*, const double*,
+                             const int*, const double*>;
+  else if (distance_type == FAST_EUCLIDEAN)
+    return &bounded_distance<FastEuclideanMetric, const double*, const double*,
+                             const int*, const double*>;
+  else
+    return &bounded_distance<EuclideanMetric, const double*, const double*,
+                             const int*, const double*>;
+}
+
+inline BoundedDistanceSkip bounded_distance_skip_function(DistanceType distance_type) {
+  if (distance_type == CITY_BLOCK)
+    return &bounded_distance_skip<CityBlockMetric, const double*, const double*,
+                                  const int*, const double*, const long*>;
+  else if (distance_type == FAST_EUCLIDEAN)
+    return &bounded_distance_skip<FastEuclideanMetric, const double*, const double*,
+                                  const int*, const double*, const long*>;
+  else
+    return &bounded_distance_skip<EuclideanMetric, const double*, const double*,
+                                  const int*, const double*, const long*>;
+}
+
+/*
+  The candidates for the nearest neighbors of unknown in a compressed
+  feature storage (see knn.hpp), using the metric of a distance type.
+  Returns the index of the farthest feature vector.
+*/
+inline size_t compressed_candidates(DistanceType distance_type,
+                                  const CompressedFeatures& storage,
+                                  const double* unknown, const int* selections,
+                                  const double* weights, size_t num_candidates,
+                                  std::vector<CompressedFeatures::candidate_type>& result) {
+  if (distance_type == CITY_BLOCK)
+    return storage.candidates<CityBlockMetric>(unknown, selections, weights,
+                                        num_candidates, result);
+  else if (distance_type == FAST_EUCLIDEAN)
+    return storage.candidates<FastEuclideanMetric>(unknown, selections, weights,
+                                            num_candidates, result);
+  else
+    return storage.candidates<EuclideanMetric>(unknown, selections, weights,
+                                        num_candidates, result);
+}
+
+/*
+  order_by_weight orders a list of feature indexes for the functions
+  returned by bounded_distance_skip_function: features that cannot
+  contribute to the distance (zero selection or weight) are removed,
+  the others are sorted by descending weight.
+*/
+struct descending_weight {
+  const double* weights;
+  descending_weight(const double* w) : weights(w) {}
+  bool operator()(long a, long b) const {
+    return weights[a] > weights[b];
+  }
+};
+
+inline void order_by_weight(std::vector<long>& indexes, const int* selections,
+                            const double* weights) {
+  size_t n = 0;
+  for (size_t i = 0; i < indexes.size(); ++i) {
+    if (selections[indexes[i]] != 0 && weights[indexes[i]] != 0.0)
+      indexes[n++] = indexes[i];
+  }
+  indexes.resize(n);
+  std::stable_sort(indexes.begin(), indexes.end(), descending_weight(weights));
+}
+
 /*
   Compute the distance between a known and an unknown image
   with weights. This version takes an image and a buffer
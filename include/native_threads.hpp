@@ -0,0 +1,150 @@
+/*
+ *
+ * Copyright (C) 2026 Gamera developers
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#ifndef gamera_native_threads_hpp
+#define gamera_native_threads_hpp
+
+#include <vector>
+#include <algorithm>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <process.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+namespace Gamera {
+
+  //---------------------------------------------------------------------
+  // Minimal native threads for the parallel loops that must not depend
+  // on whether Gamera has been compiled with OpenMP (the kNN
+  // leave-one-out, the GA population evaluation and deform_images).
+  // The workers never touch Python objects, so they run while the
+  // caller has released the GIL.
+  //---------------------------------------------------------------------
+
+  class NativeMutex {
+  public:
+#ifdef _WIN32
+    NativeMutex() { InitializeCriticalSection(&mutex); }
+    ~NativeMutex() { DeleteCriticalSection(&mutex); }
+    void lock() { EnterCriticalSection(&mutex); }
+    void unlock() { LeaveCriticalSection(&mutex); }
+#else
+    NativeMutex() { pthread_mutex_init(&mutex, NULL); }
+    ~NativeMutex() { pthread_mutex_destroy(&mutex); }
+    void lock() { pthread_mutex_lock(&mutex); }
+    void unlock() { pthread_mutex_unlock(&mutex); }
+#endif
+
+  private:
+#ifdef _WIN32
+    CRITICAL_SECTION mutex;
+#else
+    pthread_mutex_t mutex;
+#endif
+    NativeMutex(const NativeMutex&);
+    NativeMutex& operator=(const NativeMutex&);
+  };
+
+  class NativeLock {
+  public:
+    NativeLock(NativeMutex& m) : mutex(m) { mutex.lock(); }
+    ~NativeLock() { mutex.unlock(); }
+
+  private:
+    NativeMutex& mutex;
+  };
+
+  typedef void (*NativeWorkerFunction)(void* arg);
+
+  namespace NativeThreadsDetail {
+    struct Start {
+      NativeWorkerFunction worker;
+      void* arg;
+    };
+
+#ifdef _WIN32
+    inline unsigned __stdcall start_thread(void* start) {
+      ((Start*)start)->worker(((Start*)start)->arg);
+      return 0;
+    }
+#else
+    inline void* start_thread(void* start) {
+      ((Start*)start)->worker(((Start*)start)->arg);
+      return NULL;
+    }
+#endif
+  }
+
+  // Runs worker(arg) on num_threads threads (the calling thread being
+  // one of them) and returns when all of them are finished. Threads
+  // that cannot be created are simply missing, so the workers must
+  // share their work instead of relying on a fixed number of threads.
+  inline void run_native_threads(unsigned int num_threads,
+                                 NativeWorkerFunction worker, void* arg) {
+    NativeThreadsDetail::Start start;
+    start.worker = worker;
+    start.arg = arg;
+#ifdef _WIN32
+    std::vector<HANDLE> threads;
+    for (unsigned int i = 1; i < num_threads; ++i) {
+      HANDLE thread = (HANDLE)_beginthreadex(NULL, 0, NativeThreadsDetail::start_thread,
+                                             &start, 0, NULL);
+      if (thread != 0)
+        threads.push_back(thread);
+    }
+    worker(arg);
+    for (size_t i = 0; i < threads.size(); ++i) {
+      WaitForSingleObject(threads[i], INFINITE);
+      CloseHandle(threads[i]);
+    }
+#else
+    std::vector<pthread_t> threads;
+    for (unsigned int i = 1; i < num_threads; ++i) {
+      pthread_t thread;
+      if (pthread_create(&thread, NULL, NativeThreadsDetail::start_thread, &start) == 0)
+        threads.push_back(thread);
+    }
+    worker(arg);
+    for (size_t i = 0; i < threads.size(); ++i)
+      pthread_join(threads[i], NULL);
+#endif
+  }
+
+  // the number of processors available to this process
+  inline unsigned int native_processor_count() {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return std::max((unsigned int)info.dwNumberOfProcessors, 1u);
+#else
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (unsigned int)count : 1;
+#endif
+  }
+
+}
+
+#endif
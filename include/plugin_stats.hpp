@@ -0,0 +1,308 @@
+/*
+ *
+ * Copyright (C) 2026 Gamera developers
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#ifndef gamera_plugin_stats_hpp
+#define gamera_plugin_stats_hpp
+
+#include "gameramodule.hpp"
+#include "pythread.h"
+#include <ctime>
+#include <list>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/time.h>
+#include <time.h>
+#endif
+
+namespace Gamera {
+
+  //---------------------------------------------------------------------
+  // Execution statistics of the generated plugin wrappers.
+  //
+  // The switch is an int in gameracore (0 = off, PLUGIN_STATS_ON or
+  // PLUGIN_STATS_TRACE), which the plugin modules find through the
+  // CObject gameracore._plugin_stats_flag. Each wrapper checks the flag
+  // once per call and skips the timing when the statistics are
+  // disabled. Each plugin module keeps its own
+  // PluginStats, which gamera.plugin.stats() collects with the module
+  // function _plugin_stats. All recording happens with the GIL held.
+  //---------------------------------------------------------------------
+
+  enum { PLUGIN_STATS_ON = 1, PLUGIN_STATS_TRACE = 2 };
+
+  inline int plugin_stats_flag() {
+    static int* flag = 0;
+    if (flag == 0) {
+      static int off = 0;
+      flag = &off;
+      PyObject* dict = get_gameracore_dict();
+      if (dict != 0) {
+        PyObject* cobject = PyDict_GetItemString(dict, "_plugin_stats_flag");
+        if (cobject != 0 && PyCObject_Check(cobject))
+          flag = (int*)PyCObject_AsVoidPtr(cobject);
+      }
+      PyErr_Clear();
+    }
+    return *flag;
+  }
+
+  // wall clock time in seconds since the epoch
+  inline double plugin_stats_wall_time() {
+#ifdef _WIN32
+    FILETIME t;
+    GetSystemTimeAsFileTime(&t);
+    ULARGE_INTEGER ticks;
+    ticks.LowPart = t.dwLowDateTime;
+    ticks.HighPart = t.dwHighDateTime;
+    return (ticks.QuadPart - 116444736000000000ULL) * 1e-7;
+#else
+    struct timeval t;
+    gettimeofday(&t, NULL);
+    return t.tv_sec + t.tv_usec * 1e-6;
+#endif
+  }
+
+  // CPU time in seconds of the calling thread, or of the whole process
+  // (all threads) with process_time; a single call runs on one thread,
+  // while other threads may run plugins at the same time, but a batch
+  // call spreads its images over several threads
+  inline double plugin_stats_cpu_time(bool process_time) {
+#ifdef _WIN32
+    FILETIME creation, exit, kernel, user;
+    BOOL ok;
+    if (process_time)
+      ok = GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user);
+    else
+      ok = GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user);
+    if (!ok)
+      return 0.0;
+    ULARGE_INTEGER k, u;
+    k.LowPart = kernel.dwLowDateTime;
+    k.HighPart = kernel.dwHighDateTime;
+    u.LowPart = user.dwLowDateTime;
+    u.HighPart = user.dwHighDateTime;
+    return (k.QuadPart + u.QuadPart) * 1e-7;
+#else
+#ifdef CLOCK_THREAD_CPUTIME_ID
+    if (!process_time) {
+      struct timespec t;
+      if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t) == 0)
+        return t.tv_sec + t.tv_nsec * 1e-9;
+    }
+#endif
+    return double(std::clock()) / CLOCKS_PER_SEC;
+#endif
+  }
+
+  // bytes of the image data in a result that is not shared with an
+  // argument of the call (so that views and connected components on the
+  // arguments do not count)
+  inline size_t plugin_stats_bytes(Image* result,
+                                   const std::vector<ImageDataBase*>& inputs) {
+    if (result == NULL)
+      return 0;
+    for (size_t i = 0; i < inputs.size(); ++i)
+      if (inputs[i] == result->data())
+        return 0;
+    return result->data()->bytes();
+  }
+
+  inline size_t plugin_stats_bytes(std::list<Image*>* result,
+                                   const std::vector<ImageDataBase*>& inputs) {
+    if (result == NULL)
+      return 0;
+    std::set<ImageDataBase*> seen(inputs.begin(), inputs.end());
+    size_t bytes = 0;
+    for (std::list<Image*>::iterator i = result->begin(); i != result->end(); ++i) {
+      if (seen.insert((*i)->data()).second)
+        bytes += (*i)->data()->bytes();
+    }
+    return bytes;
+  }
+
+  template<class T>
+  inline size_t plugin_stats_bytes(std::vector<T>* result,
+                                   const std::vector<ImageDataBase*>&) {
+    if (result == NULL)
+      return 0;
+    return result->size() * sizeof(T);
+  }
+
+  template<class T>
+  inline size_t plugin_stats_bytes(const T&, const std::vector<ImageDataBase*>&) {
+    return 0;
+  }
+
+  struct PluginStatsEntry {
+    unsigned long long calls;
+    double wall_time;
+    double cpu_time;
+    unsigned long long pixels;
+    unsigned long long bytes;
+
+    PluginStatsEntry() : calls(0), wall_time(0.0), cpu_time(0.0),
+                         pixels(0), bytes(0) {}
+  };
+
+  struct PluginStatsEvent {
+    const char* name;
+    int pixel_type;
+    double start;
+    double duration;
+    long thread;
+  };
+
+  // the statistics of the wrappers in one plugin module
+  class PluginStats {
+  public:
+    // the trace is limited, so that a forgotten trace can not use up
+    // all memory
+    enum { max_events = 1000000 };
+
+    void record(const char* name, int pixel_type, double start, double wall_time,
+                double cpu_time, unsigned long long pixels, unsigned long long bytes) {
+      PluginStatsEntry& entry = entries[key_type(name, pixel_type)];
+      entry.calls++;
+      entry.wall_time += wall_time;
+      entry.cpu_time += cpu_time;
+      entry.pixels += pixels;
+      entry.bytes += bytes;
+      if ((plugin_stats_flag() & PLUGIN_STATS_TRACE) && events.size() < max_events) {
+        PluginStatsEvent event;
+        event.name = name;
+        event.pixel_type = pixel_type;
+        event.start = start;
+        event.duration = wall_time;
+        event.thread = PyThread_get_thread_ident();
+        events.push_back(event);
+      }
+    }
+
+    void clear() {
+      entries.clear();
+      events.clear();
+    }
+
+    // [(name, pixel_type, calls, wall_time, cpu_time, pixels, bytes), ...]
+    PyObject* entries_to_python() const {
+      PyObject* result = PyList_New(0);
+      if (result == 0)
+        return 0;
+      for (map_type::const_iterator i = entries.begin(); i != entries.end(); ++i) {
+        const PluginStatsEntry& e = i->second;
+        PyObject* item = Py_BuildValue(CHAR_PTR_CAST "(sinddKK)",
+                                       i->first.first.c_str(), i->first.second,
+                                       e.calls, e.wall_time, e.cpu_time,
+                                       e.pixels, e.bytes);
+        if (item == 0 || PyList_Append(result, item) < 0) {
+          Py_XDECREF(item);
+          Py_DECREF(result);
+          return 0;
+        }
+        Py_DECREF(item);
+      }
+      return result;
+    }
+
+    // [(name, pixel_type, start, duration, thread), ...]
+    PyObject* events_to_python() const {
+      PyObject* result = PyList_New(events.size());
+      if (result == 0)
+        return 0;
+      for (size_t i = 0; i < events.size(); ++i) {
+        const PluginStatsEvent& e = events[i];
+        PyObject* item = Py_BuildValue(CHAR_PTR_CAST "(siddl)", e.name, e.pixel_type,
+                                       e.start, e.duration, e.thread);
+        if (item == 0) {
+          Py_DECREF(result);
+          return 0;
+        }
+        PyList_SET_ITEM(result, i, item);
+      }
+      return result;
+    }
+
+  private:
+    typedef std::pair<std::string, int> key_type;
+    typedef std::map<key_type, PluginStatsEntry> map_type;
+    map_type entries;
+    std::vector<PluginStatsEvent> events;
+  };
+
+  // Measures one call of a wrapper. The images are added before the
+  // call, start and stop may be called without the GIL. The CPU time is
+  // that of the calling thread, or of the process with process_time
+  // (for the batch wrappers, whose images may run on OpenMP threads).
+  class PluginStatsCall {
+  public:
+    PluginStatsCall(bool process_time = false)
+      : active(plugin_stats_flag() != 0), process_time(process_time),
+        pixels(0), bytes(0), start_time(0.0), wall_time(0.0), cpu_time(0.0) {}
+
+    void add_image(Image* image) {
+      if (active) {
+        pixels += (unsigned long long)image->nrows() * image->ncols();
+        inputs.push_back(image->data());
+      }
+    }
+
+    void start() {
+      if (active) {
+        start_time = plugin_stats_wall_time();
+        cpu_time = plugin_stats_cpu_time(process_time);
+      }
+    }
+
+    void stop() {
+      if (active) {
+        wall_time = plugin_stats_wall_time() - start_time;
+        cpu_time = plugin_stats_cpu_time(process_time) - cpu_time;
+      }
+    }
+
+    template<class T>
+    void add_result(const T& result) {
+      if (active)
+        bytes += plugin_stats_bytes(result, inputs);
+    }
+
+    void record(PluginStats& stats, const char* name, int pixel_type) {
+      if (active)
+        stats.record(name, pixel_type, start_time, wall_time, cpu_time, pixels, bytes);
+    }
+
+  private:
+    bool active, process_time;
+    unsigned long long pixels, bytes;
+    double start_time, wall_time, cpu_time;
+    std::vector<ImageDataBase*> inputs;
+  };
+
+}
+
+#endif
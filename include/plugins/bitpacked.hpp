@@ -0,0 +1,314 @@
+/*
+ *
+ * Copyright (C) 2026 Gamera developers
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#ifndef gamera_bitpacked_hpp
+#define gamera_bitpacked_hpp
+
+#include "gamera.hpp"
+#include <vector>
+
+namespace Gamera {
+
+  //---------------------------------------------------------------------
+  // Bit packed copies of onebit images.
+  //
+  // Gamera stores every onebit pixel in an unsigned short, which makes
+  // bulk logical operations on whole images memory bound. Algorithms
+  // that only need the black/white information can copy an image into
+  // a BitPackedImage, where each row consists of words_per_row 64 bit
+  // words and bit i of word k holds the pixel in column 64*k+i. Each
+  // row is followed by one additional zero word, so that get_word may
+  // read 64 bits starting at any column without bounds checks.
+  //---------------------------------------------------------------------
+
+  typedef unsigned long long bitword_t;
+
+  inline size_t popcount(bitword_t w) {
+#if defined(__GNUC__)
+    return __builtin_popcountll(w);
+#else
+    w = w - ((w >> 1) & 0x5555555555555555ULL);
+    w = (w & 0x3333333333333333ULL) + ((w >> 2) & 0x3333333333333333ULL);
+    w = (w + (w >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+    return (size_t)((w * 0x0101010101010101ULL) >> 56);
+#endif
+  }
+
+  class BitPackedImage {
+  public:
+    size_t nrows;
+    size_t ncols;
+    size_t words_per_row;
+    size_t stride;
+    std::vector<bitword_t> bits;
+
+    BitPackedImage(size_t rows, size_t cols) {
+      init(rows, cols);
+    }
+
+    // packs the black pixels of an arbitrary image (is_black is used,
+    // so that greyscale images are packed as "value == 0")
+    template<class T>
+    BitPackedImage(const T& image) {
+      init(image.nrows(), image.ncols());
+      typename T::const_row_iterator row = image.row_begin();
+      for (size_t y = 0; row != image.row_end(); ++row, ++y) {
+        bitword_t* dest = this->row(y);
+        typename T::const_col_iterator col = row.begin();
+        for (size_t x = 0; col != row.end(); ++col, ++x) {
+          if (is_black(*col))
+            dest[x >> 6] |= ((bitword_t)1) << (x & 63);
+        }
+      }
+    }
+
+    bitword_t* row(size_t y) {
+      return &bits[y * stride];
+    }
+    const bitword_t* row(size_t y) const {
+      return &bits[y * stride];
+    }
+
+    // the 64 pixels starting at column x in row y
+    bitword_t get_word(size_t y, size_t x) const {
+      const bitword_t* r = row(y) + (x >> 6);
+      size_t shift = x & 63;
+      if (shift == 0)
+        return r[0];
+      return (r[0] >> shift) | (r[1] << (64 - shift));
+    }
+
+    bool get(size_t y, size_t x) const {
+      return (row(y)[x >> 6] >> (x & 63)) & 1;
+    }
+
+    // the 64 pixels starting at column x in row y, where x and y may lie
+    // outside the image; pixels outside the image are white
+    bitword_t shifted_word(long y, long x) const {
+      if (y < 0 || y >= (long)nrows)
+        return 0;
+      long k = (x >= 0) ? (x >> 6) : -((63 - x) >> 6);
+      size_t shift = (size_t)(x - 64 * k);
+      const bitword_t* r = row(y);
+      bitword_t lo = (k >= 0 && k < (long)words_per_row) ? r[k] : 0;
+      if (shift == 0)
+        return lo;
+      bitword_t hi = (k + 1 >= 0 && k + 1 < (long)words_per_row) ? r[k + 1] : 0;
+      return (lo >> shift) | (hi << (64 - shift));
+    }
+
+    // clears the bits beyond the last column, which must be done after
+    // operations that shift pixels to the right
+    void clear_padding() {
+      bitword_t mask = last_word_mask();
+      for (size_t y = 0; y < nrows; ++y)
+        row(y)[words_per_row - 1] &= mask;
+    }
+
+    // mask of the valid bits in the last word of each row
+    bitword_t last_word_mask() const {
+      size_t rest = ncols & 63;
+      return rest ? ((((bitword_t)1) << rest) - 1) : ~((bitword_t)0);
+    }
+
+    // writes the pixels that differ from orig into a onebit image that
+    // holds the pixels of orig, so that unchanged pixels keep their values
+    template<class T>
+    void unpack_changes(const BitPackedImage& orig, T& image) const {
+      for (size_t y = 0; y < nrows; ++y) {
+        const bitword_t* a = orig.row(y);
+        const bitword_t* b = row(y);
+        for (size_t k = 0; k < words_per_row; ++k) {
+          bitword_t diff = a[k] ^ b[k];
+          for (size_t i = 0; diff != 0; ++i, diff >>= 1) {
+            if (diff & 1) {
+              size_t x = 64 * k + i;
+              if ((b[k] >> i) & 1)
+                image.set(Point(x, y), black(image));
+              else
+                image.set(Point(x, y), white(image));
+            }
+          }
+        }
+      }
+    }
+
+    // writes the packed pixels back into a onebit image of the same size
+    template<class T>
+    void unpack(T& image) const {
+      typename T::row_iterator r = image.row_begin();
+      for (size_t y = 0; r != image.row_end(); ++r, ++y) {
+        const bitword_t* src = row(y);
+        typename T::col_iterator col = r.begin();
+        for (size_t x = 0; col != r.end(); ++col, ++x) {
+          if ((src[x >> 6] >> (x & 63)) & 1)
+            *col = black(image);
+          else
+            *col = white(image);
+        }
+      }
+    }
+
+  private:
+    void init(size_t rows, size_t cols) {
+      nrows = rows;
+      ncols = cols;
+      words_per_row = (cols + 63) / 64;
+      stride = words_per_row + 1;
+      bits.assign(nrows * stride, 0);
+    }
+  };
+
+
+  //---------------------------------------------------------------------
+  // Word parallel neighborhood operations on bit packed images.
+  //
+  // Neighborhood filters on onebit images can be evaluated for 64 pixels
+  // at once by combining the words of the neighbors, which are obtained
+  // with shifted_word. Pixels outside the image are white.
+  //---------------------------------------------------------------------
+
+  // Bit sliced counters: for each of 64 pixels, counts how many of the
+  // added words have the pixel set. plane[i] holds bit i of the counts.
+  class BitCounter {
+  public:
+    enum { max_planes = 16 };
+    bitword_t plane[max_planes];
+    size_t nplanes;
+
+    BitCounter() : nplanes(0) {}
+
+    void add(bitword_t w) {
+      for (size_t i = 0; w != 0 && i < max_planes; ++i) {
+        if (i == nplanes) {
+          plane[nplanes++] = w;
+          return;
+        }
+        bitword_t carry = plane[i] & w;
+        plane[i] ^= w;
+        w = carry;
+      }
+    }
+
+    // pixels whose count equals value
+    bitword_t equal(size_t value) const {
+      bitword_t result = ~((bitword_t)0);
+      for (size_t i = 0; i < max_planes; ++i) {
+        bitword_t p = (i < nplanes) ? plane[i] : 0;
+        result &= ((value >> i) & 1) ? p : ~p;
+      }
+      return result;
+    }
+
+    // pixels whose count is greater than value
+    bitword_t greater(size_t value) const {
+      bitword_t gt = 0, eq = ~((bitword_t)0);
+      for (size_t i = max_planes; i-- > 0; ) {
+        bitword_t p = (i < nplanes) ? plane[i] : 0;
+        if ((value >> i) & 1) {
+          eq &= p;
+        } else {
+          gt |= eq & p;
+          eq &= ~p;
+        }
+      }
+      return gt;
+    }
+
+    bitword_t less(size_t value) const {
+      return ~(greater(value) | equal(value));
+    }
+  };
+
+  // 3x3 dilation (black if any pixel in the window is black) or erosion
+  // (black if all pixels in the window are black)
+  inline BitPackedImage bitpacked_erode_dilate(const BitPackedImage& src, bool dilate) {
+    BitPackedImage horizontal(src.nrows, src.ncols);
+    for (size_t y = 0; y < src.nrows; ++y) {
+      bitword_t* h = horizontal.row(y);
+      for (size_t k = 0; k < src.words_per_row; ++k) {
+        long x = 64 * k;
+        bitword_t l = src.shifted_word(y, x - 1), c = src.row(y)[k],
+          r = src.shifted_word(y, x + 1);
+        h[k] = dilate ? (l | c | r) : (l & c & r);
+      }
+    }
+    horizontal.clear_padding();
+    BitPackedImage dest(src.nrows, src.ncols);
+    for (size_t y = 0; y < src.nrows; ++y) {
+      bitword_t* d = dest.row(y);
+      const bitword_t* c = horizontal.row(y);
+      for (size_t k = 0; k < src.words_per_row; ++k) {
+        bitword_t u = (y > 0) ? horizontal.row(y - 1)[k] : 0;
+        bitword_t b = (y + 1 < src.nrows) ? horizontal.row(y + 1)[k] : 0;
+        d[k] = dilate ? (u | c[k] | b) : (u & c[k] & b);
+      }
+    }
+    return dest;
+  }
+
+  // black pixels without black pixels in their 8-neighborhood
+  inline BitPackedImage bitpacked_isolated_pixels(const BitPackedImage& src) {
+    BitPackedImage dest(src.nrows, src.ncols);
+    for (size_t y = 0; y < src.nrows; ++y) {
+      bitword_t* d = dest.row(y);
+      for (size_t k = 0; k < src.words_per_row; ++k) {
+        long x = 64 * k;
+        bitword_t c = src.row(y)[k];
+        if (c == 0)
+          continue;
+        bitword_t neighbors = src.shifted_word(y, x - 1) | src.shifted_word(y, x + 1);
+        for (long dy = -1; dy <= 1; dy += 2)
+          neighbors |= src.shifted_word(y + dy, x - 1) | src.shifted_word(y + dy, x) |
+            src.shifted_word(y + dy, x + 1);
+        d[k] = c & ~neighbors;
+      }
+    }
+    return dest;
+  }
+
+  // dest(x,y) is black when src is black anywhere in the size x size box
+  // with lower right corner (x,y)
+  inline BitPackedImage bitpacked_spread(const BitPackedImage& src, size_t size) {
+    BitPackedImage horizontal(src.nrows, src.ncols);
+    for (size_t y = 0; y < src.nrows; ++y) {
+      bitword_t* h = horizontal.row(y);
+      for (size_t k = 0; k < src.words_per_row; ++k) {
+        bitword_t w = 0;
+        for (size_t i = 0; i < size; ++i)
+          w |= src.shifted_word(y, 64 * (long)k - (long)i);
+        h[k] = w;
+      }
+    }
+    horizontal.clear_padding();
+    BitPackedImage dest(src.nrows, src.ncols);
+    for (size_t y = 0; y < src.nrows; ++y) {
+      bitword_t* d = dest.row(y);
+      for (size_t i = 0; i < size && i <= y; ++i) {
+        const bitword_t* h = horizontal.row(y - i);
+        for (size_t k = 0; k < src.words_per_row; ++k)
+          d[k] |= h[k];
+      }
+    }
+    return dest;
+  }
+
+}
+
+#endif
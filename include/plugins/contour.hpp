@@ -23,97 +23,129 @@
 #define mgd10222004_contours
 
 #include "gamera.hpp"
+#include <set>
+#include <vector>
+#include <algorithm>
 
 namespace Gamera {
+
+  // The black runs of all rows of an image, which are computed in a
+  // single pass over the image (for a ConnectedComponent, only pixels
+  // with its label are black). All contours are computed from the runs.
+  class ContourRuns {
+  public:
+    typedef std::pair<int, int> Run; // black from first to second-1
+    typedef std::vector<Run> RunList;
+
+    int nrows, ncols;
+    std::vector<RunList> rows;
+
+    template<class T>
+    ContourRuns(const T& m) : nrows((int)m.nrows()), ncols((int)m.ncols()), rows(m.nrows()) {
+      typename T::const_row_iterator r = m.row_begin();
+      for (int y = 0; r != m.row_end(); ++r, ++y) {
+        int start = -1, x = 0;
+        typename T::const_col_iterator c = r.begin();
+        for (; c != r.end(); ++c, ++x) {
+          if (is_black(*c)) {
+            if (start < 0)
+              start = x;
+          } else if (start >= 0) {
+            rows[y].push_back(Run(start, x));
+            start = -1;
+          }
+        }
+        if (start >= 0)
+          rows[y].push_back(Run(start, x));
+      }
+    }
+
+    bool black_at(int x, int y) const {
+      const RunList& row = rows[y];
+      RunList::const_iterator r =
+        std::upper_bound(row.begin(), row.end(), Run(x, std::numeric_limits<int>::max()));
+      return r != row.begin() && (r - 1)->second > x;
+    }
+
+    // distances from the left and right border for each row
+    void left_right(FloatVector* left, FloatVector* right) const {
+      for (int y = 0; y < nrows; ++y) {
+        if (rows[y].empty()) {
+          (*left)[y] = (*right)[y] = std::numeric_limits<double>::infinity();
+        } else {
+          (*left)[y] = (double)rows[y].front().first;
+          (*right)[y] = (double)(ncols - rows[y].back().second + 1);
+        }
+      }
+    }
+
+    // distances from the top and bottom border for each column
+    void top_bottom(FloatVector* top, FloatVector* bottom) const {
+      for (int c = 0; c < ncols; ++c)
+        (*top)[c] = (*bottom)[c] = std::numeric_limits<double>::infinity();
+      // each column is set by the first run covering it; columns already
+      // set are skipped with the path compressed pointers in next
+      std::vector<int> next(ncols + 1);
+      for (int dir = 0; dir < 2; ++dir) {
+        FloatVector* output = dir ? bottom : top;
+        for (int c = 0; c <= ncols; ++c)
+          next[c] = c;
+        for (int i = 0; i < nrows; ++i) {
+          int y = dir ? nrows - 1 - i : i;
+          for (RunList::const_iterator r = rows[y].begin(); r != rows[y].end(); ++r) {
+            for (int c = find_unset(next, r->first); c < r->second;
+                 c = find_unset(next, c + 1)) {
+              (*output)[c] = dir ? (double)(nrows - y) : (double)y;
+              next[c] = c + 1;
+            }
+          }
+        }
+      }
+    }
+
+  private:
+    static int find_unset(std::vector<int>& next, int c) {
+      int root = c;
+      while (next[root] != root)
+        root = next[root];
+      while (next[c] != root) {
+        int n = next[c];
+        next[c] = root;
+        c = n;
+      }
+      return root;
+    }
+  };
+
   template<class T>
   FloatVector* contour_top(const T& m) {
     FloatVector* output = new FloatVector(m.ncols());
-    try {
-      for (size_t c = 0; c != m.ncols(); ++c) {
-        size_t r = 0;
-        for (; r != m.nrows(); ++r)
-          if (is_black(m.get(Point(c, r))))
-            break;
-        double result;
-        if (r >= m.nrows())
-          result = std::numeric_limits<double>::infinity();
-        else
-          result = (double)r;
-        (*output)[c] = result;
-      }
-    } catch (std::exception e) {
-      delete output;
-      throw;
-    }
+    FloatVector bottom(m.ncols());
+    ContourRuns(m).top_bottom(output, &bottom);
     return output;
   }
 
   template<class T>
   FloatVector* contour_bottom(const T& m) {
     FloatVector* output = new FloatVector(m.ncols());
-    try {
-      for (size_t c = 0; c != m.ncols(); ++c) {
-        long r = m.nrows() - 1;
-        for (; r >= 0; --r)
-          if (is_black(m.get(Point(c, r))))
-            break;
-        double result;
-        if (r < 0)
-          result = std::numeric_limits<double>::infinity();
-        else
-          result = (double)(m.nrows() - r);
-        (*output)[c] = result;
-      }
-    } catch (std::exception e) {
-      delete output;
-      throw;
-    }
+    FloatVector top(m.ncols());
+    ContourRuns(m).top_bottom(&top, output);
     return output;
   }
 
   template<class T>
   FloatVector* contour_left(const T& m) {
     FloatVector* output = new FloatVector(m.nrows());
-    try {
-      for (size_t r = 0; r != m.nrows(); ++r) {
-        size_t c = 0;
-        for (; c != m.ncols(); ++c)
-          if (is_black(m.get(Point(c, r))))
-            break;
-        double result;
-        if (c >= m.ncols())
-          result = std::numeric_limits<double>::infinity();
-        else
-          result = (double)c;
-        (*output)[r] = result;
-      }
-    } catch (std::exception e) {
-      delete output;
-      throw;
-    }
+    FloatVector right(m.nrows());
+    ContourRuns(m).left_right(output, &right);
     return output;
   }
 
   template<class T>
   FloatVector* contour_right(const T& m) {
     FloatVector* output = new FloatVector(m.nrows());
-    try {
-      for (size_t r = 0; r != m.nrows(); ++r) {
-        long c = m.ncols() - 1;
-        for (; c >= 0; --c)
-          if (is_black(m.get(Point(c, r))))
-            break;
-        double result;
-        if (c < 0)
-          result = std::numeric_limits<double>::infinity();
-        else
-          result = (double)(m.ncols() - c);
-        (*output)[r] = result;
-      }
-    } catch (std::exception e) {
-      delete output;
-      throw;
-    }
+    FloatVector left(m.nrows());
+    ContourRuns(m).left_right(&left, output);
     return output;
   }
 
@@ -124,11 +156,15 @@ namespace Gamera {
     PointVector *output = new PointVector();
     PointVector *contour_points = new PointVector();
     PointVector::iterator found;
+    std::set<std::pair<int, int> > point_set;
 
-    FloatVector *top = contour_top(cc);
-    FloatVector *right = contour_right(cc);
-    FloatVector *bottom = contour_bottom(cc);
-    FloatVector *left = contour_left(cc);
+    ContourRuns runs(cc);
+    FloatVector *top = new FloatVector(cc.ncols());
+    FloatVector *right = new FloatVector(cc.nrows());
+    FloatVector *bottom = new FloatVector(cc.ncols());
+    FloatVector *left = new FloatVector(cc.nrows());
+    runs.top_bottom(top, bottom);
+    runs.left_right(left, right);
     FloatVector::iterator it;
 
     int x, y, i;
@@ -163,8 +199,7 @@ namespace Gamera {
         top_max_x = x;
         top_max_y = y;	
       }
-      found = find(contour_points->begin(), contour_points->end(), Point(x,y));
-      if(found == contour_points->end()) {
+      if(point_set.insert(std::make_pair(x, y)).second) {
         contour_points->push_back( Point(x,y) );
       }
     }
@@ -181,8 +216,7 @@ namespace Gamera {
         right_max_x = x;
         right_max_y = y;
       }
-      found = find(contour_points->begin(), contour_points->end(), Point(x,y));
-      if(found == contour_points->end()) {
+      if(point_set.insert(std::make_pair(x, y)).second) {
         contour_points->push_back( Point(x,y) );
       }
     }
@@ -199,8 +233,7 @@ namespace Gamera {
         bottom_max_x = x;
         bottom_max_y = y;
       }
-      found = find(contour_points->begin(), contour_points->end(), Point(x,y));
-      if(found == contour_points->end()) {
+      if(point_set.insert(std::make_pair(x, y)).second) {
         contour_points->push_back( Point(x,y) );
       }
     }
@@ -217,8 +250,7 @@ namespace Gamera {
         left_max_x = x;
         left_max_y = y;
       }
-      found = find(contour_points->begin(), contour_points->end(), Point(x,y));
-      if(found == contour_points->end()) {
+      if(point_set.insert(std::make_pair(x, y)).second) {
         contour_points->push_back( Point(x,y) );
       }
     }
@@ -299,16 +331,16 @@ namespace Gamera {
     mask[6][0] = 0;  mask[6][1] = 1;
     mask[7][0] = 1;  mask[7][1] = 1;
 
+    ContourRuns runs(m);
+
     // find startpixel
     unsigned int x = 0;
     unsigned int y = 0;
-    while(m.get(Point(x, y)) == 0 && x < m.ncols() && y < m.nrows()){
-      if (x == m.ncols() - 1){
-        y++;
-        x = 0;
-      } 
-      x++;
-    }
+    while (y < m.nrows() && runs.rows[y].empty())
+      y++;
+    if (y == m.nrows())
+      return v_contour; // no black pixel
+    x = runs.rows[y].front().first;
     v_contour->push_back( Point(x, y) );
   
     // extract contour
@@ -337,11 +369,11 @@ namespace Gamera {
       while(found == false && third < 3){
         third++;
 
-        newX_R = (*v_contour)[n].x() + mask[ (s-1)%8 ][0];
-        newY_R = (*v_contour)[n].y() + mask[ (s-1)%8 ][1];
+        newX_R = (*v_contour)[n].x() + mask[ (s+7)%8 ][0];
+        newY_R = (*v_contour)[n].y() + mask[ (s+7)%8 ][1];
       
-        newX_M = (*v_contour)[n].x() + mask[ (s)%8 ][0];
-        newY_M = (*v_contour)[n].y() + mask[ (s)%8 ][1];
+        newX_M = (*v_contour)[n].x() + mask[ s ][0];
+        newY_M = (*v_contour)[n].y() + mask[ s ][1];
       
         newX_L = (*v_contour)[n].x() + mask[ (s+1)%8 ][0];
         newY_L = (*v_contour)[n].y() + mask[ (s+1)%8 ][1];
@@ -364,34 +396,34 @@ namespace Gamera {
       
         if(border == false){
           border = true;
-          if ( is_black(m.get( p_Right)) && newX_R < m.ncols() && newY_R < m.nrows() )
+          if ( newX_R < m.ncols() && newY_R < m.nrows() && runs.black_at(newX_R, newY_R) )
             {
               v_contour->push_back(p_Right);
               found = true;
               n++;	
-              s = s - 2;
+              s = (s + 6) % 8;
             }
           else{
-            if(is_black(m.get(p_Middle)) && newX_M < m.ncols() && newY_M < m.nrows()){
+            if(newX_M < m.ncols() && newY_M < m.nrows() && runs.black_at(newX_M, newY_M)){
               v_contour->push_back(p_Middle);
               found = true;
               n++;
             }
             else {
-              if(is_black(m.get(p_Left) ) && newX_L < m.ncols() && newY_L < m.nrows() ){
+              if(newX_L < m.ncols() && newY_L < m.nrows() && runs.black_at(newX_L, newY_L)){
                 v_contour->push_back(p_Left);
                 found = true;
                 n++;
               }
               else {
-                s = s + 2;
+                s = (s + 2) % 8;
               }
             }
           }
           first = false;
         }
         else {
-          s = s + 2;
+          s = (s + 2) % 8;
         }
       
       }
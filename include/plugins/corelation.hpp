@@ -22,6 +22,12 @@
 #define mgd06292004_corelation
 
 #include "gamera.hpp"
+#include "gameramodule.hpp"
+#include "bitpacked.hpp"
+#include <vector>
+#include <algorithm>
+#include <complex>
+#include <math.h>
 
 namespace Gamera {
 
@@ -79,7 +85,7 @@ namespace Gamera {
     progress_bar.set_length(lr_y - ul_y);
     for (size_t y = ul_y, ya = ul_y-a.ul_y(), yb = ul_y-p.y(); y < lr_y; ++y, ++ya, ++yb) {
       for (size_t x = ul_x, xa = ul_x-a.ul_x(), xb = ul_x-p.x(); x < lr_x; ++x, ++xa, ++xb) {
-	typename T::value_type px_a = a.get(Point(xb, yb));
+	typename T::value_type px_a = a.get(Point(xa, ya));
 	typename U::value_type px_b = b.get(Point(xb, yb));
 	if (is_black(px_b))
 	  area++;
@@ -98,7 +104,7 @@ namespace Gamera {
 
   inline double corelation_square_absolute_distance(GreyScalePixel a, OneBitPixel b) {
     double result = 0;
-    if (is_black(a))
+    if (is_black(b))
       result = a;
     else
       result = (double)(NumericTraits<GreyScalePixel>::max() - a);
@@ -117,7 +123,7 @@ namespace Gamera {
     progress_bar.set_length(lr_y - ul_y);
     for (size_t y = ul_y, ya = ul_y-a.ul_y(), yb = ul_y-p.y(); y < lr_y; ++y, ++ya, ++yb) {
       for (size_t x = ul_x, xa = ul_x-a.ul_x(), xb = ul_x-p.x(); x < lr_x; ++x, ++xa, ++xb) {
-	typename T::value_type px_a = a.get(Point(xb, yb));
+	typename T::value_type px_a = a.get(Point(xa, ya));
 	typename U::value_type px_b = b.get(Point(xb, yb));
 	if (is_black(px_b))
 	  area++;
@@ -128,6 +134,367 @@ namespace Gamera {
     return result / area;
   }
 
+  //---------------------------------------------------------------------
+  // Corelation over the whole image
+  //
+  // The *_map functions compute the corelation for all offsets at which
+  // the template fits completely into the image. They return a FloatImage
+  // with the same origin as the image, in which the pixel at (x,y) holds
+  // the value the corresponding per offset function returns for the
+  // offset (x,y). Onebit images are compared with bit packed rows and
+  // popcounts, greyscale images with an FFT based cross corelation.
+  //---------------------------------------------------------------------
+
+  namespace CorelationDetail {
+
+    struct BlackValue {
+      template<class V>
+      double operator()(V v) const { return is_black(v) ? 1.0 : 0.0; }
+    };
+    struct PixelValue {
+      template<class V>
+      double operator()(V v) const { return (double)v; }
+    };
+    struct SquaredPixelValue {
+      template<class V>
+      double operator()(V v) const { return (double)v * (double)v; }
+    };
+
+    // summed area table of f(pixel) with an additional leading zero
+    // row and column
+    class SummedAreaTable {
+    public:
+      size_t ncols;
+      std::vector<double> sums;
+
+      template<class T, class F>
+      SummedAreaTable(const T& image, F f) {
+        ncols = image.ncols() + 1;
+        sums.assign((image.nrows() + 1) * ncols, 0.0);
+        typename T::const_row_iterator row = image.row_begin();
+        for (size_t y = 1; row != image.row_end(); ++row, ++y) {
+          double rowsum = 0.0;
+          typename T::const_col_iterator col = row.begin();
+          for (size_t x = 1; col != row.end(); ++col, ++x) {
+            rowsum += f(*col);
+            sums[y*ncols + x] = sums[(y-1)*ncols + x] + rowsum;
+          }
+        }
+      }
+
+      // sum over the w x h rectangle with upper left corner (x,y)
+      double sum(size_t x, size_t y, size_t w, size_t h) const {
+        return sums[(y+h)*ncols + x+w] - sums[y*ncols + x+w]
+          - sums[(y+h)*ncols + x] + sums[y*ncols + x];
+      }
+    };
+
+    // number of pixels that are black both in the template t and in
+    // the image a when t is placed at (x,y)
+    inline double and_count(const BitPackedImage& a, const BitPackedImage& t,
+                            size_t x, size_t y) {
+      size_t count = 0;
+      for (size_t r = 0; r < t.nrows; ++r) {
+        const bitword_t* trow = t.row(r);
+        for (size_t k = 0; k < t.words_per_row; ++k)
+          count += popcount(a.get_word(y + r, x + 64*k) & trow[k]);
+      }
+      return (double)count;
+    }
+
+    template<class T, class U>
+    FloatImageView* create_corelation_map(const T& a, const U& b) {
+      if (b.ncols() > a.ncols() || b.nrows() > a.nrows())
+        throw std::range_error("The template must not be larger than the image.");
+      FloatImageData* data = new FloatImageData
+        (Dim(a.ncols() - b.ncols() + 1, a.nrows() - b.nrows() + 1), a.origin());
+      return new FloatImageView(*data);
+    }
+
+    inline double template_black_count(const BitPackedImage& t) {
+      double count = 0;
+      for (size_t i = 0; i < t.bits.size(); ++i)
+        count += (double)popcount(t.bits[i]);
+      if (count == 0)
+        throw std::runtime_error("The template must contain black pixels.");
+      return count;
+    }
+
+    typedef std::complex<double> complex_t;
+
+    // in place radix 2 FFT; n must be a power of two
+    inline void fft(complex_t* d, size_t n, bool inverse) {
+      size_t i, j, len;
+      for (i = 1, j = 0; i < n; ++i) {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1)
+          j ^= bit;
+        j ^= bit;
+        if (i < j)
+          std::swap(d[i], d[j]);
+      }
+      for (len = 2; len <= n; len <<= 1) {
+        double angle = 2 * 3.14159265358979323846 / len * (inverse ? 1 : -1);
+        complex_t wlen(cos(angle), sin(angle));
+        for (i = 0; i < n; i += len) {
+          complex_t w(1.0, 0.0);
+          for (j = 0; j < len / 2; ++j) {
+            complex_t u = d[i+j];
+            complex_t v = d[i+j+len/2] * w;
+            d[i+j] = u + v;
+            d[i+j+len/2] = u - v;
+            w *= wlen;
+          }
+        }
+      }
+    }
+
+    // in place 2D FFT of an n x n matrix stored row by row
+    inline void fft2d(std::vector<complex_t>& d, size_t n, bool inverse) {
+      size_t x, y;
+      for (y = 0; y < n; ++y)
+        fft(&d[y*n], n, inverse);
+      std::vector<complex_t> column(n);
+      for (x = 0; x < n; ++x) {
+        for (y = 0; y < n; ++y)
+          column[y] = d[y*n + x];
+        fft(&column[0], n, inverse);
+        for (y = 0; y < n; ++y)
+          d[y*n + x] = column[y];
+      }
+    }
+
+    // For every offset (x,y) of the map, computes the sum of the image
+    // pixels under the black template pixels. The corelation is done
+    // with the overlap-save method on square tiles of a power of two size,
+    // so that memory stays bounded for large images; the tiles are
+    // processed in parallel when OpenMP is available.
+    template<class T>
+    void template_sums_fft(const T& a, const BitPackedImage& t,
+                           size_t map_cols, size_t map_rows,
+                           std::vector<double>& result) {
+      size_t n = 64;
+      while (n < 2 * std::max(t.ncols, t.nrows))
+        n <<= 1;
+      size_t image_n = 1;
+      while (image_n < std::max(a.ncols(), a.nrows()))
+        image_n <<= 1;
+      n = std::min(n, image_n);
+
+      std::vector<complex_t> ft(n * n, complex_t(0.0, 0.0));
+      for (size_t v = 0; v < t.nrows; ++v)
+        for (size_t u = 0; u < t.ncols; ++u)
+          if (t.get(v, u))
+            ft[v*n + u] = 1.0;
+      fft2d(ft, n, false);
+
+      size_t step_x = n - t.ncols + 1;
+      size_t step_y = n - t.nrows + 1;
+      size_t tiles_x = (map_cols + step_x - 1) / step_x;
+      size_t tiles_y = (map_rows + step_y - 1) / step_y;
+      result.assign(map_cols * map_rows, 0.0);
+      double norm = 1.0 / (double)(n * n);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+      for (int tile = 0; tile < (int)(tiles_x * tiles_y); ++tile) {
+        size_t x0 = (tile % tiles_x) * step_x;
+        size_t y0 = (tile / tiles_x) * step_y;
+        std::vector<complex_t> buf(n * n, complex_t(0.0, 0.0));
+        size_t u, v;
+        for (v = 0; v < n && y0 + v < a.nrows(); ++v)
+          for (u = 0; u < n && x0 + u < a.ncols(); ++u)
+            buf[v*n + u] = (double)a.get(Point(x0 + u, y0 + v));
+        fft2d(buf, n, false);
+        for (u = 0; u < n * n; ++u)
+          buf[u] *= std::conj(ft[u]);
+        fft2d(buf, n, true);
+        for (v = 0; v < step_y && y0 + v < map_rows; ++v)
+          for (u = 0; u < step_x && x0 + u < map_cols; ++u)
+            result[(y0 + v) * map_cols + x0 + u] = floor(buf[v*n + u].real() * norm + 0.5);
+      }
+    }
+
+    template<class T, class U>
+    FloatImageView* sum_map(const T& a, const U& b, OneBitPixel, bool squares) {
+      FloatImageView* result = create_corelation_map(a, b);
+      BitPackedImage pa(a), pb(b);
+      double template_black = template_black_count(pb);
+      SummedAreaTable image_black(a, BlackValue());
+      size_t ncols = result->ncols(), nrows = result->nrows();
+
+      // for onebit images, the sum of squares is the same as the
+      // sum of absolute distances: the number of differing pixels
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+      for (int y = 0; y < (int)nrows; ++y) {
+        for (size_t x = 0; x < ncols; ++x) {
+          double both = and_count(pa, pb, x, y);
+          double image = image_black.sum(x, y, b.ncols(), b.nrows());
+          result->set(Point(x, y), (template_black + image - 2 * both) / template_black);
+        }
+      }
+      return result;
+    }
+
+    template<class T, class U>
+    FloatImageView* sum_map(const T& a, const U& b, GreyScalePixel, bool squares) {
+      FloatImageView* result = create_corelation_map(a, b);
+      BitPackedImage pb(b);
+      double template_black = template_black_count(pb);
+      double template_white = b.nrows() * b.ncols() - template_black;
+      double maxval = NumericTraits<GreyScalePixel>::max();
+      size_t ncols = result->ncols(), nrows = result->nrows();
+      std::vector<double> under_black;
+      template_sums_fft(a, pb, ncols, nrows, under_black);
+      SummedAreaTable values(a, PixelValue());
+
+      if (squares) {
+        // sum(a^2 | black) + sum((max-a)^2 | white)
+        //   = sum(a^2) + max^2*white - 2*max*(sum(a) - sum(a | black))
+        SummedAreaTable squared_values(a, SquaredPixelValue());
+        for (size_t y = 0; y < nrows; ++y) {
+          for (size_t x = 0; x < ncols; ++x) {
+            double all = values.sum(x, y, b.ncols(), b.nrows());
+            double all2 = squared_values.sum(x, y, b.ncols(), b.nrows());
+            double black = under_black[y*ncols + x];
+            result->set(Point(x, y), (all2 + maxval * maxval * template_white
+                                      - 2 * maxval * (all - black)) / template_black);
+          }
+        }
+      } else {
+        // sum(a | black) + sum(max-a | white)
+        //   = 2*sum(a | black) + max*white - sum(a)
+        for (size_t y = 0; y < nrows; ++y) {
+          for (size_t x = 0; x < ncols; ++x) {
+            double all = values.sum(x, y, b.ncols(), b.nrows());
+            double black = under_black[y*ncols + x];
+            result->set(Point(x, y), (2 * black + maxval * template_white - all) / template_black);
+          }
+        }
+      }
+      return result;
+    }
+
+    // orders map positions by their value, the best value first
+    class BestValueFirst {
+    private:
+      bool largest;
+    public:
+      BestValueFirst(bool l) : largest(l) {}
+      bool operator()(const std::pair<double, size_t>& a,
+                      const std::pair<double, size_t>& b) const {
+        if (a.first != b.first)
+          return largest ? a.first > b.first : a.first < b.first;
+        return a.second < b.second;
+      }
+    };
+
+  } // namespace CorelationDetail
+
+  template<class T, class U>
+  FloatImageView* corelation_weighted_map(const T& a, const U& b, double bb, double bw, double wb, double ww) {
+    using namespace CorelationDetail;
+    FloatImageView* result = create_corelation_map(a, b);
+    BitPackedImage pa(a), pb(b);
+    double template_black = template_black_count(pb);
+    double area = b.nrows() * b.ncols();
+    SummedAreaTable image_black(a, BlackValue());
+    size_t ncols = result->ncols(), nrows = result->nrows();
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int y = 0; y < (int)nrows; ++y) {
+      for (size_t x = 0; x < ncols; ++x) {
+        double n_bb = and_count(pa, pb, x, y);
+        double n_bw = template_black - n_bb;
+        double n_wb = image_black.sum(x, y, b.ncols(), b.nrows()) - n_bb;
+        double n_ww = area - n_bb - n_bw - n_wb;
+        result->set(Point(x, y), (n_bb * bb + n_bw * bw + n_wb * wb + n_ww * ww) / template_black);
+      }
+    }
+    return result;
+  }
+
+  template<class T, class U>
+  FloatImageView* corelation_sum_map(const T& a, const U& b) {
+    return CorelationDetail::sum_map(a, b, typename T::value_type(), false);
+  }
+
+  template<class T, class U>
+  FloatImageView* corelation_sum_squares_map(const T& a, const U& b) {
+    return CorelationDetail::sum_map(a, b, typename T::value_type(), true);
+  }
+
+  // The n best positions in a corelation map as a list of (Point, value)
+  // tuples. When min_distance > 0, only local extrema are considered and
+  // positions closer than min_distance (in each direction) to an already
+  // selected better position are suppressed.
+  template<class T>
+  PyObject* corelation_best_offsets(const T& map, int n, bool largest, int min_distance) {
+    using namespace CorelationDetail;
+    typedef std::pair<double, size_t> candidate;
+    BestValueFirst better(largest);
+    size_t ncols = map.ncols(), nrows = map.nrows();
+    size_t x, y;
+    std::vector<candidate> candidates;
+
+    if (n < 1)
+      throw std::runtime_error("corelation_best_offsets: n must be positive.");
+
+    for (y = 0; y < nrows; ++y) {
+      for (x = 0; x < ncols; ++x) {
+        double value = map.get(Point(x, y));
+        if (min_distance > 0) {
+          // skip positions with a strictly better neighbor
+          bool extremum = true;
+          for (size_t yy = (y > 0 ? y-1 : 0); extremum && yy <= y+1 && yy < nrows; ++yy)
+            for (size_t xx = (x > 0 ? x-1 : 0); xx <= x+1 && xx < ncols; ++xx) {
+              double neighbor = map.get(Point(xx, yy));
+              if (largest ? neighbor > value : neighbor < value) {
+                extremum = false;
+                break;
+              }
+            }
+          if (!extremum)
+            continue;
+        }
+        candidates.push_back(candidate(value, y * ncols + x));
+        // keep the list bounded when there is no suppression
+        if (min_distance <= 0 && candidates.size() > (size_t)(4 * n + 1024)) {
+          std::nth_element(candidates.begin(), candidates.begin() + n, candidates.end(), better);
+          candidates.resize(n);
+        }
+      }
+    }
+    std::sort(candidates.begin(), candidates.end(), better);
+
+    std::vector<candidate> selected;
+    for (size_t i = 0; i < candidates.size() && selected.size() < (size_t)n; ++i) {
+      long cx = candidates[i].second % ncols, cy = candidates[i].second / ncols;
+      bool suppressed = false;
+      for (size_t j = 0; j < selected.size() && min_distance > 0; ++j) {
+        long sx = selected[j].second % ncols, sy = selected[j].second / ncols;
+        if (labs(cx - sx) < min_distance && labs(cy - sy) < min_distance) {
+          suppressed = true;
+          break;
+        }
+      }
+      if (!suppressed)
+        selected.push_back(candidates[i]);
+    }
+
+    PyObject* list = PyList_New(selected.size());
+    for (size_t i = 0; i < selected.size(); ++i) {
+      Point p(selected[i].second % ncols + map.ul_x(), selected[i].second / ncols + map.ul_y());
+      PyList_SET_ITEM(list, i, Py_BuildValue("Nd", create_PointObject(p), selected[i].first));
+    }
+    return list;
+  }
+
 }
 
 #endif
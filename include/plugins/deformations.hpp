@@ -23,6 +23,8 @@
 #include "vigra/affinegeometry.hxx"
 #include "plugins/logical.hpp"
 #include "plugins/morphology.hpp"
+#include "vigra/random.hxx"
+#include "native_threads.hpp"
 
 #include <exception>
 #include <cstdlib>
@@ -30,6 +32,8 @@
 #include <math.h>
 #include <time.h>
 #include <algorithm>
+#include <string>
+#include <vector>
 
 // for backward compatibility:
 // plugin rotate has been moved from here to transformation.hpp
@@ -255,9 +259,16 @@ inline double sinc(float per, int n)
   return sin2(per,n)*per/(2*M_PI*n);
 }
 
-inline double noisefunc(void)
+/*
+ * Each call of a deformation uses its own random generator initialized
+ * with random_seed, so that the deformations can run concurrently and
+ * their results do not depend on the order of the calls.
+ */
+typedef vigra::RandomMT19937 DeformationRandom;
+
+inline double noisefunc(DeformationRandom& rng)
 {
-  return -1.0 + (2.0 * rand()/(RAND_MAX+1.0));
+  return -1.0 + 2.0 * rng.uniform53();
 }
 
 inline size_t expDim(size_t amp)
@@ -289,7 +300,7 @@ typename ImageFactory<T>::view_type* wave(const T &src, int amplitude, float fre
 
   typedef typename T::value_type pixelFormat;
 
-  srand(random_seed);
+  DeformationRandom rng((vigra::UInt32)random_seed);
 
   pixelFormat background = pixelFormat(0.0);
   
@@ -353,13 +364,15 @@ typename ImageFactory<T>::view_type* wave(const T &src, int amplitude, float fre
     
     if (direction) {
       for(size_t i=0; i<new_view->nrows(); i++) {
-	double shift = ((double)amplitude/2)*(1-waveType(freq,(int)i-offset))+(turbulence*(rand()/RAND_MAX))+(turbulence/2.0);
+	double shift = ((double)amplitude/2)*(1-waveType(freq,(int)i-offset))+turbulence*(rng.uniform()-0.5);
+	shift = std::max(0.0, std::min(shift, (double)amplitude));
 	shear_x(src, *new_view, i, (size_t)(floor(shift)), background, (double)(shift-floor(shift)));
       }
     }
     else {
       for(size_t i=0; i<new_view->ncols(); i++) {
-	double shift = ((double)amplitude/2)*(1-waveType(freq,(int)i-offset))+(turbulence*(rand()/RAND_MAX))+(turbulence/2.0);
+	double shift = ((double)amplitude/2)*(1-waveType(freq,(int)i-offset))+turbulence*(rng.uniform()-0.5);
+	shift = std::max(0.0, std::min(shift, (double)amplitude));
 	shear_y(src, *new_view, i, (size_t)(floor(shift)), background, (double)(shift - (size_t)(shift)));
       }
     }
@@ -387,7 +400,7 @@ typename ImageFactory<T>::view_type* noise(const T &src, int amplitude, int dire
 
   //image_copy_fill(src, *new_view);
 
-  srand(random_seed);
+  DeformationRandom rng((vigra::UInt32)random_seed);
 
   size_t (*vertExpand)(size_t), (*horizExpand)(size_t), (*vertShift)(size_t, double), (*horizShift)(size_t, double);
   
@@ -431,8 +444,8 @@ typename ImageFactory<T>::view_type* noise(const T &src, int amplitude, int dire
     
     for(size_t i = 0; i<src.nrows(); i++) {
       for(size_t j = 0; j<src.ncols();j++) {
-	new_view->set(Point(j+horizShift(amplitude,noisefunc()),
-			    i+vertShift(amplitude,noisefunc())),
+	new_view->set(Point(j+horizShift(amplitude,noisefunc(rng)),
+			    i+vertShift(amplitude,noisefunc(rng))),
 		      src.get(Point(j, i)));
       }
     }
@@ -470,7 +483,7 @@ typename ImageFactory<T>::view_type* inkrub(const T &src, int a, long random_see
     
     image_copy_fill(src, *new_view);
     
-    srand(random_seed);
+    DeformationRandom rng((vigra::UInt32)random_seed);
     
     for (int i=0; ir != src.row_end(); ++ir, ++jr, i++) {
       typename IteratorI::iterator ic = ir.begin();
@@ -478,7 +491,7 @@ typename ImageFactory<T>::view_type* inkrub(const T &src, int a, long random_see
       for (int j=0; ic != ir.end(); ++ic, ++jc, j++) {
 	pixelFormat px2 = *ic;
 	pixelFormat px1 = src.get(Point(new_view->ncols()-j-1, i));
-	if ((a*rand()/RAND_MAX) == 0)
+	if (a <= 1 || rng.uniformInt(a) == 0)
 	  *jc = norm_weight_avg(px1, px2, 0.5, 0.5);
       }
     }
@@ -523,7 +536,7 @@ typename ImageFactory<T>::view_type* ink_diffuse(const T &src, int type, double
     pixelFormat aggColor = pixelFormat();
     pixelFormat currColor = pixelFormat();
     
-    srand(random_seed);
+    DeformationRandom rng((vigra::UInt32)random_seed);
     
     if (type == 0) {
       
@@ -570,9 +583,9 @@ typename ImageFactory<T>::view_type* ink_diffuse(const T &src, int type, double
       
       size_t starti, startj;
       double iD, jD;
-      iD = (double)src.ncols() * (double)rand() / (double)RAND_MAX;
+      iD = (double)src.ncols() * rng.uniform();
       starti = (unsigned int)(floor(iD));
-      jD = (double)src.nrows() * (double)rand() / (double)RAND_MAX;
+      jD = (double)src.nrows() * rng.uniform();
       startj = (unsigned int)(floor(jD));
       
       while( ( (iD>0) && (iD < src.ncols())) && ( (jD>0) && (jD<src.nrows()) ) ) {
@@ -584,8 +597,8 @@ typename ImageFactory<T>::view_type* ink_diffuse(const T &src, int type, double
 	aggColor = norm_weight_avg(aggColor, currColor, 1-weight, weight);
 	new_view->set(Point(size_t(floor(iD)), size_t(floor(jD))), 
 		      norm_weight_avg(aggColor, currColor, 1.0-val, val));
-	iD += sin(2.0*M_PI*rand()/(double)RAND_MAX);
-	jD += cos(2.0*M_PI*rand()/(double)RAND_MAX);
+	iD += sin(2.0*M_PI*rng.uniform());
+	jD += cos(2.0*M_PI*rng.uniform());
       }
     }
     
@@ -639,10 +652,10 @@ typename ImageFactory<T>::view_type* degrade_kanungo(const T &src, float eta, fl
   }
 
   // flip pixels randomly based on their distance from border
-  srand(random_seed);
+  DeformationRandom rng((vigra::UInt32)random_seed);
   for (q=dest->vec_begin(), df=dt_fore->vec_begin(), db=dt_back->vec_begin();
        q != dest->vec_end(); q++, df++, db++) {
-    randval = ((double)rand()) / RAND_MAX;
+    randval = rng.uniform();
     // note that dest is still inverted => black is background!!
     if (is_black(*q)) {
       d = (int)(*db + 0.5);
@@ -700,15 +713,16 @@ Image* white_speckles(const T &src, float p0, int n, int k, int connectivity = 2
   view_type* speckles = new view_type(*speckles_data);
 
   // create random walk data
+  DeformationRandom rng((vigra::UInt32)random_seed);
   for (y=0; y <= maxy; y++) {
     for (x=0; x <= maxx; x++) {
       Point p(x,y);
-      if (is_black(src.get(p)) && (((double)rand()) / RAND_MAX < p0)) {
+      if (is_black(src.get(p)) && (rng.uniform() < p0)) {
         speckles->set(p,blackval);
         for (i=0; i<n; i++) {
           if (p.x() == 0 || p.x() == maxx || p.y() == 0 || p.y() == maxy)
             break;
-          randval = ((double)rand()) / RAND_MAX;
+          randval = rng.uniform();
           if (connectivity == 0) {
             // random rook move
             if (randval < 0.25)      p.x(p.x() + 1);
@@ -772,6 +786,196 @@ Image* white_speckles(const T &src, float p0, int n, int k, int connectivity = 2
 }
 
 
+
+/*
+ * Batch deformation: applies a sequence of deformations (the "recipe")
+ * n times to each image of a list. The variants are computed in
+ * parallel on native threads. Each deformation step gets a seed
+ * derived from random_seed and the indices of the image, the variant and
+ * the step, so that the result does not depend on the thread scheduling.
+ */
+namespace DeformationDetail {
+  enum { WAVE, NOISE, INKRUB, INK_DIFFUSE, DEGRADE_KANUNGO, WHITE_SPECKLES };
+  // number of parameters per step in the parameter vector
+  const size_t step_params = 6;
+
+  inline long step_seed(long seed, size_t image, size_t variant, size_t step) {
+    unsigned long long h = (unsigned long long)seed;
+    size_t index[3] = { image, variant, step };
+    for (size_t i = 0; i < 3; ++i) {
+      // splitmix64
+      h += 0x9e3779b97f4a7c15ULL + index[i];
+      h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+      h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+      h ^= h >> 31;
+    }
+    return (long)(h & 0x7fffffff);
+  }
+
+  // degrade_kanungo and white_speckles only exist for onebit images
+  template<class T, class P = typename T::value_type>
+  struct OneBitSteps {
+    typedef typename ImageFactory<T>::view_type view_type;
+    static view_type* degrade_kanungo(const T&, const double*, int) {
+      throw std::runtime_error("deform_images: degrade_kanungo requires onebit images");
+    }
+    static view_type* white_speckles(const T&, const double*, int) {
+      throw std::runtime_error("deform_images: white_speckles requires onebit images");
+    }
+  };
+
+  template<class T>
+  struct OneBitSteps<T, OneBitPixel> {
+    typedef typename ImageFactory<T>::view_type view_type;
+    static view_type* degrade_kanungo(const T& src, const double* p, int seed) {
+      return Gamera::degrade_kanungo(src, float(p[0]), float(p[1]), float(p[2]),
+                                     float(p[3]), float(p[4]), int(p[5]), seed);
+    }
+    static view_type* white_speckles(const T& src, const double* p, int seed) {
+      return (view_type*)Gamera::white_speckles(src, float(p[0]), int(p[1]),
+                                                int(p[2]), int(p[3]), seed);
+    }
+  };
+
+  template<class T>
+  typename ImageFactory<T>::view_type* apply_step(const T& src, int op,
+                                                  const double* p, long seed) {
+    switch (op) {
+    case WAVE:
+      return wave(src, int(p[0]), float(p[1]), int(p[2]), int(p[3]), int(p[4]),
+                  p[5], seed);
+    case NOISE:
+      return noise(src, int(p[0]), int(p[1]), seed);
+    case INKRUB:
+      return inkrub(src, int(p[0]), seed);
+    case INK_DIFFUSE:
+      return ink_diffuse(src, int(p[0]), p[1], seed);
+    case DEGRADE_KANUNGO:
+      return OneBitSteps<T>::degrade_kanungo(src, p, int(seed));
+    case WHITE_SPECKLES:
+      return OneBitSteps<T>::white_speckles(src, p, int(seed));
+    }
+    throw std::runtime_error("deform_images: unknown deformation");
+  }
+
+  template<class T>
+  Image* deform_variant(const T& src, const IntVector& ops, const FloatVector& params,
+                        long seed, size_t image, size_t variant) {
+    typedef typename ImageFactory<T>::view_type view_type;
+    if (ops.empty())
+      return simple_image_copy(src);
+    view_type* result = apply_step(src, ops[0], &params[0],
+                                   step_seed(seed, image, variant, 0));
+    for (size_t i = 1; i < ops.size(); ++i) {
+      view_type* next = 0;
+      try {
+        next = apply_step(*result, ops[i], &params[i * step_params],
+                          step_seed(seed, image, variant, i));
+      } catch (std::exception&) {
+        delete result->data();
+        delete result;
+        throw;
+      }
+      delete result->data();
+      delete result;
+      result = next;
+    }
+    return result;
+  }
+
+  inline Image* deform_task(const ImageVector& images, const IntVector& ops,
+                            const FloatVector& params, long seed, size_t i, size_t v) {
+    Image* image = images[i].first;
+    switch (images[i].second) {
+    case ONEBITIMAGEVIEW:
+      return deform_variant(*((OneBitImageView*)image), ops, params, seed, i, v);
+    case CC:
+      return deform_variant(*((Cc*)image), ops, params, seed, i, v);
+    case MLCC:
+      return deform_variant(*((MlCc*)image), ops, params, seed, i, v);
+    case GREYSCALEIMAGEVIEW:
+      return deform_variant(*((GreyScaleImageView*)image), ops, params, seed, i, v);
+    case GREY16IMAGEVIEW:
+      return deform_variant(*((Grey16ImageView*)image), ops, params, seed, i, v);
+    case FLOATIMAGEVIEW:
+      return deform_variant(*((FloatImageView*)image), ops, params, seed, i, v);
+    case RGBIMAGEVIEW:
+      return deform_variant(*((RGBImageView*)image), ops, params, seed, i, v);
+    default:
+      throw std::runtime_error("deform_images: unsupported image type (RLE images are not supported)");
+    }
+  }
+
+  // The variants shared by the threads of deform_images_batch. Each
+  // thread takes the next variant under the mutex until all are done
+  // or one of them has failed.
+  struct DeformJob {
+    const ImageVector* images;
+    const IntVector* operations;
+    const FloatVector* parameters;
+    size_t n;
+    long seed;
+    std::vector<Image*> results;
+    size_t next;
+    std::string error;
+    NativeMutex mutex;
+  };
+
+  inline void deform_worker(void* arg) {
+    DeformJob& job = *(DeformJob*)arg;
+    while (true) {
+      size_t t;
+      {
+        NativeLock lock(job.mutex);
+        if (job.next >= job.results.size() || !job.error.empty())
+          return;
+        t = job.next++;
+      }
+      try {
+        job.results[t] = deform_task(*job.images, *job.operations, *job.parameters,
+                                     job.seed, t / job.n, t % job.n);
+      } catch (std::exception& e) {
+        NativeLock lock(job.mutex);
+        if (job.error.empty())
+          job.error = e.what();
+      }
+    }
+  }
+}
+
+inline ImageList* deform_images_batch(ImageVector& images, IntVector* operations,
+                               FloatVector* parameters, int n, int random_seed)
+{
+  using namespace DeformationDetail;
+  if (parameters->size() != operations->size() * step_params)
+    throw std::runtime_error("deform_images: wrong number of parameters");
+  if (n < 0)
+    throw std::runtime_error("deform_images: n must not be negative");
+
+  DeformJob job;
+  job.images = &images;
+  job.operations = operations;
+  job.parameters = parameters;
+  job.n = n;
+  job.seed = random_seed;
+  job.results.resize(images.size() * n, (Image*)0);
+  job.next = 0;
+  size_t num_threads = std::min((size_t)native_processor_count(), job.results.size());
+  if (num_threads > 0)
+    run_native_threads((unsigned int)num_threads, deform_worker, &job);
+
+  if (!job.error.empty()) {
+    for (size_t t = 0; t < job.results.size(); ++t) {
+      if (job.results[t]) {
+        delete job.results[t]->data();
+        delete job.results[t];
+      }
+    }
+    throw std::runtime_error(job.error);
+  }
+  return new ImageList(job.results.begin(), job.results.end());
+}
+
 }
 
 #endif
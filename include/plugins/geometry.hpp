@@ -32,6 +32,7 @@
 #include "vigra/seededregiongrowing.hxx"
 #include "geostructs/kdtree.hpp"
 #include "geostructs/delaunaytree.hpp"
+#include "geostructs/sweephull.hpp"
 #include "graph/graph.hpp"
 #include "graph/graphdataderived.hpp"
 #include "graph/node.hpp"
@@ -326,14 +327,71 @@ namespace Gamera {
     }
   }
   
-  PyObject* delaunay_from_points(PointVector *pv, IntVector *lv) {
+  // same as delaunay_from_points_cpp, but computed with the radial sweep
+  // hull on flat arrays; the label pairs are returned sorted and unique
+  void delaunay_from_points_sweephull_cpp(PointVector *pv, IntVector *lv, std::vector<std::pair<int,int> > *result) {
+
+    // some plausi checks
+    if (pv->empty()) {
+      throw std::runtime_error("No points for triangulation given.");
+    }
+    if (pv->size() < 3) {
+      throw std::runtime_error("At least three points are required.");
+    }
+    if (pv->size() != lv->size()) {
+      throw std::runtime_error("Number of points must match the number of labels.");
+    }
+
+    size_t i, j, n = pv->size();
+    std::vector<double> coords(2 * n);
+    for (i = 0; i < n; ++i) {
+      coords[2*i] = (*pv)[i].x();
+      coords[2*i+1] = (*pv)[i].y();
+    }
+
+    SweepHull sh;
+    std::vector<int> offsets, neighbors;
+    sh.triangulate(coords);
+    sh.neighborAdjacency(&offsets, &neighbors);
+
+    result->clear();
+    for (i = 0; i < n; ++i) {
+      int label1 = (*lv)[i];
+      for (j = offsets[i]; j < (size_t)offsets[i+1]; ++j) {
+        int label2 = (*lv)[neighbors[j]];
+        if (label1 < label2)
+          result->push_back(std::make_pair(label1, label2));
+      }
+    }
+    std::sort(result->begin(), result->end());
+    result->erase(std::unique(result->begin(), result->end()), result->end());
+  }
+
+  PyObject* delaunay_from_points(PointVector *pv, IntVector *lv, int method) {
     PyObject *list, *entry, *label1, *label2;
+
+    list = PyList_New(0);
+    if (method == 1) {
+      std::vector<std::pair<int,int> > pairs;
+      std::vector<std::pair<int,int> >::iterator pit;
+      delaunay_from_points_sweephull_cpp(pv, lv, &pairs);
+      for (pit=pairs.begin(); pit!=pairs.end(); ++pit) {
+        entry = PyList_New(2);
+        label1 = Py_BuildValue("i", pit->first);
+        label2 = Py_BuildValue("i", pit->second);
+        PyList_SetItem(entry, 0, label1);
+        PyList_SetItem(entry, 1, label2);
+        PyList_Append(list, entry);
+        Py_DECREF(entry);
+      }
+      return list;
+    }
+
     std::map<int,std::set<int> > neighbors;
     std::map<int,std::set<int> >::iterator nit1;
     std::set<int>::iterator nit2;
     
-  delaunay_from_points_cpp(pv, lv, &neighbors);
-    list = PyList_New(0);
+    delaunay_from_points_cpp(pv, lv, &neighbors);
     for (nit1=neighbors.begin(); nit1!=neighbors.end(); ++nit1) {
       for (nit2=nit1->second.begin(); nit2!=nit1->second.end(); nit2++) {
         entry = PyList_New(2);
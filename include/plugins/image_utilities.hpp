@@ -33,6 +33,8 @@
 #include <math.h>
 #include <algorithm>
 #include <map>
+#include <set>
+#include <vector>
 
 // for compatibility: resize, scale, mirror, and shear
 //  were formerly implemented in image_utilitis instead of transformation
@@ -742,59 +744,237 @@ namespace Gamera {
   }
 
   /*
-   * compute Cc's from an already labeled image
-   * Christoph Dalitz and Hasan Yildiz
+   * Statistics of the labeled regions of an image, which are all
+   * collected in a single pass over the image (see region_properties).
+   * The image is split into stripes of rows that are processed in
+   * parallel; each label is processed run by run.
    */
-  template<class T>
-  ImageList* ccs_from_labeled_image(T &src) {
-    typedef typename T::value_type value_type;
-    value_type value;
+  struct RegionStats {
+    size_t ul_x, ul_y, lr_x, lr_y;
+    double area, sum_x, sum_y, sum_xx, sum_yy, sum_xy;
+    size_t perimeter;
+
+    RegionStats() : ul_x(0), ul_y(0), lr_x(0), lr_y(0), area(0), sum_x(0),
+                    sum_y(0), sum_xx(0), sum_yy(0), sum_xy(0), perimeter(0) {}
+
+    // adds the pixels x0 to x1-1 in row y
+    void add_run(size_t y, size_t x0, size_t x1) {
+      if (area == 0) {
+        ul_x = x0; ul_y = y; lr_x = x1 - 1; lr_y = y;
+      } else {
+        ul_x = std::min(ul_x, x0);
+        lr_x = std::max(lr_x, x1 - 1);
+        lr_y = y;
+      }
+      double n = (double)(x1 - x0);
+      // sums of x and x^2 over the run
+      double sx = n * (x0 + x1 - 1) / 2.0;
+      double a = (double)x0, b = (double)x1 - 1;
+      double sxx = (b * (b + 1) * (2 * b + 1) - (a - 1) * a * (2 * a - 1)) / 6.0;
+      area += n;
+      sum_x += sx;
+      sum_xx += sxx;
+      sum_y += n * y;
+      sum_yy += n * y * y;
+      sum_xy += sx * y;
+    }
 
-    ImageList* return_ccs = new ImageList();
+    void merge(const RegionStats& other) {
+      if (other.area == 0)
+        return;
+      if (area == 0) {
+        ul_x = other.ul_x; ul_y = other.ul_y; lr_x = other.lr_x; lr_y = other.lr_y;
+      } else {
+        ul_x = std::min(ul_x, other.ul_x);
+        ul_y = std::min(ul_y, other.ul_y);
+        lr_x = std::max(lr_x, other.lr_x);
+        lr_y = std::max(lr_y, other.lr_y);
+      }
+      area += other.area;
+      sum_x += other.sum_x;
+      sum_y += other.sum_y;
+      sum_xx += other.sum_xx;
+      sum_yy += other.sum_yy;
+      sum_xy += other.sum_xy;
+      perimeter += other.perimeter;
+    }
+  };
 
-    std::map<unsigned int, Rect*> pixel;
-    std::map<unsigned int, Rect*>::iterator iter;
+  typedef std::map<unsigned int, RegionStats> RegionStatsMap;
+  typedef std::set<std::pair<unsigned int, unsigned int> > RegionPairSet;
 
-    for (size_t y=0; y < src.nrows(); ++y) {
-      for (size_t x=0; x < src.ncols(); ++x) {
-        if (!is_white(src.get(Point(x,y)))) {
-          value = src.get(Point(x,y));
+  namespace RegionStatsDetail {
+    template<class T>
+    void load_row(const T& src, int y, std::vector<unsigned int>& row) {
+      if (y < 0 || y >= (int)src.nrows()) {
+        std::fill(row.begin(), row.end(), 0);
+        return;
+      }
+      typename T::const_row_iterator r = src.row_begin() + y;
+      typename T::const_col_iterator c = r.begin();
+      for (size_t x = 0; c != r.end(); ++c, ++x)
+        row[x] = (unsigned int)*c;
+    }
 
-          // when new label: create Rect for new Cc
-          if (pixel.find(value) == pixel.end()) {
-            pixel[value] = new Rect(Point(x, y), Point(x, y));
+    // the statistics of the rows y0 to y1-1; when details is set, the
+    // perimeter (pixels with a 4-neighbor of another label) and the pairs
+    // of 8-adjacent labels (smaller label first) are computed, too
+    template<class T>
+    void stripe_stats(const T& src, int y0, int y1, bool details,
+                      RegionStatsMap& stats, RegionPairSet& pairs) {
+      size_t ncols = src.ncols();
+      std::vector<unsigned int> above(ncols), row(ncols), below(ncols);
+      if (details) {
+        load_row(src, y0 - 1, above);
+        load_row(src, y0, row);
+        load_row(src, y0 + 1, below);
+      }
+      std::pair<unsigned int, unsigned int> last_pair(0, 0);
+      for (int y = y0; y < y1; ++y) {
+        if (details && y > y0) {
+          above.swap(row);
+          row.swap(below);
+          load_row(src, y + 1, below);
+        } else if (!details) {
+          load_row(src, y, row);
+        }
+        size_t x = 0;
+        while (x < ncols) {
+          unsigned int v = row[x];
+          size_t x1 = x + 1;
+          while (x1 < ncols && row[x1] == v)
+            ++x1;
+          if (v == 0) {
+            x = x1;
+            continue;
           }
-          // update Rect bounding box when known label
-          else {
-            iter = pixel.find(value);
-
-            if (y < (*iter).second->ul_y())
-              (*iter).second->ul_y(y);
-            if (x < (*iter).second->ul_x())
-              (*iter).second->ul_x(x);
-            if (y > (*iter).second->lr_y())
-              (*iter).second->lr_y(y);
-            if (x > (*iter).second->lr_x())
-              (*iter).second->lr_x(x);
+          RegionStats& s = stats[v];
+          s.add_run(y, x, x1);
+          if (details) {
+            for (size_t i = x; i < x1; ++i) {
+              if (i == x || i == x1 - 1 || above[i] != v || below[i] != v)
+                s.perimeter++;
+              size_t from = (i > 0) ? i - 1 : 0, to = std::min(i + 1, ncols - 1);
+              for (size_t j = from; j <= to; ++j) {
+                unsigned int w = below[j];
+                if (w != 0 && w != v) {
+                  std::pair<unsigned int, unsigned int> p(std::min(v, w), std::max(v, w));
+                  if (p != last_pair) {
+                    pairs.insert(p);
+                    last_pair = p;
+                  }
+                }
+              }
+            }
+            if (x1 < ncols && row[x1] != 0) {
+              unsigned int w = row[x1];
+              pairs.insert(std::make_pair(std::min(v, w), std::max(v, w)));
+            }
           }
+          x = x1;
         }
       }
     }
+  }
+
+  template<class T>
+  void region_stats(const T& src, bool details, RegionStatsMap& stats, RegionPairSet& pairs) {
+    const int stripe_height = 64;
+    int nstripes = ((int)src.nrows() + stripe_height - 1) / stripe_height;
+    std::vector<RegionStatsMap> stripe_stats(nstripes);
+    std::vector<RegionPairSet> stripe_pairs(nstripes);
+    int i;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (i = 0; i < nstripes; ++i) {
+      int y0 = i * stripe_height;
+      int y1 = std::min(y0 + stripe_height, (int)src.nrows());
+      RegionStatsDetail::stripe_stats(src, y0, y1, details, stripe_stats[i], stripe_pairs[i]);
+    }
+    for (i = 0; i < nstripes; ++i) {
+      for (RegionStatsMap::iterator s = stripe_stats[i].begin(); s != stripe_stats[i].end(); ++s)
+        stats[s->first].merge(s->second);
+      pairs.insert(stripe_pairs[i].begin(), stripe_pairs[i].end());
+    }
+  }
+
+  /*
+   * compute Cc's from an already labeled image
+   * Christoph Dalitz and Hasan Yildiz
+   */
+  template<class T>
+  ImageList* ccs_from_labeled_image(T &src) {
+    RegionStatsMap stats;
+    RegionPairSet pairs;
+    region_stats(src, false, stats, pairs);
 
     // create Cc's for all labels
-    for (iter = pixel.begin(); iter != pixel.end(); iter++) {
+    ImageList* return_ccs = new ImageList();
+    for (RegionStatsMap::iterator s = stats.begin(); s != stats.end(); ++s) {
       return_ccs->push_back(new ConnectedComponent<typename T::data_type>(
                     *src.data(),    // data
-                    (*iter).first,  // label
-                    Point((*iter).second->ul_x(), (*iter).second->ul_y()), // upper left
-                    Point((*iter).second->lr_x(), (*iter).second->lr_y())  // lower right
+                    s->first,       // label
+                    Point(s->second.ul_x + src.offset_x(), s->second.ul_y + src.offset_y()), // upper left
+                    Point(s->second.lr_x + src.offset_x(), s->second.lr_y + src.offset_y())  // lower right
                   ));
+    }
+    return return_ccs;
+  }
 
-      delete iter->second;
-      iter->second = 0;
+  /*
+   * table of properties of all labeled regions
+   */
+  template<class T>
+  PyObject* region_properties(const T& src) {
+    RegionStatsMap stats;
+    RegionPairSet pairs;
+    region_stats(src, true, stats, pairs);
+
+    std::map<unsigned int, std::vector<unsigned int> > neighbors;
+    for (RegionPairSet::iterator p = pairs.begin(); p != pairs.end(); ++p) {
+      neighbors[p->first].push_back(p->second);
+      neighbors[p->second].push_back(p->first);
     }
 
-    return return_ccs;
+    const char* names[] = {"label", "ul_x", "ul_y", "lr_x", "lr_y", "area",
+                           "center_x", "center_y", "mu20", "mu02", "mu11",
+                           "perimeter", "neighbors"};
+    const size_t ncolumns = sizeof(names) / sizeof(names[0]);
+    PyObject* columns[ncolumns];
+    for (size_t c = 0; c < ncolumns; ++c)
+      columns[c] = PyList_New(stats.size());
+
+    size_t i = 0;
+    double ox = (double)src.offset_x(), oy = (double)src.offset_y();
+    for (RegionStatsMap::iterator it = stats.begin(); it != stats.end(); ++it, ++i) {
+      const RegionStats& s = it->second;
+      double cx = s.sum_x / s.area, cy = s.sum_y / s.area;
+      PyList_SET_ITEM(columns[0], i, PyInt_FromLong(it->first));
+      PyList_SET_ITEM(columns[1], i, PyInt_FromLong(s.ul_x + src.offset_x()));
+      PyList_SET_ITEM(columns[2], i, PyInt_FromLong(s.ul_y + src.offset_y()));
+      PyList_SET_ITEM(columns[3], i, PyInt_FromLong(s.lr_x + src.offset_x()));
+      PyList_SET_ITEM(columns[4], i, PyInt_FromLong(s.lr_y + src.offset_y()));
+      PyList_SET_ITEM(columns[5], i, PyInt_FromLong((long)s.area));
+      PyList_SET_ITEM(columns[6], i, PyFloat_FromDouble(cx + ox));
+      PyList_SET_ITEM(columns[7], i, PyFloat_FromDouble(cy + oy));
+      PyList_SET_ITEM(columns[8], i, PyFloat_FromDouble(s.sum_xx / s.area - cx * cx));
+      PyList_SET_ITEM(columns[9], i, PyFloat_FromDouble(s.sum_yy / s.area - cy * cy));
+      PyList_SET_ITEM(columns[10], i, PyFloat_FromDouble(s.sum_xy / s.area - cx * cy));
+      PyList_SET_ITEM(columns[11], i, PyInt_FromLong(s.perimeter));
+      const std::vector<unsigned int>& n = neighbors[it->first];
+      PyObject* nlist = PyList_New(n.size());
+      for (size_t j = 0; j < n.size(); ++j)
+        PyList_SET_ITEM(nlist, j, PyInt_FromLong(n[j]));
+      PyList_SET_ITEM(columns[12], i, nlist);
+    }
+
+    PyObject* result = PyDict_New();
+    for (size_t c = 0; c < ncolumns; ++c) {
+      PyDict_SetItemString(result, names[c], columns[c]);
+      Py_DECREF(columns[c]);
+    }
+    return result;
   }
 
   /*
@@ -27,7 +27,10 @@
 #include "neighbor.hpp"
 #include "vigra/gaborfilter.hxx"
 #include "convolution.hpp"
+#include "bitpacked.hpp"
 #include <math.h>
+#include <vector>
+#include <algorithm>
 
 using namespace std;
 
@@ -274,59 +277,180 @@ namespace Gamera {
 
   //----------------------------------------------------------------
   // rank filter (Christoph Dalitz and David Kolanus)
+  //
+  // After S. Perreault, P. Hebert: "Median Filtering in Constant
+  // Time." IEEE Transactions on Image Processing 16, pp. 2389-2394
+  // (2007). Each column has a coarse histogram (high bits of the pixel
+  // values) and fine histograms (low bits, one per coarse bin) of its
+  // k pixels in the window rows, which are moved down by one row per
+  // image row. The coarse window histogram is moved right by adding and
+  // subtracting whole column histograms. The fine window histogram is
+  // only brought up to date for the coarse bin that contains the wanted
+  // rank, from the fine histograms of the columns that entered or left
+  // the window since its last use. The fine column histograms of a
+  // coarse bin are only allocated when a pixel of that bin occurs in a
+  // strip, so that Grey16 images with a narrow value range do not need
+  // 65536 bins per column.
+  //
+  // The image is processed in vertical strips of at least 2*k columns,
+  // so that building the fine window histograms at the start of a row
+  // is amortized over the strip. The strips are run in parallel when
+  // compiled with OpenMP.
   //----------------------------------------------------------------
-  template<class T>
-  class RankHist {
-  public:
-    unsigned int* hist;
-    unsigned int histsize;
-    RankHist<T>() {
-      unsigned int color;
-      histsize = (unsigned int)pow(2.0,8.0*sizeof(T));
-      hist = new unsigned int[histsize];
-      for(color=0; color<histsize; color++){
-        hist[color]=0;
+  namespace RankDetail {
+    // mapping between pixel values and histogram bins
+    template<class V>
+    struct Bins {
+      static const unsigned int bits = 8;
+      static unsigned short bin(V v) { return (unsigned short)v; }
+      static V value(unsigned short b) { return V(b); }
+    };
+    template<>
+    struct Bins<Grey16Pixel> {
+      static const unsigned int bits = 16;
+      static unsigned short bin(Grey16Pixel v) {
+        return (unsigned short)std::min(v, Grey16Pixel(65535));
       }
+      static Grey16Pixel value(unsigned short b) { return Grey16Pixel(b); }
+    };
+    template<>
+    struct Bins<OneBitPixel> {
+      static const unsigned int bits = 1;
+      static unsigned short bin(OneBitPixel v) { return is_black(v) ? 1 : 0; }
+      static OneBitPixel value(unsigned short b) { return b ? 1 : 0; }
     };
-    ~RankHist<T>() { delete[] hist; };
-    inline unsigned int operator() (unsigned int r, unsigned int k2);
-  };
 
-  template<>
-  RankHist<Grey16Pixel>::RankHist() {
-    unsigned int color;
-    histsize = 65536; // only 16bit
-    hist = new unsigned int[histsize];
-    for(color=0; color<histsize; color++){
-      hist[color]=0;
-    }
-  }
+    // coarse and fine histograms of n columns (the counts are at most
+    // k); the fine histograms of coarse bin c are allocated when the
+    // first pixel of that bin is added
+    struct ColumnHistograms {
+      unsigned int fbits;
+      size_t F, C, n;
+      std::vector<unsigned short> coarse;
+      std::vector<std::vector<unsigned short> > fine;
+
+      ColumnHistograms(unsigned int bits, size_t ncols)
+        : fbits(bits / 2), F(size_t(1) << (bits / 2)),
+          C(size_t(1) << (bits - bits / 2)), n(ncols),
+          coarse(ncols * C, 0), fine(C) {}
+
+      void add(size_t i, unsigned short v) {
+        size_t c = v >> fbits;
+        ++coarse[i * C + c];
+        if (fine[c].empty())
+          fine[c].resize(n * F, 0);
+        ++fine[c][i * F + (v & (F - 1))];
+      }
+      void remove(size_t i, unsigned short v) {
+        size_t c = v >> fbits;
+        --coarse[i * C + c];
+        --fine[c][i * F + (v & (F - 1))];
+      }
+    };
 
-  template<class T>
-  inline unsigned int RankHist<T>::operator() (unsigned int r, unsigned int k2) {
-	unsigned int collect = 0;
-    unsigned int color;
-	for(color=0; color<histsize; color++){
-      collect += hist[color];
-      if(collect>=r){
-        return color;
+    // Filters the columns x0 to x1-1 of the image. bins is the image
+    // padded by k/2 pixels on each side in column major order (prows
+    // rows) and dest the result (ncols columns). rank counts from one.
+    inline void rank_strip(const std::vector<unsigned short>& bins, size_t prows,
+                           size_t nrows, unsigned int bits, unsigned int k,
+                           unsigned int rank, size_t x0, size_t x1,
+                           std::vector<unsigned short>& dest, size_t ncols) {
+      const size_t ncolhist = x1 - x0 + k - 1;
+      const unsigned short* strip = &bins[x0 * prows];
+      ColumnHistograms cols(bits, ncolhist);
+      const unsigned int fbits = cols.fbits;
+      const size_t F = cols.F, C = cols.C;
+
+      // window histograms; kc0 is the coarse histogram of the first
+      // window in the row and stamp the column for which the fine
+      // histogram of a coarse bin is up to date
+      std::vector<unsigned int> kc0(C, 0), kc(C), kf(C * F);
+      std::vector<long> stamp(C);
+
+      for (size_t py = 0; py + 1 < k; ++py) {
+        for (size_t i = 0; i < ncolhist; ++i) {
+          unsigned short v = strip[i * prows + py];
+          cols.add(i, v);
+          if (i < k)
+            ++kc0[v >> fbits];
+        }
       }
-	}
-	return color;
-  }
 
-  template<>
-  inline unsigned int RankHist<OneBitPixel>::operator() (unsigned int r, unsigned int k2) {
-	unsigned int collect = 0;
-    unsigned int color;
-	collect = 0;
-	for(color=0; color<histsize; color++){
-      collect += hist[color];
-      if(collect>=k2-r+1){
-        return color;
+      for (size_t y = 0; y < nrows; ++y) {
+        // move the column histograms down
+        for (size_t i = 0; i < ncolhist; ++i) {
+          unsigned short v = strip[i * prows + y + k - 1];
+          cols.add(i, v);
+          if (i < k)
+            ++kc0[v >> fbits];
+        }
+
+        std::copy(kc0.begin(), kc0.end(), kc.begin());
+        std::fill(stamp.begin(), stamp.end(), -1);
+
+        unsigned short* out = &dest[y * ncols];
+        for (size_t i = 0; i < x1 - x0; ++i) {
+          if (i > 0) {
+            const unsigned short* in = &cols.coarse[(i + k - 1) * C];
+            const unsigned short* outgoing = &cols.coarse[(i - 1) * C];
+            for (size_t c = 0; c < C; ++c)
+              kc[c] += in[c] - outgoing[c];
+          }
+
+          // coarse bin containing the rank
+          unsigned int sum = 0;
+          size_t c = 0;
+          while (sum + kc[c] < rank)
+            sum += kc[c++];
+
+          // bring its fine histogram up to date, either from the k
+          // column histograms in the window or from those that entered
+          // or left it since its last use, whichever is less work
+          unsigned int* f = &kf[c * F];
+          const unsigned short* fcol = &cols.fine[c][0];
+          if (stamp[c] < 0 || 2 * (long(i) - stamp[c]) >= long(k)) {
+            std::fill(f, f + F, 0);
+            for (size_t j = i; j < i + k; ++j) {
+              const unsigned short* h = &fcol[j * F];
+              for (size_t l = 0; l < F; ++l)
+                f[l] += h[l];
+            }
+          } else {
+            for (size_t j = stamp[c] + 1; j <= i; ++j) {
+              const unsigned short* in = &fcol[(j + k - 1) * F];
+              const unsigned short* outgoing = &fcol[(j - 1) * F];
+              for (size_t l = 0; l < F; ++l)
+                f[l] += in[l] - outgoing[l];
+            }
+          }
+          stamp[c] = i;
+
+          size_t l = 0;
+          while (sum + f[l] < rank)
+            sum += f[l++];
+          out[x0 + i] = (unsigned short)((c << fbits) | l);
+        }
+
+        // remove the top row
+        for (size_t i = 0; i < ncolhist; ++i) {
+          unsigned short v = strip[i * prows + y];
+          cols.remove(i, v);
+          if (i < k)
+            --kc0[v >> fbits];
+        }
       }
-	}
-	return color;
+    }
+
+    // maps the index of a padded row or column to the image (-1 for white)
+    inline int border_index(int i, int n, size_t border_treatment) {
+      if (i >= 0 && i < n)
+        return i;
+      if (border_treatment != 1)
+        return -1;
+      if (i < 0)
+        return -i;
+      return n - (i - n) - 2;
+    }
   }
 
   template<class T>
@@ -334,63 +458,69 @@ namespace Gamera {
     typedef typename ImageFactory<T>::data_type data_type;
     typedef typename ImageFactory<T>::view_type view_type;
     typedef typename T::value_type T_value_type;
+    typedef RankDetail::Bins<T_value_type> bins_type;
 
     if (src.nrows() < k || src.ncols() < k)
       return simple_image_copy(src);
+    if (k > 65535)
+      throw std::range_error("rank: window size k too large");
+    if (rank < 1 || rank > k * k)
+      throw std::range_error("rank: rank must be between 1 and k*k");
 
-    data_type *res_data = new data_type(src.size(), src.origin());
-    view_type *res= new view_type(*res_data);
-    //image_copy_fill(src, *res);
+    // for onebit images, low ranks shall darken the image
+    if (bins_type::bits == 1)
+      rank = k * k - rank + 1;
 
     int src_ncols = (int)src.ncols();
     int src_nrows = (int)src.nrows();
+    int r = (k-1)/2;
+    size_t pcols = src_ncols + k - 1;
+    size_t prows = src_nrows + k - 1;
+
+    std::vector<unsigned short> image(src_ncols * src_nrows);
+    typename T::const_row_iterator row = src.row_begin();
+    for (size_t i = 0; row != src.row_end(); ++row) {
+      for (typename T::const_col_iterator col = row.begin(); col != row.end(); ++col, ++i)
+        image[i] = bins_type::bin(*col);
+    }
 
-    //(col,row)
-    int column=0;
-    int row;
-    unsigned int color;
-	int r = (k-1)/2;
-
-	//rank class
-	RankHist<T_value_type> rk;
-
-	//row/column are now center
-	GetPixel4Border<T> gp(src, border_treatment, k);
-	int ci, ri;
-	int r_p=r;
-	int r_m=-r;
-
-	for(row=0; row<src_nrows; row++){
-      column=0;
-
-      for(color=0; color<rk.histsize; color++){
-        rk.hist[color]=0;
+    // image with border in column major order
+    unsigned short white_bin = bins_type::bin(white(src));
+    std::vector<unsigned short> bins(pcols * prows);
+    std::vector<int> rowmap(prows);
+    for (size_t py = 0; py < prows; ++py)
+      rowmap[py] = RankDetail::border_index(int(py) - r, src_nrows, border_treatment);
+    for (size_t px = 0; px < pcols; ++px) {
+      int x = RankDetail::border_index(int(px) - r, src_ncols, border_treatment);
+      unsigned short* b = &bins[px * prows];
+      for (size_t py = 0; py < prows; ++py) {
+        if (x < 0 || rowmap[py] < 0)
+          b[py] = white_bin;
+        else
+          b[py] = image[rowmap[py] * src_ncols + x];
       }
-      //init hist
-      for(ri=r_m; ri<=r_p; ri++) {
-        for(ci=r_m; ci<=r_p; ci++) {
-          rk.hist[gp(column+ci, row+ri)]++;
-        }
-      }
-
-      //calc median
-      res->set( Point(column,row), T_value_type(rk(rank,k*k)));
-
-      //go right column....
-      for(column=1; column<src_ncols; column++) {
-        for(ci=r_m; ci<=r_p; ci++) {
-          //sub
-          rk.hist[gp(column-1-r,row+ci)]--;
-
-          //add
-          rk.hist[gp(column+r,row+ci)]++;
-        }
+    }
 
-        //calc median
-        res->set( Point(column,row), T_value_type(rk(rank,k*k)));
-      }
-	}
+    std::vector<unsigned short> result(src_ncols * src_nrows);
+    const int strip = std::max(128, 2 * int(k));
+    int nstrips = (src_ncols + strip - 1) / strip;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int s = 0; s < nstrips; ++s) {
+      size_t x0 = s * strip;
+      size_t x1 = std::min(x0 + strip, (size_t)src_ncols);
+      RankDetail::rank_strip(bins, prows, src_nrows, bins_type::bits, k, rank,
+                             x0, x1, result, src_ncols);
+    }
 
+    data_type *res_data = new data_type(src.size(), src.origin());
+    view_type *res= new view_type(*res_data);
+    typename view_type::row_iterator rrow = res->row_begin();
+    for (size_t i = 0; rrow != res->row_end(); ++rrow) {
+      for (typename view_type::col_iterator col = rrow.begin(); col != rrow.end(); ++col, ++i)
+        *col = bins_type::value(result[i]);
+    }
     return res;
   }
 
@@ -451,132 +581,86 @@ namespace Gamera {
 
   //---------------------------
   // kfill
+  //
+  // The conditions are evaluated for 64 window positions at once on a
+  // bit packed copy of the image. The window position (x,y) is the upper
+  // left pixel of the (k-2)x(k-2) core; for each position, the
+  // neighborhood (the border of the k x k window) is counted with bit
+  // sliced counters.
   //---------------------------
+  namespace KfillDetail {
+    struct Window {
+      BitCounter n;      // black neighborhood pixels
+      BitCounter r;      // black neighborhood corners
+      BitCounter t;      // color changes along the neighborhood
+      bitword_t core_any, core_all;
+      BitCounter core;   // black core pixels (only when count_core is set)
+    };
 
-  // count core ON pixel
-  inline unsigned int kfill_count_core_pixel(OneBitImageView *tmp, int x, int y, Point *c_lr) {
-    unsigned int core_pixel = 0;
-    for( unsigned int cy = y ; cy <= c_lr->y() ; cy++ ) {
-      for( unsigned int cx = x ; cx <= c_lr->x() ; cx++ ) {
-        if( (*tmp).get( Point(cx, cy) ) == is_black(tmp)) {
-          core_pixel++;
-        }
+    // nh is a buffer for the 4*(k-1) neighborhood words, which is
+    // allocated once by the caller instead of once per word
+    inline void evaluate(const BitPackedImage& img, int k, long y, long x,
+                         bool count_core, std::vector<bitword_t>& nh, Window& w) {
+      int nnp = 4 * (k - 1);
+      // neighborhood in clockwise order starting at the upper left corner
+      int i = 0;
+      for (int j = 0; j < k - 1; ++j)
+        nh[i++] = img.shifted_word(y - 1, x - 1 + j);
+      for (int j = 0; j < k - 1; ++j)
+        nh[i++] = img.shifted_word(y - 1 + j, x + k - 2);
+      for (int j = 0; j < k - 1; ++j)
+        nh[i++] = img.shifted_word(y + k - 2, x + k - 2 - j);
+      for (int j = 0; j < k - 1; ++j)
+        nh[i++] = img.shifted_word(y + k - 2 - j, x - 1);
+      for (i = 0; i < nnp; ++i) {
+        w.n.add(nh[i]);
+        w.t.add(nh[i] ^ nh[(i + 1) % nnp]);
       }
-    }
-    return core_pixel;
-  }
-  // set all core pixel to given value
-  inline void kfill_set_core_pixel(OneBitImageView *res, int x, int y, Point *c_lr, int v) {
-    for( unsigned int cy = y ; cy <= c_lr->y() ; cy++ ) {
-      for( unsigned int cx = x ; cx <= c_lr->x() ; cx++ ) {
-        (*res).set( Point(cx, cy), v);
-      }
-    }
-  }
-  // get n, r, c
-  void kfill_get_condition_variables(OneBitImageView *tmp, int k, int x, int y, int size_x, int size_y, int *n, int *r, int *c) {
-		
-    // upper left corner of current window
-    int ul_x;
-    int ul_y;
-    // upper right corner of current window
-    int ur_x;
-    int ur_y;
-    // lower left corner of current window
-    int ll_x;
-    int ll_y;
-    // lower right corner of current window
-    int lr_x;
-    int lr_y;
-
-    int nnp = 4*(k-1); // total number of neighborhood pixels
-    int* nh_pixel = new int[nnp]; // array for neighborhood pixel
-    int nh_pixel_count = 0;
-    int corner_pixel_count;
-    int nh_ccs;
-    OneBitPixel pixelvalue;
-		
-    // calculate window borders
-    ul_x = ( x - 1 );
-    ul_y = ( y - 1 );
-    ur_x = ( x + k - 2 );
-    ur_y = ( y - 1 );
-    ll_x = ( x - 1 );
-    ll_y = ( y + k - 2 );
-    lr_x = ( x + k - 2 );
-    lr_y = ( y + k - 2 );
-										
-    // fill array with neighborhood and count neighborhood ON pixel
-    int i = 0;
-    for( int ul_to_ur_np = ul_x ; ul_to_ur_np < ur_x ; ul_to_ur_np++ ) {
-		
-      if(ul_to_ur_np < 0 || y-1 < 0 ) {
-        pixelvalue = 0;
-      } else {
-        pixelvalue = (*tmp).get( Point(ul_to_ur_np, y - 1) );
+      for (i = 0; i < 4; ++i)
+        w.r.add(nh[i * (k - 1)]);
+
+      w.core_any = 0;
+      w.core_all = ~((bitword_t)0);
+      for (int cy = 0; cy < k - 2; ++cy) {
+        for (int cx = 0; cx < k - 2; ++cx) {
+          bitword_t c = img.shifted_word(y + cy, x + cx);
+          w.core_any |= c;
+          w.core_all &= c;
+          if (count_core)
+            w.core.add(c);
+        }
       }
-			
-      nh_pixel[i++] = is_black(pixelvalue);
-      if (is_black(pixelvalue)) { nh_pixel_count++; }
     }
 
-    for( int ur_to_lr_np = ur_y ; ur_to_lr_np < lr_y ; ur_to_lr_np++ ) {
-		
-      if(ur_to_lr_np < 0 || x + k - 2 > size_x - 1 ) {
-        pixelvalue = 0;
-      } else {
-        pixelvalue = (*tmp).get( Point(x + k - 2, ur_to_lr_np) );
-      }
-			
-      nh_pixel[i++] = is_black(pixelvalue);
-      if (is_black(pixelvalue)) { nh_pixel_count++; }
-    }
-		
-    for( int lr_to_ll_np = lr_x ; lr_to_ll_np > ll_x ; lr_to_ll_np-- ) {
-		
-      if( lr_to_ll_np > size_x - 1 || y + k - 2 > size_y - 1 ) {
-        pixelvalue = 0;
-      } else {
-        pixelvalue = (*tmp).get( Point(lr_to_ll_np, y + k - 2) );
-      }
-			
-      nh_pixel[i++] = is_black(pixelvalue);
-      if (is_black(pixelvalue)) { nh_pixel_count++; }
-    }
-			
-    for( int ll_to_ul_np = ll_y ; ll_to_ul_np > ul_y ; ll_to_ul_np-- ) {
-		
-      if(x - 1 < 0 || ll_to_ul_np > size_y - 1 ) {
-        pixelvalue = 0;
-      } else {
-        pixelvalue = (*tmp).get( Point(x - 1, ll_to_ul_np) );
-      }
-			
-      nh_pixel[i++] = is_black(pixelvalue);
-      if (is_black(pixelvalue)) { nh_pixel_count++; }
+    // windows where the core is to be filled with black
+    inline bitword_t on_condition(const Window& w, int k) {
+      // at most one connected component (i.e. two color changes) in the
+      // neighborhood and n > 3k-4 or n == 3k-4 with two black corners
+      return ~w.t.greater(2) &
+        (w.n.greater(3 * k - 4) | (w.n.equal(3 * k - 4) & w.r.equal(2)));
     }
-						
-    // count corner ON pixel
-    corner_pixel_count = nh_pixel[(k-1)*0] + nh_pixel[(k-1)*1] + nh_pixel[(k-1)*2] + nh_pixel[(k-1)*3];
-
-    // get ccs in neighborhood
-    nh_ccs = 0;
-    for(int nhpixel = 0 ; nhpixel < i ; nhpixel++) {
-      nh_ccs += abs( nh_pixel[(nhpixel+1)%nnp] - nh_pixel[nhpixel] );
-    }
-    nh_ccs /= 2;
 
-    *n = nh_pixel_count;
-    *r = corner_pixel_count;
-    *c = nh_ccs;
+    // windows where the core is to be filled with white, i.e. the
+    // on_condition with black and white swapped
+    inline bitword_t off_condition(const Window& w, int k) {
+      return ~w.t.greater(2) &
+        (w.n.less(k) | (w.n.equal(k) & w.r.equal(2)));
+    }
 
-    delete[] nh_pixel;
+    // the window positions x to x+63 that are smaller than end
+    inline bitword_t valid_positions(long x, long end) {
+      if (x + 64 <= end)
+        return ~((bitword_t)0);
+      if (x >= end)
+        return 0;
+      return (((bitword_t)1) << (end - x)) - 1;
+    }
   }
-	
+
   // the actual kfill implementation
   template<class T>
   OneBitImageView * kfill(const T &src, int k, int iterations) {
-		
+    using namespace KfillDetail;
     //
     // create a copy of the original image
     // kfill algorithm sets pixel ON/OFF information in this image
@@ -584,161 +668,94 @@ namespace Gamera {
     OneBitImageData *res_data = new OneBitImageData( src.size(), src.origin() );
     OneBitImageView *res = new OneBitImageView(*res_data);
     image_copy_fill(src, *res);
-		
-    // kfill algorithm reads pixel ON/OFF information from this image
-    OneBitImageData *tmp_data = new OneBitImageData( src.size(), src.origin() );
-    OneBitImageView *tmp = new OneBitImageView(*tmp_data);
-		
-    bool changed; // pixels changed in an iteration
-    int src_size_x = src.ncols(); // source image size x
-    int src_size_y = src.nrows(); // source image size y
-		
-    int x, y; // windows position (upper left core coordinate)
-    Point c_lr; // windows position (lower right core coordinate)
-		
-    int ncp = (k-2)*(k-2); // number of core pixel
-    int core_pixel; // number of ON core pixel
-		
-    int r; // number of pixel in the neighborhood corners
-    int n; // number of neighborhood pixel
-    int c; // number of ccs in neighborhood
-				
+
+    BitPackedImage orig(src);
+    BitPackedImage current(orig);
+    long nrows = src.nrows(), ncols = src.ncols();
+    // window positions with the core inside the image
+    long end_y = nrows - (k - 3), end_x = ncols - (k - 3);
+
+    std::vector<bitword_t> neighborhood(4 * (k - 1));
     while(iterations) {
-			
-      // create a copy from the result image (result of previous iteration or original at first iteration)
-      image_copy_fill(*res, *tmp);
-			
-      // reset changed pixel
-      changed =  false;
-			
-      // move window over the image
-      for(y = 0 ; y < src_size_y - (k-3) ; y++) {
-        for(x = 0 ; x < src_size_x - (k-3) ; x++) {
-					
-          // calculate lower right core coordinate
-          c_lr.x( x + (k - 3) );
-          c_lr.y( y + (k - 3) );
-
-          // count core ON pixel
-          core_pixel = kfill_count_core_pixel(tmp, x, y, &c_lr);
-
-          //
-          // ON filling requires ALL core pixels to be OFF
-          //
-          if(core_pixel == 0) {
-            // get condition variables
-            kfill_get_condition_variables(tmp, k, x, y, src_size_x, src_size_y, &n, &r, &c);
-            // condition check
-            if( (c <= 1) && ( (n > 3*k - 4) || ( (n == 3*k - 4) && (r == 2) ) ) ) {
-              kfill_set_core_pixel(res, x, y, &c_lr, 1);
-              changed = true;
-            }
-          }
-					
-          //
-          // OFF filling requires ALL core pixels to be ON
-          //				
-          if(core_pixel == ncp) {
-            kfill_get_condition_variables(tmp, k, x, y, src_size_x, src_size_y, &n, &r, &c);
-            n = ( 4*(k-1) ) - n;
-            r = 4 - r;
-            // condition check
-            if( (c <= 1) && ( (n > 3*k - 4) || ( (n == 3*k - 4) && (r == 2) ) ) ) {
-              kfill_set_core_pixel(res, x, y, &c_lr, 0);
-              changed = true;
-            }
-          }
-										
-        } // end for x
-      } // end for y
-						
-      if(!changed) {
-        break;
+      BitPackedImage on(nrows, ncols), off(nrows, ncols);
+      bool changed = false; // windows changed in an iteration
+      for (long y = 0; y < end_y; ++y) {
+        for (size_t word = 0; word < current.words_per_row; ++word) {
+          long x = 64 * word;
+          bitword_t valid = valid_positions(x, end_x);
+          if (valid == 0)
+            break;
+          Window w;
+          evaluate(current, k, y, x, false, neighborhood, w);
+          // ON filling requires ALL core pixels to be OFF and vice versa
+          on.row(y)[word] = valid & ~w.core_any & on_condition(w, k);
+          off.row(y)[word] = valid & w.core_all & off_condition(w, k);
+          if (on.row(y)[word] | off.row(y)[word])
+            changed = true;
+        }
       }
-			
+      if (!changed)
+        break;
+
+      // set the cores of the filled windows
+      BitPackedImage on_pixels = bitpacked_spread(on, k - 2);
+      BitPackedImage off_pixels = bitpacked_spread(off, k - 2);
+      for (size_t i = 0; i < current.bits.size(); ++i)
+        current.bits[i] = (current.bits[i] | on_pixels.bits[i]) & ~off_pixels.bits[i];
+
       iterations--;
     } // end while
-		
-    delete tmp->data();
-    delete tmp;
-		
+
+    current.unpack_changes(orig, *res);
     return res;
   }
 
 
   template<class T>
   OneBitImageView * kfill_modified(const T &src, int k) {
+    using namespace KfillDetail;
     /*
-      create a copy of the original image
-      kfill algorithm sets pixel ON/OFF information in this image
+      Each pixel is set by the last window (in row major order) whose
+      core contains it; pixels outside all windows remain white.
     */
     OneBitImageData *res_data = new OneBitImageData( src.size(), src.origin() );
     OneBitImageView *res = new OneBitImageView(*res_data);
-		
-    OneBitImageData *tmp_data = new OneBitImageData( src.size(), src.origin() );
-    OneBitImageView *tmp = new OneBitImageView(*tmp_data);
-    image_copy_fill(src, *tmp);
-		
-    int src_size_x = src.ncols(); // source image size x
-    int src_size_y = src.nrows(); // source image size y
-		
-    int x, y; // windows position (upper left core coordinate)
-    Point c_lr; // windows position (lower right core coordinate)
-		
-    int ncp = (k-2) * (k-2);
-    float ncp_required = ncp / 2.0f; // number of core pixel required -- modified version
-		
-    int core_pixel; // number of ON core pixel
-		
-    int r; // number of pixel in the neighborhood corners
-    int n; // number of neighborhood pixel
-    int c; // number of ccs in neighborhood
-		
-    // move window over the image
-    for(y = 0 ; y < src_size_y - (k-3) ; y++) {
-      for(x = 0 ; x < src_size_x - (k-3) ; x++) {
-        // calculate lower right core coordinate
-        c_lr.x( x + (k - 3) );
-        c_lr.y( y + (k - 3) );
-				
-        // count core ON pixel
-        core_pixel = kfill_count_core_pixel(tmp, x, y, &c_lr);
-				
-        // ON >= (k-2)^2/2 ?
-        if(core_pixel >= ncp_required) {
-					
-          // Examine in the Neighborhood
-          kfill_get_condition_variables(tmp, k, x, y, src_size_x, src_size_y, &n, &r, &c);
-          n = ( 4*(k-1) ) - n;
-          r = 4 - r;
-					
-          // eq. satisfied?
-          if( (c <= 1) && ( (n > 3*k - 4) || ( (n == 3*k - 4) && (r == 2) ) ) ) {
-            kfill_set_core_pixel(res, x, y, &c_lr, 0);
-          } else {
-            kfill_set_core_pixel(res, x, y, &c_lr, 1);
-          }			
-					
-        } else {
-					
-          // Examine in the Neighborhood
-          kfill_get_condition_variables(tmp, k, x, y, src_size_x, src_size_y, &n, &r, &c);
-
-          // eq. satisfied?					
-          if( (c <= 1) && ( (n > 3*k - 4) || ( (n == 3*k - 4) && (r == 2) ) ) ) {
-            kfill_set_core_pixel(res, x, y, &c_lr, 1);
-          } else {
-            kfill_set_core_pixel(res, x, y, &c_lr, 0);
-          }
 
-        }
-								
-      } // end for x
-    } // end for y
-		
-    delete tmp->data();
-    delete tmp;
+    BitPackedImage img(src);
+    long nrows = src.nrows(), ncols = src.ncols();
+    long end_y = nrows - (k - 3), end_x = ncols - (k - 3);
+    if (end_y <= 0 || end_x <= 0)
+      return res;
 
+    int ncp = (k-2) * (k-2);
+    // ON >= (k-2)^2/2 ?
+    size_t majority = (ncp + 1) / 2;
+
+    BitPackedImage decision(nrows, ncols);
+    std::vector<bitword_t> neighborhood(4 * (k - 1));
+    for (long y = 0; y < end_y; ++y) {
+      for (size_t word = 0; word < img.words_per_row; ++word) {
+        long x = 64 * word;
+        bitword_t valid = valid_positions(x, end_x);
+        if (valid == 0)
+          break;
+        Window w;
+        evaluate(img, k, y, x, true, neighborhood, w);
+        bitword_t black_core = w.core.greater(majority - 1);
+        decision.row(y)[word] = valid &
+          ((black_core & ~off_condition(w, k)) | (~black_core & on_condition(w, k)));
+      }
+    }
+
+    OneBitImageView::row_iterator r = res->row_begin();
+    for (long y = 0; r != res->row_end(); ++r, ++y) {
+      long wy = std::min(y, end_y - 1);
+      OneBitImageView::col_iterator c = r.begin();
+      for (long x = 0; c != r.end(); ++c, ++x) {
+        if (decision.get(wy, std::min(x, end_x - 1)))
+          *c = 1;
+      }
+    }
     return res;
   }
 
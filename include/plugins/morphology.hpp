@@ -34,6 +34,7 @@
 // for backward compatibility:
 // mean, rank were formerly defined in the present header file
 #include "misc_filters.hpp"
+#include "bitpacked.hpp"
 
 using namespace std;
 
@@ -308,6 +309,18 @@ namespace Gamera {
     if (src.nrows() < 3 || src.ncols() < 3 || times < 1)
       return simple_image_copy(src);
 
+    // the square kernel is the 3x3 square applied times times, which
+    // is done on a bit packed copy of the image for 64 pixels at once
+    if (!geo) {
+      BitPackedImage packed(src);
+      for (size_t r = 0; r < times; ++r)
+        packed = bitpacked_erode_dilate(packed, direction == 0);
+      OneBitImageData* dest_data = new OneBitImageData(src.size(), src.origin());
+      OneBitImageView* dest = new OneBitImageView(*dest_data);
+      packed.unpack(*dest);
+      return dest;
+    }
+
     OneBitImageData* se_data = new OneBitImageData(Dim(1+2*times,1+2*times));
 	OneBitImageView* se = new OneBitImageView(*se_data);
 	OneBitImageView* result;
@@ -375,45 +388,20 @@ namespace Gamera {
     return max_value;
   }
 
-  template<class T>
-  class All {
-  public:
-    inline T operator() (typename vector<T>::iterator begin,
-			 typename vector<T>::iterator end);
-  };
-
-  template<class T>
-  inline T All<T>::operator() (typename vector<T>::iterator begin,
-			       typename vector<T>::iterator end) {
-    typename vector<T>::iterator middle = begin + 4;
-    for (; begin != end; ++begin)
-      if (begin != middle)
-	if (is_black(*begin))
-	  return *middle;
-    return pixel_traits<T>::white();
-  }
-
   template<class T>
   void despeckle_single_pixel(T &m) {
-    typedef typename ImageFactory<T>::data_type data_type;
-    typedef typename ImageFactory<T>::view_type view_type;
-    data_type* new_data = new data_type(m.size(), m.origin());
-    view_type* new_view = new view_type(*new_data);
-
-    try {
-      All<typename T::value_type> all_op;
-      neighbor9(m, all_op, *new_view);
-      
-      typename T::vec_iterator g = m.vec_begin();
-      typename view_type::vec_iterator h = new_view->vec_begin();
-      for (; g != m.vec_end(); g++, h++)
-	*g = *h;
-    } catch (std::exception e) {
-      delete new_view;
-      delete new_data;
-      throw;
+    // only the isolated black pixels change, so these are found on a
+    // bit packed copy of the image and removed in place
+    BitPackedImage isolated = bitpacked_isolated_pixels(BitPackedImage(m));
+    for (size_t y = 0; y < isolated.nrows; ++y) {
+      const bitword_t* row = isolated.row(y);
+      for (size_t k = 0; k < isolated.words_per_row; ++k) {
+        bitword_t w = row[k];
+        for (size_t i = 0; w != 0; ++i, w >>= 1)
+          if (w & 1)
+            m.set(Point(64 * k + i, y), white(m));
+      }
     }
-    return;
   }
 
   template<class T>
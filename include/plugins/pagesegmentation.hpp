@@ -30,6 +30,7 @@
 #include <algorithm>
 #include <stdexcept>
 #include <functional>
+#include <limits>
 #include "gamera.hpp"
 #include "gameramodule.hpp"
 #include "gamera_limits.hpp"
@@ -66,41 +67,135 @@ int pagesegmentation_median_height(ImageList* ccs) {
 * IN:   Cx - Minimal length of white runs in the rows
 *   Cy - Minimal length of white runs in the columns
 *   Csm- Minimal length of white runs row-wise in the almost final image
+*   ccs - connected components of the image (may be empty)
 *       
 *   If you choose "-1" the algorithm will determine the
 *   median character length in the image to obtain the values for Cx,Cy or 
-*   Csm.
+*   Csm. When ccs is not empty, the median is taken from these CCs instead
+*   of a new connected component analysis.
+*
+*   The smearing works on the black runs of the rows and columns: white
+*   gaps are filled by merging the neighboring runs.
 ******************************************************************************/
+namespace RunListDetail {
+  // a black run from first to second-1
+  typedef std::pair<int, int> Run;
+  typedef std::vector<Run> RunList;
+
+  template<class Iter>
+  void black_runs(Iter begin, Iter end, RunList& runs) {
+    runs.clear();
+    int i = 0, start = -1;
+    for (; begin != end; ++begin, ++i) {
+      if (is_black(*begin)) {
+        if (start < 0)
+          start = i;
+      } else if (start >= 0) {
+        runs.push_back(Run(start, i));
+        start = -1;
+      }
+    }
+    if (start >= 0)
+      runs.push_back(Run(start, i));
+  }
+
+  // fills the white gaps of at most C pixels that are followed by a black
+  // run, i.e. a gap at the beginning is filled, a gap at the end is not
+  inline void smear(RunList& runs, int C) {
+    if (runs.empty())
+      return;
+    if (runs[0].first <= C)
+      runs[0].first = 0;
+    size_t n = 0;
+    for (size_t i = 1; i < runs.size(); ++i) {
+      if (runs[i].first - runs[n].second <= C)
+        runs[n].second = runs[i].second;
+      else
+        runs[++n] = runs[i];
+    }
+    runs.resize(n + 1);
+  }
+
+  // logical AND of two run lists, by merging them from left to right
+  inline void intersect_runs(const RunList& a, const RunList& b, RunList& result) {
+    result.clear();
+    RunList::const_iterator i = a.begin(), j = b.begin();
+    while (i != a.end() && j != b.end()) {
+      int start = std::max(i->first, j->first);
+      int end = std::min(i->second, j->second);
+      if (start < end)
+        result.push_back(Run(start, end));
+      if (i->second < j->second)
+        ++i;
+      else
+        ++j;
+    }
+  }
+
+  inline bool ends_before(const Run& a, const Run& b) {
+    return a.second < b.second;
+  }
+
+  // first run that ends after position a
+  inline RunList::const_iterator first_run_after(const RunList& runs, int a) {
+    return std::upper_bound(runs.begin(), runs.end(), Run(a, a), ends_before);
+  }
+
+  // number of black pixels from a to b (inclusive), counting stops as
+  // soon as limit is exceeded
+  inline int count_black(const RunList& runs, int a, int b, int limit) {
+    int count = 0;
+    for (RunList::const_iterator r = first_run_after(runs, a);
+         r != runs.end() && r->first <= b && count <= limit; ++r)
+      count += std::min(r->second, b + 1) - std::max(r->first, a);
+    return count;
+  }
+
+  // first black pixel from a to b (inclusive), or -1
+  inline int first_black(const RunList& runs, int a, int b) {
+    RunList::const_iterator r = first_run_after(runs, a);
+    if (r != runs.end() && r->first <= b)
+      return std::max(r->first, a);
+    return -1;
+  }
+
+  // last black pixel from a to b (inclusive), or -1
+  inline int last_black(const RunList& runs, int a, int b) {
+    RunList::const_iterator r =
+      std::upper_bound(runs.begin(), runs.end(), Run(b, std::numeric_limits<int>::max()));
+    if (r != runs.begin() && (r - 1)->second > a)
+      return std::min((r - 1)->second - 1, b);
+    return -1;
+  }
+}
+
 template<class T>
-ImageList* runlength_smearing(T &image, int Cx, int Cy, int Csm) {
+ImageList* runlength_smearing(T &image, int Cx, int Cy, int Csm, ImageVector &ccs) {
+    using namespace RunListDetail;
     typedef OneBitImageView view_type;
     typedef OneBitImageData data_type;
-    typedef typename T::value_type value_type;
-
-    data_type* img1_data = new data_type(image.size(), image.origin());
-    view_type* img1 = new view_type(*img1_data);
-    image_copy_fill(image, *img1);
-    
-    data_type* img2_data = new data_type(image.size(), image.origin());
-    view_type* img2 = new view_type(*img2_data);
-    image_copy_fill(image, *img2);
 
-    int Ctemp = 0;
-    size_t nrows = image.nrows();
-    size_t ncols = image.ncols();
+    int nrows = (int)image.nrows();
+    int ncols = (int)image.ncols();
     size_t x, y;
-    value_type black_val = black(image);
-    value_type white_val = white(image);
 
     // when no values given, guess them from the Cc size statistics
     if (Csm <= 0 || Cy <= 0 || Cx <= 0) {
-      ImageList* ccs_temp = cc_analysis(image);
-      int Median = pagesegmentation_median_height(ccs_temp);
+      int Median;
+      if (ccs.empty()) {
+        ImageList* ccs_temp = cc_analysis(image);
+        Median = pagesegmentation_median_height(ccs_temp);
 
-      for (ImageList::iterator i = ccs_temp->begin(); i != ccs_temp->end(); i++) {
-        delete *i;
+        for (ImageList::iterator i = ccs_temp->begin(); i != ccs_temp->end(); i++) {
+          delete *i;
+        }
+        delete ccs_temp;
+      } else {
+        vector<int> ccs_heights;
+        for (ImageVector::iterator i = ccs.begin(); i != ccs.end(); ++i)
+          ccs_heights.push_back(i->first->nrows());
+        Median = median(&ccs_heights);
       }
-      delete ccs_temp;
 
       if (Csm <= 0)
         Csm = 3 * Median;
@@ -110,62 +205,52 @@ ImageList* runlength_smearing(T &image, int Cx, int Cy, int Csm) {
         Cx = 20 * Median;
     }
 
-    // horizontal smearing
-    for (y = 0; y < nrows; ++y) {
-      for (x = 0, Ctemp = 0; x < ncols; ++x) {
-        if (is_white(image.get(Point(x, y)))) {
-          Ctemp += 1;
-        } else {
-          if ((0 != Ctemp) && (Ctemp <= Cx)){
-            for (int z = 0; z < Ctemp; z++) {
-              img1->set(Point(x-z-1, y), black_val);
-            }
-          }
-          Ctemp = 0;
-        }
-      }
-    }
-
     // vertical smearing
-    for (x = 0; x < ncols; ++x) {
-      for (y = 0, Ctemp = 0; y < nrows; ++y) {
-        if (is_white(image.get(Point(x, y)))) {
-          Ctemp += 1;
-        } else {
-          if ((0 != Ctemp) && (Ctemp <= Cy)) {
-            for (int z = 0; z < Ctemp; z++)
-              img2->set(Point(x, y-z-1), black_val);
-          }
-          Ctemp = 0;
-        }
-      }
+    std::vector<RunList> col_runs(ncols);
+    int col;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 16)
+#endif
+    for (col = 0; col < ncols; ++col) {
+      typename T::col_iterator c = image.col_begin() + col;
+      black_runs(c.begin(), c.end(), col_runs[col]);
+      smear(col_runs[col], Cy);
     }
 
-    // logical AND between both images
-    for(y = 0; y < nrows; ++y) {
-      for(x = 0; x < ncols; ++x) {
-        if ((is_black(img1->get(Point(x, y))))
-            && (is_black(img2->get(Point(x, y))))){
-          img1->set(Point(x, y), black_val);
-        } else {
-          img1->set(Point(x, y), white_val);
+    // rows of the vertically smeared image; the columns are appended
+    // from left to right, so that the run lists stay sorted
+    std::vector<RunList> vrow_runs(nrows);
+    for (col = 0; col < ncols; ++col) {
+      for (RunList::iterator i = col_runs[col].begin(); i != col_runs[col].end(); ++i) {
+        for (int r = i->first; r < i->second; ++r) {
+          RunList& runs = vrow_runs[r];
+          if (!runs.empty() && runs.back().second == col)
+            ++runs.back().second;
+          else
+            runs.push_back(Run(col, col + 1));
         }
       }
     }
+    std::vector<RunList>().swap(col_runs);
 
-    // again horizontal smearing for removal of small holes
-    for (y = 0; y < nrows; ++y) {
-      for (x = 0, Ctemp = 0; x < ncols; ++x) {
-        if (is_white(img1->get(Point(x, y)))) {
-          Ctemp += 1;
-        } else {
-          if ((0 != Ctemp) && (Ctemp <= Csm)){
-            for (int z = 0; z < Ctemp; z++)
-              img1->set(Point(x-z-1, y), black_val);
-          }
-          Ctemp = 0;
-        }
-      }
+    // horizontal smearing, logical AND with the vertically smeared
+    // image and again horizontal smearing for removal of small holes
+    data_type* img1_data = new data_type(image.size(), image.origin());
+    view_type* img1 = new view_type(*img1_data);
+    int row;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 16)
+#endif
+    for (row = 0; row < nrows; ++row) {
+      typename T::row_iterator r = image.row_begin() + row;
+      RunList row_runs, and_runs;
+      black_runs(r.begin(), r.end(), row_runs);
+      smear(row_runs, Cx);
+      intersect_runs(row_runs, vrow_runs[row], and_runs);
+      smear(and_runs, Csm);
+      view_type::row_iterator dest = img1->row_begin() + row;
+      for (RunList::iterator i = and_runs.begin(); i != and_runs.end(); ++i)
+        std::fill(dest.begin() + i->first, dest.begin() + i->second, black(*img1));
     }
 
     ImageList* ccs_AND = cc_analysis(*img1);
@@ -214,8 +299,6 @@ ImageList* runlength_smearing(T &image, int Cx, int Cy, int Csm) {
     delete ccs_AND;
     delete img1->data();
     delete img1;
-    delete img2->data();
-    delete img2;
 
     return return_ccs;
 }
@@ -223,232 +306,138 @@ ImageList* runlength_smearing(T &image, int Cx, int Cy, int Csm) {
 
 /*-------------------------------------------------------------------------
  * Functions for projection_cutting:
- * Interne_RXY_Cut(image, Tx, Ty, ccs, noise, label):recursively splits 
- * the image, sets the label and creates the CCs.
- * Start_point(image, ul, lr):search the upper_left point of the sub-image.
- * End_point(image,ul,lr):search the lower_right point of the sub-image.
- * Split_point:searchs the split point of the image
- * rxy_cut(image,Tx,Ty,noise,label):returns the ccs-list
+ * The black runs of all rows and columns are computed once. Bounding
+ * boxes and projections of the sub-images are then obtained from these
+ * run lists without rescanning the pixels.
+ *
+ * XYCutBlock: a sub-image in the recursion
+ * bounding_box(runs, block): shrinks the block to its black pixels
+ * split_points(runs, block, ...): searches the split points of the block
+ * expand(runs, block, ...): splits a block or marks it as leaf
  *-------------------------------------------------------------------------*/
+namespace XYCutDetail {
+  using namespace RunListDetail;
 
+  struct XYCutRuns {
+    std::vector<RunList> rows, cols;
+  };
 
-/* Function: Start_Point
- * This funktion is used to search the first black pixel:
- * calculates the coordinates of the begin of the cc
- * returns the coordinates of the upper-left point of subimage
- */
-
-
-
-template<class T>
-Point proj_cut_Start_Point(T& image, Point ul, Point lr) {
-    Point Start;
-
-    for (size_t y = ul.y(); y <= lr.y(); y++) {
-    for (size_t x = ul.x(); x <= lr.x(); x++) {
-        if ((image.get(Point(x, y))) != 0) {
-            Start.x(x);
-            Start.y(y);
-            goto endLoop1; // unfortunately there is no break(2) in gorgeous C++
-        }
+  struct XYCutBlock {
+    Point ul, lr;
+    char direction;
+    bool leaf;
+    XYCutBlock(Point ul_, Point lr_, char direction_)
+      : ul(ul_), lr(lr_), direction(direction_), leaf(false) {}
+  };
+
+  /* Function: bounding_box
+   * Shrinks ul and lr to the bounding box of the black pixels. An empty
+   * block becomes the single pixel (0,0).
+   */
+  inline void bounding_box(const XYCutRuns& runs, Point& ul, Point& lr) {
+    int x0 = ul.x(), x1 = lr.x();
+    int top = -1, bottom = -1;
+    for (int y = ul.y(); y <= (int)lr.y() && top < 0; ++y)
+      if (first_black(runs.rows[y], x0, x1) >= 0)
+        top = y;
+    if (top < 0) {
+      ul = lr = Point(0, 0);
+      return;
     }
-    } 
-    endLoop1:
-
-    for (size_t x = ul.x(); x <= lr.x(); x++) {
-    for (size_t y = ul.y(); y <= lr.y(); y++) {
-        if ((image.get(Point(x, y))) != 0) {
-            if (Start.x() > x)
-                Start.x(x);
-            goto endLoop2; // unfortunately there is no break(2) in gorgeous C++
-            }
-        }
+    for (int y = lr.y(); y >= top && bottom < 0; --y)
+      if (first_black(runs.rows[y], x0, x1) >= 0)
+        bottom = y;
+    int left = x1, right = x0;
+    for (int y = top; y <= bottom; ++y) {
+      int first = first_black(runs.rows[y], x0, left);
+      if (first >= 0)
+        left = first;
+      int last = last_black(runs.rows[y], right, x1);
+      if (last >= 0)
+        right = last;
     }
-    endLoop2:
-    return Start;
-}
-
-/* Function: End_Point
- * This funktion is used to search the last black pixel:the lower-right point
- * of subimage calculates the coordinates of the end of the CC.
- */
-template<class T>
-Point proj_cut_End_Point(T& image, Point ul, Point lr) {
-    Point End;
-    size_t x, y;
+    ul = Point(left, top);
+    lr = Point(right, bottom);
+  }
 
-    for (y = lr.y(); y+1 >= ul.y()+1; y--) {
-        for (x = lr.x(); x+1 >= ul.x()+1; x--) {
-            if ((image.get(Point(x, y))) != 0) {
-                End.x(x);
-                End.y(y);
-                goto endLoop1;
-            }
+  /* Function: split_points
+   * calculates the coordinates of the split points: the start point,
+   * beginning and end of all gaps of at least Tx (Ty) white columns
+   * (rows) in the projection, and the end point. Rows or columns with at
+   * most noise black pixels are white.
+   */
+  inline void split_points(const XYCutRuns& runs, Point ul, Point lr, int Tx, int Ty,
+                           int noise, int gap_treatment, char direction,
+                           IntVector& points) {
+    const std::vector<RunList>& lines = (direction == 'x') ? runs.rows : runs.cols;
+    int start = (direction == 'x') ? ul.y() : ul.x();
+    int end = (direction == 'x') ? lr.y() : lr.x();
+    int a = (direction == 'x') ? ul.x() : ul.y();
+    int b = (direction == 'x') ? lr.x() : lr.y();
+    int min_gap = (direction == 'x') ? Ty : Tx;
+
+    points.push_back(start);
+    int gap_width = 0;
+    int gap_min = 0, gap_max = 0;
+    for (int i = start + 1; i <= end; ++i) {
+      if (count_black(lines[i], a, b, noise) <= noise) {
+        gap_width++;
+        if (min_gap <= gap_width) {
+          gap_min = i - gap_width + 1;
+          gap_max = i;
         }
-    }
-    endLoop1:
-    
-    for (x = lr.x(); x+1 > ul.x()+1; x--) {
-        for (y = lr.y(); y+1 > ul.y()+1; y--) {
-            if ((image.get(Point(x,y))) != 0){
-                if (End.x()<x)
-                    End.x(x);
-                goto endLoop2;
-            }
+      } else {
+        if (min_gap <= gap_width) {
+          if (0 == gap_treatment) { // cut exactly in the middle of the gap
+            gap_min = gap_max = (gap_min + gap_max) / 2;
+          }
+          points.push_back(gap_min);
+          points.push_back(gap_max);
         }
+        gap_width = 0;
+      }
     }
-    endLoop2:
-
-    return End;
-}
+    points.push_back(end);
+  }
 
-/* Function: Split_Point
- * calculates the coordinates of the split_point.
- * The split point is determined
- * by finding the largest possible gaps in the X and Y projection of the image.
- */
-template<class T>
-IntVector * proj_cut_Split_Point(T& image, Point ul, Point lr, int Tx, int Ty, int noise, int gap_treatment, char direction ) {
-    IntVector * SplitPoints = new IntVector(); //empty IntVector
-    size_t size;
-    lr.x()-ul.x()>lr.y()-ul.y()?size=lr.x()-ul.x():size=lr.y()-ul.y();
-
-    int SplitPoints_Min[size]; // probably no need for such big mem-alloc, but necessary in certain situations
-    int SplitPoints_Max[size]; 
-    int gap_width = 0; // width of the gap
-    int gap_counter = 0; //number of gaps
-
-    if (direction == 'x'){
-        // Correct Points for Rect() with offset
-        Point a( ul.x() + image.offset_x(), ul.y() + image.offset_y() );
-        Point b( lr.x() + image.offset_x(), lr.y() + image.offset_y() );
-        IntVector *proj_x = projection_rows(image, Rect(a, b));
-        SplitPoints->push_back(ul.y()); // starting point
-        
-        for (size_t i = 1; i < proj_x->size(); i++) {
-            if ((*proj_x)[i] <= noise) {
-                gap_width++;
-                if (Ty <= gap_width) {// min-gap <= act-gap?
-                SplitPoints_Min[gap_counter] = (i + ul.y() - gap_width+1);
-                SplitPoints_Max[gap_counter] = (i + ul.y()); // finally set to last point of gap
-                }
-            } 
-            else {
-                if (Ty <= gap_width)
-                    gap_counter++;
-                gap_width = 0;
-            }
-        }
-    delete proj_x;
+  /* Function: expand
+   * Shrinks the block to its bounding box and splits it into the blocks
+   * of the next recursion level, or marks it as leaf when no gap is found
+   * in y-direction.
+   */
+  inline void expand(const XYCutRuns& runs, XYCutBlock& block, int Tx, int Ty,
+                     int noise, int gap_treatment, std::vector<XYCutBlock>& children) {
+    bounding_box(runs, block.ul, block.lr);
+    IntVector points;
+    split_points(runs, block.ul, block.lr, Tx, Ty, noise, gap_treatment,
+                 block.direction, points);
+    if (block.direction == 'y' && points.size() == 2) {
+      block.leaf = true;
+      return;
     }
-    else{ // y-direction
-        // Correct Points for Rect() with offset
-        Point a( ul.x() + image.offset_x(), ul.y() + image.offset_y() );
-        Point b( lr.x() + image.offset_x(), lr.y() + image.offset_y() );
-        IntVector *proj_y = projection_cols(image, Rect(a, b));
-        SplitPoints->push_back(ul.x()); // starting point
-        
-        for (size_t i = 1; i < proj_y->size(); i++) {
-            if ((*proj_y)[i] <= noise) {
-                gap_width++;
-                if (Tx <= gap_width) {// min-gap <= act-gap?
-                SplitPoints_Min[gap_counter] = (i + ul.x() - gap_width+1);
-                SplitPoints_Max[gap_counter] = (i + ul.x()); // finally set to last point of gap
-                }
-            } 
-            else {
-                if (Tx <= gap_width) 
-                    gap_counter++;
-                gap_width = 0;
-            }
-        }
-        delete proj_y;
+    for (size_t i = 0; i + 1 < points.size(); i += 2) {
+      if (block.direction == 'x')
+        children.push_back(XYCutBlock(Point(block.ul.x(), points[i]),
+                                      Point(block.lr.x(), points[i+1]), 'y'));
+      else
+        children.push_back(XYCutBlock(Point(points[i], block.ul.y()),
+                                      Point(points[i+1], block.lr.y()), 'x'));
     }
-    
-    for (int i=0; i<gap_counter; i++){
-        if (0==gap_treatment){ // cut exactly in the middle of the gap -> no unlabeled noise pixels
-            int mid = (SplitPoints_Min[i] + SplitPoints_Max[i]) / 2;
-            SplitPoints_Min[i] = mid;
-            SplitPoints_Max[i] = mid;
-        }
-        SplitPoints->push_back(SplitPoints_Min[i]);
-        SplitPoints->push_back(SplitPoints_Max[i]);
-    }   
-    direction=='x'? SplitPoints->push_back(lr.y()): SplitPoints->push_back(lr.x()); // ending point
-    
-    return SplitPoints;
-}
-
-
-
-/* Function: Interne_RXY_Cut
- * This function recursively splits the image in horizontal or 
- * vertical direction.
- * The original image will have all of its pixels "labeled" with a number
- * representing each connected component.
- */
-template<class T>
-void projection_cutting_intern(T& image, Point ul, Point lr, ImageList* ccs, 
-        int Tx, int Ty, int noise, int gap_treatment, char direction, int& label) {
-    
-    Point Start = proj_cut_Start_Point(image, ul, lr);
-    Point End = proj_cut_End_Point(image, ul, lr);
-    IntVector * SplitPoints = proj_cut_Split_Point(image, Start, End, Tx, Ty, noise, gap_treatment, direction);
-    IntVector::iterator It;
-    
-    ul.x(Start.x());
-    ul.y(Start.y());
-    lr.x(End.x());
-    lr.y(End.y());
-    
-        
-
-    if (!(direction=='y' && SplitPoints->size() == 2)){ // ending condition, SplitPoints==2 => only Start- and Endpoint no gaps
-        if (direction=='x'){
-            direction = 'y';
-            for(It = SplitPoints->begin(); It != SplitPoints->end(); It++){
-                Point begin, end; // note the lowercase of end, which is not End
-                begin.x(Start.x());
-                begin.y(*It);
-                It++;
-                end.x(End.x());
-                end.y(*It);
-                projection_cutting_intern(image, begin, end, ccs, Tx, Ty, noise, gap_treatment, direction, label);
-            }
-        }
-        else { // direction==y
-            direction = 'x';
-            for(It = SplitPoints->begin(); It != SplitPoints->end(); ++It){
-                Point begin, end; // note the lowercase of end, which is not End
-                begin.x(*It);
-                begin.y(Start.y());
-                It++;
-                end.x(*It);
-                end.y(End.y());
-                projection_cutting_intern(image, begin, end, ccs, Tx, Ty, noise, gap_treatment, direction, label);
-            }
-        }
-    } else {
-        label++;
-        for (size_t y = ul.y(); y <= lr.y(); y++) {
-            for (size_t x = ul.x(); x <= lr.x(); x++) {
-                if((image.get(Point(x, y))) != 0){
-                    image.set(Point(x, y), label);
-                }
-            }
-        }
+  }
 
-        Point cc(Start.x() + image.offset_x(), Start.y() + image.offset_y());
-        ccs->push_back(
-                new ConnectedComponent<typename T::data_type>(
-                    *((typename T::data_type*)image.data()),
-                    OneBitPixel(label),
-                    cc,
-                    Dim((End.x() - Start.x() + 1), (End.y() - Start.y() + 1))
-                )
-            );
-    }
-    delete SplitPoints;
+  /* Function: cut
+   * Recursively splits the block and appends the leaves in depth first
+   * order.
+   */
+  inline void cut(const XYCutRuns& runs, XYCutBlock block, int Tx, int Ty,
+                  int noise, int gap_treatment, std::vector<XYCutBlock>& leaves) {
+    std::vector<XYCutBlock> children;
+    expand(runs, block, Tx, Ty, noise, gap_treatment, children);
+    if (block.leaf)
+      leaves.push_back(block);
+    for (size_t i = 0; i < children.size(); ++i)
+      cut(runs, children[i], Tx, Ty, noise, gap_treatment, leaves);
+  }
 }
 
 /*
@@ -458,7 +447,6 @@ void projection_cutting_intern(T& image, Point ul, Point lr, ImageList* ccs,
 template<class T>
 ImageList* projection_cutting(T& image, int Tx, int Ty, int noise, int gap_treatment) {
     int Label = 1;
-    char direction = 'x';
 
     if (noise < 0) {
         noise = 0;
@@ -495,14 +483,88 @@ ImageList* projection_cutting(T& image, int Tx, int Ty, int noise, int gap_treat
             Ty=3;
     }*/
 
-    ImageList* ccs = new ImageList();
-    Point ul, lr;
+    using namespace XYCutDetail;
+    int nrows = (int)image.nrows(), ncols = (int)image.ncols();
+    XYCutRuns runs;
+    runs.rows.resize(nrows);
+    runs.cols.resize(ncols);
+    int i;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 16)
+#endif
+    for (i = 0; i < nrows; ++i) {
+      typename T::row_iterator r = image.row_begin() + i;
+      black_runs(r.begin(), r.end(), runs.rows[i]);
+    }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 16)
+#endif
+    for (i = 0; i < ncols; ++i) {
+      typename T::col_iterator c = image.col_begin() + i;
+      black_runs(c.begin(), c.end(), runs.cols[i]);
+    }
 
-    ul.x(0);
-    ul.y(0);
-    lr.x(image.ncols() - 1);
-    lr.y(image.nrows() - 1);
-    projection_cutting_intern(image, ul, lr, ccs, Tx, Ty, noise, gap_treatment, direction, Label);
+    // expand the first recursion levels until there are enough
+    // independent branches, which are then cut in parallel
+    std::vector<XYCutBlock> blocks;
+    blocks.push_back(XYCutBlock(Point(0, 0), Point(ncols - 1, nrows - 1), 'x'));
+    for (int level = 0; level < 4; ++level) {
+      std::vector<XYCutBlock> next;
+      bool expanded = false;
+      for (size_t b = 0; b < blocks.size(); ++b) {
+        if (blocks[b].leaf) {
+          next.push_back(blocks[b]);
+          continue;
+        }
+        std::vector<XYCutBlock> children;
+        expand(runs, blocks[b], Tx, Ty, noise, gap_treatment, children);
+        if (blocks[b].leaf)
+          next.push_back(blocks[b]);
+        next.insert(next.end(), children.begin(), children.end());
+        expanded = true;
+      }
+      blocks.swap(next);
+      if (!expanded || blocks.size() >= 64)
+        break;
+    }
+
+    int nblocks = (int)blocks.size();
+    std::vector<std::vector<XYCutBlock> > leaves(nblocks);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (i = 0; i < nblocks; ++i) {
+      if (blocks[i].leaf)
+        leaves[i].push_back(blocks[i]);
+      else
+        cut(runs, blocks[i], Tx, Ty, noise, gap_treatment, leaves[i]);
+    }
+
+    // label the pixels and create the CCs
+    ImageList* ccs = new ImageList();
+    for (i = 0; i < nblocks; ++i) {
+      for (size_t j = 0; j < leaves[i].size(); ++j) {
+        Point ul = leaves[i][j].ul, lr = leaves[i][j].lr;
+        Label++;
+        typename T::value_type value = Label;
+        for (size_t y = ul.y(); y <= lr.y(); ++y) {
+          typename T::row_iterator r = image.row_begin() + y;
+          const RunList& row = runs.rows[y];
+          for (RunList::const_iterator run = first_run_after(row, ul.x());
+               run != row.end() && run->first <= (int)lr.x(); ++run)
+            std::fill(r.begin() + std::max(run->first, (int)ul.x()),
+                      r.begin() + std::min(run->second, (int)lr.x() + 1), value);
+        }
+        ccs->push_back(
+                new ConnectedComponent<typename T::data_type>(
+                    *((typename T::data_type*)image.data()),
+                    OneBitPixel(Label),
+                    Point(ul.x() + image.offset_x(), ul.y() + image.offset_y()),
+                    Dim((lr.x() - ul.x() + 1), (lr.y() - ul.y() + 1))
+                )
+            );
+      }
+    }
     
     return ccs;
 }
@@ -22,6 +22,10 @@
 #define kwm02212003_projections
 
 #include "gamera.hpp"
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include <stdio.h>
 
 namespace Gamera {
 
@@ -244,6 +248,140 @@ namespace Gamera {
     }
     return projlist;
   }
+
+  /*
+    Skew estimation from the horizontal projection profiles of the
+    black runs. The projection for an angle is approximated by a shear,
+    where the row offset of each column is computed incrementally in
+    fixed point arithmetic. A sheared run is split into the pieces of
+    constant offset, so that it adds the same counts to the profile as
+    its pixels, but in one step per piece.
+  */
+  namespace SkewDetail {
+    struct Run {
+      int row, start, length;
+    };
+
+    template<class T>
+    void black_runs(const T& image, std::vector<Run>& runs) {
+      typename T::const_row_iterator r = image.row_begin();
+      for (int y = 0; r != image.row_end(); ++r, ++y) {
+        typename T::const_col_iterator c = r.begin();
+        int x = 0, start = -1;
+        for (; c != r.end(); ++c, ++x) {
+          if (is_black(*c)) {
+            if (start < 0)
+              start = x;
+          } else if (start >= 0) {
+            Run run = { y, start, x - start };
+            runs.push_back(run);
+            start = -1;
+          }
+        }
+        if (start >= 0) {
+          Run run = { y, start, x - start };
+          runs.push_back(run);
+        }
+      }
+    }
+
+    // sum of the squared differences between neighboring profile values
+    // of the runs sheared by angle (in degrees), where the profile is
+    // computed for bins of binsize rows; maxoffset must be larger than
+    // the largest shear offset
+    inline double skew_criterion(const std::vector<Run>& runs, size_t nrows,
+                                 size_t ncols, double angle, int maxoffset,
+                                 int binsize) {
+      std::vector<int> offset(ncols), piece_end(ncols);
+      long long step = (long long)floor(tan(angle * M_PI / 180.0) * 65536.0 + 0.5);
+      long long acc = ((long long)maxoffset << 16) + 32768;
+      for (size_t c = 0; c < ncols; ++c, acc += step)
+        offset[c] = (int)(acc >> 16);
+      // piece_end[c] is the first column after c with another offset
+      for (size_t c = ncols; c-- > 0; )
+        piece_end[c] = (c + 1 < ncols && offset[c + 1] == offset[c]) ? piece_end[c + 1] : int(c + 1);
+
+      std::vector<long> profile((nrows + 2 * maxoffset) / binsize + 1, 0);
+      for (std::vector<Run>::const_iterator run = runs.begin(); run != runs.end(); ++run) {
+        int end = run->start + run->length;
+        for (int c = run->start; c < end; c = piece_end[c])
+          profile[(run->row + offset[c]) / binsize] += std::min(piece_end[c], end) - c;
+      }
+
+      double result = 0.0;
+      for (size_t i = 0; i + 1 < profile.size(); ++i) {
+        double d = double(profile[i] - profile[i + 1]);
+        result += d * d;
+      }
+      return result;
+    }
+  }
+
+  template<class T>
+  FloatVector* estimate_skew(const T& image, double minangle, double maxangle,
+                             double accuracy) {
+    if (maxangle <= minangle)
+      throw std::runtime_error("estimate_skew: maxangle must be greater than minangle");
+    if (minangle <= -45.0 || maxangle >= 45.0)
+      throw std::runtime_error("estimate_skew: angles must be between -45 and 45 degrees");
+    if (accuracy <= 0.0)
+      accuracy = 180 * 0.5 / (image.ncols() * M_PI);
+
+    std::vector<SkewDetail::Run> runs;
+    SkewDetail::black_runs(image, runs);
+
+    double maxtan = std::max(fabs(tan(minangle * M_PI / 180.0)),
+                             fabs(tan(maxangle * M_PI / 180.0)));
+    int maxoffset = (int)(maxtan * image.ncols()) + 2;
+
+    // The coarse grid shifts the image ends by a few pixels per step.
+    // On coarse grids, the profile is computed for bins of as many rows,
+    // so that the maximum is not missed between two grid points.
+    double step = atan(4.0 / image.ncols()) * 180.0 / M_PI;
+    step = std::min(step, (maxangle - minangle) / 8);
+    step = std::max(step, (maxangle - minangle) / 400);
+    step = std::max(step, accuracy);
+
+    double lo = minangle, hi = maxangle;
+    double best_angle = 0.0;
+    while (true) {
+      int n = (int)ceil((hi - lo) / step - 1e-9) + 1;
+      int binsize = std::max(1, (int)(tan(step * M_PI / 180.0) * image.ncols() + 0.5));
+      std::vector<double> angles(n), values(n);
+      for (int i = 0; i < n; ++i)
+        angles[i] = std::min(lo + i * step, hi);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+      for (int i = 0; i < n; ++i)
+        values[i] = SkewDetail::skew_criterion(runs, image.nrows(), image.ncols(),
+                                               angles[i], maxoffset, binsize);
+      int best = 0;
+      for (int i = 1; i < n; ++i)
+        if (values[i] > values[best])
+          best = i;
+      best_angle = angles[best];
+
+      if (step <= accuracy)
+        break;
+      lo = std::max(minangle, best_angle - step);
+      hi = std::min(maxangle, best_angle + step);
+      step = std::max(step / 4, accuracy);
+    }
+
+    // like rotation_angle_projections, a maximum on the interval end
+    // (e.g. for an empty image) is not accepted as a skew angle
+    if (best_angle <= minangle || best_angle >= maxangle) {
+      char msg[80];
+      sprintf(msg, "maximum found on interval end %f", best_angle);
+      throw std::runtime_error(msg);
+    }
+
+    FloatVector* result = new FloatVector(2);
+    (*result)[0] = best_angle;
+    (*result)[1] = step;
+    return result;
+  }
 }
 
 #endif
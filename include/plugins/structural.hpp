@@ -23,6 +23,8 @@
 #define mgd11272002_relational
 
 #include "gamera.hpp"
+#include "gameramodule.hpp"
+#include "geostructs/rectgrid.hpp"
 #include <math.h>
 #include <algorithm>
 
@@ -35,6 +37,84 @@ namespace Gamera {
     return b->intersects(a->expand(int_threshold));
   }
 
+  // The area covered by the bounding boxes of the (non-empty list of)
+  // glyphs and their average size, from which the cell size of a
+  // Rectgrid::RectGrid over the glyphs is chosen.
+  inline void glyph_extent(ImageVector& glyphs, Rect* area, double* average_size) {
+    ImageVector::iterator i;
+    *area = *(glyphs.begin()->first);
+    *average_size = 0.0;
+    for (i = glyphs.begin(); i != glyphs.end(); ++i) {
+      Image* image = i->first;
+      *area = Rect(Point(std::min(area->ul_x(), image->ul_x()), std::min(area->ul_y(), image->ul_y())),
+                   Point(std::max(area->lr_x(), image->lr_x()), std::max(area->lr_y(), image->lr_y())));
+      *average_size += std::max(image->ncols(), image->nrows());
+    }
+    *average_size /= glyphs.size();
+  }
+
+  // Returns all index pairs (i,j) with i < j, for which
+  // bounding_box_grouping_function(glyphs[i], glyphs[j], threshold) is
+  // true. Instead of testing all pairs, the bounding boxes are stored in
+  // a uniform grid with a cell size in the order of the glyph size.
+  PyObject* bounding_box_grouping_pairs(ImageVector& glyphs, int threshold) {
+    if (threshold < 0)
+      throw std::runtime_error("Threshold must be a positive number.");
+    size_t int_threshold = size_t(threshold);
+    PyObject* result = PyList_New(0);
+    if (glyphs.empty())
+      return result;
+
+    Rect area;
+    double average_size;
+    glyph_extent(glyphs, &area, &average_size);
+    Rectgrid::RectGrid grid(area, size_t(average_size) + int_threshold + 1);
+    for (ImageVector::iterator i = glyphs.begin(); i != glyphs.end(); ++i)
+      grid.add(*(i->first));
+    Rectgrid::IndexPairVector pairs;
+    grid.neighbor_pairs(int_threshold, &pairs);
+
+    for (Rectgrid::IndexPairVector::iterator p = pairs.begin(); p != pairs.end(); ++p) {
+      PyObject* pair = Py_BuildValue("(ii)", (int)p->first, (int)p->second);
+      PyList_Append(result, pair);
+      Py_DECREF(pair);
+    }
+    return result;
+  }
+
+  // Returns for each point the sorted indices of all glyphs whose
+  // bounding box has a euclidean distance of at most radius to the
+  // point. The bounding boxes are stored once in a uniform grid, so
+  // that each query only visits the grid cells around its point.
+  PyObject* bounding_box_radius_query(ImageVector& glyphs, PointVector* points, double radius) {
+    if (radius < 0)
+      throw std::runtime_error("Radius must be a positive number.");
+    PyObject* result = PyList_New(points->size());
+    if (glyphs.empty()) {
+      for (size_t k = 0; k < points->size(); ++k)
+        PyList_SET_ITEM(result, k, PyList_New(0));
+      return result;
+    }
+
+    Rect area;
+    double average_size;
+    glyph_extent(glyphs, &area, &average_size);
+    Rectgrid::RectGrid grid(area, size_t(average_size) + 1);
+    for (ImageVector::iterator i = glyphs.begin(); i != glyphs.end(); ++i)
+      grid.add(*(i->first));
+
+    Rectgrid::IndexVector found;
+    for (size_t k = 0; k < points->size(); ++k) {
+      const Point& p = (*points)[k];
+      grid.query_radius(FloatPoint(p.x(), p.y()), radius, &found);
+      PyObject* indices = PyList_New(found.size());
+      for (size_t n = 0; n < found.size(); ++n)
+        PyList_SET_ITEM(indices, n, PyInt_FromLong((long)found[n]));
+      PyList_SET_ITEM(result, k, indices);
+    }
+    return result;
+  }
+
   template<class T, class U>
   bool shaped_grouping_function(T& a, U& b, double threshold) {
     if (threshold < 0)
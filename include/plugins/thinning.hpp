@@ -25,6 +25,8 @@
 #include "logical.hpp"
 #include "morphology.hpp"
 #include "image_utilities.hpp"
+#include <vector>
+#include <algorithm>
 
 namespace Gamera {
 
@@ -73,39 +75,128 @@ namespace Gamera {
     }
   }
 
-  template<class T>
-  inline void thin_zs_flag(const T& thin, T& flag, const unsigned char a, const unsigned char b) {
-    register unsigned char p;
-    size_t N, S; 
-    for (size_t y = 0; y < thin.nrows(); ++y) {
-      size_t y_before = (y == 0) ? 1 : y - 1;
-      size_t y_after = (y == thin.nrows() - 1) ? thin.nrows() - 2 : y + 1;
-      for (size_t x = 0; x < thin.ncols(); ++x) {
-	if (is_black(thin.get(Point(x, y)))) {
-	  thin_zs_get(y, y_before, y_after, x, thin, p, N, S);
-	  if ((N <= 6) && (N >= 2) &&
-	      (S == 1) &&
-	      !((p & a) == a) &&
-	      !((p & b) == b))  
-	    flag.set(Point(x, y), black(flag));
-	  else
-	    flag.set(Point(x, y), white(flag));
-	}
+  /* Table driven thinning engine
+
+     All thinning algorithms below delete black pixels depending on
+     their 8-neighborhood only. The neighborhood is encoded in a byte as
+     in thin_zs_get (bit 0 is the pixel above, then clockwise), which
+     indexes a 256-entry deletion table per subiteration.
+
+     Only black pixels with at least one white neighbor can be deleted,
+     so the engine keeps a list of these border pixels and only revisits
+     them and the neighbors of deleted pixels. The border list is kept
+     in row major order and evaluated in parallel stripes with OpenMP.
+  */
+  namespace ThinningDetail {
+    class ThinningGrid {
+    public:
+      int nrows, ncols;
+      // when reflect is set, the neighbors outside the image are taken
+      // from the other side of the pixel (as in thin_zs_get); otherwise
+      // they are white
+      bool reflect;
+      std::vector<unsigned char> pixels;
+      std::vector<int> border;
+      std::vector<unsigned char> mark;
+
+      template<class T>
+      ThinningGrid(const T& image, bool reflect_)
+        : nrows((int)image.nrows()), ncols((int)image.ncols()), reflect(reflect_),
+          pixels(image.nrows() * image.ncols()), mark(pixels.size()) {
+        typename T::const_vec_iterator it = image.vec_begin();
+        for (size_t i = 0; it != image.vec_end(); ++it, ++i)
+          pixels[i] = is_black(*it);
+        for (int i = 0; i < (int)pixels.size(); ++i)
+          if (pixels[i] && code(i) != 0xff)
+            border.push_back(i);
       }
-    }
-  }
-  
-  template<class T>
-  inline bool thin_zs_del_fbp(T& thin, const T& flag) {
-    bool deleted = false;
-    typename T::vec_iterator thin_it = thin.vec_begin();
-    typename T::const_vec_iterator flag_it = flag.vec_begin();
-    for (; thin_it != thin.vec_end(); ++thin_it, ++flag_it)
-      if (is_black(*flag_it) && is_black(*thin_it)) {
-	(*thin_it) = white(thin);
-	deleted = true;
+
+      unsigned char get(int y, int x) const {
+        if (x < 0 || x >= ncols) {
+          if (!reflect)
+            return 0;
+          x = (x < 0) ? 1 : ncols - 2;
+        }
+        if (y < 0 || y >= nrows) {
+          if (!reflect)
+            return 0;
+          y = (y < 0) ? 1 : nrows - 2;
+        }
+        return pixels[y * ncols + x];
+      }
+
+      unsigned char code(int i) const {
+        int y = i / ncols, x = i % ncols;
+        if (y > 0 && y < nrows - 1 && x > 0 && x < ncols - 1) {
+          const unsigned char* p = &pixels[i];
+          return (p[-ncols-1] << 7) | (p[-1] << 6) | (p[ncols-1] << 5) |
+            (p[ncols] << 4) | (p[ncols+1] << 3) | (p[1] << 2) |
+            (p[-ncols+1] << 1) | p[-ncols];
+        }
+        return (get(y-1, x-1) << 7) | (get(y, x-1) << 6) | (get(y+1, x-1) << 5) |
+          (get(y+1, x) << 4) | (get(y+1, x+1) << 3) | (get(y, x+1) << 2) |
+          (get(y-1, x+1) << 1) | get(y-1, x);
       }
-    return deleted;
+
+      // deletes all border pixels whose code is marked in the table at
+      // once and returns whether any pixel has been deleted
+      bool subiteration(const bool* table) {
+        int n = (int)border.size();
+        std::vector<unsigned char> remove(n);
+        int i;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (i = 0; i < n; ++i)
+          remove[i] = table[code(border[i])];
+
+        std::vector<int> deleted;
+        for (i = 0; i < n; ++i) {
+          if (remove[i]) {
+            pixels[border[i]] = 0;
+            deleted.push_back(border[i]);
+          }
+        }
+        if (deleted.empty())
+          return false;
+
+        // the remaining border pixels and the black neighbors of the
+        // deleted pixels form the new border
+        std::vector<int> next;
+        for (i = 0; i < n; ++i) {
+          if (!remove[i]) {
+            mark[border[i]] = 1;
+            next.push_back(border[i]);
+          }
+        }
+        for (size_t d = 0; d < deleted.size(); ++d) {
+          int y = deleted[d] / ncols, x = deleted[d] % ncols;
+          for (int ny = std::max(y - 1, 0); ny <= std::min(y + 1, nrows - 1); ++ny) {
+            for (int nx = std::max(x - 1, 0); nx <= std::min(x + 1, ncols - 1); ++nx) {
+              int j = ny * ncols + nx;
+              if (pixels[j] && !mark[j]) {
+                mark[j] = 1;
+                next.push_back(j);
+              }
+            }
+          }
+        }
+        for (i = 0; i < (int)next.size(); ++i)
+          mark[next[i]] = 0;
+        std::sort(next.begin(), next.end());
+        border.swap(next);
+        return true;
+      }
+
+      // sets the deleted pixels in image to white
+      template<class T>
+      void write_deleted(T& image) const {
+        typename T::vec_iterator it = image.vec_begin();
+        for (size_t i = 0; it != image.vec_end(); ++it, ++i)
+          if (!pixels[i] && is_black(*it))
+            *it = white(image);
+      }
+    };
   }
 
   template<class T>
@@ -120,35 +211,32 @@ namespace Gamera {
     if (in.nrows() == 1 || in.ncols() == 1) {
       return thin_view;
     }
-    
-    data_type* flag_data = 0;
-    view_type* flag_view = 0;
-    try {
-      flag_data = new data_type(in.size(), in.origin());
-      flag_view = new view_type(*flag_data);
-      
-      try {
-	bool deleted = true;
-	bool constant_i = false;
-	while (deleted) {
-	  thin_zs_flag(*thin_view, *flag_view, 
-		       constants[constant_i][0], constants[constant_i][1]);
-	  deleted = thin_zs_del_fbp(*thin_view, *flag_view);
-	  constant_i = !constant_i;
-	}
-      } catch (std::exception e) {
-	delete flag_view;
-	delete flag_data;
-	throw;
+
+    // deletion tables for both subiterations
+    bool table[2][256];
+    for (size_t i = 0; i < 2; ++i) {
+      const unsigned char a = constants[i][0], b = constants[i][1];
+      for (size_t p = 0; p < 256; ++p) {
+        size_t N = 0, S = 0;
+        bool prev = p & (1 << 7);
+        for (size_t bit = 0; bit < 8; ++bit) {
+          if (p & (1 << bit)) {
+            ++N;
+            S += !prev;
+            prev = true;
+          } else
+            prev = false;
+        }
+        table[i][p] = (N <= 6) && (N >= 2) && (S == 1) &&
+          !((p & a) == a) && !((p & b) == b);
       }
-    } catch (std::exception e) {
-      delete thin_data;
-      delete thin_view;
-      throw;
     }
 
-    delete flag_view;
-    delete flag_data;
+    ThinningDetail::ThinningGrid grid(in, true);
+    bool constant_i = false;
+    while (grid.subiteration(table[constant_i]))
+      constant_i = !constant_i;
+    grid.write_deleted(*thin_view);
     return thin_view;
   }
 
@@ -195,116 +283,52 @@ namespace Gamera {
 
   static unsigned char thin_hs_elements[16][3] = {{0x7, 0x2, 0x0}, {0x0, 0x0, 0x7}, {0x2, 0x6, 0x0}, {0x0, 0x1, 0x3}, {0x1, 0x3, 0x1}, {0x4, 0x4, 0x4}, {0x2, 0x3, 0x0}, {0x0, 0x4, 0x6}, {0x4, 0x6, 0x4}, {0x1, 0x1, 0x1}, {0x0, 0x3, 0x2}, {0x6, 0x4, 0x0}, {0x0, 0x2, 0x7}, {0x7, 0x0, 0x0}, {0x0, 0x6, 0x2}, {0x3, 0x1, 0x0}};
 
-  template<class T>
-  inline void thin_hs_diff_image(T& in, const T& other) {
-    typename T::vec_iterator in_it = in.vec_begin();
-    typename T::const_vec_iterator other_it = other.vec_begin();
-    for (; in_it != in.vec_end(); ++in_it, ++other_it) {
-      if (is_black(*in_it) ^ is_black(*other_it)) 
-	*in_it = black(in);
-      else
-	*in_it = white(in);
-    }
-  }
-
-  template<class T>
-  inline bool thin_hs_hit_and_miss(const T& in, T& H_M, 
-				   const size_t& j, const size_t& k) {
-    bool flag;
-
-    /* HIT operation */
-    flag = false;
-    for (size_t r = 1; r < in.nrows() - 1; ++r) {
-      for (size_t c = 1; c < in.ncols() - 1; ++c) {
-	for (size_t l = 0; l < 3; ++l) {
-	  for (size_t m = 0; m < 3; ++m) {
-	    if (is_white(in.get(Point(c + m - 1, r + l - 1)))) {
-	      if (thin_hs_elements[j][l] & (1 << m))
-		goto remove;
-	    } else {
-	      if (thin_hs_elements[k][l] & (1 << m))
-		goto remove;
-	    }
-	  }
-	}
-
-	H_M.set(Point(c, r), black(H_M));
-	flag = true; 
-	continue;
-      remove:
-	H_M.set(Point(c, r), white(H_M));
-      }
-    }
-
-    return flag;
-  }
-
-  template<class T>
-  bool thin_hs_one_pass(T& in, T& H_M) {
-    bool update_flag = false;
-    for (size_t i = 0; i < 8; ++i) {
-      size_t j = i * 2;
-      size_t k = j + 1;
-      if (thin_hs_hit_and_miss(in, H_M, j, k)) {
-	thin_hs_diff_image(in, H_M);
-	update_flag = true;
-      }
-    }
-    return update_flag;
-  }
-
   template<class T>
   typename ImageFactory<T>::view_type* thin_hs(const T& in) {
     typedef typename ImageFactory<T>::data_type data_type;
     typedef typename ImageFactory<T>::view_type view_type;
-    Dim new_size(in.ncols() + 2, in.nrows() + 2);
-    bool upper_left_origin = (in.ul_x() == 0) || (in.ul_y() == 0);
-    Point new_origin;
-    if (upper_left_origin)
-      new_origin = Point(0, 0);
-    else
-      new_origin = Point(in.ul_x() - 1, in.ul_y() - 1);
-    data_type* thin_data = new data_type(new_size, new_origin);
+    data_type* thin_data = new data_type(in.size(), in.origin());
     view_type* thin_view = new view_type(*thin_data);
-    try {
-      for (size_t y = 0; y != in.nrows(); ++y)
-	for (size_t x = 0; x != in.ncols(); ++x)
-	  thin_view->set(Point(x + 1, y + 1), in.get(Point(x, y)));
-      if (in.nrows() == 1 || in.ncols() == 1)
-	goto end;
-      data_type* H_M_data = new data_type(new_size, new_origin);
-      view_type* H_M_view = new view_type(*H_M_data);
-      try {
-	bool not_finished = true;
-	while (not_finished)
-	  not_finished = thin_hs_one_pass(*thin_view, *H_M_view);
-      } catch (std::exception e) {
-	delete H_M_view;
-	delete H_M_data;
-	throw;
+    image_copy_fill(in, *thin_view);
+    if (in.nrows() == 1 || in.ncols() == 1)
+      return thin_view;
+
+    // hit and miss with the structuring element pair (J,K) as deletion
+    // table: the pixels of J must be black and those of K white (the
+    // center belongs to all J, so only black pixels are deleted)
+    static const int code_row[8] = {0, 0, 1, 2, 2, 2, 1, 0};
+    static const int code_col[8] = {1, 2, 2, 2, 1, 0, 0, 0};
+    bool table[8][256];
+    for (size_t i = 0; i < 8; ++i) {
+      const unsigned char* J = thin_hs_elements[i * 2];
+      const unsigned char* K = thin_hs_elements[i * 2 + 1];
+      for (size_t p = 0; p < 256; ++p) {
+        bool hit = true;
+        for (size_t bit = 0; bit < 8; ++bit) {
+          unsigned char mask = 1 << code_col[bit];
+          if (p & (1 << bit)) {
+            if (K[code_row[bit]] & mask)
+              hit = false;
+          } else {
+            if (J[code_row[bit]] & mask)
+              hit = false;
+          }
+        }
+        table[i][p] = hit;
       }
-      delete H_M_view;
-      delete H_M_data;
-    } catch (std::exception e) {
-      delete thin_view;
-      delete thin_data;
-      throw;
     }
-  end:
-    if (upper_left_origin) {
-      data_type* new_data = new data_type(in.size(), in.origin());
-      view_type* new_view = new view_type(*new_data);
-      for (size_t y = 0; y != in.nrows(); ++y)
-	for (size_t x = 0; x != in.ncols(); ++x)
-	  new_view->set(Point(x, y), thin_view->get(Point(x + 1, y + 1)));
-      delete thin_view;
-      delete thin_data;
-      return new_view;
-    } else {
-      delete thin_view;
-      thin_view = new view_type(*thin_data, in);
-      return thin_view;
+
+    // pixels outside the image are white
+    ThinningDetail::ThinningGrid grid(in, false);
+    bool not_finished = true;
+    while (not_finished) {
+      not_finished = false;
+      for (size_t i = 0; i < 8; ++i)
+        if (grid.subiteration(table[i]))
+          not_finished = true;
     }
+    grid.write_deleted(*thin_view);
+    return thin_view;
   }
 
 
@@ -350,7 +374,6 @@ namespace Gamera {
 
   template<class T>
   typename ImageFactory<T>::view_type* thin_lc(const T& in) {
-    typedef typename ImageFactory<T>::data_type data_type;
     typedef typename ImageFactory<T>::view_type view_type;
 
     // Chain to thin_zs
@@ -359,37 +382,17 @@ namespace Gamera {
       return thin_view;
     }
 
-    try {
-      size_t nrows = thin_view->nrows();
-      size_t ncols = thin_view->ncols();
-      typename view_type::vec_iterator it = thin_view->vec_begin();
-      for (size_t y = 0; y < nrows; ++y) {
-	size_t y_before = (y == 0) ? 1 : y - 1;
-	size_t y_after = (y == nrows - 1) ? nrows - 2 : y + 1;
-	for (size_t x = 0; x < ncols; ++x, ++it) {
-	  if (is_black(*it)) {
-	    size_t x_before = (x == 0) ? 1 : x - 1;
-	    size_t x_after = (x == ncols - 1) ? ncols - 2 : x + 1;
-	    
-	    size_t j = ((is_black(thin_view->get(Point(x_after, y_after))) << 3) |
-			(is_black(thin_view->get(Point(x_after, y))) << 2) |
-			(is_black(thin_view->get(Point(x_after, y_before))) << 1) |
-			(is_black(thin_view->get(Point(x, y_before)))));
-	    
-	    size_t i = ((is_black(thin_view->get(Point(x_before, y_before))) << 3) |
-			(is_black(thin_view->get(Point(x_before, y))) << 2) |
-			(is_black(thin_view->get(Point(x_before, y_after))) << 1) |
-			(is_black(thin_view->get(Point(x, y_after)))));
-	    
-	    if (thin_lc_look_up[i] & (1 << j))
-	      *it = white(*thin_view);
-	  }
-	}
+    // a single sequential pass, where the pixel is deleted depending on
+    // the upper and the lower half of its neighborhood code
+    ThinningDetail::ThinningGrid grid(*thin_view, true);
+    for (int i = 0; i < (int)grid.pixels.size(); ++i) {
+      if (grid.pixels[i]) {
+        unsigned char p = grid.code(i);
+        if (thin_lc_look_up[p >> 4] & (1 << (p & 0xf)))
+          grid.pixels[i] = 0;
       }
-    } catch (std::exception e) {
-      delete thin_view->data();
-      delete thin_view;
     }
+    grid.write_deleted(*thin_view);
     return thin_view;
   }
 
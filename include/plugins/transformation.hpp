@@ -37,13 +37,166 @@
 namespace Gamera {
   
 
+  /*
+   * Exact rotation by a multiple of 90 degrees.
+   *
+   * For quarter turns, the image is transposed in square tiles, so that
+   * the rows read from the source and the rows written to the destination
+   * both stay in the cache while a tile is processed.
+   *
+   * src - A view of the source image
+   * quarters - Number of quarter turns (in the same direction as rotate)
+   *
+   */
+  template<class T>
+  typename ImageFactory<T>::view_type* rotate_quarter(const T &src, int quarters)
+  {
+    typedef typename ImageFactory<T>::data_type data_type;
+    typedef typename ImageFactory<T>::view_type view_type;
+    const size_t tile = 64;
+
+    quarters %= 4;
+    if (quarters < 0)
+      quarters += 4;
+    if (quarters == 0)
+      return simple_image_copy(src);
+
+    size_t nrows = src.nrows(), ncols = src.ncols();
+    data_type* dest_data;
+    if (quarters == 2)
+      dest_data = new data_type(src.size());
+    else
+      dest_data = new data_type(Size(src.height(), src.width()));
+    view_type* dest = new view_type(*dest_data);
+
+    if (quarters == 2) {
+      // dest(ncols-1-x, nrows-1-y) = src(x, y)
+      typename T::const_row_iterator sr = src.row_begin();
+      typename view_type::row_iterator dr = dest->row_end();
+      for (; sr != src.row_end(); ++sr) {
+        --dr;
+        typename view_type::col_iterator dc = dr.end();
+        for (typename T::const_col_iterator sc = sr.begin(); sc != sr.end(); ++sc) {
+          --dc;
+          *dc = *sc;
+        }
+      }
+      return dest;
+    }
+
+    for (size_t y0 = 0; y0 < nrows; y0 += tile) {
+      size_t y1 = std::min(y0 + tile, nrows);
+      for (size_t x0 = 0; x0 < ncols; x0 += tile) {
+        size_t x1 = std::min(x0 + tile, ncols);
+        typename T::const_col_iterator scol = src.col_begin() + x0;
+        for (size_t x = x0; x < x1; ++x, ++scol) {
+          typename T::const_row_iterator s = scol.begin() + y0;
+          if (quarters == 1) {
+            // dest(nrows-1-y, x) = src(x, y)
+            typename view_type::col_iterator d =
+              (dest->row_begin() + x).begin() + (nrows - y0);
+            for (size_t y = y0; y < y1; ++y, ++s) {
+              --d;
+              *d = *s;
+            }
+          } else {
+            // dest(y, ncols-1-x) = src(x, y)
+            typename view_type::col_iterator d =
+              (dest->row_begin() + (ncols - 1 - x)).begin() + y0;
+            for (size_t y = y0; y < y1; ++y, ++s, ++d)
+              *d = *s;
+          }
+        }
+      }
+    }
+    return dest;
+  }
+
+  /*
+   * Rotation by three shears (Paeth's method) for angles between -45
+   * and 45 degrees. The shears move whole pixels only, so no new pixel
+   * values are interpolated and the strokes of onebit images stay crisp.
+   * Each shear reads and writes rows sequentially.
+   *
+   * The result has the size given by nrows and ncols, with the rotated
+   * image placed in its center.
+   */
+  template<class T>
+  typename ImageFactory<T>::view_type* rotate_shear(const T &src, double angle,
+                                                    typename T::value_type bgcolor,
+                                                    size_t ncols, size_t nrows)
+  {
+    typedef typename T::value_type value_type;
+    typedef typename ImageFactory<T>::data_type data_type;
+    typedef typename ImageFactory<T>::view_type view_type;
+
+    double rad = (angle / 180.0) * M_PI;
+    double a = -tan(rad / 2.0);
+    double b = sin(rad);
+
+    // the intermediate images must hold the sheared source completely
+    size_t w = std::max(ncols, size_t(src.ncols() + fabs(a) * src.nrows()) + 2);
+    size_t h = std::max(nrows, size_t(src.nrows() + fabs(b) * w) + 2);
+    double cx = (w - 1) / 2.0, cy = (h - 1) / 2.0;
+
+    std::vector<value_type> buf(w * h, bgcolor), tmp(w * h, bgcolor);
+    size_t left = (w - src.ncols()) / 2, top = (h - src.nrows()) / 2;
+    typename T::const_row_iterator sr = src.row_begin();
+    for (size_t y = top; sr != src.row_end(); ++sr, ++y)
+      std::copy(sr.begin(), sr.end(), buf.begin() + y * w + left);
+
+    // first horizontal shear: tmp(x, y) = buf(x - shift(y), y)
+    for (size_t y = 0; y < h; ++y) {
+      long shift = (long)floor(a * (y - cy) + 0.5);
+      typename std::vector<value_type>::iterator i = buf.begin() + y * w;
+      typename std::vector<value_type>::iterator o = tmp.begin() + y * w;
+      if (shift >= (long)w || -shift >= (long)w) {
+        std::fill(o, o + w, bgcolor);
+      } else if (shift >= 0) {
+        std::fill(o, o + shift, bgcolor);
+        std::copy(i, i + (w - shift), o + shift);
+      } else {
+        std::copy(i - shift, i + w, o);
+        std::fill(o + (w + shift), o + w, bgcolor);
+      }
+    }
+
+    // vertical shear: buf(x, y) = tmp(x, y - shift(x))
+    std::vector<long> shift(w);
+    for (size_t x = 0; x < w; ++x)
+      shift[x] = (long)floor(b * (x - cx) + 0.5);
+    for (size_t y = 0; y < h; ++y) {
+      typename std::vector<value_type>::iterator o = buf.begin() + y * w;
+      for (size_t x = 0; x < w; ++x) {
+        long sy = (long)y - shift[x];
+        o[x] = (sy >= 0 && sy < (long)h) ? tmp[sy * w + x] : bgcolor;
+      }
+    }
+
+    // second horizontal shear, written directly into the cropped result
+    data_type* dest_data = new data_type(Size(ncols - 1, nrows - 1));
+    view_type* dest = new view_type(*dest_data);
+    size_t x0 = (w - ncols) / 2, y0 = (h - nrows) / 2;
+    typename view_type::row_iterator dr = dest->row_begin();
+    for (size_t y = y0; dr != dest->row_end(); ++dr, ++y) {
+      long s = (long)floor(a * (y - cy) + 0.5);
+      typename std::vector<value_type>::const_iterator i = buf.begin() + y * w;
+      long x = (long)x0 - s;
+      for (typename view_type::col_iterator dc = dr.begin(); dc != dr.end(); ++dc, ++x)
+        *dc = (x >= 0 && x < (long)w) ? i[x] : bgcolor;
+    }
+    return dest;
+  }
+
   /*
    * Rotate at an arbitrary angle.
    *
-   * This algorithm works by first rotating for 90 degrees, depending whether
-   * height and width are exchanged by rotation or not.
+   * Multiples of 90 degrees are done exactly by rotate_quarter. Otherwise
+   * the image is first rotated by 90 degrees, depending whether height
+   * and width are exchanged by rotation or not.
    * Afterwards VIGRA's rotation algorithm is called, which allows
-   * for different types of interpolation.
+   * for different types of interpolation, or, for order 0, the
+   * remaining angle is done by three shears without interpolation.
    *
    * src - A view of of the source image
    * angle - Degree of rotation
@@ -53,8 +206,8 @@ namespace Gamera {
   template<class T>
   typename ImageFactory<T>::view_type* rotate(const T &src, double angle, typename T::value_type bgcolor, int order)
   {
-    if (order < 1 || order > 3) {
-      throw std::range_error("Order must be between 1 and 3");
+    if (order < 0 || order > 3) {
+      throw std::range_error("Order must be between 0 and 3");
     }
     if (src.nrows()<2 && src.ncols()<2)
       return simple_image_copy(src);
@@ -63,6 +216,9 @@ namespace Gamera {
     while(angle<0.0) angle+=360;
     while(angle>=360.0) angle-=360;
 
+    if (fmod(angle, 90.0) == 0.0)
+      return rotate_quarter(src, int(angle / 90.0));
+
     // some angle ranges flip width and height
     // as VIGRA requires source and destination to be of the same
     // size, it cannot handle a reduce in one image dimension.
@@ -71,15 +227,7 @@ namespace Gamera {
     typename ImageFactory<T>::view_type* prep4vigra = (typename ImageFactory<T>::view_type*) &src;
     if ((45 < angle && angle < 135) ||
         (225 < angle && angle < 315)) {
-      typename ImageFactory<T>::data_type* prep4vigra_data =
-        new typename ImageFactory<T>::data_type(Size(src.height(),src.width()));
-      prep4vigra = new typename ImageFactory<T>::view_type(*prep4vigra_data);
-      size_t ymax = src.nrows() - 1;
-      for (size_t y = 0; y < src.nrows(); ++y) {
-        for (size_t x = 0; x < src.ncols(); ++x) {
-          prep4vigra->set(Point(ymax-y,x), src.get(Point(x,y)));
-        }
-      }
+      prep4vigra = rotate_quarter(src, 1);
       rot90done = true;
       // recompute rotation angle, because partial rotation already done
       angle -= 90.0;
@@ -109,6 +257,42 @@ namespace Gamera {
     if (new_height > prep4vigra->height())
       pad_height = (new_height - prep4vigra->height()) / 2 + 2;
 
+    if (order == 0) {
+      // the shears need an angle between -45 and 45 degrees
+      typename ImageFactory<T>::view_type* half = prep4vigra;
+      if (90 < angle && angle < 270) {
+        half = rotate_quarter(*prep4vigra, 2);
+        angle -= 180.0;
+      } else if (angle >= 270) {
+        angle -= 360.0;
+      }
+      typename ImageFactory<T>::view_type* dest = 0;
+      try {
+        dest = rotate_shear(*half, angle, bgcolor,
+                            prep4vigra->ncols() + 2 * pad_width,
+                            prep4vigra->nrows() + 2 * pad_height);
+      } catch (...) {
+        if (half != prep4vigra) {
+          delete half->data();
+          delete half;
+        }
+        if (rot90done) {
+          delete prep4vigra->data();
+          delete prep4vigra;
+        }
+        throw;
+      }
+      if (half != prep4vigra) {
+        delete half->data();
+        delete half;
+      }
+      if (rot90done) {
+        delete prep4vigra->data();
+        delete prep4vigra;
+      }
+      return dest;
+    }
+
     typename ImageFactory<T>::view_type* tmp =
       pad_image(*prep4vigra, pad_height, pad_width, pad_height, pad_width, bgcolor);
 
@@ -250,26 +434,31 @@ namespace Gamera {
 
   template<class T>
   void mirror_horizontal(T& m) {
-    for (size_t r = 0; r < size_t(m.nrows()) / 2; ++r) {
-      for (size_t c = 0; c < m.ncols(); ++c) {
-	typename T::value_type tmp = m.get(Point(c, r));
-	m.set(Point(c, r), m.get(Point(c, m.nrows() - r - 1)));
-	m.set(Point(c, m.nrows() - r - 1), tmp);
+    typename T::row_iterator top = m.row_begin();
+    typename T::row_iterator bottom = m.row_end();
+    for (size_t r = 0; r < size_t(m.nrows()) / 2; ++r, ++top) {
+      --bottom;
+      typename T::col_iterator t = top.begin(), b = bottom.begin();
+      for (; t != top.end(); ++t, ++b) {
+	typename T::value_type tmp = *t;
+	*t = *b;
+	*b = tmp;
       }
     }
   }
 
   template<class T>
   void mirror_vertical(T& m) {
-    for (size_t r = 0; r < m.nrows(); ++r) {
-      for (size_t c = 0; c < size_t(m.ncols() / 2); ++c) {
-	typename T::value_type tmp = m.get(Point(c, r));
-	m.set(Point(c, r), m.get(Point(m.ncols() - c - 1, r)));
-	m.set(Point(m.ncols() - c - 1, r), tmp);
+    for (typename T::row_iterator row = m.row_begin(); row != m.row_end(); ++row) {
+      typename T::col_iterator left = row.begin(), right = row.end();
+      for (size_t c = 0; c < size_t(m.ncols() / 2); ++c, ++left) {
+	--right;
+	typename T::value_type tmp = *left;
+	*left = *right;
+	*right = tmp;
       }
     }
   }
 
-
 }
 #endif
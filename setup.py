@@ -156,6 +156,12 @@ scripts = [x[command_line_filename_at] for x in command_line_utils] + ['gamera_p
 
 ##########################################
 # generate the plugins
+# plugins with parallel loops use OpenMP when it is enabled
+if has_openmp:
+    gamera_setup.extras['extra_compile_args'] = \
+        gamera_setup.extras.get('extra_compile_args', []) + ['-fopenmp']
+    gamera_setup.extras['extra_link_args'] = \
+        gamera_setup.extras.get('extra_link_args', []) + ['-fopenmp']
 plugin_extensions = []
 plugins = gamera_setup.get_plugin_filenames('gamera/plugins/')
 plugin_extensions = gamera_setup.generate_plugins(
@@ -174,11 +180,18 @@ for entry in eodev_dir:
 graph_files = glob.glob("src/graph/*.cpp") + glob.glob("src/graph/graphmodule/*.cpp")
 kdtree_files = ["src/kdtreemodule.cpp", "src/geostructs/kdtree.cpp"]
 
+# the GA and the kNN leave-one-out run on native threads
+thread_libraries = []
+if sys.platform != 'win32':
+    thread_libraries.append("pthread")
+ga_libraries = ["stdc++"] + thread_libraries
+knncore_extras = dict(gamera_setup.extras)
+knncore_extras['libraries'] = knncore_extras.get('libraries', []) + thread_libraries
 if has_openmp:
     ExtGA = Extension("gamera.knnga",
                       ["src/knngamodule.cpp"] + eodev_files,
                       include_dirs=["include", "src"] + eodev_includes,
-                      libraries=["stdc++"],
+                      libraries=ga_libraries,
                       extra_compile_args=["-Wall", "-fopenmp"],
                       extra_link_args=["-fopenmp"]
                       )
@@ -186,7 +199,7 @@ else:
     ExtGA = Extension("gamera.knnga",
                       ["src/knngamodule.cpp"] + eodev_files,
                       include_dirs=["include", "src"] + eodev_includes,
-                      libraries=["stdc++"],
+                      libraries=ga_libraries,
                       extra_compile_args=["-Wall"]
                       )
 
@@ -212,7 +225,7 @@ extensions = [Extension("gamera.gameracore",
               Extension("gamera.knncore",
                         ["src/knncoremodule.cpp"],
                         include_dirs=["include", "src"],
-                        **gamera_setup.extras
+                        **knncore_extras
                         ),
               ExtGA,
               Extension("gamera.graph", graph_files,
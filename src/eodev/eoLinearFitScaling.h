@@ -77,6 +77,14 @@ public:
 
         // the coefficients for linear scaling
         double denom = pSize*(bestFitness - averageFitness);
+        if (!(denom > 0.0)) {
+            // all fitnesses are equal (e.g. after the population has
+            // converged): the coefficients would not be finite, and the
+            // roulette wheel would select outside of the population
+            for (i=0; i<pSize; i++)
+                value()[i] = 1.0;
+            return;
+        }
         double alpha = (pressure-1)/denom;
         double beta = (bestFitness - pressure*averageFitness)/denom;
 
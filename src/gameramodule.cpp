@@ -45,7 +45,25 @@ extern "C" {
   DL_EXPORT(void) initgameracore(void);
 }
 
+/*
+  The switch for the execution statistics of the plugin wrappers (see
+  plugin_stats.hpp). The plugin modules read it through the CObject
+  _plugin_stats_flag, Python sets it with _set_plugin_stats.
+*/
+static int plugin_stats_flag = 0;
+
+static PyObject* set_plugin_stats(PyObject* self, PyObject* args) {
+  int flag;
+  if (PyArg_ParseTuple(args, CHAR_PTR_CAST "i:_set_plugin_stats", &flag) <= 0)
+    return 0;
+  plugin_stats_flag = flag;
+  Py_INCREF(Py_None);
+  return Py_None;
+}
+
 PyMethodDef gamera_module_methods[] = {
+  { CHAR_PTR_CAST "_set_plugin_stats", set_plugin_stats, METH_VARARGS,
+    CHAR_PTR_CAST "Switches the execution statistics of the plugins (0 = off, 1 = on, 3 = on with trace)" },
   {NULL, NULL },
 };
 
@@ -66,4 +84,8 @@ initgameracore(void) {
   init_ImageType(d);
   init_ImageInfoType(d);
   init_IteratorType(d);
+
+  PyObject* flag = PyCObject_FromVoidPtr(&plugin_stats_flag, NULL);
+  PyDict_SetItemString(d, "_plugin_stats_flag", flag);
+  Py_DECREF(flag);
 }
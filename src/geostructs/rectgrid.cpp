@@ -0,0 +1,117 @@
+//
+// Copyright (C) 2026 Gamera developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+
+#include "geostructs/rectgrid.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <math.h>
+
+
+namespace Gamera { namespace Rectgrid {
+
+RectGrid::RectGrid(const Rect& area, size_t cell_size) {
+  if (cell_size == 0)
+    throw std::runtime_error("RectGrid: cell size must be positive.");
+  this->area = area;
+  this->cell_size = cell_size;
+  cell_ncols = area.ncols() / cell_size + 1;
+  cell_nrows = area.nrows() / cell_size + 1;
+  cells.resize(cell_ncols * cell_nrows);
+  query_number = 0;
+}
+
+// range of cells overlapped by the given region, clipped to the grid
+void RectGrid::cell_range(long ul_x, long ul_y, long lr_x, long lr_y,
+                          size_t* c0, size_t* r0, size_t* c1, size_t* r1) const {
+  long x0 = (ul_x - (long)area.ul_x()) / (long)cell_size;
+  long y0 = (ul_y - (long)area.ul_y()) / (long)cell_size;
+  long x1 = (lr_x - (long)area.ul_x()) / (long)cell_size;
+  long y1 = (lr_y - (long)area.ul_y()) / (long)cell_size;
+  *c0 = (size_t)std::min(std::max(x0, 0l), (long)cell_ncols - 1);
+  *r0 = (size_t)std::min(std::max(y0, 0l), (long)cell_nrows - 1);
+  *c1 = (size_t)std::min(std::max(x1, 0l), (long)cell_ncols - 1);
+  *r1 = (size_t)std::min(std::max(y1, 0l), (long)cell_nrows - 1);
+}
+
+size_t RectGrid::add(const Rect& r) {
+  size_t index = rects.size();
+  size_t c0, r0, c1, r1, c, row;
+  rects.push_back(r);
+  visited.push_back(0);
+  cell_range(r.ul_x(), r.ul_y(), r.lr_x(), r.lr_y(), &c0, &r0, &c1, &r1);
+  for (row = r0; row <= r1; ++row)
+    for (c = c0; c <= c1; ++c)
+      cells[row * cell_ncols + c].push_back(index);
+  return index;
+}
+
+// all rectangles registered in the cells overlapped by the region
+void RectGrid::candidates(long ul_x, long ul_y, long lr_x, long lr_y, IndexVector* result) {
+  size_t c0, r0, c1, r1, c, row;
+  IndexVector::const_iterator it;
+  ++query_number;
+  cell_range(ul_x, ul_y, lr_x, lr_y, &c0, &r0, &c1, &r1);
+  for (row = r0; row <= r1; ++row) {
+    for (c = c0; c <= c1; ++c) {
+      const IndexVector& cell = cells[row * cell_ncols + c];
+      for (it = cell.begin(); it != cell.end(); ++it) {
+        if (visited[*it] != query_number) {
+          visited[*it] = query_number;
+          result->push_back(*it);
+        }
+      }
+    }
+  }
+}
+
+void RectGrid::query_radius(const FloatPoint& p, double radius, IndexVector* result) {
+  IndexVector found;
+  result->clear();
+  if (radius < 0)
+    return;
+  candidates((long)floor(p.x() - radius), (long)floor(p.y() - radius),
+             (long)ceil(p.x() + radius), (long)ceil(p.y() + radius), &found);
+  double radius2 = radius * radius;
+  for (IndexVector::iterator it = found.begin(); it != found.end(); ++it) {
+    const Rect& r = rects[*it];
+    // distance between the point and the closest point of the rectangle
+    double dx = std::max(std::max((double)r.ul_x() - p.x(), p.x() - (double)r.lr_x()), 0.0);
+    double dy = std::max(std::max((double)r.ul_y() - p.y(), p.y() - (double)r.lr_y()), 0.0);
+    if (dx * dx + dy * dy <= radius2)
+      result->push_back(*it);
+  }
+  std::sort(result->begin(), result->end());
+}
+
+void RectGrid::neighbor_pairs(size_t distance, IndexPairVector* result) {
+  IndexVector found;
+  size_t i;
+  result->clear();
+  for (i = 0; i < rects.size(); ++i) {
+    Rect expanded = rects[i].expand(distance);
+    found.clear();
+    candidates(expanded.ul_x(), expanded.ul_y(), expanded.lr_x(), expanded.lr_y(), &found);
+    std::sort(found.begin(), found.end());
+    for (IndexVector::iterator it = found.begin(); it != found.end(); ++it) {
+      if (*it > i && rects[*it].intersects(expanded))
+        result->push_back(std::make_pair(i, *it));
+    }
+  }
+}
+
+}} // end namespace Gamera::Rectgrid
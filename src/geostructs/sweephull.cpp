@@ -0,0 +1,479 @@
+//
+// Copyright (C) 2026 Gamera developers
+//
+// The algorithm follows the radial sweep hull described in
+// D. A. Sinclair: "S-hull: a fast radial sweep-hull routine for
+// Delaunay triangulation." arXiv:1604.01428, 2016
+// with the hull hashing and edge flip bookkeeping popularized by
+// the Delaunator library.
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+
+
+//
+// This data structure is only available in C++
+// For a Delaunay triangulation in Python,
+// use the Gamera plugin delaunay_from_points()
+//
+
+#include "geostructs/sweephull.hpp"
+#include <algorithm>
+#include <limits>
+#include <math.h>
+#include <stdio.h>
+
+//-------------------------------------------------------------------------
+// two dimensional Delaunay triangulation by a radial sweep hull
+//-------------------------------------------------------------------------
+
+namespace Gamera { namespace Delaunaytree {
+
+  // true when r lies to the right of the directed line p->q
+  inline bool sh_orient(double px, double py, double qx, double qy, double rx, double ry) {
+    return (qy - py) * (rx - qx) - (qx - px) * (ry - qy) < 0;
+  }
+
+  // true when r lies strictly between p and q on the line p->q
+  inline bool sh_on_segment(double px, double py, double qx, double qy, double rx, double ry) {
+    return (qy - py) * (rx - qx) - (qx - px) * (ry - qy) == 0 &&
+      (rx - px) * (qx - px) + (ry - py) * (qy - py) > 0 &&
+      (rx - qx) * (px - qx) + (ry - qy) * (py - qy) > 0;
+  }
+
+  // true when p lies inside the circumcircle of the triangle (a,b,c)
+  inline bool sh_incircle(double ax, double ay, double bx, double by,
+                          double cx, double cy, double px, double py) {
+    double dx = ax - px;
+    double dy = ay - py;
+    double ex = bx - px;
+    double ey = by - py;
+    double fx = cx - px;
+    double fy = cy - py;
+    double ap = dx * dx + dy * dy;
+    double bp = ex * ex + ey * ey;
+    double cp = fx * fx + fy * fy;
+    return dx * (ey * cp - bp * fy) - dy * (ex * cp - bp * fx) + ap * (ex * fy - ey * fx) < 0;
+  }
+
+  // squared circumradius of the triangle (a,b,c)
+  inline double sh_circumradius(double ax, double ay, double bx, double by, double cx, double cy) {
+    double dx = bx - ax;
+    double dy = by - ay;
+    double ex = cx - ax;
+    double ey = cy - ay;
+    double bl = dx * dx + dy * dy;
+    double cl = ex * ex + ey * ey;
+    double det = dx * ey - dy * ex;
+    if (det == 0.0)
+      return std::numeric_limits<double>::infinity();
+    double d = 0.5 / det;
+    double x = (ey * bl - dy * cl) * d;
+    double y = (dx * cl - ex * bl) * d;
+    return x * x + y * y;
+  }
+
+  inline void sh_circumcenter(double ax, double ay, double bx, double by,
+                              double cx, double cy, double *x, double *y) {
+    double dx = bx - ax;
+    double dy = by - ay;
+    double ex = cx - ax;
+    double ey = cy - ay;
+    double bl = dx * dx + dy * dy;
+    double cl = ex * ex + ey * ey;
+    double d = 0.5 / (dx * ey - dy * ex);
+    *x = ax + (ey * bl - dy * cl) * d;
+    *y = ay + (dx * cl - ex * bl) * d;
+  }
+
+  // monotone substitute for atan2 in the range [0,1)
+  inline double sh_pseudo_angle(double dx, double dy) {
+    double p = dx / (fabs(dx) + fabs(dy));
+    return (dy > 0 ? 3 - p : 1 + p) / 4;
+  }
+
+  // sort order of the sweep: distance from the seed circumcenter
+  // with ties broken by position, so that duplicates are adjacent
+  class SweepOrder {
+  private:
+    const std::vector<double>& coords;
+    const std::vector<double>& dists;
+  public:
+    SweepOrder(const std::vector<double>& c, const std::vector<double>& d)
+      : coords(c), dists(d) {}
+    bool operator()(int a, int b) const {
+      if (dists[a] != dists[b]) return dists[a] < dists[b];
+      if (coords[2*a] != coords[2*b]) return coords[2*a] < coords[2*b];
+      return coords[2*a+1] < coords[2*b+1];
+    }
+  };
+
+  SweepHull::SweepHull() {
+    this->ntriangles = 0;
+    this->hull_start = -1;
+    this->cx = this->cy = 0.0;
+  }
+
+  size_t SweepHull::numberOfPoints() {
+    return coords.size() / 2;
+  }
+
+  size_t SweepHull::numberOfTriangles() {
+    return ntriangles;
+  }
+
+  const std::vector<int>& SweepHull::getTriangles() {
+    return triangles;
+  }
+
+  const std::vector<int>& SweepHull::getHalfedges() {
+    return halfedges;
+  }
+
+  size_t SweepHull::hashKey(double x, double y) {
+    size_t n = hull_hash.size();
+    return (size_t)floor(sh_pseudo_angle(x - cx, y - cy) * n) % n;
+  }
+
+  void SweepHull::link(int a, int b) {
+    halfedges[a] = b;
+    if (b != -1) halfedges[b] = a;
+  }
+
+  int SweepHull::addTriangle(int i0, int i1, int i2, int a, int b, int c) {
+    int t = (int)(3 * ntriangles);
+    triangles[t] = i0;
+    triangles[t + 1] = i1;
+    triangles[t + 2] = i2;
+    link(t, a);
+    link(t + 1, b);
+    link(t + 2, c);
+    ntriangles++;
+    return t;
+  }
+
+  // restores the Delaunay property by recursive edge flips, starting
+  // with the half edge a of a newly created triangle
+  int SweepHull::legalize(int a) {
+    int ar = 0;
+    edge_stack.clear();
+    while (true) {
+      int b = halfedges[a];
+      int a0 = a - a % 3;
+      ar = a0 + (a + 2) % 3;
+
+      if (b == -1) {
+        if (edge_stack.empty()) break;
+        a = edge_stack.back();
+        edge_stack.pop_back();
+        continue;
+      }
+
+      int b0 = b - b % 3;
+      int al = a0 + (a + 1) % 3;
+      int bl = b0 + (b + 2) % 3;
+      int p0 = triangles[ar];
+      int pr = triangles[a];
+      int pl = triangles[al];
+      int p1 = triangles[bl];
+
+      if (sh_incircle(coords[2*p0], coords[2*p0+1], coords[2*pr], coords[2*pr+1],
+                      coords[2*pl], coords[2*pl+1], coords[2*p1], coords[2*p1+1])) {
+        triangles[a] = p1;
+        triangles[b] = p0;
+        int hbl = halfedges[bl];
+        // the flipped edge lies on the hull: fix the hull triangle reference
+        if (hbl == -1) {
+          int e = hull_start;
+          do {
+            if (hull_tri[e] == bl) {
+              hull_tri[e] = a;
+              break;
+            }
+            e = hull_prev[e];
+          } while (e != hull_start);
+        }
+        link(a, hbl);
+        link(b, halfedges[ar]);
+        link(ar, bl);
+        edge_stack.push_back(b0 + (b + 1) % 3);
+      } else {
+        if (edge_stack.empty()) break;
+        a = edge_stack.back();
+        edge_stack.pop_back();
+      }
+    }
+    return ar;
+  }
+
+  // inserts the point id that lies on a hull edge by splitting the
+  // hull edge and its triangle in two
+  void SweepHull::insertOnHull(int id) {
+    double x = coords[2*id], y = coords[2*id+1];
+    int a = hull_start, b;
+    bool found = false;
+    do {
+      b = hull_next[a];
+      if (sh_on_segment(coords[2*a], coords[2*a+1], coords[2*b], coords[2*b+1], x, y)) {
+        found = true;
+        break;
+      }
+      a = b;
+    } while (a != hull_start);
+    // not on any hull edge either (only possible through rounding)
+    if (!found) return;
+
+    // the triangle (a,b,c) becomes (a,id,c) and (id,b,c)
+    int h = hull_tri[a];
+    int h0 = h - h % 3;
+    int hb = h0 + (h + 1) % 3;
+    int hc = h0 + (h + 2) % 3;
+    int c = triangles[hc];
+    int obc = halfedges[hb];
+    triangles[hb] = id;
+    int t = addTriangle(id, b, c, -1, obc, hb);
+    if (obc == -1)
+      hull_tri[b] = t + 1;
+
+    hull_next[a] = id;
+    hull_prev[id] = a;
+    hull_next[id] = b;
+    hull_prev[b] = id;
+    hull_tri[id] = t;
+    hull_hash[hashKey(x, y)] = id;
+
+    legalize(hc);
+    legalize(t + 1);
+  }
+
+  void SweepHull::triangulate(const std::vector<double>& points) {
+    if (points.size() % 2 != 0) {
+      throw std::runtime_error("Point coordinates must be given as x,y pairs.");
+    }
+    size_t n = points.size() / 2;
+    if (n < 3) {
+      throw std::runtime_error("At least three points are required.");
+    }
+    size_t i, k;
+    for (i = 0; i < points.size(); ++i) {
+      // NaN fails every comparison, infinity the bound
+      if (!(fabs(points[i]) <= std::numeric_limits<double>::max())) {
+        char msg[64];
+        sprintf(msg, "point %d has a coordinate that is not finite", (int)(i / 2));
+        throw std::runtime_error(msg);
+      }
+    }
+    coords = points;
+
+    // seed triangle: the point closest to the bounding box center,
+    // its nearest neighbor, and the point with the smallest circumcircle
+    double minx = coords[0], maxx = coords[0];
+    double miny = coords[1], maxy = coords[1];
+    for (i = 1; i < n; ++i) {
+      double x = coords[2*i], y = coords[2*i+1];
+      if (x < minx) minx = x;
+      if (x > maxx) maxx = x;
+      if (y < miny) miny = y;
+      if (y > maxy) maxy = y;
+    }
+    double bcx = (minx + maxx) / 2;
+    double bcy = (miny + maxy) / 2;
+    double mind = std::numeric_limits<double>::infinity();
+    int i0 = 0, i1 = -1, i2 = -1;
+    for (i = 0; i < n; ++i) {
+      double dx = coords[2*i] - bcx, dy = coords[2*i+1] - bcy;
+      double d = dx * dx + dy * dy;
+      if (d < mind) {
+        i0 = (int)i;
+        mind = d;
+      }
+    }
+    double i0x = coords[2*i0], i0y = coords[2*i0+1];
+    mind = std::numeric_limits<double>::infinity();
+    for (i = 0; i < n; ++i) {
+      double dx = coords[2*i] - i0x, dy = coords[2*i+1] - i0y;
+      double d = dx * dx + dy * dy;
+      if ((int)i != i0 && d > 0 && d < mind) {
+        i1 = (int)i;
+        mind = d;
+      }
+    }
+    if (i1 == -1) {
+      throw std::runtime_error("all points are collinear");
+    }
+    double i1x = coords[2*i1], i1y = coords[2*i1+1];
+    double minr = std::numeric_limits<double>::infinity();
+    for (i = 0; i < n; ++i) {
+      if ((int)i == i0 || (int)i == i1) continue;
+      double r = sh_circumradius(i0x, i0y, i1x, i1y, coords[2*i], coords[2*i+1]);
+      if (r < minr) {
+        i2 = (int)i;
+        minr = r;
+      }
+    }
+    if (i2 == -1 || minr == std::numeric_limits<double>::infinity()) {
+      throw std::runtime_error("all points are collinear");
+    }
+    double i2x = coords[2*i2], i2y = coords[2*i2+1];
+    if (sh_orient(i0x, i0y, i1x, i1y, i2x, i2y)) {
+      std::swap(i1, i2);
+      std::swap(i1x, i2x);
+      std::swap(i1y, i2y);
+    }
+    sh_circumcenter(i0x, i0y, i1x, i1y, i2x, i2y, &cx, &cy);
+
+    // sort all points by distance from the seed circumcenter
+    std::vector<double> dists(n);
+    std::vector<int> ids(n);
+    for (i = 0; i < n; ++i) {
+      double dx = coords[2*i] - cx, dy = coords[2*i+1] - cy;
+      dists[i] = dx * dx + dy * dy;
+      ids[i] = (int)i;
+    }
+    std::sort(ids.begin(), ids.end(), SweepOrder(coords, dists));
+
+    // a planar triangulation has at most 2n-5 triangles
+    size_t max_triangles = 2 * n - 5;
+    triangles.assign(3 * max_triangles, -1);
+    halfedges.assign(3 * max_triangles, -1);
+    ntriangles = 0;
+
+    size_t hash_size = (size_t)ceil(sqrt((double)n));
+    hull_prev.assign(n, -1);
+    hull_next.assign(n, -1);
+    hull_tri.assign(n, -1);
+    hull_hash.assign(hash_size, -1);
+
+    hull_start = i0;
+    hull_next[i0] = hull_prev[i2] = i1;
+    hull_next[i1] = hull_prev[i0] = i2;
+    hull_next[i2] = hull_prev[i1] = i0;
+    hull_tri[i0] = 0;
+    hull_tri[i1] = 1;
+    hull_tri[i2] = 2;
+    hull_hash[hashKey(i0x, i0y)] = i0;
+    hull_hash[hashKey(i1x, i1y)] = i1;
+    hull_hash[hashKey(i2x, i2y)] = i2;
+
+    addTriangle(i0, i1, i2, -1, -1, -1);
+
+    double xp = 0, yp = 0;
+    for (k = 0; k < n; ++k) {
+      int id = ids[k];
+      double x = coords[2*id], y = coords[2*id+1];
+
+      // duplicate points are adjacent in the sweep order
+      if (k > 0 && x == xp && y == yp) {
+        char msg[64];
+        sprintf(msg, "point (%.1f,%.1f) is already inserted", x, y);
+        throw std::runtime_error(msg);
+      }
+      xp = x;
+      yp = y;
+      if (id == i0 || id == i1 || id == i2) continue;
+
+      // find a visible edge on the convex hull using the angular hash
+      int start = 0;
+      size_t key = hashKey(x, y);
+      for (size_t j = 0; j < hash_size; ++j) {
+        start = hull_hash[(key + j) % hash_size];
+        if (start != -1 && start != hull_next[start]) break;
+      }
+      start = hull_prev[start];
+      int e = start, q;
+      while (q = hull_next[e], !sh_orient(x, y, coords[2*e], coords[2*e+1], coords[2*q], coords[2*q+1])) {
+        e = q;
+        if (e == start) {
+          e = -1;
+          break;
+        }
+      }
+      // no hull edge is visible: the point lies on the hull
+      if (e == -1) {
+        insertOnHull(id);
+        continue;
+      }
+
+      // add the first triangle from the point
+      int t = addTriangle(e, id, hull_next[e], -1, -1, hull_tri[e]);
+      hull_tri[id] = legalize(t + 2);
+      hull_tri[e] = t;
+
+      // walk forward through the hull, adding more triangles and flipping
+      int nx = hull_next[e];
+      while (q = hull_next[nx], sh_orient(x, y, coords[2*nx], coords[2*nx+1], coords[2*q], coords[2*q+1])) {
+        t = addTriangle(nx, id, q, hull_tri[id], -1, hull_tri[nx]);
+        hull_tri[id] = legalize(t + 2);
+        hull_next[nx] = nx; // mark as removed
+        nx = q;
+      }
+
+      // walk backward from the other side
+      if (e == start) {
+        while (q = hull_prev[e], sh_orient(x, y, coords[2*q], coords[2*q+1], coords[2*e], coords[2*e+1])) {
+          t = addTriangle(q, id, e, -1, hull_tri[e], hull_tri[q]);
+          legalize(t + 2);
+          hull_tri[q] = t;
+          hull_next[e] = e; // mark as removed
+          e = q;
+        }
+      }
+
+      // update the hull
+      hull_start = hull_prev[id] = e;
+      hull_next[e] = hull_prev[nx] = id;
+      hull_next[id] = nx;
+      hull_hash[hashKey(x, y)] = id;
+      hull_hash[hashKey(coords[2*e], coords[2*e+1])] = e;
+    }
+
+    triangles.resize(3 * ntriangles);
+    halfedges.resize(3 * ntriangles);
+    // the hull is only needed during the construction
+    std::vector<int>().swap(hull_prev);
+    std::vector<int>().swap(hull_next);
+    std::vector<int>().swap(hull_tri);
+    std::vector<int>().swap(hull_hash);
+  }
+
+  void SweepHull::neighborAdjacency(std::vector<int> *offsets, std::vector<int> *neighbors) {
+    size_t n = numberOfPoints();
+    size_t e, nedges = triangles.size();
+    offsets->assign(n + 1, 0);
+    // each edge is visited once from the half edge with the larger index
+    for (e = 0; e < nedges; ++e) {
+      if ((int)e > halfedges[e]) {
+        int a = triangles[e];
+        int b = triangles[e - e % 3 + (e + 1) % 3];
+        (*offsets)[a + 1]++;
+        (*offsets)[b + 1]++;
+      }
+    }
+    for (e = 0; e < n; ++e) {
+      (*offsets)[e + 1] += (*offsets)[e];
+    }
+    neighbors->resize((*offsets)[n]);
+    std::vector<int> fill(offsets->begin(), offsets->end() - 1);
+    for (e = 0; e < nedges; ++e) {
+      if ((int)e > halfedges[e]) {
+        int a = triangles[e];
+        int b = triangles[e - e % 3 + (e + 1) % 3];
+        (*neighbors)[fill[a]++] = b;
+        (*neighbors)[fill[b]++] = a;
+      }
+    }
+  }
+
+}} // end namespace Gamera::Delaunaytree
@@ -27,7 +27,10 @@ namespace Gamera { namespace GraphApi {
    
    
 // -----------------------------------------------------------------------------
-Graph::Graph(bool directed, bool check_on_insert) {
+Graph::Graph(bool directed, bool check_on_insert)
+   : _nodes(NodeVector::allocator_type(&_pool)),
+     _edges(EdgeVector::allocator_type(&_pool)),
+     _valuemap(GraphDataPtrLessCompare(), ValueNodeMap::allocator_type(&_pool)) {
    _flags = FLAG_FREE; //flag free as default flags
    if(directed)
       GRAPH_SET_FLAG(this, FLAG_DIRECTED);
@@ -46,7 +49,10 @@ Graph::Graph(bool directed, bool check_on_insert) {
 
 
 // -----------------------------------------------------------------------------
-Graph::Graph(flag_t flags) {
+Graph::Graph(flag_t flags)
+   : _nodes(NodeVector::allocator_type(&_pool)),
+     _edges(EdgeVector::allocator_type(&_pool)),
+     _valuemap(GraphDataPtrLessCompare(), ValueNodeMap::allocator_type(&_pool)) {
    if(flags == FLAG_TREE) {
       UNSET_FLAG(flags, FLAG_DIRECTED);
       UNSET_FLAG(flags, FLAG_CYCLIC);
@@ -101,7 +107,10 @@ Graph::~Graph() {
 /**
   * copies the whole graph as a deep copy
   */
-Graph::Graph(Graph &g) {
+Graph::Graph(Graph &g)
+   : _nodes(NodeVector::allocator_type(&_pool)),
+     _edges(EdgeVector::allocator_type(&_pool)),
+     _valuemap(GraphDataPtrLessCompare(), ValueNodeMap::allocator_type(&_pool)) {
    _colors = NULL;
    _colorhistogram = NULL;
    _flags = g._flags;
@@ -123,7 +132,10 @@ Graph::Graph(Graph &g) {
 
 
 // -----------------------------------------------------------------------------
-Graph::Graph(Graph* g, flag_t flags) {
+Graph::Graph(Graph* g, flag_t flags)
+   : _nodes(NodeVector::allocator_type(&_pool)),
+     _edges(EdgeVector::allocator_type(&_pool)),
+     _valuemap(GraphDataPtrLessCompare(), ValueNodeMap::allocator_type(&_pool)) {
    _colors = NULL;
    _colorhistogram = NULL;
    _flags = flags;
@@ -179,7 +191,7 @@ bool Graph::has_node(GraphData * value) {
   * a new node is created and added using add_node
   */
 bool Graph::add_node(GraphData * value) {
-   Node* toadd = new Node(value);
+   Node* toadd = new(&_pool) Node(value, this);
    if(add_node(toadd) == false) {
       delete toadd;
       return false;
@@ -216,7 +228,7 @@ bool Graph::add_node(Node* node) {
 Node* Graph::add_node_ptr(GraphData * value) {
    Node* n = get_node(value);
    if(n == NULL) {
-      n = new Node(value);
+      n = new(&_pool) Node(value, this);
       if(add_node(n) == false) {
          delete n;
          n = NULL;
@@ -355,7 +367,7 @@ int Graph::add_edge(Node* from_node, Node* to_node, cost_t cost,
    
    if(GRAPH_HAS_FLAG(this, FLAG_DIRECTED) && !directed) {
       directed = true;
-      f = new Edge(to_node, from_node, cost, true, label);
+      f = new(&_pool) Edge(to_node, from_node, cost, true, label);
       _edges.push_back(f);
       if(GRAPH_HAS_FLAG(this, FLAG_CHECK_ON_INSERT) && 
             !conforms_restrictions()) {
@@ -366,7 +378,7 @@ int Graph::add_edge(Node* from_node, Node* to_node, cost_t cost,
          count++;
    }
 
-   e = new Edge(from_node, to_node, cost, directed, label);
+   e = new(&_pool) Edge(from_node, to_node, cost, directed, label);
    _edges.push_back(e);
 
    if(GRAPH_HAS_FLAG(this, FLAG_CHECK_ON_INSERT) && 
@@ -61,6 +61,7 @@ extern "C" {
    static PyObject* graph_get_nodes(PyObject* self, PyObject* _);
    static PyObject* graph_has_node(PyObject* self, PyObject* node);
    static PyObject* graph_get_nnodes(PyObject* self, PyObject* _);
+   static PyObject* graph_get_pool_chunks(PyObject* self, PyObject* _);
    static PyObject* graph_get_edges(PyObject* self, PyObject* _);
    static PyObject* graph_has_edge(PyObject* self, PyObject* args);
    static PyObject* graph_get_nedges(PyObject* self, PyObject* _);
@@ -331,6 +332,8 @@ PyGetSetDef graph_getset[] = {
     CHAR_PTR_CAST "Number of edges in the graph", 0 },
   { CHAR_PTR_CAST "nsubgraphs", (getter)graph_get_nsubgraphs, 0,
     CHAR_PTR_CAST "Number of edges in the graph", 0 },
+  { CHAR_PTR_CAST "_pool_chunks", (getter)graph_get_pool_chunks, 0,
+    CHAR_PTR_CAST "(used, allocated) chunks of the graph's memory pool", 0 },
   { NULL }
 };
 
@@ -929,6 +932,15 @@ PyObject* graph_get_nnodes(PyObject* self, PyObject* _) {
 
 
 
+// -----------------------------------------------------------------------------  
+PyObject* graph_get_pool_chunks(PyObject* self, PyObject* _) {
+   INIT_SELF_GRAPH();
+   return Py_BuildValue(CHAR_PTR_CAST "(ll)", (long)so->_graph->_pool.get_nused(),
+         (long)so->_graph->_pool.get_nchunks());
+}
+
+
+
 // -----------------------------------------------------------------------------  
 PyObject* graph_get_edges(PyObject* self, PyObject* _) {
    INIT_SELF_GRAPH();
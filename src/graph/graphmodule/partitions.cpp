@@ -42,6 +42,7 @@ typedef unsigned long long Bitfield;
 
 extern "C" {
    PyObject* graph_optimize_partitions(PyObject* self, PyObject* args);
+   PyObject* graph_partition_parts(PyObject* self, PyObject* args);
 }
 
 
@@ -56,6 +57,13 @@ protected:
    std::set<Node*> _visited2;
    std::map<Node*,unsigned long> _number;
 
+   // The score of a part is either computed by calling the Python
+   // evaluation function, or it is taken from a sequence of scores
+   // precomputed for the parts as returned by partition_parts.
+   // When _collected is set, the parts are only collected.
+   PyObject* _scores;
+   PyObject* _collected;
+
    void visit1(Node* n) {
       _visited1.insert(n);
    }
@@ -235,20 +243,28 @@ protected:
          PyList_SET_ITEM(result, j, dynamic_cast<GraphDataPyObject*>((*i)->_value)->data);
       }
 
-      PyObject* tuple = Py_BuildValue(CHAR_PTR_CAST "(O)", result);
-      PyObject* evalobject = PyObject_CallObject(const_cast<PyObject*>(eval_func), tuple);
-      Py_DECREF(tuple);
-      Py_DECREF(result);
-
-      double eval;
-      if (evalobject == NULL)
-         eval = -1.0;
-      else {
-         if (PyFloat_Check(evalobject))
-            eval = PyFloat_AsDouble(evalobject);
-         else
-            eval = -1.0;
-         Py_DECREF(evalobject);
+      double eval = -1.0;
+      if (_collected != NULL) {
+         PyList_Append(_collected, result);
+         Py_DECREF(result);
+      } else if (_scores != NULL) {
+         Py_DECREF(result);
+         if (parts.size() < (size_t)PySequence_Fast_GET_SIZE(_scores)) {
+            PyObject* score = PySequence_Fast_GET_ITEM(_scores, parts.size());
+            if (PyFloat_Check(score))
+               eval = PyFloat_AsDouble(score);
+         }
+      } else {
+         PyObject* tuple = Py_BuildValue(CHAR_PTR_CAST "(O)", result);
+         PyObject* evalobject = PyObject_CallObject(const_cast<PyObject*>(eval_func), tuple);
+         Py_DECREF(tuple);
+         Py_DECREF(result);
+
+         if (evalobject != NULL) {
+            if (PyFloat_Check(evalobject))
+               eval = PyFloat_AsDouble(evalobject);
+            Py_DECREF(evalobject);
+         }
       }
 
       parts.push_back(Part(bits, eval));
@@ -350,6 +366,45 @@ protected:
 
 
 public:
+   Partitions() : _scores(NULL), _collected(NULL) {}
+
+   // scores must be a PySequence_Fast object holding one score per part
+   void set_scores(PyObject* scores) {
+      _scores = scores;
+   }
+
+   // --------------------------------------------------------------------------
+   // Returns the list of all parts that optimize_partitions evaluates for
+   // the subgraph at root, in the order in which they are evaluated.
+   // For subgraphs that are not optimized, the list is empty.
+   PyObject* partition_parts(Node* root, const size_t max_parts_per_group,
+                             const size_t max_graph_size) {
+      _visited2.clear();
+      _visited1.clear();
+      PyObject* result = PyList_New(0);
+
+      std::vector<Node*> subgraph;
+      root = graph_optimize_partitions_find_root(root, subgraph);
+      size_t size = subgraph.size();
+      if (size > BITFIELD_SIZE - 2 || size > max_graph_size || size == 1)
+         return result;
+
+      subgraph.clear();
+      graph_optimize_partitions_number_parts(root, subgraph);
+      Parts parts;
+      std::vector<Node*> node_stack;
+      node_stack.reserve(max_parts_per_group);
+      _collected = result;
+      for (std::vector<Node*>::iterator i = subgraph.begin();
+            i != subgraph.end(); ++i) {
+         Bitfield bits = 0;
+         graph_optimize_partitions_evaluate_parts(*i, max_parts_per_group,
+               size, node_stack, bits, NULL, parts);
+      }
+      _collected = NULL;
+      return result;
+   }
+
    // --------------------------------------------------------------------------
    PyObject* optimize_partitions(const GraphObject* so, Node* root,
                                        const PyObject* eval_func, 
@@ -402,6 +457,14 @@ public:
                graph_optimize_partitions_evaluate_parts(*i, max_parts_per_group, 
                      size, node_stack, bits, eval_func, parts);
             }
+            // the scores are taken by position, so they must belong to
+            // exactly the parts returned by partition_parts
+            if (_scores != NULL &&
+                parts.size() != (size_t)PySequence_Fast_GET_SIZE(_scores)) {
+               PyErr_SetString(PyExc_ValueError,
+                  "optimize_partitions: the number of scores does not match the number of parts returned by partition_parts");
+               return NULL;
+            }
 
             // Build the skip list
             graph_optimize_partitions_find_skips(parts);
@@ -490,10 +553,44 @@ PyObject* graph_optimize_partitions(PyObject* self, PyObject* args) {
       return 0;
 
    Partitions p;
+   PyObject* scores = NULL;
+   if (!PyCallable_Check(eval_func)) {
+      scores = PySequence_Fast(eval_func, "fitness_func must be callable or a sequence of scores");
+      if (scores == NULL)
+         return 0;
+      p.set_scores(scores);
+   }
    PyObject* result = p.optimize_partitions(so, root, eval_func, 
          max_parts_per_group, max_graph_size, criterion);
+   Py_XDECREF(scores);
 
-   assert(result != NULL);
+   assert(result != NULL || scores != NULL);
    return result;
 }
 
+
+
+// -----------------------------------------------------------------------------
+PyObject* graph_partition_parts(PyObject* self, PyObject* args) {
+   GraphObject* so = ((GraphObject*)self);
+   PyObject* a;
+   int max_parts_per_group = 5;
+   int max_graph_size = 16;
+   if (PyArg_ParseTuple(args, CHAR_PTR_CAST "O|ii:partition_parts", &a,
+            &max_parts_per_group, &max_graph_size) <= 0)
+      return 0;
+
+   Node* root;
+   if(is_NodeObject(a))
+      root = so->_graph->get_node(((NodeObject*)a)->_node->_value);
+   else {
+      GraphDataPyObject obj(a);
+      root = so->_graph->get_node(&obj);
+   }
+   if (root == NULL)
+      return 0;
+
+   Partitions p;
+   return p.partition_parts(root, max_parts_per_group, max_graph_size);
+}
+
@@ -30,6 +30,7 @@
 
 extern "C" {
   PyObject* graph_optimize_partitions(PyObject* self, PyObject* args);
+  PyObject* graph_partition_parts(PyObject* self, PyObject* args);
 }
 
 
@@ -47,7 +48,11 @@ extern "C" {
       "    A user-provided Python function, that given a partition as a nested \n"\
       "    list of groups, where each value is a node\n" \
       "    identifier, returns a floating-point score.  Higher values indicate \n"\
-      "    greater fitness.\n\n" \
+      "    greater fitness.  Alternatively, a sequence of precomputed scores\n"\
+      "    for the parts returned by partition_parts_ can be given. The scores\n"\
+      "    are matched to the parts by position, so they must be in the order\n"\
+      "    of partition_parts_ with the same *max_parts_per_group* and\n"\
+      "    *max_subgraph_size*.\n\n" \
       "  *max_parts_per_group*\n" \
       "    Limits the number of nodes that will be placed into a single group.\n\n" \
       "  *max_subgraph_size*\n" \
@@ -57,5 +62,14 @@ extern "C" {
       "    Choses the solution with the highest minimum ('min') or highest \n"\
       "    average ('avg') confidence.\n\n" \
    }, \
+   { CHAR_PTR_CAST "partition_parts", graph_partition_parts, METH_VARARGS, \
+      CHAR_PTR_CAST "**partition_parts** (*root_node*, "\
+      "*max_parts_per_group* = 5, *max_subgraph_size* = 16)\n\n" \
+      "Returns the list of all groups (lists of node identifiers) for which\n" \
+      "optimize_partitions_ would call the fitness function, in the order of\n" \
+      "the calls. The list is empty when the subgraph is not optimized.\n\n" \
+      "This allows for evaluating the groups of many subgraphs at once and\n" \
+      "passing the scores to optimize_partitions_ afterwards.\n\n" \
+   }, \
 
 #endif
@@ -26,7 +26,8 @@ namespace Gamera { namespace GraphApi {
    
    
 // -----------------------------------------------------------------------------
-Node::Node(GraphData * value, Graph* graph) {
+Node::Node(GraphData * value, Graph* graph)
+   : _edges(EdgeVector::allocator_type(graph != NULL ? &graph->_pool : NULL)) {
    _value = value;
    _graph = graph;
 }
@@ -43,7 +44,8 @@ Node::~Node() {
 
 
 // -----------------------------------------------------------------------------
-Node::Node(Node& node) {
+Node::Node(Node& node)
+   : _edges(node._edges.get_allocator()) {
    _value = node._value;
    _graph = node._graph;
 }
@@ -51,7 +53,8 @@ Node::Node(Node& node) {
 
 
 // -----------------------------------------------------------------------------
-Node::Node(Node* node) {
+Node::Node(Node* node)
+   : _edges(node->_edges.get_allocator()) {
    _value = node->_value;
    _graph = node->_graph;
 }
@@ -54,10 +54,14 @@ extern "C" {
   static PyObject* knn_instantiate_from_images(PyObject* self, PyObject* args);
   // classification
   static PyObject* knn_classify(PyObject* self, PyObject* args);
+  static PyObject* knn_classify_list(PyObject* self, PyObject* args);
   static PyObject* knn_classify_with_images(PyObject* self, PyObject* args);
   static PyObject* knn_leave_one_out(PyObject* self, PyObject* args);
   // distance
   static PyObject* knn_knndistance_statistics(PyObject* self, PyObject* args);
+  static PyObject* knn_edit_wilson(PyObject* self, PyObject* args);
+  static PyObject* knn_condense_hart(PyObject* self, PyObject* args);
+  static PyObject* knn_reduce_medoids(PyObject* self, PyObject* args);
   static PyObject* knn_distance_from_images(PyObject* self, PyObject* args);
   static PyObject* knn_distance_between_images(PyObject* self, PyObject* args);
   static PyObject* knn_distance_matrix(PyObject* self, PyObject* args);
@@ -75,6 +79,12 @@ extern "C" {
   static PyObject* knn_set_weights(PyObject* self, PyObject* args);
   static PyObject* knn_get_num_features(PyObject* self);
   static int knn_set_num_features(PyObject* self, PyObject* v);
+  static PyObject* knn_get_storage_type(PyObject* self);
+  static int knn_set_storage_type(PyObject* self, PyObject* v);
+  static PyObject* knn_get_num_rerank(PyObject* self);
+  static int knn_set_num_rerank(PyObject* self, PyObject* v);
+  static PyObject* knn_get_num_threads(PyObject* self);
+  static int knn_set_num_threads(PyObject* self, PyObject* v);
   // saving/loading
   static PyObject* knn_serialize(PyObject* self, PyObject* args);
   static PyObject* knn_unserialize(PyObject* self, PyObject* args);
@@ -108,9 +118,37 @@ PyMethodDef knn_methods[] = {
     (char *)"Get the weights used for classification." },
   { (char *)"classify", knn_classify, METH_VARARGS,
     (char *)"" },
+  { (char *)"classify_list", knn_classify_list, METH_VARARGS,
+    (char *)"[(id_name, confidencemap), ...] **classify_list** (ImageList *glyphs*)\n"
+    "\nClassifies a list of images with the data created by instantiate_from_images\n"
+    "and returns the same tuples as *classify* for each of them. The\n"
+    "classification runs without holding the Python interpreter lock." },
   { (char *)"leave_one_out", knn_leave_one_out, METH_VARARGS, (char *)"" },
   { (char *)"_knndistance_statistics", knn_knndistance_statistics, METH_VARARGS,
     (char *)"" },
+  { (char *)"edit_wilson", knn_edit_wilson, METH_VARARGS,
+    (char *)"[int] **edit_wilson** (int *k* = 0, int *rare_threshold* = 0, *progress* = None)\n"
+    "\nWilson's editing on the data created by instantiate_from_images: returns\n"
+    "the indexes of the feature vectors that are classified correctly by the\n"
+    "majority of their *k* nearest neighbors (``num_k`` when *k* is 0).\n"
+    "Vectors of classes with fewer than *rare_threshold* vectors are always kept.\n"
+    "The callable *progress* is called once for each classified vector." },
+  { (char *)"condense_hart", knn_condense_hart, METH_VARARGS,
+    (char *)"[int] **condense_hart** (int *k* = 0, [int] *order* = None, *progress* = None)\n"
+    "\nHart's condensed nearest neighbor on the data created by\n"
+    "instantiate_from_images: returns the indexes of a subset of the feature\n"
+    "vectors with which all other vectors are classified correctly by the\n"
+    "majority of their *k* nearest neighbors (``num_k`` when *k* is 0). The\n"
+    "vectors are processed in the given *order* (a permutation of the\n"
+    "indexes; by default, in their natural order). The callable *progress*\n"
+    "is called once for each vector that is kept." },
+  { (char *)"reduce_medoids", knn_reduce_medoids, METH_VARARGS,
+    (char *)"[int] **reduce_medoids** (float *ratio*, *progress* = None)\n"
+    "\nPrototype reduction on the data created by instantiate_from_images: the\n"
+    "feature vectors of each class are clustered into *ratio* times as many\n"
+    "clusters as the class has vectors (at least one), and the indexes of the\n"
+    "cluster medoids are returned. The callable *progress* is called once\n"
+    "for each class." },
   { (char *)"serialize", knn_serialize, METH_VARARGS, (char *)"" },
   { (char *)"unserialize", knn_unserialize, METH_VARARGS, (char *)"" },
   { NULL }
@@ -125,11 +163,35 @@ PyGetSetDef knn_getset[] = {
     (char *)"The types of confidences computed during classification.", 0 },
   { (char *)"num_features", (getter)knn_get_num_features, (setter)knn_set_num_features,
     (char *)"The current number of features.", 0 },
+  { (char *)"storage_type", (getter)knn_get_storage_type, (setter)knn_set_storage_type,
+    (char *)"The storage of the feature vectors scanned by classify and classify_list:\n"
+    "STORAGE_DOUBLE (exact), STORAGE_FLOAT, STORAGE_INT8 or STORAGE_PQ (product\n"
+    "quantization). The compressed storage types only select candidates, which\n"
+    "are compared exactly afterwards (see num_rerank).", 0 },
+  { (char *)"num_rerank", (getter)knn_get_num_rerank, (setter)knn_set_num_rerank,
+    (char *)"The number of candidates taken from a compressed storage, whose exact\n"
+    "distances are computed (at least num_k).", 0 },
+  { (char *)"num_threads", (getter)knn_get_num_threads, (setter)knn_set_num_threads,
+    (char *)"The number of threads that run the queries of leave_one_out (0: one\n"
+    "per processor).", 0 },
   { NULL }
 };
 
 static PyObject* array_init;
 
+/*
+  Check that no other thread is reading the classification data
+  without the GIL (see KnnObject::busy) before it is changed.
+*/
+static bool knn_check_not_busy(KnnObject* o) {
+  if (o->busy != 0) {
+    PyErr_SetString(PyExc_RuntimeError,
+                    "knn: the data cannot be changed while another thread is classifying with it.");
+    return false;
+  }
+  return true;
+}
+
 /*
   Convenience function to delete all of the dynamic data used for
   classification.
@@ -158,9 +220,38 @@ static void knn_delete_feature_data(KnnObject* o) {
     delete[] o->id_names;
     o->id_names = 0;
   }
-  if (o->id_name_histogram != 0) {
-    delete[] o->id_name_histogram;
-    o->id_name_histogram = 0;
+  if (o->class_ids != 0) {
+    delete[] o->class_ids;
+    o->class_ids = 0;
+  }
+  if (o->compressed != 0) {
+    delete o->compressed;
+    o->compressed = 0;
+  }
+  std::vector<char*>().swap(o->class_names);
+  std::vector<int>().swap(o->class_sizes);
+}
+
+/*
+  Intern the id_names of the feature vectors: each distinct name gets
+  a small integer id, assigned in ascending order of the names, so that
+  sorting by id is the same as sorting by name.
+*/
+static void knn_intern_id_names(KnnObject* o) {
+  typedef std::map<char*, int, ltstr> map_type;
+  map_type ids;
+  size_t num_feature_vectors = o->feature_vectors->size();
+  for (size_t i = 0; i < num_feature_vectors; ++i)
+    ids.insert(std::make_pair(o->id_names[i], 0));
+  o->class_names.clear();
+  for (map_type::iterator i = ids.begin(); i != ids.end(); ++i) {
+    i->second = (int)o->class_names.size();
+    o->class_names.push_back(i->first);
+  }
+  o->class_sizes.assign(o->class_names.size(), 0);
+  for (size_t i = 0; i < num_feature_vectors; ++i) {
+    o->class_ids[i] = ids[o->id_names[i]];
+    o->class_sizes[o->class_ids[i]]++;
   }
 }
 
@@ -202,13 +293,18 @@ static PyObject* knn_new(PyTypeObject* pytype, PyObject* args,
   o->num_features = 0;
   o->feature_vectors = 0;
   o->id_names = 0;
-  o->id_name_histogram = 0;
+  o->class_ids = 0;
   o->selection_vector = 0;
   o->weight_vector = 0;
   o->normalize = 0;
   o->unknown = 0;
   o->num_k = 1;
   o->distance_type = CITY_BLOCK;
+  o->storage_type = STORAGE_DOUBLE;
+  o->num_rerank = 32;
+  o->num_threads = 0;
+  o->compressed = 0;
+  o->busy = 0;
   o->confidence_types.push_back(CONFIDENCE_DEFAULT);
 
   Py_INCREF(Py_None);
@@ -236,7 +332,7 @@ static int knn_create_feature_data(KnnObject* o, size_t num_feature_vectors) {
     o->id_names = new char*[num_feature_vectors];
     for (size_t i = 0; i < num_feature_vectors; ++i)
       o->id_names[i] = 0;
-    o->id_name_histogram = new int[num_feature_vectors];
+    o->class_ids = new int[num_feature_vectors];
   } catch (std::exception e) {
     PyErr_SetString(PyExc_RuntimeError, e.what());
     return -1;
@@ -275,6 +371,8 @@ static PyObject* knn_instantiate_from_images(PyObject* self, PyObject* args) {
   if (PyArg_ParseTuple(args, CHAR_PTR_CAST "OO", &images, &norm) <= 0) {
     return 0;
   }
+  if (!knn_check_not_busy(o))
+    return 0;
   /*
     Unlike classify_with_images this method requires a list so that the
     size can be known ahead of time. One of the advantages of the non-interactive
@@ -322,7 +420,6 @@ static PyObject* knn_instantiate_from_images(PyObject* self, PyObject* args) {
   double* tmp_fv;
   Py_ssize_t tmp_fv_len;
 
-  std::map<char*, int, ltstr> id_name_histogram;
   double *current_features;
   for (size_t i = 0; i < o->feature_vectors->size(); ++i) {
     current_features = (*o->feature_vectors)[i];
@@ -352,12 +449,11 @@ static PyObject* knn_instantiate_from_images(PyObject* self, PyObject* args) {
     }
     o->id_names[i] = new char[len + 1];
     strncpy(o->id_names[i], tmp_id_name, len + 1);
-    id_name_histogram[o->id_names[i]]++;
   }
 
   /*
-    Apply the normalization and store the histogram data for fast access in
-    leave-one-out.
+    Apply the normalization and intern the id_names for fast access in
+    classification and leave-one-out.
   */
   if (o->normalize != 0) {
     o->normalize->compute_normalization();
@@ -365,14 +461,9 @@ static PyObject* knn_instantiate_from_images(PyObject* self, PyObject* args) {
     for (size_t i = 0; i < o->feature_vectors->size(); ++i) {
       current_features = (*o->feature_vectors)[i];
       o->normalize->apply(current_features, current_features + o->num_features);
-      o->id_name_histogram[i] = id_name_histogram[o->id_names[i]];
-    }
-  } else {
-    for (size_t i = 0; i < o->feature_vectors->size(); ++i) {
-      current_features = (*o->feature_vectors)[i];
-      o->id_name_histogram[i] = id_name_histogram[o->id_names[i]];
     }
   }
+  knn_intern_id_names(o);
 
   Py_DECREF(images_seq);
   Py_INCREF(Py_None);
@@ -394,6 +485,11 @@ static PyObject* knn_classify(PyObject* self, PyObject* args) {
                       "knn: classify called before instantiate from images");
       return 0;
   }
+  if (o->feature_vectors->size() == 0) {
+      PyErr_SetString(PyExc_ValueError,
+                      "knn: classify called with an empty database");
+      return 0;
+  }
   PyObject* unknown;
   if (PyArg_ParseTuple(args, CHAR_PTR_CAST "O", &unknown) <= 0) {
     return 0;
@@ -422,23 +518,12 @@ static PyObject* knn_classify(PyObject* self, PyObject* args) {
   }
 
   // create the kNN object
-  kNearestNeighbors<char*, ltstr, eqstr> knn(o->num_k);
+  kNearestClassIds knn(o->num_k);
   knn.confidence_types = o->confidence_types;
 
-  double *current_known;
-
-  for (size_t i = 0; i < o->feature_vectors->size(); ++i) {
-    double distance;
-
-    current_known = (*o->feature_vectors)[i];
-
-    compute_distance(o->distance_type, current_known, o->num_features,
-                     o->unknown, &distance,
-                     o->selection_vector, o->weight_vector);
-
-    knn.add(o->id_names[i], distance);
-  }
-  knn.majority();
+  prepare_storage(o);
+  find_nearest(o, o->unknown, knn);
+  knn.majority(o->class_names.size());
   knn.calculate_confidences();
   PyObject* ans_list = PyList_New(knn.answer.size());
   for (size_t i = 0; i < knn.answer.size(); ++i) {
@@ -446,7 +531,7 @@ static PyObject* knn_classify(PyObject* self, PyObject* args) {
     // like it leaks. KWM
     PyObject* ans = PyTuple_New(2);
     PyTuple_SET_ITEM(ans, 0, PyFloat_FromDouble(knn.answer[i].second));
-    PyTuple_SET_ITEM(ans, 1, PyString_FromString(knn.answer[i].first));
+    PyTuple_SET_ITEM(ans, 1, PyString_FromString(o->class_names[knn.answer[i].first]));
     PyList_SET_ITEM(ans_list, i, ans);
   }
   PyObject* conf_dict = PyDict_New();
@@ -463,6 +548,107 @@ static PyObject* knn_classify(PyObject* self, PyObject* args) {
   return result;
 }
 
+/*
+  non-interactive classification of many images at once. The feature
+  vectors are copied while holding the GIL, the distances are then
+  computed without it.
+*/
+static PyObject* knn_classify_list(PyObject* self, PyObject* args) {
+  KnnObject* o = (KnnObject*)self;
+
+  if (o->feature_vectors == 0) {
+      PyErr_SetString(PyExc_RuntimeError,
+                      "knn: classify_list called before instantiate from images");
+      return 0;
+  }
+  if (o->feature_vectors->size() == 0) {
+      PyErr_SetString(PyExc_ValueError,
+                      "knn: classify_list called with an empty database");
+      return 0;
+  }
+  PyObject* unknowns;
+  if (PyArg_ParseTuple(args, CHAR_PTR_CAST "O", &unknowns) <= 0) {
+    return 0;
+  }
+  PyObject* unknowns_seq = PySequence_Fast(unknowns, "knn: glyphs must be a sequence of images");
+  if (unknowns_seq == NULL)
+    return 0;
+
+  int num_unknowns = (int)PySequence_Fast_GET_SIZE(unknowns_seq);
+  std::vector<double> features(num_unknowns * o->num_features);
+  for (int i = 0; i < num_unknowns; ++i) {
+    PyObject* unknown = PySequence_Fast_GET_ITEM(unknowns_seq, i);
+    if (!is_ImageObject(unknown)) {
+      Py_DECREF(unknowns_seq);
+      PyErr_SetString(PyExc_TypeError, "knn: unknown must be an image");
+      return 0;
+    }
+    double* fv;
+    Py_ssize_t fv_len;
+    if (image_get_fv(unknown, &fv, &fv_len) < 0) {
+      Py_DECREF(unknowns_seq);
+      PyErr_SetString(PyExc_ValueError, "knn: could not get features");
+      return 0;
+    }
+    if (size_t(fv_len) != o->num_features) {
+      Py_DECREF(unknowns_seq);
+      PyErr_SetString(PyExc_ValueError, "knn: features not the correct size");
+      return 0;
+    }
+    double* dest = &features[i * o->num_features];
+    if (o->normalize != 0)
+      o->normalize->apply(fv, fv + o->num_features, dest);
+    else
+      std::copy(fv, fv + o->num_features, dest);
+  }
+  Py_DECREF(unknowns_seq);
+
+  typedef kNearestClassIds Knn;
+  std::vector<Knn*> answers(num_unknowns);
+  prepare_storage(o);
+  o->busy++;
+  Py_BEGIN_ALLOW_THREADS
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+  for (int i = 0; i < num_unknowns; ++i) {
+    Knn* knn = new Knn(o->num_k);
+    knn->confidence_types = o->confidence_types;
+    find_nearest(o, &features[i * o->num_features], *knn);
+    knn->majority(o->class_names.size());
+    knn->calculate_confidences();
+    answers[i] = knn;
+  }
+  Py_END_ALLOW_THREADS
+  o->busy--;
+
+  PyObject* result = PyList_New(num_unknowns);
+  for (int i = 0; i < num_unknowns; ++i) {
+    Knn* knn = answers[i];
+    PyObject* ans_list = PyList_New(knn->answer.size());
+    for (size_t j = 0; j < knn->answer.size(); ++j) {
+      PyObject* ans = PyTuple_New(2);
+      PyTuple_SET_ITEM(ans, 0, PyFloat_FromDouble(knn->answer[j].second));
+      PyTuple_SET_ITEM(ans, 1, PyString_FromString(o->class_names[knn->answer[j].first]));
+      PyList_SET_ITEM(ans_list, j, ans);
+    }
+    PyObject* conf_dict = PyDict_New();
+    for (size_t j = 0; j < knn->confidence_types.size(); ++j) {
+      PyObject* o1 = PyInt_FromLong(knn->confidence_types[j]);
+      PyObject* o2 = PyFloat_FromDouble(knn->confidence[j]);
+      PyDict_SetItem(conf_dict, o1, o2);
+      Py_DECREF(o1);
+      Py_DECREF(o2);
+    }
+    PyObject* pair = PyTuple_New(2);
+    PyTuple_SET_ITEM(pair, 0, ans_list);
+    PyTuple_SET_ITEM(pair, 1, conf_dict);
+    PyList_SET_ITEM(result, i, pair);
+    delete knn;
+  }
+  return result;
+}
+
 static PyObject* knn_classify_with_images(PyObject* self, PyObject* args) {
   KnnObject* o = (KnnObject*)self;
   PyObject* unknown, *iterator, *container;
@@ -871,10 +1057,12 @@ PyObject* knn_unique_distances(PyObject* self, PyObject* args) {
 }
 
 static PyObject* knn_get_num_k(PyObject* self) {
-  return Py_BuildValue(CHAR_PTR_CAST "i", ((KnnObject*)self)->num_k);
+  return Py_BuildValue(CHAR_PTR_CAST "i", (int)((KnnObject*)self)->num_k);
 }
 
 static int knn_set_num_k(PyObject* self, PyObject* v) {
+  if (!knn_check_not_busy((KnnObject*)self))
+    return -1;
   if (!PyInt_Check(v)) {
     PyErr_SetString(PyExc_TypeError, "knn: expected an int.");
     return -1;
@@ -888,6 +1076,8 @@ static PyObject* knn_get_distance_type(PyObject* self) {
 }
 
 static int knn_set_distance_type(PyObject* self, PyObject* v) {
+  if (!knn_check_not_busy((KnnObject*)self))
+    return -1;
   if (!PyInt_Check(v)) {
     PyErr_SetString(PyExc_TypeError, "knn: expected an int.");
     return -1;
@@ -910,6 +1100,8 @@ static PyObject* knn_get_confidence_types(PyObject* self) {
 }
 
 static int knn_set_confidence_types(PyObject* self, PyObject* list) {
+  if (!knn_check_not_busy((KnnObject*)self))
+    return -1;
   if(!PyList_Check(list)) {
     PyErr_SetString(PyExc_TypeError, "knn: confidence_types must be list.");
     return -1;
@@ -933,7 +1125,8 @@ static int knn_set_confidence_types(PyObject* self, PyObject* list) {
 }
 
 /*
-  Leave-one-out cross validation
+  Leave-one-out cross validation. The queries run in parallel on
+  num_threads native threads (the GIL is released meanwhile).
 */
 static PyObject* knn_leave_one_out(PyObject* self, PyObject* args) {
   KnnObject* o = (KnnObject*)self;
@@ -950,9 +1143,11 @@ static PyObject* knn_leave_one_out(PyObject* self, PyObject* args) {
   }
   if (indexes == 0) {
     // If we don't have a list of indexes, just do the leave_one_out
+    o->busy++;
     Py_BEGIN_ALLOW_THREADS
     ans = leave_one_out(o, std::numeric_limits<int>::max());
     Py_END_ALLOW_THREADS
+    o->busy--;
     return Py_BuildValue(CHAR_PTR_CAST "(ii)", ans.first, ans.second);
   } else {
     // Get the list of indexes
@@ -988,9 +1183,11 @@ static PyObject* knn_leave_one_out(PyObject* self, PyObject* args) {
     }
 
     // do the leave-one-out
+    o->busy++;
     Py_BEGIN_ALLOW_THREADS
     ans = leave_one_out(o, stop_threshold, o->selection_vector, o->weight_vector, &idx);
     Py_END_ALLOW_THREADS
+    o->busy--;
 
     return Py_BuildValue(CHAR_PTR_CAST "(ii)", ans.first, ans.second);
   }
@@ -1023,7 +1220,8 @@ static PyObject* knn_knndistance_statistics(PyObject* self, PyObject* args) {
   PyObject* result = PyList_New(o->feature_vectors->size());
   double *feature_i, *feature_j;
   double distance;
-  kNearestNeighbors<char*, ltstr, eqstr> knn((size_t)k);
+  kNearestClassIds knn((size_t)k);
+  BoundedDistance distance_function = bounded_distance_function(o->distance_type);
   for (i=0; i<o->feature_vectors->size(); i++) {
     knn.reset();
     // find k nearest neighbors of i-th prototype
@@ -1031,11 +1229,12 @@ static PyObject* knn_knndistance_statistics(PyObject* self, PyObject* args) {
     for (j=0; j<o->feature_vectors->size(); j++) {
       if (j==i) continue;
       feature_j = (*o->feature_vectors)[j];
-      // compute distance
-      compute_distance(o->distance_type, feature_i, o->num_features,
-                       feature_j, &distance, o->selection_vector, o->weight_vector);
+      // compute distance (only the k nearest neighbors are needed, so
+      // farther ones can be abandoned early)
+      distance = distance_function(feature_i, feature_i + o->num_features, feature_j,
+                                   o->selection_vector, o->weight_vector, knn.bound());
       // store distance in kNearestNeighbors
-      knn.add(o->id_names[j], distance);
+      knn.add(o->class_ids[j], distance);
     }
     // compute average distance
     distance = 0.0;
@@ -1053,6 +1252,174 @@ static PyObject* knn_knndistance_statistics(PyObject* self, PyObject* args) {
   return result;
 }
 
+/*
+  Database editing (see edit_wilson, condense_hart and reduce_medoids in
+  knncoremodule.hpp). The functions return the indexes of the kept feature
+  vectors, from which the Python side builds the reduced classifier.
+*/
+static bool knn_check_editing(KnnObject* o, const char* name) {
+  if (o->feature_vectors == 0) {
+    PyErr_Format(PyExc_RuntimeError,
+                 "knn: %s called before instantiate_from_images.", name);
+    return false;
+  }
+  return true;
+}
+
+static PyObject* knn_kept_indexes(const std::vector<char>& keep) {
+  PyObject* result = PyList_New(0);
+  for (size_t i = 0; i < keep.size(); ++i) {
+    if (keep[i]) {
+      PyObject* index = PyInt_FromLong((long)i);
+      PyList_Append(result, index);
+      Py_DECREF(index);
+    }
+  }
+  return result;
+}
+
+/*
+  The editing functions run in chunks without the interpreter lock. When
+  a progress callable is given, the chunks are small, and it is called
+  for the steps done after each chunk.
+*/
+static size_t knn_editing_chunk(PyObject* progress, size_t n) {
+  if (progress == 0 || progress == Py_None)
+    return std::max(n, (size_t)1);
+  return std::max(n / 100, (size_t)1);
+}
+
+static bool knn_editing_progress(PyObject* progress, size_t steps) {
+  if (progress == 0 || progress == Py_None)
+    return true;
+  for (size_t i = 0; i < steps; ++i) {
+    PyObject* result = PyObject_CallObject(progress, NULL);
+    if (result == 0)
+      return false;
+    Py_DECREF(result);
+  }
+  return true;
+}
+
+static PyObject* knn_edit_wilson(PyObject* self, PyObject* args) {
+  KnnObject* o = (KnnObject*)self;
+  int k = 0;
+  int rare_threshold = 0;
+  PyObject* progress = 0;
+  if (PyArg_ParseTuple(args, CHAR_PTR_CAST "|iiO", &k, &rare_threshold, &progress) <= 0)
+    return 0;
+  if (!knn_check_editing(o, "edit_wilson"))
+    return 0;
+  if (k <= 0)
+    k = (int)o->num_k;
+  size_t n = o->feature_vectors->size();
+  size_t chunk = knn_editing_chunk(progress, n);
+  std::vector<char> keep(n, 1);
+  bool ok = true;
+  o->busy++;
+  for (size_t begin = 0; begin < n && ok; begin += chunk) {
+    size_t end = std::min(begin + chunk, n);
+    Py_BEGIN_ALLOW_THREADS
+    edit_wilson(o, (size_t)k, rare_threshold, keep, begin, end);
+    Py_END_ALLOW_THREADS
+    ok = knn_editing_progress(progress, end - begin);
+  }
+  o->busy--;
+  if (!ok)
+    return 0;
+  return knn_kept_indexes(keep);
+}
+
+static PyObject* knn_condense_hart(PyObject* self, PyObject* args) {
+  KnnObject* o = (KnnObject*)self;
+  int k = 0;
+  PyObject* order_arg = Py_None;
+  PyObject* progress = 0;
+  if (PyArg_ParseTuple(args, CHAR_PTR_CAST "|iOO", &k, &order_arg, &progress) <= 0)
+    return 0;
+  if (!knn_check_editing(o, "condense_hart"))
+    return 0;
+  if (k <= 0)
+    k = (int)o->num_k;
+  size_t n = o->feature_vectors->size();
+  std::vector<size_t> order;
+  if (order_arg == Py_None) {
+    for (size_t i = 0; i < n; ++i)
+      order.push_back(i);
+  } else {
+    PyObject* seq = PySequence_Fast(order_arg, "knn: order must be a list of indexes.");
+    if (seq == 0)
+      return 0;
+    std::vector<char> seen(n, 0);
+    size_t size = PySequence_Fast_GET_SIZE(seq);
+    for (size_t i = 0; i < size; ++i) {
+      PyObject* item = PySequence_Fast_GET_ITEM(seq, i);
+      long index = PyInt_Check(item) ? PyInt_AsLong(item) : -1;
+      if (index < 0 || index >= (long)n || seen[index]) {
+        Py_DECREF(seq);
+        PyErr_SetString(PyExc_ValueError,
+                        "knn: order must be a permutation of the feature vector indexes.");
+        return 0;
+      }
+      seen[index] = 1;
+      order.push_back((size_t)index);
+    }
+    Py_DECREF(seq);
+    if (order.size() != n) {
+      PyErr_SetString(PyExc_ValueError,
+                      "knn: order must be a permutation of the feature vector indexes.");
+      return 0;
+    }
+  }
+  std::vector<char> keep;
+  CondenseHart hart(o, (size_t)k, order, keep);
+  size_t chunk = knn_editing_chunk(progress, n);
+  size_t reported = hart.store_size();
+  bool ok = knn_editing_progress(progress, reported);
+  bool running = true;
+  o->busy++;
+  while (running && ok) {
+    Py_BEGIN_ALLOW_THREADS
+    running = hart.run(chunk);
+    Py_END_ALLOW_THREADS
+    ok = knn_editing_progress(progress, hart.store_size() - reported);
+    reported = hart.store_size();
+  }
+  o->busy--;
+  if (!ok)
+    return 0;
+  return knn_kept_indexes(keep);
+}
+
+static PyObject* knn_reduce_medoids(PyObject* self, PyObject* args) {
+  KnnObject* o = (KnnObject*)self;
+  double ratio;
+  PyObject* progress = 0;
+  if (PyArg_ParseTuple(args, CHAR_PTR_CAST "d|O", &ratio, &progress) <= 0)
+    return 0;
+  if (!knn_check_editing(o, "reduce_medoids"))
+    return 0;
+  if (ratio <= 0.0 || ratio > 1.0) {
+    PyErr_SetString(PyExc_ValueError, "knn: ratio must be in the range (0, 1].");
+    return 0;
+  }
+  std::vector<std::vector<size_t> > classes;
+  class_members(o, classes);
+  std::vector<char> keep(o->feature_vectors->size(), 0);
+  bool ok = true;
+  o->busy++;
+  for (size_t c = 0; c < classes.size() && ok; ++c) {
+    Py_BEGIN_ALLOW_THREADS
+    reduce_medoids(o, classes[c], ratio, keep);
+    Py_END_ALLOW_THREADS
+    ok = knn_editing_progress(progress, 1);
+  }
+  o->busy--;
+  if (!ok)
+    return 0;
+  return knn_kept_indexes(keep);
+}
+
 /*
   Serialize and unserialize save and restore the internal data of the kNN object
   to/from a fast and compact binary format. This allows a user to create a file that
@@ -1253,6 +1620,8 @@ static PyObject* knn_unserialize(PyObject* self, PyObject* args) {
   char* filename;
   if (PyArg_ParseTuple(args, CHAR_PTR_CAST "s", &filename) <= 0)
     return 0;
+  if (!knn_check_not_busy(o))
+    return 0;
 
   FILE* file = fopen(filename, "rb");
   if (file == 0) {
@@ -1317,7 +1686,6 @@ static PyObject* knn_unserialize(PyObject* self, PyObject* args) {
   }
   o->num_k = num_k;
 
-  std::map<char*, int, ltstr> id_name_histogram;
   for (size_t i = 0; i < o->feature_vectors->size(); ++i) {
     unsigned long len;
     if (fread((void*)&len, sizeof(unsigned long), 1, file) != 1) {
@@ -1331,7 +1699,6 @@ static PyObject* knn_unserialize(PyObject* self, PyObject* args) {
       fclose(file);
       return 0;
     }
-    id_name_histogram[o->id_names[i]]++;
   }
 
   bool normalize = false;
@@ -1383,8 +1750,8 @@ static PyObject* knn_unserialize(PyObject* self, PyObject* args) {
       fclose(file);
       return 0;
     }
-    o->id_name_histogram[i] = id_name_histogram[o->id_names[i]];
   }
+  knn_intern_id_names(o);
 
   fclose(file);
   return feature_names;
@@ -1441,6 +1808,8 @@ static PyObject* knn_set_selections(PyObject* self, PyObject* args) {
   if (PyArg_ParseTuple(args, CHAR_PTR_CAST "O", &array) <= 0) {
     return 0;
   }
+  if (!knn_check_not_busy(o))
+    return 0;
 
   Py_ssize_t len;
   int *selections;
@@ -1479,6 +1848,8 @@ static PyObject* knn_set_weights(PyObject* self, PyObject* args) {
   if (PyArg_ParseTuple(args, CHAR_PTR_CAST "O", &array) <= 0) {
     return 0;
   }
+  if (!knn_check_not_busy(o))
+    return 0;
   Py_ssize_t len;
   double* weights;
   if (!PyObject_CheckReadBuffer(array)) {
@@ -1502,11 +1873,13 @@ static PyObject* knn_set_weights(PyObject* self, PyObject* args) {
 
 static PyObject* knn_get_num_features(PyObject* self) {
   KnnObject* o = (KnnObject*)self;
-  return Py_BuildValue(CHAR_PTR_CAST "i", o->num_features);
+  return Py_BuildValue(CHAR_PTR_CAST "i", (int)o->num_features);
 }
 
 static int knn_set_num_features(PyObject* self, PyObject* v) {
   KnnObject* o = (KnnObject*)self;
+  if (!knn_check_not_busy(o))
+    return -1;
   if (!PyInt_Check(v)) {
     PyErr_SetString(PyExc_TypeError, "knn: must be an integer.");
     return -1;
@@ -1515,6 +1888,70 @@ static int knn_set_num_features(PyObject* self, PyObject* v) {
   return 0;
 }
 
+static PyObject* knn_get_storage_type(PyObject* self) {
+  return Py_BuildValue(CHAR_PTR_CAST "i", ((KnnObject*)self)->storage_type);
+}
+
+static int knn_set_storage_type(PyObject* self, PyObject* v) {
+  KnnObject* o = (KnnObject*)self;
+  if (!knn_check_not_busy(o))
+    return -1;
+  if (!PyInt_Check(v)) {
+    PyErr_SetString(PyExc_TypeError, "knn: expected an int.");
+    return -1;
+  }
+  long storage_type = PyInt_AS_LONG(v);
+  if (storage_type < STORAGE_DOUBLE || storage_type > STORAGE_PQ) {
+    PyErr_SetString(PyExc_ValueError, "knn: unknown storage type.");
+    return -1;
+  }
+  o->storage_type = (FeatureStorage)storage_type;
+  // the compressed storage is rebuilt when it is needed next
+  if (o->compressed != 0) {
+    delete o->compressed;
+    o->compressed = 0;
+  }
+  return 0;
+}
+
+static PyObject* knn_get_num_rerank(PyObject* self) {
+  return Py_BuildValue(CHAR_PTR_CAST "i", (int)((KnnObject*)self)->num_rerank);
+}
+
+static int knn_set_num_rerank(PyObject* self, PyObject* v) {
+  if (!knn_check_not_busy((KnnObject*)self))
+    return -1;
+  if (!PyInt_Check(v)) {
+    PyErr_SetString(PyExc_TypeError, "knn: expected an int.");
+    return -1;
+  }
+  if (PyInt_AS_LONG(v) < 1) {
+    PyErr_SetString(PyExc_ValueError, "knn: num_rerank must be positive.");
+    return -1;
+  }
+  ((KnnObject*)self)->num_rerank = PyInt_AS_LONG(v);
+  return 0;
+}
+
+static PyObject* knn_get_num_threads(PyObject* self) {
+  return Py_BuildValue(CHAR_PTR_CAST "i", (int)((KnnObject*)self)->num_threads);
+}
+
+static int knn_set_num_threads(PyObject* self, PyObject* v) {
+  if (!knn_check_not_busy((KnnObject*)self))
+    return -1;
+  if (!PyInt_Check(v)) {
+    PyErr_SetString(PyExc_TypeError, "knn: expected an int.");
+    return -1;
+  }
+  if (PyInt_AS_LONG(v) < 0) {
+    PyErr_SetString(PyExc_ValueError, "knn: num_threads must not be negative.");
+    return -1;
+  }
+  ((KnnObject*)self)->num_threads = PyInt_AS_LONG(v);
+  return 0;
+}
+
 PyMethodDef knn_module_methods[] = {
   { NULL }
 };
@@ -1542,6 +1979,14 @@ DL_EXPORT(void) initknncore(void) {
                        Py_BuildValue(CHAR_PTR_CAST "i", EUCLIDEAN));
   PyDict_SetItemString(d, "FAST_EUCLIDEAN",
                        Py_BuildValue(CHAR_PTR_CAST "i", FAST_EUCLIDEAN));
+  PyDict_SetItemString(d, "STORAGE_DOUBLE",
+                       Py_BuildValue(CHAR_PTR_CAST "i", STORAGE_DOUBLE));
+  PyDict_SetItemString(d, "STORAGE_FLOAT",
+                       Py_BuildValue(CHAR_PTR_CAST "i", STORAGE_FLOAT));
+  PyDict_SetItemString(d, "STORAGE_INT8",
+                       Py_BuildValue(CHAR_PTR_CAST "i", STORAGE_INT8));
+  PyDict_SetItemString(d, "STORAGE_PQ",
+                       Py_BuildValue(CHAR_PTR_CAST "i", STORAGE_PQ));
 
   PyObject* array_dict = get_module_dict("array");
   if (array_dict == 0) {
@@ -84,6 +84,7 @@ GABaseSetting::GABaseSetting(int opMode /*= GA_SELECTION*/,
     this->pSize = pSize;
     this->cRate = cRate;
     this->mRate = mRate;
+    this->seed = 0;
 }
 
 int GABaseSetting::getOpMode() {
@@ -102,6 +103,10 @@ double GABaseSetting::getMutRate() {
     return this->mRate;
 }
 
+unsigned int GABaseSetting::getSeed() {
+    return this->seed;
+}
+
 void GABaseSetting::setOpMode(int opMode) {
     if ( opMode != GA_SELECTION && opMode != GA_WEIGHTING ) {
         throw std::invalid_argument("GABaseSetting: setOpMode: unknown mode of opertation");
@@ -122,6 +127,10 @@ void GABaseSetting::setMutRate(double mRate) {
     this->mRate = mRate;
 }
 
+void GABaseSetting::setSeed(unsigned int seed) {
+    this->seed = seed;
+}
+
 /******************************************************************************/
 /******************************************************************************/
 /******************************************************************************/
@@ -466,6 +475,23 @@ void GAParallelization::setThreadNum(unsigned int n /*= 2*/) {
 /******************************************************************************/
 /******************************************************************************/
 
+double wallTime() {
+#ifdef _WIN32
+    LARGE_INTEGER frequency, counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return counter.QuadPart / (double) frequency.QuadPart;
+#else
+    struct timeval now;
+    gettimeofday(&now, NULL);
+    return now.tv_sec + now.tv_usec * 1e-6;
+#endif
+}
+
+/******************************************************************************/
+/******************************************************************************/
+/******************************************************************************/
+
 template <typename EOT>
 GAOptimization<EOT>::GAOptimization(KnnObject *knn,
                                GABaseSetting *baseSetting,
@@ -493,6 +519,7 @@ GAOptimization<EOT>::GAOptimization(KnnObject *knn,
 
     // statistics for output
     this->generationCounter = NULL;
+    this->evalTime = NULL;
     this->bestStat = NULL;
     this->kNNUpdater = NULL;
     this->monitorStream = NULL;
@@ -505,6 +532,10 @@ GAOptimization<EOT>::~GAOptimization() {
         delete this->generationCounter;
         this->generationCounter = NULL;
     }
+    if (this->evalTime != NULL) {
+        delete this->evalTime;
+        this->evalTime = NULL;
+    }
     if (this->bestStat != NULL ) {
         delete this->bestStat;
         this->bestStat = NULL;
@@ -529,32 +560,25 @@ void GAOptimization<EOT>::StartCalculation() {
     this->manualStop.setFlag(true);
     this->running = true;
 
-    // seed the random number generator from EO
-    rng.reseed(time(NULL));
+    // seed the random number generator from EO (from the time,
+    // unless a seed has been set)
+    if (this->baseSetting->getSeed() != 0) {
+        rng.reseed(this->baseSetting->getSeed());
+    } else {
+        rng.reseed(time(NULL));
+    }
 
-#ifdef _OPENMP
     // *************** PARALLELIZATION ***************
-    // Set parallel environment settings
-    // 'make_parallel' from eoParallel works only with an eoParser object
-    // so we have to simulate an argc and argv here :(
-    int argc = 1;
-    char *argv[] = { (char*)"dummy-argv" };
-    eoParser parser(argc, argv);
-
-    std::string section("Parallelization");
-    parser.setORcreateParam(this->parallelization->isParallel(),
-        "parallelize-loop",
-        "Enable memory shared parallelization into evaluation's loops",
-        '\0', section);
-    parser.setORcreateParam(this->parallelization->isParallel(),
-        "parallelize-dynamic",
-        "Enable dynamic memory shared parallelization",
-        '\0', section);
-
-    omp_set_num_threads(this->parallelization->getThreadNum());
-
-    make_parallel(parser);
-#endif
+    // The population is evaluated on native threads (see GAPopulationEval),
+    // so that this does not depend on OpenMP. A thread number of zero
+    // means one thread per processor.
+    unsigned int threadNum = 1;
+    if (this->parallelization->isParallel()) {
+        threadNum = this->parallelization->getThreadNum();
+        if (threadNum == 0) {
+            threadNum = native_processor_count();
+        }
+    }
 
     // adjust the individual size for the case of weighting with
     // prior deselected features and build an index relation map
@@ -575,6 +599,12 @@ void GAOptimization<EOT>::StartCalculation() {
     GAFitnessEval<EOT> fitnessEvalFunctor(this->getKnnObject(), &indexRelation);
     eoEvalFuncCounter<EOT> eval(fitnessEvalFunctor);
 
+    if (this->evalTime != NULL) {
+        delete this->evalTime;
+    }
+    this->evalTime = new eoValueParam<double>(0.0, "EvalTime");
+    GAPopulationEval<EOT> popEval(fitnessEvalFunctor, eval, *(this->evalTime), threadNum);
+
     // *************** POPULATIONS SETTINGS ***************
     // Create a population and fill it with random values for the start
     eoPop<EOT> population;
@@ -584,7 +614,8 @@ void GAOptimization<EOT>::StartCalculation() {
     population.append(this->baseSetting->getPopSize(), random);
 
     // calculate the fitness for the individuals in the first generation
-    apply<EOT>(eval, population);
+    eoPop<EOT> noParents;
+    popEval(noParents, population);
 
     // *************** SELECTION SETTINGS ***************
     SelectOneDefaultWorth<EOT> *selectionMethod = this->selection->getSetting();
@@ -671,6 +702,7 @@ void GAOptimization<EOT>::StartCalculation() {
     monitor.add(eval);
     monitor.add(*(this->bestStat));
     monitor.add(secondStat);
+    monitor.add(*(this->evalTime));
     checkpoint.add(monitor);
 
     this->bestIndiStream = new std::ostringstream(std::ostringstream::out);
@@ -690,7 +722,7 @@ void GAOptimization<EOT>::StartCalculation() {
     eoSGATransform<EOT> transform(xover, this->baseSetting->getCrossRate(),
                                   muta, this->baseSetting->getMutRate());
 
-    eoEasyEA<EOT> realGA( checkpoint, eval, selection, transform, *replacement );
+    eoEasyEA<EOT> realGA( checkpoint, popEval, selection, transform, *replacement );
 
     // run the main GA algorithm
     if (this->manualStop.getFlag()) {
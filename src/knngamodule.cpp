@@ -35,11 +35,13 @@ extern "C" {
     static PyObject* getPopSize(PyObject* object);
     static PyObject* getCrossRate(PyObject* object);
     static PyObject* getMutRate(PyObject* object);
+    static PyObject* getSeed(PyObject* object);
     // Setter
     static int setOpMode(PyObject* object, PyObject* arg);
     static int setPopSize(PyObject* object, PyObject* arg);
     static int setCrossRate(PyObject* object, PyObject* arg);
     static int setMutRate(PyObject* object, PyObject* arg);
+    static int setSeed(PyObject* object, PyObject* arg);
 }
 
 struct GABaseSettingObject {
@@ -68,6 +70,9 @@ PyGetSetDef GABaseSetting_getset[] = {
     { (char *) "mutRate", (getter)getMutRate, (setter)setMutRate,
       (char *) "the mutation probability "
                "(should be between 0.0 and 1.0)", NULL },
+    { (char *) "seed", (getter)getSeed, (setter)setSeed,
+      (char *) "the seed of the random number generator; with the default "
+               "value 0, it is seeded from the current time", NULL },
     { NULL }
 };
 
@@ -158,6 +163,17 @@ static PyObject* getMutRate(PyObject* object) {
     }
 }
 
+static PyObject* getSeed(PyObject* object) {
+    GABaseSettingObject *self = (GABaseSettingObject*) object;
+
+    try {
+        return Py_BuildValue(CHAR_PTR_CAST "I", self->baseSetting->getSeed());
+    } catch (std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        Py_RETURN_NONE;
+    }
+}
+
 static int setOpMode(PyObject* object, PyObject* arg) {
     GABaseSettingObject *self = (GABaseSettingObject*) object;
 
@@ -237,6 +253,24 @@ static int setMutRate(PyObject* object, PyObject* arg) {
     return 0;
 }
 
+static int setSeed(PyObject* object, PyObject* arg) {
+    GABaseSettingObject *self = (GABaseSettingObject*) object;
+
+    if(!PyInt_Check(arg)) {
+        PyErr_SetString(PyExc_TypeError, "GABaseSetting.setSeed: seed have to be an int");
+        return -1;
+    }
+
+    try {
+        self->baseSetting->setSeed((unsigned int) PyInt_AsLong(arg));
+    } catch (std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return -1;
+    }
+
+    return 0;
+}
+
 void init_GABaseSettingType(PyObject *d) {
     GABaseSettingType.ob_type = &PyType_Type;
     GABaseSettingType.tp_name = CHAR_PTR_CAST "gamera.knnga.GABaseSetting";
@@ -1377,7 +1411,7 @@ PyGetSetDef GAParallelization_getset[] = {
                "used (``True``) or not (``False``)", NULL },
     { (char *) "thredNum", (getter)getThreadNum, (setter)setThreadNum,
       (char *) "the number of threads which are used by enabled "
-               "parallelization", NULL },
+               "parallelization (0 means one thread per processor)", NULL },
     { NULL }
 };
 
@@ -1511,7 +1545,12 @@ void init_GAParallelizationType(PyObject *d) {
         "   enable (``True``) or disable (``Flase``) the parallelization of "
         "individual fitness calculations\n"
         "*threads* (optional)\n"
-        "   the number of threads which are used for parallelization";
+        "   the number of threads which are used for parallelization; 0 "
+        "means one thread per processor\n\n"
+        "The individuals of each generation are evaluated on native "
+        "threads, which does not require compiling with OpenMP. Without "
+        "parallelization, a build with OpenMP distributes the queries "
+        "within each fitness evaluation instead.";
 
     PyType_Ready(&GAParallelizationType);
     PyDict_SetItemString(d, "GAParallelization", (PyObject*)&GAParallelizationType);
@@ -1578,7 +1617,9 @@ PyGetSetDef GAOptimization_getset[] = {
     { (char *) "monitorString", (getter)getMonitorString, NULL,
       (char *) "string which contains some statistical information about "
                "the optimization process, like number of fitness evaluations, "
-               "average and stdev of fitness values within each generation.", NULL },
+               "average and stdev of fitness values within each generation. "
+               "The last column is the time in seconds taken by the fitness "
+               "evaluations of the generation.", NULL },
     { (char *) "bestIndiString", (getter)getBestIndiString, NULL,
       (char *) "string coded version from the best individual of each "
                "generation", NULL },
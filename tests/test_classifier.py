@@ -1,3 +1,4 @@
+import py.test
 from gamera.core import init_gamera, load_image
 from gamera import knn, classify, gamera_xml
 init_gamera()
@@ -129,3 +130,403 @@ def test_noninteractive_classifier():
     classifier.clear_glyphs()
     assert len(classifier.get_glyphs()) == 0
     classifier.unserialize("tmp/serialized.knn")
+
+def test_grouping_pairs():
+    # the spatial index must find the same pairs as testing all pairs
+    image = load_image("data/testline.png")
+    ccs = image.cc_analysis()
+    for func in [classify.BoundingBoxGroupingFunction(4),
+                 classify.ShapedGroupingFunction(4),
+                 classify.BasicGroupingFunction(3)]:
+        expected = [(i, j) for i in range(len(ccs))
+                    for j in range(i + 1, len(ccs)) if func(ccs[i], ccs[j])]
+        assert sorted(func.grouping_pairs(ccs)) == expected
+
+def _knn_sample(value, id_name):
+    from gamera.core import Image, Dim
+    from array import array
+    if not isinstance(value, list):
+        value = [value]
+    sample = Image((0, 0), Dim(1, 1))
+    sample.features = array('d', value)
+    sample.id_name = [(1.0, id_name)]
+    return sample
+
+def test_knn_majority():
+    from gamera import knncore
+    database = [_knn_sample(1.0, 'a'), _knn_sample(0.0, 'b'),
+                _knn_sample(2.0, 'c'), _knn_sample(2.1, 'c'),
+                _knn_sample(2.2, 'c')]
+    classifier = knncore.kNN()
+    classifier.num_features = 1
+    classifier.num_k = 3
+    classifier.instantiate_from_images(database, False)
+    # each class once among the three nearest neighbors: the closest wins,
+    # the others follow in the order of their names
+    answer, confidence = classifier.classify(_knn_sample(0.2, 'b'))
+    assert [id_name for (c, id_name) in answer] == ['b', 'a', 'c']
+    answer, confidence = classifier.classify(_knn_sample(1.6, 'c'))
+    assert [id_name for (c, id_name) in answer] == ['c', 'a']
+    # without themselves, 'a' and 'b' are outvoted by 'c'
+    assert classifier.leave_one_out() == (3, 5)
+
+def test_knn_leave_one_out():
+    # compare against the majority of the three nearest neighbors
+    # (distances are abandoned early, which must not change the result)
+    from gamera import knncore
+    import random
+    random.seed(42)
+    samples = []
+    for i in range(60):
+        id_name = "abc"[i % 3]
+        samples.append(([random.gauss("abc".index(id_name), 1.0)
+                         for j in range(6)], id_name))
+    classifier = knncore.kNN()
+    classifier.num_features = 6
+    classifier.num_k = 3
+    classifier.instantiate_from_images(
+        [_knn_sample(f, id_name) for (f, id_name) in samples], False)
+    for features in [range(6), [0, 2, 3]]:
+        correct = 0
+        for (f, id_name) in samples:
+            distances = sorted([(sum([abs(f[x] - g[x]) for x in features]), other)
+                                for (g, other) in samples if g is not f])[:3]
+            votes = [other for (d, other) in distances]
+            best = max(votes, key=lambda x: (votes.count(x),
+                       -sum([d for (d, o) in distances if o == x])))
+            if best == id_name:
+                correct += 1
+        if len(features) == 6:
+            assert classifier.leave_one_out() == (correct, 60)
+        assert classifier.leave_one_out(features) == (correct, 60)
+
+def test_knn_leave_one_out_threads():
+    # the queries of leave_one_out are spread over num_threads native
+    # threads, which must not change the result
+    from gamera import knncore
+    import random
+    random.seed(11)
+    samples = [_knn_sample([random.gauss("abc".index(id_name), 1.5)
+                            for j in range(6)], id_name)
+               for id_name in "abc" * 40]
+    results = []
+    for threads in [1, 3]:
+        result = []
+        for k in [1, 3, 5]:
+            classifier = knncore.kNN()
+            classifier.num_features = 6
+            classifier.num_k = k
+            classifier.num_threads = threads
+            classifier.instantiate_from_images(samples, False)
+            result.append(classifier.leave_one_out())
+            result.append(classifier.leave_one_out([0, 2, 5]))
+            correct, total = classifier.leave_one_out(range(6), 5)
+            assert total - correct > 5
+        results.append(result)
+    assert results[0] == results[1]
+    py.test.raises(ValueError, setattr, classifier, "num_threads", -1)
+
+def test_knn_leave_one_out_thread_count():
+    # more than one thread runs the queries; another Python thread
+    # counts the threads of the process while leave_one_out has
+    # released the GIL (Linux only)
+    import os, random, threading
+    from gamera import knncore
+    if not os.path.exists("/proc/self/status"):
+        return
+    def count_threads():
+        for line in open("/proc/self/status"):
+            if line.startswith("Threads:"):
+                return int(line.split()[1])
+    random.seed(12)
+    samples = [_knn_sample([random.gauss("ab".index(id_name), 1.5)
+                            for j in range(20)], id_name)
+               for id_name in "ab" * 1000]
+    classifier = knncore.kNN()
+    classifier.num_features = 20
+    classifier.num_threads = 3
+    classifier.instantiate_from_images(samples, False)
+    done = threading.Event()
+    counts = []
+    def watch():
+        while not done.isSet():
+            counts.append(count_threads())
+    thread = threading.Thread(target=watch)
+    thread.start()
+    try:
+        before = count_threads()
+        for i in range(20):
+            classifier.leave_one_out()
+            if max(counts + [0]) > before:
+                break
+    finally:
+        done.set()
+        thread.join()
+    assert max(counts) > before
+
+def test_knnga_fitness():
+    # the fitness of the genetic algorithms must agree with leave_one_out
+    # (with integral features and a selection the distances do not depend
+    # on the order in which they are summed, with weights they can)
+    from gamera import knncore, knnga
+    import random
+    random.seed(7)
+    samples = []
+    for i in range(150):
+        id_name = "abc"[i % 3]
+        samples.append(_knn_sample([float(random.randint(0, 3) +
+                                          ("abc".index(id_name) if j < 2 else 0))
+                                    for j in range(8)], id_name))
+    for mode, threads in [(knnga.GA_SELECTION, 1), (knnga.GA_SELECTION, 3),
+                          (knnga.GA_WEIGHTING, 1), (knnga.GA_WEIGHTING, 3)]:
+        classifier = knncore.kNN()
+        classifier.num_features = 8
+        classifier.num_k = 3
+        classifier.instantiate_from_images(samples, False)
+        base = knnga.GABaseSetting()
+        base.opMode = mode
+        base.popSize = 10
+        base.seed = 4711
+        selection = knnga.GASelection()
+        selection.setRoulettWheelScaled(2.0)
+        crossover = knnga.GACrossover()
+        crossover.setUniformCrossover(0.5)
+        mutation = knnga.GAMutation()
+        if mode == knnga.GA_SELECTION:
+            mutation.setBinaryMutation(0.1, False)
+        else:
+            mutation.setGaussMutation(8, 0.0, 1.0, 0.5, 0.05)
+        replacement = knnga.GAReplacement()
+        replacement.setSSGAdetTournament(3)
+        stop = knnga.GAStopCriteria()
+        stop.setMaxGenerations(5)
+        parallel = knnga.GAParallelization()
+        parallel.mode = threads > 1
+        parallel.thredNum = threads
+        ga = knnga.GAOptimization(classifier, base, selection, crossover,
+                                  mutation, replacement, stop, parallel)
+        ga.startCalculation()
+        # the best individual has been written back to the classifier
+        correct, total = classifier.leave_one_out()
+        assert total == 150
+        if mode == knnga.GA_SELECTION:
+            assert ga.bestFitness == correct / float(total)
+        else:
+            assert abs(ga.bestFitness - correct / float(total)) <= 2.0 / total
+
+def _knn_editing_sample():
+    from gamera import knncore
+    import random
+    random.seed(3)
+    samples = []
+    for i in range(90):
+        id_name = "abc"[i % 3]
+        samples.append(([random.gauss("abc".index(id_name), 0.8)
+                         for j in range(4)], id_name))
+    # a rare class far away from the others
+    samples.append(([1.0, 1.0, 1.0, 1.0], "d"))
+    samples.append(([1.1, 1.0, 0.9, 1.0], "d"))
+    classifier = knncore.kNN()
+    classifier.num_features = 4
+    classifier.num_k = 3
+    classifier.instantiate_from_images(
+        [_knn_sample(f, id_name) for (f, id_name) in samples], False)
+    return samples, classifier
+
+def _knn_vote(samples, f, candidates, k):
+    distances = sorted([(sum([abs(a - b) for (a, b) in zip(f, samples[c][0])]),
+                         samples[c][1]) for c in candidates])[:k]
+    votes = [other for (d, other) in distances]
+    return max(votes, key=lambda x: (votes.count(x),
+               -sum([d for (d, o) in distances if o == x])))
+
+def test_knn_edit_wilson():
+    samples, classifier = _knn_editing_sample()
+    n = len(samples)
+    expected = [i for i in range(n)
+                if _knn_vote(samples, samples[i][0],
+                             [j for j in range(n) if j != i], 3) == samples[i][1]]
+    kept = classifier.edit_wilson()
+    assert kept == expected
+    assert n - 2 not in kept and n - 1 not in kept
+    # classes with less than rare_threshold samples are never removed
+    kept = classifier.edit_wilson(3, 3)
+    assert kept == expected + [n - 2, n - 1]
+    # the progress is reported for each sample
+    steps = []
+    assert classifier.edit_wilson(3, 0, lambda: steps.append(1)) == expected
+    assert len(steps) == n
+    def cancel():
+        raise KeyboardInterrupt()
+    py.test.raises(KeyboardInterrupt, classifier.edit_wilson, 3, 0, cancel)
+
+def test_knn_condense_hart():
+    import random
+    samples, classifier = _knn_editing_sample()
+    n = len(samples)
+    for order in [None, random.sample(range(n), n)]:
+        kept = classifier.condense_hart(1, order)
+        assert kept == sorted(kept)
+        assert len(kept) < n
+        if order is not None:
+            assert order[0] in kept
+        # the condensed set classifies all removed samples correctly
+        for i in range(n):
+            if i not in kept:
+                assert _knn_vote(samples, samples[i][0], kept, 1) == samples[i][1]
+    assert classifier.condense_hart() == classifier.condense_hart()
+    # the progress is reported for each kept sample
+    steps = []
+    kept = classifier.condense_hart(1, None, lambda: steps.append(1))
+    assert kept == classifier.condense_hart(1)
+    assert len(steps) == len(kept)
+    py.test.raises(ValueError, classifier.condense_hart, 1, [0, 0] + range(2, n))
+    py.test.raises(ValueError, classifier.condense_hart, 1, range(n - 1))
+
+def test_knn_reduce_medoids():
+    from gamera import knncore
+    # four tight groups per class, one medoid must be chosen from each group
+    samples = []
+    for id_name in "ab":
+        for group in range(4):
+            for i in range(5):
+                samples.append(([10.0 * group + 0.1 * i,
+                                 "ab".index(id_name) * 100.0 + 0.05 * i], id_name))
+    classifier = knncore.kNN()
+    classifier.num_features = 2
+    classifier.instantiate_from_images(
+        [_knn_sample(f, id_name) for (f, id_name) in samples], False)
+    kept = classifier.reduce_medoids(0.2)
+    assert len(kept) == 8
+    assert sorted([i // 5 for i in kept]) == range(8)
+    # the medoid of each group is its middle element
+    assert [i % 5 for i in kept] == [2] * 8
+    assert len(classifier.reduce_medoids(0.01)) == 2
+    # the progress is reported for each class
+    steps = []
+    assert classifier.reduce_medoids(0.2, lambda: steps.append(1)) == kept
+    assert len(steps) == 2
+    py.test.raises(ValueError, classifier.reduce_medoids, 0.0)
+    py.test.raises(ValueError, classifier.reduce_medoids, 1.5)
+
+def test_knn_editing_settings():
+    # the edited classifiers keep the settings of the original one
+    from gamera import knn, knncore, knn_editing
+    from gamera.core import Image, Dim
+    from array import array
+    glyphs = []
+    for i in range(12):
+        glyph = Image((0, 0), Dim(2 + i % 4, 2 + i // 4))
+        glyph.classify_manual("abc"[i % 3])
+        glyphs.append(glyph)
+    features = ["area", "aspect_ratio", "nrows_feature"]
+    classifier = knn.kNNInteractive(glyphs, features, False, 3)
+    classifier.distance_type = knncore.CITY_BLOCK
+    classifier.set_selections(array('i', [1, 0, 1]))
+    classifier.set_weights(array('d', [0.5, 1.0, 2.0]))
+    for edit in [lambda c: knn_editing.edit_mnn(c, 1, True),
+                 lambda c: knn_editing.edit_cnn(c, 1, False),
+                 lambda c: knn_editing.edit_medoids(c, 0.5)]:
+        edited = edit(classifier)
+        assert edited.features == features
+        assert edited.distance_type == knncore.CITY_BLOCK
+        assert list(edited.get_selections()) == [1, 0, 1]
+        assert list(edited.get_weights()) == [0.5, 1.0, 2.0]
+
+def test_knn_storage():
+    # the compressed storages only select candidates, which are then
+    # compared exactly
+    from gamera import knncore
+    import random
+    random.seed(11)
+    def sample(id_name):
+        return [random.gauss("abcd".index(id_name), 1.5) for j in range(10)]
+    database = [_knn_sample(sample("abcd"[i % 4]), "abcd"[i % 4])
+                for i in range(400)]
+    unknowns = [_knn_sample(sample("abcd"[i % 4]), "x") for i in range(40)]
+    for distance_type in [knncore.CITY_BLOCK, knncore.EUCLIDEAN,
+                          knncore.FAST_EUCLIDEAN]:
+        classifier = knncore.kNN()
+        classifier.num_features = 10
+        classifier.num_k = 3
+        classifier.distance_type = distance_type
+        classifier.instantiate_from_images(database, True)
+        exact = classifier.classify_list(unknowns)
+        for storage_type in [knncore.STORAGE_FLOAT, knncore.STORAGE_INT8,
+                             knncore.STORAGE_PQ]:
+            classifier.storage_type = storage_type
+            result = classifier.classify_list(unknowns)
+            assert [r[0][0][1] for r in result] == [r[0][0][1] for r in exact]
+            assert classifier.classify(unknowns[0])[0][0][1] == exact[0][0][0][1]
+        classifier.storage_type = knncore.STORAGE_FLOAT
+        assert classifier.classify_list(unknowns) == exact
+        # at least num_k candidates are compared
+        classifier.num_rerank = 1
+        assert classifier.num_rerank == 1
+        assert [r[0][0][1] for r in classifier.classify_list(unknowns[:5])] == \
+               [r[0][0][1] for r in exact[:5]]
+        classifier.storage_type = knncore.STORAGE_DOUBLE
+        assert classifier.classify_list(unknowns) == exact
+    # classifying against an empty database is an error, with and without
+    # compression; only unserialize can create one, so the file of a
+    # database with a single feature vector is stripped of its vector
+    import struct
+    classifier = knncore.kNN()
+    classifier.num_features = 10
+    classifier.instantiate_from_images(database[:1], False)
+    classifier.serialize("tmp/empty.knn", ["f%d" % i for i in range(10)])
+    data = open("tmp/empty.knn", "rb").read()
+    ulong = struct.calcsize("L")
+    header = list(struct.unpack("5L", data[:5 * ulong]))
+    pos = 5 * ulong
+    for i in range(header[4]):
+        pos += ulong + struct.unpack("L", data[pos:pos + ulong])[0]
+    names = data[5 * ulong:pos]
+    pos += ulong + struct.unpack("L", data[pos:pos + ulong])[0]
+    settings = data[pos:len(data) - 10 * struct.calcsize("d")]
+    header[3] = 0
+    open("tmp/empty.knn", "wb").write(struct.pack("5L", *header) + names + settings)
+    classifier = knncore.kNN()
+    classifier.unserialize("tmp/empty.knn")
+    for storage_type in [knncore.STORAGE_DOUBLE, knncore.STORAGE_FLOAT,
+                         knncore.STORAGE_PQ]:
+        classifier.storage_type = storage_type
+        py.test.raises(ValueError, classifier.classify, unknowns[0])
+        py.test.raises(ValueError, classifier.classify_list, unknowns[:3])
+    classifier = knncore.kNN()
+    py.test.raises(ValueError, setattr, classifier, "storage_type", 4)
+    py.test.raises(ValueError, setattr, classifier, "num_rerank", 0)
+
+def test_knn_busy():
+    # while classify_list runs without the GIL, the data it reads must
+    # not be changed by other threads; whether a change is refused
+    # depends on the timing, but the results must never be affected
+    from gamera import knncore
+    import random, threading
+    random.seed(5)
+    def sample(id_name):
+        return [random.gauss("ab".index(id_name), 1.0) for j in range(10)]
+    database = [_knn_sample(sample("ab"[i % 2]), "ab"[i % 2])
+                for i in range(1000)]
+    unknowns = [_knn_sample(sample("ab"[i % 2]), "x") for i in range(200)]
+    classifier = knncore.kNN()
+    classifier.num_features = 10
+    classifier.instantiate_from_images(database, True)
+    exact = classifier.classify_list(unknowns)
+    results = []
+    def worker():
+        for i in range(5):
+            results.append(classifier.classify_list(unknowns))
+    thread = threading.Thread(target=worker)
+    thread.start()
+    while thread.isAlive():
+        try:
+            classifier.instantiate_from_images(database, True)
+            classifier.num_k = 1
+        except RuntimeError, e:
+            assert "another thread" in str(e)
+    thread.join()
+    assert results == [exact] * 5
+    # the data can be changed again afterwards
+    classifier.num_k = 3
+    classifier.instantiate_from_images(database, True)
@@ -0,0 +1,23 @@
+from gamera.core import *
+init_gamera()
+
+inf = float("inf")
+
+def test_profile_contours():
+   image = Image((0, 0), Dim(6, 5))
+   image.draw_filled_rect((1, 1), (3, 2), 1)
+   image.set((4, 3), 1)
+   assert list(image.contour_top()) == [inf, 1, 1, 1, 3, inf]
+   assert list(image.contour_bottom()) == [inf, 3, 3, 3, 2, inf]
+   assert list(image.contour_left()) == [inf, 1, 1, 4, inf]
+   assert list(image.contour_right()) == [inf, 3, 3, 2, inf]
+
+def test_contour_pavlidis():
+   image = Image((0, 0), Dim(8, 8))
+   image.draw_filled_rect((2, 2), (5, 5), 1)
+   contour = image.contour_pavlidis()
+   assert contour[0] == Point(2, 2)
+   assert len(contour) == 12
+   for p in contour:
+      assert p.x in (2, 5) or p.y in (2, 5)
+   assert Image((0, 0), Dim(5, 5)).contour_pavlidis() == []
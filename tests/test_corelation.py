@@ -0,0 +1,61 @@
+import py.test
+
+from gamera.core import *
+init_gamera()
+
+#
+# Tests for template matching over the whole image
+#
+
+def _page_and_template():
+   page = load_image("data/OneBit_generic.png")
+   template = Image((0, 0), Dim(13, 11))
+   for y in range(template.nrows):
+      for x in range(template.ncols):
+         template.set((x, y), page.get((30 + x, 22 + y)))
+   return page, template
+
+def _assert_map_matches(page, template, scores, single):
+   assert scores.ncols == page.ncols - template.ncols + 1
+   assert scores.nrows == page.nrows - template.nrows + 1
+   assert scores.ul == page.ul
+   for y in range(0, scores.nrows, 7):
+      for x in range(0, scores.ncols, 5):
+         offset = Point(page.ul_x + x, page.ul_y + y)
+         assert abs(scores.get((x, y)) - single(offset)) < 1e-6
+
+def test_onebit_maps():
+   page, template = _page_and_template()
+   scores = page.corelation_weighted_map(template, 1.0, -0.5, -0.25, 0.1)
+   _assert_map_matches(page, template, scores,
+      lambda p: page.corelation_weighted(template, p, 1.0, -0.5, -0.25, 0.1))
+   scores = page.corelation_sum_map(template)
+   _assert_map_matches(page, template, scores,
+      lambda p: page.corelation_sum(template, p))
+   scores = page.corelation_sum_squares_map(template)
+   _assert_map_matches(page, template, scores,
+      lambda p: page.corelation_sum_squares(template, p))
+
+def test_greyscale_maps():
+   page, template = _page_and_template()
+   grey = page.to_greyscale()
+   scores = grey.corelation_sum_map(template)
+   _assert_map_matches(grey, template, scores,
+      lambda p: grey.corelation_sum(template, p))
+   scores = grey.corelation_sum_squares_map(template)
+   _assert_map_matches(grey, template, scores,
+      lambda p: grey.corelation_sum_squares(template, p))
+
+def test_best_offsets():
+   page, template = _page_and_template()
+   scores = page.corelation_sum_map(template)
+   best = scores.corelation_best_offsets(3, False, template.ncols)
+   # the template has been cut out of the page
+   assert best[0][0] == Point(30, 22)
+   assert best[0][1] == 0.0
+   assert len(best) <= 3
+   for offset, value in best[1:]:
+      assert abs(offset.x - 30) >= template.ncols or \
+             abs(offset.y - 22) >= template.ncols
+   # template larger than the image
+   py.test.raises(Exception, template.corelation_sum_map, page)
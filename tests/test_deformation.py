@@ -0,0 +1,35 @@
+import py.test
+
+from gamera.core import *
+init_gamera()
+from gamera.plugins.deformation import deform_images
+
+def test_random_seed():
+   image = load_image("data/OneBit_generic.png")
+   a = image.degrade_kanungo(0.0, 0.5, 0.5, 0.5, 0.5, 2, 7)
+   b = image.degrade_kanungo(0.0, 0.5, 0.5, 0.5, 0.5, 2, 7)
+   c = image.degrade_kanungo(0.0, 0.5, 0.5, 0.5, 0.5, 2, 8)
+   assert a.to_string() == b.to_string()
+   assert a.to_string() != c.to_string()
+   a = image.white_speckles(0.05, 5, 2, 2, 7)
+   b = image.white_speckles(0.05, 5, 2, 2, 7)
+   assert a.to_string() == b.to_string()
+
+def test_deform_images():
+   image = load_image("data/OneBit_generic.png")
+   ccs = image.cc_analysis()
+   recipe = [("degrade_kanungo", 0.0, 0.5, 0.5, 0.5, 0.5),
+             ("noise", 1, 0)]
+   a = deform_images(ccs, recipe, 3, 42)
+   b = deform_images(ccs, recipe, 3, 42)
+   assert len(a) == 3 * len(ccs)
+   assert [x.to_string() for x in a] == [x.to_string() for x in b]
+   for i, cc in enumerate(ccs):
+      assert a[3 * i].nrows == cc.nrows
+   grey = image.to_greyscale()
+   result = deform_images([grey], [("wave", 5, 10, 0), ("inkrub", 50)], 2)
+   assert len(result) == 2
+   assert result[0].data.pixel_type == GREYSCALE
+   py.test.raises(RuntimeError, deform_images, [grey], recipe)
+   py.test.raises(RuntimeError, deform_images, ccs, [("rotate", 1.0)])
+   py.test.raises(RuntimeError, deform_images, ccs, [("noise",)])
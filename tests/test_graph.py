@@ -1138,3 +1138,59 @@ def test_textline_reading_order():
       del img
 
 
+
+
+# ------------------------------------------------------------------------------
+def test_partition_parts():
+   g = gamera.graph.Undirected()
+   g.add_edges([("a", "b"), ("b", "c"), ("c", "d"), ("a", "c"), ("e", "f")])
+   def score(part):
+      part = "".join(sorted(part))
+      return {"ab": 0.9, "cd": 0.8, "bc": 0.3}.get(part, 0.5)
+   for root in g.get_subgraph_roots():
+      parts = g.partition_parts(root, 3, 16)
+      scores = [score(part) for part in parts]
+      for criterion in ["min", "avg"]:
+         expected = g.optimize_partitions(root, score, 3, 16, criterion)
+         assert g.optimize_partitions(root, scores, 3, 16, criterion) == expected
+         # the scores are matched to the parts by position
+         try:
+            g.optimize_partitions(root, scores[:-1], 3, 16, criterion)
+            assert False
+         except ValueError:
+            pass
+   # subgraphs that are too large are not optimized
+   assert g.partition_parts("a", 3, 2) == []
+
+
+
+# ------------------------------------------------------------------------------
+def test_graph_pool():
+   # every graph takes its nodes, edges and list cells from its own
+   # memory pool, which is freed together with the graph
+   for i in range(200):
+      g = gamera.graph.Undirected()
+      g.add_edges([(j, (j + 1) % 100) for j in range(100)])
+      assert g.nnodes == 100
+      assert g.nedges == 100
+      h = g.copy(gamera.graph.UNDIRECTED)
+      assert h.nnodes == 100
+      assert h.nedges == 100
+      del g
+      assert h.nnodes == 100
+      assert len(list(h.get_edges())) == 100
+      del h
+   # removed nodes and edges are reused by the same graph
+   g = gamera.graph.Undirected()
+   g.add_edges([(j, (j + 1) % 500) for j in range(500)])
+   used, allocated = g._pool_chunks
+   for i in range(5):
+      for j in range(250):
+         g.remove_node_and_edges(j)
+      assert g.nnodes == 250
+      assert g.nedges == 249
+      assert g._pool_chunks[0] < used
+      g.add_edges([(j, j + 1) for j in range(250)] + [(499, 0)])
+      assert g.nnodes == 500
+      assert g.nedges == 500
+      assert g._pool_chunks == (used, allocated)
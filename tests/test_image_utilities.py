@@ -0,0 +1,59 @@
+from gamera.core import *
+init_gamera()
+
+def _brute_force_properties(image, label):
+   pixels = [(x, y) for y in range(image.nrows) for x in range(image.ncols)
+             if image.get((x, y)) == label]
+   n = float(len(pixels))
+   cx = sum([x for x, y in pixels]) / n
+   cy = sum([y for x, y in pixels]) / n
+   mu20 = sum([(x - cx) ** 2 for x, y in pixels]) / n
+   mu11 = sum([(x - cx) * (y - cy) for x, y in pixels]) / n
+   def value(x, y):
+      if x < 0 or y < 0 or x >= image.ncols or y >= image.nrows:
+         return 0
+      return image.get((x, y))
+   perimeter = len([(x, y) for x, y in pixels
+                    if [value(x + dx, y + dy) for dx, dy in
+                        ((1, 0), (-1, 0), (0, 1), (0, -1))].count(label) < 4])
+   neighbors = {}
+   for x, y in pixels:
+      for dy in (-1, 0, 1):
+         for dx in (-1, 0, 1):
+            v = value(x + dx, y + dy)
+            if v != 0 and v != label:
+               neighbors[v] = 1
+   return len(pixels), cx, cy, mu20, mu11, perimeter, sorted(neighbors.keys())
+
+def test_region_properties():
+   image = load_image("data/OneBit_generic.png")
+   ccs = image.cc_analysis()
+   props = image.region_properties()
+   assert props["label"] == sorted([cc.label for cc in ccs])
+   for i, label in enumerate(props["label"]):
+      area, cx, cy, mu20, mu11, perimeter, neighbors = \
+            _brute_force_properties(image, label)
+      assert props["area"][i] == area
+      assert abs(props["center_x"][i] - cx) < 1e-6
+      assert abs(props["center_y"][i] - cy) < 1e-6
+      assert abs(props["mu20"][i] - mu20) < 1e-6
+      assert abs(props["mu11"][i] - mu11) < 1e-6
+      assert props["perimeter"][i] == perimeter
+      assert props["neighbors"][i] == neighbors
+   # bounding boxes agree with ccs_from_labeled_image
+   boxes = [(cc.label, cc.ul_x, cc.ul_y, cc.lr_x, cc.lr_y)
+            for cc in image.ccs_from_labeled_image()]
+   assert boxes == zip(props["label"], props["ul_x"], props["ul_y"],
+                       props["lr_x"], props["lr_y"])
+
+def test_region_neighbors():
+   image = Image((0, 0), Dim(30, 30))
+   image.draw_filled_rect((2, 2), (10, 10), 5)
+   # touches region 5 diagonally
+   image.draw_filled_rect((11, 11), (20, 15), 7)
+   image.draw_filled_rect((22, 2), (25, 25), 9)
+   props = image.region_properties()
+   assert props["label"] == [5, 7, 9]
+   assert props["neighbors"] == [[7], [5], []]
+   assert props["area"] == [81, 50, 96]
+   assert props["perimeter"] == [32, 26, 52]
@@ -0,0 +1,61 @@
+import py.test
+
+from gamera.core import *
+init_gamera()
+
+def _rank_brute_force(image, rank, k, x, y):
+   r = (k - 1) / 2
+   window = []
+   for dy in range(-r, r + 1):
+      for dx in range(-r, r + 1):
+         xx, yy = abs(x + dx), abs(y + dy)
+         if xx >= image.ncols:
+            xx = 2 * image.ncols - xx - 2
+         if yy >= image.nrows:
+            yy = 2 * image.nrows - yy - 2
+         window.append(image.get((xx, yy)))
+   window.sort()
+   return window[rank - 1]
+
+def test_rank():
+   grey = load_image("data/GreyScale_generic.tiff").resize(Dim(300, 40), 1)
+   grey16 = load_image("data/Grey16_generic.tiff").resize(Dim(300, 40), 1)
+   for image in [grey, grey16]:
+      for rank, k in [(1, 3), (5, 3), (41, 9), (81, 9)]:
+         result = image.rank(rank, k)
+         for y in range(0, image.nrows, 3):
+            for x in range(0, image.ncols, 7):
+               assert result.get((x, y)) == \
+                      _rank_brute_force(image, rank, k, x, y)
+   # a large window, whose fine histograms are mostly caught up from the
+   # column histograms
+   for image in [load_image("data/GreyScale_generic.tiff").resize(Dim(300, 60), 1),
+                 load_image("data/Grey16_generic.tiff").resize(Dim(300, 60), 1)]:
+      result = image.rank(841, 41)
+      for y in range(0, image.nrows, 13):
+         for x in range(0, image.ncols, 29):
+            assert result.get((x, y)) == _rank_brute_force(image, 841, 41, x, y)
+   py.test.raises(Exception, grey16.rank, 10, 3)
+
+def test_rank_onebit():
+   image = load_image("data/OneBit_generic.png")
+   # low ranks darken the image
+   assert image.rank(1, 3).black_area()[0] > image.black_area()[0]
+   assert image.rank(9, 3).black_area()[0] < image.black_area()[0]
+   assert image.rank(1, 3).black_area() == image.dilate().black_area()
+
+def test_kfill():
+   image = Image((0, 0), Dim(20, 12))
+   image.draw_filled_rect((2, 2), (15, 9), 1)
+   # a salt pixel inside and a pepper pixel outside the rectangle
+   image.set((8, 5), 0)
+   image.set((18, 1), 1)
+   result = image.kfill(3, 1)
+   assert result.get((8, 5)) == 1
+   assert result.get((18, 1)) == 0
+   result.set((8, 5), 0)
+   result.set((18, 1), 1)
+   assert result.to_string() == image.to_string()
+   result = image.kfill_modified(5)
+   assert result.get((8, 5)) == 1
+   assert result.get((18, 1)) == 0
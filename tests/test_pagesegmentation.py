@@ -0,0 +1,32 @@
+from gamera.core import *
+init_gamera()
+
+def _segments(ccs):
+   return [(cc.label, cc.ul, cc.dim) for cc in ccs]
+
+def test_runlength_smearing():
+   image = Image((0, 0), Dim(60, 30))
+   # two words of three letters each in one line
+   for x in (2, 8, 14, 40, 46, 52):
+      image.draw_filled_rect((x, 10), (x + 3, 17), 1)
+   segments = image.image_copy().runlength_smearing(5, 5, 3)
+   assert [(cc.ul, cc.lr) for cc in segments] == \
+          [(Point(0, 10), Point(17, 17)), (Point(40, 10), Point(55, 17))]
+   segments = image.image_copy().runlength_smearing(5, 5, 30)
+   assert len(segments) == 1
+   # precomputed ccs give the same median height
+   ccs = image.cc_analysis()
+   assert _segments(image.image_copy().runlength_smearing()) == \
+          _segments(image.image_copy().runlength_smearing(ccs=ccs))
+
+def test_projection_cutting():
+   image = Image((0, 0), Dim(60, 40))
+   # two columns, the left one with two paragraphs
+   image.draw_filled_rect((2, 2), (20, 10), 1)
+   image.draw_filled_rect((2, 20), (20, 30), 1)
+   image.draw_filled_rect((40, 5), (55, 35), 1)
+   segments = image.projection_cutting(5, 5, 0, 1)
+   assert [(cc.ul, cc.lr) for cc in segments] == \
+          [(Point(2, 2), Point(20, 10)), (Point(2, 20), Point(20, 30)),
+           (Point(40, 5), Point(55, 35))]
+   assert len(set([cc.label for cc in segments])) == 3
@@ -23,3 +23,195 @@ def make_test(tester, method):
 tester = PluginTester()
 for name, method in tester.methods:
    setattr(TestPlugins, "test_plugin_" + name, make_test(tester, method))
+
+#
+# Tests for plugins that release the GIL (release_gil)
+#
+
+def test_release_gil_results():
+   # the same results in several threads at the same time
+   import threading
+   grey = load_image("data/GreyScale_generic.png")
+   onebit = load_image("data/OneBit_generic.png")
+   calls = [lambda: grey.otsu_threshold(),
+            lambda: grey.niblack_threshold(),
+            lambda: grey.rank(5, 3),
+            lambda: onebit.erode_dilate(2, 0, 0),
+            lambda: len(onebit.image_copy().cc_analysis()),
+            lambda: grey.image_mean()]
+   def value(result):
+      if isinstance(result, Image):
+         return result.to_string()
+      return result
+   expected = [value(call()) for call in calls]
+   results = {}
+   def work(i):
+      results[i] = [value(call()) for call in calls]
+   threads = [threading.Thread(target=work, args=(i,)) for i in range(4)]
+   for thread in threads:
+      thread.start()
+   for thread in threads:
+      thread.join()
+   for i in range(4):
+      assert results[i] == expected
+
+def test_release_gil_concurrency():
+   # another Python thread runs while the plugin is working; with the
+   # large check interval, the threads are not switched between the
+   # statements of this thread, but only when the plugin releases the GIL
+   import sys, threading
+   grey = load_image("data/GreyScale_generic.png")
+   big = grey.resize(Dim(grey.ncols * 4, grey.nrows * 4), 0)
+   inside = [False]
+   progressed = threading.Event()
+   done = threading.Event()
+   def watch():
+      while not done.isSet():
+         if inside[0]:
+            progressed.set()
+   thread = threading.Thread(target=watch)
+   interval = sys.getcheckinterval()
+   sys.setcheckinterval(1000000)
+   thread.start()
+   try:
+      for i in range(20):
+         inside[0] = True
+         big.rank(41, 9)
+         inside[0] = False
+         if progressed.isSet():
+            break
+   finally:
+      done.set()
+      thread.join()
+      sys.setcheckinterval(interval)
+   assert progressed.isSet()
+
+def test_release_gil_check():
+   import py.test
+   from gamera import generate
+   from gamera.args import Args, ImageType, Int, Pixel
+   class f(plugin.PluginFunction):
+      self_type = ImageType([GREYSCALE])
+      args = Args([Pixel("value")])
+      release_gil = True
+   py.test.raises(RuntimeError, generate.check_release_gil, f)
+   f.args = Args([Int("value")])
+   generate.check_release_gil(f)
+   f.progress_bar = "Working"
+   py.test.raises(RuntimeError, generate.check_release_gil, f)
+
+#
+# Tests for the batch variants of plugins (batch)
+#
+
+def test_batch():
+   from gamera.plugins import _features, _runlength, _threshold
+   from gamera.plugins.features import black_area_batch, moments_batch
+   from gamera.plugins.runlength import to_rle_batch
+   from gamera.plugins.threshold import otsu_find_threshold_batch
+   ccs = load_image("data/OneBit_generic.png").cc_analysis()
+   # feature functions return the features of all images in one array
+   assert list(black_area_batch(ccs)) == \
+          [_features.black_area(cc)[0] for cc in ccs]
+   moments = moments_batch(ccs)
+   assert len(moments) == 9 * len(ccs)
+   for i, cc in enumerate(ccs):
+      assert list(moments[9 * i:9 * (i + 1)]) == list(_features.moments(cc))
+   assert len(black_area_batch([])) == 0
+   # the others return a list (any iterable of images is accepted)
+   assert to_rle_batch(iter(ccs)) == [_runlength.to_rle(cc) for cc in ccs]
+   grey = load_image("data/GreyScale_generic.png")
+   assert otsu_find_threshold_batch([grey, grey]) == \
+          [_threshold.otsu_find_threshold(grey)] * 2
+
+def test_batch_errors():
+   import py.test
+   from gamera.plugins.threshold import otsu_find_threshold_batch
+   onebit = load_image("data/OneBit_generic.png")
+   py.test.raises(TypeError, otsu_find_threshold_batch, [onebit])
+   py.test.raises(TypeError, otsu_find_threshold_batch, [1])
+   py.test.raises(TypeError, otsu_find_threshold_batch, 1)
+
+def test_batch_check():
+   import py.test
+   from gamera import generate
+   from gamera.args import Args, ImageType, Int
+   class f(plugin.PluginFunction):
+      self_type = ImageType([ONEBIT])
+      args = Args([ImageType([ONEBIT], "other")])
+      batch = True
+   py.test.raises(RuntimeError, generate.check_batch, f)
+   f.args = Args([Int("value")])
+   generate.check_batch(f)
+   f.self_type = None
+   py.test.raises(RuntimeError, generate.check_batch, f)
+
+#
+# Tests for the execution statistics of the plugins
+#
+
+def test_stats():
+   import os
+   from gamera.plugins.features import black_area_batch
+   grey = load_image("data/GreyScale_generic.png")
+   onebit = load_image("data/OneBit_generic.png")
+   plugin.reset_stats()
+   # nothing is recorded while the statistics are switched off
+   grey.otsu_threshold()
+   assert plugin.stats() == {}
+   plugin.enable_stats(trace=True)
+   try:
+      for i in range(3):
+         grey.otsu_threshold()
+      ccs = onebit.cc_analysis()
+      black_area_batch(ccs)
+   finally:
+      plugin.enable_stats(False)
+   grey.otsu_threshold()
+   result = plugin.stats()
+   entry = result[("otsu_threshold", "GreyScale")]
+   assert entry["calls"] == 3
+   assert entry["pixels"] == 3 * grey.nrows * grey.ncols
+   # the onebit results use two bytes per pixel
+   assert entry["bytes"] == 3 * 2 * grey.nrows * grey.ncols
+   assert entry["wall_time"] >= 0.0 and entry["cpu_time"] >= 0.0
+   # the connected components share the image data with the argument
+   assert result[("cc_analysis", "OneBit")]["bytes"] == 0
+   entry = result[("black_area_batch", "OneBit")]
+   assert entry["calls"] == 1
+   assert entry["pixels"] == sum([cc.nrows * cc.ncols for cc in ccs])
+   trace = plugin.stats_trace()
+   assert [x[0] for x in trace] == ["otsu_threshold"] * 3 + \
+          ["cc_analysis", "black_area_batch"]
+   filename = os.path.join("tmp", "plugin_stats.json")
+   plugin.save_stats(filename)
+   plugin.save_stats(filename, "chrome")
+   plugin.reset_stats()
+   assert plugin.stats() == {} and plugin.stats_trace() == []
+
+def test_stats_thread_cpu_time():
+   # the CPU time of a call is that of its own thread; two threads run
+   # the plugin at the same time (with the GIL released), and each call
+   # must not be charged the CPU time of the other one as well
+   import threading, time
+   grey = load_image("data/GreyScale_generic.png")
+   big = grey.resize(Dim(grey.ncols * 4, grey.nrows * 4), 0).to_grey16()
+   def work():
+      for i in range(10):
+         big.rank(41, 9)
+   threads = [threading.Thread(target=work) for i in range(2)]
+   plugin.reset_stats()
+   plugin.enable_stats()
+   try:
+      start = time.clock()
+      for thread in threads:
+         thread.start()
+      for thread in threads:
+         thread.join()
+      used = time.clock() - start
+   finally:
+      plugin.enable_stats(False)
+   entry = plugin.stats()[("rank", "Grey16")]
+   plugin.reset_stats()
+   assert entry["calls"] == 20
+   assert entry["cpu_time"] <= 1.25 * used + 0.02
@@ -0,0 +1,32 @@
+import py.test
+
+from gamera.core import *
+init_gamera()
+
+def test_estimate_skew():
+   image = load_image("data/reading_order.png")
+   for angle in [0.0, 1.3, -2.0]:
+      if angle:
+         rotated = image.rotate(angle, 0, 1)
+      else:
+         rotated = image
+      skew, accuracy = rotated.estimate_skew()
+      assert abs(skew + angle) < 0.1
+      assert accuracy < 0.1
+      # same criterion as rotation_angle_projections
+      assert abs(skew - rotated.rotation_angle_projections()[0]) < 0.1
+   py.test.raises(Exception, image.estimate_skew, 2.0, 1.0)
+
+def test_estimate_skew_interval_end():
+   # like rotation_angle_projections, a maximum on the interval end is
+   # an error rather than a skew angle
+   image = load_image("data/reading_order.png")
+   rotated = image.rotate(2.0, 0, 1)
+   py.test.raises(RuntimeError, rotated.estimate_skew, -1.5, 1.5)
+   py.test.raises(RuntimeError, Image((0, 0), Dim(200, 100)).estimate_skew)
+   # the sheared runs are projected like their pixels, so that long
+   # runs do not pull the estimate to the interval end
+   skew = image.resize(Dim(image.ncols * 4, image.nrows * 4), 0).estimate_skew()[0]
+   assert abs(skew) < 0.1
+   skew = load_image("data/OneBit_generic.png").estimate_skew()[0]
+   assert -2.5 < skew < 2.5
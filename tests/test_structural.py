@@ -0,0 +1,28 @@
+import py.test
+
+from gamera.core import *
+init_gamera()
+from gamera.plugins.structural import bounding_box_radius_query
+
+def _box_distance(glyph, p):
+   dx = max(glyph.ul_x - p.x, p.x - glyph.lr_x, 0)
+   dy = max(glyph.ul_y - p.y, p.y - glyph.lr_y, 0)
+   return (dx * dx + dy * dy) ** 0.5
+
+def test_bounding_box_radius_query():
+   # the grid index must find the same glyphs as testing all glyphs
+   image = load_image("data/testline.png")
+   ccs = image.cc_analysis()
+   points = [cc.center for cc in ccs[::3]] + \
+            [Point(0, 0), Point(image.ncols + 40, image.nrows / 2)]
+   for radius in [0.0, 2.5, 15.0, 100.0]:
+      result = bounding_box_radius_query(ccs, points, radius)
+      assert len(result) == len(points)
+      for p, indices in zip(points, result):
+         expected = [i for i, cc in enumerate(ccs)
+                     if _box_distance(cc, p) <= radius]
+         assert indices == expected
+   # a point inside a bounding box finds at least that glyph
+   assert 0 in bounding_box_radius_query(ccs, [ccs[0].center], 0.0)[0]
+   assert bounding_box_radius_query([], points, 10.0) == [[]] * len(points)
+   py.test.raises(RuntimeError, bounding_box_radius_query, ccs, points, -1.0)
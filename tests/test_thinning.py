@@ -0,0 +1,21 @@
+from gamera.core import *
+init_gamera()
+
+def _has_black_square(image):
+   for y in range(image.nrows - 1):
+      for x in range(image.ncols - 1):
+         if image.get((x, y)) and image.get((x + 1, y)) and \
+            image.get((x, y + 1)) and image.get((x + 1, y + 1)):
+            return True
+   return False
+
+def test_thinning():
+   image = Image((0, 0), Dim(40, 30))
+   image.draw_filled_rect((3, 5), (35, 14), 1)
+   image.draw_filled_rect((15, 5), (24, 27), 1)
+   for thinned in [image.thin_zs(), image.thin_hs(), image.thin_lc()]:
+      assert thinned.dim == image.dim
+      assert 0 < thinned.black_area()[0] < image.black_area()[0] / 4
+      assert not _has_black_square(thinned)
+      # the skeleton lies inside the shape
+      assert thinned.subtract_images(image).black_area()[0] == 0
@@ -0,0 +1,42 @@
+import py.test
+
+from gamera.core import *
+init_gamera()
+
+def _pixels(image):
+   return [image.get((x, y)) for y in range(image.nrows)
+           for x in range(image.ncols)]
+
+def test_quarter_turns():
+   for filename in ["data/OneBit_generic.png", "data/GreyScale_generic.tiff"]:
+      image = load_image(filename)
+      turned = image.rotate(90.0, None, 1)
+      assert turned.ncols == image.nrows and turned.nrows == image.ncols
+      for y in range(0, image.nrows, 3):
+         for x in range(0, image.ncols, 3):
+            assert turned.get((image.nrows - 1 - y, x)) == image.get((x, y))
+      # four quarter turns give the original image again
+      for order in [0, 3]:
+         result = image
+         for i in range(4):
+            result = result.rotate(-270.0, None, order)
+         assert _pixels(result) == _pixels(image)
+      # half turn is the same as mirroring in both directions
+      mirrored = image.image_copy()
+      mirrored.mirror_horizontal()
+      mirrored.mirror_vertical()
+      assert _pixels(image.rotate(180.0, None, 1)) == _pixels(mirrored)
+
+def test_shear_rotation():
+   image = load_image("data/OneBit_generic.png")
+   for angle in [2.5, -30.0, 100.0]:
+      sheared = image.rotate(angle, None, 0)
+      interpolated = image.rotate(angle, None, 1)
+      assert sheared.dim == interpolated.dim
+      # shears only move pixels, so none get lost or added
+      assert sheared.black_area()[0] == image.black_area()[0]
+      # and the result differs from the interpolated one at the
+      # stroke borders only
+      diff = sheared.xor_image(interpolated, False)
+      assert diff.black_area()[0] < 0.2 * image.black_area()[0]
+   py.test.raises(Exception, image.rotate, 10.0, None, 4)
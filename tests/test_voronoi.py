@@ -87,3 +87,66 @@ def test_delaunay_triangulation():
     assert [2, 3] in edges
     assert [2, 4] in edges
     assert [3, 4] in edges
+
+def test_delaunay_sweephull():
+    # same as above, but with the sweep hull triangulation
+    points = [(50,50),(25,100),(50,150),(150,60),(150,125)]
+    edges = delaunay_from_points(points,range(len(points)),1)
+    assert len(edges) == 7
+    assert [0,1] in edges
+    assert [0,2] in edges
+    assert [0,3] in edges
+    assert [0,4] in edges
+    assert [1,2] in edges
+    assert [2,4] in edges
+    assert [3,4] in edges
+    # some doublettes
+    labels = [0,1,2,3,3]
+    edges = delaunay_from_points(points,labels,1)
+    assert len(edges) == 5
+    assert [0,1] in edges
+    assert [0,2] in edges
+    assert [0,3] in edges
+    assert [1,2] in edges
+    assert [2,3] in edges
+    # collinear edge resolution
+    points = [(50,50),(50,100),(50,150),(50,200),(150,125)]
+    edges = delaunay_from_points(points,range(len(points)),1)
+    assert len(edges) == 7
+    assert [0, 1] in edges
+    assert [0, 4] in edges
+    assert [1, 2] in edges
+    assert [1, 4] in edges
+    assert [2, 3] in edges
+    assert [2, 4] in edges
+    assert [3, 4] in edges
+    # both methods must agree on points in general position; the
+    # coordinates are spread so that no four points are cocircular
+    points = [((i * 104729) % 100003, (i * i * 7919) % 100019)
+              for i in range(1, 301)]
+    labels = range(len(points))
+    edges1 = delaunay_from_points(points,labels,0)
+    edges2 = delaunay_from_points(points,labels,1)
+    edges1.sort()
+    assert edges1 == edges2
+    # duplicate points are an error
+    py.test.raises(Exception, delaunay_from_points, [(1,1),(5,1),(1,1),(3,7)], range(4), 1)
+
+def test_delaunay_sweephull_collinear():
+    # a grid has many collinear points on the hull and cocircular
+    # points inside; any triangulation of n points with h points on the
+    # hull has 3n-3-h edges
+    points = [(x * 10, y * 10) for x in range(6) for y in range(5)]
+    edges = delaunay_from_points(points,range(len(points)),1)
+    assert len(edges) == 3 * 30 - 3 - 18
+    for i in range(len(points)):
+        assert [e for e in edges if i in e]
+    # points on the edges of the seed triangle and of the hull
+    points = [(0,0),(100,0),(50,80),(50,0),(25,40),(75,40),(25,0),(75,0)]
+    edges = delaunay_from_points(points,range(len(points)),1)
+    assert len(edges) == 3 * 8 - 3 - 8
+    assert [0, 6] in edges
+    assert [3, 6] in edges
+    assert [3, 7] in edges
+    assert [1, 7] in edges
+    assert [0, 3] not in edges